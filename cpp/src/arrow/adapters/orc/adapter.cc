@@ -18,10 +18,15 @@
 #include "arrow/adapters/orc/adapter.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <deque>
+#include <functional>
 #include <list>
+#include <map>
 #include <memory>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <utility>
 #include <vector>
@@ -39,8 +44,11 @@
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/future.h"
 #include "arrow/util/lazy.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread-pool.h"
 #include "arrow/util/visibility.h"
 
 #include "orc/Exceptions.hh"
@@ -102,6 +110,7 @@ struct StripeInformation {
   uint64_t offset;
   uint64_t length;
   uint64_t num_rows;
+  uint64_t first_row;
 };
 
 Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out) {
@@ -211,12 +220,373 @@ Status GetArrowType(const liborc::Type* type, std::shared_ptr<DataType>* out) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// ORCPredicate
+
+using Literal = ORCPredicate::Literal;
+
+Literal::Literal(bool value) : kind_(BOOL), integer_value_(value ? 1 : 0) {}
+
+Literal::Literal(int32_t value) : kind_(INTEGER), integer_value_(value) {}
+
+Literal::Literal(int64_t value) : kind_(INTEGER), integer_value_(value) {}
+
+Literal::Literal(float value) : kind_(FLOATING), floating_value_(value) {}
+
+Literal::Literal(double value) : kind_(FLOATING), floating_value_(value) {}
+
+Literal::Literal(const char* value) : kind_(BYTES), bytes_value_(value) {}
+
+Literal::Literal(const std::string& value) : kind_(BYTES), bytes_value_(value) {}
+
+std::string Literal::ToString() const {
+  std::stringstream ss;
+  switch (kind_) {
+    case BOOL:
+      ss << (bool_value() ? "true" : "false");
+      break;
+    case INTEGER:
+      ss << integer_value_;
+      break;
+    case FLOATING:
+      ss << floating_value_;
+      break;
+    case BYTES:
+      ss << '"' << bytes_value_ << '"';
+      break;
+  }
+  return ss.str();
+}
+
+namespace {
+
+const char* OperatorToString(ORCPredicate::Operator op) {
+  switch (op) {
+    case ORCPredicate::EQUAL:
+      return "==";
+    case ORCPredicate::NOT_EQUAL:
+      return "!=";
+    case ORCPredicate::LESS:
+      return "<";
+    case ORCPredicate::LESS_EQUAL:
+      return "<=";
+    case ORCPredicate::GREATER:
+      return ">";
+    case ORCPredicate::GREATER_EQUAL:
+      return ">=";
+  }
+  return "?";
+}
+
+// Whether data whose non-null values all lie in [min, max] may hold a value v
+// with "v op value"
+template <typename T>
+bool RangeMayMatch(ORCPredicate::Operator op, const T& min, const T& max,
+                   const T& value) {
+  switch (op) {
+    case ORCPredicate::EQUAL:
+      return !(value < min) && !(max < value);
+    case ORCPredicate::NOT_EQUAL:
+      // Only data holding nothing but value is ruled out
+      return min < value || value < max;
+    case ORCPredicate::LESS:
+      return min < value;
+    case ORCPredicate::LESS_EQUAL:
+      return !(value < min);
+    case ORCPredicate::GREATER:
+      return value < max;
+    case ORCPredicate::GREATER_EQUAL:
+      return !(max < value);
+  }
+  return true;
+}
+
+Status CannotCompare(int field_index, const Literal& value) {
+  return Status::Invalid("Cannot compare field ", field_index, " with literal ",
+                         value.ToString());
+}
+
+// Check "field op value" against the statistics of a field
+Status StatisticsMayMatch(int field_index, const liborc::ColumnStatistics* stats,
+                          ORCPredicate::Operator op, const Literal& value,
+                          bool* may_match) {
+  *may_match = true;
+  if (stats == nullptr) {
+    return Status::OK();
+  }
+  if (auto int_stats = dynamic_cast<const liborc::IntegerColumnStatistics*>(stats)) {
+    if (value.kind() != Literal::INTEGER && value.kind() != Literal::FLOATING) {
+      return CannotCompare(field_index, value);
+    }
+    if (int_stats->hasMinimum() && int_stats->hasMaximum()) {
+      if (value.kind() == Literal::INTEGER) {
+        *may_match = RangeMayMatch<int64_t>(op, int_stats->getMinimum(),
+                                            int_stats->getMaximum(),
+                                            value.integer_value());
+      } else if (!std::isnan(value.floating_value())) {
+        *may_match = RangeMayMatch<double>(
+            op, static_cast<double>(int_stats->getMinimum()),
+            static_cast<double>(int_stats->getMaximum()), value.floating_value());
+      }
+    }
+  } else if (auto double_stats =
+                 dynamic_cast<const liborc::DoubleColumnStatistics*>(stats)) {
+    if (value.kind() != Literal::INTEGER && value.kind() != Literal::FLOATING) {
+      return CannotCompare(field_index, value);
+    }
+    const double v = value.kind() == Literal::FLOATING
+                         ? value.floating_value()
+                         : static_cast<double>(value.integer_value());
+    if (double_stats->hasMinimum() && double_stats->hasMaximum() && !std::isnan(v) &&
+        !std::isnan(double_stats->getMinimum()) &&
+        !std::isnan(double_stats->getMaximum())) {
+      *may_match = RangeMayMatch<double>(op, double_stats->getMinimum(),
+                                         double_stats->getMaximum(), v);
+    }
+  } else if (auto string_stats =
+                 dynamic_cast<const liborc::StringColumnStatistics*>(stats)) {
+    if (value.kind() != Literal::BYTES) {
+      return CannotCompare(field_index, value);
+    }
+    if (string_stats->hasMinimum() && string_stats->hasMaximum()) {
+      *may_match = RangeMayMatch<std::string>(op, string_stats->getMinimum(),
+                                              string_stats->getMaximum(),
+                                              value.bytes_value());
+    }
+  } else if (auto bool_stats =
+                 dynamic_cast<const liborc::BooleanColumnStatistics*>(stats)) {
+    if (value.kind() != Literal::BOOL) {
+      return CannotCompare(field_index, value);
+    }
+    if (bool_stats->hasCount() &&
+        bool_stats->getFalseCount() + bool_stats->getTrueCount() > 0) {
+      // false < true
+      const int64_t min = bool_stats->getFalseCount() > 0 ? 0 : 1;
+      const int64_t max = bool_stats->getTrueCount() > 0 ? 1 : 0;
+      *may_match = RangeMayMatch<int64_t>(op, min, max, value.integer_value());
+    }
+  } else if (auto date_stats = dynamic_cast<const liborc::DateColumnStatistics*>(stats)) {
+    if (value.kind() != Literal::INTEGER) {
+      return CannotCompare(field_index, value);
+    }
+    if (date_stats->hasMinimum() && date_stats->hasMaximum()) {
+      *may_match = RangeMayMatch<int64_t>(op, date_stats->getMinimum(),
+                                          date_stats->getMaximum(),
+                                          value.integer_value());
+    }
+  } else {
+    // Other types are not supported
+    return Status::OK();
+  }
+  // Comparisons never hold for nulls
+  if (stats->getNumberOfValues() == 0) {
+    *may_match = false;
+  }
+  return Status::OK();
+}
+
+class ComparisonPredicate : public ORCPredicate {
+ public:
+  ComparisonPredicate(int field_index, Operator op, const Literal& value)
+      : field_index_(field_index), op_(op), value_(value) {}
+
+  Status MayMatch(const std::vector<const liborc::ColumnStatistics*>& statistics,
+                  bool* may_match) const override {
+    if (field_index_ < 0 || field_index_ >= static_cast<int>(statistics.size())) {
+      return Status::Invalid("Predicate field index ", field_index_,
+                             " is either < 0 or >= num_fields(", statistics.size(),
+                             ")");
+    }
+    return StatisticsMayMatch(field_index_, statistics[field_index_], op_, value_,
+                              may_match);
+  }
+
+  std::string ToString() const override {
+    std::stringstream ss;
+    ss << "field(" << field_index_ << ") " << OperatorToString(op_) << " "
+       << value_.ToString();
+    return ss.str();
+  }
+
+ private:
+  int field_index_;
+  Operator op_;
+  Literal value_;
+};
+
+class InPredicate : public ORCPredicate {
+ public:
+  InPredicate(int field_index, const std::vector<Literal>& values)
+      : field_index_(field_index), values_(values) {}
+
+  Status MayMatch(const std::vector<const liborc::ColumnStatistics*>& statistics,
+                  bool* may_match) const override {
+    *may_match = false;
+    for (const Literal& value : values_) {
+      ComparisonPredicate equal(field_index_, EQUAL, value);
+      bool value_may_match;
+      RETURN_NOT_OK(equal.MayMatch(statistics, &value_may_match));
+      *may_match = *may_match || value_may_match;
+    }
+    return Status::OK();
+  }
+
+  std::string ToString() const override {
+    std::stringstream ss;
+    ss << "field(" << field_index_ << ") in (";
+    for (size_t i = 0; i < values_.size(); ++i) {
+      ss << (i > 0 ? ", " : "") << values_[i].ToString();
+    }
+    ss << ")";
+    return ss.str();
+  }
+
+ private:
+  int field_index_;
+  std::vector<Literal> values_;
+};
+
+class ConjunctionPredicate : public ORCPredicate {
+ public:
+  ConjunctionPredicate(bool is_and, const std::shared_ptr<ORCPredicate>& lhs,
+                       const std::shared_ptr<ORCPredicate>& rhs)
+      : is_and_(is_and), lhs_(lhs), rhs_(rhs) {
+    DCHECK(lhs_ && rhs_);
+  }
+
+  Status MayMatch(const std::vector<const liborc::ColumnStatistics*>& statistics,
+                  bool* may_match) const override {
+    bool lhs_match, rhs_match;
+    // Both sides are always evaluated so that invalid predicates are reported
+    // regardless of the statistics
+    RETURN_NOT_OK(lhs_->MayMatch(statistics, &lhs_match));
+    RETURN_NOT_OK(rhs_->MayMatch(statistics, &rhs_match));
+    *may_match = is_and_ ? (lhs_match && rhs_match) : (lhs_match || rhs_match);
+    return Status::OK();
+  }
+
+  std::string ToString() const override {
+    return "(" + lhs_->ToString() + (is_and_ ? " and " : " or ") + rhs_->ToString() +
+           ")";
+  }
+
+ private:
+  bool is_and_;
+  std::shared_ptr<ORCPredicate> lhs_;
+  std::shared_ptr<ORCPredicate> rhs_;
+};
+
+}  // namespace
+
+std::shared_ptr<ORCPredicate> ORCPredicate::Compare(int field_index, Operator op,
+                                                    const Literal& value) {
+  return std::make_shared<ComparisonPredicate>(field_index, op, value);
+}
+
+std::shared_ptr<ORCPredicate> ORCPredicate::In(int field_index,
+                                               const std::vector<Literal>& values) {
+  return std::make_shared<InPredicate>(field_index, values);
+}
+
+std::shared_ptr<ORCPredicate> ORCPredicate::And(
+    const std::shared_ptr<ORCPredicate>& lhs, const std::shared_ptr<ORCPredicate>& rhs) {
+  return std::make_shared<ConjunctionPredicate>(true, lhs, rhs);
+}
+
+std::shared_ptr<ORCPredicate> ORCPredicate::Or(
+    const std::shared_ptr<ORCPredicate>& lhs, const std::shared_ptr<ORCPredicate>& rhs) {
+  return std::make_shared<ConjunctionPredicate>(false, lhs, rhs);
+}
+
+// ----------------------------------------------------------------------
+// ORCFileReader
+
 // The number of rows to read in a ColumnVectorBatch
 constexpr int64_t kReadRowsBatch = 1000;
 
 // The numer of nanoseconds in a second
 constexpr int64_t kOneSecondNanos = 1000000000LL;
 
+// Yields the record batches of some stripes in order, decoding the next
+// stripes on the CPU thread pool meanwhile
+class StripeRecordBatchReader : public RecordBatchReader {
+ public:
+  using StripeBatches = std::vector<std::shared_ptr<RecordBatch>>;
+  using ReadStripeFunction = std::function<Status(int64_t, StripeBatches*)>;
+
+  StripeRecordBatchReader(const std::shared_ptr<Schema>& schema,
+                          const std::vector<int64_t>& stripes, int max_concurrent_stripes,
+                          ReadStripeFunction read_stripe)
+      : schema_(schema),
+        stripes_(stripes),
+        max_concurrent_stripes_(max_concurrent_stripes),
+        read_stripe_(std::move(read_stripe)),
+        next_stripe_(0) {}
+
+  ~StripeRecordBatchReader() override {
+    // The decoding tasks refer to the file reader
+    for (const auto& stripe : pending_stripes_) {
+      stripe.Wait();
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    while (batches_.empty()) {
+      SubmitStripes();
+      if (pending_stripes_.empty()) {
+        // End of file
+        out->reset();
+        return Status::OK();
+      }
+      auto stripe = pending_stripes_.front();
+      pending_stripes_.pop_front();
+      StripeBatches batches;
+      RETURN_NOT_OK(stripe.Get(&batches));
+      batches_.assign(batches.begin(), batches.end());
+    }
+    *out = std::move(batches_.front());
+    batches_.pop_front();
+    return Status::OK();
+  }
+
+ private:
+  // Start decoding stripes until max_concurrent_stripes_ are pending
+  void SubmitStripes() {
+    auto pool = internal::GetCpuThreadPool();
+    // Decode in the calling thread when it belongs to the pool, whose
+    // workers could all end up waiting on stripes otherwise
+    const bool use_threads = max_concurrent_stripes_ > 1 && !pool->OwnsThisThread();
+    const size_t max_pending =
+        use_threads ? static_cast<size_t>(max_concurrent_stripes_) : 1;
+    while (pending_stripes_.size() < max_pending && next_stripe_ < stripes_.size()) {
+      const int64_t stripe = stripes_[next_stripe_++];
+      ReadStripeFunction read_stripe = read_stripe_;
+      auto task = [read_stripe, stripe](StripeBatches* out) {
+        return read_stripe(stripe, out);
+      };
+      if (use_threads) {
+        pending_stripes_.push_back(pool->SubmitAsync<StripeBatches>(std::move(task)));
+      } else {
+        StripeBatches batches;
+        Status st = task(&batches);
+        pending_stripes_.push_back(st.ok()
+                                       ? Future<StripeBatches>::MakeFinished(batches)
+                                       : Future<StripeBatches>::MakeFailed(st));
+      }
+    }
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::vector<int64_t> stripes_;
+  int max_concurrent_stripes_;
+  ReadStripeFunction read_stripe_;
+  size_t next_stripe_;
+  std::deque<Future<StripeBatches>> pending_stripes_;
+  std::deque<std::shared_ptr<RecordBatch>> batches_;
+};
+
 class ORCFileReader::Impl {
  public:
   Impl() {}
@@ -241,10 +611,12 @@ class ORCFileReader::Impl {
     int64_t nstripes = reader_->getNumberOfStripes();
     stripes_.resize(nstripes);
     std::unique_ptr<liborc::StripeInformation> stripe;
+    uint64_t first_row = 0;
     for (int i = 0; i < nstripes; ++i) {
       stripe = reader_->getStripe(i);
-      stripes_[i] = StripeInformation(
-          {stripe->getOffset(), stripe->getLength(), stripe->getNumberOfRows()});
+      stripes_[i] = StripeInformation({stripe->getOffset(), stripe->getLength(),
+                                       stripe->getNumberOfRows(), first_row});
+      first_row += stripe->getNumberOfRows();
     }
     return Status::OK();
   }
@@ -399,6 +771,223 @@ class ORCFileReader::Impl {
     return Status::OK();
   }
 
+  Status GetRecordBatchReader(const liborc::RowReaderOptions& opts,
+                              const std::shared_ptr<ORCPredicate>& predicate,
+                              const ORCReadOptions& options,
+                              std::shared_ptr<RecordBatchReader>* out) {
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(ReadSchema(opts, &schema));
+
+    // The row groups to read of each stripe, all of them if absent. The
+    // statistics are read here rather than by the concurrent decoding tasks
+    std::vector<int64_t> stripes;
+    auto stripe_rows = std::make_shared<std::map<int64_t, std::vector<RowRange>>>();
+    for (int64_t stripe = 0; stripe < NumberOfStripes(); ++stripe) {
+      if (predicate == nullptr) {
+        stripes.push_back(stripe);
+        continue;
+      }
+      std::vector<RowRange> ranges;
+      RETURN_NOT_OK(SelectRows(*predicate, stripe, &ranges));
+      if (!ranges.empty()) {
+        stripes.push_back(stripe);
+        (*stripe_rows)[stripe] = std::move(ranges);
+      }
+    }
+
+    const int64_t batch_size = options.batch_size;
+    auto read_stripe = [this, opts, schema, batch_size, stripe_rows](
+                           int64_t stripe,
+                           std::vector<std::shared_ptr<RecordBatch>>* batches) {
+      auto it = stripe_rows->find(stripe);
+      const std::vector<RowRange>* ranges =
+          it == stripe_rows->end() ? nullptr : &it->second;
+      return ReadStripeBatches(opts, schema, stripe, ranges, batch_size, batches);
+    };
+    *out = std::make_shared<StripeRecordBatchReader>(
+        schema, stripes, options.max_concurrent_stripes, read_stripe);
+    return Status::OK();
+  }
+
+  Status FilterStripes(const ORCPredicate& predicate, std::vector<int64_t>* stripes,
+                       int64_t* num_pruned) {
+    stripes->clear();
+    for (int64_t stripe = 0; stripe < NumberOfStripes(); ++stripe) {
+      std::vector<RowRange> ranges;
+      RETURN_NOT_OK(SelectRows(predicate, stripe, &ranges));
+      if (!ranges.empty()) {
+        stripes->push_back(stripe);
+      }
+    }
+    *num_pruned = NumberOfStripes() - static_cast<int64_t>(stripes->size());
+    return Status::OK();
+  }
+
+  // A range of rows of a stripe
+  struct RowRange {
+    int64_t offset;
+    int64_t length;
+  };
+
+  // The ORC column ids of the top-level fields
+  std::vector<uint32_t> FieldColumnIds() {
+    const liborc::Type& type = reader_->getType();
+    std::vector<uint32_t> column_ids;
+    for (uint64_t i = 0; i < type.getSubtypeCount(); ++i) {
+      column_ids.push_back(static_cast<uint32_t>(type.getSubtype(i)->getColumnId()));
+    }
+    return column_ids;
+  }
+
+  // Read the statistics of a stripe and its row index, null if the file has
+  // no statistics
+  Status GetStripeStatistics(int64_t stripe,
+                             std::unique_ptr<liborc::StripeStatistics>* out) {
+    try {
+      *out = reader_->getStripeStatistics(static_cast<uint64_t>(stripe));
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    } catch (const std::logic_error&) {
+      out->reset();
+    }
+    return Status::OK();
+  }
+
+  // Select the row groups of a stripe whose statistics do not rule out
+  // predicate, as ranges of consecutive rows. None if the stripe is ruled out
+  Status SelectRows(const ORCPredicate& predicate, int64_t stripe,
+                    std::vector<RowRange>* ranges) {
+    const int64_t nrows = stripes_[stripe].num_rows;
+    ranges->clear();
+    std::unique_ptr<liborc::StripeStatistics> stats;
+    RETURN_NOT_OK(GetStripeStatistics(stripe, &stats));
+    if (stats == nullptr) {
+      ranges->push_back({0, nrows});
+      return Status::OK();
+    }
+
+    const std::vector<uint32_t> column_ids = FieldColumnIds();
+    std::vector<const liborc::ColumnStatistics*> field_stats(column_ids.size());
+    for (size_t i = 0; i < column_ids.size(); ++i) {
+      field_stats[i] = stats->getColumnStatistics(column_ids[i]);
+    }
+    bool may_match = true;
+    RETURN_NOT_OK(predicate.MayMatch(field_stats, &may_match));
+    if (!may_match) {
+      return Status::OK();
+    }
+
+    // Without a complete row index, the whole stripe is read
+    const int64_t stride = static_cast<int64_t>(reader_->getRowIndexStride());
+    const int64_t num_row_groups = stride > 0 ? (nrows + stride - 1) / stride : 0;
+    bool has_row_index = num_row_groups > 0 && !column_ids.empty();
+    for (uint32_t column_id : column_ids) {
+      if (stats->getNumberOfRowIndexStats(column_id) != num_row_groups) {
+        has_row_index = false;
+      }
+    }
+    if (!has_row_index) {
+      ranges->push_back({0, nrows});
+      return Status::OK();
+    }
+
+    for (int64_t row_group = 0; row_group < num_row_groups; ++row_group) {
+      for (size_t i = 0; i < column_ids.size(); ++i) {
+        field_stats[i] = stats->getRowIndexStatistics(
+            column_ids[i], static_cast<uint32_t>(row_group));
+      }
+      RETURN_NOT_OK(predicate.MayMatch(field_stats, &may_match));
+      if (!may_match) {
+        continue;
+      }
+      const int64_t offset = row_group * stride;
+      const int64_t length = std::min(stride, nrows - offset);
+      if (!ranges->empty() && ranges->back().offset + ranges->back().length == offset) {
+        ranges->back().length += length;
+      } else {
+        ranges->push_back({offset, length});
+      }
+    }
+    return Status::OK();
+  }
+
+  // Read rows of a stripe, all of them if ranges is null, as record batches
+  // of at most batch_size rows
+  Status ReadStripeBatches(const liborc::RowReaderOptions& row_opts,
+                           const std::shared_ptr<Schema>& schema, int64_t stripe,
+                           const std::vector<RowRange>* ranges, int64_t batch_size,
+                           std::vector<std::shared_ptr<RecordBatch>>* out) {
+    liborc::RowReaderOptions opts(row_opts);
+    RETURN_NOT_OK(SelectStripe(&opts, stripe));
+    const int64_t nrows = stripes_[stripe].num_rows;
+    const std::vector<RowRange> all_rows = {{0, nrows}};
+    if (ranges == nullptr) {
+      ranges = &all_rows;
+    }
+    batch_size = std::max<int64_t>(1, std::min(batch_size, nrows));
+
+    std::unique_ptr<liborc::RowReader> rowreader;
+    std::unique_ptr<liborc::ColumnVectorBatch> batch;
+    try {
+      rowreader = reader_->createRowReader(opts);
+      batch = rowreader->createRowBatch(std::min(batch_size, kReadRowsBatch));
+    } catch (const liborc::ParseError& e) {
+      return Status::Invalid(e.what());
+    }
+    std::unique_ptr<RecordBatchBuilder> builder;
+    RETURN_NOT_OK(RecordBatchBuilder::Make(schema, pool_, batch_size, &builder));
+
+    // The top-level type must be a struct to read into an arrow table
+    const auto& struct_batch = checked_cast<liborc::StructVectorBatch&>(*batch);
+
+    const liborc::Type& type = rowreader->getSelectedType();
+    out->clear();
+    int64_t builder_rows = 0;
+    // The row of the stripe the row reader is at
+    int64_t position = 0;
+    for (const RowRange& range : *ranges) {
+      if (range.offset != position) {
+        try {
+          rowreader->seekToRow(stripes_[stripe].first_row + range.offset);
+        } catch (const liborc::ParseError& e) {
+          return Status::Invalid(e.what());
+        }
+        position = range.offset;
+      }
+      int64_t remaining = range.length;
+      while (remaining > 0 && rowreader->next(*batch)) {
+        // Rows read past the range are dropped
+        const int64_t length =
+            std::min(static_cast<int64_t>(batch->numElements), remaining);
+        position += static_cast<int64_t>(batch->numElements);
+        remaining -= length;
+        int64_t offset = 0;
+        while (offset < length) {
+          // Split the ORC batch where a record batch is full
+          const int64_t chunk = std::min(length - offset, batch_size - builder_rows);
+          for (int i = 0; i < builder->num_fields(); i++) {
+            RETURN_NOT_OK(AppendBatch(type.getSubtype(i), struct_batch.fields[i],
+                                      offset, chunk, builder->GetField(i)));
+          }
+          offset += chunk;
+          builder_rows += chunk;
+          if (builder_rows == batch_size) {
+            std::shared_ptr<RecordBatch> record_batch;
+            RETURN_NOT_OK(builder->Flush(&record_batch));
+            out->push_back(std::move(record_batch));
+            builder_rows = 0;
+          }
+        }
+      }
+    }
+    if (builder_rows > 0) {
+      std::shared_ptr<RecordBatch> record_batch;
+      RETURN_NOT_OK(builder->Flush(&record_batch));
+      out->push_back(std::move(record_batch));
+    }
+    return Status::OK();
+  }
+
   Status AppendBatch(const liborc::Type* type, liborc::ColumnVectorBatch* batch,
                      int64_t offset, int64_t length, ArrayBuilder* builder) {
     if (type == nullptr) {
@@ -721,10 +1310,436 @@ Status ORCFileReader::ReadStripe(int64_t stripe, const std::vector<int>& include
   return impl_->ReadStripe(stripe, include_indices, out);
 }
 
+Status ORCFileReader::GetRecordBatchReader(const ORCReadOptions& options,
+                                           std::shared_ptr<RecordBatchReader>* out) {
+  return impl_->GetRecordBatchReader(liborc::RowReaderOptions(), nullptr, options, out);
+}
+
+Status ORCFileReader::GetRecordBatchReader(const std::vector<int>& include_indices,
+                                           const ORCReadOptions& options,
+                                           std::shared_ptr<RecordBatchReader>* out) {
+  liborc::RowReaderOptions opts;
+  RETURN_NOT_OK(impl_->SelectIndices(&opts, include_indices));
+  return impl_->GetRecordBatchReader(opts, nullptr, options, out);
+}
+
+Status ORCFileReader::GetRecordBatchReader(const std::vector<int>& include_indices,
+                                           const std::shared_ptr<ORCPredicate>& predicate,
+                                           const ORCReadOptions& options,
+                                           std::shared_ptr<RecordBatchReader>* out) {
+  liborc::RowReaderOptions opts;
+  RETURN_NOT_OK(impl_->SelectIndices(&opts, include_indices));
+  return impl_->GetRecordBatchReader(opts, predicate, options, out);
+}
+
+Status ORCFileReader::FilterStripes(const ORCPredicate& predicate,
+                                    std::vector<int64_t>* stripes, int64_t* num_pruned) {
+  return impl_->FilterStripes(predicate, stripes, num_pruned);
+}
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
 
+// ----------------------------------------------------------------------
+// ORCFileWriter
+
+class ArrowOutputStream : public liborc::OutputStream {
+ public:
+  explicit ArrowOutputStream(const std::shared_ptr<io::OutputStream>& output)
+      : output_(output), length_(0) {}
+
+  uint64_t getLength() const override { return length_; }
+
+  uint64_t getNaturalWriteSize() const override { return 128 * 1024; }
+
+  void write(const void* buf, size_t length) override {
+    ORC_THROW_NOT_OK(output_->Write(buf, static_cast<int64_t>(length)));
+    length_ += static_cast<uint64_t>(length);
+  }
+
+  const std::string& getName() const override {
+    static const std::string filename("ArrowOutputFile");
+    return filename;
+  }
+
+  // The output stream belongs to the caller
+  void close() override { ORC_THROW_NOT_OK(output_->Flush()); }
+
+ private:
+  std::shared_ptr<io::OutputStream> output_;
+  uint64_t length_;
+};
+
+Status GetORCType(const DataType& type, std::unique_ptr<liborc::Type>* out) {
+  switch (type.id()) {
+    case Type::BOOL:
+      *out = liborc::createPrimitiveType(liborc::BOOLEAN);
+      break;
+    case Type::INT8:
+      *out = liborc::createPrimitiveType(liborc::BYTE);
+      break;
+    case Type::INT16:
+      *out = liborc::createPrimitiveType(liborc::SHORT);
+      break;
+    case Type::INT32:
+      *out = liborc::createPrimitiveType(liborc::INT);
+      break;
+    case Type::INT64:
+      *out = liborc::createPrimitiveType(liborc::LONG);
+      break;
+    case Type::FLOAT:
+      *out = liborc::createPrimitiveType(liborc::FLOAT);
+      break;
+    case Type::DOUBLE:
+      *out = liborc::createPrimitiveType(liborc::DOUBLE);
+      break;
+    case Type::STRING:
+      *out = liborc::createPrimitiveType(liborc::STRING);
+      break;
+    case Type::BINARY:
+    case Type::FIXED_SIZE_BINARY:
+      *out = liborc::createPrimitiveType(liborc::BINARY);
+      break;
+    case Type::DATE32:
+      *out = liborc::createPrimitiveType(liborc::DATE);
+      break;
+    case Type::TIMESTAMP:
+      *out = liborc::createPrimitiveType(liborc::TIMESTAMP);
+      break;
+    case Type::DECIMAL: {
+      const auto& decimal_type = checked_cast<const Decimal128Type&>(type);
+      *out = liborc::createDecimalType(static_cast<uint64_t>(decimal_type.precision()),
+                                       static_cast<uint64_t>(decimal_type.scale()));
+      break;
+    }
+    case Type::LIST: {
+      std::unique_ptr<liborc::Type> value_type;
+      RETURN_NOT_OK(
+          GetORCType(*checked_cast<const ListType&>(type).value_type(), &value_type));
+      *out = liborc::createListType(std::move(value_type));
+      break;
+    }
+    case Type::STRUCT: {
+      *out = liborc::createStructType();
+      for (const auto& child : type.children()) {
+        std::unique_ptr<liborc::Type> child_type;
+        RETURN_NOT_OK(GetORCType(*child->type(), &child_type));
+        (*out)->addStructField(child->name(), std::move(child_type));
+      }
+      break;
+    }
+    default:
+      return Status::NotImplemented("Writing type ", type.ToString(), " to ORC");
+  }
+  return Status::OK();
+}
+
+Status GetORCCompression(Compression::type compression, liborc::CompressionKind* out) {
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      *out = liborc::CompressionKind_NONE;
+      break;
+    case Compression::GZIP:
+      *out = liborc::CompressionKind_ZLIB;
+      break;
+    case Compression::SNAPPY:
+      *out = liborc::CompressionKind_SNAPPY;
+      break;
+    case Compression::LZ4:
+      *out = liborc::CompressionKind_LZ4;
+      break;
+    case Compression::LZO:
+      *out = liborc::CompressionKind_LZO;
+      break;
+    case Compression::ZSTD:
+      *out = liborc::CompressionKind_ZSTD;
+      break;
+    default:
+      return Status::NotImplemented("Compression ", static_cast<int>(compression),
+                                    " is not supported by ORC");
+  }
+  return Status::OK();
+}
+
+// The number of rows to write in a ColumnVectorBatch
+constexpr int64_t kWriteRowsBatch = 1024;
+
+class ORCFileWriter::Impl {
+ public:
+  Status Open(const std::shared_ptr<Schema>& schema,
+              const std::shared_ptr<io::OutputStream>& sink,
+              const ORCWriteOptions& options) {
+    schema_ = schema;
+    RETURN_NOT_OK(GetORCType(*struct_(schema->fields()), &orc_type_));
+
+    liborc::CompressionKind compression;
+    RETURN_NOT_OK(GetORCCompression(options.compression, &compression));
+    liborc::WriterOptions orc_options;
+    orc_options.setStripeSize(static_cast<uint64_t>(options.stripe_size));
+    orc_options.setCompression(compression);
+    orc_options.setCompressionBlockSize(
+        static_cast<uint64_t>(options.compression_block_size));
+    orc_options.setDictionaryKeySizeThreshold(options.dictionary_key_size_threshold);
+    orc_options.setRowIndexStride(static_cast<uint64_t>(options.row_index_stride));
+
+    output_.reset(new ArrowOutputStream(sink));
+    try {
+      // The writer refers to the type
+      writer_ = liborc::createWriter(*orc_type_, output_.get(), orc_options);
+      batch_ = writer_->createRowBatch(kWriteRowsBatch);
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    } catch (const std::exception& e) {
+      return Status::Invalid(e.what());
+    }
+    return Status::OK();
+  }
+
+  Status Write(const RecordBatch& batch) {
+    if (!batch.schema()->Equals(*schema_, false)) {
+      return Status::Invalid("Record batch schema ", batch.schema()->ToString(),
+                             " differs from the schema of the ORC file ",
+                             schema_->ToString());
+    }
+    auto& struct_batch = checked_cast<liborc::StructVectorBatch&>(*batch_);
+    for (int64_t offset = 0; offset < batch.num_rows(); offset += kWriteRowsBatch) {
+      const int64_t length = std::min(batch.num_rows() - offset, kWriteRowsBatch);
+      for (int i = 0; i < batch.num_columns(); i++) {
+        RETURN_NOT_OK(
+            FillBatch(*batch.column(i), offset, length, struct_batch.fields[i]));
+      }
+      struct_batch.numElements = length;
+      struct_batch.hasNulls = false;
+      try {
+        writer_->add(*batch_);
+      } catch (const liborc::ParseError& e) {
+        return Status::IOError(e.what());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Close() {
+    try {
+      writer_->close();
+    } catch (const liborc::ParseError& e) {
+      return Status::IOError(e.what());
+    }
+    return Status::OK();
+  }
+
+ private:
+  // Fill a column batch with length values of array from offset. String and
+  // binary values point into the Arrow buffers
+  Status FillBatch(const Array& array, int64_t offset, int64_t length,
+                   liborc::ColumnVectorBatch* batch) {
+    if (batch->capacity < static_cast<uint64_t>(length)) {
+      batch->resize(static_cast<uint64_t>(length));
+    }
+    batch->numElements = length;
+    batch->hasNulls = array.null_count() > 0;
+    if (batch->hasNulls) {
+      char* not_null = batch->notNull.data();
+      for (int64_t i = 0; i < length; i++) {
+        not_null[i] = array.IsValid(offset + i) ? 1 : 0;
+      }
+    }
+
+    switch (array.type_id()) {
+      case Type::BOOL: {
+        const auto& bool_array = checked_cast<const BooleanArray&>(array);
+        int64_t* data = checked_cast<liborc::LongVectorBatch*>(batch)->data.data();
+        for (int64_t i = 0; i < length; i++) {
+          data[i] = bool_array.Value(offset + i) ? 1 : 0;
+        }
+        break;
+      }
+      case Type::INT8:
+        FillLongBatch<Int8Type>(array, offset, length, batch);
+        break;
+      case Type::INT16:
+        FillLongBatch<Int16Type>(array, offset, length, batch);
+        break;
+      case Type::INT32:
+        FillLongBatch<Int32Type>(array, offset, length, batch);
+        break;
+      case Type::INT64:
+        FillLongBatch<Int64Type>(array, offset, length, batch);
+        break;
+      case Type::DATE32:
+        FillLongBatch<Date32Type>(array, offset, length, batch);
+        break;
+      case Type::FLOAT:
+        FillDoubleBatch<FloatType>(array, offset, length, batch);
+        break;
+      case Type::DOUBLE:
+        FillDoubleBatch<DoubleType>(array, offset, length, batch);
+        break;
+      case Type::STRING:
+      case Type::BINARY: {
+        const auto& binary_array = checked_cast<const BinaryArray&>(array);
+        auto string_batch = checked_cast<liborc::StringVectorBatch*>(batch);
+        for (int64_t i = 0; i < length; i++) {
+          int32_t value_length = 0;
+          const uint8_t* value = binary_array.GetValue(offset + i, &value_length);
+          string_batch->data[i] = reinterpret_cast<char*>(const_cast<uint8_t*>(value));
+          string_batch->length[i] = value_length;
+        }
+        break;
+      }
+      case Type::FIXED_SIZE_BINARY: {
+        const auto& binary_array = checked_cast<const FixedSizeBinaryArray&>(array);
+        auto string_batch = checked_cast<liborc::StringVectorBatch*>(batch);
+        for (int64_t i = 0; i < length; i++) {
+          const uint8_t* value = binary_array.GetValue(offset + i);
+          string_batch->data[i] = reinterpret_cast<char*>(const_cast<uint8_t*>(value));
+          string_batch->length[i] = binary_array.byte_width();
+        }
+        break;
+      }
+      case Type::TIMESTAMP:
+        FillTimestampBatch(array, offset, length, batch);
+        break;
+      case Type::DECIMAL:
+        FillDecimalBatch(array, offset, length, batch);
+        break;
+      case Type::LIST: {
+        const auto& list_array = checked_cast<const ListArray&>(array);
+        auto list_batch = checked_cast<liborc::ListVectorBatch*>(batch);
+        const int64_t values_offset = list_array.value_offset(offset);
+        int64_t* offsets = list_batch->offsets.data();
+        for (int64_t i = 0; i <= length; i++) {
+          offsets[i] = list_array.value_offset(offset + i) - values_offset;
+        }
+        RETURN_NOT_OK(FillBatch(*list_array.values(), values_offset, offsets[length],
+                                list_batch->elements.get()));
+        break;
+      }
+      case Type::STRUCT: {
+        const auto& struct_array = checked_cast<const StructArray&>(array);
+        auto struct_batch = checked_cast<liborc::StructVectorBatch*>(batch);
+        for (int i = 0; i < struct_array.num_fields(); i++) {
+          RETURN_NOT_OK(FillBatch(*struct_array.field(i), offset, length,
+                                  struct_batch->fields[i]));
+        }
+        break;
+      }
+      default:
+        return Status::NotImplemented("Writing type ", array.type()->ToString(),
+                                      " to ORC");
+    }
+    return Status::OK();
+  }
+
+  template <typename ArrowType>
+  void FillLongBatch(const Array& array, int64_t offset, int64_t length,
+                     liborc::ColumnVectorBatch* batch) {
+    const auto* values =
+        checked_cast<const NumericArray<ArrowType>&>(array).raw_values() + offset;
+    int64_t* data = checked_cast<liborc::LongVectorBatch*>(batch)->data.data();
+    std::copy(values, values + length, data);
+  }
+
+  template <typename ArrowType>
+  void FillDoubleBatch(const Array& array, int64_t offset, int64_t length,
+                       liborc::ColumnVectorBatch* batch) {
+    const auto* values =
+        checked_cast<const NumericArray<ArrowType>&>(array).raw_values() + offset;
+    double* data = checked_cast<liborc::DoubleVectorBatch*>(batch)->data.data();
+    std::copy(values, values + length, data);
+  }
+
+  void FillTimestampBatch(const Array& array, int64_t offset, int64_t length,
+                          liborc::ColumnVectorBatch* batch) {
+    const auto& timestamp_array = checked_cast<const TimestampArray&>(array);
+    int64_t units_per_second = 1;
+    switch (checked_cast<const TimestampType&>(*array.type()).unit()) {
+      case TimeUnit::SECOND:
+        units_per_second = 1;
+        break;
+      case TimeUnit::MILLI:
+        units_per_second = 1000;
+        break;
+      case TimeUnit::MICRO:
+        units_per_second = 1000000;
+        break;
+      case TimeUnit::NANO:
+        units_per_second = kOneSecondNanos;
+        break;
+    }
+    const int64_t nanos_per_unit = kOneSecondNanos / units_per_second;
+    auto timestamp_batch = checked_cast<liborc::TimestampVectorBatch*>(batch);
+    for (int64_t i = 0; i < length; i++) {
+      const int64_t value = timestamp_array.Value(offset + i);
+      // Round the seconds down, so that the nanoseconds are non-negative
+      int64_t seconds = value / units_per_second;
+      int64_t units = value % units_per_second;
+      if (units < 0) {
+        --seconds;
+        units += units_per_second;
+      }
+      timestamp_batch->data[i] = seconds;
+      timestamp_batch->nanoseconds[i] = units * nanos_per_unit;
+    }
+  }
+
+  void FillDecimalBatch(const Array& array, int64_t offset, int64_t length,
+                        liborc::ColumnVectorBatch* batch) {
+    const auto& decimal_array = checked_cast<const Decimal128Array&>(array);
+    if (auto decimal64_batch = dynamic_cast<liborc::Decimal64VectorBatch*>(batch)) {
+      // Precision up to 18
+      for (int64_t i = 0; i < length; i++) {
+        const Decimal128 value(decimal_array.GetValue(offset + i));
+        decimal64_batch->values[i] = static_cast<int64_t>(value.low_bits());
+      }
+    } else {
+      auto decimal128_batch = checked_cast<liborc::Decimal128VectorBatch*>(batch);
+      for (int64_t i = 0; i < length; i++) {
+        const Decimal128 value(decimal_array.GetValue(offset + i));
+        decimal128_batch->values[i] = liborc::Int128(value.high_bits(), value.low_bits());
+      }
+    }
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::unique_ptr<liborc::Type> orc_type_;
+  std::unique_ptr<ArrowOutputStream> output_;
+  std::unique_ptr<liborc::Writer> writer_;
+  std::unique_ptr<liborc::ColumnVectorBatch> batch_;
+};
+
+ORCFileWriter::ORCFileWriter() { impl_.reset(new ORCFileWriter::Impl()); }
+
+ORCFileWriter::~ORCFileWriter() {}
+
+Status ORCFileWriter::Open(const std::shared_ptr<Schema>& schema,
+                           const std::shared_ptr<io::OutputStream>& sink,
+                           const ORCWriteOptions& options,
+                           std::unique_ptr<ORCFileWriter>* writer) {
+  auto result = std::unique_ptr<ORCFileWriter>(new ORCFileWriter());
+  RETURN_NOT_OK(result->impl_->Open(schema, sink, options));
+  *writer = std::move(result);
+  return Status::OK();
+}
+
+Status ORCFileWriter::Write(const RecordBatch& batch) { return impl_->Write(batch); }
+
+Status ORCFileWriter::Write(const Table& table) {
+  TableBatchReader reader(table);
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(impl_->Write(*batch));
+  }
+  return Status::OK();
+}
+
+Status ORCFileWriter::Close() { return impl_->Close(); }
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
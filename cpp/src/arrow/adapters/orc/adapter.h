@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/io/interfaces.h"
@@ -27,14 +28,114 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
+namespace orc {
+
+class ColumnStatistics;
+
+}  // namespace orc
+
 namespace arrow {
 
 namespace adapters {
 
 namespace orc {
 
+/// \brief A filter expression over top-level field values, used to skip
+/// stripes and row groups whose statistics show that no row can satisfy it.
+///
+/// Predicates are built from comparisons of a field against a literal and
+/// from IN lists, combined with And and Or, like parquet::arrow's
+/// RowGroupPredicate. Stripes are skipped using the stripe statistics, and
+/// row groups of the remaining stripes using the row index; the rows read
+/// are not filtered. Fields without statistics, and fields of other types
+/// than below, never cause data to be skipped:
+///
+/// * boolean fields take bool literals
+/// * integer and date fields take integer literals (days since the epoch for
+///   dates)
+/// * floating point fields take floating point or integer literals
+/// * string fields take string literals, compared bytewise
+class ARROW_EXPORT ORCPredicate {
+ public:
+  enum Operator { EQUAL, NOT_EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL };
+
+  /// \brief A typed constant to compare a field against
+  class ARROW_EXPORT Literal {
+   public:
+    enum Kind { BOOL, INTEGER, FLOATING, BYTES };
+
+    Literal(bool value);                // NOLINT implicit conversion
+    Literal(int32_t value);             // NOLINT implicit conversion
+    Literal(int64_t value);             // NOLINT implicit conversion
+    Literal(float value);               // NOLINT implicit conversion
+    Literal(double value);              // NOLINT implicit conversion
+    Literal(const char* value);         // NOLINT implicit conversion
+    Literal(const std::string& value);  // NOLINT implicit conversion
+
+    Kind kind() const { return kind_; }
+    bool bool_value() const { return integer_value_ != 0; }
+    int64_t integer_value() const { return integer_value_; }
+    double floating_value() const { return floating_value_; }
+    const std::string& bytes_value() const { return bytes_value_; }
+
+    std::string ToString() const;
+
+   private:
+    Kind kind_;
+    int64_t integer_value_ = 0;
+    double floating_value_ = 0;
+    std::string bytes_value_;
+  };
+
+  /// \brief Compare the top-level field field_index against value
+  static std::shared_ptr<ORCPredicate> Compare(int field_index, Operator op,
+                                               const Literal& value);
+
+  /// \brief Satisfied when the top-level field field_index equals any of
+  /// values
+  static std::shared_ptr<ORCPredicate> In(int field_index,
+                                          const std::vector<Literal>& values);
+
+  /// \brief Satisfied when both lhs and rhs are
+  static std::shared_ptr<ORCPredicate> And(const std::shared_ptr<ORCPredicate>& lhs,
+                                           const std::shared_ptr<ORCPredicate>& rhs);
+
+  /// \brief Satisfied when either lhs or rhs is
+  static std::shared_ptr<ORCPredicate> Or(const std::shared_ptr<ORCPredicate>& lhs,
+                                          const std::shared_ptr<ORCPredicate>& rhs);
+
+  virtual ~ORCPredicate() = default;
+
+  /// \brief Check the predicate against the statistics of a stripe or a
+  /// row group
+  ///
+  /// \param[in] statistics the statistics of each top-level field, null
+  /// when not available
+  /// \param[out] may_match set to false if no row can satisfy the
+  /// predicate, true otherwise
+  /// \return error Status if a field index is out of range or a literal
+  /// cannot be compared with its field
+  virtual Status MayMatch(const std::vector<const ::orc::ColumnStatistics*>& statistics,
+                          bool* may_match) const = 0;
+
+  virtual std::string ToString() const = 0;
+};
+
+/// \brief Options for ORCFileReader::GetRecordBatchReader
+struct ARROW_EXPORT ORCReadOptions {
+  /// The maximum number of rows of the record batches. A batch never spans
+  /// two stripes, so the last one of each stripe may be shorter
+  int64_t batch_size = 64 * 1024;
+
+  /// The number of stripes decoded ahead of the one being read, concurrently
+  /// on the CPU thread pool. With 1 or less, stripes are decoded one at a
+  /// time in the calling thread
+  int max_concurrent_stripes = 1;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -102,6 +203,58 @@ class ARROW_EXPORT ORCFileReader {
   Status ReadStripe(int64_t stripe, const std::vector<int>& include_indices,
                     std::shared_ptr<RecordBatch>* out);
 
+  /// \brief Return a RecordBatchReader over the stripes of the file
+  ///
+  /// Stripes are decoded as the batches are read, up to
+  /// options.max_concurrent_stripes at a time. The reader must not outlive
+  /// this ORCFileReader.
+  ///
+  /// \param[in] options the batch size and the number of stripes decoded
+  /// concurrently
+  /// \param[out] out the returned RecordBatchReader
+  Status GetRecordBatchReader(const ORCReadOptions& options,
+                              std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Return a RecordBatchReader over the stripes of the file, reading
+  /// only some fields
+  ///
+  /// Only the selected fields are decoded by the ORC row readers.
+  ///
+  /// \param[in] include_indices the selected field indices to read
+  /// \param[in] options the batch size and the number of stripes decoded
+  /// concurrently
+  /// \param[out] out the returned RecordBatchReader
+  Status GetRecordBatchReader(const std::vector<int>& include_indices,
+                              const ORCReadOptions& options,
+                              std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Return a RecordBatchReader over the stripes of the file whose
+  /// statistics do not rule out predicate, reading only some fields
+  ///
+  /// Row groups of the stripes read are skipped as well when the row index
+  /// rules them out. Rows of the row groups read are not filtered.
+  ///
+  /// \param[in] include_indices the selected field indices to read
+  /// \param[in] predicate the predicate on the fields of the file, which
+  /// need not be selected
+  /// \param[in] options the batch size and the number of stripes decoded
+  /// concurrently
+  /// \param[out] out the returned RecordBatchReader
+  Status GetRecordBatchReader(const std::vector<int>& include_indices,
+                              const std::shared_ptr<ORCPredicate>& predicate,
+                              const ORCReadOptions& options,
+                              std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Return the indices of the stripes whose statistics do not rule
+  /// out predicate, in file order. The other stripes are skipped by
+  /// GetRecordBatchReader
+  ///
+  /// \param[in] predicate the predicate on the fields of the file
+  /// \param[out] stripes the stripes that may match
+  /// \param[out] num_pruned the number of stripes ruled out
+  Status FilterStripes(const ORCPredicate& predicate, std::vector<int64_t>* stripes,
+                       int64_t* num_pruned);
+
   /// \brief The number of stripes in the file
   int64_t NumberOfStripes();
 
@@ -114,6 +267,65 @@ class ARROW_EXPORT ORCFileReader {
   ORCFileReader();
 };
 
+/// \brief Options for ORCFileWriter
+struct ARROW_EXPORT ORCWriteOptions {
+  /// The size of the stripes in bytes, before compression
+  int64_t stripe_size = 64 * 1024 * 1024;
+
+  /// The compression codec, one of UNCOMPRESSED, GZIP (zlib), SNAPPY, LZ4,
+  /// LZO and ZSTD
+  Compression::type compression = Compression::GZIP;
+
+  /// The size of the compressed blocks
+  int64_t compression_block_size = 64 * 1024;
+
+  /// The ratio of distinct values to non-null values of a string column
+  /// below which it is dictionary encoded, 0 to never dictionary encode
+  double dictionary_key_size_threshold = 0.0;
+
+  /// The number of rows between the entries of the row index, 0 for no
+  /// row index
+  int64_t row_index_stride = 10000;
+};
+
+/// \class ORCFileWriter
+/// \brief Write Arrow record batches to an ORC file
+///
+/// Fixed-width values are copied into the ORC column batches, while string
+/// and binary values are passed by pointer to Arrow's buffers. Supported
+/// types are boolean, integers, floating point, string, binary, fixed-size
+/// binary, date32, timestamp, decimal, list and struct.
+class ARROW_EXPORT ORCFileWriter {
+ public:
+  ~ORCFileWriter();
+
+  /// \brief Create a new ORC writer
+  ///
+  /// \param[in] schema the schema of the record batches written
+  /// \param[in] sink the output stream, which is not closed by the writer
+  /// \param[in] options the stripe size, compression and encoding options
+  /// \param[out] writer the returned writer object
+  /// \return Status
+  static Status Open(const std::shared_ptr<Schema>& schema,
+                     const std::shared_ptr<io::OutputStream>& sink,
+                     const ORCWriteOptions& options,
+                     std::unique_ptr<ORCFileWriter>* writer);
+
+  /// \brief Write a record batch, of the schema of the writer
+  Status Write(const RecordBatch& batch);
+
+  /// \brief Write the record batches of a table, of the schema of the writer
+  Status Write(const Table& table);
+
+  /// \brief Write the file footer. Nothing can be written after
+  Status Close();
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+  ORCFileWriter();
+};
+
 }  // namespace orc
 
 }  // namespace adapters
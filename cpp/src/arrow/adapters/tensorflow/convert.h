@@ -18,11 +18,22 @@
 #ifndef ARROW_TENSORFLOW_CONVERTER_H
 #define ARROW_TENSORFLOW_CONVERTER_H
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <vector>
 
+#include "tensorflow/core/framework/allocation_description.pb.h"
 #include "tensorflow/core/framework/op.h"
+#include "tensorflow/core/framework/tensor.h"
 
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/record_batch.h"
+#include "arrow/tensor.h"
 #include "arrow/type.h"
+#include "arrow/util/parallel.h"
 
 // These utilities are supposed to be included in TensorFlow operators
 // that need to be compiled separately from Arrow because of ABI issues.
@@ -149,6 +160,204 @@ Status GetTensorFlowType(std::shared_ptr<DataType> dtype, ::tensorflow::DataType
   return arrow::Status::OK();
 }
 
+// A TensorFlow tensor buffer over the memory of an Arrow buffer, which it keeps alive.
+class ArrowTensorBuffer : public ::tensorflow::TensorBuffer {
+ public:
+  ArrowTensorBuffer(const std::shared_ptr<Buffer>& buffer, const uint8_t* data,
+                    size_t size)
+      : ::tensorflow::TensorBuffer(const_cast<uint8_t*>(data)),
+        buffer_(buffer),
+        size_(size) {}
+
+  size_t size() const override { return size_; }
+
+  ::tensorflow::TensorBuffer* root_buffer() override { return this; }
+
+  void FillAllocationDescription(
+      ::tensorflow::AllocationDescription* proto) const override {
+    proto->set_requested_bytes(static_cast<int64_t>(size_));
+    proto->set_allocator_name("arrow");
+  }
+
+  bool OwnsMemory() const override { return false; }
+
+ private:
+  std::shared_ptr<Buffer> buffer_;
+  size_t size_;
+};
+
+namespace detail {
+
+// The number of values copied by each task of a parallel copy
+constexpr int64_t kCopyChunkSize = 1 << 16;
+
+// Calls func(begin, end) over chunks of [0, length), in parallel on the CPU thread pool
+template <typename Function>
+Status ParallelForChunks(int64_t length, int64_t chunk_size, Function&& func) {
+  const int64_t num_chunks = (length + chunk_size - 1) / chunk_size;
+  if (num_chunks <= 1) {
+    func(0, length);
+    return Status::OK();
+  }
+  return internal::ParallelFor(static_cast<int>(num_chunks), [&](int chunk) -> Status {
+    const int64_t begin = chunk * chunk_size;
+    func(begin, std::min(begin + chunk_size, length));
+    return Status::OK();
+  });
+}
+
+// Whether TensorFlow can use memory in place, as its kernels expect tensor data aligned
+// for Eigen.
+inline bool IsTensorFlowAligned(const uint8_t* data) {
+  return reinterpret_cast<uintptr_t>(data) % EIGEN_MAX_ALIGN_BYTES == 0;
+}
+
+inline uint8_t* MutableTensorData(::tensorflow::Tensor* tensor) {
+  return reinterpret_cast<uint8_t*>(const_cast<char*>(tensor->tensor_data().data()));
+}
+
+// Wraps memory of an Arrow buffer in a TensorFlow tensor.
+inline void ShareBuffer(const std::shared_ptr<Buffer>& buffer, const uint8_t* data,
+                        size_t size, ::tensorflow::DataType dtype,
+                        const ::tensorflow::TensorShape& shape,
+                        ::tensorflow::Tensor* out) {
+  auto tensor_buffer = new ArrowTensorBuffer(buffer, data, size);
+  *out = ::tensorflow::Tensor(dtype, shape, tensor_buffer);
+  // The tensor holds its own reference
+  tensor_buffer->Unref();
+}
+
+// Copies rows [begin, end) of the first dimension of a strided tensor, whose row-major
+// copy starts at out.
+inline void CopyStrided(const uint8_t* data, const std::vector<int64_t>& shape,
+                        const std::vector<int64_t>& strides, int dim, int64_t begin,
+                        int64_t end, int byte_width, uint8_t** out) {
+  const bool last = dim == static_cast<int>(shape.size()) - 1;
+  if (last && strides[dim] == byte_width) {
+    const int64_t nbytes = (end - begin) * byte_width;
+    std::memcpy(*out, data + begin * byte_width, static_cast<size_t>(nbytes));
+    *out += nbytes;
+    return;
+  }
+  for (int64_t i = begin; i < end; ++i) {
+    const uint8_t* element = data + i * strides[dim];
+    if (last) {
+      std::memcpy(*out, element, static_cast<size_t>(byte_width));
+      *out += byte_width;
+    } else {
+      CopyStrided(element, shape, strides, dim + 1, 0, shape[dim + 1], byte_width, out);
+    }
+  }
+}
+
+}  // namespace detail
+
+// Converts a numeric or boolean Arrow array to a 1-D TensorFlow tensor. A numeric array
+// without nulls whose values are aligned for Eigen is shared with the tensor without
+// copying, the tensor keeping the Arrow memory alive. Otherwise the values are copied
+// in parallel, with nulls becoming zeros, and booleans unpacked to bytes.
+inline Status ArrayToTensorFlowTensor(const Array& array, ::tensorflow::Tensor* out) {
+  ::tensorflow::DataType dtype;
+  RETURN_NOT_OK(GetTensorFlowType(array.type(), &dtype));
+  const int64_t length = array.length();
+  const ::tensorflow::TensorShape shape({length});
+
+  if (array.type_id() == Type::BOOL) {
+    *out = ::tensorflow::Tensor(dtype, shape);
+    const auto& booleans = static_cast<const BooleanArray&>(array);
+    bool* values = reinterpret_cast<bool*>(detail::MutableTensorData(out));
+    return detail::ParallelForChunks(length, detail::kCopyChunkSize,
+                                     [&](int64_t begin, int64_t end) {
+                                       for (int64_t i = begin; i < end; ++i) {
+                                         values[i] = booleans.IsValid(i) &&
+                                                     booleans.Value(i);
+                                       }
+                                     });
+  }
+
+  const int byte_width =
+      static_cast<const FixedWidthType&>(*array.type()).bit_width() / 8;
+  const std::shared_ptr<Buffer>& buffer = array.data()->buffers[1];
+  const size_t nbytes = static_cast<size_t>(length * byte_width);
+  const uint8_t* data =
+      buffer == nullptr ? nullptr : buffer->data() + array.offset() * byte_width;
+  if (length > 0 && array.null_count() == 0 && detail::IsTensorFlowAligned(data)) {
+    detail::ShareBuffer(buffer, data, nbytes, dtype, shape, out);
+    return Status::OK();
+  }
+
+  *out = ::tensorflow::Tensor(dtype, shape);
+  if (length == 0) {
+    return Status::OK();
+  }
+  uint8_t* out_data = detail::MutableTensorData(out);
+  return detail::ParallelForChunks(
+      length, detail::kCopyChunkSize, [&](int64_t begin, int64_t end) {
+        const int64_t offset = begin * byte_width;
+        std::memcpy(out_data + offset, data + offset,
+                    static_cast<size_t>((end - begin) * byte_width));
+        if (array.null_count() != 0) {
+          for (int64_t i = begin; i < end; ++i) {
+            if (array.IsNull(i)) {
+              std::memset(out_data + i * byte_width, 0, static_cast<size_t>(byte_width));
+            }
+          }
+        }
+      });
+}
+
+// Converts each column of a record batch to a 1-D TensorFlow tensor, as
+// ArrayToTensorFlowTensor.
+inline Status RecordBatchToTensorFlowTensors(const RecordBatch& batch,
+                                             std::vector<::tensorflow::Tensor>* out) {
+  out->resize(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    RETURN_NOT_OK(ArrayToTensorFlowTensor(*batch.column(i), &(*out)[i]));
+  }
+  return Status::OK();
+}
+
+// Converts an Arrow tensor to a TensorFlow tensor of the same shape. A row-major tensor
+// whose data is aligned for Eigen is shared without copying. Otherwise, eg. for a
+// column-major or strided tensor, the values are copied in row-major order, in
+// parallel over the first dimension.
+inline Status TensorToTensorFlowTensor(const Tensor& tensor, ::tensorflow::Tensor* out) {
+  ::tensorflow::DataType dtype;
+  RETURN_NOT_OK(GetTensorFlowType(tensor.type(), &dtype));
+  ::tensorflow::TensorShape shape;
+  for (int64_t dim : tensor.shape()) {
+    shape.AddDim(dim);
+  }
+  const int byte_width =
+      static_cast<const FixedWidthType&>(*tensor.type()).bit_width() / 8;
+  const size_t nbytes = static_cast<size_t>(tensor.size() * byte_width);
+  if (tensor.size() > 0 && tensor.is_row_major() &&
+      detail::IsTensorFlowAligned(tensor.raw_data())) {
+    detail::ShareBuffer(tensor.data(), tensor.raw_data(), nbytes, dtype, shape, out);
+    return Status::OK();
+  }
+
+  *out = ::tensorflow::Tensor(dtype, shape);
+  if (tensor.size() == 0) {
+    return Status::OK();
+  }
+  if (tensor.ndim() == 0) {
+    std::memcpy(detail::MutableTensorData(out), tensor.raw_data(), nbytes);
+    return Status::OK();
+  }
+  uint8_t* out_data = detail::MutableTensorData(out);
+  const int64_t row_size = static_cast<int64_t>(nbytes) / tensor.shape()[0];
+  // Copy chunks of rows of about kCopyChunkSize values
+  const int64_t rows_per_chunk =
+      std::max<int64_t>(1, detail::kCopyChunkSize * byte_width / row_size);
+  return detail::ParallelForChunks(
+      tensor.shape()[0], rows_per_chunk, [&](int64_t begin, int64_t end) {
+        uint8_t* row_out = out_data + begin * row_size;
+        detail::CopyStrided(tensor.raw_data(), tensor.shape(), tensor.strides(), 0, begin,
+                            end, byte_width, &row_out);
+      });
+}
+
 }  // namespace tensorflow
 
 }  // namespace adapters
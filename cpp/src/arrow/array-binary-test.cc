@@ -28,6 +28,7 @@
 #include "arrow/builder.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
@@ -617,6 +618,30 @@ TEST_F(TestBinaryBuilder, TestCapacityReserve) {
   ASSERT_EQ(640, result_->value_data()->capacity());
 }
 
+TEST_F(TestBinaryBuilder, TestAppendValuesOffsets) {
+  // Values "", "bb", "a", "", "ccc" sliced out of a larger data buffer
+  const std::string data = "xxbbaccc";
+  const int32_t offsets[] = {2, 2, 4, 5, 5, 8};
+  // Bits 1 to 5 are 1, 1, 0, 1, 1
+  const uint8_t bitmap[] = {0x36};
+
+  ASSERT_OK(builder_->Append("dd"));
+  ASSERT_OK(builder_->AppendValues(offsets, 5,
+                                   reinterpret_cast<const uint8_t*>(data.data()), bitmap,
+                                   1));
+  ASSERT_OK(builder_->AppendValues(offsets + 1, 2,
+                                   reinterpret_cast<const uint8_t*>(data.data())));
+  ASSERT_EQ(8, builder_->length());
+  ASSERT_EQ(1, builder_->null_count());
+  // The null "a" gets a zero length
+  ASSERT_EQ(10, builder_->value_data_length());
+  Done();
+
+  auto expected =
+      ArrayFromJSON(binary(), R"(["dd", "", "bb", null, "", "ccc", "bb", "a"])");
+  AssertArraysEqual(*expected, *result_);
+}
+
 TEST_F(TestBinaryBuilder, TestZeroLength) {
   // All buffers are null
   Done();
@@ -686,11 +711,11 @@ class TestChunkedBinaryBuilder : public ::testing::Test {
   void SetUp() {}
 
   void Init(int32_t chunksize) {
-    builder_.reset(new internal::ChunkedBinaryBuilder(chunksize));
+    builder_.reset(new ChunkedBinaryBuilder(chunksize));
   }
 
  protected:
-  std::unique_ptr<internal::ChunkedBinaryBuilder> builder_;
+  std::unique_ptr<ChunkedBinaryBuilder> builder_;
 };
 
 TEST_F(TestChunkedBinaryBuilder, BasicOperation) {
@@ -764,9 +789,31 @@ TEST_F(TestChunkedBinaryBuilder, LargeElements) {
   ASSERT_EQ(iterations * bufsize, total_data_size);
 }
 
+TEST_F(TestChunkedBinaryBuilder, FinishChunkedArray) {
+  Init(5);
+
+  ASSERT_OK(builder_->Append("abc"));
+  ASSERT_OK(builder_->AppendNull());
+  ASSERT_OK(builder_->Append("de"));
+  ASSERT_OK(builder_->Append("fgh"));
+  ASSERT_EQ(4, builder_->length());
+
+  std::shared_ptr<ChunkedArray> out;
+  ASSERT_OK(builder_->Finish(&out));
+  ASSERT_EQ(0, builder_->length());
+  ASSERT_EQ(2, out->num_chunks());
+  AssertChunkedEqual(*out, ArrayVector{ArrayFromJSON(binary(), R"(["abc", null, "de"])"),
+                                       ArrayFromJSON(binary(), R"(["fgh"])")});
+
+  // The builder is reusable
+  ASSERT_OK(builder_->Append("ijklm"));
+  ASSERT_OK(builder_->Finish(&out));
+  AssertChunkedEqual(*out, ArrayVector{ArrayFromJSON(binary(), R"(["ijklm"])")});
+}
+
 TEST(TestChunkedStringBuilder, BasicOperation) {
   const int chunksize = 100;
-  internal::ChunkedStringBuilder builder(chunksize);
+  ChunkedStringBuilder builder(chunksize);
 
   std::string value = "0123456789";
 
@@ -786,4 +833,14 @@ TEST(TestChunkedStringBuilder, BasicOperation) {
   }
 }
 
+TEST(TestChunkedStringBuilder, FinishChunkedArray) {
+  ChunkedStringBuilder builder(100);
+  ASSERT_OK(builder.Append("abc"));
+
+  std::shared_ptr<ChunkedArray> out;
+  ASSERT_OK(builder.Finish(&out));
+  ASSERT_TRUE(out->type()->Equals(*::arrow::utf8()));
+  AssertChunkedEqual(*out, ArrayVector{ArrayFromJSON(utf8(), R"(["abc"])")});
+}
+
 }  // namespace arrow
@@ -823,4 +823,59 @@ TEST(TestDictionary, TransposeNulls) {
   AssertArraysEqual(*expected, *out);
 }
 
+TEST(TestDictionaryUnifier, Basics) {
+  std::unique_ptr<DictionaryUnifier> unifier;
+  ASSERT_OK(DictionaryUnifier::Make(default_memory_pool(), utf8(), &unifier));
+
+  std::vector<int32_t> transpose1, transpose2;
+  ASSERT_OK(unifier->Unify(*ArrayFromJSON(utf8(), R"(["foo", "bar"])"), &transpose1));
+  ASSERT_OK(unifier->Unify(*ArrayFromJSON(utf8(), R"(["quux", "foo"])"), &transpose2));
+  ASSERT_EQ(transpose1, std::vector<int32_t>({0, 1}));
+  ASSERT_EQ(transpose2, std::vector<int32_t>({2, 0}));
+
+  std::shared_ptr<DataType> type;
+  ASSERT_OK(unifier->GetResult(&type));
+  ASSERT_TRUE(type->Equals(
+      dictionary(int8(), ArrayFromJSON(utf8(), R"(["foo", "bar", "quux"])"))));
+
+  // Dictionaries must have the unifier's value type and no nulls
+  ASSERT_RAISES(TypeError, unifier->Unify(*ArrayFromJSON(int32(), "[1, 2]")));
+  ASSERT_RAISES(TypeError, unifier->Unify(*ArrayFromJSON(utf8(), R"(["a", null])")));
+
+  ASSERT_RAISES(NotImplemented,
+                DictionaryUnifier::Make(default_memory_pool(), list(int8()), &unifier));
+}
+
+TEST(TestDictionaryUnifier, UnifyArrays) {
+  auto type1 = dictionary(int8(), ArrayFromJSON(int32(), "[10, 20, 30]"));
+  auto type2 = dictionary(int16(), ArrayFromJSON(int32(), "[40, 10]"));
+  std::shared_ptr<Array> arr1, arr2, arr3;
+  ASSERT_OK(DictionaryArray::FromArrays(type1, ArrayFromJSON(int8(), "[2, null, 0, 1]"),
+                                        &arr1));
+  ASSERT_OK(DictionaryArray::FromArrays(type2, ArrayFromJSON(int16(), "[0, 1, null]"),
+                                        &arr2));
+  ASSERT_OK(DictionaryArray::FromArrays(type1, ArrayFromJSON(int8(), "[1, 1]"), &arr3));
+
+  ArrayVector out;
+  ASSERT_OK(
+      DictionaryUnifier::UnifyArrays(default_memory_pool(), {arr1, arr2, arr3}, &out));
+  ASSERT_EQ(3, static_cast<int>(out.size()));
+
+  auto expected_type = dictionary(int8(), ArrayFromJSON(int32(), "[10, 20, 30, 40]"));
+  std::shared_ptr<Array> expected1, expected2, expected3;
+  ASSERT_OK(DictionaryArray::FromArrays(
+      expected_type, ArrayFromJSON(int8(), "[2, null, 0, 1]"), &expected1));
+  ASSERT_OK(DictionaryArray::FromArrays(expected_type,
+                                        ArrayFromJSON(int8(), "[3, 0, null]"), &expected2));
+  ASSERT_OK(DictionaryArray::FromArrays(expected_type, ArrayFromJSON(int8(), "[1, 1]"),
+                                        &expected3));
+  AssertArraysEqual(*expected1, *out[0]);
+  AssertArraysEqual(*expected2, *out[1]);
+  AssertArraysEqual(*expected3, *out[2]);
+
+  // The first dictionary is a prefix of the unified one: indices are not copied
+  ASSERT_EQ(arr1->data()->buffers[1], out[0]->data()->buffers[1]);
+  ASSERT_EQ(arr3->data()->buffers[1], out[2]->data()->buffers[1]);
+}
+
 }  // namespace arrow
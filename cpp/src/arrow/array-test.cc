@@ -130,6 +130,55 @@ TEST_F(TestArray, TestEquality) {
   ASSERT_FALSE(timestamp_us_array->Equals(timestamp_ns_array));
 }
 
+TEST_F(TestArray, TestEqualityIgnoresNullSlots) {
+  // Values behind null slots may differ without making arrays unequal
+  const std::vector<uint8_t> valid_bytes = {1, 1, 0, 1, 1, 1, 0, 0, 1, 1, 1};
+  const int64_t length = static_cast<int64_t>(valid_bytes.size());
+  std::shared_ptr<Buffer> null_bitmap;
+  ASSERT_OK(BitUtil::BytesToBits(valid_bytes, pool_, &null_bitmap));
+
+  const std::vector<int32_t> values1 = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  const std::vector<int32_t> values2 = {1, 2, 0, 4, 5, 6, 0, 0, 9, 10, 11};
+  const std::vector<int32_t> values3 = {1, 2, 0, 4, 5, 0, 0, 0, 9, 10, 11};
+  auto ints1 =
+      std::make_shared<Int32Array>(length, Buffer::Wrap(values1), null_bitmap, 3);
+  auto ints2 =
+      std::make_shared<Int32Array>(length, Buffer::Wrap(values2), null_bitmap, 3);
+  auto ints3 =
+      std::make_shared<Int32Array>(length, Buffer::Wrap(values3), null_bitmap, 3);
+  ASSERT_TRUE(ints1->Equals(ints2));
+  ASSERT_TRUE(ints1->RangeEquals(1, 9, 1, ints2));
+  ASSERT_TRUE(ints1->Slice(3)->Equals(ints2->Slice(3)));
+  ASSERT_FALSE(ints1->Equals(ints3));
+  ASSERT_FALSE(ints1->RangeEquals(1, 9, 1, ints3));
+  ASSERT_TRUE(ints1->RangeEquals(6, length, 6, ints3));
+  ASSERT_FALSE(ints1->RangeEquals(0, 2, 1, ints2));
+
+  // Null slots of different lengths shift the offsets of the following values
+  const std::vector<int32_t> offsets1 = {0, 1, 2, 2, 3, 4, 5, 5, 5, 6, 7, 8};
+  const std::vector<int32_t> offsets2 = {0, 1, 2, 4, 5, 6, 7, 7, 8, 9, 10, 11};
+  auto strings1 = std::make_shared<StringArray>(
+      length, Buffer::Wrap(offsets1), Buffer::FromString("abcdefgh"), null_bitmap, 3);
+  auto strings2 = std::make_shared<StringArray>(
+      length, Buffer::Wrap(offsets2), Buffer::FromString("abxxcdeyfgh"), null_bitmap, 3);
+  ASSERT_TRUE(strings1->RangeEquals(0, length, 0, strings2));
+  ASSERT_TRUE(strings1->RangeEquals(1, 10, 1, strings2));
+  ASSERT_TRUE(strings1->Slice(4)->RangeEquals(0, 7, 0, strings2->Slice(4)));
+  ASSERT_FALSE(strings1->RangeEquals(0, 2, 1, strings2));
+
+  const std::vector<uint8_t> bools1 = {1, 0, 1, 1, 0, 1, 1, 0, 1, 1, 0};
+  const std::vector<uint8_t> bools2 = {1, 0, 0, 1, 0, 1, 0, 1, 1, 1, 0};
+  std::shared_ptr<Buffer> bool_values1, bool_values2;
+  ASSERT_OK(BitUtil::BytesToBits(bools1, pool_, &bool_values1));
+  ASSERT_OK(BitUtil::BytesToBits(bools2, pool_, &bool_values2));
+  auto booleans1 = std::make_shared<BooleanArray>(length, bool_values1, null_bitmap, 3);
+  auto booleans2 = std::make_shared<BooleanArray>(length, bool_values2, null_bitmap, 3);
+  ASSERT_TRUE(booleans1->Equals(booleans2));
+  ASSERT_TRUE(booleans1->Slice(1)->Equals(booleans2->Slice(1)));
+  ASSERT_TRUE(booleans1->RangeEquals(2, 9, 2, booleans2));
+  ASSERT_FALSE(booleans1->RangeEquals(0, 3, 1, booleans2));
+}
+
 TEST_F(TestArray, TestNullArrayEquality) {
   auto array_1 = std::make_shared<NullArray>(10);
   auto array_2 = std::make_shared<NullArray>(10);
@@ -1014,6 +1063,52 @@ void CheckSliceApproxEquals() {
   ASSERT_TRUE(slice1->ApproxEquals(slice2));
 }
 
+TEST(TestNumericBuilder, TestRecycleBuffers) {
+  Int32Builder builder;
+  builder.set_shrink_to_fit(false);
+  builder.set_recycle_buffers(true);
+  const int32_t values[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+  std::shared_ptr<Array> result;
+  ASSERT_OK(builder.Reserve(100));
+  ASSERT_OK(builder.AppendValues(values, 10));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Finish(&result));
+  // The buffers are not shrunk
+  ASSERT_EQ(11 * sizeof(int32_t), result->data()->buffers[1]->size());
+  ASSERT_LE(100 * sizeof(int32_t), result->data()->buffers[1]->capacity());
+  const uint8_t* null_bitmap = result->null_bitmap_data();
+  const uint8_t* data = result->data()->buffers[1]->data();
+
+  // The next array is built into the buffers of the released one
+  result.reset();
+  ASSERT_OK(builder.AppendValues(values, 5));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Finish(&result));
+  ASSERT_EQ(null_bitmap, result->null_bitmap_data());
+  ASSERT_EQ(data, result->data()->buffers[1]->data());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, 3, 4, 5, null]"), *result);
+}
+
+TEST(TestNumericBuilder, TestAppendValuesBitmap) {
+  Int32Builder builder;
+  const int32_t values[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  // Bits 3 to 12 are 1, 0, 1, 1, 0, 0, 1, 1, 1, 0
+  const uint8_t bitmap[] = {0x68, 0x0E};
+
+  ASSERT_OK(builder.Append(0));
+  ASSERT_OK(builder.AppendValues(values, 10, bitmap, 3));
+  ASSERT_OK(builder.AppendValues(values, 2, nullptr, 0));
+  ASSERT_EQ(13, builder.length());
+  ASSERT_EQ(4, builder.null_count());
+
+  std::shared_ptr<Array> result;
+  ASSERT_OK(builder.Finish(&result));
+  auto expected =
+      ArrayFromJSON(int32(), "[0, 1, null, 3, 4, null, null, 7, 8, 9, null, 1, 2]");
+  AssertArraysEqual(*expected, *result);
+}
+
 TEST(TestPrimitiveAdHoc, FloatingSliceApproxEquals) {
   CheckSliceApproxEquals<FloatType>();
   CheckSliceApproxEquals<DoubleType>();
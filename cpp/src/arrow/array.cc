@@ -672,8 +672,13 @@ static Status TransposeDictIndices(MemoryPool* pool, const ArrayData& in_data,
 
   std::shared_ptr<Buffer> out_buffer;
   RETURN_NOT_OK(AllocateBuffer(pool, in_data.length * sizeof(out_c_type), &out_buffer));
-  // Null bitmap is unchanged
-  auto out_data = ArrayData::Make(type, in_data.length, {in_data.buffers[0], out_buffer},
+  // Null bitmap is unchanged, but the output has no offset
+  std::shared_ptr<Buffer> null_bitmap = in_data.buffers[0];
+  if (null_bitmap && in_data.offset != 0) {
+    RETURN_NOT_OK(internal::CopyBitmap(pool, null_bitmap->data(), in_data.offset,
+                                       in_data.length, &null_bitmap));
+  }
+  auto out_data = ArrayData::Make(type, in_data.length, {null_bitmap, out_buffer},
                                   in_data.null_count);
   internal::TransposeInts(in_data.GetValues<in_c_type>(1),
                           out_data->GetMutableValues<out_c_type>(1), in_data.length,
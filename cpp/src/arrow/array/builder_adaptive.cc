@@ -91,8 +91,8 @@ Status AdaptiveIntBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   }
 
   std::shared_ptr<Buffer> null_bitmap;
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
-  RETURN_NOT_OK(TrimBuffer(length_ * int_size_, data_.get()));
+  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap, shrink_to_fit_));
+  RETURN_NOT_OK(TrimBuffer(length_ * int_size_, data_.get(), shrink_to_fit_));
 
   *out = ArrayData::Make(output_type, length_, {null_bitmap, data_}, null_count_);
 
@@ -202,9 +202,9 @@ AdaptiveIntBuilder::ExpandIntSizeInternal() {
   const old_type* src = reinterpret_cast<old_type*>(raw_data_);
   new_type* dst = reinterpret_cast<new_type*>(raw_data_);
 
-  // By doing the backward copy, we ensure that no element is overriden during
+  // UpcastInts copies backwards, so that no element is overriden during
   // the copy process and the copy stays in-place.
-  std::copy_backward(src, src + length_, dst + length_);
+  internal::UpcastInts(src, dst, length_);
 
   return Status::OK();
 }
@@ -277,8 +277,8 @@ Status AdaptiveUIntBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   }
 
   std::shared_ptr<Buffer> null_bitmap;
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
-  RETURN_NOT_OK(TrimBuffer(length_ * int_size_, data_.get()));
+  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap, shrink_to_fit_));
+  RETURN_NOT_OK(TrimBuffer(length_ * int_size_, data_.get(), shrink_to_fit_));
 
   *out = ArrayData::Make(output_type, length_, {null_bitmap, data_}, null_count_);
 
@@ -357,9 +357,9 @@ AdaptiveUIntBuilder::ExpandIntSizeInternal() {
 
   old_type* src = reinterpret_cast<old_type*>(raw_data_);
   new_type* dst = reinterpret_cast<new_type*>(raw_data_);
-  // By doing the backward copy, we ensure that no element is overriden during
+  // UpcastInts copies backwards, so that no element is overriden during
   // the copy process and the copy stays in-place.
-  std::copy_backward(src, src + length_, dst + length_);
+  internal::UpcastInts(src, dst, length_);
 
   return Status::OK();
 }
@@ -36,11 +36,12 @@
 
 namespace arrow {
 
-Status ArrayBuilder::TrimBuffer(const int64_t bytes_filled, ResizableBuffer* buffer) {
+Status ArrayBuilder::TrimBuffer(const int64_t bytes_filled, ResizableBuffer* buffer,
+                                bool shrink_to_fit) {
   if (buffer) {
     if (bytes_filled < buffer->size()) {
       // Trim buffer
-      RETURN_NOT_OK(buffer->Resize(bytes_filled));
+      RETURN_NOT_OK(buffer->Resize(bytes_filled, shrink_to_fit));
     }
     // zero the padding
     buffer->ZeroPadding();
@@ -89,6 +90,20 @@ void ArrayBuilder::Reset() {
   null_bitmap_builder_.Reset();
 }
 
+void ArrayBuilder::set_shrink_to_fit(bool shrink_to_fit) {
+  shrink_to_fit_ = shrink_to_fit;
+  for (const auto& child : children_) {
+    child->set_shrink_to_fit(shrink_to_fit);
+  }
+}
+
+void ArrayBuilder::set_recycle_buffers(bool recycle_buffers) {
+  null_bitmap_builder_.set_recycle_buffers(recycle_buffers);
+  for (const auto& child : children_) {
+    child->set_recycle_buffers(recycle_buffers);
+  }
+}
+
 Status ArrayBuilder::SetNotNull(int64_t length) {
   RETURN_NOT_OK(Reserve(length));
   UnsafeSetNotNull(length);
@@ -122,6 +122,25 @@ class ARROW_EXPORT ArrayBuilder {
   /// \return Status
   Status Finish(std::shared_ptr<Array>* out);
 
+  /// \brief Set whether Finish shrinks the buffers to the size of their data
+  ///
+  /// Shrinking reallocates the buffers, which copies them unless the memory
+  /// pool resizes them in place, as the default pool does for large
+  /// allocations. If false, the finished arrays keep the spare capacity of
+  /// the buffers and nothing is copied. The default is true. This also applies
+  /// to the child builders.
+  virtual void set_shrink_to_fit(bool shrink_to_fit);
+
+  /// \brief Set whether the builder reuses the memory of the buffers of the
+  /// last finished array, once that array is released
+  ///
+  /// Along with set_shrink_to_fit(false), building arrays of similar sizes
+  /// in a loop then reaches a steady state without allocations. The buffers
+  /// of the last finished array stay alive as long as the builder. Off by
+  /// default; see BufferBuilder::set_recycle_buffers. This also applies to
+  /// the child builders.
+  virtual void set_recycle_buffers(bool recycle_buffers);
+
   std::shared_ptr<DataType> type() const { return type_; }
 
  protected:
@@ -157,6 +176,18 @@ class ARROW_EXPORT ArrayBuilder {
     null_count_ = null_bitmap_builder_.false_count();
   }
 
+  // Append the bits of a packed validity bitmap, starting at a bit offset. If bitmap
+  // is null assume all of length bits are valid.
+  void UnsafeAppendToBitmap(const uint8_t* bitmap, int64_t bitmap_offset,
+                            int64_t length) {
+    if (bitmap == NULLPTR) {
+      return UnsafeSetNotNull(length);
+    }
+    null_bitmap_builder_.UnsafeAppendBitmap(bitmap, bitmap_offset, length);
+    length_ += length;
+    null_count_ = null_bitmap_builder_.false_count();
+  }
+
   void UnsafeAppendToBitmap(const std::vector<bool>& is_valid);
 
   // Set the next length bits to not null (i.e. valid).
@@ -164,7 +195,8 @@ class ARROW_EXPORT ArrayBuilder {
 
   void UnsafeSetNull(int64_t length);
 
-  static Status TrimBuffer(const int64_t bytes_filled, ResizableBuffer* buffer);
+  static Status TrimBuffer(const int64_t bytes_filled, ResizableBuffer* buffer,
+                           bool shrink_to_fit = true);
 
   static Status CheckCapacity(int64_t new_capacity, int64_t old_capacity) {
     if (new_capacity < 0) {
@@ -186,6 +218,9 @@ class ARROW_EXPORT ArrayBuilder {
   int64_t length_ = 0;
   int64_t capacity_ = 0;
 
+  // Whether FinishInternal shrinks the buffers to fit
+  bool shrink_to_fit_ = true;
+
   // Child value array builders. These are owned by this class
   std::vector<std::shared_ptr<ArrayBuilder>> children_;
 
@@ -30,6 +30,7 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
@@ -68,6 +69,54 @@ Status BinaryBuilder::ReserveData(int64_t elements) {
                                         : Status::OK();
 }
 
+Status BinaryBuilder::AppendValues(const int32_t* offsets, int64_t length,
+                                   const uint8_t* data, const uint8_t* bitmap,
+                                   int64_t bitmap_offset) {
+  const int64_t num_bytes = value_data_builder_.length();
+  // An upper bound if some values are null
+  const int64_t data_size = offsets[length] - offsets[0];
+  if (ARROW_PREDICT_FALSE(num_bytes + data_size > kBinaryMemoryLimit)) {
+    return AppendOverflow(num_bytes + data_size);
+  }
+  RETURN_NOT_OK(Reserve(length));
+  RETURN_NOT_OK(ReserveData(data_size));
+
+  int32_t* out = offsets_builder_.mutable_data() + offsets_builder_.length();
+  // Copy the data of values [start, end) at once, rebasing their offsets onto
+  // the end of the data appended so far
+  auto append_run = [&](int64_t start, int64_t end) {
+    const int32_t shift =
+        static_cast<int32_t>(value_data_builder_.length()) - offsets[start];
+    value_data_builder_.UnsafeAppend(data + offsets[start],
+                                     offsets[end] - offsets[start]);
+    for (int64_t i = start; i < end; ++i) {
+      out[i] = offsets[i] + shift;
+    }
+  };
+
+  if (bitmap == NULLPTR) {
+    append_run(0, length);
+  } else {
+    // Null values get a zero length, as with AppendNull, so only runs of
+    // valid values are copied
+    internal::BitmapReader reader(bitmap, bitmap_offset, length);
+    int64_t i = 0;
+    while (i < length) {
+      const auto null_offset = static_cast<int32_t>(value_data_builder_.length());
+      for (; i < length && reader.IsNotSet(); ++i, reader.Next()) {
+        out[i] = null_offset;
+      }
+      const int64_t start = i;
+      for (; i < length && reader.IsSet(); ++i, reader.Next()) {
+      }
+      append_run(start, i);
+    }
+  }
+  offsets_builder_.UnsafeAdvance(length);
+  UnsafeAppendToBitmap(bitmap, bitmap_offset, length);
+  return Status::OK();
+}
+
 Status BinaryBuilder::AppendOverflow(int64_t num_bytes) {
   return Status::CapacityError("BinaryArray cannot contain more than ",
                                kBinaryMemoryLimit, " bytes, have ", num_bytes);
@@ -79,9 +128,9 @@ Status BinaryBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
 
   // These buffers' padding zeroed by BufferBuilder
   std::shared_ptr<Buffer> offsets, value_data, null_bitmap;
-  RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
-  RETURN_NOT_OK(value_data_builder_.Finish(&value_data));
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(offsets_builder_.Finish(&offsets, shrink_to_fit_));
+  RETURN_NOT_OK(value_data_builder_.Finish(&value_data, shrink_to_fit_));
+  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap, shrink_to_fit_));
 
   *out =
       ArrayData::Make(type_, length_, {null_bitmap, offsets, value_data}, null_count_, 0);
@@ -95,6 +144,12 @@ void BinaryBuilder::Reset() {
   value_data_builder_.Reset();
 }
 
+void BinaryBuilder::set_recycle_buffers(bool recycle_buffers) {
+  ArrayBuilder::set_recycle_buffers(recycle_buffers);
+  offsets_builder_.set_recycle_buffers(recycle_buffers);
+  value_data_builder_.set_recycle_buffers(recycle_buffers);
+}
+
 const uint8_t* BinaryBuilder::GetValue(int64_t i, int32_t* out_length) const {
   const int32_t* offsets = offsets_builder_.data();
   int32_t offset = offsets[i];
@@ -241,6 +296,11 @@ void FixedSizeBinaryBuilder::Reset() {
   byte_builder_.Reset();
 }
 
+void FixedSizeBinaryBuilder::set_recycle_buffers(bool recycle_buffers) {
+  ArrayBuilder::set_recycle_buffers(recycle_buffers);
+  byte_builder_.set_recycle_buffers(recycle_buffers);
+}
+
 Status FixedSizeBinaryBuilder::Resize(int64_t capacity) {
   RETURN_NOT_OK(CheckCapacity(capacity, capacity_));
   RETURN_NOT_OK(byte_builder_.Resize(capacity * byte_width_));
@@ -249,10 +309,10 @@ Status FixedSizeBinaryBuilder::Resize(int64_t capacity) {
 
 Status FixedSizeBinaryBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   std::shared_ptr<Buffer> data;
-  RETURN_NOT_OK(byte_builder_.Finish(&data));
+  RETURN_NOT_OK(byte_builder_.Finish(&data, shrink_to_fit_));
 
   std::shared_ptr<Buffer> null_bitmap;
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap, shrink_to_fit_));
   *out = ArrayData::Make(type_, length_, {null_bitmap, data}, null_count_);
 
   capacity_ = length_ = null_count_ = 0;
@@ -273,11 +333,10 @@ util::string_view FixedSizeBinaryBuilder::GetView(int64_t i) const {
 // ----------------------------------------------------------------------
 // ChunkedArray builders
 
-namespace internal {
-
 ChunkedBinaryBuilder::ChunkedBinaryBuilder(int32_t max_chunk_size, MemoryPool* pool)
     : max_chunk_size_(max_chunk_size),
       chunk_data_size_(0),
+      finished_length_(0),
       builder_(new BinaryBuilder(pool)) {}
 
 Status ChunkedBinaryBuilder::Finish(ArrayVector* out) {
@@ -287,12 +346,27 @@ Status ChunkedBinaryBuilder::Finish(ArrayVector* out) {
     chunks_.emplace_back(std::move(chunk));
   }
   *out = std::move(chunks_);
+  chunks_.clear();
+  chunk_data_size_ = 0;
+  finished_length_ = 0;
   return Status::OK();
 }
 
+Status ChunkedBinaryBuilder::Finish(std::shared_ptr<ChunkedArray>* out) {
+  ArrayVector chunks;
+  RETURN_NOT_OK(Finish(&chunks));
+  *out = std::make_shared<ChunkedArray>(std::move(chunks));
+  return Status::OK();
+}
+
+int64_t ChunkedBinaryBuilder::length() const {
+  return finished_length_ + builder_->length();
+}
+
 Status ChunkedBinaryBuilder::NextChunk() {
   std::shared_ptr<Array> chunk;
   RETURN_NOT_OK(builder_->Finish(&chunk));
+  finished_length_ += chunk->length();
   chunks_.emplace_back(std::move(chunk));
 
   chunk_data_size_ = 0;
@@ -311,6 +385,4 @@ Status ChunkedStringBuilder::Finish(ArrayVector* out) {
   return Status::OK();
 }
 
-}  // namespace internal
-
 }  // namespace arrow
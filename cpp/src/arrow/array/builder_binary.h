@@ -98,8 +98,26 @@ class ARROW_EXPORT BinaryBuilder : public ArrayBuilder {
     UnsafeAppendToBitmap(false);
   }
 
+  /// \brief Append a sequence of values in one shot, given as the offsets and
+  /// data of existing binary values, eg. the buffers of a BinaryArray
+  ///
+  /// The data of each run of valid values is copied at once, and the offsets
+  /// rebased in a single pass.  Null values are given a zero length, as with
+  /// AppendNull, whatever their length in data.
+  ///
+  /// \param[in] offsets the length + 1 offsets of the values into data
+  /// \param[in] length the number of values to append
+  /// \param[in] data the data of the values
+  /// \param[in] bitmap a packed validity bitmap where a set bit indicates a
+  /// valid (non-null) value, or null if all values are valid
+  /// \param[in] bitmap_offset the bit offset of the first value in bitmap
+  /// \return Status
+  Status AppendValues(const int32_t* offsets, int64_t length, const uint8_t* data,
+                      const uint8_t* bitmap = NULLPTR, int64_t bitmap_offset = 0);
+
   void Reset() override;
   Status Resize(int64_t capacity) override;
+  void set_recycle_buffers(bool recycle_buffers) override;
 
   /// \brief Ensures there is enough allocated capacity to append the indicated
   /// number of bytes to the value data buffer without additional allocations
@@ -150,6 +168,7 @@ class ARROW_EXPORT StringBuilder : public BinaryBuilder {
   explicit StringBuilder(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
 
   using BinaryBuilder::Append;
+  using BinaryBuilder::AppendValues;
   using BinaryBuilder::Reset;
   using BinaryBuilder::UnsafeAppend;
 
@@ -220,6 +239,7 @@ class ARROW_EXPORT FixedSizeBinaryBuilder : public ArrayBuilder {
 
   void Reset() override;
   Status Resize(int64_t capacity) override;
+  void set_recycle_buffers(bool recycle_buffers) override;
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
 
   /// \return size of values buffer so far
@@ -250,17 +270,30 @@ class ARROW_EXPORT FixedSizeBinaryBuilder : public ArrayBuilder {
 // Chunked builders: build a sequence of BinaryArray or StringArray that are
 // limited to a particular size (to the upper limit of 2GB)
 
-namespace internal {
-
+/// \class ChunkedBinaryBuilder
+/// \brief Builder of binary values that may exceed the 2GB limit of a
+/// BinaryArray, as a ChunkedArray
+///
+/// A new chunk is started whenever appending a value would take the data of
+/// the current one beyond max_chunk_size bytes, or its length beyond the
+/// int32 limit. A single value larger than max_chunk_size makes up a chunk
+/// on its own.
 class ARROW_EXPORT ChunkedBinaryBuilder {
  public:
-  ChunkedBinaryBuilder(int32_t max_chunk_size,
-                       MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+  /// \brief Create a builder
+  /// \param[in] max_chunk_size the maximum size of the data of a chunk, in
+  /// bytes, at most kBinaryMemoryLimit
+  /// \param[in] pool the memory pool to allocate the chunks from
+  explicit ChunkedBinaryBuilder(int32_t max_chunk_size = kBinaryMemoryLimit,
+                                MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
 
   virtual ~ChunkedBinaryBuilder() = default;
 
   Status Append(const uint8_t* value, int32_t length) {
-    if (ARROW_PREDICT_FALSE(length + chunk_data_size_ > max_chunk_size_)) {
+    // Computed in 64 bits as both sizes can approach the int32 limit
+    if (ARROW_PREDICT_FALSE(static_cast<int64_t>(chunk_data_size_) + length >
+                            max_chunk_size_) ||
+        ARROW_PREDICT_FALSE(builder_->length() == std::numeric_limits<int32_t>::max())) {
       // Move onto next chunk, unless the builder length is currently 0, which
       // means that max_chunk_size_ is less than the item length
       if (builder_->length() > 0) {
@@ -287,25 +320,38 @@ class ARROW_EXPORT ChunkedBinaryBuilder {
 
   Status Reserve(int64_t values) { return builder_->Reserve(values); }
 
+  /// \brief Return the chunks built so far, and reset the builder
+  ///
+  /// There is always at least one chunk, which may be empty.
   virtual Status Finish(ArrayVector* out);
 
+  /// \brief Return the values built so far as a ChunkedArray, and reset the
+  /// builder
+  Status Finish(std::shared_ptr<ChunkedArray>* out);
+
+  /// \brief The number of values appended so far
+  int64_t length() const;
+
  protected:
   Status NextChunk();
 
   int32_t max_chunk_size_;
   int32_t chunk_data_size_;
+  int64_t finished_length_;
 
   std::unique_ptr<BinaryBuilder> builder_;
   std::vector<std::shared_ptr<Array>> chunks_;
 };
 
+/// \class ChunkedStringBuilder
+/// \brief Builder of UTF8 values that may exceed the 2GB limit of a
+/// StringArray, as a ChunkedArray
 class ARROW_EXPORT ChunkedStringBuilder : public ChunkedBinaryBuilder {
  public:
   using ChunkedBinaryBuilder::ChunkedBinaryBuilder;
+  using ChunkedBinaryBuilder::Finish;
 
   Status Finish(ArrayVector* out) override;
 };
 
-}  // namespace internal
-
 }  // namespace arrow
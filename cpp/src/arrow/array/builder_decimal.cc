@@ -54,9 +54,9 @@ Status Decimal128Builder::Append(const Decimal128& value) {
 
 Status Decimal128Builder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   std::shared_ptr<Buffer> data;
-  RETURN_NOT_OK(byte_builder_.Finish(&data));
+  RETURN_NOT_OK(byte_builder_.Finish(&data, shrink_to_fit_));
   std::shared_ptr<Buffer> null_bitmap;
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap, shrink_to_fit_));
 
   *out = ArrayData::Make(type_, length_, {null_bitmap, data}, null_count_);
 
@@ -20,7 +20,6 @@
 #include <algorithm>
 #include <cstdint>
 #include <limits>
-#include <sstream>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -40,61 +39,146 @@ namespace arrow {
 using internal::checked_cast;
 
 // ----------------------------------------------------------------------
-// DictionaryType unification
+// Dictionary unification
+
+namespace {
+
+// The smallest index type for a dictionary of the given length
+std::shared_ptr<DataType> DictionaryIndexType(int64_t dictionary_length) {
+  if (dictionary_length <= std::numeric_limits<int8_t>::max()) {
+    return int8();
+  } else if (dictionary_length <= std::numeric_limits<int16_t>::max()) {
+    return int16();
+  } else if (dictionary_length <= std::numeric_limits<int32_t>::max()) {
+    return int32();
+  } else {
+    return int64();
+  }
+}
+
+template <typename T>
+class DictionaryUnifierImpl : public DictionaryUnifier {
+ public:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+  using DictTraits = typename internal::DictionaryTraits<T>;
+  using MemoTableType = typename DictTraits::MemoTableType;
+
+  DictionaryUnifierImpl(MemoryPool* pool, std::shared_ptr<DataType> value_type)
+      : pool_(pool), value_type_(std::move(value_type)) {}
+
+  Status Unify(const Array& dictionary, std::vector<int32_t>* out_transpose) override {
+    RETURN_NOT_OK(CheckDictionary(dictionary));
+    const ArrayType& values = checked_cast<const ArrayType&>(dictionary);
+    if (out_transpose != nullptr) {
+      out_transpose->resize(values.length());
+      int32_t* transpose = out_transpose->data();
+      for (int64_t i = 0; i < values.length(); ++i) {
+        transpose[i] = memo_table_.GetOrInsert(values.GetView(i));
+      }
+    } else {
+      for (int64_t i = 0; i < values.length(); ++i) {
+        memo_table_.GetOrInsert(values.GetView(i));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Unify(const Array& dictionary) override { return Unify(dictionary, nullptr); }
+
+  Status GetResult(std::shared_ptr<DataType>* out_type) override {
+    std::shared_ptr<ArrayData> data;
+    RETURN_NOT_OK(DictTraits::GetDictionaryArrayData(pool_, value_type_, memo_table_,
+                                                     0 /* start_offset */, &data));
+    *out_type = arrow::dictionary(DictionaryIndexType(data->length), MakeArray(data));
+    return Status::OK();
+  }
+
+ private:
+  Status CheckDictionary(const Array& dictionary) {
+    if (!dictionary.type()->Equals(*value_type_)) {
+      return Status::TypeError("Dictionary type ", dictionary.type()->ToString(),
+                               " different from unifier type ",
+                               value_type_->ToString());
+    }
+    if (dictionary.null_count() != 0) {
+      return Status::TypeError("Dictionary has null values");
+    }
+    return Status::OK();
+  }
 
-struct UnifyDictionaryValues {
   MemoryPool* pool_;
   std::shared_ptr<DataType> value_type_;
-  const std::vector<const DictionaryType*>& types_;
-  std::shared_ptr<Array>* out_values_;
-  std::vector<std::vector<int32_t>>* out_transpose_maps_;
+  MemoTableType memo_table_;
+};
+
+struct MakeUnifier {
+  MemoryPool* pool;
+  std::shared_ptr<DataType> value_type;
+  std::unique_ptr<DictionaryUnifier>* out;
 
   Status Visit(const DataType&, void* = nullptr) {
     // Default implementation for non-dictionary-supported datatypes
-    std::stringstream ss;
-    ss << "Unification of " << value_type_->ToString()
-       << " dictionaries is not implemented";
-    return Status::NotImplemented(ss.str());
+    return Status::NotImplemented("Unification of ", value_type->ToString(),
+                                  " dictionaries is not implemented");
   }
 
   template <typename T>
   Status Visit(const T&,
                typename internal::DictionaryTraits<T>::MemoTableType* = nullptr) {
-    using ArrayType = typename TypeTraits<T>::ArrayType;
-    using DictTraits = typename internal::DictionaryTraits<T>;
-    using MemoTableType = typename DictTraits::MemoTableType;
-
-    MemoTableType memo_table;
-    if (out_transpose_maps_ != nullptr) {
-      out_transpose_maps_->clear();
-      out_transpose_maps_->reserve(types_.size());
-    }
-    // Build up the unified dictionary values and the transpose maps
-    for (const auto& type : types_) {
-      const ArrayType& values = checked_cast<const ArrayType&>(*type->dictionary());
-      if (out_transpose_maps_ != nullptr) {
-        std::vector<int32_t> transpose_map;
-        transpose_map.reserve(values.length());
-        for (int64_t i = 0; i < values.length(); ++i) {
-          int32_t dict_index = memo_table.GetOrInsert(values.GetView(i));
-          transpose_map.push_back(dict_index);
-        }
-        out_transpose_maps_->push_back(std::move(transpose_map));
-      } else {
-        for (int64_t i = 0; i < values.length(); ++i) {
-          memo_table.GetOrInsert(values.GetView(i));
-        }
-      }
-    }
-    // Build unified dictionary array
-    std::shared_ptr<ArrayData> data;
-    RETURN_NOT_OK(DictTraits::GetDictionaryArrayData(pool_, value_type_, memo_table,
-                                                     0 /* start_offset */, &data));
-    *out_values_ = MakeArray(data);
+    out->reset(new DictionaryUnifierImpl<T>(pool, value_type));
     return Status::OK();
   }
 };
 
+// Whether the transposition maps each index to itself
+bool IsIdentityTranspose(const std::vector<int32_t>& transpose_map) {
+  for (size_t i = 0; i < transpose_map.size(); ++i) {
+    if (transpose_map[i] != static_cast<int32_t>(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+Status DictionaryUnifier::Make(MemoryPool* pool,
+                               const std::shared_ptr<DataType>& value_type,
+                               std::unique_ptr<DictionaryUnifier>* out) {
+  MakeUnifier visitor{pool, value_type, out};
+  return VisitTypeInline(*value_type, &visitor);
+}
+
+Status DictionaryUnifier::UnifyArrays(MemoryPool* pool,
+                                      const std::vector<std::shared_ptr<Array>>& arrays,
+                                      std::vector<std::shared_ptr<Array>>* out) {
+  std::vector<const DataType*> types;
+  types.reserve(arrays.size());
+  for (const auto& array : arrays) {
+    types.push_back(array->type().get());
+  }
+  std::shared_ptr<DataType> type;
+  std::vector<std::vector<int32_t>> transpose_maps;
+  RETURN_NOT_OK(DictionaryType::Unify(pool, types, &type, &transpose_maps));
+
+  const auto& index_type = *checked_cast<const DictionaryType&>(*type).index_type();
+  std::vector<std::shared_ptr<Array>> results(arrays.size());
+  for (size_t i = 0; i < arrays.size(); ++i) {
+    const auto& array = checked_cast<const DictionaryArray&>(*arrays[i]);
+    if (array.dict_type()->index_type()->Equals(index_type) &&
+        IsIdentityTranspose(transpose_maps[i])) {
+      // The indices are valid as is
+      auto data = array.data()->Copy();
+      data->type = type;
+      results[i] = MakeArray(data);
+    } else {
+      RETURN_NOT_OK(array.Transpose(pool, type, transpose_maps[i], &results[i]));
+    }
+  }
+  *out = std::move(results);
+  return Status::OK();
+}
+
 Status DictionaryType::Unify(MemoryPool* pool, const std::vector<const DataType*>& types,
                              std::shared_ptr<DataType>* out_type,
                              std::vector<std::vector<int32_t>>* out_transpose_maps) {
@@ -122,26 +206,21 @@ Status DictionaryType::Unify(MemoryPool* pool, const std::vector<const DataType*
     }
   }
 
-  std::shared_ptr<Array> values;
-  {
-    UnifyDictionaryValues visitor{pool, value_type, dict_types, &values,
-                                  out_transpose_maps};
-    RETURN_NOT_OK(VisitTypeInline(*value_type, &visitor));
-  }
-
-  // Build unified dictionary type with the right index type
-  std::shared_ptr<DataType> index_type;
-  if (values->length() <= std::numeric_limits<int8_t>::max()) {
-    index_type = int8();
-  } else if (values->length() <= std::numeric_limits<int16_t>::max()) {
-    index_type = int16();
-  } else if (values->length() <= std::numeric_limits<int32_t>::max()) {
-    index_type = int32();
+  std::unique_ptr<DictionaryUnifier> unifier;
+  RETURN_NOT_OK(DictionaryUnifier::Make(pool, value_type, &unifier));
+  if (out_transpose_maps != nullptr) {
+    out_transpose_maps->clear();
+    out_transpose_maps->resize(dict_types.size());
+    for (size_t i = 0; i < dict_types.size(); ++i) {
+      RETURN_NOT_OK(
+          unifier->Unify(*dict_types[i]->dictionary(), &(*out_transpose_maps)[i]));
+    }
   } else {
-    index_type = int64();
+    for (const auto& type : dict_types) {
+      RETURN_NOT_OK(unifier->Unify(*type->dictionary()));
+    }
   }
-  *out_type = arrow::dictionary(index_type, values);
-  return Status::OK();
+  return unifier->GetResult(out_type);
 }
 
 // ----------------------------------------------------------------------
@@ -191,6 +270,11 @@ void DictionaryBuilder<T>::Reset() {
   delta_offset_ = 0;
 }
 
+template <typename T>
+int64_t DictionaryBuilder<T>::dictionary_length() const {
+  return memo_table_->size();
+}
+
 template <typename T>
 Status DictionaryBuilder<T>::Resize(int64_t capacity) {
   RETURN_NOT_OK(CheckCapacity(capacity, capacity_));
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "arrow/array/builder_adaptive.h"  // IWYU pragma: export
 #include "arrow/array/builder_base.h"      // IWYU pragma: export
@@ -105,6 +106,9 @@ class ARROW_EXPORT DictionaryBuilder : public ArrayBuilder {
   /// is the dictionary builder in the delta building mode
   bool is_building_delta() { return delta_offset_ > 0; }
 
+  /// \brief The number of distinct values appended so far
+  int64_t dictionary_length() const;
+
  protected:
   class MemoTableImpl;
   std::unique_ptr<MemoTableImpl> memo_table_;
@@ -164,4 +168,50 @@ class ARROW_EXPORT StringDictionaryBuilder : public DictionaryBuilder<StringType
   }
 };
 
+// ----------------------------------------------------------------------
+// Dictionary unification
+
+/// \brief Merge dictionaries into a common one, without touching indices
+///
+/// Each dictionary is added in turn to a hash table of the unified values,
+/// yielding the transpose map of its indices into the unified dictionary.
+/// Dictionary-encoded data is then remapped with DictionaryArray::Transpose
+/// rather than decoded and encoded again.
+class ARROW_EXPORT DictionaryUnifier {
+ public:
+  virtual ~DictionaryUnifier() = default;
+
+  /// \brief Make a unifier for dictionaries of the given value type
+  static Status Make(MemoryPool* pool, const std::shared_ptr<DataType>& value_type,
+                     std::unique_ptr<DictionaryUnifier>* out);
+
+  /// \brief Add the values of a dictionary to the unified dictionary
+  ///
+  /// \param[in] dictionary the dictionary values, without nulls
+  /// \param[out] out_transpose the unified dictionary index of each value
+  virtual Status Unify(const Array& dictionary, std::vector<int32_t>* out_transpose) = 0;
+
+  /// \brief Add the values of a dictionary to the unified dictionary
+  virtual Status Unify(const Array& dictionary) = 0;
+
+  /// \brief Get the unified dictionary type
+  ///
+  /// Its index type is the smallest signed integer type able to index the
+  /// unified dictionary.
+  virtual Status GetResult(std::shared_ptr<DataType>* out_type) = 0;
+
+  /// \brief Give dictionary arrays a common dictionary
+  ///
+  /// The indices of each array are remapped in a single pass.  Arrays whose
+  /// dictionary is a prefix of the unified one, and whose index type is
+  /// unchanged, share their indices with the result.
+  ///
+  /// \param[in] pool the memory pool to allocate the result from
+  /// \param[in] arrays dictionary arrays with the same value type
+  /// \param[out] out the arrays, all of the same unified dictionary type
+  static Status UnifyArrays(MemoryPool* pool,
+                            const std::vector<std::shared_ptr<Array>>& arrays,
+                            std::vector<std::shared_ptr<Array>>* out);
+};
+
 }  // namespace arrow
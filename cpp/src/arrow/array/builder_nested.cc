@@ -86,7 +86,7 @@ Status ListBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
 
   // Offset padding zeroed by BufferBuilder
   std::shared_ptr<Buffer> offsets;
-  RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
+  RETURN_NOT_OK(offsets_builder_.Finish(&offsets, shrink_to_fit_));
 
   std::shared_ptr<ArrayData> items;
   if (values_) {
@@ -106,7 +106,7 @@ Status ListBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
         std::make_shared<ListType>(value_builder_->type()));
   }
   std::shared_ptr<Buffer> null_bitmap;
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap, shrink_to_fit_));
   *out = ArrayData::Make(type_, length_, {null_bitmap, offsets}, null_count_);
   (*out)->child_data.emplace_back(std::move(items));
   Reset();
@@ -120,6 +120,17 @@ void ListBuilder::Reset() {
   value_builder_->Reset();
 }
 
+void ListBuilder::set_shrink_to_fit(bool shrink_to_fit) {
+  ArrayBuilder::set_shrink_to_fit(shrink_to_fit);
+  value_builder_->set_shrink_to_fit(shrink_to_fit);
+}
+
+void ListBuilder::set_recycle_buffers(bool recycle_buffers) {
+  ArrayBuilder::set_recycle_buffers(recycle_buffers);
+  offsets_builder_.set_recycle_buffers(recycle_buffers);
+  value_builder_->set_recycle_buffers(recycle_buffers);
+}
+
 ArrayBuilder* ListBuilder::value_builder() const {
   DCHECK(!values_) << "Using value builder is pointless when values_ is set";
   return value_builder_.get();
@@ -143,7 +154,7 @@ void StructBuilder::Reset() {
 
 Status StructBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   std::shared_ptr<Buffer> null_bitmap;
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap, shrink_to_fit_));
 
   std::vector<std::shared_ptr<ArrayData>> child_data(children_.size());
   for (size_t i = 0; i < children_.size(); ++i) {
@@ -51,6 +51,8 @@ class ARROW_EXPORT ListBuilder : public ArrayBuilder {
   Status Resize(int64_t capacity) override;
   void Reset() override;
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+  void set_shrink_to_fit(bool shrink_to_fit) override;
+  void set_recycle_buffers(bool recycle_buffers) override;
 
   /// \brief Vector append
   ///
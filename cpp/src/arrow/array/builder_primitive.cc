@@ -58,6 +58,11 @@ void BooleanBuilder::Reset() {
   data_builder_.Reset();
 }
 
+void BooleanBuilder::set_recycle_buffers(bool recycle_buffers) {
+  ArrayBuilder::set_recycle_buffers(recycle_buffers);
+  data_builder_.set_recycle_buffers(recycle_buffers);
+}
+
 Status BooleanBuilder::Resize(int64_t capacity) {
   RETURN_NOT_OK(CheckCapacity(capacity, capacity_));
   capacity = std::max(capacity, kMinBuilderCapacity);
@@ -67,8 +72,8 @@ Status BooleanBuilder::Resize(int64_t capacity) {
 
 Status BooleanBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   std::shared_ptr<Buffer> data, null_bitmap;
-  RETURN_NOT_OK(data_builder_.Finish(&data));
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(data_builder_.Finish(&data, shrink_to_fit_));
+  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap, shrink_to_fit_));
 
   *out = ArrayData::Make(boolean(), length_, {null_bitmap, data}, null_count_);
 
@@ -83,7 +83,15 @@ class NumericBuilder : public ArrayBuilder {
 
   value_type GetValue(int64_t index) const { return data_builder_.data()[index]; }
 
-  void Reset() override { data_builder_.Reset(); }
+  void Reset() override {
+    ArrayBuilder::Reset();
+    data_builder_.Reset();
+  }
+
+  void set_recycle_buffers(bool recycle_buffers) override {
+    ArrayBuilder::set_recycle_buffers(recycle_buffers);
+    data_builder_.set_recycle_buffers(recycle_buffers);
+  }
 
   Status Resize(int64_t capacity) override {
     ARROW_RETURN_NOT_OK(CheckCapacity(capacity, capacity_));
@@ -107,6 +115,21 @@ class NumericBuilder : public ArrayBuilder {
     return Status::OK();
   }
 
+  /// \brief Append a sequence of elements in one shot
+  /// \param[in] values a contiguous C array of values
+  /// \param[in] length the number of values to append
+  /// \param[in] bitmap a packed validity bitmap where a set bit indicates a
+  /// valid (non-null) value, or null if all values are valid
+  /// \param[in] bitmap_offset the bit offset of the first value in bitmap
+  /// \return Status
+  Status AppendValues(const value_type* values, int64_t length, const uint8_t* bitmap,
+                      int64_t bitmap_offset) {
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    data_builder_.UnsafeAppend(values, length);
+    ArrayBuilder::UnsafeAppendToBitmap(bitmap, bitmap_offset, length);
+    return Status::OK();
+  }
+
   /// \brief Append a sequence of elements in one shot
   /// \param[in] values a contiguous C array of values
   /// \param[in] length the number of values to append
@@ -141,8 +164,8 @@ class NumericBuilder : public ArrayBuilder {
 
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override {
     std::shared_ptr<Buffer> data, null_bitmap;
-    ARROW_RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
-    ARROW_RETURN_NOT_OK(data_builder_.Finish(&data));
+    ARROW_RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap, shrink_to_fit_));
+    ARROW_RETURN_NOT_OK(data_builder_.Finish(&data, shrink_to_fit_));
     *out = ArrayData::Make(type_, length_, {null_bitmap, data}, null_count_);
     capacity_ = length_ = null_count_ = 0;
     return Status::OK();
@@ -393,6 +416,7 @@ class ARROW_EXPORT BooleanBuilder : public ArrayBuilder {
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
   void Reset() override;
   Status Resize(int64_t capacity) override;
+  void set_recycle_buffers(bool recycle_buffers) override;
 
  protected:
   TypedBufferBuilder<bool> data_builder_;
@@ -27,14 +27,20 @@ DenseUnionBuilder::DenseUnionBuilder(MemoryPool* pool,
                                      const std::shared_ptr<DataType>& type)
     : ArrayBuilder(type, pool), types_builder_(pool), offsets_builder_(pool) {}
 
+void DenseUnionBuilder::set_recycle_buffers(bool recycle_buffers) {
+  ArrayBuilder::set_recycle_buffers(recycle_buffers);
+  types_builder_.set_recycle_buffers(recycle_buffers);
+  offsets_builder_.set_recycle_buffers(recycle_buffers);
+}
+
 Status DenseUnionBuilder::FinishInternal(std::shared_ptr<ArrayData>* out) {
   std::shared_ptr<Buffer> types;
-  RETURN_NOT_OK(types_builder_.Finish(&types));
+  RETURN_NOT_OK(types_builder_.Finish(&types, shrink_to_fit_));
   std::shared_ptr<Buffer> offsets;
-  RETURN_NOT_OK(offsets_builder_.Finish(&offsets));
+  RETURN_NOT_OK(offsets_builder_.Finish(&offsets, shrink_to_fit_));
 
   std::shared_ptr<Buffer> null_bitmap;
-  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap));
+  RETURN_NOT_OK(null_bitmap_builder_.Finish(&null_bitmap, shrink_to_fit_));
 
   std::vector<std::shared_ptr<Field>> fields;
   std::vector<std::shared_ptr<ArrayData>> child_data(children_.size());
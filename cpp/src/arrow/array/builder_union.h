@@ -64,6 +64,7 @@ class ARROW_EXPORT DenseUnionBuilder : public ArrayBuilder {
   }
 
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override;
+  void set_recycle_buffers(bool recycle_buffers) override;
 
   /// \brief Make a new child builder available to the UnionArray
   ///
@@ -0,0 +1,181 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+
+class TestConcatenate : public ::testing::Test {
+ protected:
+  // Slice an array into pieces at the given offsets, concatenate them and
+  // check that the result equals the array
+  void CheckRoundtrip(const std::shared_ptr<Array>& array,
+                      const std::vector<int64_t>& split_points) {
+    ArrayVector pieces;
+    int64_t start = 0;
+    for (int64_t point : split_points) {
+      pieces.push_back(array->Slice(start, point - start));
+      start = point;
+    }
+    pieces.push_back(array->Slice(start));
+
+    std::shared_ptr<Array> out;
+    ASSERT_OK(Concatenate(pieces, default_memory_pool(), &out));
+    ASSERT_OK(ValidateArray(*out));
+    ASSERT_EQ(0, out->offset());
+    AssertArraysEqual(*array, *out);
+  }
+
+  void CheckRoundtrip(const std::shared_ptr<DataType>& type, const std::string& json) {
+    CheckRoundtrip(ArrayFromJSON(type, json), {0, 1, 4, 4, 6});
+  }
+};
+
+TEST_F(TestConcatenate, Primitives) {
+  CheckRoundtrip(int8(), "[1, 2, null, 4, 5, 6, null, 8, 9]");
+  CheckRoundtrip(int64(), "[1, 2, null, 4, 5, 6, null, 8, 9]");
+  CheckRoundtrip(float64(), "[1.5, 2, null, 4, 5, 6, null, 8, 9]");
+  CheckRoundtrip(boolean(), "[true, false, null, true, true, false, null, true, false]");
+  CheckRoundtrip(null(), "[null, null, null, null, null, null, null]");
+  CheckRoundtrip(fixed_size_binary(2), R"(["ab", "cd", null, "ef", "gh", "ij", "kl"])");
+}
+
+TEST_F(TestConcatenate, NoNulls) {
+  CheckRoundtrip(int32(), "[1, 2, 3, 4, 5, 6, 7, 8, 9]");
+  CheckRoundtrip(utf8(), R"(["a", "bc", "", "def", "g", "hi", "j"])");
+}
+
+TEST_F(TestConcatenate, Strings) {
+  CheckRoundtrip(utf8(), R"(["a", "bc", null, "", "def", null, "ghij", "k"])");
+  CheckRoundtrip(binary(), R"(["a", "bc", null, "", "def", null, "ghij", "k"])");
+}
+
+TEST_F(TestConcatenate, Lists) {
+  CheckRoundtrip(list(int16()), "[[1, 2], null, [], [3], [4, null, 5], [6], null, [7]]");
+  CheckRoundtrip(list(list(utf8())),
+                 R"([[["a"], []], null, [null, ["b", "c"]], [], [["d"]], [["e", "f"]],
+                     [], [["g"]]])");
+}
+
+TEST_F(TestConcatenate, Structs) {
+  auto type = struct_({field("a", int32()), field("b", list(utf8()))});
+  CheckRoundtrip(type, R"([{"a": 1, "b": ["x"]}, null, {"a": null, "b": []},
+                           {"a": 4, "b": null}, {"a": 5, "b": ["y", "z"]},
+                           {"a": 6, "b": []}, null, {"a": 8, "b": ["w"]}])");
+}
+
+TEST_F(TestConcatenate, Unions) {
+  auto type_ids = ArrayFromJSON(int8(), "[0, 1, 0, 0, 1, 1, 0, 1]");
+  auto ints = ArrayFromJSON(int32(), "[1, 2, 3, 4, 5, 6, 7, 8]");
+  auto strings = ArrayFromJSON(utf8(), R"(["a", "b", "c", "d", "e", "f", "g", "h"])");
+
+  std::shared_ptr<Array> sparse;
+  ASSERT_OK(UnionArray::MakeSparse(*type_ids, {ints, strings}, &sparse));
+  CheckRoundtrip(sparse, {0, 1, 4, 4, 6});
+
+  auto offsets = ArrayFromJSON(int32(), "[0, 0, 1, 2, 1, 2, 3, 3]");
+  std::shared_ptr<Array> dense;
+  ASSERT_OK(UnionArray::MakeDense(*type_ids, *offsets, {ints, strings}, &dense));
+
+  ArrayVector pieces = {dense->Slice(0, 3), dense->Slice(3)};
+  std::shared_ptr<Array> out;
+  ASSERT_OK(Concatenate(pieces, default_memory_pool(), &out));
+  ASSERT_OK(ValidateArray(*out));
+  ASSERT_EQ(dense->length(), out->length());
+  // The children are concatenated whole, so the offsets into them are shifted
+  const auto& dense_union = static_cast<const UnionArray&>(*dense);
+  const auto& out_union = static_cast<const UnionArray&>(*out);
+  for (int j = 0; j < 2; ++j) {
+    ASSERT_EQ(2 * dense_union.child(j)->length(), out_union.child(j)->length());
+  }
+  for (int64_t i = 0; i < dense->length(); ++i) {
+    const int8_t type_id = dense_union.raw_type_ids()[i];
+    ASSERT_EQ(type_id, out_union.raw_type_ids()[i]);
+    const int32_t shift = i < 3 ? 0 : 8;
+    ASSERT_EQ(dense_union.raw_value_offsets()[i] + shift,
+              out_union.raw_value_offsets()[i]);
+  }
+}
+
+TEST_F(TestConcatenate, DictionarySameType) {
+  auto type = dictionary(int8(), ArrayFromJSON(utf8(), R"(["a", "b", "c"])"));
+  auto indices = ArrayFromJSON(int8(), "[0, 1, null, 2, 2, 1, null, 0]");
+  CheckRoundtrip(std::make_shared<DictionaryArray>(type, indices), {0, 1, 4, 4, 6});
+}
+
+TEST_F(TestConcatenate, DictionaryUnified) {
+  auto type1 = dictionary(int8(), ArrayFromJSON(utf8(), R"(["a", "b"])"));
+  auto type2 = dictionary(int8(), ArrayFromJSON(utf8(), R"(["c", "a"])"));
+  auto dict1 = std::make_shared<DictionaryArray>(
+      type1, ArrayFromJSON(int8(), "[1, 0, null, 1]"));
+  auto dict2 = std::make_shared<DictionaryArray>(
+      type2, ArrayFromJSON(int8(), "[null, 0, 1, 0]"));
+
+  std::shared_ptr<Array> out;
+  ASSERT_OK(Concatenate({dict1->Slice(1), dict2}, default_memory_pool(), &out));
+  ASSERT_OK(ValidateArray(*out));
+
+  auto expected_type =
+      dictionary(int8(), ArrayFromJSON(utf8(), R"(["a", "b", "c"])"));
+  auto expected = std::make_shared<DictionaryArray>(
+      expected_type, ArrayFromJSON(int8(), "[0, null, 1, null, 2, 0, 2]"));
+  AssertArraysEqual(*expected, *out);
+}
+
+TEST_F(TestConcatenate, Errors) {
+  std::shared_ptr<Array> out;
+  ASSERT_RAISES(Invalid, Concatenate({}, default_memory_pool(), &out));
+  ASSERT_RAISES(Invalid, Concatenate({ArrayFromJSON(int8(), "[1]"),
+                                      ArrayFromJSON(int16(), "[1]")},
+                                     default_memory_pool(), &out));
+}
+
+TEST(TestCombineChunks, Basics) {
+  auto schema = ::arrow::schema({field("a", int32()), field("b", utf8())});
+  auto a = std::make_shared<Column>(
+      schema->field(0), ArrayVector{ArrayFromJSON(int32(), "[1, 2]"),
+                                    ArrayFromJSON(int32(), "[3, null, 5]")});
+  auto b = std::make_shared<Column>(
+      schema->field(1), ArrayFromJSON(utf8(), R"(["a", "b", null, "c", "d"])"));
+  auto table = Table::Make(schema, {a, b});
+
+  std::shared_ptr<Table> out;
+  ASSERT_OK(table->CombineChunks(default_memory_pool(), &out));
+  ASSERT_OK(out->Validate());
+  ASSERT_TRUE(out->Equals(*table));
+  for (int i = 0; i < out->num_columns(); ++i) {
+    ASSERT_EQ(1, out->column(i)->data()->num_chunks());
+  }
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, 3, null, 5]"),
+                    *out->column(0)->data()->chunk(0));
+  // Single chunks are kept as is
+  ASSERT_EQ(table->column(1)->data()->chunk(0), out->column(1)->data()->chunk(0));
+}
+
+}  // namespace arrow
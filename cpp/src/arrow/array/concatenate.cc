@@ -0,0 +1,311 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/array/concatenate.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+namespace {
+
+// A range of values, e.g. the child values of a range of list elements
+struct Range {
+  int64_t offset;
+  int64_t length;
+};
+
+// Zero-copy view of a range of the elements of an array
+std::shared_ptr<ArrayData> SliceData(const ArrayData& data, int64_t offset,
+                                     int64_t length) {
+  auto out = std::make_shared<ArrayData>(data);
+  out->offset += offset;
+  out->length = length;
+  out->null_count = data.null_count == 0 ? 0 : kUnknownNullCount;
+  return out;
+}
+
+class ConcatenateImpl {
+ public:
+  ConcatenateImpl(const std::vector<std::shared_ptr<ArrayData>>& in, MemoryPool* pool)
+      : in_(in), pool_(pool), out_(std::make_shared<ArrayData>(in[0]->type, 0, 0)) {
+    for (const auto& data : in_) {
+      out_->length += data->length;
+      out_->null_count += data->GetNullCount();
+    }
+    out_->buffers.resize(in_[0]->buffers.size());
+    out_->child_data.resize(in_[0]->child_data.size());
+  }
+
+  Status Concatenate(std::shared_ptr<ArrayData>* out) {
+    if (out_->type->id() == Type::DICTIONARY && !SameTypes()) {
+      return ConcatenateUnifiedDictionaries(out);
+    }
+    if (out_->type->id() != Type::NA && out_->null_count != 0) {
+      RETURN_NOT_OK(ConcatenateBitmaps(0, &out_->buffers[0]));
+    }
+    RETURN_NOT_OK(VisitTypeInline(*out_->type, this));
+    *out = std::move(out_);
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) { return Status::OK(); }
+
+  Status Visit(const BooleanType&) { return ConcatenateBitmaps(1, &out_->buffers[1]); }
+
+  // Numbers, temporal types, fixed size binary, decimals and dictionary indices
+  Status Visit(const FixedWidthType& fixed) {
+    return ConcatenateFixedWidth(1, fixed.bit_width() / 8, &out_->buffers[1]);
+  }
+
+  Status Visit(const BinaryType&) {
+    std::vector<Range> value_ranges;
+    RETURN_NOT_OK(ConcatenateOffsets(&out_->buffers[1], &value_ranges));
+
+    int64_t data_size = 0;
+    for (const auto& range : value_ranges) {
+      data_size += range.length;
+    }
+    RETURN_NOT_OK(AllocateBuffer(pool_, data_size, &out_->buffers[2]));
+    uint8_t* dst = out_->buffers[2]->mutable_data();
+    for (size_t i = 0; i < in_.size(); ++i) {
+      if (value_ranges[i].length == 0) continue;
+      std::memcpy(dst, in_[i]->buffers[2]->data() + value_ranges[i].offset,
+                  static_cast<size_t>(value_ranges[i].length));
+      dst += value_ranges[i].length;
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const ListType&) {
+    std::vector<Range> value_ranges;
+    RETURN_NOT_OK(ConcatenateOffsets(&out_->buffers[1], &value_ranges));
+
+    std::vector<std::shared_ptr<ArrayData>> values(in_.size());
+    for (size_t i = 0; i < in_.size(); ++i) {
+      values[i] = SliceData(*in_[i]->child_data[0], value_ranges[i].offset,
+                            value_ranges[i].length);
+    }
+    return ConcatenateImpl(values, pool_).Concatenate(&out_->child_data[0]);
+  }
+
+  Status Visit(const StructType&) { return ConcatenateAlignedChildren(); }
+
+  Status Visit(const UnionType& type) {
+    RETURN_NOT_OK(ConcatenateFixedWidth(1, sizeof(uint8_t), &out_->buffers[1]));
+    if (type.mode() == UnionMode::SPARSE) {
+      return ConcatenateAlignedChildren();
+    }
+
+    // The children of dense unions are concatenated whole, and the value
+    // offsets shifted by the lengths of the children before them
+    std::vector<int> child_ids(std::numeric_limits<uint8_t>::max() + 1, -1);
+    for (size_t j = 0; j < type.type_codes().size(); ++j) {
+      child_ids[type.type_codes()[j]] = static_cast<int>(j);
+    }
+    std::vector<int64_t> shifts(out_->child_data.size(), 0);
+    RETURN_NOT_OK(
+        AllocateBuffer(pool_, out_->length * sizeof(int32_t), &out_->buffers[2]));
+    auto dst = reinterpret_cast<int32_t*>(out_->buffers[2]->mutable_data());
+    for (const auto& data : in_) {
+      for (size_t j = 0; j < shifts.size(); ++j) {
+        if (shifts[j] > std::numeric_limits<int32_t>::max()) {
+          return Status::CapacityError("Concatenated union child has ", shifts[j],
+                                       " values, more than int32 offsets allow");
+        }
+      }
+      const uint8_t* type_codes = data->GetValues<uint8_t>(1);
+      const int32_t* offsets = data->GetValues<int32_t>(2);
+      for (int64_t k = 0; k < data->length; ++k) {
+        const int child_id = child_ids[type_codes[k]];
+        dst[k] = offsets[k] + static_cast<int32_t>(shifts[child_id]);
+      }
+      dst += data->length;
+      for (size_t j = 0; j < shifts.size(); ++j) {
+        shifts[j] += data->child_data[j]->length;
+      }
+    }
+
+    for (size_t j = 0; j < out_->child_data.size(); ++j) {
+      std::vector<std::shared_ptr<ArrayData>> children(in_.size());
+      for (size_t i = 0; i < in_.size(); ++i) {
+        children[i] = in_[i]->child_data[j];
+      }
+      RETURN_NOT_OK(ConcatenateImpl(children, pool_).Concatenate(&out_->child_data[j]));
+    }
+    return Status::OK();
+  }
+
+ private:
+  bool SameTypes() const {
+    for (const auto& data : in_) {
+      if (!data->type->Equals(*out_->type)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Concatenate the children of struct or sparse union arrays, whose elements
+  // are aligned with those of their parent
+  Status ConcatenateAlignedChildren() {
+    for (size_t j = 0; j < out_->child_data.size(); ++j) {
+      std::vector<std::shared_ptr<ArrayData>> children(in_.size());
+      for (size_t i = 0; i < in_.size(); ++i) {
+        children[i] = SliceData(*in_[i]->child_data[j], in_[i]->offset, in_[i]->length);
+      }
+      RETURN_NOT_OK(ConcatenateImpl(children, pool_).Concatenate(&out_->child_data[j]));
+    }
+    return Status::OK();
+  }
+
+  // Concatenate bitmaps, absent ones being all set
+  Status ConcatenateBitmaps(int index, std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool_, out_->length, out));
+    uint8_t* dst = (*out)->mutable_data();
+    int64_t position = 0;
+    for (const auto& data : in_) {
+      const auto& bitmap = data->buffers[index];
+      if (bitmap) {
+        internal::CopyBitmap(bitmap->data(), data->offset, data->length, dst, position);
+      } else {
+        BitUtil::SetBitsTo(dst, position, data->length, true);
+      }
+      position += data->length;
+    }
+    return Status::OK();
+  }
+
+  Status ConcatenateFixedWidth(int index, int byte_width, std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(AllocateBuffer(pool_, out_->length * byte_width, out));
+    uint8_t* dst = (*out)->mutable_data();
+    for (const auto& data : in_) {
+      if (data->length == 0) continue;
+      const int64_t nbytes = data->length * byte_width;
+      std::memcpy(dst, data->buffers[index]->data() + data->offset * byte_width,
+                  static_cast<size_t>(nbytes));
+      dst += nbytes;
+    }
+    return Status::OK();
+  }
+
+  // Concatenate int32 offsets, rebased on the values of the arrays before
+  // them, and return the range of values of each array
+  Status ConcatenateOffsets(std::shared_ptr<Buffer>* out,
+                            std::vector<Range>* value_ranges) {
+    value_ranges->resize(in_.size());
+    int64_t values_length = 0;
+    for (size_t i = 0; i < in_.size(); ++i) {
+      Range& range = (*value_ranges)[i];
+      if (in_[i]->length == 0) {
+        range.offset = range.length = 0;
+        continue;
+      }
+      const int32_t* offsets = in_[i]->GetValues<int32_t>(1);
+      range.offset = offsets[0];
+      range.length = offsets[in_[i]->length] - offsets[0];
+      values_length += range.length;
+    }
+    if (values_length > std::numeric_limits<int32_t>::max()) {
+      return Status::CapacityError("Concatenated array has ", values_length,
+                                   " values, more than int32 offsets allow");
+    }
+
+    RETURN_NOT_OK(AllocateBuffer(pool_, (out_->length + 1) * sizeof(int32_t), out));
+    auto dst = reinterpret_cast<int32_t*>((*out)->mutable_data());
+    int32_t position = 0;
+    for (size_t i = 0; i < in_.size(); ++i) {
+      if (in_[i]->length == 0) continue;
+      const int32_t* offsets = in_[i]->GetValues<int32_t>(1);
+      const int32_t shift = position - offsets[0];
+      for (int64_t k = 0; k < in_[i]->length; ++k) {
+        dst[k] = offsets[k] + shift;
+      }
+      dst += in_[i]->length;
+      position += static_cast<int32_t>((*value_ranges)[i].length);
+    }
+    *dst = position;
+    return Status::OK();
+  }
+
+  // Transpose the indices of dictionary arrays with different dictionaries
+  // into a unified dictionary before concatenating them
+  Status ConcatenateUnifiedDictionaries(std::shared_ptr<ArrayData>* out) {
+    std::vector<const DataType*> types;
+    for (const auto& data : in_) {
+      types.push_back(data->type.get());
+    }
+    std::shared_ptr<DataType> type;
+    std::vector<std::vector<int32_t>> transpose_maps;
+    RETURN_NOT_OK(DictionaryType::Unify(pool_, types, &type, &transpose_maps));
+
+    std::vector<std::shared_ptr<ArrayData>> transposed(in_.size());
+    for (size_t i = 0; i < in_.size(); ++i) {
+      std::shared_ptr<Array> array;
+      RETURN_NOT_OK(
+          DictionaryArray(in_[i]).Transpose(pool_, type, transpose_maps[i], &array));
+      transposed[i] = array->data();
+    }
+    return ConcatenateImpl(transposed, pool_).Concatenate(out);
+  }
+
+  const std::vector<std::shared_ptr<ArrayData>>& in_;
+  MemoryPool* pool_;
+  std::shared_ptr<ArrayData> out_;
+};
+
+}  // namespace
+
+Status Concatenate(const std::vector<std::shared_ptr<Array>>& arrays, MemoryPool* pool,
+                   std::shared_ptr<Array>* out) {
+  if (arrays.size() == 0) {
+    return Status::Invalid("Must pass at least one array");
+  }
+
+  std::vector<std::shared_ptr<ArrayData>> data(arrays.size());
+  for (size_t i = 0; i < arrays.size(); ++i) {
+    if (arrays[i]->type_id() != arrays[0]->type_id() ||
+        (arrays[i]->type_id() != Type::DICTIONARY &&
+         !arrays[i]->type()->Equals(*arrays[0]->type()))) {
+      return Status::Invalid("Array at index ", i, " has type ",
+                             arrays[i]->type()->ToString(), ", expected ",
+                             arrays[0]->type()->ToString());
+    }
+    data[i] = arrays[i]->data();
+  }
+
+  std::shared_ptr<ArrayData> out_data;
+  RETURN_NOT_OK(ConcatenateImpl(data, pool).Concatenate(&out_data));
+  *out = MakeArray(out_data);
+  return Status::OK();
+}
+
+}  // namespace arrow
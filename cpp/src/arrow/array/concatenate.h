@@ -0,0 +1,48 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_ARRAY_CONCATENATE_H
+#define ARROW_ARRAY_CONCATENATE_H
+
+#include <memory>
+#include <vector>
+
+#include "arrow/memory_pool.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class Status;
+
+/// \brief Concatenate arrays into a single contiguous array
+///
+/// The arrays must all have the same type, except for dictionary arrays,
+/// whose dictionaries are unified (see DictionaryType::Unify) when they
+/// differ. Each buffer of the result is allocated once, at its final size.
+/// \param[in] arrays the arrays to concatenate, at least one
+/// \param[in] pool the memory pool to allocate the result from
+/// \param[out] out the concatenated array
+/// \return Status, CapacityError if the data of a binary or list result
+/// exceeds the limit of its int32 offsets
+ARROW_EXPORT
+Status Concatenate(const std::vector<std::shared_ptr<Array>>& arrays, MemoryPool* pool,
+                   std::shared_ptr<Array>* out);
+
+}  // namespace arrow
+
+#endif  // ARROW_ARRAY_CONCATENATE_H
@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -43,7 +44,20 @@ namespace arrow {
 class ARROW_EXPORT BufferBuilder {
  public:
   explicit BufferBuilder(MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT)
-      : pool_(pool), data_(NULLPTR), capacity_(0), size_(0) {}
+      : pool_(pool), data_(NULLPTR), capacity_(0), size_(0), recycle_buffers_(false) {}
+
+  /// \brief Set whether the builder keeps a reference to the buffers it
+  /// finishes, so as to build the next buffer into the memory of the last one
+  /// once all other references to it are released
+  ///
+  /// With shrink_to_fit false in Finish, repeatedly building buffers of
+  /// similar sizes then reaches a steady state without allocations.  Off by
+  /// default.  Consumers on other threads must release the buffer by
+  /// dropping their shared_ptr, after which they must not access its memory.
+  void set_recycle_buffers(bool recycle_buffers) {
+    recycle_buffers_ = recycle_buffers;
+    if (!recycle_buffers_) finished_buffer_ = NULLPTR;
+  }
 
   /// \brief Resize the buffer to the nearest multiple of 64 bytes
   ///
@@ -58,7 +72,14 @@ class ARROW_EXPORT BufferBuilder {
       return Status::OK();
     }
     int64_t old_capacity = capacity_;
-    if (buffer_ == NULLPTR) {
+    if (buffer_ == NULLPTR && finished_buffer_ && finished_buffer_.use_count() == 1) {
+      // The last finished buffer was released, reuse its memory.  use_count()
+      // is a relaxed load: the fence makes the reads by the consumer that
+      // dropped the last other reference happen before our writes.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      buffer_ = std::move(finished_buffer_);
+      ARROW_RETURN_NOT_OK(buffer_->Resize(new_capacity, false));
+    } else if (buffer_ == NULLPTR) {
       ARROW_RETURN_NOT_OK(AllocateResizableBuffer(pool_, new_capacity, &buffer_));
     } else {
       ARROW_RETURN_NOT_OK(buffer_->Resize(new_capacity, shrink_to_fit));
@@ -163,6 +184,9 @@ class ARROW_EXPORT BufferBuilder {
   }
 
   void Reset() {
+    if (recycle_buffers_ && buffer_ != NULLPTR) {
+      finished_buffer_ = std::move(buffer_);
+    }
     buffer_ = NULLPTR;
     capacity_ = size_ = 0;
   }
@@ -178,6 +202,8 @@ class ARROW_EXPORT BufferBuilder {
   uint8_t* data_;
   int64_t capacity_;
   int64_t size_;
+  bool recycle_buffers_;
+  std::shared_ptr<ResizableBuffer> finished_buffer_;
 };
 
 template <typename T, typename Enable = void>
@@ -243,12 +269,21 @@ class TypedBufferBuilder<T, typename std::enable_if<std::is_arithmetic<T>::value
     return bytes_builder_.Advance(length * sizeof(T));
   }
 
+  // Advance pointer, but don't allocate or zero memory
+  void UnsafeAdvance(const int64_t length) {
+    bytes_builder_.UnsafeAdvance(length * sizeof(T));
+  }
+
   Status Finish(std::shared_ptr<Buffer>* out, bool shrink_to_fit = true) {
     return bytes_builder_.Finish(out, shrink_to_fit);
   }
 
   void Reset() { bytes_builder_.Reset(); }
 
+  void set_recycle_buffers(bool recycle_buffers) {
+    bytes_builder_.set_recycle_buffers(recycle_buffers);
+  }
+
   int64_t length() const { return bytes_builder_.length() / sizeof(T); }
   int64_t capacity() const { return bytes_builder_.capacity() / sizeof(T); }
   const T* data() const { return reinterpret_cast<const T*>(bytes_builder_.data()); }
@@ -283,6 +318,12 @@ class TypedBufferBuilder<bool> {
     return Status::OK();
   }
 
+  Status AppendBitmap(const uint8_t* bitmap, int64_t offset, int64_t num_elements) {
+    ARROW_RETURN_NOT_OK(ResizeWithGrowthFactor(bit_length_ + num_elements));
+    UnsafeAppendBitmap(bitmap, offset, num_elements);
+    return Status::OK();
+  }
+
   void UnsafeAppend(bool value) {
     BitUtil::SetBitTo(mutable_data(), bit_length_, value);
     if (!value) {
@@ -308,6 +349,14 @@ class TypedBufferBuilder<bool> {
     bit_length_ += num_copies;
   }
 
+  // Append the bits of a packed bitmap, starting at a bit offset
+  void UnsafeAppendBitmap(const uint8_t* bitmap, int64_t offset, int64_t num_elements) {
+    if (num_elements == 0) return;
+    internal::CopyBitmap(bitmap, offset, num_elements, mutable_data(), bit_length_);
+    false_count_ += num_elements - internal::CountSetBits(bitmap, offset, num_elements);
+    bit_length_ += num_elements;
+  }
+
   template <bool count_falses, typename Generator>
   void UnsafeAppend(const int64_t num_elements, Generator&& gen) {
     if (num_elements == 0) return;
@@ -359,6 +408,10 @@ class TypedBufferBuilder<bool> {
     bit_length_ = false_count_ = 0;
   }
 
+  void set_recycle_buffers(bool recycle_buffers) {
+    bytes_builder_.set_recycle_buffers(recycle_buffers);
+  }
+
   int64_t length() const { return bit_length_; }
   int64_t capacity() const { return bytes_builder_.capacity() * 8; }
   const uint8_t* data() const { return bytes_builder_.data(); }
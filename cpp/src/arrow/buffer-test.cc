@@ -16,11 +16,15 @@
 // under the License.
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -28,6 +32,7 @@
 
 #include "arrow/buffer-builder.h"
 #include "arrow/buffer.h"
+#include "arrow/buffer_pool.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
@@ -277,6 +282,82 @@ TEST(TestBufferBuilder, ResizeReserve) {
   ASSERT_EQ(128, builder.capacity());
 }
 
+TEST(TestBufferBuilder, RecycleBuffers) {
+  const std::string data = "some data";
+  auto data_ptr = data.c_str();
+
+  BufferBuilder builder;
+  builder.set_recycle_buffers(true);
+
+  ASSERT_OK(builder.Resize(128));
+  ASSERT_OK(builder.Append(data_ptr, 9));
+  std::shared_ptr<Buffer> first;
+  ASSERT_OK(builder.Finish(&first, false));
+  ASSERT_EQ(9, first->size());
+  ASSERT_EQ(128, first->capacity());
+  const uint8_t* first_data = first->data();
+
+  // The finished buffer is still referenced, so new memory is allocated
+  std::shared_ptr<Buffer> second;
+  ASSERT_OK(builder.Append(data_ptr, 4));
+  ASSERT_OK(builder.Finish(&second, false));
+  ASSERT_NE(first_data, second->data());
+  const uint8_t* second_data = second->data();
+
+  // Once released, the last finished buffer is reused
+  second.reset();
+  ASSERT_OK(builder.Append(data_ptr, 9));
+  ASSERT_EQ(second_data, builder.data());
+  std::shared_ptr<Buffer> third;
+  ASSERT_OK(builder.Finish(&third, false));
+  AssertBufferEqual(*third, "some data");
+  AssertBufferEqual(*first, "some data");
+}
+
+TEST(TestBufferBuilder, RecycleBuffersAcrossThreads) {
+  // Finished buffers are released by a consumer on another thread while the
+  // builder goes on building, possibly into their memory
+  constexpr int kNumBuffers = 1000;
+  constexpr int64_t kBufferSize = 256;
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::deque<std::shared_ptr<Buffer>> queue;
+  bool all_uniform = true;
+
+  std::thread consumer([&] {
+    for (int i = 0; i < kNumBuffers; ++i) {
+      std::shared_ptr<Buffer> buffer;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] { return !queue.empty(); });
+        buffer = std::move(queue.front());
+        queue.pop_front();
+      }
+      const uint8_t* data = buffer->data();
+      all_uniform &= std::all_of(data, data + kBufferSize,
+                                 [&](uint8_t byte) { return byte == data[0]; });
+    }
+  });
+
+  BufferBuilder builder;
+  builder.set_recycle_buffers(true);
+  std::vector<uint8_t> values(kBufferSize);
+  for (int i = 0; i < kNumBuffers; ++i) {
+    std::fill(values.begin(), values.end(), static_cast<uint8_t>(i));
+    // Not ASSERT_OK, which would return without joining the consumer
+    ABORT_NOT_OK(builder.Append(values.data(), kBufferSize));
+    std::shared_ptr<Buffer> buffer;
+    ABORT_NOT_OK(builder.Finish(&buffer, false));
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      queue.push_back(std::move(buffer));
+    }
+    cv.notify_one();
+  }
+  consumer.join();
+  ASSERT_TRUE(all_uniform);
+}
+
 template <typename T>
 class TypedTestBufferBuilder : public ::testing::Test {};
 
@@ -453,4 +534,62 @@ TYPED_TEST(TypedTestBuffer, ResizeOOM) {
 #endif
 }
 
+TEST(TestBufferPool, Recycling) {
+  ProxyMemoryPool memory_pool(default_memory_pool());
+  BufferPool pool(1000, 2, &memory_pool);
+
+  std::shared_ptr<ResizableBuffer> buf1, buf2, buf3;
+  ASSERT_OK(pool.GetBuffer(1000, &buf1));
+  ASSERT_EQ(1000, buf1->size());
+  ASSERT_OK(pool.GetBuffer(10, &buf2));
+  ASSERT_EQ(10, buf2->size());
+  ASSERT_GE(buf2->capacity(), 1000);
+  ASSERT_OK(pool.GetBuffer(2000, &buf3));
+  ASSERT_EQ(2000, buf3->size());
+  ASSERT_EQ(0, pool.num_idle_buffers());
+  const uint8_t* data1 = buf1->data();
+  const uint8_t* data3 = buf3->data();
+
+  // Released buffers are retained up to max_buffers
+  buf1.reset();
+  ASSERT_EQ(1, pool.num_idle_buffers());
+  buf3.reset();
+  ASSERT_EQ(2, pool.num_idle_buffers());
+  buf2.reset();
+  ASSERT_EQ(2, pool.num_idle_buffers());
+  const int64_t bytes_allocated = memory_pool.bytes_allocated();
+
+  // Idle buffers are reused, if large enough
+  ASSERT_OK(pool.GetBuffer(1500, &buf1));
+  ASSERT_EQ(data3, buf1->data());
+  ASSERT_EQ(1500, buf1->size());
+  ASSERT_OK(pool.GetBuffer(800, &buf2));
+  ASSERT_EQ(data1, buf2->data());
+  ASSERT_EQ(bytes_allocated, memory_pool.bytes_allocated());
+  ASSERT_EQ(0, pool.num_idle_buffers());
+
+  // A buffer shrunk below the pool's capacity is not recycled
+  ASSERT_OK(buf2->Resize(10));
+  buf2.reset();
+  ASSERT_EQ(0, pool.num_idle_buffers());
+
+  buf1.reset();
+  ASSERT_EQ(1, pool.num_idle_buffers());
+  pool.Clear();
+  ASSERT_EQ(0, pool.num_idle_buffers());
+  ASSERT_EQ(0, memory_pool.bytes_allocated());
+}
+
+TEST(TestBufferPool, OutlivesPool) {
+  ProxyMemoryPool memory_pool(default_memory_pool());
+  std::shared_ptr<ResizableBuffer> buf;
+  {
+    BufferPool pool(100, 1, &memory_pool);
+    ASSERT_OK(pool.GetBuffer(100, &buf));
+  }
+  ASSERT_EQ(128, memory_pool.bytes_allocated());
+  buf.reset();
+  ASSERT_EQ(0, memory_pool.bytes_allocated());
+}
+
 }  // namespace arrow
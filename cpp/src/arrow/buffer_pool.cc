@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/buffer_pool.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+class BufferPool::Impl : public std::enable_shared_from_this<BufferPool::Impl> {
+ public:
+  Impl(int64_t buffer_capacity, int32_t max_buffers, MemoryPool* pool)
+      : buffer_capacity_(buffer_capacity), max_buffers_(max_buffers), pool_(pool) {}
+
+  Status GetBuffer(int64_t size, std::shared_ptr<ResizableBuffer>* out) {
+    std::unique_ptr<ResizableBuffer> buffer;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      // Most recently returned buffers are likelier to be in CPU cache
+      for (auto it = idle_buffers_.rbegin(); it != idle_buffers_.rend(); ++it) {
+        if ((*it)->capacity() >= size) {
+          buffer = std::move(*it);
+          idle_buffers_.erase(std::next(it).base());
+          break;
+        }
+      }
+    }
+    if (buffer) {
+      RETURN_NOT_OK(buffer->Resize(size, false /* shrink_to_fit */));
+    } else {
+      RETURN_NOT_OK(AllocateResizableBuffer(pool_, std::max(size, buffer_capacity_),
+                                            &buffer));
+      RETURN_NOT_OK(buffer->Resize(size, false /* shrink_to_fit */));
+    }
+    // Give the buffer back to the pool (if still alive) when released
+    std::weak_ptr<Impl> weak_self = shared_from_this();
+    out->reset(buffer.release(), [weak_self](ResizableBuffer* released) {
+      std::unique_ptr<ResizableBuffer> owned(released);
+      auto self = weak_self.lock();
+      if (self) {
+        self->PutBuffer(std::move(owned));
+      }
+    });
+    return Status::OK();
+  }
+
+  void PutBuffer(std::unique_ptr<ResizableBuffer> buffer) {
+    if (buffer->capacity() < buffer_capacity_) {
+      // Was shrunk by its user, not worth keeping
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (static_cast<int32_t>(idle_buffers_.size()) < max_buffers_) {
+      idle_buffers_.push_back(std::move(buffer));
+    }
+  }
+
+  void Clear() {
+    std::vector<std::unique_ptr<ResizableBuffer>> buffers;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      buffers.swap(idle_buffers_);
+    }
+  }
+
+  int64_t buffer_capacity() const { return buffer_capacity_; }
+
+  int32_t max_buffers() const { return max_buffers_; }
+
+  int32_t num_idle_buffers() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int32_t>(idle_buffers_.size());
+  }
+
+ private:
+  const int64_t buffer_capacity_;
+  const int32_t max_buffers_;
+  MemoryPool* pool_;
+
+  mutable std::mutex mutex_;
+  std::vector<std::unique_ptr<ResizableBuffer>> idle_buffers_;
+};
+
+BufferPool::BufferPool(int64_t buffer_capacity, int32_t max_buffers, MemoryPool* pool)
+    : impl_(std::make_shared<Impl>(buffer_capacity, max_buffers, pool)) {
+  DCHECK_GE(buffer_capacity, 0);
+  DCHECK_GE(max_buffers, 0);
+}
+
+BufferPool::~BufferPool() {}
+
+Status BufferPool::GetBuffer(int64_t size, std::shared_ptr<ResizableBuffer>* out) {
+  return impl_->GetBuffer(size, out);
+}
+
+void BufferPool::Clear() { impl_->Clear(); }
+
+int64_t BufferPool::buffer_capacity() const { return impl_->buffer_capacity(); }
+
+int32_t BufferPool::max_buffers() const { return impl_->max_buffers(); }
+
+int32_t BufferPool::num_idle_buffers() const { return impl_->num_idle_buffers(); }
+
+}  // namespace arrow
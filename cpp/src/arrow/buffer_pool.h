@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_BUFFER_POOL_H
+#define ARROW_BUFFER_POOL_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/memory_pool.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class ResizableBuffer;
+class Status;
+
+/// \class BufferPool
+/// \brief A cache of reusable fixed-capacity ResizableBuffers
+///
+/// Readers processing data in fixed-size blocks can draw their block buffers
+/// from a BufferPool rather than allocating a fresh buffer per block.  A buffer
+/// handed out by the pool goes back to it once the last reference to it is
+/// dropped, so that a steady-state scan performs no block allocations at all.
+/// At most max_buffers idle buffers are retained; additional buffers are
+/// released to the underlying MemoryPool.
+///
+/// Buffers may outlive the BufferPool, in which case they are released
+/// normally.  This class is thread-safe.
+class ARROW_EXPORT BufferPool {
+ public:
+  /// \brief Create a BufferPool
+  ///
+  /// \param[in] buffer_capacity the capacity of buffers allocated by the pool
+  /// \param[in] max_buffers the maximum number of idle buffers retained
+  /// \param[in] pool the MemoryPool buffers are allocated from
+  BufferPool(int64_t buffer_capacity, int32_t max_buffers,
+             MemoryPool* pool ARROW_MEMORY_POOL_DEFAULT);
+  ~BufferPool();
+
+  /// \brief Get a buffer of the given size
+  ///
+  /// An idle buffer is reused if it is large enough, otherwise a new buffer
+  /// with a capacity of at least buffer_capacity is allocated.  The buffer
+  /// contents are undefined.
+  Status GetBuffer(int64_t size, std::shared_ptr<ResizableBuffer>* out);
+
+  /// \brief Release all idle buffers to the underlying MemoryPool
+  void Clear();
+
+  int64_t buffer_capacity() const;
+  int32_t max_buffers() const;
+
+  /// The number of idle buffers currently retained
+  int32_t num_idle_buffers() const;
+
+ private:
+  class Impl;
+  std::shared_ptr<Impl> impl_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(BufferPool);
+};
+
+}  // namespace arrow
+
+#endif  // ARROW_BUFFER_POOL_H
@@ -188,7 +188,7 @@ static void BM_BuildChunkedBinaryArray(
   for (auto _ : state) {
     // 1MB chunks
     const int32_t chunksize = 1 << 20;
-    internal::ChunkedBinaryBuilder builder(chunksize);
+    ChunkedBinaryBuilder builder(chunksize);
     for (int64_t i = 0; i < iterations; i++) {
       ABORT_NOT_OK(builder.Append(reinterpret_cast<const uint8_t*>(value.data()),
                                   static_cast<int32_t>(value.size())));
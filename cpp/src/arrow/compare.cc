@@ -50,6 +50,52 @@ using internal::checked_cast;
 
 namespace internal {
 
+// Whether pred(start, end) holds for each run [start, end) of set bits in a
+// bit range, stopping at the first run for which it doesn't.  A null bitmap
+// is all set.
+template <typename Predicate>
+static bool AllSetBitRuns(const uint8_t* bitmap, int64_t offset, int64_t length,
+                          Predicate&& pred) {
+  if (bitmap == nullptr) {
+    return length == 0 || pred(0, length);
+  }
+  int64_t position = 0;
+  while (position < length) {
+    position += FindNextSetBit(bitmap, offset + position, length - position);
+    if (position == length) {
+      break;
+    }
+    const int64_t run_length =
+        FindNextUnsetBit(bitmap, offset + position, length - position);
+    if (!pred(position, position + run_length)) {
+      return false;
+    }
+    position += run_length;
+  }
+  return true;
+}
+
+// The validity bitmap of an array, or null if it has no nulls
+static const uint8_t* NullBitmapIfNulls(const Array& array) {
+  return array.null_count() > 0 ? array.null_bitmap_data() : nullptr;
+}
+
+// Whether two ranges of the same length have their nulls at the same positions
+static bool NullsRangeEquals(const Array& left, int64_t left_start, const Array& right,
+                             int64_t right_start, int64_t length) {
+  const uint8_t* left_bitmap = NullBitmapIfNulls(left);
+  const uint8_t* right_bitmap = NullBitmapIfNulls(right);
+  if (left_bitmap != nullptr && right_bitmap != nullptr) {
+    return BitmapEquals(left_bitmap, left.offset() + left_start, right_bitmap,
+                        right.offset() + right_start, length);
+  } else if (left_bitmap != nullptr) {
+    return CountSetBits(left_bitmap, left.offset() + left_start, length) == length;
+  } else if (right_bitmap != nullptr) {
+    return CountSetBits(right_bitmap, right.offset() + right_start, length) == length;
+  }
+  return true;
+}
+
 class RangeEqualsVisitor {
  public:
   RangeEqualsVisitor(const Array& right, int64_t left_start_idx, int64_t left_end_idx,
@@ -77,28 +123,69 @@ class RangeEqualsVisitor {
     return Status::OK();
   }
 
+  // Compare the valid values of fixed-width arrays, a run of valid values at
+  // a time.  The data pointers include the arrays' offsets.
+  bool CompareFixedWidthRange(const Array& left, const uint8_t* left_data,
+                              const uint8_t* right_data, int64_t byte_width) const {
+    const int64_t length = left_end_idx_ - left_start_idx_;
+    if (!NullsRangeEquals(left, left_start_idx_, right_, right_start_idx_, length)) {
+      return false;
+    }
+    return AllSetBitRuns(
+        NullBitmapIfNulls(left), left.offset() + left_start_idx_, length,
+        [&](int64_t start, int64_t end) {
+          const int64_t left_pos = (left_start_idx_ + start) * byte_width;
+          const int64_t right_pos = (right_start_idx_ + start) * byte_width;
+          return std::memcmp(left_data + left_pos, right_data + right_pos,
+                             static_cast<size_t>((end - start) * byte_width)) == 0;
+        });
+  }
+
   bool CompareBinaryRange(const BinaryArray& left) const {
     const auto& right = checked_cast<const BinaryArray&>(right_);
+    const int64_t length = left_end_idx_ - left_start_idx_;
+    if (!NullsRangeEquals(left, left_start_idx_, right, right_start_idx_, length)) {
+      return false;
+    }
 
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
-        return false;
-      }
-      if (is_null) continue;
-      const int32_t begin_offset = left.value_offset(i);
-      const int32_t end_offset = left.value_offset(i + 1);
-      const int32_t right_begin_offset = right.value_offset(o_i);
-      const int32_t right_end_offset = right.value_offset(o_i + 1);
+    const int32_t* left_offsets = left.raw_value_offsets() + left_start_idx_;
+    const int32_t* right_offsets = right.raw_value_offsets() + right_start_idx_;
+    const uint8_t* left_data = left.value_data() ? left.value_data()->data() : nullptr;
+    const uint8_t* right_data = right.value_data() ? right.value_data()->data() : nullptr;
+
+    // When the value offsets match, compare the data of runs of valid values
+    // in bulk
+    bool offsets_equal = true;
+    for (int64_t i = 1; i <= length; ++i) {
+      offsets_equal &=
+          (left_offsets[i] - left_offsets[0] == right_offsets[i] - right_offsets[0]);
+    }
+    if (offsets_equal) {
+      return AllSetBitRuns(
+          NullBitmapIfNulls(left), left.offset() + left_start_idx_, length,
+          [&](int64_t start, int64_t end) {
+            const int32_t nbytes = left_offsets[end] - left_offsets[start];
+            return nbytes == 0 ||
+                   std::memcmp(left_data + left_offsets[start],
+                               right_data + right_offsets[start],
+                               static_cast<size_t>(nbytes)) == 0;
+          });
+    }
+
+    // The offsets may still differ only in null slots
+    for (int64_t i = 0; i < length; ++i) {
+      if (left.IsNull(left_start_idx_ + i)) continue;
+      const int32_t begin_offset = left_offsets[i];
+      const int32_t end_offset = left_offsets[i + 1];
+      const int32_t right_begin_offset = right_offsets[i];
+      const int32_t right_end_offset = right_offsets[i + 1];
       // Underlying can't be equal if the size isn't equal
       if (end_offset - begin_offset != right_end_offset - right_begin_offset) {
         return false;
       }
 
       if (end_offset - begin_offset > 0 &&
-          std::memcmp(left.value_data()->data() + begin_offset,
-                      right.value_data()->data() + right_begin_offset,
+          std::memcmp(left_data + begin_offset, right_data + right_begin_offset,
                       static_cast<size_t>(end_offset - begin_offset))) {
         return false;
       }
@@ -225,35 +312,9 @@ class RangeEqualsVisitor {
 
   Status Visit(const FixedSizeBinaryArray& left) {
     const auto& right = checked_cast<const FixedSizeBinaryArray&>(right_);
-
-    int32_t width = left.byte_width();
-
-    const uint8_t* left_data = nullptr;
-    const uint8_t* right_data = nullptr;
-
-    if (left.values()) {
-      left_data = left.raw_values();
-    }
-
-    if (right.values()) {
-      right_data = right.raw_values();
-    }
-
-    for (int64_t i = left_start_idx_, o_i = right_start_idx_; i < left_end_idx_;
-         ++i, ++o_i) {
-      const bool is_null = left.IsNull(i);
-      if (is_null != right.IsNull(o_i)) {
-        result_ = false;
-        return Status::OK();
-      }
-      if (is_null) continue;
-
-      if (std::memcmp(left_data + width * i, right_data + width * o_i, width)) {
-        result_ = false;
-        return Status::OK();
-      }
-    }
-    result_ = true;
+    result_ = CompareFixedWidthRange(left, left.values() ? left.raw_values() : nullptr,
+                                     right.values() ? right.raw_values() : nullptr,
+                                     left.byte_width());
     return Status::OK();
   }
 
@@ -267,12 +328,52 @@ class RangeEqualsVisitor {
     return Status::OK();
   }
 
+  Status Visit(const BooleanArray& left) {
+    const auto& right = checked_cast<const BooleanArray&>(right_);
+    const int64_t length = left_end_idx_ - left_start_idx_;
+    if (!NullsRangeEquals(left, left_start_idx_, right, right_start_idx_, length)) {
+      result_ = false;
+      return Status::OK();
+    }
+    const uint8_t* left_data = left.values()->data();
+    const uint8_t* right_data = right.values()->data();
+    result_ = AllSetBitRuns(
+        NullBitmapIfNulls(left), left.offset() + left_start_idx_, length,
+        [&](int64_t start, int64_t end) {
+          return BitmapEquals(left_data, left.offset() + left_start_idx_ + start,
+                              right_data, right.offset() + right_start_idx_ + start,
+                              end - start);
+        });
+    return Status::OK();
+  }
+
+  // Floating-point values compare by value (e.g. 0.0 == -0.0), other
+  // primitive values bitwise
   template <typename T>
-  typename std::enable_if<std::is_base_of<PrimitiveArray, T>::value, Status>::type Visit(
-      const T& left) {
+  typename std::enable_if<std::is_base_of<PrimitiveArray, T>::value &&
+                              std::is_floating_point<typename T::value_type>::value,
+                          Status>::type
+  Visit(const T& left) {
     return CompareValues<T>(left);
   }
 
+  template <typename T>
+  typename std::enable_if<std::is_base_of<PrimitiveArray, T>::value &&
+                              !std::is_base_of<BooleanArray, T>::value &&
+                              !std::is_floating_point<typename T::value_type>::value,
+                          Status>::type
+  Visit(const T& left) {
+    const auto& right = checked_cast<const PrimitiveArray&>(right_);
+    const int64_t byte_width =
+        checked_cast<const FixedWidthType&>(*left.type()).bit_width() / CHAR_BIT;
+    const uint8_t* left_data =
+        left.values() ? left.values()->data() + left.offset() * byte_width : nullptr;
+    const uint8_t* right_data =
+        right.values() ? right.values()->data() + right.offset() * byte_width : nullptr;
+    result_ = CompareFixedWidthRange(left, left_data, right_data, byte_width);
+    return Status::OK();
+  }
+
   Status Visit(const ListArray& left) {
     result_ = CompareLists(left);
     return Status::OK();
@@ -334,19 +435,14 @@ static bool IsEqualPrimitive(const PrimitiveArray& left, const PrimitiveArray& r
     }
     return true;
   } else if (left.null_count() > 0) {
-    for (int64_t i = 0; i < left.length(); ++i) {
-      const bool left_null = left.IsNull(i);
-      const bool right_null = right.IsNull(i);
-      if (left_null != right_null) {
-        return false;
-      }
-      if (!left_null && memcmp(left_data, right_data, byte_width) != 0) {
-        return false;
-      }
-      left_data += byte_width;
-      right_data += byte_width;
-    }
-    return true;
+    // The null bitmaps are known to be equal: compare runs of valid values
+    return AllSetBitRuns(left.null_bitmap_data(), left.offset(), left.length(),
+                         [&](int64_t start, int64_t end) {
+                           const int64_t nbytes = (end - start) * byte_width;
+                           return memcmp(left_data + start * byte_width,
+                                         right_data + start * byte_width,
+                                         static_cast<size_t>(nbytes)) == 0;
+                         });
   } else {
     auto number_of_bytes_to_compare = static_cast<size_t>(byte_width * left.length());
     return memcmp(left_data, right_data, number_of_bytes_to_compare) == 0;
@@ -370,15 +466,12 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
     if (left.null_count() > 0) {
       const uint8_t* left_data = left.values()->data();
       const uint8_t* right_data = right.values()->data();
-
-      for (int64_t i = 0; i < left.length(); ++i) {
-        if (left.IsValid(i) && BitUtil::GetBit(left_data, i + left.offset()) !=
-                                   BitUtil::GetBit(right_data, i + right.offset())) {
-          result_ = false;
-          return Status::OK();
-        }
-      }
-      result_ = true;
+      result_ = AllSetBitRuns(left.null_bitmap_data(), left.offset(), left.length(),
+                              [&](int64_t start, int64_t end) {
+                                return BitmapEquals(left_data, left.offset() + start,
+                                                    right_data, right.offset() + start,
+                                                    end - start);
+                              });
     } else {
       result_ = BitmapEquals(left.values()->data(), left.offset(), right.values()->data(),
                              right.offset(), left.length());
@@ -451,19 +544,18 @@ class ArrayEqualsVisitor : public RangeEqualsVisitor {
                            static_cast<size_t>(total_bytes)) == 0;
       }
     } else {
-      // ARROW-537: Only compare data in non-null slots
+      // ARROW-537: Only compare data in non-null slots, a run of valid values
+      // at a time
       const int32_t* left_offsets = left.raw_value_offsets();
       const int32_t* right_offsets = right.raw_value_offsets();
-      for (int64_t i = 0; i < left.length(); ++i) {
-        if (left.IsNull(i)) {
-          continue;
-        }
-        if (std::memcmp(left_data + left_offsets[i], right_data + right_offsets[i],
-                        left.value_length(i))) {
-          return false;
-        }
-      }
-      return true;
+      return AllSetBitRuns(
+          left.null_bitmap_data(), left.offset(), left.length(),
+          [&](int64_t start, int64_t end) {
+            const int32_t nbytes = left_offsets[end] - left_offsets[start];
+            return std::memcmp(left_data + left_offsets[start],
+                               right_data + right_offsets[start],
+                               static_cast<size_t>(nbytes)) == 0;
+          });
     }
   }
 
@@ -817,7 +909,7 @@ struct SparseTensorEqualsImpl<SparseIndexType, SparseIndexType> {
     const uint8_t* right_data = right.data()->data();
 
     return memcmp(left_data, right_data,
-                  static_cast<size_t>(byte_width * left.non_zero_length()));
+                  static_cast<size_t>(byte_width * left.non_zero_length())) == 0;
   }
 };
 
@@ -839,6 +931,20 @@ inline bool SparseTensorEqualsImplDispatch(const SparseTensorImpl<SparseIndexTyp
                                                                               right_csr);
     }
 
+    case SparseTensorFormat::CSC: {
+      const auto& right_csc =
+          checked_cast<const SparseTensorImpl<SparseCSCIndex>&>(right);
+      return SparseTensorEqualsImpl<SparseIndexType, SparseCSCIndex>::Compare(left,
+                                                                              right_csc);
+    }
+
+    case SparseTensorFormat::CSF: {
+      const auto& right_csf =
+          checked_cast<const SparseTensorImpl<SparseCSFIndex>&>(right);
+      return SparseTensorEqualsImpl<SparseIndexType, SparseCSFIndex>::Compare(left,
+                                                                              right_csf);
+    }
+
     default:
       return false;
   }
@@ -870,6 +976,16 @@ bool SparseTensorEquals(const SparseTensor& left, const SparseTensor& right) {
       return SparseTensorEqualsImplDispatch(left_csr, right);
     }
 
+    case SparseTensorFormat::CSC: {
+      const auto& left_csc = checked_cast<const SparseTensorImpl<SparseCSCIndex>&>(left);
+      return SparseTensorEqualsImplDispatch(left_csc, right);
+    }
+
+    case SparseTensorFormat::CSF: {
+      const auto& left_csf = checked_cast<const SparseTensorImpl<SparseCSFIndex>&>(left);
+      return SparseTensorEqualsImplDispatch(left_csf, right);
+    }
+
     default:
       return false;
   }
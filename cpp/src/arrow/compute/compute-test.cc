@@ -29,6 +29,7 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
@@ -94,6 +95,10 @@ TEST_F(TestInvokeBinaryKernel, Exceptions) {
   // Different sized inputs
   ASSERT_RAISES(Invalid, detail::InvokeBinaryArrayKernel(&this->ctx_, &kernel, a1,
                                                          a1->Slice(1), &outputs));
+  // Scalars are only passed to kernels accepting them
+  std::shared_ptr<Scalar> scalar = std::make_shared<BooleanScalar>(true);
+  ASSERT_RAISES(Invalid, detail::InvokeBinaryArrayKernel(&this->ctx_, &kernel, scalar, a2,
+                                                         &outputs));
 }
 
 }  // namespace compute
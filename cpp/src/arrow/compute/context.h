@@ -70,10 +70,17 @@ class ARROW_EXPORT FunctionContext {
 
   internal::CpuInfo* cpu_info() const { return cpu_info_; }
 
+  /// \brief Whether thread-safe kernels may process the chunks of their
+  /// inputs concurrently on the global CPU thread pool (default false)
+  bool use_threads() const { return use_threads_; }
+
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
  private:
   Status status_;
   MemoryPool* pool_;
   internal::CpuInfo* cpu_info_;
+  bool use_threads_;
 };
 
 }  // namespace compute
@@ -0,0 +1,175 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/expression.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/boolean.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/test-util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestExpression : public ComputeFixture, public TestBase {
+ public:
+  // And(Invert(Cast(x, boolean)), b)
+  void MakeChain(std::shared_ptr<Expression>* out) {
+    auto x = Expression::Input(0, int32());
+    auto b = Expression::Input(1, boolean());
+    std::shared_ptr<Expression> cast, invert;
+    ASSERT_OK(MakeCastExpression(x, boolean(), CastOptions(), &cast));
+    ASSERT_OK(MakeInvertExpression(cast, &invert));
+    ASSERT_OK(MakeAndExpression(invert, b, out));
+  }
+
+  void ComputeChain(const Datum& x, const Datum& b, Datum* out) {
+    Datum cast, invert;
+    ASSERT_OK(Cast(&ctx_, x, boolean(), CastOptions(), &cast));
+    ASSERT_OK(Invert(&ctx_, cast, &invert));
+    ASSERT_OK(And(&ctx_, invert, b, out));
+  }
+
+  void CheckChain(const Datum& x, const Datum& b, int64_t morsel_length) {
+    std::shared_ptr<Expression> chain;
+    MakeChain(&chain);
+    Datum expected, actual;
+    ComputeChain(x, b, &expected);
+    ASSERT_OK(EvaluateExpression(&ctx_, *chain, {x, b}, &actual, morsel_length));
+    ASSERT_EQ(expected.kind(), actual.kind());
+    if (expected.kind() == Datum::ARRAY) {
+      ASSERT_OK(ValidateArray(*actual.make_array()));
+      AssertArraysEqual(*expected.make_array(), *actual.make_array());
+    } else {
+      AssertChunkedEqual(*expected.chunked_array(), *actual.chunked_array());
+    }
+  }
+};
+
+TEST_F(TestExpression, Basics) {
+  auto x = ArrayFromJSON(int32(), "[0, 1, null, 3, 0, 5, 0]");
+  auto b = ArrayFromJSON(boolean(), "[true, true, true, null, false, true, true]");
+  std::shared_ptr<Expression> chain;
+  MakeChain(&chain);
+  Datum out;
+  ASSERT_OK(EvaluateExpression(&ctx_, *chain, {x, b}, &out));
+  AssertArraysEqual(
+      *ArrayFromJSON(boolean(), "[true, false, null, null, false, false, true]"),
+      *out.make_array());
+
+  // Without nulls, the result has no validity bitmap
+  x = ArrayFromJSON(int32(), "[0, 1]");
+  b = ArrayFromJSON(boolean(), "[true, true]");
+  ASSERT_OK(EvaluateExpression(&ctx_, *chain, {x, b}, &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, false]"), *out.make_array());
+  ASSERT_EQ(nullptr, out.array()->buffers[0]);
+}
+
+TEST_F(TestExpression, Random) {
+  random::RandomArrayGenerator rand(0x5eed);
+  const int64_t length = 10007;
+  auto x = rand.Int32(length, 0, 3, 0.1);
+  auto b = rand.Boolean(length, 0.5, 0.2);
+  for (int64_t morsel_length : {1, 64, 100, 4096, 20000}) {
+    CheckChain(x, b, morsel_length);
+    // Unaligned and byte-aligned offsets
+    CheckChain(x->Slice(3), b->Slice(3), morsel_length);
+    CheckChain(x->Slice(8, 5000), b->Slice(16, 5000), morsel_length);
+  }
+}
+
+TEST_F(TestExpression, ChunkedInputs) {
+  random::RandomArrayGenerator rand(0x5eed);
+  auto x = rand.Int32(3000, 0, 3, 0.1);
+  auto b = rand.Boolean(3000, 0.5, 0.2);
+  auto chunked_x = std::make_shared<ChunkedArray>(
+      ArrayVector{x->Slice(0, 1000), x->Slice(1000, 1), x->Slice(1001)});
+  auto chunked_b =
+      std::make_shared<ChunkedArray>(ArrayVector{b->Slice(0, 500), b->Slice(500)});
+  CheckChain(chunked_x, chunked_b, 256);
+  CheckChain(chunked_x, b, 256);
+}
+
+TEST_F(TestExpression, UseThreads) {
+  random::RandomArrayGenerator rand(0x5eed);
+  const int64_t length = 300000;
+  auto x = rand.Int32(length, 0, 3, 0.1);
+  auto b = rand.Boolean(length, 0.5, 0.2);
+  ctx_.set_use_threads(true);
+  CheckChain(x, b, kDefaultExpressionMorselLength);
+  CheckChain(x->Slice(5), b->Slice(5), kDefaultExpressionMorselLength);
+}
+
+TEST_F(TestExpression, SharedSubexpression) {
+  // Xor(Cast(x), Invert(Cast(x))) is true wherever x is valid
+  auto x = Expression::Input(0, int32());
+  std::shared_ptr<Expression> cast, invert, xor_expr;
+  ASSERT_OK(MakeCastExpression(x, boolean(), CastOptions(), &cast));
+  ASSERT_OK(MakeInvertExpression(cast, &invert));
+  ASSERT_OK(MakeXorExpression(cast, invert, &xor_expr));
+  Datum out;
+  ASSERT_OK(EvaluateExpression(&ctx_, *xor_expr, {ArrayFromJSON(int32(), "[0, null, 2]")},
+                               &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, null, true]"), *out.make_array());
+}
+
+TEST_F(TestExpression, ZeroCopyCast) {
+  // Casting to the same type shares the input values, which are copied
+  auto x = Expression::Input(0, int32());
+  std::shared_ptr<Expression> cast;
+  ASSERT_OK(MakeCastExpression(x, int32(), CastOptions(), &cast));
+  auto values = ArrayFromJSON(int32(), "[1, null, 3, 4]");
+  Datum out;
+  ASSERT_OK(EvaluateExpression(&ctx_, *cast, {values->Slice(1)}, &out));
+  AssertArraysEqual(*values->Slice(1), *out.make_array());
+}
+
+TEST_F(TestExpression, Errors) {
+  auto x = Expression::Input(0, int32());
+  auto b = Expression::Input(1, boolean());
+  std::shared_ptr<Expression> expr;
+  ASSERT_RAISES(TypeError, MakeInvertExpression(x, &expr));
+  ASSERT_RAISES(TypeError, MakeAndExpression(b, x, &expr));
+
+  ASSERT_OK(MakeInvertExpression(b, &expr));
+  auto ints = ArrayFromJSON(int32(), "[1, 2]");
+  auto bools = ArrayFromJSON(boolean(), "[true, false]");
+  Datum out;
+  ASSERT_RAISES(Invalid, EvaluateExpression(&ctx_, *expr, {ints}, &out));
+  ASSERT_RAISES(TypeError, EvaluateExpression(&ctx_, *expr, {ints, ints}, &out));
+  ASSERT_RAISES(Invalid, EvaluateExpression(&ctx_, *expr, {ints, bools->Slice(1)}, &out));
+
+  // Kernel errors are reported
+  std::shared_ptr<Expression> narrow;
+  ASSERT_OK(MakeCastExpression(x, int8(), CastOptions::Safe(), &narrow));
+  auto wide = ArrayFromJSON(int32(), "[1, 1000]");
+  ASSERT_RAISES(Invalid, EvaluateExpression(&ctx_, *narrow, {wide}, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
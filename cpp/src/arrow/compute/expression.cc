@@ -0,0 +1,516 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/expression.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/boolean.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+
+namespace arrow {
+
+using internal::BitmapAnd;
+using internal::checked_cast;
+using internal::CopyBitmap;
+using internal::CountSetBits;
+
+namespace compute {
+
+Expression::Expression(const std::shared_ptr<DataType>& type) : type_(type) {}
+
+std::shared_ptr<Expression> Expression::Input(int index,
+                                              const std::shared_ptr<DataType>& type) {
+  std::shared_ptr<Expression> expr(new Expression(type));
+  expr->input_index_ = index;
+  return expr;
+}
+
+static Status CheckResultType(const DataType& type) {
+  if (!is_fixed_width(type.id())) {
+    return Status::Invalid("Expression results must have a fixed-width type, got ",
+                           type.ToString());
+  }
+  return Status::OK();
+}
+
+Status Expression::MakeUnary(const std::shared_ptr<UnaryKernel>& kernel,
+                             const std::shared_ptr<Expression>& operand,
+                             std::shared_ptr<Expression>* out) {
+  DCHECK(kernel);
+  DCHECK(operand);
+  std::shared_ptr<DataType> type = kernel->out_type();
+  RETURN_NOT_OK(CheckResultType(*type));
+  std::shared_ptr<Expression> expr(new Expression(type));
+  expr->unary_kernel_ = kernel;
+  expr->operands_ = {operand};
+  *out = std::move(expr);
+  return Status::OK();
+}
+
+Status Expression::MakeBinary(const std::shared_ptr<BinaryKernel>& kernel,
+                              const std::shared_ptr<DataType>& type,
+                              const std::shared_ptr<Expression>& left,
+                              const std::shared_ptr<Expression>& right,
+                              std::shared_ptr<Expression>* out) {
+  DCHECK(kernel);
+  DCHECK(left);
+  DCHECK(right);
+  RETURN_NOT_OK(CheckResultType(*type));
+  std::shared_ptr<Expression> expr(new Expression(type));
+  expr->binary_kernel_ = kernel;
+  expr->operands_ = {left, right};
+  *out = std::move(expr);
+  return Status::OK();
+}
+
+Status MakeCastExpression(const std::shared_ptr<Expression>& operand,
+                          const std::shared_ptr<DataType>& to_type,
+                          const CastOptions& options, std::shared_ptr<Expression>* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(GetCastFunction(*operand->type(), to_type, options, &kernel));
+  return Expression::MakeUnary(std::move(kernel), operand, out);
+}
+
+static Status CheckBooleanOperand(const Expression& operand) {
+  if (operand.type()->id() != Type::BOOL) {
+    return Status::TypeError("Expected a boolean operand, got ",
+                             operand.type()->ToString());
+  }
+  return Status::OK();
+}
+
+Status MakeInvertExpression(const std::shared_ptr<Expression>& operand,
+                            std::shared_ptr<Expression>* out) {
+  RETURN_NOT_OK(CheckBooleanOperand(*operand));
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(GetInvertKernel(&kernel));
+  return Expression::MakeUnary(std::move(kernel), operand, out);
+}
+
+template <typename GetKernel>
+static Status MakeBooleanBinaryExpression(GetKernel&& get_kernel,
+                                          const std::shared_ptr<Expression>& left,
+                                          const std::shared_ptr<Expression>& right,
+                                          std::shared_ptr<Expression>* out) {
+  RETURN_NOT_OK(CheckBooleanOperand(*left));
+  RETURN_NOT_OK(CheckBooleanOperand(*right));
+  std::unique_ptr<BinaryKernel> kernel;
+  RETURN_NOT_OK(get_kernel(&kernel));
+  return Expression::MakeBinary(std::move(kernel), boolean(), left, right, out);
+}
+
+Status MakeAndExpression(const std::shared_ptr<Expression>& left,
+                         const std::shared_ptr<Expression>& right,
+                         std::shared_ptr<Expression>* out) {
+  return MakeBooleanBinaryExpression(GetAndKernel, left, right, out);
+}
+
+Status MakeOrExpression(const std::shared_ptr<Expression>& left,
+                        const std::shared_ptr<Expression>& right,
+                        std::shared_ptr<Expression>* out) {
+  return MakeBooleanBinaryExpression(GetOrKernel, left, right, out);
+}
+
+Status MakeXorExpression(const std::shared_ptr<Expression>& left,
+                         const std::shared_ptr<Expression>& right,
+                         std::shared_ptr<Expression>* out) {
+  return MakeBooleanBinaryExpression(GetXorKernel, left, right, out);
+}
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Expression evaluation
+
+// An expression node, with its operands flattened to indices of nodes
+// evaluated before it
+struct Node {
+  const Expression* expr;
+  std::vector<int> operands;
+  // The bit width of the values, or 0 for an input which is not fixed-width
+  int bit_width;
+};
+
+int BitWidth(const DataType& type) {
+  if (!is_fixed_width(type.id())) {
+    return 0;
+  }
+  return checked_cast<const FixedWidthType&>(type).bit_width();
+}
+
+// The number of bytes taken by `length` values
+int64_t ValuesSize(int bit_width, int64_t length) {
+  return bit_width == 1 ? BitUtil::BytesForBits(length) : length * (bit_width / 8);
+}
+
+// The byte position of the value at `position`, a multiple of 8 for bitmaps
+int64_t ValuesOffset(int bit_width, int64_t position) {
+  return bit_width == 1 ? position / 8 : position * (bit_width / 8);
+}
+
+int64_t DatumLength(const Datum& datum) {
+  return datum.kind() == Datum::ARRAY ? datum.array()->length
+                                      : datum.chunked_array()->length();
+}
+
+// Flatten the tree in evaluation order, numbering shared subexpressions once
+int Flatten(const Expression& expr, std::unordered_map<const Expression*, int>* indices,
+            std::vector<Node>* nodes) {
+  auto it = indices->find(&expr);
+  if (it != indices->end()) {
+    return it->second;
+  }
+  Node node;
+  node.expr = &expr;
+  node.bit_width = BitWidth(*expr.type());
+  for (const auto& operand : expr.operands()) {
+    node.operands.push_back(Flatten(*operand, indices, nodes));
+  }
+  const int index = static_cast<int>(nodes->size());
+  nodes->push_back(std::move(node));
+  indices->emplace(&expr, index);
+  return index;
+}
+
+// Evaluates the nodes over consecutive morsels of rows, writing the result of
+// the root node into its final buffers and intermediate results into scratch
+// buffers which are reused for every morsel
+class MorselEvaluator {
+ public:
+  MorselEvaluator(FunctionContext* ctx, const std::vector<Node>& nodes,
+                  int64_t morsel_length)
+      : ctx_(ctx), nodes_(nodes), morsel_length_(morsel_length), views_(nodes.size()) {}
+
+  Status Init() {
+    scratch_validity_.resize(nodes_.size());
+    scratch_values_.resize(nodes_.size());
+    // The root node is the last one and writes into the final buffers
+    for (size_t i = 0; i + 1 < nodes_.size(); ++i) {
+      const Node& node = nodes_[i];
+      if (node.operands.empty()) {
+        continue;
+      }
+      RETURN_NOT_OK(ctx_->Allocate(BitUtil::BytesForBits(morsel_length_),
+                                   &scratch_validity_[i]));
+      RETURN_NOT_OK(ctx_->Allocate(ValuesSize(node.bit_width, morsel_length_),
+                                   &scratch_values_[i]));
+    }
+    return Status::OK();
+  }
+
+  // Evaluate rows [begin, end) of the inputs, `begin` being a multiple of 64
+  Status Evaluate(const std::vector<std::shared_ptr<ArrayData>>& inputs, int64_t begin,
+                  int64_t end, const std::shared_ptr<Buffer>& validity,
+                  const std::shared_ptr<Buffer>& values, int64_t* null_count) {
+    const int root = static_cast<int>(nodes_.size()) - 1;
+    const int root_width = nodes_[root].bit_width;
+    for (int64_t start = begin; start < end; start += morsel_length_) {
+      const int64_t length = std::min(morsel_length_, end - start);
+      auto root_validity = SliceMutableBuffer(validity, start / 8,
+                                              BitUtil::BytesForBits(length));
+      auto root_values = SliceMutableBuffer(values, ValuesOffset(root_width, start),
+                                            ValuesSize(root_width, length));
+      for (int i = 0; i <= root; ++i) {
+        const Node& node = nodes_[i];
+        if (node.operands.empty()) {
+          views_[i] = InputView(*inputs[node.expr->input_index()], node.bit_width, start,
+                                length);
+        } else if (i == root) {
+          RETURN_NOT_OK(EvaluateNode(i, length, root_validity, root_values));
+        } else {
+          RETURN_NOT_OK(
+              EvaluateNode(i, length, scratch_validity_[i], scratch_values_[i]));
+        }
+      }
+      const ArrayData& result = *views_[root];
+      if (result.buffers[0] == nullptr) {
+        BitUtil::SetBitsTo(root_validity->mutable_data(), 0, length, true);
+      } else {
+        *null_count += result.null_count;
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  // A view of `length` rows of an input from `start` without copying
+  static std::shared_ptr<ArrayData> InputView(const ArrayData& input, int bit_width,
+                                              int64_t start, int64_t length) {
+    const int64_t position = input.offset + start;
+    std::shared_ptr<Buffer> validity;
+    if (input.null_count != 0) {
+      validity = input.buffers[0];
+    }
+    const int64_t null_count = validity ? kUnknownNullCount : 0;
+    if (bit_width == 0 || position % 8 != 0) {
+      auto view = std::make_shared<ArrayData>(input);
+      view->buffers[0] = validity;
+      view->offset = position;
+      view->length = length;
+      view->null_count = null_count;
+      return view;
+    }
+    // Byte-aligned views have no offset, sparing kernels from realigning
+    // the validity bitmap
+    if (validity) {
+      validity = SliceBuffer(validity, position / 8, BitUtil::BytesForBits(length));
+    }
+    auto values = SliceBuffer(input.buffers[1], ValuesOffset(bit_width, position),
+                              ValuesSize(bit_width, length));
+    return ArrayData::Make(input.type, length, {validity, values}, null_count);
+  }
+
+  // Compute the validity of a node: the rows valid in all of its operands
+  Status ComputeValidity(const Node& node, int64_t length,
+                         const std::shared_ptr<Buffer>& target,
+                         std::shared_ptr<Buffer>* validity, int64_t* null_count) {
+    std::vector<const ArrayData*> nullable;
+    for (int operand : node.operands) {
+      const ArrayData& data = *views_[operand];
+      if (data.buffers[0] != nullptr && data.GetNullCount() != 0) {
+        nullable.push_back(&data);
+      }
+    }
+    if (nullable.empty()) {
+      *validity = nullptr;
+      *null_count = 0;
+      return Status::OK();
+    }
+    uint8_t* out = target->mutable_data();
+    const ArrayData& first = *nullable[0];
+    CopyBitmap(first.buffers[0]->data(), first.offset, length, out, 0);
+    for (size_t i = 1; i < nullable.size(); ++i) {
+      const ArrayData& other = *nullable[i];
+      BitmapAnd(out, 0, other.buffers[0]->data(), other.offset, length, 0, out);
+    }
+    *validity = target;
+    *null_count = length - CountSetBits(out, 0, length);
+    return Status::OK();
+  }
+
+  Status EvaluateNode(int index, int64_t length, const std::shared_ptr<Buffer>& validity,
+                      const std::shared_ptr<Buffer>& values) {
+    const Node& node = nodes_[index];
+    const std::shared_ptr<DataType>& type = node.expr->type();
+
+    std::shared_ptr<Buffer> node_validity;
+    int64_t null_count;
+    RETURN_NOT_OK(ComputeValidity(node, length, validity, &node_validity, &null_count));
+
+    Datum out(ArrayData::Make(type, length, {node_validity, values}, null_count));
+    if (node.expr->unary_kernel()) {
+      RETURN_NOT_OK(
+          node.expr->unary_kernel()->Call(ctx_, Datum(views_[node.operands[0]]), &out));
+    } else {
+      RETURN_NOT_OK(node.expr->binary_kernel()->Call(
+          ctx_, Datum(views_[node.operands[0]]), Datum(views_[node.operands[1]]), &out));
+    }
+    RETURN_IF_ERROR(ctx_);
+
+    // Kernels which do not write into the preallocated buffer, such as
+    // zero-copy casts, have their values copied
+    const ArrayData& result = *out.array();
+    if (result.buffers.size() < 2 || result.buffers[1] == nullptr) {
+      return Status::Invalid("Expression kernel did not produce values");
+    }
+    if (result.buffers[1] != values) {
+      const uint8_t* src = result.buffers[1]->data();
+      if (node.bit_width == 1) {
+        CopyBitmap(src, result.offset, length, values->mutable_data(), 0);
+      } else {
+        src += ValuesOffset(node.bit_width, result.offset);
+        std::memcpy(values->mutable_data(), src, ValuesSize(node.bit_width, length));
+      }
+    }
+    views_[index] = ArrayData::Make(type, length, {node_validity, values}, null_count);
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  const std::vector<Node>& nodes_;
+  const int64_t morsel_length_;
+  std::vector<std::shared_ptr<Buffer>> scratch_validity_;
+  std::vector<std::shared_ptr<Buffer>> scratch_values_;
+  // The current morsel of each node
+  std::vector<std::shared_ptr<ArrayData>> views_;
+};
+
+// A range of rows of one aligned piece of the inputs
+struct EvaluationTask {
+  size_t piece;
+  int64_t begin;
+  int64_t end;
+};
+
+}  // namespace
+
+Status EvaluateExpression(FunctionContext* ctx, const Expression& expression,
+                          const std::vector<Datum>& inputs, Datum* out,
+                          int64_t morsel_length) {
+  std::vector<Node> nodes;
+  std::unordered_map<const Expression*, int> indices;
+  Flatten(expression, &indices, &nodes);
+
+  if (inputs.empty()) {
+    return Status::Invalid("Expression evaluation needs at least one input");
+  }
+  bool all_arrays = true;
+  for (const auto& input : inputs) {
+    if (!input.is_arraylike()) {
+      return Status::Invalid("Expression inputs must be array-like");
+    }
+    if (DatumLength(input) != DatumLength(inputs[0])) {
+      return Status::Invalid("Expression inputs must have the same length");
+    }
+    all_arrays &= input.kind() == Datum::ARRAY;
+  }
+  bool thread_safe = true;
+  for (const Node& node : nodes) {
+    if (node.operands.empty()) {
+      const int index = node.expr->input_index();
+      if (index < 0 || index >= static_cast<int>(inputs.size())) {
+        return Status::Invalid("Expression input index ", index, " out of bounds");
+      }
+      if (!inputs[index].type()->Equals(*node.expr->type())) {
+        return Status::TypeError("Expression input ", index, " should have type ",
+                                 node.expr->type()->ToString(), ", got ",
+                                 inputs[index].type()->ToString());
+      }
+    } else if (node.expr->unary_kernel()) {
+      thread_safe &= node.expr->unary_kernel()->is_thread_safe();
+    } else {
+      thread_safe &= node.expr->binary_kernel()->is_thread_safe();
+    }
+  }
+
+  const Node& root = nodes.back();
+  if (root.operands.empty()) {
+    out->value = inputs[root.expr->input_index()].value;
+    return Status::OK();
+  }
+  const std::shared_ptr<DataType>& type = root.expr->type();
+  morsel_length = BitUtil::RoundUpToMultipleOf64(std::max<int64_t>(morsel_length, 1));
+
+  // Split the inputs into pieces aligned across all of them
+  std::vector<ArrayVector> groups;
+  for (const auto& input : inputs) {
+    if (input.kind() == Datum::ARRAY) {
+      groups.push_back({input.make_array()});
+    } else {
+      groups.push_back(input.chunked_array()->chunks());
+    }
+  }
+  std::vector<std::vector<std::shared_ptr<ArrayData>>> pieces;
+  if (DatumLength(inputs[0]) > 0) {
+    groups = internal::RechunkArraysConsistently(groups);
+    for (size_t i = 0; i < groups[0].size(); ++i) {
+      std::vector<std::shared_ptr<ArrayData>> piece;
+      for (const auto& group : groups) {
+        piece.push_back(group[i]->data());
+      }
+      pieces.push_back(std::move(piece));
+    }
+  }
+
+  // Allocate the results, and split them into tasks of whole morsels
+  std::vector<std::shared_ptr<Buffer>> validities(pieces.size());
+  std::vector<std::shared_ptr<Buffer>> values(pieces.size());
+  std::vector<EvaluationTask> tasks;
+  const bool use_threads = ctx->use_threads() && thread_safe;
+  const int64_t task_length =
+      use_threads ? std::max(morsel_length, detail::kMorselLength) : 0;
+  for (size_t i = 0; i < pieces.size(); ++i) {
+    const int64_t length = pieces[i][0]->length;
+    RETURN_NOT_OK(ctx->Allocate(BitUtil::BytesForBits(length), &validities[i]));
+    RETURN_NOT_OK(ctx->Allocate(ValuesSize(root.bit_width, length), &values[i]));
+    if (task_length == 0) {
+      tasks.push_back({i, 0, length});
+      continue;
+    }
+    for (int64_t begin = 0; begin < length; begin += task_length) {
+      tasks.push_back({i, begin, std::min(begin + task_length, length)});
+    }
+  }
+
+  std::vector<int64_t> null_counts(pieces.size(), 0);
+  if (use_threads && tasks.size() > 1) {
+    std::vector<int64_t> task_null_counts(tasks.size(), 0);
+    RETURN_NOT_OK(
+        internal::ParallelFor(static_cast<int>(tasks.size()), [&](int i) -> Status {
+          // Kernels may report errors through the context, which is not
+          // thread-safe, so each task gets its own
+          FunctionContext task_ctx(ctx->memory_pool());
+          MorselEvaluator evaluator(&task_ctx, nodes, morsel_length);
+          RETURN_NOT_OK(evaluator.Init());
+          const EvaluationTask& task = tasks[i];
+          return evaluator.Evaluate(pieces[task.piece], task.begin, task.end,
+                                    validities[task.piece], values[task.piece],
+                                    &task_null_counts[i]);
+        }));
+    for (size_t i = 0; i < tasks.size(); ++i) {
+      null_counts[tasks[i].piece] += task_null_counts[i];
+    }
+  } else {
+    MorselEvaluator evaluator(ctx, nodes, morsel_length);
+    RETURN_NOT_OK(evaluator.Init());
+    for (const EvaluationTask& task : tasks) {
+      RETURN_NOT_OK(evaluator.Evaluate(pieces[task.piece], task.begin, task.end,
+                                       validities[task.piece], values[task.piece],
+                                       &null_counts[task.piece]));
+    }
+  }
+
+  ArrayVector results;
+  for (size_t i = 0; i < pieces.size(); ++i) {
+    const int64_t length = pieces[i][0]->length;
+    std::shared_ptr<Buffer> validity = null_counts[i] > 0 ? validities[i] : nullptr;
+    results.push_back(MakeArray(
+        ArrayData::Make(type, length, {validity, values[i]}, null_counts[i])));
+  }
+  if (all_arrays) {
+    if (results.empty()) {
+      std::shared_ptr<Buffer> empty_values;
+      RETURN_NOT_OK(ctx->Allocate(0, &empty_values));
+      results.push_back(MakeArray(ArrayData::Make(type, 0, {nullptr, empty_values}, 0)));
+    }
+    *out = results[0];
+  } else {
+    *out = std::make_shared<ChunkedArray>(results, type);
+  }
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,149 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_EXPRESSION_H
+#define ARROW_COMPUTE_EXPRESSION_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct CastOptions;
+struct Datum;
+class FunctionContext;
+class UnaryKernel;
+class BinaryKernel;
+
+/// \brief A tree of element-wise kernels, evaluated together
+///
+/// Instead of materializing the full result of each kernel in turn, an
+/// expression is evaluated one morsel of rows at a time: every kernel runs
+/// over the morsel before the next morsel is started.  Intermediate results
+/// are written into morsel-sized scratch buffers that are reused, so they
+/// stay in cache; only the final result is allocated at full length.
+///
+/// Each kernel is expected to write its values into the preallocated values
+/// buffer of its output, as the kernels returned by GetCastFunction and
+/// GetInvertKernel do; the values of kernels which allocate their own are
+/// copied.  The validity of each result is the intersection of the validity
+/// of its operands, and is computed by the expression.  All results must
+/// have a fixed-width type.
+class ARROW_EXPORT Expression {
+ public:
+  /// \brief Reference the input at `index` of EvaluateExpression
+  static std::shared_ptr<Expression> Input(int index,
+                                           const std::shared_ptr<DataType>& type);
+
+  /// \brief Apply a unary kernel, whose out_type() is the result type
+  static Status MakeUnary(const std::shared_ptr<UnaryKernel>& kernel,
+                          const std::shared_ptr<Expression>& operand,
+                          std::shared_ptr<Expression>* out);
+
+  /// \brief Apply a binary kernel producing values of `type`
+  static Status MakeBinary(const std::shared_ptr<BinaryKernel>& kernel,
+                           const std::shared_ptr<DataType>& type,
+                           const std::shared_ptr<Expression>& left,
+                           const std::shared_ptr<Expression>& right,
+                           std::shared_ptr<Expression>* out);
+
+  /// \brief The type of the result
+  const std::shared_ptr<DataType>& type() const { return type_; }
+
+  /// \brief The index of the input, for an input expression, or -1
+  int input_index() const { return input_index_; }
+
+  /// \brief The operands of a kernel expression
+  const std::vector<std::shared_ptr<Expression>>& operands() const { return operands_; }
+
+  const std::shared_ptr<UnaryKernel>& unary_kernel() const { return unary_kernel_; }
+  const std::shared_ptr<BinaryKernel>& binary_kernel() const { return binary_kernel_; }
+
+ private:
+  explicit Expression(const std::shared_ptr<DataType>& type);
+
+  std::shared_ptr<DataType> type_;
+  int input_index_ = -1;
+  std::shared_ptr<UnaryKernel> unary_kernel_;
+  std::shared_ptr<BinaryKernel> binary_kernel_;
+  std::vector<std::shared_ptr<Expression>> operands_;
+};
+
+/// \brief Cast the result of an expression, see Cast
+ARROW_EXPORT
+Status MakeCastExpression(const std::shared_ptr<Expression>& operand,
+                          const std::shared_ptr<DataType>& to_type,
+                          const CastOptions& options, std::shared_ptr<Expression>* out);
+
+/// \brief Invert a boolean expression, see Invert
+ARROW_EXPORT
+Status MakeInvertExpression(const std::shared_ptr<Expression>& operand,
+                            std::shared_ptr<Expression>* out);
+
+/// \brief AND two boolean expressions, see And
+ARROW_EXPORT
+Status MakeAndExpression(const std::shared_ptr<Expression>& left,
+                         const std::shared_ptr<Expression>& right,
+                         std::shared_ptr<Expression>* out);
+
+/// \brief OR two boolean expressions, see Or
+ARROW_EXPORT
+Status MakeOrExpression(const std::shared_ptr<Expression>& left,
+                        const std::shared_ptr<Expression>& right,
+                        std::shared_ptr<Expression>* out);
+
+/// \brief XOR two boolean expressions, see Xor
+ARROW_EXPORT
+Status MakeXorExpression(const std::shared_ptr<Expression>& left,
+                         const std::shared_ptr<Expression>& right,
+                         std::shared_ptr<Expression>* out);
+
+/// \brief The default number of rows evaluated at a time by EvaluateExpression
+static constexpr int64_t kDefaultExpressionMorselLength = 4096;
+
+/// \brief Evaluate an expression over array-like inputs
+///
+/// The inputs must all have the same length and the types of the input
+/// expressions referencing them.  Chunked inputs are evaluated over
+/// consistently rechunked pieces, and the result is chunked like them.
+/// If the context enables threads and all kernels are thread-safe, ranges
+/// of rows are evaluated in parallel.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] expression the expression to evaluate
+/// \param[in] inputs array-like values referenced by input expressions
+/// \param[out] out resulting datum
+/// \param[in] morsel_length the number of rows evaluated at a time, rounded
+/// up to a multiple of 64
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status EvaluateExpression(FunctionContext* context, const Expression& expression,
+                          const std::vector<Datum>& inputs, Datum* out,
+                          int64_t morsel_length = kDefaultExpressionMorselLength);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_EXPRESSION_H
@@ -54,6 +54,13 @@ class FunctionContext;
 class ARROW_EXPORT OpKernel {
  public:
   virtual ~OpKernel() = default;
+
+  /// \brief Whether Call() may run concurrently on different inputs
+  ///
+  /// Thread-safe kernels must not modify their own state when called.  Each
+  /// concurrent call gets its own FunctionContext sharing the memory pool of
+  /// the caller's context.
+  virtual bool is_thread_safe() const { return false; }
 };
 
 /// \class Datum
@@ -200,6 +207,12 @@ class ARROW_EXPORT BinaryKernel : public OpKernel {
  public:
   virtual Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
                       Datum* out) = 0;
+
+  /// \brief Whether Call() accepts a scalar on either side
+  ///
+  /// The scalar then applies to every value of the array on the other side,
+  /// without being materialized as an array.
+  virtual bool accepts_scalars() const { return false; }
 };
 
 }  // namespace compute
@@ -33,6 +33,8 @@
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/mean.h"
+#include "arrow/compute/kernels/minmax.h"
 #include "arrow/compute/kernels/sum.h"
 
 namespace arrow {
@@ -324,7 +326,10 @@ BENCHMARK_TEMPLATE(BenchSum, SumBitmapNaive<int64_t>)->Apply(SetArgs);
 BENCHMARK_TEMPLATE(BenchSum, SumBitmapReader<int64_t>)->Apply(SetArgs);
 BENCHMARK_TEMPLATE(BenchSum, SumBitmapVectorizeUnroll<int64_t>)->Apply(SetArgs);
 
-static void BenchSumKernel(benchmark::State& state) {
+using AggregateFunc = Status (*)(FunctionContext*, const Datum&, Datum*);
+
+template <AggregateFunc Func>
+static void BenchAggregateKernel(benchmark::State& state) {
   const int64_t array_size = state.range(0) / sizeof(int64_t);
   const double null_percent = static_cast<double>(state.range(1)) / 100.0;
   auto rand = random::RandomArrayGenerator(1923);
@@ -334,7 +339,7 @@ static void BenchSumKernel(benchmark::State& state) {
   FunctionContext ctx;
   for (auto _ : state) {
     Datum out;
-    ABORT_NOT_OK(Sum(&ctx, Datum(array), &out));
+    ABORT_NOT_OK(Func(&ctx, Datum(array), &out));
     benchmark::DoNotOptimize(out);
   }
 
@@ -343,7 +348,21 @@ static void BenchSumKernel(benchmark::State& state) {
   state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
 }
 
+static void BenchSumKernel(benchmark::State& state) {
+  BenchAggregateKernel<Sum>(state);
+}
+
+static void BenchMeanKernel(benchmark::State& state) {
+  BenchAggregateKernel<Mean>(state);
+}
+
+static void BenchMinMaxKernel(benchmark::State& state) {
+  BenchAggregateKernel<MinMax>(state);
+}
+
 BENCHMARK(BenchSumKernel)->Apply(SetArgs);
+BENCHMARK(BenchMeanKernel)->Apply(SetArgs);
+BENCHMARK(BenchMinMaxKernel)->Apply(SetArgs);
 
 }  // namespace compute
 }  // namespace arrow
@@ -15,18 +15,29 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <string>
+#include <unordered_set>
 #include <type_traits>
 
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/approximate.h"
+#include "arrow/compute/kernels/mean.h"
+#include "arrow/compute/kernels/minmax.h"
 #include "arrow/compute/kernels/sum.h"
+#include "arrow/compute/kernels/util-internal.h"
 #include "arrow/compute/test-util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/thread-pool.h"
 
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
@@ -35,6 +46,8 @@
 using std::shared_ptr;
 using std::vector;
 
+using arrow::internal::checked_cast;
+
 namespace arrow {
 namespace compute {
 
@@ -182,5 +195,373 @@ TYPED_TEST(TestRandomSumKernelNumeric, RandomSliceArraySum) {
   }
 }
 
+TYPED_TEST(TestRandomSumKernelNumeric, RandomSliceLongArraySum) {
+  // Exercise validity words at all bit offsets, with all-valid, all-null
+  // and mixed words
+  auto rand = random::RandomArrayGenerator(0x94378165);
+  const int64_t length = 1000;
+  for (auto null_probability : {0.0, 0.001, 0.1, 0.5, 0.999}) {
+    auto array = rand.Numeric<TypeParam>(length, 0, 100, null_probability);
+    for (int64_t offset = 0; offset < 17; ++offset) {
+      for (int64_t trim : {0, 1, 7, 63, 64, 65}) {
+        auto slice = array->Slice(offset, length - offset - trim);
+        ValidateSum<TypeParam>(&this->ctx_, *slice);
+      }
+    }
+  }
+}
+
+//
+// Mean
+//
+
+template <typename ArrowType>
+static Datum NaiveMean(const Array& array) {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  const auto& array_numeric = checked_cast<const ArrayType&>(array);
+
+  double sum = 0;
+  int64_t count = 0;
+  for (int64_t i = 0; i < array.length(); i++) {
+    if (array.IsValid(i)) {
+      sum += static_cast<double>(array_numeric.Value(i));
+      count++;
+    }
+  }
+  if (count == 0) {
+    return Datum(std::make_shared<DoubleScalar>(0, false));
+  }
+  return Datum(std::make_shared<DoubleScalar>(sum / count));
+}
+
+static void AssertMeanEqual(const Datum& expected, const Datum& actual) {
+  ASSERT_EQ(actual.kind(), Datum::SCALAR);
+  const auto& left = checked_cast<const DoubleScalar&>(*expected.scalar());
+  const auto& right = checked_cast<const DoubleScalar&>(*actual.scalar());
+  ASSERT_EQ(left.is_valid, right.is_valid);
+  if (left.is_valid) {
+    ASSERT_NEAR(left.value, right.value, 1e-6 * std::abs(left.value) + 1e-9);
+  }
+}
+
+template <typename ArrowType>
+void ValidateMean(FunctionContext* ctx, const Array& input, const Datum& expected) {
+  Datum result;
+  ASSERT_OK(Mean(ctx, input, &result));
+  AssertMeanEqual(expected, result);
+}
+
+template <typename ArrowType>
+void ValidateMean(FunctionContext* ctx, const char* json, const Datum& expected) {
+  auto array = ArrayFromJSON(TypeTraits<ArrowType>::type_singleton(), json);
+  ValidateMean<ArrowType>(ctx, *array, expected);
+}
+
+template <typename ArrowType>
+class TestMeanKernelNumeric : public ComputeFixture, public TestBase {};
+
+TYPED_TEST_CASE(TestMeanKernelNumeric, NumericArrowTypes);
+TYPED_TEST(TestMeanKernelNumeric, SimpleMean) {
+  ValidateMean<TypeParam>(&this->ctx_, "[]",
+                          Datum(std::make_shared<DoubleScalar>(0, false)));
+  ValidateMean<TypeParam>(&this->ctx_, "[null]",
+                          Datum(std::make_shared<DoubleScalar>(0, false)));
+  ValidateMean<TypeParam>(&this->ctx_, "[1, 2, 3, 4, 5, 6, 7, 8]",
+                          Datum(std::make_shared<DoubleScalar>(4.5)));
+  ValidateMean<TypeParam>(&this->ctx_, "[1, null, 3, null, 3, null, 7]",
+                          Datum(std::make_shared<DoubleScalar>(3.5)));
+}
+
+TYPED_TEST(TestMeanKernelNumeric, RandomArrayMean) {
+  auto rand = random::RandomArrayGenerator(0x8afc055);
+  for (auto null_probability : {0.0, 0.01, 0.1, 0.5, 1.0}) {
+    for (int64_t length : {5, 63, 64, 65, 1000, 4096 + 3}) {
+      auto array = rand.Numeric<TypeParam>(length, 0, 100, null_probability);
+      ValidateMean<TypeParam>(&this->ctx_, *array, NaiveMean<TypeParam>(*array));
+      auto slice = array->Slice(3, length - 5);
+      ValidateMean<TypeParam>(&this->ctx_, *slice, NaiveMean<TypeParam>(*slice));
+    }
+  }
+}
+
+//
+// MinMax
+//
+
+template <typename ArrowType>
+class TestMinMaxKernelNumeric : public ComputeFixture, public TestBase {
+ public:
+  using CType = typename ArrowType::c_type;
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  void AssertMinMaxIs(const Array& array, bool is_valid, CType expected_min = 0,
+                      CType expected_max = 0) {
+    Datum out;
+    ASSERT_OK(MinMax(&this->ctx_, array, &out));
+    ASSERT_EQ(out.kind(), Datum::COLLECTION);
+    const auto& collection = out.collection();
+    ASSERT_EQ(collection.size(), 2);
+    const auto& min = checked_cast<const ScalarType&>(*collection[0].scalar());
+    const auto& max = checked_cast<const ScalarType&>(*collection[1].scalar());
+    ASSERT_EQ(min.is_valid, is_valid);
+    ASSERT_EQ(max.is_valid, is_valid);
+    if (is_valid) {
+      ASSERT_EQ(min.value, expected_min);
+      ASSERT_EQ(max.value, expected_max);
+    }
+  }
+
+  void AssertMinMaxIs(const std::string& json, bool is_valid, CType expected_min = 0,
+                      CType expected_max = 0) {
+    auto array = ArrayFromJSON(TypeTraits<ArrowType>::type_singleton(), json);
+    AssertMinMaxIs(*array, is_valid, expected_min, expected_max);
+  }
+
+  void AssertNaiveMinMax(const Array& array) {
+    const auto& array_numeric = checked_cast<const ArrayType&>(array);
+    bool is_valid = false;
+    CType min = 0, max = 0;
+    for (int64_t i = 0; i < array.length(); i++) {
+      if (array.IsValid(i)) {
+        const CType value = array_numeric.Value(i);
+        min = is_valid ? std::min(min, value) : value;
+        max = is_valid ? std::max(max, value) : value;
+        is_valid = true;
+      }
+    }
+    AssertMinMaxIs(array, is_valid, min, max);
+  }
+};
+
+TYPED_TEST_CASE(TestMinMaxKernelNumeric, NumericArrowTypes);
+TYPED_TEST(TestMinMaxKernelNumeric, SimpleMinMax) {
+  this->AssertMinMaxIs("[]", false);
+  this->AssertMinMaxIs("[null, null]", false);
+  this->AssertMinMaxIs("[5, 1, 2, 3, 4]", true, 1, 5);
+  this->AssertMinMaxIs("[5, null, 2, 3, 4]", true, 2, 5);
+  this->AssertMinMaxIs("[null, 7, null, 3, null]", true, 3, 7);
+}
+
+TYPED_TEST(TestMinMaxKernelNumeric, RandomArrayMinMax) {
+  auto rand = random::RandomArrayGenerator(0x1e63b0f);
+  for (auto null_probability : {0.0, 0.01, 0.1, 0.5, 0.99, 1.0}) {
+    for (int64_t length : {5, 63, 64, 65, 1000, 4096 + 3}) {
+      auto array = rand.Numeric<TypeParam>(length, 0, 100, null_probability);
+      this->AssertNaiveMinMax(*array);
+      for (int64_t offset : {1, 7, 9}) {
+        if (offset + 2 < length) {
+          this->AssertNaiveMinMax(*array->Slice(offset, length - offset - 2));
+        }
+      }
+    }
+  }
+}
+
+typedef ::testing::Types<FloatType, DoubleType> RealArrowTypes;
+
+template <typename ArrowType>
+class TestMinMaxKernelFloating : public TestMinMaxKernelNumeric<ArrowType> {};
+
+TYPED_TEST_CASE(TestMinMaxKernelFloating, RealArrowTypes);
+TYPED_TEST(TestMinMaxKernelFloating, NaNsAreIgnored) {
+  using CType = typename TypeParam::c_type;
+  const CType nan = std::numeric_limits<CType>::quiet_NaN();
+  std::shared_ptr<Array> array;
+  ArrayFromVector<TypeParam, CType>({true, true, true, false}, {nan, 2.5, -1.5, 99},
+                                    &array);
+  this->AssertMinMaxIs(*array, true, -1.5, 2.5);
+}
+
+//
+// Chunked and parallel aggregation
+//
+
+TEST(TestAggregateKernels, ChunkedInput) {
+  FunctionContext ctx;
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int32(), "[5, null, 1]"), ArrayFromJSON(int32(), "[]"),
+                  ArrayFromJSON(int32(), "[7, -2]")});
+  Datum out;
+  ASSERT_OK(Sum(&ctx, chunked, &out));
+  ASSERT_EQ(checked_cast<const Int64Scalar&>(*out.scalar()).value, 11);
+  ASSERT_OK(MinMax(&ctx, chunked, &out));
+  ASSERT_EQ(checked_cast<const Int32Scalar&>(*out.collection()[0].scalar()).value, -2);
+  ASSERT_EQ(checked_cast<const Int32Scalar&>(*out.collection()[1].scalar()).value, 7);
+}
+
+TEST(TestAggregateKernels, UseThreads) {
+  const int old_capacity = internal::GetCpuThreadPool()->GetCapacity();
+  ASSERT_OK(internal::GetCpuThreadPool()->SetCapacity(4));
+  auto rand = random::RandomArrayGenerator(0x7a1);
+  auto array = rand.Int64(5 * detail::kMorselLength + 17, -1000, 1000, 0.1);
+
+  FunctionContext ctx;
+  Datum serial, parallel;
+  ASSERT_OK(Sum(&ctx, array, &serial));
+  ctx.set_use_threads(true);
+  ASSERT_OK(Sum(&ctx, array, &parallel));
+  ASSERT_EQ(checked_cast<const Int64Scalar&>(*serial.scalar()).value,
+            checked_cast<const Int64Scalar&>(*parallel.scalar()).value);
+  ASSERT_OK(internal::GetCpuThreadPool()->SetCapacity(old_capacity));
+}
+
+TEST(TestAggregateKernels, DictionaryInput) {
+  FunctionContext ctx;
+  // The dictionary holds a null, and an unused entry
+  auto dict_type = dictionary(int8(), ArrayFromJSON(int32(), "[10, null, -4, 100, 7]"));
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{
+      std::make_shared<DictionaryArray>(dict_type, ArrayFromJSON(int8(), "[0, 2, null]")),
+      std::make_shared<DictionaryArray>(dict_type, ArrayFromJSON(int8(), "[1, 4, 0]"))});
+  Datum out;
+  ASSERT_OK(Sum(&ctx, chunked, &out));
+  ASSERT_EQ(checked_cast<const Int64Scalar&>(*out.scalar()).value, 23);
+  ASSERT_OK(Mean(&ctx, chunked, &out));
+  ASSERT_DOUBLE_EQ(checked_cast<const DoubleScalar&>(*out.scalar()).value, 23.0 / 4);
+  ASSERT_OK(MinMax(&ctx, chunked, &out));
+  ASSERT_EQ(checked_cast<const Int32Scalar&>(*out.collection()[0].scalar()).value, -4);
+  ASSERT_EQ(checked_cast<const Int32Scalar&>(*out.collection()[1].scalar()).value, 10);
+  ASSERT_OK(ApproxCountDistinct(&ctx, chunked, &out));
+  ASSERT_EQ(checked_cast<const Int64Scalar&>(*out.scalar()).value, 3);
+
+  auto strings = std::make_shared<DictionaryArray>(
+      dictionary(int8(), ArrayFromJSON(utf8(), R"(["x", "y", "z"])")),
+      ArrayFromJSON(int8(), "[2, 2, 0, null]"));
+  ASSERT_OK(ApproxCountDistinct(&ctx, strings, &out));
+  ASSERT_EQ(checked_cast<const Int64Scalar&>(*out.scalar()).value, 2);
+  ASSERT_RAISES(Invalid, Sum(&ctx, strings, &out));
+}
+
+//
+// ApproxCountDistinct
+//
+
+static int64_t ApproxCountDistinctOf(FunctionContext* ctx, const Datum& value) {
+  Datum out;
+  EXPECT_OK(ApproxCountDistinct(ctx, value, &out));
+  return checked_cast<const Int64Scalar&>(*out.scalar()).value;
+}
+
+TEST(TestApproxCountDistinct, Basics) {
+  FunctionContext ctx;
+  // Small cardinalities are practically exact
+  ASSERT_EQ(ApproxCountDistinctOf(&ctx, ArrayFromJSON(int32(), "[]")), 0);
+  ASSERT_EQ(ApproxCountDistinctOf(&ctx, ArrayFromJSON(int32(), "[null, null]")), 0);
+  ASSERT_EQ(ApproxCountDistinctOf(&ctx, ArrayFromJSON(int32(), "[1, 2, 1, null, 3]")),
+            3);
+  ASSERT_EQ(ApproxCountDistinctOf(&ctx, ArrayFromJSON(boolean(), "[true, true]")), 1);
+  ASSERT_EQ(ApproxCountDistinctOf(
+                &ctx, ArrayFromJSON(utf8(), R"(["a", "bb", "", "a", null, "ccc"])")),
+            4);
+  ASSERT_EQ(ApproxCountDistinctOf(&ctx, ArrayFromJSON(float64(), "[0.5, 1.5, 0.5]")),
+            2);
+
+  Datum out;
+  ASSERT_RAISES(NotImplemented,
+                ApproxCountDistinct(&ctx, ArrayFromJSON(list(int32()), "[]"), &out));
+}
+
+TEST(TestApproxCountDistinct, LargeCardinality) {
+  FunctionContext ctx;
+  auto rand = random::RandomArrayGenerator(0x4c1);
+  // About 126000 distinct values out of 200000
+  auto array = rand.Int64(200000, 0, 200000, 0.05);
+  const auto& values = checked_cast<const Int64Array&>(*array);
+  std::unordered_set<int64_t> distinct;
+  for (int64_t i = 0; i < values.length(); ++i) {
+    if (values.IsValid(i)) distinct.insert(values.Value(i));
+  }
+  const double expected = static_cast<double>(distinct.size());
+  const int64_t estimate = ApproxCountDistinctOf(&ctx, array);
+  ASSERT_NEAR(estimate, expected, 0.03 * expected);
+
+  // Estimates merged from chunks or threads are identical
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, 70000), array->Slice(70000)});
+  ASSERT_EQ(ApproxCountDistinctOf(&ctx, chunked), estimate);
+  const int old_capacity = internal::GetCpuThreadPool()->GetCapacity();
+  ASSERT_OK(internal::GetCpuThreadPool()->SetCapacity(4));
+  ctx.set_use_threads(true);
+  ASSERT_EQ(ApproxCountDistinctOf(&ctx, array), estimate);
+  ASSERT_OK(internal::GetCpuThreadPool()->SetCapacity(old_capacity));
+}
+
+//
+// ApproxQuantile
+//
+
+static std::vector<Datum> ApproxQuantilesOf(FunctionContext* ctx, const Datum& value,
+                                            const std::vector<double>& quantiles) {
+  auto options = ApproxQuantileOptions::Defaults();
+  options.quantiles = quantiles;
+  Datum out;
+  EXPECT_OK(ApproxQuantile(ctx, value, options, &out));
+  return out.collection();
+}
+
+static double QuantileValue(const Datum& datum) {
+  return checked_cast<const DoubleScalar&>(*datum.scalar()).value;
+}
+
+TEST(TestApproxQuantile, Basics) {
+  FunctionContext ctx;
+  auto result = ApproxQuantilesOf(&ctx, ArrayFromJSON(int32(), "[4, null, 0, 2, 1, 3]"),
+                                  {0, 0.5, 1});
+  ASSERT_EQ(result.size(), 3);
+  ASSERT_EQ(QuantileValue(result[0]), 0);
+  ASSERT_EQ(QuantileValue(result[1]), 2);
+  ASSERT_EQ(QuantileValue(result[2]), 4);
+
+  result = ApproxQuantilesOf(&ctx, ArrayFromJSON(float64(), "[]"), {0.5});
+  ASSERT_FALSE(result[0].scalar()->is_valid);
+
+  Datum out;
+  auto options = ApproxQuantileOptions::Defaults();
+  options.quantiles = {1.5};
+  ASSERT_RAISES(Invalid,
+                ApproxQuantile(&ctx, ArrayFromJSON(int32(), "[1]"), options, &out));
+  ASSERT_RAISES(Invalid, ApproxQuantile(&ctx, ArrayFromJSON(utf8(), R"(["a"])"),
+                                        ApproxQuantileOptions::Defaults(), &out));
+}
+
+TEST(TestApproxQuantile, Random) {
+  FunctionContext ctx;
+  auto rand = random::RandomArrayGenerator(0x9e1);
+  const int64_t length = 100000;
+  auto array = rand.Float64(length, 0, 1000, 0.1);
+  const auto& values = checked_cast<const DoubleArray&>(*array);
+  std::vector<double> sorted;
+  for (int64_t i = 0; i < length; ++i) {
+    if (values.IsValid(i)) sorted.push_back(values.Value(i));
+  }
+  std::sort(sorted.begin(), sorted.end());
+
+  const std::vector<double> quantiles = {0, 0.001, 0.1, 0.5, 0.9, 0.999, 1};
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{array->Slice(0, 30000), array->Slice(30000)});
+  for (const Datum& value : {Datum(array), Datum(chunked)}) {
+    auto result = ApproxQuantilesOf(&ctx, value, quantiles);
+    for (size_t i = 0; i < quantiles.size(); ++i) {
+      // Compare ranks rather than values
+      const double estimate = QuantileValue(result[i]);
+      const double rank =
+          static_cast<double>(std::lower_bound(sorted.begin(), sorted.end(), estimate) -
+                              sorted.begin()) /
+          static_cast<double>(sorted.size());
+      ASSERT_NEAR(rank, quantiles[i], 0.005) << quantiles[i];
+    }
+    ASSERT_EQ(QuantileValue(result.front()), sorted.front());
+    ASSERT_EQ(QuantileValue(result.back()), sorted.back());
+  }
+}
+
+TEST(TestAggregateKernels, NonNumeric) {
+  FunctionContext ctx;
+  auto array = ArrayFromJSON(utf8(), R"(["a", "b"])");
+  Datum out;
+  ASSERT_RAISES(Invalid, Mean(&ctx, *array, &out));
+  ASSERT_RAISES(Invalid, MinMax(&ctx, *array, &out));
+}
+
 }  // namespace compute
 }  // namespace arrow
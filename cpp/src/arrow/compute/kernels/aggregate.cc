@@ -15,10 +15,17 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
+#include "arrow/array.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/table.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 namespace compute {
@@ -50,16 +57,50 @@ class ManagedAggregateState {
 };
 
 Status AggregateUnaryKernel::Call(FunctionContext* ctx, const Datum& input, Datum* out) {
-  if (!input.is_array()) return Status::Invalid("AggregateKernel expects Array datum");
+  if (!input.is_arraylike()) {
+    return Status::Invalid("AggregateKernel expects Array or ChunkedArray datum");
+  }
 
   auto state = ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
   if (!state) return Status::OutOfMemory("AggregateState allocation failed");
 
-  auto array = input.make_array();
-  RETURN_NOT_OK(aggregate_function_->Consume(*array, state->mutable_data()));
-  RETURN_NOT_OK(aggregate_function_->Finalize(state->mutable_data(), out));
+  const auto morsels = detail::SplitIntoMorsels(input, detail::kMorselLength);
+  const int num_tasks =
+      ctx->use_threads()
+          ? static_cast<int>(std::min<size_t>(
+                internal::GetCpuThreadPool()->GetCapacity(), morsels.size()))
+          : 1;
+  if (num_tasks < 2) {
+    if (input.is_array()) {
+      RETURN_NOT_OK(aggregate_function_->Consume(*input.make_array(),
+                                                 state->mutable_data()));
+    } else {
+      for (const auto& chunk : input.chunked_array()->chunks()) {
+        RETURN_NOT_OK(aggregate_function_->Consume(*chunk, state->mutable_data()));
+      }
+    }
+    return aggregate_function_->Finalize(state->mutable_data(), out);
+  }
 
-  return Status::OK();
+  // Each task consumes a contiguous range of morsels into a partial state,
+  // and the partial states are merged in task order
+  std::vector<std::shared_ptr<ManagedAggregateState>> partials(num_tasks);
+  RETURN_NOT_OK(internal::ParallelFor(num_tasks, [&](int task) -> Status {
+    partials[task] = ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
+    if (!partials[task]) return Status::OutOfMemory("AggregateState allocation failed");
+    const size_t begin = morsels.size() * task / num_tasks;
+    const size_t end = morsels.size() * (task + 1) / num_tasks;
+    for (size_t i = begin; i < end; ++i) {
+      RETURN_NOT_OK(
+          aggregate_function_->Consume(*morsels[i], partials[task]->mutable_data()));
+    }
+    return Status::OK();
+  }));
+  for (const auto& partial : partials) {
+    RETURN_NOT_OK(aggregate_function_->Merge(partial->mutable_data(),
+                                             state->mutable_data()));
+  }
+  return aggregate_function_->Finalize(state->mutable_data(), out);
 }
 
 std::shared_ptr<DataType> AggregateUnaryKernel::out_type() const {
@@ -98,6 +98,10 @@ class AggregateFunctionStaticState : public AggregateFunction {
 };
 
 /// \brief UnaryKernel implemented by an AggregateState
+///
+/// Chunked inputs are consumed chunk by chunk into a single state.  When the
+/// context enables threads, the input is split into morsels which are
+/// consumed into partial states in parallel and then merged.
 class ARROW_EXPORT AggregateUnaryKernel : public UnaryKernel {
  public:
   explicit AggregateUnaryKernel(std::shared_ptr<AggregateFunction>& aggregate)
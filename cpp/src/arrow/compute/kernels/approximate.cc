@@ -0,0 +1,489 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/approximate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+namespace compute {
+
+// ----------------------------------------------------------------------
+// ApproxCountDistinct
+
+namespace {
+
+// The MurmurHash3 finalizer.  HyperLogLog needs every bit of the hash to be
+// well mixed, which the hash table oriented hashes do not guarantee.
+inline uint64_t MixHash(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ULL;
+  h ^= h >> 33;
+  return h;
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value, uint64_t>::type HashValue(
+    T value) {
+  return MixHash(static_cast<uint64_t>(value));
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value, uint64_t>::type
+HashValue(T value) {
+  using UInt = typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type;
+  UInt bits;
+  std::memcpy(&bits, &value, sizeof(T));
+  return MixHash(bits);
+}
+
+inline uint64_t HashValue(util::string_view value) {
+  return MixHash(internal::ComputeStringHash<0>(value.data(),
+                                                static_cast<int64_t>(value.size())));
+}
+
+}  // namespace
+
+struct HyperLogLogState {
+  static constexpr int kPrecision = 14;
+  static constexpr int kNumRegisters = 1 << kPrecision;
+  // The number of hash bits left after selecting the register
+  static constexpr int kRankBits = 64 - kPrecision;
+
+  void Update(uint64_t hash) {
+    const uint64_t index = hash >> kRankBits;
+    const uint64_t rest = hash << kPrecision;
+    const uint8_t rank = static_cast<uint8_t>(
+        rest == 0 ? kRankBits + 1 : BitUtil::CountLeadingZeros(rest) + 1);
+    registers[index] = std::max(registers[index], rank);
+  }
+
+  uint8_t registers[kNumRegisters] = {};
+};
+
+struct HyperLogLogVisitor {
+  Status VisitNull() { return Status::OK(); }
+
+  template <typename Value>
+  Status VisitValue(Value value) {
+    state->Update(HashValue(value));
+    return Status::OK();
+  }
+
+  HyperLogLogState* state;
+};
+
+// Hash the dictionary entries used by a batch once each
+struct DictionaryHyperLogLogVisitor {
+  Status VisitNull() {
+    ++position;
+    return Status::OK();
+  }
+
+  template <typename Value>
+  Status VisitValue(Value value) {
+    if (used[position++]) {
+      state->Update(HashValue(value));
+    }
+    return Status::OK();
+  }
+
+  HyperLogLogState* state;
+  const std::vector<bool>& used;
+  int64_t position;
+};
+
+// The improved raw estimator from Ertl, "New cardinality estimation algorithms
+// for HyperLogLog sketches" (2017), which is unbiased over the whole range of
+// cardinalities without empirical bias correction tables.
+static double EstimateCardinality(const HyperLogLogState& state) {
+  constexpr int kNumRegisters = HyperLogLogState::kNumRegisters;
+  constexpr int kRankBits = HyperLogLogState::kRankBits;
+  int64_t histogram[kRankBits + 2] = {};
+  for (int i = 0; i < kNumRegisters; ++i) {
+    ++histogram[state.registers[i]];
+  }
+  const double m = kNumRegisters;
+  if (histogram[0] == kNumRegisters) {
+    return 0;
+  }
+
+  auto sigma = [](double x) {
+    double y = 1, z = x, previous;
+    do {
+      x *= x;
+      previous = z;
+      z += x * y;
+      y += y;
+    } while (z != previous);
+    return z;
+  };
+  auto tau = [](double x) {
+    if (x == 0 || x == 1) return 0.0;
+    double y = 1, z = 1 - x, previous;
+    do {
+      x = std::sqrt(x);
+      previous = z;
+      y *= 0.5;
+      z -= (1 - x) * (1 - x) * y;
+    } while (z != previous);
+    return z / 3;
+  };
+
+  double z = m * tau(1 - static_cast<double>(histogram[kRankBits + 1]) / m);
+  for (int k = kRankBits; k >= 1; --k) {
+    z = 0.5 * (z + static_cast<double>(histogram[k]));
+  }
+  z += m * sigma(static_cast<double>(histogram[0]) / m);
+  return 0.5 / std::log(2.0) * m * m / z;
+}
+
+template <typename ArrowType>
+class ApproxCountDistinctAggregateFunction final
+    : public AggregateFunctionStaticState<HyperLogLogState> {
+ public:
+  Status Consume(const Array& input, HyperLogLogState* state) const override {
+    if (input.type_id() == Type::DICTIONARY) {
+      const auto dictionary = static_cast<const DictionaryArray&>(input).dictionary();
+      std::vector<bool> used(dictionary->length());
+      detail::VisitDictionaryIndices(*input.data(),
+                                     [&](int64_t index) { used[index] = true; });
+      DictionaryHyperLogLogVisitor visitor{state, used, 0};
+      return ArrayDataVisitor<ArrowType>::Visit(*dictionary->data(), &visitor);
+    }
+    HyperLogLogVisitor visitor{state};
+    return ArrayDataVisitor<ArrowType>::Visit(*input.data(), &visitor);
+  }
+
+  Status Merge(const HyperLogLogState& src, HyperLogLogState* dst) const override {
+    for (int i = 0; i < HyperLogLogState::kNumRegisters; ++i) {
+      dst->registers[i] = std::max(dst->registers[i], src.registers[i]);
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(const HyperLogLogState& src, Datum* output) const override {
+    const auto estimate = static_cast<int64_t>(std::llround(EstimateCardinality(src)));
+    *output = Datum(std::make_shared<Int64Scalar>(estimate));
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+};
+
+#define APPROX_DISTINCT_AGG_FN_CASE(T)                  \
+  case T::type_id:                                      \
+    return std::static_pointer_cast<AggregateFunction>( \
+        std::make_shared<ApproxCountDistinctAggregateFunction<T>>());
+
+std::shared_ptr<AggregateFunction> MakeApproxCountDistinctAggregateFunction(
+    const DataType& type, FunctionContext* ctx) {
+  switch (type.id()) {
+    APPROX_DISTINCT_AGG_FN_CASE(BooleanType);
+    APPROX_DISTINCT_AGG_FN_CASE(UInt8Type);
+    APPROX_DISTINCT_AGG_FN_CASE(Int8Type);
+    APPROX_DISTINCT_AGG_FN_CASE(UInt16Type);
+    APPROX_DISTINCT_AGG_FN_CASE(Int16Type);
+    APPROX_DISTINCT_AGG_FN_CASE(UInt32Type);
+    APPROX_DISTINCT_AGG_FN_CASE(Int32Type);
+    APPROX_DISTINCT_AGG_FN_CASE(UInt64Type);
+    APPROX_DISTINCT_AGG_FN_CASE(Int64Type);
+    APPROX_DISTINCT_AGG_FN_CASE(FloatType);
+    APPROX_DISTINCT_AGG_FN_CASE(DoubleType);
+    APPROX_DISTINCT_AGG_FN_CASE(Date32Type);
+    APPROX_DISTINCT_AGG_FN_CASE(Date64Type);
+    APPROX_DISTINCT_AGG_FN_CASE(Time32Type);
+    APPROX_DISTINCT_AGG_FN_CASE(Time64Type);
+    APPROX_DISTINCT_AGG_FN_CASE(TimestampType);
+    APPROX_DISTINCT_AGG_FN_CASE(BinaryType);
+    APPROX_DISTINCT_AGG_FN_CASE(StringType);
+    APPROX_DISTINCT_AGG_FN_CASE(FixedSizeBinaryType);
+    APPROX_DISTINCT_AGG_FN_CASE(Decimal128Type);
+    default:
+      return nullptr;
+  }
+
+#undef APPROX_DISTINCT_AGG_FN_CASE
+}
+
+Status ApproxCountDistinct(FunctionContext* ctx, const Datum& value, Datum* out) {
+  auto data_type = detail::DecodedType(value.type());
+  if (data_type == nullptr) return Status::Invalid("Datum must be array-like");
+
+  std::shared_ptr<AggregateFunction> aggregate =
+      MakeApproxCountDistinctAggregateFunction(*data_type, ctx);
+  if (!aggregate) {
+    return Status::NotImplemented("No approximate distinct count for type ",
+                                  *data_type);
+  }
+
+  auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
+  return kernel->Call(ctx, value, out);
+}
+
+// ----------------------------------------------------------------------
+// ApproxQuantile
+
+ApproxQuantileOptions ApproxQuantileOptions::Defaults() {
+  return ApproxQuantileOptions();
+}
+
+static constexpr double kPi = 3.14159265358979323846;
+
+struct Centroid {
+  double mean;
+  double weight;
+};
+
+// A merging t-digest (Dunning & Ertl, "Computing extremely accurate quantiles
+// using t-digests").  Values are appended to a buffer, which is periodically
+// sorted and merged into the centroids.
+struct TDigestState {
+  std::vector<Centroid> centroids;
+  std::vector<Centroid> buffer;
+  double total_weight = 0;
+  double min = std::numeric_limits<double>::infinity();
+  double max = -std::numeric_limits<double>::infinity();
+};
+
+class TDigest {
+ public:
+  explicit TDigest(double compression)
+      : compression_(compression),
+        buffer_capacity_(static_cast<size_t>(std::ceil(compression * 5))) {}
+
+  void Add(double value, TDigestState* state) const {
+    state->buffer.push_back(Centroid{value, 1});
+    state->total_weight += 1;
+    state->min = std::min(state->min, value);
+    state->max = std::max(state->max, value);
+    if (state->buffer.size() >= buffer_capacity_) {
+      Compress(state);
+    }
+  }
+
+  void Merge(const TDigestState& src, TDigestState* dst) const {
+    dst->buffer.insert(dst->buffer.end(), src.centroids.begin(), src.centroids.end());
+    dst->buffer.insert(dst->buffer.end(), src.buffer.begin(), src.buffer.end());
+    dst->total_weight += src.total_weight;
+    dst->min = std::min(dst->min, src.min);
+    dst->max = std::max(dst->max, src.max);
+    if (dst->buffer.size() >= buffer_capacity_) {
+      Compress(dst);
+    }
+  }
+
+  // Merge adjacent centroids as long as each stays within one unit of the
+  // k1 scale function, which keeps centroids small near the tails.
+  void Compress(TDigestState* state) const {
+    if (state->buffer.empty()) return;
+    auto& points = state->buffer;
+    points.insert(points.end(), state->centroids.begin(), state->centroids.end());
+    std::sort(points.begin(), points.end(),
+              [](const Centroid& left, const Centroid& right) {
+                return left.mean < right.mean;
+              });
+
+    const double total = state->total_weight;
+    std::vector<Centroid> merged;
+    Centroid current = points[0];
+    double weight_before = 0;
+    double weight_limit = total * QuantileLimit(0);
+    for (size_t i = 1; i < points.size(); ++i) {
+      const Centroid& next = points[i];
+      if (weight_before + current.weight + next.weight <= weight_limit) {
+        current.weight += next.weight;
+        current.mean += (next.mean - current.mean) * next.weight / current.weight;
+      } else {
+        weight_before += current.weight;
+        merged.push_back(current);
+        weight_limit = total * QuantileLimit(weight_before / total);
+        current = next;
+      }
+    }
+    merged.push_back(current);
+    state->centroids.swap(merged);
+    points.clear();
+  }
+
+  // Interpolate between centroid means, treating each centroid's weight as
+  // centered on its mean, and the extremes as exact.
+  static double Quantile(const TDigestState& state, double q) {
+    const auto& centroids = state.centroids;
+    if (q <= 0) return state.min;
+    if (q >= 1) return state.max;
+
+    const double target = q * state.total_weight;
+    const Centroid& first = centroids.front();
+    if (target < first.weight / 2) {
+      return state.min + (first.mean - state.min) * target / (first.weight / 2);
+    }
+    double weight_before = 0;
+    for (size_t i = 0; i + 1 < centroids.size(); ++i) {
+      const double left = weight_before + centroids[i].weight / 2;
+      const double right =
+          weight_before + centroids[i].weight + centroids[i + 1].weight / 2;
+      if (target < right) {
+        return centroids[i].mean + (centroids[i + 1].mean - centroids[i].mean) *
+                                       (target - left) / (right - left);
+      }
+      weight_before += centroids[i].weight;
+    }
+    const Centroid& last = centroids.back();
+    const double left = state.total_weight - last.weight / 2;
+    return last.mean + (state.max - last.mean) * (target - left) / (last.weight / 2);
+  }
+
+ private:
+  // The quantile one unit of k1(q) = compression / (2 pi) * asin(2q - 1)
+  // above q
+  double QuantileLimit(double q) const {
+    const double k =
+        compression_ / (2 * kPi) * std::asin(2 * std::min(q, 1.0) - 1) + 1;
+    if (k >= compression_ / 4) return 1;
+    return (std::sin(k * 2 * kPi / compression_) + 1) / 2;
+  }
+
+  double compression_;
+  size_t buffer_capacity_;
+};
+
+template <typename ArrowType>
+class ApproxQuantileAggregateFunction final
+    : public AggregateFunctionStaticState<TDigestState> {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  explicit ApproxQuantileAggregateFunction(const ApproxQuantileOptions& options)
+      : quantiles_(options.quantiles), digest_(options.compression) {}
+
+  Status Consume(const Array& input, TDigestState* state) const override {
+    const ArrayType& array = static_cast<const ArrayType&>(input);
+    const auto values = array.raw_values();
+    const bool has_nulls = array.null_count() != 0;
+    for (int64_t i = 0; i < array.length(); ++i) {
+      if (has_nulls && array.IsNull(i)) continue;
+      const double value = static_cast<double>(values[i]);
+      if (std::isnan(value)) continue;
+      digest_.Add(value, state);
+    }
+    return Status::OK();
+  }
+
+  Status Merge(const TDigestState& src, TDigestState* dst) const override {
+    digest_.Merge(src, dst);
+    return Status::OK();
+  }
+
+  Status Finalize(const TDigestState& src, Datum* output) const override {
+    TDigestState state = src;
+    digest_.Compress(&state);
+    const bool is_valid = state.total_weight > 0;
+    std::vector<Datum> quantiles;
+    for (double q : quantiles_) {
+      const double value = is_valid ? TDigest::Quantile(state, q) : 0;
+      quantiles.emplace_back(std::make_shared<DoubleScalar>(value, is_valid));
+    }
+    *output = quantiles;
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return float64(); }
+
+ private:
+  std::vector<double> quantiles_;
+  TDigest digest_;
+};
+
+static Status ValidateOptions(const ApproxQuantileOptions& options) {
+  if (!(options.compression >= 1)) {
+    return Status::Invalid("t-digest compression must be at least 1, got ",
+                           options.compression);
+  }
+  for (double q : options.quantiles) {
+    if (!(q >= 0 && q <= 1)) {
+      return Status::Invalid("Quantile must be between 0 and 1, got ", q);
+    }
+  }
+  return Status::OK();
+}
+
+#define APPROX_QUANTILE_AGG_FN_CASE(T)                  \
+  case T::type_id:                                      \
+    return std::static_pointer_cast<AggregateFunction>( \
+        std::make_shared<ApproxQuantileAggregateFunction<T>>(options));
+
+std::shared_ptr<AggregateFunction> MakeApproxQuantileAggregateFunction(
+    const DataType& type, const ApproxQuantileOptions& options, FunctionContext* ctx) {
+  if (!ValidateOptions(options).ok()) return nullptr;
+  switch (type.id()) {
+    APPROX_QUANTILE_AGG_FN_CASE(UInt8Type);
+    APPROX_QUANTILE_AGG_FN_CASE(Int8Type);
+    APPROX_QUANTILE_AGG_FN_CASE(UInt16Type);
+    APPROX_QUANTILE_AGG_FN_CASE(Int16Type);
+    APPROX_QUANTILE_AGG_FN_CASE(UInt32Type);
+    APPROX_QUANTILE_AGG_FN_CASE(Int32Type);
+    APPROX_QUANTILE_AGG_FN_CASE(UInt64Type);
+    APPROX_QUANTILE_AGG_FN_CASE(Int64Type);
+    APPROX_QUANTILE_AGG_FN_CASE(FloatType);
+    APPROX_QUANTILE_AGG_FN_CASE(DoubleType);
+    default:
+      return nullptr;
+  }
+
+#undef APPROX_QUANTILE_AGG_FN_CASE
+}
+
+Status ApproxQuantile(FunctionContext* ctx, const Datum& value,
+                      const ApproxQuantileOptions& options, Datum* out) {
+  auto data_type = value.type();
+  if (data_type == nullptr)
+    return Status::Invalid("Datum must be array-like");
+  else if (!is_integer(data_type->id()) && !is_floating(data_type->id()))
+    return Status::Invalid("Datum must contain a NumericType");
+  RETURN_NOT_OK(ValidateOptions(options));
+
+  std::shared_ptr<AggregateFunction> aggregate =
+      MakeApproxQuantileAggregateFunction(*data_type, options, ctx);
+  if (!aggregate) return Status::Invalid("No approximate quantile for type ", *data_type);
+
+  auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
+  return kernel->Call(ctx, value, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
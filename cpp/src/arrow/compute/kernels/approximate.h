@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_APPROXIMATE_H
+#define ARROW_COMPUTE_KERNELS_APPROXIMATE_H
+
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+/// \brief Return a HyperLogLog aggregate estimating the number of distinct
+/// valid values of the given type, or nullptr if the type is not supported.
+///
+/// The state is 2^14 one-byte registers regardless of the input size, for a
+/// relative standard error of about 0.8%.  Merging two states is exact, so
+/// the estimate does not depend on how the input was split.
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeApproxCountDistinctAggregateFunction(
+    const DataType& type, FunctionContext* context);
+
+/// \brief Estimate the number of distinct values of an array-like datum.
+///
+/// Null values are ignored.  The result is an Int64Scalar.  Supported types
+/// are the primitive, temporal, binary and string types, and dictionaries
+/// of those, whose distinct entries are hashed once per batch instead of
+/// once per value.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value datum to count, expecting Array or ChunkedArray
+/// \param[out] out resulting datum
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproxCountDistinct(FunctionContext* context, const Datum& value, Datum* out);
+
+struct ARROW_EXPORT ApproxQuantileOptions {
+  /// The quantiles to compute, each in [0, 1]
+  std::vector<double> quantiles = {0.5};
+  /// The t-digest compression: higher values keep more centroids, trading
+  /// memory for accuracy.  The state holds at most about this many centroids.
+  double compression = 100;
+
+  static ApproxQuantileOptions Defaults();
+};
+
+/// \brief Return a t-digest aggregate estimating quantiles of the given
+/// numeric type, or nullptr if the type is not supported or the options are
+/// invalid.
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeApproxQuantileAggregateFunction(
+    const DataType& type, const ApproxQuantileOptions& options,
+    FunctionContext* context);
+
+/// \brief Estimate quantiles of a numeric array-like datum with a t-digest.
+///
+/// Null and NaN values are ignored.  The result is a collection Datum of one
+/// DoubleScalar per requested quantile, all null if there are no valid
+/// values.  Quantiles 0 and 1 are the exact minimum and maximum; accuracy
+/// is best near the tails.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value datum to summarize, expecting Array or ChunkedArray
+/// \param[in] options the quantiles to compute and the digest compression
+/// \param[out] out resulting datum
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproxQuantile(FunctionContext* context, const Datum& value,
+                      const ApproxQuantileOptions& options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_APPROXIMATE_H
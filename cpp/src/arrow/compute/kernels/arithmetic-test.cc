@@ -0,0 +1,260 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/decimal.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/test-util.h"
+
+namespace arrow {
+namespace compute {
+
+class TestArithmeticKernel : public ComputeFixture, public TestBase {
+ public:
+  void AssertArithmetic(ArithmeticOptions options, const Datum& left,
+                        const Datum& right, const std::shared_ptr<Array>& expected) {
+    Datum out;
+    ASSERT_OK(Arithmetic(&ctx_, left, right, options, &out));
+    ASSERT_EQ(Datum::ARRAY, out.kind());
+    std::shared_ptr<Array> result = out.make_array();
+    ASSERT_OK(ValidateArray(*result));
+    AssertArraysEqual(*expected, *result);
+  }
+
+  void AssertArithmetic(ArithmeticOptions options, const std::shared_ptr<DataType>& type,
+                        const std::string& left, const std::string& right,
+                        const std::string& expected) {
+    AssertArithmetic(options, ArrayFromJSON(type, left), ArrayFromJSON(type, right),
+                     ArrayFromJSON(type, expected));
+  }
+
+  void AssertOverflow(ArithmeticOptions options, const std::shared_ptr<DataType>& type,
+                      const std::string& left, const std::string& right) {
+    Datum out;
+    ASSERT_RAISES(Invalid, Arithmetic(&ctx_, ArrayFromJSON(type, left),
+                                      ArrayFromJSON(type, right), options, &out));
+  }
+};
+
+const ArithmeticOptions kAdd(ArithmeticOperator::ADD);
+const ArithmeticOptions kSubtract(ArithmeticOperator::SUBTRACT);
+const ArithmeticOptions kMultiply(ArithmeticOperator::MULTIPLY);
+const ArithmeticOptions kDivide(ArithmeticOperator::DIVIDE);
+const ArithmeticOptions kCheckedAdd(ArithmeticOperator::ADD, true);
+const ArithmeticOptions kCheckedSubtract(ArithmeticOperator::SUBTRACT, true);
+const ArithmeticOptions kCheckedMultiply(ArithmeticOperator::MULTIPLY, true);
+const ArithmeticOptions kCheckedDivide(ArithmeticOperator::DIVIDE, true);
+
+TEST_F(TestArithmeticKernel, Integers) {
+  for (auto type : {int8(), uint8(), int16(), uint16(), int32(), uint32(), int64(),
+                    uint64()}) {
+    for (auto options : {kAdd, kCheckedAdd}) {
+      AssertArithmetic(options, type, "[1, null, 3, 4]", "[5, 6, null, 0]",
+                       "[6, null, null, 4]");
+    }
+    for (auto options : {kSubtract, kCheckedSubtract}) {
+      AssertArithmetic(options, type, "[9, 7]", "[2, 7]", "[7, 0]");
+    }
+    for (auto options : {kMultiply, kCheckedMultiply}) {
+      AssertArithmetic(options, type, "[3, null, 0]", "[4, 5, 9]", "[12, null, 0]");
+    }
+    for (auto options : {kDivide, kCheckedDivide}) {
+      AssertArithmetic(options, type, "[9, 7, 1]", "[2, 7, 3]", "[4, 1, 0]");
+    }
+    AssertArithmetic(kAdd, type, "[]", "[]", "[]");
+  }
+}
+
+TEST_F(TestArithmeticKernel, IntegerOverflow) {
+  // Unchecked operations wrap around
+  AssertArithmetic(kAdd, int8(), "[127, -128]", "[1, -1]", "[-128, 127]");
+  AssertArithmetic(kSubtract, uint8(), "[0]", "[1]", "[255]");
+  AssertArithmetic(kMultiply, int32(), "[65536]", "[65536]", "[0]");
+  AssertArithmetic(kDivide, int16(), "[-32768, 5]", "[-1, 0]", "[-32768, 0]");
+
+  AssertOverflow(kCheckedAdd, int8(), "[1, 127]", "[1, 1]");
+  AssertOverflow(kCheckedAdd, uint64(), "[18446744073709551615]", "[1]");
+  AssertOverflow(kCheckedSubtract, uint8(), "[0]", "[1]");
+  AssertOverflow(kCheckedSubtract, int64(), "[-9223372036854775808]", "[1]");
+  AssertOverflow(kCheckedMultiply, int32(), "[65536]", "[65536]");
+  AssertOverflow(kCheckedMultiply, uint16(), "[256]", "[256]");
+  AssertOverflow(kCheckedDivide, int16(), "[-32768]", "[-1]");
+  AssertOverflow(kCheckedDivide, int32(), "[1, 2]", "[1, 0]");
+
+  // Overflow in null slots is not reported
+  AssertArithmetic(kCheckedAdd, int8(), "[127, null, 1]", "[null, 1, 2]",
+                   "[null, null, 3]");
+  AssertArithmetic(kCheckedDivide, uint32(), "[null, 4]", "[0, 2]", "[null, 2]");
+}
+
+TEST_F(TestArithmeticKernel, FloatingPoint) {
+  for (auto type : {float32(), float64()}) {
+    for (auto checked : {false, true}) {
+      AssertArithmetic(ArithmeticOptions(ArithmeticOperator::ADD, checked), type,
+                       "[1.5, null, -2]", "[0.25, 1, 2]", "[1.75, null, 0]");
+      AssertArithmetic(ArithmeticOptions(ArithmeticOperator::MULTIPLY, checked), type,
+                       "[1.5, -2]", "[4, 0.5]", "[6, -1]");
+      AssertArithmetic(ArithmeticOptions(ArithmeticOperator::DIVIDE, checked), type,
+                       "[3, -1]", "[2, 4]", "[1.5, -0.25]");
+    }
+  }
+  // Division by zero follows IEEE 754
+  Datum out;
+  ASSERT_OK(Arithmetic(&ctx_, ArrayFromJSON(float64(), "[1, -1]"),
+                       ArrayFromJSON(float64(), "[0, 0]"), kCheckedDivide, &out));
+  auto values = std::static_pointer_cast<DoubleArray>(out.make_array());
+  ASSERT_EQ(std::numeric_limits<double>::infinity(), values->Value(0));
+  ASSERT_EQ(-std::numeric_limits<double>::infinity(), values->Value(1));
+}
+
+TEST_F(TestArithmeticKernel, Decimal) {
+  auto type = decimal(5, 2);
+  for (auto checked : {false, true}) {
+    AssertArithmetic(ArithmeticOptions(ArithmeticOperator::ADD, checked), type,
+                     R"(["1.25", null, "-3.00"])", R"(["2.50", "1.00", "0.01"])",
+                     R"(["3.75", null, "-2.99"])");
+    AssertArithmetic(ArithmeticOptions(ArithmeticOperator::SUBTRACT, checked), type,
+                     R"(["1.25"])", R"(["2.50"])", R"(["-1.25"])");
+    // Products and quotients are truncated to the scale
+    AssertArithmetic(ArithmeticOptions(ArithmeticOperator::MULTIPLY, checked), type,
+                     R"(["1.25", "-0.33"])", R"(["2.50", "0.33"])",
+                     R"(["3.12", "-0.10"])");
+    AssertArithmetic(ArithmeticOptions(ArithmeticOperator::DIVIDE, checked), type,
+                     R"(["1.00", "-7.50"])", R"(["3.00", "2.00"])",
+                     R"(["0.33", "-3.75"])");
+  }
+  AssertArithmetic(kDivide, type, R"(["1.00"])", R"(["0.00"])", R"(["0.00"])");
+  AssertOverflow(kCheckedDivide, type, R"(["1.00"])", R"(["0.00"])");
+  // Checked results must fit in the precision
+  AssertOverflow(kCheckedAdd, type, R"(["999.99"])", R"(["0.01"])");
+  AssertOverflow(kCheckedMultiply, type, R"(["100.00"])", R"(["10.00"])");
+  AssertArithmetic(kCheckedMultiply, type, R"([null, "1.00"])", R"(["100.00", "2.00"])",
+                   R"([null, "2.00"])");
+}
+
+TEST_F(TestArithmeticKernel, DecimalBeyond64Bits) {
+  // Operands and results not fitting in 64 bits take the 128-bit path
+  for (auto checked : {false, true}) {
+    AssertArithmetic(ArithmeticOptions(ArithmeticOperator::ADD, checked),
+                     decimal(20, 2), R"(["92233720368547758.07", "1.00"])",
+                     R"(["0.01", "2.00"])", R"(["92233720368547758.08", "3.00"])");
+    AssertArithmetic(ArithmeticOptions(ArithmeticOperator::SUBTRACT, checked),
+                     decimal(20, 0),
+                     R"(["-9223372036854775808", "10000000000000000000"])",
+                     R"(["1", "1"])",
+                     R"(["-9223372036854775809", "9999999999999999999"])");
+    AssertArithmetic(ArithmeticOptions(ArithmeticOperator::MULTIPLY, checked),
+                     decimal(30, 2), R"(["30000000000.00", "1.50"])",
+                     R"(["40000000000.00", "2.00"])",
+                     R"(["1200000000000000000000.00", "3.00"])");
+    AssertArithmetic(ArithmeticOptions(ArithmeticOperator::DIVIDE, checked),
+                     decimal(25, 2), R"(["100000000000000000.00", "-7.50"])",
+                     R"(["3.00", "2.00"])", R"(["33333333333333333.33", "-3.75"])");
+    // 10^scale doesn't fit in 64 bits, and the unscaled product or dividend
+    // doesn't fit in 128 bits
+    AssertArithmetic(ArithmeticOptions(ArithmeticOperator::MULTIPLY, checked),
+                     decimal(38, 20), R"(["1.50000000000000000000"])",
+                     R"(["-2.00000000000000000000"])", R"(["-3.00000000000000000000"])");
+    AssertArithmetic(ArithmeticOptions(ArithmeticOperator::DIVIDE, checked),
+                     decimal(38, 20), R"(["1000000000000.00000000000000000000"])",
+                     R"(["3.00000000000000000000"])",
+                     R"(["333333333333.33333333333333333333"])");
+  }
+  AssertArithmetic(kCheckedAdd, decimal(19, 0), R"(["9223372036854775807"])", R"(["1"])",
+                   R"(["9223372036854775808"])");
+  AssertOverflow(kCheckedAdd, decimal(19, 0), R"(["9999999999999999999"])", R"(["1"])");
+  AssertOverflow(kCheckedMultiply, decimal(18, 0), R"(["1000000000"])",
+                 R"(["1000000000"])");
+  AssertOverflow(kCheckedMultiply, decimal(38, 20),
+                 R"(["100000000000000000.00000000000000000000"])",
+                 R"(["10.00000000000000000000"])");
+}
+
+// Datum only converts from shared_ptr<Scalar> itself
+std::shared_ptr<Scalar> MakeScalar(std::shared_ptr<Scalar> scalar) { return scalar; }
+
+TEST_F(TestArithmeticKernel, Scalar) {
+  auto values = ArrayFromJSON(int32(), "[1, null, 3, 2147483647]");
+  auto ten = MakeScalar(std::make_shared<Int32Scalar>(10));
+  AssertArithmetic(kAdd, values, ten,
+                   ArrayFromJSON(int32(), "[11, null, 13, -2147483639]"));
+  AssertArithmetic(kMultiply, values, MakeScalar(std::make_shared<Int32Scalar>(0, false)),
+                   ArrayFromJSON(int32(), "[null, null, null, null]"));
+
+  // The scalar may be on either side
+  AssertArithmetic(kSubtract, ten, values,
+                   ArrayFromJSON(int32(), "[9, null, 7, -2147483637]"));
+  AssertArithmetic(kDivide, ten, ArrayFromJSON(int32(), "[3, 0, null, -5]"),
+                   ArrayFromJSON(int32(), "[3, 0, null, -2]"));
+
+  Datum out;
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, values, ten, kCheckedAdd, &out));
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, ten, values, kCheckedAdd, &out));
+  auto zero = MakeScalar(std::make_shared<Int32Scalar>(0));
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, values, zero, kCheckedDivide, &out));
+  ASSERT_RAISES(Invalid, Arithmetic(&ctx_, ten, zero, kAdd, &out));
+
+  auto type = decimal(5, 2);
+  Decimal128 two;
+  int32_t precision, scale;
+  ASSERT_OK(Decimal128::FromString("2.00", &two, &precision, &scale));
+  AssertArithmetic(kDivide, ArrayFromJSON(type, R"(["1.00", null])"),
+                   MakeScalar(std::make_shared<Decimal128Scalar>(two, type)),
+                   ArrayFromJSON(type, R"(["0.50", null])"));
+}
+
+TEST_F(TestArithmeticKernel, SlicedAndChunked) {
+  auto left = ArrayFromJSON(int16(), "[0, 1, null, 3, 4, 5, 6, 7, 8, 9]")->Slice(1);
+  auto right = ArrayFromJSON(int16(), "[9, 9, 1, 1, 1, null, 1, 1, 1, 1, 1]")->Slice(2);
+  AssertArithmetic(kAdd, left, right,
+                   ArrayFromJSON(int16(), "[2, null, 4, null, 6, 7, 8, 9, 10]"));
+
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(int64(), "[1, 2]"), ArrayFromJSON(int64(), "[null, 4, 5]")});
+  Datum out;
+  auto three = MakeScalar(std::make_shared<Int64Scalar>(3));
+  ASSERT_OK(Arithmetic(&ctx_, chunked, three, kSubtract, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  AssertChunkedEqual(*out.chunked_array(), {ArrayFromJSON(int64(), "[-2, -1]"),
+                                             ArrayFromJSON(int64(), "[null, 1, 2]")});
+}
+
+TEST_F(TestArithmeticKernel, InvalidTypes) {
+  Datum out;
+  ASSERT_RAISES(TypeError,
+                Arithmetic(&ctx_, ArrayFromJSON(int32(), "[1]"),
+                           ArrayFromJSON(int64(), "[1]"), kAdd, &out));
+  ASSERT_RAISES(NotImplemented,
+                Arithmetic(&ctx_, ArrayFromJSON(boolean(), "[true]"),
+                           ArrayFromJSON(boolean(), "[true]"), kAdd, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
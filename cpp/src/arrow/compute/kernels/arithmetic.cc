@@ -0,0 +1,749 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/arithmetic.h"
+
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/basic_decimal.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::BitmapAnd;
+using internal::checked_cast;
+using internal::CopyBitmap;
+using internal::CountSetBits;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Integer overflow
+
+// An unsigned type at least as wide as int, in which T wraps around
+// without undefined behaviour or promotion to a signed type
+template <typename T>
+using WrappingType =
+    typename std::conditional<(sizeof(T) < sizeof(unsigned)), unsigned,
+                              typename std::make_unsigned<T>::type>::type;
+
+template <typename T>
+T WrappingAdd(T a, T b) {
+  using U = WrappingType<T>;
+  return static_cast<T>(static_cast<U>(a) + static_cast<U>(b));
+}
+
+template <typename T>
+T WrappingSubtract(T a, T b) {
+  using U = WrappingType<T>;
+  return static_cast<T>(static_cast<U>(a) - static_cast<U>(b));
+}
+
+template <typename T>
+T WrappingMultiply(T a, T b) {
+  using U = WrappingType<T>;
+  return static_cast<T>(static_cast<U>(a) * static_cast<U>(b));
+}
+
+// Each returns whether the operation overflowed, storing the wrapped result
+
+template <typename T>
+bool AddWithOverflow(T a, T b, T* out) {
+#if defined(__GNUC__)
+  return __builtin_add_overflow(a, b, out);
+#else
+  *out = WrappingAdd(a, b);
+  return std::is_signed<T>::value ? ((a ^ *out) & (b ^ *out)) < 0 : *out < a;
+#endif
+}
+
+template <typename T>
+bool SubtractWithOverflow(T a, T b, T* out) {
+#if defined(__GNUC__)
+  return __builtin_sub_overflow(a, b, out);
+#else
+  *out = WrappingSubtract(a, b);
+  return std::is_signed<T>::value ? ((a ^ b) & (a ^ *out)) < 0 : a < b;
+#endif
+}
+
+template <typename T>
+bool MultiplyWithOverflow(T a, T b, T* out) {
+#if defined(__GNUC__)
+  return __builtin_mul_overflow(a, b, out);
+#else
+  *out = WrappingMultiply(a, b);
+  if (a == 0 || b == 0) {
+    return false;
+  }
+  if (std::is_signed<T>::value) {
+    constexpr T kMin = std::numeric_limits<T>::min();
+    if ((a == -1 && b == kMin) || (b == -1 && a == kMin)) {
+      return true;
+    }
+  }
+  return *out / b != a;
+#endif
+}
+
+// ----------------------------------------------------------------------
+// Operators
+//
+// Each operator computes Unchecked(a, b), which never fails, and
+// Checked(a, b, &out), which returns false on overflow or division by zero.
+// Unchecked loops are branch-free where possible to let the compiler
+// vectorize them.
+
+template <typename T>
+using enable_if_integral_c = typename std::enable_if<std::is_integral<T>::value>::type;
+
+template <typename T>
+using enable_if_floating_c =
+    typename std::enable_if<std::is_floating_point<T>::value>::type;
+
+template <typename T, typename Enable = void>
+struct AddOp {};
+
+template <typename T, typename Enable = void>
+struct SubtractOp {};
+
+template <typename T, typename Enable = void>
+struct MultiplyOp {};
+
+template <typename T, typename Enable = void>
+struct DivideOp {};
+
+template <typename T>
+struct AddOp<T, enable_if_integral_c<T>> {
+  explicit AddOp(const DataType&) {}
+  static constexpr const char* kError = "Overflow in addition";
+  T Unchecked(T a, T b) const { return WrappingAdd(a, b); }
+  bool Checked(T a, T b, T* out) const { return !AddWithOverflow(a, b, out); }
+};
+
+template <typename T>
+struct SubtractOp<T, enable_if_integral_c<T>> {
+  explicit SubtractOp(const DataType&) {}
+  static constexpr const char* kError = "Overflow in subtraction";
+  T Unchecked(T a, T b) const { return WrappingSubtract(a, b); }
+  bool Checked(T a, T b, T* out) const { return !SubtractWithOverflow(a, b, out); }
+};
+
+template <typename T>
+struct MultiplyOp<T, enable_if_integral_c<T>> {
+  explicit MultiplyOp(const DataType&) {}
+  static constexpr const char* kError = "Overflow in multiplication";
+  T Unchecked(T a, T b) const { return WrappingMultiply(a, b); }
+  bool Checked(T a, T b, T* out) const { return !MultiplyWithOverflow(a, b, out); }
+};
+
+template <typename T>
+struct DivideOp<T, enable_if_integral_c<T>> {
+  explicit DivideOp(const DataType&) {}
+  static constexpr const char* kError = "Division by zero or overflow in division";
+
+  // Whether a / b overflows, i.e. is the minimum value divided by -1
+  static bool Overflows(T a, T b) {
+    return std::is_signed<T>::value && a == std::numeric_limits<T>::min() &&
+           b == static_cast<T>(-1);
+  }
+
+  T Unchecked(T a, T b) const {
+    if (b == 0) {
+      return 0;
+    }
+    // The minimum value divided by -1 wraps around to itself
+    return Overflows(a, b) ? a : static_cast<T>(a / b);
+  }
+
+  bool Checked(T a, T b, T* out) const {
+    if (b == 0 || Overflows(a, b)) {
+      return false;
+    }
+    *out = static_cast<T>(a / b);
+    return true;
+  }
+};
+
+template <typename T>
+struct AddOp<T, enable_if_floating_c<T>> {
+  explicit AddOp(const DataType&) {}
+  static constexpr const char* kError = "";
+  T Unchecked(T a, T b) const { return a + b; }
+  bool Checked(T a, T b, T* out) const {
+    *out = a + b;
+    return true;
+  }
+};
+
+template <typename T>
+struct SubtractOp<T, enable_if_floating_c<T>> {
+  explicit SubtractOp(const DataType&) {}
+  static constexpr const char* kError = "";
+  T Unchecked(T a, T b) const { return a - b; }
+  bool Checked(T a, T b, T* out) const {
+    *out = a - b;
+    return true;
+  }
+};
+
+template <typename T>
+struct MultiplyOp<T, enable_if_floating_c<T>> {
+  explicit MultiplyOp(const DataType&) {}
+  static constexpr const char* kError = "";
+  T Unchecked(T a, T b) const { return a * b; }
+  bool Checked(T a, T b, T* out) const {
+    *out = a * b;
+    return true;
+  }
+};
+
+template <typename T>
+struct DivideOp<T, enable_if_floating_c<T>> {
+  explicit DivideOp(const DataType&) {}
+  static constexpr const char* kError = "";
+  T Unchecked(T a, T b) const { return a / b; }
+  bool Checked(T a, T b, T* out) const {
+    *out = a / b;
+    return true;
+  }
+};
+
+// Decimal operators know the scale and precision of their type.
+//
+// Operands that fit in 64 bits, which is always the case for a precision
+// of at most 18, are computed with 64-bit integer arithmetic as long as the
+// result fits in 64 bits too, falling back to 128-bit arithmetic otherwise
+// (with a 256-bit intermediate for multiplication and division).
+class DecimalOpBase {
+ public:
+  explicit DecimalOpBase(const DataType& type)
+      : scale_(checked_cast<const Decimal128Type&>(type).scale()),
+        precision_(checked_cast<const Decimal128Type&>(type).precision()),
+        bound_(BasicDecimal128::GetScaleMultiplier(precision_)),
+        multiplier64_(BasicDecimal128::GetScaleMultiplier64(scale_)),
+        bound64_(BasicDecimal128::GetScaleMultiplier64(precision_)) {}
+
+ protected:
+  static bool IsNegative(const BasicDecimal128& value) { return value.high_bits() < 0; }
+
+  // Whether the value fits in the precision of the type
+  bool Fits(const BasicDecimal128& value) const {
+    return -bound_ < value && value < bound_;
+  }
+
+  bool Fits(int64_t value) const {
+    // An int64_t has at most 19 digits
+    return bound64_ == 0 || (-bound64_ < value && value < bound64_);
+  }
+
+  int32_t scale_;
+  int32_t precision_;
+  BasicDecimal128 bound_;
+  // 10^scale and 10^precision, or 0 if they don't fit in an int64_t
+  int64_t multiplier64_;
+  int64_t bound64_;
+};
+
+template <>
+struct AddOp<BasicDecimal128> : public DecimalOpBase {
+  using DecimalOpBase::DecimalOpBase;
+  static constexpr const char* kError = "Overflow in addition";
+
+  // Whether a + b was computed in 64 bits
+  static bool Add64(const BasicDecimal128& a, const BasicDecimal128& b, int64_t* out) {
+    int64_t a64, b64;
+    return a.ToInt64(&a64) && b.ToInt64(&b64) && !AddWithOverflow(a64, b64, out);
+  }
+
+  BasicDecimal128 Unchecked(const BasicDecimal128& a, const BasicDecimal128& b) const {
+    int64_t result;
+    if (ARROW_PREDICT_TRUE(Add64(a, b, &result))) {
+      return result;
+    }
+    return a + b;
+  }
+  bool Checked(const BasicDecimal128& a, const BasicDecimal128& b,
+               BasicDecimal128* out) const {
+    int64_t result;
+    if (ARROW_PREDICT_TRUE(Add64(a, b, &result))) {
+      *out = result;
+      return Fits(result);
+    }
+    *out = a + b;
+    // Operands of the same sign overflow 128 bits if the sign changes
+    const bool wrapped =
+        IsNegative(a) == IsNegative(b) && IsNegative(*out) != IsNegative(a);
+    return !wrapped && Fits(*out);
+  }
+};
+
+template <>
+struct SubtractOp<BasicDecimal128> : public DecimalOpBase {
+  using DecimalOpBase::DecimalOpBase;
+  static constexpr const char* kError = "Overflow in subtraction";
+
+  // Whether a - b was computed in 64 bits
+  static bool Subtract64(const BasicDecimal128& a, const BasicDecimal128& b,
+                         int64_t* out) {
+    int64_t a64, b64;
+    return a.ToInt64(&a64) && b.ToInt64(&b64) && !SubtractWithOverflow(a64, b64, out);
+  }
+
+  BasicDecimal128 Unchecked(const BasicDecimal128& a, const BasicDecimal128& b) const {
+    int64_t result;
+    if (ARROW_PREDICT_TRUE(Subtract64(a, b, &result))) {
+      return result;
+    }
+    return a - b;
+  }
+  bool Checked(const BasicDecimal128& a, const BasicDecimal128& b,
+               BasicDecimal128* out) const {
+    int64_t result;
+    if (ARROW_PREDICT_TRUE(Subtract64(a, b, &result))) {
+      *out = result;
+      return Fits(result);
+    }
+    *out = a - b;
+    const bool wrapped =
+        IsNegative(a) != IsNegative(b) && IsNegative(*out) != IsNegative(a);
+    return !wrapped && Fits(*out);
+  }
+};
+
+template <>
+struct MultiplyOp<BasicDecimal128> : public DecimalOpBase {
+  using DecimalOpBase::DecimalOpBase;
+  static constexpr const char* kError = "Overflow in multiplication";
+
+  // Whether a * b / 10^scale was computed in 64 bits (truncating towards
+  // zero, as ReduceScaleBy does)
+  bool Multiply64(const BasicDecimal128& a, const BasicDecimal128& b,
+                  int64_t* out) const {
+    int64_t a64, b64, product;
+    if (multiplier64_ == 0 || !a.ToInt64(&a64) || !b.ToInt64(&b64) ||
+        MultiplyWithOverflow(a64, b64, &product)) {
+      return false;
+    }
+    *out = product / multiplier64_;
+    return true;
+  }
+
+  BasicDecimal128 Unchecked(const BasicDecimal128& a, const BasicDecimal128& b) const {
+    int64_t result;
+    if (ARROW_PREDICT_TRUE(Multiply64(a, b, &result))) {
+      return result;
+    }
+    BasicDecimal128 product;
+    a.MultiplyAndReduceScaleBy(b, scale_, &product);
+    return product;
+  }
+  bool Checked(const BasicDecimal128& a, const BasicDecimal128& b,
+               BasicDecimal128* out) const {
+    int64_t result;
+    if (ARROW_PREDICT_TRUE(Multiply64(a, b, &result))) {
+      *out = result;
+      return Fits(result);
+    }
+    // The product of two large-scale operands may need more than 128 bits
+    // before being scaled down
+    return a.MultiplyAndReduceScaleBy(b, scale_, out) == DecimalStatus::kSuccess &&
+           Fits(*out);
+  }
+};
+
+template <>
+struct DivideOp<BasicDecimal128> : public DecimalOpBase {
+  using DecimalOpBase::DecimalOpBase;
+  static constexpr const char* kError = "Division by zero or overflow in division";
+
+  // Whether a * 10^scale / b was computed in 64 bits, b being non-zero
+  bool Divide64(const BasicDecimal128& a, const BasicDecimal128& b, int64_t* out) const {
+    int64_t a64, b64, dividend;
+    if (multiplier64_ == 0 || !a.ToInt64(&a64) || !b.ToInt64(&b64) ||
+        MultiplyWithOverflow(a64, multiplier64_, &dividend) ||
+        (dividend == std::numeric_limits<int64_t>::min() && b64 == -1)) {
+      return false;
+    }
+    *out = dividend / b64;
+    return true;
+  }
+
+  BasicDecimal128 Unchecked(const BasicDecimal128& a, const BasicDecimal128& b) const {
+    if (b == 0) {
+      return 0;
+    }
+    int64_t result;
+    if (ARROW_PREDICT_TRUE(Divide64(a, b, &result))) {
+      return result;
+    }
+    BasicDecimal128 quotient;
+    a.IncreaseScaleAndDivide(scale_, b, &quotient);
+    return quotient;
+  }
+  bool Checked(const BasicDecimal128& a, const BasicDecimal128& b,
+               BasicDecimal128* out) const {
+    if (b == 0) {
+      return false;
+    }
+    int64_t result;
+    if (ARROW_PREDICT_TRUE(Divide64(a, b, &result))) {
+      *out = result;
+      return Fits(result);
+    }
+    return a.IncreaseScaleAndDivide(scale_, b, out) == DecimalStatus::kSuccess &&
+           Fits(*out);
+  }
+};
+
+// ----------------------------------------------------------------------
+// Value access
+
+template <typename ArrowType, typename Enable = void>
+struct ArithmeticTraits {};
+
+template <typename ArrowType>
+struct ArithmeticTraits<ArrowType, enable_if_number<ArrowType>> {
+  using ValueType = typename ArrowType::c_type;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  class ArrayValues {
+   public:
+    explicit ArrayValues(const ArrayData& data)
+        : values_(data.GetValues<ValueType>(1)) {}
+
+    ValueType operator()(int64_t i) const { return values_[i]; }
+
+   private:
+    const ValueType* values_;
+  };
+
+  class OutputValues {
+   public:
+    explicit OutputValues(uint8_t* data) : values_(reinterpret_cast<ValueType*>(data)) {}
+
+    void Set(int64_t i, ValueType value) { values_[i] = value; }
+
+   private:
+    ValueType* values_;
+  };
+
+  static ValueType ScalarValue(const Scalar& scalar) {
+    return checked_cast<const ScalarType&>(scalar).value;
+  }
+};
+
+template <>
+struct ArithmeticTraits<Decimal128Type> {
+  using ValueType = BasicDecimal128;
+  static constexpr int64_t kByteWidth = 16;
+
+  class ArrayValues {
+   public:
+    explicit ArrayValues(const ArrayData& data)
+        : values_(data.GetValues<uint8_t>(1, data.offset * kByteWidth)) {}
+
+    ValueType operator()(int64_t i) const {
+      return BasicDecimal128(values_ + i * kByteWidth);
+    }
+
+   private:
+    const uint8_t* values_;
+  };
+
+  class OutputValues {
+   public:
+    explicit OutputValues(uint8_t* data) : values_(data) {}
+
+    void Set(int64_t i, const ValueType& value) {
+      value.ToBytes(values_ + i * kByteWidth);
+    }
+
+   private:
+    uint8_t* values_;
+  };
+
+  static ValueType ScalarValue(const Scalar& scalar) {
+    return checked_cast<const Decimal128Scalar&>(scalar).value;
+  }
+};
+
+// Type-erased arithmetic on values, with the validity of the result (or
+// null if all valid) to ignore failures in null slots
+class Calculator {
+ public:
+  virtual ~Calculator() = default;
+
+  virtual Status Compute(const ArrayData& left, const ArrayData& right,
+                         const uint8_t* validity, uint8_t* out) const = 0;
+  virtual Status Compute(const ArrayData& left, const Scalar& right,
+                         const uint8_t* validity, uint8_t* out) const = 0;
+  virtual Status Compute(const Scalar& left, const ArrayData& right,
+                         const uint8_t* validity, uint8_t* out) const = 0;
+};
+
+template <typename ArrowType, typename Op, bool kChecked>
+class CalculatorImpl : public Calculator {
+  using Traits = ArithmeticTraits<ArrowType>;
+  using ArrayValues = typename Traits::ArrayValues;
+  using OutputValues = typename Traits::OutputValues;
+  using ValueType = typename Traits::ValueType;
+
+ public:
+  explicit CalculatorImpl(const DataType& type) : op_(type) {}
+
+  Status Compute(const ArrayData& left, const ArrayData& right, const uint8_t* validity,
+                 uint8_t* out) const override {
+    return Loop(left.length, ArrayValues(left), ArrayValues(right), validity, out);
+  }
+
+  Status Compute(const ArrayData& left, const Scalar& right, const uint8_t* validity,
+                 uint8_t* out) const override {
+    const ValueType right_value = Traits::ScalarValue(right);
+    return Loop(left.length, ArrayValues(left),
+                [&](int64_t) { return right_value; }, validity, out);
+  }
+
+  Status Compute(const Scalar& left, const ArrayData& right, const uint8_t* validity,
+                 uint8_t* out) const override {
+    const ValueType left_value = Traits::ScalarValue(left);
+    return Loop(right.length, [&](int64_t) { return left_value; }, ArrayValues(right),
+                validity, out);
+  }
+
+ private:
+  template <typename LeftValues, typename RightValues>
+  Status Loop(int64_t length, LeftValues&& left, RightValues&& right,
+              const uint8_t* validity, uint8_t* out) const {
+    OutputValues values(out);
+    if (!kChecked) {
+      for (int64_t i = 0; i < length; ++i) {
+        values.Set(i, op_.Unchecked(left(i), right(i)));
+      }
+      return Status::OK();
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      ValueType result{};
+      if (ARROW_PREDICT_FALSE(!op_.Checked(left(i), right(i), &result)) &&
+          (validity == NULLPTR || BitUtil::GetBit(validity, i))) {
+        return Status::Invalid(std::string(Op::kError));
+      }
+      values.Set(i, result);
+    }
+    return Status::OK();
+  }
+
+  Op op_;
+};
+
+template <typename ArrowType, template <typename...> class Op>
+std::unique_ptr<Calculator> MakeCalculator(const DataType& type, bool checked) {
+  using ValueType = typename ArithmeticTraits<ArrowType>::ValueType;
+  if (checked) {
+    return std::unique_ptr<Calculator>(
+        new CalculatorImpl<ArrowType, Op<ValueType>, true>(type));
+  }
+  return std::unique_ptr<Calculator>(
+      new CalculatorImpl<ArrowType, Op<ValueType>, false>(type));
+}
+
+template <typename ArrowType>
+std::unique_ptr<Calculator> MakeCalculator(const DataType& type,
+                                           const ArithmeticOptions& options) {
+  switch (options.op) {
+    case ArithmeticOperator::ADD:
+      return MakeCalculator<ArrowType, AddOp>(type, options.check_overflow);
+    case ArithmeticOperator::SUBTRACT:
+      return MakeCalculator<ArrowType, SubtractOp>(type, options.check_overflow);
+    case ArithmeticOperator::MULTIPLY:
+      return MakeCalculator<ArrowType, MultiplyOp>(type, options.check_overflow);
+    case ArithmeticOperator::DIVIDE:
+      return MakeCalculator<ArrowType, DivideOp>(type, options.check_overflow);
+  }
+  return nullptr;
+}
+
+Status MakeCalculator(const DataType& type, const ArithmeticOptions& options,
+                      std::unique_ptr<Calculator>* out) {
+#define CALCULATOR_CASE(T)                     \
+  case T::type_id:                             \
+    *out = MakeCalculator<T>(type, options);   \
+    return Status::OK();
+
+  switch (type.id()) {
+    CALCULATOR_CASE(UInt8Type);
+    CALCULATOR_CASE(Int8Type);
+    CALCULATOR_CASE(UInt16Type);
+    CALCULATOR_CASE(Int16Type);
+    CALCULATOR_CASE(UInt32Type);
+    CALCULATOR_CASE(Int32Type);
+    CALCULATOR_CASE(UInt64Type);
+    CALCULATOR_CASE(Int64Type);
+    CALCULATOR_CASE(FloatType);
+    CALCULATOR_CASE(DoubleType);
+    CALCULATOR_CASE(Decimal128Type);
+    default:
+      break;
+  }
+
+#undef CALCULATOR_CASE
+
+  return Status::NotImplemented("Arithmetic on type ", type);
+}
+
+// ----------------------------------------------------------------------
+// Kernels
+
+// Allocate the output of `type`, with validity from the given inputs
+// (right may be null)
+Status AllocateArithmeticOutput(FunctionContext* ctx,
+                                const std::shared_ptr<DataType>& type,
+                                const ArrayData& left, const ArrayData* right,
+                                Datum* out) {
+  const int64_t length = left.length;
+  const int byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+  std::shared_ptr<Buffer> validity, data;
+  RETURN_NOT_OK(ctx->Allocate(length * byte_width, &data));
+
+  const bool left_nulls = left.GetNullCount() > 0;
+  const bool right_nulls = right != NULLPTR && right->GetNullCount() > 0;
+  if (left_nulls && right_nulls) {
+    RETURN_NOT_OK(BitmapAnd(ctx->memory_pool(), left.buffers[0]->data(), left.offset,
+                            right->buffers[0]->data(), right->offset, length, 0,
+                            &validity));
+  } else if (left_nulls) {
+    RETURN_NOT_OK(CopyBitmap(ctx->memory_pool(), left.buffers[0]->data(), left.offset,
+                             length, &validity));
+  } else if (right_nulls) {
+    RETURN_NOT_OK(CopyBitmap(ctx->memory_pool(), right->buffers[0]->data(),
+                             right->offset, length, &validity));
+  }
+  const int64_t null_count =
+      validity ? length - CountSetBits(validity->data(), 0, length) : 0;
+  out->value = ArrayData::Make(type, length, {validity, data}, null_count);
+  return Status::OK();
+}
+
+const uint8_t* OutputValidity(const Datum& out) {
+  const auto& validity = out.array()->buffers[0];
+  return validity ? validity->data() : NULLPTR;
+}
+
+class ArithmeticKernel : public BinaryKernel {
+ public:
+  explicit ArithmeticKernel(std::unique_ptr<Calculator> calculator)
+      : calculator_(std::move(calculator)) {}
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out) override {
+    if (left.is_scalar() || right.is_scalar()) {
+      return CallScalar(ctx, left, right, out);
+    }
+    DCHECK_EQ(Datum::ARRAY, left.kind());
+    DCHECK_EQ(Datum::ARRAY, right.kind());
+    const ArrayData& left_data = *left.array();
+    const ArrayData& right_data = *right.array();
+
+    RETURN_NOT_OK(
+        AllocateArithmeticOutput(ctx, left_data.type, left_data, &right_data, out));
+    if (left_data.length == 0) {
+      return Status::OK();
+    }
+    return calculator_->Compute(left_data, right_data, OutputValidity(*out),
+                                out->array()->buffers[1]->mutable_data());
+  }
+
+  bool is_thread_safe() const override { return true; }
+
+  bool accepts_scalars() const override { return true; }
+
+ private:
+  // The scalar value is applied to every value of the array on the other side
+  Status CallScalar(FunctionContext* ctx, const Datum& left, const Datum& right,
+                    Datum* out) {
+    const bool scalar_left = left.is_scalar();
+    DCHECK_EQ(Datum::ARRAY, (scalar_left ? right : left).kind());
+    const ArrayData& values = *(scalar_left ? right : left).array();
+    const Scalar& scalar = *(scalar_left ? left : right).scalar();
+    const int64_t length = values.length;
+
+    RETURN_NOT_OK(AllocateArithmeticOutput(ctx, values.type, values, NULLPTR, out));
+    if (!scalar.is_valid) {
+      // All results are null
+      ArrayData* result = out->array().get();
+      RETURN_NOT_OK(AllocateEmptyBitmap(ctx->memory_pool(), length, &result->buffers[0]));
+      std::memset(result->buffers[1]->mutable_data(), 0, result->buffers[1]->size());
+      result->null_count = length;
+      return Status::OK();
+    }
+    if (length == 0) {
+      return Status::OK();
+    }
+    uint8_t* out_values = out->array()->buffers[1]->mutable_data();
+    return scalar_left
+               ? calculator_->Compute(scalar, values, OutputValidity(*out), out_values)
+               : calculator_->Compute(values, scalar, OutputValidity(*out), out_values);
+  }
+
+  std::unique_ptr<Calculator> calculator_;
+};
+
+}  // namespace
+
+Status Arithmetic(FunctionContext* ctx, const Datum& left, const Datum& right,
+                  ArithmeticOptions options, Datum* out) {
+  if (!left.is_arraylike() && !left.is_scalar()) {
+    return Status::Invalid("Left input of arithmetic must be array-like or scalar");
+  }
+  if (!right.is_arraylike() && !right.is_scalar()) {
+    return Status::Invalid("Right input of arithmetic must be array-like or scalar");
+  }
+  if (left.is_scalar() && right.is_scalar()) {
+    return Status::Invalid("One input of arithmetic must be array-like");
+  }
+  if (!left.type()->Equals(*right.type())) {
+    return Status::TypeError("Cannot apply arithmetic to values of type ", *left.type(),
+                             " and ", *right.type());
+  }
+
+  std::unique_ptr<Calculator> calculator;
+  RETURN_NOT_OK(MakeCalculator(*left.type(), options, &calculator));
+
+  ArithmeticKernel kernel(std::move(calculator));
+  return detail::InvokeBinaryArrayKernel(ctx, &kernel, left, right, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_ARITHMETIC_H
+#define ARROW_COMPUTE_KERNELS_ARITHMETIC_H
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+enum class ArithmeticOperator {
+  ADD,
+  SUBTRACT,
+  MULTIPLY,
+  DIVIDE,
+};
+
+struct ARROW_EXPORT ArithmeticOptions {
+  explicit ArithmeticOptions(ArithmeticOperator op, bool check_overflow = false)
+      : op(op), check_overflow(check_overflow) {}
+
+  ArithmeticOperator op;
+  /// Whether to fail on integer and decimal overflow and division by zero.
+  /// Unchecked operations never fail: integers wrap around, decimals are
+  /// truncated to 128 bits and integer or decimal division by zero gives 0.
+  bool check_overflow;
+};
+
+/// \brief Apply an arithmetic operator element-wise
+///
+/// `left` and `right` may be array-like, with the same length, or one of
+/// them a scalar applied to every element of the other.  Both must have
+/// the same integer, floating-point or decimal type, which is the type of
+/// the result.  The result is null where either input is null; overflow in
+/// null slots is never reported.
+///
+/// Floating-point operations follow IEEE 754 in both modes.  Decimal
+/// products and quotients are truncated to the scale of the inputs, and
+/// checked decimal results must fit in their precision.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left array-like or scalar left-hand side
+/// \param[in] right array-like or scalar right-hand side
+/// \param[in] options arithmetic options (e.g. the operator)
+/// \param[out] out resulting datum
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Arithmetic(FunctionContext* context, const Datum& left, const Datum& right,
+                  ArithmeticOptions options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_ARITHMETIC_H
@@ -22,8 +22,12 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/scalar.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/thread-pool.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -42,9 +46,8 @@ using BinaryKernelFunc =
 
 class TestBooleanKernel : public ComputeFixture, public TestBase {
  public:
-  void TestArrayBinary(const BinaryKernelFunc& kernel, const std::shared_ptr<Array>& left,
-                       const std::shared_ptr<Array>& right,
-                       const std::shared_ptr<Array>& expected) {
+  void TestArrayBinary(const BinaryKernelFunc& kernel, const Datum& left,
+                       const Datum& right, const std::shared_ptr<Array>& expected) {
     Datum result;
     ASSERT_OK(kernel(&this->ctx_, left, right, &result));
     ASSERT_EQ(Datum::ARRAY, result.kind());
@@ -165,5 +168,76 @@ TEST_F(TestBooleanKernel, Xor) {
   TestBinaryKernel(Xor, values1, values2, values3, values3_nulls);
 }
 
+TEST_F(TestBooleanKernel, Scalar) {
+  auto type = boolean();
+  auto values = _MakeArray<BooleanType, bool>(type, {true, false, true, false, true},
+                                              {true, true, false, true, true});
+  auto true_scalar = std::make_shared<BooleanScalar>(true);
+  auto false_scalar = std::make_shared<BooleanScalar>(false);
+  auto null_scalar = std::make_shared<BooleanScalar>(false, false);
+  auto expected = [&](const vector<bool>& expected_values) {
+    return _MakeArray<BooleanType, bool>(type, expected_values,
+                                         {true, true, false, true, true});
+  };
+
+  // The scalar may be on either side
+  TestArrayBinary(And, values, Datum(true_scalar), values);
+  TestArrayBinary(And, Datum(false_scalar), values,
+                  expected({false, false, false, false, false}));
+  TestArrayBinary(Or, values, Datum(true_scalar),
+                  expected({true, true, true, true, true}));
+  TestArrayBinary(Or, Datum(false_scalar), values, values);
+  TestArrayBinary(Xor, Datum(true_scalar), values,
+                  expected({false, true, false, true, false}));
+  TestArrayBinary(Xor, values, Datum(false_scalar), values);
+  TestArrayBinary(And, values->Slice(1), Datum(true_scalar), values->Slice(1));
+  TestArrayBinary(Xor, Datum(true_scalar), values->Slice(1),
+                  expected({false, true, false, true, false})->Slice(1));
+  auto all_null = _MakeArray<BooleanType, bool>(type, {false, false, false, false, false},
+                                                {false, false, false, false, false});
+  TestArrayBinary(Or, Datum(null_scalar), values, all_null);
+
+  auto chunked = std::make_shared<ChunkedArray>(ArrayVector{values, values->Slice(2)});
+  Datum result;
+  ASSERT_OK(Xor(&this->ctx_, chunked, Datum(true_scalar), &result));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, result.kind());
+  auto inverted = expected({false, true, false, true, false});
+  ASSERT_TRUE(result.chunked_array()->Equals(
+      std::make_shared<ChunkedArray>(ArrayVector{inverted, inverted->Slice(2)})));
+
+  ASSERT_RAISES(Invalid,
+                And(&this->ctx_, Datum(true_scalar), Datum(true_scalar), &result));
+}
+
+TEST_F(TestBooleanKernel, UseThreads) {
+  auto rand = random::RandomArrayGenerator(0x0b00);
+  const int64_t length = 3 * detail::kMorselLength / 2;
+  // Misaligned chunks produce pieces shorter than a morsel
+  auto left = std::make_shared<ChunkedArray>(
+      ArrayVector{rand.Boolean(length, 0.5, 0.1), rand.Boolean(length, 0.5, 0.1)});
+  auto right = std::make_shared<ChunkedArray>(ArrayVector{
+      rand.Boolean(length / 3, 0.5, 0.1), rand.Boolean(2 * length - length / 3, 0.5, 0)});
+
+  // Make sure several tasks are used even on small machines
+  const int saved_capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(4));
+
+  Datum serial_and, serial_invert;
+  ASSERT_OK(And(&ctx_, left, right, &serial_and));
+  ASSERT_OK(Invert(&ctx_, left, &serial_invert));
+
+  ctx_.set_use_threads(true);
+  Datum parallel_and, parallel_invert;
+  ASSERT_OK(And(&ctx_, left, right, &parallel_and));
+  ASSERT_OK(Invert(&ctx_, left, &parallel_invert));
+  ctx_.set_use_threads(false);
+
+  ASSERT_GT(parallel_and.chunked_array()->num_chunks(),
+            serial_and.chunked_array()->num_chunks());
+  ASSERT_TRUE(parallel_and.chunked_array()->Equals(serial_and.chunked_array()));
+  ASSERT_TRUE(parallel_invert.chunked_array()->Equals(serial_invert.chunked_array()));
+  ASSERT_OK(SetCpuThreadPoolCapacity(saved_capacity));
+}
+
 }  // namespace compute
 }  // namespace arrow
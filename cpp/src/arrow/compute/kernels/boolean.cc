@@ -17,6 +17,7 @@
 
 #include "arrow/compute/kernels/boolean.h"
 
+#include <cstring>
 #include <memory>
 #include <vector>
 
@@ -25,8 +26,10 @@
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/util-internal.h"
+#include "arrow/scalar.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -34,6 +37,8 @@ namespace arrow {
 using internal::BitmapAnd;
 using internal::BitmapOr;
 using internal::BitmapXor;
+using internal::checked_cast;
+using internal::CopyBitmap;
 using internal::CountSetBits;
 using internal::InvertBitmap;
 
@@ -42,6 +47,8 @@ namespace compute {
 class BooleanUnaryKernel : public UnaryKernel {
  public:
   std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+  bool is_thread_safe() const override { return true; }
 };
 
 class InvertKernel : public BooleanUnaryKernel {
@@ -52,6 +59,7 @@ class InvertKernel : public BooleanUnaryKernel {
     const ArrayData& in_data = *input.array();
     std::shared_ptr<ArrayData> result = out->array();
     result->type = boolean();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result.get()));
 
     // Handle output data buffer
     if (in_data.length > 0) {
@@ -75,45 +83,138 @@ Status Invert(FunctionContext* ctx, const Datum& value, Datum* out) {
   return Status::OK();
 }
 
+// Values and validity are written into preallocated buffers if the output
+// has them
+void GetOutputBuffers(const Datum& out, std::shared_ptr<Buffer>* validity_bitmap,
+                      std::shared_ptr<Buffer>* values) {
+  if (out.kind() == Datum::ARRAY && out.array()->buffers.size() > 1) {
+    *validity_bitmap = out.array()->buffers[0];
+    *values = out.array()->buffers[1];
+  }
+}
+
 class BinaryBooleanKernel : public BinaryKernel {
-  virtual Status Compute(FunctionContext* ctx, const ArrayData& left,
-                         const ArrayData& right, ArrayData* out) = 0;
+  // Write the values of the result for `length` slots into `out`
+  virtual void Compute(const ArrayData& left, const ArrayData& right, int64_t length,
+                       uint8_t* out) = 0;
+  // Same with a valid scalar operand on either side
+  virtual void Compute(const ArrayData& values, bool scalar, int64_t length,
+                       uint8_t* out) = 0;
 
   Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
               Datum* out) override {
+    if (left.is_scalar() || right.is_scalar()) {
+      // The operators are commutative
+      const bool scalar_left = left.is_scalar();
+      DCHECK_EQ(Datum::ARRAY, (scalar_left ? right : left).kind());
+      return CallScalar(ctx, *(scalar_left ? right : left).array(),
+                        *(scalar_left ? left : right).scalar(), out);
+    }
     DCHECK_EQ(Datum::ARRAY, right.kind());
     DCHECK_EQ(Datum::ARRAY, left.kind());
 
     const ArrayData& left_data = *left.array();
     const ArrayData& right_data = *right.array();
-    ArrayData* result;
-    out->value = ArrayData::Make(boolean(), right_data.length);
+    const int64_t length = right_data.length;
 
-    result = out->array().get();
+    std::shared_ptr<Buffer> validity_bitmap;
+    std::shared_ptr<Buffer> values;
+    GetOutputBuffers(*out, &validity_bitmap, &values);
+    if (values == nullptr) {
+      RETURN_NOT_OK(AllocateEmptyBitmap(ctx->memory_pool(), length, &values));
+    }
 
     // If one of the arrays has a null value, the result will have a null.
+    const bool left_nulls = left_data.GetNullCount() > 0;
+    const bool right_nulls = right_data.GetNullCount() > 0;
+    if (!left_nulls && !right_nulls) {
+      validity_bitmap = nullptr;
+    } else if (validity_bitmap == nullptr) {
+      RETURN_NOT_OK(AllocateEmptyBitmap(ctx->memory_pool(), length, &validity_bitmap));
+    }
+    uint8_t* validity = validity_bitmap ? validity_bitmap->mutable_data() : nullptr;
+    if (left_nulls && right_nulls) {
+      BitmapAnd(left_data.buffers[0]->data(), left_data.offset,
+                right_data.buffers[0]->data(), right_data.offset, length, 0, validity);
+    } else if (left_nulls) {
+      CopyBitmap(left_data.buffers[0]->data(), left_data.offset, length, validity, 0);
+    } else if (right_nulls) {
+      CopyBitmap(right_data.buffers[0]->data(), right_data.offset, length, validity, 0);
+    }
+    const int64_t null_count =
+        validity ? length - CountSetBits(validity, 0, length) : 0;
+
+    out->value =
+        ArrayData::Make(boolean(), length, {validity_bitmap, values}, null_count);
+    if (length > 0) {
+      Compute(left_data, right_data, length, values->mutable_data());
+    }
+    return Status::OK();
+  }
+
+  Status CallScalar(FunctionContext* ctx, const ArrayData& input, const Scalar& scalar,
+                    Datum* out) {
+    DCHECK_EQ(Type::BOOL, scalar.type->id());
+    const int64_t length = input.length;
+
     std::shared_ptr<Buffer> validity_bitmap;
-    RETURN_NOT_OK(BitmapAnd(ctx->memory_pool(), left_data.buffers[0]->data(),
-                            left_data.offset, right_data.buffers[0]->data(),
-                            right_data.offset, right_data.length, 0, &validity_bitmap));
-    result->buffers.push_back(validity_bitmap);
+    std::shared_ptr<Buffer> values;
+    GetOutputBuffers(*out, &validity_bitmap, &values);
+    if (values == nullptr) {
+      RETURN_NOT_OK(AllocateEmptyBitmap(ctx->memory_pool(), length, &values));
+    }
 
-    result->null_count =
-        result->length - CountSetBits(validity_bitmap->data(), 0, result->length);
+    if (!scalar.is_valid) {
+      // All results are null
+      if (validity_bitmap == nullptr) {
+        RETURN_NOT_OK(AllocateEmptyBitmap(ctx->memory_pool(), length, &validity_bitmap));
+      } else {
+        std::memset(validity_bitmap->mutable_data(), 0, BitUtil::BytesForBits(length));
+      }
+      std::memset(values->mutable_data(), 0, BitUtil::BytesForBits(length));
+      out->value = ArrayData::Make(boolean(), length, {validity_bitmap, values}, length);
+      return Status::OK();
+    }
 
-    return Compute(ctx, left_data, right_data, result);
+    const int64_t null_count = input.GetNullCount();
+    if (null_count == 0) {
+      validity_bitmap = nullptr;
+    } else {
+      if (validity_bitmap == nullptr) {
+        RETURN_NOT_OK(AllocateEmptyBitmap(ctx->memory_pool(), length, &validity_bitmap));
+      }
+      CopyBitmap(input.buffers[0]->data(), input.offset, length,
+                 validity_bitmap->mutable_data(), 0);
+    }
+    out->value =
+        ArrayData::Make(boolean(), length, {validity_bitmap, values}, null_count);
+    if (length > 0) {
+      Compute(input, checked_cast<const BooleanScalar&>(scalar).value, length,
+              values->mutable_data());
+    }
+    return Status::OK();
   }
+
+ public:
+  bool is_thread_safe() const override { return true; }
+
+  bool accepts_scalars() const override { return true; }
 };
 
 class AndKernel : public BinaryBooleanKernel {
-  Status Compute(FunctionContext* ctx, const ArrayData& left, const ArrayData& right,
-                 ArrayData* out) override {
-    std::shared_ptr<Buffer> data_bitmap;
-    RETURN_NOT_OK(BitmapAnd(ctx->memory_pool(), left.buffers[1]->data(), left.offset,
-                            right.buffers[1]->data(), right.offset, right.length, 0,
-                            &data_bitmap));
-    out->buffers.push_back(data_bitmap);
-    return Status::OK();
+  void Compute(const ArrayData& left, const ArrayData& right, int64_t length,
+               uint8_t* out) override {
+    BitmapAnd(left.buffers[1]->data(), left.offset, right.buffers[1]->data(),
+              right.offset, length, 0, out);
+  }
+
+  void Compute(const ArrayData& values, bool scalar, int64_t length,
+               uint8_t* out) override {
+    if (scalar) {
+      CopyBitmap(values.buffers[1]->data(), values.offset, length, out, 0);
+    } else {
+      std::memset(out, 0, BitUtil::BytesForBits(length));
+    }
   }
 };
 
@@ -123,14 +224,19 @@ Status And(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* o
 }
 
 class OrKernel : public BinaryBooleanKernel {
-  Status Compute(FunctionContext* ctx, const ArrayData& left, const ArrayData& right,
-                 ArrayData* out) override {
-    std::shared_ptr<Buffer> data_bitmap;
-    RETURN_NOT_OK(BitmapOr(ctx->memory_pool(), left.buffers[1]->data(), left.offset,
-                           right.buffers[1]->data(), right.offset, right.length, 0,
-                           &data_bitmap));
-    out->buffers.push_back(data_bitmap);
-    return Status::OK();
+  void Compute(const ArrayData& left, const ArrayData& right, int64_t length,
+               uint8_t* out) override {
+    BitmapOr(left.buffers[1]->data(), left.offset, right.buffers[1]->data(),
+             right.offset, length, 0, out);
+  }
+
+  void Compute(const ArrayData& values, bool scalar, int64_t length,
+               uint8_t* out) override {
+    if (scalar) {
+      std::memset(out, 0xff, BitUtil::BytesForBits(length));
+    } else {
+      CopyBitmap(values.buffers[1]->data(), values.offset, length, out, 0);
+    }
   }
 };
 
@@ -140,14 +246,19 @@ Status Or(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* ou
 }
 
 class XorKernel : public BinaryBooleanKernel {
-  Status Compute(FunctionContext* ctx, const ArrayData& left, const ArrayData& right,
-                 ArrayData* out) override {
-    std::shared_ptr<Buffer> data_bitmap;
-    RETURN_NOT_OK(BitmapXor(ctx->memory_pool(), left.buffers[1]->data(), left.offset,
-                            right.buffers[1]->data(), right.offset, right.length, 0,
-                            &data_bitmap));
-    out->buffers.push_back(data_bitmap);
-    return Status::OK();
+  void Compute(const ArrayData& left, const ArrayData& right, int64_t length,
+               uint8_t* out) override {
+    BitmapXor(left.buffers[1]->data(), left.offset, right.buffers[1]->data(),
+              right.offset, length, 0, out);
+  }
+
+  void Compute(const ArrayData& values, bool scalar, int64_t length,
+               uint8_t* out) override {
+    if (scalar) {
+      InvertBitmap(values.buffers[1]->data(), values.offset, length, out, 0);
+    } else {
+      CopyBitmap(values.buffers[1]->data(), values.offset, length, out, 0);
+    }
   }
 };
 
@@ -156,5 +267,25 @@ Status Xor(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* o
   return detail::InvokeBinaryArrayKernel(ctx, &kernel, left, right, out);
 }
 
+Status GetInvertKernel(std::unique_ptr<UnaryKernel>* kernel) {
+  kernel->reset(new InvertKernel());
+  return Status::OK();
+}
+
+Status GetAndKernel(std::unique_ptr<BinaryKernel>* kernel) {
+  kernel->reset(new AndKernel());
+  return Status::OK();
+}
+
+Status GetOrKernel(std::unique_ptr<BinaryKernel>* kernel) {
+  kernel->reset(new OrKernel());
+  return Status::OK();
+}
+
+Status GetXorKernel(std::unique_ptr<BinaryKernel>* kernel) {
+  kernel->reset(new XorKernel());
+  return Status::OK();
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -18,6 +18,8 @@
 #ifndef ARROW_COMPUTE_KERNELS_BOOLEAN_H
 #define ARROW_COMPUTE_KERNELS_BOOLEAN_H
 
+#include <memory>
+
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
@@ -26,6 +28,8 @@ namespace compute {
 
 struct Datum;
 class FunctionContext;
+class UnaryKernel;
+class BinaryKernel;
 
 /// \brief Invert the values of a boolean datum
 /// \param[in] context the FunctionContext
@@ -39,8 +43,8 @@ Status Invert(FunctionContext* context, const Datum& value, Datum* out);
 
 /// \brief Element-wise AND of two boolean dates
 /// \param[in] context the FunctionContext
-/// \param[in] left left operand (array)
-/// \param[in] right right operand (array)
+/// \param[in] left left operand (array-like or scalar)
+/// \param[in] right right operand (array-like, or scalar if left is array-like)
 /// \param[out] out resulting datum
 ///
 /// \since 0.11.0
@@ -50,8 +54,8 @@ Status And(FunctionContext* context, const Datum& left, const Datum& right, Datu
 
 /// \brief Element-wise OR of two boolean dates
 /// \param[in] context the FunctionContext
-/// \param[in] left left operand (array)
-/// \param[in] right right operand (array)
+/// \param[in] left left operand (array-like or scalar)
+/// \param[in] right right operand (array-like, or scalar if left is array-like)
 /// \param[out] out resulting datum
 ///
 /// \since 0.11.0
@@ -61,8 +65,8 @@ Status Or(FunctionContext* context, const Datum& left, const Datum& right, Datum
 
 /// \brief Element-wise XOR of two boolean dates
 /// \param[in] context the FunctionContext
-/// \param[in] left left operand (array)
-/// \param[in] right right operand (array)
+/// \param[in] left left operand (array-like or scalar)
+/// \param[in] right right operand (array-like, or scalar if left is array-like)
 /// \param[out] out resulting datum
 ///
 /// \since 0.11.0
@@ -70,6 +74,39 @@ Status Or(FunctionContext* context, const Datum& left, const Datum& right, Datum
 ARROW_EXPORT
 Status Xor(FunctionContext* context, const Datum& left, const Datum& right, Datum* out);
 
+/// \brief Get the kernel of Invert
+///
+/// The kernel writes the values of its output into a preallocated buffer.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetInvertKernel(std::unique_ptr<UnaryKernel>* kernel);
+
+/// \brief Get the kernel of And
+///
+/// The kernel writes the values and validity of its output into preallocated
+/// buffers if the output has them, and allocates them otherwise.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetAndKernel(std::unique_ptr<BinaryKernel>* kernel);
+
+/// \brief Get the kernel of Or, see GetAndKernel
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetOrKernel(std::unique_ptr<BinaryKernel>* kernel);
+
+/// \brief Get the kernel of Xor, see GetAndKernel
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetXorKernel(std::unique_ptr<BinaryKernel>* kernel);
+
 }  // namespace compute
 }  // namespace arrow
 
@@ -82,9 +82,10 @@ class TestCast : public ComputeFixture, public TestBase {
     ASSERT_RAISES(Invalid, Cast(&ctx_, *input, out_type, options, &result));
   }
 
-  void CheckZeroCopy(const Array& input, const shared_ptr<DataType>& out_type) {
+  void CheckZeroCopy(const Array& input, const shared_ptr<DataType>& out_type,
+                     const CastOptions& options = CastOptions()) {
     shared_ptr<Array> result;
-    ASSERT_OK(Cast(&ctx_, input, out_type, {}, &result));
+    ASSERT_OK(Cast(&ctx_, input, out_type, options, &result));
     ASSERT_EQ(input.data()->buffers.size(), result->data()->buffers.size());
     for (size_t i = 0; i < input.data()->buffers.size(); ++i) {
       AssertBufferSame(input, *result, static_cast<int>(i));
@@ -522,6 +523,47 @@ TEST_F(TestCast, TimestampToTimestamp) {
                             timestamp(TimeUnit::SECOND), options);
 }
 
+TEST_F(TestCast, DecimalToDecimal) {
+  CastOptions options;
+
+  vector<bool> is_valid = {true, false, true, true, true};
+  // A large value exercises the 128-bit path
+  const Decimal128 large("1234567890123456789012345");
+  vector<Decimal128> v1 = {Decimal128(0), Decimal128(12), Decimal128(-123),
+                           Decimal128(1000), large};
+  vector<Decimal128> e1 = {Decimal128(0), Decimal128(1200), Decimal128(-12300),
+                           Decimal128(100000), large * 100};
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(30, 2), v1, is_valid, decimal(32, 4), e1, options);
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(32, 4), e1, is_valid, decimal(30, 2), v1, options);
+
+  // Same scale, lower precision
+  vector<Decimal128> v2 = {Decimal128(0), Decimal128(12345678), Decimal128(-9999),
+                           Decimal128(12), Decimal128(-1)};
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(20, 2), v2, is_valid, decimal(4, 2), v2, options);
+
+  // Zero copy
+  shared_ptr<Array> arr;
+  ArrayFromVector<Decimal128Type, Decimal128>(decimal(10, 2), is_valid, v2, &arr);
+  CheckZeroCopy(*arr, decimal(12, 2));
+
+  // Data loss and precision overflow
+  vector<Decimal128> v3 = {Decimal128(0), Decimal128(0), Decimal128(-123),
+                           Decimal128(1000), Decimal128(99999)};
+  CheckFails<Decimal128Type>(decimal(10, 2), v3, {}, decimal(10, 1), options);
+  CheckFails<Decimal128Type>(decimal(10, 2), v3, {}, decimal(5, 3), options);
+  CheckFails<Decimal128Type>(decimal(30, 2), e1, {}, decimal(28, 4), options);
+
+  // Truncate
+  options.allow_decimal_truncate = true;
+  vector<Decimal128> e3 = {Decimal128(0), Decimal128(0), Decimal128(-12),
+                           Decimal128(100), Decimal128(9999)};
+  CheckCase<Decimal128Type, Decimal128, Decimal128Type, Decimal128>(
+      decimal(10, 2), v3, is_valid, decimal(10, 1), e3, options);
+}
+
 TEST_F(TestCast, TimestampToDate32_Date64) {
   CastOptions options;
 
@@ -803,6 +845,24 @@ TEST_F(TestCast, DateTimeZeroCopy) {
   CheckZeroCopy(*arr, time64(TimeUnit::MICRO));
   CheckZeroCopy(*arr, date64());
   CheckZeroCopy(*arr, timestamp(TimeUnit::NANO));
+
+  // Only the timezone differs
+  ArrayFromVector<TimestampType, int64_t>(timestamp(TimeUnit::MILLI), is_valid, v2, &arr);
+  CheckZeroCopy(*arr, timestamp(TimeUnit::MILLI, "Europe/Paris"));
+}
+
+TEST_F(TestCast, SameWidthIntegersZeroCopy) {
+  auto arr = ArrayFromJSON(int32(), "[0, -1, null, 7]");
+  CheckZeroCopy(*arr, uint32(), CastOptions::Unsafe());
+  CheckCaseJSON(int32(), uint32(), "[0, -1, null, 7]", "[0, 4294967295, null, 7]",
+                CastOptions::Unsafe());
+
+  arr = ArrayFromJSON(uint8(), "[255, 1]");
+  CheckZeroCopy(*arr, int8(), CastOptions::Unsafe());
+
+  // Safe casts still check the values
+  shared_ptr<Array> result;
+  ASSERT_RAISES(Invalid, Cast(&this->ctx_, *arr, int8(), CastOptions::Safe(), &result));
 }
 
 TEST_F(TestCast, FromNull) {
@@ -899,6 +959,34 @@ void CheckOffsetOutputCase(FunctionContext* ctx, const std::shared_ptr<DataType>
   ASSERT_ARRAYS_EQUAL(*expected, *result);
 }
 
+TEST_F(TestCast, CallerAllocatedOutput) {
+  auto arr = ArrayFromJSON(int32(), "[5, null, 70000, -1, 3]")->Slice(1);
+  const int64_t length = arr->length();
+
+  for (auto out_type : {int64(), date32(), boolean()}) {
+    std::shared_ptr<Buffer> values;
+    ASSERT_OK(this->ctx_.Allocate(length * sizeof(int64_t), &values));
+    auto out = ArrayData::Make(out_type, 0, {nullptr, values});
+
+    ASSERT_OK(Cast(&this->ctx_, *arr, CastOptions(), out.get()));
+    // The values are written to the caller's buffer, even for zero-copy casts
+    ASSERT_EQ(values.get(), out->buffers[1].get());
+    ASSERT_EQ(0, out->offset);
+
+    shared_ptr<Array> expected;
+    ASSERT_OK(Cast(&this->ctx_, *arr, out_type, CastOptions(), &expected));
+    ASSERT_ARRAYS_EQUAL(*expected, *MakeArray(out));
+  }
+
+  // The output must be fixed-width with a large enough values buffer
+  std::shared_ptr<Buffer> values;
+  ASSERT_OK(this->ctx_.Allocate(length * sizeof(int32_t), &values));
+  auto out = ArrayData::Make(int64(), 0, {nullptr, values});
+  ASSERT_RAISES(Invalid, Cast(&this->ctx_, *arr, CastOptions(), out.get()));
+  out = ArrayData::Make(utf8(), 0, {nullptr, values});
+  ASSERT_RAISES(Invalid, Cast(&this->ctx_, *arr, CastOptions(), out.get()));
+}
+
 TEST_F(TestCast, OffsetOutputBuffer) {
   // ARROW-1735
   vector<int32_t> v1 = {0, 10000, 2000, 1000, 0};
@@ -18,6 +18,7 @@
 #include "arrow/compute/kernels/cast.h"
 
 #include <cstdint>
+#include <cstdlib>
 #include <cstring>
 #include <functional>
 #include <limits>
@@ -34,6 +35,7 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/parsing.h"  // IWYU pragma: keep
@@ -623,16 +625,25 @@ class CastKernelBase : public UnaryKernel {
 
   std::shared_ptr<DataType> out_type() const override { return out_type_; }
 
+  bool is_thread_safe() const override { return true; }
+
+  /// \brief Whether the output shares the input buffers, so that no output
+  /// memory needs to be preallocated
+  virtual bool is_zero_copy() const { return false; }
+
  protected:
   std::shared_ptr<DataType> out_type_;
 };
 
-bool NeedToPreallocate(const DataType& type) { return is_fixed_width(type.id()); }
+bool NeedToPreallocate(const UnaryKernel& func) {
+  return is_fixed_width(func.out_type()->id()) &&
+         !checked_cast<const CastKernelBase&>(func).is_zero_copy();
+}
 
 Status InvokeWithAllocation(FunctionContext* ctx, UnaryKernel* func, const Datum& input,
                             Datum* out) {
   std::vector<Datum> result;
-  if (NeedToPreallocate(*func->out_type())) {
+  if (NeedToPreallocate(*func)) {
     // Create wrapper that allocates output memory for primitive types
     detail::PrimitiveAllocatingUnaryKernel wrapper(func, func->out_type());
     RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &wrapper, input, &result));
@@ -995,8 +1006,6 @@ struct CastFunctor<StringType, I,
                    typename std::enable_if<std::is_same<BinaryType, I>::value>::type> {
   void operator()(FunctionContext* ctx, const CastOptions& options,
                   const ArrayData& input, ArrayData* output) {
-    BinaryArray binary(input.Copy());
-
     if (options.allow_invalid_utf8) {
       ZeroCopyData(input, output);
       return;
@@ -1004,26 +1013,16 @@ struct CastFunctor<StringType, I,
 
     util::InitializeUTF8();
 
-    if (binary.null_count() != 0) {
-      for (int64_t i = 0; i < input.length; i++) {
-        if (binary.IsNull(i)) {
-          continue;
-        }
-
-        const auto str = binary.GetView(i);
-        if (ARROW_PREDICT_FALSE(!arrow::util::ValidateUTF8(str))) {
-          ctx->SetStatus(Status::Invalid("Invalid UTF8 payload"));
-          return;
-        }
-      }
-
-    } else {
-      for (int64_t i = 0; i < input.length; i++) {
-        const auto str = binary.GetView(i);
-        if (ARROW_PREDICT_FALSE(!arrow::util::ValidateUTF8(str))) {
-          ctx->SetStatus(Status::Invalid("Invalid UTF8 payload"));
-          return;
-        }
+    if (input.length > 0) {
+      // Validate all values at once
+      const uint8_t* data = input.buffers[2] ? input.buffers[2]->data() : nullptr;
+      const uint8_t* null_bitmap =
+          input.null_count != 0 && input.buffers[0] ? input.buffers[0]->data() : nullptr;
+      if (ARROW_PREDICT_FALSE(!util::ValidateUTF8Strings(
+              data, input.GetValues<int32_t>(1), input.length, null_bitmap,
+              input.offset))) {
+        ctx->SetStatus(Status::Invalid("Invalid UTF8 payload"));
+        return;
       }
     }
 
@@ -1046,6 +1045,8 @@ class IdentityCast : public CastKernelBase {
     out->value = input.array()->Copy();
     return Status::OK();
   }
+
+  bool is_zero_copy() const override { return true; }
 };
 
 class ZeroCopyCast : public CastKernelBase {
@@ -1059,8 +1060,90 @@ class ZeroCopyCast : public CastKernelBase {
     out->value = result;
     return Status::OK();
   }
+
+  bool is_zero_copy() const override { return true; }
+};
+
+// ----------------------------------------------------------------------
+// From one decimal to another
+
+// Values that fit in 64 bits, which is always the case for a precision of at
+// most 18, are rescaled with 64-bit integer arithmetic as long as the result
+// fits in 64 bits too, falling back to 128-bit arithmetic otherwise.
+template <>
+struct CastFunctor<Decimal128Type, Decimal128Type> {
+  static constexpr int64_t kByteWidth = 16;
+
+  void operator()(FunctionContext* ctx, const CastOptions& options,
+                  const ArrayData& input, ArrayData* output) {
+    const auto& in_type = checked_cast<const Decimal128Type&>(*input.type);
+    const auto& out_type = checked_cast<const Decimal128Type&>(*output->type);
+    const int32_t delta_scale = out_type.scale() - in_type.scale();
+
+    if (delta_scale == 0 && out_type.precision() >= in_type.precision()) {
+      ZeroCopyData(input, output);
+      return;
+    }
+    const int32_t abs_delta_scale = std::abs(delta_scale);
+    if (abs_delta_scale > 38) {
+      ctx->SetStatus(Status::NotImplemented("Casting from ", in_type.ToString(), " to ",
+                                            out_type.ToString(),
+                                            ": scale change is too large"));
+      return;
+    }
+
+    const bool check = !options.allow_decimal_truncate;
+    const bool upscale = delta_scale >= 0;
+    const BasicDecimal128 multiplier =
+        BasicDecimal128::GetScaleMultiplier(abs_delta_scale);
+    const BasicDecimal128 bound =
+        BasicDecimal128::GetScaleMultiplier(out_type.precision());
+    const BasicDecimal128 negative_bound = -bound;
+    // 10^abs_delta_scale and 10^precision, or 0 if they don't fit in an int64_t
+    const int64_t multiplier64 = BasicDecimal128::GetScaleMultiplier64(abs_delta_scale);
+    const int64_t bound64 = BasicDecimal128::GetScaleMultiplier64(out_type.precision());
+    // Values up to this magnitude can be upscaled in 64 bits
+    const int64_t max_upscale64 =
+        multiplier64 != 0 ? std::numeric_limits<int64_t>::max() / multiplier64 : 0;
+
+    const uint8_t* in_values = input.GetValues<uint8_t>(1, input.offset * kByteWidth);
+    uint8_t* out_values =
+        output->GetMutableValues<uint8_t>(1, output->offset * kByteWidth);
+    const uint8_t* in_valid = input.null_count != 0 ? input.buffers[0]->data() : NULLPTR;
+
+    for (int64_t i = 0; i < input.length; ++i) {
+      const BasicDecimal128 value(in_values + i * kByteWidth);
+      BasicDecimal128 result;
+      bool ok;
+      int64_t value64;
+      if (multiplier64 != 0 && value.ToInt64(&value64) &&
+          (!upscale || (-max_upscale64 <= value64 && value64 <= max_upscale64))) {
+        const int64_t result64 =
+            upscale ? value64 * multiplier64 : value64 / multiplier64;
+        ok = (upscale || result64 * multiplier64 == value64) &&
+             (bound64 == 0 || (-bound64 < result64 && result64 < bound64));
+        result = BasicDecimal128(result64);
+      } else if (upscale) {
+        result = value * multiplier;
+        ok = result / multiplier == value && negative_bound < result && result < bound;
+      } else {
+        result = value / multiplier;
+        ok = result * multiplier == value && negative_bound < result && result < bound;
+      }
+      if (ARROW_PREDICT_FALSE(check && !ok) &&
+          (in_valid == NULLPTR || BitUtil::GetBit(in_valid, input.offset + i))) {
+        ctx->SetStatus(Status::Invalid("Casting from ", in_type.ToString(), " to ",
+                                       out_type.ToString(), " would lose data: ",
+                                       Decimal128(value).ToString(in_type.scale())));
+        return;
+      }
+      result.ToBytes(out_values + i * kByteWidth);
+    }
+  }
 };
 
+constexpr int64_t CastFunctor<Decimal128Type, Decimal128Type>::kByteWidth;
+
 class CastKernel : public CastKernelBase {
  public:
   CastKernel(const CastOptions& options, const CastFunction& func,
@@ -1130,6 +1213,7 @@ GET_CAST_FUNCTION(DATE64_CASES, Date64Type)
 GET_CAST_FUNCTION(TIME32_CASES, Time32Type)
 GET_CAST_FUNCTION(TIME64_CASES, Time64Type)
 GET_CAST_FUNCTION(TIMESTAMP_CASES, TimestampType)
+GET_CAST_FUNCTION(DECIMAL128_CASES, Decimal128Type)
 GET_CAST_FUNCTION(BINARY_CASES, BinaryType)
 GET_CAST_FUNCTION(STRING_CASES, StringType)
 GET_CAST_FUNCTION(DICTIONARY_CASES, DictionaryType)
@@ -1159,20 +1243,32 @@ Status GetListCastFunc(const DataType& in_type, std::shared_ptr<DataType> out_ty
 
 }  // namespace
 
-inline bool IsZeroCopyCast(Type::type in_type, Type::type out_type) {
-  switch (in_type) {
+inline bool IsZeroCopyCast(const DataType& in_type, const DataType& out_type,
+                           const CastOptions& options) {
+  const Type::type out_id = out_type.id();
+  // Unchecked casts between integers of the same width only reinterpret bits
+  if (options.allow_int_overflow && is_integer(in_type.id()) && is_integer(out_id)) {
+    return checked_cast<const FixedWidthType&>(in_type).bit_width() ==
+           checked_cast<const FixedWidthType&>(out_type).bit_width();
+  }
+  switch (in_type.id()) {
     case Type::INT32:
-      return (out_type == Type::DATE32) || (out_type == Type::TIME32);
+      return (out_id == Type::DATE32) || (out_id == Type::TIME32);
     case Type::INT64:
-      return ((out_type == Type::DATE64) || (out_type == Type::TIME64) ||
-              (out_type == Type::TIMESTAMP));
+      return ((out_id == Type::DATE64) || (out_id == Type::TIME64) ||
+              (out_id == Type::TIMESTAMP));
     case Type::DATE32:
     case Type::TIME32:
-      return out_type == Type::INT32;
+      return out_id == Type::INT32;
     case Type::DATE64:
     case Type::TIME64:
+      return out_id == Type::INT64;
     case Type::TIMESTAMP:
-      return out_type == Type::INT64;
+      // Timestamps of the same unit only differ in their timezone
+      return out_id == Type::INT64 ||
+             (out_id == Type::TIMESTAMP &&
+              checked_cast<const TimestampType&>(in_type).unit() ==
+                  checked_cast<const TimestampType&>(out_type).unit());
     default:
       break;
   }
@@ -1186,7 +1282,7 @@ Status GetCastFunction(const DataType& in_type, std::shared_ptr<DataType> out_ty
     return Status::OK();
   }
 
-  if (IsZeroCopyCast(in_type.id(), out_type->id())) {
+  if (IsZeroCopyCast(in_type, *out_type, options)) {
     *kernel = std::unique_ptr<UnaryKernel>(new ZeroCopyCast(std::move(out_type)));
     return Status::OK();
   }
@@ -1209,6 +1305,7 @@ Status GetCastFunction(const DataType& in_type, std::shared_ptr<DataType> out_ty
     CAST_FUNCTION_CASE(Time32Type);
     CAST_FUNCTION_CASE(Time64Type);
     CAST_FUNCTION_CASE(TimestampType);
+    CAST_FUNCTION_CASE(Decimal128Type);
     CAST_FUNCTION_CASE(BinaryType);
     CAST_FUNCTION_CASE(StringType);
     CAST_FUNCTION_CASE(DictionaryType);
@@ -1244,5 +1341,50 @@ Status Cast(FunctionContext* ctx, const Array& array, std::shared_ptr<DataType>
   return Status::OK();
 }
 
+Status Cast(FunctionContext* ctx, const Array& array, const CastOptions& options,
+            ArrayData* out) {
+  if (out->type == nullptr || !is_fixed_width(out->type->id())) {
+    return Status::Invalid("Preallocated cast output must have a fixed-width type");
+  }
+  const int64_t length = array.length();
+  const int bit_width = checked_cast<const FixedWidthType&>(*out->type).bit_width();
+  const int64_t values_size =
+      bit_width == 1 ? BitUtil::BytesForBits(length) : length * (bit_width / 8);
+  if (out->buffers.size() < 2 || out->buffers[1] == nullptr ||
+      !out->buffers[1]->is_mutable() || out->buffers[1]->size() < values_size) {
+    return Status::Invalid("Preallocated cast output needs a mutable values buffer of ",
+                           values_size, " bytes");
+  }
+
+  std::unique_ptr<UnaryKernel> func;
+  RETURN_NOT_OK(GetCastFunction(*array.type(), out->type, options, &func));
+
+  std::shared_ptr<Buffer> values = out->buffers[1];
+  Datum result(ArrayData::Make(out->type, length, {nullptr, values}));
+  RETURN_NOT_OK(func->Call(ctx, array.data(), &result));
+  RETURN_IF_ERROR(ctx);
+
+  const ArrayData& result_data = *result.array();
+  if (result_data.buffers[1] == values) {
+    *out = ArrayData(result_data);
+    return Status::OK();
+  }
+
+  // The kernel shared the input values, copy them into the caller's buffer
+  auto output = ArrayData::Make(out->type, length, {nullptr, values});
+  if (length > 0) {
+    const uint8_t* in_values = result_data.buffers[1]->data();
+    if (bit_width == 1) {
+      CopyBitmap(in_values, result_data.offset, length, values->mutable_data(), 0);
+    } else {
+      memcpy(values->mutable_data(), in_values + result_data.offset * (bit_width / 8),
+             values_size);
+    }
+  }
+  RETURN_NOT_OK(detail::PropagateNulls(ctx, result_data, output.get()));
+  *out = std::move(*output);
+  return Status::OK();
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -26,6 +26,7 @@
 namespace arrow {
 
 class Array;
+struct ArrayData;
 class DataType;
 
 namespace compute {
@@ -39,12 +40,14 @@ struct ARROW_EXPORT CastOptions {
       : allow_int_overflow(false),
         allow_time_truncate(false),
         allow_float_truncate(false),
+        allow_decimal_truncate(false),
         allow_invalid_utf8(false) {}
 
   explicit CastOptions(bool safe)
       : allow_int_overflow(!safe),
         allow_time_truncate(!safe),
         allow_float_truncate(!safe),
+        allow_decimal_truncate(!safe),
         allow_invalid_utf8(!safe) {}
 
   static CastOptions Safe() { return CastOptions(true); }
@@ -54,6 +57,9 @@ struct ARROW_EXPORT CastOptions {
   bool allow_int_overflow;
   bool allow_time_truncate;
   bool allow_float_truncate;
+  // Indicate if decimal rescaling may drop fractional digits and exceed the
+  // output precision.
+  bool allow_decimal_truncate;
   // Indicate if conversions from Binary/FixedSizeBinary to string must
   // validate the utf8 payload.
   bool allow_invalid_utf8;
@@ -92,6 +98,25 @@ ARROW_EXPORT
 Status Cast(FunctionContext* context, const Datum& value,
             std::shared_ptr<DataType> to_type, const CastOptions& options, Datum* out);
 
+/// \brief Cast an array into caller-allocated memory
+///
+/// out->type is the type to cast to and must be fixed-width.  out->buffers[1]
+/// must be a mutable buffer large enough for value.length() values; the
+/// values are written there even for casts that could otherwise share the
+/// input buffers.  The remaining fields of out are set as for the other
+/// overloads.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value array to cast
+/// \param[in] options casting options
+/// \param[in,out] out preallocated output
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Cast(FunctionContext* context, const Array& value, const CastOptions& options,
+            ArrayData* out);
+
 }  // namespace compute
 }  // namespace arrow
 
@@ -0,0 +1,277 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/decimal.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/test-util.h"
+
+using std::shared_ptr;
+using std::vector;
+
+using arrow::internal::checked_cast;
+
+namespace arrow {
+namespace compute {
+
+class TestCompare : public ComputeFixture, public ::testing::Test {
+ protected:
+  void AssertCompare(CompareOperator op, const shared_ptr<DataType>& type,
+                     const std::string& left, const std::string& right,
+                     const std::string& expected) {
+    Datum out;
+    ASSERT_OK(Compare(&ctx_, ArrayFromJSON(type, left), ArrayFromJSON(type, right),
+                      CompareOptions(op), &out));
+    ASSERT_EQ(out.kind(), Datum::ARRAY);
+    AssertArraysEqual(*ArrayFromJSON(boolean(), expected), *out.make_array());
+  }
+
+  void AssertCompareScalar(CompareOperator op, const shared_ptr<DataType>& type,
+                           const std::string& left, const shared_ptr<Scalar>& right,
+                           const std::string& expected) {
+    Datum out;
+    ASSERT_OK(Compare(&ctx_, ArrayFromJSON(type, left), Datum(right), CompareOptions(op),
+                      &out));
+    ASSERT_EQ(out.kind(), Datum::ARRAY);
+    AssertArraysEqual(*ArrayFromJSON(boolean(), expected), *out.make_array());
+  }
+};
+
+TEST_F(TestCompare, Integers) {
+  const char* left = "[1, 2, 3, null, 5, -1]";
+  const char* right = "[1, 3, 2, 4, null, -1]";
+  AssertCompare(CompareOperator::EQUAL, int32(), left, right,
+                "[true, false, false, null, null, true]");
+  AssertCompare(CompareOperator::NOT_EQUAL, int32(), left, right,
+                "[false, true, true, null, null, false]");
+  AssertCompare(CompareOperator::GREATER, int32(), left, right,
+                "[false, false, true, null, null, false]");
+  AssertCompare(CompareOperator::GREATER_EQUAL, int32(), left, right,
+                "[true, false, true, null, null, true]");
+  AssertCompare(CompareOperator::LESS, int32(), left, right,
+                "[false, true, false, null, null, false]");
+  AssertCompare(CompareOperator::LESS_EQUAL, int32(), left, right,
+                "[true, true, false, null, null, true]");
+
+  AssertCompare(CompareOperator::LESS, uint8(), "[0, 255]", "[255, 0]", "[true, false]");
+  AssertCompare(CompareOperator::LESS, int64(), "[]", "[]", "[]");
+}
+
+TEST_F(TestCompare, Floats) {
+  AssertCompare(CompareOperator::LESS, float64(), "[1.5, 2.5, null]", "[2.5, 1.5, 0]",
+                "[true, false, null]");
+  AssertCompare(CompareOperator::EQUAL, float32(), "[1.5, 2.5, 0]", "[1.5, 2.0, -0]",
+                "[true, false, true]");
+}
+
+TEST_F(TestCompare, Strings) {
+  const char* left = R"(["a", "ab", "", null, "b"])";
+  const char* right = R"(["a", "a", "a", "a", "ab"])";
+  AssertCompare(CompareOperator::EQUAL, utf8(), left, right,
+                "[true, false, false, null, false]");
+  AssertCompare(CompareOperator::GREATER, utf8(), left, right,
+                "[false, true, false, null, true]");
+  AssertCompare(CompareOperator::LESS_EQUAL, binary(), left, right,
+                "[true, false, true, null, false]");
+}
+
+TEST_F(TestCompare, Timestamps) {
+  auto type = timestamp(TimeUnit::SECOND);
+  AssertCompare(CompareOperator::GREATER_EQUAL, type, "[0, 10, 20]", "[10, 10, 10]",
+                "[false, true, true]");
+  AssertCompare(CompareOperator::NOT_EQUAL, date32(), "[0, 10]", "[0, 11]",
+                "[false, true]");
+}
+
+TEST_F(TestCompare, Decimals) {
+  auto type = decimal(38, 2);
+  // Values differing in the high word only, the low word only, and in sign
+  const char* left =
+      R"(["1.00", "-1.00", "184467440737095516.16", "-0.01", null, "12.34"])";
+  const char* right =
+      R"(["1.00", "1.00", "184467440737095516.15", "0.01", "0.00", "12.35"])";
+  AssertCompare(CompareOperator::EQUAL, type, left, right,
+                "[true, false, false, false, null, false]");
+  AssertCompare(CompareOperator::LESS, type, left, right,
+                "[false, true, false, true, null, true]");
+  AssertCompare(CompareOperator::GREATER_EQUAL, type, left, right,
+                "[true, false, true, false, null, false]");
+
+  auto scalar = std::make_shared<Decimal128Scalar>(Decimal128(1234), type);
+  AssertCompareScalar(CompareOperator::GREATER, type, left, scalar,
+                      "[false, false, true, false, null, false]");
+  AssertCompareScalar(CompareOperator::EQUAL, type, left, scalar,
+                      "[false, false, false, false, null, true]");
+}
+
+TEST_F(TestCompare, Scalar) {
+  const char* left = "[1, 2, 3, null]";
+  AssertCompareScalar(CompareOperator::GREATER, int64(), left,
+                      std::make_shared<Int64Scalar>(2), "[false, false, true, null]");
+  AssertCompareScalar(CompareOperator::LESS_EQUAL, int64(), left,
+                      std::make_shared<Int64Scalar>(2), "[true, true, false, null]");
+  // A null scalar compares null to every value
+  auto null_scalar = std::make_shared<Int64Scalar>(2, false);
+  AssertCompareScalar(CompareOperator::EQUAL, int64(), left, null_scalar,
+                      "[null, null, null, null]");
+
+  auto b = std::make_shared<StringScalar>(Buffer::FromString("b"));
+  AssertCompareScalar(CompareOperator::LESS, utf8(), R"(["a", "b", "c", null])", b,
+                      "[true, false, false, null]");
+
+  // A scalar left-hand side swaps the operands
+  Datum out;
+  ASSERT_OK(Compare(&ctx_, Datum(b), ArrayFromJSON(utf8(), R"(["a", "b", "c", null])"),
+                    CompareOptions(CompareOperator::LESS), &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, false, true, null]"),
+                    *out.make_array());
+  ASSERT_OK(Compare(&ctx_, Datum(b), ArrayFromJSON(utf8(), R"(["a", "b", "c", null])"),
+                    CompareOptions(CompareOperator::GREATER_EQUAL), &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, true, false, null]"),
+                    *out.make_array());
+  ASSERT_RAISES(Invalid, Compare(&ctx_, Datum(b), Datum(b),
+                                 CompareOptions(CompareOperator::EQUAL), &out));
+}
+
+TEST_F(TestCompare, Offsets) {
+  // Exercise the bit-packing tail and unaligned inputs
+  auto rand = random::RandomArrayGenerator(0xc0ffee);
+  const int64_t length = 1000;
+  auto left = rand.Int32(length, -5, 5, 0.1);
+  auto right = rand.Int32(length, -5, 5, 0.1);
+
+  for (int64_t offset : {0, 1, 7, 13}) {
+    const int64_t slice_length = length - offset - 3;
+    auto left_slice = left->Slice(offset, slice_length);
+    auto right_slice = right->Slice(3, slice_length);
+    Datum out;
+    ASSERT_OK(Compare(&ctx_, left_slice, right_slice,
+                      CompareOptions(CompareOperator::LESS), &out));
+    const auto result = out.make_array();
+    ASSERT_OK(ValidateArray(*result));
+    const auto& bools = checked_cast<const BooleanArray&>(*result);
+    const auto& l = checked_cast<const Int32Array&>(*left_slice);
+    const auto& r = checked_cast<const Int32Array&>(*right_slice);
+    ASSERT_EQ(bools.length(), slice_length);
+    for (int64_t i = 0; i < slice_length; ++i) {
+      const bool valid = l.IsValid(i) && r.IsValid(i);
+      ASSERT_EQ(bools.IsValid(i), valid) << i;
+      if (valid) {
+        ASSERT_EQ(bools.Value(i), l.Value(i) < r.Value(i)) << i;
+      }
+    }
+  }
+}
+
+TEST_F(TestCompare, ChunkedArrays) {
+  auto left = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(int32(), "[1, 2]"), ArrayFromJSON(int32(), "[3, 4, 5]")});
+  auto right = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(int32(), "[2, 2, 2]"), ArrayFromJSON(int32(), "[2, 9]")});
+  Datum out;
+  ASSERT_OK(Compare(&ctx_, left, right, CompareOptions(CompareOperator::GREATER), &out));
+  ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+  ChunkedArray expected(ArrayVector{ArrayFromJSON(boolean(), "[false, false]"),
+                                    ArrayFromJSON(boolean(), "[true]"),
+                                    ArrayFromJSON(boolean(), "[true, false]")});
+  ASSERT_TRUE(out.chunked_array()->Equals(expected));
+
+  ASSERT_OK(Compare(&ctx_, left, Datum(std::make_shared<Int32Scalar>(3)),
+                    CompareOptions(CompareOperator::EQUAL), &out));
+  ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+  ChunkedArray expected_scalar(
+      ArrayVector{ArrayFromJSON(boolean(), "[false, false]"),
+                  ArrayFromJSON(boolean(), "[true, false, false]")});
+  ASSERT_TRUE(out.chunked_array()->Equals(expected_scalar));
+}
+
+TEST_F(TestCompare, Dictionary) {
+  // The dictionary repeats "b" and holds a null
+  auto dict_type =
+      dictionary(int8(), ArrayFromJSON(utf8(), R"(["c", "a", "b", null, "b"])"));
+  auto left = std::make_shared<DictionaryArray>(
+      dict_type, ArrayFromJSON(int8(), "[0, 1, null, 2, 3, 4]"));
+  auto right = std::make_shared<DictionaryArray>(
+      dict_type, ArrayFromJSON(int8(), "[1, 1, 0, 4, 2, 2]"));
+  Datum out;
+  ASSERT_OK(Compare(&ctx_, left, right, CompareOptions(CompareOperator::EQUAL), &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, true, null, true, null, true]"),
+                    *out.make_array());
+  ASSERT_OK(Compare(&ctx_, left, right, CompareOptions(CompareOperator::GREATER), &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, false, null, false, null, false]"),
+                    *out.make_array());
+
+  auto b = std::make_shared<StringScalar>(Buffer::FromString("b"));
+  ASSERT_OK(Compare(&ctx_, left, Datum(b), CompareOptions(CompareOperator::LESS), &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, true, null, false, null, false]"),
+                    *out.make_array());
+
+  auto chunked =
+      std::make_shared<ChunkedArray>(ArrayVector{left->Slice(0, 2), left->Slice(2)});
+  ASSERT_OK(Compare(&ctx_, chunked, Datum(b), CompareOptions(CompareOperator::EQUAL),
+                    &out));
+  ChunkedArray expected(
+      ArrayVector{ArrayFromJSON(boolean(), "[false, false]"),
+                  ArrayFromJSON(boolean(), "[null, true, null, true]")});
+  ASSERT_TRUE(out.chunked_array()->Equals(expected));
+
+  // Floating-point dictionaries keep NaN semantics
+  std::shared_ptr<Array> doubles;
+  ArrayFromVector<DoubleType, double>({1.5, std::nan("")}, &doubles);
+  auto double_type = dictionary(int8(), doubles);
+  auto with_nan = std::make_shared<DictionaryArray>(double_type,
+                                                    ArrayFromJSON(int8(), "[0, 1]"));
+  ASSERT_OK(Compare(&ctx_, with_nan, with_nan, CompareOptions(CompareOperator::EQUAL),
+                    &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, false]"), *out.make_array());
+
+  ASSERT_RAISES(TypeError, Compare(&ctx_, left, Datum(std::make_shared<Int8Scalar>(1)),
+                                   CompareOptions(CompareOperator::EQUAL), &out));
+}
+
+TEST_F(TestCompare, Errors) {
+  Datum out;
+  auto ints = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_RAISES(TypeError, Compare(&ctx_, ints, ArrayFromJSON(int64(), "[1, 2]"),
+                                   CompareOptions(CompareOperator::EQUAL), &out));
+  ASSERT_RAISES(Invalid, Compare(&ctx_, ints, ArrayFromJSON(int32(), "[1]"),
+                                 CompareOptions(CompareOperator::EQUAL), &out));
+  auto lists = ArrayFromJSON(list(int32()), "[[1], [2]]");
+  ASSERT_RAISES(NotImplemented, Compare(&ctx_, lists, lists,
+                                        CompareOptions(CompareOperator::EQUAL), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
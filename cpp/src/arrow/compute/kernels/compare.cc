@@ -0,0 +1,498 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/compare.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/builder.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/sort.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+
+using internal::BitmapAnd;
+using internal::checked_cast;
+using internal::CopyBitmap;
+using internal::CountSetBits;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Comparison operators
+
+struct Equal {
+  template <typename T>
+  static bool Call(const T& left, const T& right) {
+    return left == right;
+  }
+};
+
+struct NotEqual {
+  template <typename T>
+  static bool Call(const T& left, const T& right) {
+    return left != right;
+  }
+};
+
+struct Greater {
+  template <typename T>
+  static bool Call(const T& left, const T& right) {
+    return left > right;
+  }
+};
+
+struct GreaterEqual {
+  template <typename T>
+  static bool Call(const T& left, const T& right) {
+    return left >= right;
+  }
+};
+
+struct Less {
+  template <typename T>
+  static bool Call(const T& left, const T& right) {
+    return left < right;
+  }
+};
+
+struct LessEqual {
+  template <typename T>
+  static bool Call(const T& left, const T& right) {
+    return left <= right;
+  }
+};
+
+// ----------------------------------------------------------------------
+// Access to the values to compare
+
+template <typename ArrowType, typename Enable = void>
+struct CompareTraits {};
+
+template <typename ArrowType>
+struct CompareTraits<ArrowType, enable_if_has_c_type<ArrowType>> {
+  using ValueType = typename ArrowType::c_type;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  class ArrayValues {
+   public:
+    explicit ArrayValues(const ArrayData& data)
+        : values_(data.GetValues<ValueType>(1)) {}
+
+    ValueType operator()(int64_t i) const { return values_[i]; }
+
+   private:
+    const ValueType* values_;
+  };
+
+  static ValueType ScalarValue(const Scalar& scalar) {
+    return checked_cast<const ScalarType&>(scalar).value;
+  }
+};
+
+template <typename ArrowType>
+struct CompareTraits<ArrowType, enable_if_binary<ArrowType>> {
+  using ValueType = util::string_view;
+
+  class ArrayValues {
+   public:
+    explicit ArrayValues(const ArrayData& data)
+        : offsets_(data.GetValues<int32_t>(1)),
+          data_(data.buffers[2] ? reinterpret_cast<const char*>(data.buffers[2]->data())
+                                : NULLPTR) {}
+
+    ValueType operator()(int64_t i) const {
+      return ValueType(data_ + offsets_[i], offsets_[i + 1] - offsets_[i]);
+    }
+
+   private:
+    const int32_t* offsets_;
+    const char* data_;
+  };
+
+  static ValueType ScalarValue(const Scalar& scalar) {
+    const auto& buffer = checked_cast<const BinaryScalar&>(scalar).value;
+    return ValueType(reinterpret_cast<const char*>(buffer->data()),
+                     static_cast<size_t>(buffer->size()));
+  }
+};
+
+// Decimals are compared as (high, low) word pairs with inline operators,
+// rather than through the out-of-line Decimal128 operators
+struct DecimalWords {
+  int64_t high;
+  uint64_t low;
+
+  bool operator==(const DecimalWords& other) const {
+    return high == other.high && low == other.low;
+  }
+  bool operator!=(const DecimalWords& other) const { return !(*this == other); }
+  bool operator<(const DecimalWords& other) const {
+    return high < other.high || (high == other.high && low < other.low);
+  }
+  bool operator>(const DecimalWords& other) const { return other < *this; }
+  bool operator<=(const DecimalWords& other) const { return !(other < *this); }
+  bool operator>=(const DecimalWords& other) const { return !(*this < other); }
+};
+
+template <>
+struct CompareTraits<Decimal128Type> {
+  using ValueType = DecimalWords;
+
+  class ArrayValues {
+   public:
+    explicit ArrayValues(const ArrayData& data)
+        : words_(reinterpret_cast<const uint64_t*>(
+              data.GetValues<uint8_t>(1, data.offset * 16))) {}
+
+    ValueType operator()(int64_t i) const {
+      return {static_cast<int64_t>(BitUtil::FromLittleEndian(words_[2 * i + 1])),
+              BitUtil::FromLittleEndian(words_[2 * i])};
+    }
+
+   private:
+    const uint64_t* words_;
+  };
+
+  static ValueType ScalarValue(const Scalar& scalar) {
+    const auto& value = checked_cast<const Decimal128Scalar&>(scalar).value;
+    return {value.high_bits(), value.low_bits()};
+  }
+};
+
+// Write the comparison results of `length` values as packed bits.
+// Results are assembled by bytes to let the compiler unroll and vectorize
+// the comparisons.
+template <typename Op, typename LeftValues, typename RightValues>
+void ComparePacked(int64_t length, LeftValues&& left, RightValues&& right,
+                   uint8_t* out) {
+  const int64_t nbytes = length / 8;
+  for (int64_t byte = 0; byte < nbytes; ++byte) {
+    const int64_t i = byte * 8;
+    uint8_t bits = 0;
+    for (int k = 0; k < 8; ++k) {
+      bits |= static_cast<uint8_t>(Op::Call(left(i + k), right(i + k)) << k);
+    }
+    out[byte] = bits;
+  }
+  if (length % 8 != 0) {
+    uint8_t bits = 0;
+    for (int64_t i = nbytes * 8; i < length; ++i) {
+      bits |= static_cast<uint8_t>(Op::Call(left(i), right(i)) << (i % 8));
+    }
+    out[nbytes] = bits;
+  }
+}
+
+// Type-erased comparison of values, ignoring validity
+class Comparator {
+ public:
+  virtual ~Comparator() = default;
+
+  virtual void Compare(const ArrayData& left, const ArrayData& right,
+                       uint8_t* out) const = 0;
+  virtual void Compare(const ArrayData& left, const Scalar& right,
+                       uint8_t* out) const = 0;
+};
+
+template <typename ArrowType, typename Op>
+class ComparatorImpl : public Comparator {
+  using Traits = CompareTraits<ArrowType>;
+  using ArrayValues = typename Traits::ArrayValues;
+  using ValueType = typename Traits::ValueType;
+
+ public:
+  void Compare(const ArrayData& left, const ArrayData& right,
+               uint8_t* out) const override {
+    ComparePacked<Op>(left.length, ArrayValues(left), ArrayValues(right), out);
+  }
+
+  void Compare(const ArrayData& left, const Scalar& right, uint8_t* out) const override {
+    const ValueType right_value = Traits::ScalarValue(right);
+    ComparePacked<Op>(left.length, ArrayValues(left),
+                      [&](int64_t) { return right_value; }, out);
+  }
+};
+
+template <typename ArrowType>
+std::unique_ptr<Comparator> MakeComparator(CompareOperator op) {
+  switch (op) {
+    case CompareOperator::EQUAL:
+      return std::unique_ptr<Comparator>(new ComparatorImpl<ArrowType, Equal>());
+    case CompareOperator::NOT_EQUAL:
+      return std::unique_ptr<Comparator>(new ComparatorImpl<ArrowType, NotEqual>());
+    case CompareOperator::GREATER:
+      return std::unique_ptr<Comparator>(new ComparatorImpl<ArrowType, Greater>());
+    case CompareOperator::GREATER_EQUAL:
+      return std::unique_ptr<Comparator>(new ComparatorImpl<ArrowType, GreaterEqual>());
+    case CompareOperator::LESS:
+      return std::unique_ptr<Comparator>(new ComparatorImpl<ArrowType, Less>());
+    case CompareOperator::LESS_EQUAL:
+      return std::unique_ptr<Comparator>(new ComparatorImpl<ArrowType, LessEqual>());
+  }
+  return nullptr;
+}
+
+Status MakeComparator(const DataType& type, CompareOperator op,
+                      std::unique_ptr<Comparator>* out) {
+#define COMPARATOR_CASE(T)        \
+  case T::type_id:                \
+    *out = MakeComparator<T>(op); \
+    return Status::OK();
+
+  switch (type.id()) {
+    COMPARATOR_CASE(UInt8Type);
+    COMPARATOR_CASE(Int8Type);
+    COMPARATOR_CASE(UInt16Type);
+    COMPARATOR_CASE(Int16Type);
+    COMPARATOR_CASE(UInt32Type);
+    COMPARATOR_CASE(Int32Type);
+    COMPARATOR_CASE(UInt64Type);
+    COMPARATOR_CASE(Int64Type);
+    COMPARATOR_CASE(FloatType);
+    COMPARATOR_CASE(DoubleType);
+    COMPARATOR_CASE(Date32Type);
+    COMPARATOR_CASE(Date64Type);
+    COMPARATOR_CASE(Time32Type);
+    COMPARATOR_CASE(Time64Type);
+    COMPARATOR_CASE(TimestampType);
+    COMPARATOR_CASE(BinaryType);
+    COMPARATOR_CASE(StringType);
+    COMPARATOR_CASE(Decimal128Type);
+    default:
+      break;
+  }
+
+#undef COMPARATOR_CASE
+
+  return Status::NotImplemented("Comparison of type ", type);
+}
+
+// ----------------------------------------------------------------------
+// Kernels
+
+// Allocate the boolean output, with validity from the given inputs
+// (right may be null)
+Status AllocateCompareOutput(FunctionContext* ctx, const ArrayData& left,
+                             const ArrayData* right, Datum* out) {
+  const int64_t length = left.length;
+  std::shared_ptr<Buffer> validity, data;
+  RETURN_NOT_OK(AllocateBitmap(ctx->memory_pool(), length, &data));
+
+  const bool left_nulls = left.GetNullCount() > 0;
+  const bool right_nulls = right != NULLPTR && right->GetNullCount() > 0;
+  if (left_nulls && right_nulls) {
+    RETURN_NOT_OK(BitmapAnd(ctx->memory_pool(), left.buffers[0]->data(), left.offset,
+                            right->buffers[0]->data(), right->offset, length, 0,
+                            &validity));
+  } else if (left_nulls) {
+    RETURN_NOT_OK(CopyBitmap(ctx->memory_pool(), left.buffers[0]->data(), left.offset,
+                             length, &validity));
+  } else if (right_nulls) {
+    RETURN_NOT_OK(CopyBitmap(ctx->memory_pool(), right->buffers[0]->data(),
+                             right->offset, length, &validity));
+  }
+  const int64_t null_count =
+      validity ? length - CountSetBits(validity->data(), 0, length) : 0;
+  out->value = ArrayData::Make(boolean(), length, {validity, data}, null_count);
+  return Status::OK();
+}
+
+class CompareKernel : public BinaryKernel {
+ public:
+  explicit CompareKernel(std::unique_ptr<Comparator> comparator)
+      : comparator_(std::move(comparator)) {}
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, left.kind());
+    const ArrayData& left_data = *left.array();
+    const int64_t length = left_data.length;
+    if (right.is_scalar()) {
+      return CallScalar(ctx, left_data, *right.scalar(), out);
+    }
+    DCHECK_EQ(Datum::ARRAY, right.kind());
+    const ArrayData& right_data = *right.array();
+
+    RETURN_NOT_OK(AllocateCompareOutput(ctx, left_data, &right_data, out));
+    if (length == 0) {
+      return Status::OK();
+    }
+    comparator_->Compare(left_data, right_data,
+                         out->array()->buffers[1]->mutable_data());
+    return Status::OK();
+  }
+
+  bool is_thread_safe() const override { return true; }
+
+  // Only on the right: Compare() swaps a scalar left-hand side
+  bool accepts_scalars() const override { return true; }
+
+ private:
+  Status CallScalar(FunctionContext* ctx, const ArrayData& left, const Scalar& right,
+                    Datum* out) {
+    const int64_t length = left.length;
+    if (!right.is_valid) {
+      // All results are null
+      std::shared_ptr<Buffer> validity, data;
+      RETURN_NOT_OK(AllocateEmptyBitmap(ctx->memory_pool(), length, &validity));
+      RETURN_NOT_OK(AllocateEmptyBitmap(ctx->memory_pool(), length, &data));
+      out->value = ArrayData::Make(boolean(), length, {validity, data}, length);
+      return Status::OK();
+    }
+
+    RETURN_NOT_OK(AllocateCompareOutput(ctx, left, NULLPTR, out));
+    if (length == 0) {
+      return Status::OK();
+    }
+    comparator_->Compare(left, right, out->array()->buffers[1]->mutable_data());
+    return Status::OK();
+  }
+
+  std::unique_ptr<Comparator> comparator_;
+};
+
+// The operator giving the same result with its operands swapped
+CompareOperator SwapOperands(CompareOperator op) {
+  switch (op) {
+    case CompareOperator::GREATER:
+      return CompareOperator::LESS;
+    case CompareOperator::GREATER_EQUAL:
+      return CompareOperator::LESS_EQUAL;
+    case CompareOperator::LESS:
+      return CompareOperator::GREATER;
+    case CompareOperator::LESS_EQUAL:
+      return CompareOperator::GREATER_EQUAL;
+    default:
+      return op;
+  }
+}
+
+// ----------------------------------------------------------------------
+// Dictionary-encoded inputs
+
+// The dense rank of each dictionary entry, equal values sharing a rank, so
+// that comparing ranks is the same as comparing values (except for NaNs)
+Status DictionaryRanks(FunctionContext* ctx, const std::shared_ptr<Array>& dictionary,
+                       std::shared_ptr<Array>* out) {
+  std::shared_ptr<Array> uniques;
+  RETURN_NOT_OK(Unique(ctx, dictionary, &uniques));
+  Datum unique_ids, order;
+  RETURN_NOT_OK(Match(ctx, dictionary, uniques, &unique_ids));
+  RETURN_NOT_OK(SortToIndices(ctx, uniques, &order));
+
+  const uint64_t* order_values = order.array()->GetValues<uint64_t>(1);
+  std::vector<int32_t> unique_ranks(uniques->length());
+  for (int32_t rank = 0; rank < static_cast<int32_t>(unique_ranks.size()); ++rank) {
+    unique_ranks[order_values[rank]] = rank;
+  }
+  Int32Builder builder(ctx->memory_pool());
+  RETURN_NOT_OK(builder.AppendValues(unique_ranks));
+  std::shared_ptr<Array> unique_ranks_array;
+  RETURN_NOT_OK(builder.Finish(&unique_ranks_array));
+
+  Datum ranks;
+  RETURN_NOT_OK(Take(ctx, unique_ranks_array, unique_ids, &ranks));
+  *out = ranks.make_array();
+  return Status::OK();
+}
+
+// Against a scalar, the dictionary is compared once and the results gathered
+// by index.  Between arrays sharing a dictionary, the indices are mapped to
+// ranks of the dictionary values, and the ranks are compared.
+Status CompareDictionary(FunctionContext* ctx, const Datum& left, const Datum& right,
+                         CompareOptions options, Datum* out) {
+  const auto& dict_type = checked_cast<const DictionaryType&>(*left.type());
+  const auto dictionary = dict_type.dictionary();
+  if (right.is_scalar()) {
+    if (!dictionary->type()->Equals(*right.type())) {
+      return Status::TypeError("Cannot compare values of type ", *left.type(), " and ",
+                               *right.type());
+    }
+    Datum dictionary_result;
+    RETURN_NOT_OK(Compare(ctx, dictionary, right, options, &dictionary_result));
+    return Take(ctx, dictionary_result, detail::DictionaryIndices(left), out);
+  }
+
+  if (!left.type()->Equals(*right.type())) {
+    return Status::TypeError("Cannot compare values of type ", *left.type(), " and ",
+                             *right.type());
+  }
+  if (is_floating(dictionary->type()->id())) {
+    // NaNs are unordered, so ranks cannot stand in for the values
+    Datum left_values, right_values;
+    RETURN_NOT_OK(Cast(ctx, left, dictionary->type(), CastOptions(), &left_values));
+    RETURN_NOT_OK(Cast(ctx, right, dictionary->type(), CastOptions(), &right_values));
+    return Compare(ctx, left_values, right_values, options, out);
+  }
+  std::shared_ptr<Array> ranks;
+  RETURN_NOT_OK(DictionaryRanks(ctx, dictionary, &ranks));
+  Datum left_ranks, right_ranks;
+  RETURN_NOT_OK(Take(ctx, ranks, detail::DictionaryIndices(left), &left_ranks));
+  RETURN_NOT_OK(Take(ctx, ranks, detail::DictionaryIndices(right), &right_ranks));
+  return Compare(ctx, left_ranks, right_ranks, options, out);
+}
+
+}  // namespace
+
+Status Compare(FunctionContext* ctx, const Datum& left, const Datum& right,
+               CompareOptions options, Datum* out) {
+  if (left.is_scalar() && right.is_arraylike()) {
+    // Compare the array-like values to the scalar instead
+    return Compare(ctx, right, left, CompareOptions(SwapOperands(options.op)), out);
+  }
+  if (!left.is_arraylike()) {
+    return Status::Invalid("Left input of comparison must be array-like");
+  }
+  if (!right.is_arraylike() && !right.is_scalar()) {
+    return Status::Invalid("Right input of comparison must be array-like or scalar");
+  }
+  if (left.type()->id() == Type::DICTIONARY) {
+    return CompareDictionary(ctx, left, right, options, out);
+  }
+  if (!left.type()->Equals(*right.type())) {
+    return Status::TypeError("Cannot compare values of type ", *left.type(), " and ",
+                             *right.type());
+  }
+
+  std::unique_ptr<Comparator> comparator;
+  RETURN_NOT_OK(MakeComparator(*left.type(), options.op, &comparator));
+
+  CompareKernel kernel(std::move(comparator));
+  return detail::InvokeBinaryArrayKernel(ctx, &kernel, left, right, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
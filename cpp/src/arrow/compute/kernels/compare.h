@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_COMPARE_H
+#define ARROW_COMPUTE_KERNELS_COMPARE_H
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+enum class CompareOperator {
+  EQUAL,
+  NOT_EQUAL,
+  GREATER,
+  GREATER_EQUAL,
+  LESS,
+  LESS_EQUAL,
+};
+
+struct ARROW_EXPORT CompareOptions {
+  explicit CompareOptions(CompareOperator op) : op(op) {}
+
+  CompareOperator op;
+};
+
+/// \brief Compare values element-wise
+///
+/// `left` and `right` may be array-like, with the same length, or one of
+/// them a scalar compared to every element of the other.  Both must
+/// have the same numeric, temporal, decimal, binary or string type.  The
+/// result is a boolean array-like value, null where either input is null.
+///
+/// Dictionary-encoded values are compared without decoding them, either to
+/// a scalar of their value type, or to array-like values with the same
+/// dictionary type.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left array-like or scalar left-hand side
+/// \param[in] right array-like or scalar right-hand side
+/// \param[in] options comparison options (e.g. the operator)
+/// \param[out] out resulting boolean datum
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
+               CompareOptions options, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_COMPARE_H
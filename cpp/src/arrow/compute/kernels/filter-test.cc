@@ -0,0 +1,276 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/testing/util.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/compare.h"
+#include "arrow/compute/kernels/filter.h"
+#include "arrow/compute/test-util.h"
+
+using std::shared_ptr;
+using std::vector;
+
+using arrow::internal::checked_cast;
+
+namespace arrow {
+namespace compute {
+
+class TestFilter : public ComputeFixture, public ::testing::Test {
+ protected:
+  void AssertFilter(const shared_ptr<DataType>& type, const std::string& values,
+                    const std::string& filter, const std::string& expected) {
+    Datum out;
+    ASSERT_OK(Filter(&ctx_, ArrayFromJSON(type, values), ArrayFromJSON(boolean(), filter),
+                     &out));
+    ASSERT_EQ(out.kind(), Datum::ARRAY);
+    const auto result = out.make_array();
+    ASSERT_OK(ValidateArray(*result));
+    AssertArraysEqual(*ArrayFromJSON(type, expected), *result);
+  }
+};
+
+TEST_F(TestFilter, Primitive) {
+  AssertFilter(int32(), "[1, 2, 3, null, 5]", "[true, false, true, true, null]",
+               "[1, 3, null]");
+  AssertFilter(float64(), "[1.5, 2.5]", "[false, false]", "[]");
+  AssertFilter(timestamp(TimeUnit::MILLI), "[1, 2, 3]", "[false, true, true]", "[2, 3]");
+}
+
+TEST_F(TestFilter, Empty) {
+  auto values = ArrayFromJSON(int8(), "[]");
+  Datum out;
+  ASSERT_OK(Filter(&ctx_, values, ArrayFromJSON(boolean(), "[]"), &out));
+  AssertArraysEqual(*values, *out.make_array());
+}
+
+TEST_F(TestFilter, AllSelected) {
+  auto values = ArrayFromJSON(int64(), "[1, 2, null]");
+  Datum out;
+  ASSERT_OK(Filter(&ctx_, values, ArrayFromJSON(boolean(), "[true, true, true]"), &out));
+  // The input is returned without copying
+  ASSERT_EQ(out.array()->buffers[1].get(), values->data()->buffers[1].get());
+  AssertArraysEqual(*values, *out.make_array());
+}
+
+TEST_F(TestFilter, Boolean) {
+  AssertFilter(boolean(), "[true, false, null, true, false]",
+               "[true, true, true, false, true]", "[true, false, null, false]");
+}
+
+TEST_F(TestFilter, Null) {
+  AssertFilter(null(), "[null, null, null]", "[true, false, true]", "[null, null]");
+}
+
+TEST_F(TestFilter, Strings) {
+  AssertFilter(utf8(), R"(["a", "bc", null, "", "def"])",
+               "[true, false, true, true, true]", R"(["a", null, "", "def"])");
+  AssertFilter(binary(), R"(["a", "bc"])", "[false, true]", R"(["bc"])");
+}
+
+TEST_F(TestFilter, List) {
+  AssertFilter(list(int32()), "[[1, 2], null, [], [3], [4, null]]",
+               "[false, true, true, true, null]", "[null, [], [3]]");
+  AssertFilter(list(utf8()), R"([["a"], ["b", "c"], ["d"]])", "[true, false, true]",
+               R"([["a"], ["d"]])");
+}
+
+TEST_F(TestFilter, Struct) {
+  auto type = struct_({field("a", int32()), field("b", utf8())});
+  AssertFilter(type, R"([{"a": 1, "b": "x"}, null, {"a": null, "b": "z"}])",
+               "[true, true, false]", R"([{"a": 1, "b": "x"}, null])");
+}
+
+TEST_F(TestFilter, Random) {
+  // Exercise word-at-a-time selection with varying densities and offsets
+  auto rand = random::RandomArrayGenerator(0xf11e7);
+  const int64_t length = 2000;
+  auto values = rand.Int16(length, -100, 100, 0.1);
+  for (double probability : {0.0, 0.05, 0.5, 0.95, 1.0}) {
+    auto filter = rand.Boolean(length, probability, 0.1);
+    for (int64_t offset : {0, 3, 64}) {
+      auto values_slice = values->Slice(offset, length - 70);
+      auto filter_slice = filter->Slice(70 - offset, length - 70);
+      Datum out;
+      ASSERT_OK(Filter(&ctx_, values_slice, filter_slice, &out));
+      const auto result = out.make_array();
+      ASSERT_OK(ValidateArray(*result));
+
+      Int16Builder builder;
+      const auto& v = checked_cast<const Int16Array&>(*values_slice);
+      const auto& f = checked_cast<const BooleanArray&>(*filter_slice);
+      for (int64_t i = 0; i < v.length(); ++i) {
+        if (f.IsValid(i) && f.Value(i)) {
+          if (v.IsValid(i)) {
+            ASSERT_OK(builder.Append(v.Value(i)));
+          } else {
+            ASSERT_OK(builder.AppendNull());
+          }
+        }
+      }
+      shared_ptr<Array> expected;
+      ASSERT_OK(builder.Finish(&expected));
+      AssertArraysEqual(*expected, *result);
+    }
+  }
+}
+
+TEST_F(TestFilter, ChunkedArrays) {
+  auto values = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(int32(), "[1, 2, 3]"), ArrayFromJSON(int32(), "[4, 5]")});
+  Datum mask;
+  ASSERT_OK(Compare(&ctx_, values, Datum(std::make_shared<Int32Scalar>(2)),
+                    CompareOptions(CompareOperator::GREATER), &mask));
+  Datum out;
+  ASSERT_OK(Filter(&ctx_, values, mask, &out));
+  ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+  ChunkedArray expected(ArrayVector{ArrayFromJSON(int32(), "[3]"),
+                                    ArrayFromJSON(int32(), "[4, 5]")});
+  ASSERT_TRUE(out.chunked_array()->Equals(expected));
+}
+
+TEST_F(TestFilter, Errors) {
+  Datum out;
+  auto values = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_RAISES(TypeError, Filter(&ctx_, values, values, &out));
+  ASSERT_RAISES(Invalid,
+                Filter(&ctx_, values, ArrayFromJSON(boolean(), "[true]"), &out));
+}
+
+TEST_F(TestFilter, ToIndices) {
+  auto filter = ArrayFromJSON(boolean(), "[true, false, null, true, true, false]");
+  for (auto type : {uint16(), int32(), uint32(), int64(), uint64()}) {
+    Datum out;
+    ASSERT_OK(FilterToIndices(&ctx_, filter, type, &out));
+    AssertArraysEqual(*ArrayFromJSON(type, "[0, 3, 4]"), *out.make_array());
+
+    ASSERT_OK(FilterToIndices(&ctx_, filter->Slice(1), type, &out));
+    AssertArraysEqual(*ArrayFromJSON(type, "[2, 3]"), *out.make_array());
+
+    // Positions are counted across chunks
+    auto chunked = std::make_shared<ChunkedArray>(
+        ArrayVector{ArrayFromJSON(boolean(), "[false, true]"), filter});
+    ASSERT_OK(FilterToIndices(&ctx_, chunked, type, &out));
+    AssertArraysEqual(*ArrayFromJSON(type, "[1, 2, 5, 6]"), *out.make_array());
+  }
+
+  // The selected positions must fit in the index type
+  std::vector<bool> selected(70002, false);
+  selected[70000] = true;
+  BooleanBuilder builder;
+  ASSERT_OK(builder.AppendValues(selected));
+  std::shared_ptr<Array> sparse;
+  ASSERT_OK(builder.Finish(&sparse));
+  Datum out;
+  ASSERT_RAISES(Invalid, FilterToIndices(&ctx_, sparse, uint16(), &out));
+  ASSERT_OK(FilterToIndices(&ctx_, sparse, int32(), &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[70000]"), *out.make_array());
+  ASSERT_OK(FilterToIndices(&ctx_, sparse->Slice(10000), uint16(), &out));
+  AssertArraysEqual(*ArrayFromJSON(uint16(), "[60000]"), *out.make_array());
+
+  ASSERT_RAISES(TypeError,
+                FilterToIndices(&ctx_, ArrayFromJSON(int32(), "[1]"), int32(), &out));
+  ASSERT_RAISES(TypeError, FilterToIndices(&ctx_, filter, int8(), &out));
+}
+
+TEST_F(TestFilter, RecordBatchReader) {
+  auto schema = ::arrow::schema({field("a", int32()), field("b", utf8())});
+  std::vector<std::shared_ptr<RecordBatch>> batches = {
+      RecordBatch::Make(schema, 4,
+                        {ArrayFromJSON(int32(), "[1, 5, null, 7]"),
+                         ArrayFromJSON(utf8(), R"(["a", "b", "c", "d"])")}),
+      RecordBatch::Make(schema, 2,
+                        {ArrayFromJSON(int32(), "[0, 2]"),
+                         ArrayFromJSON(utf8(), R"(["e", null])")}),
+      RecordBatch::Make(schema, 3,
+                        {ArrayFromJSON(int32(), "[3, 4, 9]"),
+                         ArrayFromJSON(utf8(), R"(["f", "g", "h"])")})};
+  auto source = std::make_shared<BatchIterator>(schema, batches);
+
+  // Keep rows where a > 2; the second batch is dropped entirely
+  auto predicate = [this](const RecordBatch& batch, Datum* selection) {
+    return Compare(&ctx_, Datum(batch.column(0)),
+                   Datum(std::make_shared<Int32Scalar>(2)),
+                   CompareOptions(CompareOperator::GREATER), selection);
+  };
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(FilterRecordBatchReader(&ctx_, source, predicate, &reader));
+  ASSERT_TRUE(reader->schema()->Equals(*schema));
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_OK(batch->Validate());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[5, 7]"), *batch->column(0));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["b", "d"])"), *batch->column(1));
+  ASSERT_OK(reader->ReadNext(&batch));
+  // All rows selected, so the batch is passed through
+  ASSERT_EQ(batches[2], batch);
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+
+  // Positions to keep, as produced by a Gandiva selection vector
+  source = std::make_shared<BatchIterator>(schema, batches);
+  auto positions = [](const RecordBatch& batch, Datum* selection) {
+    *selection = ArrayFromJSON(uint16(), batch.num_rows() > 2 ? "[0, 2]" : "[]");
+    return Status::OK();
+  };
+  ASSERT_OK(FilterRecordBatchReader(&ctx_, source, positions, &reader));
+  ASSERT_OK(reader->ReadNext(&batch));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, null]"), *batch->column(0));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "c"])"), *batch->column(1));
+  ASSERT_OK(reader->ReadNext(&batch));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[3, 9]"), *batch->column(0));
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+
+  // A mask of the wrong length
+  source = std::make_shared<BatchIterator>(schema, batches);
+  auto short_mask = [](const RecordBatch&, Datum* selection) {
+    *selection = ArrayFromJSON(boolean(), "[true]");
+    return Status::OK();
+  };
+  ASSERT_OK(FilterRecordBatchReader(&ctx_, source, short_mask, &reader));
+  ASSERT_RAISES(Invalid, reader->ReadNext(&batch));
+
+  // A selection which is neither a mask nor positions
+  source = std::make_shared<BatchIterator>(schema, batches);
+  auto floats = [](const RecordBatch&, Datum* selection) {
+    *selection = ArrayFromJSON(float64(), "[1.5]");
+    return Status::OK();
+  };
+  ASSERT_OK(FilterRecordBatchReader(&ctx_, source, floats, &reader));
+  ASSERT_RAISES(TypeError, reader->ReadNext(&batch));
+}
+
+}  // namespace compute
+}  // namespace arrow
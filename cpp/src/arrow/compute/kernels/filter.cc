@@ -0,0 +1,550 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/filter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::BitmapAnd;
+using internal::checked_cast;
+using internal::CopyBitmap;
+using internal::CountSetBits;
+
+namespace compute {
+
+namespace {
+
+// The positions to select, as a bitmap
+struct Selection {
+  const uint8_t* bitmap;
+  int64_t offset;
+  int64_t length;
+  // The number of selected positions
+  int64_t count;
+
+  // Call visit_run(position, length) for each run of selected positions.
+  // Runs spanning full 64-bit words are coalesced.
+  template <typename VisitRun>
+  void VisitRuns(VisitRun&& visit_run) const {
+    detail::VisitValidityWords(
+        bitmap, offset, length, visit_run, [&](int64_t position, int64_t, uint64_t word) {
+          while (word != 0) {
+            const int start = BitUtil::CountTrailingZeros(word);
+            // Length of the run of set bits beginning at `start`
+            const uint64_t rest = ~(word >> start);
+            const int run_length =
+                rest == 0 ? 64 - start : BitUtil::CountTrailingZeros(rest);
+            visit_run(position + start, run_length);
+            if (start + run_length == 64) {
+              break;
+            }
+            word &= ~static_cast<uint64_t>(0) << (start + run_length);
+          }
+        });
+  }
+};
+
+// Copy the selected bits of a bitmap to a zero-initialized bitmap
+void FilterBits(const uint8_t* in, int64_t in_offset, const Selection& selection,
+                uint8_t* out) {
+  int64_t out_position = 0;
+  selection.VisitRuns([&](int64_t position, int64_t run_length) {
+    CopyBitmap(in, in_offset + position, run_length, out, out_position);
+    out_position += run_length;
+  });
+}
+
+// Copy the selected values of a fixed-width buffer
+template <int64_t kByteWidth>
+void FilterFixedWidthValues(const uint8_t* in, int64_t byte_width,
+                            const Selection& selection, uint8_t* out) {
+  // Use a compile-time width if possible, so that small copies are inlined
+  const int64_t width = kByteWidth > 0 ? kByteWidth : byte_width;
+  selection.VisitRuns([&](int64_t position, int64_t run_length) {
+    if (run_length == 1) {
+      std::memcpy(out, in + position * width, static_cast<size_t>(width));
+    } else {
+      std::memcpy(out, in + position * width, static_cast<size_t>(run_length * width));
+    }
+    out += run_length * width;
+  });
+}
+
+Status FilterArrayData(MemoryPool* pool, const std::shared_ptr<ArrayData>& values,
+                       const Selection& selection, std::shared_ptr<ArrayData>* out);
+
+class FilterVisitor {
+ public:
+  FilterVisitor(MemoryPool* pool, const std::shared_ptr<ArrayData>& values,
+                const Selection& selection)
+      : pool_(pool), values_(values), selection_(selection) {}
+
+  Status Visit(const NullType&) {
+    *out() = ArrayData::Make(null(), selection_.count, {nullptr}, selection_.count);
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    std::shared_ptr<Buffer> null_bitmap, data;
+    int64_t null_count;
+    RETURN_NOT_OK(FilterNullBitmap(&null_bitmap, &null_count));
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool_, selection_.count, &data));
+    if (selection_.count > 0) {
+      FilterBits(values_->buffers[1]->data(), values_->offset, selection_,
+                 data->mutable_data());
+    }
+    *out() = ArrayData::Make(values_->type, selection_.count, {null_bitmap, data},
+                             null_count);
+    return Status::OK();
+  }
+
+  Status Visit(const FixedWidthType& type) {
+    if (type.bit_width() % 8 != 0) {
+      return Status::NotImplemented("Filter of type ", type);
+    }
+    const int64_t byte_width = type.bit_width() / 8;
+    std::shared_ptr<Buffer> null_bitmap, data;
+    int64_t null_count;
+    RETURN_NOT_OK(FilterNullBitmap(&null_bitmap, &null_count));
+    RETURN_NOT_OK(AllocateBuffer(pool_, selection_.count * byte_width, &data));
+    if (selection_.count > 0) {
+      const uint8_t* in = values_->buffers[1]->data() + values_->offset * byte_width;
+      uint8_t* out_data = data->mutable_data();
+      switch (byte_width) {
+        case 1:
+          FilterFixedWidthValues<1>(in, byte_width, selection_, out_data);
+          break;
+        case 2:
+          FilterFixedWidthValues<2>(in, byte_width, selection_, out_data);
+          break;
+        case 4:
+          FilterFixedWidthValues<4>(in, byte_width, selection_, out_data);
+          break;
+        case 8:
+          FilterFixedWidthValues<8>(in, byte_width, selection_, out_data);
+          break;
+        case 16:
+          FilterFixedWidthValues<16>(in, byte_width, selection_, out_data);
+          break;
+        default:
+          FilterFixedWidthValues<0>(in, byte_width, selection_, out_data);
+      }
+    }
+    *out() = ArrayData::Make(values_->type, selection_.count, {null_bitmap, data},
+                             null_count);
+    return Status::OK();
+  }
+
+  Status Visit(const BinaryType&) {
+    std::shared_ptr<Buffer> null_bitmap, offsets, data;
+    int64_t null_count;
+    RETURN_NOT_OK(FilterNullBitmap(&null_bitmap, &null_count));
+    RETURN_NOT_OK(FilterOffsets(&offsets));
+    const int32_t* in_offsets = values_->GetValues<int32_t>(1);
+    const int32_t* out_offsets = reinterpret_cast<const int32_t*>(offsets->data());
+
+    RETURN_NOT_OK(AllocateBuffer(pool_, out_offsets[selection_.count], &data));
+    if (out_offsets[selection_.count] > 0) {
+      const uint8_t* in_data = values_->buffers[2]->data();
+      uint8_t* out_data = data->mutable_data();
+      selection_.VisitRuns([&](int64_t position, int64_t run_length) {
+        const int32_t start = in_offsets[position];
+        const int32_t nbytes = in_offsets[position + run_length] - start;
+        std::memcpy(out_data, in_data + start, nbytes);
+        out_data += nbytes;
+      });
+    }
+    *out() = ArrayData::Make(values_->type, selection_.count,
+                             {null_bitmap, offsets, data}, null_count);
+    return Status::OK();
+  }
+
+  Status Visit(const ListType&) {
+    std::shared_ptr<Buffer> null_bitmap, offsets, child_bitmap;
+    int64_t null_count;
+    RETURN_NOT_OK(FilterNullBitmap(&null_bitmap, &null_count));
+    RETURN_NOT_OK(FilterOffsets(&offsets));
+
+    // Select the child values of the selected lists
+    const auto& child = values_->child_data[0];
+    const int32_t* in_offsets = values_->GetValues<int32_t>(1);
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool_, child->length, &child_bitmap));
+    selection_.VisitRuns([&](int64_t position, int64_t run_length) {
+      const int32_t start = in_offsets[position];
+      BitUtil::SetBitsTo(child_bitmap->mutable_data(), start,
+                         in_offsets[position + run_length] - start, true);
+    });
+    const int32_t* out_offsets = reinterpret_cast<const int32_t*>(offsets->data());
+    Selection child_selection = {child_bitmap->data(), 0, child->length,
+                                 out_offsets[selection_.count]};
+    std::shared_ptr<ArrayData> out_child;
+    RETURN_NOT_OK(FilterArrayData(pool_, child, child_selection, &out_child));
+
+    *out() = ArrayData::Make(values_->type, selection_.count, {null_bitmap, offsets},
+                             null_count);
+    (*out())->child_data = {out_child};
+    return Status::OK();
+  }
+
+  Status Visit(const StructType& type) {
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_count;
+    RETURN_NOT_OK(FilterNullBitmap(&null_bitmap, &null_count));
+
+    StructArray array(values_);
+    std::vector<std::shared_ptr<ArrayData>> out_children(type.num_children());
+    for (int i = 0; i < type.num_children(); ++i) {
+      RETURN_NOT_OK(
+          FilterArrayData(pool_, array.field(i)->data(), selection_, &out_children[i]));
+    }
+    *out() = ArrayData::Make(values_->type, selection_.count, {null_bitmap}, null_count);
+    (*out())->child_data = std::move(out_children);
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Filter of type ", type);
+  }
+
+  std::shared_ptr<ArrayData>* out() { return &out_; }
+
+ private:
+  Status FilterNullBitmap(std::shared_ptr<Buffer>* out, int64_t* null_count) {
+    if (values_->GetNullCount() == 0) {
+      *null_count = 0;
+      return Status::OK();
+    }
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool_, selection_.count, out));
+    FilterBits(values_->buffers[0]->data(), values_->offset, selection_,
+               (*out)->mutable_data());
+    *null_count = selection_.count - CountSetBits((*out)->data(), 0, selection_.count);
+    return Status::OK();
+  }
+
+  // Compute the offsets of the selected variable-size values
+  Status FilterOffsets(std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(AllocateBuffer(pool_, (selection_.count + 1) * sizeof(int32_t), out));
+    int32_t* out_offsets = reinterpret_cast<int32_t*>((*out)->mutable_data());
+    out_offsets[0] = 0;
+    if (selection_.count == 0) {
+      return Status::OK();
+    }
+    const int32_t* in_offsets = values_->GetValues<int32_t>(1);
+    selection_.VisitRuns([&](int64_t position, int64_t run_length) {
+      const int32_t base = out_offsets[0] - in_offsets[position];
+      for (int64_t i = 1; i <= run_length; ++i) {
+        out_offsets[i] = base + in_offsets[position + i];
+      }
+      out_offsets += run_length;
+    });
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  const std::shared_ptr<ArrayData>& values_;
+  const Selection& selection_;
+  std::shared_ptr<ArrayData> out_;
+};
+
+Status FilterArrayData(MemoryPool* pool, const std::shared_ptr<ArrayData>& values,
+                       const Selection& selection, std::shared_ptr<ArrayData>* out) {
+  DCHECK_EQ(values->length, selection.length);
+  if (selection.count == selection.length) {
+    // Everything is selected
+    *out = values;
+    return Status::OK();
+  }
+  FilterVisitor visitor(pool, values, selection);
+  RETURN_NOT_OK(VisitTypeInline(*values->type, &visitor));
+  *out = std::move(*visitor.out());
+  return Status::OK();
+}
+
+// Select the true slots of a boolean filter.  Null filter slots are not
+// selected; `selection_bitmap` keeps the bitmap alive if one is computed.
+Status MakeSelection(MemoryPool* pool, const ArrayData& filter_data,
+                     Selection* selection, std::shared_ptr<Buffer>* selection_bitmap) {
+  const int64_t length = filter_data.length;
+  *selection = {nullptr, 0, length, 0};
+  if (length == 0) {
+    return Status::OK();
+  }
+  if (filter_data.GetNullCount() > 0) {
+    RETURN_NOT_OK(BitmapAnd(pool, filter_data.buffers[0]->data(), filter_data.offset,
+                            filter_data.buffers[1]->data(), filter_data.offset, length,
+                            0, selection_bitmap));
+    selection->bitmap = (*selection_bitmap)->data();
+  } else {
+    selection->bitmap = filter_data.buffers[1]->data();
+    selection->offset = filter_data.offset;
+  }
+  selection->count = CountSetBits(selection->bitmap, selection->offset, length);
+  return Status::OK();
+}
+
+class FilterKernel : public BinaryKernel {
+ public:
+  Status Call(FunctionContext* ctx, const Datum& values, const Datum& filter,
+              Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, values.kind());
+    DCHECK_EQ(Datum::ARRAY, filter.kind());
+    Selection selection;
+    std::shared_ptr<Buffer> selection_bitmap;
+    RETURN_NOT_OK(MakeSelection(ctx->memory_pool(), *filter.array(), &selection,
+                                &selection_bitmap));
+
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(
+        FilterArrayData(ctx->memory_pool(), values.array(), selection, &result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  bool is_thread_safe() const override { return true; }
+};
+
+// Write the selected positions of consecutive filter chunks
+template <typename IndexType>
+void WriteSelectedIndices(const std::vector<Selection>& selections, IndexType* out) {
+  int64_t base = 0;
+  for (const Selection& selection : selections) {
+    const int64_t count = internal::BitmapToIndices(selection.bitmap, selection.offset,
+                                                    selection.length, out);
+    if (base > 0) {
+      for (int64_t i = 0; i < count; ++i) {
+        out[i] = static_cast<IndexType>(out[i] + base);
+      }
+    }
+    out += count;
+    base += selection.length;
+  }
+}
+
+}  // namespace
+
+Status FilterToIndices(FunctionContext* ctx, const Datum& filter,
+                       const std::shared_ptr<DataType>& index_type, Datum* out) {
+  if (!filter.is_arraylike()) {
+    return Status::Invalid("Filter must be array-like");
+  }
+  if (filter.type()->id() != Type::BOOL) {
+    return Status::TypeError("Filter must be boolean, got ", *filter.type());
+  }
+  uint64_t max_index;
+  switch (index_type->id()) {
+    case Type::UINT16:
+      max_index = std::numeric_limits<uint16_t>::max();
+      break;
+    case Type::INT32:
+      max_index = std::numeric_limits<int32_t>::max();
+      break;
+    case Type::UINT32:
+      max_index = std::numeric_limits<uint32_t>::max();
+      break;
+    case Type::INT64:
+      max_index = std::numeric_limits<int64_t>::max();
+      break;
+    case Type::UINT64:
+      max_index = std::numeric_limits<uint64_t>::max();
+      break;
+    default:
+      return Status::TypeError("Filter indices must be uint16, int32, uint32, ",
+                               "int64 or uint64, got ", *index_type);
+  }
+
+  std::vector<std::shared_ptr<ArrayData>> chunks;
+  if (filter.kind() == Datum::ARRAY) {
+    chunks.push_back(filter.array());
+  } else {
+    for (const auto& chunk : filter.chunked_array()->chunks()) {
+      chunks.push_back(chunk->data());
+    }
+  }
+
+  MemoryPool* pool = ctx->memory_pool();
+  std::vector<Selection> selections(chunks.size());
+  std::vector<std::shared_ptr<Buffer>> selection_bitmaps(chunks.size());
+  int64_t count = 0;
+  int64_t base = 0;
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    Selection& selection = selections[i];
+    RETURN_NOT_OK(MakeSelection(pool, *chunks[i], &selection, &selection_bitmaps[i]));
+    // Selected positions past the index range cannot be represented
+    const int64_t end = base + selection.length;
+    if (selection.count > 0 && static_cast<uint64_t>(end - 1) > max_index) {
+      const int64_t start =
+          std::max<int64_t>(0, static_cast<int64_t>(max_index) + 1 - base);
+      if (CountSetBits(selection.bitmap, selection.offset + start,
+                       selection.length - start) > 0) {
+        return Status::Invalid("Selected positions do not fit in ", *index_type);
+      }
+    }
+    count += selection.count;
+    base = end;
+  }
+
+  const int byte_width = checked_cast<const FixedWidthType&>(*index_type).bit_width() / 8;
+  std::shared_ptr<Buffer> indices;
+  RETURN_NOT_OK(AllocateBuffer(pool, count * byte_width, &indices));
+  uint8_t* data = indices->mutable_data();
+  switch (index_type->id()) {
+    case Type::UINT16:
+      WriteSelectedIndices(selections, reinterpret_cast<uint16_t*>(data));
+      break;
+    case Type::INT32:
+      WriteSelectedIndices(selections, reinterpret_cast<int32_t*>(data));
+      break;
+    case Type::UINT32:
+      WriteSelectedIndices(selections, reinterpret_cast<uint32_t*>(data));
+      break;
+    case Type::INT64:
+      WriteSelectedIndices(selections, reinterpret_cast<int64_t*>(data));
+      break;
+    default:
+      WriteSelectedIndices(selections, reinterpret_cast<uint64_t*>(data));
+      break;
+  }
+  out->value = ArrayData::Make(index_type, count, {nullptr, indices}, 0);
+  return Status::OK();
+}
+
+Status Filter(FunctionContext* ctx, const Datum& values, const Datum& filter,
+              Datum* out) {
+  if (!values.is_arraylike() || !filter.is_arraylike()) {
+    return Status::Invalid("Filter values and filter must be array-like");
+  }
+  if (filter.type()->id() != Type::BOOL) {
+    return Status::TypeError("Filter must be boolean, got ", *filter.type());
+  }
+  FilterKernel kernel;
+  return detail::InvokeBinaryArrayKernel(ctx, &kernel, values, filter, out);
+}
+
+namespace {
+
+class FilteringReader : public RecordBatchReader {
+ public:
+  FilteringReader(FunctionContext* ctx, const std::shared_ptr<RecordBatchReader>& reader,
+                  RecordBatchPredicate predicate)
+      : ctx_(ctx), reader_(reader), predicate_(std::move(predicate)) {}
+
+  std::shared_ptr<Schema> schema() const override { return reader_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader_->ReadNext(&batch));
+      if (!batch) {
+        *out = nullptr;
+        return Status::OK();
+      }
+      RETURN_NOT_OK(FilterBatch(batch, out));
+      if ((*out)->num_rows() > 0) {
+        return Status::OK();
+      }
+    }
+  }
+
+ private:
+  Status FilterBatch(const std::shared_ptr<RecordBatch>& batch,
+                     std::shared_ptr<RecordBatch>* out) {
+    Datum selection;
+    RETURN_NOT_OK(predicate_(*batch, &selection));
+    if (selection.kind() != Datum::ARRAY) {
+      return Status::Invalid("Record batch selection must be an array");
+    }
+    const auto& selection_type = *selection.type();
+    const bool is_mask = selection_type.id() == Type::BOOL;
+    if (!is_mask && !is_integer(selection_type.id())) {
+      return Status::TypeError("Record batch selection must be boolean or integer, got ",
+                               selection_type);
+    }
+    const int64_t length = selection.array()->length;
+    if (is_mask && length != batch->num_rows()) {
+      return Status::Invalid("Filter of length ", length,
+                             " does not match record batch of length ",
+                             batch->num_rows());
+    }
+    const ArrayData& selection_data = *selection.array();
+    if (is_mask && selection_data.GetNullCount() == 0 &&
+        (length == 0 || CountSetBits(selection_data.buffers[1]->data(),
+                                     selection_data.offset, length) == length)) {
+      // All rows selected
+      *out = batch;
+      return Status::OK();
+    }
+
+    std::vector<std::shared_ptr<ArrayData>> columns(batch->num_columns());
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      Datum column;
+      if (is_mask) {
+        RETURN_NOT_OK(Filter(ctx_, Datum(batch->column_data(i)), selection, &column));
+      } else {
+        RETURN_NOT_OK(Take(ctx_, Datum(batch->column_data(i)), selection, &column));
+      }
+      columns[i] = column.array();
+    }
+    int64_t num_rows = length;
+    if (batch->num_columns() > 0) {
+      num_rows = columns[0]->length;
+    } else if (is_mask) {
+      Datum indices;
+      RETURN_NOT_OK(FilterToIndices(ctx_, selection, int64(), &indices));
+      num_rows = indices.array()->length;
+    }
+    *out = RecordBatch::Make(batch->schema(), num_rows, std::move(columns));
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  std::shared_ptr<RecordBatchReader> reader_;
+  RecordBatchPredicate predicate_;
+};
+
+}  // namespace
+
+Status FilterRecordBatchReader(FunctionContext* ctx,
+                               const std::shared_ptr<RecordBatchReader>& reader,
+                               RecordBatchPredicate predicate,
+                               std::shared_ptr<RecordBatchReader>* out) {
+  *out = std::make_shared<FilteringReader>(ctx, reader, std::move(predicate));
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_FILTER_H
+#define ARROW_COMPUTE_KERNELS_FILTER_H
+
+#include <functional>
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class DataType;
+class RecordBatch;
+class RecordBatchReader;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \brief Select the values for which a boolean filter is true
+///
+/// Values where the filter is false or null are dropped.  Values and filter
+/// must be array-like with the same length; the result has the same shape
+/// and type as `values`.  All types are supported except unions.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like values to filter
+/// \param[in] filter array-like boolean filter, e.g. the result of Compare()
+/// \param[out] out resulting datum
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Filter(FunctionContext* context, const Datum& values, const Datum& filter,
+              Datum* out);
+
+/// \brief Compute the positions at which a boolean filter is true
+///
+/// Positions where the filter is false or null are dropped.  The result can
+/// be passed to Take() in place of the filter, e.g. when the same selection
+/// applies to several arrays.  Positions in a chunked filter are counted
+/// from the start of its first chunk, and the result is a single array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] filter array-like boolean filter
+/// \param[in] index_type the type of the positions: uint16, int32, uint32,
+/// int64 or uint64.  It is an error if a selected position does not fit.
+/// \param[out] out resulting array of positions, in increasing order
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status FilterToIndices(FunctionContext* context, const Datum& filter,
+                       const std::shared_ptr<DataType>& index_type, Datum* out);
+
+/// \brief Compute the rows of a record batch to keep
+///
+/// The selection is either a boolean array with one slot per row, e.g. the
+/// result of Compare() on a column, or an integer array of the positions to
+/// keep, e.g. a Gandiva filter's selection vector converted with ToArray().
+using RecordBatchPredicate =
+    std::function<Status(const RecordBatch& batch, Datum* selection)>;
+
+/// \brief Lazily filter the rows of a reader
+///
+/// Batches are read from `reader`, evaluated with `predicate` and filtered one
+/// at a time as the returned reader is consumed.  Batches left without rows
+/// are skipped.  `context` must outlive the returned reader.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] reader the source of record batches
+/// \param[in] predicate computes the rows of each batch to keep
+/// \param[out] out the filtering reader
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status FilterRecordBatchReader(FunctionContext* context,
+                               const std::shared_ptr<RecordBatchReader>& reader,
+                               RecordBatchPredicate predicate,
+                               std::shared_ptr<RecordBatchReader>* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_FILTER_H
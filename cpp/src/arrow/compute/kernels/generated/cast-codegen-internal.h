@@ -186,6 +186,9 @@
   TEMPLATE(TimestampType, Date64Type) \
   TEMPLATE(TimestampType, TimestampType)
 
+#define DECIMAL128_CASES(TEMPLATE) \
+  TEMPLATE(Decimal128Type, Decimal128Type)
+
 #define BINARY_CASES(TEMPLATE) \
   TEMPLATE(BinaryType, StringType)
 
@@ -84,6 +84,7 @@ CAST_GENERATORS = [
                       parametric=True),
     CastCodeGenerator('Timestamp', ['Date32', 'Date64', 'Timestamp'],
                       parametric=True),
+    CastCodeGenerator('Decimal128', ['Decimal128'], parametric=True),
     CastCodeGenerator('Binary', ['String']),
     CastCodeGenerator('String', NUMERIC_TYPES + ['Timestamp']),
     CastCodeGenerator('Dictionary',
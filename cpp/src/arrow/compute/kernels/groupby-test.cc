@@ -0,0 +1,215 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/thread-pool.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/groupby.h"
+#include "arrow/compute/kernels/mean.h"
+#include "arrow/compute/kernels/minmax.h"
+#include "arrow/compute/kernels/sum.h"
+#include "arrow/compute/test-util.h"
+
+using std::shared_ptr;
+using std::vector;
+
+using arrow::internal::checked_cast;
+
+namespace arrow {
+namespace compute {
+
+class TestGroupBy : public ComputeFixture, public ::testing::Test {
+ protected:
+  void AssertKeysEqual(const Datum& actual, const shared_ptr<DataType>& type,
+                       const std::string& dictionary, const std::string& indices) {
+    ASSERT_EQ(actual.kind(), Datum::ARRAY);
+    auto dict_type = ::arrow::dictionary(int32(), ArrayFromJSON(type, dictionary));
+    DictionaryArray expected(dict_type, ArrayFromJSON(int32(), indices));
+    AssertArraysEqual(expected, *actual.make_array());
+  }
+
+  void AssertResultEqual(const Datum& actual, const shared_ptr<DataType>& type,
+                         const std::string& expected) {
+    ASSERT_EQ(actual.kind(), Datum::ARRAY);
+    AssertArraysEqual(*ArrayFromJSON(type, expected), *actual.make_array());
+  }
+};
+
+TEST_F(TestGroupBy, SingleKey) {
+  auto keys = ArrayFromJSON(int64(), "[1, 2, 1, null, 2, 1]");
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3, 4, 5, null]");
+  auto sum = MakeSumAggregateFunction(*int32(), &ctx_);
+
+  Datum out;
+  ASSERT_OK(GroupBy(&ctx_, {keys}, {values}, {sum}, &out));
+  ASSERT_EQ(out.kind(), Datum::COLLECTION);
+  const auto results = out.collection();
+  ASSERT_EQ(results.size(), 2);
+  AssertKeysEqual(results[0], int64(), "[1, 2]", "[0, 1, null]");
+  AssertResultEqual(results[1], int64(), "[4, 7, 4]");
+}
+
+TEST_F(TestGroupBy, MultipleKeysAndAggregates) {
+  auto key1 = ArrayFromJSON(utf8(), R"(["a", "b", "a", "a", "b", null])");
+  auto key2 = ArrayFromJSON(int32(), "[1, 1, 2, 1, 1, 2]");
+  auto values = ArrayFromJSON(float64(), "[1.5, 2.0, 3.0, 4.5, null, 5.0]");
+
+  Datum out;
+  ASSERT_OK(GroupBy(&ctx_, {key1, key2}, {values, values, values},
+                    {MakeSumAggregateFunction(*float64(), &ctx_),
+                     MakeMeanAggregateFunction(*float64(), &ctx_),
+                     MakeMinMaxAggregateFunction(*float64(), &ctx_)},
+                    &out));
+  const auto results = out.collection();
+  // MinMax yields two arrays
+  ASSERT_EQ(results.size(), 6);
+  AssertKeysEqual(results[0], utf8(), R"(["a", "b"])", "[0, 1, 0, null]");
+  AssertKeysEqual(results[1], int32(), "[1, 2]", "[0, 0, 1, 1]");
+  AssertResultEqual(results[2], float64(), "[6.0, 2.0, 3.0, 5.0]");
+  AssertResultEqual(results[3], float64(), "[3.0, 2.0, 3.0, 5.0]");
+  AssertResultEqual(results[4], float64(), "[1.5, 2.0, 3.0, 5.0]");
+  AssertResultEqual(results[5], float64(), "[4.5, 2.0, 3.0, 5.0]");
+}
+
+TEST_F(TestGroupBy, EmptyInput) {
+  auto keys = ArrayFromJSON(int64(), "[]");
+  auto values = ArrayFromJSON(int64(), "[]");
+
+  Datum out;
+  ASSERT_OK(GroupBy(&ctx_, {keys}, {values, values},
+                    {MakeSumAggregateFunction(*int64(), &ctx_),
+                     MakeMinMaxAggregateFunction(*int64(), &ctx_)},
+                    &out));
+  const auto results = out.collection();
+  ASSERT_EQ(results.size(), 4);
+  AssertKeysEqual(results[0], int64(), "[]", "[]");
+  AssertResultEqual(results[1], int64(), "[]");
+  AssertResultEqual(results[2], int64(), "[]");
+  AssertResultEqual(results[3], int64(), "[]");
+}
+
+TEST_F(TestGroupBy, ChunkedInputs) {
+  // Keys and values are chunked differently
+  auto keys = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(int32(), "[1, 2]"), ArrayFromJSON(int32(), "[3, 1, 2, 3]")});
+  auto values = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int64(), "[10, 20, 30, 40]"),
+                  ArrayFromJSON(int64(), "[]"), ArrayFromJSON(int64(), "[50, 60]")});
+
+  Datum out;
+  ASSERT_OK(GroupBy(&ctx_, {keys}, {values}, {MakeSumAggregateFunction(*int64(), &ctx_)},
+                    &out));
+  const auto results = out.collection();
+  ASSERT_EQ(results.size(), 2);
+  AssertKeysEqual(results[0], int32(), "[1, 2, 3]", "[0, 1, 2]");
+  AssertResultEqual(results[1], int64(), "[50, 70, 90]");
+}
+
+TEST_F(TestGroupBy, RandomParallel) {
+  // Large enough to be split into several batches and tasks
+  const int64_t length = 300000;
+  auto rand = random::RandomArrayGenerator(0x5e7c0de);
+  auto keys = rand.Int32(length, 0, 999, 0.01);
+  auto values = rand.Int64(length, -100, 100, 0.1);
+
+  // Reference result
+  std::map<int32_t, int64_t> expected_sums;
+  int64_t expected_null_key_sum = 0;
+  const auto& int_keys = checked_cast<const Int32Array&>(*keys);
+  const auto& int_values = checked_cast<const Int64Array&>(*values);
+  for (int64_t i = 0; i < length; ++i) {
+    const int64_t value = int_values.IsValid(i) ? int_values.Value(i) : 0;
+    if (int_keys.IsValid(i)) {
+      expected_sums[int_keys.Value(i)] += value;
+    } else {
+      expected_null_key_sum += value;
+    }
+  }
+
+  // Make sure several tasks are used even on small machines
+  const int saved_capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(4));
+
+  vector<shared_ptr<Array>> serial_results;
+  for (bool use_threads : {false, true}) {
+    GroupByOptions options;
+    options.use_threads = use_threads;
+    Datum out;
+    ASSERT_OK(GroupBy(&ctx_, {keys}, {values},
+                      {MakeSumAggregateFunction(*int64(), &ctx_)}, options, &out));
+    const auto results = out.collection();
+    ASSERT_EQ(results.size(), 2);
+
+    const auto result_keys = results[0].make_array();
+    const auto result_sums = results[1].make_array();
+    const auto& dict_keys = checked_cast<const DictionaryArray&>(*result_keys);
+    const auto& dict = checked_cast<const Int32Array&>(*dict_keys.dictionary());
+    const auto& indices = checked_cast<const Int32Array&>(*dict_keys.indices());
+    const auto& sums = checked_cast<const Int64Array&>(*result_sums);
+    ASSERT_EQ(indices.length(), static_cast<int64_t>(expected_sums.size()) + 1);
+    for (int64_t g = 0; g < indices.length(); ++g) {
+      if (indices.IsNull(g)) {
+        ASSERT_EQ(sums.Value(g), expected_null_key_sum);
+      } else {
+        ASSERT_EQ(sums.Value(g), expected_sums[dict.Value(indices.Value(g))]);
+      }
+    }
+
+    // Groups are in order of first appearance regardless of threading
+    if (use_threads) {
+      AssertArraysEqual(*serial_results[0], *result_keys);
+      AssertArraysEqual(*serial_results[1], *result_sums);
+    } else {
+      serial_results = {result_keys, result_sums};
+    }
+  }
+  ASSERT_OK(SetCpuThreadPoolCapacity(saved_capacity));
+}
+
+TEST_F(TestGroupBy, Errors) {
+  auto keys = ArrayFromJSON(int64(), "[1, 2]");
+  auto values = ArrayFromJSON(int64(), "[1, 2, 3]");
+  auto sum = MakeSumAggregateFunction(*int64(), &ctx_);
+  Datum out;
+
+  ASSERT_RAISES(Invalid, GroupBy(&ctx_, {}, {keys}, {sum}, &out));
+  ASSERT_RAISES(Invalid, GroupBy(&ctx_, {keys}, {keys}, {}, &out));
+  ASSERT_RAISES(Invalid, GroupBy(&ctx_, {keys}, {values}, {sum}, &out));
+  ASSERT_RAISES(Invalid, GroupBy(&ctx_, {keys}, {keys}, {nullptr}, &out));
+
+  auto strings = ArrayFromJSON(utf8(), R"(["a", "b"])");
+  ASSERT_RAISES(NotImplemented, GroupBy(&ctx_, {keys}, {strings}, {sum}, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
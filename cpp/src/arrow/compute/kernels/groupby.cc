@@ -0,0 +1,630 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/groupby.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/hash.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::GetCpuThreadPool;
+using internal::TaskGroup;
+
+namespace compute {
+
+GroupByOptions GroupByOptions::Defaults() { return GroupByOptions(); }
+
+namespace {
+
+// Maximum number of rows consumed at once, so that the per-batch
+// group ids and permutation stay cache-friendly
+constexpr int64_t kGroupByBatchSize = 1 << 16;
+
+// ----------------------------------------------------------------------
+// Per-group aggregate states
+
+// The states of one aggregate function, one per group.  States are
+// allocated by blocks so that they never move once constructed.
+class GroupedAggregateStates {
+ public:
+  GroupedAggregateStates(const std::shared_ptr<AggregateFunction>& function,
+                         MemoryPool* pool)
+      : function_(function),
+        pool_(pool),
+        state_size_(BitUtil::RoundUpToMultipleOf64(function->Size())) {}
+
+  ~GroupedAggregateStates() {
+    for (int64_t i = 0; i < num_states_; ++i) {
+      function_->Delete(state(i));
+    }
+  }
+
+  Status Resize(int64_t num_groups) {
+    while (num_states_ < num_groups) {
+      if (num_states_ % kStatesPerBlock == 0) {
+        std::shared_ptr<Buffer> block;
+        RETURN_NOT_OK(AllocateBuffer(pool_, kStatesPerBlock * state_size_, &block));
+        blocks_.push_back(std::move(block));
+      }
+      function_->New(state(num_states_++));
+    }
+    return Status::OK();
+  }
+
+  void* state(int64_t group) {
+    return blocks_[group / kStatesPerBlock]->mutable_data() +
+           (group % kStatesPerBlock) * state_size_;
+  }
+
+  const std::shared_ptr<AggregateFunction>& function() const { return function_; }
+
+ private:
+  static constexpr int64_t kStatesPerBlock = 1024;
+
+  std::shared_ptr<AggregateFunction> function_;
+  MemoryPool* pool_;
+  const int64_t state_size_;
+  std::vector<std::shared_ptr<Buffer>> blocks_;
+  int64_t num_states_ = 0;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(GroupedAggregateStates);
+};
+
+// ----------------------------------------------------------------------
+// Gathering of aggregate arguments by group
+
+template <typename T>
+void GatherValues(const uint8_t* in, const int32_t* indices, int64_t length,
+                  uint8_t* out) {
+  const T* in_values = reinterpret_cast<const T*>(in);
+  T* out_values = reinterpret_cast<T*>(out);
+  for (int64_t i = 0; i < length; ++i) {
+    out_values[i] = in_values[indices[i]];
+  }
+}
+
+// Reorder the values of a fixed-width array according to `indices`
+Status GatherFixedWidth(MemoryPool* pool, const ArrayData& input, const int32_t* indices,
+                        std::shared_ptr<ArrayData>* out) {
+  const auto& fw_type = checked_cast<const FixedWidthType&>(*input.type);
+  if (fw_type.bit_width() % 8 != 0) {
+    return Status::NotImplemented("GroupBy arguments of type ", *input.type);
+  }
+  const int64_t byte_width = fw_type.bit_width() / 8;
+  const int64_t length = input.length;
+
+  std::shared_ptr<Buffer> values;
+  RETURN_NOT_OK(AllocateBuffer(pool, length * byte_width, &values));
+  const uint8_t* in_values = input.buffers[1]->data() + input.offset * byte_width;
+  uint8_t* out_values = values->mutable_data();
+  switch (byte_width) {
+    case 1:
+      GatherValues<uint8_t>(in_values, indices, length, out_values);
+      break;
+    case 2:
+      GatherValues<uint16_t>(in_values, indices, length, out_values);
+      break;
+    case 4:
+      GatherValues<uint32_t>(in_values, indices, length, out_values);
+      break;
+    case 8:
+      GatherValues<uint64_t>(in_values, indices, length, out_values);
+      break;
+    default:
+      for (int64_t i = 0; i < length; ++i) {
+        std::memcpy(out_values + i * byte_width, in_values + indices[i] * byte_width,
+                    byte_width);
+      }
+  }
+
+  std::shared_ptr<Buffer> null_bitmap;
+  int64_t null_count = 0;
+  if (input.GetNullCount() > 0) {
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool, length, &null_bitmap));
+    const uint8_t* in_bitmap = input.buffers[0]->data();
+    uint8_t* out_bitmap = null_bitmap->mutable_data();
+    for (int64_t i = 0; i < length; ++i) {
+      if (BitUtil::GetBit(in_bitmap, input.offset + indices[i])) {
+        BitUtil::SetBit(out_bitmap, i);
+      } else {
+        ++null_count;
+      }
+    }
+  }
+
+  *out = ArrayData::Make(input.type, length, {null_bitmap, values}, null_count);
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Building result arrays from finalized scalars
+
+class AppendScalarVisitor {
+ public:
+  AppendScalarVisitor(const Scalar& scalar, ArrayBuilder* builder)
+      : scalar_(scalar), builder_(builder) {}
+
+  template <typename T>
+  typename std::enable_if<is_number<T>::value, Status>::type Visit(const T&) {
+    using ScalarType = typename TypeTraits<T>::ScalarType;
+    using BuilderType = typename TypeTraits<T>::BuilderType;
+    auto builder = checked_cast<BuilderType*>(builder_);
+    if (!scalar_.is_valid) {
+      return builder->AppendNull();
+    }
+    return builder->Append(checked_cast<const ScalarType&>(scalar_).value);
+  }
+
+  Status Visit(const BooleanType&) {
+    auto builder = checked_cast<BooleanBuilder*>(builder_);
+    if (!scalar_.is_valid) {
+      return builder->AppendNull();
+    }
+    return builder->Append(checked_cast<const BooleanScalar&>(scalar_).value);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("GroupBy results of type ", type);
+  }
+
+ private:
+  const Scalar& scalar_;
+  ArrayBuilder* builder_;
+};
+
+Status AppendScalar(const Scalar& scalar, ArrayBuilder* builder) {
+  AppendScalarVisitor visitor(scalar, builder);
+  return VisitTypeInline(*scalar.type, &visitor);
+}
+
+// Flatten a finalized aggregate into its scalar components
+Status GetResultScalars(const Datum& result, std::vector<std::shared_ptr<Scalar>>* out) {
+  out->clear();
+  if (result.is_scalar()) {
+    out->push_back(result.scalar());
+    return Status::OK();
+  }
+  if (result.kind() == Datum::COLLECTION) {
+    for (const Datum& datum : result.collection()) {
+      if (!datum.is_scalar()) {
+        return Status::NotImplemented("GroupBy with non-scalar aggregate results");
+      }
+      out->push_back(datum.scalar());
+    }
+    return Status::OK();
+  }
+  return Status::NotImplemented("GroupBy with non-scalar aggregate results");
+}
+
+// ----------------------------------------------------------------------
+// Grouped aggregation of a subset of the input
+
+class GroupByState {
+ public:
+  GroupByState(FunctionContext* ctx,
+               const std::vector<std::shared_ptr<DataType>>& key_types,
+               const std::vector<std::shared_ptr<AggregateFunction>>& aggregates)
+      : ctx_(ctx), key_types_(key_types), num_keys_(key_types.size()) {
+    for (const auto& aggregate : aggregates) {
+      states_.emplace_back(new GroupedAggregateStates(aggregate, ctx->memory_pool()));
+    }
+  }
+
+  Status Init() {
+    // Each key is dictionary-encoded to a memo table index
+    for (const auto& type : key_types_) {
+      std::unique_ptr<HashKernel> encoder;
+      RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx_, type, &encoder));
+      key_encoders_.push_back(std::move(encoder));
+    }
+    return Status::OK();
+  }
+
+  int32_t num_groups() const { return num_groups_; }
+
+  // Aggregate a batch.  All arrays must have the same length.
+  Status Consume(const std::vector<std::shared_ptr<ArrayData>>& keys,
+                 const std::vector<std::shared_ptr<ArrayData>>& arguments) {
+    const int64_t length = keys[0]->length;
+    RETURN_NOT_OK(ComputeGroupIds(keys));
+    for (auto& states : states_) {
+      RETURN_NOT_OK(states->Resize(num_groups_));
+    }
+
+    // Renumber the groups of this batch densely, so that the work below
+    // is proportional to the batch size instead of the total group count
+    batch_groups_.clear();
+    if (static_cast<int32_t>(batch_slot_.size()) < num_groups_) {
+      batch_slot_.resize(num_groups_, -1);
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      int32_t& slot = batch_slot_[group_ids_[i]];
+      if (slot == -1) {
+        slot = static_cast<int32_t>(batch_groups_.size());
+        batch_groups_.push_back(group_ids_[i]);
+      }
+      group_ids_[i] = slot;
+    }
+    for (int32_t group : batch_groups_) {
+      batch_slot_[group] = -1;
+    }
+
+    if (batch_groups_.size() == 1) {
+      // Single group, no need to reorder the arguments
+      for (size_t i = 0; i < states_.size(); ++i) {
+        auto& states = *states_[i];
+        RETURN_NOT_OK(states.function()->Consume(*MakeArray(arguments[i]),
+                                                states.state(batch_groups_[0])));
+      }
+      return Status::OK();
+    }
+
+    // Counting sort of the row indices by group
+    const size_t num_batch_groups = batch_groups_.size();
+    group_offsets_.assign(num_batch_groups + 1, 0);
+    for (int64_t i = 0; i < length; ++i) {
+      ++group_offsets_[group_ids_[i] + 1];
+    }
+    for (size_t g = 0; g < num_batch_groups; ++g) {
+      group_offsets_[g + 1] += group_offsets_[g];
+    }
+    permutation_.resize(length);
+    group_cursors_.assign(group_offsets_.begin(), group_offsets_.end() - 1);
+    for (int64_t i = 0; i < length; ++i) {
+      permutation_[group_cursors_[group_ids_[i]]++] = static_cast<int32_t>(i);
+    }
+
+    // Each group's rows are now contiguous in the gathered arguments
+    for (size_t i = 0; i < states_.size(); ++i) {
+      auto& states = *states_[i];
+      std::shared_ptr<ArrayData> gathered;
+      RETURN_NOT_OK(GatherFixedWidth(ctx_->memory_pool(), *arguments[i],
+                                     permutation_.data(), &gathered));
+      const auto gathered_array = MakeArray(gathered);
+      for (size_t g = 0; g < num_batch_groups; ++g) {
+        const int32_t offset = group_offsets_[g];
+        const auto slice = gathered_array->Slice(offset, group_offsets_[g + 1] - offset);
+        RETURN_NOT_OK(states.function()->Consume(*slice, states.state(batch_groups_[g])));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Merge another state's groups and aggregates into this one
+  Status Merge(GroupByState* other) {
+    // Map the other state's key indices to ours by encoding its dictionaries
+    std::vector<std::shared_ptr<ArrayData>> key_mappings(num_keys_);
+    for (size_t k = 0; k < num_keys_; ++k) {
+      std::shared_ptr<ArrayData> dictionary;
+      RETURN_NOT_OK(other->key_encoders_[k]->GetDictionary(&dictionary));
+      Datum mapping;
+      RETURN_NOT_OK(key_encoders_[k]->Call(ctx_, Datum(dictionary), &mapping));
+      key_mappings[k] = mapping.array();
+    }
+
+    std::vector<int32_t> key_indices(num_keys_);
+    std::vector<int32_t> group_mapping(other->num_groups_);
+    for (int32_t g = 0; g < other->num_groups_; ++g) {
+      for (size_t k = 0; k < num_keys_; ++k) {
+        const int32_t index = other->group_keys_[g * num_keys_ + k];
+        key_indices[k] =
+            index == -1 ? -1 : key_mappings[k]->GetValues<int32_t>(1)[index];
+      }
+      group_mapping[g] = GetOrInsertGroup(key_indices.data());
+    }
+
+    for (size_t i = 0; i < states_.size(); ++i) {
+      auto& states = *states_[i];
+      auto& other_states = *other->states_[i];
+      RETURN_NOT_OK(states.Resize(num_groups_));
+      for (int32_t g = 0; g < other->num_groups_; ++g) {
+        RETURN_NOT_OK(states.function()->Merge(other_states.state(g),
+                                              states.state(group_mapping[g])));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Finalize(std::vector<Datum>* out) {
+    MemoryPool* pool = ctx_->memory_pool();
+
+    // The keys are output as dictionary arrays of the memo table indices
+    for (size_t k = 0; k < num_keys_; ++k) {
+      Int32Builder indices_builder(pool);
+      RETURN_NOT_OK(indices_builder.Reserve(num_groups_));
+      for (int32_t g = 0; g < num_groups_; ++g) {
+        const int32_t index = group_keys_[g * num_keys_ + k];
+        if (index == -1) {
+          indices_builder.UnsafeAppendNull();
+        } else {
+          indices_builder.UnsafeAppend(index);
+        }
+      }
+      std::shared_ptr<Array> indices;
+      RETURN_NOT_OK(indices_builder.Finish(&indices));
+      std::shared_ptr<ArrayData> dictionary;
+      RETURN_NOT_OK(key_encoders_[k]->GetDictionary(&dictionary));
+      auto type = ::arrow::dictionary(int32(), MakeArray(dictionary));
+      out->emplace_back(std::make_shared<DictionaryArray>(type, indices));
+    }
+
+    std::vector<std::shared_ptr<Scalar>> scalars;
+    for (auto& states_ptr : states_) {
+      auto& states = *states_ptr;
+      const auto& function = states.function();
+
+      // Finalize an empty state to find out the result shape and types
+      std::vector<std::unique_ptr<ArrayBuilder>> builders;
+      {
+        GroupedAggregateStates empty(function, pool);
+        RETURN_NOT_OK(empty.Resize(1));
+        Datum result;
+        RETURN_NOT_OK(function->Finalize(empty.state(0), &result));
+        RETURN_NOT_OK(GetResultScalars(result, &scalars));
+        for (const auto& scalar : scalars) {
+          std::unique_ptr<ArrayBuilder> builder;
+          RETURN_NOT_OK(MakeBuilder(pool, scalar->type, &builder));
+          RETURN_NOT_OK(builder->Reserve(num_groups_));
+          builders.push_back(std::move(builder));
+        }
+      }
+
+      for (int32_t g = 0; g < num_groups_; ++g) {
+        Datum result;
+        RETURN_NOT_OK(function->Finalize(states.state(g), &result));
+        RETURN_NOT_OK(GetResultScalars(result, &scalars));
+        DCHECK_EQ(scalars.size(), builders.size());
+        for (size_t j = 0; j < builders.size(); ++j) {
+          RETURN_NOT_OK(AppendScalar(*scalars[j], builders[j].get()));
+        }
+      }
+      for (auto& builder : builders) {
+        std::shared_ptr<Array> array;
+        RETURN_NOT_OK(builder->Finish(&array));
+        out->emplace_back(array);
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  // Compute group_ids_ for the batch, creating new groups as necessary
+  Status ComputeGroupIds(const std::vector<std::shared_ptr<ArrayData>>& keys) {
+    const int64_t length = keys[0]->length;
+    std::vector<std::shared_ptr<ArrayData>> encoded(num_keys_);
+    for (size_t k = 0; k < num_keys_; ++k) {
+      Datum indices;
+      RETURN_NOT_OK(key_encoders_[k]->Call(ctx_, Datum(keys[k]), &indices));
+      encoded[k] = indices.array();
+    }
+
+    group_ids_.resize(length);
+    std::vector<int32_t> key_indices(num_keys_);
+    for (int64_t i = 0; i < length; ++i) {
+      for (size_t k = 0; k < num_keys_; ++k) {
+        // Null keys have their own group
+        const ArrayData& indices = *encoded[k];
+        const bool is_null =
+            indices.null_count != 0 &&
+            !BitUtil::GetBit(indices.buffers[0]->data(), indices.offset + i);
+        key_indices[k] = is_null ? -1 : indices.GetValues<int32_t>(1)[i];
+      }
+      group_ids_[i] = GetOrInsertGroup(key_indices.data());
+    }
+    return Status::OK();
+  }
+
+  int32_t GetOrInsertGroup(const int32_t* key_indices) {
+    auto on_found = [](int32_t group) {};
+    auto on_not_found = [&](int32_t group) {
+      group_keys_.insert(group_keys_.end(), key_indices, key_indices + num_keys_);
+      ++num_groups_;
+    };
+    if (num_keys_ == 1) {
+      return single_key_groups_.GetOrInsert(key_indices[0], on_found, on_not_found);
+    }
+    return multi_key_groups_.GetOrInsert(
+        key_indices, static_cast<int32_t>(num_keys_ * sizeof(int32_t)), on_found,
+        on_not_found);
+  }
+
+  FunctionContext* ctx_;
+  std::vector<std::shared_ptr<DataType>> key_types_;
+  const size_t num_keys_;
+  std::vector<std::unique_ptr<HashKernel>> key_encoders_;
+  std::vector<std::unique_ptr<GroupedAggregateStates>> states_;
+
+  // Group ids by tuple of key indices
+  internal::ScalarMemoTable<int32_t> single_key_groups_;
+  internal::BinaryMemoTable multi_key_groups_;
+  // The key indices of each group
+  std::vector<int32_t> group_keys_;
+  int32_t num_groups_ = 0;
+
+  // Scratch space for Consume()
+  std::vector<int32_t> group_ids_;
+  std::vector<int32_t> batch_slot_;
+  std::vector<int32_t> batch_groups_;
+  std::vector<int32_t> group_offsets_;
+  std::vector<int32_t> group_cursors_;
+  std::vector<int32_t> permutation_;
+};
+
+}  // namespace
+
+Status GroupBy(FunctionContext* ctx, const std::vector<Datum>& keys,
+               const std::vector<Datum>& arguments,
+               const std::vector<std::shared_ptr<AggregateFunction>>& aggregates,
+               const GroupByOptions& options, Datum* out) {
+  if (keys.empty()) {
+    return Status::Invalid("GroupBy needs at least one key");
+  }
+  if (arguments.size() != aggregates.size()) {
+    return Status::Invalid("GroupBy needs as many arguments as aggregates");
+  }
+  for (const auto& aggregate : aggregates) {
+    if (!aggregate) {
+      return Status::Invalid("GroupBy with null aggregate function");
+    }
+  }
+
+  // Keys and arguments, as chunks
+  std::vector<std::shared_ptr<DataType>> key_types;
+  std::vector<ArrayVector> columns;
+  auto add_column = [&](const Datum& datum) {
+    if (datum.is_array()) {
+      columns.push_back({datum.make_array()});
+    } else {
+      columns.push_back(datum.chunked_array()->chunks());
+    }
+  };
+  for (const auto& key : keys) {
+    if (!key.is_arraylike()) {
+      return Status::Invalid("GroupBy keys must be array-like");
+    }
+    key_types.push_back(key.type());
+    add_column(key);
+  }
+  for (const auto& argument : arguments) {
+    if (!argument.is_arraylike()) {
+      return Status::Invalid("GroupBy arguments must be array-like");
+    }
+    if (!is_fixed_width(argument.type()->id())) {
+      return Status::NotImplemented("GroupBy arguments of type ", *argument.type());
+    }
+    add_column(argument);
+  }
+  auto column_length = [](const ArrayVector& column) {
+    int64_t length = 0;
+    for (const auto& chunk : column) {
+      length += chunk->length();
+    }
+    return length;
+  };
+  for (const auto& column : columns) {
+    if (column_length(column) != column_length(columns[0])) {
+      return Status::Invalid("GroupBy keys and arguments must have the same length");
+    }
+  }
+
+  // Chunk all columns identically, then split the chunks into bounded batches
+  columns = internal::RechunkArraysConsistently(columns);
+  struct Batch {
+    size_t chunk;
+    int64_t offset, length;
+  };
+  std::vector<Batch> batches;
+  for (size_t chunk = 0; chunk < columns[0].size(); ++chunk) {
+    const int64_t chunk_length = columns[0][chunk]->length();
+    for (int64_t offset = 0; offset < chunk_length; offset += kGroupByBatchSize) {
+      batches.push_back(
+          {chunk, offset, std::min(kGroupByBatchSize, chunk_length - offset)});
+    }
+  }
+  const int64_t num_batches = static_cast<int64_t>(batches.size());
+
+  auto consume_batches = [&](GroupByState* state, int64_t begin,
+                             int64_t end) -> Status {
+    std::vector<std::shared_ptr<ArrayData>> key_batch(keys.size());
+    std::vector<std::shared_ptr<ArrayData>> argument_batch(arguments.size());
+    for (int64_t i = begin; i < end; ++i) {
+      const Batch& batch = batches[i];
+      for (size_t j = 0; j < columns.size(); ++j) {
+        auto data = columns[j][batch.chunk]->Slice(batch.offset, batch.length)->data();
+        if (j < keys.size()) {
+          key_batch[j] = std::move(data);
+        } else {
+          argument_batch[j - keys.size()] = std::move(data);
+        }
+      }
+      RETURN_NOT_OK(state->Consume(key_batch, argument_batch));
+    }
+    return Status::OK();
+  };
+
+  // Each task aggregates a contiguous range of batches, so that merging the
+  // partial states in order preserves the order of first appearance
+  int64_t num_tasks = 1;
+  if (options.use_threads) {
+    num_tasks = std::max<int64_t>(
+        1, std::min<int64_t>(GetCpuThreadPool()->GetCapacity(), num_batches));
+  }
+  std::vector<std::unique_ptr<GroupByState>> states;
+  for (int64_t t = 0; t < num_tasks; ++t) {
+    states.emplace_back(new GroupByState(ctx, key_types, aggregates));
+    RETURN_NOT_OK(states.back()->Init());
+  }
+
+  if (num_tasks == 1) {
+    RETURN_NOT_OK(consume_batches(states[0].get(), 0, num_batches));
+  } else {
+    auto task_group = TaskGroup::MakeThreaded(GetCpuThreadPool());
+    for (int64_t t = 0; t < num_tasks; ++t) {
+      GroupByState* state = states[t].get();
+      const int64_t begin = num_batches * t / num_tasks;
+      const int64_t end = num_batches * (t + 1) / num_tasks;
+      task_group->Append(
+          [&, state, begin, end]() { return consume_batches(state, begin, end); });
+    }
+    RETURN_NOT_OK(task_group->Finish());
+    for (int64_t t = 1; t < num_tasks; ++t) {
+      RETURN_NOT_OK(states[0]->Merge(states[t].get()));
+    }
+  }
+
+  std::vector<Datum> results;
+  RETURN_NOT_OK(states[0]->Finalize(&results));
+  *out = results;
+  return Status::OK();
+}
+
+Status GroupBy(FunctionContext* ctx, const std::vector<Datum>& keys,
+               const std::vector<Datum>& arguments,
+               const std::vector<std::shared_ptr<AggregateFunction>>& aggregates,
+               Datum* out) {
+  return GroupBy(ctx, keys, arguments, aggregates, GroupByOptions::Defaults(), out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_GROUPBY_H
+#define ARROW_COMPUTE_KERNELS_GROUPBY_H
+
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+struct ARROW_EXPORT GroupByOptions {
+  /// Whether to aggregate parts of the input in parallel on the CPU thread
+  /// pool, merging the partial results at the end
+  bool use_threads = true;
+
+  static GroupByOptions Defaults();
+};
+
+/// \brief Compute aggregates grouped by the distinct values of some keys
+///
+/// Rows are grouped by the distinct tuples of `keys` values (null being a
+/// distinct value).  For each group, `aggregates[i]` consumes the values of
+/// `arguments[i]` in the group's rows.  All keys and arguments must be
+/// array-like and have the same length; chunked arrays needn't have the
+/// same chunk layout.
+///
+/// The result is a collection datum of arrays with one element per group,
+/// in order of first appearance: first the keys, dictionary-encoded, then
+/// the finalized aggregates.  Aggregates finalizing to a collection of
+/// scalars (such as MinMax) yield one array per collection element.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] keys array-like grouping keys
+/// \param[in] arguments array-like aggregate inputs, one per aggregate
+/// \param[in] aggregates aggregate functions, e.g. from MakeSumAggregateFunction
+/// \param[in] options GroupBy options
+/// \param[out] out collection of result arrays
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* context, const std::vector<Datum>& keys,
+               const std::vector<Datum>& arguments,
+               const std::vector<std::shared_ptr<AggregateFunction>>& aggregates,
+               const GroupByOptions& options, Datum* out);
+
+/// \brief Compute grouped aggregates with default options
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GroupBy(FunctionContext* context, const std::vector<Datum>& keys,
+               const std::vector<Datum>& arguments,
+               const std::vector<std::shared_ptr<AggregateFunction>>& aggregates,
+               Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_GROUPBY_H
@@ -0,0 +1,171 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/hash-rows.h"
+#include "arrow/compute/test-util.h"
+
+using std::shared_ptr;
+using std::string;
+using std::vector;
+
+using arrow::internal::checked_cast;
+
+namespace arrow {
+namespace compute {
+
+class TestHashRows : public ComputeFixture, public ::testing::Test {
+ protected:
+  vector<uint64_t> HashArrays(const vector<shared_ptr<Array>>& columns) {
+    vector<Datum> inputs(columns.begin(), columns.end());
+    Datum out;
+    ABORT_NOT_OK(HashRows(&ctx_, inputs, &out));
+    EXPECT_EQ(Datum::ARRAY, out.kind());
+    auto hashes = out.make_array();
+    EXPECT_OK(ValidateArray(*hashes));
+    EXPECT_TRUE(hashes->type()->Equals(uint64()));
+    EXPECT_EQ(0, hashes->null_count());
+    const auto& values = checked_cast<const UInt64Array&>(*hashes);
+    return vector<uint64_t>(values.raw_values(), values.raw_values() + values.length());
+  }
+};
+
+TEST_F(TestHashRows, Basics) {
+  shared_ptr<Array> ints, strings;
+  ArrayFromVector<Int32Type, int32_t>({true, true, false, true, false, true},
+                                      {1, 2, 0, 1, 5, 2}, &ints);
+  ArrayFromVector<StringType, string>({true, true, true, true, true, true},
+                                      {"a", "b", "a", "a", "a", "c"}, &strings);
+
+  auto hashes = HashArrays({ints});
+  ASSERT_EQ(6, static_cast<int>(hashes.size()));
+  ASSERT_EQ(hashes[0], hashes[3]);
+  ASSERT_EQ(hashes[1], hashes[5]);
+  // Null values are equal whatever their slot holds
+  ASSERT_EQ(hashes[2], hashes[4]);
+  ASSERT_NE(hashes[0], hashes[1]);
+  ASSERT_NE(hashes[0], hashes[2]);
+
+  hashes = HashArrays({ints, strings});
+  ASSERT_EQ(hashes[0], hashes[3]);
+  ASSERT_EQ(hashes[2], hashes[4]);
+  ASSERT_NE(hashes[1], hashes[5]);
+  // Column order matters
+  ASSERT_NE(hashes, HashArrays({strings, ints}));
+}
+
+TEST_F(TestHashRows, Types) {
+  shared_ptr<Array> bools, doubles, fixed, nulls;
+  ArrayFromVector<BooleanType, bool>({true, false, true, false},
+                                     {true, false, true, true}, &bools);
+  ArrayFromVector<DoubleType, double>({1.5, -0.5, 1.5, 2.0}, &doubles);
+  ArrayFromVector<FixedSizeBinaryType, string>(fixed_size_binary(3),
+                                               {true, true, true, false},
+                                               {"abc", "def", "abc", "xyz"}, &fixed);
+  nulls = std::make_shared<NullArray>(4);
+
+  for (const auto& column : {bools, doubles, fixed}) {
+    auto hashes = HashArrays({column});
+    ASSERT_EQ(hashes[0], hashes[2]);
+    ASSERT_NE(hashes[0], hashes[1]);
+  }
+  auto hashes = HashArrays({nulls});
+  ASSERT_EQ(hashes[0], hashes[3]);
+  // Nulls of any type hash alike
+  ASSERT_EQ(HashArrays({bools})[1], hashes[1]);
+}
+
+TEST_F(TestHashRows, Sliced) {
+  shared_ptr<Array> ints, strings;
+  ArrayFromVector<Int64Type, int64_t>({true, false, true, true, false, true, true},
+                                      {5, 6, 7, 5, 8, 6, 9}, &ints);
+  ArrayFromVector<StringType, string>({"x", "y", "z", "x", "w", "y", "v"}, &strings);
+
+  auto hashes = HashArrays({ints, strings});
+  auto sliced = HashArrays({ints->Slice(3), strings->Slice(3)});
+  ASSERT_EQ(vector<uint64_t>(hashes.begin() + 3, hashes.end()), sliced);
+}
+
+TEST_F(TestHashRows, Dictionary) {
+  shared_ptr<Array> dict_values, indices, plain;
+  ArrayFromVector<StringType, string>({"c", "b", "a"}, &dict_values);
+  ArrayFromVector<Int16Type, int16_t>({true, true, true, false, true}, {2, 1, 0, 7, 2},
+                                      &indices);
+  ArrayFromVector<StringType, string>({true, true, true, false, true},
+                                      {"a", "b", "c", "", "a"}, &plain);
+  auto dict =
+      std::make_shared<DictionaryArray>(dictionary(int16(), dict_values), indices);
+
+  // Dictionary values are hashed by value
+  ASSERT_EQ(HashArrays({plain}), HashArrays({dict}));
+}
+
+TEST_F(TestHashRows, Chunked) {
+  shared_ptr<Array> ints, strings;
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3, 4, 5}, &ints);
+  ArrayFromVector<StringType, string>({"a", "b", "c", "d", "e"}, &strings);
+  auto expected = HashArrays({ints, strings});
+
+  auto chunked_ints =
+      std::make_shared<ChunkedArray>(ArrayVector{ints->Slice(0, 2), ints->Slice(2)});
+  auto chunked_strings = std::make_shared<ChunkedArray>(
+      ArrayVector{strings->Slice(0, 3), strings->Slice(3)});
+  Datum out;
+  ASSERT_OK(HashRows(&ctx_, {Datum(chunked_ints), Datum(chunked_strings)}, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  // Chunks are split where either column's chunks end
+  ASSERT_EQ(3, out.chunked_array()->num_chunks());
+  vector<uint64_t> hashes;
+  for (const auto& chunk : out.chunked_array()->chunks()) {
+    const auto& values = checked_cast<const UInt64Array&>(*chunk);
+    hashes.insert(hashes.end(), values.raw_values(),
+                  values.raw_values() + values.length());
+  }
+  ASSERT_EQ(expected, hashes);
+
+  // Arrays and chunked arrays can be mixed
+  ASSERT_OK(HashRows(&ctx_, {Datum(ints), Datum(chunked_strings)}, &out));
+  ASSERT_EQ(2, out.chunked_array()->num_chunks());
+}
+
+TEST_F(TestHashRows, Errors) {
+  shared_ptr<Array> ints, longer;
+  ArrayFromVector<Int32Type, int32_t>({1, 2}, &ints);
+  ArrayFromVector<Int32Type, int32_t>({1, 2, 3}, &longer);
+  auto lists = ArrayFromJSON(list(int32()), "[[1], [2]]");
+  Datum out;
+  ASSERT_RAISES(Invalid, HashRows(&ctx_, {}, &out));
+  ASSERT_RAISES(Invalid, HashRows(&ctx_, {Datum(ints), Datum(longer)}, &out));
+  ASSERT_RAISES(NotImplemented, HashRows(&ctx_, {Datum(ints), Datum(lists)}, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,255 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/hash-rows.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::hash_t;
+
+namespace compute {
+
+namespace {
+
+// Hash of null values
+constexpr hash_t kNullHash = 0x2545f4914f6cdd1dULL;
+
+// How the hash of a value is merged into the hash of its row
+
+struct SetHash {
+  static hash_t Merge(hash_t, hash_t h) { return h; }
+};
+
+struct CombineHash {
+  static hash_t Merge(hash_t seed, hash_t h) {
+    return seed ^ (h + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+  }
+};
+
+// Merge the hash of each value of a column, given by `hash(i)`, into `out`
+template <typename Merger, typename HashFunc>
+void MergeHashes(const ArrayData& column, HashFunc&& hash, hash_t* out) {
+  if (column.GetNullCount() == 0) {
+    for (int64_t i = 0; i < column.length; ++i) {
+      out[i] = Merger::Merge(out[i], hash(i));
+    }
+  } else {
+    internal::BitmapReader valid(column.buffers[0]->data(), column.offset,
+                                 column.length);
+    for (int64_t i = 0; i < column.length; ++i) {
+      out[i] = Merger::Merge(out[i], valid.IsSet() ? hash(i) : kNullHash);
+      valid.Next();
+    }
+  }
+}
+
+template <typename Merger, typename CType>
+void MergeValueHashes(const ArrayData& column, hash_t* out) {
+  const CType* values = column.GetValues<CType>(1);
+  MergeHashes<Merger>(
+      column,
+      [=](int64_t i) { return internal::ScalarHelper<CType, 0>::ComputeHash(values[i]); },
+      out);
+}
+
+template <typename Merger, typename IndexCType>
+void MergeDictionaryHashes(const ArrayData& indices,
+                           const std::vector<hash_t>& dict_hashes, hash_t* out) {
+  const IndexCType* values = indices.GetValues<IndexCType>(1);
+  const hash_t* hashes = dict_hashes.data();
+  MergeHashes<Merger>(indices, [=](int64_t i) { return hashes[values[i]]; }, out);
+}
+
+template <typename Merger>
+Status HashColumn(const ArrayData& column, hash_t* out) {
+  const DataType& type = *column.type;
+  switch (type.id()) {
+    case Type::NA:
+      for (int64_t i = 0; i < column.length; ++i) {
+        out[i] = Merger::Merge(out[i], kNullHash);
+      }
+      break;
+    case Type::BOOL: {
+      const hash_t hashes[2] = {internal::ScalarHelper<uint8_t, 0>::ComputeHash(0),
+                                internal::ScalarHelper<uint8_t, 0>::ComputeHash(1)};
+      const uint8_t* bitmap = column.buffers[1]->data();
+      const int64_t offset = column.offset;
+      MergeHashes<Merger>(
+          column, [&](int64_t i) { return hashes[BitUtil::GetBit(bitmap, offset + i)]; },
+          out);
+    } break;
+    case Type::BINARY:
+    case Type::STRING: {
+      const int32_t* offsets = column.GetValues<int32_t>(1);
+      const uint8_t* data = column.buffers[2] ? column.buffers[2]->data() : NULLPTR;
+      MergeHashes<Merger>(column,
+                          [=](int64_t i) {
+                            return internal::ComputeStringHash<0>(
+                                data + offsets[i], offsets[i + 1] - offsets[i]);
+                          },
+                          out);
+    } break;
+    case Type::DICTIONARY: {
+      // Hash dictionary values rather than indices, so that equal values get
+      // equal hashes whatever the dictionary
+      const auto& dict_type = checked_cast<const DictionaryType&>(type);
+      const ArrayData& dictionary = *dict_type.dictionary()->data();
+      std::vector<hash_t> dict_hashes(dictionary.length);
+      RETURN_NOT_OK(HashColumn<SetHash>(dictionary, dict_hashes.data()));
+      switch (dict_type.index_type()->id()) {
+        case Type::INT8:
+          MergeDictionaryHashes<Merger, int8_t>(column, dict_hashes, out);
+          break;
+        case Type::INT16:
+          MergeDictionaryHashes<Merger, int16_t>(column, dict_hashes, out);
+          break;
+        case Type::INT32:
+          MergeDictionaryHashes<Merger, int32_t>(column, dict_hashes, out);
+          break;
+        case Type::INT64:
+          MergeDictionaryHashes<Merger, int64_t>(column, dict_hashes, out);
+          break;
+        default:
+          return Status::NotImplemented("HashRows dictionary indices of type ",
+                                        *dict_type.index_type());
+      }
+    } break;
+    default: {
+      if (!is_fixed_width(type.id())) {
+        return Status::NotImplemented("HashRows of type ", type);
+      }
+      // Other fixed-width values are hashed by bit pattern
+      const int byte_width = checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+      switch (byte_width) {
+        case 1:
+          MergeValueHashes<Merger, uint8_t>(column, out);
+          break;
+        case 2:
+          MergeValueHashes<Merger, uint16_t>(column, out);
+          break;
+        case 4:
+          MergeValueHashes<Merger, uint32_t>(column, out);
+          break;
+        case 8:
+          MergeValueHashes<Merger, uint64_t>(column, out);
+          break;
+        default: {
+          const uint8_t* values = column.buffers[1]->data() + column.offset * byte_width;
+          MergeHashes<Merger>(column,
+                              [=](int64_t i) {
+                                return internal::ComputeStringHash<0>(
+                                    values + i * byte_width, byte_width);
+                              },
+                              out);
+        } break;
+      }
+    } break;
+  }
+  return Status::OK();
+}
+
+// Hash the rows of columns of the same length into a new uint64 array
+Status HashArrays(FunctionContext* ctx, const std::vector<const ArrayData*>& columns,
+                  int64_t length, std::shared_ptr<ArrayData>* out) {
+  std::shared_ptr<Buffer> hashes;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length * sizeof(hash_t), &hashes));
+  auto data = reinterpret_cast<hash_t*>(hashes->mutable_data());
+  std::memset(data, 0, static_cast<size_t>(length * sizeof(hash_t)));
+  for (const ArrayData* column : columns) {
+    RETURN_NOT_OK(HashColumn<CombineHash>(*column, data));
+  }
+  *out = ArrayData::Make(uint64(), length, {NULLPTR, hashes}, 0);
+  return Status::OK();
+}
+
+int64_t DatumLength(const Datum& datum) {
+  return datum.kind() == Datum::ARRAY ? datum.array()->length
+                                      : datum.chunked_array()->length();
+}
+
+}  // namespace
+
+Status HashRows(FunctionContext* ctx, const std::vector<Datum>& columns, Datum* out) {
+  if (columns.empty()) {
+    return Status::Invalid("HashRows needs at least one column");
+  }
+  bool all_arrays = true;
+  for (const auto& column : columns) {
+    if (!column.is_arraylike()) {
+      return Status::Invalid("HashRows columns must be array-like");
+    }
+    if (DatumLength(column) != DatumLength(columns[0])) {
+      return Status::Invalid("HashRows columns must have the same length");
+    }
+    all_arrays &= column.is_array();
+  }
+
+  if (all_arrays) {
+    std::vector<const ArrayData*> arrays;
+    for (const auto& column : columns) {
+      arrays.push_back(column.array().get());
+    }
+    std::shared_ptr<ArrayData> hashes;
+    RETURN_NOT_OK(HashArrays(ctx, arrays, DatumLength(columns[0]), &hashes));
+    *out = hashes;
+    return Status::OK();
+  }
+
+  std::vector<ArrayVector> chunked_columns;
+  for (const auto& column : columns) {
+    if (column.is_array()) {
+      chunked_columns.push_back({column.make_array()});
+    } else {
+      chunked_columns.push_back(column.chunked_array()->chunks());
+    }
+  }
+  chunked_columns = internal::RechunkArraysConsistently(chunked_columns);
+
+  ArrayVector chunks;
+  for (size_t chunk = 0; chunk < chunked_columns[0].size(); ++chunk) {
+    std::vector<const ArrayData*> arrays;
+    for (const auto& column : chunked_columns) {
+      arrays.push_back(column[chunk]->data().get());
+    }
+    std::shared_ptr<ArrayData> hashes;
+    RETURN_NOT_OK(HashArrays(ctx, arrays, chunked_columns[0][chunk]->length(), &hashes));
+    chunks.push_back(MakeArray(hashes));
+  }
+  *out = std::make_shared<ChunkedArray>(std::move(chunks), uint64());
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
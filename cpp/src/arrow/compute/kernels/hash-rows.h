@@ -0,0 +1,55 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_HASH_ROWS_H
+#define ARROW_COMPUTE_KERNELS_HASH_ROWS_H
+
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \brief Compute a 64-bit hash of each row of several columns
+///
+/// Rows with equal values (null being a distinct value) get equal hashes,
+/// also across calls, e.g. for the batches of both sides of a join.  The
+/// columns are hashed one at a time, each hash being combined into those of
+/// the previous columns, so that each pass is a tight loop over a single
+/// column.  Fixed-width, binary, string and dictionary columns are
+/// supported; floating-point values are hashed by bit pattern, dictionary
+/// values by their dictionary value rather than their index.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] columns array-like columns of the same length, at least one
+/// \param[out] out uint64 array-like hashes without nulls, chunked like the
+/// columns (rechunked consistently if they have different chunk layouts)
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashRows(FunctionContext* context, const std::vector<Datum>& columns, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_HASH_ROWS_H
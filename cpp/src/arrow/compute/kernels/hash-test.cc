@@ -32,10 +32,13 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/thread-pool.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -336,5 +339,153 @@ TEST_F(TestHashKernel, ChunkedArrayInvoke) {
   AssertChunkedEqual(*dict_carr, *encoded_out.chunked_array());
 }
 
+TEST_F(TestHashKernel, IsInAndMatch) {
+  auto member_set = ArrayFromJSON(utf8(), R"(["b", null, "a", "b", ""])");
+  auto values = ArrayFromJSON(utf8(), R"(["a", "c", null, "", "b", "a"])");
+
+  Datum out;
+  ASSERT_OK(IsIn(&this->ctx_, values, member_set, &out));
+  AssertArraysEqual(*ArrayFromJSON(boolean(), "[true, false, null, true, true, true]"),
+                    *out.make_array());
+  // Positions of the first occurrences in the member set
+  ASSERT_OK(Match(&this->ctx_, values, member_set, &out));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2, null, null, 4, 0, 2]"),
+                    *out.make_array());
+
+  // The output is chunked like the values
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int64(), "[3, 1]"), ArrayFromJSON(int64(), "[2]")});
+  ASSERT_OK(IsIn(&this->ctx_, chunked, ArrayFromJSON(int64(), "[1, 2]"), &out));
+  ChunkedArray expected(ArrayVector{ArrayFromJSON(boolean(), "[false, true]"),
+                                    ArrayFromJSON(boolean(), "[true]")});
+  ASSERT_TRUE(out.chunked_array()->Equals(expected));
+
+  ASSERT_RAISES(TypeError, IsIn(&this->ctx_, chunked, member_set, &out));
+}
+
+TEST_F(TestHashKernel, SetLookupKernelReuse) {
+  // The member set is hashed once and probed several times
+  auto member_set = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(int32(), "[10, 20]"), ArrayFromJSON(int32(), "[30, 10]")});
+  std::unique_ptr<UnaryKernel> kernel;
+  ASSERT_OK(GetMatchKernel(&this->ctx_, member_set, &kernel));
+  for (int i = 0; i < 3; ++i) {
+    Datum out;
+    ASSERT_OK(kernel->Call(&this->ctx_, ArrayFromJSON(int32(), "[30, 5, 10]"), &out));
+    AssertArraysEqual(*ArrayFromJSON(int32(), "[2, null, 0]"), *out.make_array());
+  }
+}
+
+TEST_F(TestHashKernel, CountValues) {
+  auto values = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int16(), "[3, null, 1, 3]"),
+                  ArrayFromJSON(int16(), "[]"), ArrayFromJSON(int16(), "[1, 3, 7]")});
+  shared_ptr<Array> uniques, counts;
+  ASSERT_OK(CountValues(&this->ctx_, values, &uniques, &counts));
+  AssertArraysEqual(*ArrayFromJSON(int16(), "[3, 1, 7]"), *uniques);
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[3, 2, 1]"), *counts);
+
+  // Counts accumulate over appended batches
+  std::unique_ptr<HashKernel> kernel;
+  ASSERT_OK(GetCountValuesKernel(&this->ctx_, utf8(), &kernel));
+  ASSERT_OK(kernel->Append(&this->ctx_, *ArrayFromJSON(utf8(), R"(["x", "y"])")->data()));
+  Datum out;
+  ASSERT_OK(kernel->Flush(&out));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 1]"), *out.make_array());
+  ASSERT_OK(kernel->Append(&this->ctx_, *ArrayFromJSON(utf8(), R"(["y"])")->data()));
+  ASSERT_OK(kernel->Flush(&out));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 2]"), *out.make_array());
+}
+
+TEST_F(TestHashKernel, DictionaryInput) {
+  // The dictionary repeats "b", holds a null and an unused entry
+  auto dict_type =
+      dictionary(int16(), ArrayFromJSON(utf8(), R"(["unused", "b", "a", "b", null])"));
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{std::make_shared<DictionaryArray>(
+                      dict_type, ArrayFromJSON(int16(), "[3, 2, null]")),
+                  std::make_shared<DictionaryArray>(
+                      dict_type, ArrayFromJSON(int16(), "[1, 4, 2]"))});
+
+  auto expected_dictionary = ArrayFromJSON(utf8(), R"(["b", "a"])");
+  shared_ptr<Array> uniques;
+  ASSERT_OK(Unique(&this->ctx_, chunked, &uniques));
+  AssertArraysEqual(*expected_dictionary, *uniques);
+
+  // Re-encoding compacts the dictionary, like encoding the decoded values
+  Datum encoded;
+  ASSERT_OK(DictionaryEncode(&this->ctx_, chunked, &encoded));
+  auto out_type = dictionary(int32(), expected_dictionary);
+  ChunkedArray expected(ArrayVector{
+      std::make_shared<DictionaryArray>(out_type, ArrayFromJSON(int32(), "[0, 1, null]")),
+      std::make_shared<DictionaryArray>(out_type,
+                                        ArrayFromJSON(int32(), "[0, null, 1]"))});
+  ASSERT_EQ(encoded.kind(), Datum::CHUNKED_ARRAY);
+  ASSERT_TRUE(encoded.chunked_array()->Equals(expected));
+}
+
+TEST_F(TestHashKernel, UniqueUseThreads) {
+  auto rand = random::RandomArrayGenerator(0x4a5b);
+  const int64_t length = 5 * detail::kMorselLength / 2;
+  auto values = std::make_shared<ChunkedArray>(
+      ArrayVector{rand.Int64(length, -5000, 5000, 0.01),
+                  rand.Int64(length, 0, 100000, 0.01)});
+
+  // Make sure several tasks are used even on small machines
+  const int saved_capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(4));
+
+  shared_ptr<Array> serial, parallel;
+  ASSERT_OK(Unique(&this->ctx_, values, &serial));
+  this->ctx_.set_use_threads(true);
+  ASSERT_OK(Unique(&this->ctx_, values, &parallel));
+  this->ctx_.set_use_threads(false);
+
+  // Values must appear in the same order as with a single table
+  ASSERT_ARRAYS_EQUAL(*serial, *parallel);
+  ASSERT_OK(SetCpuThreadPoolCapacity(saved_capacity));
+}
+
+TEST_F(TestHashKernel, DictionaryEncodeUseThreads) {
+  auto rand = random::RandomArrayGenerator(0x5c6d);
+  const int64_t length = 5 * detail::kMorselLength / 2;
+  auto integers = std::static_pointer_cast<Int32Array>(rand.Int32(length, 0, 3000, 0.01));
+  StringBuilder builder;
+  for (int64_t i = 0; i < length; ++i) {
+    if (integers->IsNull(i)) {
+      ASSERT_OK(builder.AppendNull());
+    } else {
+      ASSERT_OK(builder.Append("value-" + std::to_string(integers->Value(i))));
+    }
+  }
+  shared_ptr<Array> strings;
+  ASSERT_OK(builder.Finish(&strings));
+
+  const int saved_capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(4));
+
+  for (const Datum& values :
+       {Datum(strings->Slice(3)),
+        Datum(std::make_shared<ChunkedArray>(
+            ArrayVector{strings->Slice(0, 1000), strings->Slice(1000)}))}) {
+    Datum serial, parallel;
+    ASSERT_OK(DictionaryEncode(&this->ctx_, values, &serial));
+    this->ctx_.set_use_threads(true);
+    ASSERT_OK(DictionaryEncode(&this->ctx_, values, &parallel));
+    this->ctx_.set_use_threads(false);
+
+    // The dictionary is in order of first appearance, as with a single table
+    ASSERT_EQ(serial.kind(), parallel.kind());
+    if (values.kind() == Datum::ARRAY) {
+      auto result = parallel.make_array();
+      ASSERT_OK(ValidateArray(*result));
+      ASSERT_ARRAYS_EQUAL(*serial.make_array(), *result);
+    } else {
+      ASSERT_TRUE(parallel.chunked_array()->Equals(*serial.chunked_array()));
+    }
+  }
+  ASSERT_OK(SetCpuThreadPoolCapacity(saved_capacity));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -33,7 +33,10 @@
 #include "arrow/builder.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/util-internal.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
@@ -41,7 +44,9 @@
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread-pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -135,6 +140,49 @@ class DictEncodeAction : public ActionBase {
   Int32Builder indices_builder_;
 };
 
+// ----------------------------------------------------------------------
+// Count values implementation
+
+class CountValuesAction : public ActionBase {
+ public:
+  using ActionBase::ActionBase;
+
+  Status Reset() {
+    counts_.clear();
+    return Status::OK();
+  }
+
+  Status Reserve(const int64_t length) { return Status::OK(); }
+
+  // Nulls are not counted
+  void ObserveNull() {}
+
+  template <class Index>
+  void ObserveFound(Index index) {
+    ++counts_[index];
+  }
+
+  template <class Index>
+  void ObserveNotFound(Index index) {
+    counts_.push_back(1);
+  }
+
+  // Output the counts of all values appended so far, in dictionary order
+  Status Flush(Datum* out) {
+    Int64Builder builder(pool_);
+    RETURN_NOT_OK(builder.AppendValues(counts_));
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(builder.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const { return int64(); }
+
+ private:
+  std::vector<int64_t> counts_;
+};
+
 // ----------------------------------------------------------------------
 // Base class for all hash kernel implementations
 
@@ -174,7 +222,7 @@ class RegularHashKernelImpl : public HashKernelImpl {
 
   Status Append(const ArrayData& arr) override {
     RETURN_NOT_OK(action_.Reserve(arr.length));
-    return ArrayDataVisitor<Type>::Visit(arr, this);
+    return AppendValues(arr, BatchedLookup());
   }
 
   Status Flush(Datum* out) override { return action_.Flush(out); }
@@ -202,6 +250,40 @@ class RegularHashKernelImpl : public HashKernelImpl {
 
  protected:
   using MemoTable = typename HashTraits<Type>::MemoTableType;
+  // Hashed fixed-width values are looked up in batches
+  using BatchedLookup = std::is_same<MemoTable, internal::ScalarMemoTable<Scalar>>;
+
+  Status AppendValues(const ArrayData& arr, std::false_type) {
+    return ArrayDataVisitor<Type>::Visit(arr, this);
+  }
+
+  Status AppendValues(const ArrayData& arr, std::true_type) {
+    auto on_found = [this](int32_t memo_index) { action_.ObserveFound(memo_index); };
+    auto on_not_found = [this](int32_t memo_index) {
+      action_.ObserveNotFound(memo_index);
+    };
+    const Scalar* values = arr.GetValues<Scalar>(1);
+    if (arr.GetNullCount() == 0) {
+      memo_table_->GetOrInsertBatch(values, arr.length, on_found, on_not_found);
+      return Status::OK();
+    }
+    // Observe the values run by run, in order with the nulls between them
+    int64_t position = 0;
+    internal::VisitSetBitRuns(arr.buffers[0]->data(), arr.offset, arr.length,
+                              [&](int64_t run_start, int64_t run_length) {
+                                for (; position < run_start; ++position) {
+                                  action_.ObserveNull();
+                                }
+                                memo_table_->GetOrInsertBatch(values + run_start,
+                                                              run_length, on_found,
+                                                              on_not_found);
+                                position += run_length;
+                              });
+    for (; position < arr.length; ++position) {
+      action_.ObserveNull();
+    }
+    return Status::OK();
+  }
 
   MemoryPool* pool_;
   std::shared_ptr<DataType> type_;
@@ -276,6 +358,234 @@ struct HashKernelTraits<Type, Action, enable_if_fixed_size_binary<Type>> {
   using HashKernelImpl = RegularHashKernelImpl<Type, util::string_view, Action>;
 };
 
+// ----------------------------------------------------------------------
+// Lookups in a member set, hashed once
+
+// Output whether each value is in the member set
+class IsInAction {
+ public:
+  explicit IsInAction(MemoryPool* pool) : builder_(pool) {}
+
+  Status Reserve(const int64_t length) { return builder_.Reserve(length); }
+
+  void ObserveNull() { builder_.UnsafeAppendNull(); }
+
+  void ObserveFound(int32_t position) { builder_.UnsafeAppend(true); }
+
+  void ObserveNotFound() { builder_.UnsafeAppend(false); }
+
+  Status Flush(Datum* out) {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(builder_.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  static std::shared_ptr<DataType> out_type() { return boolean(); }
+
+ private:
+  BooleanBuilder builder_;
+};
+
+// Output the position of each value in the member set
+class MatchAction {
+ public:
+  explicit MatchAction(MemoryPool* pool) : builder_(pool) {}
+
+  Status Reserve(const int64_t length) { return builder_.Reserve(length); }
+
+  void ObserveNull() { builder_.UnsafeAppendNull(); }
+
+  void ObserveFound(int32_t position) { builder_.UnsafeAppend(position); }
+
+  void ObserveNotFound() { builder_.UnsafeAppendNull(); }
+
+  Status Flush(Datum* out) {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(builder_.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  static std::shared_ptr<DataType> out_type() { return int32(); }
+
+ private:
+  Int32Builder builder_;
+};
+
+// The member set is only read once built, so that the kernel can probe
+// several inputs concurrently
+template <typename Type, typename Scalar, typename Action>
+class SetLookupKernelImpl : public UnaryKernel {
+ public:
+  explicit SetLookupKernelImpl(const std::shared_ptr<DataType>& type) : type_(type) {}
+
+  Status Init(const Datum& member_set) {
+    memo_table_.reset(new MemoTable(0));
+    SetBuilder builder{this, 0};
+    if (member_set.kind() == Datum::ARRAY) {
+      return ArrayDataVisitor<Type>::Visit(*member_set.array(), &builder);
+    }
+    for (const auto& chunk : member_set.chunked_array()->chunks()) {
+      RETURN_NOT_OK(ArrayDataVisitor<Type>::Visit(*chunk->data(), &builder));
+    }
+    return Status::OK();
+  }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    DCHECK_EQ(Datum::ARRAY, input.kind());
+    const ArrayData& arr = *input.array();
+    Prober prober(this, ctx->memory_pool());
+    RETURN_NOT_OK(prober.action.Reserve(arr.length));
+    RETURN_NOT_OK(ArrayDataVisitor<Type>::Visit(arr, &prober));
+    return prober.action.Flush(out);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return Action::out_type(); }
+
+  bool is_thread_safe() const override { return true; }
+
+ private:
+  using MemoTable = typename HashTraits<Type>::MemoTableType;
+
+  // Record the first position of each distinct member, ignoring nulls
+  struct SetBuilder {
+    SetLookupKernelImpl* kernel;
+    int32_t position;
+
+    Status VisitNull() {
+      ++position;
+      return Status::OK();
+    }
+
+    Status VisitValue(const Scalar& value) {
+      auto on_found = [](int32_t memo_index) {};
+      auto on_not_found = [this](int32_t memo_index) {
+        kernel->positions_.push_back(position);
+      };
+      kernel->memo_table_->GetOrInsert(value, on_found, on_not_found);
+      ++position;
+      return Status::OK();
+    }
+  };
+
+  struct Prober {
+    Prober(const SetLookupKernelImpl* kernel, MemoryPool* pool)
+        : kernel(kernel), action(pool) {}
+
+    const SetLookupKernelImpl* kernel;
+    Action action;
+
+    Status VisitNull() {
+      action.ObserveNull();
+      return Status::OK();
+    }
+
+    Status VisitValue(const Scalar& value) {
+      const int32_t memo_index = kernel->memo_table_->Get(value);
+      if (memo_index == -1) {
+        action.ObserveNotFound();
+      } else {
+        action.ObserveFound(kernel->positions_[memo_index]);
+      }
+      return Status::OK();
+    }
+  };
+
+  std::shared_ptr<DataType> type_;
+  std::unique_ptr<MemoTable> memo_table_;
+  // Position in the member set of each memo table entry
+  std::vector<int32_t> positions_;
+};
+
+template <typename Type, typename Action, typename Enable = void>
+struct SetLookupKernelTraits {};
+
+template <typename Type, typename Action>
+struct SetLookupKernelTraits<Type, Action, enable_if_has_c_type<Type>> {
+  using KernelImpl = SetLookupKernelImpl<Type, typename Type::c_type, Action>;
+};
+
+template <typename Type, typename Action>
+struct SetLookupKernelTraits<Type, Action, enable_if_boolean<Type>> {
+  using KernelImpl = SetLookupKernelImpl<Type, bool, Action>;
+};
+
+template <typename Type, typename Action>
+struct SetLookupKernelTraits<Type, Action, enable_if_binary<Type>> {
+  using KernelImpl = SetLookupKernelImpl<Type, util::string_view, Action>;
+};
+
+template <typename Type, typename Action>
+struct SetLookupKernelTraits<Type, Action, enable_if_fixed_size_binary<Type>> {
+  using KernelImpl = SetLookupKernelImpl<Type, util::string_view, Action>;
+};
+
+template <typename Action>
+Status GetSetLookupKernel(const char* name, const Datum& member_set,
+                          std::unique_ptr<UnaryKernel>* out) {
+  if (!member_set.is_arraylike()) {
+    return Status::Invalid("Member set must be array-like");
+  }
+  const std::shared_ptr<DataType> type = member_set.type();
+  std::unique_ptr<UnaryKernel> kernel;
+
+#define SET_LOOKUP_CASE(InType)                                                   \
+  case InType::type_id: {                                                         \
+    using KernelImpl = typename SetLookupKernelTraits<InType, Action>::KernelImpl; \
+    std::unique_ptr<KernelImpl> impl(new KernelImpl(type));                       \
+    RETURN_NOT_OK(impl->Init(member_set));                                        \
+    kernel = std::move(impl);                                                     \
+  } break
+
+  switch (type->id()) {
+    SET_LOOKUP_CASE(BooleanType);
+    SET_LOOKUP_CASE(UInt8Type);
+    SET_LOOKUP_CASE(Int8Type);
+    SET_LOOKUP_CASE(UInt16Type);
+    SET_LOOKUP_CASE(Int16Type);
+    SET_LOOKUP_CASE(UInt32Type);
+    SET_LOOKUP_CASE(Int32Type);
+    SET_LOOKUP_CASE(UInt64Type);
+    SET_LOOKUP_CASE(Int64Type);
+    SET_LOOKUP_CASE(FloatType);
+    SET_LOOKUP_CASE(DoubleType);
+    SET_LOOKUP_CASE(Date32Type);
+    SET_LOOKUP_CASE(Date64Type);
+    SET_LOOKUP_CASE(Time32Type);
+    SET_LOOKUP_CASE(Time64Type);
+    SET_LOOKUP_CASE(TimestampType);
+    SET_LOOKUP_CASE(BinaryType);
+    SET_LOOKUP_CASE(StringType);
+    SET_LOOKUP_CASE(FixedSizeBinaryType);
+    SET_LOOKUP_CASE(Decimal128Type);
+    default:
+      break;
+  }
+
+#undef SET_LOOKUP_CASE
+
+  CHECK_IMPLEMENTED(kernel, name, type);
+  *out = std::move(kernel);
+  return Status::OK();
+}
+
+// Probe an array-like value against a set lookup kernel
+Status InvokeSetLookup(FunctionContext* ctx, UnaryKernel* kernel,
+                       const Datum& member_set, const Datum& values, Datum* out) {
+  if (!values.is_arraylike()) {
+    return Status::Invalid("Values must be array-like");
+  }
+  if (!values.type()->Equals(member_set.type())) {
+    return Status::TypeError("Values of type ", *values.type(),
+                             " looked up in a member set of type ", *member_set.type());
+  }
+  std::vector<Datum> outputs;
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, kernel, values, &outputs));
+  *out = detail::WrapDatumsLike(values, outputs);
+  return Status::OK();
+}
+
 }  // namespace
 
 Status GetUniqueKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
@@ -368,6 +678,60 @@ Status GetDictionaryEncodeKernel(FunctionContext* ctx,
   return Status::OK();
 }
 
+Status GetCountValuesKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                            std::unique_ptr<HashKernel>* out) {
+  std::unique_ptr<HashKernel> kernel;
+
+#define COUNT_VALUES_CASE(InType)                                                      \
+  case InType::type_id:                                                                \
+    kernel.reset(                                                                      \
+        new typename HashKernelTraits<InType, CountValuesAction>::HashKernelImpl(      \
+            type, ctx->memory_pool()));                                                \
+    break
+
+  switch (type->id()) {
+    COUNT_VALUES_CASE(BooleanType);
+    COUNT_VALUES_CASE(UInt8Type);
+    COUNT_VALUES_CASE(Int8Type);
+    COUNT_VALUES_CASE(UInt16Type);
+    COUNT_VALUES_CASE(Int16Type);
+    COUNT_VALUES_CASE(UInt32Type);
+    COUNT_VALUES_CASE(Int32Type);
+    COUNT_VALUES_CASE(UInt64Type);
+    COUNT_VALUES_CASE(Int64Type);
+    COUNT_VALUES_CASE(FloatType);
+    COUNT_VALUES_CASE(DoubleType);
+    COUNT_VALUES_CASE(Date32Type);
+    COUNT_VALUES_CASE(Date64Type);
+    COUNT_VALUES_CASE(Time32Type);
+    COUNT_VALUES_CASE(Time64Type);
+    COUNT_VALUES_CASE(TimestampType);
+    COUNT_VALUES_CASE(BinaryType);
+    COUNT_VALUES_CASE(StringType);
+    COUNT_VALUES_CASE(FixedSizeBinaryType);
+    COUNT_VALUES_CASE(Decimal128Type);
+    default:
+      break;
+  }
+
+#undef COUNT_VALUES_CASE
+
+  CHECK_IMPLEMENTED(kernel, "count-values", type);
+  RETURN_NOT_OK(kernel->Reset());
+  *out = std::move(kernel);
+  return Status::OK();
+}
+
+Status GetIsInKernel(FunctionContext* ctx, const Datum& member_set,
+                     std::unique_ptr<UnaryKernel>* kernel) {
+  return GetSetLookupKernel<IsInAction>("is-in", member_set, kernel);
+}
+
+Status GetMatchKernel(FunctionContext* ctx, const Datum& member_set,
+                      std::unique_ptr<UnaryKernel>* kernel) {
+  return GetSetLookupKernel<MatchAction>("match", member_set, kernel);
+}
+
 namespace {
 
 Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
@@ -381,23 +745,246 @@ Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
   return Status::OK();
 }
 
+// The dictionary entries used by dictionary-encoded values, in order of
+// first appearance.  Only the indices are hashed; the entries may still
+// repeat values, or be null.
+Status UsedDictionaryEntries(FunctionContext* ctx, const Datum& value,
+                             std::shared_ptr<Array>* used_indices,
+                             std::shared_ptr<Array>* used_values) {
+  const auto& dict_type = checked_cast<const DictionaryType&>(*value.type());
+  RETURN_NOT_OK(Unique(ctx, detail::DictionaryIndices(value), used_indices));
+  Datum values;
+  RETURN_NOT_OK(Take(ctx, dict_type.dictionary(), *used_indices, &values));
+  *used_values = values.make_array();
+  return Status::OK();
+}
+
+// Write the transposed values of dictionary indices, with 0 in null slots.
+// `out` may be the indices' own values.
+void RemapIndices(const ArrayData& indices, const int32_t* transpose, int32_t* out) {
+  const int32_t* in = indices.GetValues<int32_t>(1);
+  if (indices.GetNullCount() == 0) {
+    for (int64_t i = 0; i < indices.length; ++i) {
+      out[i] = transpose[in[i]];
+    }
+    return;
+  }
+  const uint8_t* validity = indices.buffers[0]->data();
+  for (int64_t i = 0; i < indices.length; ++i) {
+    out[i] = BitUtil::GetBit(validity, indices.offset + i) ? transpose[in[i]] : 0;
+  }
+}
+
+// The split of array-like values into parallel hash tasks, each hashing a
+// contiguous range of morsels with its own memo table
+struct HashTasks {
+  HashTasks(FunctionContext* ctx, const Datum& value) : type(value.type()), num_tasks(0) {
+    if (!ctx->use_threads()) {
+      return;
+    }
+    morsels = detail::SplitIntoMorsels(value, detail::kMorselLength);
+    num_tasks = static_cast<int>(
+        std::min<size_t>(internal::GetCpuThreadPool()->GetCapacity(), morsels.size()));
+  }
+
+  size_t begin(int task) const { return morsels.size() * task / num_tasks; }
+  size_t end(int task) const { return morsels.size() * (task + 1) / num_tasks; }
+
+  std::shared_ptr<ChunkedArray> Range(int task) const {
+    ArrayVector range(morsels.begin() + begin(task), morsels.begin() + end(task));
+    return std::make_shared<ChunkedArray>(range, type);
+  }
+
+  std::shared_ptr<DataType> type;
+  ArrayVector morsels;
+  int num_tasks;
+};
+
+// Dictionary-encode each task's range against a task-local memo table, then
+// merge the partial dictionaries in task order, which keeps the values in
+// order of first appearance, and remap the task-local indices.  The output
+// has one piece per morsel, or a single array for an array input.
+Status DictionaryEncodeParallel(FunctionContext* ctx, HashKernel* func,
+                                const Datum& value, const HashTasks& tasks,
+                                std::vector<Datum>* indices_outputs,
+                                std::shared_ptr<Array>* dictionary) {
+  MemoryPool* pool = ctx->memory_pool();
+  std::vector<std::vector<Datum>> task_indices(tasks.num_tasks);
+  std::vector<std::shared_ptr<Array>> partials(tasks.num_tasks);
+  RETURN_NOT_OK(internal::ParallelFor(tasks.num_tasks, [&](int task) -> Status {
+    FunctionContext task_ctx(pool);
+    std::unique_ptr<HashKernel> task_func;
+    RETURN_NOT_OK(GetDictionaryEncodeKernel(&task_ctx, tasks.type, &task_func));
+    return InvokeHash(&task_ctx, task_func.get(), tasks.Range(task),
+                      &task_indices[task], &partials[task]);
+  }));
+
+  // The global index of each task-local index
+  std::vector<Datum> transposes(tasks.num_tasks);
+  for (int task = 0; task < tasks.num_tasks; ++task) {
+    transposes[task].value = ArrayData::Make(int32(), partials[task]->length());
+    RETURN_NOT_OK(func->Call(ctx, partials[task], &transposes[task]));
+  }
+  std::shared_ptr<ArrayData> dict_data;
+  RETURN_NOT_OK(func->GetDictionary(&dict_data));
+  *dictionary = MakeArray(dict_data);
+
+  // An array input is encoded into a single array with the input's nulls.
+  // Otherwise, the indices of each morsel are remapped in place.
+  std::shared_ptr<Buffer> array_indices;
+  std::shared_ptr<Buffer> array_validity;
+  if (value.kind() == Datum::ARRAY) {
+    const ArrayData& input = *value.array();
+    RETURN_NOT_OK(AllocateBuffer(pool, input.length * sizeof(int32_t), &array_indices));
+    if (input.GetNullCount() > 0) {
+      RETURN_NOT_OK(internal::CopyBitmap(pool, input.buffers[0]->data(), input.offset,
+                                         input.length, &array_validity));
+    }
+  }
+
+  // The position of each morsel in an array input
+  std::vector<int64_t> starts(tasks.morsels.size(), 0);
+  for (size_t i = 1; i < starts.size(); ++i) {
+    starts[i] = starts[i - 1] + tasks.morsels[i - 1]->length();
+  }
+
+  RETURN_NOT_OK(internal::ParallelFor(tasks.num_tasks, [&](int task) -> Status {
+    const int32_t* transpose = transposes[task].array()->GetValues<int32_t>(1);
+    DCHECK_EQ(task_indices[task].size(), tasks.end(task) - tasks.begin(task));
+    for (size_t i = 0; i < task_indices[task].size(); ++i) {
+      ArrayData* indices = task_indices[task][i].array().get();
+      int32_t* out = indices->GetMutableValues<int32_t>(1);
+      if (array_indices) {
+        out = reinterpret_cast<int32_t*>(array_indices->mutable_data()) +
+              starts[tasks.begin(task) + i];
+      }
+      RemapIndices(*indices, transpose, out);
+    }
+    return Status::OK();
+  }));
+
+  if (value.kind() == Datum::ARRAY) {
+    const ArrayData& input = *value.array();
+    indices_outputs->emplace_back(ArrayData::Make(int32(), input.length,
+                                                  {array_validity, array_indices},
+                                                  input.GetNullCount()));
+  } else {
+    for (const auto& indices : task_indices) {
+      for (const Datum& datum : indices) {
+        indices_outputs->push_back(datum);
+      }
+    }
+  }
+  return Status::OK();
+}
+
+Status UniqueDictionary(FunctionContext* ctx, const Datum& value,
+                        std::shared_ptr<Array>* out) {
+  std::shared_ptr<Array> used_indices, used_values;
+  RETURN_NOT_OK(UsedDictionaryEntries(ctx, value, &used_indices, &used_values));
+  return Unique(ctx, used_values, out);
+}
+
+// Re-encode against a new dictionary holding the distinct values in use,
+// remapping the indices with a single Take
+Status DictionaryEncodeDictionary(FunctionContext* ctx, const Datum& value,
+                                  Datum* out) {
+  const auto& dict_type = checked_cast<const DictionaryType&>(*value.type());
+  std::shared_ptr<Array> used_indices, used_values;
+  RETURN_NOT_OK(UsedDictionaryEntries(ctx, value, &used_indices, &used_values));
+
+  std::unique_ptr<HashKernel> func;
+  RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, used_values->type(), &func));
+  std::shared_ptr<Array> dictionary;
+  std::vector<Datum> memo_indices;
+  RETURN_NOT_OK(InvokeHash(ctx, func.get(), used_values, &memo_indices, &dictionary));
+  const auto memo_array = memo_indices[0].make_array();
+  const auto& new_indices = checked_cast<const Int32Array&>(*memo_array);
+
+  // Map each old dictionary index to its new index
+  Datum old_indices;
+  RETURN_NOT_OK(Cast(ctx, used_indices, int64(), CastOptions(), &old_indices));
+  const int64_t* old_index_values = old_indices.array()->GetValues<int64_t>(1);
+  const int64_t dictionary_length = dict_type.dictionary()->length();
+  std::vector<int32_t> transpose(dictionary_length, 0);
+  std::vector<uint8_t> transpose_valid(dictionary_length, 0);
+  for (int64_t i = 0; i < used_indices->length(); ++i) {
+    if (used_indices->IsValid(i) && new_indices.IsValid(i)) {
+      transpose[old_index_values[i]] = new_indices.Value(i);
+      transpose_valid[old_index_values[i]] = 1;
+    }
+  }
+  Int32Builder builder(ctx->memory_pool());
+  RETURN_NOT_OK(
+      builder.AppendValues(transpose.data(), dictionary_length, transpose_valid.data()));
+  std::shared_ptr<Array> transpose_array;
+  RETURN_NOT_OK(builder.Finish(&transpose_array));
+
+  Datum indices;
+  RETURN_NOT_OK(
+      Take(ctx, transpose_array, detail::DictionaryIndices(value), &indices));
+  auto out_type = ::arrow::dictionary(int32(), dictionary);
+  std::vector<std::shared_ptr<Array>> dict_chunks;
+  if (indices.kind() == Datum::ARRAY) {
+    dict_chunks.push_back(
+        std::make_shared<DictionaryArray>(out_type, indices.make_array()));
+  } else {
+    for (const auto& chunk : indices.chunked_array()->chunks()) {
+      dict_chunks.push_back(std::make_shared<DictionaryArray>(out_type, chunk));
+    }
+  }
+  *out = detail::WrapArraysLike(value, dict_chunks);
+  return Status::OK();
+}
+
 }  // namespace
 
 Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>* out) {
+  if (value.is_arraylike() && value.type()->id() == Type::DICTIONARY) {
+    return UniqueDictionary(ctx, value, out);
+  }
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetUniqueKernel(ctx, value.type(), &func));
 
   std::vector<Datum> dummy_outputs;
-  return InvokeHash(ctx, func.get(), value, &dummy_outputs, out);
+  const HashTasks tasks(ctx, value);
+  if (tasks.num_tasks < 2) {
+    return InvokeHash(ctx, func.get(), value, &dummy_outputs, out);
+  }
+
+  // Each task hashes a contiguous range of morsels into a partial dictionary
+  std::vector<std::shared_ptr<Array>> partials(tasks.num_tasks);
+  RETURN_NOT_OK(internal::ParallelFor(tasks.num_tasks, [&](int task) -> Status {
+    FunctionContext task_ctx(ctx->memory_pool());
+    std::unique_ptr<HashKernel> task_func;
+    RETURN_NOT_OK(GetUniqueKernel(&task_ctx, value.type(), &task_func));
+    std::vector<Datum> task_outputs;
+    return InvokeHash(&task_ctx, task_func.get(), tasks.Range(task), &task_outputs,
+                      &partials[task]);
+  }));
+
+  // Merging the partial dictionaries in task order keeps the values in
+  // order of first appearance
+  return InvokeHash(ctx, func.get(), std::make_shared<ChunkedArray>(partials),
+                    &dummy_outputs, out);
 }
 
 Status DictionaryEncode(FunctionContext* ctx, const Datum& value, Datum* out) {
+  if (value.is_arraylike() && value.type()->id() == Type::DICTIONARY) {
+    return DictionaryEncodeDictionary(ctx, value, out);
+  }
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, value.type(), &func));
 
   std::shared_ptr<Array> dictionary;
   std::vector<Datum> indices_outputs;
-  RETURN_NOT_OK(InvokeHash(ctx, func.get(), value, &indices_outputs, &dictionary));
+  const HashTasks tasks(ctx, value);
+  if (tasks.num_tasks < 2) {
+    RETURN_NOT_OK(InvokeHash(ctx, func.get(), value, &indices_outputs, &dictionary));
+  } else {
+    RETURN_NOT_OK(DictionaryEncodeParallel(ctx, func.get(), value, tasks,
+                                           &indices_outputs, &dictionary));
+  }
 
   // Create the dictionary type
   DCHECK_EQ(indices_outputs[0].kind(), Datum::ARRAY);
@@ -415,5 +1002,44 @@ Status DictionaryEncode(FunctionContext* ctx, const Datum& value, Datum* out) {
   return Status::OK();
 }
 
+Status Match(FunctionContext* ctx, const Datum& values, const Datum& member_set,
+             Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(GetMatchKernel(ctx, member_set, &kernel));
+  return InvokeSetLookup(ctx, kernel.get(), member_set, values, out);
+}
+
+Status IsIn(FunctionContext* ctx, const Datum& values, const Datum& member_set,
+            Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(GetIsInKernel(ctx, member_set, &kernel));
+  return InvokeSetLookup(ctx, kernel.get(), member_set, values, out);
+}
+
+Status CountValues(FunctionContext* ctx, const Datum& values,
+                   std::shared_ptr<Array>* out_uniques,
+                   std::shared_ptr<Array>* out_counts) {
+  if (!values.is_arraylike()) {
+    return Status::Invalid("Values must be array-like");
+  }
+  std::unique_ptr<HashKernel> kernel;
+  RETURN_NOT_OK(GetCountValuesKernel(ctx, values.type(), &kernel));
+  if (values.kind() == Datum::ARRAY) {
+    RETURN_NOT_OK(kernel->Append(ctx, *values.array()));
+  } else {
+    for (const auto& chunk : values.chunked_array()->chunks()) {
+      RETURN_NOT_OK(kernel->Append(ctx, *chunk->data()));
+    }
+  }
+
+  Datum counts;
+  RETURN_NOT_OK(kernel->Flush(&counts));
+  std::shared_ptr<ArrayData> uniques;
+  RETURN_NOT_OK(kernel->GetDictionary(&uniques));
+  *out_uniques = MakeArray(uniques);
+  *out_counts = counts.make_array();
+  return Status::OK();
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -57,6 +57,12 @@ Status GetDictionaryEncodeKernel(FunctionContext* ctx,
                                  std::unique_ptr<HashKernel>* kernel);
 
 /// \brief Compute unique elements from an array-like object
+///
+/// Values are returned in order of first appearance.  If the context
+/// enables threads, ranges of the input are hashed concurrently and
+/// their partial results merged.  For dictionary-encoded input, only the
+/// indices are hashed, then the dictionary entries they use.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] datum array-like input
 /// \param[out] out result as Array
@@ -67,6 +73,11 @@ ARROW_EXPORT
 Status Unique(FunctionContext* context, const Datum& datum, std::shared_ptr<Array>* out);
 
 /// \brief Dictionary-encode values in an array-like object
+///
+/// Dictionary-encoded input is re-encoded without decoding it: the result
+/// has a dictionary of the distinct values in use, in order of first
+/// appearance, as if the decoded values had been encoded.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] data array-like input
 /// \param[out] out result with same shape and type as input
@@ -91,19 +102,86 @@ Status DictionaryEncode(FunctionContext* context, const Datum& data, Datum* out)
 // Status DictionaryEncode(FunctionContext* context, const Datum& data,
 //                         const Array& prior_dictionary, Datum* out);
 
-// TODO(wesm): Implement these next
-// ARROW_EXPORT
-// Status Match(FunctionContext* context, const Datum& values, const Datum& member_set,
-//              Datum* out);
+/// \brief Get a kernel testing values for membership in a set
+///
+/// The member set is hashed once; the kernel can then probe any number
+/// of arrays of the same type, concurrently if need be.  See IsIn() for
+/// the output.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetIsInKernel(FunctionContext* ctx, const Datum& member_set,
+                     std::unique_ptr<UnaryKernel>* kernel);
 
-// ARROW_EXPORT
-// Status IsIn(FunctionContext* context, const Datum& values, const Datum& member_set,
-//             Datum* out);
+/// \brief Get a kernel locating values in a set
+///
+/// Like GetIsInKernel(), with the output of Match().
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetMatchKernel(FunctionContext* ctx, const Datum& member_set,
+                      std::unique_ptr<UnaryKernel>* kernel);
 
-// ARROW_EXPORT
-// Status CountValues(FunctionContext* context, const Datum& values,
-//                    std::shared_ptr<Array>* out_uniques,
-//                    std::shared_ptr<Array>* out_counts);
+/// \brief Get a kernel counting distinct values
+///
+/// After appending any number of arrays, Flush() yields the int64 counts
+/// of the values appended so far and GetDictionary() the values counted,
+/// in order of first appearance.  Nulls are not counted.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status GetCountValuesKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                            std::unique_ptr<HashKernel>* kernel);
+
+/// \brief Locate values in a set
+///
+/// The result is an int32 array-like value with, for each value, the
+/// position of its first occurrence in `member_set`, or null if it does
+/// not occur.  Null values (and null members) never match.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like values to look up
+/// \param[in] member_set array-like set of values of the same type
+/// \param[out] out resulting datum, with the same shape as values
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Match(FunctionContext* context, const Datum& values, const Datum& member_set,
+             Datum* out);
+
+/// \brief Test values for membership in a set
+///
+/// The result is a boolean array-like value, true where a value occurs in
+/// `member_set`.  It is null where the value is null.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like values to look up
+/// \param[in] member_set array-like set of values of the same type
+/// \param[out] out resulting datum, with the same shape as values
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status IsIn(FunctionContext* context, const Datum& values, const Datum& member_set,
+            Datum* out);
+
+/// \brief Count the occurrences of distinct values
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like input
+/// \param[out] out_uniques distinct non-null values, in order of first appearance
+/// \param[out] out_counts int64 number of occurrences of each distinct value
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status CountValues(FunctionContext* context, const Datum& values,
+                   std::shared_ptr<Array>* out_uniques,
+                   std::shared_ptr<Array>* out_counts);
 
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,200 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/thread-pool.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/join.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test-util.h"
+
+using std::shared_ptr;
+using std::vector;
+
+using arrow::internal::checked_cast;
+
+namespace arrow {
+namespace compute {
+
+class TestHashJoin : public ComputeFixture, public ::testing::Test {
+ protected:
+  void AssertJoin(JoinType type, const vector<Datum>& left, const vector<Datum>& right,
+                  const std::string& expected_left, const std::string& expected_right) {
+    for (bool use_threads : {false, true}) {
+      HashJoinOptions options;
+      options.type = type;
+      options.use_threads = use_threads;
+      Datum left_indices, right_indices;
+      ASSERT_OK(HashJoin(&ctx_, left, right, options, &left_indices, &right_indices));
+      AssertArraysEqual(*ArrayFromJSON(int64(), expected_left),
+                        *left_indices.make_array());
+      if (type == JoinType::LEFT_SEMI) {
+        ASSERT_EQ(right_indices.kind(), Datum::NONE);
+      } else {
+        AssertArraysEqual(*ArrayFromJSON(int64(), expected_right),
+                          *right_indices.make_array());
+      }
+    }
+  }
+};
+
+TEST_F(TestHashJoin, Inner) {
+  auto left = ArrayFromJSON(int32(), "[1, 2, null, 3, 2]");
+  auto right = ArrayFromJSON(int32(), "[2, 4, null, 1, 2, 5]");
+  // Null keys never match
+  AssertJoin(JoinType::INNER, {left}, {right}, "[0, 1, 1, 4, 4]", "[3, 0, 4, 0, 4]");
+  // Building over the smaller left side gives the same order
+  AssertJoin(JoinType::INNER, {right}, {left}, "[0, 0, 3, 4, 4]", "[1, 4, 0, 1, 4]");
+  AssertJoin(JoinType::INNER, {left}, {ArrayFromJSON(int32(), "[]")}, "[]", "[]");
+}
+
+TEST_F(TestHashJoin, LeftOuter) {
+  auto left = ArrayFromJSON(utf8(), R"(["a", null, "b", "c", "a"])");
+  auto right = ArrayFromJSON(utf8(), R"(["c", "a", "", "a"])");
+  AssertJoin(JoinType::LEFT_OUTER, {left}, {right}, "[0, 0, 1, 2, 3, 4, 4]",
+             "[1, 3, null, null, 0, 1, 3]");
+}
+
+TEST_F(TestHashJoin, LeftSemi) {
+  auto left = ArrayFromJSON(int64(), "[5, 6, 7, 5, null]");
+  auto right = ArrayFromJSON(int64(), "[5, 5, 7, null]");
+  AssertJoin(JoinType::LEFT_SEMI, {left}, {right}, "[0, 2, 3]", "");
+}
+
+TEST_F(TestHashJoin, MultipleKeys) {
+  // Chunked keys needn't have the same chunk layout
+  auto left_a = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(utf8(), R"(["x", "y"])"),
+                  ArrayFromJSON(utf8(), R"(["x", "xy", ""])")});
+  auto left_b = ArrayFromJSON(boolean(), "[true, false, false, true, null]");
+  auto right_a = ArrayFromJSON(utf8(), R"(["", "x", "xy", "x", "y"])");
+  auto right_b = ArrayFromJSON(boolean(), "[null, true, true, false, false]");
+  AssertJoin(JoinType::INNER, {left_a, left_b}, {right_a, right_b}, "[0, 1, 2, 3]",
+             "[1, 4, 3, 2]");
+}
+
+TEST_F(TestHashJoin, Take) {
+  auto left = ArrayFromJSON(int16(), "[3, 1, 2]");
+  auto right_key = ArrayFromJSON(int16(), "[1, 3, 3]");
+  auto right_value = ArrayFromJSON(utf8(), R"(["one", "three", "drei"])");
+  Datum left_indices, right_indices;
+  HashJoinOptions options;
+  options.type = JoinType::LEFT_OUTER;
+  ASSERT_OK(HashJoin(&ctx_, {left}, {right_key}, options, &left_indices, &right_indices));
+
+  Datum keys, values;
+  ASSERT_OK(Take(&ctx_, left, left_indices, &keys));
+  ASSERT_OK(Take(&ctx_, right_value, right_indices, &values));
+  AssertArraysEqual(*ArrayFromJSON(int16(), "[3, 3, 1, 2]"), *keys.make_array());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["three", "drei", "one", null])"),
+                    *values.make_array());
+}
+
+TEST_F(TestHashJoin, Random) {
+  auto rand = random::RandomArrayGenerator(0x701e);
+  const int64_t left_length = 150000;
+  const int64_t right_length = 3000;
+  auto left = std::make_shared<ChunkedArray>(
+      ArrayVector{rand.Int32(left_length / 2, 0, 5000, 0.05),
+                  rand.Int32(left_length / 2, 0, 5000, 0.05)});
+  auto right = rand.Int32(right_length, 0, 5000, 0.05);
+  const auto& right_values = checked_cast<const Int32Array&>(*right);
+  std::unordered_map<int32_t, vector<int64_t>> right_rows_by_key;
+  for (int64_t j = 0; j < right_length; ++j) {
+    if (right_values.IsValid(j)) {
+      right_rows_by_key[right_values.Value(j)].push_back(j);
+    }
+  }
+
+  // Make sure several partitions and tasks are used even on small machines
+  const int saved_capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(4));
+
+  for (auto type : {JoinType::INNER, JoinType::LEFT_OUTER}) {
+    HashJoinOptions options;
+    options.type = type;
+    Datum left_indices, right_indices;
+    ASSERT_OK(HashJoin(&ctx_, {left}, {right}, options, &left_indices, &right_indices));
+    const auto left_result = left_indices.make_array();
+    const auto right_result = right_indices.make_array();
+    const auto& left_rows = checked_cast<const Int64Array&>(*left_result);
+    const auto& right_rows = checked_cast<const Int64Array&>(*right_result);
+
+    // Brute-force the expected pairs
+    int64_t position = 0;
+    int64_t row = 0;
+    for (const auto& chunk : left->chunks()) {
+      const auto& left_values = checked_cast<const Int32Array&>(*chunk);
+      for (int64_t i = 0; i < chunk->length(); ++i, ++row) {
+        bool matched = false;
+        if (left_values.IsValid(i)) {
+          for (int64_t j : right_rows_by_key[left_values.Value(i)]) {
+            ASSERT_LT(position, left_rows.length());
+            ASSERT_EQ(left_rows.Value(position), row);
+            ASSERT_EQ(right_rows.Value(position), j);
+            ++position;
+            matched = true;
+          }
+        }
+        if (!matched && type == JoinType::LEFT_OUTER) {
+          ASSERT_EQ(left_rows.Value(position), row);
+          ASSERT_TRUE(right_rows.IsNull(position));
+          ++position;
+        }
+      }
+    }
+    ASSERT_EQ(position, left_rows.length());
+  }
+  ASSERT_OK(SetCpuThreadPoolCapacity(saved_capacity));
+}
+
+TEST_F(TestHashJoin, Errors) {
+  auto keys = ArrayFromJSON(int32(), "[1, 2]");
+  Datum left_indices, right_indices;
+  auto options = HashJoinOptions::Defaults();
+
+  ASSERT_RAISES(Invalid, HashJoin(&ctx_, {}, {}, options, &left_indices, &right_indices));
+  ASSERT_RAISES(Invalid,
+                HashJoin(&ctx_, {keys}, {keys, keys}, options, &left_indices,
+                         &right_indices));
+  ASSERT_RAISES(Invalid, HashJoin(&ctx_, {keys, ArrayFromJSON(int32(), "[1]")},
+                                  {keys, keys}, options, &left_indices, &right_indices));
+  ASSERT_RAISES(TypeError, HashJoin(&ctx_, {keys}, {ArrayFromJSON(int64(), "[1]")},
+                                    options, &left_indices, &right_indices));
+  auto lists = ArrayFromJSON(list(int32()), "[[1]]");
+  ASSERT_RAISES(NotImplemented, HashJoin(&ctx_, {lists}, {lists}, options, &left_indices,
+                                         &right_indices));
+}
+
+}  // namespace compute
+}  // namespace arrow
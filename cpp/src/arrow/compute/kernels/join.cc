@@ -0,0 +1,490 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/join.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::GetCpuThreadPool;
+
+namespace compute {
+
+HashJoinOptions HashJoinOptions::Defaults() { return HashJoinOptions(); }
+
+namespace {
+
+// Maximum number of rows encoded at once
+constexpr int64_t kJoinBatchSize = 1 << 16;
+
+Status RunTasks(int num_tasks, const std::function<Status(int)>& task) {
+  if (num_tasks == 1) {
+    return task(0);
+  }
+  return internal::ParallelFor(num_tasks, task);
+}
+
+// ----------------------------------------------------------------------
+// The key columns of one join side
+
+struct JoinBatch {
+  size_t chunk;
+  int64_t offset, length;
+  // Index of the first row of the batch in the whole side
+  int64_t start;
+};
+
+struct JoinSide {
+  // Key columns, chunked identically
+  std::vector<ArrayVector> columns;
+  int64_t length = 0;
+  std::vector<JoinBatch> batches;
+
+  std::vector<std::shared_ptr<ArrayData>> batch_columns(const JoinBatch& batch) const {
+    std::vector<std::shared_ptr<ArrayData>> out;
+    for (const auto& column : columns) {
+      out.push_back(column[batch.chunk]->Slice(batch.offset, batch.length)->data());
+    }
+    return out;
+  }
+};
+
+Status MakeJoinSide(const std::vector<Datum>& keys, JoinSide* out) {
+  for (const auto& key : keys) {
+    if (!key.is_arraylike()) {
+      return Status::Invalid("HashJoin keys must be array-like");
+    }
+    int64_t length;
+    if (key.is_array()) {
+      out->columns.push_back({key.make_array()});
+      length = key.array()->length;
+    } else {
+      out->columns.push_back(key.chunked_array()->chunks());
+      length = key.chunked_array()->length();
+    }
+    if (out->columns.size() > 1 && length != out->length) {
+      return Status::Invalid("HashJoin keys of one side must have the same length");
+    }
+    out->length = length;
+  }
+  out->columns = internal::RechunkArraysConsistently(out->columns);
+
+  int64_t start = 0;
+  for (size_t chunk = 0; chunk < out->columns[0].size(); ++chunk) {
+    const int64_t chunk_length = out->columns[0][chunk]->length();
+    for (int64_t offset = 0; offset < chunk_length; offset += kJoinBatchSize) {
+      const int64_t length = std::min(kJoinBatchSize, chunk_length - offset);
+      out->batches.push_back({chunk, offset, length, start});
+      start += length;
+    }
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Row-wise encoding of keys into byte strings, equal iff the keys are
+
+struct KeyColumnLayout {
+  enum Kind { FIXED, BOOLEAN, BINARY };
+  Kind kind;
+  int byte_width;
+};
+
+Status GetKeyColumnLayout(const DataType& type, KeyColumnLayout* out) {
+  if (type.id() == Type::BOOL) {
+    *out = {KeyColumnLayout::BOOLEAN, 1};
+  } else if (type.id() == Type::BINARY || type.id() == Type::STRING) {
+    *out = {KeyColumnLayout::BINARY, 0};
+  } else if (is_fixed_width(type.id()) && type.id() != Type::NA &&
+             type.id() != Type::DICTIONARY) {
+    const int bit_width = checked_cast<const FixedWidthType&>(type).bit_width();
+    DCHECK_EQ(bit_width % 8, 0);
+    *out = {KeyColumnLayout::FIXED, bit_width / 8};
+  } else {
+    return Status::NotImplemented("HashJoin keys of type ", type);
+  }
+  return Status::OK();
+}
+
+class KeyEncoder {
+ public:
+  explicit KeyEncoder(const std::vector<KeyColumnLayout>& layouts) : layouts_(layouts) {}
+
+  // Encode the keys of a batch, given as one array per key column.
+  // Fixed-width keys come first in each row, then length-prefixed binary keys.
+  void Encode(const std::vector<std::shared_ptr<ArrayData>>& columns) {
+    const int64_t length = columns[0]->length;
+    int32_t fixed_length = 0;
+    for (const auto& layout : layouts_) {
+      if (layout.kind != KeyColumnLayout::BINARY) {
+        fixed_length += layout.byte_width;
+      } else {
+        fixed_length += static_cast<int32_t>(sizeof(int32_t));
+      }
+    }
+
+    offsets_.assign(length + 1, fixed_length);
+    offsets_[0] = 0;
+    for (size_t k = 0; k < layouts_.size(); ++k) {
+      if (layouts_[k].kind == KeyColumnLayout::BINARY) {
+        const int32_t* value_offsets = columns[k]->GetValues<int32_t>(1);
+        for (int64_t i = 0; i < length; ++i) {
+          offsets_[i + 1] += value_offsets[i + 1] - value_offsets[i];
+        }
+      }
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_[i + 1] += offsets_[i];
+    }
+    keys_.resize(offsets_[length]);
+    valid_.assign(length, 1);
+
+    uint8_t* keys = keys_.data();
+    int32_t fixed_position = 0;
+    for (size_t k = 0; k < layouts_.size(); ++k) {
+      const ArrayData& column = *columns[k];
+      if (column.GetNullCount() > 0) {
+        const uint8_t* bitmap = column.buffers[0]->data();
+        for (int64_t i = 0; i < length; ++i) {
+          valid_[i] &= BitUtil::GetBit(bitmap, column.offset + i);
+        }
+      }
+      switch (layouts_[k].kind) {
+        case KeyColumnLayout::FIXED: {
+          const int byte_width = layouts_[k].byte_width;
+          const uint8_t* values =
+              column.buffers[1]->data() + column.offset * byte_width;
+          for (int64_t i = 0; i < length; ++i) {
+            std::memcpy(keys + offsets_[i] + fixed_position, values + i * byte_width,
+                        byte_width);
+          }
+          fixed_position += byte_width;
+        } break;
+        case KeyColumnLayout::BOOLEAN: {
+          const uint8_t* values = column.buffers[1]->data();
+          for (int64_t i = 0; i < length; ++i) {
+            keys[offsets_[i] + fixed_position] =
+                BitUtil::GetBit(values, column.offset + i) ? 1 : 0;
+          }
+          fixed_position += 1;
+        } break;
+        case KeyColumnLayout::BINARY:
+          break;
+      }
+    }
+
+    // Binary keys are appended after the fixed-width part
+    cursors_.resize(length);
+    for (int64_t i = 0; i < length; ++i) {
+      cursors_[i] = offsets_[i] + fixed_position;
+    }
+    for (size_t k = 0; k < layouts_.size(); ++k) {
+      if (layouts_[k].kind != KeyColumnLayout::BINARY) {
+        continue;
+      }
+      const ArrayData& column = *columns[k];
+      const int32_t* value_offsets = column.GetValues<int32_t>(1);
+      const uint8_t* data = column.buffers[2] ? column.buffers[2]->data() : NULLPTR;
+      for (int64_t i = 0; i < length; ++i) {
+        const int32_t value_length = value_offsets[i + 1] - value_offsets[i];
+        std::memcpy(keys + cursors_[i], &value_length, sizeof(int32_t));
+        if (value_length > 0) {
+          std::memcpy(keys + cursors_[i] + sizeof(int32_t), data + value_offsets[i],
+                      value_length);
+        }
+        cursors_[i] += static_cast<int32_t>(sizeof(int32_t)) + value_length;
+      }
+    }
+
+    hashes_.resize(length);
+    for (int64_t i = 0; i < length; ++i) {
+      hashes_[i] = internal::ComputeStringHash<0>(key(i), key_length(i));
+    }
+  }
+
+  // Whether no key of the row is null
+  bool is_valid(int64_t i) const { return valid_[i] != 0; }
+  const uint8_t* key(int64_t i) const { return keys_.data() + offsets_[i]; }
+  int32_t key_length(int64_t i) const { return offsets_[i + 1] - offsets_[i]; }
+  internal::hash_t hash(int64_t i) const { return hashes_[i]; }
+
+ private:
+  std::vector<KeyColumnLayout> layouts_;
+  std::vector<uint8_t> keys_;
+  std::vector<int32_t> offsets_;
+  std::vector<int32_t> cursors_;
+  std::vector<uint8_t> valid_;
+  std::vector<internal::hash_t> hashes_;
+};
+
+// ----------------------------------------------------------------------
+// Build side hash table, partitioned by hash
+
+class JoinHashTable {
+ public:
+  JoinHashTable(const std::vector<KeyColumnLayout>& layouts, int num_partitions)
+      : layouts_(layouts), partitions_(num_partitions) {}
+
+  Status Build(const JoinSide& side) {
+    const int num_batches = static_cast<int>(side.batches.size());
+    std::vector<KeyEncoder> encoded(num_batches, KeyEncoder(layouts_));
+    RETURN_NOT_OK(RunTasks(std::max(num_batches, 1), [&](int i) {
+      if (i < num_batches) {
+        encoded[i].Encode(side.batch_columns(side.batches[i]));
+      }
+      return Status::OK();
+    }));
+
+    // Each partition inserts its rows in order, so that the row lists of
+    // equal keys are ordered
+    next_.assign(side.length, -1);
+    const int num_partitions = static_cast<int>(partitions_.size());
+    return RunTasks(num_partitions, [&](int p) {
+      Partition& partition = partitions_[p];
+      for (int b = 0; b < num_batches; ++b) {
+        const KeyEncoder& keys = encoded[b];
+        const int64_t start = side.batches[b].start;
+        for (int64_t i = 0; i < side.batches[b].length; ++i) {
+          if (!keys.is_valid(i) || PartitionOf(keys.hash(i)) != p) {
+            continue;
+          }
+          const int64_t row = start + i;
+          auto on_found = [&](int32_t memo_index) {
+            next_[partition.tails[memo_index]] = row;
+            partition.tails[memo_index] = row;
+          };
+          auto on_not_found = [&](int32_t memo_index) {
+            partition.heads.push_back(row);
+            partition.tails.push_back(row);
+          };
+          partition.memo.GetOrInsert(keys.key(i), keys.key_length(i), on_found,
+                                     on_not_found);
+        }
+      }
+      return Status::OK();
+    });
+  }
+
+  // The first build row matching row i of the encoded keys, or -1
+  int64_t Find(const KeyEncoder& keys, int64_t i) const {
+    if (!keys.is_valid(i)) {
+      return -1;
+    }
+    const Partition& partition = partitions_[PartitionOf(keys.hash(i))];
+    const int32_t memo_index = partition.memo.Get(keys.key(i), keys.key_length(i));
+    return memo_index == -1 ? -1 : partition.heads[memo_index];
+  }
+
+  // The build row after `row` with the same key, or -1
+  int64_t Next(int64_t row) const { return next_[row]; }
+
+ private:
+  struct Partition {
+    internal::BinaryMemoTable memo;
+    // First and last build rows of each memo entry
+    std::vector<int64_t> heads, tails;
+  };
+
+  int PartitionOf(internal::hash_t hash) const {
+    // The memo tables use the low bits
+    return static_cast<int>((hash >> 32) % partitions_.size());
+  }
+
+  std::vector<KeyColumnLayout> layouts_;
+  std::vector<Partition> partitions_;
+  // Build rows chained by key, in order
+  std::vector<int64_t> next_;
+};
+
+// ----------------------------------------------------------------------
+// Assembling the result
+
+Status MakeIndices(MemoryPool* pool, const std::vector<std::vector<int64_t>>& parts,
+                   Datum* out) {
+  int64_t length = 0;
+  for (const auto& part : parts) {
+    length += static_cast<int64_t>(part.size());
+  }
+  std::shared_ptr<Buffer> values;
+  RETURN_NOT_OK(AllocateBuffer(pool, length * sizeof(int64_t), &values));
+  auto out_values = reinterpret_cast<int64_t*>(values->mutable_data());
+  for (const auto& part : parts) {
+    out_values = std::copy(part.begin(), part.end(), out_values);
+  }
+  out_values = reinterpret_cast<int64_t*>(values->mutable_data());
+
+  // Missing rows are null
+  std::shared_ptr<Buffer> null_bitmap;
+  int64_t null_count = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    null_count += out_values[i] < 0;
+  }
+  if (null_count > 0) {
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool, length, &null_bitmap));
+    uint8_t* bitmap = null_bitmap->mutable_data();
+    for (int64_t i = 0; i < length; ++i) {
+      if (out_values[i] >= 0) {
+        BitUtil::SetBit(bitmap, i);
+      } else {
+        out_values[i] = 0;
+      }
+    }
+  }
+  out->value = ArrayData::Make(int64(), length, {null_bitmap, values}, null_count);
+  return Status::OK();
+}
+
+// Stable counting sort of the pairs by first row index
+void SortPairs(int64_t num_rows, std::vector<int64_t>* first,
+               std::vector<int64_t>* second) {
+  std::vector<int64_t> offsets(num_rows + 1, 0);
+  for (int64_t row : *first) {
+    ++offsets[row + 1];
+  }
+  for (int64_t i = 0; i < num_rows; ++i) {
+    offsets[i + 1] += offsets[i];
+  }
+  std::vector<int64_t> sorted_first(first->size()), sorted_second(second->size());
+  for (size_t i = 0; i < first->size(); ++i) {
+    const int64_t position = offsets[(*first)[i]]++;
+    sorted_first[position] = (*first)[i];
+    sorted_second[position] = (*second)[i];
+  }
+  *first = std::move(sorted_first);
+  *second = std::move(sorted_second);
+}
+
+}  // namespace
+
+Status HashJoin(FunctionContext* ctx, const std::vector<Datum>& left_keys,
+                const std::vector<Datum>& right_keys, const HashJoinOptions& options,
+                Datum* left_indices, Datum* right_indices) {
+  if (left_keys.empty() || left_keys.size() != right_keys.size()) {
+    return Status::Invalid("HashJoin needs the same, non-zero number of keys per side");
+  }
+  std::vector<KeyColumnLayout> layouts(left_keys.size());
+  for (size_t k = 0; k < left_keys.size(); ++k) {
+    if (!left_keys[k].is_arraylike() || !right_keys[k].is_arraylike()) {
+      return Status::Invalid("HashJoin keys must be array-like");
+    }
+    if (!left_keys[k].type()->Equals(right_keys[k].type())) {
+      return Status::TypeError("HashJoin keys have different types: ",
+                               *left_keys[k].type(), " and ", *right_keys[k].type());
+    }
+    RETURN_NOT_OK(GetKeyColumnLayout(*left_keys[k].type(), &layouts[k]));
+  }
+
+  JoinSide left, right;
+  RETURN_NOT_OK(MakeJoinSide(left_keys, &left));
+  RETURN_NOT_OK(MakeJoinSide(right_keys, &right));
+
+  // Inner joins build over the smaller side, the others over the right side
+  const bool build_left = options.type == JoinType::INNER && left.length < right.length;
+  const JoinSide& build = build_left ? left : right;
+  const JoinSide& probe = build_left ? right : left;
+
+  const int capacity = options.use_threads ? GetCpuThreadPool()->GetCapacity() : 1;
+  JoinHashTable table(layouts, std::max(capacity, 1));
+  RETURN_NOT_OK(table.Build(build));
+
+  // Each task probes a contiguous range of batches, so that concatenating
+  // the results in order keeps them ordered by probe row
+  const int num_batches = static_cast<int>(probe.batches.size());
+  const int num_tasks = std::max(1, std::min(capacity, num_batches));
+  std::vector<std::vector<int64_t>> probe_rows(num_tasks), build_rows(num_tasks);
+  RETURN_NOT_OK(RunTasks(num_tasks, [&](int task) {
+    KeyEncoder keys(layouts);
+    auto& task_probe_rows = probe_rows[task];
+    auto& task_build_rows = build_rows[task];
+    const int begin = num_batches * task / num_tasks;
+    const int end = num_batches * (task + 1) / num_tasks;
+    for (int b = begin; b < end; ++b) {
+      const JoinBatch& batch = probe.batches[b];
+      keys.Encode(probe.batch_columns(batch));
+      for (int64_t i = 0; i < batch.length; ++i) {
+        const int64_t row = batch.start + i;
+        int64_t match = table.Find(keys, i);
+        switch (options.type) {
+          case JoinType::LEFT_SEMI:
+            if (match != -1) {
+              task_probe_rows.push_back(row);
+            }
+            break;
+          case JoinType::LEFT_OUTER:
+            if (match == -1) {
+              task_probe_rows.push_back(row);
+              task_build_rows.push_back(-1);
+            }
+          // Fall through
+          case JoinType::INNER:
+            for (; match != -1; match = table.Next(match)) {
+              task_probe_rows.push_back(row);
+              task_build_rows.push_back(match);
+            }
+            break;
+        }
+      }
+    }
+    return Status::OK();
+  }));
+
+  MemoryPool* pool = ctx->memory_pool();
+  if (options.type == JoinType::LEFT_SEMI) {
+    return MakeIndices(pool, probe_rows, left_indices);
+  }
+  if (build_left) {
+    // Order the pairs by left row
+    std::vector<std::vector<int64_t>> left_rows(1), right_rows(1);
+    for (int task = 0; task < num_tasks; ++task) {
+      right_rows[0].insert(right_rows[0].end(), probe_rows[task].begin(),
+                           probe_rows[task].end());
+      left_rows[0].insert(left_rows[0].end(), build_rows[task].begin(),
+                          build_rows[task].end());
+    }
+    SortPairs(left.length, &left_rows[0], &right_rows[0]);
+    RETURN_NOT_OK(MakeIndices(pool, left_rows, left_indices));
+    return MakeIndices(pool, right_rows, right_indices);
+  }
+  RETURN_NOT_OK(MakeIndices(pool, probe_rows, left_indices));
+  return MakeIndices(pool, build_rows, right_indices);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_JOIN_H
+#define ARROW_COMPUTE_KERNELS_JOIN_H
+
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+enum class JoinType {
+  /// Pairs of matching left and right rows
+  INNER,
+  /// Like INNER, plus unmatched left rows paired with a null right index
+  LEFT_OUTER,
+  /// Left rows with at least one match, each once
+  LEFT_SEMI,
+};
+
+struct ARROW_EXPORT HashJoinOptions {
+  JoinType type = JoinType::INNER;
+
+  /// Whether to build and probe partitions in parallel on the CPU thread pool
+  bool use_threads = true;
+
+  static HashJoinOptions Defaults();
+};
+
+/// \brief Compute the row pairs of an equi-join between two sets of keys
+///
+/// Left and right rows match when all their keys are equal.  Null keys
+/// never match.  Keys must be array-like, with the same number and types
+/// on both sides and the same length on each side; fixed-width, binary
+/// and string keys are supported.  Floating-point keys are compared by
+/// bit pattern.
+///
+/// The result is given as int64 row indices into each side, suitable as
+/// input to Take().  Pairs are ordered by left row, then right row.  A hash
+/// table is built over the right side, or for inner joins over the smaller
+/// side.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] left_keys array-like left join keys
+/// \param[in] right_keys array-like right join keys
+/// \param[in] options join options (e.g. the join type)
+/// \param[out] left_indices resulting left row indices
+/// \param[out] right_indices resulting right row indices, null for
+/// unmatched left rows; not set for LEFT_SEMI joins
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashJoin(FunctionContext* context, const std::vector<Datum>& left_keys,
+                const std::vector<Datum>& right_keys, const HashJoinOptions& options,
+                Datum* left_indices, Datum* right_indices);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_JOIN_H
@@ -0,0 +1,309 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Throughput of the compute kernels over a grid of value types, null
+// fractions, array lengths and chunk counts.  Each benchmark takes the
+// arguments {length, null percent, number of chunks}; a single chunk is
+// passed as a plain array.
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/boolean.h"
+#include "arrow/compute/kernels/cast.h"
+#include "arrow/compute/kernels/hash.h"
+#include "arrow/compute/kernels/sum.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr random::SeedType kSeed = 0x0ff1ce;
+
+// The number of distinct values drawn for hash kernels
+constexpr int64_t kDistinctValues = 1000;
+
+static void SetArgs(benchmark::internal::Benchmark* bench) {
+  bench->Unit(benchmark::kMicrosecond)->UseRealTime();
+  for (int64_t length : {1 << 12, 1 << 20}) {
+    for (int64_t null_percent : {0, 1, 50, 100}) {
+      for (int64_t num_chunks : {1, 16}) {
+        bench->Args({length, null_percent, num_chunks});
+      }
+    }
+  }
+}
+
+// ----------------------------------------------------------------------
+// Input generation
+
+template <typename ArrowType, typename Enable = void>
+struct RandomValues {
+  static std::shared_ptr<Array> Make(random::RandomArrayGenerator* rand, int64_t length,
+                                     double null_probability) {
+    using CType = typename ArrowType::c_type;
+    return rand->Numeric<ArrowType>(length, static_cast<CType>(0),
+                                    static_cast<CType>(kDistinctValues - 1),
+                                    null_probability);
+  }
+};
+
+template <>
+struct RandomValues<Int8Type> {
+  static std::shared_ptr<Array> Make(random::RandomArrayGenerator* rand, int64_t length,
+                                     double null_probability) {
+    return rand->Int8(length, -100, 100, null_probability);
+  }
+};
+
+template <>
+struct RandomValues<UInt8Type> {
+  static std::shared_ptr<Array> Make(random::RandomArrayGenerator* rand, int64_t length,
+                                     double null_probability) {
+    return rand->UInt8(length, 0, 200, null_probability);
+  }
+};
+
+template <>
+struct RandomValues<BooleanType> {
+  static std::shared_ptr<Array> Make(random::RandomArrayGenerator* rand, int64_t length,
+                                     double null_probability) {
+    return rand->Boolean(length, 0.5, null_probability);
+  }
+};
+
+template <>
+struct RandomValues<StringType> {
+  // Render random integers as strings, keeping their nulls
+  static std::shared_ptr<Array> Make(random::RandomArrayGenerator* rand, int64_t length,
+                                     double null_probability) {
+    auto integers = std::static_pointer_cast<Int32Array>(
+        RandomValues<Int32Type>::Make(rand, length, null_probability));
+    StringBuilder builder;
+    ABORT_NOT_OK(builder.Reserve(length));
+    for (int64_t i = 0; i < length; ++i) {
+      if (integers->IsNull(i)) {
+        ABORT_NOT_OK(builder.AppendNull());
+      } else {
+        ABORT_NOT_OK(builder.Append("value-" + std::to_string(integers->Value(i))));
+      }
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+    return out;
+  }
+};
+
+// The number of bytes a kernel reads from the given values
+static int64_t InputBytes(const Array& values) {
+  int64_t nbytes = 0;
+  for (const auto& buffer : values.data()->buffers) {
+    if (buffer) {
+      nbytes += buffer->size();
+    }
+  }
+  return nbytes;
+}
+
+// Input values along with the counters to report
+struct BenchmarkInput {
+  Datum values;
+  int64_t length;
+  int64_t nbytes;
+};
+
+template <typename ArrowType>
+BenchmarkInput MakeInput(const benchmark::State& state, random::SeedType seed = kSeed) {
+  const int64_t length = state.range(0);
+  const double null_probability = static_cast<double>(state.range(1)) / 100.0;
+  const int64_t num_chunks = state.range(2);
+
+  random::RandomArrayGenerator rand(seed);
+  auto values = RandomValues<ArrowType>::Make(&rand, length, null_probability);
+
+  BenchmarkInput input{Datum(values), length, InputBytes(*values)};
+  if (num_chunks > 1) {
+    ArrayVector chunks;
+    const int64_t chunk_length = length / num_chunks;
+    for (int64_t i = 0; i < num_chunks; ++i) {
+      const int64_t offset = i * chunk_length;
+      chunks.push_back(values->Slice(
+          offset, i == num_chunks - 1 ? length - offset : chunk_length));
+    }
+    input.values = Datum(std::make_shared<ChunkedArray>(chunks));
+  }
+  return input;
+}
+
+static void SetCounters(benchmark::State& state, const BenchmarkInput& input) {
+  state.SetItemsProcessed(state.iterations() * input.length);
+  state.SetBytesProcessed(state.iterations() * input.nbytes);
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.counters["chunks"] = static_cast<double>(state.range(2));
+}
+
+// ----------------------------------------------------------------------
+// Cast
+
+template <typename FromType, typename ToType>
+static void BenchCast(benchmark::State& state) {  // NOLINT non-const reference
+  const BenchmarkInput input = MakeInput<FromType>(state);
+  auto to_type = TypeTraits<ToType>::type_singleton();
+  CastOptions options;
+  // Generated floating-point values have a fractional part
+  options.allow_float_truncate = true;
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Cast(&ctx, input.values, to_type, options, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  SetCounters(state, input);
+}
+
+BENCHMARK_TEMPLATE(BenchCast, UInt8Type, Int32Type)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchCast, Int32Type, Int64Type)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchCast, Int64Type, Int32Type)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchCast, Int32Type, DoubleType)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchCast, Int64Type, DoubleType)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchCast, DoubleType, Int64Type)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchCast, FloatType, DoubleType)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchCast, BooleanType, Int32Type)->Apply(SetArgs);
+
+// ----------------------------------------------------------------------
+// Hash kernels
+
+template <typename ArrowType>
+static void BenchUnique(benchmark::State& state) {  // NOLINT non-const reference
+  const BenchmarkInput input = MakeInput<ArrowType>(state);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(Unique(&ctx, input.values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  SetCounters(state, input);
+}
+
+template <typename ArrowType>
+static void BenchDictionaryEncode(benchmark::State& state) {  // NOLINT non-const ref
+  const BenchmarkInput input = MakeInput<ArrowType>(state);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(DictionaryEncode(&ctx, input.values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  SetCounters(state, input);
+}
+
+BENCHMARK_TEMPLATE(BenchUnique, Int8Type)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchUnique, Int32Type)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchUnique, Int64Type)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchUnique, DoubleType)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchUnique, StringType)->Apply(SetArgs);
+
+BENCHMARK_TEMPLATE(BenchDictionaryEncode, Int8Type)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchDictionaryEncode, Int32Type)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchDictionaryEncode, Int64Type)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchDictionaryEncode, DoubleType)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchDictionaryEncode, StringType)->Apply(SetArgs);
+
+// ----------------------------------------------------------------------
+// Boolean kernels
+
+static void BenchInvert(benchmark::State& state) {  // NOLINT non-const reference
+  const BenchmarkInput input = MakeInput<BooleanType>(state);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Invert(&ctx, input.values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  SetCounters(state, input);
+}
+
+using BinaryBooleanFunction = Status (*)(FunctionContext*, const Datum&, const Datum&,
+                                         Datum*);
+
+template <BinaryBooleanFunction Func>
+static void BenchBinaryBoolean(benchmark::State& state) {  // NOLINT non-const reference
+  const BenchmarkInput left = MakeInput<BooleanType>(state);
+  const BenchmarkInput right = MakeInput<BooleanType>(state, kSeed + 1);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Func(&ctx, left.values, right.values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  const int64_t nbytes = left.nbytes + right.nbytes;
+  SetCounters(state, BenchmarkInput{left.values, left.length, nbytes});
+}
+
+static void BenchAnd(benchmark::State& state) { BenchBinaryBoolean<And>(state); }
+
+static void BenchOr(benchmark::State& state) { BenchBinaryBoolean<Or>(state); }
+
+static void BenchXor(benchmark::State& state) { BenchBinaryBoolean<Xor>(state); }
+
+BENCHMARK(BenchInvert)->Apply(SetArgs);
+BENCHMARK(BenchAnd)->Apply(SetArgs);
+BENCHMARK(BenchOr)->Apply(SetArgs);
+BENCHMARK(BenchXor)->Apply(SetArgs);
+
+// ----------------------------------------------------------------------
+// Sum
+
+template <typename ArrowType>
+static void BenchSum(benchmark::State& state) {  // NOLINT non-const reference
+  const BenchmarkInput input = MakeInput<ArrowType>(state);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Sum(&ctx, input.values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  SetCounters(state, input);
+}
+
+BENCHMARK_TEMPLATE(BenchSum, Int8Type)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchSum, Int32Type)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchSum, Int64Type)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchSum, FloatType)->Apply(SetArgs);
+BENCHMARK_TEMPLATE(BenchSum, DoubleType)->Apply(SetArgs);
+
+}  // namespace compute
+}  // namespace arrow
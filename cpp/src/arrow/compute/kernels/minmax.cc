@@ -0,0 +1,236 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/minmax.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+
+namespace arrow {
+namespace compute {
+
+// The neutral elements of min() and max()
+template <typename CType, typename Enable = void>
+struct MinMaxIdentity {
+  static constexpr CType Min() { return std::numeric_limits<CType>::max(); }
+  static constexpr CType Max() { return std::numeric_limits<CType>::lowest(); }
+};
+
+template <typename CType>
+struct MinMaxIdentity<
+    CType, typename std::enable_if<std::is_floating_point<CType>::value>::type> {
+  static constexpr CType Min() { return std::numeric_limits<CType>::infinity(); }
+  static constexpr CType Max() { return -std::numeric_limits<CType>::infinity(); }
+};
+
+template <typename ArrowType>
+struct MinMaxState {
+  using ThisType = MinMaxState<ArrowType>;
+  using CType = typename ArrowType::c_type;
+
+  ThisType& operator+=(const ThisType& rhs) {
+    this->count += rhs.count;
+    this->min = std::min(this->min, rhs.min);
+    this->max = std::max(this->max, rhs.max);
+    return *this;
+  }
+
+  size_t count = 0;
+  CType min = MinMaxIdentity<CType>::Min();
+  CType max = MinMaxIdentity<CType>::Max();
+};
+
+template <typename ArrowType, typename StateType = MinMaxState<ArrowType>>
+class MinMaxAggregateFunction final : public AggregateFunctionStaticState<StateType> {
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+  using Identity = MinMaxIdentity<CType>;
+
+ public:
+  Status Consume(const Array& input, StateType* state) const override {
+    if (input.type_id() == Type::DICTIONARY) {
+      ConsumeDictionary(static_cast<const DictionaryArray&>(input), state);
+      return Status::OK();
+    }
+    const ArrayType& array = static_cast<const ArrayType&>(input);
+    const auto values = array.raw_values();
+    const int64_t null_count = array.null_count();
+    if (null_count == array.length()) {
+      return Status::OK();
+    }
+
+    StateType local;
+    const uint8_t* bitmap = null_count == 0 ? nullptr : array.null_bitmap_data();
+    detail::VisitValidityWords(
+        bitmap, array.offset(), array.length(),
+        [&](int64_t position, int64_t run_length) {
+          ConsumeValid(values + position, run_length, &local);
+          local.count += run_length;
+        },
+        [&](int64_t position, int64_t word_length, uint64_t word) {
+          ConsumeMasked(values + position, word_length, word, &local);
+          local.count += BitUtil::PopCount(word);
+        });
+    *state += local;
+    return Status::OK();
+  }
+
+  Status Merge(const StateType& src, StateType* dst) const override {
+    *dst += src;
+    return Status::OK();
+  }
+
+  Status Finalize(const StateType& src, Datum* output) const override {
+    const bool is_valid = src.count > 0;
+    std::vector<Datum> minmax = {
+        Datum(std::make_shared<ScalarType>(is_valid ? src.min : CType(0), is_valid)),
+        Datum(std::make_shared<ScalarType>(is_valid ? src.max : CType(0), is_valid))};
+    *output = minmax;
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return TypeTraits<ArrowType>::type_singleton();
+  }
+
+ private:
+  static constexpr int64_t kLanes = 8;
+
+  // Gather the values from the dictionary instead of decoding the array
+  static void ConsumeDictionary(const DictionaryArray& array, StateType* state) {
+    const auto dictionary = array.dictionary();
+    const auto values = static_cast<const ArrayType&>(*dictionary).raw_values();
+    const bool dictionary_nulls = dictionary->null_count() > 0;
+    StateType local;
+    detail::VisitDictionaryIndices(*array.data(), [&](int64_t index) {
+      if (dictionary_nulls && dictionary->IsNull(index)) return;
+      local.min = std::min(local.min, values[index]);
+      local.max = std::max(local.max, values[index]);
+      ++local.count;
+    });
+    *state += local;
+  }
+
+  // Loops over independent accumulators, which the compiler can vectorize.
+  // Since NaN compares false, std::min/max keep the accumulated value.
+  static void ConsumeValid(const CType* values, int64_t length, StateType* state) {
+    CType mins[kLanes], maxs[kLanes];
+    std::fill(mins, mins + kLanes, state->min);
+    std::fill(maxs, maxs + kLanes, state->max);
+    const int64_t length_rounded = BitUtil::RoundDown(length, kLanes);
+    for (int64_t i = 0; i < length_rounded; i += kLanes) {
+      for (int64_t k = 0; k < kLanes; ++k) {
+        mins[k] = std::min(mins[k], values[i + k]);
+        maxs[k] = std::max(maxs[k], values[i + k]);
+      }
+    }
+    for (int64_t i = length_rounded; i < length; ++i) {
+      mins[0] = std::min(mins[0], values[i]);
+      maxs[0] = std::max(maxs[0], values[i]);
+    }
+    Reduce(mins, maxs, state);
+  }
+
+  // Null slots are replaced with the neutral elements instead of branching
+  static void ConsumeMasked(const CType* values, int64_t length, uint64_t word,
+                            StateType* state) {
+    CType mins[kLanes], maxs[kLanes];
+    std::fill(mins, mins + kLanes, state->min);
+    std::fill(maxs, maxs + kLanes, state->max);
+    const int64_t length_rounded = BitUtil::RoundDown(length, kLanes);
+    for (int64_t i = 0; i < length_rounded; i += kLanes) {
+      const uint64_t bits = word >> i;
+      for (int64_t k = 0; k < kLanes; ++k) {
+        const uint64_t valid = (bits >> k) & 1;
+        mins[k] = std::min(mins[k], detail::SelectValue(valid, values[i + k],
+                                                        Identity::Min()));
+        maxs[k] = std::max(maxs[k], detail::SelectValue(valid, values[i + k],
+                                                        Identity::Max()));
+      }
+    }
+    for (int64_t i = length_rounded; i < length; ++i) {
+      const uint64_t valid = (word >> i) & 1;
+      mins[0] = std::min(mins[0], detail::SelectValue(valid, values[i], Identity::Min()));
+      maxs[0] = std::max(maxs[0], detail::SelectValue(valid, values[i], Identity::Max()));
+    }
+    Reduce(mins, maxs, state);
+  }
+
+  static void Reduce(const CType* mins, const CType* maxs, StateType* state) {
+    state->min = *std::min_element(mins, mins + kLanes);
+    state->max = *std::max_element(maxs, maxs + kLanes);
+  }
+};
+
+#define MINMAX_AGG_FN_CASE(T)                           \
+  case T::type_id:                                      \
+    return std::static_pointer_cast<AggregateFunction>( \
+        std::make_shared<MinMaxAggregateFunction<T>>());
+
+std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunction(const DataType& type,
+                                                               FunctionContext* ctx) {
+  switch (type.id()) {
+    MINMAX_AGG_FN_CASE(UInt8Type);
+    MINMAX_AGG_FN_CASE(Int8Type);
+    MINMAX_AGG_FN_CASE(UInt16Type);
+    MINMAX_AGG_FN_CASE(Int16Type);
+    MINMAX_AGG_FN_CASE(UInt32Type);
+    MINMAX_AGG_FN_CASE(Int32Type);
+    MINMAX_AGG_FN_CASE(UInt64Type);
+    MINMAX_AGG_FN_CASE(Int64Type);
+    MINMAX_AGG_FN_CASE(FloatType);
+    MINMAX_AGG_FN_CASE(DoubleType);
+    default:
+      return nullptr;
+  }
+
+#undef MINMAX_AGG_FN_CASE
+}
+
+Status MinMax(FunctionContext* ctx, const Datum& value, Datum* out) {
+  auto data_type = detail::DecodedType(value.type());
+  if (data_type == nullptr)
+    return Status::Invalid("Datum must be array-like");
+  else if (!is_integer(data_type->id()) && !is_floating(data_type->id()))
+    return Status::Invalid("Datum must contain a NumericType");
+
+  std::shared_ptr<AggregateFunction> aggregate =
+      MakeMinMaxAggregateFunction(*data_type, ctx);
+  if (!aggregate) return Status::Invalid("No min/max for type ", *data_type);
+
+  auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
+  return kernel->Call(ctx, value, out);
+}
+
+Status MinMax(FunctionContext* ctx, const Array& array, Datum* out) {
+  return MinMax(ctx, array.data(), out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_MINMAX_H
+#define ARROW_COMPUTE_KERNELS_MINMAX_H
+
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Array;
+class DataType;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeMinMaxAggregateFunction(const DataType& type,
+                                                               FunctionContext* context);
+
+/// \brief Compute the minimum and maximum values of a numeric array.
+///
+/// Null values are ignored, as are NaN values for floating-point arrays.
+/// The result is a collection Datum of two scalars of the input type,
+/// the minimum and the maximum, both null if there are no valid values.
+/// Dictionary-encoded values are aggregated over the dictionary entries
+/// they use, without decoding.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] value datum to compute the min/max, expecting Array
+/// \param[out] out resulting datum
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MinMax(FunctionContext* context, const Datum& value, Datum* out);
+
+/// \brief Compute the minimum and maximum values of a numeric array.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] array to compute the min/max
+/// \param[out] out resulting datum
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MinMax(FunctionContext* context, const Array& array, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_MINMAX_H
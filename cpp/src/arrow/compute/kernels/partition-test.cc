@@ -0,0 +1,213 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/partition.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test-util.h"
+
+using std::shared_ptr;
+using std::vector;
+
+using arrow::internal::checked_cast;
+
+namespace arrow {
+namespace compute {
+
+class TestHashPartition : public ComputeFixture, public ::testing::Test {
+ protected:
+  // Partition a batch whose first column holds row ids (0, 1, ...), check
+  // that each partition holds the rows it names in input order, and return
+  // the partition of each row
+  vector<int> CheckPartition(const shared_ptr<RecordBatch>& batch,
+                             const vector<int>& key_columns, int num_partitions) {
+    vector<shared_ptr<RecordBatch>> partitions;
+    ABORT_NOT_OK(HashPartition(&ctx_, *batch, key_columns, num_partitions, &partitions));
+    EXPECT_EQ(num_partitions, static_cast<int>(partitions.size()));
+
+    vector<int> row_partitions(batch->num_rows(), -1);
+    int64_t total_rows = 0;
+    for (int p = 0; p < num_partitions; ++p) {
+      const auto& partition = partitions[p];
+      EXPECT_OK(partition->Validate());
+      EXPECT_TRUE(partition->schema()->Equals(*batch->schema()));
+      total_rows += partition->num_rows();
+
+      const auto& ids = checked_cast<const Int64Array&>(*partition->column(0));
+      for (int64_t i = 0; i < ids.length(); ++i) {
+        EXPECT_EQ(-1, row_partitions[ids.Value(i)]);
+        row_partitions[ids.Value(i)] = p;
+        if (i > 0) {
+          EXPECT_LT(ids.Value(i - 1), ids.Value(i));
+        }
+      }
+      for (int c = 1; c < batch->num_columns(); ++c) {
+        Datum expected;
+        ABORT_NOT_OK(Take(&ctx_, Datum(batch->column(c)), Datum(ids.data()), &expected));
+        AssertArraysEqual(*expected.make_array(), *partition->column(c));
+      }
+    }
+    EXPECT_EQ(batch->num_rows(), total_rows);
+    return row_partitions;
+  }
+
+  shared_ptr<RecordBatch> MakeBatch(const vector<shared_ptr<Array>>& columns) {
+    const int64_t length = columns[0]->length();
+    vector<int64_t> ids(length);
+    for (int64_t i = 0; i < length; ++i) {
+      ids[i] = i;
+    }
+    shared_ptr<Array> id_array;
+    ArrayFromVector<Int64Type>(ids, &id_array);
+
+    vector<shared_ptr<Field>> fields = {field("id", int64())};
+    vector<shared_ptr<Array>> arrays = {id_array};
+    for (size_t i = 0; i < columns.size(); ++i) {
+      fields.push_back(field("f" + std::to_string(i), columns[i]->type()));
+      arrays.push_back(columns[i]);
+    }
+    return RecordBatch::Make(schema(fields), length, arrays);
+  }
+
+  // Check that rows with equal keys are in the same partition
+  void AssertKeysColocated(const vector<int>& row_partitions,
+                           const vector<int>& key_groups) {
+    std::map<int, int> group_partitions;
+    for (size_t i = 0; i < key_groups.size(); ++i) {
+      auto it = group_partitions.emplace(key_groups[i], row_partitions[i]).first;
+      ASSERT_EQ(it->second, row_partitions[i]) << "row " << i;
+    }
+  }
+};
+
+TEST_F(TestHashPartition, Types) {
+  auto batch = MakeBatch({
+      ArrayFromJSON(int32(), "[1, 2, null, 1, 3, 2, null, 4]"),
+      ArrayFromJSON(utf8(), R"(["a", "bc", "a", null, "", "bc", "def", "a"])"),
+      ArrayFromJSON(boolean(), "[true, false, null, true, true, false, false, null]"),
+      ArrayFromJSON(float64(), "[1.5, null, 2, 3, 4, 5, 6, 7]"),
+      ArrayFromJSON(fixed_size_binary(3),
+                    R"(["abc", "def", null, "abc", "ghi", "def", null, "jkl"])"),
+      ArrayFromJSON(null(), "[null, null, null, null, null, null, null, null]"),
+      ArrayFromJSON(list(int16()), "[[1], null, [], [2, 3], [4], null, [5, null], []]"),
+      ArrayFromJSON(struct_({field("a", int8())}),
+                    R"([{"a": 1}, null, {"a": 2}, {"a": null}, {"a": 3}, {"a": 4},
+                        null, {"a": 5}])"),
+  });
+  // Null keys are equal to each other
+  const vector<int> int_groups = {1, 2, 0, 1, 3, 2, 0, 4};
+  for (int num_partitions : {1, 2, 3, 7}) {
+    auto row_partitions = CheckPartition(batch, {1}, num_partitions);
+    AssertKeysColocated(row_partitions, int_groups);
+    row_partitions = CheckPartition(batch, {2}, num_partitions);
+    AssertKeysColocated(row_partitions, {0, 1, 0, 2, 3, 1, 4, 0});
+    for (int key : {3, 4, 5, 6}) {
+      CheckPartition(batch, {key}, num_partitions);
+    }
+    row_partitions = CheckPartition(batch, {1, 2}, num_partitions);
+    AssertKeysColocated(row_partitions, {0, 1, 2, 3, 4, 1, 5, 6});
+  }
+}
+
+TEST_F(TestHashPartition, SlicedBatches) {
+  auto batch = MakeBatch({
+      ArrayFromJSON(int64(), "[5, 6, null, 7, 5, 8, 6, null, 9, 5]"),
+      ArrayFromJSON(utf8(), R"(["x", "y", null, "z", "x", "w", "y", null, "v", "x"])"),
+  });
+  auto full = CheckPartition(batch, {1, 2}, 4);
+  auto sliced_batch = batch->Slice(3);
+  vector<shared_ptr<RecordBatch>> partitions;
+  ASSERT_OK(HashPartition(&ctx_, *sliced_batch, {1, 2}, 4, &partitions));
+  for (int p = 0; p < 4; ++p) {
+    ASSERT_OK(partitions[p]->Validate());
+    const auto& ids = checked_cast<const Int64Array&>(*partitions[p]->column(0));
+    for (int64_t i = 0; i < ids.length(); ++i) {
+      // Rows land in the same partition whatever the batch
+      ASSERT_EQ(full[ids.Value(i)], p);
+    }
+  }
+}
+
+TEST_F(TestHashPartition, DictionaryKeys) {
+  auto type1 = dictionary(int8(), ArrayFromJSON(utf8(), R"(["a", "b", "c"])"));
+  auto type2 = dictionary(int16(), ArrayFromJSON(utf8(), R"(["c", "b", "a"])"));
+  auto dict1 = std::make_shared<DictionaryArray>(
+      type1, ArrayFromJSON(int8(), "[0, 1, 2, null, 0]"));
+  auto dict2 = std::make_shared<DictionaryArray>(
+      type2, ArrayFromJSON(int16(), "[2, 1, 0, null, 2]"));
+  auto plain = ArrayFromJSON(utf8(), R"(["a", "b", "c", null, "a"])");
+
+  // Dictionary keys are hashed by value
+  auto expected = CheckPartition(MakeBatch({plain}), {1}, 5);
+  ASSERT_EQ(expected, CheckPartition(MakeBatch({dict1}), {1}, 5));
+  ASSERT_EQ(expected, CheckPartition(MakeBatch({dict2}), {1}, 5));
+}
+
+TEST_F(TestHashPartition, Random) {
+  random::RandomArrayGenerator rand(0x5487656);
+  const int64_t length = 5000;
+  auto keys = rand.Int64(length, 0, 200, 0.1);
+  vector<shared_ptr<Array>> columns = {keys, rand.Int32(length, 0, 1000, 0.2),
+                                       rand.Boolean(length, 0.5, 0.3),
+                                       rand.Float64(length, 0, 1, 0.1)};
+  auto batch = MakeBatch(columns);
+  // Columns with a non-zero offset
+  vector<shared_ptr<Array>> sliced_columns;
+  for (const auto& column : columns) {
+    sliced_columns.push_back(column->Slice(77));
+  }
+  auto sliced_batch = MakeBatch(sliced_columns);
+
+  const auto& key_values = checked_cast<const Int64Array&>(*keys);
+  vector<int> key_groups(length);
+  for (int64_t i = 0; i < length; ++i) {
+    key_groups[i] = key_values.IsNull(i) ? -1 : static_cast<int>(key_values.Value(i));
+  }
+  for (int num_partitions : {1, 16, 61}) {
+    auto row_partitions = CheckPartition(batch, {1}, num_partitions);
+    AssertKeysColocated(row_partitions, key_groups);
+    CheckPartition(sliced_batch, {1, 3}, num_partitions);
+  }
+}
+
+TEST_F(TestHashPartition, Errors) {
+  auto batch = MakeBatch({ArrayFromJSON(int32(), "[1, 2]"),
+                          ArrayFromJSON(list(int32()), "[[1], [2]]")});
+  vector<shared_ptr<RecordBatch>> partitions;
+  ASSERT_RAISES(Invalid, HashPartition(&ctx_, *batch, {1}, 0, &partitions));
+  ASSERT_RAISES(Invalid, HashPartition(&ctx_, *batch, {}, 2, &partitions));
+  ASSERT_RAISES(Invalid, HashPartition(&ctx_, *batch, {3}, 2, &partitions));
+  ASSERT_RAISES(NotImplemented, HashPartition(&ctx_, *batch, {2}, 2, &partitions));
+}
+
+}  // namespace compute
+}  // namespace arrow
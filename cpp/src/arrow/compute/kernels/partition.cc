@@ -0,0 +1,314 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/partition.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/hash-rows.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Scattering of columns into partitions
+
+class RowScatter {
+ public:
+  RowScatter(FunctionContext* ctx, int num_partitions)
+      : ctx_(ctx), pool_(ctx->memory_pool()), num_partitions_(num_partitions) {}
+
+  // First pass: assign each row to a partition and a position within it
+  void Assign(const uint64_t* hashes, int64_t length) {
+    counts_.assign(num_partitions_, 0);
+    partitions_.resize(length);
+    positions_.resize(length);
+    const auto num_partitions = static_cast<uint64_t>(num_partitions_);
+    for (int64_t i = 0; i < length; ++i) {
+      const auto partition = static_cast<int32_t>((hashes[i] >> 32) % num_partitions);
+      partitions_[i] = partition;
+      positions_[i] = counts_[partition]++;
+    }
+  }
+
+  int64_t count(int partition) const { return counts_[partition]; }
+
+  // Second pass, once per column: copy each row to its destination.  The
+  // input is read sequentially, and the destinations of each partition are
+  // written sequentially.
+  Status Scatter(const std::shared_ptr<ArrayData>& column,
+                 std::vector<std::shared_ptr<ArrayData>>* out) {
+    const ArrayData& input = *column;
+    const DataType& type = *input.type;
+    out->resize(num_partitions_);
+
+    if (type.id() == Type::NA) {
+      for (int p = 0; p < num_partitions_; ++p) {
+        (*out)[p] = ArrayData::Make(input.type, counts_[p], {NULLPTR}, counts_[p]);
+      }
+      return Status::OK();
+    }
+    const bool fixed_width = is_fixed_width(type.id());
+    if (!fixed_width && !is_binary_like(type.id())) {
+      return ScatterByTake(column, out);
+    }
+
+    BufferVector null_bitmaps(num_partitions_);
+    std::vector<int64_t> null_counts(num_partitions_, 0);
+    if (input.GetNullCount() > 0) {
+      RETURN_NOT_OK(ScatterBitmap(input.buffers[0]->data(), input.offset, &null_bitmaps,
+                                  &null_counts));
+    }
+
+    std::vector<BufferVector> value_buffers(num_partitions_);
+    if (type.id() == Type::BOOL) {
+      BufferVector values(num_partitions_);
+      std::vector<int64_t> unset_counts(num_partitions_);
+      RETURN_NOT_OK(ScatterBitmap(input.buffers[1]->data(), input.offset, &values,
+                                  &unset_counts));
+      for (int p = 0; p < num_partitions_; ++p) {
+        value_buffers[p] = {values[p]};
+      }
+    } else if (fixed_width) {
+      const int byte_width = checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+      BufferVector values;
+      RETURN_NOT_OK(ScatterFixedWidth(input, byte_width, &values));
+      for (int p = 0; p < num_partitions_; ++p) {
+        value_buffers[p] = {values[p]};
+      }
+    } else {
+      BufferVector offsets, data;
+      RETURN_NOT_OK(ScatterBinary(input, &offsets, &data));
+      for (int p = 0; p < num_partitions_; ++p) {
+        value_buffers[p] = {offsets[p], data[p]};
+      }
+    }
+
+    for (int p = 0; p < num_partitions_; ++p) {
+      BufferVector buffers = {null_bitmaps[p]};
+      buffers.insert(buffers.end(), value_buffers[p].begin(), value_buffers[p].end());
+      (*out)[p] =
+          ArrayData::Make(input.type, counts_[p], std::move(buffers), null_counts[p]);
+    }
+    return Status::OK();
+  }
+
+ private:
+  Status ScatterBitmap(const uint8_t* bitmap, int64_t offset, BufferVector* out,
+                       std::vector<int64_t>* unset_counts) {
+    std::vector<uint8_t*> dest(num_partitions_);
+    for (int p = 0; p < num_partitions_; ++p) {
+      RETURN_NOT_OK(AllocateEmptyBitmap(pool_, counts_[p], &(*out)[p]));
+      dest[p] = (*out)[p]->mutable_data();
+    }
+    int64_t* unset = unset_counts->data();
+    const int64_t length = static_cast<int64_t>(partitions_.size());
+    for (int64_t i = 0; i < length; ++i) {
+      if (BitUtil::GetBit(bitmap, offset + i)) {
+        BitUtil::SetBit(dest[partitions_[i]], positions_[i]);
+      } else {
+        ++unset[partitions_[i]];
+      }
+    }
+    return Status::OK();
+  }
+
+  template <typename CType>
+  void ScatterValues(const uint8_t* values, const std::vector<uint8_t*>& dest) {
+    const CType* in = reinterpret_cast<const CType*>(values);
+    const int64_t length = static_cast<int64_t>(partitions_.size());
+    for (int64_t i = 0; i < length; ++i) {
+      reinterpret_cast<CType*>(dest[partitions_[i]])[positions_[i]] = in[i];
+    }
+  }
+
+  Status ScatterFixedWidth(const ArrayData& input, int byte_width, BufferVector* out) {
+    out->resize(num_partitions_);
+    std::vector<uint8_t*> dest(num_partitions_);
+    for (int p = 0; p < num_partitions_; ++p) {
+      RETURN_NOT_OK(AllocateBuffer(pool_, counts_[p] * byte_width, &(*out)[p]));
+      dest[p] = (*out)[p]->mutable_data();
+    }
+    const uint8_t* values = input.buffers[1]->data() + input.offset * byte_width;
+    switch (byte_width) {
+      case 1:
+        ScatterValues<uint8_t>(values, dest);
+        break;
+      case 2:
+        ScatterValues<uint16_t>(values, dest);
+        break;
+      case 4:
+        ScatterValues<uint32_t>(values, dest);
+        break;
+      case 8:
+        ScatterValues<uint64_t>(values, dest);
+        break;
+      default: {
+        const int64_t length = static_cast<int64_t>(partitions_.size());
+        for (int64_t i = 0; i < length; ++i) {
+          std::memcpy(dest[partitions_[i]] + positions_[i] * byte_width,
+                      values + i * byte_width, byte_width);
+        }
+      } break;
+    }
+    return Status::OK();
+  }
+
+  Status ScatterBinary(const ArrayData& input, BufferVector* out_offsets,
+                       BufferVector* out_data) {
+    const int32_t* offsets = input.GetValues<int32_t>(1);
+    const uint8_t* data = input.buffers[2] ? input.buffers[2]->data() : NULLPTR;
+    const int64_t length = static_cast<int64_t>(partitions_.size());
+
+    std::vector<int64_t> data_sizes(num_partitions_, 0);
+    for (int64_t i = 0; i < length; ++i) {
+      data_sizes[partitions_[i]] += offsets[i + 1] - offsets[i];
+    }
+
+    out_offsets->resize(num_partitions_);
+    out_data->resize(num_partitions_);
+    std::vector<int32_t*> dest_offsets(num_partitions_);
+    std::vector<uint8_t*> dest_data(num_partitions_);
+    for (int p = 0; p < num_partitions_; ++p) {
+      RETURN_NOT_OK(AllocateBuffer(pool_, (counts_[p] + 1) * sizeof(int32_t),
+                                   &(*out_offsets)[p]));
+      RETURN_NOT_OK(AllocateBuffer(pool_, data_sizes[p], &(*out_data)[p]));
+      dest_offsets[p] = reinterpret_cast<int32_t*>((*out_offsets)[p]->mutable_data());
+      dest_data[p] = (*out_data)[p]->mutable_data();
+    }
+
+    std::vector<int32_t> cursors(num_partitions_, 0);
+    for (int64_t i = 0; i < length; ++i) {
+      const int32_t p = partitions_[i];
+      const int32_t value_length = offsets[i + 1] - offsets[i];
+      dest_offsets[p][positions_[i]] = cursors[p];
+      if (value_length > 0) {
+        std::memcpy(dest_data[p] + cursors[p], data + offsets[i], value_length);
+      }
+      cursors[p] += value_length;
+    }
+    for (int p = 0; p < num_partitions_; ++p) {
+      dest_offsets[p][counts_[p]] = cursors[p];
+    }
+    return Status::OK();
+  }
+
+  // Nested columns are gathered with Take, from the rows of each partition
+  Status ScatterByTake(const std::shared_ptr<ArrayData>& column,
+                       std::vector<std::shared_ptr<ArrayData>>* out) {
+    if (row_indices_.empty()) {
+      RETURN_NOT_OK(MakeRowIndices());
+    }
+    for (int p = 0; p < num_partitions_; ++p) {
+      Datum taken;
+      RETURN_NOT_OK(Take(ctx_, Datum(column), Datum(row_indices_[p]), &taken));
+      (*out)[p] = taken.array();
+    }
+    return Status::OK();
+  }
+
+  Status MakeRowIndices() {
+    row_indices_.resize(num_partitions_);
+    std::vector<int64_t*> dest(num_partitions_);
+    for (int p = 0; p < num_partitions_; ++p) {
+      std::shared_ptr<Buffer> values;
+      RETURN_NOT_OK(AllocateBuffer(pool_, counts_[p] * sizeof(int64_t), &values));
+      dest[p] = reinterpret_cast<int64_t*>(values->mutable_data());
+      row_indices_[p] = ArrayData::Make(int64(), counts_[p], {NULLPTR, values}, 0);
+    }
+    const int64_t length = static_cast<int64_t>(partitions_.size());
+    for (int64_t i = 0; i < length; ++i) {
+      dest[partitions_[i]][positions_[i]] = i;
+    }
+    return Status::OK();
+  }
+
+  FunctionContext* ctx_;
+  MemoryPool* pool_;
+  int num_partitions_;
+  std::vector<int64_t> counts_;
+  // Partition and position within it of each row
+  std::vector<int32_t> partitions_;
+  std::vector<int64_t> positions_;
+  // Rows of each partition, for ScatterByTake
+  std::vector<std::shared_ptr<ArrayData>> row_indices_;
+};
+
+}  // namespace
+
+Status HashPartition(FunctionContext* ctx, const RecordBatch& batch,
+                     const std::vector<int>& key_columns, int num_partitions,
+                     std::vector<std::shared_ptr<RecordBatch>>* out) {
+  if (num_partitions < 1) {
+    return Status::Invalid("HashPartition needs at least one partition");
+  }
+  if (key_columns.empty()) {
+    return Status::Invalid("HashPartition needs at least one key column");
+  }
+
+  std::vector<Datum> keys;
+  for (int key : key_columns) {
+    if (key < 0 || key >= batch.num_columns()) {
+      return Status::Invalid("HashPartition key column ", key, " out of bounds");
+    }
+    keys.emplace_back(batch.column_data(key));
+  }
+  Datum hashes;
+  RETURN_NOT_OK(HashRows(ctx, keys, &hashes));
+
+  RowScatter scatter(ctx, num_partitions);
+  scatter.Assign(hashes.array()->GetValues<uint64_t>(1), batch.num_rows());
+
+  std::vector<std::vector<std::shared_ptr<ArrayData>>> columns(num_partitions);
+  std::vector<std::shared_ptr<ArrayData>> parts;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    RETURN_NOT_OK(scatter.Scatter(batch.column_data(i), &parts));
+    for (int p = 0; p < num_partitions; ++p) {
+      columns[p].push_back(std::move(parts[p]));
+    }
+  }
+
+  out->clear();
+  for (int p = 0; p < num_partitions; ++p) {
+    out->push_back(
+        RecordBatch::Make(batch.schema(), scatter.count(p), std::move(columns[p])));
+  }
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
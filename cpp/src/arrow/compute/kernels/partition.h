@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_PARTITION_H
+#define ARROW_COMPUTE_KERNELS_PARTITION_H
+
+#include <memory>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatch;
+
+namespace compute {
+
+class FunctionContext;
+
+/// \brief Split a record batch into partitions by the hash of some key columns
+///
+/// Rows with equal keys (null being a distinct value) land in the same
+/// partition, also across batches, so that batches of both sides of a join
+/// can be partitioned independently.  Within a partition, rows keep their
+/// input order.  Fixed-width, binary, string and dictionary keys are
+/// supported; floating-point keys are hashed by bit pattern, dictionary keys
+/// by their dictionary value.  All column types can be partitioned.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] batch the record batch to partition
+/// \param[in] key_columns indices of the key columns in `batch`, at least one
+/// \param[in] num_partitions the number of partitions, at least 1
+/// \param[out] out one record batch per partition, with the schema of
+/// `batch`; some may be empty
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status HashPartition(FunctionContext* context, const RecordBatch& batch,
+                     const std::vector<int>& key_columns, int num_partitions,
+                     std::vector<std::shared_ptr<RecordBatch>>* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_PARTITION_H
@@ -0,0 +1,306 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/sort.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test-util.h"
+
+using std::shared_ptr;
+using std::vector;
+
+using arrow::internal::checked_cast;
+
+namespace arrow {
+namespace compute {
+
+class TestSortToIndices : public ComputeFixture, public ::testing::Test {
+ protected:
+  void AssertSortIndices(const shared_ptr<DataType>& type, const std::string& values,
+                         const std::string& expected) {
+    Datum out;
+    ASSERT_OK(SortToIndices(&ctx_, ArrayFromJSON(type, values), &out));
+    ASSERT_EQ(out.kind(), Datum::ARRAY);
+    AssertArraysEqual(*ArrayFromJSON(uint64(), expected), *out.make_array());
+  }
+};
+
+TEST_F(TestSortToIndices, Integers) {
+  AssertSortIndices(int32(), "[3, -1, null, 2, -1, null, 0]", "[1, 4, 6, 3, 0, 2, 5]");
+  AssertSortIndices(uint8(), "[255, 0, 128, 127]", "[1, 3, 2, 0]");
+  AssertSortIndices(int64(), "[9223372036854775807, -9223372036854775808, 0]",
+                    "[1, 2, 0]");
+  AssertSortIndices(int16(), "[]", "[]");
+  AssertSortIndices(int16(), "[null, null]", "[0, 1]");
+  // All keys share the upper bytes
+  AssertSortIndices(uint64(), "[5, 3, 4, 3]", "[1, 3, 2, 0]");
+}
+
+TEST_F(TestSortToIndices, Floats) {
+  const double inf = std::numeric_limits<double>::infinity();
+  shared_ptr<Array> values;
+  ArrayFromVector<DoubleType, double>(
+      {true, true, false, true, true, true, true, true, true},
+      {1.5, -2.5, 0, 0.0, -0.0, -inf, std::nan(""), inf, -std::nan("")}, &values);
+  Datum out;
+  ASSERT_OK(SortToIndices(&ctx_, values, &out));
+  // NaNs sort after +inf, and -0.0 is equal to 0.0
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[5, 1, 3, 4, 0, 7, 6, 8, 2]"),
+                    *out.make_array());
+
+  AssertSortIndices(float32(), "[0.25, -0.5, 0.125]", "[1, 2, 0]");
+}
+
+TEST_F(TestSortToIndices, Boolean) {
+  AssertSortIndices(boolean(), "[true, null, false, true, false]", "[2, 4, 0, 3, 1]");
+}
+
+TEST_F(TestSortToIndices, Temporal) {
+  AssertSortIndices(timestamp(TimeUnit::NANO), "[30, -10, 20]", "[1, 2, 0]");
+  AssertSortIndices(date32(), "[3, 1, 2]", "[1, 2, 0]");
+}
+
+TEST_F(TestSortToIndices, Strings) {
+  AssertSortIndices(utf8(), R"(["b", "", null, "abcdefghij", "abcdefghi", "a", "b"])",
+                    "[1, 5, 4, 3, 0, 6, 2]");
+  // Prefixes are compared as unsigned bytes
+  AssertSortIndices(binary(), R"(["ÿ", "a", "abcdefgh", "abcdefg"])", "[1, 3, 2, 0]");
+}
+
+TEST_F(TestSortToIndices, MultipleKeys) {
+  auto key1 = ArrayFromJSON(utf8(), R"(["b", "a", "b", null, "a", "b"])");
+  auto key2 = ArrayFromJSON(int32(), "[2, 3, 1, 1, null, 2]");
+  Datum out;
+  ASSERT_OK(SortToIndices(&ctx_, {key1, key2}, &out));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[1, 4, 2, 0, 5, 3]"), *out.make_array());
+}
+
+TEST_F(TestSortToIndices, ChunkedAndTake) {
+  auto values = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int64(), "[5, null, 1]"), ArrayFromJSON(int64(), "[]"),
+                  ArrayFromJSON(int64(), "[4, 2]")});
+  Datum indices;
+  ASSERT_OK(SortToIndices(&ctx_, values, &indices));
+  AssertArraysEqual(*ArrayFromJSON(uint64(), "[2, 4, 3, 0, 1]"), *indices.make_array());
+
+  // The permutation can be applied with Take
+  Datum sorted;
+  ASSERT_OK(Take(&ctx_, values, indices, &sorted));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 2, 4, 5, null]"), *sorted.make_array());
+}
+
+TEST_F(TestSortToIndices, Random) {
+  auto rand = random::RandomArrayGenerator(0x5047);
+  const int64_t length = 5000;
+  // A narrow range produces many ties, to check stability
+  auto ints = rand.Int64(length, -50, 50, 0.1);
+  auto doubles = rand.Float64(length, -1e9, 1e9, 0.1);
+
+  for (const auto& values : {ints, doubles}) {
+    Datum out;
+    ASSERT_OK(SortToIndices(&ctx_, values, &out));
+    const auto result = out.make_array();
+    const auto& indices = checked_cast<const UInt64Array&>(*result);
+
+    vector<uint64_t> expected(length);
+    std::iota(expected.begin(), expected.end(), 0);
+    auto less = [&](uint64_t left, uint64_t right) {
+      if (values->IsNull(left) || values->IsNull(right)) {
+        return values->IsValid(left) && values->IsNull(right);
+      }
+      if (values->type_id() == Type::INT64) {
+        const auto& array = checked_cast<const Int64Array&>(*values);
+        return array.Value(left) < array.Value(right);
+      }
+      const auto& array = checked_cast<const DoubleArray&>(*values);
+      return array.Value(left) < array.Value(right);
+    };
+    std::stable_sort(expected.begin(), expected.end(), less);
+    for (int64_t i = 0; i < length; ++i) {
+      ASSERT_EQ(indices.Value(i), expected[i]) << i;
+    }
+  }
+}
+
+TEST_F(TestSortToIndices, Errors) {
+  Datum out;
+  auto values = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_RAISES(Invalid, SortToIndices(&ctx_, vector<Datum>{}, &out));
+  ASSERT_RAISES(Invalid,
+                SortToIndices(&ctx_, {values, ArrayFromJSON(int32(), "[1]")}, &out));
+  ASSERT_RAISES(NotImplemented,
+                SortToIndices(&ctx_, ArrayFromJSON(list(int32()), "[[1]]"), &out));
+}
+
+class TestTopK : public ComputeFixture, public ::testing::Test {
+ protected:
+  void AssertTopK(const Datum& values, int64_t k, SortOrder order,
+                  const std::string& expected) {
+    auto expected_indices = ArrayFromJSON(uint64(), expected);
+    Datum out;
+    ASSERT_OK(TopK(&ctx_, values, k, order, &out));
+    ASSERT_EQ(out.kind(), Datum::ARRAY);
+    AssertArraysEqual(*expected_indices, *out.make_array());
+
+    // SelectKUnstable selects the same indices, in any order
+    ASSERT_OK(SelectKUnstable(&ctx_, values, k, order, &out));
+    const auto& indices = checked_cast<const UInt64Array&>(*out.make_array());
+    vector<uint64_t> selected(indices.raw_values(),
+                              indices.raw_values() + indices.length());
+    const auto& expected_values = checked_cast<const UInt64Array&>(*expected_indices);
+    vector<uint64_t> expected_selected(
+        expected_values.raw_values(),
+        expected_values.raw_values() + expected_values.length());
+    std::sort(selected.begin(), selected.end());
+    std::sort(expected_selected.begin(), expected_selected.end());
+    ASSERT_EQ(expected_selected, selected);
+  }
+
+  void AssertTopK(const shared_ptr<DataType>& type, const std::string& values,
+                  int64_t k, SortOrder order, const std::string& expected) {
+    AssertTopK(ArrayFromJSON(type, values), k, order, expected);
+  }
+};
+
+TEST_F(TestTopK, Integers) {
+  const std::string values = "[3, -1, null, 2, -1, null, 0]";
+  AssertTopK(int32(), values, 3, SortOrder::ASCENDING, "[1, 4, 6]");
+  AssertTopK(int32(), values, 3, SortOrder::DESCENDING, "[0, 3, 6]");
+  // Nulls come last in both orders
+  AssertTopK(int32(), values, 6, SortOrder::ASCENDING, "[1, 4, 6, 3, 0, 2]");
+  AssertTopK(int32(), values, 7, SortOrder::DESCENDING, "[0, 3, 6, 1, 4, 2, 5]");
+  AssertTopK(int32(), values, 10, SortOrder::ASCENDING, "[1, 4, 6, 3, 0, 2, 5]");
+  AssertTopK(int32(), values, 0, SortOrder::ASCENDING, "[]");
+  AssertTopK(uint64(), "[18446744073709551615, 0, 5]", 2, SortOrder::DESCENDING,
+             "[0, 2]");
+  AssertTopK(int8(), "[]", 2, SortOrder::ASCENDING, "[]");
+}
+
+TEST_F(TestTopK, Floats) {
+  const double inf = std::numeric_limits<double>::infinity();
+  shared_ptr<Array> values;
+  ArrayFromVector<DoubleType, double>({true, true, true, false, true, true},
+                                      {1.5, std::nan(""), -2, 0, inf, -0.0}, &values);
+  // NaNs come after all other values in both orders
+  AssertTopK(values, 6, SortOrder::ASCENDING, "[2, 5, 0, 4, 1, 3]");
+  AssertTopK(values, 5, SortOrder::DESCENDING, "[4, 0, 5, 2, 1]");
+  AssertTopK(float32(), "[0.25, -0.5, 0.125]", 1, SortOrder::DESCENDING, "[0]");
+}
+
+TEST_F(TestTopK, Boolean) {
+  AssertTopK(boolean(), "[true, null, false, true]", 2, SortOrder::DESCENDING,
+             "[0, 3]");
+  AssertTopK(boolean(), "[true, null, false, true]", 3, SortOrder::ASCENDING,
+             "[2, 0, 3]");
+}
+
+TEST_F(TestTopK, Strings) {
+  const std::string values = R"(["b", "", null, "abc", "b", "c"])";
+  AssertTopK(utf8(), values, 3, SortOrder::DESCENDING, "[5, 0, 4]");
+  AssertTopK(utf8(), values, 2, SortOrder::ASCENDING, "[1, 3]");
+  AssertTopK(binary(), values, 6, SortOrder::ASCENDING, "[1, 3, 0, 4, 5, 2]");
+}
+
+TEST_F(TestTopK, ChunkedAndTake) {
+  auto values = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int64(), "[5, null, 1]"), ArrayFromJSON(int64(), "[]"),
+                  ArrayFromJSON(int64(), "[4, 2]")});
+  AssertTopK(values, 2, SortOrder::DESCENDING, "[0, 3]");
+
+  Datum indices, top;
+  ASSERT_OK(TopK(&ctx_, values, 3, SortOrder::ASCENDING, &indices));
+  ASSERT_OK(Take(&ctx_, values, indices, &top));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 2, 4]"), *top.make_array());
+}
+
+TEST_F(TestTopK, Random) {
+  auto rand = random::RandomArrayGenerator(0x70b6);
+  const int64_t length = 5000;
+  // A narrow range produces many ties, to check they are broken by position
+  auto ints = rand.Int64(length, -50, 50, 0.1);
+  auto doubles = rand.Float64(length, -1e9, 1e9, 0.1);
+
+  for (const auto& values : {ints, doubles}) {
+    ArrayVector chunks;
+    for (int64_t offset = 0; offset < length; offset += 700) {
+      chunks.push_back(values->Slice(offset, 700));
+    }
+    auto chunked = std::make_shared<ChunkedArray>(chunks);
+
+    auto value_less = [&](uint64_t left, uint64_t right) {
+      if (values->type_id() == Type::INT64) {
+        const auto& array = checked_cast<const Int64Array&>(*values);
+        return array.Value(left) < array.Value(right);
+      }
+      const auto& array = checked_cast<const DoubleArray&>(*values);
+      return array.Value(left) < array.Value(right);
+    };
+    for (SortOrder order : {SortOrder::ASCENDING, SortOrder::DESCENDING}) {
+      vector<uint64_t> expected(length);
+      std::iota(expected.begin(), expected.end(), 0);
+      std::stable_sort(expected.begin(), expected.end(),
+                       [&](uint64_t left, uint64_t right) {
+                         if (values->IsNull(left) || values->IsNull(right)) {
+                           return values->IsValid(left) && values->IsNull(right);
+                         }
+                         return order == SortOrder::ASCENDING
+                                    ? value_less(left, right)
+                                    : value_less(right, left);
+                       });
+      for (int64_t k : {1, 10, 100, 3000, 6000}) {
+        Datum out;
+        ASSERT_OK(TopK(&ctx_, chunked, k, order, &out));
+        const auto result = out.make_array();
+        const auto& indices = checked_cast<const UInt64Array&>(*result);
+        ASSERT_EQ(std::min(k, length), indices.length());
+        for (int64_t i = 0; i < indices.length(); ++i) {
+          ASSERT_EQ(expected[i], indices.Value(i)) << i;
+        }
+      }
+    }
+  }
+}
+
+TEST_F(TestTopK, Errors) {
+  Datum out;
+  ASSERT_RAISES(Invalid, TopK(&ctx_, ArrayFromJSON(int32(), "[1, 2]"), -1,
+                              SortOrder::ASCENDING, &out));
+  ASSERT_RAISES(NotImplemented, TopK(&ctx_, ArrayFromJSON(list(int32()), "[[1]]"), 1,
+                                     SortOrder::ASCENDING, &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
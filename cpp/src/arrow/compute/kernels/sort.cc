@@ -0,0 +1,710 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/sort.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Order-preserving conversion of values to unsigned radix keys
+
+template <typename CType, typename Enable = void>
+struct RadixKey {};
+
+template <typename CType>
+struct RadixKey<CType, typename std::enable_if<std::is_unsigned<CType>::value>::type> {
+  using type = CType;
+  static type Make(CType value) { return value; }
+};
+
+template <typename CType>
+struct RadixKey<CType, typename std::enable_if<std::is_integral<CType>::value &&
+                                               std::is_signed<CType>::value>::type> {
+  using type = typename std::make_unsigned<CType>::type;
+  // Flipping the sign bit maps the signed range onto the unsigned range
+  static type Make(CType value) {
+    return static_cast<type>(value) ^ (static_cast<type>(1) << (sizeof(type) * 8 - 1));
+  }
+};
+
+template <typename CType>
+struct RadixKey<CType,
+                typename std::enable_if<std::is_floating_point<CType>::value>::type> {
+  using type = typename std::conditional<sizeof(CType) == 4, uint32_t, uint64_t>::type;
+  static type Make(CType value) {
+    if (std::isnan(value)) {
+      // All NaNs sort together, after +inf
+      value = std::numeric_limits<CType>::quiet_NaN();
+    } else if (value == 0) {
+      // -0.0 and 0.0 compare equal and keep their relative order
+      value = 0;
+    }
+    type bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    static constexpr type kSignBit = static_cast<type>(1) << (sizeof(type) * 8 - 1);
+    // Negative values have their order reversed by inverting all bits;
+    // positive values move above them by setting the sign bit
+    const type mask = (bits & kSignBit) ? ~static_cast<type>(0) : kSignBit;
+    return bits ^ mask;
+  }
+};
+
+// Stably sort `indices` by `keys`.  The temporaries must have room for
+// `length` elements; the sorted indices are always written to `indices`.
+template <typename UKey>
+void RadixSort(UKey* keys, uint64_t* indices, int64_t length, UKey* keys_tmp,
+               uint64_t* indices_tmp) {
+  // 11-bit digits keep the histograms in L1 cache while needing only
+  // 6 passes over 64-bit keys
+  static constexpr int kDigitBits = sizeof(UKey) == 1 ? 8 : 11;
+  static constexpr int kRadix = 1 << kDigitBits;
+  static constexpr int kNumPasses =
+      (static_cast<int>(sizeof(UKey)) * 8 + kDigitBits - 1) / kDigitBits;
+  static constexpr UKey kDigitMask = kRadix - 1;
+
+  // Build the histograms of all digits in a single pass
+  std::vector<int64_t> counts(kNumPasses * kRadix, 0);
+  for (int64_t i = 0; i < length; ++i) {
+    const UKey key = keys[i];
+    for (int pass = 0; pass < kNumPasses; ++pass) {
+      ++counts[pass * kRadix + ((key >> (pass * kDigitBits)) & kDigitMask)];
+    }
+  }
+
+  uint64_t* const out_indices = indices;
+  for (int pass = 0; pass < kNumPasses; ++pass) {
+    int64_t* offsets = counts.data() + pass * kRadix;
+    const int shift = pass * kDigitBits;
+    if (offsets[(keys[0] >> shift) & kDigitMask] == length) {
+      // All keys share this digit
+      continue;
+    }
+    int64_t offset = 0;
+    for (int digit = 0; digit < kRadix; ++digit) {
+      const int64_t count = offsets[digit];
+      offsets[digit] = offset;
+      offset += count;
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      const int64_t position = offsets[(keys[i] >> shift) & kDigitMask]++;
+      keys_tmp[position] = keys[i];
+      indices_tmp[position] = indices[i];
+    }
+    std::swap(keys, keys_tmp);
+    std::swap(indices, indices_tmp);
+  }
+  if (indices != out_indices) {
+    std::memcpy(out_indices, indices, length * sizeof(uint64_t));
+  }
+}
+
+// ----------------------------------------------------------------------
+// Sort columns
+
+// The values of one sort key, in logical order across chunks
+class SortColumn {
+ public:
+  virtual ~SortColumn() = default;
+
+  // Stably reorder `indices` by the values they point to, nulls last
+  virtual void Sort(uint64_t* indices, int64_t length) = 0;
+
+ protected:
+  // Move the indices of null values to the end, keeping the order of
+  // both parts.  Return the number of valid values.
+  int64_t PartitionNulls(uint64_t* indices, int64_t length) const {
+    if (valid_.empty()) {
+      return length;
+    }
+    std::vector<uint64_t> nulls;
+    int64_t num_valid = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      if (valid_[indices[i]]) {
+        indices[num_valid++] = indices[i];
+      } else {
+        nulls.push_back(indices[i]);
+      }
+    }
+    std::copy(nulls.begin(), nulls.end(), indices + num_valid);
+    return num_valid;
+  }
+
+  // Set length_, and fill valid_ if any chunk has nulls
+  void InitValidity(const ArrayVector& chunks) {
+    bool has_nulls = false;
+    length_ = 0;
+    for (const auto& chunk : chunks) {
+      has_nulls |= chunk->null_count() > 0;
+      length_ += chunk->length();
+    }
+    if (!has_nulls) {
+      return;
+    }
+    valid_.reserve(length_);
+    for (const auto& chunk : chunks) {
+      for (int64_t i = 0; i < chunk->length(); ++i) {
+        valid_.push_back(chunk->IsValid(i));
+      }
+    }
+  }
+
+  int64_t length_;
+  // Validity by logical position, empty if there are no nulls
+  std::vector<uint8_t> valid_;
+};
+
+// The C type of values to sort; booleans are sorted as bytes
+template <typename ArrowType>
+struct SortCType {
+  using type = typename ArrowType::c_type;
+};
+
+template <>
+struct SortCType<BooleanType> {
+  using type = uint8_t;
+};
+
+template <typename ArrowType>
+class RadixSortColumn : public SortColumn {
+ public:
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using CType = typename SortCType<ArrowType>::type;
+  using UKey = typename RadixKey<CType>::type;
+
+  explicit RadixSortColumn(const ArrayVector& chunks) {
+    InitValidity(chunks);
+    keys_.reserve(length_);
+    for (const auto& chunk : chunks) {
+      const CType* values = static_cast<const ArrayType&>(*chunk).raw_values();
+      for (int64_t i = 0; i < chunk->length(); ++i) {
+        keys_.push_back(RadixKey<CType>::Make(values[i]));
+      }
+    }
+  }
+
+  void Sort(uint64_t* indices, int64_t length) override {
+    const int64_t num_valid = PartitionNulls(indices, length);
+    if (num_valid < 2) {
+      return;
+    }
+    std::vector<UKey> keys(num_valid), keys_tmp(num_valid);
+    std::vector<uint64_t> indices_tmp(num_valid);
+    for (int64_t i = 0; i < num_valid; ++i) {
+      keys[i] = keys_[indices[i]];
+    }
+    RadixSort(keys.data(), indices, num_valid, keys_tmp.data(), indices_tmp.data());
+  }
+
+ private:
+  std::vector<UKey> keys_;
+};
+
+template <>
+RadixSortColumn<BooleanType>::RadixSortColumn(const ArrayVector& chunks) {
+  InitValidity(chunks);
+  keys_.reserve(length_);
+  for (const auto& chunk : chunks) {
+    const auto& array = static_cast<const BooleanArray&>(*chunk);
+    for (int64_t i = 0; i < array.length(); ++i) {
+      keys_.push_back(array.Value(i));
+    }
+  }
+}
+
+class BinarySortColumn : public SortColumn {
+ public:
+  explicit BinarySortColumn(const ArrayVector& chunks) {
+    InitValidity(chunks);
+    views_.reserve(length_);
+    prefixes_.reserve(length_);
+    for (const auto& chunk : chunks) {
+      const auto& array = static_cast<const BinaryArray&>(*chunk);
+      for (int64_t i = 0; i < array.length(); ++i) {
+        const util::string_view view = array.GetView(i);
+        views_.push_back(view);
+        prefixes_.push_back(Prefix(view));
+      }
+    }
+  }
+
+  void Sort(uint64_t* indices, int64_t length) override {
+    const int64_t num_valid = PartitionNulls(indices, length);
+
+    // Compare the cached prefixes first, and the full values only when
+    // they are equal, so that most comparisons avoid touching the data
+    struct Entry {
+      uint64_t prefix;
+      uint64_t index;
+    };
+    std::vector<Entry> entries(num_valid);
+    for (int64_t i = 0; i < num_valid; ++i) {
+      entries[i] = {prefixes_[indices[i]], indices[i]};
+    }
+    std::stable_sort(entries.begin(), entries.end(),
+                     [this](const Entry& left, const Entry& right) {
+                       if (left.prefix != right.prefix) {
+                         return left.prefix < right.prefix;
+                       }
+                       return views_[left.index].compare(views_[right.index]) < 0;
+                     });
+    for (int64_t i = 0; i < num_valid; ++i) {
+      indices[i] = entries[i].index;
+    }
+  }
+
+ private:
+  // The first 8 bytes, zero-padded, ordered like the bytes themselves
+  static uint64_t Prefix(util::string_view view) {
+    uint64_t prefix = 0;
+    const size_t nbytes = std::min<size_t>(view.size(), 8);
+    for (size_t i = 0; i < nbytes; ++i) {
+      prefix |= static_cast<uint64_t>(static_cast<uint8_t>(view[i])) << (56 - 8 * i);
+    }
+    return prefix;
+  }
+
+  std::vector<util::string_view> views_;
+  std::vector<uint64_t> prefixes_;
+};
+
+Status MakeSortColumn(const Datum& values, std::unique_ptr<SortColumn>* out) {
+  ArrayVector chunks;
+  if (values.kind() == Datum::ARRAY) {
+    chunks.push_back(values.make_array());
+  } else {
+    chunks = values.chunked_array()->chunks();
+  }
+
+#define RADIX_SORT_CASE(InType)                    \
+  case InType::type_id:                            \
+    out->reset(new RadixSortColumn<InType>(chunks)); \
+    return Status::OK()
+
+  switch (values.type()->id()) {
+    RADIX_SORT_CASE(BooleanType);
+    RADIX_SORT_CASE(UInt8Type);
+    RADIX_SORT_CASE(Int8Type);
+    RADIX_SORT_CASE(UInt16Type);
+    RADIX_SORT_CASE(Int16Type);
+    RADIX_SORT_CASE(UInt32Type);
+    RADIX_SORT_CASE(Int32Type);
+    RADIX_SORT_CASE(UInt64Type);
+    RADIX_SORT_CASE(Int64Type);
+    RADIX_SORT_CASE(FloatType);
+    RADIX_SORT_CASE(DoubleType);
+    RADIX_SORT_CASE(Date32Type);
+    RADIX_SORT_CASE(Date64Type);
+    RADIX_SORT_CASE(Time32Type);
+    RADIX_SORT_CASE(Time64Type);
+    RADIX_SORT_CASE(TimestampType);
+    case Type::BINARY:
+    case Type::STRING:
+      out->reset(new BinarySortColumn(chunks));
+      return Status::OK();
+    default:
+      break;
+  }
+
+#undef RADIX_SORT_CASE
+
+  return Status::NotImplemented("Sorting values of type ", *values.type());
+}
+
+// ----------------------------------------------------------------------
+// Top-k selection
+
+// Maximum number of values scanned by one selection task
+constexpr int64_t kSelectBatchSize = 1 << 20;
+
+template <typename CType>
+typename std::enable_if<std::is_floating_point<CType>::value, bool>::type IsNaN(
+    CType value) {
+  return std::isnan(value);
+}
+
+template <typename CType>
+typename std::enable_if<!std::is_floating_point<CType>::value, bool>::type IsNaN(
+    CType value) {
+  return false;
+}
+
+// Selection keys of the values of one chunk; smaller keys are selected first
+template <typename ArrowType>
+class SelectKeys {
+ public:
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+  using CType = typename SortCType<ArrowType>::type;
+  using Key = typename RadixKey<CType>::type;
+  using Less = std::less<Key>;
+
+  SelectKeys(const Array& chunk, SortOrder order)
+      : values_(static_cast<const ArrayType&>(chunk).raw_values()),
+        // Inverting the bits of radix keys reverses their order
+        mask_(order == SortOrder::DESCENDING ? static_cast<Key>(~static_cast<Key>(0))
+                                             : 0) {}
+
+  static Less less(SortOrder order) { return Less(); }
+
+  bool is_nan(int64_t i) const { return IsNaN(values_[i]); }
+  Key key(int64_t i) const { return RadixKey<CType>::Make(values_[i]) ^ mask_; }
+
+ private:
+  const CType* values_;
+  Key mask_;
+};
+
+template <>
+class SelectKeys<BooleanType> {
+ public:
+  using Key = uint8_t;
+  using Less = std::less<Key>;
+
+  SelectKeys(const Array& chunk, SortOrder order)
+      : array_(static_cast<const BooleanArray&>(chunk)),
+        descending_(order == SortOrder::DESCENDING) {}
+
+  static Less less(SortOrder order) { return Less(); }
+
+  bool is_nan(int64_t i) const { return false; }
+  Key key(int64_t i) const { return array_.Value(i) != descending_; }
+
+ private:
+  const BooleanArray& array_;
+  bool descending_;
+};
+
+template <>
+class SelectKeys<BinaryType> {
+ public:
+  using Key = util::string_view;
+
+  struct Less {
+    bool operator()(const Key& left, const Key& right) const {
+      return descending ? right.compare(left) < 0 : left.compare(right) < 0;
+    }
+    bool descending;
+  };
+
+  SelectKeys(const Array& chunk, SortOrder order)
+      : array_(static_cast<const BinaryArray&>(chunk)) {}
+
+  static Less less(SortOrder order) { return Less{order == SortOrder::DESCENDING}; }
+
+  bool is_nan(int64_t i) const { return false; }
+  Key key(int64_t i) const { return array_.GetView(i); }
+
+ private:
+  const BinaryArray& array_;
+};
+
+// Keeps the k smallest (key, index) entries added to it.  Entries are
+// buffered and the buffer is cut down to the best k with a partial sort
+// whenever it fills up; the k-th best entry then serves as a threshold
+// that most further entries fail.
+template <typename Key, typename KeyLess>
+class TopKCollector {
+ public:
+  struct Entry {
+    Key key;
+    uint64_t index;
+  };
+
+  TopKCollector(int64_t k, KeyLess key_less)
+      : k_(k), capacity_(std::max<int64_t>(2 * k, 1024)), less_{key_less} {}
+
+  void Add(const Key& key, uint64_t index) {
+    const Entry entry{key, index};
+    if (has_threshold_ && !less_(entry, threshold_)) {
+      return;
+    }
+    entries_.push_back(entry);
+    if (static_cast<int64_t>(entries_.size()) == capacity_) {
+      Shrink();
+    }
+  }
+
+  // Return the best k entries, sorted if `sorted` is true
+  std::vector<Entry> Finish(bool sorted) {
+    if (static_cast<int64_t>(entries_.size()) > k_) {
+      Shrink();
+    }
+    if (sorted) {
+      std::sort(entries_.begin(), entries_.end(), less_);
+    }
+    return std::move(entries_);
+  }
+
+ private:
+  struct EntryLess {
+    bool operator()(const Entry& left, const Entry& right) const {
+      if (key_less(left.key, right.key)) {
+        return true;
+      }
+      if (key_less(right.key, left.key)) {
+        return false;
+      }
+      return left.index < right.index;
+    }
+    KeyLess key_less;
+  };
+
+  void Shrink() {
+    std::nth_element(entries_.begin(), entries_.begin() + (k_ - 1), entries_.end(),
+                     less_);
+    entries_.resize(k_);
+    threshold_ = entries_.back();
+    has_threshold_ = true;
+  }
+
+  int64_t k_;
+  int64_t capacity_;
+  EntryLess less_;
+  std::vector<Entry> entries_;
+  bool has_threshold_ = false;
+  Entry threshold_;
+};
+
+// A range of values scanned by one selection task
+struct SelectBatch {
+  size_t chunk;
+  int64_t offset, length;
+  // Logical index of the first value of the batch
+  uint64_t start;
+};
+
+template <typename ArrowType>
+Status SelectK(const ArrayVector& chunks, int64_t k, SortOrder order, bool sorted,
+               std::vector<uint64_t>* out) {
+  using Keys = SelectKeys<ArrowType>;
+  using Collector = TopKCollector<typename Keys::Key, typename Keys::Less>;
+  using Entry = typename Collector::Entry;
+
+  out->clear();
+  if (k == 0) {
+    return Status::OK();
+  }
+  std::vector<SelectBatch> batches;
+  uint64_t start = 0;
+  for (size_t chunk = 0; chunk < chunks.size(); ++chunk) {
+    const int64_t chunk_length = chunks[chunk]->length();
+    for (int64_t offset = 0; offset < chunk_length; offset += kSelectBatchSize) {
+      const int64_t length = std::min(kSelectBatchSize, chunk_length - offset);
+      batches.push_back({chunk, offset, length, start + offset});
+    }
+    start += chunk_length;
+  }
+
+  // NaNs and nulls are only selected after all other values, in index order,
+  // so each batch keeps its first k of them
+  const auto num_batches = static_cast<int>(batches.size());
+  std::vector<std::vector<Entry>> selected(num_batches);
+  std::vector<std::vector<uint64_t>> nans(num_batches), nulls(num_batches);
+  auto select_batch = [&](int i) -> Status {
+    const SelectBatch& batch = batches[i];
+    const Array& chunk = *chunks[batch.chunk];
+    const Keys keys(chunk, order);
+    const bool has_nulls = chunk.null_count() > 0;
+    Collector collector(k, Keys::less(order));
+    for (int64_t j = batch.offset; j < batch.offset + batch.length; ++j) {
+      const uint64_t index = batch.start + (j - batch.offset);
+      if (has_nulls && chunk.IsNull(j)) {
+        if (static_cast<int64_t>(nulls[i].size()) < k) {
+          nulls[i].push_back(index);
+        }
+      } else if (keys.is_nan(j)) {
+        if (static_cast<int64_t>(nans[i].size()) < k) {
+          nans[i].push_back(index);
+        }
+      } else {
+        collector.Add(keys.key(j), index);
+      }
+    }
+    selected[i] = collector.Finish(false);
+    return Status::OK();
+  };
+  if (num_batches > 1) {
+    RETURN_NOT_OK(internal::ParallelFor(num_batches, select_batch));
+  } else if (num_batches == 1) {
+    RETURN_NOT_OK(select_batch(0));
+  }
+
+  Collector merged(k, Keys::less(order));
+  for (const auto& entries : selected) {
+    for (const auto& entry : entries) {
+      merged.Add(entry.key, entry.index);
+    }
+  }
+  for (const auto& entry : merged.Finish(sorted)) {
+    out->push_back(entry.index);
+  }
+  for (const auto* trailing : {&nans, &nulls}) {
+    for (const auto& indices : *trailing) {
+      for (uint64_t index : indices) {
+        if (static_cast<int64_t>(out->size()) == k) {
+          return Status::OK();
+        }
+        out->push_back(index);
+      }
+    }
+  }
+  return Status::OK();
+}
+
+Status SelectKIndices(FunctionContext* ctx, const Datum& values, int64_t k,
+                      SortOrder order, bool sorted, Datum* out) {
+  if (!values.is_arraylike()) {
+    return Status::Invalid("TopK values must be array-like");
+  }
+  if (k < 0) {
+    return Status::Invalid("TopK needs a non-negative k, got ", k);
+  }
+  ArrayVector chunks;
+  if (values.kind() == Datum::ARRAY) {
+    chunks.push_back(values.make_array());
+  } else {
+    chunks = values.chunked_array()->chunks();
+  }
+
+  std::vector<uint64_t> indices;
+  Status status;
+
+#define SELECT_CASE(InType)                                      \
+  case InType::type_id:                                          \
+    status = SelectK<InType>(chunks, k, order, sorted, &indices); \
+    break
+
+  switch (values.type()->id()) {
+    SELECT_CASE(BooleanType);
+    SELECT_CASE(UInt8Type);
+    SELECT_CASE(Int8Type);
+    SELECT_CASE(UInt16Type);
+    SELECT_CASE(Int16Type);
+    SELECT_CASE(UInt32Type);
+    SELECT_CASE(Int32Type);
+    SELECT_CASE(UInt64Type);
+    SELECT_CASE(Int64Type);
+    SELECT_CASE(FloatType);
+    SELECT_CASE(DoubleType);
+    SELECT_CASE(Date32Type);
+    SELECT_CASE(Date64Type);
+    SELECT_CASE(Time32Type);
+    SELECT_CASE(Time64Type);
+    SELECT_CASE(TimestampType);
+    case Type::BINARY:
+    case Type::STRING:
+      status = SelectK<BinaryType>(chunks, k, order, sorted, &indices);
+      break;
+    default:
+      return Status::NotImplemented("Selecting values of type ", *values.type());
+  }
+
+#undef SELECT_CASE
+
+  RETURN_NOT_OK(status);
+  const auto length = static_cast<int64_t>(indices.size());
+  std::shared_ptr<Buffer> indices_buffer;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t),
+                               &indices_buffer));
+  if (length > 0) {
+    std::memcpy(indices_buffer->mutable_data(), indices.data(),
+                length * sizeof(uint64_t));
+  }
+  out->value = ArrayData::Make(uint64(), length, {nullptr, indices_buffer}, 0);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status SortToIndices(FunctionContext* ctx, const Datum& values, Datum* out) {
+  return SortToIndices(ctx, std::vector<Datum>{values}, out);
+}
+
+Status SortToIndices(FunctionContext* ctx, const std::vector<Datum>& keys,
+                     Datum* out) {
+  if (keys.empty()) {
+    return Status::Invalid("Must have at least one sort key");
+  }
+  int64_t length = -1;
+  for (const auto& key : keys) {
+    if (!key.is_arraylike()) {
+      return Status::Invalid("Sort keys must be array-like");
+    }
+    const int64_t key_length = key.kind() == Datum::ARRAY
+                                   ? key.array()->length
+                                   : key.chunked_array()->length();
+    if (length >= 0 && key_length != length) {
+      return Status::Invalid("Sort keys must have the same length");
+    }
+    length = key_length;
+  }
+
+  std::shared_ptr<Buffer> indices_buffer;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length * sizeof(uint64_t),
+                               &indices_buffer));
+  uint64_t* indices = reinterpret_cast<uint64_t*>(indices_buffer->mutable_data());
+  std::iota(indices, indices + length, 0);
+
+  // Stable sorts from the least to the most significant key yield the
+  // lexicographic order
+  for (auto it = keys.rbegin(); it != keys.rend(); ++it) {
+    std::unique_ptr<SortColumn> column;
+    RETURN_NOT_OK(MakeSortColumn(*it, &column));
+    column->Sort(indices, length);
+  }
+
+  out->value = ArrayData::Make(uint64(), length, {nullptr, indices_buffer}, 0);
+  return Status::OK();
+}
+
+Status TopK(FunctionContext* ctx, const Datum& values, int64_t k, SortOrder order,
+            Datum* out) {
+  return SelectKIndices(ctx, values, k, order, true, out);
+}
+
+Status SelectKUnstable(FunctionContext* ctx, const Datum& values, int64_t k,
+                       SortOrder order, Datum* out) {
+  return SelectKIndices(ctx, values, k, order, false, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
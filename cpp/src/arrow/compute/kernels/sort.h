@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_SORT_H
+#define ARROW_COMPUTE_KERNELS_SORT_H
+
+#include <cstdint>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \brief Compute the permutation that sorts an array-like value
+///
+/// The result is a uint64 array with the index of the smallest value
+/// first, suitable as input to Take().  The sort is stable and ascending,
+/// with nulls last.  NaNs sort after all other floating-point values and
+/// before nulls.
+///
+/// Integer, floating-point, boolean and temporal values are sorted with
+/// an LSD radix sort, binary and string values with a merge sort.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like values to sort
+/// \param[out] out resulting uint64 array of indices
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* context, const Datum& values, Datum* out);
+
+/// \brief Compute the permutation that sorts rows lexicographically
+///
+/// Rows are ordered by the first key, ties by the second key, and so on.
+/// All keys must be array-like with the same length.  See the
+/// single-key overload for the ordering of each key.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] keys array-like sort keys, most significant first
+/// \param[out] out resulting uint64 array of indices
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SortToIndices(FunctionContext* context, const std::vector<Datum>& keys,
+                     Datum* out);
+
+enum class SortOrder {
+  /// Smallest values first
+  ASCENDING,
+  /// Largest values first
+  DESCENDING,
+};
+
+/// \brief Compute the indices of the first k values in sort order
+///
+/// The result is a uint64 array of min(k, length) indices, suitable as
+/// input to Take(), best value first.  Ties are broken by position, so
+/// that in ascending order the result is the first k indices given by
+/// SortToIndices().  In both orders, NaNs come after all other values and
+/// nulls come last.
+///
+/// Values are scanned in batches on the CPU thread pool, each keeping its
+/// best k values with a partial sort, and the candidates of all batches
+/// are merged.  Values can have the same types as for SortToIndices().
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like values to select from
+/// \param[in] k the number of indices to return
+/// \param[in] order whether to select the smallest or the largest values
+/// \param[out] out resulting uint64 array of indices
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status TopK(FunctionContext* context, const Datum& values, int64_t k, SortOrder order,
+            Datum* out);
+
+/// \brief Compute the indices of the first k values in sort order, unordered
+///
+/// Like TopK(), but the indices are returned in no particular order, which
+/// saves sorting them.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status SelectKUnstable(FunctionContext* context, const Datum& values, int64_t k,
+                       SortOrder order, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_SORT_H
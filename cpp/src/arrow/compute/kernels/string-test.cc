@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/string.h"
+#include "arrow/compute/test-util.h"
+
+namespace arrow {
+namespace compute {
+
+using StringFunction = std::function<Status(FunctionContext*, const Datum&, Datum*)>;
+
+class TestStringKernels : public ComputeFixture, public TestBase {
+ public:
+  void AssertFunction(const StringFunction& func, const std::shared_ptr<Array>& input,
+                      const std::shared_ptr<Array>& expected) {
+    Datum out;
+    ASSERT_OK(func(&ctx_, input, &out));
+    ASSERT_OK(ValidateArray(*out.make_array()));
+    AssertArraysEqual(*expected, *out.make_array());
+  }
+
+  void AssertFunction(const StringFunction& func, const std::shared_ptr<DataType>& type,
+                      const std::string& input, const std::shared_ptr<DataType>& out_type,
+                      const std::string& expected) {
+    AssertFunction(func, ArrayFromJSON(type, input), ArrayFromJSON(out_type, expected));
+  }
+};
+
+TEST_F(TestStringKernels, Utf8Length) {
+  AssertFunction(Utf8Length, utf8(), R"(["abc", null, "", "de"])", int32(),
+                 "[3, null, 0, 2]");
+  AssertFunction(Utf8Length, utf8(), R"(["héllo", "€", "😀!"])", int32(), "[5, 1, 2]");
+  AssertFunction(Utf8Length, utf8(), "[]", int32(), "[]");
+
+  Datum out;
+  ASSERT_RAISES(TypeError, Utf8Length(&ctx_, ArrayFromJSON(binary(), "[]"), &out));
+  auto invalid = ArrayFromJSON(binary(), R"(["a", "é"])");
+  // Truncate the second value to its first byte
+  auto data = invalid->data()->Copy();
+  data->type = utf8();
+  std::shared_ptr<Buffer> offsets;
+  ASSERT_OK(AllocateBuffer(3 * sizeof(int32_t), &offsets));
+  auto raw_offsets = reinterpret_cast<int32_t*>(offsets->mutable_data());
+  raw_offsets[0] = 0;
+  raw_offsets[1] = 1;
+  raw_offsets[2] = 2;
+  data->buffers[1] = offsets;
+  ASSERT_RAISES(Invalid, Utf8Length(&ctx_, MakeArray(data), &out));
+}
+
+TEST_F(TestStringKernels, Substring) {
+  auto substring = [](const SubstringOptions& options) -> StringFunction {
+    return [options](FunctionContext* ctx, const Datum& values, Datum* out) {
+      return Substring(ctx, values, options, out);
+    };
+  };
+  const std::string input = R"(["abcdef", null, "", "xy", "hé€l"])";
+  AssertFunction(substring(SubstringOptions(1, 3)), utf8(), input, utf8(),
+                 R"(["bcd", null, "", "y", "é€l"])");
+  AssertFunction(substring(SubstringOptions(-2)), utf8(), input, utf8(),
+                 R"(["ef", null, "", "xy", "€l"])");
+  AssertFunction(substring(SubstringOptions(10)), utf8(), input, utf8(),
+                 R"(["", null, "", "", ""])");
+  AssertFunction(substring(SubstringOptions(0, 0)), utf8(), input, utf8(),
+                 R"(["", null, "", "", ""])");
+  // Binary values are sliced by bytes
+  AssertFunction(substring(SubstringOptions(1, 2)), binary(), input, binary(),
+                 R"(["bc", null, "", "y", "é"])");
+
+  // Sliced input
+  auto values = ArrayFromJSON(utf8(), R"(["abc", "def", null, "ghi"])")->Slice(1);
+  AssertFunction(substring(SubstringOptions(1)), values,
+                 ArrayFromJSON(utf8(), R"(["ef", null, "hi"])"));
+
+  Datum out;
+  ASSERT_RAISES(Invalid, Substring(&ctx_, values, SubstringOptions(0, -1), &out));
+}
+
+TEST_F(TestStringKernels, Matching) {
+  auto bind = [](Status (*func)(FunctionContext*, const Datum&, const std::string&,
+                                Datum*),
+                 const std::string& pattern) -> StringFunction {
+    return [func, pattern](FunctionContext* ctx, const Datum& values, Datum* out) {
+      return func(ctx, values, pattern, out);
+    };
+  };
+  const std::string input = R"(["abcab", null, "", "ab", "cabx", "b"])";
+  for (auto type : {utf8(), binary()}) {
+    AssertFunction(bind(StartsWith, "ab"), type, input, boolean(),
+                   "[true, null, false, true, false, false]");
+    AssertFunction(bind(EndsWith, "ab"), type, input, boolean(),
+                   "[true, null, false, true, false, false]");
+    AssertFunction(bind(Contains, "ab"), type, input, boolean(),
+                   "[true, null, false, true, true, false]");
+    AssertFunction(bind(Contains, ""), type, input, boolean(),
+                   "[true, null, true, true, true, true]");
+  }
+}
+
+TEST_F(TestStringKernels, Case) {
+  const std::string ascii = R"(["AbC-1", null, ""])";
+  AssertFunction(Lower, utf8(), ascii, utf8(), R"(["abc-1", null, ""])");
+  AssertFunction(Upper, utf8(), ascii, utf8(), R"(["ABC-1", null, ""])");
+  AssertFunction(Lower, utf8(),
+                 R"(["ÉCOLE ŁÓDŹ", "ΑΘΗΝΑ", "МОСКВА €"])", utf8(),
+                 R"(["école łódź", "αθηνα", "москва €"])");
+  AssertFunction(Upper, utf8(), R"(["straße ÿ", "σοφίας"])", utf8(),
+                 R"(["STRAßE Ÿ", "ΣΟΦΊΑΣ"])");
+  // Binary values only have their ASCII letters converted
+  AssertFunction(Upper, binary(), R"(["café"])", binary(), R"(["CAFé"])");
+
+  // Sliced input
+  auto values = ArrayFromJSON(utf8(), R"(["ab", "Cd", null, "éF"])")->Slice(1);
+  AssertFunction(Upper, values, ArrayFromJSON(utf8(), R"(["CD", null, "ÉF"])"));
+}
+
+TEST_F(TestStringKernels, ChunkedInput) {
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(utf8(), R"(["a", "bb"])"),
+                  ArrayFromJSON(utf8(), R"([null, "ééé"])")});
+  Datum out;
+  ASSERT_OK(Utf8Length(&ctx_, chunked, &out));
+  ASSERT_EQ(Datum::CHUNKED_ARRAY, out.kind());
+  AssertChunkedEqual(*out.chunked_array(), {ArrayFromJSON(int32(), "[1, 2]"),
+                                             ArrayFromJSON(int32(), "[null, 3]")});
+}
+
+}  // namespace compute
+}  // namespace arrow
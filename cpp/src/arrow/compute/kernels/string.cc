@@ -0,0 +1,553 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/string.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/utf8.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+// ----------------------------------------------------------------------
+// Helpers
+
+const int32_t kEmptyOffsets[] = {0};
+
+// The slots of a string or binary array
+struct StringSlots {
+  explicit StringSlots(const ArrayData& data)
+      : length(data.length),
+        offsets(data.buffers[1] ? data.GetValues<int32_t>(1) : kEmptyOffsets),
+        bytes(data.buffers[2] ? data.buffers[2]->data() : nullptr),
+        validity(data.null_count != 0 && data.buffers[0] ? data.buffers[0]->data()
+                                                          : nullptr),
+        validity_offset(data.offset) {}
+
+  bool IsValid(int64_t i) const {
+    return validity == nullptr || BitUtil::GetBit(validity, validity_offset + i);
+  }
+
+  const uint8_t* value(int64_t i) const { return bytes + offsets[i]; }
+  int32_t value_length(int64_t i) const { return offsets[i + 1] - offsets[i]; }
+
+  int64_t length;
+  const int32_t* offsets;
+  const uint8_t* bytes;
+  const uint8_t* validity;
+  int64_t validity_offset;
+};
+
+bool IsAscii(const uint8_t* data, int64_t size) {
+  static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
+  uint64_t mask;
+  while (size >= 8) {
+    memcpy(&mask, data, 8);
+    if ((mask & high_bits_64) != 0) {
+      return false;
+    }
+    data += 8;
+    size -= 8;
+  }
+  while (size-- > 0) {
+    if (*data++ & 0x80) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Check that all valid values are UTF-8, setting whether all the bytes of
+// the values are ASCII, in which case code points are bytes
+Status CheckUtf8(const StringSlots& slots, bool* is_ascii) {
+  const int32_t begin = slots.offsets[0];
+  const int32_t end = slots.offsets[slots.length];
+  *is_ascii = slots.length == 0 || IsAscii(slots.bytes + begin, end - begin);
+  if (*is_ascii) {
+    return Status::OK();
+  }
+  util::InitializeUTF8();
+  if (!util::ValidateUTF8Strings(slots.bytes, slots.offsets, slots.length,
+                                 slots.validity, slots.validity_offset)) {
+    return Status::Invalid("Invalid UTF8 sequence in input");
+  }
+  return Status::OK();
+}
+
+inline bool IsContinuationByte(uint8_t byte) { return (byte & 0xc0) == 0x80; }
+
+// The number of code points of valid UTF-8 data
+int64_t CountCodepoints(const uint8_t* data, int64_t size) {
+  int64_t count = 0;
+  for (int64_t i = 0; i < size; ++i) {
+    count += !IsContinuationByte(data[i]);
+  }
+  return count;
+}
+
+// The byte position of code point `index` in valid UTF-8 data, starting the
+// search at byte `from`, which is code point `from_index`
+int64_t CodepointPosition(const uint8_t* data, int64_t size, int64_t from,
+                          int64_t from_index, int64_t index) {
+  int64_t position = from;
+  for (int64_t k = from_index; k < index; ++k) {
+    ++position;
+    while (position < size && IsContinuationByte(data[position])) {
+      ++position;
+    }
+  }
+  return position;
+}
+
+Status CheckStringType(const Datum& values, bool allow_binary) {
+  if (!values.is_arraylike()) {
+    return Status::Invalid("Expected an array-like string datum");
+  }
+  const Type::type id = values.type()->id();
+  if (id != Type::STRING && !(allow_binary && id == Type::BINARY)) {
+    return Status::TypeError("Expected a string", allow_binary ? " or binary" : "",
+                             " datum, got ", values.type()->ToString());
+  }
+  return Status::OK();
+}
+
+Status InvokeStringKernel(FunctionContext* ctx, UnaryKernel* kernel, const Datum& values,
+                          Datum* out) {
+  std::vector<Datum> result;
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, kernel, values, &result));
+  *out = detail::WrapDatumsLike(values, result);
+  return Status::OK();
+}
+
+class StringUnaryKernel : public UnaryKernel {
+ public:
+  bool is_thread_safe() const override { return true; }
+};
+
+// ----------------------------------------------------------------------
+// Utf8Length
+
+class Utf8LengthKernel : public StringUnaryKernel {
+ public:
+  std::shared_ptr<DataType> out_type() const override { return int32(); }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    const StringSlots slots(in_data);
+    bool is_ascii;
+    RETURN_NOT_OK(CheckUtf8(slots, &is_ascii));
+
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+    std::shared_ptr<Buffer> values;
+    RETURN_NOT_OK(ctx->Allocate(slots.length * sizeof(int32_t), &values));
+    auto lengths = reinterpret_cast<int32_t*>(values->mutable_data());
+    if (is_ascii) {
+      for (int64_t i = 0; i < slots.length; ++i) {
+        lengths[i] = slots.value_length(i);
+      }
+    } else {
+      // Null slots are counted too, bytes being enough to count code points
+      for (int64_t i = 0; i < slots.length; ++i) {
+        lengths[i] =
+            static_cast<int32_t>(CountCodepoints(slots.value(i), slots.value_length(i)));
+      }
+    }
+    result->type = int32();
+    result->buffers.resize(2);
+    result->buffers[1] = std::move(values);
+    return Status::OK();
+  }
+};
+
+// ----------------------------------------------------------------------
+// Substring
+
+// The range [*begin, *end) of `options` in a value of `size` elements
+void SubstringRange(const SubstringOptions& options, int64_t size, int64_t* begin,
+                    int64_t* end) {
+  if (options.start < 0) {
+    *begin = std::max<int64_t>(0, size + options.start);
+  } else {
+    *begin = std::min(options.start, size);
+  }
+  *end = *begin + std::min(options.length, size - *begin);
+}
+
+class SubstringKernel : public StringUnaryKernel {
+ public:
+  SubstringKernel(const std::shared_ptr<DataType>& type, const SubstringOptions& options)
+      : type_(type), options_(options) {}
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    const StringSlots slots(in_data);
+    bool is_ascii = true;
+    if (type_->id() == Type::STRING) {
+      RETURN_NOT_OK(CheckUtf8(slots, &is_ascii));
+    }
+
+    // First compute the output offsets, remembering where each substring
+    // starts in the input
+    const int64_t length = slots.length;
+    std::shared_ptr<Buffer> offsets_buffer;
+    RETURN_NOT_OK(ctx->Allocate((length + 1) * sizeof(int32_t), &offsets_buffer));
+    auto offsets = reinterpret_cast<int32_t*>(offsets_buffer->mutable_data());
+    std::vector<int32_t> starts(length);
+    offsets[0] = 0;
+    for (int64_t i = 0; i < length; ++i) {
+      int64_t begin = 0, end = 0;
+      if (slots.IsValid(i)) {
+        const uint8_t* value = slots.value(i);
+        const int64_t size = slots.value_length(i);
+        if (is_ascii) {
+          SubstringRange(options_, size, &begin, &end);
+        } else {
+          SubstringRange(options_, CountCodepoints(value, size), &begin, &end);
+          const int64_t begin_position = CodepointPosition(value, size, 0, 0, begin);
+          end = CodepointPosition(value, size, begin_position, begin, end);
+          begin = begin_position;
+        }
+      }
+      starts[i] = slots.offsets[i] + static_cast<int32_t>(begin);
+      offsets[i + 1] = offsets[i] + static_cast<int32_t>(end - begin);
+    }
+
+    // Then allocate and copy the data at once
+    std::shared_ptr<Buffer> data;
+    RETURN_NOT_OK(ctx->Allocate(offsets[length], &data));
+    uint8_t* out_bytes = data->mutable_data();
+    for (int64_t i = 0; i < length; ++i) {
+      std::memcpy(out_bytes + offsets[i], slots.bytes + starts[i],
+                  offsets[i + 1] - offsets[i]);
+    }
+
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+    result->type = type_;
+    result->buffers.resize(3);
+    result->buffers[1] = std::move(offsets_buffer);
+    result->buffers[2] = std::move(data);
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  SubstringOptions options_;
+};
+
+// ----------------------------------------------------------------------
+// StartsWith, EndsWith and Contains
+
+template <typename Predicate>
+class MatchKernel : public StringUnaryKernel {
+ public:
+  explicit MatchKernel(const std::string& pattern) : pattern_(pattern) {}
+
+  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    const StringSlots slots(in_data);
+
+    std::shared_ptr<Buffer> values;
+    RETURN_NOT_OK(AllocateEmptyBitmap(ctx->memory_pool(), slots.length, &values));
+    uint8_t* bitmap = values->mutable_data();
+    const util::string_view pattern(pattern_);
+    Predicate predicate;
+    for (int64_t i = 0; i < slots.length; ++i) {
+      const util::string_view value(reinterpret_cast<const char*>(slots.value(i)),
+                                    slots.value_length(i));
+      if (predicate(value, pattern)) {
+        BitUtil::SetBit(bitmap, i);
+      }
+    }
+
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+    result->type = boolean();
+    result->buffers.resize(2);
+    result->buffers[1] = std::move(values);
+    return Status::OK();
+  }
+
+ private:
+  std::string pattern_;
+};
+
+struct StartsWithPredicate {
+  bool operator()(util::string_view value, util::string_view pattern) const {
+    return value.size() >= pattern.size() &&
+           std::memcmp(value.data(), pattern.data(), pattern.size()) == 0;
+  }
+};
+
+struct EndsWithPredicate {
+  bool operator()(util::string_view value, util::string_view pattern) const {
+    return value.size() >= pattern.size() &&
+           std::memcmp(value.data() + value.size() - pattern.size(), pattern.data(),
+                       pattern.size()) == 0;
+  }
+};
+
+struct ContainsPredicate {
+  bool operator()(util::string_view value, util::string_view pattern) const {
+    return pattern.empty() || value.find(pattern) != util::string_view::npos;
+  }
+};
+
+template <typename Predicate>
+Status InvokeMatchKernel(FunctionContext* ctx, const Datum& values,
+                         const std::string& pattern, Datum* out) {
+  RETURN_NOT_OK(CheckStringType(values, /*allow_binary=*/true));
+  MatchKernel<Predicate> kernel(pattern);
+  return InvokeStringKernel(ctx, &kernel, values, out);
+}
+
+// ----------------------------------------------------------------------
+// Lower and Upper
+
+// Simple case mappings between two-byte code points, so that the encoded
+// length never changes
+
+uint32_t LowerCodepoint(uint32_t c) {
+  if ((c >= 0xc0 && c <= 0xde && c != 0xd7) || (c >= 0x391 && c <= 0x3a9 && c != 0x3a2) ||
+      (c >= 0x410 && c <= 0x42f)) {
+    // Latin-1, Greek and Cyrillic capitals
+    return c + 32;
+  }
+  if ((c >= 0x100 && c <= 0x137 && c != 0x130) || (c >= 0x14a && c <= 0x177)) {
+    // Latin Extended-A pairs with an even capital
+    return c | 1;
+  }
+  if ((c >= 0x139 && c <= 0x148) || (c >= 0x179 && c <= 0x17e)) {
+    // Latin Extended-A pairs with an odd capital
+    return (c & 1) ? c + 1 : c;
+  }
+  if (c >= 0x400 && c <= 0x40f) {
+    return c + 80;
+  }
+  switch (c) {
+    case 0x178:
+      return 0xff;
+    case 0x386:
+      return 0x3ac;
+    case 0x388:
+    case 0x389:
+    case 0x38a:
+      return c + 37;
+    case 0x38c:
+      return 0x3cc;
+    case 0x38e:
+    case 0x38f:
+      return c + 63;
+    default:
+      return c;
+  }
+}
+
+uint32_t UpperCodepoint(uint32_t c) {
+  if ((c >= 0xe0 && c <= 0xfe && c != 0xf7) || (c >= 0x3b1 && c <= 0x3c9 && c != 0x3c2) ||
+      (c >= 0x430 && c <= 0x44f)) {
+    return c - 32;
+  }
+  if ((c >= 0x100 && c <= 0x137 && c != 0x131) || (c >= 0x14a && c <= 0x177)) {
+    return c & ~1u;
+  }
+  if ((c >= 0x139 && c <= 0x148) || (c >= 0x179 && c <= 0x17e)) {
+    return (c & 1) ? c : c - 1;
+  }
+  if (c >= 0x450 && c <= 0x45f) {
+    return c - 80;
+  }
+  switch (c) {
+    case 0xff:
+      return 0x178;
+    case 0x3c2:
+      return 0x3a3;
+    case 0x3ac:
+      return 0x386;
+    case 0x3ad:
+    case 0x3ae:
+    case 0x3af:
+      return c - 37;
+    case 0x3cc:
+      return 0x38c;
+    case 0x3cd:
+    case 0x3ce:
+      return c - 63;
+    default:
+      return c;
+  }
+}
+
+inline uint8_t LowerAscii(uint8_t c) {
+  return static_cast<uint8_t>(c - 'A') < 26 ? static_cast<uint8_t>(c + 32) : c;
+}
+
+inline uint8_t UpperAscii(uint8_t c) {
+  return static_cast<uint8_t>(c - 'a') < 26 ? static_cast<uint8_t>(c - 32) : c;
+}
+
+template <bool kUpper>
+class CaseKernel : public StringUnaryKernel {
+ public:
+  explicit CaseKernel(const std::shared_ptr<DataType>& type) : type_(type) {}
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    const StringSlots slots(in_data);
+    bool is_ascii = true;
+    if (type_->id() == Type::STRING) {
+      RETURN_NOT_OK(CheckUtf8(slots, &is_ascii));
+    }
+
+    // The lengths are unchanged: the offsets are those of the input, rebased
+    const int64_t length = slots.length;
+    const int32_t base = slots.offsets[0];
+    std::shared_ptr<Buffer> offsets_buffer;
+    RETURN_NOT_OK(ctx->Allocate((length + 1) * sizeof(int32_t), &offsets_buffer));
+    auto offsets = reinterpret_cast<int32_t*>(offsets_buffer->mutable_data());
+    for (int64_t i = 0; i <= length; ++i) {
+      offsets[i] = slots.offsets[i] - base;
+    }
+
+    std::shared_ptr<Buffer> data;
+    RETURN_NOT_OK(ctx->Allocate(offsets[length], &data));
+    uint8_t* out_bytes = data->mutable_data();
+    const uint8_t* in_bytes = slots.bytes + base;
+    if (is_ascii) {
+      for (int32_t j = 0; j < offsets[length]; ++j) {
+        out_bytes[j] = kUpper ? UpperAscii(in_bytes[j]) : LowerAscii(in_bytes[j]);
+      }
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        const int32_t begin = offsets[i];
+        const int32_t end = offsets[i + 1];
+        if (slots.IsValid(i)) {
+          ConvertUtf8(in_bytes + begin, end - begin, out_bytes + begin);
+        } else {
+          std::memcpy(out_bytes + begin, in_bytes + begin, end - begin);
+        }
+      }
+    }
+
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+    result->type = type_;
+    result->buffers.resize(3);
+    result->buffers[1] = std::move(offsets_buffer);
+    result->buffers[2] = std::move(data);
+    return Status::OK();
+  }
+
+ private:
+  // Convert valid UTF-8 data
+  static void ConvertUtf8(const uint8_t* in, int32_t size, uint8_t* out) {
+    int32_t j = 0;
+    while (j < size) {
+      const uint8_t c = in[j];
+      if (c < 0x80) {
+        out[j] = kUpper ? UpperAscii(c) : LowerAscii(c);
+        ++j;
+      } else if (c < 0xe0) {
+        uint32_t codepoint = (static_cast<uint32_t>(c & 0x1f) << 6) | (in[j + 1] & 0x3f);
+        codepoint = kUpper ? UpperCodepoint(codepoint) : LowerCodepoint(codepoint);
+        out[j] = static_cast<uint8_t>(0xc0 | (codepoint >> 6));
+        out[j + 1] = static_cast<uint8_t>(0x80 | (codepoint & 0x3f));
+        j += 2;
+      } else {
+        // Three and four byte sequences are copied
+        const int32_t width = c < 0xf0 ? 3 : 4;
+        std::memcpy(out + j, in + j, width);
+        j += width;
+      }
+    }
+  }
+
+  std::shared_ptr<DataType> type_;
+};
+
+}  // namespace
+
+Status Utf8Length(FunctionContext* ctx, const Datum& values, Datum* out) {
+  RETURN_NOT_OK(CheckStringType(values, /*allow_binary=*/false));
+  Utf8LengthKernel kernel;
+  return InvokeStringKernel(ctx, &kernel, values, out);
+}
+
+Status Substring(FunctionContext* ctx, const Datum& values,
+                 const SubstringOptions& options, Datum* out) {
+  RETURN_NOT_OK(CheckStringType(values, /*allow_binary=*/true));
+  if (options.length < 0) {
+    return Status::Invalid("Substring length must be non-negative, got ",
+                           options.length);
+  }
+  SubstringKernel kernel(values.type(), options);
+  return InvokeStringKernel(ctx, &kernel, values, out);
+}
+
+Status StartsWith(FunctionContext* ctx, const Datum& values, const std::string& pattern,
+                  Datum* out) {
+  return InvokeMatchKernel<StartsWithPredicate>(ctx, values, pattern, out);
+}
+
+Status EndsWith(FunctionContext* ctx, const Datum& values, const std::string& pattern,
+                Datum* out) {
+  return InvokeMatchKernel<EndsWithPredicate>(ctx, values, pattern, out);
+}
+
+Status Contains(FunctionContext* ctx, const Datum& values, const std::string& pattern,
+                Datum* out) {
+  return InvokeMatchKernel<ContainsPredicate>(ctx, values, pattern, out);
+}
+
+Status Lower(FunctionContext* ctx, const Datum& values, Datum* out) {
+  RETURN_NOT_OK(CheckStringType(values, /*allow_binary=*/true));
+  CaseKernel<false> kernel(values.type());
+  return InvokeStringKernel(ctx, &kernel, values, out);
+}
+
+Status Upper(FunctionContext* ctx, const Datum& values, Datum* out) {
+  RETURN_NOT_OK(CheckStringType(values, /*allow_binary=*/true));
+  CaseKernel<true> kernel(values.type());
+  return InvokeStringKernel(ctx, &kernel, values, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
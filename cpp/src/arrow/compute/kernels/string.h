@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_STRING_H
+#define ARROW_COMPUTE_KERNELS_STRING_H
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+// The kernels below take array-like string or binary values and return a
+// result of the same shape, null where the input is null.  String inputs
+// are checked to be valid UTF-8 where code points matter; inputs made of
+// ASCII bytes only skip the check and are processed byte-wise.
+
+/// \brief Compute the number of code points of each string
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like string values
+/// \param[out] out resulting int32 datum
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Length(FunctionContext* context, const Datum& values, Datum* out);
+
+struct ARROW_EXPORT SubstringOptions {
+  SubstringOptions(int64_t start = 0,  // NOLINT implicit conversion
+                   int64_t length = std::numeric_limits<int64_t>::max())
+      : start(start), length(length) {}
+
+  /// The position of the first code point (byte, for binary values) to
+  /// keep; negative positions count from the end of each value
+  int64_t start;
+  /// The maximum number of code points (bytes) to keep, non-negative
+  int64_t length;
+};
+
+/// \brief Extract a substring of each value
+///
+/// The output has the type of the input.  Its offsets are computed before
+/// its data is allocated and copied in a single pass.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like string or binary values
+/// \param[in] options the range to extract
+/// \param[out] out resulting datum
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Substring(FunctionContext* context, const Datum& values,
+                 const SubstringOptions& options, Datum* out);
+
+/// \brief Test whether each value starts with `pattern`
+///
+/// Matching is byte-wise, which for valid UTF-8 is also code point-wise.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like string or binary values
+/// \param[in] pattern the prefix to look for
+/// \param[out] out resulting boolean datum
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status StartsWith(FunctionContext* context, const Datum& values,
+                  const std::string& pattern, Datum* out);
+
+/// \brief Test whether each value ends with `pattern`, see StartsWith
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status EndsWith(FunctionContext* context, const Datum& values,
+                const std::string& pattern, Datum* out);
+
+/// \brief Test whether each value contains `pattern`, see StartsWith
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Contains(FunctionContext* context, const Datum& values,
+                const std::string& pattern, Datum* out);
+
+/// \brief Convert each value to lower case
+///
+/// ASCII letters are converted in binary values.  In string values, the
+/// letters of the Latin-1, Latin Extended-A, Greek and Cyrillic blocks are
+/// converted as well, using simple case mappings which do not change the
+/// encoded length, so that the output offsets are those of the input.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like string or binary values
+/// \param[out] out resulting datum, with the type of the input
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Lower(FunctionContext* context, const Datum& values, Datum* out);
+
+/// \brief Convert each value to upper case, see Lower
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Upper(FunctionContext* context, const Datum& values, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_STRING_H
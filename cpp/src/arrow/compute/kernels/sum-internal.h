@@ -0,0 +1,187 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_SUM_INTERNAL_H
+#define ARROW_COMPUTE_KERNELS_SUM_INTERNAL_H
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/array.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/sum.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/scalar.h"
+#include "arrow/status.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+
+namespace arrow {
+namespace compute {
+
+template <typename ArrowType,
+          typename SumType = typename FindAccumulatorType<ArrowType>::Type>
+struct SumState {
+  using ThisType = SumState<ArrowType, SumType>;
+  using SumCType = typename SumType::c_type;
+
+  ThisType operator+(const ThisType& rhs) const {
+    return ThisType(this->count + rhs.count, this->sum + rhs.sum);
+  }
+
+  ThisType& operator+=(const ThisType& rhs) {
+    this->count += rhs.count;
+    this->sum += rhs.sum;
+
+    return *this;
+  }
+
+  std::shared_ptr<Scalar> AsScalar() const {
+    using ScalarType = typename TypeTraits<SumType>::ScalarType;
+    return std::make_shared<ScalarType>(this->sum);
+  }
+
+  size_t count = 0;
+  SumCType sum = 0;
+};
+
+namespace detail {
+
+// Sum a run of valid values.  Independent accumulators let the compiler
+// vectorize the loop with the target's widest registers, including for
+// floating-point values (whose additions can't be reordered otherwise).
+template <typename SumCType, typename CType>
+SumCType SumValid(const CType* values, int64_t length) {
+  constexpr int64_t kLanes = 8;
+  SumCType lanes[kLanes] = {};
+  const int64_t length_rounded = BitUtil::RoundDown(length, kLanes);
+  for (int64_t i = 0; i < length_rounded; i += kLanes) {
+    for (int64_t k = 0; k < kLanes; ++k) {
+      lanes[k] += values[i + k];
+    }
+  }
+  SumCType sum = 0;
+  for (int64_t i = length_rounded; i < length; ++i) {
+    sum += values[i];
+  }
+  for (int64_t k = 0; k < kLanes; ++k) {
+    sum += lanes[k];
+  }
+  return sum;
+}
+
+// Sum up to 64 values according to a validity word, without branching.
+// Values are consumed by validity byte, with one accumulator per bit
+// position, so that the compiler can vectorize the loop.
+template <typename SumCType, typename CType>
+SumCType SumMasked(const CType* values, int64_t length, uint64_t word) {
+  SumCType lanes[8] = {};
+  const int64_t length_rounded = BitUtil::RoundDown(length, 8);
+  for (int64_t i = 0; i < length_rounded; i += 8) {
+    const uint64_t bits = word >> i;
+    for (int k = 0; k < 8; ++k) {
+      lanes[k] += SelectValue((bits >> k) & 1, values[i + k], CType(0));
+    }
+  }
+  SumCType sum = 0;
+  for (int64_t i = length_rounded; i < length; ++i) {
+    sum += SelectValue((word >> i) & 1, values[i], CType(0));
+  }
+  for (int k = 0; k < 8; ++k) {
+    sum += lanes[k];
+  }
+  return sum;
+}
+
+}  // namespace detail
+
+/// \brief Sum the valid values of a numeric array
+template <typename ArrowType, typename StateType = SumState<ArrowType>>
+StateType ConsumeSum(const typename TypeTraits<ArrowType>::ArrayType& array) {
+  using SumCType = typename StateType::SumCType;
+
+  StateType local;
+  const auto values = array.raw_values();
+  const int64_t length = array.length();
+  const int64_t null_count = array.null_count();
+
+  if (null_count == length) {
+    return local;
+  }
+  // Don't bother visiting the bitmap if there are no nulls
+  const uint8_t* bitmap = null_count == 0 ? NULLPTR : array.null_bitmap_data();
+  detail::VisitValidityWords(
+      bitmap, array.offset(), length,
+      [&](int64_t position, int64_t run_length) {
+        local.sum += detail::SumValid<SumCType>(values + position, run_length);
+        local.count += run_length;
+      },
+      [&](int64_t position, int64_t word_length, uint64_t word) {
+        local.sum += detail::SumMasked<SumCType>(values + position, word_length, word);
+        local.count += BitUtil::PopCount(word);
+      });
+  return local;
+}
+
+/// \brief Sum the valid values of a dictionary-encoded array, gathering them
+/// from the dictionary instead of decoding the array
+template <typename ArrowType, typename StateType = SumState<ArrowType>>
+StateType ConsumeDictionarySum(const DictionaryArray& array) {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+  StateType local;
+  const auto dictionary = array.dictionary();
+  const auto values = static_cast<const ArrayType&>(*dictionary).raw_values();
+  const bool dictionary_nulls = dictionary->null_count() > 0;
+  detail::VisitDictionaryIndices(*array.data(), [&](int64_t index) {
+    if (dictionary_nulls && dictionary->IsNull(index)) return;
+    local.sum += values[index];
+    ++local.count;
+  });
+  return local;
+}
+
+/// \brief AggregateFunction accumulating the sum and count of valid values
+///
+/// Dictionary-encoded inputs with ArrowType values are also accepted.
+/// Subclasses implement Finalize() and out_type().
+template <typename ArrowType, typename StateType = SumState<ArrowType>>
+class SumAggregateFunctionBase : public AggregateFunctionStaticState<StateType> {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  Status Consume(const Array& input, StateType* state) const override {
+    if (input.type_id() == Type::DICTIONARY) {
+      *state += ConsumeDictionarySum<ArrowType, StateType>(
+          static_cast<const DictionaryArray&>(input));
+      return Status::OK();
+    }
+    *state += ConsumeSum<ArrowType, StateType>(static_cast<const ArrayType&>(input));
+    return Status::OK();
+  }
+
+  Status Merge(const StateType& src, StateType* dst) const override {
+    *dst += src;
+    return Status::OK();
+  }
+};
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_SUM_INTERNAL_H
@@ -64,6 +64,9 @@ std::shared_ptr<AggregateFunction> MakeSumAggregateFunction(const DataType& type
 
 /// \brief Sum values of a numeric array.
 ///
+/// Dictionary-encoded values are summed from their dictionary by index,
+/// without decoding.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] value datum to sum, expecting Array or ChunkedArray
 /// \param[out] out resulting datum
@@ -0,0 +1,181 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/compute/test-util.h"
+
+using std::shared_ptr;
+using std::vector;
+
+using arrow::internal::checked_cast;
+
+namespace arrow {
+namespace compute {
+
+class TestTake : public ComputeFixture, public ::testing::Test {
+ protected:
+  void AssertTake(const shared_ptr<DataType>& type, const std::string& values,
+                  const std::string& indices, const std::string& expected) {
+    for (auto index_type : {int8(), uint16(), int32(), uint64()}) {
+      Datum out;
+      ASSERT_OK(Take(&ctx_, ArrayFromJSON(type, values),
+                     ArrayFromJSON(index_type, indices), &out));
+      ASSERT_EQ(out.kind(), Datum::ARRAY);
+      const auto result = out.make_array();
+      ASSERT_OK(ValidateArray(*result));
+      AssertArraysEqual(*ArrayFromJSON(type, expected), *result);
+    }
+  }
+};
+
+TEST_F(TestTake, Primitive) {
+  AssertTake(int32(), "[7, 8, null, 9]", "[3, 0, 0, null, 2, 1]",
+             "[9, 7, 7, null, null, 8]");
+  AssertTake(float64(), "[1.5, 2.5]", "[]", "[]");
+  AssertTake(int16(), "[1, 2]", "[null, null]", "[null, null]");
+  AssertTake(timestamp(TimeUnit::MICRO), "[10, 20, 30]", "[2, 1]", "[30, 20]");
+}
+
+TEST_F(TestTake, Boolean) {
+  AssertTake(boolean(), "[true, false, null]", "[1, 0, 2, 0, null]",
+             "[false, true, null, true, null]");
+}
+
+TEST_F(TestTake, Null) {
+  AssertTake(null(), "[null, null]", "[1, 0, 1]", "[null, null, null]");
+}
+
+TEST_F(TestTake, Strings) {
+  AssertTake(utf8(), R"(["a", "", null, "def"])", "[3, 0, null, 1, 2, 3]",
+             R"(["def", "a", null, "", null, "def"])");
+  AssertTake(binary(), R"(["ab", "c"])", "[1, 1]", R"(["c", "c"])");
+}
+
+TEST_F(TestTake, List) {
+  AssertTake(list(int32()), "[[1, 2], null, [], [3, null]]", "[3, 1, 0, null, 2, 0]",
+             "[[3, null], null, [1, 2], null, [], [1, 2]]");
+  AssertTake(list(list(utf8())), R"([[["a"], []], [["b", "c"]]])", "[1, 0]",
+             R"([[["b", "c"]], [["a"], []]])");
+}
+
+TEST_F(TestTake, Struct) {
+  auto type = struct_({field("a", int32()), field("b", utf8())});
+  AssertTake(type, R"([{"a": 1, "b": "x"}, null, {"a": null, "b": "z"}])",
+             "[2, 1, null, 0]",
+             R"([{"a": null, "b": "z"}, null, null, {"a": 1, "b": "x"}])");
+}
+
+TEST_F(TestTake, Sliced) {
+  auto values = ArrayFromJSON(utf8(), R"(["a", "b", null, "d", "e"])")->Slice(1, 3);
+  auto indices = ArrayFromJSON(int32(), "[9, 2, 0, 1]")->Slice(1);
+  Datum out;
+  ASSERT_OK(Take(&ctx_, values, indices, &out));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["d", "b", null])"), *out.make_array());
+}
+
+TEST_F(TestTake, ChunkedValues) {
+  // Empty chunks must be skipped when resolving indices
+  auto values = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(utf8(), R"(["a", "b"])"), ArrayFromJSON(utf8(), "[]"),
+                  ArrayFromJSON(utf8(), R"([null, "d", "e"])")});
+  Datum out;
+  ASSERT_OK(Take(&ctx_, values, ArrayFromJSON(int64(), "[4, 0, 2, 1, null, 3]"), &out));
+  ASSERT_EQ(out.kind(), Datum::ARRAY);
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["e", "a", null, "b", null, "d"])"),
+                    *out.make_array());
+
+  // The output is chunked like the indices
+  auto indices = std::make_shared<ChunkedArray>(ArrayVector{
+      ArrayFromJSON(int8(), "[3, 3]"), ArrayFromJSON(int8(), "[1, 4, 0]")});
+  ASSERT_OK(Take(&ctx_, values, indices, &out));
+  ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+  ChunkedArray expected(ArrayVector{ArrayFromJSON(utf8(), R"(["d", "d"])"),
+                                    ArrayFromJSON(utf8(), R"(["b", "e", "a"])")});
+  ASSERT_TRUE(out.chunked_array()->Equals(expected));
+}
+
+TEST_F(TestTake, ChunkedLists) {
+  auto values = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(list(int16()), "[[1], [2, 3]]"),
+                  ArrayFromJSON(list(int16()), "[null, [4, 5, 6]]")->Slice(1)});
+  Datum out;
+  ASSERT_OK(Take(&ctx_, values, ArrayFromJSON(int32(), "[2, 0, 1, 2]"), &out));
+  AssertArraysEqual(*ArrayFromJSON(list(int16()), "[[4, 5, 6], [1], [2, 3], [4, 5, 6]]"),
+                    *out.make_array());
+}
+
+TEST_F(TestTake, Random) {
+  auto rand = random::RandomArrayGenerator(0x7a4e);
+  const int64_t length = 1500;
+  auto chunk1 = rand.Int64(length, -1000, 1000, 0.1);
+  auto chunk2 = rand.Int64(length, -1000, 1000, 0.1);
+  auto values = std::make_shared<ChunkedArray>(ArrayVector{chunk1, chunk2});
+  auto indices = rand.Int32(length, 0, 2 * length - 1, 0.1);
+
+  Datum out;
+  ASSERT_OK(Take(&ctx_, values, indices, &out));
+  const auto result = out.make_array();
+  ASSERT_OK(ValidateArray(*result));
+
+  const auto& int_indices = checked_cast<const Int32Array&>(*indices);
+  const auto& taken = checked_cast<const Int64Array&>(*result);
+  for (int64_t i = 0; i < length; ++i) {
+    if (int_indices.IsNull(i)) {
+      ASSERT_TRUE(taken.IsNull(i));
+      continue;
+    }
+    const int32_t index = int_indices.Value(i);
+    const auto& chunk =
+        checked_cast<const Int64Array&>(index < length ? *chunk1 : *chunk2);
+    const int64_t chunk_index = index < length ? index : index - length;
+    ASSERT_EQ(taken.IsValid(i), chunk.IsValid(chunk_index)) << i;
+    if (chunk.IsValid(chunk_index)) {
+      ASSERT_EQ(taken.Value(i), chunk.Value(chunk_index)) << i;
+    }
+  }
+}
+
+TEST_F(TestTake, Errors) {
+  Datum out;
+  auto values = ArrayFromJSON(int32(), "[1, 2]");
+  ASSERT_RAISES(Invalid, Take(&ctx_, values, ArrayFromJSON(int32(), "[0, 2]"), &out));
+  ASSERT_RAISES(Invalid, Take(&ctx_, values, ArrayFromJSON(int8(), "[-1]"), &out));
+  ASSERT_RAISES(Invalid, Take(&ctx_, values,
+                              ArrayFromJSON(uint64(), "[18446744073709551615]"), &out));
+  ASSERT_RAISES(TypeError, Take(&ctx_, values, ArrayFromJSON(float64(), "[0]"), &out));
+  // Null indices are not checked
+  ASSERT_OK(Take(&ctx_, values, ArrayFromJSON(int32(), "[null]"), &out));
+}
+
+}  // namespace compute
+}  // namespace arrow
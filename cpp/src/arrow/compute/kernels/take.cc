@@ -0,0 +1,501 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/take.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util-internal.h"
+#include "arrow/table.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::CopyBitmap;
+using internal::CountSetBits;
+
+namespace compute {
+
+namespace {
+
+using ArrayDataVector = std::vector<std::shared_ptr<ArrayData>>;
+
+// Map logical positions to positions in a single chunk
+struct SingleChunkResolver {
+  void Resolve(int64_t index, int* chunk, int64_t* chunk_index) const {
+    *chunk = 0;
+    *chunk_index = index;
+  }
+};
+
+// Map logical positions to (chunk, position in chunk) over several chunks
+class ChunkResolver {
+ public:
+  explicit ChunkResolver(const ArrayDataVector& chunks) : offsets_(chunks.size() + 1, 0) {
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      offsets_[i + 1] = offsets_[i] + chunks[i]->length;
+    }
+  }
+
+  void Resolve(int64_t index, int* chunk, int64_t* chunk_index) const {
+    // Neighbouring indices often fall in the same chunk
+    if (index < offsets_[cached_chunk_] || index >= offsets_[cached_chunk_ + 1]) {
+      auto it = std::upper_bound(offsets_.begin(), offsets_.end(), index);
+      cached_chunk_ = static_cast<int>(it - offsets_.begin()) - 1;
+    }
+    *chunk = cached_chunk_;
+    *chunk_index = index - offsets_[cached_chunk_];
+  }
+
+ private:
+  std::vector<int64_t> offsets_;
+  mutable int cached_chunk_ = 0;
+};
+
+// Like ArrayData::GetValues, but allowing for absent buffers in empty arrays
+template <typename T>
+const T* GetValuesSafe(const ArrayData& data, int i) {
+  return data.buffers[i] ? data.GetValues<T>(i) : NULLPTR;
+}
+
+int64_t TotalLength(const ArrayDataVector& chunks) {
+  int64_t length = 0;
+  for (const auto& chunk : chunks) {
+    length += chunk->length;
+  }
+  return length;
+}
+
+Status TakeChunks(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                  const ArrayDataVector& chunks, const ArrayData& indices,
+                  std::shared_ptr<ArrayData>* out);
+
+// Gather values of any supported type, for indices of type IndexCType
+template <typename IndexCType>
+class Taker {
+ public:
+  Taker(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+        const ArrayDataVector& chunks, const ArrayData& indices)
+      : pool_(pool),
+        type_(type),
+        chunks_(chunks),
+        indices_(indices),
+        length_(indices.length),
+        index_values_(GetValuesSafe<IndexCType>(indices, 1)),
+        index_bitmap_(indices.GetNullCount() > 0 ? indices.buffers[0]->data()
+                                                 : NULLPTR) {}
+
+  Status CheckBounds() const {
+    const int64_t values_length = TotalLength(chunks_);
+    bool out_of_bounds = false;
+    // Accumulate without branching, so that the common case vectorizes
+    auto check = [&](int64_t position) {
+      const int64_t index = static_cast<int64_t>(index_values_[position]);
+      out_of_bounds |= (index < 0) | (index >= values_length);
+    };
+    detail::VisitValidityWords(
+        index_bitmap_, indices_.offset, length_,
+        [&](int64_t position, int64_t length) {
+          for (int64_t i = 0; i < length; ++i) {
+            check(position + i);
+          }
+        },
+        [&](int64_t position, int64_t, uint64_t word) {
+          for (; word != 0; word &= word - 1) {
+            check(position + BitUtil::CountTrailingZeros(word));
+          }
+        });
+    if (out_of_bounds) {
+      return Status::Invalid("Take index out of bounds");
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) {
+    out_ = ArrayData::Make(type_, length_, {NULLPTR}, length_);
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanType&) {
+    std::shared_ptr<Buffer> null_bitmap, data;
+    int64_t null_count;
+    RETURN_NOT_OK(TakeNullBitmap(&null_bitmap, &null_count));
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool_, length_, &data));
+
+    const std::vector<const uint8_t*> values = ChunkBuffers(1);
+    uint8_t* out_data = data->mutable_data();
+    VisitIndices([&](int64_t position, int chunk, int64_t index) {
+      if (BitUtil::GetBit(values[chunk], chunks_[chunk]->offset + index)) {
+        BitUtil::SetBit(out_data, position);
+      }
+    });
+    out_ = ArrayData::Make(type_, length_, {null_bitmap, data}, null_count);
+    return Status::OK();
+  }
+
+  Status Visit(const FixedWidthType& type) {
+    if (type.bit_width() % 8 != 0) {
+      return Status::NotImplemented("Take of type ", type);
+    }
+    const int64_t byte_width = type.bit_width() / 8;
+    std::shared_ptr<Buffer> null_bitmap, data;
+    int64_t null_count;
+    RETURN_NOT_OK(TakeNullBitmap(&null_bitmap, &null_count));
+    RETURN_NOT_OK(AllocateBuffer(pool_, length_ * byte_width, &data));
+    uint8_t* out_data = data->mutable_data();
+    if (index_bitmap_ != NULLPTR) {
+      // Slots for null indices are not written
+      std::memset(out_data, 0, static_cast<size_t>(data->size()));
+    }
+
+    switch (byte_width) {
+      case 1:
+        TakeFixedWidth<1>(byte_width, out_data);
+        break;
+      case 2:
+        TakeFixedWidth<2>(byte_width, out_data);
+        break;
+      case 4:
+        TakeFixedWidth<4>(byte_width, out_data);
+        break;
+      case 8:
+        TakeFixedWidth<8>(byte_width, out_data);
+        break;
+      case 16:
+        TakeFixedWidth<16>(byte_width, out_data);
+        break;
+      default:
+        TakeFixedWidth<0>(byte_width, out_data);
+    }
+    out_ = ArrayData::Make(type_, length_, {null_bitmap, data}, null_count);
+    return Status::OK();
+  }
+
+  Status Visit(const BinaryType&) {
+    std::shared_ptr<Buffer> null_bitmap, offsets, data;
+    int64_t null_count;
+    RETURN_NOT_OK(TakeNullBitmap(&null_bitmap, &null_count));
+    RETURN_NOT_OK(TakeOffsets(&offsets));
+    const int32_t* out_offsets = reinterpret_cast<const int32_t*>(offsets->data());
+
+    RETURN_NOT_OK(AllocateBuffer(pool_, out_offsets[length_], &data));
+    const std::vector<const int32_t*> in_offsets = ChunkOffsets();
+    const std::vector<const uint8_t*> in_data = ChunkBuffers(2);
+    uint8_t* out_data = data->mutable_data();
+    VisitIndices([&](int64_t position, int chunk, int64_t index) {
+      const int32_t start = in_offsets[chunk][index];
+      const int32_t nbytes = in_offsets[chunk][index + 1] - start;
+      if (nbytes > 0) {
+        std::memcpy(out_data + out_offsets[position], in_data[chunk] + start, nbytes);
+      }
+    });
+    out_ = ArrayData::Make(type_, length_, {null_bitmap, offsets, data}, null_count);
+    return Status::OK();
+  }
+
+  Status Visit(const ListType&) {
+    std::shared_ptr<Buffer> null_bitmap, offsets, child_index_values;
+    int64_t null_count;
+    RETURN_NOT_OK(TakeNullBitmap(&null_bitmap, &null_count));
+    RETURN_NOT_OK(TakeOffsets(&offsets));
+    const int32_t* out_offsets = reinterpret_cast<const int32_t*>(offsets->data());
+
+    // Take the child values of the selected lists, as logical positions
+    // in the sequence of child chunks
+    ArrayDataVector child_chunks;
+    std::vector<int64_t> child_chunk_offsets;
+    int64_t child_length = 0;
+    for (const auto& chunk : chunks_) {
+      child_chunks.push_back(chunk->child_data[0]);
+      child_chunk_offsets.push_back(child_length);
+      child_length += chunk->child_data[0]->length;
+    }
+    const int64_t out_child_length = out_offsets[length_];
+    RETURN_NOT_OK(
+        AllocateBuffer(pool_, out_child_length * sizeof(int64_t), &child_index_values));
+    int64_t* child_indices =
+        reinterpret_cast<int64_t*>(child_index_values->mutable_data());
+    const std::vector<const int32_t*> in_offsets = ChunkOffsets();
+    VisitIndices([&](int64_t position, int chunk, int64_t index) {
+      const int64_t start = child_chunk_offsets[chunk] + in_offsets[chunk][index];
+      int64_t* out_indices = child_indices + out_offsets[position];
+      for (int32_t i = 0; i < out_offsets[position + 1] - out_offsets[position]; ++i) {
+        out_indices[i] = start + i;
+      }
+    });
+    auto child_index_data =
+        ArrayData::Make(int64(), out_child_length, {NULLPTR, child_index_values}, 0);
+
+    std::shared_ptr<ArrayData> out_child;
+    RETURN_NOT_OK(TakeChunks(pool_, checked_cast<const ListType&>(*type_).value_type(),
+                             child_chunks, *child_index_data, &out_child));
+    out_ = ArrayData::Make(type_, length_, {null_bitmap, offsets}, null_count);
+    out_->child_data = {out_child};
+    return Status::OK();
+  }
+
+  Status Visit(const StructType& type) {
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_count;
+    RETURN_NOT_OK(TakeNullBitmap(&null_bitmap, &null_count));
+
+    // Slice the children of each chunk according to its offset and length
+    std::vector<ArrayDataVector> field_chunks(type.num_children());
+    for (const auto& chunk : chunks_) {
+      StructArray array(chunk);
+      for (int i = 0; i < type.num_children(); ++i) {
+        field_chunks[i].push_back(array.field(i)->data());
+      }
+    }
+    ArrayDataVector out_children(type.num_children());
+    for (int i = 0; i < type.num_children(); ++i) {
+      RETURN_NOT_OK(TakeChunks(pool_, type.child(i)->type(), field_chunks[i], indices_,
+                               &out_children[i]));
+    }
+    out_ = ArrayData::Make(type_, length_, {null_bitmap}, null_count);
+    out_->child_data = std::move(out_children);
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Take of type ", type);
+  }
+
+  std::shared_ptr<ArrayData> out() const { return out_; }
+
+ private:
+  // Call visit(position, chunk, index) for each non-null index, with the
+  // index resolved to a position in one of the chunks
+  template <typename Visit>
+  void VisitIndices(Visit&& visit) const {
+    if (chunks_.size() == 1) {
+      VisitResolvedIndices(SingleChunkResolver(), std::forward<Visit>(visit));
+    } else {
+      VisitResolvedIndices(ChunkResolver(chunks_), std::forward<Visit>(visit));
+    }
+  }
+
+  template <typename Resolver, typename Visit>
+  void VisitResolvedIndices(const Resolver& resolver, Visit&& visit) const {
+    auto visit_position = [&](int64_t position) {
+      int chunk;
+      int64_t index;
+      resolver.Resolve(static_cast<int64_t>(index_values_[position]), &chunk, &index);
+      visit(position, chunk, index);
+    };
+    detail::VisitValidityWords(
+        index_bitmap_, indices_.offset, length_,
+        [&](int64_t position, int64_t length) {
+          for (int64_t i = 0; i < length; ++i) {
+            visit_position(position + i);
+          }
+        },
+        [&](int64_t position, int64_t, uint64_t word) {
+          for (; word != 0; word &= word - 1) {
+            visit_position(position + BitUtil::CountTrailingZeros(word));
+          }
+        });
+  }
+
+  // The data of buffer `i` of each chunk, not adjusted for offsets
+  std::vector<const uint8_t*> ChunkBuffers(int i) const {
+    std::vector<const uint8_t*> buffers;
+    for (const auto& chunk : chunks_) {
+      buffers.push_back(chunk->buffers[i] ? chunk->buffers[i]->data() : NULLPTR);
+    }
+    return buffers;
+  }
+
+  std::vector<const int32_t*> ChunkOffsets() const {
+    std::vector<const int32_t*> offsets;
+    for (const auto& chunk : chunks_) {
+      offsets.push_back(GetValuesSafe<int32_t>(*chunk, 1));
+    }
+    return offsets;
+  }
+
+  template <int kByteWidth>
+  void TakeFixedWidth(int64_t byte_width, uint8_t* out) const {
+    // Use a compile-time width if possible, so that copies are inlined
+    const int64_t width = kByteWidth > 0 ? kByteWidth : byte_width;
+    std::vector<const uint8_t*> values;
+    for (const auto& chunk : chunks_) {
+      const auto& data = chunk->buffers[1];
+      values.push_back(data ? data->data() + chunk->offset * width : NULLPTR);
+    }
+    VisitIndices([&](int64_t position, int chunk, int64_t index) {
+      std::memcpy(out + position * width, values[chunk] + index * width,
+                  static_cast<size_t>(width));
+    });
+  }
+
+  Status TakeNullBitmap(std::shared_ptr<Buffer>* out, int64_t* null_count) const {
+    bool values_have_nulls = false;
+    for (const auto& chunk : chunks_) {
+      values_have_nulls |= chunk->GetNullCount() > 0;
+    }
+    if (!values_have_nulls) {
+      // Only null indices yield nulls
+      *null_count = indices_.GetNullCount();
+      if (*null_count == 0) {
+        return Status::OK();
+      }
+      return CopyBitmap(pool_, index_bitmap_, indices_.offset, length_, out);
+    }
+
+    std::vector<const uint8_t*> validity;
+    for (const auto& chunk : chunks_) {
+      validity.push_back(chunk->GetNullCount() > 0 ? chunk->buffers[0]->data() : NULLPTR);
+    }
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool_, length_, out));
+    uint8_t* out_bitmap = (*out)->mutable_data();
+    VisitIndices([&](int64_t position, int chunk, int64_t index) {
+      if (validity[chunk] == NULLPTR ||
+          BitUtil::GetBit(validity[chunk], chunks_[chunk]->offset + index)) {
+        BitUtil::SetBit(out_bitmap, position);
+      }
+    });
+    *null_count = length_ - CountSetBits(out_bitmap, 0, length_);
+    return Status::OK();
+  }
+
+  // Compute the offsets of the taken variable-size values
+  Status TakeOffsets(std::shared_ptr<Buffer>* out) const {
+    RETURN_NOT_OK(AllocateBuffer(pool_, (length_ + 1) * sizeof(int32_t), out));
+    int32_t* out_offsets = reinterpret_cast<int32_t*>((*out)->mutable_data());
+    std::memset(out_offsets, 0, static_cast<size_t>((*out)->size()));
+
+    // Store the value lengths, then accumulate them
+    const std::vector<const int32_t*> in_offsets = ChunkOffsets();
+    VisitIndices([&](int64_t position, int chunk, int64_t index) {
+      out_offsets[position + 1] = in_offsets[chunk][index + 1] - in_offsets[chunk][index];
+    });
+    int64_t offset = 0;
+    for (int64_t i = 1; i <= length_; ++i) {
+      offset += out_offsets[i];
+      out_offsets[i] = static_cast<int32_t>(offset);
+    }
+    if (offset > std::numeric_limits<int32_t>::max()) {
+      return Status::CapacityError("Take output of ", *type_,
+                                   " exceeds the maximum offset");
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  const std::shared_ptr<DataType>& type_;
+  const ArrayDataVector& chunks_;
+  const ArrayData& indices_;
+  const int64_t length_;
+  const IndexCType* index_values_;
+  const uint8_t* index_bitmap_;
+  std::shared_ptr<ArrayData> out_;
+};
+
+template <typename IndexCType>
+Status TakeChunksImpl(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                      const ArrayDataVector& chunks, const ArrayData& indices,
+                      std::shared_ptr<ArrayData>* out) {
+  Taker<IndexCType> taker(pool, type, chunks, indices);
+  RETURN_NOT_OK(taker.CheckBounds());
+  RETURN_NOT_OK(VisitTypeInline(*type, &taker));
+  *out = taker.out();
+  return Status::OK();
+}
+
+Status TakeChunks(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                  const ArrayDataVector& chunks, const ArrayData& indices,
+                  std::shared_ptr<ArrayData>* out) {
+  switch (indices.type->id()) {
+#define TAKE_INDEX_CASE(TYPE_ID, CType) \
+  case Type::TYPE_ID:                   \
+    return TakeChunksImpl<CType>(pool, type, chunks, indices, out);
+
+    TAKE_INDEX_CASE(INT8, int8_t)
+    TAKE_INDEX_CASE(INT16, int16_t)
+    TAKE_INDEX_CASE(INT32, int32_t)
+    TAKE_INDEX_CASE(INT64, int64_t)
+    TAKE_INDEX_CASE(UINT8, uint8_t)
+    TAKE_INDEX_CASE(UINT16, uint16_t)
+    TAKE_INDEX_CASE(UINT32, uint32_t)
+    TAKE_INDEX_CASE(UINT64, uint64_t)
+
+#undef TAKE_INDEX_CASE
+    default:
+      return Status::TypeError("Take indices must be integers, got ", *indices.type);
+  }
+}
+
+}  // namespace
+
+Status Take(FunctionContext* ctx, const Datum& values, const Datum& indices,
+            Datum* out) {
+  if (!values.is_arraylike() || !indices.is_arraylike()) {
+    return Status::Invalid("Take values and indices must be array-like");
+  }
+  if (!is_integer(indices.type()->id())) {
+    return Status::TypeError("Take indices must be integers, got ", *indices.type());
+  }
+
+  ArrayDataVector chunks;
+  if (values.kind() == Datum::ARRAY) {
+    chunks.push_back(values.array());
+  } else {
+    for (const auto& chunk : values.chunked_array()->chunks()) {
+      chunks.push_back(chunk->data());
+    }
+  }
+  const std::shared_ptr<DataType> type = values.type();
+
+  if (indices.kind() == Datum::ARRAY) {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(
+        TakeChunks(ctx->memory_pool(), type, chunks, *indices.array(), &result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  // The output is chunked like the indices
+  std::vector<std::shared_ptr<Array>> out_chunks;
+  for (const auto& index_chunk : indices.chunked_array()->chunks()) {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(
+        TakeChunks(ctx->memory_pool(), type, chunks, *index_chunk->data(), &result));
+    out_chunks.push_back(MakeArray(result));
+  }
+  out->value = std::make_shared<ChunkedArray>(std::move(out_chunks), type);
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
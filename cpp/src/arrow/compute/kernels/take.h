@@ -0,0 +1,55 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_COMPUTE_KERNELS_TAKE_H
+#define ARROW_COMPUTE_KERNELS_TAKE_H
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \brief Gather values at the given indices
+///
+/// The output has the type of `values` and one slot per index; slot `i`
+/// is `values[indices[i]]`, or null if either the index or the value it
+/// points to is null.
+///
+/// Both inputs must be array-like.  Indices must be integers and refer to
+/// logical positions in `values`; a chunked `values` is not concatenated.
+/// The output is chunked like `indices`.  All types are supported except
+/// unions.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values array-like values to gather from
+/// \param[in] indices array-like integer indices into `values`
+/// \param[out] out resulting datum
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Take(FunctionContext* context, const Datum& values, const Datum& indices,
+            Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
+
+#endif  // ARROW_COMPUTE_KERNELS_TAKE_H
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -26,8 +27,10 @@
 #include "arrow/array.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -39,6 +42,80 @@ using internal::checked_cast;
 namespace compute {
 namespace detail {
 
+std::shared_ptr<DataType> DecodedType(const std::shared_ptr<DataType>& type) {
+  if (type != nullptr && type->id() == Type::DICTIONARY) {
+    return checked_cast<const DictionaryType&>(*type).dictionary()->type();
+  }
+  return type;
+}
+
+Datum DictionaryIndices(const Datum& value) {
+  const auto& dict_type = checked_cast<const DictionaryType&>(*value.type());
+  auto retype = [&](const ArrayData& data) {
+    auto indices = std::make_shared<ArrayData>(data);
+    indices->type = dict_type.index_type();
+    return indices;
+  };
+  if (value.kind() == Datum::ARRAY) {
+    return Datum(retype(*value.array()));
+  }
+  ArrayVector chunks;
+  for (const auto& chunk : value.chunked_array()->chunks()) {
+    chunks.push_back(MakeArray(retype(*chunk->data())));
+  }
+  return Datum(std::make_shared<ChunkedArray>(chunks, dict_type.index_type()));
+}
+
+std::vector<std::shared_ptr<Array>> SplitIntoMorsels(const Datum& value,
+                                                     int64_t morsel_length) {
+  std::vector<std::shared_ptr<Array>> chunks;
+  if (value.kind() == Datum::ARRAY) {
+    chunks.push_back(value.make_array());
+  } else {
+    chunks = value.chunked_array()->chunks();
+  }
+  std::vector<std::shared_ptr<Array>> morsels;
+  for (const auto& chunk : chunks) {
+    if (chunk->length() <= morsel_length) {
+      morsels.push_back(chunk);
+      continue;
+    }
+    for (int64_t offset = 0; offset < chunk->length(); offset += morsel_length) {
+      morsels.push_back(chunk->Slice(offset, morsel_length));
+    }
+  }
+  return morsels;
+}
+
+namespace {
+
+// Run call(i, ctx, &out) for i in [0, num_calls) on the CPU thread pool,
+// appending the outputs in order
+template <typename CallKernel>
+Status ParallelCallKernel(FunctionContext* ctx, int64_t num_calls, CallKernel&& call,
+                          std::vector<Datum>* outputs) {
+  std::vector<Datum> results(num_calls);
+  RETURN_NOT_OK(
+      internal::ParallelFor(static_cast<int>(num_calls), [&](int i) -> Status {
+        // Kernels may report errors through the context, which is not
+        // thread-safe, so each call gets its own
+        FunctionContext call_ctx(ctx->memory_pool());
+        Datum out;
+        RETURN_NOT_OK(call(i, &call_ctx, &out));
+        if (call_ctx.HasError()) {
+          return call_ctx.status();
+        }
+        results[i].value = std::move(out.value);
+        return Status::OK();
+      }));
+  for (const Datum& result : results) {
+    outputs->push_back(result);
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
                               const Datum& value, std::vector<Datum>* outputs) {
   if (value.kind() == Datum::ARRAY) {
@@ -47,6 +124,16 @@ Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
     RETURN_NOT_OK(kernel->Call(ctx, value, &out));
     outputs->push_back(out);
   } else if (value.kind() == Datum::CHUNKED_ARRAY) {
+    if (ctx->use_threads() && kernel->is_thread_safe()) {
+      const auto morsels = SplitIntoMorsels(value, kMorselLength);
+      return ParallelCallKernel(
+          ctx, static_cast<int64_t>(morsels.size()),
+          [&](int i, FunctionContext* call_ctx, Datum* out) {
+            out->value = ArrayData::Make(kernel->out_type(), morsels[i]->length());
+            return kernel->Call(call_ctx, morsels[i], out);
+          },
+          outputs);
+    }
     const ChunkedArray& array = *value.chunked_array();
     for (int i = 0; i < array.num_chunks(); i++) {
       Datum out;
@@ -60,9 +147,56 @@ Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
   return Status::OK();
 }
 
+namespace {
+
+// Call the kernel on each chunk or morsel of the array-like side, against the
+// scalar side as is
+Status InvokeBinaryScalarKernel(FunctionContext* ctx, BinaryKernel* kernel,
+                                const Datum& left, const Datum& right,
+                                std::vector<Datum>* outputs) {
+  const bool scalar_left = left.is_scalar();
+  const Datum& values = scalar_left ? right : left;
+  const Datum& scalar = scalar_left ? left : right;
+  if (!values.is_arraylike()) {
+    return Status::Invalid(scalar_left ? "Right" : "Left",
+                           " input Datum was not array-like");
+  }
+  auto call = [&](FunctionContext* call_ctx, const Datum& piece, Datum* out) {
+    return scalar_left ? kernel->Call(call_ctx, scalar, piece, out)
+                       : kernel->Call(call_ctx, piece, scalar, out);
+  };
+
+  if (values.kind() == Datum::ARRAY) {
+    Datum output;
+    RETURN_NOT_OK(call(ctx, values, &output));
+    outputs->push_back(output);
+    return Status::OK();
+  }
+  if (ctx->use_threads() && kernel->is_thread_safe()) {
+    const auto morsels = SplitIntoMorsels(values, kMorselLength);
+    return ParallelCallKernel(ctx, static_cast<int64_t>(morsels.size()),
+                              [&](int i, FunctionContext* call_ctx, Datum* out) {
+                                return call(call_ctx, morsels[i], out);
+                              },
+                              outputs);
+  }
+  for (const auto& chunk : values.chunked_array()->chunks()) {
+    Datum output;
+    RETURN_NOT_OK(call(ctx, chunk, &output));
+    outputs->push_back(output);
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
                                const Datum& left, const Datum& right,
                                std::vector<Datum>* outputs) {
+  if ((left.is_scalar() || right.is_scalar()) && kernel->accepts_scalars()) {
+    return InvokeBinaryScalarKernel(ctx, kernel, left, right, outputs);
+  }
+
   int64_t left_length;
   std::vector<std::shared_ptr<Array>> left_arrays;
   if (left.kind() == Datum::ARRAY) {
@@ -91,24 +225,43 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
     return Status::Invalid("Right and left have different lengths");
   }
 
+  if (left.kind() == Datum::ARRAY && right.kind() == Datum::ARRAY) {
+    // No chunks to align; this also yields an output for empty arrays
+    Datum output;
+    RETURN_NOT_OK(kernel->Call(ctx, left, right, &output));
+    outputs->push_back(output);
+    return Status::OK();
+  }
+
+  // In parallel, pieces are also bounded by the morsel length
+  const bool use_threads = ctx->use_threads() && kernel->is_thread_safe();
+  const int64_t max_length =
+      use_threads ? kMorselLength : std::numeric_limits<int64_t>::max();
+
   // TODO: Remove duplication with ChunkedArray::Equals
   int left_chunk_idx = 0;
   int64_t left_start_idx = 0;
   int right_chunk_idx = 0;
   int64_t right_start_idx = 0;
 
+  std::vector<std::pair<std::shared_ptr<Array>, std::shared_ptr<Array>>> pieces;
   int64_t elements_compared = 0;
   while (elements_compared < left_length) {
     const std::shared_ptr<Array> left_array = left_arrays[left_chunk_idx];
     const std::shared_ptr<Array> right_array = right_arrays[right_chunk_idx];
-    int64_t common_length = std::min(left_array->length() - left_start_idx,
-                                     right_array->length() - right_start_idx);
+    int64_t common_length = std::min({left_array->length() - left_start_idx,
+                                      right_array->length() - right_start_idx,
+                                      max_length});
 
     std::shared_ptr<Array> left_op = left_array->Slice(left_start_idx, common_length);
     std::shared_ptr<Array> right_op = right_array->Slice(right_start_idx, common_length);
-    Datum output;
-    RETURN_NOT_OK(kernel->Call(ctx, Datum(left_op), Datum(right_op), &output));
-    outputs->push_back(output);
+    if (use_threads) {
+      pieces.emplace_back(left_op, right_op);
+    } else {
+      Datum output;
+      RETURN_NOT_OK(kernel->Call(ctx, Datum(left_op), Datum(right_op), &output));
+      outputs->push_back(output);
+    }
 
     elements_compared += common_length;
 
@@ -128,6 +281,14 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
     }
   }
 
+  if (use_threads) {
+    return ParallelCallKernel(
+        ctx, static_cast<int64_t>(pieces.size()),
+        [&](int i, FunctionContext* call_ctx, Datum* out) {
+          return kernel->Call(call_ctx, pieces[i].first, pieces[i].second, out);
+        },
+        outputs);
+  }
   return Status::OK();
 }
 
@@ -135,7 +296,8 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
                                const Datum& left, const Datum& right, Datum* output) {
   std::vector<Datum> result;
   RETURN_NOT_OK(InvokeBinaryArrayKernel(ctx, kernel, left, right, &result));
-  *output = detail::WrapDatumsLike(left, result);
+  // The output is shaped like the array-like input
+  *output = detail::WrapDatumsLike(left.is_scalar() ? right : left, result);
   return Status::OK();
 }
 
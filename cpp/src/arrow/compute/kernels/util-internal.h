@@ -18,13 +18,19 @@
 #ifndef ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 #define ARROW_COMPUTE_KERNELS_UTIL_INTERNAL_H
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <memory>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/status.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -44,16 +50,36 @@ static inline void ZeroCopyData(const ArrayData& input, ArrayData* output) {
 
 namespace detail {
 
+/// \brief The number of values processed by one task when kernels run in
+/// parallel
+static constexpr int64_t kMorselLength = 1 << 16;
+
+/// \brief Slice array-like values into arrays of at most `morsel_length` values
+ARROW_EXPORT
+std::vector<std::shared_ptr<Array>> SplitIntoMorsels(const Datum& value,
+                                                     int64_t morsel_length);
+
 /// \brief Invoke the kernel on value using the ctx and store results in outputs.
 ///
+/// If ctx->use_threads() and the kernel is thread-safe, the chunks of a
+/// ChunkedArray are processed concurrently, with large chunks split into
+/// morsels.  Outputs are in input order.
+///
 /// \param[in,out] ctx The function context to use when invoking the kernel.
 /// \param[in,out] kernel The kernel to execute.
 /// \param[in] value The input value to execute the kernel with.
-/// \param[out] outputs One ArrayData datum for each ArrayData available in value.
+/// \param[out] outputs One ArrayData datum for each ArrayData available in value,
+/// or for each morsel when processed in parallel.
 ARROW_EXPORT
 Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
                               const Datum& value, std::vector<Datum>* outputs);
 
+/// \brief Invoke the kernel on aligned pieces of left and right
+///
+/// Chunked inputs are split where either side's chunks end, and into morsels
+/// when processed in parallel as in InvokeUnaryArrayKernel.  If the kernel
+/// accepts_scalars(), one side may be a scalar, passed as is with each piece
+/// of the other side.
 ARROW_EXPORT
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
                                const Datum& left, const Datum& right,
@@ -79,6 +105,136 @@ Datum WrapArraysLike(const Datum& value,
 ARROW_EXPORT
 Datum WrapDatumsLike(const Datum& value, const std::vector<Datum>& datums);
 
+/// \brief Load up to 64 bits of a bitmap, starting at an arbitrary bit offset
+///
+/// Bit `i` of the result is the bit at position `offset + i`; bits beyond
+/// `length` are zero.  No more bytes than covering the range are read.
+static inline uint64_t LoadBitmapWord(const uint8_t* bitmap, int64_t offset,
+                                      int64_t length) {
+  const uint8_t* bytes = bitmap + offset / 8;
+  const int shift = static_cast<int>(offset % 8);
+  const int64_t nbytes = BitUtil::BytesForBits(length + shift);
+  uint64_t word = 0;
+  std::memcpy(&word, bytes, static_cast<size_t>(std::min<int64_t>(nbytes, 8)));
+  word = BitUtil::FromLittleEndian(word) >> shift;
+  if (nbytes > 8) {
+    word |= static_cast<uint64_t>(bytes[8]) << (64 - shift);
+  }
+  if (length < 64) {
+    word &= (static_cast<uint64_t>(1) << length) - 1;
+  }
+  return word;
+}
+
+/// \brief Return `a` if `bit` is 1, `b` if it is 0, without branching
+///
+/// The selection is done on the bit representation of the values, so that
+/// the compiler can vectorize loops of unpredictable selections (such as
+/// by validity bits).  This also discards unselected NaNs and garbage.
+template <typename CType>
+CType SelectValue(uint64_t bit, CType a, CType b) {
+  using UIntType = typename std::conditional<
+      sizeof(CType) == 1, uint8_t,
+      typename std::conditional<
+          sizeof(CType) == 2, uint16_t,
+          typename std::conditional<sizeof(CType) == 4, uint32_t,
+                                    uint64_t>::type>::type>::type;
+  UIntType a_bits, b_bits;
+  std::memcpy(&a_bits, &a, sizeof(CType));
+  std::memcpy(&b_bits, &b, sizeof(CType));
+  const auto mask = static_cast<UIntType>(-static_cast<UIntType>(bit));
+  a_bits = static_cast<UIntType>(b_bits ^ ((a_bits ^ b_bits) & mask));
+  std::memcpy(&a, &a_bits, sizeof(CType));
+  return a;
+}
+
+/// \brief Visit a validity bitmap one 64-bit word at a time
+///
+/// Runs of all-valid values are coalesced and passed to
+/// `visit_valid(position, length)`, so that they can be processed without
+/// testing individual bits.  Words mixing valid and null values are passed
+/// to `visit_mixed(position, length, word)`, where bit `i` of `word` is the
+/// validity of value `position + i`.  All-null words are skipped.
+/// Positions are relative to `offset`.  A null bitmap means all values
+/// are valid.
+template <typename VisitValid, typename VisitMixed>
+void VisitValidityWords(const uint8_t* bitmap, int64_t offset, int64_t length,
+                        VisitValid&& visit_valid, VisitMixed&& visit_mixed) {
+  if (bitmap == NULLPTR) {
+    if (length > 0) {
+      visit_valid(0, length);
+    }
+    return;
+  }
+  int64_t valid_run_start = 0;
+  int64_t position = 0;
+  for (; position < length; position += 64) {
+    const int64_t word_length = std::min<int64_t>(64, length - position);
+    const uint64_t word = LoadBitmapWord(bitmap, offset + position, word_length);
+    const uint64_t all_valid = word_length == 64
+                                   ? ~static_cast<uint64_t>(0)
+                                   : (static_cast<uint64_t>(1) << word_length) - 1;
+    if (word == all_valid) {
+      continue;
+    }
+    if (position > valid_run_start) {
+      visit_valid(valid_run_start, position - valid_run_start);
+    }
+    valid_run_start = position + word_length;
+    if (word != 0) {
+      visit_mixed(position, word_length, word);
+    }
+  }
+  if (length > valid_run_start) {
+    visit_valid(valid_run_start, length - valid_run_start);
+  }
+}
+
+/// \brief Return the value type of a dictionary type, or the type itself
+ARROW_EXPORT
+std::shared_ptr<DataType> DecodedType(const std::shared_ptr<DataType>& type);
+
+/// \brief Return the indices of dictionary-encoded array-like values, with
+/// the same chunk layout and without copying
+ARROW_EXPORT
+Datum DictionaryIndices(const Datum& value);
+
+template <typename IndexCType, typename Visit>
+void VisitDictionaryIndicesImpl(const ArrayData& data, Visit&& visit) {
+  const IndexCType* indices = data.GetValues<IndexCType>(1);
+  const uint8_t* bitmap = data.GetNullCount() > 0 ? data.buffers[0]->data() : NULLPTR;
+  VisitValidityWords(bitmap, data.offset, data.length,
+                     [&](int64_t position, int64_t length) {
+                       for (int64_t i = position; i < position + length; ++i) {
+                         visit(static_cast<int64_t>(indices[i]));
+                       }
+                     },
+                     [&](int64_t position, int64_t, uint64_t word) {
+                       for (; word != 0; word &= word - 1) {
+                         const int64_t i =
+                             position + BitUtil::CountTrailingZeros(word);
+                         visit(static_cast<int64_t>(indices[i]));
+                       }
+                     });
+}
+
+/// \brief Call `visit(index)` with the dictionary index of each valid slot
+/// of dictionary-encoded array data, in order
+template <typename Visit>
+void VisitDictionaryIndices(const ArrayData& data, Visit&& visit) {
+  const auto& type = static_cast<const DictionaryType&>(*data.type);
+  switch (type.index_type()->id()) {
+    case Type::INT8:
+      return VisitDictionaryIndicesImpl<int8_t>(data, std::forward<Visit>(visit));
+    case Type::INT16:
+      return VisitDictionaryIndicesImpl<int16_t>(data, std::forward<Visit>(visit));
+    case Type::INT32:
+      return VisitDictionaryIndicesImpl<int32_t>(data, std::forward<Visit>(visit));
+    default:
+      return VisitDictionaryIndicesImpl<int64_t>(data, std::forward<Visit>(visit));
+  }
+}
+
 /// \brief Kernel used to preallocate outputs for primitive types.
 class PrimitiveAllocatingUnaryKernel : public UnaryKernel {
  public:
@@ -92,6 +248,8 @@ class PrimitiveAllocatingUnaryKernel : public UnaryKernel {
 
   std::shared_ptr<DataType> out_type() const override;
 
+  bool is_thread_safe() const override { return delegate_->is_thread_safe(); }
+
  private:
   UnaryKernel* delegate_;
   std::shared_ptr<DataType> out_type_;
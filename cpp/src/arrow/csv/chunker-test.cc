@@ -16,8 +16,11 @@
 // under the License.
 
 #include <cstdint>
+#include <memory>
 #include <numeric>
+#include <random>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -25,6 +28,7 @@
 #include "arrow/csv/options.h"
 #include "arrow/csv/test-common.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 namespace csv {
@@ -253,5 +257,98 @@ TEST_P(BaseChunkerTest, EscapingNewline) {
   }
 }
 
+void AssertRowStart(Chunker& chunker, const std::string& str, bool final, bool found,
+                    uint32_t pos) {
+  bool actual_found;
+  uint32_t actual_pos;
+  ASSERT_OK(chunker.FindRowStart(str.data(), static_cast<uint32_t>(str.size()), final,
+                                 &actual_found, &actual_pos));
+  ASSERT_EQ(found, actual_found) << "for " << str;
+  if (found) {
+    ASSERT_EQ(pos, actual_pos) << "for " << str;
+  }
+}
+
+TEST_P(BaseChunkerTest, FindRowStart) {
+  Chunker chunker(options_);
+  bool found;
+  uint32_t pos;
+  if (options_.newlines_in_values) {
+    ASSERT_RAISES(NotImplemented, chunker.FindRowStart("a\n", 2, true, &found, &pos));
+    return;
+  }
+  // Data starts one byte before the offset
+  AssertRowStart(chunker, "\nab,c\n", false, true, 1);
+  AssertRowStart(chunker, "b,c\nde\n", false, true, 4);
+  AssertRowStart(chunker, "b,c\r\nde\n", false, true, 5);
+  AssertRowStart(chunker, "b,c\rde\n", false, true, 4);
+  // The offset is inside a '\r\n' separator
+  AssertRowStart(chunker, "\r\nde\n", false, true, 2);
+  // Truncated data
+  AssertRowStart(chunker, "b,c", false, false, 0);
+  AssertRowStart(chunker, "b,c\r", false, false, 0);
+  AssertRowStart(chunker, "b,c", true, true, 3);
+  AssertRowStart(chunker, "b,c\r", true, true, 4);
+  AssertRowStart(chunker, "", true, true, 0);
+}
+
+TEST(SpeculativeChunker, SameAsSerial) {
+  // Many newlines inside quoted values, so that some speculative splits fall
+  // inside rows
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> length_dist(0, 300);
+  std::uniform_int_distribution<int> kind_dist(0, 3);
+  std::string csv;
+  while (csv.size() < 1 << 20) {
+    const std::string text(length_dist(gen), 'x');
+    switch (kind_dist(gen)) {
+      case 0:
+        csv += text + "," + text + "\n";
+        break;
+      case 1:
+        csv += "\"" + text + "\n" + text + "\"\"\r\n\",y\r\n";
+        break;
+      case 2:
+        csv += "a,\"\n\n" + text + "\n\",\"\n\"\n";
+        break;
+      default:
+        csv += "\n";
+        break;
+    }
+  }
+
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(4, &pool));
+  auto options = ParseOptions::Defaults();
+  options.newlines_in_values = true;
+  for (bool escaping : {false, true}) {
+    options.escaping = escaping;
+    Chunker serial(options);
+    Chunker speculative(options, pool.get());
+    // The block may end anywhere, including inside a quoted value
+    for (size_t size : {csv.size(), csv.size() - 1, csv.size() / 2, csv.size() / 3,
+                        csv.size() / 5 + 7, static_cast<size_t>(300 * 1000)}) {
+      uint32_t expected;
+      ASSERT_OK(serial.Process(csv.data(), static_cast<uint32_t>(size), &expected));
+      AssertChunkSize(speculative, csv.substr(0, size), expected);
+    }
+  }
+}
+
+TEST(SpeculativeChunker, UnbalancedQuote) {
+  // A quote that doesn't end: no row ends after it, although the speculative
+  // splits find newlines
+  std::string csv = "a,b\n1,\"";
+  while (csv.size() < 1 << 20) {
+    csv += "xxxxxxxxxxxxxxx\n";
+  }
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(4, &pool));
+  auto options = ParseOptions::Defaults();
+  options.newlines_in_values = true;
+  Chunker chunker(options, pool.get());
+  AssertChunkSize(chunker, csv, 4);
+}
+
 }  // namespace csv
 }  // namespace arrow
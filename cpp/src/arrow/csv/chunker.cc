@@ -17,10 +17,16 @@
 
 #include "arrow/csv/chunker.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <vector>
 
+#include "arrow/csv/scanner-internal.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace csv {
@@ -44,14 +50,36 @@ const char* FindNewlineReverse(const char* data, uint32_t size) {
   return nullptr;
 }
 
+// Find the first line separator at or after the data pointer, and return
+// the position following it.  data_end is returned if not found.
+const char* FindNewlineEnd(const char* data, const char* data_end) {
+  while (data != data_end && *data != '\r' && *data != '\n') {
+    ++data;
+  }
+  if (data == data_end) {
+    return data_end;
+  }
+  if (*data++ == '\r' && data != data_end && *data == '\n') {
+    ++data;
+  }
+  return data;
+}
+
+// The minimum size of a segment when splitting a block speculatively
+constexpr uint32_t kMinSpeculativeSegmentSize = 64 * 1024;  // 64 kB
+
 }  // namespace
 
 Chunker::Chunker(ParseOptions options) : options_(options) {}
 
+Chunker::Chunker(ParseOptions options, internal::ThreadPool* thread_pool)
+    : options_(options), thread_pool_(thread_pool) {}
+
 // NOTE: cvsmonkey (https://github.com/dw/csvmonkey) has optimization ideas
 
 template <bool quoting, bool escaping>
-inline const char* Chunker::ReadLine(const char* data, const char* data_end) {
+inline const char* Chunker::ReadLine(SpecialCharScanner* scanner, const char* data,
+                                     const char* data_end) {
   DCHECK_EQ(quoting, options_.quoting);
   DCHECK_EQ(escaping, options_.escaping);
 
@@ -93,6 +121,8 @@ InField:
   if (ARROW_PREDICT_FALSE(c == options_.delimiter)) {
     goto FieldEnd;
   }
+  // Skip the rest of the field in bulk
+  data += scanner->UnquotedRunLength(data, data_end);
   goto InField;
 
 InQuotedField:
@@ -117,6 +147,7 @@ InQuotedField:
       goto InField;
     }
   }
+  data += scanner->QuotedRunLength(data, data_end);
   goto InQuotedField;
 
 FieldEnd:
@@ -131,27 +162,82 @@ AbortLine:
   return nullptr;
 }
 
+template <bool quoting, bool escaping>
+const char* Chunker::ReadRows(const char* data, const char* until, const char* data_end) {
+  SpecialCharScanner scanner(options_);
+  while (data < until) {
+    const char* line_end = ReadLine<quoting, escaping>(&scanner, data, data_end);
+    if (line_end == nullptr) {
+      // Cannot read any further
+      break;
+    }
+    data = line_end;
+  }
+  return data;
+}
+
 template <bool quoting, bool escaping>
 Status Chunker::ProcessSpecialized(const char* start, uint32_t size, uint32_t* out_size) {
   DCHECK_EQ(quoting, options_.quoting);
   DCHECK_EQ(escaping, options_.escaping);
 
-  const char* data = start;
   const char* data_end = start + size;
+  const uint32_t max_segments = size / kMinSpeculativeSegmentSize;
+  if (thread_pool_ == nullptr || max_segments < 2) {
+    const char* data = ReadRows<quoting, escaping>(start, data_end, data_end);
+    *out_size = static_cast<uint32_t>(data - start);
+    return Status::OK();
+  }
 
-  while (data < data_end) {
-    const char* line_end = ReadLine<quoting, escaping>(data, data_end);
-    if (line_end == nullptr) {
-      // Cannot read any further
+  // Split the block speculatively after newlines, assuming they are row ends
+  const int num_splits =
+      std::min(thread_pool_->GetCapacity(), static_cast<int>(max_segments));
+  std::vector<const char*> starts = {start};
+  for (int i = 1; i < num_splits; ++i) {
+    const char* split = start + static_cast<uint64_t>(size) * i / num_splits;
+    const char* segment_start = FindNewlineEnd(std::max(split, starts.back()), data_end);
+    if (segment_start == data_end) {
       break;
     }
-    data = line_end;
+    starts.push_back(segment_start);
+  }
+  starts.push_back(data_end);
+  const size_t num_segments = starts.size() - 1;
+
+  // Read the rows of each segment in parallel, up to the first row ending at
+  // or after the next segment start
+  std::vector<const char*> ends(num_segments);
+  auto task_group = internal::TaskGroup::MakeThreaded(thread_pool_);
+  for (size_t i = 0; i < num_segments; ++i) {
+    task_group->Append([this, &starts, &ends, data_end, i]() {
+      ends[i] = ReadRows<quoting, escaping>(starts[i], starts[i + 1], data_end);
+      return Status::OK();
+    });
+  }
+  RETURN_NOT_OK(task_group->Finish());
+
+  // Verify the speculation in order.  A segment read from a true row start
+  // is valid, and its end is the next true row start.
+  const char* data = ends[0];
+  for (size_t i = 1; i < num_segments; ++i) {
+    if (data < starts[i]) {
+      // Truncated row before the end of the block
+      break;
+    }
+    if (data == starts[i]) {
+      data = ends[i];
+    } else {
+      // The segment starts inside a row (e.g. after a newline in a quoted
+      // value): read it again from the actual row start
+      data = ReadRows<quoting, escaping>(data, starts[i + 1], data_end);
+    }
   }
   *out_size = static_cast<uint32_t>(data - start);
   return Status::OK();
 }
 
 Status Chunker::Process(const char* start, uint32_t size, uint32_t* out_size) {
+  ARROW_TRACE_SPAN("csv", "chunk");
   if (!options_.newlines_in_values) {
     // In newlines are not accepted in CSV values, we can simply search for
     // the last newline character.
@@ -182,5 +268,38 @@ Status Chunker::Process(const char* start, uint32_t size, uint32_t* out_size) {
   }
 }
 
+Status Chunker::FindRowStart(const char* data, uint32_t size, bool final, bool* found,
+                             uint32_t* out_pos) {
+  if (options_.newlines_in_values) {
+    return Status::NotImplemented(
+        "Cannot find row boundaries in CSV data with newlines in values");
+  }
+  const char* data_end = data + size;
+  const char* s = data;
+  while (s != data_end && *s != '\r' && *s != '\n') {
+    ++s;
+  }
+  if (s == data_end) {
+    // No row end: no row starts in this data
+    *found = final;
+    *out_pos = size;
+    return Status::OK();
+  }
+  if (*s++ == '\r') {
+    if (s == data_end) {
+      // The next byte decides whether this is a '\r\n' line separator
+      *found = final;
+      *out_pos = size;
+      return Status::OK();
+    }
+    if (*s == '\n') {
+      ++s;
+    }
+  }
+  *found = true;
+  *out_pos = static_cast<uint32_t>(s - data);
+  return Status::OK();
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -26,8 +26,16 @@
 #include "arrow/util/visibility.h"
 
 namespace arrow {
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+
 namespace csv {
 
+class SpecialCharScanner;
+
 /// \class Chunker
 /// \brief A reusable block-based chunker for CSV data
 ///
@@ -42,12 +50,42 @@ class ARROW_EXPORT Chunker {
  public:
   explicit Chunker(ParseOptions options);
 
+  /// \brief Create a chunker finding row boundaries on several threads
+  ///
+  /// With newlines_in_values, large blocks are split speculatively after
+  /// newlines, in one segment per thread.  The rows of each segment are
+  /// delimited in parallel, assuming that a row starts at the segment start.
+  /// The assumptions are then verified in order: a segment found to start
+  /// inside a row is delimited again from the actual row start.  The result
+  /// is the same as with the serial chunker.
+  Chunker(ParseOptions options, internal::ThreadPool* thread_pool);
+
   /// \brief Carve up a chunk in a block of data
   ///
   /// Process a block of CSV data, reading up to size bytes.
   /// The number of bytes in the chunk is returned in out_size.
   Status Process(const char* data, uint32_t size, uint32_t* out_size);
 
+  /// \brief Find the first row starting at or after a given file offset
+  ///
+  /// This resolves row boundaries when a file is read as several
+  /// independent byte ranges: the range [a, b) owns the rows starting in it,
+  /// i.e. the data from the first row start at or after a to the first row
+  /// start at or after b.
+  ///
+  /// The data must start one byte before the offset, so that a row
+  /// starting exactly at the offset is recognized.  The position of the row
+  /// start in the data is returned in out_pos.  If the data is too short to
+  /// tell, found is false and the caller should retry with more data, unless
+  /// the data extends to the end of the file (final is true): the end of
+  /// the data is then returned.
+  ///
+  /// Only supported if newlines_in_values is false, as newlines inside
+  /// quoted values can't otherwise be told from row ends without reading
+  /// from the start of the file.
+  Status FindRowStart(const char* data, uint32_t size, bool final, bool* found,
+                      uint32_t* out_pos);
+
  protected:
   ARROW_DISALLOW_COPY_AND_ASSIGN(Chunker);
 
@@ -55,12 +93,20 @@ class ARROW_EXPORT Chunker {
   template <bool quoting, bool escaping>
   Status ProcessSpecialized(const char* data, uint32_t size, uint32_t* out_size);
 
+  // Detect lines from the data pointer until one ends at or after until.
+  // Return the end of the last complete line.
+  template <bool quoting, bool escaping>
+  const char* ReadRows(const char* data, const char* until, const char* data_end);
+
   // Detect a single line from the data pointer.  Return the line end,
   // or nullptr if the remaining line is truncated.
   template <bool quoting, bool escaping>
-  inline const char* ReadLine(const char* data, const char* data_end);
+  inline const char* ReadLine(SpecialCharScanner* scanner, const char* data,
+                              const char* data_end);
 
   ParseOptions options_;
+  // If not null, the thread pool for speculative chunking
+  internal::ThreadPool* thread_pool_ = nullptr;
 };
 
 }  // namespace csv
@@ -25,6 +25,7 @@
 #include "arrow/csv/options.h"
 #include "arrow/csv/test-common.h"
 #include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/util/task-group.h"
@@ -316,6 +317,53 @@ TEST(InferringColumnBuilder, MultipleChunkBinary) {
   AssertChunkedEqual(*expected, *actual);
 }
 
+TEST(InferringColumnBuilder, SingleChunkDictionary) {
+  auto tg = TaskGroup::MakeSerial();
+  std::shared_ptr<ColumnBuilder> builder;
+  std::shared_ptr<ChunkedArray> actual;
+
+  auto options = ConvertOptions::Defaults();
+  options.auto_dict_encode = true;
+  ASSERT_OK(ColumnBuilder::Make(0, options, tg, &builder));
+  AssertBuilding(builder, {{"", "foo", "baré", "foo"}}, &actual);
+
+  auto type = dictionary(int8(), ArrayFromJSON(utf8(), R"(["", "foo", "baré"])"));
+  auto expected = std::make_shared<DictionaryArray>(
+      type, ArrayFromJSON(int8(), "[0, 1, 2, 1]"));
+  AssertChunkedEqual(ChunkedArray(ArrayVector{expected}), *actual);
+
+  // Too many distinct values: not dictionary-encoded
+  options.auto_dict_max_cardinality = 2;
+  tg = TaskGroup::MakeSerial();
+  ASSERT_OK(ColumnBuilder::Make(0, options, tg, &builder));
+  AssertBuilding(builder, {{"", "foo", "baré", "foo"}}, &actual);
+
+  std::shared_ptr<ChunkedArray> expected_strings;
+  ChunkedArrayFromVector<StringType, std::string>(
+      {{true, true, true, true}}, {{"", "foo", "baré", "foo"}}, &expected_strings);
+  AssertChunkedEqual(*expected_strings, *actual);
+}
+
+TEST(InferringColumnBuilder, MultipleChunkDictionary) {
+  auto tg = TaskGroup::MakeSerial();
+  std::shared_ptr<ColumnBuilder> builder;
+  auto options = ConvertOptions::Defaults();
+  options.auto_dict_encode = true;
+  ASSERT_OK(ColumnBuilder::Make(0, options, tg, &builder));
+
+  std::shared_ptr<ChunkedArray> actual;
+  AssertBuilding(builder, {{""}, {"008"}, {"NaN", "baré", "008"}}, &actual);
+
+  // The chunk dictionaries are unified
+  auto type =
+      dictionary(int8(), ArrayFromJSON(utf8(), R"(["", "008", "NaN", "baré"])"));
+  ArrayVector chunks = {
+      std::make_shared<DictionaryArray>(type, ArrayFromJSON(int8(), "[0]")),
+      std::make_shared<DictionaryArray>(type, ArrayFromJSON(int8(), "[1]")),
+      std::make_shared<DictionaryArray>(type, ArrayFromJSON(int8(), "[2, 3, 1]"))};
+  AssertChunkedEqual(ChunkedArray(chunks), *actual);
+}
+
 TEST(InferringColumnBuilder, MultipleChunkIntegerParallel) {
   auto tg = TaskGroup::MakeThreaded(GetCpuThreadPool());
   std::shared_ptr<ColumnBuilder> builder;
@@ -329,5 +377,28 @@ TEST(InferringColumnBuilder, MultipleChunkIntegerParallel) {
   AssertChunkedEqual(*actual, *expected);
 }
 
+TEST(InferringColumnBuilder, SampledType) {
+  std::shared_ptr<ColumnBuilder> builder;
+  std::shared_ptr<ChunkedArray> actual;
+  std::shared_ptr<ChunkedArray> expected;
+
+  // Values after the sample, in the first block or later ones, still
+  // loosen the sampled type
+  for (int32_t sample_rows : {0, 1, 1000}) {
+    auto options = ConvertOptions::Defaults();
+    options.inference_sample_rows = sample_rows;
+    ASSERT_OK(ColumnBuilder::Make(0, options, TaskGroup::MakeSerial(), &builder));
+    AssertBuilding(builder, {{"1", "2.5"}, {""}, {"8"}}, &actual);
+    ChunkedArrayFromVector<DoubleType>({{true, true}, {false}, {true}},
+                                       {{1.0, 2.5}, {0.0}, {8.0}}, &expected);
+    AssertChunkedEqual(*expected, *actual);
+
+    ASSERT_OK(ColumnBuilder::Make(0, options, TaskGroup::MakeSerial(), &builder));
+    AssertBuilding(builder, {{"1", "2"}, {"foo"}}, &actual);
+    ChunkedArrayFromVector<StringType, std::string>({{"1", "2"}, {"foo"}}, &expected);
+    AssertChunkedEqual(*expected, *actual);
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -27,19 +27,23 @@
 #include "arrow/array.h"
 #include "arrow/csv/column-builder.h"
 #include "arrow/csv/converter.h"
+#include "arrow/csv/inference-internal.h"
 #include "arrow/csv/options.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/task-group.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace csv {
 
 class BlockParser;
 
+using internal::checked_cast;
 using internal::TaskGroup;
 
 void ColumnBuilder::SetTaskGroup(const std::shared_ptr<internal::TaskGroup>& task_group) {
@@ -110,6 +114,7 @@ void TypedColumnBuilder::Insert(int64_t block_index,
 
   // We're careful that all references in the closure outlive the Append() call
   task_group_->Append([=]() -> Status {
+    ARROW_TRACE_SPAN("csv", "convert");
     std::shared_ptr<Array> res;
     RETURN_NOT_OK(WrapConversionError(converter_->Convert(*parser, col_index_, &res)));
 
@@ -145,7 +150,9 @@ class InferringColumnBuilder : public ColumnBuilder {
       : ColumnBuilder(task_group),
         col_index_(col_index),
         options_(options),
-        pool_(pool) {}
+        pool_(pool),
+        classifier_(options),
+        sampled_(false) {}
 
   Status Init();
 
@@ -153,8 +160,10 @@ class InferringColumnBuilder : public ColumnBuilder {
   Status Finish(std::shared_ptr<ChunkedArray>* out) override;
 
  protected:
+  Status SampleType(const BlockParser& parser);
   Status LoosenType();
   Status UpdateType();
+  Status UnifyDictionaries(std::shared_ptr<DataType>* out_type);
   Status TryConvertChunk(size_t chunk_index);
   // This must be called unlocked!
   void ScheduleConvertChunk(size_t chunk_index);
@@ -167,44 +176,48 @@ class InferringColumnBuilder : public ColumnBuilder {
   std::shared_ptr<Converter> converter_;
 
   // Current inference status
-  enum class InferKind { Null, Integer, Real, Timestamp, Text, Binary };
-
   std::shared_ptr<DataType> infer_type_;
   InferKind infer_kind_;
   bool can_loosen_type_;
 
+  ValueClassifier classifier_;
+  // Whether the type was picked from a sample of the first inserted block
+  bool sampled_;
+
   // The parsers corresponding to each chunk (for reconverting)
   std::vector<std::shared_ptr<BlockParser>> parsers_;
 };
 
 Status InferringColumnBuilder::Init() {
   infer_kind_ = InferKind::Null;
+  RETURN_NOT_OK(classifier_.Init());
   return UpdateType();
 }
 
+Status InferringColumnBuilder::SampleType(const BlockParser& parser) {
+  // We are locked, and no chunk was converted yet
+
+  // Start with the strictest type the sampled values convert to, rather than
+  // converting whole blocks to each stricter type only to fail.  Later values
+  // can still loosen the type.
+  InferKind kind =
+      classifier_.Classify(parser, col_index_, options_.inference_sample_rows);
+  sampled_ = true;
+  if (kind != infer_kind_) {
+    infer_kind_ = kind;
+    return UpdateType();
+  }
+  return Status::OK();
+}
+
 Status InferringColumnBuilder::LoosenType() {
   // We are locked
 
   DCHECK(can_loosen_type_);
-  switch (infer_kind_) {
-    case InferKind::Null:
-      infer_kind_ = InferKind::Integer;
-      break;
-    case InferKind::Integer:
-      infer_kind_ = InferKind::Timestamp;
-      break;
-    case InferKind::Timestamp:
-      infer_kind_ = InferKind::Real;
-      break;
-    case InferKind::Real:
-      infer_kind_ = InferKind::Text;
-      break;
-    case InferKind::Text:
-      infer_kind_ = InferKind::Binary;
-      break;
-    case InferKind::Binary:
-      return Status::UnknownError("Shouldn't come here");
+  if (infer_kind_ == InferKind::Binary) {
+    return Status::UnknownError("Shouldn't come here");
   }
+  infer_kind_ = NextInferKind(infer_kind_, options_);
   return UpdateType();
 }
 
@@ -229,6 +242,11 @@ Status InferringColumnBuilder::UpdateType() {
       infer_type_ = float64();
       can_loosen_type_ = true;
       break;
+    case InferKind::TextDict:
+      // Each chunk gets its own dictionary, unified in Finish()
+      infer_type_ = utf8();
+      can_loosen_type_ = true;
+      return Converter::MakeDictionary(infer_type_, options_, pool_, &converter_);
     case InferKind::Text:
       infer_type_ = utf8();
       can_loosen_type_ = true;
@@ -241,9 +259,28 @@ Status InferringColumnBuilder::UpdateType() {
   return Converter::Make(infer_type_, options_, pool_, &converter_);
 }
 
+Status InferringColumnBuilder::UnifyDictionaries(std::shared_ptr<DataType>* out_type) {
+  // We are locked
+
+  std::vector<const DataType*> types;
+  for (const auto& chunk : chunks_) {
+    types.push_back(chunk->type().get());
+  }
+  std::vector<std::vector<int32_t>> transpose_maps;
+  RETURN_NOT_OK(DictionaryType::Unify(pool_, types, out_type, &transpose_maps));
+  for (size_t i = 0; i < chunks_.size(); ++i) {
+    const auto& chunk = checked_cast<const DictionaryArray&>(*chunks_[i]);
+    RETURN_NOT_OK(chunk.Transpose(pool_, *out_type, transpose_maps[i], &chunks_[i]));
+  }
+  return Status::OK();
+}
+
 void InferringColumnBuilder::ScheduleConvertChunk(size_t chunk_index) {
   // We're careful that all values in the closure outlive the Append() call
-  task_group_->Append([=]() { return TryConvertChunk(chunk_index); });
+  task_group_->Append([=]() -> Status {
+    ARROW_TRACE_SPAN("csv", "convert");
+    return TryConvertChunk(chunk_index);
+  });
 }
 
 Status InferringColumnBuilder::TryConvertChunk(size_t chunk_index) {
@@ -320,6 +357,15 @@ void InferringColumnBuilder::Insert(int64_t block_index,
     // Should not insert an already converting chunk
     DCHECK_EQ(parsers_[chunk_index], nullptr);
     parsers_[chunk_index] = parser;
+
+    if (!sampled_ && options_.inference_sample_rows > 0) {
+      Status st = SampleType(*parser);
+      if (!st.ok()) {
+        // Report the error from the chunk's conversion task
+        task_group_->Append([st]() { return st; });
+        return;
+      }
+    }
   }
 
   ScheduleConvertChunk(chunk_index);
@@ -329,16 +375,23 @@ Status InferringColumnBuilder::Finish(std::shared_ptr<ChunkedArray>* out) {
   // Unnecessary iff all tasks have finished
   std::lock_guard<std::mutex> lock(mutex_);
 
+  const bool dict_encoded = infer_kind_ == InferKind::TextDict;
   for (const auto& chunk : chunks_) {
     if (chunk == nullptr) {
       return Status::Invalid("A chunk failed converting for an unknown reason");
     }
     // XXX Perhaps we must instead do a last equalization pass
     // in this serial step
-    DCHECK_EQ(chunk->type()->id(), infer_type_->id())
+    DCHECK_EQ(chunk->type()->id(), dict_encoded ? Type::DICTIONARY : infer_type_->id())
         << "Inference didn't equalize types!";
   }
-  *out = std::make_shared<ChunkedArray>(chunks_, infer_type_);
+  if (dict_encoded) {
+    std::shared_ptr<DataType> dict_type;
+    RETURN_NOT_OK(UnifyDictionaries(&dict_type));
+    *out = std::make_shared<ChunkedArray>(chunks_, dict_type);
+  } else {
+    *out = std::make_shared<ChunkedArray>(chunks_, infer_type_);
+  }
   chunks_.clear();
   parsers_.clear();
 
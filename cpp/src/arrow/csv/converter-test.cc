@@ -25,11 +25,14 @@
 
 #include "arrow/array.h"
 #include "arrow/csv/converter.h"
+#include "arrow/csv/inference-internal.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/test-common.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
+#include "arrow/util/decimal.h"
 
 namespace arrow {
 namespace csv {
@@ -136,6 +139,63 @@ TEST(StringConversion, Errors) {
   AssertConversionError(utf8(), {"ab,cdé\n", "\xff,gh\n"}, {0});
 }
 
+void AssertDictConversion(const std::shared_ptr<DataType>& value_type,
+                          const std::vector<std::string>& csv_string,
+                          const std::vector<std::string>& expected_dicts,
+                          const std::vector<std::string>& expected_indices,
+                          ConvertOptions options = ConvertOptions::Defaults()) {
+  std::shared_ptr<BlockParser> parser;
+  std::shared_ptr<Converter> converter;
+  std::shared_ptr<Array> array;
+
+  ASSERT_OK(Converter::MakeDictionary(value_type, options, default_memory_pool(),
+                                      &converter));
+
+  MakeCSVParser(csv_string, &parser);
+  for (int32_t col_index = 0; col_index < static_cast<int32_t>(expected_dicts.size());
+       ++col_index) {
+    ASSERT_OK(converter->Convert(*parser, col_index, &array));
+    auto type =
+        dictionary(int8(), ArrayFromJSON(value_type, expected_dicts[col_index]));
+    DictionaryArray expected(type, ArrayFromJSON(int8(), expected_indices[col_index]));
+    AssertArraysEqual(expected, *array);
+  }
+}
+
+TEST(DictionaryConversion, Basics) {
+  AssertDictConversion(utf8(), {"ab,cdé\n", ",cdé\n", "ab,gh\n"},
+                       {R"(["ab", ""])", R"(["cdé", "gh"])"},
+                       {"[0, 1, 0]", "[0, 0, 1]"});
+  AssertDictConversion(binary(), {"ab,cdé\n", ",gh\n", ",gh\n"},
+                       {R"(["ab", ""])", R"(["cdé", "gh"])"},
+                       {"[0, 1, 1]", "[0, 1, 1]"});
+}
+
+TEST(DictionaryConversion, Errors) {
+  // Invalid UTF8 in column 0
+  auto options = ConvertOptions::Defaults();
+  std::shared_ptr<BlockParser> parser;
+  std::shared_ptr<Converter> converter;
+  std::shared_ptr<Array> array;
+  ASSERT_OK(Converter::MakeDictionary(utf8(), options, default_memory_pool(),
+                                      &converter));
+  MakeCSVParser({"ab,cdé\n", "\xff,gh\n"}, &parser);
+  ASSERT_RAISES(Invalid, converter->Convert(*parser, 0, &array));
+  ASSERT_OK(converter->Convert(*parser, 1, &array));
+
+  // Too many distinct values in column 1
+  options.auto_dict_max_cardinality = 2;
+  ASSERT_OK(Converter::MakeDictionary(utf8(), options, default_memory_pool(),
+                                      &converter));
+  MakeCSVParser({"a,a\n", "b,b\n", "a,c\n"}, &parser);
+  ASSERT_OK(converter->Convert(*parser, 0, &array));
+  ASSERT_RAISES(Invalid, converter->Convert(*parser, 1, &array));
+
+  ASSERT_RAISES(NotImplemented, Converter::MakeDictionary(int32(), options,
+                                                          default_memory_pool(),
+                                                          &converter));
+}
+
 TEST(FixedSizeBinaryConversion, Basics) {
   AssertConversion<FixedSizeBinaryType, std::string>(
       fixed_size_binary(2), {"ab,cd\n", "gh,ij\n"}, {{"ab", "gh"}, {"cd", "ij"}});
@@ -288,10 +348,64 @@ TEST(TimestampConversion, CustomNulls) {
                                            {{true}, {false}, {false}}, options);
 }
 
-TEST(DecimalConversion, NotImplemented) {
-  std::shared_ptr<Converter> converter;
-  ASSERT_RAISES(NotImplemented,
-                Converter::Make(decimal(12, 3), ConvertOptions::Defaults(), &converter));
+TEST(DecimalConversion, Basics) {
+  AssertConversion<Decimal128Type, Decimal128>(
+      decimal(12, 3), {"1.5,-12.345\n", " 0 ,1e2\n", "123456789.123,-0.001\n"},
+      {{Decimal128(1500), Decimal128(0), Decimal128(123456789123LL)},
+       {Decimal128(-12345), Decimal128(100000), Decimal128(-1)}});
+  // Values beyond 64 bits
+  AssertConversion<Decimal128Type, Decimal128>(
+      decimal(38, 0), {"99999999999999999999999999999999999999\n"},
+      {{Decimal128("99999999999999999999999999999999999999")}});
+}
+
+TEST(DecimalConversion, Nulls) {
+  AssertConversion<Decimal128Type, Decimal128>(
+      decimal(5, 2), {"1.5,N/A\n", ",-1\n"},
+      {{Decimal128(150), Decimal128(0)}, {Decimal128(0), Decimal128(-100)}},
+      {{true, false}, {false, true}});
+}
+
+TEST(DecimalConversion, Errors) {
+  // Invalid value in column 0, data loss in column 1, overflow in column 2
+  AssertConversionError(decimal(5, 2), {"1.2.3,1.234,1000\n", "1,1,999.99\n"},
+                        {0, 1, 2});
+}
+
+InferKind ClassifyColumn(const std::vector<std::string>& values,
+                         ConvertOptions options = ConvertOptions::Defaults(),
+                         int32_t max_rows = 1000) {
+  std::shared_ptr<BlockParser> parser;
+  MakeColumnParser(values, &parser);
+  ValueClassifier classifier(options);
+  EXPECT_OK(classifier.Init());
+  return classifier.Classify(*parser, 0, max_rows);
+}
+
+TEST(ValueClassifier, Basics) {
+  ASSERT_EQ(InferKind::Null, ClassifyColumn({"", "NA"}));
+  ASSERT_EQ(InferKind::Integer, ClassifyColumn({"", "123", " -4 "}));
+  ASSERT_EQ(InferKind::Timestamp, ClassifyColumn({"N/A", "2018-11-13 17:11:10"}));
+  ASSERT_EQ(InferKind::Real, ClassifyColumn({"1", "nan", "12.5"}));
+  ASSERT_EQ(InferKind::Text, ClassifyColumn({"1", "foo"}));
+  ASSERT_EQ(InferKind::Binary, ClassifyColumn({"foo", "\xff"}));
+  // Quoted null spellings are strings
+  ASSERT_EQ(InferKind::Text, ClassifyColumn({"\"NA\""}));
+  // Integers are not timestamps, so that a column of both is text
+  ASSERT_EQ(InferKind::Text, ClassifyColumn({"1", "2018-11-13"}));
+
+  auto options = ConvertOptions::Defaults();
+  options.auto_dict_encode = true;
+  ASSERT_EQ(InferKind::TextDict, ClassifyColumn({"foo", "bar"}, options));
+  options.check_utf8 = false;
+  ASSERT_EQ(InferKind::TextDict, ClassifyColumn({"foo", "\xff"}, options));
+}
+
+TEST(ValueClassifier, MaxRows) {
+  auto options = ConvertOptions::Defaults();
+  ASSERT_EQ(InferKind::Integer, ClassifyColumn({"1", "2", "foo"}, options, 2));
+  ASSERT_EQ(InferKind::Null, ClassifyColumn({"", "2"}, options, 1));
+  ASSERT_EQ(InferKind::Null, ClassifyColumn({"1"}, options, 0));
 }
 
 }  // namespace csv
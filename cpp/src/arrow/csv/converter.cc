@@ -23,12 +23,17 @@
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/builder.h"
+#include "arrow/csv/inference-internal.h"
 #include "arrow/csv/parser.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/parsing.h"  // IWYU pragma: keep
 #include "arrow/util/trie.h"
 #include "arrow/util/utf8.h"
@@ -36,6 +41,7 @@
 namespace arrow {
 namespace csv {
 
+using internal::checked_cast;
 using internal::StringConverter;
 using internal::Trie;
 using internal::TrieBuilder;
@@ -49,6 +55,20 @@ Status GenericConversionError(const std::shared_ptr<DataType>& type, const uint8
                          std::string(reinterpret_cast<const char*>(data), size), "'");
 }
 
+// Check that all the values of a string array are UTF8, validating their
+// data in one pass rather than each value on its own
+Status ValidateUTF8Values(const std::shared_ptr<DataType>& type, const Array& values) {
+  const ArrayData& data = *values.data();
+  if (data.length > 0 &&
+      ARROW_PREDICT_FALSE(!util::ValidateUTF8Strings(data.GetValues<uint8_t>(2, 0),
+                                                     data.GetValues<int32_t>(1),
+                                                     data.length))) {
+    return Status::Invalid("CSV conversion error to ", type->ToString(),
+                           ": invalid UTF8 data");
+  }
+  return Status::OK();
+}
+
 inline bool IsWhitespace(uint8_t c) {
   if (ARROW_PREDICT_TRUE(c > ' ')) {
     return false;
@@ -56,6 +76,26 @@ inline bool IsWhitespace(uint8_t c) {
   return c == ' ' || c == '\t';
 }
 
+// Skip leading and trailing whitespace
+inline void TrimWhitespace(const uint8_t** data, uint32_t* size) {
+  // Skip trailing whitespace
+  if (ARROW_PREDICT_TRUE(*size > 0) &&
+      ARROW_PREDICT_FALSE(IsWhitespace((*data)[*size - 1]))) {
+    const uint8_t* p = *data + *size - 1;
+    while (*size > 0 && IsWhitespace(*p)) {
+      --*size;
+      --p;
+    }
+  }
+  // Skip leading whitespace
+  if (ARROW_PREDICT_TRUE(*size > 0) && ARROW_PREDICT_FALSE(IsWhitespace(**data))) {
+    while (*size > 0 && IsWhitespace(**data)) {
+      --*size;
+      ++*data;
+    }
+  }
+}
+
 class ConcreteConverter : public Converter {
  public:
   using Converter::Converter;
@@ -129,10 +169,6 @@ class VarSizeBinaryConverter : public ConcreteConverter {
     // TODO do we accept nulls here?
 
     auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-      if (CheckUTF8 && ARROW_PREDICT_FALSE(!util::ValidateUTF8(data, size))) {
-        return Status::Invalid("CSV conversion error to ", type_->ToString(),
-                               ": invalid UTF8 data");
-      }
       builder.UnsafeAppend(data, size);
       return Status::OK();
     };
@@ -141,6 +177,54 @@ class VarSizeBinaryConverter : public ConcreteConverter {
     RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
     RETURN_NOT_OK(builder.Finish(out));
 
+    if (CheckUTF8) {
+      RETURN_NOT_OK(ValidateUTF8Values(type_, **out));
+    }
+    return Status::OK();
+  }
+
+ protected:
+  Status Initialize() override {
+    util::InitializeUTF8();
+    return Status::OK();
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////
+// Concrete Converter for dictionary-encoded var-sized binary strings
+
+template <typename T, bool CheckUTF8>
+class DictionaryBinaryConverter : public ConcreteConverter {
+ public:
+  using ConcreteConverter::ConcreteConverter;
+
+  Status Convert(const BlockParser& parser, int32_t col_index,
+                 std::shared_ptr<Array>* out) override {
+    // The type is the dictionary value type
+    DictionaryBuilder<T> builder(type_, pool_);
+    const int64_t max_cardinality = options_.auto_dict_max_cardinality;
+
+    // TODO do we accept nulls here?
+
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      RETURN_NOT_OK(
+          builder.Append(util::string_view(reinterpret_cast<const char*>(data), size)));
+      if (ARROW_PREDICT_FALSE(builder.dictionary_length() > max_cardinality)) {
+        return Status::Invalid("CSV conversion error to dictionary of ",
+                               type_->ToString(), ": more than ", max_cardinality,
+                               " distinct values");
+      }
+      return Status::OK();
+    };
+    RETURN_NOT_OK(builder.Resize(parser.num_rows()));
+    RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
+    RETURN_NOT_OK(builder.Finish(out));
+
+    if (CheckUTF8) {
+      // Only the distinct values need validating
+      const auto& dict_array = checked_cast<const DictionaryArray&>(**out);
+      RETURN_NOT_OK(ValidateUTF8Values(type_, *dict_array.dictionary()));
+    }
     return Status::OK();
   }
 
@@ -212,22 +296,7 @@ Status NumericConverter<T>::Convert(const BlockParser& parser, int32_t col_index
       return Status::OK();
     }
     if (!std::is_same<BooleanType, T>::value) {
-      // Skip trailing whitespace
-      if (ARROW_PREDICT_TRUE(size > 0) &&
-          ARROW_PREDICT_FALSE(IsWhitespace(data[size - 1]))) {
-        const uint8_t* p = data + size - 1;
-        while (size > 0 && IsWhitespace(*p)) {
-          --size;
-          --p;
-        }
-      }
-      // Skip leading whitespace
-      if (ARROW_PREDICT_TRUE(size > 0) && ARROW_PREDICT_FALSE(IsWhitespace(data[0]))) {
-        while (size > 0 && IsWhitespace(*data)) {
-          --size;
-          ++data;
-        }
-      }
+      TrimWhitespace(&data, &size);
     }
     if (ARROW_PREDICT_FALSE(
             !converter(reinterpret_cast<const char*>(data), size, &value))) {
@@ -278,6 +347,65 @@ class TimestampConverter : public ConcreteConverter {
   }
 };
 
+/////////////////////////////////////////////////////////////////////////
+// Concrete Converter for decimals
+
+class DecimalConverter : public ConcreteConverter {
+ public:
+  using ConcreteConverter::ConcreteConverter;
+
+  Status Convert(const BlockParser& parser, int32_t col_index,
+                 std::shared_ptr<Array>* out) override;
+};
+
+Status DecimalConverter::Convert(const BlockParser& parser, int32_t col_index,
+                                 std::shared_ptr<Array>* out) {
+  Decimal128Builder builder(type_, pool_);
+  const auto& decimal_type = checked_cast<const Decimal128Type&>(*type_);
+  const int32_t type_scale = decimal_type.scale();
+  // Values must lie strictly between -10^precision and 10^precision
+  const Decimal128 upper_bound = Decimal128::GetScaleMultiplier(decimal_type.precision());
+  const Decimal128 lower_bound = -upper_bound;
+
+  auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+    if (IsNull(data, size, quoted)) {
+      return builder.AppendNull();
+    }
+    TrimWhitespace(&data, &size);
+    Decimal128 value;
+    int32_t precision, scale;
+    if (ARROW_PREDICT_FALSE(
+            !Decimal128::FromString(
+                 util::string_view(reinterpret_cast<const char*>(data), size), &value,
+                 &precision, &scale)
+                 .ok())) {
+      return GenericConversionError(type_, data, size);
+    }
+    if (scale != type_scale) {
+      Decimal128 rescaled;
+      if (ARROW_PREDICT_FALSE(!value.Rescale(scale, type_scale, &rescaled).ok())) {
+        return Status::Invalid("CSV conversion error to ", type_->ToString(),
+                               ": value '",
+                               std::string(reinterpret_cast<const char*>(data), size),
+                               "' cannot be rescaled without data loss");
+      }
+      value = rescaled;
+    }
+    if (ARROW_PREDICT_FALSE(value >= upper_bound || value <= lower_bound)) {
+      return Status::Invalid("CSV conversion error to ", type_->ToString(),
+                             ": value '",
+                             std::string(reinterpret_cast<const char*>(data), size),
+                             "' does not fit in the precision");
+    }
+    return builder.Append(value);
+  };
+  RETURN_NOT_OK(builder.Reserve(parser.num_rows()));
+  RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
+  RETURN_NOT_OK(builder.Finish(out));
+
+  return Status::OK();
+}
+
 }  // namespace
 
 /////////////////////////////////////////////////////////////////////////
@@ -313,6 +441,7 @@ Status Converter::Make(const std::shared_ptr<DataType>& type,
     CONVERTER_CASE(Type::TIMESTAMP, TimestampConverter)
     CONVERTER_CASE(Type::BINARY, (VarSizeBinaryConverter<BinaryType, false>))
     CONVERTER_CASE(Type::FIXED_SIZE_BINARY, FixedSizeBinaryConverter)
+    CONVERTER_CASE(Type::DECIMAL, DecimalConverter)
 
     case Type::STRING:
       if (options.check_utf8) {
@@ -333,10 +462,141 @@ Status Converter::Make(const std::shared_ptr<DataType>& type,
   return result->Initialize();
 }
 
+Status Converter::MakeDictionary(const std::shared_ptr<DataType>& value_type,
+                                 const ConvertOptions& options, MemoryPool* pool,
+                                 std::shared_ptr<Converter>* out) {
+  Converter* result;
+
+  switch (value_type->id()) {
+    case Type::BINARY:
+      result =
+          new DictionaryBinaryConverter<BinaryType, false>(value_type, options, pool);
+      break;
+
+    case Type::STRING:
+      if (options.check_utf8) {
+        result =
+            new DictionaryBinaryConverter<StringType, true>(value_type, options, pool);
+      } else {
+        result =
+            new DictionaryBinaryConverter<StringType, false>(value_type, options, pool);
+      }
+      break;
+
+    default: {
+      return Status::NotImplemented("CSV dictionary conversion to ",
+                                    value_type->ToString(), " is not supported");
+    }
+  }
+  out->reset(result);
+  return result->Initialize();
+}
+
 Status Converter::Make(const std::shared_ptr<DataType>& type,
                        const ConvertOptions& options, std::shared_ptr<Converter>* out) {
   return Make(type, options, default_memory_pool(), out);
 }
 
+/////////////////////////////////////////////////////////////////////////
+// Value classification for type inference
+
+InferKind NextInferKind(InferKind kind, const ConvertOptions& options) {
+  switch (kind) {
+    case InferKind::Null:
+      return InferKind::Integer;
+    case InferKind::Integer:
+      return InferKind::Timestamp;
+    case InferKind::Timestamp:
+      return InferKind::Real;
+    case InferKind::Real:
+      return options.auto_dict_encode ? InferKind::TextDict : InferKind::Text;
+    case InferKind::TextDict:
+      return InferKind::Text;
+    default:
+      DCHECK(kind == InferKind::Text);
+      return InferKind::Binary;
+  }
+}
+
+ValueClassifier::ValueClassifier(const ConvertOptions& options) : options_(options) {}
+
+Status ValueClassifier::Init() {
+  TrieBuilder builder;
+  for (const auto& s : options_.null_values) {
+    RETURN_NOT_OK(builder.Append(s, true /* allow_duplicates */));
+  }
+  null_trie_ = builder.Finish();
+  util::InitializeUTF8();
+  return Status::OK();
+}
+
+bool ValueClassifier::IsNull(const uint8_t* data, uint32_t size, bool quoted) {
+  if (quoted) {
+    return false;
+  }
+  return null_trie_.Find(util::string_view(reinterpret_cast<const char*>(data), size)) >=
+         0;
+}
+
+bool ValueClassifier::Accepts(InferKind kind, const uint8_t* data, uint32_t size,
+                              bool quoted) {
+  switch (kind) {
+    case InferKind::Null:
+      return IsNull(data, size, quoted);
+    case InferKind::Integer: {
+      if (IsNull(data, size, quoted)) {
+        return true;
+      }
+      TrimWhitespace(&data, &size);
+      int64_t value;
+      return StringConverter<Int64Type>()(reinterpret_cast<const char*>(data), size,
+                                          &value);
+    }
+    case InferKind::Timestamp: {
+      if (IsNull(data, size, quoted)) {
+        return true;
+      }
+      int64_t value;
+      return StringConverter<TimestampType>(timestamp(TimeUnit::SECOND))(
+          reinterpret_cast<const char*>(data), size, &value);
+    }
+    case InferKind::Real: {
+      if (IsNull(data, size, quoted)) {
+        return true;
+      }
+      TrimWhitespace(&data, &size);
+      double value;
+      return StringConverter<DoubleType>()(reinterpret_cast<const char*>(data), size,
+                                           &value);
+    }
+    case InferKind::TextDict:
+    case InferKind::Text:
+      return !options_.check_utf8 || util::ValidateUTF8(data, size);
+    case InferKind::Binary:
+      return true;
+  }
+  return false;
+}
+
+InferKind ValueClassifier::Classify(const BlockParser& parser, int32_t col_index,
+                                    int32_t max_rows, InferKind kind) {
+  // A value rejected by a kind may be accepted by a looser one that rejects
+  // earlier values (e.g. integers are not timestamps), so each candidate kind
+  // is checked against the whole sample
+  while (kind != InferKind::Binary) {
+    bool accepted = true;
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      accepted = accepted && Accepts(kind, data, size, quoted);
+      return Status::OK();
+    };
+    DCHECK_OK(parser.VisitColumn(col_index, max_rows, visit));
+    if (accepted) {
+      break;
+    }
+    kind = NextInferKind(kind, options_);
+  }
+  return kind;
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -52,6 +52,14 @@ class ARROW_EXPORT Converter {
   static Status Make(const std::shared_ptr<DataType>& type, const ConvertOptions& options,
                      MemoryPool* pool, std::shared_ptr<Converter>* out);
 
+  /// Construct a converter to dictionary-encoded arrays of the given value
+  /// type (string or binary).  Conversion fails if a block has more than
+  /// options.auto_dict_max_cardinality distinct values.  Each converted
+  /// array has its own dictionary type.
+  static Status MakeDictionary(const std::shared_ptr<DataType>& value_type,
+                               const ConvertOptions& options, MemoryPool* pool,
+                               std::shared_ptr<Converter>* out);
+
  protected:
   ARROW_DISALLOW_COPY_AND_ASSIGN(Converter);
 
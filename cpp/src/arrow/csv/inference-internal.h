@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_CSV_INFERENCE_INTERNAL_H
+#define ARROW_CSV_INFERENCE_INTERNAL_H
+
+#include <cstdint>
+
+#include "arrow/csv/options.h"
+#include "arrow/status.h"
+#include "arrow/util/trie.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace csv {
+
+class BlockParser;
+
+/// The kinds of types a type-inferring column is converted to in turn,
+/// from the strictest to the loosest
+enum class InferKind { Null, Integer, Timestamp, Real, TextDict, Text, Binary };
+
+/// \brief Return the kind tried after the given one (which must not be Binary)
+ARROW_EXPORT
+InferKind NextInferKind(InferKind kind, const ConvertOptions& options);
+
+/// \brief Classify CSV values by the kinds of types they convert to
+///
+/// Values are checked with the same rules as the converters, but without
+/// building any array, so that a sample of a column can cheaply tell which
+/// type to start converting it with.
+class ARROW_EXPORT ValueClassifier {
+ public:
+  explicit ValueClassifier(const ConvertOptions& options);
+
+  Status Init();
+
+  /// \brief Whether a value converts to the type of the given kind
+  ///
+  /// Dictionary and cardinality limits are not checked: TextDict accepts
+  /// the same values as Text.
+  bool Accepts(InferKind kind, const uint8_t* data, uint32_t size, bool quoted);
+
+  /// \brief Return the strictest kind, starting from `kind`, that the first
+  /// `max_rows` values of a column all convert to
+  InferKind Classify(const BlockParser& parser, int32_t col_index, int32_t max_rows,
+                     InferKind kind = InferKind::Null);
+
+ protected:
+  bool IsNull(const uint8_t* data, uint32_t size, bool quoted);
+
+  ConvertOptions options_;
+  internal::Trie null_trie_;
+};
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_INFERENCE_INTERNAL_H
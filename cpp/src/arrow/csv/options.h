@@ -70,6 +70,19 @@ struct ARROW_EXPORT ConvertOptions {
   // Recognized spellings for null values
   std::vector<std::string> null_values;
 
+  // Names of the columns to read, in this order (default: all columns).
+  // The other columns are parsed but not converted.
+  std::vector<std::string> include_columns;
+  // Whether string columns are inferred as dictionary-encoded, as long as
+  // a block has at most auto_dict_max_cardinality distinct values
+  // (TableReader only)
+  bool auto_dict_encode = false;
+  int32_t auto_dict_max_cardinality = 50;
+  // Number of values of the first block of a type-inferring column that are
+  // classified to pick the type it is first converted to (0 to start with
+  // the null type and loosen it on each conversion failure)
+  int32_t inference_sample_rows = 1000;
+
   static ConvertOptions Defaults();
 };
 
@@ -81,6 +94,10 @@ struct ARROW_EXPORT ReadOptions {
   // Block size we request from the IO layer; also determines the size of
   // chunks when use_threads is true
   int32_t block_size = 1 << 20;  // 1 MB
+  // Whether, with newlines_in_values and use_threads, row boundaries are
+  // found by splitting blocks speculatively at newlines and verifying the
+  // splits in parallel
+  bool speculative_chunking = true;
 
   static ReadOptions Defaults();
 };
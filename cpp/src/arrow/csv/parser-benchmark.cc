@@ -24,6 +24,7 @@
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 namespace csv {
@@ -46,9 +47,30 @@ static std::string BuildEscapedData(int32_t num_rows = 10000) {
   return ss.str();
 }
 
+static std::string BuildNumericData(int32_t num_rows = 10000) {
+  std::string one_row = "12345,-6789.125,42,0.5\n";
+  std::stringstream ss;
+  for (int32_t i = 0; i < num_rows; ++i) {
+    ss << one_row;
+  }
+  return ss.str();
+}
+
+static std::string BuildTextData(int32_t num_rows = 10000) {
+  std::string one_row =
+      "Lorem ipsum dolor sit amet consectetur,adipiscing elit sed do eiusmod,"
+      "\"tempor incididunt ut labore et dolore\"\n";
+  std::stringstream ss;
+  for (int32_t i = 0; i < num_rows; ++i) {
+    ss << one_row;
+  }
+  return ss.str();
+}
+
 static void BenchmarkCSVChunking(benchmark::State& state,  // NOLINT non-const reference
-                                 const std::string& csv, ParseOptions options) {
-  Chunker chunker(options);
+                                 const std::string& csv, ParseOptions options,
+                                 internal::ThreadPool* thread_pool = nullptr) {
+  Chunker chunker(options, thread_pool);
 
   while (state.KeepRunning()) {
     uint32_t chunk_size;
@@ -74,6 +96,18 @@ static void BM_ChunkCSVQuotedBlock(
   BenchmarkCSVChunking(state, csv, options);
 }
 
+static void BM_ChunkCSVQuotedBlockSpeculative(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t num_rows = 50000;
+  auto csv = BuildQuotedData(num_rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+  options.newlines_in_values = true;
+
+  BenchmarkCSVChunking(state, csv, options, internal::GetCpuThreadPool());
+}
+
 static void BM_ChunkCSVEscapedBlock(
     benchmark::State& state) {  // NOLINT non-const reference
   const int32_t num_rows = 5000;
@@ -151,11 +185,35 @@ static void BM_ParseCSVEscapedBlock(
   BenchmarkCSVParsing(state, csv, num_rows, options);
 }
 
+static void BM_ParseCSVNumericBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t num_rows = 5000;
+  auto csv = BuildNumericData(num_rows);
+  auto options = ParseOptions::Defaults();
+
+  BenchmarkCSVParsing(state, csv, num_rows, options);
+}
+
+static void BM_ParseCSVTextBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t num_rows = 5000;
+  auto csv = BuildTextData(num_rows);
+  auto options = ParseOptions::Defaults();
+
+  BenchmarkCSVParsing(state, csv, num_rows, options);
+}
+
 BENCHMARK(BM_ChunkCSVQuotedBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ChunkCSVQuotedBlockSpeculative)
+    ->Repetitions(3)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
 BENCHMARK(BM_ChunkCSVEscapedBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_ChunkCSVNoNewlinesBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_ParseCSVQuotedBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 BENCHMARK(BM_ParseCSVEscapedBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ParseCSVNumericBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ParseCSVTextBlock)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 
 }  // namespace csv
 }  // namespace arrow
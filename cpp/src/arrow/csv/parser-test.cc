@@ -457,5 +457,41 @@ TEST(BlockParser, QuotedEscape) {
   }
 }
 
+TEST(BlockParser, LongFields) {
+  // Fields spanning several 64-byte windows of the vectorized scanner, with
+  // special characters at varying offsets
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+
+  for (size_t length : {1, 15, 16, 17, 63, 64, 65, 100, 200}) {
+    const std::string text(length, 'x');
+    const std::string quoted = text + ",\n" + text + "\"\"" + text;
+    const std::string escaped = text + "\\," + text;
+    std::vector<std::string> lines = {
+        text + "," + text + "\n",
+        "\"" + quoted + "\"," + text + "\r\n",
+        escaped + ",\"" + text + "\\\"" + text + "\"\n",
+    };
+    auto csv = MakeCSVData(lines);
+    BlockParser parser(options);
+    AssertParseOk(parser, csv);
+    const std::string quoted_value = text + ",\n" + text + "\"" + text;
+    const std::string escaped_value = text + "," + text;
+    AssertColumnsEq(parser,
+                    {{text, quoted_value, escaped_value},
+                     {text, text, text + "\"" + text}},
+                    {{false, true, false}, {false, false, true}} /* quoted */);
+  }
+}
+
+TEST(BlockParser, LongFieldsTruncated) {
+  // A long line truncated at the end of the block is left unparsed
+  const std::string text(100, 'x');
+  auto csv = MakeCSVData({text + "," + text + "\n", text + "," + text});
+  BlockParser parser(ParseOptions::Defaults());
+  AssertParsePartial(parser, csv, static_cast<uint32_t>(text.size() * 2 + 2));
+  AssertColumnsEq(parser, {{text}, {text}});
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -22,9 +22,11 @@
 #include <sstream>
 #include <utility>
 
+#include "arrow/csv/scanner-internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace csv {
@@ -54,7 +56,8 @@ class BlockParser::PresizedParsedWriter {
  public:
   PresizedParsedWriter(MemoryPool* pool, uint32_t size)
       : parsed_size_(0), parsed_capacity_(size) {
-    ARROW_CHECK_OK(AllocateResizableBuffer(pool, parsed_capacity_, &parsed_buffer_));
+    ARROW_CHECK_OK(AllocateResizableBuffer(
+        pool, parsed_capacity_ + SpecialCharScanner::kCopyPadding, &parsed_buffer_));
     parsed_ = parsed_buffer_->mutable_data();
   }
 
@@ -70,6 +73,12 @@ class BlockParser::PresizedParsedWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  void PushFieldRun(const char* data, int64_t nchars) {
+    DCHECK_LE(parsed_size_ + nchars, parsed_capacity_);
+    SpecialCharScanner::CopyRun(parsed_ + parsed_size_, data, nchars);
+    parsed_size_ += nchars;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
@@ -188,7 +197,8 @@ class BlockParser::PresizedValuesWriter {
 };
 
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
+Status BlockParser::ParseLine(SpecialCharScanner* scanner,
+                              ValuesWriter* values_writer, ParsedWriter* parsed_writer,
                               const char* data, const char* data_end, bool is_final,
                               const char** out_data) {
   int32_t num_cols = 0;
@@ -261,6 +271,12 @@ InField:
     }
   }
   parsed_writer->PushFieldChar(c);
+  // Past its first character, copy the rest of the field in bulk
+  {
+    const int64_t run_length = scanner->UnquotedRunLength(data, data_end);
+    parsed_writer->PushFieldRun(data, run_length);
+    data += run_length;
+  }
   goto InField;
 
 InQuotedField:
@@ -288,6 +304,11 @@ InQuotedField:
     }
   }
   parsed_writer->PushFieldChar(c);
+  {
+    const int64_t run_length = scanner->QuotedRunLength(data, data_end);
+    parsed_writer->PushFieldRun(data, run_length);
+    data += run_length;
+  }
   goto InQuotedField;
 
 FieldEnd:
@@ -339,14 +360,15 @@ EmptyLine:
 }
 
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-Status BlockParser::ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
+Status BlockParser::ParseChunk(SpecialCharScanner* scanner,
+                               ValuesWriter* values_writer, ParsedWriter* parsed_writer,
                                const char* data, const char* data_end, bool is_final,
                                int32_t rows_in_chunk, const char** out_data,
                                bool* finished_parsing) {
   while (data < data_end && rows_in_chunk > 0) {
     const char* line_end = data;
-    RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, data,
-                                                data_end, is_final, &line_end));
+    RETURN_NOT_OK(ParseLine<SpecializedOptions>(scanner, values_writer, parsed_writer,
+                                                data, data_end, is_final, &line_end));
     if (line_end == data) {
       // Cannot parse any further
       *finished_parsing = true;
@@ -383,6 +405,7 @@ Status BlockParser::DoParseSpecialized(const char* start, uint32_t size, bool is
   bool finished_parsing = false;
 
   PresizedParsedWriter parsed_writer(pool_, size);
+  SpecialCharScanner scanner(options_);
 
   if (num_cols_ == -1) {
     // Can't presize values when the number of columns is not known, first parse
@@ -391,9 +414,9 @@ Status BlockParser::DoParseSpecialized(const char* start, uint32_t size, bool is
     ResizableValuesWriter values_writer(pool_);
     values_writer.Start(parsed_writer);
 
-    RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                 data_end, is_final, rows_in_chunk, &data,
-                                                 &finished_parsing));
+    RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&scanner, &values_writer, &parsed_writer,
+                                                 data, data_end, is_final, rows_in_chunk,
+                                                 &data, &finished_parsing));
     if (num_cols_ == -1) {
       return ParseError("Empty CSV file or block: cannot infer number of columns");
     }
@@ -413,9 +436,9 @@ Status BlockParser::DoParseSpecialized(const char* start, uint32_t size, bool is
     PresizedValuesWriter values_writer(pool_, rows_in_chunk, num_cols_);
     values_writer.Start(parsed_writer);
 
-    RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                 data_end, is_final, rows_in_chunk, &data,
-                                                 &finished_parsing));
+    RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&scanner, &values_writer, &parsed_writer,
+                                                 data, data_end, is_final, rows_in_chunk,
+                                                 &data, &finished_parsing));
   }
 
   parsed_writer.Finish(&parsed_buffer_);
@@ -465,10 +488,12 @@ Status BlockParser::DoParse(const char* start, uint32_t size, bool is_final,
 }
 
 Status BlockParser::Parse(const char* data, uint32_t size, uint32_t* out_size) {
+  ARROW_TRACE_SPAN("csv", "parse");
   return DoParse(data, size, false /* is_final */, out_size);
 }
 
 Status BlockParser::ParseFinal(const char* data, uint32_t size, uint32_t* out_size) {
+  ARROW_TRACE_SPAN("csv", "parse");
   return DoParse(data, size, true /* is_final */, out_size);
 }
 
@@ -35,6 +35,8 @@ class MemoryPool;
 
 namespace csv {
 
+class SpecialCharScanner;
+
 constexpr int32_t kMaxParserNumRows = 100000;
 
 /// \class BlockParser
@@ -96,6 +98,27 @@ class ARROW_EXPORT BlockParser {
     return Status::OK();
   }
 
+  /// \brief Visit the parsed values of the first `max_rows` rows in a column
+  template <typename Visitor>
+  Status VisitColumn(int32_t col_index, int32_t max_rows, Visitor&& visit) const {
+    for (size_t buf_index = 0; buf_index < values_buffers_.size(); ++buf_index) {
+      const auto& values_buffer = values_buffers_[buf_index];
+      const auto values = reinterpret_cast<const ValueDesc*>(values_buffer->data());
+      const auto max_pos =
+          static_cast<int32_t>(values_buffer->size() / sizeof(ValueDesc)) - 1;
+      for (int32_t pos = col_index; pos < max_pos; pos += num_cols_) {
+        if (max_rows-- <= 0) {
+          return Status::OK();
+        }
+        auto start = values[pos].offset;
+        auto stop = values[pos + 1].offset;
+        auto quoted = values[pos + 1].quoted;
+        ARROW_RETURN_NOT_OK(visit(parsed_ + start, stop - start, quoted));
+      }
+    }
+    return Status::OK();
+  }
+
  protected:
   ARROW_DISALLOW_COPY_AND_ASSIGN(BlockParser);
 
@@ -105,15 +128,16 @@ class ARROW_EXPORT BlockParser {
                             uint32_t* out_size);
 
   template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-  Status ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                    const char* data, const char* data_end, bool is_final,
-                    int32_t rows_in_chunk, const char** out_data, bool* finished_parsing);
+  Status ParseChunk(SpecialCharScanner* scanner, ValuesWriter* values_writer,
+                    ParsedWriter* parsed_writer, const char* data, const char* data_end,
+                    bool is_final, int32_t rows_in_chunk, const char** out_data,
+                    bool* finished_parsing);
 
   // Parse a single line from the data pointer
   template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-  Status ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                   const char* data, const char* data_end, bool is_final,
-                   const char** out_data);
+  Status ParseLine(SpecialCharScanner* scanner, ValuesWriter* values_writer,
+                   ParsedWriter* parsed_writer, const char* data, const char* data_end,
+                   bool is_final, const char** out_data);
 
   MemoryPool* pool_;
   const ParseOptions options_;
@@ -17,8 +17,10 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -32,7 +34,10 @@
 #include "arrow/csv/column-builder.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
+#include "arrow/io/instrumented.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/io/readahead.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
@@ -40,6 +45,7 @@
 #include "arrow/util/macros.h"
 #include "arrow/util/task-group.h"
 #include "arrow/util/thread-pool.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 
@@ -54,6 +60,7 @@ class InputStream;
 namespace csv {
 
 using internal::GetCpuThreadPool;
+using internal::GetIOThreadPool;
 using internal::ThreadPool;
 using io::internal::ReadaheadBuffer;
 using io::internal::ReadaheadSpooler;
@@ -64,11 +71,10 @@ static constexpr int64_t kDefaultRightPadding = 16;
 /////////////////////////////////////////////////////////////////////////
 // Base class for common functionality
 
-class BaseTableReader : public csv::TableReader {
+class BaseReader {
  public:
-  BaseTableReader(MemoryPool* pool, const ReadOptions& read_options,
-                  const ParseOptions& parse_options,
-                  const ConvertOptions& convert_options)
+  BaseReader(MemoryPool* pool, const ReadOptions& read_options,
+             const ParseOptions& parse_options, const ConvertOptions& convert_options)
       : pool_(pool),
         read_options_(read_options),
         parse_options_(parse_options),
@@ -77,6 +83,7 @@ class BaseTableReader : public csv::TableReader {
  protected:
   // Read a next data block, stitch it to trailing data
   Status ReadNextBlock() {
+    ARROW_TRACE_SPAN("csv", "read_block");
     bool trailing_data = cur_size_ > 0;
     ReadaheadBuffer rh;
 
@@ -156,24 +163,34 @@ class BaseTableReader : public csv::TableReader {
     num_cols_ = parser.num_cols();
     DCHECK_GT(num_cols_, 0);
 
+    std::vector<std::string> names;
     for (int32_t col_index = 0; col_index < num_cols_; ++col_index) {
       auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
-        DCHECK_EQ(column_names_.size(), static_cast<uint32_t>(col_index));
-        column_names_.emplace_back(reinterpret_cast<const char*>(data), size);
+        DCHECK_EQ(names.size(), static_cast<uint32_t>(col_index));
+        names.emplace_back(reinterpret_cast<const char*>(data), size);
         return Status::OK();
       };
       RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
-      std::shared_ptr<ColumnBuilder> builder;
-      // Does the named column have a fixed type?
-      auto it = convert_options_.column_types.find(column_names_[col_index]);
-      if (it == convert_options_.column_types.end()) {
-        RETURN_NOT_OK(
-            ColumnBuilder::Make(col_index, convert_options_, task_group_, &builder));
-      } else {
-        RETURN_NOT_OK(ColumnBuilder::Make(it->second, col_index, convert_options_,
-                                          task_group_, &builder));
+    }
+
+    if (convert_options_.include_columns.empty()) {
+      for (int32_t col_index = 0; col_index < num_cols_; ++col_index) {
+        RETURN_NOT_OK(MakeColumnBuilder(col_index, names[col_index]));
+      }
+    } else {
+      // Only build the requested columns, the others are never converted
+      std::unordered_map<std::string, int32_t> name_to_index;
+      for (int32_t col_index = num_cols_ - 1; col_index >= 0; --col_index) {
+        name_to_index[names[col_index]] = col_index;
+      }
+      for (const auto& name : convert_options_.include_columns) {
+        auto it = name_to_index.find(name);
+        if (it == name_to_index.end()) {
+          return Status::KeyError("Column '", name,
+                                  "' in include_columns does not exist in CSV file");
+        }
+        RETURN_NOT_OK(MakeColumnBuilder(it->second, name));
       }
-      column_builders_.push_back(builder);
     }
 
     // Skip parsed header rows
@@ -182,6 +199,23 @@ class BaseTableReader : public csv::TableReader {
     return Status::OK();
   }
 
+  Status MakeColumnBuilder(int32_t col_index, const std::string& name) {
+    std::shared_ptr<ColumnBuilder> builder;
+    // Does the named column have a fixed type?
+    auto it = convert_options_.column_types.find(name);
+    if (it == convert_options_.column_types.end()) {
+      RETURN_NOT_OK(
+          ColumnBuilder::Make(col_index, convert_options_, task_group_, &builder));
+    } else {
+      RETURN_NOT_OK(ColumnBuilder::Make(it->second, col_index, convert_options_,
+                                        task_group_, &builder));
+    }
+    column_names_.push_back(name);
+    column_indices_.push_back(col_index);
+    column_builders_.push_back(builder);
+    return Status::OK();
+  }
+
   // Trigger conversion of parsed block data
   Status ProcessData(const std::shared_ptr<BlockParser>& parser, int64_t block_index) {
     for (auto& builder : column_builders_) {
@@ -192,13 +226,12 @@ class BaseTableReader : public csv::TableReader {
 
   Status MakeTable(std::shared_ptr<Table>* out) {
     DCHECK_GT(num_cols_, 0);
-    DCHECK_EQ(column_names_.size(), static_cast<uint32_t>(num_cols_));
-    DCHECK_EQ(column_builders_.size(), static_cast<uint32_t>(num_cols_));
+    DCHECK_EQ(column_names_.size(), column_builders_.size());
 
     std::vector<std::shared_ptr<Field>> fields;
     std::vector<std::shared_ptr<Column>> columns;
 
-    for (int32_t i = 0; i < num_cols_; ++i) {
+    for (size_t i = 0; i < column_builders_.size(); ++i) {
       std::shared_ptr<ChunkedArray> array;
       RETURN_NOT_OK(column_builders_[i]->Finish(&array));
       columns.push_back(std::make_shared<Column>(column_names_[i], array));
@@ -213,10 +246,12 @@ class BaseTableReader : public csv::TableReader {
   ParseOptions parse_options_;
   ConvertOptions convert_options_;
 
+  // Number of columns in the CSV file
   int32_t num_cols_ = -1;
   std::shared_ptr<ReadaheadSpooler> readahead_;
-  // Column names
+  // Names and CSV column indices of the columns read, one per column builder
   std::vector<std::string> column_names_;
+  std::vector<int32_t> column_indices_;
   std::shared_ptr<internal::TaskGroup> task_group_;
   std::vector<std::shared_ptr<ColumnBuilder>> column_builders_;
 
@@ -233,6 +268,11 @@ class BaseTableReader : public csv::TableReader {
   bool eof_ = false;
 };
 
+class BaseTableReader : public csv::TableReader, public BaseReader {
+ public:
+  using BaseReader::BaseReader;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // Serial TableReader implementation
 
@@ -250,6 +290,7 @@ class SerialTableReader : public BaseTableReader {
   }
 
   Status Read(std::shared_ptr<Table>* out) {
+    ARROW_TRACE_SPAN("csv", "read_table");
     task_group_ = internal::TaskGroup::MakeSerial();
 
     // First block
@@ -324,9 +365,11 @@ class ThreadedTableReader : public BaseTableReader {
   }
 
   Status Read(std::shared_ptr<Table>* out) {
+    ARROW_TRACE_SPAN("csv", "read_table");
     task_group_ = internal::TaskGroup::MakeThreaded(thread_pool_);
     static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
-    Chunker chunker(parse_options_);
+    Chunker chunker(parse_options_,
+                    read_options_.speculative_chunking ? thread_pool_ : nullptr);
 
     // Get first block and process header serially
     RETURN_NOT_OK(ReadNextBlock());
@@ -400,6 +443,512 @@ class ThreadedTableReader : public BaseTableReader {
   ThreadPool* thread_pool_;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// Parallel TableReader implementation reading a file as independent ranges
+
+// Bytes read past the end of a range to find the end of its last row
+static constexpr int64_t kSplitOverrun = 64 * 1024;  // 64 kB
+
+class SplitTableReader : public BaseTableReader {
+ public:
+  SplitTableReader(MemoryPool* pool, std::shared_ptr<io::RandomAccessFile> file,
+                   ThreadPool* thread_pool, const ReadOptions& read_options,
+                   const ParseOptions& parse_options,
+                   const ConvertOptions& convert_options)
+      : BaseTableReader(pool, read_options, parse_options, convert_options),
+        file_(std::move(file)),
+        thread_pool_(thread_pool) {}
+
+  ~SplitTableReader() {
+    if (task_group_) {
+      // In case of error, make sure all pending tasks are finished before
+      // we start destroying BaseTableReader members
+      ARROW_UNUSED(task_group_->Finish());
+    }
+  }
+
+  Status Read(std::shared_ptr<Table>* out) {
+    ARROW_TRACE_SPAN("csv", "read_table");
+    task_group_ = internal::TaskGroup::MakeThreaded(thread_pool_);
+
+    int64_t start;
+    RETURN_NOT_OK(file_->Tell(&start));
+    RETURN_NOT_OK(file_->GetSize(&file_size_));
+    if (start >= file_size_) {
+      return Status::Invalid("Empty CSV file");
+    }
+
+    // Process header serially
+    std::shared_ptr<ResizableBuffer> header_block;
+    int64_t header_size = 0;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, 0, &header_block));
+    RETURN_NOT_OK(
+        ReadMore(start, read_options_.block_size, header_block.get(), &header_size));
+    cur_block_ = header_block;
+    cur_data_ = header_block->data();
+    cur_size_ = header_size;
+    RETURN_NOT_OK(ProcessHeader());
+    data_start_ = start + (cur_data_ - header_block->data());
+    cur_block_.reset();
+
+    // Each range is read and parsed by its own task, the rows starting in
+    // it forming the chunk of the same index
+    const int64_t data_size = file_size_ - data_start_;
+    const int64_t block_size = read_options_.block_size;
+    const std::vector<io::ReadRange> ranges =
+        io::SplitRange(data_start_, data_size, (data_size + block_size - 1) / block_size);
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      const io::ReadRange range = ranges[i];
+      const int64_t block_index = static_cast<int64_t>(i);
+      task_group_->Append([this, range, block_index]() {
+        return ReadRange(range.offset, range.offset + range.length, block_index);
+      });
+    }
+    RETURN_NOT_OK(task_group_->Finish());
+
+    return MakeTable(out);
+  }
+
+ protected:
+  // Read and parse the rows starting in [range_start, range_end)
+  Status ReadRange(int64_t range_start, int64_t range_end, int64_t block_index) {
+    static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
+    Chunker chunker(parse_options_);
+
+    // Unless the range starts right after the header, read from one byte
+    // before it to tell whether a row starts exactly there
+    const bool first = range_start == data_start_;
+    const int64_t read_start = first ? range_start : range_start - 1;
+    std::shared_ptr<ResizableBuffer> block;
+    int64_t size = 0;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, 0, &block));
+    RETURN_NOT_OK(
+        ReadMore(read_start, range_end - read_start + kSplitOverrun, block.get(), &size));
+
+    int64_t begin = 0;
+    if (!first) {
+      RETURN_NOT_OK(FindRowStart(&chunker, read_start, 0, block.get(), &size, &begin));
+    }
+    int64_t end = size;
+    if (range_end < file_size_) {
+      RETURN_NOT_OK(FindRowStart(&chunker, read_start, range_end - 1 - read_start,
+                                 block.get(), &size, &end));
+    }
+
+    auto parser =
+        std::make_shared<BlockParser>(pool_, parse_options_, num_cols_, max_num_rows);
+    uint32_t parsed_size = 0;
+    RETURN_NOT_OK(parser->ParseFinal(reinterpret_cast<const char*>(block->data() + begin),
+                                     static_cast<uint32_t>(end - begin), &parsed_size));
+    // Even empty, the chunk is inserted to keep chunk indices dense
+    RETURN_NOT_OK(ProcessData(parser, block_index));
+    // Keep the block alive until the parser is done with it
+    block.reset();
+    return Status::OK();
+  }
+
+  // Find the first row starting after the byte at offset in the block,
+  // reading more of the file as needed
+  Status FindRowStart(Chunker* chunker, int64_t read_start, int64_t offset,
+                      ResizableBuffer* block, int64_t* size, int64_t* out_pos) {
+    while (true) {
+      const bool final = read_start + *size >= file_size_;
+      bool found;
+      uint32_t pos;
+      RETURN_NOT_OK(chunker->FindRowStart(
+          reinterpret_cast<const char*>(block->data() + offset),
+          static_cast<uint32_t>(*size - offset), final, &found, &pos));
+      if (found) {
+        *out_pos = offset + pos;
+        return Status::OK();
+      }
+      // The row extends past the data read, read as much again
+      RETURN_NOT_OK(
+          ReadMore(read_start, std::max(kSplitOverrun, *size - offset), block, size));
+    }
+  }
+
+  // Append up to nbytes of the file to the block of *size bytes read from
+  // read_start, keeping it zero-padded
+  Status ReadMore(int64_t read_start, int64_t nbytes, ResizableBuffer* block,
+                  int64_t* size) {
+    nbytes = std::min(nbytes, file_size_ - read_start - *size);
+    RETURN_NOT_OK(block->Resize(*size + nbytes + kDefaultRightPadding, false));
+    int64_t bytes_read = 0;
+    if (nbytes > 0) {
+      RETURN_NOT_OK(file_->ReadAt(read_start + *size, nbytes, &bytes_read,
+                                  block->mutable_data() + *size));
+    }
+    *size += bytes_read;
+    std::memset(block->mutable_data() + *size, 0, kDefaultRightPadding);
+    return Status::OK();
+  }
+
+  std::shared_ptr<io::RandomAccessFile> file_;
+  ThreadPool* thread_pool_;
+  int64_t file_size_ = 0;
+  // Where the data rows start, after the header
+  int64_t data_start_ = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////
+// StreamingReader implementation
+
+class StreamingReaderImpl : public StreamingReader, public BaseReader {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                      ThreadPool* thread_pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options,
+                      const ConvertOptions& convert_options)
+      : BaseReader(pool, read_options, parse_options, convert_options),
+        thread_pool_(thread_pool),
+        chunker_(parse_options,
+                 read_options.speculative_chunking ? thread_pool : nullptr) {
+    // Each batch would get its own dictionaries, which a stream schema
+    // cannot describe
+    convert_options_.auto_dict_encode = false;
+    // Blocks are parsed and converted by windows of one block per worker
+    // thread, which also bounds the readahead
+    window_size_ = thread_pool_ ? thread_pool_->GetCapacity() : 1;
+    readahead_ = std::make_shared<ReadaheadSpooler>(
+        pool_, input, read_options_.block_size, window_size_, kDefaultLeftPadding,
+        kDefaultRightPadding);
+  }
+
+  ~StreamingReaderImpl() {
+    if (task_group_) {
+      // In case of error, make sure all pending tasks are finished before
+      // we start destroying BaseReader members
+      ARROW_UNUSED(task_group_->Finish());
+    }
+  }
+
+  // Read the header and the first window of blocks, fixing the schema
+  Status Init() {
+    RETURN_NOT_OK(ReadNextBlock());
+    if (eof_) {
+      return Status::Invalid("Empty CSV file");
+    }
+    task_group_ = MakeTaskGroup();
+    RETURN_NOT_OK(ProcessHeader());
+    return ReadWindow();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    ARROW_TRACE_SPAN("csv", "read_batch");
+    while (pending_batches_.empty() && !finished_) {
+      RETURN_NOT_OK(ReadWindow());
+    }
+    if (pending_batches_.empty()) {
+      batch->reset();
+      return Status::OK();
+    }
+    *batch = std::move(pending_batches_.front());
+    pending_batches_.pop_front();
+    return Status::OK();
+  }
+
+ protected:
+  std::shared_ptr<internal::TaskGroup> MakeTaskGroup() const {
+    return thread_pool_ ? internal::TaskGroup::MakeThreaded(thread_pool_)
+                        : internal::TaskGroup::MakeSerial();
+  }
+
+  // Parse and convert up to window_size_ blocks, one record batch each
+  Status ReadWindow() {
+    if (schema_) {
+      // The column types were fixed by the first window: convert the next
+      // blocks into fresh builders, so that earlier chunks are not retained
+      task_group_ = MakeTaskGroup();
+      for (int i = 0; i < schema_->num_fields(); ++i) {
+        RETURN_NOT_OK(ColumnBuilder::Make(schema_->field(i)->type(), column_indices_[i],
+                                          convert_options_, task_group_,
+                                          &column_builders_[i]));
+      }
+    }
+
+    int64_t num_blocks = 0;
+    while (num_blocks < window_size_ && task_group_->ok()) {
+      if (eof_) {
+        if (cur_size_ > 0) {
+          // Parse remaining data, which may lack a final newline
+          AppendParseTask(cur_data_, static_cast<uint32_t>(cur_size_), num_blocks++,
+                          true);
+          cur_size_ = 0;
+        }
+        finished_ = true;
+        break;
+      }
+      uint32_t chunk_size = 0;
+      RETURN_NOT_OK(chunker_.Process(reinterpret_cast<const char*>(cur_data_),
+                                     static_cast<uint32_t>(cur_size_), &chunk_size));
+      if (chunk_size > 0) {
+        // Got a chunk of rows
+        AppendParseTask(cur_data_, chunk_size, num_blocks++, false);
+        cur_data_ += chunk_size;
+        cur_size_ -= chunk_size;
+      } else {
+        // Need to fetch more data to get at least one row
+        RETURN_NOT_OK(ReadNextBlock());
+      }
+    }
+    RETURN_NOT_OK(task_group_->Finish());
+
+    std::vector<std::shared_ptr<ChunkedArray>> columns(column_builders_.size());
+    for (size_t i = 0; i < column_builders_.size(); ++i) {
+      RETURN_NOT_OK(column_builders_[i]->Finish(&columns[i]));
+    }
+    if (!schema_) {
+      std::vector<std::shared_ptr<Field>> fields;
+      for (size_t i = 0; i < column_builders_.size(); ++i) {
+        fields.push_back(field(column_names_[i], columns[i]->type()));
+      }
+      schema_ = ::arrow::schema(fields);
+    }
+    for (int64_t block_index = 0; block_index < num_blocks; ++block_index) {
+      std::vector<std::shared_ptr<Array>> arrays;
+      for (const auto& column : columns) {
+        arrays.push_back(column->chunk(static_cast<int>(block_index)));
+      }
+      const int64_t num_rows = arrays[0]->length();
+      if (num_rows > 0) {
+        pending_batches_.push_back(RecordBatch::Make(schema_, num_rows, arrays));
+      }
+    }
+    return Status::OK();
+  }
+
+  void AppendParseTask(const uint8_t* chunk_data, uint32_t chunk_size,
+                       int64_t block_index, bool final) {
+    static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
+    std::shared_ptr<Buffer> chunk_buffer = cur_block_;
+    // "mutable" allows to modify captured by-copy chunk_buffer
+    task_group_->Append([=]() mutable -> Status {
+      auto parser =
+          std::make_shared<BlockParser>(pool_, parse_options_, num_cols_, max_num_rows);
+      uint32_t parsed_size = 0;
+      const char* data = reinterpret_cast<const char*>(chunk_data);
+      if (final) {
+        RETURN_NOT_OK(parser->ParseFinal(data, chunk_size, &parsed_size));
+      } else {
+        RETURN_NOT_OK(parser->Parse(data, chunk_size, &parsed_size));
+        if (parsed_size != chunk_size) {
+          DCHECK_EQ(parsed_size, chunk_size);
+          return Status::Invalid("Chunker and parser disagree on block size: ",
+                                 chunk_size, " vs ", parsed_size);
+        }
+      }
+      // Even empty, the chunk is inserted to keep chunk indices dense
+      RETURN_NOT_OK(ProcessData(parser, block_index));
+      // Keep chunk buffer alive within closure and release it at the end
+      chunk_buffer.reset();
+      return Status::OK();
+    });
+  }
+
+  ThreadPool* thread_pool_;
+  Chunker chunker_;
+  int32_t window_size_;
+  std::shared_ptr<Schema> schema_;
+  // Converted batches of the current window, not yet returned
+  std::deque<std::shared_ptr<RecordBatch>> pending_batches_;
+  // Whether all the data was handed to the parse tasks
+  bool finished_ = false;
+};
+
+/////////////////////////////////////////////////////////////////////////
+// MultiSourceReader implementation
+
+class MultiSourceReaderImpl : public MultiSourceReader {
+ public:
+  MultiSourceReaderImpl(MemoryPool* pool,
+                        std::vector<std::shared_ptr<io::InputStream>> inputs,
+                        ThreadPool* thread_pool, const ReadOptions& read_options,
+                        const ParseOptions& parse_options,
+                        const ConvertOptions& convert_options)
+      : pool_(pool),
+        inputs_(std::move(inputs)),
+        thread_pool_(thread_pool),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        convert_options_(convert_options) {
+    // Each input is read by a single task, without fanning out further
+    read_options_.use_threads = false;
+    // Each input would get its own dictionaries
+    convert_options_.auto_dict_encode = false;
+    // Read ahead one input per worker thread
+    window_size_ = thread_pool_ ? static_cast<size_t>(thread_pool_->GetCapacity()) : 0;
+  }
+
+  ~MultiSourceReaderImpl() {
+    // In case of error, make sure all pending tasks are finished before
+    // destroying the inputs
+    for (const auto& fut : pending_tables_) {
+      fut.Wait();
+    }
+  }
+
+  // Read the first input with data, fixing the schema
+  Status Init() {
+    if (inputs_.empty()) {
+      return Status::Invalid("No CSV inputs");
+    }
+    // Inputs without any row would only yield null columns, and
+    // contribute no data
+    do {
+      RETURN_NOT_OK(ReadSource(next_source_++, convert_options_, &first_table_));
+    } while (first_table_->num_rows() == 0 && next_source_ < inputs_.size());
+    schema_ = first_table_->schema();
+
+    // The other inputs are converted to the same columns and types
+    convert_options_.include_columns.clear();
+    for (const auto& field : schema_->fields()) {
+      convert_options_.include_columns.push_back(field->name());
+      convert_options_.column_types[field->name()] = field->type();
+    }
+    ReadAhead();
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    while (true) {
+      if (batch_reader_) {
+        RETURN_NOT_OK(batch_reader_->ReadNext(batch));
+        if (*batch) {
+          return Status::OK();
+        }
+        batch_reader_.reset();
+        current_table_.reset();
+      }
+      RETURN_NOT_OK(NextTable(&current_table_));
+      if (!current_table_) {
+        batch->reset();
+        return Status::OK();
+      }
+      batch_reader_ = std::make_shared<TableBatchReader>(*current_table_);
+    }
+  }
+
+  Status Read(std::shared_ptr<Table>* out) override {
+    std::vector<std::shared_ptr<Table>> tables;
+    if (batch_reader_) {
+      // Data of the current input not yet returned by ReadNext()
+      std::shared_ptr<Table> rest;
+      RETURN_NOT_OK(batch_reader_->ReadAll(&rest));
+      tables.push_back(rest);
+      batch_reader_.reset();
+      current_table_.reset();
+    }
+    if (thread_pool_) {
+      // Read all the remaining inputs concurrently
+      window_size_ = inputs_.size();
+      ReadAhead();
+    }
+    std::shared_ptr<Table> table;
+    while (true) {
+      RETURN_NOT_OK(NextTable(&table));
+      if (!table) {
+        break;
+      }
+      tables.push_back(table);
+    }
+    if (tables.empty()) {
+      return Table::FromRecordBatches(schema_, {}, out);
+    }
+    return ConcatenateTables(tables, out);
+  }
+
+ protected:
+  // Read a whole input serially
+  Status ReadSource(size_t index, const ConvertOptions& convert_options,
+                    std::shared_ptr<Table>* out) {
+    std::shared_ptr<TableReader> reader;
+    Status st = TableReader::Make(pool_, inputs_[index], read_options_, parse_options_,
+                                  convert_options, &reader);
+    if (st.ok()) {
+      st = reader->Read(out);
+    }
+    if (!st.ok()) {
+      std::stringstream ss;
+      ss << "In CSV input #" << index << ": " << st.message();
+      return Status(st.code(), ss.str());
+    }
+    // Release the input as soon as it is consumed
+    inputs_[index].reset();
+    return Status::OK();
+  }
+
+  Future<std::shared_ptr<Table>> ReadSourceAsync(size_t index) {
+    if (!thread_pool_) {
+      std::shared_ptr<Table> table;
+      Status st = ReadSource(index, convert_options_, &table);
+      return st.ok() ? Future<std::shared_ptr<Table>>::MakeFinished(std::move(table))
+                     : Future<std::shared_ptr<Table>>::MakeFailed(std::move(st));
+    }
+    // We're careful that the pending tasks finish before this reader is destroyed
+    return thread_pool_->SubmitAsync<std::shared_ptr<Table>>(
+        [this, index](std::shared_ptr<Table>* out) {
+          return ReadSource(index, convert_options_, out);
+        });
+  }
+
+  // Keep up to window_size_ inputs being read
+  void ReadAhead() {
+    while (next_source_ < inputs_.size() && pending_tables_.size() < window_size_) {
+      pending_tables_.push_back(ReadSourceAsync(next_source_++));
+    }
+  }
+
+  // Get the table of the next input, or null after the last one
+  Status NextTable(std::shared_ptr<Table>* out) {
+    if (first_table_) {
+      *out = std::move(first_table_);
+      return Status::OK();
+    }
+    Future<std::shared_ptr<Table>> fut;
+    if (!pending_tables_.empty()) {
+      fut = pending_tables_.front();
+      pending_tables_.pop_front();
+    } else if (next_source_ < inputs_.size()) {
+      fut = ReadSourceAsync(next_source_++);
+    } else {
+      out->reset();
+      return Status::OK();
+    }
+    ReadAhead();
+    return fut.Get(out);
+  }
+
+  MemoryPool* pool_;
+  std::vector<std::shared_ptr<io::InputStream>> inputs_;
+  ThreadPool* thread_pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  ConvertOptions convert_options_;
+
+  std::shared_ptr<Schema> schema_;
+  size_t window_size_;
+  // Index of the next input to read
+  size_t next_source_ = 0;
+  std::shared_ptr<Table> first_table_;
+  std::deque<Future<std::shared_ptr<Table>>> pending_tables_;
+  // The table whose batches ReadNext() is returning
+  std::shared_ptr<Table> current_table_;
+  std::shared_ptr<TableBatchReader> batch_reader_;
+};
+
+Future<std::shared_ptr<Table>> TableReader::ReadAsync() {
+  auto self = shared_from_this();
+  // The calling thread mostly waits for I/O, while parsing and conversion
+  // are dispatched to the CPU thread pool
+  return GetIOThreadPool()->SubmitAsync<std::shared_ptr<Table>>(
+      [self](std::shared_ptr<Table>* out) { return self->Read(out); });
+}
+
 /////////////////////////////////////////////////////////////////////////
 // TableReader factory function
 
@@ -409,7 +958,16 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
                          const ConvertOptions& convert_options,
                          std::shared_ptr<TableReader>* out) {
   std::shared_ptr<TableReader> result;
-  if (read_options.use_threads) {
+  input = io::internal::MaybeInstrumentStream(std::move(input), "csv");
+  auto file = std::dynamic_pointer_cast<io::RandomAccessFile>(input);
+  if (read_options.use_threads && file && !parse_options.newlines_in_values) {
+    // Row boundaries can be found anywhere in the file: read it as
+    // several ranges concurrently
+    result = std::make_shared<SplitTableReader>(
+        pool, file, GetCpuThreadPool(), read_options, parse_options, convert_options);
+    *out = result;
+    return Status::OK();
+  } else if (read_options.use_threads) {
     result = std::make_shared<ThreadedTableReader>(
         pool, input, GetCpuThreadPool(), read_options, parse_options, convert_options);
     *out = result;
@@ -422,5 +980,37 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   }
 }
 
+/////////////////////////////////////////////////////////////////////////
+// StreamingReader factory function
+
+Status StreamingReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                             const ReadOptions& read_options,
+                             const ParseOptions& parse_options,
+                             const ConvertOptions& convert_options,
+                             std::shared_ptr<StreamingReader>* out) {
+  input = io::internal::MaybeInstrumentStream(std::move(input), "csv");
+  ThreadPool* thread_pool = read_options.use_threads ? GetCpuThreadPool() : nullptr;
+  auto result = std::make_shared<StreamingReaderImpl>(
+      pool, input, thread_pool, read_options, parse_options, convert_options);
+  RETURN_NOT_OK(result->Init());
+  *out = result;
+  return Status::OK();
+}
+
+/////////////////////////////////////////////////////////////////////////
+// MultiSourceReader factory function
+
+Status MultiSourceReader::Make(
+    MemoryPool* pool, const std::vector<std::shared_ptr<io::InputStream>>& inputs,
+    const ReadOptions& read_options, const ParseOptions& parse_options,
+    const ConvertOptions& convert_options, std::shared_ptr<MultiSourceReader>* out) {
+  ThreadPool* thread_pool = read_options.use_threads ? GetCpuThreadPool() : nullptr;
+  auto result = std::make_shared<MultiSourceReaderImpl>(
+      pool, inputs, thread_pool, read_options, parse_options, convert_options);
+  RETURN_NOT_OK(result->Init());
+  *out = result;
+  return Status::OK();
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -19,9 +19,12 @@
 #define ARROW_CSV_READER_H
 
 #include <memory>
+#include <vector>
 
 #include "arrow/csv/options.h"  // IWYU pragma: keep
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -35,18 +38,83 @@ class InputStream;
 
 namespace csv {
 
-class ARROW_EXPORT TableReader {
+class ARROW_EXPORT TableReader : public std::enable_shared_from_this<TableReader> {
  public:
   virtual ~TableReader() = default;
 
   virtual Status Read(std::shared_ptr<Table>* out) = 0;
 
+  /// \brief Read the table asynchronously
+  ///
+  /// The read runs on the I/O thread pool; the reader is kept alive until
+  /// the returned Future finishes.
+  Future<std::shared_ptr<Table>> ReadAsync();
+
+  /// \brief Create a reader of the CSV data from the current position of input
+  ///
+  /// With use_threads, data blocks are parsed concurrently.  If input is also
+  /// a RandomAccessFile and newlines_in_values is false, the file is read as
+  /// independent ranges of block_size bytes, so that both reading and parsing
+  /// a single file scale across threads.
   // XXX pass optional schema?
   static Status Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
                      const ReadOptions&, const ParseOptions&, const ConvertOptions&,
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A reader yielding the CSV data as a stream of record batches
+///
+/// Data blocks are parsed and converted by windows of one block per CPU
+/// thread (a single block without use_threads), each block yielding one
+/// record batch, so that memory use is bounded by a few blocks rather than
+/// by the size of the input.  The column types not given in ConvertOptions
+/// are inferred from the first window of blocks, read by Make(); later
+/// values that do not convert to those types are an error.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// \brief Create a streaming reader of the CSV data from the current
+  /// position of input
+  ///
+  /// The header and the first window of blocks are read before returning,
+  /// to determine the schema.
+  static Status Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                     const ReadOptions&, const ParseOptions&, const ConvertOptions&,
+                     std::shared_ptr<StreamingReader>* out);
+};
+
+/// \brief A reader of several CSV inputs with the same columns
+///
+/// The column types not given in ConvertOptions are inferred once, from
+/// the first input having data rows, which Make() reads entirely.  The
+/// other inputs are then read and converted to those types concurrently on
+/// the CPU thread pool, one input per task (serially without use_threads),
+/// which suits many small files better than a parallel TableReader on each.  Columns are
+/// matched by name: a later input lacking a column is an error, and its
+/// extra columns are ignored.  Data is returned in the order of the inputs.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class ARROW_EXPORT MultiSourceReader : public RecordBatchReader {
+ public:
+  virtual ~MultiSourceReader() = default;
+
+  /// \brief Read the remaining data as a single table, with one or more
+  /// chunks per input
+  virtual Status Read(std::shared_ptr<Table>* out) = 0;
+
+  /// \brief Create a reader of the CSV data from the current position of
+  /// each input
+  static Status Make(MemoryPool* pool,
+                     const std::vector<std::shared_ptr<io::InputStream>>& inputs,
+                     const ReadOptions&, const ParseOptions&, const ConvertOptions&,
+                     std::shared_ptr<MultiSourceReader>* out);
+};
+
 }  // namespace csv
 }  // namespace arrow
 
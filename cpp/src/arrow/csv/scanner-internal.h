@@ -0,0 +1,192 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Vectorized lookup of special characters in CSV data, shared by the parser
+// and the chunker
+
+#ifndef ARROW_CSV_SCANNER_INTERNAL_H
+#define ARROW_CSV_SCANNER_INTERNAL_H
+
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/csv/options.h"
+#include "arrow/util/logging.h"  // IWYU pragma: keep
+#include "arrow/util/macros.h"
+#include "arrow/util/sse-util.h"
+
+#if defined(ARROW_USE_SIMD) && defined(__aarch64__)
+#define ARROW_CSV_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace arrow {
+namespace csv {
+
+// A helper class locating the characters which need special handling when
+// parsing or chunking CSV data, 64 bytes at a time where SIMD is available.
+// Two bitmasks are computed for each 64-byte window of input: the characters
+// ending a run inside a non-quoted field (delimiter, escape and newline
+// characters) and those ending a run inside a quoted field (quote and escape
+// characters).  The quoting state itself is tracked by the caller.
+//
+// Data at the end of the block that does not fill a whole window is left to
+// the scalar state machines.
+class SpecialCharScanner {
+ public:
+  explicit SpecialCharScanner(const ParseOptions& options) {
+    // Without escaping (resp. quoting), the delimiter stands in for the escape
+    // (resp. quote) character
+    const char escape_char = options.escaping ? options.escape_char : options.delimiter;
+    const char quote_char = options.quoting ? options.quote_char : options.delimiter;
+#if defined(ARROW_HAVE_SSE2)
+    delimiter_ = _mm_set1_epi8(options.delimiter);
+    escape_ = _mm_set1_epi8(escape_char);
+    quote_ = _mm_set1_epi8(quote_char);
+    cr_ = _mm_set1_epi8('\r');
+    lf_ = _mm_set1_epi8('\n');
+#elif defined(ARROW_CSV_HAVE_NEON)
+    delimiter_ = vdupq_n_u8(static_cast<uint8_t>(options.delimiter));
+    escape_ = vdupq_n_u8(static_cast<uint8_t>(escape_char));
+    quote_ = vdupq_n_u8(static_cast<uint8_t>(quote_char));
+    cr_ = vdupq_n_u8('\r');
+    lf_ = vdupq_n_u8('\n');
+#else
+    ARROW_UNUSED(escape_char);
+    ARROW_UNUSED(quote_char);
+#endif
+  }
+
+  // Return the number of characters at data before the next special
+  // character of a non-quoted field (or some smaller number)
+  int64_t UnquotedRunLength(const char* data, const char* data_end) {
+    return RunLength<false>(data, data_end);
+  }
+
+  // Return the number of characters at data before the next special
+  // character of a quoted field (or some smaller number)
+  int64_t QuotedRunLength(const char* data, const char* data_end) {
+    return RunLength<true>(data, data_end);
+  }
+
+  // Copy nchars characters from data to out, possibly writing up to
+  // kCopyPadding bytes past the end of out
+  static void CopyRun(uint8_t* out, const char* data, int64_t nchars) {
+#if defined(ARROW_HAVE_SSE2)
+    for (int64_t i = 0; i < nchars; i += 16) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i),
+                       _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+    }
+#elif defined(ARROW_CSV_HAVE_NEON)
+    for (int64_t i = 0; i < nchars; i += 16) {
+      vst1q_u8(out + i, vld1q_u8(reinterpret_cast<const uint8_t*>(data + i)));
+    }
+#else
+    std::memcpy(out, data, nchars);
+#endif
+  }
+
+  static constexpr int64_t kCopyPadding = 16;
+
+ protected:
+  template <bool Quoted>
+  int64_t RunLength(const char* data, const char* data_end) {
+#if defined(ARROW_HAVE_SSE2) || defined(ARROW_CSV_HAVE_NEON)
+    // The parser only moves forward, so that the window never lies past data
+    const char* start = data;
+    while (true) {
+      if (data >= window_end_) {
+        if (data_end - data < 64) {
+          return data - start;
+        }
+        ComputeMasks(data);
+      }
+      const int shift = static_cast<int>(data - (window_end_ - 64));
+      const uint64_t mask = (Quoted ? quoted_mask_ : unquoted_mask_) >> shift;
+      if (mask != 0) {
+        return data - start + __builtin_ctzll(mask);
+      }
+      data = window_end_;
+    }
+#else
+    ARROW_UNUSED(data);
+    ARROW_UNUSED(data_end);
+    return 0;
+#endif
+  }
+
+#if defined(ARROW_HAVE_SSE2)
+  void ComputeMasks(const char* data) {
+    unquoted_mask_ = 0;
+    quoted_mask_ = 0;
+    for (int i = 0; i < 4; ++i) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * i));
+      const __m128i escape = _mm_cmpeq_epi8(v, escape_);
+      const __m128i unquoted = _mm_or_si128(
+          _mm_or_si128(_mm_cmpeq_epi8(v, delimiter_), escape),
+          _mm_or_si128(_mm_cmpeq_epi8(v, cr_), _mm_cmpeq_epi8(v, lf_)));
+      const __m128i quoted = _mm_or_si128(_mm_cmpeq_epi8(v, quote_), escape);
+      unquoted_mask_ |= static_cast<uint64_t>(_mm_movemask_epi8(unquoted) & 0xffff)
+                        << (16 * i);
+      quoted_mask_ |= static_cast<uint64_t>(_mm_movemask_epi8(quoted) & 0xffff)
+                      << (16 * i);
+    }
+    window_end_ = data + 64;
+  }
+
+  __m128i delimiter_, escape_, quote_, cr_, lf_;
+#elif defined(ARROW_CSV_HAVE_NEON)
+  // Gather the top bits of four comparison results into a 64-bit mask
+  static uint64_t MoveMask(uint8x16_t m0, uint8x16_t m1, uint8x16_t m2,
+                           uint8x16_t m3) {
+    const uint8x16_t bits = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+                             0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+    uint8x16_t sum0 = vpaddq_u8(vandq_u8(m0, bits), vandq_u8(m1, bits));
+    uint8x16_t sum1 = vpaddq_u8(vandq_u8(m2, bits), vandq_u8(m3, bits));
+    sum0 = vpaddq_u8(sum0, sum1);
+    sum0 = vpaddq_u8(sum0, sum0);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+  }
+
+  void ComputeMasks(const char* data) {
+    uint8x16_t unquoted[4];
+    uint8x16_t quoted[4];
+    for (int i = 0; i < 4; ++i) {
+      const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(data + 16 * i));
+      const uint8x16_t escape = vceqq_u8(v, escape_);
+      unquoted[i] = vorrq_u8(vorrq_u8(vceqq_u8(v, delimiter_), escape),
+                             vorrq_u8(vceqq_u8(v, cr_), vceqq_u8(v, lf_)));
+      quoted[i] = vorrq_u8(vceqq_u8(v, quote_), escape);
+    }
+    unquoted_mask_ = MoveMask(unquoted[0], unquoted[1], unquoted[2], unquoted[3]);
+    quoted_mask_ = MoveMask(quoted[0], quoted[1], quoted[2], quoted[3]);
+    window_end_ = data + 64;
+  }
+
+  uint8x16_t delimiter_, escape_, quote_, cr_, lf_;
+#endif
+
+  // The current 64-byte window ends at window_end_
+  const char* window_end_ = nullptr;
+  uint64_t unquoted_mask_ = 0;
+  uint64_t quoted_mask_ = 0;
+};
+
+}  // namespace csv
+}  // namespace arrow
+
+#endif  // ARROW_CSV_SCANNER_INTERNAL_H
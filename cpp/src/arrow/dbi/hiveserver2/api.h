@@ -21,6 +21,7 @@
 #include "arrow/dbi/hiveserver2/operation.h"
 #include "arrow/dbi/hiveserver2/service.h"
 #include "arrow/dbi/hiveserver2/session.h"
+#include "arrow/dbi/hiveserver2/session-pool.h"
 #include "arrow/dbi/hiveserver2/types.h"
 #include "arrow/dbi/hiveserver2/util.h"
 
@@ -17,19 +17,25 @@
 
 #include "arrow/dbi/hiveserver2/operation.h"
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
 
 #include "arrow/dbi/hiveserver2/service.h"
 #include "arrow/dbi/hiveserver2/session.h"
+#include "arrow/dbi/hiveserver2/session-pool.h"
 #include "arrow/dbi/hiveserver2/thrift-internal.h"
 
+#include "arrow/array.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
 
 using std::string;
 using std::unique_ptr;
@@ -252,6 +258,41 @@ TEST_F(OperationTest, TestFetch) {
   ASSERT_OK(select_op->Close());
 }
 
+TEST_F(OperationTest, TestFetchAsRecordBatch) {
+  CreateTestTable();
+  InsertIntoTestTable(vector<int>({1, 2, 3, NULL_INT_VALUE}),
+                      vector<string>({"a", "b", "NULL", "d"}));
+
+  unique_ptr<Operation> select_op;
+  ASSERT_OK(session_->ExecuteStatement("select * from " + TEST_TBL + " order by int_col",
+                                       &select_op));
+  select_op->set_prefetch(true);
+
+  std::shared_ptr<Schema> schema;
+  ASSERT_OK(select_op->GetResultSchema(&schema));
+  ASSERT_TRUE(schema->Equals(*::arrow::schema(
+      {field(TEST_COL1, int32()), field(TEST_COL2, utf8())})));
+
+  // Fetch the results in two batches, the second one fetched in the background.
+  std::shared_ptr<RecordBatch> batch;
+  bool has_more_rows = false;
+  ASSERT_OK(select_op->FetchAsRecordBatch(2, &batch, &has_more_rows));
+  ASSERT_TRUE(has_more_rows);
+  ASSERT_TRUE(batch->schema()->Equals(*schema));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2]"), *batch->column(0));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b"])"), *batch->column(1));
+
+  ASSERT_OK(select_op->FetchAsRecordBatch(2, &batch, &has_more_rows));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[3, null]"), *batch->column(0));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"([null, "d"])"), *batch->column(1));
+
+  ASSERT_OK(select_op->FetchAsRecordBatch(2, &batch, &has_more_rows));
+  ASSERT_EQ(batch->num_rows(), 0);
+  ASSERT_FALSE(has_more_rows);
+
+  ASSERT_OK(select_op->Close());
+}
+
 TEST_F(OperationTest, TestIsNull) {
   CreateTestTable();
   // Insert some NULLs and ensure Column::IsNull() is correct.
@@ -403,6 +444,49 @@ TEST_F(SessionTest, TestSessionConfig) {
   ASSERT_OK(session_error->Close());
 }
 
+class SessionPoolTest : public HS2ClientTest {};
+
+TEST_F(SessionPoolTest, TestExecuteToReader) {
+  CreateTestTable();
+  InsertIntoTestTable(vector<int>({1, 2, 3, 4, 5, 6}),
+                      vector<string>({"a", "b", "c", "d", "e", "f"}));
+
+  HS2ClientConfig config;
+  config.SetOption("use:database", TEST_DB);
+  unique_ptr<SessionPool> pool;
+  ASSERT_OK(SessionPool::Open(hostname_, port, 0, ProtocolVersion::PROTOCOL_V7, "user",
+                              config, 2, &pool));
+  ASSERT_EQ(pool->num_sessions(), 2);
+
+  // Fetch three partitions of the table concurrently, in batches of one row.
+  vector<string> statements;
+  for (int i = 0; i < 3; ++i) {
+    statements.push_back("select * from " + TEST_TBL + " where int_col % 3 = " +
+                         std::to_string(i));
+  }
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(pool->ExecuteToReader(statements, 1, &reader));
+  ASSERT_TRUE(reader->schema()->Equals(*::arrow::schema(
+      {field(TEST_COL1, int32()), field(TEST_COL2, utf8())})));
+
+  vector<std::shared_ptr<RecordBatch>> batches;
+  ASSERT_OK(reader->ReadAll(&batches));
+  vector<std::pair<int32_t, string>> rows;
+  for (const auto& batch : batches) {
+    auto int_col = std::static_pointer_cast<Int32Array>(batch->column(0));
+    auto string_col = std::static_pointer_cast<StringArray>(batch->column(1));
+    for (int64_t i = 0; i < batch->num_rows(); ++i) {
+      rows.emplace_back(int_col->Value(i), string_col->GetString(i));
+    }
+  }
+  std::sort(rows.begin(), rows.end());
+  ASSERT_EQ(rows, (vector<std::pair<int32_t, string>>(
+                      {{1, "a"}, {2, "b"}, {3, "c"}, {4, "d"}, {5, "e"}, {6, "f"}})));
+
+  reader.reset();
+  ASSERT_OK(pool->Close());
+}
+
 TEST(ServiceTest, TestConnect) {
   // Open a connection.
   string host = GetTestHost();
@@ -17,14 +17,27 @@
 
 #include "arrow/dbi/hiveserver2/operation.h"
 
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <utility>
+
 #include "arrow/dbi/hiveserver2/thrift-internal.h"
 
 #include "arrow/dbi/hiveserver2/ImpalaService_types.h"
 #include "arrow/dbi/hiveserver2/TCLIService.h"
 
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread-pool.h"
 
 namespace hs2 = apache::hive::service::cli::thrift;
 using std::unique_ptr;
@@ -35,6 +48,240 @@ namespace hiveserver2 {
 // Max rows to fetch, if not specified.
 constexpr int kDefaultMaxRows = 1024;
 
+namespace {
+
+Status FetchResultsRPC(const std::shared_ptr<ThriftRPC>& rpc,
+                       const hs2::TFetchResultsReq& req,
+                       std::shared_ptr<hs2::TFetchResultsResp>* out) {
+  auto resp = std::make_shared<hs2::TFetchResultsResp>();
+  TRY_CLIENT_RPC_OR_RETURN(rpc, rpc->client->FetchResults(*resp, req));
+  *out = std::move(resp);
+  return Status::OK();
+}
+
+// A buffer over the values of a fetched column, keeping the fetched results alive.
+class FetchedBuffer : public Buffer {
+ public:
+  FetchedBuffer(const std::shared_ptr<hs2::TFetchResultsResp>& resp, const void* data,
+                int64_t size)
+      : Buffer(reinterpret_cast<const uint8_t*>(data), size), resp_(resp) {}
+
+ private:
+  std::shared_ptr<hs2::TFetchResultsResp> resp_;
+};
+
+std::shared_ptr<DataType> ColumnTypeToDataType(const ColumnType& type) {
+  switch (type.type_id()) {
+    case ColumnType::TypeId::BOOLEAN:
+      return boolean();
+    case ColumnType::TypeId::TINYINT:
+      return int8();
+    case ColumnType::TypeId::SMALLINT:
+      return int16();
+    case ColumnType::TypeId::INT:
+      return int32();
+    case ColumnType::TypeId::BIGINT:
+      return int64();
+    case ColumnType::TypeId::FLOAT:
+      return float32();
+    case ColumnType::TypeId::DOUBLE:
+      return float64();
+    case ColumnType::TypeId::BINARY:
+      return binary();
+    default:
+      // Other types, eg. TIMESTAMP or DECIMAL, are returned as strings.
+      return utf8();
+  }
+}
+
+// Converts the null bitmap of a fetched column, in which a set bit marks a null, to a
+// validity bitmap. The null bitmap may be short, see HUE-2722.
+Status MakeValidityBitmap(const std::string& nulls, int64_t length,
+                          std::shared_ptr<Buffer>* out, int64_t* null_count) {
+  const uint8_t* null_bits = reinterpret_cast<const uint8_t*>(nulls.data());
+  const int64_t known_length =
+      std::min(length, static_cast<int64_t>(nulls.size()) * 8);
+  *null_count = internal::CountSetBits(null_bits, 0, known_length);
+  if (*null_count == 0) {
+    *out = nullptr;
+    return Status::OK();
+  }
+  std::shared_ptr<Buffer> bitmap;
+  RETURN_NOT_OK(AllocateBuffer(BitUtil::BytesForBits(length), &bitmap));
+  std::memset(bitmap->mutable_data(), 0xFF, static_cast<size_t>(bitmap->size()));
+  internal::InvertBitmap(null_bits, 0, known_length, bitmap->mutable_data(), 0);
+  *out = std::move(bitmap);
+  return Status::OK();
+}
+
+// Makes an array over the values of a fetched column of a fixed-width type, which are
+// not copied.
+template <typename TColumnValues>
+Status MakeNumericArray(const std::shared_ptr<hs2::TFetchResultsResp>& resp,
+                        const TColumnValues& column,
+                        const std::shared_ptr<DataType>& type,
+                        std::shared_ptr<Array>* out) {
+  const int64_t length = static_cast<int64_t>(column.values.size());
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count = 0;
+  RETURN_NOT_OK(MakeValidityBitmap(column.nulls, length, &validity, &null_count));
+  const int64_t value_size = static_cast<int64_t>(sizeof(column.values[0]));
+  auto values =
+      std::make_shared<FetchedBuffer>(resp, column.values.data(), length * value_size);
+  *out = MakeArray(ArrayData::Make(type, length, {validity, values}, null_count));
+  return Status::OK();
+}
+
+Status MakeBooleanArray(const hs2::TBoolColumn& column, std::shared_ptr<Array>* out) {
+  const int64_t length = static_cast<int64_t>(column.values.size());
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count = 0;
+  RETURN_NOT_OK(MakeValidityBitmap(column.nulls, length, &validity, &null_count));
+  std::shared_ptr<Buffer> values;
+  RETURN_NOT_OK(AllocateEmptyBitmap(length, &values));
+  uint8_t* value_bits = values->mutable_data();
+  for (int64_t i = 0; i < length; ++i) {
+    if (column.values[i]) {
+      BitUtil::SetBit(value_bits, i);
+    }
+  }
+  *out = MakeArray(ArrayData::Make(boolean(), length, {validity, values}, null_count));
+  return Status::OK();
+}
+
+// FLOAT columns are fetched as doubles.
+Status MakeFloatArray(const hs2::TDoubleColumn& column, std::shared_ptr<Array>* out) {
+  const int64_t length = static_cast<int64_t>(column.values.size());
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count = 0;
+  RETURN_NOT_OK(MakeValidityBitmap(column.nulls, length, &validity, &null_count));
+  std::shared_ptr<Buffer> values;
+  RETURN_NOT_OK(AllocateBuffer(length * static_cast<int64_t>(sizeof(float)), &values));
+  float* data = reinterpret_cast<float*>(values->mutable_data());
+  for (int64_t i = 0; i < length; ++i) {
+    data[i] = static_cast<float>(column.values[i]);
+  }
+  *out = MakeArray(ArrayData::Make(float32(), length, {validity, values}, null_count));
+  return Status::OK();
+}
+
+template <typename TColumnValues>
+Status MakeBinaryArray(const TColumnValues& column, const std::shared_ptr<DataType>& type,
+                       std::shared_ptr<Array>* out) {
+  const int64_t length = static_cast<int64_t>(column.values.size());
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count = 0;
+  RETURN_NOT_OK(MakeValidityBitmap(column.nulls, length, &validity, &null_count));
+
+  int64_t data_size = 0;
+  for (const std::string& value : column.values) {
+    data_size += static_cast<int64_t>(value.size());
+  }
+  if (data_size > std::numeric_limits<int32_t>::max()) {
+    return Status::CapacityError("Fetched column of ", data_size,
+                                 " bytes is too large for a binary array");
+  }
+
+  std::shared_ptr<Buffer> offsets;
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(AllocateBuffer((length + 1) * static_cast<int64_t>(sizeof(int32_t)),
+                               &offsets));
+  RETURN_NOT_OK(AllocateBuffer(data_size, &data));
+  int32_t* offset = reinterpret_cast<int32_t*>(offsets->mutable_data());
+  uint8_t* position = data->mutable_data();
+  offset[0] = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    const std::string& value = column.values[i];
+    std::memcpy(position, value.data(), value.size());
+    position += value.size();
+    offset[i + 1] = offset[i] + static_cast<int32_t>(value.size());
+  }
+  *out = MakeArray(ArrayData::Make(type, length, {validity, offsets, data}, null_count));
+  return Status::OK();
+}
+
+Status ColumnToArray(const std::shared_ptr<hs2::TFetchResultsResp>& resp,
+                     const hs2::TColumn& column, const std::shared_ptr<DataType>& type,
+                     std::shared_ptr<Array>* out) {
+  switch (type->id()) {
+    case Type::BOOL:
+      if (column.__isset.boolVal) return MakeBooleanArray(column.boolVal, out);
+      break;
+    case Type::INT8:
+      if (column.__isset.byteVal) {
+        return MakeNumericArray(resp, column.byteVal, type, out);
+      }
+      break;
+    case Type::INT16:
+      if (column.__isset.i16Val) return MakeNumericArray(resp, column.i16Val, type, out);
+      break;
+    case Type::INT32:
+      if (column.__isset.i32Val) return MakeNumericArray(resp, column.i32Val, type, out);
+      break;
+    case Type::INT64:
+      if (column.__isset.i64Val) return MakeNumericArray(resp, column.i64Val, type, out);
+      break;
+    case Type::FLOAT:
+      if (column.__isset.doubleVal) return MakeFloatArray(column.doubleVal, out);
+      break;
+    case Type::DOUBLE:
+      if (column.__isset.doubleVal) {
+        return MakeNumericArray(resp, column.doubleVal, type, out);
+      }
+      break;
+    case Type::BINARY:
+    case Type::STRING:
+      if (column.__isset.binaryVal) return MakeBinaryArray(column.binaryVal, type, out);
+      if (column.__isset.stringVal) return MakeBinaryArray(column.stringVal, type, out);
+      break;
+    default:
+      break;
+  }
+  return Status::IOError("Fetched column does not hold values of type ",
+                         type->ToString());
+}
+
+}  // namespace
+
+Status Operation::OperationImpl::FetchResults(const std::shared_ptr<ThriftRPC>& rpc,
+                                              int max_rows, FetchOrientation orientation,
+                                              std::shared_ptr<FetchResultsResp>* out) {
+  hs2::TFetchResultsReq req;
+  req.__set_operationHandle(handle);
+  req.__set_orientation(FetchOrientationToTFetchOrientation(orientation));
+  req.__set_maxRows(max_rows);
+
+  std::shared_ptr<FetchResultsResp> resp;
+  if (has_prefetched && orientation == FetchOrientation::NEXT) {
+    has_prefetched = false;
+    RETURN_NOT_OK(prefetched.Get(&resp));
+  } else {
+    DiscardPrefetched();
+    RETURN_NOT_OK(FetchResultsRPC(rpc, req, &resp));
+  }
+  THRIFT_RETURN_NOT_OK(resp->status);
+
+  // A fetch from a thread of the IO pool could wait for a prefetch queued behind it.
+  internal::ThreadPool* pool = internal::GetIOThreadPool();
+  if (prefetch && orientation == FetchOrientation::NEXT && resp->hasMoreRows &&
+      !pool->OwnsThisThread()) {
+    prefetched = pool->SubmitAsync<std::shared_ptr<FetchResultsResp>>(
+        [rpc, req](std::shared_ptr<FetchResultsResp>* out) {
+          return FetchResultsRPC(rpc, req, out);
+        });
+    has_prefetched = true;
+  }
+  *out = std::move(resp);
+  return Status::OK();
+}
+
+void Operation::OperationImpl::DiscardPrefetched() {
+  if (has_prefetched) {
+    prefetched.Wait();
+    has_prefetched = false;
+  }
+}
+
 Operation::Operation(const std::shared_ptr<ThriftRPC>& rpc)
     : impl_(new OperationImpl()), rpc_(rpc), open_(false) {}
 
@@ -44,7 +291,7 @@ Status Operation::GetState(Operation::State* out) const {
   hs2::TGetOperationStatusReq req;
   req.__set_operationHandle(impl_->handle);
   hs2::TGetOperationStatusResp resp;
-  TRY_RPC_OR_RETURN(rpc_->client->GetOperationStatus(resp, req));
+  TRY_CLIENT_RPC_OR_RETURN(rpc_, rpc_->client->GetOperationStatus(resp, req));
   THRIFT_RETURN_NOT_OK(resp.status);
   *out = TOperationStateToOperationState(resp.operationState);
   return TStatusToStatus(resp.status);
@@ -54,7 +301,7 @@ Status Operation::GetLog(std::string* out) const {
   hs2::TGetLogReq req;
   req.__set_operationHandle(impl_->handle);
   hs2::TGetLogResp resp;
-  TRY_RPC_OR_RETURN(rpc_->client->GetLog(resp, req));
+  TRY_CLIENT_RPC_OR_RETURN(rpc_, rpc_->client->GetLog(resp, req));
   THRIFT_RETURN_NOT_OK(resp.status);
   *out = resp.log;
   return TStatusToStatus(resp.status);
@@ -65,7 +312,7 @@ Status Operation::GetProfile(std::string* out) const {
   req.__set_operationHandle(impl_->handle);
   req.__set_sessionHandle(impl_->session_handle);
   impala::TGetRuntimeProfileResp resp;
-  TRY_RPC_OR_RETURN(rpc_->client->GetRuntimeProfile(resp, req));
+  TRY_CLIENT_RPC_OR_RETURN(rpc_, rpc_->client->GetRuntimeProfile(resp, req));
   THRIFT_RETURN_NOT_OK(resp.status);
   *out = resp.profile;
   return TStatusToStatus(resp.status);
@@ -75,7 +322,7 @@ Status Operation::GetResultSetMetadata(std::vector<ColumnDesc>* column_descs) co
   hs2::TGetResultSetMetadataReq req;
   req.__set_operationHandle(impl_->handle);
   hs2::TGetResultSetMetadataResp resp;
-  TRY_RPC_OR_RETURN(rpc_->client->GetResultSetMetadata(resp, req));
+  TRY_CLIENT_RPC_OR_RETURN(rpc_, rpc_->client->GetResultSetMetadata(resp, req));
   THRIFT_RETURN_NOT_OK(resp.status);
 
   column_descs->clear();
@@ -95,14 +342,11 @@ Status Operation::Fetch(unique_ptr<ColumnarRowSet>* results, bool* has_more_rows
 
 Status Operation::Fetch(int max_rows, FetchOrientation orientation,
                         unique_ptr<ColumnarRowSet>* results, bool* has_more_rows) const {
-  hs2::TFetchResultsReq req;
-  req.__set_operationHandle(impl_->handle);
-  req.__set_orientation(FetchOrientationToTFetchOrientation(orientation));
-  req.__set_maxRows(max_rows);
+  std::shared_ptr<hs2::TFetchResultsResp> resp;
+  RETURN_NOT_OK(impl_->FetchResults(rpc_, max_rows, orientation, &resp));
   std::unique_ptr<ColumnarRowSet::ColumnarRowSetImpl> row_set_impl(
       new ColumnarRowSet::ColumnarRowSetImpl());
-  TRY_RPC_OR_RETURN(rpc_->client->FetchResults(row_set_impl->resp, req));
-  THRIFT_RETURN_NOT_OK(row_set_impl->resp.status);
+  swap(row_set_impl->resp, *resp);
 
   if (has_more_rows != NULL) {
     *has_more_rows = row_set_impl->resp.hasMoreRows;
@@ -113,21 +357,85 @@ Status Operation::Fetch(int max_rows, FetchOrientation orientation,
   return status;
 }
 
+Status Operation::FetchAsRecordBatch(std::shared_ptr<RecordBatch>* out,
+                                     bool* has_more_rows) const {
+  return FetchAsRecordBatch(kDefaultMaxRows, out, has_more_rows);
+}
+
+Status Operation::FetchAsRecordBatch(int max_rows, std::shared_ptr<RecordBatch>* out,
+                                     bool* has_more_rows) const {
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(GetResultSchema(&schema));
+  std::shared_ptr<hs2::TFetchResultsResp> resp;
+  RETURN_NOT_OK(impl_->FetchResults(rpc_, max_rows, FetchOrientation::NEXT, &resp));
+
+  const std::vector<hs2::TColumn>& columns = resp->results.columns;
+  std::vector<std::shared_ptr<Array>> arrays(schema->num_fields());
+  int64_t num_rows = 0;
+  if (columns.empty()) {
+    // No rows were fetched.
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      std::unique_ptr<ArrayBuilder> builder;
+      RETURN_NOT_OK(
+          MakeBuilder(default_memory_pool(), schema->field(i)->type(), &builder));
+      RETURN_NOT_OK(builder->Finish(&arrays[i]));
+    }
+  } else if (static_cast<int>(columns.size()) != schema->num_fields()) {
+    return Status::IOError("Fetched ", columns.size(), " columns, expected ",
+                           schema->num_fields());
+  }
+  for (size_t i = 0; i < columns.size(); ++i) {
+    const std::shared_ptr<DataType>& type = schema->field(static_cast<int>(i))->type();
+    RETURN_NOT_OK(ColumnToArray(resp, columns[i], type, &arrays[i]));
+    if (i == 0) {
+      num_rows = arrays[i]->length();
+    } else if (arrays[i]->length() != num_rows) {
+      return Status::IOError("Fetched columns have different lengths");
+    }
+  }
+
+  if (has_more_rows != NULLPTR) {
+    *has_more_rows = resp->hasMoreRows;
+  }
+  *out = RecordBatch::Make(schema, num_rows, std::move(arrays));
+  return Status::OK();
+}
+
+Status Operation::GetResultSchema(std::shared_ptr<Schema>* out) const {
+  if (impl_->schema == NULLPTR) {
+    std::vector<ColumnDesc> column_descs;
+    RETURN_NOT_OK(GetResultSetMetadata(&column_descs));
+    std::vector<std::shared_ptr<Field>> fields;
+    fields.reserve(column_descs.size());
+    for (const ColumnDesc& column_desc : column_descs) {
+      fields.push_back(
+          field(column_desc.column_name(), ColumnTypeToDataType(*column_desc.type())));
+    }
+    impl_->schema = ::arrow::schema(std::move(fields));
+  }
+  *out = impl_->schema;
+  return Status::OK();
+}
+
+void Operation::set_prefetch(bool prefetch) { impl_->prefetch = prefetch; }
+
 Status Operation::Cancel() const {
   hs2::TCancelOperationReq req;
   req.__set_operationHandle(impl_->handle);
   hs2::TCancelOperationResp resp;
-  TRY_RPC_OR_RETURN(rpc_->client->CancelOperation(resp, req));
+  TRY_CLIENT_RPC_OR_RETURN(rpc_, rpc_->client->CancelOperation(resp, req));
   return TStatusToStatus(resp.status);
 }
 
 Status Operation::Close() {
   if (!open_) return Status::OK();
 
+  impl_->DiscardPrefetched();
+
   hs2::TCloseOperationReq req;
   req.__set_operationHandle(impl_->handle);
   hs2::TCloseOperationResp resp;
-  TRY_RPC_OR_RETURN(rpc_->client->CloseOperation(resp, req));
+  TRY_CLIENT_RPC_OR_RETURN(rpc_, rpc_->client->CloseOperation(resp, req));
   THRIFT_RETURN_NOT_OK(resp.status);
 
   open_ = false;
@@ -29,6 +29,8 @@
 
 namespace arrow {
 
+class RecordBatch;
+class Schema;
 class Status;
 
 namespace hiveserver2 {
@@ -91,6 +93,25 @@ class ARROW_EXPORT Operation {
   Status Fetch(int max_rows, FetchOrientation orientation,
                std::unique_ptr<ColumnarRowSet>* results, bool* has_more_rows) const;
 
+  // Fetches the next batch of results as an Arrow record batch, and sets has_more_rows.
+  // The Thrift columns are decoded directly into Arrow arrays, without copying the
+  // values of numeric columns other than FLOAT. Columns that HiveServer2 returns as
+  // strings, such as TIMESTAMP or DECIMAL, become utf8 arrays. Blocks like Fetch.
+  Status FetchAsRecordBatch(std::shared_ptr<RecordBatch>* out,
+                            bool* has_more_rows) const;
+  Status FetchAsRecordBatch(int max_rows, std::shared_ptr<RecordBatch>* out,
+                            bool* has_more_rows) const;
+
+  // Fetches the schema of the record batches returned by FetchAsRecordBatch. May be
+  // called after successfully creating the operation and before calling Close.
+  Status GetResultSchema(std::shared_ptr<Schema>* out) const;
+
+  // If enabled, whenever a fetch of the NEXT rows returns with more rows to come, the
+  // following batch is fetched in the background with the same max_rows, and returned
+  // by the next fetch of the NEXT rows. This overlaps the consumption of each batch
+  // with the round trip for the next one. Disabled by default.
+  void set_prefetch(bool prefetch);
+
   // May be called after successfully creating the operation and before calling Close.
   Status Cancel() const;
 
@@ -0,0 +1,286 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dbi/hiveserver2/session-pool.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace hiveserver2 {
+
+namespace {
+
+// The number of fetched batches per session kept waiting to be read.
+constexpr size_t kQueuedBatchesPerSession = 2;
+
+// Executes statements on several sessions, with a worker thread per session, and
+// queues the fetched batches for reading.
+class ParallelFetchReader : public RecordBatchReader {
+ public:
+  ParallelFetchReader(const std::vector<std::string>& statements, int max_rows,
+                      const std::shared_ptr<Schema>& schema)
+      : statements_(statements),
+        max_rows_(max_rows),
+        schema_(schema),
+        next_statement_(0),
+        num_running_(0),
+        max_queued_(0),
+        stopping_(false) {}
+
+  ~ParallelFetchReader() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+      not_full_.notify_all();
+    }
+    if (workers_) {
+      // Wait for the workers to close their operations.
+      DCHECK_OK(workers_->Shutdown());
+    }
+    if (first_op_) {
+      DCHECK_OK(first_op_->Close());
+    }
+  }
+
+  // Starts fetching with the sessions. The first statement was already executed on the
+  // first session, as first_op.
+  Status Start(const std::vector<Session*>& sessions,
+               std::unique_ptr<Operation> first_op) {
+    first_op_ = std::move(first_op);
+    next_statement_ = 1;
+    max_queued_ = kQueuedBatchesPerSession * sessions.size();
+    RETURN_NOT_OK(
+        internal::ThreadPool::Make(static_cast<int>(sessions.size()), &workers_));
+    for (Session* session : sessions) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++num_running_;
+      }
+      Status st = workers_->Spawn([this, session] { FinishWorker(Fetch(session)); });
+      if (!st.ok()) {
+        FinishWorker(st);
+        return st;
+      }
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] {
+      return !batches_.empty() || !status_.ok() || num_running_ == 0;
+    });
+    RETURN_NOT_OK(status_);
+    if (batches_.empty()) {
+      *batch = nullptr;
+      return Status::OK();
+    }
+    *batch = std::move(batches_.front());
+    batches_.pop_front();
+    not_full_.notify_one();
+    return Status::OK();
+  }
+
+ private:
+  // Takes the next statement to execute, or the operation of the first one, or returns
+  // false if there are none left or the reader is stopping.
+  bool TakeStatement(std::unique_ptr<Operation>* first_op,
+                     const std::string** statement) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stopping_) {
+      return false;
+    }
+    if (first_op_) {
+      *first_op = std::move(first_op_);
+      return true;
+    }
+    if (next_statement_ == statements_.size()) {
+      return false;
+    }
+    *statement = &statements_[next_statement_++];
+    return true;
+  }
+
+  // Executes statements on a session until there are none left.
+  Status Fetch(Session* session) {
+    std::unique_ptr<Operation> op;
+    const std::string* statement = nullptr;
+    while (TakeStatement(&op, &statement)) {
+      if (op == nullptr) {
+        RETURN_NOT_OK(session->ExecuteStatement(*statement, &op));
+      }
+      Status st = FetchResults(op.get());
+      Status close_st = op->Close();
+      op.reset();
+      RETURN_NOT_OK(st);
+      RETURN_NOT_OK(close_st);
+    }
+    return Status::OK();
+  }
+
+  Status FetchResults(Operation* op) {
+    std::shared_ptr<Schema> schema;
+    RETURN_NOT_OK(op->GetResultSchema(&schema));
+    if (!schema->Equals(*schema_)) {
+      return Status::Invalid("Statement results have schema ", schema->ToString(),
+                             ", expected ", schema_->ToString());
+    }
+    op->set_prefetch(true);
+    bool has_more_rows = true;
+    while (has_more_rows) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(op->FetchAsRecordBatch(max_rows_, &batch, &has_more_rows));
+      if (batch->num_rows() > 0 && !Push(std::move(batch))) {
+        // The reader is stopping
+        break;
+      }
+    }
+    return Status::OK();
+  }
+
+  // Queues a batch, blocking while the queue is full. Returns false if the reader is
+  // stopping.
+  bool Push(std::shared_ptr<RecordBatch> batch) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [this] { return stopping_ || batches_.size() < max_queued_; });
+    if (stopping_) {
+      return false;
+    }
+    batches_.push_back(std::move(batch));
+    not_empty_.notify_one();
+    return true;
+  }
+
+  void FinishWorker(const Status& st) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!st.ok() && status_.ok()) {
+      status_ = st;
+      // Stop the other workers
+      stopping_ = true;
+      not_full_.notify_all();
+    }
+    --num_running_;
+    not_empty_.notify_all();
+  }
+
+  const std::vector<std::string> statements_;
+  const int max_rows_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<internal::ThreadPool> workers_;
+
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  // The following members are guarded by mutex_
+  std::unique_ptr<Operation> first_op_;
+  size_t next_statement_;
+  int num_running_;
+  std::deque<std::shared_ptr<RecordBatch>> batches_;
+  size_t max_queued_;
+  bool stopping_;
+  // The first error of the workers
+  Status status_;
+};
+
+}  // namespace
+
+Status SessionPool::Open(const std::string& host, int port, int conn_timeout,
+                         ProtocolVersion protocol_version, const std::string& user,
+                         const HS2ClientConfig& config, int num_sessions,
+                         std::unique_ptr<SessionPool>* pool) {
+  if (num_sessions < 1) {
+    return Status::Invalid("A session pool needs at least one session");
+  }
+  std::unique_ptr<SessionPool> result(new SessionPool());
+  for (int i = 0; i < num_sessions; ++i) {
+    std::unique_ptr<Service> service;
+    std::unique_ptr<Session> session;
+    Status st = Service::Connect(host, port, conn_timeout, protocol_version, &service);
+    if (st.ok()) {
+      st = service->OpenSession(user, config, &session);
+    }
+    result->services_.push_back(std::move(service));
+    result->sessions_.push_back(std::move(session));
+    if (!st.ok()) {
+      // Close the connections opened so far
+      ARROW_UNUSED(result->Close());
+      return st;
+    }
+  }
+  *pool = std::move(result);
+  return Status::OK();
+}
+
+SessionPool::~SessionPool() = default;
+
+Status SessionPool::Close() {
+  Status st;
+  for (const std::unique_ptr<Session>& session : sessions_) {
+    if (session) {
+      Status close_st = session->Close();
+      if (st.ok()) st = close_st;
+    }
+  }
+  for (const std::unique_ptr<Service>& service : services_) {
+    if (service) {
+      Status close_st = service->Close();
+      if (st.ok()) st = close_st;
+    }
+  }
+  return st;
+}
+
+Status SessionPool::ExecuteToReader(const std::vector<std::string>& statements,
+                                    int max_rows,
+                                    std::shared_ptr<RecordBatchReader>* out) {
+  if (statements.empty()) {
+    return Status::Invalid("No statements to execute");
+  }
+  // Execute the first statement to get the schema of the results
+  std::unique_ptr<Operation> first_op;
+  RETURN_NOT_OK(sessions_[0]->ExecuteStatement(statements[0], &first_op));
+  std::shared_ptr<Schema> schema;
+  Status st = first_op->GetResultSchema(&schema);
+  if (!st.ok()) {
+    ARROW_UNUSED(first_op->Close());
+    return st;
+  }
+
+  std::vector<Session*> sessions;
+  for (size_t i = 0; i < sessions_.size() && i < statements.size(); ++i) {
+    sessions.push_back(sessions_[i].get());
+  }
+  std::shared_ptr<ParallelFetchReader> reader =
+      std::make_shared<ParallelFetchReader>(statements, max_rows, schema);
+  RETURN_NOT_OK(reader->Start(sessions, std::move(first_op)));
+  *out = std::move(reader);
+  return Status::OK();
+}
+
+}  // namespace hiveserver2
+}  // namespace arrow
@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/dbi/hiveserver2/service.h"
+#include "arrow/dbi/hiveserver2/session.h"
+
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class RecordBatchReader;
+class Status;
+
+namespace hiveserver2 {
+
+// Manages a set of HiveServer2 sessions, each on a connection of its own, to execute
+// several statements concurrently - eg. queries over disjoint partitions of a table -
+// and fetch their results in parallel, so that large result sets aren't limited by the
+// latency of a single connection.
+//
+// SessionPools are created using SessionPool::Open(). They must have Close called on
+// them before they can be deleted.
+//
+// This class is not thread-safe.
+//
+// Example:
+// unique_ptr<SessionPool> pool;
+// SessionPool::Open(host, port, 0, ProtocolVersion::PROTOCOL_V7, user, config, 4,
+//                   &pool);
+// shared_ptr<RecordBatchReader> reader;
+// pool->ExecuteToReader({"select * from tbl where part = 1",
+//                        "select * from tbl where part = 2"}, 1024, &reader);
+// shared_ptr<Table> table;
+// reader->ReadAll(&table);
+// reader.reset();
+// pool->Close();
+class ARROW_EXPORT SessionPool {
+ public:
+  // Connects num_sessions times to the HS2 service at the given host and port, and opens
+  // a session with each connection. See Service::Connect and Service::OpenSession for
+  // the other parameters.
+  static Status Open(const std::string& host, int port, int conn_timeout,
+                     ProtocolVersion protocol_version, const std::string& user,
+                     const HS2ClientConfig& config, int num_sessions,
+                     std::unique_ptr<SessionPool>* pool);
+
+  ~SessionPool();
+
+  // Closes the sessions and their connections. Must be called before the pool is
+  // deleted. May be safely called on an already closed pool.
+  Status Close();
+
+  int num_sessions() const { return static_cast<int>(sessions_.size()); }
+
+  // Executes the statements, which must return results of the same schema, spread over
+  // the sessions of the pool, and returns their results as a single stream of record
+  // batches, each fetched by Operation::FetchAsRecordBatch with max_rows. Each session
+  // executes one statement at a time and fetches all its results, prefetching the next
+  // batch, before taking the next statement. The batches of different statements are
+  // interleaved in the order they are fetched, and a few of them are fetched ahead of
+  // the reader.
+  //
+  // The pool must not be used otherwise, nor closed, until the reader is deleted.
+  // Deleting the reader before its end stops the fetches and closes the operations.
+  Status ExecuteToReader(const std::vector<std::string>& statements, int max_rows,
+                         std::shared_ptr<RecordBatchReader>* out);
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(SessionPool);
+
+  SessionPool() = default;
+
+  std::vector<std::unique_ptr<Service>> services_;
+  std::vector<std::unique_ptr<Session>> sessions_;
+};
+
+}  // namespace hiveserver2
+}  // namespace arrow
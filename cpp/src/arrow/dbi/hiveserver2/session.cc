@@ -46,7 +46,7 @@ Status Session::Close() {
   hs2::TCloseSessionReq req;
   req.__set_sessionHandle(impl_->handle);
   hs2::TCloseSessionResp resp;
-  TRY_RPC_OR_RETURN(rpc_->client->CloseSession(resp, req));
+  TRY_CLIENT_RPC_OR_RETURN(rpc_, rpc_->client->CloseSession(resp, req));
   THRIFT_RETURN_NOT_OK(resp.status);
 
   open_ = false;
@@ -58,7 +58,7 @@ Status Session::Open(const HS2ClientConfig& config, const string& user) {
   req.__set_configuration(config.GetConfig());
   req.__set_username(user);
   hs2::TOpenSessionResp resp;
-  TRY_RPC_OR_RETURN(rpc_->client->OpenSession(resp, req));
+  TRY_CLIENT_RPC_OR_RETURN(rpc_, rpc_->client->OpenSession(resp, req));
   THRIFT_RETURN_NOT_OK(resp.status);
 
   impl_->handle = resp.sessionHandle;
@@ -78,7 +78,7 @@ class ExecuteStatementOperation : public Operation {
     req.__set_statement(statement);
     req.__set_confOverlay(config.GetConfig());
     hs2::TExecuteStatementResp resp;
-    TRY_RPC_OR_RETURN(rpc_->client->ExecuteStatement(resp, req));
+    TRY_CLIENT_RPC_OR_RETURN(rpc_, rpc_->client->ExecuteStatement(resp, req));
     THRIFT_RETURN_NOT_OK(resp.status);
 
     impl_->handle = resp.operationHandle;
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "arrow/dbi/hiveserver2/columnar-row-set.h"
@@ -28,6 +29,8 @@
 #include "arrow/dbi/hiveserver2/ImpalaHiveServer2Service.h"
 #include "arrow/dbi/hiveserver2/TCLIService.h"
 
+#include "arrow/util/future.h"
+
 namespace arrow {
 namespace hiveserver2 {
 
@@ -37,12 +40,36 @@ struct ColumnarRowSet::ColumnarRowSetImpl {
 };
 
 struct Operation::OperationImpl {
+  using FetchResultsResp = apache::hive::service::cli::thrift::TFetchResultsResp;
+
   apache::hive::service::cli::thrift::TOperationHandle handle;
   apache::hive::service::cli::thrift::TSessionHandle session_handle;
+
+  // The schema of the results, cached by Operation::GetResultSchema.
+  std::shared_ptr<Schema> schema;
+
+  // Whether to fetch the next rows in the background, see Operation::set_prefetch.
+  bool prefetch = false;
+  // The background fetch of the next rows, valid if has_prefetched.
+  bool has_prefetched = false;
+  Future<std::shared_ptr<FetchResultsResp>> prefetched;
+
+  // Fetches a batch of results, taking it from the background fetch for a fetch of the
+  // NEXT rows, and starts the background fetch of the following batch if prefetch is
+  // enabled.
+  Status FetchResults(const std::shared_ptr<ThriftRPC>& rpc, int max_rows,
+                      FetchOrientation orientation,
+                      std::shared_ptr<FetchResultsResp>* out);
+
+  // Waits for the background fetch if any, discarding its results.
+  void DiscardPrefetched();
 };
 
 struct ThriftRPC {
   std::unique_ptr<impala::ImpalaHiveServer2ServiceClient> client;
+  // Serializes the RPCs of client, which the background fetches of an Operation issue
+  // concurrently with the caller's.
+  std::mutex mutex;
 };
 
 const std::string OperationStateToString(const Operation::State& state);
@@ -82,6 +109,13 @@ ColumnType::TypeId TTypeIdToTypeId(
     }                                           \
   } while (0)
 
+// Like TRY_RPC_OR_RETURN, for an RPC through the client of a ThriftRPC.
+#define TRY_CLIENT_RPC_OR_RETURN(thrift_rpc, rpc)              \
+  do {                                                         \
+    std::lock_guard<std::mutex> rpc_lock((thrift_rpc)->mutex); \
+    TRY_RPC_OR_RETURN(rpc);                                    \
+  } while (0)
+
 #define THRIFT_RETURN_NOT_OK(tstatus)                                       \
   do {                                                                      \
     if (tstatus.statusCode != hs2::TStatusCode::SUCCESS_STATUS &&           \
@@ -18,5 +18,6 @@
 #pragma once
 
 #include "arrow/flight/client.h"
+#include "arrow/flight/data-plane.h"
 #include "arrow/flight/server.h"
 #include "arrow/flight/types.h"
@@ -18,10 +18,16 @@
 #include "arrow/flight/client.h"
 #include "arrow/flight/protocol-internal.h"  // IWYU pragma: keep
 
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include <grpcpp/grpcpp.h>
 
@@ -34,6 +40,7 @@
 #include "arrow/type.h"
 #include "arrow/util/logging.h"
 
+#include "arrow/flight/data-plane.h"
 #include "arrow/flight/internal.h"
 #include "arrow/flight/serialization-internal.h"
 #include "arrow/flight/types.h"
@@ -59,11 +66,13 @@ class FlightStreamReader : public RecordBatchReader {
  public:
   FlightStreamReader(std::unique_ptr<ClientRpc> rpc,
                      const std::shared_ptr<Schema>& schema,
-                     std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream)
+                     std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream,
+                     std::unique_ptr<DataPlaneReceiver> data_plane = nullptr)
       : rpc_(std::move(rpc)),
         stream_finished_(false),
         schema_(schema),
-        stream_(std::move(stream)) {}
+        stream_(std::move(stream)),
+        data_plane_(std::move(data_plane)) {}
 
   std::shared_ptr<Schema> schema() const override { return schema_; }
 
@@ -81,6 +90,12 @@ class FlightStreamReader : public RecordBatchReader {
 
       // Validate IPC message
       RETURN_NOT_OK(ipc::Message::Open(data.metadata, data.body, &message));
+      if (data_plane_ != nullptr && data.body == nullptr && message->body_length() > 0) {
+        // The server sent the body through the data plane
+        std::shared_ptr<Buffer> body;
+        RETURN_NOT_OK(data_plane_->ReadBody(message->body_length(), &body));
+        RETURN_NOT_OK(ipc::Message::Open(data.metadata, body, &message));
+      }
       // The first message is a schema; read it and then try to read a
       // record batch.
       if (message->type() == ipc::Message::Type::SCHEMA) {
@@ -106,36 +121,253 @@ class FlightStreamReader : public RecordBatchReader {
   bool stream_finished_;
   std::shared_ptr<Schema> schema_;
   std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream_;
+  std::unique_ptr<DataPlaneReceiver> data_plane_;
+};
+
+/// \brief A RecordBatchReader that reads the streams of the endpoints of a
+/// flight on worker threads, which each take the next endpoint to read.
+class ParallelStreamReader : public RecordBatchReader {
+ public:
+  ParallelStreamReader(FlightClient* client, const std::shared_ptr<Schema>& schema,
+                       const std::vector<FlightEndpoint>& endpoints,
+                       const ParallelDoGetOptions& options)
+      : client_(client),
+        schema_(schema),
+        endpoints_(endpoints),
+        options_(options),
+        queues_(options.ordered ? endpoints.size() : 1),
+        next_endpoint_(0),
+        finished_endpoints_(0),
+        current_queue_(0),
+        closed_(false) {
+    if (endpoints_.empty()) {
+      queues_[0].finished = true;
+    }
+    const size_t num_workers = std::min(
+        endpoints_.size(), static_cast<size_t>(std::max(options_.parallelism, 1)));
+    for (size_t i = 0; i < num_workers; ++i) {
+      workers_.emplace_back([this] { ReadEndpoints(); });
+    }
+  }
+
+  ~ParallelStreamReader() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    space_ready_.notify_all();
+    // The workers stop once the batch they are reading arrives.
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      RETURN_NOT_OK(status_);
+      if (current_queue_ == queues_.size()) {
+        *out = nullptr;
+        return Status::OK();
+      }
+      Queue& queue = queues_[current_queue_];
+      if (!queue.batches.empty()) {
+        *out = std::move(queue.batches.front());
+        queue.batches.pop_front();
+        space_ready_.notify_all();
+        return Status::OK();
+      }
+      if (queue.finished) {
+        ++current_queue_;
+        continue;
+      }
+      batch_ready_.wait(lock);
+    }
+  }
+
+ private:
+  /// \brief The batches of an endpoint if ordered, or of all of them
+  struct Queue {
+    std::deque<std::shared_ptr<RecordBatch>> batches;
+    bool finished = false;
+  };
+
+  bool Stopped() const { return closed_ || !status_.ok(); }
+
+  void ReadEndpoints() {
+    while (true) {
+      size_t endpoint;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (Stopped() || next_endpoint_ == endpoints_.size()) {
+          return;
+        }
+        endpoint = next_endpoint_++;
+      }
+      Status status = ReadEndpoint(endpoint);
+      if (!status.ok()) {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (status_.ok()) {
+            status_ = status;
+          }
+        }
+        batch_ready_.notify_all();
+        space_ready_.notify_all();
+        return;
+      }
+    }
+  }
+
+  Status OpenEndpoint(const FlightEndpoint& endpoint,
+                      std::unique_ptr<FlightClient>* connection,
+                      std::unique_ptr<RecordBatchReader>* stream) {
+    if (endpoint.locations.empty()) {
+      return client_->DoGet(endpoint.ticket, schema_, options_.stream_options, stream);
+    }
+    // Try the locations in order, until one of them serves the ticket.
+    Status status;
+    for (const auto& location : endpoint.locations) {
+      status = FlightClient::Connect(location.host, location.port, connection);
+      if (status.ok()) {
+        status = (*connection)->DoGet(endpoint.ticket, schema_, options_.stream_options,
+                                      stream);
+      }
+      if (status.ok()) {
+        break;
+      }
+    }
+    return status;
+  }
+
+  Status ReadEndpoint(size_t endpoint) {
+    // The stream must be destroyed before the connection it was opened on.
+    std::unique_ptr<FlightClient> connection;
+    std::unique_ptr<RecordBatchReader> stream;
+    RETURN_NOT_OK(OpenEndpoint(endpoints_[endpoint], &connection, &stream));
+
+    Queue& queue = queues_[options_.ordered ? endpoint : 0];
+    const size_t max_buffered =
+        static_cast<size_t>(std::max(options_.max_buffered_batches, 1));
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(stream->ReadNext(&batch));
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (batch == nullptr) {
+        ++finished_endpoints_;
+        if (options_.ordered || finished_endpoints_ == endpoints_.size()) {
+          queue.finished = true;
+        }
+        lock.unlock();
+        batch_ready_.notify_all();
+        return Status::OK();
+      }
+      space_ready_.wait(
+          lock, [&] { return Stopped() || queue.batches.size() < max_buffered; });
+      if (Stopped()) {
+        return Status::OK();
+      }
+      queue.batches.push_back(std::move(batch));
+      lock.unlock();
+      batch_ready_.notify_all();
+    }
+  }
+
+  FlightClient* client_;
+  std::shared_ptr<Schema> schema_;
+  const std::vector<FlightEndpoint> endpoints_;
+  const ParallelDoGetOptions options_;
+
+  std::mutex mutex_;
+  // Notified when a batch is queued, a queue is finished, or a read failed.
+  std::condition_variable batch_ready_;
+  // Notified when a batch is consumed, or the reader stops.
+  std::condition_variable space_ready_;
+  std::vector<Queue> queues_;
+  size_t next_endpoint_;
+  size_t finished_endpoints_;
+  size_t current_queue_;
+  bool closed_;
+  // The first error of the workers.
+  Status status_;
+
+  std::vector<std::thread> workers_;
 };
 
 /// \brief A RecordBatchWriter implementation that writes to a Flight
 /// DoPut stream.
+///
+/// With a window of batches in flight, the batches are queued and a worker
+/// thread serializes and writes them, so that the producer isn't held up by
+/// the network.
 class FlightPutWriter::FlightPutWriterImpl : public ipc::RecordBatchWriter {
  public:
   explicit FlightPutWriterImpl(std::unique_ptr<ClientRpc> rpc,
                                const FlightDescriptor& descriptor,
                                const std::shared_ptr<Schema>& schema,
                                MemoryPool* pool = default_memory_pool())
-      : rpc_(std::move(rpc)), descriptor_(descriptor), schema_(schema), pool_(pool) {}
+      : rpc_(std::move(rpc)),
+        descriptor_(descriptor),
+        schema_(schema),
+        pool_(pool),
+        options_(ipc::IpcWriteOptions::Defaults()),
+        max_batches_in_flight_(0),
+        closed_(false) {}
+
+  ~FlightPutWriterImpl() override {
+    if (worker_.joinable()) {
+      // Not closed: drop the batches that weren't written
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        queue_.clear();
+        closed_ = true;
+      }
+      batch_ready_.notify_one();
+      worker_.join();
+    }
+  }
 
   Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit = false) override {
-    FlightPayload payload;
-    RETURN_NOT_OK(
-        ipc::internal::GetRecordBatchPayload(batch, pool_, &payload.ipc_message));
+    if (max_batches_in_flight_ == 0) {
+      return WriteBatch(batch);
+    }
 
-    if (!writer_->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
-                        grpc::WriteOptions())) {
-      std::stringstream ss;
-      ss << "Could not write record batch to stream: "
-         << rpc_->context.debug_error_string();
-      return Status::IOError(ss.str());
+    // Keep the columns alive until the batch is written
+    std::vector<std::shared_ptr<Array>> columns(batch.num_columns());
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      columns[i] = batch.column(i);
     }
+    auto queued = RecordBatch::Make(batch.schema(), batch.num_rows(), std::move(columns));
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    space_ready_.wait(lock, [this] {
+      return !status_.ok() ||
+             static_cast<int>(queue_.size()) < max_batches_in_flight_;
+    });
+    RETURN_NOT_OK(status_);
+    queue_.push_back(std::move(queued));
+    lock.unlock();
+    batch_ready_.notify_one();
     return Status::OK();
   }
 
   Status Close() override {
+    if (worker_.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+      }
+      batch_ready_.notify_one();
+      worker_.join();
+    }
     bool finished_writes = writer_->WritesDone();
-    RETURN_NOT_OK(internal::FromGrpcStatus(writer_->Finish()));
+    Status st = internal::FromGrpcStatus(writer_->Finish());
+    // The error of a write is more telling than that of the call
+    RETURN_NOT_OK(status_);
+    RETURN_NOT_OK(st);
     if (!finished_writes) {
       return Status::UnknownError(
           "Could not finish writing record batches before closing");
@@ -150,6 +382,49 @@ class FlightPutWriter::FlightPutWriterImpl : public ipc::RecordBatchWriter {
   /// \param [in] writer the gRPC writer
   void set_stream(std::unique_ptr<grpc::ClientWriter<pb::FlightData>> writer) {
     writer_ = std::move(writer);
+    if (max_batches_in_flight_ > 0) {
+      worker_ = std::thread([this] { WriteQueuedBatches(); });
+    }
+  }
+
+  Status WriteBatch(const RecordBatch& batch) {
+    FlightPayload payload;
+    RETURN_NOT_OK(ipc::internal::GetRecordBatchPayload(batch, options_, pool_,
+                                                       &payload.ipc_message));
+
+    if (!writer_->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
+                        grpc::WriteOptions())) {
+      std::stringstream ss;
+      ss << "Could not write record batch to stream: "
+         << rpc_->context.debug_error_string();
+      return Status::IOError(ss.str());
+    }
+    return Status::OK();
+  }
+
+  void WriteQueuedBatches() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      batch_ready_.wait(lock, [this] { return closed_ || !queue_.empty(); });
+      if (queue_.empty()) {
+        return;
+      }
+      std::shared_ptr<RecordBatch> batch = queue_.front();
+      lock.unlock();
+      Status st = WriteBatch(*batch);
+      lock.lock();
+      // Only dequeue the batch once it is written, so that at most
+      // max_batches_in_flight_ batches are held at once
+      queue_.pop_front();
+      if (!st.ok()) {
+        status_ = st;
+        queue_.clear();
+        lock.unlock();
+        space_ready_.notify_all();
+        return;
+      }
+      space_ready_.notify_all();
+    }
   }
 
   // TODO: there isn't a way to access this as a user.
@@ -159,6 +434,18 @@ class FlightPutWriter::FlightPutWriterImpl : public ipc::RecordBatchWriter {
   std::shared_ptr<Schema> schema_;
   std::unique_ptr<grpc::ClientWriter<pb::FlightData>> writer_;
   MemoryPool* pool_;
+  ipc::IpcWriteOptions options_;
+
+  // The pipelined writes
+  int max_batches_in_flight_;
+  std::mutex mutex_;
+  std::condition_variable batch_ready_;
+  std::condition_variable space_ready_;
+  std::deque<std::shared_ptr<RecordBatch>> queue_;
+  bool closed_;
+  // The first error of the worker
+  Status status_;
+  std::thread worker_;
 
   // We need to reference some fields
   friend class FlightClient;
@@ -274,25 +561,56 @@ class FlightClient::FlightClientImpl {
   }
 
   Status DoGet(const Ticket& ticket, const std::shared_ptr<Schema>& schema,
+               const FlightStreamOptions& options,
                std::unique_ptr<RecordBatchReader>* out) {
     pb::Ticket pb_ticket;
     internal::ToProto(ticket, &pb_ticket);
 
     // ClientRpc rpc;
     std::unique_ptr<ClientRpc> rpc(new ClientRpc);
+    if (options.compression != Compression::UNCOMPRESSED) {
+      // Request the compression from the server. The batches are decompressed
+      // transparently when they are read.
+      std::string name;
+      RETURN_NOT_OK(internal::GetCompressionName(options.compression, &name));
+      rpc->context.AddMetadata(internal::kCompressionHeader, name);
+    }
+    std::shared_ptr<DataPlane> data_plane = options.data_plane;
+    if (data_plane == nullptr && !options.shared_memory_dir.empty()) {
+      RETURN_NOT_OK(MakeSharedMemoryDataPlane(options.shared_memory_dir, &data_plane));
+    }
+    std::unique_ptr<DataPlaneReceiver> receiver;
+    if (data_plane != nullptr) {
+      // Offer the server a receiver for the record batch bodies
+      RETURN_NOT_OK(data_plane->MakeReceiver(&receiver));
+      rpc->context.AddMetadata(internal::kDataPlaneHeader, data_plane->name());
+      rpc->context.AddMetadata(internal::kDataPlaneAddressHeader, receiver->address());
+    }
     std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream(
         stub_->DoGet(&rpc->context, pb_ticket));
 
-    *out = std::unique_ptr<RecordBatchReader>(
-        new FlightStreamReader(std::move(rpc), schema, std::move(stream)));
+    *out = std::unique_ptr<RecordBatchReader>(new FlightStreamReader(
+        std::move(rpc), schema, std::move(stream), std::move(receiver)));
     return Status::OK();
   }
 
   Status DoPut(const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
+               const FlightStreamOptions& options,
                std::unique_ptr<ipc::RecordBatchWriter>* stream) {
     std::unique_ptr<ClientRpc> rpc(new ClientRpc);
     std::unique_ptr<FlightPutWriter::FlightPutWriterImpl> out(
         new FlightPutWriter::FlightPutWriterImpl(std::move(rpc), descriptor, schema));
+    if (options.compression != Compression::UNCOMPRESSED) {
+      // Fail early if the codec isn't supported. The server reads compressed
+      // batches transparently.
+      std::string name;
+      RETURN_NOT_OK(internal::GetCompressionName(options.compression, &name));
+      out->options_.compression = options.compression;
+    }
+    if (options.max_batches_in_flight < 0) {
+      return Status::Invalid("max_batches_in_flight must be non-negative");
+    }
+    out->max_batches_in_flight_ = options.max_batches_in_flight;
     std::unique_ptr<grpc::ClientWriter<pb::FlightData>> write_stream(
         stub_->DoPut(&out->rpc_->context, &out->response));
 
@@ -311,7 +629,7 @@ class FlightClient::FlightClientImpl {
                              grpc::WriteOptions())) {
       std::stringstream ss;
       ss << "Could not write descriptor and schema to stream: "
-         << rpc->context.debug_error_string();
+         << out->rpc_->context.debug_error_string();
       return Status::IOError(ss.str());
     }
 
@@ -360,13 +678,35 @@ Status FlightClient::ListFlights(const Criteria& criteria,
 
 Status FlightClient::DoGet(const Ticket& ticket, const std::shared_ptr<Schema>& schema,
                            std::unique_ptr<RecordBatchReader>* stream) {
-  return impl_->DoGet(ticket, schema, stream);
+  return impl_->DoGet(ticket, schema, FlightStreamOptions(), stream);
+}
+
+Status FlightClient::DoGet(const Ticket& ticket, const std::shared_ptr<Schema>& schema,
+                           const FlightStreamOptions& options,
+                           std::unique_ptr<RecordBatchReader>* stream) {
+  return impl_->DoGet(ticket, schema, options, stream);
+}
+
+Status FlightClient::DoGet(const FlightInfo& info, const ParallelDoGetOptions& options,
+                           std::unique_ptr<RecordBatchReader>* stream) {
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(info.GetSchema(&schema));
+  *stream = std::unique_ptr<RecordBatchReader>(
+      new ParallelStreamReader(this, schema, info.endpoints(), options));
+  return Status::OK();
+}
+
+Status FlightClient::DoPut(const FlightDescriptor& descriptor,
+                           const std::shared_ptr<Schema>& schema,
+                           std::unique_ptr<ipc::RecordBatchWriter>* stream) {
+  return impl_->DoPut(descriptor, schema, FlightStreamOptions(), stream);
 }
 
 Status FlightClient::DoPut(const FlightDescriptor& descriptor,
                            const std::shared_ptr<Schema>& schema,
+                           const FlightStreamOptions& options,
                            std::unique_ptr<ipc::RecordBatchWriter>* stream) {
-  return impl_->DoPut(descriptor, schema, stream);
+  return impl_->DoPut(descriptor, schema, options, stream);
 }
 
 }  // namespace flight
@@ -39,6 +39,51 @@ class Schema;
 
 namespace flight {
 
+class DataPlane;
+
+/// \brief Options for a DoGet or DoPut stream
+struct ARROW_EXPORT FlightStreamOptions {
+  /// The codec compressing the body buffers of the record batches:
+  /// Compression::UNCOMPRESSED, LZ4 or ZSTD. For DoGet, the codec is requested
+  /// from the server, which sends uncompressed batches if it doesn't support it
+  Compression::type compression = Compression::UNCOMPRESSED;
+
+  /// For DoPut, the number of record batches that may be waiting to be
+  /// written. When positive, WriteRecordBatch only queues the batch, blocking
+  /// while the queue is full, and a background thread serializes and writes
+  /// the batches. A write error is then returned by the following
+  /// WriteRecordBatch or by Close. When 0, batches are written synchronously
+  int max_batches_in_flight = 0;
+
+  /// For DoGet, a directory in shared memory, such as /dev/shm, to create a
+  /// file in for a server on the same host to write the record batch bodies
+  /// to, so that only their metadata goes through gRPC. Servers on other
+  /// hosts send the bodies as usual. Empty to not use shared memory
+  std::string shared_memory_dir;
+
+  /// For DoGet, the data plane to ask the server to send the record batch
+  /// bodies through, in place of the shared memory one. Servers that don't
+  /// have it registered send the bodies through gRPC
+  std::shared_ptr<DataPlane> data_plane;
+};
+
+/// \brief Options for reading the streams of all the endpoints of a flight
+struct ARROW_EXPORT ParallelDoGetOptions {
+  /// The maximum number of endpoints read at once
+  int parallelism = 4;
+
+  /// Whether batches are returned in the order of the endpoints. Otherwise,
+  /// they are returned in the order they arrive in
+  bool ordered = false;
+
+  /// The number of batches buffered, for each endpoint if ordered, before the
+  /// streams stop being read until the batches are consumed
+  int max_buffered_batches = 16;
+
+  /// The options of the stream of each endpoint
+  FlightStreamOptions stream_options;
+};
+
 /// \brief Client class for Arrow Flight RPC services (gRPC-based).
 /// API experimental for now
 class ARROW_EXPORT FlightClient {
@@ -96,6 +141,29 @@ class ARROW_EXPORT FlightClient {
   Status DoGet(const Ticket& ticket, const std::shared_ptr<Schema>& schema,
                std::unique_ptr<RecordBatchReader>* stream);
 
+  /// \brief Like the above, with options such as the compression of the
+  /// record batches
+  /// \param[in] ticket The flight ticket to use
+  /// \param[in] schema the schema of the stream data as computed by
+  /// GetFlightInfo
+  /// \param[in] options the options of the stream
+  /// \param[out] stream the returned RecordBatchReader
+  /// \return Status
+  Status DoGet(const Ticket& ticket, const std::shared_ptr<Schema>& schema,
+               const FlightStreamOptions& options,
+               std::unique_ptr<RecordBatchReader>* stream);
+
+  /// \brief Request the streams of all the endpoints of a flight, which are
+  /// read concurrently on background threads, and returned as one stream.
+  /// Endpoints without locations are redeemed with this client, which must
+  /// outlive the stream; otherwise the locations are tried in order
+  /// \param[in] info the FlightInfo describing the endpoints
+  /// \param[in] options the parallelism, ordering and buffering of the reads
+  /// \param[out] stream the returned RecordBatchReader
+  /// \return Status
+  Status DoGet(const FlightInfo& info, const ParallelDoGetOptions& options,
+               std::unique_ptr<RecordBatchReader>* stream);
+
   /// \brief Upload data to a Flight described by the given
   /// descriptor. The caller must call Close() on the returned stream
   /// once they are done writing.
@@ -106,6 +174,17 @@ class ARROW_EXPORT FlightClient {
   Status DoPut(const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
                std::unique_ptr<ipc::RecordBatchWriter>* stream);
 
+  /// \brief Like the above, with options such as the compression of the
+  /// record batches written
+  /// \param[in] descriptor the descriptor of the stream
+  /// \param[in] schema the schema for the data to upload
+  /// \param[in] options the options of the stream
+  /// \param[out] stream a writer to write record batches to
+  /// \return Status
+  Status DoPut(const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
+               const FlightStreamOptions& options,
+               std::unique_ptr<ipc::RecordBatchWriter>* stream);
+
  private:
   FlightClient();
   class FlightClientImpl;
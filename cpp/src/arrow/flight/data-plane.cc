@@ -0,0 +1,170 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/data-plane.h"
+
+#include <atomic>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/util.h"
+#include "arrow/util/bit-util.h"
+
+#include "arrow/flight/internal.h"
+
+namespace arrow {
+namespace flight {
+
+namespace {
+
+/// \brief The file that a server on the same host appends the record batch
+/// bodies of a DoGet stream to. The file is removed with the receiver, while
+/// the batches read remain valid, since they reference its memory map.
+class SharedMemoryReceiver : public DataPlaneReceiver {
+ public:
+  explicit SharedMemoryReceiver(const std::string& path)
+      : path_(path), offset_(0), mapped_size_(0) {}
+
+  ~SharedMemoryReceiver() override { std::remove(path_.c_str()); }
+
+  std::string address() const override { return path_; }
+
+  Status ReadBody(int64_t length, std::shared_ptr<Buffer>* out) override {
+    if (file_ == nullptr || offset_ + length > mapped_size_) {
+      // Map the bodies written since
+      RETURN_NOT_OK(io::MemoryMappedFile::Open(path_, io::FileMode::READ, &file_));
+      RETURN_NOT_OK(file_->GetSize(&mapped_size_));
+      if (offset_ + length > mapped_size_) {
+        return Status::IOError("Record batch body missing from ", path_);
+      }
+    }
+    RETURN_NOT_OK(file_->ReadAt(offset_, length, out));
+    offset_ += length;
+    return Status::OK();
+  }
+
+ private:
+  std::string path_;
+  std::shared_ptr<io::MemoryMappedFile> file_;
+  int64_t offset_;
+  int64_t mapped_size_;
+};
+
+class SharedMemorySender : public DataPlaneSender {
+ public:
+  explicit SharedMemorySender(std::shared_ptr<io::OutputStream> file)
+      : file_(std::move(file)) {}
+
+  Status WriteBody(const std::vector<std::shared_ptr<Buffer>>& buffers) override {
+    for (const auto& buffer : buffers) {
+      if (!buffer) continue;
+      RETURN_NOT_OK(file_->Write(buffer->data(), buffer->size()));
+      const int64_t remainder =
+          BitUtil::RoundUpToMultipleOf8(buffer->size()) - buffer->size();
+      if (remainder) {
+        RETURN_NOT_OK(file_->Write(ipc::kPaddingBytes, remainder));
+      }
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<io::OutputStream> file_;
+};
+
+class SharedMemoryDataPlane : public DataPlane {
+ public:
+  explicit SharedMemoryDataPlane(const std::string& dir) : dir_(dir) {}
+
+  std::string name() const override { return "shm"; }
+
+  Status MakeReceiver(std::unique_ptr<DataPlaneReceiver>* out) override {
+    static std::atomic<int64_t> counter(0);
+    std::stringstream ss;
+    ss << dir_ << "/" << internal::kSharedMemoryPrefix << std::hex
+       << std::random_device()() << "-" << counter++;
+    std::shared_ptr<io::FileOutputStream> file;
+    RETURN_NOT_OK(io::FileOutputStream::Open(ss.str(), &file));
+    RETURN_NOT_OK(file->Close());
+    out->reset(new SharedMemoryReceiver(ss.str()));
+    return Status::OK();
+  }
+
+  Status MakeSender(const std::string& peer, const std::string& address,
+                    std::unique_ptr<DataPlaneSender>* out) override {
+    if (!internal::IsLocalPeer(peer)) {
+      return Status::Invalid("Shared memory is only used for peers on this host");
+    }
+    RETURN_NOT_OK(internal::CheckSharedMemoryFile(address));
+    std::shared_ptr<io::FileOutputStream> file;
+    RETURN_NOT_OK(io::FileOutputStream::Open(address, /*append=*/true, &file));
+    out->reset(new SharedMemorySender(file));
+    return Status::OK();
+  }
+
+ private:
+  std::string dir_;
+};
+
+struct DataPlaneRegistry {
+  DataPlaneRegistry() {
+    data_planes["shm"] = std::make_shared<SharedMemoryDataPlane>("");
+  }
+
+  std::mutex mutex;
+  std::map<std::string, std::shared_ptr<DataPlane>> data_planes;
+};
+
+DataPlaneRegistry* GetRegistry() {
+  static DataPlaneRegistry registry;
+  return &registry;
+}
+
+}  // namespace
+
+Status MakeSharedMemoryDataPlane(const std::string& dir,
+                                 std::shared_ptr<DataPlane>* out) {
+  *out = std::make_shared<SharedMemoryDataPlane>(dir);
+  return Status::OK();
+}
+
+Status RegisterDataPlane(const std::shared_ptr<DataPlane>& data_plane) {
+  DataPlaneRegistry* registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  registry->data_planes[data_plane->name()] = data_plane;
+  return Status::OK();
+}
+
+Status GetDataPlane(const std::string& name, std::shared_ptr<DataPlane>* out) {
+  DataPlaneRegistry* registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry->mutex);
+  auto it = registry->data_planes.find(name);
+  if (it == registry->data_planes.end()) {
+    return Status::KeyError("No Flight data plane named ", name);
+  }
+  *out = it->second;
+  return Status::OK();
+}
+
+}  // namespace flight
+}  // namespace arrow
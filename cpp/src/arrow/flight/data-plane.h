@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+/// \brief Transports for the record batch bodies of Flight streams, beside
+/// gRPC. API experimental for now
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+
+namespace flight {
+
+/// \brief The client end of a data plane for one DoGet stream, which
+/// receives the bodies of the record batches in the order of their messages
+class ARROW_EXPORT DataPlaneReceiver {
+ public:
+  virtual ~DataPlaneReceiver() = default;
+
+  /// \brief The address of the receiver, which is sent to the server
+  virtual std::string address() const = 0;
+
+  /// \brief Read the body of the next record batch
+  /// \param[in] length the length of the body, from the batch metadata
+  /// \param[out] out the body
+  /// \return Status
+  virtual Status ReadBody(int64_t length, std::shared_ptr<Buffer>* out) = 0;
+};
+
+/// \brief The server end of a data plane for one DoGet stream
+class ARROW_EXPORT DataPlaneSender {
+ public:
+  virtual ~DataPlaneSender() = default;
+
+  /// \brief Send the body of the next record batch. Each buffer is padded to
+  /// a multiple of 8 bytes, as in the IPC stream format
+  /// \param[in] buffers the body buffers, some of which may be null
+  /// \return Status
+  virtual Status WriteBody(const std::vector<std::shared_ptr<Buffer>>& buffers) = 0;
+};
+
+/// \brief A transport for the record batch bodies of DoGet streams, in
+/// place of gRPC. gRPC still carries the calls and the batch metadata, and
+/// the bodies of streams whose server doesn't support the data plane.
+///
+/// The client names the data plane and the address of its receiver in the
+/// headers of the call. Servers look the data plane up by name among the
+/// registered ones, and may decline it for the peer.
+class ARROW_EXPORT DataPlane {
+ public:
+  virtual ~DataPlane() = default;
+
+  /// \brief The name of the data plane, which is the same on all hosts
+  virtual std::string name() const = 0;
+
+  /// \brief Create the client end for a stream
+  /// \param[out] out the receiver
+  /// \return Status
+  virtual Status MakeReceiver(std::unique_ptr<DataPlaneReceiver>* out) = 0;
+
+  /// \brief Create the server end for a stream
+  /// \param[in] peer the gRPC peer of the call, e.g. "ipv4:127.0.0.1:5000"
+  /// \param[in] address the address of the receiver
+  /// \param[out] out the sender
+  /// \return Status, which is not OK if the data plane can't reach the peer
+  virtual Status MakeSender(const std::string& peer, const std::string& address,
+                            std::unique_ptr<DataPlaneSender>* out) = 0;
+};
+
+/// \brief Make the data plane moving the bodies through a memory-mapped
+/// file, which servers use for clients on the same host. It is registered
+/// under the name "shm"
+/// \param[in] dir the directory of the files of the client, in shared
+/// memory such as /dev/shm
+/// \param[out] out the data plane
+/// \return Status
+ARROW_EXPORT
+Status MakeSharedMemoryDataPlane(const std::string& dir,
+                                 std::shared_ptr<DataPlane>* out);
+
+/// \brief Register a data plane for servers in this process to use
+/// \param[in] data_plane the data plane, replacing any of the same name
+/// \return Status
+ARROW_EXPORT
+Status RegisterDataPlane(const std::shared_ptr<DataPlane>& data_plane);
+
+/// \brief Get a registered data plane
+/// \param[in] name the name of the data plane
+/// \param[out] out the data plane
+/// \return Status, KeyError if no data plane has the name
+ARROW_EXPORT
+Status GetDataPlane(const std::string& name, std::shared_ptr<DataPlane>* out);
+
+}  // namespace flight
+}  // namespace arrow
@@ -15,7 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdlib>
+#include <iostream>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -28,6 +31,7 @@
 #include "arrow/ipc/api.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
 #include "arrow/util/stopwatch.h"
 #include "arrow/util/thread-pool.h"
 
@@ -40,6 +44,15 @@ DEFINE_int32(num_streams, 4, "Number of streams for each server");
 DEFINE_int32(num_threads, 4, "Number of concurrent gets");
 DEFINE_int32(records_per_stream, 10000000, "Total records per stream");
 DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
+DEFINE_bool(test_put, false, "Test DoPut instead of DoGet");
+DEFINE_string(sweep_threads, "",
+              "Comma-separated numbers of concurrent streams to run in turn, "
+              "instead of --num_threads");
+DEFINE_string(sweep_records_per_batch, "",
+              "Comma-separated batch sizes to run in turn, instead of "
+              "--records_per_batch");
+DEFINE_string(sweep_columns, "4",
+              "Comma-separated numbers of int64 columns to run in turn");
 
 namespace perf = arrow::flight::perf;
 
@@ -55,23 +68,145 @@ struct PerformanceStats {
   std::mutex mutex;
   int64_t total_records;
   int64_t total_bytes;
+  // The time to read or write each batch
+  std::vector<uint64_t> batch_nanos;
 
-  void Update(const int64_t total_records, const int64_t total_bytes) {
+  void Update(const int64_t total_records, const int64_t total_bytes,
+              const std::vector<uint64_t>& batch_nanos) {
     std::lock_guard<std::mutex> lock(this->mutex);
     this->total_records += total_records;
     this->total_bytes += total_bytes;
+    this->batch_nanos.insert(this->batch_nanos.end(), batch_nanos.begin(),
+                             batch_nanos.end());
+  }
+
+  double BatchMicros(double percentile) {
+    if (batch_nanos.empty()) {
+      return 0;
+    }
+    std::sort(batch_nanos.begin(), batch_nanos.end());
+    const auto index = static_cast<size_t>(percentile * (batch_nanos.size() - 1));
+    return static_cast<double>(batch_nanos[index]) / 1000;
   }
 };
 
-Status RunPerformanceTest(const int port) {
+Status GetServerCpuTime(FlightClient* client, double* seconds) {
+  std::unique_ptr<ResultStream> results;
+  RETURN_NOT_OK(client->DoAction(Action{"cpu-time", nullptr}, &results));
+  std::unique_ptr<Result> result;
+  RETURN_NOT_OK(results->Next(&result));
+  if (result == nullptr) {
+    return Status::IOError("No CPU time returned by the server");
+  }
+  perf::CpuTime cpu_time;
+  if (!cpu_time.ParseFromString(result->body->ToString())) {
+    return Status::Invalid("cannot parse protobuf");
+  }
+  *seconds = cpu_time.seconds();
+  return Status::OK();
+}
+
+Status ConsumeStream(const int port, const std::shared_ptr<Schema>& schema,
+                     const FlightEndpoint& endpoint, PerformanceStats* stats) {
+  // TODO(wesm): Use location from endpoint, same host/port for now
+  std::unique_ptr<FlightClient> client;
+  RETURN_NOT_OK(FlightClient::Connect("localhost", port, &client));
+
+  perf::Token token;
+  token.ParseFromString(endpoint.ticket.ticket);
+
+  std::unique_ptr<RecordBatchReader> reader;
+  RETURN_NOT_OK(client->DoGet(endpoint.ticket, schema, &reader));
+
+  std::shared_ptr<RecordBatch> batch;
+
+  // All columns are int64
+  const int bytes_per_record = 8 * schema->num_fields();
+
+  // This must also be set in perf-server.c
+  const bool verify = false;
+
+  int64_t num_bytes = 0;
+  int64_t num_records = 0;
+  std::vector<uint64_t> batch_nanos;
+  StopWatch timer;
+  while (true) {
+    timer.Start();
+    RETURN_NOT_OK(reader->ReadNext(&batch));
+    if (!batch) {
+      break;
+    }
+    batch_nanos.push_back(timer.Stop());
+
+    if (verify) {
+      auto values =
+          reinterpret_cast<const int64_t*>(batch->column_data(0)->buffers[1]->data());
+      const int64_t start = token.start() + num_records;
+      for (int64_t i = 0; i < batch->num_rows(); ++i) {
+        if (values[i] != start + i) {
+          return Status::Invalid("verification failure");
+        }
+      }
+    }
+
+    num_records += batch->num_rows();
+    num_bytes += batch->num_rows() * bytes_per_record;
+  }
+  stats->Update(num_records, num_bytes, batch_nanos);
+  return Status::OK();
+}
+
+Status ProduceStream(const int port, const std::shared_ptr<Schema>& schema,
+                     const perf::Perf& perf, PerformanceStats* stats) {
+  std::unique_ptr<FlightClient> client;
+  RETURN_NOT_OK(FlightClient::Connect("localhost", port, &client));
+
+  const int64_t length = perf.records_per_batch();
+  std::vector<std::shared_ptr<Array>> arrays;
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(MakeRandomBuffer<int64_t>(length, default_memory_pool(), &buffer));
+    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
+  }
+  auto batch = RecordBatch::Make(schema, length, arrays);
+
+  FlightDescriptor descriptor;
+  descriptor.type = FlightDescriptor::CMD;
+  perf.SerializeToString(&descriptor.cmd);
+  std::unique_ptr<ipc::RecordBatchWriter> writer;
+  RETURN_NOT_OK(client->DoPut(descriptor, schema, &writer));
+
+  const int bytes_per_record = 8 * schema->num_fields();
+  int64_t num_records = 0;
+  std::vector<uint64_t> batch_nanos;
+  StopWatch timer;
+  while (num_records < perf.records_per_stream()) {
+    // Last partial batch
+    auto next = batch;
+    if (num_records + length > perf.records_per_stream()) {
+      next = batch->Slice(0, perf.records_per_stream() - num_records);
+    }
+    timer.Start();
+    RETURN_NOT_OK(writer->WriteRecordBatch(*next));
+    batch_nanos.push_back(timer.Stop());
+    num_records += next->num_rows();
+  }
+  RETURN_NOT_OK(writer->Close());
+  stats->Update(num_records, num_records * bytes_per_record, batch_nanos);
+  return Status::OK();
+}
+
+Status RunPerformanceTest(const int port, const int num_threads,
+                          const int records_per_batch, const int num_columns) {
   // TODO(wesm): Multiple servers
   // std::vector<std::unique_ptr<TestServer>> servers;
 
   // schema not needed
   perf::Perf perf;
-  perf.set_stream_count(FLAGS_num_streams);
+  perf.set_stream_count(std::max(FLAGS_num_streams, num_threads));
   perf.set_records_per_stream(FLAGS_records_per_stream);
-  perf.set_records_per_batch(FLAGS_records_per_batch);
+  perf.set_records_per_batch(records_per_batch);
+  perf.set_num_columns(num_columns);
 
   // Construct client and plan the query
   std::unique_ptr<FlightClient> client;
@@ -89,66 +224,27 @@ Status RunPerformanceTest(const int port) {
   RETURN_NOT_OK(plan->GetSchema(&schema));
 
   PerformanceStats stats;
-  auto ConsumeStream = [&stats, &schema, &port](const FlightEndpoint& endpoint) {
-    // TODO(wesm): Use location from endpoint, same host/port for now
-    std::unique_ptr<FlightClient> client;
-    RETURN_NOT_OK(FlightClient::Connect("localhost", port, &client));
-
-    perf::Token token;
-    token.ParseFromString(endpoint.ticket.ticket);
-
-    std::unique_ptr<RecordBatchReader> reader;
-    RETURN_NOT_OK(client->DoGet(endpoint.ticket, schema, &reader));
-
-    std::shared_ptr<RecordBatch> batch;
-
-    // This is hard-coded for right now, 4 columns each with int64
-    const int bytes_per_record = 32;
-
-    // This must also be set in perf-server.c
-    const bool verify = false;
-
-    int64_t num_bytes = 0;
-    int64_t num_records = 0;
-    while (true) {
-      RETURN_NOT_OK(reader->ReadNext(&batch));
-      if (!batch) {
-        break;
-      }
-
-      if (verify) {
-        auto values =
-            reinterpret_cast<const int64_t*>(batch->column_data(0)->buffers[1]->data());
-        const int64_t start = token.start() + num_records;
-        for (int64_t i = 0; i < batch->num_rows(); ++i) {
-          if (values[i] != start + i) {
-            return Status::Invalid("verification failure");
-          }
-        }
-      }
-
-      num_records += batch->num_rows();
-
-      // Hard-coded
-      num_bytes += batch->num_rows() * bytes_per_record;
-    }
-    stats.Update(num_records, num_bytes);
-    return Status::OK();
-  };
+  double client_cpu_start, server_cpu_start;
+  RETURN_NOT_OK(GetCpuTime(&client_cpu_start));
+  RETURN_NOT_OK(GetServerCpuTime(client.get(), &server_cpu_start));
 
   StopWatch timer;
   timer.Start();
 
   // XXX(wesm): Serial version for debugging
   // for (const auto& endpoint : plan->endpoints()) {
-  //   RETURN_NOT_OK(ConsumeStream(endpoint));
+  //   RETURN_NOT_OK(ConsumeStream(port, schema, endpoint, &stats));
   // }
 
   std::shared_ptr<ThreadPool> pool;
-  RETURN_NOT_OK(ThreadPool::Make(FLAGS_num_threads, &pool));
+  RETURN_NOT_OK(ThreadPool::Make(num_threads, &pool));
   std::vector<std::future<Status>> tasks;
   for (const auto& endpoint : plan->endpoints()) {
-    tasks.emplace_back(pool->Submit(ConsumeStream, endpoint));
+    if (FLAGS_test_put) {
+      tasks.emplace_back(pool->Submit(ProduceStream, port, schema, perf, &stats));
+    } else {
+      tasks.emplace_back(pool->Submit(ConsumeStream, port, schema, endpoint, &stats));
+    }
   }
 
   // Wait for tasks to finish
@@ -161,18 +257,67 @@ Status RunPerformanceTest(const int port) {
   double time_elapsed =
       static_cast<double>(elapsed_nanos) / static_cast<double>(1000000000);
 
+  double client_cpu_end, server_cpu_end;
+  RETURN_NOT_OK(GetCpuTime(&client_cpu_end));
+  RETURN_NOT_OK(GetServerCpuTime(client.get(), &server_cpu_end));
+
   constexpr double kMegabyte = static_cast<double>(1 << 20);
+  constexpr double kGigabyte = static_cast<double>(1 << 30);
 
   // Check that number of rows read is as expected
   if (stats.total_records != static_cast<int64_t>(plan->total_records())) {
     return Status::Invalid("Did not consume expected number of records");
   }
 
-  std::cout << "Bytes read: " << stats.total_bytes << std::endl;
-  std::cout << "Nanos: " << elapsed_nanos << std::endl;
-  std::cout << "Speed: "
+  const double gigabytes = static_cast<double>(stats.total_bytes) / kGigabyte;
+  std::cout << (FLAGS_test_put ? "DoPut" : "DoGet") << " threads=" << num_threads
+            << " records_per_batch=" << records_per_batch
+            << " columns=" << num_columns << std::endl;
+  std::cout << "  Bytes: " << stats.total_bytes << std::endl;
+  std::cout << "  Nanos: " << elapsed_nanos << std::endl;
+  std::cout << "  Speed: "
             << (static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed)
             << " MB/s" << std::endl;
+  std::cout << "  Batch latency: p50 " << stats.BatchMicros(0.5) << " us, p99 "
+            << stats.BatchMicros(0.99) << " us" << std::endl;
+  std::cout << "  CPU per GB: client " << (client_cpu_end - client_cpu_start) / gigabytes
+            << " s, server " << (server_cpu_end - server_cpu_start) / gigabytes << " s"
+            << std::endl;
+  return Status::OK();
+}
+
+// Parse a comma-separated list of positive integers, or take the default
+Status ParseSweep(const std::string& values, int default_value, std::vector<int>* out) {
+  if (values.empty()) {
+    out->push_back(default_value);
+    return Status::OK();
+  }
+  std::stringstream ss(values);
+  std::string value;
+  while (std::getline(ss, value, ',')) {
+    const int parsed = std::atoi(value.c_str());
+    if (parsed <= 0) {
+      return Status::Invalid("Invalid sweep value: ", value);
+    }
+    out->push_back(parsed);
+  }
+  return Status::OK();
+}
+
+Status RunPerformanceTests(const int port) {
+  std::vector<int> threads, batch_sizes, columns;
+  RETURN_NOT_OK(ParseSweep(FLAGS_sweep_threads, FLAGS_num_threads, &threads));
+  RETURN_NOT_OK(
+      ParseSweep(FLAGS_sweep_records_per_batch, FLAGS_records_per_batch, &batch_sizes));
+  RETURN_NOT_OK(ParseSweep(FLAGS_sweep_columns, 4, &columns));
+  for (int num_threads : threads) {
+    for (int records_per_batch : batch_sizes) {
+      for (int num_columns : columns) {
+        RETURN_NOT_OK(
+            RunPerformanceTest(port, num_threads, records_per_batch, num_columns));
+      }
+    }
+  }
   return Status::OK();
 }
 
@@ -186,7 +331,7 @@ int main(int argc, char** argv) {
   arrow::flight::TestServer server("arrow-flight-perf-server", port);
   server.Start();
 
-  arrow::Status s = arrow::flight::RunPerformanceTest(port);
+  arrow::Status s = arrow::flight::RunPerformanceTests(port);
   server.Stop();
 
   if (!s.ok()) {
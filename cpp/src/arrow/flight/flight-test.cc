@@ -19,8 +19,10 @@
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <deque>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -30,6 +32,7 @@
 #include "arrow/ipc/test-common.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/bit-util.h"
 
 #include "arrow/flight/api.h"
 
@@ -39,7 +42,9 @@
 
 #include "arrow/flight/Flight.pb.h"
 #include "arrow/flight/internal.h"
+#include "arrow/flight/serialization-internal.h"
 #include "arrow/flight/test-util.h"
+#include "arrow/ipc/writer.h"
 
 namespace pb = arrow::flight::protocol;
 
@@ -59,6 +64,158 @@ TEST(TestFlight, StartStopTestServer) {
   ASSERT_FALSE(server.IsRunning());
 }
 
+// A server whose streams are generated by the executor of the server
+class ExecutorTestServer : public FlightServerBase {
+  Status DoGet(const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    BatchVector batches;
+    RETURN_NOT_OK(SimpleIntegerBatches(5, &batches));
+    auto reader = std::make_shared<BatchIterator>(batches[0]->schema(), batches);
+    *data_stream = std::unique_ptr<FlightDataStream>(new RecordBatchStream(reader));
+    return Status::OK();
+  }
+};
+
+TEST(TestFlight, DataStreamExecutor) {
+  const int port = 30001;
+  FlightServerOptions options;
+  options.max_grpc_threads = 4;
+  options.data_stream_threads = 2;
+  options.prefetch_payloads = 3;
+  ExecutorTestServer server;
+  std::thread server_thread([&server, &options] { server.Run(port, options); });
+
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(FlightClient::Connect("localhost", port, &client));
+  BatchVector expected_batches;
+  ASSERT_OK(SimpleIntegerBatches(5, &expected_batches));
+  // Concurrent streams share the executor
+  for (int i = 0; i < 2; ++i) {
+    std::unique_ptr<RecordBatchReader> stream1, stream2;
+    ASSERT_OK(client->DoGet(Ticket{""}, ExampleSchema1(), &stream1));
+    ASSERT_OK(client->DoGet(Ticket{""}, ExampleSchema1(), &stream2));
+    std::shared_ptr<RecordBatch> chunk;
+    for (const auto& expected : expected_batches) {
+      ASSERT_OK(stream1->ReadNext(&chunk));
+      ASSERT_BATCHES_EQUAL(*expected, *chunk);
+      ASSERT_OK(stream2->ReadNext(&chunk));
+      ASSERT_BATCHES_EQUAL(*expected, *chunk);
+    }
+    ASSERT_OK(stream1->ReadNext(&chunk));
+    ASSERT_EQ(nullptr, chunk);
+    ASSERT_OK(stream2->ReadNext(&chunk));
+    ASSERT_EQ(nullptr, chunk);
+  }
+
+  server.Shutdown();
+  server_thread.join();
+}
+
+// A data plane passing the bodies through a queue in this process
+class QueueDataPlane : public DataPlane {
+ public:
+  std::string name() const override { return "test-queue"; }
+
+  Status MakeReceiver(std::unique_ptr<DataPlaneReceiver>* out) override {
+    out->reset(new Receiver(this));
+    return Status::OK();
+  }
+
+  Status MakeSender(const std::string& peer, const std::string& address,
+                    std::unique_ptr<DataPlaneSender>* out) override {
+    out->reset(new Sender(this));
+    return Status::OK();
+  }
+
+  int bodies_sent() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bodies_sent_;
+  }
+
+ private:
+  class Receiver : public DataPlaneReceiver {
+   public:
+    explicit Receiver(QueueDataPlane* data_plane) : data_plane_(data_plane) {}
+
+    std::string address() const override { return "queue"; }
+
+    Status ReadBody(int64_t length, std::shared_ptr<Buffer>* out) override {
+      std::lock_guard<std::mutex> lock(data_plane_->mutex_);
+      if (data_plane_->bodies_.empty() ||
+          data_plane_->bodies_.front()->size() != length) {
+        return Status::IOError("Unexpected body");
+      }
+      *out = data_plane_->bodies_.front();
+      data_plane_->bodies_.pop_front();
+      return Status::OK();
+    }
+
+   private:
+    QueueDataPlane* data_plane_;
+  };
+
+  class Sender : public DataPlaneSender {
+   public:
+    explicit Sender(QueueDataPlane* data_plane) : data_plane_(data_plane) {}
+
+    Status WriteBody(const std::vector<std::shared_ptr<Buffer>>& buffers) override {
+      std::string body;
+      for (const auto& buffer : buffers) {
+        if (!buffer) continue;
+        body += buffer->ToString();
+        body.resize(BitUtil::RoundUpToMultipleOf8(body.size()));
+      }
+      std::shared_ptr<Buffer> out;
+      RETURN_NOT_OK(Buffer::FromString(body, &out));
+      std::lock_guard<std::mutex> lock(data_plane_->mutex_);
+      data_plane_->bodies_.push_back(out);
+      ++data_plane_->bodies_sent_;
+      return Status::OK();
+    }
+
+   private:
+    QueueDataPlane* data_plane_;
+  };
+
+  std::mutex mutex_;
+  std::deque<std::shared_ptr<Buffer>> bodies_;
+  int bodies_sent_ = 0;
+};
+
+TEST(TestFlight, DataPlane) {
+  std::shared_ptr<DataPlane> data_plane;
+  ASSERT_OK(GetDataPlane("shm", &data_plane));
+  ASSERT_RAISES(KeyError, GetDataPlane("test-queue", &data_plane));
+
+  auto queue = std::make_shared<QueueDataPlane>();
+  ASSERT_OK(RegisterDataPlane(queue));
+
+  const int port = 30002;
+  ExecutorTestServer server;
+  std::thread server_thread([&server] { server.Run(port); });
+
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(FlightClient::Connect("localhost", port, &client));
+  FlightStreamOptions options;
+  options.data_plane = queue;
+  std::unique_ptr<RecordBatchReader> stream;
+  ASSERT_OK(client->DoGet(Ticket{""}, ExampleSchema1(), options, &stream));
+
+  BatchVector expected_batches;
+  ASSERT_OK(SimpleIntegerBatches(5, &expected_batches));
+  std::shared_ptr<RecordBatch> chunk;
+  for (const auto& expected : expected_batches) {
+    ASSERT_OK(stream->ReadNext(&chunk));
+    ASSERT_BATCHES_EQUAL(*expected, *chunk);
+  }
+  ASSERT_OK(stream->ReadNext(&chunk));
+  ASSERT_EQ(nullptr, chunk);
+  ASSERT_EQ(5, queue->bodies_sent());
+
+  server.Shutdown();
+  server_thread.join();
+}
+
 // ----------------------------------------------------------------------
 // Client tests
 
@@ -186,6 +343,28 @@ TEST(TestFlightProtocol, FlightDescriptor) {
   AssertEqual(descr2, descr_test);
 }
 
+TEST(TestFlightProtocol, DeserializeZeroCopy) {
+  std::shared_ptr<Array> values;
+  ArrayFromVector<Int64Type, int64_t>({1, 2, 3, 4, 5, 6, 7, 8}, &values);
+  auto batch = RecordBatch::Make(schema({field("f0", int64())}), 8, {values});
+
+  FlightPayload payload;
+  ASSERT_OK(ipc::internal::GetRecordBatchPayload(*batch, default_memory_pool(),
+                                                 &payload.ipc_message));
+
+  grpc::ByteBuffer buffer;
+  bool own_buffer;
+  ASSERT_TRUE(internal::FlightDataSerialize(payload, &buffer, &own_buffer).ok());
+
+  internal::FlightData data;
+  ASSERT_TRUE(internal::FlightDataDeserialize(&buffer, &data).ok());
+  ASSERT_TRUE(data.metadata->Equals(*payload.ipc_message.metadata));
+
+  // The body is the slice of the values, which is referenced without copying.
+  ASSERT_EQ(values->data()->buffers[1]->data(), data.body->data());
+  ASSERT_EQ(values->data()->buffers[1]->size(), data.body->size());
+}
+
 TEST_F(TestFlightClient, DoGet) {
   FlightDescriptor descr{FlightDescriptor::PATH, "", {"foo", "bar"}};
   std::unique_ptr<FlightInfo> info;
@@ -220,6 +399,154 @@ TEST_F(TestFlightClient, DoGet) {
   ASSERT_EQ(nullptr, chunk);
 }
 
+TEST_F(TestFlightClient, DoGetCompressed) {
+  FlightStreamOptions options;
+  options.compression = Compression::LZ4;
+
+  std::unique_ptr<RecordBatchReader> stream;
+  Status st = client_->DoGet(Ticket{"ticket-id-1"}, ExampleSchema1(), options, &stream);
+  if (st.IsNotImplemented()) {
+    // Arrow was built without LZ4
+    return;
+  }
+  ASSERT_OK(st);
+
+  BatchVector expected_batches;
+  const int num_batches = 5;
+  ASSERT_OK(SimpleIntegerBatches(num_batches, &expected_batches));
+  std::shared_ptr<RecordBatch> chunk;
+  for (int i = 0; i < num_batches; ++i) {
+    ASSERT_OK(stream->ReadNext(&chunk));
+    ASSERT_BATCHES_EQUAL(*expected_batches[i], *chunk);
+  }
+  ASSERT_OK(stream->ReadNext(&chunk));
+  ASSERT_EQ(nullptr, chunk);
+
+  // Codecs without IPC body compression are refused.
+  options.compression = Compression::GZIP;
+  Ticket ticket{"ticket-id-1"};
+  ASSERT_RAISES(Invalid, client_->DoGet(ticket, ExampleSchema1(), options, &stream));
+}
+
+TEST_F(TestFlightClient, DoGetSharedMemory) {
+  // The test server is on this host, so it writes the bodies to the file
+  FlightStreamOptions options;
+  options.shared_memory_dir = "/tmp";
+
+  std::unique_ptr<RecordBatchReader> stream;
+  ASSERT_OK(client_->DoGet(Ticket{"ticket-id-1"}, ExampleSchema1(), options, &stream));
+
+  BatchVector expected_batches;
+  const int num_batches = 5;
+  ASSERT_OK(SimpleIntegerBatches(num_batches, &expected_batches));
+  BatchVector batches;
+  std::shared_ptr<RecordBatch> chunk;
+  for (int i = 0; i < num_batches; ++i) {
+    ASSERT_OK(stream->ReadNext(&chunk));
+    ASSERT_BATCHES_EQUAL(*expected_batches[i], *chunk);
+    batches.push_back(chunk);
+  }
+  ASSERT_OK(stream->ReadNext(&chunk));
+  ASSERT_EQ(nullptr, chunk);
+
+  // The batches outlive the stream and its file
+  stream.reset();
+  for (int i = 0; i < num_batches; ++i) {
+    ASSERT_BATCHES_EQUAL(*expected_batches[i], *batches[i]);
+  }
+}
+
+TEST(TestFlightProtocol, SharedMemoryPeers) {
+  ASSERT_TRUE(internal::IsLocalPeer("ipv4:127.0.0.1:31337"));
+  ASSERT_TRUE(internal::IsLocalPeer("ipv6:[::1]:31337"));
+  ASSERT_TRUE(internal::IsLocalPeer("unix:/tmp/flight.sock"));
+  ASSERT_FALSE(internal::IsLocalPeer("ipv4:10.0.0.1:31337"));
+
+  ASSERT_RAISES(Invalid, internal::CheckSharedMemoryFile("/etc/passwd"));
+  ASSERT_RAISES(IOError,
+                internal::CheckSharedMemoryFile("/tmp/arrow-flight-shm-none"));
+}
+
+TEST_F(TestFlightClient, DoPutPipelined) {
+  FlightDescriptor descr{FlightDescriptor::PATH, "", {"foo", "bar"}};
+  BatchVector batches;
+  ASSERT_OK(SimpleIntegerBatches(5, &batches));
+
+  FlightStreamOptions options;
+  options.max_batches_in_flight = 2;
+  std::unique_ptr<ipc::RecordBatchWriter> stream;
+  ASSERT_OK(client_->DoPut(descr, batches[0]->schema(), options, &stream));
+  for (const auto& batch : batches) {
+    ASSERT_OK(stream->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(stream->Close());
+
+  // The server rejects the upload once it is closed
+  ASSERT_OK(client_->DoPut(descr, batches[0]->schema(), options, &stream));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK(stream->WriteRecordBatch(*batches[i]));
+  }
+  ASSERT_RAISES(IOError, stream->Close());
+
+  options.max_batches_in_flight = -1;
+  ASSERT_RAISES(Invalid, client_->DoPut(descr, batches[0]->schema(), options, &stream));
+}
+
+TEST_F(TestFlightClient, ParallelDoGet) {
+  // The same ticket redeemed on this server, with and without its location.
+  FlightEndpoint remote({{"ticket-id-1"}, {{"localhost", port_}}});
+  FlightEndpoint local({{"ticket-id-1"}, {}});
+  FlightDescriptor descr{FlightDescriptor::PATH, "", {"foo", "bar"}};
+  FlightInfo::Data data;
+  ASSERT_OK(MakeFlightInfo(*ExampleSchema1(), descr, {remote, local, remote}, 15, -1,
+                           &data));
+  FlightInfo info(data);
+
+  BatchVector expected_batches;
+  const int num_batches = 5;
+  ASSERT_OK(SimpleIntegerBatches(num_batches, &expected_batches));
+
+  // In endpoint order, with little buffering.
+  ParallelDoGetOptions options;
+  options.parallelism = 2;
+  options.ordered = true;
+  options.max_buffered_batches = 1;
+  std::unique_ptr<RecordBatchReader> stream;
+  ASSERT_OK(client_->DoGet(info, options, &stream));
+  std::shared_ptr<RecordBatch> chunk;
+  for (int i = 0; i < 3 * num_batches; ++i) {
+    ASSERT_OK(stream->ReadNext(&chunk));
+    ASSERT_NE(nullptr, chunk);
+    ASSERT_BATCHES_EQUAL(*expected_batches[i % num_batches], *chunk);
+  }
+  ASSERT_OK(stream->ReadNext(&chunk));
+  ASSERT_EQ(nullptr, chunk);
+
+  // In arrival order.
+  options.ordered = false;
+  ASSERT_OK(client_->DoGet(info, options, &stream));
+  int64_t num_rows = 0;
+  for (int i = 0; i < 3 * num_batches; ++i) {
+    ASSERT_OK(stream->ReadNext(&chunk));
+    ASSERT_NE(nullptr, chunk);
+    num_rows += chunk->num_rows();
+  }
+  ASSERT_OK(stream->ReadNext(&chunk));
+  ASSERT_EQ(nullptr, chunk);
+  // Batch i has 10 + i rows.
+  ASSERT_EQ(3 * (10 + 11 + 12 + 13 + 14), num_rows);
+
+  // Errors of any endpoint are returned.
+  FlightEndpoint missing({{"ticket-id-2"}, {}});
+  ASSERT_OK(MakeFlightInfo(*ExampleSchema1(), descr, {local, missing}, 10, -1, &data));
+  ASSERT_OK(client_->DoGet(FlightInfo(data), options, &stream));
+  Status status;
+  do {
+    status = stream->ReadNext(&chunk);
+  } while (status.ok() && chunk != nullptr);
+  ASSERT_RAISES(NotImplemented, status);
+}
+
 TEST_F(TestFlightClient, ListActions) {
   std::vector<ActionType> actions;
   ASSERT_OK(client_->ListActions(&actions));
@@ -19,6 +19,7 @@
 #include "arrow/flight/protocol-internal.h"
 
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
@@ -31,6 +32,7 @@
 #include "arrow/ipc/writer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/io-util.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -65,6 +67,58 @@ grpc::Status ToGrpcStatus(const Status& arrow_status) {
   }
 }
 
+// Stream compression
+
+Status GetCompressionName(Compression::type compression, std::string* out) {
+  if (compression != Compression::LZ4 && compression != Compression::ZSTD) {
+    return Status::Invalid("Flight streams can only be compressed with LZ4 or ZSTD");
+  }
+  std::unique_ptr<util::Codec> codec;
+  RETURN_NOT_OK(util::Codec::Create(compression, &codec));
+  *out = codec->name();
+  return Status::OK();
+}
+
+Status GetCompressionFromName(const std::string& name, Compression::type* out) {
+  for (auto compression : {Compression::LZ4, Compression::ZSTD}) {
+    std::string supported_name;
+    if (GetCompressionName(compression, &supported_name).ok() &&
+        name == supported_name) {
+      *out = compression;
+      return Status::OK();
+    }
+  }
+  return Status::NotImplemented("Unsupported Flight stream compression: ", name);
+}
+
+bool IsLocalPeer(const std::string& peer) {
+  for (const char* prefix : {"unix:", "ipv4:127.", "ipv6:[::1]", "ipv6:[::ffff:127."}) {
+    if (peer.compare(0, strlen(prefix), prefix) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+Status CheckSharedMemoryFile(const std::string& path) {
+  const size_t name_start = path.find_last_of('/') + 1;
+  if (path.compare(name_start, strlen(kSharedMemoryPrefix), kSharedMemoryPrefix) != 0) {
+    return Status::Invalid("Not a file for record batch bodies: ", path);
+  }
+  ::arrow::internal::PlatformFilename file_name;
+  RETURN_NOT_OK(::arrow::internal::FileNameFromString(path, &file_name));
+  int fd;
+  RETURN_NOT_OK(::arrow::internal::FileOpenReadable(file_name, &fd));
+  int64_t size;
+  Status st = ::arrow::internal::FileGetSize(fd, &size);
+  RETURN_NOT_OK(::arrow::internal::FileClose(fd));
+  RETURN_NOT_OK(st);
+  if (size != 0) {
+    return Status::Invalid("The file for record batch bodies is not empty: ", path);
+  }
+  return Status::OK();
+}
+
 // ActionType
 
 Status FromProto(const pb::ActionType& pb_type, ActionType* type) {
@@ -22,6 +22,7 @@
 
 #include "arrow/flight/protocol-internal.h"  // IWYU pragma: keep
 #include "arrow/flight/types.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/macros.h"
 
 namespace grpc {
@@ -80,6 +81,33 @@ Status FromGrpcStatus(const grpc::Status& grpc_status);
 
 grpc::Status ToGrpcStatus(const Status& arrow_status);
 
+/// The gRPC metadata key with the codec of the record batches of a stream,
+/// requested by the client and acknowledged by the server
+static constexpr char kCompressionHeader[] = "arrow-flight-compression";
+
+/// Get the name of a codec supported for the record batches of streams
+Status GetCompressionName(Compression::type compression, std::string* out);
+
+/// Get the codec named by the client, if it is supported for the record
+/// batches of streams
+Status GetCompressionFromName(const std::string& name, Compression::type* out);
+
+/// The gRPC metadata keys with the name of the data plane that the client
+/// asks a DoGet stream to send the record batch bodies through, and with the
+/// address of its receiver
+static constexpr char kDataPlaneHeader[] = "arrow-flight-data-plane";
+static constexpr char kDataPlaneAddressHeader[] = "arrow-flight-data-plane-address";
+
+/// The prefix of the names of the files of the shared memory data plane.
+/// Servers don't write to others
+static constexpr char kSharedMemoryPrefix[] = "arrow-flight-shm-";
+
+/// Whether a gRPC peer, as given by ServerContext::peer(), is on this host
+bool IsLocalPeer(const std::string& peer);
+
+/// Check that the file at path is an empty file for record batch bodies
+Status CheckSharedMemoryFile(const std::string& path);
+
 }  // namespace internal
 }  // namespace flight
 }  // namespace arrow
@@ -53,6 +53,16 @@ namespace flight {
 
 using ArrayVector = std::vector<std::shared_ptr<Array>>;
 
+// The schema of the perf streams, with 4 int64 columns unless requested
+std::shared_ptr<Schema> PerfSchema(const perf::Perf& perf) {
+  const int num_columns = perf.num_columns() > 0 ? perf.num_columns() : 4;
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int i = 0; i < num_columns; ++i) {
+    fields.push_back(field("f" + std::to_string(i), int64()));
+  }
+  return schema(fields);
+}
+
 // Create record batches with a unique "a" column so we can verify on the
 // client side that the results are correct
 class PerfDataStream : public FlightDataStream {
@@ -117,8 +127,7 @@ Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& s
   std::vector<std::shared_ptr<Array>> arrays;
 
   const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
-  for (int i = 0; i < ncolumns; ++i) {
+  for (int i = 0; i < schema->num_fields(); ++i) {
     RETURN_NOT_OK(MakeRandomBuffer<int64_t>(length, default_memory_pool(), &buffer));
     arrays.push_back(std::make_shared<Int64Array>(length, buffer));
   }
@@ -131,10 +140,7 @@ Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& s
 
 class FlightPerfServer : public FlightServerBase {
  public:
-  FlightPerfServer() : location_(Location{"localhost", FLAGS_port}) {
-    perf_schema_ = schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                           field("d", int64())});
-  }
+  FlightPerfServer() : location_(Location{"localhost", FLAGS_port}) {}
 
   Status GetFlightInfo(const FlightDescriptor& request,
                        std::unique_ptr<FlightInfo>* info) override {
@@ -160,8 +166,8 @@ class FlightPerfServer : public FlightServerBase {
         perf_request.stream_count() * perf_request.records_per_stream();
 
     FlightInfo::Data data;
-    RETURN_NOT_OK(
-        MakeFlightInfo(*perf_schema_, request, endpoints, total_records, -1, &data));
+    RETURN_NOT_OK(MakeFlightInfo(*PerfSchema(perf_request), request, endpoints,
+                                 total_records, -1, &data));
     *info = std::unique_ptr<FlightInfo>(new FlightInfo(data));
     return Status::OK();
   }
@@ -170,12 +176,36 @@ class FlightPerfServer : public FlightServerBase {
                std::unique_ptr<FlightDataStream>* data_stream) override {
     perf::Token token;
     CHECK_PARSE(token.ParseFromString(request.ticket));
-    return GetPerfBatches(token, perf_schema_, false, data_stream);
+    return GetPerfBatches(token, PerfSchema(token.definition()), false, data_stream);
+  }
+
+  Status DoPut(std::unique_ptr<FlightMessageReader> reader) override {
+    // Deserialize and drop the batches
+    std::shared_ptr<RecordBatch> batch;
+    do {
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+    } while (batch != nullptr);
+    return Status::OK();
+  }
+
+  Status DoAction(const Action& action, std::unique_ptr<ResultStream>* out) override {
+    if (action.type != "cpu-time") {
+      return Status::NotImplemented(action.type);
+    }
+    // The CPU time of the server, for the benchmark to measure the CPU used
+    // by its streams
+    double seconds;
+    RETURN_NOT_OK(GetCpuTime(&seconds));
+    perf::CpuTime cpu_time;
+    cpu_time.set_seconds(seconds);
+    Result result;
+    RETURN_NOT_OK(Buffer::FromString(cpu_time.SerializeAsString(), &result.body));
+    *out = std::unique_ptr<ResultStream>(new SimpleResultStream({result}));
+    return Status::OK();
   }
 
  private:
   Location location_;
-  std::shared_ptr<Schema> perf_schema_;
 };
 
 }  // namespace flight
@@ -17,7 +17,9 @@
 
 #include "arrow/flight/serialization-internal.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <string>
 #include <vector>
@@ -46,21 +48,10 @@ using arrow::ipc::internal::IpcPayload;
 
 using google::protobuf::internal::WireFormatLite;
 using google::protobuf::io::ArrayOutputStream;
-using google::protobuf::io::CodedInputStream;
 using google::protobuf::io::CodedOutputStream;
 
 using grpc::ByteBuffer;
 
-bool ReadBytesZeroCopy(const std::shared_ptr<Buffer>& source_data,
-                       CodedInputStream* input, std::shared_ptr<Buffer>* out) {
-  uint32_t length;
-  if (!input->ReadVarint32(&length)) {
-    return false;
-  }
-  *out = SliceBuffer(source_data, input->CurrentPosition(), static_cast<int64_t>(length));
-  return input->Skip(static_cast<int>(length));
-}
-
 // Internal wrapper for gRPC ByteBuffer so its memory can be exposed to Arrow
 // consumers with zero-copy
 class GrpcBuffer : public MutableBuffer {
@@ -75,44 +66,92 @@ class GrpcBuffer : public MutableBuffer {
     grpc_slice_unref(slice_);
   }
 
-  static Status Wrap(ByteBuffer* cpp_buf, std::shared_ptr<Buffer>* out) {
-    // These types are guaranteed by static assertions in gRPC to have the same
-    // in-memory representation
-
-    auto buffer = *reinterpret_cast<grpc_byte_buffer**>(cpp_buf);
+ private:
+  grpc_slice slice_;
+};
 
-    // This part below is based on the Flatbuffers gRPC SerializationTraits in
-    // flatbuffers/grpc.h
+// Reads the length-delimited fields of a protobuf message from the slices of a
+// gRPC ByteBuffer. A field that lies within one slice is exposed to Arrow
+// consumers with zero-copy, and only a field spanning slices is copied.
+class SliceReader {
+ public:
+  SliceReader(const grpc_slice* slices, size_t num_slices)
+      : slices_(slices), num_slices_(num_slices), index_(0), position_(0) {
+    SkipConsumedSlices();
+  }
 
-    // Check if this is a single uncompressed slice.
-    if ((buffer->type == GRPC_BB_RAW) &&
-        (buffer->data.raw.compression == GRPC_COMPRESS_NONE) &&
-        (buffer->data.raw.slice_buffer.count == 1)) {
-      // If it is, then we can reference the `grpc_slice` directly.
-      grpc_slice slice = buffer->data.raw.slice_buffer.slices[0];
+  bool Done() const { return index_ == num_slices_; }
 
-      // Increment reference count so this memory remains valid
-      *out = std::make_shared<GrpcBuffer>(slice, true);
-    } else {
-      // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
-      // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
-      // us back a new slice with the refcount already incremented.
-      grpc_byte_buffer_reader reader;
-      if (!grpc_byte_buffer_reader_init(&reader, buffer)) {
-        return Status::IOError("Internal gRPC error reading from ByteBuffer");
+  bool ReadVarint(uint64_t* out) {
+    *out = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (Done()) {
+        return false;
+      }
+      const uint8_t byte = GRPC_SLICE_START_PTR(slices_[index_])[position_];
+      ++position_;
+      SkipConsumedSlices();
+      *out |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+        return true;
       }
-      grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
-      grpc_byte_buffer_reader_destroy(&reader);
+    }
+    return false;
+  }
 
-      // Steal the slice reference
-      *out = std::make_shared<GrpcBuffer>(slice, false);
+  Status ReadBytes(int64_t length, std::shared_ptr<Buffer>* out) {
+    if (length == 0) {
+      *out = std::make_shared<Buffer>(nullptr, 0);
+      return Status::OK();
+    }
+    if (Done()) {
+      return Status::IOError("Unexpected end of FlightData");
     }
 
+    const grpc_slice& slice = slices_[index_];
+    if (position_ + length <= static_cast<int64_t>(GRPC_SLICE_LENGTH(slice))) {
+      // Increment reference count so this memory remains valid
+      auto wrapped = std::make_shared<GrpcBuffer>(slice, true);
+      *out = SliceBuffer(wrapped, position_, length);
+      position_ += length;
+      SkipConsumedSlices();
+      return Status::OK();
+    }
+
+    std::shared_ptr<Buffer> copy;
+    RETURN_NOT_OK(AllocateBuffer(length, &copy));
+    uint8_t* dest = copy->mutable_data();
+    int64_t remaining = length;
+    while (remaining > 0) {
+      if (Done()) {
+        return Status::IOError("Unexpected end of FlightData");
+      }
+      const grpc_slice& current = slices_[index_];
+      const int64_t chunk = std::min(
+          remaining, static_cast<int64_t>(GRPC_SLICE_LENGTH(current)) - position_);
+      memcpy(dest, GRPC_SLICE_START_PTR(current) + position_, chunk);
+      dest += chunk;
+      remaining -= chunk;
+      position_ += chunk;
+      SkipConsumedSlices();
+    }
+    *out = copy;
     return Status::OK();
   }
 
  private:
-  grpc_slice slice_;
+  void SkipConsumedSlices() {
+    while (index_ < num_slices_ &&
+           position_ == static_cast<int64_t>(GRPC_SLICE_LENGTH(slices_[index_]))) {
+      ++index_;
+      position_ = 0;
+    }
+  }
+
+  const grpc_slice* slices_;
+  const size_t num_slices_;
+  size_t index_;
+  int64_t position_;
 };
 
 // Destructor callback for grpc::Slice
@@ -222,7 +261,8 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
       const auto remainder = static_cast<int>(
           BitUtil::RoundUpToMultipleOf8(buffer->size()) - buffer->size());
       if (remainder) {
-        slices.push_back(grpc::Slice(kPaddingBytes, remainder));
+        slices.push_back(
+            grpc::Slice(kPaddingBytes, remainder, grpc::Slice::STATIC_SLICE));
       }
     }
   }
@@ -235,64 +275,82 @@ grpc::Status FlightDataSerialize(const FlightPayload& msg, ByteBuffer* out,
   return grpc::Status::OK;
 }
 
-// Read internal::FlightData from grpc::ByteBuffer containing FlightData
-// protobuf without copying
-grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
-  if (!buffer) {
-    return grpc::Status(grpc::StatusCode::INTERNAL, "No payload");
-  }
-
-  std::shared_ptr<arrow::Buffer> wrapped_buffer;
-  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
-
-  auto buffer_length = static_cast<int>(wrapped_buffer->size());
-  CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
-
-  // TODO(wesm): The 2-parameter version of this function is deprecated
-  pb_stream.SetTotalBytesLimit(buffer_length, -1 /* no threshold */);
+// Read the fields of the FlightData message into internal::FlightData
+static Status ReadFlightData(SliceReader* reader, FlightData* out) {
+  while (!reader->Done()) {
+    uint64_t tag;
+    uint64_t length;
+    if (!reader->ReadVarint(&tag) ||
+        WireFormatLite::GetTagWireType(static_cast<uint32_t>(tag)) !=
+            WireFormatLite::WIRETYPE_LENGTH_DELIMITED ||
+        !reader->ReadVarint(&length) || length > static_cast<uint64_t>(kInt32Max)) {
+      return Status::IOError("Unable to parse FlightData field");
+    }
 
-  // This is the bytes remaining when using CodedInputStream like this
-  while (pb_stream.BytesUntilTotalBytesLimit()) {
-    const uint32_t tag = pb_stream.ReadTag();
-    const int field_number = WireFormatLite::GetTagFieldNumber(tag);
-    switch (field_number) {
+    std::shared_ptr<Buffer> value;
+    RETURN_NOT_OK(reader->ReadBytes(static_cast<int64_t>(length), &value));
+    switch (WireFormatLite::GetTagFieldNumber(static_cast<uint32_t>(tag))) {
       case pb::FlightData::kFlightDescriptorFieldNumber: {
         pb::FlightDescriptor pb_descriptor;
-        uint32_t length;
-        if (!pb_stream.ReadVarint32(&length)) {
-          return grpc::Status(grpc::StatusCode::INTERNAL,
-                              "Unable to parse length of FlightDescriptor");
-        }
-        // Can't use ParseFromCodedStream as this reads the entire
-        // rest of the stream into the descriptor command field.
-        std::string buffer;
-        pb_stream.ReadString(&buffer, length);
-        if (!pb_descriptor.ParseFromString(buffer)) {
-          return grpc::Status(grpc::StatusCode::INTERNAL,
-                              "Unable to parse FlightDescriptor");
+        if (!pb_descriptor.ParseFromArray(value->data(),
+                                          static_cast<int>(value->size()))) {
+          return Status::IOError("Unable to parse FlightDescriptor");
         }
         arrow::flight::FlightDescriptor descriptor;
-        GRPC_RETURN_NOT_OK(
-            arrow::flight::internal::FromProto(pb_descriptor, &descriptor));
+        RETURN_NOT_OK(arrow::flight::internal::FromProto(pb_descriptor, &descriptor));
         out->descriptor.reset(new arrow::flight::FlightDescriptor(descriptor));
       } break;
-      case pb::FlightData::kDataHeaderFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->metadata)) {
-          return grpc::Status(grpc::StatusCode::INTERNAL,
-                              "Unable to read FlightData metadata");
-        }
-      } break;
-      case pb::FlightData::kDataBodyFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->body)) {
-          return grpc::Status(grpc::StatusCode::INTERNAL,
-                              "Unable to read FlightData body");
-        }
-      } break;
+      case pb::FlightData::kDataHeaderFieldNumber:
+        out->metadata = value;
+        break;
+      case pb::FlightData::kDataBodyFieldNumber:
+        out->body = value;
+        break;
       default:
-        DCHECK(false) << "cannot happen";
+        // Skip unknown fields, like protobuf does.
+        break;
     }
   }
+  return Status::OK();
+}
+
+// Read internal::FlightData from grpc::ByteBuffer containing FlightData
+// protobuf without copying
+grpc::Status FlightDataDeserialize(ByteBuffer* buffer, FlightData* out) {
+  if (!buffer) {
+    return grpc::Status(grpc::StatusCode::INTERNAL, "No payload");
+  }
+
+  // These types are guaranteed by static assertions in gRPC to have the same
+  // in-memory representation
+  auto raw_buffer = *reinterpret_cast<grpc_byte_buffer**>(buffer);
+
+  Status status;
+  if ((raw_buffer->type == GRPC_BB_RAW) &&
+      (raw_buffer->data.raw.compression == GRPC_COMPRESS_NONE)) {
+    // Reference the slices directly.
+    const grpc_slice_buffer& slice_buffer = raw_buffer->data.raw.slice_buffer;
+    SliceReader reader(slice_buffer.slices, slice_buffer.count);
+    status = ReadFlightData(&reader, out);
+  } else {
+    // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to decompress
+    // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
+    // us back a new slice with the refcount already incremented.
+    grpc_byte_buffer_reader byte_buffer_reader;
+    if (!grpc_byte_buffer_reader_init(&byte_buffer_reader, raw_buffer)) {
+      return grpc::Status(grpc::StatusCode::INTERNAL,
+                          "Internal gRPC error reading from ByteBuffer");
+    }
+    grpc_slice slice = grpc_byte_buffer_reader_readall(&byte_buffer_reader);
+    grpc_byte_buffer_reader_destroy(&byte_buffer_reader);
+
+    SliceReader reader(&slice, 1);
+    status = ReadFlightData(&reader, out);
+    // The buffers read hold their own references to the slice.
+    grpc_slice_unref(slice);
+  }
   buffer->Clear();
+  GRPC_RETURN_NOT_OK(status);
 
   // TODO(wesm): Where and when should we verify that the FlightData is not
   // malformed or missing components?
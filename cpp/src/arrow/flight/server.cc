@@ -18,8 +18,14 @@
 #include "arrow/flight/server.h"
 #include "arrow/flight/protocol-internal.h"
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -32,7 +38,9 @@
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
 
+#include "arrow/flight/data-plane.h"
 #include "arrow/flight/internal.h"
 #include "arrow/flight/serialization-internal.h"
 #include "arrow/flight/types.h"
@@ -100,11 +108,98 @@ class FlightMessageReaderImpl : public FlightMessageReader {
   bool stream_finished_;
 };
 
+// Generates the payloads of a DoGet stream ahead of the network on an
+// executor. The generation is a task that returns once the payloads are
+// buffered, rather than blocking a thread of the executor for the stream.
+class PayloadPrefetcher {
+ public:
+  PayloadPrefetcher(std::function<Status(FlightPayload*)> next_payload,
+                    ::arrow::internal::ThreadPool* executor, int depth)
+      : next_payload_(std::move(next_payload)),
+        executor_(executor),
+        depth_(static_cast<size_t>(std::max(depth, 1))),
+        running_(false),
+        finished_(false) {}
+
+  ~PayloadPrefetcher() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    finished_ = true;
+    ready_.wait(lock, [this] { return !running_; });
+  }
+
+  // Get the next payload of the stream. A null metadata ends the stream.
+  Status Next(FlightPayload* payload) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    Schedule();
+    ready_.wait(lock, [this] { return !queue_.empty() || (finished_ && !running_); });
+    if (queue_.empty()) {
+      RETURN_NOT_OK(status_);
+      payload->ipc_message.metadata = nullptr;
+      return Status::OK();
+    }
+    *payload = std::move(queue_.front());
+    queue_.pop_front();
+    Schedule();
+    return Status::OK();
+  }
+
+ private:
+  // Start generating payloads unless it's underway or the buffer is full.
+  // The mutex must be held.
+  void Schedule() {
+    if (running_ || finished_ || queue_.size() >= depth_) {
+      return;
+    }
+    running_ = true;
+    Status st = executor_->Spawn([this] { Generate(); });
+    if (!st.ok()) {
+      status_ = st;
+      finished_ = true;
+      running_ = false;
+    }
+  }
+
+  void Generate() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!finished_ && queue_.size() < depth_) {
+      lock.unlock();
+      FlightPayload payload;
+      Status st = next_payload_(&payload);
+      lock.lock();
+      if (!st.ok()) {
+        status_ = st;
+        finished_ = true;
+      } else if (payload.ipc_message.metadata == nullptr) {
+        finished_ = true;
+      } else {
+        queue_.push_back(std::move(payload));
+      }
+      ready_.notify_all();
+    }
+    running_ = false;
+    ready_.notify_all();
+  }
+
+  std::function<Status(FlightPayload*)> next_payload_;
+  ::arrow::internal::ThreadPool* executor_;
+  const size_t depth_;
+
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<FlightPayload> queue_;
+  bool running_;
+  bool finished_;
+  Status status_;
+};
+
 // This class glues an implementation of FlightServerBase together with the
 // gRPC service definition, so the latter is not exposed in the public API
 class FlightServiceImpl : public FlightService::Service {
  public:
-  explicit FlightServiceImpl(FlightServerBase* server) : server_(server) {}
+  explicit FlightServiceImpl(FlightServerBase* server,
+                             const FlightServerOptions& options = FlightServerOptions(),
+                             ::arrow::internal::ThreadPool* executor = nullptr)
+      : server_(server), options_(options), executor_(executor) {}
 
   template <typename UserType, typename Iterator, typename ProtoType>
   grpc::Status WriteStream(Iterator* iterator, ServerWriter<ProtoType>* writer) {
@@ -180,6 +275,38 @@ class FlightServiceImpl : public FlightService::Service {
     std::unique_ptr<FlightDataStream> data_stream;
     GRPC_RETURN_NOT_OK(server_->DoGet(ticket, &data_stream));
 
+    // Compress the record batches with the codec requested by the client, if
+    // it is supported, and acknowledge it.
+    bool compressed = false;
+    auto header = context->client_metadata().find(internal::kCompressionHeader);
+    if (header != context->client_metadata().end()) {
+      std::string name(header->second.data(), header->second.size());
+      ipc::IpcWriteOptions options;
+      if (internal::GetCompressionFromName(name, &options.compression).ok()) {
+        data_stream->SetWriteOptions(options);
+        context->AddInitialMetadata(internal::kCompressionHeader, name);
+        compressed = true;
+      }
+    }
+
+    // Send the record batch bodies through the data plane the client asked
+    // for, if it is registered and reaches the client, so that only the
+    // metadata goes through gRPC.
+    std::shared_ptr<DataPlaneSender> data_plane_sender;
+    header = context->client_metadata().find(internal::kDataPlaneHeader);
+    auto address = context->client_metadata().find(internal::kDataPlaneAddressHeader);
+    if (header != context->client_metadata().end() &&
+        address != context->client_metadata().end()) {
+      std::string name(header->second.data(), header->second.size());
+      std::string receiver(address->second.data(), address->second.size());
+      std::shared_ptr<DataPlane> data_plane;
+      std::unique_ptr<DataPlaneSender> sender;
+      if (GetDataPlane(name, &data_plane).ok() &&
+          data_plane->MakeSender(context->peer(), receiver, &sender).ok()) {
+        data_plane_sender = std::move(sender);
+      }
+    }
+
     // Write the schema as the first message in the stream
     FlightPayload schema_payload;
     MemoryPool* pool = default_memory_pool();
@@ -192,9 +319,28 @@ class FlightServiceImpl : public FlightService::Service {
     writer->Write(*reinterpret_cast<const pb::FlightData*>(&schema_payload),
                   grpc::WriteOptions());
 
+    FlightDataStream* stream = data_stream.get();
+    auto next_payload = [stream, data_plane_sender](FlightPayload* payload) {
+      RETURN_NOT_OK(stream->Next(payload));
+      if (data_plane_sender != nullptr && payload->ipc_message.metadata != nullptr) {
+        // Leave only the metadata to be sent. The client reads the bodies in
+        // the order of the messages.
+        RETURN_NOT_OK(data_plane_sender->WriteBody(payload->ipc_message.body_buffers));
+        payload->ipc_message.body_buffers.clear();
+        payload->ipc_message.body_length = 0;
+      }
+      return Status::OK();
+    };
+    if (executor_ != nullptr) {
+      PayloadPrefetcher prefetcher(next_payload, executor_, options_.prefetch_payloads);
+      return WritePrefetchedStream(&prefetcher, writer);
+    }
+    if (compressed) {
+      return WriteCompressedStream(next_payload, writer);
+    }
     while (true) {
       FlightPayload payload;
-      GRPC_RETURN_NOT_OK(data_stream->Next(&payload));
+      GRPC_RETURN_NOT_OK(next_payload(&payload));
       if (payload.ipc_message.metadata == nullptr ||
           !writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
                          grpc::WriteOptions())) {
@@ -206,6 +352,47 @@ class FlightServiceImpl : public FlightService::Service {
     return grpc::Status::OK;
   }
 
+  // Compress the next payload on another thread while the current one is
+  // written, so that compression doesn't hold up the writes. The buffers of
+  // each payload are compressed on the CPU thread pool.
+  template <typename NextPayload>
+  grpc::Status WriteCompressedStream(NextPayload next_payload,
+                                     ServerWriter<pb::FlightData>* writer) {
+    auto payload = std::make_shared<FlightPayload>();
+    std::future<Status> pending =
+        std::async(std::launch::async, next_payload, payload.get());
+    while (true) {
+      GRPC_RETURN_NOT_OK(pending.get());
+      if (payload->ipc_message.metadata == nullptr) {
+        break;
+      }
+      auto next = std::make_shared<FlightPayload>();
+      pending = std::async(std::launch::async, next_payload, next.get());
+      if (!writer->Write(*reinterpret_cast<const pb::FlightData*>(payload.get()),
+                         grpc::WriteOptions())) {
+        // Connection terminated; wait for the payload being computed.
+        pending.wait();
+        break;
+      }
+      payload = next;
+    }
+    return grpc::Status::OK;
+  }
+
+  grpc::Status WritePrefetchedStream(PayloadPrefetcher* prefetcher,
+                                     ServerWriter<pb::FlightData>* writer) {
+    while (true) {
+      FlightPayload payload;
+      GRPC_RETURN_NOT_OK(prefetcher->Next(&payload));
+      if (payload.ipc_message.metadata == nullptr ||
+          !writer->Write(*reinterpret_cast<const pb::FlightData*>(&payload),
+                         grpc::WriteOptions())) {
+        break;
+      }
+    }
+    return grpc::Status::OK;
+  }
+
   grpc::Status DoPut(ServerContext* context, grpc::ServerReader<pb::FlightData>* reader,
                      pb::PutResult* response) {
     // Get metadata
@@ -272,6 +459,9 @@ class FlightServiceImpl : public FlightService::Service {
 
  private:
   FlightServerBase* server_;
+  FlightServerOptions options_;
+  // Runs FlightDataStream::Next for DoGet, if configured
+  ::arrow::internal::ThreadPool* executor_;
 };
 
 struct FlightServerBase::FlightServerBaseImpl {
@@ -282,13 +472,27 @@ FlightServerBase::FlightServerBase() { impl_.reset(new FlightServerBaseImpl); }
 
 FlightServerBase::~FlightServerBase() {}
 
-void FlightServerBase::Run(int port) {
+void FlightServerBase::Run(int port) { Run(port, FlightServerOptions()); }
+
+void FlightServerBase::Run(int port, const FlightServerOptions& options) {
   std::string address = "localhost:" + std::to_string(port);
 
-  FlightServiceImpl service(this);
+  std::shared_ptr<::arrow::internal::ThreadPool> executor;
+  if (options.data_stream_threads > 0) {
+    ARROW_CHECK_OK(
+        ::arrow::internal::ThreadPool::Make(options.data_stream_threads, &executor));
+  }
+  FlightServiceImpl service(this, options, executor.get());
   grpc::ServerBuilder builder;
   builder.AddListeningPort(address, grpc::InsecureServerCredentials());
   builder.RegisterService(&service);
+  if (options.max_grpc_threads > 0) {
+    grpc::ResourceQuota quota;
+    quota.SetMaxThreads(options.max_grpc_threads);
+    builder.SetResourceQuota(quota);
+    builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::MAX_POLLERS,
+                                options.max_grpc_threads);
+  }
 
   impl_->server = builder.BuildAndStart();
   std::cout << "Server listening on " << address << std::endl;
@@ -333,7 +537,9 @@ Status FlightServerBase::ListActions(std::vector<ActionType>* actions) {
 // Implement RecordBatchStream
 
 RecordBatchStream::RecordBatchStream(const std::shared_ptr<RecordBatchReader>& reader)
-    : pool_(default_memory_pool()), reader_(reader) {}
+    : pool_(default_memory_pool()),
+      options_(ipc::IpcWriteOptions::Defaults()),
+      reader_(reader) {}
 
 std::shared_ptr<Schema> RecordBatchStream::schema() { return reader_->schema(); }
 
@@ -346,9 +552,14 @@ Status RecordBatchStream::Next(FlightPayload* payload) {
     payload->ipc_message.metadata = nullptr;
     return Status::OK();
   } else {
-    return ipc::internal::GetRecordBatchPayload(*batch, pool_, &payload->ipc_message);
+    return ipc::internal::GetRecordBatchPayload(*batch, options_, pool_,
+                                                &payload->ipc_message);
   }
 }
 
+void RecordBatchStream::SetWriteOptions(const ipc::IpcWriteOptions& options) {
+  options_ = options;
+}
+
 }  // namespace flight
 }  // namespace arrow
@@ -48,6 +48,11 @@ class ARROW_EXPORT FlightDataStream {
   // When the stream is completed, the last payload written will have null
   // metadata
   virtual Status Next(FlightPayload* payload) = 0;
+
+  /// \brief Set the options of the record batch payloads, such as the
+  /// compression negotiated with the client, before the first call to Next().
+  /// Streams that don't serialize record batches themselves may ignore them
+  virtual void SetWriteOptions(const ipc::IpcWriteOptions& options) {}
 };
 
 /// \brief A basic implementation of FlightDataStream that will provide
@@ -59,9 +64,11 @@ class ARROW_EXPORT RecordBatchStream : public FlightDataStream {
 
   std::shared_ptr<Schema> schema() override;
   Status Next(FlightPayload* payload) override;
+  void SetWriteOptions(const ipc::IpcWriteOptions& options) override;
 
  private:
   MemoryPool* pool_;
+  ipc::IpcWriteOptions options_;
   std::shared_ptr<RecordBatchReader> reader_;
 };
 
@@ -72,6 +79,22 @@ class ARROW_EXPORT FlightMessageReader : public RecordBatchReader {
   virtual const FlightDescriptor& descriptor() const = 0;
 };
 
+/// \brief Options for running a FlightServerBase
+struct ARROW_EXPORT FlightServerOptions {
+  /// The maximum number of gRPC threads running calls, or 0 for gRPC's
+  /// default. Slow streams then can't take all the threads of the host
+  int max_grpc_threads = 0;
+
+  /// The number of threads of an executor to call FlightDataStream::Next on
+  /// for DoGet, so that generating batches doesn't hold up the writes to the
+  /// network. When 0, Next is called by the gRPC thread writing the stream
+  int data_stream_threads = 0;
+
+  /// The number of payloads of each DoGet stream generated ahead of the
+  /// network by the executor
+  int prefetch_payloads = 2;
+};
+
 /// \brief Skeleton RPC server implementation which can be used to create
 /// custom servers by implementing its abstract methods
 class ARROW_EXPORT FlightServerBase {
@@ -84,6 +107,11 @@ class ARROW_EXPORT FlightServerBase {
   /// \param[in] port the port to bind to
   void Run(int port);
 
+  /// \brief Like the above, with options for the threads serving the calls
+  /// \param[in] port the port to bind to
+  /// \param[in] options the options of the server
+  void Run(int port, const FlightServerOptions& options);
+
   /// \brief Shut down the server. Can be called from signal handler or another
   /// thread while Run blocks
   ///
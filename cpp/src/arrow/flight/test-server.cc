@@ -81,6 +81,30 @@ class FlightTestServer : public FlightServerBase {
     return Status::OK();
   }
 
+  Status DoPut(std::unique_ptr<FlightMessageReader> reader) override {
+    // Accept the batches of ticket-id-1
+    BatchVector expected_batches;
+    RETURN_NOT_OK(SimpleIntegerBatches(5, &expected_batches));
+    size_t num_batches = 0;
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) {
+        break;
+      }
+      if (num_batches == expected_batches.size() ||
+          !batch->Equals(*expected_batches[num_batches])) {
+        return Status::Invalid("Unexpected batch ", num_batches);
+      }
+      ++num_batches;
+    }
+    if (num_batches != expected_batches.size()) {
+      return Status::Invalid("Expected ", expected_batches.size(), " batches, got ",
+                             num_batches);
+    }
+    return Status::OK();
+  }
+
   Status RunAction1(const Action& action, std::unique_ptr<ResultStream>* out) {
     std::vector<Result> results;
     for (int i = 0; i < 3; ++i) {
@@ -20,6 +20,8 @@
 #include <mach-o/dyld.h>
 #endif
 
+#include <sys/resource.h>
+
 #include <sstream>
 
 #include <boost/filesystem.hpp>
@@ -159,5 +161,15 @@ std::vector<ActionType> ExampleActionTypes() {
   return {{"drop", "drop a dataset"}, {"cache", "cache a dataset"}};
 }
 
+Status GetCpuTime(double* seconds) {
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return Status::IOError("getrusage failed");
+  }
+  *seconds = static_cast<double>(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) +
+             static_cast<double>(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+  return Status::OK();
+}
+
 }  // namespace flight
 }  // namespace arrow
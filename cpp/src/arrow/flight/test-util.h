@@ -114,5 +114,12 @@ Status SimpleIntegerBatches(const int num_batches, BatchVector* out);
 ARROW_EXPORT
 std::vector<ActionType> ExampleActionTypes();
 
+// ----------------------------------------------------------------------
+// Resource usage for benchmarks
+
+/// \brief Get the user and system CPU time used by this process
+ARROW_EXPORT
+Status GetCpuTime(double* seconds);
+
 }  // namespace flight
 }  // namespace arrow
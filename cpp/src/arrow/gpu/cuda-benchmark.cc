@@ -17,14 +17,21 @@
 
 #include "benchmark/benchmark.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/api.h"
 #include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
+#include "arrow/type.h"
 
 #include "arrow/gpu/cuda_api.h"
 
@@ -33,6 +40,14 @@ namespace cuda {
 
 constexpr int64_t kGpuNumber = 0;
 
+static std::shared_ptr<CudaContext> GetContext() {
+  CudaDeviceManager* manager;
+  ABORT_NOT_OK(CudaDeviceManager::GetInstance(&manager));
+  std::shared_ptr<CudaContext> context;
+  ABORT_NOT_OK(manager->GetContext(kGpuNumber, &context));
+  return context;
+}
+
 static void CudaBufferWriterBenchmark(benchmark::State& state, const int64_t total_bytes,
                                       const int64_t chunksize,
                                       const int64_t buffer_size) {
@@ -95,5 +110,246 @@ BENCHMARK(BM_Writer_Unbuffered)
     ->MinTime(1.0)
     ->UseRealTime();
 
+// ----------------------------------------------------------------------
+// Allocation
+
+static void BM_Allocate_Context(benchmark::State& state) {
+  const int64_t size = state.range(0);
+  std::shared_ptr<CudaContext> context = GetContext();
+  while (state.KeepRunning()) {
+    std::shared_ptr<CudaBuffer> buffer;
+    ABORT_NOT_OK(context->Allocate(size, &buffer));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * size);
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_Allocate_Pool(benchmark::State& state) {
+  const int64_t size = state.range(0);
+  std::shared_ptr<CudaMemoryPool> pool;
+  ABORT_NOT_OK(CudaMemoryPool::Make(GetContext(), &pool));
+  while (state.KeepRunning()) {
+    std::shared_ptr<CudaBuffer> buffer;
+    ABORT_NOT_OK(pool->AllocateBuffer(size, &buffer));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * size);
+  state.SetItemsProcessed(state.iterations());
+}
+
+// Vary allocation size from 4KB to 64MB
+BENCHMARK(BM_Allocate_Context)->RangeMultiplier(16)->Range(1 << 12, 1 << 26);
+
+BENCHMARK(BM_Allocate_Pool)->RangeMultiplier(16)->Range(1 << 12, 1 << 26);
+
+// ----------------------------------------------------------------------
+// Host/device copies
+
+enum class HostMemory { PAGEABLE, PINNED };
+
+static std::shared_ptr<Buffer> MakeHostBuffer(HostMemory memory, int64_t size) {
+  std::shared_ptr<Buffer> buffer;
+  if (memory == HostMemory::PINNED) {
+    CudaDeviceManager* manager;
+    ABORT_NOT_OK(CudaDeviceManager::GetInstance(&manager));
+    std::shared_ptr<CudaHostBuffer> pinned;
+    ABORT_NOT_OK(manager->AllocateHost(kGpuNumber, size, &pinned));
+    buffer = pinned;
+  } else {
+    ABORT_NOT_OK(AllocateBuffer(default_memory_pool(), size, &buffer));
+  }
+  random_bytes(size, 0, buffer->mutable_data());
+  return buffer;
+}
+
+// Copy the host buffer in chunks of the given size, which are queued all at
+// once if async
+static void CopyToDeviceBenchmark(benchmark::State& state, HostMemory memory,
+                                  bool async) {
+  const int64_t kTotalBytes = 1 << 28;
+  const int64_t chunk_size = state.range(0);
+  std::shared_ptr<CudaContext> context = GetContext();
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ABORT_NOT_OK(context->Allocate(kTotalBytes, &device_buffer));
+  std::shared_ptr<Buffer> host_buffer = MakeHostBuffer(memory, kTotalBytes);
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<CudaEvent> done;
+    for (int64_t offset = 0; offset < kTotalBytes; offset += chunk_size) {
+      const int64_t nbytes = std::min(chunk_size, kTotalBytes - offset);
+      if (async) {
+        ABORT_NOT_OK(device_buffer->CopyFromHostAsync(
+            offset, host_buffer->data() + offset, nbytes, nullptr, &done));
+      } else {
+        ABORT_NOT_OK(
+            device_buffer->CopyFromHost(offset, host_buffer->data() + offset, nbytes));
+      }
+    }
+    if (done) {
+      ABORT_NOT_OK(done->Wait());
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalBytes);
+}
+
+static void CopyToHostBenchmark(benchmark::State& state, HostMemory memory,
+                                bool async) {
+  const int64_t kTotalBytes = 1 << 28;
+  const int64_t chunk_size = state.range(0);
+  std::shared_ptr<CudaContext> context = GetContext();
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ABORT_NOT_OK(context->Allocate(kTotalBytes, &device_buffer));
+  std::shared_ptr<Buffer> host_buffer = MakeHostBuffer(memory, kTotalBytes);
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<CudaEvent> done;
+    for (int64_t offset = 0; offset < kTotalBytes; offset += chunk_size) {
+      const int64_t nbytes = std::min(chunk_size, kTotalBytes - offset);
+      uint8_t* out = host_buffer->mutable_data() + offset;
+      if (async) {
+        ABORT_NOT_OK(device_buffer->CopyToHostAsync(offset, nbytes, out, nullptr, &done));
+      } else {
+        ABORT_NOT_OK(device_buffer->CopyToHost(offset, nbytes, out));
+      }
+    }
+    if (done) {
+      ABORT_NOT_OK(done->Wait());
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalBytes);
+}
+
+static void BM_CopyToDevice_Pageable(benchmark::State& state) {
+  CopyToDeviceBenchmark(state, HostMemory::PAGEABLE, false);
+}
+
+static void BM_CopyToDevice_Pinned(benchmark::State& state) {
+  CopyToDeviceBenchmark(state, HostMemory::PINNED, false);
+}
+
+static void BM_CopyToDevice_PinnedAsync(benchmark::State& state) {
+  CopyToDeviceBenchmark(state, HostMemory::PINNED, true);
+}
+
+static void BM_CopyToDevice_Staged(benchmark::State& state) {
+  // Pageable memory through 4 pinned buffers of the chunk size
+  const int64_t kTotalBytes = 1 << 28;
+  std::shared_ptr<CudaContext> context = GetContext();
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ABORT_NOT_OK(context->Allocate(kTotalBytes, &device_buffer));
+  std::shared_ptr<Buffer> host_buffer = MakeHostBuffer(HostMemory::PAGEABLE, kTotalBytes);
+  std::shared_ptr<CudaHostBufferPool> staging;
+  ABORT_NOT_OK(CudaHostBufferPool::Make(context, state.range(0), 4, &staging));
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<CudaEvent> done;
+    ABORT_NOT_OK(staging->CopyToDevice(host_buffer->data(), kTotalBytes,
+                                       device_buffer.get(), 0, nullptr, &done));
+    ABORT_NOT_OK(done->Wait());
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalBytes);
+}
+
+static void BM_CopyToHost_Pageable(benchmark::State& state) {
+  CopyToHostBenchmark(state, HostMemory::PAGEABLE, false);
+}
+
+static void BM_CopyToHost_Pinned(benchmark::State& state) {
+  CopyToHostBenchmark(state, HostMemory::PINNED, false);
+}
+
+static void BM_CopyToHost_PinnedAsync(benchmark::State& state) {
+  CopyToHostBenchmark(state, HostMemory::PINNED, true);
+}
+
+// Vary the copy size from 64KB to 256MB
+#define COPY_BENCHMARK(NAME) \
+  BENCHMARK(NAME)->RangeMultiplier(16)->Range(1 << 16, 1 << 28)->UseRealTime()
+
+COPY_BENCHMARK(BM_CopyToDevice_Pageable);
+COPY_BENCHMARK(BM_CopyToDevice_Pinned);
+COPY_BENCHMARK(BM_CopyToDevice_PinnedAsync);
+COPY_BENCHMARK(BM_CopyToDevice_Staged);
+COPY_BENCHMARK(BM_CopyToHost_Pageable);
+COPY_BENCHMARK(BM_CopyToHost_Pinned);
+COPY_BENCHMARK(BM_CopyToHost_PinnedAsync);
+
+// ----------------------------------------------------------------------
+// IPC
+
+// A batch of random int64 columns, half of them with nulls
+static std::shared_ptr<RecordBatch> MakeBatch(int num_columns, int64_t num_rows) {
+  random::RandomArrayGenerator rand(0x5487655);
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < num_columns; ++i) {
+    fields.push_back(field("f" + std::to_string(i), int64()));
+    columns.push_back(rand.Int64(num_rows, 0, 1 << 20, i % 2 ? 0.1 : 0.0));
+  }
+  return RecordBatch::Make(schema(fields), num_rows, columns);
+}
+
+static int64_t BatchSize(const RecordBatch& batch) {
+  int64_t size = 0;
+  ABORT_NOT_OK(ipc::GetRecordBatchSize(batch, &size));
+  return size;
+}
+
+static void BM_SerializeRecordBatch(benchmark::State& state) {
+  std::shared_ptr<RecordBatch> batch =
+      MakeBatch(static_cast<int>(state.range(0)), state.range(1));
+  std::shared_ptr<CudaContext> context = GetContext();
+  while (state.KeepRunning()) {
+    std::shared_ptr<CudaBuffer> serialized;
+    ABORT_NOT_OK(SerializeRecordBatch(*batch, context.get(), &serialized));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * BatchSize(*batch));
+}
+
+static void BM_ReadRecordBatch_Device(benchmark::State& state) {
+  // The message is on the device
+  std::shared_ptr<RecordBatch> batch =
+      MakeBatch(static_cast<int>(state.range(0)), state.range(1));
+  std::shared_ptr<CudaContext> context = GetContext();
+  std::shared_ptr<CudaBuffer> serialized;
+  ABORT_NOT_OK(SerializeRecordBatch(*batch, context.get(), &serialized));
+  while (state.KeepRunning()) {
+    std::shared_ptr<RecordBatch> result;
+    ABORT_NOT_OK(
+        ReadRecordBatch(batch->schema(), serialized, default_memory_pool(), &result));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * serialized->size());
+}
+
+static void BM_ReadRecordBatch_Host(benchmark::State& state) {
+  // The message is on the host, and its body copied to the device
+  std::shared_ptr<RecordBatch> batch =
+      MakeBatch(static_cast<int>(state.range(0)), state.range(1));
+  std::shared_ptr<CudaContext> context = GetContext();
+  std::shared_ptr<Buffer> serialized;
+  ABORT_NOT_OK(ipc::SerializeRecordBatch(*batch, default_memory_pool(), &serialized));
+  io::BufferReader reader(serialized);
+  std::unique_ptr<ipc::Message> message;
+  ABORT_NOT_OK(ipc::ReadMessage(&reader, &message));
+  while (state.KeepRunning()) {
+    std::shared_ptr<RecordBatch> result;
+    ABORT_NOT_OK(ReadRecordBatch(batch->schema(), *message, context.get(), &result));
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * serialized->size());
+}
+
+// Batch shapes as (columns, rows): narrow and wide, small and large
+#define IPC_BENCHMARK(NAME)                                                      \
+  BENCHMARK(NAME)                                                                \
+      ->Args({1, 1 << 10})                                                       \
+      ->Args({1, 1 << 20})                                                       \
+      ->Args({16, 1 << 16})                                                      \
+      ->Args({100, 1 << 10})                                                     \
+      ->Args({100, 1 << 16})                                                     \
+      ->UseRealTime()
+
+IPC_BENCHMARK(BM_SerializeRecordBatch);
+IPC_BENCHMARK(BM_ReadRecordBatch_Device);
+IPC_BENCHMARK(BM_ReadRecordBatch_Host);
+
 }  // namespace cuda
 }  // namespace arrow
@@ -16,15 +16,20 @@
 // under the License.
 
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
+#include "arrow/io/file.h"
 #include "arrow/ipc/api.h"
 #include "arrow/ipc/test-common.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/logging.h"
 
 #include "arrow/gpu/cuda_api.h"
 
@@ -80,6 +85,32 @@ TEST_F(TestCudaBuffer, CopyFromHost) {
   AssertCudaBufferEquals(*device_buffer, host_buffer->data(), kSize);
 }
 
+TEST_F(TestCudaBuffer, CopyAsync) {
+  const int64_t kSize = 1000;
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ASSERT_OK(context_->Allocate(kSize, &device_buffer));
+
+  std::shared_ptr<ResizableBuffer> random;
+  ASSERT_OK(MakeRandomByteBuffer(kSize, default_memory_pool(), &random));
+  std::shared_ptr<CudaHostBuffer> pinned;
+  ASSERT_OK(manager_->AllocateHost(kGpuNumber, kSize, &pinned));
+  std::memcpy(pinned->mutable_data(), random->data(), kSize);
+
+  std::shared_ptr<CudaEvent> done;
+  ASSERT_OK(device_buffer->CopyFromHostAsync(0, pinned->data(), kSize, nullptr, &done));
+  ASSERT_OK(done->Wait());
+  bool is_done = false;
+  ASSERT_OK(done->IsDone(&is_done));
+  ASSERT_TRUE(is_done);
+  AssertCudaBufferEquals(*device_buffer, random->data(), kSize);
+
+  std::memset(pinned->mutable_data(), 0, kSize);
+  ASSERT_OK(device_buffer->CopyToHostAsync(0, kSize, pinned->mutable_data(), nullptr,
+                                           &done));
+  ASSERT_OK(done->Wait());
+  ASSERT_EQ(0, std::memcmp(pinned->data(), random->data(), kSize));
+}
+
 TEST_F(TestCudaBuffer, FromBuffer) {
   const int64_t kSize = 1000;
   // Initialize device buffer with random data
@@ -307,6 +338,76 @@ TEST_F(TestCudaBufferReader, Basics) {
   ASSERT_EQ(0, std::memcmp(stack_buffer, host_data + 925, 75));
 }
 
+class TestCudaFileReader : public TestCudaBufferBase {
+ public:
+  void SetUp() {
+    TestCudaBufferBase::SetUp();
+    path_ = "arrow-test-cuda-file.bin";
+  }
+
+  void TearDown() { ARROW_UNUSED(std::remove(path_.c_str())); }
+
+  void WriteFile(int64_t size) {
+    ASSERT_OK(MakeRandomByteBuffer(size, default_memory_pool(), &contents_));
+    std::shared_ptr<io::FileOutputStream> file;
+    ASSERT_OK(io::FileOutputStream::Open(path_, &file));
+    ASSERT_OK(file->Write(contents_->data(), size));
+    ASSERT_OK(file->Close());
+  }
+
+ protected:
+  std::string path_;
+  std::shared_ptr<ResizableBuffer> contents_;
+};
+
+TEST_F(TestCudaFileReader, ReadBounceBuffers) {
+  const int64_t kSize = 5000;
+  WriteFile(kSize);
+
+  CudaFileReaderOptions options;
+  options.use_gpudirect = false;
+  // Several chunks per bounce buffer
+  options.bounce_buffer_size = 512;
+  options.num_bounce_buffers = 2;
+  std::shared_ptr<CudaFileReader> reader;
+  ASSERT_OK(CudaFileReader::Open(path_, context_, options, &reader));
+  ASSERT_FALSE(reader->uses_gpudirect());
+
+  int64_t size = 0;
+  ASSERT_OK(reader->GetSize(&size));
+  ASSERT_EQ(kSize, size);
+
+  std::shared_ptr<CudaBuffer> buffer;
+  ASSERT_OK(reader->ReadAt(100, 3000, &buffer));
+  ASSERT_EQ(3000, buffer->size());
+  AssertCudaBufferEquals(*buffer, contents_->data() + 100, 3000);
+
+  // Truncated at the end of the file
+  ASSERT_OK(reader->ReadAt(4000, 3000, &buffer));
+  ASSERT_EQ(1000, buffer->size());
+  AssertCudaBufferEquals(*buffer, contents_->data() + 4000, 1000);
+
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ASSERT_OK(context_->Allocate(kSize, &device_buffer));
+  int64_t bytes_read = 0;
+  ASSERT_OK(reader->ReadAt(0, kSize, device_buffer.get(), 0, &bytes_read));
+  ASSERT_EQ(kSize, bytes_read);
+  AssertCudaBufferEquals(*device_buffer, contents_->data(), kSize);
+  ASSERT_OK(reader->Close());
+}
+
+TEST_F(TestCudaFileReader, ReadDefaultOptions) {
+  // GPUDirect Storage if available
+  const int64_t kSize = 1 << 16;
+  WriteFile(kSize);
+
+  std::shared_ptr<CudaFileReader> reader;
+  ASSERT_OK(CudaFileReader::Open(path_, context_, CudaFileReaderOptions(), &reader));
+  std::shared_ptr<CudaBuffer> buffer;
+  ASSERT_OK(reader->ReadAt(0, kSize, &buffer));
+  AssertCudaBufferEquals(*buffer, contents_->data(), kSize);
+}
+
 class TestCudaArrowIpc : public TestCudaBufferBase {
  public:
   void SetUp() {
@@ -314,6 +415,23 @@ class TestCudaArrowIpc : public TestCudaBufferBase {
     pool_ = default_memory_pool();
   }
 
+  // Serialize a record batch message on the host
+  std::unique_ptr<ipc::Message> GetMessage(const RecordBatch& batch) {
+    std::shared_ptr<io::BufferOutputStream> sink;
+    ARROW_CHECK_OK(io::BufferOutputStream::Create(1024, pool_, &sink));
+    int32_t metadata_length;
+    int64_t body_length;
+    ARROW_CHECK_OK(ipc::WriteRecordBatch(batch, 0, sink.get(), &metadata_length,
+                                         &body_length, pool_));
+    std::shared_ptr<Buffer> serialized;
+    ARROW_CHECK_OK(sink->Finish(&serialized));
+
+    io::BufferReader reader(serialized);
+    std::unique_ptr<ipc::Message> message;
+    ARROW_CHECK_OK(ipc::ReadMessage(&reader, &message));
+    return message;
+  }
+
  protected:
   MemoryPool* pool_;
 };
@@ -343,11 +461,127 @@ TEST_F(TestCudaArrowIpc, BasicWriteRead) {
   CompareBatch(*batch, *cpu_batch);
 }
 
+void AssertDeviceBatchEquals(const RecordBatch& expected, const RecordBatch& actual) {
+  ASSERT_EQ(expected.num_columns(), actual.num_columns());
+  ASSERT_EQ(expected.num_rows(), actual.num_rows());
+  for (int i = 0; i < expected.num_columns(); ++i) {
+    const auto& expected_buffers = expected.column_data(i)->buffers;
+    const auto& actual_buffers = actual.column_data(i)->buffers;
+    ASSERT_EQ(expected_buffers.size(), actual_buffers.size());
+    for (size_t j = 0; j < expected_buffers.size(); ++j) {
+      if (!expected_buffers[j]) {
+        ASSERT_EQ(nullptr, actual_buffers[j]);
+        continue;
+      }
+      std::shared_ptr<CudaBuffer> device_buffer;
+      ASSERT_OK(CudaBuffer::FromBuffer(actual_buffers[j], &device_buffer));
+      ASSERT_EQ(expected_buffers[j]->size(), device_buffer->size());
+      AssertCudaBufferEquals(*device_buffer, expected_buffers[j]->data(),
+                             device_buffer->size());
+    }
+  }
+}
+
+TEST_F(TestCudaArrowIpc, ReadHostMessage) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::MakeIntRecordBatch(&batch));
+
+  std::shared_ptr<RecordBatch> device_batch;
+  ASSERT_OK(ReadRecordBatch(batch->schema(), *GetMessage(*batch), context_.get(),
+                            &device_batch));
+  AssertDeviceBatchEquals(*batch, *device_batch);
+}
+
+TEST_F(TestCudaArrowIpc, ReadHostStreamAndFile) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::MakeIntRecordBatch(&batch));
+
+  for (bool file_format : {false, true}) {
+    std::shared_ptr<io::BufferOutputStream> sink;
+    ASSERT_OK(io::BufferOutputStream::Create(1024, pool_, &sink));
+    std::shared_ptr<ipc::RecordBatchWriter> writer;
+    if (file_format) {
+      ASSERT_OK(ipc::RecordBatchFileWriter::Open(sink.get(), batch->schema(), &writer));
+    } else {
+      ASSERT_OK(ipc::RecordBatchStreamWriter::Open(sink.get(), batch->schema(), &writer));
+    }
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+    ASSERT_OK(writer->WriteRecordBatch(*batch->Slice(1)));
+    ASSERT_OK(writer->Close());
+    std::shared_ptr<Buffer> serialized;
+    ASSERT_OK(sink->Finish(&serialized));
+
+    std::shared_ptr<Schema> schema;
+    std::vector<std::shared_ptr<RecordBatch>> device_batches;
+    ASSERT_OK(ReadRecordBatches(serialized, context_.get(), &schema, &device_batches));
+    ASSERT_TRUE(schema->Equals(*batch->schema()));
+    ASSERT_EQ(2, static_cast<int>(device_batches.size()));
+    ASSERT_EQ(batch->num_rows(), device_batches[0]->num_rows());
+    ASSERT_EQ(batch->num_rows() - 1, device_batches[1]->num_rows());
+
+    // Compare with the batches read on the host
+    io::BufferReader reader(serialized);
+    std::vector<std::shared_ptr<RecordBatch>> host_batches;
+    if (file_format) {
+      std::shared_ptr<ipc::RecordBatchFileReader> file_reader;
+      ASSERT_OK(ipc::RecordBatchFileReader::Open(&reader, &file_reader));
+      host_batches.resize(2);
+      ASSERT_OK(file_reader->ReadRecordBatch(0, &host_batches[0]));
+      ASSERT_OK(file_reader->ReadRecordBatch(1, &host_batches[1]));
+    } else {
+      std::shared_ptr<RecordBatchReader> stream_reader;
+      ASSERT_OK(ipc::RecordBatchStreamReader::Open(&reader, &stream_reader));
+      ASSERT_OK(stream_reader->ReadAll(&host_batches));
+    }
+    AssertDeviceBatchEquals(*host_batches[0], *device_batches[0]);
+    AssertDeviceBatchEquals(*host_batches[1], *device_batches[1]);
+  }
+}
+
+TEST_F(TestCudaArrowIpc, CopyRecordBatch) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(ipc::MakeIntRecordBatch(&batch));
+  std::shared_ptr<RecordBatch> device_batch;
+  ASSERT_OK(ReadRecordBatch(batch->schema(), *GetMessage(*batch), context_.get(),
+                            &device_batch));
+
+  // To the last device, which is the same one on single GPU hosts
+  std::shared_ptr<CudaContext> other_context;
+  ASSERT_OK(manager_->GetContext(manager_->num_devices() - 1, &other_context));
+  std::shared_ptr<RecordBatch> copied;
+  ASSERT_OK(CopyRecordBatch(*device_batch, other_context, &copied));
+  for (int i = 0; i < copied->num_columns(); ++i) {
+    for (const auto& buffer : copied->column_data(i)->buffers) {
+      if (!buffer) continue;
+      std::shared_ptr<CudaBuffer> device_buffer;
+      ASSERT_OK(CudaBuffer::FromBuffer(buffer, &device_buffer));
+      ASSERT_EQ(other_context, device_buffer->context());
+    }
+  }
+  AssertDeviceBatchEquals(*batch, *copied);
+}
+
 class TestCudaContext : public TestCudaBufferBase {
  public:
   void SetUp() { TestCudaBufferBase::SetUp(); }
 };
 
+TEST_F(TestCudaContext, SharedPerDevice) {
+  std::shared_ptr<CudaContext> other;
+  ASSERT_OK(manager_->GetContext(kGpuNumber, &other));
+  ASSERT_EQ(context_, other);
+  ASSERT_RAISES(Invalid, manager_->GetContext(manager_->num_devices(), &other));
+}
+
+TEST_F(TestCudaContext, GetPeerDevices) {
+  std::vector<int> peers;
+  ASSERT_OK(manager_->GetPeerDevices(kGpuNumber, &peers));
+  for (int peer : peers) {
+    ASSERT_NE(kGpuNumber, peer);
+    ASSERT_LT(peer, manager_->num_devices());
+  }
+}
+
 TEST_F(TestCudaContext, GetDeviceAddress) {
   const int64_t kSize = 100;
   std::shared_ptr<CudaBuffer> buffer;
@@ -357,5 +591,116 @@ TEST_F(TestCudaContext, GetDeviceAddress) {
   ASSERT_EQ(buffer.get()->mutable_data(), devptr);
 }
 
+class TestCudaMemoryPool : public TestCudaBufferBase {
+ public:
+  void SetUp() {
+    TestCudaBufferBase::SetUp();
+    ASSERT_OK(CudaMemoryPool::Make(context_, &pool_));
+  }
+
+ protected:
+  std::shared_ptr<CudaMemoryPool> pool_;
+};
+
+TEST_F(TestCudaMemoryPool, ReuseFreedMemory) {
+  const int64_t context_bytes = context_->bytes_allocated();
+  uint8_t* data = nullptr;
+  ASSERT_OK(pool_->Allocate(1000, &data));
+  ASSERT_NE(nullptr, data);
+  // Rounded up to the size class
+  ASSERT_EQ(1024, pool_->bytes_allocated());
+  ASSERT_EQ(context_bytes + 1024, context_->bytes_allocated());
+
+  ASSERT_OK(pool_->Free(data, 1000));
+  ASSERT_EQ(0, pool_->bytes_allocated());
+  ASSERT_EQ(1024, pool_->bytes_cached());
+  ASSERT_EQ(context_bytes + 1024, context_->bytes_allocated());
+
+  // Same size class
+  uint8_t* other = nullptr;
+  ASSERT_OK(pool_->Allocate(600, &other));
+  ASSERT_EQ(data, other);
+  ASSERT_EQ(0, pool_->bytes_cached());
+  ASSERT_OK(pool_->Free(other, 600));
+
+  ASSERT_RAISES(Invalid, pool_->Free(data, 1000));
+  ASSERT_EQ(1024, pool_->max_memory());
+
+  ASSERT_OK(pool_->ReleaseCached());
+  ASSERT_EQ(0, pool_->bytes_cached());
+  ASSERT_EQ(context_bytes, context_->bytes_allocated());
+}
+
+TEST_F(TestCudaMemoryPool, AllocateBuffer) {
+  const int64_t kSize = 1000;
+  std::shared_ptr<ResizableBuffer> host_buffer;
+  ASSERT_OK(MakeRandomByteBuffer(kSize, default_memory_pool(), &host_buffer));
+
+  uint8_t* data = nullptr;
+  {
+    std::shared_ptr<CudaBuffer> buffer;
+    ASSERT_OK(pool_->AllocateBuffer(kSize, &buffer));
+    ASSERT_EQ(kSize, buffer->size());
+    ASSERT_EQ(context_, buffer->context());
+    ASSERT_OK(buffer->CopyFromHost(0, host_buffer->data(), kSize));
+    AssertCudaBufferEquals(*buffer, host_buffer->data(), kSize);
+    data = buffer->mutable_data();
+  }
+  ASSERT_EQ(0, pool_->bytes_allocated());
+
+  // The buffer keeps the pool alive
+  std::shared_ptr<CudaBuffer> buffer;
+  ASSERT_OK(pool_->AllocateBuffer(kSize, &buffer));
+  ASSERT_EQ(data, buffer->mutable_data());
+  pool_.reset();
+  buffer.reset();
+}
+
+class TestCudaHostBufferPool : public TestCudaBufferBase {
+ public:
+  void SetUp() {
+    TestCudaBufferBase::SetUp();
+    ASSERT_OK(CudaHostBufferPool::Make(context_, 256, 2, &pool_));
+  }
+
+ protected:
+  std::shared_ptr<CudaHostBufferPool> pool_;
+};
+
+TEST_F(TestCudaHostBufferPool, StagedCopies) {
+  // Several chunks per staging buffer
+  const int64_t kSize = 2000;
+  std::shared_ptr<CudaBuffer> device_buffer;
+  ASSERT_OK(context_->Allocate(kSize, &device_buffer));
+
+  std::shared_ptr<ResizableBuffer> host_buffer;
+  ASSERT_OK(MakeRandomByteBuffer(kSize, default_memory_pool(), &host_buffer));
+  std::shared_ptr<CudaEvent> done;
+  ASSERT_OK(pool_->CopyToDevice(host_buffer->data(), kSize, device_buffer.get(), 0,
+                                nullptr, &done));
+  ASSERT_OK(done->Wait());
+  AssertCudaBufferEquals(*device_buffer, host_buffer->data(), kSize);
+
+  std::shared_ptr<Buffer> result;
+  ASSERT_OK(AllocateBuffer(default_memory_pool(), kSize - 100, &result));
+  ASSERT_OK(pool_->CopyToHost(*device_buffer, 100, kSize - 100, result->mutable_data(),
+                              nullptr));
+  ASSERT_EQ(0, std::memcmp(result->data(), host_buffer->data() + 100, kSize - 100));
+}
+
+TEST_F(TestCudaHostBufferPool, Acquire) {
+  std::shared_ptr<CudaHostBuffer> first, second;
+  ASSERT_OK(pool_->Acquire(&first));
+  ASSERT_OK(pool_->Acquire(&second));
+  ASSERT_EQ(256, first->size());
+  ASSERT_NE(first->data(), second->data());
+
+  // Released buffers are reused
+  const uint8_t* data = first->data();
+  first.reset();
+  ASSERT_OK(pool_->Acquire(&first));
+  ASSERT_EQ(data, first->data());
+}
+
 }  // namespace cuda
 }  // namespace arrow
@@ -20,7 +20,9 @@
 
 #include "arrow/gpu/cuda_arrow_ipc.h"
 #include "arrow/gpu/cuda_context.h"
+#include "arrow/gpu/cuda_file.h"
 #include "arrow/gpu/cuda_memory.h"
+#include "arrow/gpu/cuda_memory_pool.h"
 #include "arrow/gpu/cuda_version.h"
 
 #endif  // ARROW_GPU_CUDA_API_H
@@ -18,17 +18,24 @@
 #include "arrow/gpu/cuda_arrow_ipc.h"
 
 #include <cstdint>
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <sstream>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/io/memory.h"
 #include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/message.h"
+#include "arrow/ipc/metadata-internal.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/visibility.h"
 
 #include "arrow/gpu/cuda_context.h"
@@ -105,5 +112,158 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
   return ipc::ReadRecordBatch(*message, schema, out);
 }
 
+namespace {
+
+using ReplaceFunction =
+    std::function<Status(const std::shared_ptr<Buffer>&, std::shared_ptr<Buffer>*)>;
+
+// Replace the buffers of array data, children first
+Status ReplaceBuffers(const std::shared_ptr<ArrayData>& data,
+                      const ReplaceFunction& replace, std::shared_ptr<ArrayData>* out) {
+  if (data->type->id() == Type::DICTIONARY) {
+    return Status::NotImplemented("Dictionary-encoded fields on device");
+  }
+  auto result = std::make_shared<ArrayData>(*data);
+  for (auto& buffer : result->buffers) {
+    if (buffer) {
+      RETURN_NOT_OK(replace(buffer, &buffer));
+    }
+  }
+  for (auto& child : result->child_data) {
+    RETURN_NOT_OK(ReplaceBuffers(child, replace, &child));
+  }
+  *out = std::move(result);
+  return Status::OK();
+}
+
+Status ReplaceBuffers(const RecordBatch& batch, const ReplaceFunction& replace,
+                      std::shared_ptr<RecordBatch>* out) {
+  std::vector<std::shared_ptr<ArrayData>> columns(batch.num_columns());
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    RETURN_NOT_OK(ReplaceBuffers(batch.column_data(i), replace, &columns[i]));
+  }
+  *out = RecordBatch::Make(batch.schema(), batch.num_rows(), std::move(columns));
+  return Status::OK();
+}
+
+// Replace the buffers of a record batch read zero-copy from host memory with
+// slices of the copy of that memory on the device
+Status MoveToDevice(const RecordBatch& batch, const Buffer& host,
+                    const std::shared_ptr<CudaBuffer>& device,
+                    std::shared_ptr<RecordBatch>* out) {
+  auto replace = [&host, &device](const std::shared_ptr<Buffer>& buffer,
+                                  std::shared_ptr<Buffer>* out) -> Status {
+    const int64_t offset = buffer->data() - host.data();
+    if (offset < 0 || offset + buffer->size() > host.size()) {
+      return Status::NotImplemented("Buffers not read zero-copy from the host memory");
+    }
+    *out = SliceBuffer(device, offset, buffer->size());
+    return Status::OK();
+  };
+  return ReplaceBuffers(batch, replace, out);
+}
+
+Status CopyToDevice(const Buffer& host, CudaContext* ctx,
+                    std::shared_ptr<CudaBuffer>* out) {
+  RETURN_NOT_OK(ctx->Allocate(host.size(), out));
+  return (*out)->CopyFromHost(0, host.data(), host.size());
+}
+
+bool IsFileFormat(const Buffer& buffer) {
+  const int64_t magic_size =
+      static_cast<int64_t>(strlen(ipc::internal::kArrowMagicBytes));
+  return buffer.size() >= magic_size &&
+         memcmp(buffer.data(), ipc::internal::kArrowMagicBytes, magic_size) == 0;
+}
+
+}  // namespace
+
+Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
+                       const ipc::Message& message, CudaContext* ctx,
+                       std::shared_ptr<RecordBatch>* out) {
+  if (message.type() != ipc::Message::RECORD_BATCH) {
+    return Status::Invalid("Message is not a record batch");
+  }
+  // Decode on the host, where the buffers are slices of the body
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(ipc::ReadRecordBatch(message, schema, &batch));
+  const std::shared_ptr<Buffer>& body = message.body();
+  if (!body) {
+    *out = batch;
+    return Status::OK();
+  }
+  std::shared_ptr<CudaBuffer> device_body;
+  RETURN_NOT_OK(CopyToDevice(*body, ctx, &device_body));
+  return MoveToDevice(*batch, *body, device_body, out);
+}
+
+Status ReadRecordBatches(const std::shared_ptr<Buffer>& buffer, CudaContext* ctx,
+                         std::shared_ptr<Schema>* schema,
+                         std::vector<std::shared_ptr<RecordBatch>>* out) {
+  // Decode on the host, where the buffers are slices of the stream
+  auto reader = std::make_shared<io::BufferReader>(buffer);
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  if (IsFileFormat(*buffer)) {
+    std::shared_ptr<ipc::RecordBatchFileReader> file_reader;
+    RETURN_NOT_OK(ipc::RecordBatchFileReader::Open(reader, &file_reader));
+    *schema = file_reader->schema();
+    batches.resize(file_reader->num_record_batches());
+    for (int i = 0; i < file_reader->num_record_batches(); ++i) {
+      RETURN_NOT_OK(file_reader->ReadRecordBatch(i, &batches[i]));
+    }
+  } else {
+    std::shared_ptr<RecordBatchReader> stream_reader;
+    RETURN_NOT_OK(ipc::RecordBatchStreamReader::Open(reader, &stream_reader));
+    *schema = stream_reader->schema();
+    RETURN_NOT_OK(stream_reader->ReadAll(&batches));
+  }
+
+  std::shared_ptr<CudaBuffer> device_buffer;
+  RETURN_NOT_OK(CopyToDevice(*buffer, ctx, &device_buffer));
+  out->resize(batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    RETURN_NOT_OK(MoveToDevice(*batches[i], *buffer, device_buffer, &(*out)[i]));
+  }
+  return Status::OK();
+}
+
+Status CopyRecordBatch(const RecordBatch& batch,
+                       const std::shared_ptr<CudaContext>& ctx,
+                       std::shared_ptr<RecordBatch>* out) {
+  // Size the destination, with each buffer 64-byte aligned
+  int64_t total_size = 0;
+  auto measure = [&total_size](const std::shared_ptr<Buffer>& buffer,
+                               std::shared_ptr<Buffer>* out) -> Status {
+    total_size += BitUtil::RoundUpToMultipleOf64(buffer->size());
+    *out = buffer;
+    return Status::OK();
+  };
+  std::shared_ptr<RecordBatch> unused;
+  RETURN_NOT_OK(ReplaceBuffers(batch, measure, &unused));
+
+  std::shared_ptr<CudaBuffer> dst;
+  RETURN_NOT_OK(ctx->Allocate(total_size, &dst));
+  int64_t offset = 0;
+  std::vector<std::shared_ptr<CudaEvent>> copies;
+  auto copy = [&dst, &offset, &copies](const std::shared_ptr<Buffer>& buffer,
+                                       std::shared_ptr<Buffer>* out) -> Status {
+    std::shared_ptr<CudaBuffer> src;
+    RETURN_NOT_OK(CudaBuffer::FromBuffer(buffer, &src));
+    std::shared_ptr<CudaEvent> done;
+    RETURN_NOT_OK(dst->CopyFromAnotherDeviceAsync(src->context(), offset, src->data(),
+                                                  src->size(), nullptr, &done));
+    copies.push_back(done);
+    *out = SliceBuffer(dst, offset, buffer->size());
+    offset += BitUtil::RoundUpToMultipleOf64(buffer->size());
+    return Status::OK();
+  };
+  Status st = ReplaceBuffers(batch, copy, out);
+  // The queued copies read the source and write the destination
+  for (const auto& done : copies) {
+    RETURN_NOT_OK(done->Wait());
+  }
+  return st;
+}
+
 }  // namespace cuda
 }  // namespace arrow
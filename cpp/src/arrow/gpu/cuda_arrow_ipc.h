@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/status.h"
@@ -71,6 +72,47 @@ Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
                        const std::shared_ptr<CudaBuffer>& buffer, MemoryPool* pool,
                        std::shared_ptr<RecordBatch>* out);
 
+/// \brief Read a record batch message in host memory onto a device. The
+/// message body is copied to the device in one transfer, and the buffers of
+/// the record batch are slices of it
+/// \param[in] schema the Schema for the record batch
+/// \param[in] message the record batch message, with its body on the host
+/// \param[in] ctx CudaContext to allocate device memory from
+/// \param[out] out the reconstructed RecordBatch, with device pointers
+/// \return Status
+ARROW_EXPORT
+Status ReadRecordBatch(const std::shared_ptr<Schema>& schema,
+                       const ipc::Message& message, CudaContext* ctx,
+                       std::shared_ptr<RecordBatch>* out);
+
+/// \brief Read all the record batches of an IPC stream or file in host memory
+/// onto a device. The whole buffer is copied to the device in one transfer,
+/// and the buffers of the record batches are slices of it
+/// \param[in] buffer host memory containing a complete IPC stream or file
+/// \param[in] ctx CudaContext to allocate device memory from
+/// \param[out] schema the Schema of the record batches
+/// \param[out] out the reconstructed RecordBatches, with device pointers
+/// \return Status
+///
+/// \note Dictionary-encoded fields and compressed bodies are not supported
+ARROW_EXPORT
+Status ReadRecordBatches(const std::shared_ptr<Buffer>& buffer, CudaContext* ctx,
+                         std::shared_ptr<Schema>* schema,
+                         std::vector<std::shared_ptr<RecordBatch>>* out);
+
+/// \brief Copy a record batch on a device to another device, into one
+/// device buffer. With peer devices (see CudaDeviceManager::GetPeerDevices)
+/// the data doesn't go through host memory
+/// \param[in] batch the record batch, with device pointers
+/// \param[in] ctx CudaContext of the destination device
+/// \param[out] out the copied RecordBatch, with device pointers of ctx
+/// \return Status
+///
+/// \note Dictionary-encoded fields are not supported
+ARROW_EXPORT
+Status CopyRecordBatch(const RecordBatch& batch, const std::shared_ptr<CudaContext>& ctx,
+                       std::shared_ptr<RecordBatch>* out);
+
 }  // namespace cuda
 }  // namespace arrow
 
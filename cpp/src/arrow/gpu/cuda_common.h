@@ -43,6 +43,16 @@ namespace cuda {
     }                                                                           \
   } while (0)
 
+/// \brief Make a context current for the lifetime of the object
+class ContextSaver {
+ public:
+  explicit ContextSaver(CUcontext new_context) { cuCtxPushCurrent(new_context); }
+  ~ContextSaver() {
+    CUcontext unused;
+    cuCtxPopCurrent(&unused);
+  }
+};
+
 }  // namespace cuda
 }  // namespace arrow
 
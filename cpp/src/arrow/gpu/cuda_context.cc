@@ -18,14 +18,20 @@
 #include "arrow/gpu/cuda_context.h"
 
 #include <atomic>
+#include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <cuda.h>
 
+#include "arrow/util/logging.h"
+
 #include "arrow/gpu/cuda_common.h"
 #include "arrow/gpu/cuda_memory.h"
 
@@ -38,15 +44,6 @@ struct CudaDevice {
   int64_t total_memory;
 };
 
-class ContextSaver {
- public:
-  explicit ContextSaver(CUcontext new_context) { cuCtxPushCurrent(new_context); }
-  ~ContextSaver() {
-    CUcontext unused;
-    cuCtxPopCurrent(&unused);
-  }
-};
-
 class CudaContext::CudaContextImpl {
  public:
   CudaContextImpl() : bytes_allocated_(0) {}
@@ -104,6 +101,22 @@ class CudaContext::CudaContextImpl {
     return Status::OK();
   }
 
+  Status CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                               CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK(cuMemcpyHtoDAsync(reinterpret_cast<CUdeviceptr>(dst), src,
+                                       static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
+  Status CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                               CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK(cuMemcpyDtoHAsync(dst, reinterpret_cast<const CUdeviceptr>(src),
+                                       static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
   Status CopyDeviceToDevice(void* dst, const void* src, int64_t nbytes) {
     ContextSaver set_temporary(context_);
     CU_RETURN_NOT_OK(cuMemcpyDtoD(reinterpret_cast<CUdeviceptr>(dst),
@@ -122,6 +135,17 @@ class CudaContext::CudaContextImpl {
     return Status::OK();
   }
 
+  Status CopyDeviceToAnotherDeviceAsync(const std::shared_ptr<CudaContext>& dst_ctx,
+                                        void* dst, const void* src, int64_t nbytes,
+                                        CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK(cuMemcpyPeerAsync(reinterpret_cast<CUdeviceptr>(dst),
+                                       reinterpret_cast<CUcontext>(dst_ctx->handle()),
+                                       reinterpret_cast<const CUdeviceptr>(src),
+                                       context_, static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
   Status Synchronize(void) {
     ContextSaver set_temporary(context_);
     CU_RETURN_NOT_OK(cuCtxSynchronize());
@@ -162,6 +186,8 @@ class CudaContext::CudaContextImpl {
 
   const CudaDevice device() const { return device_; }
 
+  bool is_open() const { return is_open_; }
+
   void* context_handle() const { return reinterpret_cast<void*>(context_); }
 
  private:
@@ -184,6 +210,7 @@ class CudaDeviceManager::CudaDeviceManagerImpl {
     CU_RETURN_NOT_OK(cuDeviceGetCount(&num_devices_));
 
     devices_.resize(num_devices_);
+    contexts_.resize(num_devices_);
     for (int i = 0; i < num_devices_; ++i) {
       RETURN_NOT_OK(GetDeviceProperties(i, &devices_[i]));
     }
@@ -218,8 +245,19 @@ class CudaDeviceManager::CudaDeviceManagerImpl {
   }
 
   Status GetContext(int device_number, std::shared_ptr<CudaContext>* out) {
-    *out = std::shared_ptr<CudaContext>(new CudaContext());
-    return (*out)->impl_->Init(devices_[device_number]);
+    if (device_number < 0 || device_number >= num_devices_) {
+      return Status::Invalid("Invalid CUDA device number ", device_number);
+    }
+    // One context per device is shared by all callers, unless it was closed
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::shared_ptr<CudaContext>& context = contexts_[device_number];
+    if (!context || !context->impl_->is_open()) {
+      std::shared_ptr<CudaContext> new_context(new CudaContext());
+      RETURN_NOT_OK(new_context->impl_->Init(devices_[device_number]));
+      context = new_context;
+    }
+    *out = context;
+    return Status::OK();
   }
 
   Status GetSharedContext(int device_number, CUcontext ctx,
@@ -228,12 +266,80 @@ class CudaDeviceManager::CudaDeviceManagerImpl {
     return (*out)->impl_->InitShared(devices_[device_number], ctx);
   }
 
+  // Let each context access the memory of the other directly, if their
+  // devices are capable. This is done once for each pair of contexts
+  Status EnablePeerAccess(const CudaContext& a, const CudaContext& b) {
+    CUcontext a_handle = reinterpret_cast<CUcontext>(a.handle());
+    CUcontext b_handle = reinterpret_cast<CUcontext>(b.handle());
+    if (a.device_number() == b.device_number()) {
+      return Status::OK();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto key = std::make_pair(std::min(a_handle, b_handle), std::max(a_handle, b_handle));
+    if (peers_.count(key)) {
+      return Status::OK();
+    }
+    const CUdevice a_device = devices_[a.device_number()].handle;
+    const CUdevice b_device = devices_[b.device_number()].handle;
+    RETURN_NOT_OK(EnableAccess(a_handle, a_device, b_handle, b_device));
+    RETURN_NOT_OK(EnableAccess(b_handle, b_device, a_handle, a_device));
+    peers_.insert(key);
+    return Status::OK();
+  }
+
+  Status GetPeerDevices(int device_number, std::vector<int>* out) {
+    if (device_number < 0 || device_number >= num_devices_) {
+      return Status::Invalid("Invalid CUDA device number ", device_number);
+    }
+    std::vector<std::pair<int, int>> ranked;
+    for (int i = 0; i < num_devices_; ++i) {
+      if (i == device_number) continue;
+      const CUdevice src = devices_[device_number].handle;
+      const CUdevice dst = devices_[i].handle;
+      int supported = 0;
+      CU_RETURN_NOT_OK(cuDeviceGetP2PAttribute(
+          &supported, CU_DEVICE_P2P_ATTRIBUTE_ACCESS_SUPPORTED, src, dst));
+      if (!supported) continue;
+      int rank = 0;
+      CU_RETURN_NOT_OK(cuDeviceGetP2PAttribute(
+          &rank, CU_DEVICE_P2P_ATTRIBUTE_PERFORMANCE_RANK, src, dst));
+      ranked.emplace_back(-rank, i);
+    }
+    // Best link first, then by device number
+    std::sort(ranked.begin(), ranked.end());
+    out->clear();
+    for (const auto& entry : ranked) {
+      out->push_back(entry.second);
+    }
+    return Status::OK();
+  }
+
   int num_devices() const { return num_devices_; }
 
  private:
+  Status EnableAccess(CUcontext from, CUdevice from_device, CUcontext to,
+                      CUdevice to_device) {
+    int can_access = 0;
+    CU_RETURN_NOT_OK(cuDeviceCanAccessPeer(&can_access, from_device, to_device));
+    if (!can_access) {
+      return Status::OK();
+    }
+    ContextSaver set_temporary(from);
+    CUresult ret = cuCtxEnablePeerAccess(to, 0);
+    if (ret != CUDA_ERROR_PEER_ACCESS_ALREADY_ENABLED) {
+      CU_RETURN_NOT_OK(ret);
+    }
+    return Status::OK();
+  }
+
   int num_devices_;
   std::vector<CudaDevice> devices_;
 
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<CudaContext>> contexts_;
+  // The pairs of contexts that peer access was set up for
+  std::set<std::pair<CUcontext, CUcontext>> peers_;
+
   int64_t host_bytes_allocated_;
 };
 
@@ -272,6 +378,10 @@ Status CudaDeviceManager::FreeHost(void* data, int64_t nbytes) {
   return impl_->FreeHost(data, nbytes);
 }
 
+Status CudaDeviceManager::GetPeerDevices(int device_number, std::vector<int>* out) {
+  return impl_->GetPeerDevices(device_number, out);
+}
+
 int CudaDeviceManager::num_devices() const { return impl_->num_devices(); }
 
 // ----------------------------------------------------------------------
@@ -307,6 +417,18 @@ Status CudaContext::CopyDeviceToHost(void* dst, const void* src, int64_t nbytes)
   return impl_->CopyDeviceToHost(dst, src, nbytes);
 }
 
+Status CudaContext::CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes,
+                                          void* stream) {
+  return impl_->CopyHostToDeviceAsync(dst, src, nbytes,
+                                      reinterpret_cast<CUstream>(stream));
+}
+
+Status CudaContext::CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes,
+                                          void* stream) {
+  return impl_->CopyDeviceToHostAsync(dst, src, nbytes,
+                                      reinterpret_cast<CUstream>(stream));
+}
+
 Status CudaContext::CopyDeviceToDevice(void* dst, const void* src, int64_t nbytes) {
   return impl_->CopyDeviceToDevice(dst, src, nbytes);
 }
@@ -314,13 +436,45 @@ Status CudaContext::CopyDeviceToDevice(void* dst, const void* src, int64_t nbyte
 Status CudaContext::CopyDeviceToAnotherDevice(const std::shared_ptr<CudaContext>& dst_ctx,
                                               void* dst, const void* src,
                                               int64_t nbytes) {
+  RETURN_NOT_OK(EnablePeerAccess(*dst_ctx));
   return impl_->CopyDeviceToAnotherDevice(dst_ctx, dst, src, nbytes);
 }
 
+Status CudaContext::CopyDeviceToAnotherDeviceAsync(
+    const std::shared_ptr<CudaContext>& dst_ctx, void* dst, const void* src,
+    int64_t nbytes, void* stream) {
+  RETURN_NOT_OK(EnablePeerAccess(*dst_ctx));
+  return impl_->CopyDeviceToAnotherDeviceAsync(dst_ctx, dst, src, nbytes,
+                                               reinterpret_cast<CUstream>(stream));
+}
+
+Status CudaContext::EnablePeerAccess(const CudaContext& other) {
+  CudaDeviceManager* manager = nullptr;
+  RETURN_NOT_OK(CudaDeviceManager::GetInstance(&manager));
+  return manager->impl_->EnablePeerAccess(*this, other);
+}
+
 Status CudaContext::Synchronize(void) { return impl_->Synchronize(); }
 
+Status CudaContext::RecordEvent(void* stream, std::shared_ptr<CudaEvent>* out) {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(handle()));
+  CUevent event;
+  CU_RETURN_NOT_OK(cuEventCreate(&event, CU_EVENT_DISABLE_TIMING));
+  CUresult ret = cuEventRecord(event, reinterpret_cast<CUstream>(stream));
+  if (ret != CUDA_SUCCESS) {
+    cuEventDestroy(event);
+    CU_RETURN_NOT_OK(ret);
+  }
+  out->reset(new CudaEvent(shared_from_this(), event));
+  return Status::OK();
+}
+
 Status CudaContext::Close() { return impl_->Close(); }
 
+Status CudaContext::AllocateDevice(int64_t nbytes, uint8_t** out) {
+  return impl_->Allocate(nbytes, out);
+}
+
 Status CudaContext::Free(void* device_ptr, int64_t nbytes) {
   return impl_->Free(device_ptr, nbytes);
 }
@@ -366,5 +520,32 @@ Status CudaContext::GetDeviceAddress(uint8_t* addr, uint8_t** devaddr) {
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// CudaEvent
+
+CudaEvent::CudaEvent(const std::shared_ptr<CudaContext>& context, void* event)
+    : context_(context), event_(event) {}
+
+CudaEvent::~CudaEvent() {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+  CUDA_DCHECK(cuEventDestroy(reinterpret_cast<CUevent>(event_)));
+}
+
+Status CudaEvent::Wait() {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+  CU_RETURN_NOT_OK(cuEventSynchronize(reinterpret_cast<CUevent>(event_)));
+  return Status::OK();
+}
+
+Status CudaEvent::IsDone(bool* done) {
+  ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+  CUresult ret = cuEventQuery(reinterpret_cast<CUevent>(event_));
+  *done = ret == CUDA_SUCCESS;
+  if (ret != CUDA_SUCCESS && ret != CUDA_ERROR_NOT_READY) {
+    CU_RETURN_NOT_OK(ret);
+  }
+  return Status::OK();
+}
+
 }  // namespace cuda
 }  // namespace arrow
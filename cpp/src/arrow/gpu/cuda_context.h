@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
@@ -31,12 +32,15 @@ namespace cuda {
 
 // Forward declaration
 class CudaContext;
+class CudaHostBufferPool;
+class CudaMemoryPool;
 
 class ARROW_EXPORT CudaDeviceManager {
  public:
   static Status GetInstance(CudaDeviceManager** manager);
 
-  /// \brief Get the CUDA driver context for a particular device
+  /// \brief Get the CUDA driver context for a particular device, which is
+  /// created once and shared by all callers, unless closed
   /// \param[in] device_number the CUDA device
   /// \param[out] out cached context
   Status GetContext(int device_number, std::shared_ptr<CudaContext>* out);
@@ -59,6 +63,15 @@ class ARROW_EXPORT CudaDeviceManager {
 
   int num_devices() const;
 
+  /// \brief Get the devices that can access the memory of a device directly,
+  /// the best connected first, e.g. through NVLink before PCIe, as ranked by
+  /// the driver. Copies between contexts of peer devices don't go through
+  /// host memory, and set up peer access on first use
+  /// \param[in] device_number the CUDA device
+  /// \param[out] out the numbers of the peer devices
+  /// \return Status
+  Status GetPeerDevices(int device_number, std::vector<int>* out);
+
  private:
   CudaDeviceManager();
   static std::unique_ptr<CudaDeviceManager> instance_;
@@ -111,6 +124,12 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   /// \brief Block until the all device tasks are completed.
   Status Synchronize(void);
 
+  /// \brief Record an event completed with the work queued on a stream so far
+  /// \param[in] stream the CUstream, or null for the default stream
+  /// \param[out] out the event
+  /// \return Status
+  Status RecordEvent(void* stream, std::shared_ptr<CudaEvent>* out);
+
   int64_t bytes_allocated() const;
 
   /// \brief Expose CUDA context handle to other libraries
@@ -140,9 +159,16 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
                          std::shared_ptr<CudaIpcMemHandle>* handle);
   Status CopyHostToDevice(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToHost(void* dst, const void* src, int64_t nbytes);
+  Status CopyHostToDeviceAsync(void* dst, const void* src, int64_t nbytes, void* stream);
+  Status CopyDeviceToHostAsync(void* dst, const void* src, int64_t nbytes, void* stream);
   Status CopyDeviceToDevice(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToAnotherDevice(const std::shared_ptr<CudaContext>& dst_ctx, void* dst,
                                    const void* src, int64_t nbytes);
+  Status CopyDeviceToAnotherDeviceAsync(const std::shared_ptr<CudaContext>& dst_ctx,
+                                        void* dst, const void* src, int64_t nbytes,
+                                        void* stream);
+  Status EnablePeerAccess(const CudaContext& other);
+  Status AllocateDevice(int64_t nbytes, uint8_t** out);
   Status Free(void* device_ptr, int64_t nbytes);
 
   class CudaContextImpl;
@@ -151,12 +177,41 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   friend CudaBuffer;
   friend CudaBufferReader;
   friend CudaBufferWriter;
+  friend CudaHostBufferPool;
+  friend CudaMemoryPool;
   /// \cond FALSE
   // (note: emits warning on Doxygen < 1.8.15)
   friend CudaDeviceManager::CudaDeviceManagerImpl;
   /// \endcond
 };
 
+/// \class CudaEvent
+/// \brief The completion of the work queued on a CUDA stream, such as an
+/// asynchronous copy
+class ARROW_EXPORT CudaEvent {
+ public:
+  ~CudaEvent();
+
+  /// \brief Block until the work is completed
+  Status Wait();
+
+  /// \brief Whether the work is completed, without blocking
+  /// \param[out] done true if completed
+  /// \return Status
+  Status IsDone(bool* done);
+
+  /// \brief Expose the CUevent handle to other libraries
+  void* handle() const { return event_; }
+
+ private:
+  CudaEvent(const std::shared_ptr<CudaContext>& context, void* event);
+
+  std::shared_ptr<CudaContext> context_;
+  void* event_;
+
+  friend CudaContext;
+};
+
 }  // namespace cuda
 }  // namespace arrow
 
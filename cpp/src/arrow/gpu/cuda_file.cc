@@ -0,0 +1,248 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/gpu/cuda_file.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#ifdef ARROW_CUDA_HAVE_CUFILE
+#include <cerrno>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cufile.h>
+#endif
+
+#include <cuda.h>
+
+#include "arrow/io/file.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/gpu/cuda_common.h"
+#include "arrow/gpu/cuda_context.h"
+#include "arrow/gpu/cuda_memory_pool.h"
+
+namespace arrow {
+namespace cuda {
+
+#ifdef ARROW_CUDA_HAVE_CUFILE
+
+namespace {
+
+// The cuFile driver is opened once per process
+bool OpenCuFileDriver() {
+  static const bool opened = cuFileDriverOpen().err == CU_FILE_SUCCESS;
+  return opened;
+}
+
+}  // namespace
+
+#endif
+
+class CudaFileReader::CudaFileReaderImpl {
+ public:
+  CudaFileReaderImpl(const std::shared_ptr<CudaContext>& context,
+                     const CudaFileReaderOptions& options)
+      : context_(context), options_(options), uses_gpudirect_(false) {
+#ifdef ARROW_CUDA_HAVE_CUFILE
+    fd_ = -1;
+#endif
+  }
+
+  ~CudaFileReaderImpl() { DCHECK_OK(Close()); }
+
+  Status Open(const std::string& path) {
+    RETURN_NOT_OK(io::ReadableFile::Open(path, &file_));
+#ifdef ARROW_CUDA_HAVE_CUFILE
+    if (options_.use_gpudirect && OpenCuFileDriver()) {
+      OpenGpuDirect(path);
+    }
+#endif
+    if (!uses_gpudirect_) {
+      RETURN_NOT_OK(CudaHostBufferPool::Make(context_, options_.bounce_buffer_size,
+                                             options_.num_bounce_buffers,
+                                             &bounce_buffers_));
+    }
+    return Status::OK();
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, CudaBuffer* dst, int64_t dst_position,
+                int64_t* bytes_read) {
+    int64_t size = 0;
+    RETURN_NOT_OK(file_->GetSize(&size));
+    nbytes = std::max<int64_t>(0, std::min(nbytes, size - position));
+    DCHECK_LE(nbytes, dst->size() - dst_position) << "Read would overflow buffer";
+    if (uses_gpudirect_) {
+      RETURN_NOT_OK(ReadGpuDirect(position, nbytes, dst, dst_position, bytes_read));
+      return Status::OK();
+    }
+
+    // Read each chunk into a pinned buffer, while the previous ones are
+    // transferred to the device
+    io::ReadableFile* file = file_.get();
+    auto fill = [file, position](int64_t offset, int64_t chunk,
+                                 uint8_t* staging) -> Status {
+      int64_t chunk_read = 0;
+      RETURN_NOT_OK(file->ReadAt(position + offset, chunk, &chunk_read, staging));
+      if (chunk_read != chunk) {
+        return Status::IOError("File truncated while reading");
+      }
+      return Status::OK();
+    };
+    std::shared_ptr<CudaEvent> done;
+    RETURN_NOT_OK(
+        bounce_buffers_->CopyToDevice(fill, nbytes, dst, dst_position, nullptr, &done));
+    RETURN_NOT_OK(done->Wait());
+    *bytes_read = nbytes;
+    return Status::OK();
+  }
+
+  Status GetSize(int64_t* size) { return file_->GetSize(size); }
+
+  Status Close() {
+#ifdef ARROW_CUDA_HAVE_CUFILE
+    if (uses_gpudirect_) {
+      cuFileHandleDeregister(handle_);
+      uses_gpudirect_ = false;
+    }
+    if (fd_ >= 0) {
+      if (close(fd_) != 0) {
+        fd_ = -1;
+        return Status::IOError("Failed to close file: ", std::strerror(errno));
+      }
+      fd_ = -1;
+    }
+#endif
+    if (file_) {
+      RETURN_NOT_OK(file_->Close());
+    }
+    return Status::OK();
+  }
+
+  bool uses_gpudirect() const { return uses_gpudirect_; }
+
+  std::shared_ptr<CudaContext> context() const { return context_; }
+
+ private:
+#ifdef ARROW_CUDA_HAVE_CUFILE
+  // Register the file with cuFile, leaving uses_gpudirect_ false if the file
+  // system doesn't support it
+  void OpenGpuDirect(const std::string& path) {
+    fd_ = open(path.c_str(), O_RDONLY | O_DIRECT);
+    if (fd_ < 0) {
+      return;
+    }
+    CUfileDescr_t descr;
+    std::memset(&descr, 0, sizeof(descr));
+    descr.handle.fd = fd_;
+    descr.type = CU_FILE_HANDLE_TYPE_OPAQUE_FD;
+    if (cuFileHandleRegister(&handle_, &descr).err != CU_FILE_SUCCESS) {
+      close(fd_);
+      fd_ = -1;
+      return;
+    }
+    uses_gpudirect_ = true;
+  }
+
+  Status ReadGpuDirect(int64_t position, int64_t nbytes, CudaBuffer* dst,
+                       int64_t dst_position, int64_t* bytes_read) {
+    ContextSaver set_temporary(reinterpret_cast<CUcontext>(context_->handle()));
+    int64_t total = 0;
+    while (total < nbytes) {
+      ssize_t ret = cuFileRead(handle_, dst->mutable_data(),
+                               static_cast<size_t>(nbytes - total),
+                               static_cast<off_t>(position + total),
+                               static_cast<off_t>(dst_position + total));
+      if (ret < 0) {
+        return Status::IOError("cuFileRead failed with code ", ret);
+      }
+      if (ret == 0) {
+        break;
+      }
+      total += ret;
+    }
+    *bytes_read = total;
+    return Status::OK();
+  }
+
+  int fd_;
+  CUfileHandle_t handle_;
+#else
+  Status ReadGpuDirect(int64_t position, int64_t nbytes, CudaBuffer* dst,
+                       int64_t dst_position, int64_t* bytes_read) {
+    return Status::NotImplemented("Arrow was built without cuFile");
+  }
+#endif
+
+  std::shared_ptr<CudaContext> context_;
+  CudaFileReaderOptions options_;
+  std::shared_ptr<io::ReadableFile> file_;
+  std::shared_ptr<CudaHostBufferPool> bounce_buffers_;
+  bool uses_gpudirect_;
+};
+
+CudaFileReader::CudaFileReader() {}
+
+CudaFileReader::~CudaFileReader() {}
+
+Status CudaFileReader::Open(const std::string& path,
+                            const std::shared_ptr<CudaContext>& context,
+                            const CudaFileReaderOptions& options,
+                            std::shared_ptr<CudaFileReader>* out) {
+  std::shared_ptr<CudaFileReader> reader(new CudaFileReader());
+  reader->impl_.reset(new CudaFileReaderImpl(context, options));
+  RETURN_NOT_OK(reader->impl_->Open(path));
+  *out = std::move(reader);
+  return Status::OK();
+}
+
+Status CudaFileReader::ReadAt(int64_t position, int64_t nbytes, CudaBuffer* dst,
+                              int64_t dst_position, int64_t* bytes_read) {
+  return impl_->ReadAt(position, nbytes, dst, dst_position, bytes_read);
+}
+
+Status CudaFileReader::ReadAt(int64_t position, int64_t nbytes,
+                              std::shared_ptr<CudaBuffer>* out) {
+  int64_t size = 0;
+  RETURN_NOT_OK(impl_->GetSize(&size));
+  nbytes = std::max<int64_t>(0, std::min(nbytes, size - position));
+  std::shared_ptr<CudaBuffer> buffer;
+  RETURN_NOT_OK(impl_->context()->Allocate(nbytes, &buffer));
+  int64_t bytes_read = 0;
+  RETURN_NOT_OK(impl_->ReadAt(position, nbytes, buffer.get(), 0, &bytes_read));
+  if (bytes_read < nbytes) {
+    *out = std::make_shared<CudaBuffer>(buffer, 0, bytes_read);
+  } else {
+    *out = std::move(buffer);
+  }
+  return Status::OK();
+}
+
+Status CudaFileReader::GetSize(int64_t* size) { return impl_->GetSize(size); }
+
+Status CudaFileReader::Close() { return impl_->Close(); }
+
+bool CudaFileReader::uses_gpudirect() const { return impl_->uses_gpudirect(); }
+
+}  // namespace cuda
+}  // namespace arrow
@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_GPU_CUDA_FILE_H
+#define ARROW_GPU_CUDA_FILE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+#include "arrow/gpu/cuda_memory.h"
+
+namespace arrow {
+namespace cuda {
+
+class CudaContext;
+
+/// \brief Options for CudaFileReader
+struct ARROW_EXPORT CudaFileReaderOptions {
+  /// Whether to read with GPUDirect Storage, which moves file ranges straight
+  /// into device memory, if Arrow was built with cuFile and the file system
+  /// supports it
+  bool use_gpudirect = true;
+
+  /// The size of the pinned host buffers that the reads go through otherwise
+  int64_t bounce_buffer_size = 1 << 23;
+
+  /// The number of pinned host buffers, so that reading a chunk of the file
+  /// overlaps with the transfer of the previous ones to the device
+  int num_bounce_buffers = 4;
+};
+
+/// \class CudaFileReader
+/// \brief A file read into device memory
+class ARROW_EXPORT CudaFileReader {
+ public:
+  ~CudaFileReader();
+
+  /// \brief Open a file for reading into the memory of a context
+  /// \param[in] path the file path
+  /// \param[in] context the CUDA context
+  /// \param[in] options how the file is read
+  /// \param[out] out the reader
+  /// \return Status
+  static Status Open(const std::string& path, const std::shared_ptr<CudaContext>& context,
+                     const CudaFileReaderOptions& options,
+                     std::shared_ptr<CudaFileReader>* out);
+
+  /// \brief Read a range of the file into device memory. Thread-safe
+  /// \param[in] position the start of the range in the file
+  /// \param[in] nbytes the size of the range
+  /// \param[in] dst the device buffer, of the device of the reader
+  /// \param[in] dst_position start position inside dst to read bytes to
+  /// \param[out] bytes_read the number of bytes read, less than nbytes at the
+  /// end of the file
+  /// \return Status
+  Status ReadAt(int64_t position, int64_t nbytes, CudaBuffer* dst, int64_t dst_position,
+                int64_t* bytes_read);
+
+  /// \brief Read a range of the file into new device memory. Thread-safe
+  /// \param[in] position the start of the range in the file
+  /// \param[in] nbytes the maximum size of the range
+  /// \param[out] out the device buffer, shorter than nbytes at the end of
+  /// the file
+  /// \return Status
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<CudaBuffer>* out);
+
+  Status GetSize(int64_t* size);
+
+  Status Close();
+
+  /// \brief Whether the reads use GPUDirect Storage
+  bool uses_gpudirect() const;
+
+ private:
+  CudaFileReader();
+
+  class CudaFileReaderImpl;
+  std::unique_ptr<CudaFileReaderImpl> impl_;
+};
+
+}  // namespace cuda
+}  // namespace arrow
+
+#endif  // ARROW_GPU_CUDA_FILE_H
@@ -157,6 +157,22 @@ Status CudaBuffer::CopyFromHost(const int64_t position, const void* data,
   return context_->CopyHostToDevice(mutable_data_ + position, data, nbytes);
 }
 
+Status CudaBuffer::CopyToHostAsync(const int64_t position, const int64_t nbytes,
+                                   void* out, void* stream,
+                                   std::shared_ptr<CudaEvent>* done) const {
+  RETURN_NOT_OK(context_->CopyDeviceToHostAsync(out, data_ + position, nbytes, stream));
+  return context_->RecordEvent(stream, done);
+}
+
+Status CudaBuffer::CopyFromHostAsync(const int64_t position, const void* data,
+                                     int64_t nbytes, void* stream,
+                                     std::shared_ptr<CudaEvent>* done) {
+  DCHECK_LE(nbytes, size_ - position) << "Copy would overflow buffer";
+  RETURN_NOT_OK(
+      context_->CopyHostToDeviceAsync(mutable_data_ + position, data, nbytes, stream));
+  return context_->RecordEvent(stream, done);
+}
+
 Status CudaBuffer::CopyFromDevice(const int64_t position, const void* data,
                                   int64_t nbytes) {
   DCHECK_LE(nbytes, size_ - position) << "Copy would overflow buffer";
@@ -171,6 +187,16 @@ Status CudaBuffer::CopyFromAnotherDevice(const std::shared_ptr<CudaContext>& src
                                             nbytes);
 }
 
+Status CudaBuffer::CopyFromAnotherDeviceAsync(const std::shared_ptr<CudaContext>& src_ctx,
+                                              const int64_t position, const void* data,
+                                              int64_t nbytes, void* stream,
+                                              std::shared_ptr<CudaEvent>* done) {
+  DCHECK_LE(nbytes, size_ - position) << "Copy would overflow buffer";
+  RETURN_NOT_OK(src_ctx->CopyDeviceToAnotherDeviceAsync(
+      context_, mutable_data_ + position, data, nbytes, stream));
+  return src_ctx->RecordEvent(stream, done);
+}
+
 Status CudaBuffer::ExportForIpc(std::shared_ptr<CudaIpcMemHandle>* handle) {
   if (is_ipc_) {
     return Status::Invalid("Buffer has already been exported for IPC");
@@ -30,6 +30,7 @@ namespace arrow {
 namespace cuda {
 
 class CudaContext;
+class CudaEvent;
 class CudaIpcMemHandle;
 
 /// \class CudaBuffer
@@ -70,6 +71,36 @@ class ARROW_EXPORT CudaBuffer : public Buffer {
   /// \return Status
   Status CopyFromHost(const int64_t position, const void* data, int64_t nbytes);
 
+  /// \brief Queue a copy of memory from GPU device to CPU host on a stream
+  /// \param[in] position start position inside buffer to copy bytes from
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[out] out start address of the host memory area to copy to, which
+  /// must stay valid until the copy completes
+  /// \param[in] stream the CUstream to queue the copy on, or null for the
+  /// default stream
+  /// \param[out] done an event completed with the copy
+  /// \return Status
+  ///
+  /// \note The copy only overlaps with the work of the host and of other
+  /// streams if the host memory is pinned, such as a CudaHostBuffer
+  Status CopyToHostAsync(const int64_t position, const int64_t nbytes, void* out,
+                         void* stream, std::shared_ptr<CudaEvent>* done) const;
+
+  /// \brief Queue a copy of memory to device at position on a stream
+  /// \param[in] position start position to copy bytes to
+  /// \param[in] data the host data to copy, which must stay valid and
+  /// unchanged until the copy completes
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] stream the CUstream to queue the copy on, or null for the
+  /// default stream
+  /// \param[out] done an event completed with the copy
+  /// \return Status
+  ///
+  /// \note The copy only overlaps with the work of the host and of other
+  /// streams if the host memory is pinned, such as a CudaHostBuffer
+  Status CopyFromHostAsync(const int64_t position, const void* data, int64_t nbytes,
+                           void* stream, std::shared_ptr<CudaEvent>* done);
+
   /// \brief Copy memory from device to device at position
   /// \param[in] position start position inside buffer to copy bytes to
   /// \param[in] data start address of the device memory area to copy from
@@ -89,6 +120,21 @@ class ARROW_EXPORT CudaBuffer : public Buffer {
   Status CopyFromAnotherDevice(const std::shared_ptr<CudaContext>& src_ctx,
                                const int64_t position, const void* data, int64_t nbytes);
 
+  /// \brief Queue a copy of memory from another device to device at
+  /// position on a stream
+  /// \param[in] src_ctx context of the source device memory
+  /// \param[in] position start position inside buffer to copy bytes to
+  /// \param[in] data start address of the another device memory area to copy from
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] stream a CUstream of the source context, or null for its
+  /// default stream
+  /// \param[out] done an event completed with the copy
+  /// \return Status
+  Status CopyFromAnotherDeviceAsync(const std::shared_ptr<CudaContext>& src_ctx,
+                                    const int64_t position, const void* data,
+                                    int64_t nbytes, void* stream,
+                                    std::shared_ptr<CudaEvent>* done);
+
   /// \brief Expose this device buffer as IPC memory which can be used in other processes
   /// \param[out] handle the exported IPC handle
   /// \return Status
@@ -0,0 +1,586 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/gpu/cuda_memory_pool.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <cuda.h>
+
+#include "arrow/status.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"
+
+#include "arrow/gpu/cuda_common.h"
+#include "arrow/gpu/cuda_context.h"
+
+namespace arrow {
+namespace cuda {
+
+namespace {
+
+constexpr int64_t kMinBlockSize = 512;
+constexpr int64_t kMaxPowerOfTwoBlockSize = int64_t(1) << 28;
+constexpr int64_t kLargeBlockRounding = int64_t(1) << 20;
+
+int64_t SizeClass(int64_t size) {
+  if (size <= kMaxPowerOfTwoBlockSize) {
+    return std::max(kMinBlockSize, BitUtil::NextPower2(size));
+  }
+  return BitUtil::RoundUp(size, kLargeBlockRounding);
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// CudaMemoryPool implementation
+
+class CudaMemoryPool::CudaMemoryPoolImpl {
+ public:
+  explicit CudaMemoryPoolImpl(const std::shared_ptr<CudaContext>& context)
+      : context_(context), bytes_allocated_(0), bytes_cached_(0), max_memory_(0) {}
+
+  ~CudaMemoryPoolImpl() {
+    DCHECK_OK(ReleaseCached());
+    // Memory still allocated belongs to the callers, and is left alone
+  }
+
+  Status Allocate(int64_t size, CUstream stream, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("Negative allocation size requested");
+    }
+    if (size == 0) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    const int64_t size_class = SizeClass(size);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    bool found = false;
+    RETURN_NOT_OK(TakeCached(size_class, stream, out, &found));
+    if (!found) {
+      Status st = context_->AllocateDevice(size_class, out);
+      if (!st.ok() && !cached_.empty()) {
+        // The device may be out of memory because of the cache
+        RETURN_NOT_OK(ReleaseCachedUnlocked());
+        st = context_->AllocateDevice(size_class, out);
+      }
+      RETURN_NOT_OK(st);
+    }
+    allocated_[*out] = size_class;
+    bytes_allocated_ += size_class;
+    max_memory_ = std::max(max_memory_, bytes_allocated_);
+    return Status::OK();
+  }
+
+  Status Free(uint8_t* data, int64_t size, CUstream stream) {
+    if (data == nullptr) {
+      return Status::OK();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = allocated_.find(data);
+    if (it == allocated_.end()) {
+      return Status::Invalid("Device memory was not allocated from this pool");
+    }
+    DCHECK_EQ(SizeClass(size), it->second);
+
+    Block block;
+    block.data = data;
+    block.stream = stream;
+    RETURN_NOT_OK(RecordEvent(stream, &block.event));
+    cached_.emplace(it->second, block);
+    bytes_allocated_ -= it->second;
+    bytes_cached_ += it->second;
+    allocated_.erase(it);
+    return Status::OK();
+  }
+
+  void Detach(uint8_t* data) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = allocated_.find(data);
+    if (it != allocated_.end()) {
+      bytes_allocated_ -= it->second;
+      allocated_.erase(it);
+    }
+  }
+
+  Status ReleaseCached() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ReleaseCachedUnlocked();
+  }
+
+  int64_t bytes_allocated() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_allocated_;
+  }
+
+  int64_t bytes_cached() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_cached_;
+  }
+
+  int64_t max_memory() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return max_memory_;
+  }
+
+  std::shared_ptr<CudaContext> context() const { return context_; }
+
+ private:
+  struct Block {
+    uint8_t* data;
+    // The stream that last used the block, and an event recorded on it when
+    // the block was freed
+    CUstream stream;
+    CUevent event;
+  };
+
+  // Find a cached block of the size class that the stream may use now
+  Status TakeCached(int64_t size_class, CUstream stream, uint8_t** out, bool* found) {
+    auto range = cached_.equal_range(size_class);
+    auto chosen = range.second;
+    for (auto it = range.first; it != range.second; ++it) {
+      if (it->second.stream == stream) {
+        chosen = it;
+        break;
+      }
+    }
+    if (chosen == range.second) {
+      ContextSaver set_temporary(context_handle());
+      for (auto it = range.first; it != range.second; ++it) {
+        CUresult ret = cuEventQuery(it->second.event);
+        if (ret == CUDA_SUCCESS) {
+          chosen = it;
+          break;
+        }
+        if (ret != CUDA_ERROR_NOT_READY) {
+          CU_RETURN_NOT_OK(ret);
+        }
+      }
+    }
+    *found = chosen != range.second;
+    if (*found) {
+      *out = chosen->second.data;
+      free_events_.push_back(chosen->second.event);
+      cached_.erase(chosen);
+      bytes_cached_ -= size_class;
+    }
+    return Status::OK();
+  }
+
+  Status RecordEvent(CUstream stream, CUevent* out) {
+    ContextSaver set_temporary(context_handle());
+    if (free_events_.empty()) {
+      CU_RETURN_NOT_OK(cuEventCreate(out, CU_EVENT_DISABLE_TIMING));
+    } else {
+      *out = free_events_.back();
+      free_events_.pop_back();
+    }
+    CUresult ret = cuEventRecord(*out, stream);
+    if (ret != CUDA_SUCCESS) {
+      free_events_.push_back(*out);
+      CU_RETURN_NOT_OK(ret);
+    }
+    return Status::OK();
+  }
+
+  Status ReleaseCachedUnlocked() {
+    ContextSaver set_temporary(context_handle());
+    while (!cached_.empty()) {
+      auto it = cached_.begin();
+      CU_RETURN_NOT_OK(cuEventSynchronize(it->second.event));
+      RETURN_NOT_OK(context_->Free(it->second.data, it->first));
+      free_events_.push_back(it->second.event);
+      bytes_cached_ -= it->first;
+      cached_.erase(it);
+    }
+    for (CUevent event : free_events_) {
+      CU_RETURN_NOT_OK(cuEventDestroy(event));
+    }
+    free_events_.clear();
+    return Status::OK();
+  }
+
+  CUcontext context_handle() const {
+    return reinterpret_cast<CUcontext>(context_->handle());
+  }
+
+  std::shared_ptr<CudaContext> context_;
+
+  mutable std::mutex mutex_;
+  // Cached blocks by size class
+  std::multimap<int64_t, Block> cached_;
+  // The size classes of the allocated blocks
+  std::unordered_map<uint8_t*, int64_t> allocated_;
+  std::vector<CUevent> free_events_;
+
+  int64_t bytes_allocated_;
+  int64_t bytes_cached_;
+  int64_t max_memory_;
+};
+
+// ----------------------------------------------------------------------
+// Buffers of pooled memory
+
+class CudaPoolBuffer : public CudaBuffer {
+ public:
+  CudaPoolBuffer(uint8_t* data, int64_t size, std::shared_ptr<CudaMemoryPool> pool,
+                 CUstream stream)
+      : CudaBuffer(data, size, pool->context()),
+        pool_(std::move(pool)),
+        stream_(stream) {}
+
+  ~CudaPoolBuffer() { DCHECK_OK(Close()); }
+
+  Status ExportForIpc(std::shared_ptr<CudaIpcMemHandle>* handle) override {
+    RETURN_NOT_OK(CudaBuffer::ExportForIpc(handle));
+    if (pool_) {
+      pool_->Detach(mutable_data_);
+      pool_.reset();
+    }
+    return Status::OK();
+  }
+
+ protected:
+  Status Close() override {
+    if (pool_) {
+      std::shared_ptr<CudaMemoryPool> pool = std::move(pool_);
+      return pool->Free(mutable_data_, size_, stream_);
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<CudaMemoryPool> pool_;
+  CUstream stream_;
+};
+
+// ----------------------------------------------------------------------
+// CudaMemoryPool public API
+
+CudaMemoryPool::CudaMemoryPool() {}
+
+CudaMemoryPool::~CudaMemoryPool() {}
+
+Status CudaMemoryPool::Make(const std::shared_ptr<CudaContext>& context,
+                            std::shared_ptr<CudaMemoryPool>* out) {
+  std::shared_ptr<CudaMemoryPool> pool(new CudaMemoryPool());
+  pool->impl_.reset(new CudaMemoryPoolImpl(context));
+  *out = std::move(pool);
+  return Status::OK();
+}
+
+Status CudaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, nullptr, out);
+}
+
+Status CudaMemoryPool::Allocate(int64_t size, void* stream, uint8_t** out) {
+  return impl_->Allocate(size, reinterpret_cast<CUstream>(stream), out);
+}
+
+Status CudaMemoryPool::Free(uint8_t* data, int64_t size) {
+  return impl_->Free(data, size, nullptr);
+}
+
+Status CudaMemoryPool::Free(uint8_t* data, int64_t size, void* stream) {
+  return impl_->Free(data, size, reinterpret_cast<CUstream>(stream));
+}
+
+Status CudaMemoryPool::AllocateBuffer(int64_t size, std::shared_ptr<CudaBuffer>* out) {
+  return AllocateBuffer(size, nullptr, out);
+}
+
+Status CudaMemoryPool::AllocateBuffer(int64_t size, void* stream,
+                                      std::shared_ptr<CudaBuffer>* out) {
+  uint8_t* data = nullptr;
+  RETURN_NOT_OK(Allocate(size, stream, &data));
+  *out = std::make_shared<CudaPoolBuffer>(data, size, shared_from_this(),
+                                          reinterpret_cast<CUstream>(stream));
+  return Status::OK();
+}
+
+Status CudaMemoryPool::ReleaseCached() { return impl_->ReleaseCached(); }
+
+void CudaMemoryPool::Detach(uint8_t* data) { impl_->Detach(data); }
+
+int64_t CudaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t CudaMemoryPool::bytes_cached() const { return impl_->bytes_cached(); }
+
+int64_t CudaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+std::shared_ptr<CudaContext> CudaMemoryPool::context() const {
+  return impl_->context();
+}
+
+// ----------------------------------------------------------------------
+// CudaHostBufferPool implementation
+
+class CudaHostBufferPool::CudaHostBufferPoolImpl
+    : public std::enable_shared_from_this<CudaHostBufferPoolImpl> {
+ public:
+  struct Staging {
+    std::shared_ptr<CudaHostBuffer> buffer;
+    // Recorded after the last transfer from or to the buffer
+    CUevent event;
+    bool pending;
+  };
+
+  CudaHostBufferPoolImpl(const std::shared_ptr<CudaContext>& context,
+                         int64_t buffer_size, int max_buffers)
+      : context_(context),
+        buffer_size_(buffer_size),
+        max_buffers_(max_buffers),
+        num_buffers_(0) {}
+
+  ~CudaHostBufferPoolImpl() {
+    ContextSaver set_temporary(context_handle());
+    for (const Staging& staging : free_) {
+      if (staging.pending) {
+        CUDA_DCHECK(cuEventSynchronize(staging.event));
+      }
+      CUDA_DCHECK(cuEventDestroy(staging.event));
+    }
+  }
+
+  // Take a staging buffer, once the transfers still using it are completed
+  Status Take(Staging* out) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this] { return !free_.empty() || num_buffers_ < max_buffers_; });
+      if (!free_.empty()) {
+        *out = free_.front();
+        free_.pop_front();
+      } else {
+        ++num_buffers_;
+        out->buffer.reset();
+      }
+    }
+    if (!out->buffer) {
+      Status st = NewStaging(out);
+      if (!st.ok()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --num_buffers_;
+        cv_.notify_one();
+        return st;
+      }
+    }
+    if (out->pending) {
+      ContextSaver set_temporary(context_handle());
+      CUresult ret = cuEventSynchronize(out->event);
+      if (ret != CUDA_SUCCESS) {
+        Give(*out);
+        CU_RETURN_NOT_OK(ret);
+      }
+      out->pending = false;
+    }
+    return Status::OK();
+  }
+
+  // Return a staging buffer, with the transfers queued from or to it
+  void Give(const Staging& staging) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_.push_back(staging);
+    cv_.notify_one();
+  }
+
+  // Record the completion of the transfers queued on the stream so far
+  Status MarkPending(CUstream stream, Staging* staging) {
+    ContextSaver set_temporary(context_handle());
+    CU_RETURN_NOT_OK(cuEventRecord(staging->event, stream));
+    staging->pending = true;
+    return Status::OK();
+  }
+
+  Status Acquire(std::shared_ptr<CudaHostBuffer>* out) {
+    Staging staging;
+    RETURN_NOT_OK(Take(&staging));
+    // The buffer returns to the pool, which it keeps alive, when released
+    std::shared_ptr<CudaHostBufferPoolImpl> self = shared_from_this();
+    *out = std::shared_ptr<CudaHostBuffer>(
+        staging.buffer.get(), [self, staging](CudaHostBuffer*) { self->Give(staging); });
+    return Status::OK();
+  }
+
+  Status CopyToDevice(const FillFunction& fill, int64_t nbytes, CudaBuffer* dst,
+                      int64_t position, CUstream stream,
+                      std::shared_ptr<CudaEvent>* done) {
+    DCHECK_LE(nbytes, dst->size() - position) << "Copy would overflow buffer";
+    for (int64_t offset = 0; offset < nbytes; offset += buffer_size_) {
+      const int64_t chunk = std::min(buffer_size_, nbytes - offset);
+      Staging staging;
+      RETURN_NOT_OK(Take(&staging));
+      Status st = fill(offset, chunk, staging.buffer->mutable_data());
+      if (!st.ok()) {
+        Give(staging);
+        return st;
+      }
+      st = context_->CopyHostToDeviceAsync(
+          dst->mutable_data() + position + offset, staging.buffer->data(), chunk, stream);
+      if (st.ok()) {
+        st = MarkPending(stream, &staging);
+      }
+      Give(staging);
+      RETURN_NOT_OK(st);
+    }
+    return context_->RecordEvent(stream, done);
+  }
+
+  Status CopyToHost(const CudaBuffer& src, int64_t position, int64_t nbytes,
+                    uint8_t* out, CUstream stream) {
+    DCHECK_LE(nbytes, src.size() - position) << "Copy would overflow buffer";
+    // The chunks being transferred, in order
+    std::deque<std::pair<Staging, int64_t>> in_flight;
+    int64_t next = 0;
+    Status st;
+    while (st.ok() && (next < nbytes || !in_flight.empty())) {
+      // Keep all the staging buffers busy
+      while (st.ok() && next < nbytes &&
+             static_cast<int>(in_flight.size()) < max_buffers_) {
+        const int64_t chunk = std::min(buffer_size_, nbytes - next);
+        Staging staging;
+        st = Take(&staging);
+        if (!st.ok()) break;
+        st = context_->CopyDeviceToHostAsync(staging.buffer->mutable_data(),
+                                             src.data() + position + next, chunk, stream);
+        if (st.ok()) {
+          st = MarkPending(stream, &staging);
+        }
+        in_flight.emplace_back(staging, next);
+        next += chunk;
+      }
+      if (!st.ok() || in_flight.empty()) break;
+
+      Staging staging = in_flight.front().first;
+      const int64_t offset = in_flight.front().second;
+      const int64_t chunk = std::min(buffer_size_, nbytes - offset);
+      in_flight.pop_front();
+      {
+        ContextSaver set_temporary(context_handle());
+        CUresult ret = cuEventSynchronize(staging.event);
+        if (ret == CUDA_SUCCESS) {
+          staging.pending = false;
+          std::memcpy(out + offset, staging.buffer->data(), chunk);
+        } else {
+          st = Status::IOError("Cuda Driver API call failed with code ", ret,
+                               ": cuEventSynchronize");
+        }
+      }
+      Give(staging);
+    }
+    // On error, the buffers are waited for when taken again
+    for (const auto& entry : in_flight) {
+      Give(entry.first);
+    }
+    return st;
+  }
+
+  int64_t buffer_size() const { return buffer_size_; }
+
+  int max_buffers() const { return max_buffers_; }
+
+ private:
+  Status NewStaging(Staging* out) {
+    CudaDeviceManager* manager = nullptr;
+    RETURN_NOT_OK(CudaDeviceManager::GetInstance(&manager));
+    RETURN_NOT_OK(
+        manager->AllocateHost(context_->device_number(), buffer_size_, &out->buffer));
+    ContextSaver set_temporary(context_handle());
+    CU_RETURN_NOT_OK(cuEventCreate(&out->event, CU_EVENT_DISABLE_TIMING));
+    out->pending = false;
+    return Status::OK();
+  }
+
+  CUcontext context_handle() const {
+    return reinterpret_cast<CUcontext>(context_->handle());
+  }
+
+  std::shared_ptr<CudaContext> context_;
+  const int64_t buffer_size_;
+  const int max_buffers_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  // The staging buffers not in use, oldest first
+  std::deque<Staging> free_;
+  int num_buffers_;
+};
+
+// ----------------------------------------------------------------------
+// CudaHostBufferPool public API
+
+CudaHostBufferPool::CudaHostBufferPool() {}
+
+CudaHostBufferPool::~CudaHostBufferPool() {}
+
+Status CudaHostBufferPool::Make(const std::shared_ptr<CudaContext>& context,
+                                int64_t buffer_size, int max_buffers,
+                                std::shared_ptr<CudaHostBufferPool>* out) {
+  if (buffer_size <= 0 || max_buffers <= 0) {
+    return Status::Invalid("Staging buffer size and count must be positive");
+  }
+  std::shared_ptr<CudaHostBufferPool> pool(new CudaHostBufferPool());
+  pool->impl_ = std::make_shared<CudaHostBufferPoolImpl>(context, buffer_size,
+                                                         max_buffers);
+  *out = std::move(pool);
+  return Status::OK();
+}
+
+Status CudaHostBufferPool::Acquire(std::shared_ptr<CudaHostBuffer>* out) {
+  return impl_->Acquire(out);
+}
+
+Status CudaHostBufferPool::CopyToDevice(const void* data, int64_t nbytes,
+                                        CudaBuffer* dst, int64_t position, void* stream,
+                                        std::shared_ptr<CudaEvent>* done) {
+  const uint8_t* src = reinterpret_cast<const uint8_t*>(data);
+  auto fill = [src](int64_t offset, int64_t chunk, uint8_t* staging) -> Status {
+    std::memcpy(staging, src + offset, chunk);
+    return Status::OK();
+  };
+  return impl_->CopyToDevice(fill, nbytes, dst, position,
+                             reinterpret_cast<CUstream>(stream), done);
+}
+
+Status CudaHostBufferPool::CopyToDevice(const FillFunction& fill, int64_t nbytes,
+                                        CudaBuffer* dst, int64_t position, void* stream,
+                                        std::shared_ptr<CudaEvent>* done) {
+  return impl_->CopyToDevice(fill, nbytes, dst, position,
+                             reinterpret_cast<CUstream>(stream), done);
+}
+
+Status CudaHostBufferPool::CopyToHost(const CudaBuffer& src, int64_t position,
+                                      int64_t nbytes, void* out, void* stream) {
+  return impl_->CopyToHost(src, position, nbytes, reinterpret_cast<uint8_t*>(out),
+                           reinterpret_cast<CUstream>(stream));
+}
+
+int64_t CudaHostBufferPool::buffer_size() const { return impl_->buffer_size(); }
+
+int CudaHostBufferPool::max_buffers() const { return impl_->max_buffers(); }
+
+}  // namespace cuda
+}  // namespace arrow
@@ -0,0 +1,213 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_GPU_CUDA_MEMORY_POOL_H
+#define ARROW_GPU_CUDA_MEMORY_POOL_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+#include "arrow/gpu/cuda_memory.h"
+
+namespace arrow {
+namespace cuda {
+
+class CudaContext;
+class CudaEvent;
+
+/// \class CudaMemoryPool
+/// \brief A caching allocator of device memory for one CudaContext
+///
+/// cuMemAlloc and cuMemFree synchronize the device, so freed memory is kept
+/// by the pool for later allocations rather than returned to the driver.
+/// Allocations are rounded up to a size class: a power of two up to 256 MiB,
+/// and a multiple of 1 MiB beyond.
+///
+/// Memory may be freed with the CUDA stream (a CUstream, or null for the
+/// default stream) that last used it. It is then reused right away by
+/// allocations on the same stream, whose work is ordered after that use, and
+/// by allocations on other streams once the work queued on the stream when
+/// it was freed has completed.
+class ARROW_EXPORT CudaMemoryPool : public std::enable_shared_from_this<CudaMemoryPool> {
+ public:
+  ~CudaMemoryPool();
+
+  /// \brief Create a pool allocating from a context
+  /// \param[in] context the CUDA context
+  /// \param[out] out the pool
+  /// \return Status
+  static Status Make(const std::shared_ptr<CudaContext>& context,
+                     std::shared_ptr<CudaMemoryPool>* out);
+
+  /// \brief Allocate device memory for use on the default stream
+  /// \param[in] size number of bytes, which may be 0
+  /// \param[out] out the device address, null if size is 0
+  /// \return Status
+  Status Allocate(int64_t size, uint8_t** out);
+
+  /// \brief Allocate device memory for use on a stream
+  /// \param[in] size number of bytes, which may be 0
+  /// \param[in] stream the CUstream the memory is used on
+  /// \param[out] out the device address, null if size is 0
+  /// \return Status
+  Status Allocate(int64_t size, void* stream, uint8_t** out);
+
+  /// \brief Return memory used on the default stream to the pool
+  /// \param[in] data the device address from Allocate
+  /// \param[in] size the size passed to Allocate
+  /// \return Status
+  Status Free(uint8_t* data, int64_t size);
+
+  /// \brief Return memory to the pool, once the work queued on a stream so
+  /// far has completed
+  /// \param[in] data the device address from Allocate
+  /// \param[in] size the size passed to Allocate
+  /// \param[in] stream the CUstream that last used the memory
+  /// \return Status
+  Status Free(uint8_t* data, int64_t size, void* stream);
+
+  /// \brief Allocate a CudaBuffer whose memory returns to the pool when it
+  /// is destroyed. The buffer keeps the pool alive
+  /// \param[in] size number of bytes
+  /// \param[out] out the allocated buffer
+  /// \return Status
+  Status AllocateBuffer(int64_t size, std::shared_ptr<CudaBuffer>* out);
+
+  /// \brief Like the above, for use on a stream
+  /// \param[in] size number of bytes
+  /// \param[in] stream the CUstream the buffer is used on
+  /// \param[out] out the allocated buffer
+  /// \return Status
+  Status AllocateBuffer(int64_t size, void* stream, std::shared_ptr<CudaBuffer>* out);
+
+  /// \brief Return the cached memory to the driver, waiting for the work
+  /// still using it
+  /// \return Status
+  Status ReleaseCached();
+
+  /// \brief The bytes allocated from the pool and not freed, by size class
+  int64_t bytes_allocated() const;
+
+  /// \brief The bytes kept by the pool for reuse
+  int64_t bytes_cached() const;
+
+  /// \brief The peak of bytes_allocated
+  int64_t max_memory() const;
+
+  std::shared_ptr<CudaContext> context() const;
+
+ private:
+  CudaMemoryPool();
+
+  // Stop tracking memory exported for IPC, which is never freed
+  void Detach(uint8_t* data);
+
+  class CudaMemoryPoolImpl;
+  std::unique_ptr<CudaMemoryPoolImpl> impl_;
+
+  friend class CudaPoolBuffer;
+};
+
+/// \class CudaHostBufferPool
+/// \brief A pool of pinned host buffers of one size, which stage the copies
+/// between pageable host memory and a device
+///
+/// Only copies from and to pinned memory run asynchronously, at the full
+/// bandwidth of the bus, while pinning memory is slow. The buffers are
+/// allocated as needed with CudaDeviceManager::AllocateHost, and reused.
+class ARROW_EXPORT CudaHostBufferPool {
+ public:
+  ~CudaHostBufferPool();
+
+  /// \brief Create a pool of staging buffers for the device of a context
+  /// \param[in] context the CUDA context
+  /// \param[in] buffer_size the size of each buffer
+  /// \param[in] max_buffers the maximum number of buffers
+  /// \param[out] out the pool
+  /// \return Status
+  static Status Make(const std::shared_ptr<CudaContext>& context, int64_t buffer_size,
+                     int max_buffers, std::shared_ptr<CudaHostBufferPool>* out);
+
+  /// \brief Take a buffer, blocking while all of them are in use. It returns
+  /// to the pool when destroyed
+  /// \param[out] out the buffer
+  /// \return Status
+  Status Acquire(std::shared_ptr<CudaHostBuffer>* out);
+
+  /// \brief Queue a copy of host memory to device memory on a stream, through
+  /// the staging buffers. The host memory may be reused once this returns
+  /// \param[in] data the host data to copy
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] dst the device buffer, of the device of the pool
+  /// \param[in] position start position inside dst to copy bytes to
+  /// \param[in] stream the CUstream to queue the copy on, or null for the
+  /// default stream
+  /// \param[out] done an event completed with the copy
+  /// \return Status
+  Status CopyToDevice(const void* data, int64_t nbytes, CudaBuffer* dst,
+                      int64_t position, void* stream, std::shared_ptr<CudaEvent>* done);
+
+  /// \brief Function writing a chunk of the data copied by CopyToDevice into
+  /// a staging buffer, e.g. by reading it from a file. It is given the offset
+  /// of the chunk in the data, its size, and the staging memory
+  using FillFunction = std::function<Status(int64_t, int64_t, uint8_t*)>;
+
+  /// \brief Like the above, with each chunk of the data written into the
+  /// staging buffers by a function
+  /// \param[in] fill the function writing the chunks
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] dst the device buffer, of the device of the pool
+  /// \param[in] position start position inside dst to copy bytes to
+  /// \param[in] stream the CUstream to queue the copy on, or null for the
+  /// default stream
+  /// \param[out] done an event completed with the copy
+  /// \return Status
+  Status CopyToDevice(const FillFunction& fill, int64_t nbytes, CudaBuffer* dst,
+                      int64_t position, void* stream, std::shared_ptr<CudaEvent>* done);
+
+  /// \brief Copy device memory to host memory through the staging buffers.
+  /// The transfer of each chunk overlaps with the copy of the previous ones
+  /// out of the staging buffers
+  /// \param[in] src the device buffer, of the device of the pool
+  /// \param[in] position start position inside src to copy bytes from
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[out] out start address of the host memory area to copy to
+  /// \param[in] stream the CUstream to queue the transfers on, or null for
+  /// the default stream
+  /// \return Status
+  Status CopyToHost(const CudaBuffer& src, int64_t position, int64_t nbytes, void* out,
+                    void* stream);
+
+  int64_t buffer_size() const;
+
+  int max_buffers() const;
+
+ private:
+  CudaHostBufferPool();
+
+  class CudaHostBufferPoolImpl;
+  std::shared_ptr<CudaHostBufferPoolImpl> impl_;
+};
+
+}  // namespace cuda
+}  // namespace arrow
+
+#endif  // ARROW_GPU_CUDA_MEMORY_POOL_H
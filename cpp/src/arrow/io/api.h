@@ -18,11 +18,15 @@
 #ifndef ARROW_IO_API_H
 #define ARROW_IO_API_H
 
+#include "arrow/io/async-file.h"
 #include "arrow/io/buffered.h"
+#include "arrow/io/cached-file.h"
 #include "arrow/io/compressed.h"
 #include "arrow/io/file.h"
 #include "arrow/io/hdfs.h"
+#include "arrow/io/instrumented.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/object-store.h"
 
 #endif  // ARROW_IO_API_H
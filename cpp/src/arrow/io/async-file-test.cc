@@ -0,0 +1,204 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/async-file.h"
+#include "arrow/io/test-common.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+
+namespace arrow {
+namespace io {
+
+constexpr int64_t kFileSize = 1 << 20;
+
+// Parameterized on whether to use io_uring
+class TestAsyncReadableFile : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override {
+    path_ = "arrow-test-io-async-file.bin";
+    data_.resize(kFileSize);
+    random_bytes(kFileSize, 0, data_.data());
+    std::ofstream stream(path_.c_str(), std::ios::binary);
+    stream.write(reinterpret_cast<const char*>(data_.data()), kFileSize);
+  }
+
+  void TearDown() override {
+    file_.reset();
+    if (FileExists(path_)) {
+      ARROW_UNUSED(std::remove(path_.c_str()));
+    }
+  }
+
+  Status OpenFile(AsyncReadOptions options = AsyncReadOptions::Defaults()) {
+    options.use_io_uring = GetParam();
+    return AsyncReadableFile::Open(path_, options, default_memory_pool(), &file_);
+  }
+
+  // Check a buffer read at the given position, as truncated by the end of file
+  void AssertRead(int64_t position, int64_t nbytes, const Buffer& actual) {
+    const int64_t offset = std::min(position, kFileSize);
+    const int64_t length = std::min(nbytes, kFileSize - offset);
+    ASSERT_TRUE(actual.Equals(Buffer(data_.data() + offset, length)))
+        << "read of " << nbytes << " bytes at " << position;
+  }
+
+ protected:
+  std::string path_;
+  std::vector<uint8_t> data_;
+  std::shared_ptr<AsyncReadableFile> file_;
+};
+
+TEST_P(TestAsyncReadableFile, ManyReadsInFlight) {
+  AsyncReadOptions options = AsyncReadOptions::Defaults();
+  options.queue_depth = 8;
+  ASSERT_OK(OpenFile(options));
+
+  // More reads than the queue depth, including some past the end of file
+  std::vector<std::pair<int64_t, int64_t>> reads;
+  for (int64_t i = 0; i < 200; ++i) {
+    reads.emplace_back((i * 7919) % (kFileSize + 100), (i * 104729) % 20000);
+  }
+  reads.emplace_back(kFileSize * 2, 10);
+
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  for (const auto& read : reads) {
+    futures.push_back(file_->ReadAtAsync(read.first, read.second));
+  }
+  for (size_t i = 0; i < reads.size(); ++i) {
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(futures[i].Get(&buffer));
+    AssertRead(reads[i].first, reads[i].second, *buffer);
+  }
+}
+
+TEST_P(TestAsyncReadableFile, SyncInterface) {
+  ASSERT_OK(OpenFile());
+
+  int64_t size;
+  ASSERT_OK(file_->GetSize(&size));
+  ASSERT_EQ(kFileSize, size);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->ReadAt(1000, 5000, &buffer));
+  AssertRead(1000, 5000, *buffer);
+
+  uint8_t out[100];
+  int64_t bytes_read;
+  ASSERT_OK(file_->ReadAt(kFileSize - 10, 100, &bytes_read, out));
+  ASSERT_EQ(10, bytes_read);
+  AssertRead(kFileSize - 10, 100, Buffer(out, bytes_read));
+
+  int64_t position;
+  ASSERT_OK(file_->Seek(300));
+  ASSERT_OK(file_->Read(100, &buffer));
+  AssertRead(300, 100, *buffer);
+  ASSERT_OK(file_->Read(100, &bytes_read, out));
+  AssertRead(400, 100, Buffer(out, bytes_read));
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(500, position);
+
+  ASSERT_OK(file_->ReadAt(0, 0, &buffer));
+  ASSERT_EQ(0, buffer->size());
+  ASSERT_RAISES(Invalid, file_->ReadAt(-1, 10, &buffer));
+}
+
+TEST_P(TestAsyncReadableFile, Close) {
+  ASSERT_OK(OpenFile());
+  if (!GetParam()) {
+    ASSERT_FALSE(file_->uses_io_uring());
+  }
+
+  // Close() waits for pending reads
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  for (int64_t i = 0; i < 50; ++i) {
+    futures.push_back(file_->ReadAtAsync(i * 10000, 10000));
+  }
+  ASSERT_FALSE(file_->closed());
+  ASSERT_OK(file_->Close());
+  ASSERT_TRUE(file_->closed());
+  for (int64_t i = 0; i < 50; ++i) {
+    ASSERT_TRUE(futures[i].is_finished());
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(futures[i].Get(&buffer));
+    AssertRead(i * 10000, 10000, *buffer);
+  }
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_RAISES(Invalid, file_->ReadAtAsync(0, 10).Get(&buffer));
+  int64_t size;
+  ASSERT_RAISES(Invalid, file_->GetSize(&size));
+  // Idempotent
+  ASSERT_OK(file_->Close());
+}
+
+TEST_P(TestAsyncReadableFile, DirectIO) {
+  AsyncReadOptions options = AsyncReadOptions::Defaults();
+  options.direct_io = true;
+  Status st = OpenFile(options);
+  if (st.IsIOError()) {
+    // Not all file systems support O_DIRECT (e.g. tmpfs)
+    std::cout << "Skipping test: " << st.ToString() << std::endl;
+    return;
+  }
+  ASSERT_OK(st);
+
+  std::vector<std::pair<int64_t, int64_t>> reads = {
+      {0, 4096}, {1, 10}, {4095, 2}, {12345, 54321}, {kFileSize - 1, 4096}};
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  for (const auto& read : reads) {
+    futures.push_back(file_->ReadAtAsync(read.first, read.second));
+  }
+  for (size_t i = 0; i < reads.size(); ++i) {
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(futures[i].Get(&buffer));
+    AssertRead(reads[i].first, reads[i].second, *buffer);
+  }
+}
+
+TEST_P(TestAsyncReadableFile, InvalidOptions) {
+  AsyncReadOptions options = AsyncReadOptions::Defaults();
+  options.queue_depth = 0;
+  ASSERT_RAISES(Invalid, OpenFile(options));
+
+  options = AsyncReadOptions::Defaults();
+  options.direct_io = true;
+  options.direct_io_alignment = 1000;
+  ASSERT_RAISES(Invalid, OpenFile(options));
+
+  ASSERT_RAISES(IOError, AsyncReadableFile::Open("0xDEADBEEF.txt", &file_));
+}
+
+INSTANTIATE_TEST_CASE_P(ThreadPoolAndIoUring, TestAsyncReadableFile,
+                        ::testing::Values(false, true));
+
+}  // namespace io
+}  // namespace arrow
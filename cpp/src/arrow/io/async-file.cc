@@ -0,0 +1,609 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/windows_compatibility.h"  // IWYU pragma: keep
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/uio.h>
+#endif
+
+// io_uring is used through raw system calls, so only the kernel headers
+// are needed
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define ARROW_IO_URING
+#endif
+#endif
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "arrow/io/async-file.h"
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/io-util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+namespace io {
+
+AsyncReadOptions AsyncReadOptions::Defaults() {
+  AsyncReadOptions options;
+  options.queue_depth = 64;
+  options.direct_io = false;
+  options.direct_io_alignment = 4096;
+  options.use_io_uring = true;
+  return options;
+}
+
+namespace {
+
+// A read in progress.  For direct I/O, the read is widened to aligned
+// boundaries and `skip` leading bytes are dropped from the result.
+struct ReadRequest {
+  Future<std::shared_ptr<Buffer>> future;
+  std::shared_ptr<Buffer> allocation;
+  uint8_t* data;
+  int64_t position;
+  int64_t nbytes;
+  int64_t bytes_read;
+  int64_t skip;
+  int64_t requested;
+#ifdef ARROW_IO_URING
+  struct iovec iov;
+#endif
+};
+
+std::shared_ptr<Buffer> ReadResult(const ReadRequest& request) {
+  const int64_t available = std::max<int64_t>(request.bytes_read - request.skip, 0);
+  const int64_t offset = request.data - request.allocation->data() + request.skip;
+  return SliceBuffer(request.allocation, offset, std::min(request.requested, available));
+}
+
+}  // namespace
+
+#ifdef ARROW_IO_URING
+
+// ----------------------------------------------------------------------
+// io_uring submission and completion
+
+namespace {
+
+int IoUringSetup(unsigned entries, struct io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, NULLPTR, 0));
+}
+
+// A memory-mapped region of the ring
+struct RingMapping {
+  void* address = MAP_FAILED;
+  size_t size = 0;
+
+  Status Map(int ring_fd, size_t nbytes, off_t offset) {
+    size = nbytes;
+    address = mmap(NULLPTR, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                   ring_fd, offset);
+    if (address == MAP_FAILED) {
+      return Status::IOError("Failed to map io_uring: ", std::strerror(errno));
+    }
+    return Status::OK();
+  }
+
+  template <typename T>
+  T* At(uint32_t offset) const {
+    return reinterpret_cast<T*>(static_cast<uint8_t*>(address) + offset);
+  }
+
+  ~RingMapping() {
+    if (address != MAP_FAILED) {
+      munmap(address, size);
+    }
+  }
+};
+
+}  // namespace
+
+class IoUring {
+ public:
+  using OnComplete = std::function<void(ReadRequest*, Status)>;
+
+  ~IoUring() {
+    if (reaper_.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        SubmitLocked(NULLPTR);
+      }
+      reaper_.join();
+    }
+    if (ring_fd_ != -1) {
+      close(ring_fd_);
+    }
+  }
+
+  // Fails if the kernel doesn't support io_uring
+  static Status Make(int fd, int32_t queue_depth, OnComplete on_complete,
+                     std::unique_ptr<IoUring>* out) {
+    std::unique_ptr<IoUring> ring(new IoUring(fd, std::move(on_complete)));
+    RETURN_NOT_OK(ring->Init(queue_depth));
+    *out = std::move(ring);
+    return Status::OK();
+  }
+
+  void Submit(ReadRequest* request) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (in_flight_ < max_in_flight_) {
+      ++in_flight_;
+      SubmitLocked(request);
+    } else {
+      queued_.push_back(request);
+    }
+  }
+
+ private:
+  IoUring(int fd, OnComplete on_complete)
+      : fd_(fd), on_complete_(std::move(on_complete)), ring_fd_(-1), in_flight_(0) {}
+
+  Status Init(int32_t queue_depth) {
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring_fd_ = IoUringSetup(static_cast<unsigned>(queue_depth), &params);
+    if (ring_fd_ < 0) {
+      return Status::IOError("io_uring_setup failed: ", std::strerror(errno));
+    }
+    // The completion queue is at least as large as the submission queue,
+    // so bounding submissions ensures completions never overflow
+    max_in_flight_ = std::min(queue_depth, static_cast<int32_t>(params.sq_entries));
+
+    RETURN_NOT_OK(sq_ring_.Map(
+        ring_fd_, params.sq_off.array + params.sq_entries * sizeof(uint32_t),
+        IORING_OFF_SQ_RING));
+    RETURN_NOT_OK(sqes_.Map(ring_fd_, params.sq_entries * sizeof(struct io_uring_sqe),
+                            IORING_OFF_SQES));
+    RETURN_NOT_OK(cq_ring_.Map(
+        ring_fd_, params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe),
+        IORING_OFF_CQ_RING));
+
+    sq_tail_ = sq_ring_.At<uint32_t>(params.sq_off.tail);
+    sq_mask_ = *sq_ring_.At<uint32_t>(params.sq_off.ring_mask);
+    sq_array_ = sq_ring_.At<uint32_t>(params.sq_off.array);
+    cq_head_ = cq_ring_.At<uint32_t>(params.cq_off.head);
+    cq_tail_ = cq_ring_.At<uint32_t>(params.cq_off.tail);
+    cq_mask_ = *cq_ring_.At<uint32_t>(params.cq_off.ring_mask);
+    cqes_ = cq_ring_.At<struct io_uring_cqe>(params.cq_off.cqes);
+
+    reaper_ = std::thread([this]() { ReapCompletions(); });
+    return Status::OK();
+  }
+
+  // Submit the remainder of a read, or a no-op waking up the reaper
+  // thread for termination if `request` is null
+  void SubmitLocked(ReadRequest* request) {
+    const uint32_t tail = *sq_tail_;
+    const uint32_t index = tail & sq_mask_;
+    struct io_uring_sqe* sqe = sqes_.At<struct io_uring_sqe>(0) + index;
+    std::memset(sqe, 0, sizeof(*sqe));
+    if (request != NULLPTR) {
+      request->iov.iov_base = request->data + request->bytes_read;
+      request->iov.iov_len = static_cast<size_t>(request->nbytes - request->bytes_read);
+      sqe->opcode = IORING_OP_READV;
+      sqe->fd = fd_;
+      sqe->off = static_cast<uint64_t>(request->position + request->bytes_read);
+      sqe->addr = reinterpret_cast<uint64_t>(&request->iov);
+      sqe->len = 1;
+    } else {
+      sqe->opcode = IORING_OP_NOP;
+    }
+    sqe->user_data = reinterpret_cast<uint64_t>(request);
+    sq_array_[index] = index;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+
+    int ret;
+    do {
+      ret = IoUringEnter(ring_fd_, 1, 0, 0);
+    } while (ret < 0 && errno == EINTR);
+    if (ret < 0) {
+      ARROW_LOG(ERROR) << "io_uring_enter failed: " << std::strerror(errno);
+    }
+  }
+
+  void ReapCompletions() {
+    bool stopping = false;
+    std::vector<std::pair<ReadRequest*, int32_t>> completions;
+    while (!stopping) {
+      if (IoUringEnter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR) {
+        ARROW_LOG(ERROR) << "io_uring_enter failed: " << std::strerror(errno);
+      }
+      uint32_t head = *cq_head_;
+      const uint32_t tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      for (; head != tail; ++head) {
+        const struct io_uring_cqe& cqe = cqes_[head & cq_mask_];
+        auto request = reinterpret_cast<ReadRequest*>(cqe.user_data);
+        if (request == NULLPTR) {
+          stopping = true;
+        } else {
+          completions.emplace_back(request, cqe.res);
+        }
+      }
+      __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+
+      for (const auto& completion : completions) {
+        Complete(completion.first, completion.second);
+      }
+      completions.clear();
+    }
+  }
+
+  void Complete(ReadRequest* request, int32_t result) {
+    Status st;
+    if (result == -EAGAIN || result == -EINTR) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      SubmitLocked(request);
+      return;
+    }
+    if (result < 0) {
+      st = Status::IOError("Error reading bytes from file: ", std::strerror(-result));
+    } else {
+      request->bytes_read += result;
+      if (result > 0 && request->bytes_read < request->nbytes) {
+        // Short read before the end of the file
+        std::lock_guard<std::mutex> lock(mutex_);
+        SubmitLocked(request);
+        return;
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (queued_.empty()) {
+        --in_flight_;
+      } else {
+        SubmitLocked(queued_.front());
+        queued_.pop_front();
+      }
+    }
+    on_complete_(request, std::move(st));
+  }
+
+  const int fd_;
+  const OnComplete on_complete_;
+  int ring_fd_;
+
+  RingMapping sq_ring_;
+  RingMapping sqes_;
+  RingMapping cq_ring_;
+  uint32_t* sq_tail_;
+  uint32_t sq_mask_;
+  uint32_t* sq_array_;
+  uint32_t* cq_head_;
+  uint32_t* cq_tail_;
+  uint32_t cq_mask_;
+  struct io_uring_cqe* cqes_;
+
+  std::mutex mutex_;
+  int32_t in_flight_;
+  int32_t max_in_flight_;
+  std::deque<ReadRequest*> queued_;
+  std::thread reaper_;
+};
+
+#endif  // ARROW_IO_URING
+
+// ----------------------------------------------------------------------
+// AsyncReadableFile implementation
+
+class AsyncReadableFile::Impl : public std::enable_shared_from_this<Impl> {
+ public:
+  Impl(const AsyncReadOptions& options, MemoryPool* pool)
+      : options_(options), pool_(pool), fd_(-1), pending_reads_(0), position_(0) {}
+
+  ~Impl() { ARROW_CHECK_OK(Close()); }
+
+  Status Open(const std::string& path) {
+    if (options_.queue_depth <= 0) {
+      return Status::Invalid("Queue depth must be positive");
+    }
+    const int64_t alignment = options_.direct_io_alignment;
+    if (options_.direct_io && (alignment <= 0 || (alignment & (alignment - 1)) != 0)) {
+      return Status::Invalid("Direct I/O alignment must be a power of two");
+    }
+    internal::PlatformFilename file_name;
+    RETURN_NOT_OK(internal::FileNameFromString(path, &file_name));
+    RETURN_NOT_OK(internal::FileOpenReadable(file_name, &fd_));
+    if (options_.direct_io) {
+      RETURN_NOT_OK(EnableDirectIO());
+    }
+#ifdef ARROW_IO_URING
+    if (options_.use_io_uring) {
+      auto on_complete = [this](ReadRequest* request, Status st) {
+        Finish(std::unique_ptr<ReadRequest>(request), std::move(st));
+      };
+      // Fall back to the thread pool if io_uring is unsupported
+      if (!IoUring::Make(fd_, options_.queue_depth, on_complete, &ring_).ok()) {
+        ring_.reset();
+      }
+    }
+#endif
+    return Status::OK();
+  }
+
+  Future<std::shared_ptr<Buffer>> ReadAtAsync(int64_t position, int64_t nbytes) {
+    if (position < 0 || nbytes < 0) {
+      return Future<std::shared_ptr<Buffer>>::MakeFailed(
+          Status::Invalid("Read position and length must be non-negative"));
+    }
+    std::unique_ptr<ReadRequest> request;
+    Status st = MakeRequest(position, nbytes, &request);
+    if (!st.ok()) {
+      return Future<std::shared_ptr<Buffer>>::MakeFailed(std::move(st));
+    }
+    auto future = request->future;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (fd_ == -1) {
+      return Future<std::shared_ptr<Buffer>>::MakeFailed(
+          Status::Invalid("Operation on closed file"));
+    }
+    ++pending_reads_;
+    lock.unlock();
+#ifdef ARROW_IO_URING
+    if (ring_) {
+      ring_->Submit(request.release());
+      return future;
+    }
+#endif
+    auto self = shared_from_this();
+    auto raw_request = request.release();
+    st = internal::GetIOThreadPool()->Spawn([self, raw_request]() {
+      std::unique_ptr<ReadRequest> request(raw_request);
+      Status st = internal::FileReadAt(self->fd_, request->data, request->position,
+                                       request->nbytes, &request->bytes_read);
+      self->Finish(std::move(request), std::move(st));
+    });
+    if (!st.ok()) {
+      Finish(std::unique_ptr<ReadRequest>(raw_request), std::move(st));
+    }
+    return future;
+  }
+
+  Status Close() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (fd_ == -1) {
+      return Status::OK();
+    }
+    // Reads may still be submitted while waiting, as long as the file is open
+    reads_done_.wait(lock, [this]() { return pending_reads_ == 0; });
+#ifdef ARROW_IO_URING
+    ring_.reset();
+#endif
+    const int fd = fd_;
+    fd_ = -1;
+    return internal::FileClose(fd);
+  }
+
+  bool closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return fd_ == -1;
+  }
+
+  Status CheckClosed() const {
+    if (closed()) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  Status GetSize(int64_t* size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (fd_ == -1) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return internal::FileGetSize(fd_, size);
+  }
+
+  bool uses_io_uring() const {
+#ifdef ARROW_IO_URING
+    return ring_ != NULLPTR;
+#else
+    return false;
+#endif
+  }
+
+  Status Tell(int64_t* position) {
+    RETURN_NOT_OK(CheckClosed());
+    std::lock_guard<std::mutex> lock(position_mutex_);
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status Seek(int64_t position) {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0) {
+      return Status::Invalid("Invalid position");
+    }
+    std::lock_guard<std::mutex> lock(position_mutex_);
+    position_ = position;
+    return Status::OK();
+  }
+
+  // Read at the current position, then advance it
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> lock(position_mutex_);
+    RETURN_NOT_OK(ReadAtAsync(position_, nbytes).Get(out));
+    position_ += (*out)->size();
+    return Status::OK();
+  }
+
+ private:
+  Status EnableDirectIO() {
+#if defined(O_DIRECT) && !defined(_WIN32)
+    const int flags = fcntl(fd_, F_GETFL);
+    if (flags == -1 || fcntl(fd_, F_SETFL, flags | O_DIRECT) == -1) {
+      return Status::IOError("Failed to enable direct I/O: ", std::strerror(errno));
+    }
+    return Status::OK();
+#else
+    return Status::NotImplemented("Direct I/O is not supported on this platform");
+#endif
+  }
+
+  Status MakeRequest(int64_t position, int64_t nbytes,
+                     std::unique_ptr<ReadRequest>* out) {
+    std::unique_ptr<ReadRequest> request(new ReadRequest);
+    request->future = Future<std::shared_ptr<Buffer>>::Make();
+    request->bytes_read = 0;
+    request->requested = nbytes;
+    if (options_.direct_io) {
+      const int64_t alignment = options_.direct_io_alignment;
+      request->position = position & ~(alignment - 1);
+      request->skip = position - request->position;
+      request->nbytes = BitUtil::RoundUp(request->skip + nbytes, alignment);
+      // Over-allocate so as to align the start of the read
+      RETURN_NOT_OK(
+          AllocateBuffer(pool_, request->nbytes + alignment, &request->allocation));
+      const auto address = reinterpret_cast<uintptr_t>(request->allocation->data());
+      request->data = request->allocation->mutable_data() +
+                      (BitUtil::RoundUp(address, alignment) - address);
+    } else {
+      request->position = position;
+      request->skip = 0;
+      request->nbytes = nbytes;
+      RETURN_NOT_OK(AllocateBuffer(pool_, nbytes, &request->allocation));
+      request->data = request->allocation->mutable_data();
+    }
+    *out = std::move(request);
+    return Status::OK();
+  }
+
+  void Finish(std::unique_ptr<ReadRequest> request, Status st) {
+    if (st.ok()) {
+      request->future.MarkFinished(ReadResult(*request));
+    } else {
+      request->future.MarkFailed(std::move(st));
+    }
+    request.reset();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--pending_reads_ == 0) {
+      reads_done_.notify_all();
+    }
+  }
+
+  const AsyncReadOptions options_;
+  MemoryPool* pool_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable reads_done_;
+  int fd_;
+  int64_t pending_reads_;
+
+  // Serializes Read() calls, which use the current position
+  std::mutex position_mutex_;
+  int64_t position_;
+#ifdef ARROW_IO_URING
+  std::unique_ptr<IoUring> ring_;
+#endif
+};
+
+AsyncReadableFile::AsyncReadableFile() {}
+
+AsyncReadableFile::~AsyncReadableFile() { ARROW_CHECK_OK(impl_->Close()); }
+
+Status AsyncReadableFile::Open(const std::string& path, const AsyncReadOptions& options,
+                               MemoryPool* pool,
+                               std::shared_ptr<AsyncReadableFile>* file) {
+  std::shared_ptr<AsyncReadableFile> result(new AsyncReadableFile());
+  result->impl_ = std::make_shared<Impl>(options, pool);
+  RETURN_NOT_OK(result->impl_->Open(path));
+  *file = std::move(result);
+  return Status::OK();
+}
+
+Status AsyncReadableFile::Open(const std::string& path,
+                               std::shared_ptr<AsyncReadableFile>* file) {
+  return Open(path, AsyncReadOptions::Defaults(), default_memory_pool(), file);
+}
+
+Future<std::shared_ptr<Buffer>> AsyncReadableFile::ReadAtAsync(int64_t position,
+                                                               int64_t nbytes) {
+  return impl_->ReadAtAsync(position, nbytes);
+}
+
+bool AsyncReadableFile::uses_io_uring() const { return impl_->uses_io_uring(); }
+
+Status AsyncReadableFile::Close() { return impl_->Close(); }
+
+bool AsyncReadableFile::closed() const { return impl_->closed(); }
+
+Status AsyncReadableFile::Tell(int64_t* position) const { return impl_->Tell(position); }
+
+Status AsyncReadableFile::Seek(int64_t position) { return impl_->Seek(position); }
+
+Status AsyncReadableFile::GetSize(int64_t* size) { return impl_->GetSize(size); }
+
+Status AsyncReadableFile::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(impl_->Read(nbytes, &buffer));
+  std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+  *bytes_read = buffer->size();
+  return Status::OK();
+}
+
+Status AsyncReadableFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Status AsyncReadableFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                                 void* out) {
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(ReadAt(position, nbytes, &buffer));
+  std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+  *bytes_read = buffer->size();
+  return Status::OK();
+}
+
+Status AsyncReadableFile::ReadAt(int64_t position, int64_t nbytes,
+                                 std::shared_ptr<Buffer>* out) {
+  return impl_->ReadAtAsync(position, nbytes).Get(out);
+}
+
+}  // namespace io
+}  // namespace arrow
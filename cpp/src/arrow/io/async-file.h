@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Local file reader issuing asynchronous reads
+
+#ifndef ARROW_IO_ASYNC_FILE_H
+#define ARROW_IO_ASYNC_FILE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/future.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class Status;
+
+namespace io {
+
+/// \brief Options for AsyncReadableFile
+struct ARROW_EXPORT AsyncReadOptions {
+  static AsyncReadOptions Defaults();
+
+  /// The maximum number of reads submitted to the kernel at once; further
+  /// reads are queued until earlier ones complete
+  int32_t queue_depth;
+  /// Open the file with O_DIRECT, bypassing the page cache.  Reads are then
+  /// widened to `direct_io_alignment` boundaries, and the returned buffers
+  /// are slices of the widened reads.  Not all file systems support it.
+  bool direct_io;
+  /// The alignment of offsets, lengths and memory for direct I/O
+  int64_t direct_io_alignment;
+  /// Use io_uring when available (Linux only).  When false, or when the
+  /// kernel doesn't support io_uring, reads run on the global I/O thread pool.
+  bool use_io_uring;
+};
+
+/// \brief A local file reader with asynchronous positional reads
+///
+/// On Linux, reads are submitted to an io_uring and completed by a single
+/// background thread, so that many reads can be in flight without one
+/// thread per read.  Elsewhere, each read is a blocking pread on the global
+/// I/O thread pool.
+///
+/// All methods are thread-safe.  The synchronous RandomAccessFile methods
+/// wait for the corresponding asynchronous read.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class ARROW_EXPORT AsyncReadableFile : public RandomAccessFile {
+ public:
+  ~AsyncReadableFile() override;
+
+  /// \brief Open a local file for asynchronous reading
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] options reading options
+  /// \param[in] pool a MemoryPool for the read buffers
+  /// \param[out] file AsyncReadableFile instance
+  static Status Open(const std::string& path, const AsyncReadOptions& options,
+                     MemoryPool* pool, std::shared_ptr<AsyncReadableFile>* file);
+
+  /// \brief Open a local file with the default options and memory pool
+  static Status Open(const std::string& path, std::shared_ptr<AsyncReadableFile>* file);
+
+  /// \brief Read nbytes at the given position, asynchronously
+  ///
+  /// As with ReadAt(), the resulting buffer is shorter than requested if
+  /// the end of the file is reached.
+  Future<std::shared_ptr<Buffer>> ReadAtAsync(int64_t position, int64_t nbytes);
+
+  /// \brief Whether reads go through io_uring rather than a thread pool
+  bool uses_io_uring() const;
+
+  /// \brief Close the file, after waiting for the pending reads
+  Status Close() override;
+  bool closed() const override;
+
+  Status Tell(int64_t* position) const override;
+  Status Seek(int64_t position) override;
+  Status GetSize(int64_t* size) override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+ private:
+  AsyncReadableFile();
+
+  class ARROW_NO_EXPORT Impl;
+  std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_ASYNC_FILE_H
@@ -21,19 +21,25 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdio>
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <random>
 #include <string>
+#include <thread>
 #include <utility>
 #include <valarray>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/io/buffered.h"
 #include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
@@ -227,6 +233,26 @@ TEST_F(TestBufferedOutputStream, LargeWrites) {
   AssertFileContents(path_, data);
 }
 
+TEST_F(TestBufferedOutputStream, WriteBuffers) {
+  OpenBuffered(20);
+
+  // The small buffers are copied, the large ones are handed over to the
+  // raw stream after the pending bytes
+  const std::string data = GenerateRandomData(100);
+  std::vector<std::shared_ptr<Buffer>> buffers = {Buffer::FromString(data.substr(0, 5)),
+                                                  Buffer::FromString(data.substr(5, 7))};
+  ASSERT_OK(buffered_->Write(buffers));
+  ASSERT_OK(buffered_->Write(data.data() + 12, 3));
+  ASSERT_OK(buffered_->Write({Buffer::FromString(data.substr(15, 5))}));
+  AssertTell(20);
+  ASSERT_OK(buffered_->Write({Buffer::FromString(data.substr(20, 30)), nullptr,
+                              Buffer::FromString(data.substr(50, 50))}));
+  AssertTell(100);
+  ASSERT_OK(buffered_->Close());
+
+  AssertFileContents(path_, data);
+}
+
 TEST_F(TestBufferedOutputStream, Flush) {
   OpenBuffered();
 
@@ -299,6 +325,153 @@ TEST_F(TestBufferedOutputStream, TruncatesFile) {
   AssertFileContents(path_, "");
 }
 
+// An output stream in memory whose writes can be held back or failed
+class GatedOutputStream : public OutputStream {
+ public:
+  GatedOutputStream() : open_(true), gate_open_(true), fail_(false), writes_started_(0) {}
+
+  Status Close() override {
+    std::lock_guard<std::mutex> guard(lock_);
+    open_ = false;
+    return Status::OK();
+  }
+
+  bool closed() const override {
+    std::lock_guard<std::mutex> guard(lock_);
+    return !open_;
+  }
+
+  Status Tell(int64_t* position) const override {
+    std::lock_guard<std::mutex> guard(lock_);
+    *position = static_cast<int64_t>(data_.size());
+    return Status::OK();
+  }
+
+  Status Write(const void* data, int64_t nbytes) override {
+    std::unique_lock<std::mutex> lock(lock_);
+    ++writes_started_;
+    cv_.notify_all();
+    cv_.wait(lock, [this]() { return gate_open_; });
+    if (fail_) {
+      return Status::IOError("Injected failure");
+    }
+    data_.append(reinterpret_cast<const char*>(data), static_cast<size_t>(nbytes));
+    return Status::OK();
+  }
+
+  void SetGateOpen(bool open) {
+    std::lock_guard<std::mutex> guard(lock_);
+    gate_open_ = open;
+    cv_.notify_all();
+  }
+
+  void set_fail(bool fail) { fail_ = fail; }
+
+  void WaitForWriteStarted() {
+    std::unique_lock<std::mutex> lock(lock_);
+    cv_.wait(lock, [this]() { return writes_started_ > 0; });
+  }
+
+  int64_t writes_started() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return writes_started_;
+  }
+
+  std::string data() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return data_;
+  }
+
+ private:
+  std::string data_;
+  bool open_;
+  bool gate_open_;
+  std::atomic<bool> fail_;
+  int64_t writes_started_;
+  mutable std::mutex lock_;
+  std::condition_variable cv_;
+};
+
+TEST(TestBufferedOutputStreamAsync, WritesInOrder) {
+  auto raw = std::make_shared<GatedOutputStream>();
+  std::shared_ptr<BufferedOutputStream> buffered;
+  ASSERT_OK(BufferedOutputStream::Create(100, 3, default_memory_pool(), raw, &buffered));
+
+  const std::string data = GenerateRandomData(20000);
+  const int64_t sizes[] = {1, 7, 33, 99, 150, 64};
+  int64_t written = 0;
+  for (int i = 0; written < static_cast<int64_t>(data.size()); ++i) {
+    const int64_t remaining = static_cast<int64_t>(data.size()) - written;
+    const int64_t size = std::min(sizes[i % 6], remaining);
+    ASSERT_OK(buffered->Write(data.data() + written, size));
+    written += size;
+    int64_t position;
+    ASSERT_OK(buffered->Tell(&position));
+    ASSERT_EQ(written, position);
+  }
+  ASSERT_OK(buffered->Flush());
+  ASSERT_EQ(data, raw->data());
+  ASSERT_OK(buffered->Write("tail", 4));
+  ASSERT_OK(buffered->Close());
+  ASSERT_TRUE(raw->closed());
+  ASSERT_EQ(data + "tail", raw->data());
+}
+
+TEST(TestBufferedOutputStreamAsync, Backpressure) {
+  auto raw = std::make_shared<GatedOutputStream>();
+  raw->SetGateOpen(false);
+  std::shared_ptr<BufferedOutputStream> buffered;
+  ASSERT_OK(BufferedOutputStream::Create(100, 2, default_memory_pool(), raw, &buffered));
+
+  const std::string data = GenerateRandomData(1000);
+  std::atomic<bool> done(false);
+  Status st;
+  std::thread producer([&]() {
+    for (size_t i = 0; i < data.size() && st.ok(); i += 50) {
+      st = buffered->Write(data.data() + i, 50);
+    }
+    done = true;
+  });
+
+  // The first buffer is stuck in the raw stream, the second one is queued
+  // and the third one blocks the producer
+  raw->WaitForWriteStarted();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_FALSE(done);
+  ASSERT_EQ(1, raw->writes_started());
+
+  raw->SetGateOpen(true);
+  producer.join();
+  ASSERT_OK(st);
+  ASSERT_OK(buffered->Close());
+  ASSERT_EQ(data, raw->data());
+}
+
+TEST(TestBufferedOutputStreamAsync, WriteError) {
+  auto raw = std::make_shared<GatedOutputStream>();
+  raw->set_fail(true);
+  std::shared_ptr<BufferedOutputStream> buffered;
+  ASSERT_OK(BufferedOutputStream::Create(100, 2, default_memory_pool(), raw, &buffered));
+
+  const std::string data(1000, 'x');
+  // The background failure is reported by a later call, at the latest by
+  // Close()
+  Status st;
+  for (size_t i = 0; i < data.size() && st.ok(); i += 10) {
+    st = buffered->Write(data.data() + i, 10);
+  }
+  if (st.ok()) {
+    st = buffered->Close();
+  } else {
+    ASSERT_RAISES(IOError, buffered->Close());
+  }
+  ASSERT_RAISES(IOError, st);
+  ASSERT_TRUE(raw->closed());
+
+  ASSERT_RAISES(Invalid, BufferedOutputStream::Create(100, -1, default_memory_pool(),
+                                                     raw, &buffered));
+}
+
 // ----------------------------------------------------------------------
 // BufferedInputStream tests
 
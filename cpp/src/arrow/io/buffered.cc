@@ -18,16 +18,20 @@
 #include "arrow/io/buffered.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 namespace io {
@@ -92,15 +96,24 @@ class BufferedBase {
 class BufferedOutputStream::Impl : public BufferedBase {
  public:
   explicit Impl(std::shared_ptr<OutputStream> raw, MemoryPool* pool)
-      : BufferedBase(pool), raw_(std::move(raw)) {}
+      : BufferedBase(pool),
+        raw_(std::move(raw)),
+        max_pending_buffers_(0),
+        writer_running_(false) {}
+
+  void set_max_pending_buffers(int32_t max_pending_buffers) {
+    max_pending_buffers_ = max_pending_buffers;
+  }
 
   Status Close() {
     std::lock_guard<std::mutex> guard(lock_);
     if (is_open_) {
       Status st = FlushUnlocked();
+      // Even after an error, no background write may outlive the stream
+      Status write_st = WaitForWrites();
       is_open_ = false;
       RETURN_NOT_OK(raw_->Close());
-      return st;
+      return st.ok() ? write_st : st;
     }
     return Status::OK();
   }
@@ -124,18 +137,54 @@ class BufferedOutputStream::Impl : public BufferedBase {
       return Status::OK();
     }
     if (nbytes + buffer_pos_ >= buffer_size_) {
-      RETURN_NOT_OK(FlushUnlocked());
+      RETURN_NOT_OK(max_pending_buffers_ > 0 ? SubmitBuffer() : FlushUnlocked());
       DCHECK_EQ(buffer_pos_, 0);
       if (nbytes >= buffer_size_) {
-        // Direct write
-        return raw_->Write(data, nbytes);
+        // Direct write, after the pending buffers since it can't be deferred
+        RETURN_NOT_OK(WaitForWrites());
+        RETURN_NOT_OK(raw_->Write(data, nbytes));
+        if (raw_pos_ != -1) {
+          raw_pos_ += nbytes;
+        }
+        return Status::OK();
       }
     }
     AppendToBuffer(data, nbytes);
     return Status::OK();
   }
 
+  Status Write(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+    std::lock_guard<std::mutex> guard(lock_);
+    int64_t nbytes = 0;
+    for (const auto& buffer : buffers) {
+      if (buffer) {
+        nbytes += buffer->size();
+      }
+    }
+    if (nbytes + buffer_pos_ < buffer_size_) {
+      for (const auto& buffer : buffers) {
+        if (buffer && buffer->size() > 0) {
+          AppendToBuffer(buffer->data(), buffer->size());
+        }
+      }
+      return Status::OK();
+    }
+    // Hand the buffers over to the raw stream rather than copying them,
+    // after the buffered and pending bytes
+    RETURN_NOT_OK(max_pending_buffers_ > 0 ? SubmitBuffer() : FlushUnlocked());
+    RETURN_NOT_OK(WaitForWrites());
+    RETURN_NOT_OK(raw_->Write(buffers));
+    if (raw_pos_ != -1) {
+      raw_pos_ += nbytes;
+    }
+    return Status::OK();
+  }
+
   Status FlushUnlocked() {
+    if (max_pending_buffers_ > 0) {
+      RETURN_NOT_OK(SubmitBuffer());
+      return WaitForWrites();
+    }
     if (buffer_pos_ > 0) {
       // Invalidate cached raw pos
       raw_pos_ = -1;
@@ -170,7 +219,86 @@ class BufferedOutputStream::Impl : public BufferedBase {
   std::shared_ptr<OutputStream> raw() const { return raw_; }
 
  private:
+  // Hand the buffer to the background writer, and continue in a fresh one
+  Status SubmitBuffer() {
+    if (buffer_pos_ == 0) {
+      return Status::OK();
+    }
+    // Track the raw position ourselves, the raw stream is busy
+    if (raw_pos_ == -1) {
+      RETURN_NOT_OK(WaitForWrites());
+      RETURN_NOT_OK(raw_->Tell(&raw_pos_));
+    }
+    RETURN_NOT_OK(buffer_->Resize(buffer_pos_, false /* shrink_to_fit */));
+
+    std::unique_lock<std::mutex> lock(async_lock_);
+    // Backpressure
+    async_cv_.wait(lock, [this]() {
+      return static_cast<int32_t>(pending_buffers_.size()) < max_pending_buffers_ ||
+             !async_status_.ok();
+    });
+    RETURN_NOT_OK(async_status_);
+    pending_buffers_.push_back(buffer_);
+    if (!writer_running_) {
+      Status st = internal::GetIOThreadPool()->Spawn([this]() { WriteBuffers(); });
+      if (!st.ok()) {
+        pending_buffers_.pop_back();
+        return st;
+      }
+      writer_running_ = true;
+    }
+    raw_pos_ += buffer_pos_;
+    buffer_.reset();
+    if (!free_buffers_.empty()) {
+      buffer_ = std::move(free_buffers_.back());
+      free_buffers_.pop_back();
+    }
+    lock.unlock();
+    return ResetBuffer();
+  }
+
+  // Background task writing the pending buffers in order
+  void WriteBuffers() {
+    std::unique_lock<std::mutex> lock(async_lock_);
+    while (!pending_buffers_.empty()) {
+      // The buffer stays pending while written, so that it counts against
+      // the limit
+      std::shared_ptr<ResizableBuffer> buffer = pending_buffers_.front();
+      const bool failed = !async_status_.ok();
+      lock.unlock();
+      // After a failure, the remaining buffers are dropped
+      Status st = failed ? Status::OK() : raw_->Write(buffer->data(), buffer->size());
+      lock.lock();
+      pending_buffers_.pop_front();
+      if (!st.ok()) {
+        async_status_ = st;
+      }
+      if (static_cast<int32_t>(free_buffers_.size()) < max_pending_buffers_) {
+        free_buffers_.push_back(std::move(buffer));
+      }
+      async_cv_.notify_all();
+    }
+    writer_running_ = false;
+    async_cv_.notify_all();
+  }
+
+  // Wait for the background writes, and return their status
+  Status WaitForWrites() {
+    std::unique_lock<std::mutex> lock(async_lock_);
+    async_cv_.wait(lock, [this]() { return !writer_running_; });
+    return async_status_;
+  }
+
   std::shared_ptr<OutputStream> raw_;
+
+  int32_t max_pending_buffers_;
+  // The background writes, guarded by async_lock_
+  std::deque<std::shared_ptr<ResizableBuffer>> pending_buffers_;
+  std::vector<std::shared_ptr<ResizableBuffer>> free_buffers_;
+  bool writer_running_;
+  Status async_status_;
+  std::mutex async_lock_;
+  std::condition_variable async_cv_;
 };
 
 BufferedOutputStream::BufferedOutputStream(std::shared_ptr<OutputStream> raw,
@@ -181,8 +309,19 @@ BufferedOutputStream::BufferedOutputStream(std::shared_ptr<OutputStream> raw,
 Status BufferedOutputStream::Create(int64_t buffer_size, MemoryPool* pool,
                                     std::shared_ptr<OutputStream> raw,
                                     std::shared_ptr<BufferedOutputStream>* out) {
+  return Create(buffer_size, 0, pool, std::move(raw), out);
+}
+
+Status BufferedOutputStream::Create(int64_t buffer_size, int32_t max_pending_buffers,
+                                    MemoryPool* pool, std::shared_ptr<OutputStream> raw,
+                                    std::shared_ptr<BufferedOutputStream>* out) {
+  if (max_pending_buffers < 0) {
+    return Status::Invalid("Number of pending buffers should be non-negative, got ",
+                           max_pending_buffers);
+  }
   auto result = std::shared_ptr<BufferedOutputStream>(
       new BufferedOutputStream(std::move(raw), pool));
+  result->impl_->set_max_pending_buffers(max_pending_buffers);
   RETURN_NOT_OK(result->SetBufferSize(buffer_size));
   *out = std::move(result);
   return Status::OK();
@@ -212,6 +351,11 @@ Status BufferedOutputStream::Write(const void* data, int64_t nbytes) {
   return impl_->Write(data, nbytes);
 }
 
+Status BufferedOutputStream::DoWrite(
+    const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  return impl_->Write(buffers);
+}
+
 Status BufferedOutputStream::Flush() { return impl_->Flush(); }
 
 std::shared_ptr<OutputStream> BufferedOutputStream::raw() const { return impl_->raw(); }
@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/util/string_view.h"
@@ -49,6 +50,26 @@ class ARROW_EXPORT BufferedOutputStream : public OutputStream {
                        std::shared_ptr<OutputStream> raw,
                        std::shared_ptr<BufferedOutputStream>* out);
 
+  /// \brief Create a buffered output stream flushing in the background
+  ///
+  /// When the buffer fills up, it is handed to a task on the I/O thread pool
+  /// which writes it to the raw stream, while writes go on into a fresh
+  /// buffer.  Writes block once max_pending_buffers buffers are waiting for,
+  /// or in the middle of, a raw write.  The raw writes happen in order.
+  /// Flush(), Detach() and Close() wait for the pending buffers.  A failed
+  /// background write is reported by the next call.
+  ///
+  /// \param[in] buffer_size the size of the temporary write buffers
+  /// \param[in] max_pending_buffers the maximum number of full buffers
+  /// outstanding; 0 flushes synchronously, as Create() above
+  /// \param[in] pool a MemoryPool to use for allocations
+  /// \param[in] raw another OutputStream
+  /// \param[out] out the created BufferedOutputStream
+  /// \return Status
+  static Status Create(int64_t buffer_size, int32_t max_pending_buffers,
+                       MemoryPool* pool, std::shared_ptr<OutputStream> raw,
+                       std::shared_ptr<BufferedOutputStream>* out);
+
   /// \brief Resize internal buffer
   /// \param[in] new_buffer_size the new buffer size
   /// \return Status
@@ -74,11 +95,18 @@ class ARROW_EXPORT BufferedOutputStream : public OutputStream {
   // Write bytes to the stream. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
 
+  using Writable::Write;
+
   Status Flush() override;
 
   /// \brief Return the underlying raw output stream.
   std::shared_ptr<OutputStream> raw() const;
 
+ protected:
+  // Copy the buffers into the buffer if they fit in it, otherwise hand them
+  // over to the raw stream. Thread-safe
+  Status DoWrite(const std::vector<std::shared_ptr<Buffer>>& buffers) override;
+
  private:
   explicit BufferedOutputStream(std::shared_ptr<OutputStream> raw, MemoryPool* pool);
 
@@ -0,0 +1,240 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/cached-file.h"
+#include "arrow/io/memory.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+
+namespace arrow {
+namespace io {
+
+// A file over a buffer, counting the reads and copying as a real file would
+class CountingFile : public BufferReader {
+ public:
+  explicit CountingFile(const std::shared_ptr<Buffer>& buffer)
+      : BufferReader(buffer), num_reads_(0) {}
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    ++num_reads_;
+    std::shared_ptr<Buffer> slice;
+    RETURN_NOT_OK(BufferReader::ReadAt(position, nbytes, &slice));
+    return slice->Copy(0, slice->size(), out);
+  }
+
+  using BufferReader::ReadAt;
+
+  bool supports_zero_copy() const override { return false; }
+
+  int64_t num_reads() const { return num_reads_; }
+
+ private:
+  std::atomic<int64_t> num_reads_;
+};
+
+constexpr int64_t kBlockSize = 100;
+constexpr int64_t kFileSize = 1050;
+
+class TestCachedRandomAccessFile : public ::testing::Test {
+ public:
+  void SetUp() override {
+    data_.resize(kFileSize);
+    random_bytes(kFileSize, 0, reinterpret_cast<uint8_t*>(&data_[0]));
+    ASSERT_OK(BlockCache::Make(1 << 20, kBlockSize, &cache_));
+    OpenFile("file", &file_, &raw_);
+  }
+
+  void OpenFile(const std::string& path, std::shared_ptr<CachedRandomAccessFile>* file,
+                std::shared_ptr<CountingFile>* raw) {
+    *raw = std::make_shared<CountingFile>(std::make_shared<Buffer>(data_));
+    ASSERT_OK(CachedRandomAccessFile::Make(*raw, path, cache_, file));
+  }
+
+  void AssertRead(int64_t position, int64_t nbytes, const Buffer& actual) {
+    ASSERT_EQ(data_.substr(position, nbytes), actual.ToString())
+        << "read of " << nbytes << " bytes at " << position;
+  }
+
+ protected:
+  std::string data_;
+  std::shared_ptr<BlockCache> cache_;
+  std::shared_ptr<CountingFile> raw_;
+  std::shared_ptr<CachedRandomAccessFile> file_;
+};
+
+TEST_F(TestCachedRandomAccessFile, HitsAreZeroCopy) {
+  std::shared_ptr<Buffer> first, second;
+  ASSERT_OK(file_->ReadAt(110, 50, &first));
+  AssertRead(110, 50, *first);
+  ASSERT_EQ(1, raw_->num_reads());
+  ASSERT_EQ(kBlockSize, cache_->bytes_cached());
+
+  ASSERT_OK(file_->ReadAt(120, 80, &second));
+  AssertRead(120, 80, *second);
+  ASSERT_EQ(1, raw_->num_reads());
+  ASSERT_EQ(first->data() + 10, second->data());
+  ASSERT_EQ(1, cache_->hits());
+  ASSERT_EQ(1, cache_->misses());
+}
+
+TEST_F(TestCachedRandomAccessFile, SpanningReads) {
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->ReadAt(50, 300, &buffer));
+  AssertRead(50, 300, *buffer);
+  // Consecutive missing blocks are read at once
+  ASSERT_EQ(1, raw_->num_reads());
+
+  // Only the missing blocks are read, up to the short last block
+  ASSERT_OK(file_->ReadAt(0, 2000, &buffer));
+  AssertRead(0, kFileSize, *buffer);
+  ASSERT_EQ(2, raw_->num_reads());
+  ASSERT_EQ(kFileSize, cache_->bytes_cached());
+
+  std::string out(500, '\0');
+  int64_t bytes_read;
+  ASSERT_OK(file_->ReadAt(kFileSize - 200, 500, &bytes_read, &out[0]));
+  ASSERT_EQ(200, bytes_read);
+  ASSERT_EQ(data_.substr(kFileSize - 200), out.substr(0, 200));
+  ASSERT_EQ(2, raw_->num_reads());
+
+  ASSERT_OK(file_->ReadAt(kFileSize + 10, 10, &buffer));
+  ASSERT_EQ(0, buffer->size());
+  ASSERT_RAISES(Invalid, file_->ReadAt(-1, 10, &buffer));
+  ASSERT_RAISES(Invalid, file_->ReadAt(0, -1, &buffer));
+}
+
+TEST_F(TestCachedRandomAccessFile, SharedAcrossFiles) {
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->ReadAt(0, 500, &buffer));
+  ASSERT_EQ(1, raw_->num_reads());
+
+  std::shared_ptr<CachedRandomAccessFile> same;
+  std::shared_ptr<CountingFile> same_raw;
+  OpenFile("file", &same, &same_raw);
+  ASSERT_OK(same->ReadAt(250, 100, &buffer));
+  AssertRead(250, 100, *buffer);
+  ASSERT_EQ(0, same_raw->num_reads());
+
+  std::shared_ptr<CachedRandomAccessFile> other;
+  std::shared_ptr<CountingFile> other_raw;
+  OpenFile("other", &other, &other_raw);
+  ASSERT_OK(other->ReadAt(250, 100, &buffer));
+  ASSERT_EQ(1, other_raw->num_reads());
+
+  cache_->Invalidate("file");
+  ASSERT_OK(same->ReadAt(250, 100, &buffer));
+  ASSERT_EQ(1, same_raw->num_reads());
+  // Blocks 2 and 3 of both paths
+  ASSERT_EQ(4 * kBlockSize, cache_->bytes_cached());
+}
+
+TEST_F(TestCachedRandomAccessFile, Eviction) {
+  ASSERT_OK(BlockCache::Make(250, kBlockSize, &cache_));
+  OpenFile("file", &file_, &raw_);
+
+  std::shared_ptr<Buffer> block0, buffer;
+  ASSERT_OK(file_->ReadAt(0, 10, &block0));
+  ASSERT_OK(file_->ReadAt(100, 10, &buffer));
+  // Block 0 becomes the most recently used, block 1 is evicted next
+  ASSERT_OK(file_->ReadAt(0, 10, &buffer));
+  ASSERT_OK(file_->ReadAt(200, 10, &buffer));
+  ASSERT_EQ(3, raw_->num_reads());
+  ASSERT_EQ(2 * kBlockSize, cache_->bytes_cached());
+
+  ASSERT_OK(file_->ReadAt(0, 10, &buffer));
+  ASSERT_EQ(3, raw_->num_reads());
+  ASSERT_OK(file_->ReadAt(100, 10, &buffer));
+  ASSERT_EQ(4, raw_->num_reads());
+
+  // Evicted blocks stay valid while in use
+  AssertRead(0, 10, *block0);
+
+  // Reads larger than the cache still work
+  ASSERT_OK(file_->ReadAt(0, kFileSize, &buffer));
+  AssertRead(0, kFileSize, *buffer);
+  ASSERT_LE(cache_->bytes_cached(), 250);
+}
+
+TEST_F(TestCachedRandomAccessFile, ReadRanges) {
+  std::shared_ptr<Buffer> buffer;
+  const std::vector<ReadRange> ranges = {
+      {150, 20}, {0, 10}, {290, 230}, {900, 500}, {600, 0}, {20, 5}};
+  for (bool use_threads : {false, true}) {
+    ASSERT_OK(BlockCache::Make(1 << 20, kBlockSize, &cache_));
+    OpenFile("file", &file_, &raw_);
+    ASSERT_OK(file_->ReadAt(300, 10, &buffer));
+
+    CoalesceOptions options = CoalesceOptions::Defaults();
+    options.use_threads = use_threads;
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    ASSERT_OK(file_->ReadRanges(ranges, options, &buffers));
+    ASSERT_EQ(ranges.size(), buffers.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      const int64_t length = std::min(ranges[i].length, kFileSize - ranges[i].offset);
+      AssertRead(ranges[i].offset, length, *buffers[i]);
+    }
+    // Missing blocks {0, 1, 2}, {4, 5} and {9, 10}, each run in one read
+    ASSERT_EQ(4, raw_->num_reads());
+  }
+}
+
+TEST_F(TestCachedRandomAccessFile, StreamReads) {
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->Seek(95));
+  ASSERT_OK(file_->Read(10, &buffer));
+  AssertRead(95, 10, *buffer);
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(105, position);
+
+  std::string out(2000, '\0');
+  int64_t bytes_read;
+  ASSERT_OK(file_->Read(2000, &bytes_read, &out[0]));
+  ASSERT_EQ(kFileSize - 105, bytes_read);
+  ASSERT_EQ(data_.substr(105), out.substr(0, bytes_read));
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(kFileSize, position);
+
+  int64_t size;
+  ASSERT_OK(file_->GetSize(&size));
+  ASSERT_EQ(kFileSize, size);
+
+  ASSERT_OK(file_->Close());
+  ASSERT_TRUE(file_->closed());
+  ASSERT_TRUE(raw_->closed());
+  ASSERT_RAISES(Invalid, file_->ReadAt(0, 10, &buffer));
+}
+
+TEST(TestBlockCache, InvalidOptions) {
+  std::shared_ptr<BlockCache> cache;
+  ASSERT_RAISES(Invalid, BlockCache::Make(-1, 100, &cache));
+  ASSERT_RAISES(Invalid, BlockCache::Make(100, 0, &cache));
+}
+
+}  // namespace io
+}  // namespace arrow
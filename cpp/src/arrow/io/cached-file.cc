@@ -0,0 +1,511 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/cached-file.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+
+using internal::TaskGroup;
+
+namespace io {
+
+// ----------------------------------------------------------------------
+// BlockCache implementation
+
+class BlockCache::Impl {
+ public:
+  Impl(int64_t capacity, int64_t block_size)
+      : capacity_(capacity), block_size_(block_size), bytes_cached_(0), hits_(0),
+        misses_(0) {}
+
+  bool Get(const std::string& path, int64_t index, std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = entries_.find(Key(path, index));
+    if (it == entries_.end()) {
+      ++misses_;
+      return false;
+    }
+    ++hits_;
+    // Move to the front of the LRU list
+    lru_.splice(lru_.begin(), lru_, it->second);
+    *out = it->second->block;
+    return true;
+  }
+
+  void Put(const std::string& path, int64_t index, const std::shared_ptr<Buffer>& block) {
+    if (block->size() > capacity_) {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    Key key(path, index);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      Erase(it->second);
+    }
+    lru_.push_front(Entry{key, block});
+    entries_[key] = lru_.begin();
+    bytes_cached_ += block->size();
+    while (bytes_cached_ > capacity_) {
+      Erase(std::prev(lru_.end()));
+    }
+  }
+
+  void Invalidate(const std::string& path) {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto it = lru_.begin(); it != lru_.end();) {
+      auto entry = it++;
+      if (entry->key.first == path) {
+        Erase(entry);
+      }
+    }
+  }
+
+  int64_t capacity() const { return capacity_; }
+  int64_t block_size() const { return block_size_; }
+
+  int64_t bytes_cached() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return bytes_cached_;
+  }
+
+  int64_t hits() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return hits_;
+  }
+
+  int64_t misses() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return misses_;
+  }
+
+ private:
+  using Key = std::pair<std::string, int64_t>;
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      return std::hash<std::string>()(key.first) ^
+             std::hash<int64_t>()(key.second) * 0x9e3779b97f4a7c15ULL;
+    }
+  };
+
+  struct Entry {
+    Key key;
+    std::shared_ptr<Buffer> block;
+  };
+
+  void Erase(std::list<Entry>::iterator entry) {
+    bytes_cached_ -= entry->block->size();
+    entries_.erase(entry->key);
+    lru_.erase(entry);
+  }
+
+  const int64_t capacity_;
+  const int64_t block_size_;
+
+  // Most recently used first
+  std::list<Entry> lru_;
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> entries_;
+  int64_t bytes_cached_;
+  int64_t hits_;
+  int64_t misses_;
+  mutable std::mutex lock_;
+};
+
+BlockCache::BlockCache(int64_t capacity, int64_t block_size)
+    : impl_(new Impl(capacity, block_size)) {}
+
+BlockCache::~BlockCache() {}
+
+Status BlockCache::Make(int64_t capacity, int64_t block_size,
+                        std::shared_ptr<BlockCache>* out) {
+  if (capacity < 0) {
+    return Status::Invalid("Cache capacity should be non-negative, got ", capacity);
+  }
+  if (block_size <= 0) {
+    return Status::Invalid("Block size should be positive, got ", block_size);
+  }
+  out->reset(new BlockCache(capacity, block_size));
+  return Status::OK();
+}
+
+bool BlockCache::Get(const std::string& path, int64_t index,
+                     std::shared_ptr<Buffer>* out) {
+  return impl_->Get(path, index, out);
+}
+
+void BlockCache::Put(const std::string& path, int64_t index,
+                     const std::shared_ptr<Buffer>& block) {
+  impl_->Put(path, index, block);
+}
+
+void BlockCache::Invalidate(const std::string& path) { impl_->Invalidate(path); }
+
+int64_t BlockCache::capacity() const { return impl_->capacity(); }
+
+int64_t BlockCache::block_size() const { return impl_->block_size(); }
+
+int64_t BlockCache::bytes_cached() const { return impl_->bytes_cached(); }
+
+int64_t BlockCache::hits() const { return impl_->hits(); }
+
+int64_t BlockCache::misses() const { return impl_->misses(); }
+
+// ----------------------------------------------------------------------
+// CachedRandomAccessFile implementation
+
+class CachedRandomAccessFile::Impl {
+ public:
+  Impl(const std::shared_ptr<RandomAccessFile>& raw, const std::string& path,
+       const std::shared_ptr<BlockCache>& cache, MemoryPool* pool, int64_t size)
+      : raw_(raw),
+        path_(path),
+        cache_(cache),
+        pool_(pool),
+        size_(size),
+        block_size_(cache->block_size()),
+        position_(0) {}
+
+  std::shared_ptr<RandomAccessFile> raw() const { return raw_; }
+
+  Status Close() { return raw_->Close(); }
+
+  bool closed() const { return raw_->closed(); }
+
+  Status CheckClosed() const {
+    if (raw_->closed()) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  Status Tell(int64_t* position) const {
+    RETURN_NOT_OK(CheckClosed());
+    std::lock_guard<std::mutex> guard(lock_);
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status Seek(int64_t position) {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0) {
+      return Status::Invalid("Invalid position ", position);
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    position_ = position;
+    return Status::OK();
+  }
+
+  Status GetSize(int64_t* size) {
+    RETURN_NOT_OK(CheckClosed());
+    *size = size_;
+    return Status::OK();
+  }
+
+  // Validate a read and clamp it to the end of the file
+  Status CheckRead(int64_t position, int64_t* nbytes) const {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0 || *nbytes < 0) {
+      return Status::Invalid("Invalid read (offset = ", position, ", size = ", *nbytes,
+                             ")");
+    }
+    *nbytes = std::min(*nbytes, std::max<int64_t>(0, size_ - position));
+    return Status::OK();
+  }
+
+  int64_t BlockLength(int64_t index) const {
+    return std::min(block_size_, size_ - index * block_size_);
+  }
+
+  // Get the given blocks (sorted, without duplicates) from the cache, reading
+  // and caching the missing ones.  The blocks are kept in `blocks` so that
+  // they can't be evicted before use.
+  Status FetchBlocks(const std::vector<int64_t>& indices, bool use_threads,
+                     std::vector<std::shared_ptr<Buffer>>* blocks) {
+    blocks->assign(indices.size(), nullptr);
+    // Runs of consecutive missing blocks, as [begin, end) in `indices`
+    std::vector<std::pair<size_t, size_t>> runs;
+    for (size_t i = 0; i < indices.size(); ++i) {
+      if (cache_->Get(path_, indices[i], &(*blocks)[i])) {
+        continue;
+      }
+      if (!runs.empty() && runs.back().second == i &&
+          indices[i - 1] + 1 == indices[i]) {
+        ++runs.back().second;
+      } else {
+        runs.emplace_back(i, i + 1);
+      }
+    }
+    if (runs.empty()) {
+      return Status::OK();
+    }
+
+    auto task_group = use_threads && runs.size() > 1
+                          ? TaskGroup::MakeThreaded(internal::GetIOThreadPool())
+                          : TaskGroup::MakeSerial();
+    for (const auto& run : runs) {
+      task_group->Append([this, run, &indices, blocks]() {
+        return ReadBlocks(indices[run.first], run.second - run.first,
+                          blocks->data() + run.first);
+      });
+    }
+    return task_group->Finish();
+  }
+
+  // Read consecutive blocks in a single read, and cache them
+  Status ReadBlocks(int64_t first, size_t count, std::shared_ptr<Buffer>* blocks) {
+    const int64_t offset = first * block_size_;
+    const int64_t nbytes =
+        std::min(static_cast<int64_t>(count) * block_size_, size_ - offset);
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(raw_->ReadAt(offset, nbytes, &buffer));
+    if (buffer->size() != nbytes) {
+      return Status::IOError("Cached file '", path_, "' changed while reading: expected ",
+                             nbytes, " bytes at offset ", offset, ", got ",
+                             buffer->size());
+    }
+    // Unless the read is zero-copy, copy the blocks out of it, so that each
+    // cached block only holds its own memory
+    const bool slice = count == 1 || raw_->supports_zero_copy();
+    for (size_t i = 0; i < count; ++i) {
+      const int64_t index = first + static_cast<int64_t>(i);
+      const int64_t block_offset = static_cast<int64_t>(i) * block_size_;
+      const int64_t length = BlockLength(index);
+      if (slice) {
+        blocks[i] = SliceBuffer(buffer, block_offset, length);
+      } else {
+        std::shared_ptr<Buffer> block;
+        RETURN_NOT_OK(AllocateBuffer(pool_, length, &block));
+        std::memcpy(block->mutable_data(), buffer->data() + block_offset,
+                    static_cast<size_t>(length));
+        blocks[i] = block;
+      }
+      cache_->Put(path_, index, blocks[i]);
+    }
+    return Status::OK();
+  }
+
+  std::vector<int64_t> BlockIndices(int64_t position, int64_t nbytes) const {
+    std::vector<int64_t> indices;
+    for (int64_t i = position / block_size_; i * block_size_ < position + nbytes; ++i) {
+      indices.push_back(i);
+    }
+    return indices;
+  }
+
+  // Copy a range out of the blocks covering it, starting at block `first`
+  void CopyRange(int64_t position, int64_t nbytes, int64_t first,
+                 const std::shared_ptr<Buffer>* blocks, uint8_t* out) const {
+    while (nbytes > 0) {
+      const int64_t index = position / block_size_;
+      const std::shared_ptr<Buffer>& block = blocks[index - first];
+      const int64_t block_offset = position - index * block_size_;
+      const int64_t length = std::min(nbytes, block->size() - block_offset);
+      std::memcpy(out, block->data() + block_offset, static_cast<size_t>(length));
+      out += length;
+      position += length;
+      nbytes -= length;
+    }
+  }
+
+  // Make the buffer of a range from the blocks covering it
+  Status AssembleRange(int64_t position, int64_t nbytes, int64_t first,
+                       const std::shared_ptr<Buffer>* blocks,
+                       std::shared_ptr<Buffer>* out) const {
+    if (nbytes == 0) {
+      return AllocateBuffer(pool_, 0, out);
+    }
+    const int64_t block_offset = position - first * block_size_;
+    if (block_offset + nbytes <= blocks[0]->size()) {
+      *out = SliceBuffer(blocks[0], block_offset, nbytes);
+      return Status::OK();
+    }
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(AllocateBuffer(pool_, nbytes, &buffer));
+    CopyRange(position, nbytes, first, blocks, buffer->mutable_data());
+    *out = buffer;
+    return Status::OK();
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, void* out) {
+    RETURN_NOT_OK(CheckRead(position, &nbytes));
+    if (nbytes > 0) {
+      const std::vector<int64_t> indices = BlockIndices(position, nbytes);
+      std::vector<std::shared_ptr<Buffer>> blocks;
+      RETURN_NOT_OK(FetchBlocks(indices, false, &blocks));
+      CopyRange(position, nbytes, indices[0], blocks.data(),
+                reinterpret_cast<uint8_t*>(out));
+    }
+    *bytes_read = nbytes;
+    return Status::OK();
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(CheckRead(position, &nbytes));
+    if (nbytes == 0) {
+      return AllocateBuffer(pool_, 0, out);
+    }
+    const std::vector<int64_t> indices = BlockIndices(position, nbytes);
+    std::vector<std::shared_ptr<Buffer>> blocks;
+    RETURN_NOT_OK(FetchBlocks(indices, false, &blocks));
+    return AssembleRange(position, nbytes, indices[0], blocks.data(), out);
+  }
+
+  Status ReadRanges(const std::vector<ReadRange>& ranges, bool use_threads,
+                    std::vector<std::shared_ptr<Buffer>>* out) {
+    std::vector<ReadRange> clamped = ranges;
+    std::vector<int64_t> indices;
+    for (auto& range : clamped) {
+      RETURN_NOT_OK(CheckRead(range.offset, &range.length));
+      const std::vector<int64_t> range_indices = BlockIndices(range.offset, range.length);
+      indices.insert(indices.end(), range_indices.begin(), range_indices.end());
+    }
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+    std::vector<std::shared_ptr<Buffer>> blocks;
+    RETURN_NOT_OK(FetchBlocks(indices, use_threads, &blocks));
+
+    out->resize(ranges.size());
+    for (size_t i = 0; i < clamped.size(); ++i) {
+      const ReadRange& range = clamped[i];
+      if (range.length == 0) {
+        RETURN_NOT_OK(AllocateBuffer(pool_, 0, &(*out)[i]));
+        continue;
+      }
+      const int64_t first = range.offset / block_size_;
+      const size_t pos =
+          std::lower_bound(indices.begin(), indices.end(), first) - indices.begin();
+      RETURN_NOT_OK(
+          AssembleRange(range.offset, range.length, first, &blocks[pos], &(*out)[i]));
+    }
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(read_lock_);
+    int64_t position;
+    RETURN_NOT_OK(Tell(&position));
+    RETURN_NOT_OK(ReadAt(position, nbytes, bytes_read, out));
+    return Seek(position + *bytes_read);
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(read_lock_);
+    int64_t position;
+    RETURN_NOT_OK(Tell(&position));
+    RETURN_NOT_OK(ReadAt(position, nbytes, out));
+    return Seek(position + (*out)->size());
+  }
+
+ private:
+  std::shared_ptr<RandomAccessFile> raw_;
+  const std::string path_;
+  std::shared_ptr<BlockCache> cache_;
+  MemoryPool* pool_;
+  const int64_t size_;
+  const int64_t block_size_;
+
+  int64_t position_;
+  mutable std::mutex lock_;
+  // Serializes the stream reads, which update the position
+  std::mutex read_lock_;
+};
+
+CachedRandomAccessFile::CachedRandomAccessFile() {}
+
+CachedRandomAccessFile::~CachedRandomAccessFile() {}
+
+Status CachedRandomAccessFile::Make(const std::shared_ptr<RandomAccessFile>& raw,
+                                    const std::string& path,
+                                    const std::shared_ptr<BlockCache>& cache,
+                                    MemoryPool* pool,
+                                    std::shared_ptr<CachedRandomAccessFile>* out) {
+  int64_t size;
+  RETURN_NOT_OK(raw->GetSize(&size));
+  std::shared_ptr<CachedRandomAccessFile> result(new CachedRandomAccessFile());
+  result->impl_.reset(new Impl(raw, path, cache, pool, size));
+  *out = std::move(result);
+  return Status::OK();
+}
+
+Status CachedRandomAccessFile::Make(const std::shared_ptr<RandomAccessFile>& raw,
+                                    const std::string& path,
+                                    const std::shared_ptr<BlockCache>& cache,
+                                    std::shared_ptr<CachedRandomAccessFile>* out) {
+  return Make(raw, path, cache, default_memory_pool(), out);
+}
+
+std::shared_ptr<RandomAccessFile> CachedRandomAccessFile::raw() const {
+  return impl_->raw();
+}
+
+Status CachedRandomAccessFile::Close() { return impl_->Close(); }
+
+bool CachedRandomAccessFile::closed() const { return impl_->closed(); }
+
+Status CachedRandomAccessFile::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status CachedRandomAccessFile::Seek(int64_t position) { return impl_->Seek(position); }
+
+Status CachedRandomAccessFile::GetSize(int64_t* size) { return impl_->GetSize(size); }
+
+Status CachedRandomAccessFile::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status CachedRandomAccessFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Status CachedRandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
+                                      int64_t* bytes_read, void* out) {
+  return impl_->ReadAt(position, nbytes, bytes_read, out);
+}
+
+Status CachedRandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
+                                      std::shared_ptr<Buffer>* out) {
+  return impl_->ReadAt(position, nbytes, out);
+}
+
+Status CachedRandomAccessFile::ReadRanges(const std::vector<ReadRange>& ranges,
+                                          const CoalesceOptions& options,
+                                          std::vector<std::shared_ptr<Buffer>>* out) {
+  return impl_->ReadRanges(ranges, options.use_threads, out);
+}
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,159 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Block-level read cache shared by files
+
+#ifndef ARROW_IO_CACHED_FILE_H
+#define ARROW_IO_CACHED_FILE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class Status;
+
+namespace io {
+
+/// \brief An LRU cache of fixed-size file blocks, keyed by path
+///
+/// A single cache may be shared by any number of CachedRandomAccessFile
+/// instances, which then share both the cached blocks of identical paths
+/// and the memory budget.  The least recently used blocks are evicted
+/// when the cached bytes exceed the capacity; blocks in use by readers
+/// stay alive until released.  This class is thread-safe.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class ARROW_EXPORT BlockCache {
+ public:
+  ~BlockCache();
+
+  /// \brief Create a cache
+  /// \param[in] capacity the maximum number of bytes cached
+  /// \param[in] block_size the size of the blocks files are cached by
+  /// \param[out] out the created cache
+  static Status Make(int64_t capacity, int64_t block_size,
+                     std::shared_ptr<BlockCache>* out);
+
+  /// \brief Look up a block, and mark it as most recently used
+  /// \return whether the block was found
+  bool Get(const std::string& path, int64_t index, std::shared_ptr<Buffer>* out);
+
+  /// \brief Insert or replace a block
+  ///
+  /// Blocks larger than the capacity are not cached.
+  void Put(const std::string& path, int64_t index, const std::shared_ptr<Buffer>& block);
+
+  /// \brief Drop the blocks of a path, e.g. after it was modified
+  void Invalidate(const std::string& path);
+
+  int64_t capacity() const;
+  int64_t block_size() const;
+  /// \brief The number of bytes currently cached
+  int64_t bytes_cached() const;
+
+  /// \brief The number of Get() calls which found their block
+  int64_t hits() const;
+  /// \brief The number of Get() calls which didn't find their block
+  int64_t misses() const;
+
+ private:
+  BlockCache(int64_t capacity, int64_t block_size);
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief A RandomAccessFile reading through a BlockCache
+///
+/// Reads are served from the cached blocks of the file, and the missing
+/// blocks are read from the underlying file then cached.  A read within a
+/// single block returns a zero-copy slice of the cached block; reads
+/// spanning several blocks are copied into a new buffer.
+///
+/// The path identifies the file contents in the cache: files opened with
+/// the same path and cache must have the same contents.  All methods are
+/// thread-safe if the underlying ReadAt() is.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class ARROW_EXPORT CachedRandomAccessFile : public RandomAccessFile {
+ public:
+  ~CachedRandomAccessFile() override;
+
+  /// \brief Create a cached file
+  /// \param[in] raw the underlying file
+  /// \param[in] path the identity of the file in the cache
+  /// \param[in] cache the cache to read through
+  /// \param[in] pool a MemoryPool for the reads spanning several blocks
+  /// \param[out] out the created file
+  static Status Make(const std::shared_ptr<RandomAccessFile>& raw,
+                     const std::string& path, const std::shared_ptr<BlockCache>& cache,
+                     MemoryPool* pool, std::shared_ptr<CachedRandomAccessFile>* out);
+
+  /// \brief Create a cached file with the default memory pool
+  static Status Make(const std::shared_ptr<RandomAccessFile>& raw,
+                     const std::string& path, const std::shared_ptr<BlockCache>& cache,
+                     std::shared_ptr<CachedRandomAccessFile>* out);
+
+  /// \brief Return the underlying file
+  std::shared_ptr<RandomAccessFile> raw() const;
+
+  /// \brief Close the underlying file; cached blocks are kept
+  Status Close() override;
+  bool closed() const override;
+
+  Status Tell(int64_t* position) const override;
+  Status Seek(int64_t position) override;
+  Status GetSize(int64_t* size) override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief Read several ranges of the file
+  ///
+  /// The missing blocks of all ranges are read at once, consecutive blocks
+  /// in a single read of the underlying file.  The reads are concurrent if
+  /// options.use_threads is true; the other options are ignored.
+  Status ReadRanges(const std::vector<ReadRange>& ranges, const CoalesceOptions& options,
+                    std::vector<std::shared_ptr<Buffer>>* out) override;
+
+  using RandomAccessFile::ReadRanges;
+
+ private:
+  CachedRandomAccessFile();
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_CACHED_FILE_H
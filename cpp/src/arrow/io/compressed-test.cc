@@ -29,6 +29,7 @@
 #include "arrow/status.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/compression_zlib.h"
 
 namespace arrow {
 namespace io {
@@ -207,6 +208,108 @@ INSTANTIATE_TEST_CASE_P(TestZSTDInputStream, CompressedInputStreamTest,
                         ::testing::Values(Compression::ZSTD));
 #endif
 
+// ----------------------------------------------------------------------
+// Framed data
+
+uint32_t Crc32(const uint8_t* data, int64_t length) {
+  uint32_t crc = 0xFFFFFFFF;
+  for (int64_t i = 0; i < length; ++i) {
+    crc ^= data[i];
+    for (int j = 0; j < 8; ++j) {
+      crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+    }
+  }
+  return ~crc;
+}
+
+void AppendLittleEndian(uint32_t value, int nbytes, std::vector<uint8_t>* out) {
+  for (int i = 0; i < nbytes; ++i) {
+    out->push_back(static_cast<uint8_t>(value >> (8 * i)));
+  }
+}
+
+// Append a BGZF block, i.e. a gzip member with its size in the "BC" extra field
+void AppendBgzfBlock(const uint8_t* data, int64_t length, std::vector<uint8_t>* out) {
+  ::arrow::util::GZipCodec deflate(::arrow::util::GZipCodec::DEFLATE);
+  std::vector<uint8_t> deflated(deflate.MaxCompressedLen(length, data));
+  int64_t deflated_len;
+  ABORT_NOT_OK(deflate.Compress(length, data, deflated.size(), deflated.data(),
+                                &deflated_len));
+
+  const uint8_t header[] = {31, 139, 8, 4, 0, 0, 0, 0, 0, 255, 6, 0, 'B', 'C', 2, 0};
+  out->insert(out->end(), header, header + sizeof(header));
+  const int64_t block_size = sizeof(header) + 2 + deflated_len + 8;
+  AppendLittleEndian(static_cast<uint32_t>(block_size - 1), 2, out);
+  out->insert(out->end(), deflated.data(), deflated.data() + deflated_len);
+  AppendLittleEndian(Crc32(data, length), 4, out);
+  AppendLittleEndian(static_cast<uint32_t>(length), 4, out);
+}
+
+std::shared_ptr<Buffer> MakeBgzfData(const std::vector<uint8_t>& data) {
+  const int64_t kBlockSize = 60000;
+  std::vector<uint8_t> compressed;
+  for (int64_t pos = 0; pos < static_cast<int64_t>(data.size()); pos += kBlockSize) {
+    const int64_t length = std::min<int64_t>(kBlockSize, data.size() - pos);
+    AppendBgzfBlock(data.data() + pos, length, &compressed);
+  }
+  // End-of-file marker
+  AppendBgzfBlock(nullptr, 0, &compressed);
+  return Buffer::FromString(std::string(compressed.begin(), compressed.end()));
+}
+
+std::shared_ptr<Buffer> Concatenate(const std::shared_ptr<Buffer>& left,
+                                    const std::shared_ptr<Buffer>& right) {
+  return Buffer::FromString(left->ToString() + right->ToString());
+}
+
+TEST(TestFramedInputStream, Bgzf) {
+  auto codec = std::unique_ptr<Codec>(new ::arrow::util::GZipCodec);
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  auto random_data = MakeRandomData(RANDOM_DATA_SIZE);
+  data.insert(data.end(), random_data.begin(), random_data.end());
+  auto compressed = MakeBgzfData(data);
+
+  int64_t frame_len;
+  ASSERT_OK(codec->FindFrameLength(compressed->size(), compressed->data(), &frame_len));
+  ASSERT_GT(frame_len, 0);
+  ASSERT_LT(frame_len, 65536);
+  ASSERT_OK(codec->FindFrameLength(frame_len - 1, compressed->data(), &frame_len));
+  ASSERT_EQ(0, frame_len);
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunCompressedInputStream(codec.get(), compressed, &decompressed));
+  ASSERT_EQ(decompressed, data);
+
+  // A regular gzip member following BGZF blocks
+  auto tail = MakeCompressibleData(10000);
+  auto mixed = Concatenate(compressed, CompressDataOneShot(codec.get(), tail));
+  ASSERT_OK(RunCompressedInputStream(codec.get(), mixed, &decompressed));
+  data.insert(data.end(), tail.begin(), tail.end());
+  ASSERT_EQ(decompressed, data);
+
+  auto truncated = SliceBuffer(compressed, 0, compressed->size() - 3);
+  ASSERT_RAISES(IOError, RunCompressedInputStream(codec.get(), truncated, &decompressed));
+}
+
+TEST(TestFramedInputStream, ConcatenatedGZip) {
+  auto codec = std::unique_ptr<Codec>(new ::arrow::util::GZipCodec);
+  // Regular gzip members don't announce their size
+  auto single = CompressDataOneShot(codec.get(), MakeRandomData(100));
+  int64_t frame_len;
+  ASSERT_RAISES(NotImplemented,
+                codec->FindFrameLength(single->size(), single->data(), &frame_len));
+
+  auto first = MakeCompressibleData(100000);
+  auto second = MakeRandomData(100000);
+  auto compressed = Concatenate(CompressDataOneShot(codec.get(), first),
+                                CompressDataOneShot(codec.get(), second));
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunCompressedInputStream(codec.get(), compressed, &decompressed));
+  first.insert(first.end(), second.begin(), second.end());
+  ASSERT_EQ(decompressed, first);
+}
+
 class CompressedOutputStreamTest : public ::testing::TestWithParam<Compression::type> {
  protected:
   Compression::type GetCompression() { return GetParam(); }
@@ -234,6 +337,57 @@ TEST_P(CompressedOutputStreamTest, RandomData) {
   CheckCompressedOutputStream(codec.get(), data, true /* do_flush */);
 }
 
+TEST_P(CompressedOutputStreamTest, Threaded) {
+  auto codec = MakeCodec();
+  auto options = CompressedOutputOptions::Defaults();
+  options.use_threads = true;
+  options.block_size = 100000;
+
+  std::shared_ptr<BufferOutputStream> buffer_writer;
+  ASSERT_OK(BufferOutputStream::Create(1024, default_memory_pool(), &buffer_writer));
+  std::shared_ptr<CompressedOutputStream> stream;
+  Status st = CompressedOutputStream::Make(default_memory_pool(), codec.get(),
+                                           buffer_writer, options, &stream);
+  if (!codec->SupportsConcatenation()) {
+    ASSERT_RAISES(NotImplemented, st);
+    return;
+  }
+  ASSERT_OK(st);
+
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  auto random_data = MakeRandomData(RANDOM_DATA_SIZE);
+  data.insert(data.end(), random_data.begin(), random_data.end());
+  const int64_t chunk_size = 77777;
+  for (int64_t pos = 0; pos < static_cast<int64_t>(data.size()); pos += chunk_size) {
+    ASSERT_OK(stream->Write(data.data() + pos,
+                            std::min<int64_t>(chunk_size, data.size() - pos)));
+    if (pos == chunk_size * 3) {
+      ASSERT_OK(stream->Flush());
+    }
+  }
+  ASSERT_OK(stream->Close());
+
+  std::shared_ptr<Buffer> compressed;
+  ASSERT_OK(buffer_writer->Finish(&compressed));
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunCompressedInputStream(codec.get(), compressed, &decompressed));
+  ASSERT_EQ(decompressed, data);
+
+  // Empty data
+  ASSERT_OK(BufferOutputStream::Create(1024, default_memory_pool(), &buffer_writer));
+  ASSERT_OK(CompressedOutputStream::Make(default_memory_pool(), codec.get(),
+                                         buffer_writer, options, &stream));
+  ASSERT_OK(stream->Close());
+  ASSERT_OK(buffer_writer->Finish(&compressed));
+  ASSERT_GT(compressed->size(), 0);
+  ASSERT_OK(RunCompressedInputStream(codec.get(), compressed, &decompressed));
+  ASSERT_EQ(0, decompressed.size());
+
+  options.block_size = 0;
+  ASSERT_RAISES(Invalid, CompressedOutputStream::Make(default_memory_pool(), codec.get(),
+                                                      buffer_writer, options, &stream));
+}
+
 INSTANTIATE_TEST_CASE_P(TestGZipOutputStream, CompressedOutputStreamTest,
                         ::testing::Values(Compression::GZIP));
 
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -28,7 +29,9 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 
@@ -38,17 +41,105 @@ using util::Decompressor;
 
 namespace io {
 
+namespace {
+
+// Wait for the result of a CPU thread pool task
+template <typename T>
+void WaitForTask(const Future<T>& future) {
+  auto pool = internal::GetCpuThreadPool();
+  if (pool->OwnsThisThread()) {
+    // Called from a CPU task: the awaited task may be queued behind us, so
+    // run pending tasks rather than block the worker.
+    while (!future.is_finished()) {
+      if (!pool->RunPendingTask()) {
+        future.Wait(0.001);
+      }
+    }
+  } else {
+    future.Wait();
+  }
+}
+
+// The number of blocks or frames being (de)compressed concurrently
+int MaxPendingTasks() { return std::max(2, internal::GetCpuThreadPool()->GetCapacity()); }
+
+}  // namespace
+
 // ----------------------------------------------------------------------
 // CompressedOutputStream implementation
 
+CompressedOutputOptions CompressedOutputOptions::Defaults() {
+  CompressedOutputOptions options;
+  options.use_threads = false;
+  options.block_size = 4 * 1024 * 1024;
+  return options;
+}
+
+namespace {
+
+// Compress a block into a complete compressed stream
+Status CompressBlock(MemoryPool* pool, Compressor* compressor, int64_t output_size,
+                     const Buffer& block, std::shared_ptr<ResizableBuffer>* out) {
+  std::shared_ptr<ResizableBuffer> output;
+  RETURN_NOT_OK(AllocateResizableBuffer(pool, output_size, &output));
+
+  int64_t input_pos = 0;
+  int64_t output_pos = 0;
+  while (input_pos < block.size()) {
+    int64_t bytes_read, bytes_written;
+    RETURN_NOT_OK(compressor->Compress(
+        block.size() - input_pos, block.data() + input_pos, output->size() - output_pos,
+        output->mutable_data() + output_pos, &bytes_read, &bytes_written));
+    input_pos += bytes_read;
+    output_pos += bytes_written;
+    if (bytes_read == 0) {
+      // Need to enlarge output buffer
+      RETURN_NOT_OK(output->Resize(output->size() * 2));
+    }
+  }
+  while (true) {
+    int64_t bytes_written;
+    bool should_retry;
+    RETURN_NOT_OK(compressor->End(output->size() - output_pos,
+                                  output->mutable_data() + output_pos, &bytes_written,
+                                  &should_retry));
+    output_pos += bytes_written;
+    if (!should_retry) {
+      break;
+    }
+    // Need to enlarge output buffer
+    RETURN_NOT_OK(output->Resize(output->size() * 2));
+  }
+  RETURN_NOT_OK(output->Resize(output_pos));
+  *out = output;
+  return Status::OK();
+}
+
+}  // namespace
+
+// In threaded mode, the data is cut into blocks that are compressed as
+// separate streams, several blocks at a time on the CPU thread pool, and
+// written out in order.
 class CompressedOutputStream::Impl {
  public:
-  Impl(MemoryPool* pool, Codec* codec, const std::shared_ptr<OutputStream>& raw)
-      : pool_(pool), raw_(raw), codec_(codec), is_open_(true), compressed_pos_(0) {}
+  Impl(MemoryPool* pool, Codec* codec, const std::shared_ptr<OutputStream>& raw,
+       const CompressedOutputOptions& options)
+      : pool_(pool),
+        raw_(raw),
+        codec_(codec),
+        options_(options),
+        is_open_(true),
+        compressed_pos_(0),
+        block_pos_(0),
+        num_blocks_(0),
+        max_pending_blocks_(MaxPendingTasks()) {}
 
   ~Impl() { DCHECK(Close().ok()); }
 
   Status Init() {
+    if (options_.use_threads) {
+      return AllocateResizableBuffer(pool_, options_.block_size, &block_);
+    }
     RETURN_NOT_OK(codec_->MakeCompressor(&compressor_));
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, kChunkSize, &compressed_));
     compressed_pos_ = 0;
@@ -69,10 +160,65 @@ class CompressedOutputStream::Impl {
     return Status::OK();
   }
 
+  // Submit the current block for compression
+  Status SubmitBlock() {
+    std::shared_ptr<Compressor> compressor;
+    RETURN_NOT_OK(codec_->MakeCompressor(&compressor));
+    auto block = SliceBuffer(block_, 0, block_pos_);
+    // Leave room for the stream header and trailer
+    const int64_t output_size =
+        codec_->MaxCompressedLen(block_pos_, block_->data()) + kStreamOverhead;
+    MemoryPool* pool = pool_;
+    auto task = [pool, compressor, output_size,
+                 block](std::shared_ptr<ResizableBuffer>* out) {
+      return CompressBlock(pool, compressor.get(), output_size, *block, out);
+    };
+    pending_blocks_.push_back(
+        internal::GetCpuThreadPool()->SubmitAsync<std::shared_ptr<ResizableBuffer>>(
+            std::move(task)));
+    ++num_blocks_;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, options_.block_size, &block_));
+    block_pos_ = 0;
+    while (static_cast<int>(pending_blocks_.size()) > max_pending_blocks_) {
+      RETURN_NOT_OK(WriteNextBlock());
+    }
+    return Status::OK();
+  }
+
+  // Wait for the oldest pending block and write it out
+  Status WriteNextBlock() {
+    auto future = pending_blocks_.front();
+    pending_blocks_.pop_front();
+    WaitForTask(future);
+    std::shared_ptr<ResizableBuffer> compressed;
+    RETURN_NOT_OK(future.Get(&compressed));
+    return raw_->Write(compressed->data(), compressed->size());
+  }
+
+  Status WriteBlocks() {
+    while (!pending_blocks_.empty()) {
+      RETURN_NOT_OK(WriteNextBlock());
+    }
+    return Status::OK();
+  }
+
   Status Write(const void* data, int64_t nbytes) {
     std::lock_guard<std::mutex> guard(lock_);
 
     auto input = reinterpret_cast<const uint8_t*>(data);
+    if (options_.use_threads) {
+      while (nbytes > 0) {
+        const int64_t chunk = std::min(nbytes, options_.block_size - block_pos_);
+        memcpy(block_->mutable_data() + block_pos_, input, chunk);
+        block_pos_ += chunk;
+        input += chunk;
+        nbytes -= chunk;
+        if (block_pos_ == options_.block_size) {
+          RETURN_NOT_OK(SubmitBlock());
+        }
+      }
+      return Status::OK();
+    }
     while (nbytes > 0) {
       int64_t bytes_read, bytes_written;
       int64_t input_len = nbytes;
@@ -110,6 +256,13 @@ class CompressedOutputStream::Impl {
   Status Flush() {
     std::lock_guard<std::mutex> guard(lock_);
 
+    if (options_.use_threads) {
+      // The buffered data becomes a shorter block
+      if (block_pos_ > 0) {
+        RETURN_NOT_OK(SubmitBlock());
+      }
+      return WriteBlocks();
+    }
     while (true) {
       // Flush compressor
       int64_t bytes_written;
@@ -134,6 +287,13 @@ class CompressedOutputStream::Impl {
   }
 
   Status FinalizeCompression() {
+    if (options_.use_threads) {
+      // Even empty data must yield a valid compressed stream
+      if (block_pos_ > 0 || num_blocks_ == 0) {
+        RETURN_NOT_OK(SubmitBlock());
+      }
+      return WriteBlocks();
+    }
     while (true) {
       // Try to end compressor
       int64_t bytes_written;
@@ -177,15 +337,25 @@ class CompressedOutputStream::Impl {
  private:
   // Write 64 KB compressed data at a time
   static const int64_t kChunkSize = 64 * 1024;
+  // An upper bound for the size of stream headers and trailers
+  static const int64_t kStreamOverhead = 64;
 
   MemoryPool* pool_;
   std::shared_ptr<OutputStream> raw_;
   Codec* codec_;
+  const CompressedOutputOptions options_;
   bool is_open_;
   std::shared_ptr<Compressor> compressor_;
   std::shared_ptr<ResizableBuffer> compressed_;
   int64_t compressed_pos_;
 
+  // Threaded mode
+  std::shared_ptr<ResizableBuffer> block_;
+  int64_t block_pos_;
+  int64_t num_blocks_;
+  int max_pending_blocks_;
+  std::deque<Future<std::shared_ptr<ResizableBuffer>>> pending_blocks_;
+
   mutable std::mutex lock_;
 };
 
@@ -198,8 +368,24 @@ Status CompressedOutputStream::Make(util::Codec* codec,
 Status CompressedOutputStream::Make(MemoryPool* pool, util::Codec* codec,
                                     const std::shared_ptr<OutputStream>& raw,
                                     std::shared_ptr<CompressedOutputStream>* out) {
+  return Make(pool, codec, raw, CompressedOutputOptions::Defaults(), out);
+}
+
+Status CompressedOutputStream::Make(MemoryPool* pool, util::Codec* codec,
+                                    const std::shared_ptr<OutputStream>& raw,
+                                    const CompressedOutputOptions& options,
+                                    std::shared_ptr<CompressedOutputStream>* out) {
+  if (options.use_threads) {
+    if (options.block_size <= 0) {
+      return Status::Invalid("Compression block size must be positive");
+    }
+    if (!codec->SupportsConcatenation()) {
+      return Status::NotImplemented("Threaded compression with the ", codec->name(),
+                                    " codec");
+    }
+  }
   std::shared_ptr<CompressedOutputStream> res(new CompressedOutputStream);
-  res->impl_ = std::unique_ptr<Impl>(new Impl(pool, codec, std::move(raw)));
+  res->impl_ = std::unique_ptr<Impl>(new Impl(pool, codec, std::move(raw), options));
   RETURN_NOT_OK(res->impl_->Init());
   *out = res;
   return Status::OK();
@@ -226,10 +412,64 @@ std::shared_ptr<OutputStream> CompressedOutputStream::raw() const { return impl_
 // ----------------------------------------------------------------------
 // CompressedInputStream implementation
 
+namespace {
+
+// Give up on parallel decompression if a frame is larger than this
+constexpr int64_t kMaxFrameSize = 32 * 1024 * 1024;
+// The minimum initial output size for a frame
+constexpr int64_t kMinFrameOutputSize = 64 * 1024;
+
+// Decompress a whole independent frame
+Status DecompressFrame(MemoryPool* pool, Decompressor* decompressor, const Buffer& frame,
+                       std::shared_ptr<ResizableBuffer>* out) {
+  std::shared_ptr<ResizableBuffer> output;
+  RETURN_NOT_OK(AllocateResizableBuffer(
+      pool, std::max(kMinFrameOutputSize, frame.size() * 4), &output));
+
+  int64_t input_pos = 0;
+  int64_t output_pos = 0;
+  while (!decompressor->IsFinished()) {
+    bool need_more_output;
+    int64_t bytes_read, bytes_written;
+    RETURN_NOT_OK(decompressor->Decompress(
+        frame.size() - input_pos, frame.data() + input_pos, output->size() - output_pos,
+        output->mutable_data() + output_pos, &bytes_read, &bytes_written,
+        &need_more_output));
+    input_pos += bytes_read;
+    output_pos += bytes_written;
+    if (decompressor->IsFinished()) {
+      break;
+    }
+    if (need_more_output || output_pos == output->size()) {
+      // Need to enlarge output buffer
+      RETURN_NOT_OK(output->Resize(output->size() * 2));
+    } else if (bytes_read == 0 && bytes_written == 0) {
+      return Status::IOError("Truncated compressed frame");
+    }
+  }
+  RETURN_NOT_OK(output->Resize(output_pos));
+  *out = output;
+  return Status::OK();
+}
+
+}  // namespace
+
+// Codecs whose data is made of independent frames (such as BGZF, ZSTD or
+// LZ4 frames) are decompressed frame by frame, several frames at a time
+// on the CPU thread pool.  Other data is decompressed incrementally on
+// the calling thread.
 class CompressedInputStream::Impl {
  public:
   Impl(MemoryPool* pool, Codec* codec, const std::shared_ptr<InputStream>& raw)
-      : pool_(pool), raw_(raw), codec_(codec), is_open_(true) {}
+      : pool_(pool),
+        raw_(raw),
+        codec_(codec),
+        is_open_(true),
+        compressed_pos_(0),
+        decompressed_pos_(0),
+        mode_(Mode::UNKNOWN),
+        raw_eof_(false),
+        max_pending_frames_(MaxPendingTasks()) {}
 
   Status Init() {
     RETURN_NOT_OK(codec_->MakeDecompressor(&decompressor_));
@@ -242,6 +482,8 @@ class CompressedInputStream::Impl {
     std::lock_guard<std::mutex> guard(lock_);
     if (is_open_) {
       is_open_ = false;
+      // Pending frame tasks only hold references to their own data
+      pending_frames_.clear();
       return raw_->Close();
     } else {
       return Status::OK();
@@ -297,12 +539,132 @@ class CompressedInputStream::Impl {
     return Status::OK();
   }
 
+  // Look at the start of the data to choose how to decompress it
+  Status DetectMode() {
+    RETURN_NOT_OK(EnsureCompressedData());
+    mode_ = Mode::SEQUENTIAL;
+    const int64_t avail = compressed_->size() - compressed_pos_;
+    if (avail == 0) {
+      return Status::OK();
+    }
+    int64_t frame_len;
+    Status st =
+        codec_->FindFrameLength(avail, compressed_->data() + compressed_pos_, &frame_len);
+    if (st.IsNotImplemented()) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(st);
+    mode_ = Mode::FRAMES;
+    return Status::OK();
+  }
+
+  // Read more compressed data, keeping the yet unconsumed data before it
+  Status ReadMoreCompressedData() {
+    const int64_t avail = compressed_->size() - compressed_pos_;
+    std::shared_ptr<Buffer> chunk;
+    // Read at least as much as we have, to avoid quadratic copying
+    RETURN_NOT_OK(raw_->Read(avail > kChunkSize ? avail : kChunkSize, &chunk));
+    if (chunk->size() == 0) {
+      raw_eof_ = true;
+    } else if (avail == 0) {
+      compressed_ = chunk;
+      compressed_pos_ = 0;
+    } else {
+      std::shared_ptr<Buffer> combined;
+      RETURN_NOT_OK(AllocateBuffer(pool_, avail + chunk->size(), &combined));
+      memcpy(combined->mutable_data(), compressed_->data() + compressed_pos_, avail);
+      memcpy(combined->mutable_data() + avail, chunk->data(), chunk->size());
+      compressed_ = combined;
+      compressed_pos_ = 0;
+    }
+    return Status::OK();
+  }
+
+  // Split complete frames off the compressed data and submit them for
+  // decompression, until enough frames are pending
+  Status SubmitFrames() {
+    while (static_cast<int>(pending_frames_.size()) < max_pending_frames_) {
+      const int64_t avail = compressed_->size() - compressed_pos_;
+      int64_t frame_len = 0;
+      if (avail > 0) {
+        Status st = codec_->FindFrameLength(avail, compressed_->data() + compressed_pos_,
+                                            &frame_len);
+        if (st.IsNotImplemented() || (frame_len == 0 && avail >= kMaxFrameSize)) {
+          // Data that isn't framed (e.g. a regular gzip member following
+          // BGZF blocks), or frames too large to buffer: after the pending
+          // frames, decompress the rest incrementally
+          if (pending_frames_.empty()) {
+            mode_ = Mode::SEQUENTIAL;
+          }
+          return Status::OK();
+        }
+        RETURN_NOT_OK(st);
+      }
+      if (frame_len > 0) {
+        std::shared_ptr<Decompressor> decompressor;
+        RETURN_NOT_OK(codec_->MakeDecompressor(&decompressor));
+        auto frame = SliceBuffer(compressed_, compressed_pos_, frame_len);
+        compressed_pos_ += frame_len;
+        MemoryPool* pool = pool_;
+        pending_frames_.push_back(
+            internal::GetCpuThreadPool()->SubmitAsync<std::shared_ptr<ResizableBuffer>>(
+                [pool, decompressor, frame](std::shared_ptr<ResizableBuffer>* out) {
+                  return DecompressFrame(pool, decompressor.get(), *frame, out);
+                }));
+        continue;
+      }
+      // Incomplete frame
+      if (raw_eof_) {
+        if (avail > 0 && pending_frames_.empty()) {
+          return Status::IOError("Truncated compressed stream");
+        }
+        return Status::OK();
+      }
+      RETURN_NOT_OK(ReadMoreCompressedData());
+    }
+    return Status::OK();
+  }
+
+  // Make the next decompressed frame available, in stream order
+  Status NextFrame(bool* eof) {
+    *eof = false;
+    RETURN_NOT_OK(SubmitFrames());
+    if (mode_ != Mode::FRAMES) {
+      return Status::OK();
+    }
+    if (pending_frames_.empty()) {
+      *eof = true;
+      return Status::OK();
+    }
+    auto frame = pending_frames_.front();
+    pending_frames_.pop_front();
+    WaitForTask(frame);
+    RETURN_NOT_OK(frame.Get(&decompressed_));
+    decompressed_pos_ = 0;
+    return Status::OK();
+  }
+
+  // The current compressed stream is finished, see whether another one
+  // follows (e.g. concatenated gzip members)
+  Status NextStream(bool* has_next) {
+    RETURN_NOT_OK(EnsureCompressedData());
+    *has_next = compressed_pos_ < compressed_->size();
+    if (*has_next) {
+      RETURN_NOT_OK(codec_->MakeDecompressor(&decompressor_));
+    }
+    return Status::OK();
+  }
+
   Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
     std::lock_guard<std::mutex> guard(lock_);
 
     *bytes_read = 0;
     auto out_data = reinterpret_cast<uint8_t*>(out);
 
+    if (mode_ == Mode::UNKNOWN && nbytes > 0) {
+      RETURN_NOT_OK(DetectMode());
+    }
+
     while (nbytes > 0) {
       int64_t avail = decompressed_ ? (decompressed_->size() - decompressed_pos_) : 0;
       if (avail > 0) {
@@ -325,14 +687,27 @@ class CompressedInputStream::Impl {
 
       // At this point, no more decompressed data remains,
       // so we need to decompress more
+      if (mode_ == Mode::FRAMES) {
+        bool eof;
+        RETURN_NOT_OK(NextFrame(&eof));
+        if (eof) {
+          break;
+        }
+        continue;
+      }
       if (decompressor_->IsFinished()) {
-        break;
+        bool has_next;
+        RETURN_NOT_OK(NextStream(&has_next));
+        if (!has_next) {
+          break;
+        }
       }
       // First try to read data from the decompressor
       if (compressed_) {
         RETURN_NOT_OK(DecompressData());
       }
-      if (!decompressed_ || decompressed_->size() == 0) {
+      if ((!decompressed_ || decompressed_->size() == 0) &&
+          !decompressor_->IsFinished()) {
         // Got nothing, need to read more compressed data
         RETURN_NOT_OK(EnsureCompressedData());
         if (compressed_pos_ == compressed_->size()) {
@@ -373,6 +748,12 @@ class CompressedInputStream::Impl {
   std::shared_ptr<ResizableBuffer> decompressed_;
   int64_t decompressed_pos_;
 
+  enum class Mode { UNKNOWN, SEQUENTIAL, FRAMES };
+  Mode mode_;
+  bool raw_eof_;
+  int max_pending_frames_;
+  std::deque<Future<std::shared_ptr<ResizableBuffer>>> pending_frames_;
+
   mutable std::mutex lock_;
 };
 
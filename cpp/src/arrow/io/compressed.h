@@ -20,6 +20,7 @@
 #ifndef ARROW_IO_COMPRESSED_H
 #define ARROW_IO_COMPRESSED_H
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -39,6 +40,19 @@ class Codec;
 
 namespace io {
 
+/// \brief Options for CompressedOutputStream
+struct ARROW_EXPORT CompressedOutputOptions {
+  static CompressedOutputOptions Defaults();
+
+  /// Cut the data into blocks of `block_size` bytes, and compress several
+  /// blocks concurrently on the CPU thread pool.  Each block becomes an
+  /// independent compressed stream (e.g. a gzip member or a zstd frame),
+  /// so the codec must support concatenation.
+  bool use_threads;
+  /// The number of uncompressed bytes per block
+  int64_t block_size;
+};
+
 class ARROW_EXPORT CompressedOutputStream : public OutputStream {
  public:
   ~CompressedOutputStream() override;
@@ -49,6 +63,13 @@ class ARROW_EXPORT CompressedOutputStream : public OutputStream {
   static Status Make(MemoryPool* pool, util::Codec* codec,
                      const std::shared_ptr<OutputStream>& raw,
                      std::shared_ptr<CompressedOutputStream>* out);
+  /// \brief Create a compressed output stream with the given options
+  ///
+  /// \since 0.13.0
+  static Status Make(MemoryPool* pool, util::Codec* codec,
+                     const std::shared_ptr<OutputStream>& raw,
+                     const CompressedOutputOptions& options,
+                     std::shared_ptr<CompressedOutputStream>* out);
 
   // OutputStream interface
 
@@ -20,6 +20,7 @@
 #include <unistd.h>
 #endif
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <cstdio>
@@ -274,6 +275,23 @@ TEST_F(TestFileOutputStream, Append) {
   AssertFileContents(path_, "testdata");
 }
 
+TEST_F(TestFileOutputStream, WriteBuffers) {
+  OpenFile();
+
+  std::shared_ptr<Buffer> empty;
+  ASSERT_OK(AllocateBuffer(0, &empty));
+  std::vector<std::shared_ptr<Buffer>> buffers = {
+      Buffer::FromString("test"), nullptr, empty, Buffer::FromString("data")};
+  ASSERT_OK(file_->Write(buffers));
+  ASSERT_OK(stream_->Write(buffers));
+
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(8, position);
+  ASSERT_OK(file_->Close());
+  AssertFileContents(path_, "testdata");
+}
+
 // ----------------------------------------------------------------------
 // File input tests
 
@@ -435,6 +453,60 @@ TEST_F(TestReadableFile, ReadAt) {
   ASSERT_TRUE(buffer2->Equals(expected));
 }
 
+TEST_F(TestReadableFile, ReadRanges) {
+  const int64_t file_size = 100000;
+  std::vector<uint8_t> data(file_size);
+  random_bytes(file_size, 0, data.data());
+  {
+    std::ofstream stream(path_.c_str(), std::ios::binary);
+    stream.write(reinterpret_cast<const char*>(data.data()), file_size);
+  }
+  OpenFile();
+
+  // Out of order, overlapping, far apart and past the end of the file
+  const std::vector<ReadRange> ranges = {{5000, 100},   {0, 10},     {20, 30},
+                                         {40, 0},       {5050, 200}, {90000, 9000},
+                                         {99990, 1000}, {200000, 5}};
+  for (const int64_t hole_size_limit : {0, 100, 1 << 20}) {
+    for (const bool use_threads : {false, true}) {
+      CoalesceOptions options = CoalesceOptions::Defaults();
+      options.hole_size_limit = hole_size_limit;
+      options.range_size_limit = 10000;
+      options.use_threads = use_threads;
+
+      std::vector<std::shared_ptr<Buffer>> buffers;
+      ASSERT_OK(file_->ReadRanges(ranges, options, &buffers));
+      ASSERT_EQ(ranges.size(), buffers.size());
+      for (size_t i = 0; i < ranges.size(); ++i) {
+        const int64_t offset = std::min(ranges[i].offset, file_size);
+        const int64_t length = std::min(ranges[i].length, file_size - offset);
+        Buffer expected(data.data() + offset, length);
+        ASSERT_TRUE(buffers[i]->Equals(expected)) << "range " << i;
+      }
+    }
+  }
+
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  ASSERT_OK(file_->ReadRanges({}, &buffers));
+  ASSERT_EQ(0, buffers.size());
+}
+
+TEST_F(TestReadableFile, Advise) {
+  MakeTestFile();
+  OpenFile();
+
+  const std::vector<ReadRange> ranges = {{0, 4}, {2, 100}, {1000, 10}};
+  for (const auto hint : {AccessHint::WILL_NEED, AccessHint::SEQUENTIAL,
+                          AccessHint::RANDOM, AccessHint::DONT_NEED}) {
+    ASSERT_OK(file_->Advise(ranges, hint));
+  }
+  ASSERT_OK(file_->Advise({}, AccessHint::WILL_NEED));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->ReadAt(0, 4, &buffer));
+  AssertBufferEqual(*buffer, "test");
+}
+
 TEST_F(TestReadableFile, NonExistentFile) {
   std::string path = "0xDEADBEEF.txt";
   Status s = ReadableFile::Open(path, &file_);
@@ -633,6 +705,52 @@ TEST_F(TestMemoryMappedFile, WriteRead) {
   }
 }
 
+TEST_F(TestMemoryMappedFile, ReadRanges) {
+  const int64_t buffer_size = 1024;
+  std::vector<uint8_t> buffer(buffer_size);
+  random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = "io-memory-map-read-ranges-test";
+  std::shared_ptr<MemoryMappedFile> result;
+  ASSERT_OK(InitMemoryMap(buffer_size, path, &result));
+  ASSERT_OK(result->Write(buffer.data(), buffer_size));
+
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  ASSERT_OK(result->ReadRanges({{100, 10}, {0, 50}, {1000, 100}}, &buffers));
+  ASSERT_EQ(3, buffers.size());
+  ASSERT_TRUE(buffers[0]->Equals(Buffer(buffer.data() + 100, 10)));
+  ASSERT_TRUE(buffers[1]->Equals(Buffer(buffer.data(), 50)));
+  ASSERT_TRUE(buffers[2]->Equals(Buffer(buffer.data() + 1000, 24)));
+  // The buffers point into the memory map
+  std::shared_ptr<Buffer> whole;
+  ASSERT_OK(result->ReadAt(0, buffer_size, &whole));
+  ASSERT_EQ(whole->data() + 100, buffers[0]->data());
+}
+
+TEST_F(TestMemoryMappedFile, Advise) {
+  const int64_t buffer_size = 100000;
+  std::vector<uint8_t> buffer(buffer_size);
+  random_bytes(buffer_size, 0, buffer.data());
+
+  std::string path = "io-memory-map-advise-test";
+  std::shared_ptr<MemoryMappedFile> result;
+  ASSERT_OK(InitMemoryMap(buffer_size, path, &result));
+  ASSERT_OK(result->Write(buffer.data(), buffer_size));
+
+  // Unaligned, empty, and partly or entirely out of bounds
+  const std::vector<ReadRange> ranges = {
+      {1, 10}, {5000, 30000}, {4096, 0}, {99990, 1000}, {200000, 10}, {-10, 20}};
+  for (const auto hint : {AccessHint::WILL_NEED, AccessHint::SEQUENTIAL,
+                          AccessHint::RANDOM, AccessHint::DONT_NEED}) {
+    ASSERT_OK(result->Advise(ranges, hint));
+  }
+
+  // The data is still there
+  std::shared_ptr<Buffer> out_buffer;
+  ASSERT_OK(result->ReadAt(0, buffer_size, &out_buffer));
+  ASSERT_TRUE(out_buffer->Equals(Buffer(buffer.data(), buffer_size)));
+}
+
 TEST_F(TestMemoryMappedFile, WriteResizeRead) {
   const int64_t buffer_size = 1024;
   const int reps = 5;
@@ -26,6 +26,7 @@
 #undef Realloc
 #undef Free
 #else
+#include <fcntl.h>
 #include <sys/mman.h>
 #include <unistd.h>  // IWYU pragma: keep
 #endif
@@ -38,6 +39,7 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // ----------------------------------------------------------------------
 // Other Arrow includes
@@ -54,6 +56,42 @@
 namespace arrow {
 namespace io {
 
+namespace {
+
+#ifdef POSIX_FADV_WILLNEED
+int FileAdvice(AccessHint::type hint) {
+  switch (hint) {
+    case AccessHint::WILL_NEED:
+      return POSIX_FADV_WILLNEED;
+    case AccessHint::SEQUENTIAL:
+      return POSIX_FADV_SEQUENTIAL;
+    case AccessHint::RANDOM:
+      return POSIX_FADV_RANDOM;
+    case AccessHint::DONT_NEED:
+      return POSIX_FADV_DONTNEED;
+  }
+  return POSIX_FADV_NORMAL;
+}
+#endif
+
+#ifdef MADV_WILLNEED
+int MemoryAdvice(AccessHint::type hint) {
+  switch (hint) {
+    case AccessHint::WILL_NEED:
+      return MADV_WILLNEED;
+    case AccessHint::SEQUENTIAL:
+      return MADV_SEQUENTIAL;
+    case AccessHint::RANDOM:
+      return MADV_RANDOM;
+    case AccessHint::DONT_NEED:
+      return MADV_DONTNEED;
+  }
+  return MADV_NORMAL;
+}
+#endif
+
+}  // namespace
+
 class OSFile {
  public:
   OSFile() : fd_(-1), is_open_(false), size_(-1) {}
@@ -141,6 +179,20 @@ class OSFile {
 
   Status Tell(int64_t* pos) const { return internal::FileTell(fd_, pos); }
 
+  Status Advise(const std::vector<ReadRange>& ranges, AccessHint::type hint) {
+#ifdef POSIX_FADV_WILLNEED
+    const int advice = FileAdvice(hint);
+    for (const auto& range : ranges) {
+      int ret = posix_fadvise(fd_, static_cast<off_t>(range.offset),
+                              static_cast<off_t>(range.length), advice);
+      if (ret != 0) {
+        return Status::IOError("posix_fadvise failed: ", std::strerror(ret));
+      }
+    }
+#endif
+    return Status::OK();
+  }
+
   Status Write(const void* data, int64_t length) {
     std::lock_guard<std::mutex> guard(lock_);
     if (length < 0) {
@@ -149,6 +201,11 @@ class OSFile {
     return internal::FileWrite(fd_, reinterpret_cast<const uint8_t*>(data), length);
   }
 
+  Status Write(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+    std::lock_guard<std::mutex> guard(lock_);
+    return internal::FileWriteV(fd_, buffers);
+  }
+
   int fd() const { return fd_; }
 
   bool is_open() const { return is_open_; }
@@ -281,6 +338,11 @@ Status ReadableFile::GetSize(int64_t* size) {
 
 Status ReadableFile::Seek(int64_t pos) { return impl_->Seek(pos); }
 
+Status ReadableFile::Advise(const std::vector<ReadRange>& ranges,
+                            AccessHint::type hint) {
+  return impl_->Advise(ranges, hint);
+}
+
 int ReadableFile::file_descriptor() const { return impl_->fd(); }
 
 // ----------------------------------------------------------------------
@@ -345,6 +407,10 @@ Status FileOutputStream::Write(const void* data, int64_t length) {
   return impl_->Write(data, length);
 }
 
+Status FileOutputStream::DoWrite(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  return impl_->Write(buffers);
+}
+
 int FileOutputStream::file_descriptor() const { return impl_->fd(); }
 
 // ----------------------------------------------------------------------
@@ -469,6 +535,26 @@ class MemoryMappedFile::MemoryMap : public MutableBuffer {
 
   std::mutex& resize_lock() { return resize_lock_; }
 
+  Status Advise(const std::vector<ReadRange>& ranges, AccessHint::type hint) {
+#ifdef MADV_WILLNEED
+    const int advice = MemoryAdvice(hint);
+    const int64_t page_size = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+    for (const auto& range : ranges) {
+      // madvise() needs a page-aligned address
+      const int64_t offset = std::max<int64_t>(0, std::min(range.offset, size_));
+      const int64_t start = offset / page_size * page_size;
+      const int64_t end = std::min(range.offset + range.length, size_);
+      if (end <= start) {
+        continue;
+      }
+      if (madvise(mutable_data_ + start, static_cast<size_t>(end - start), advice) != 0) {
+        return Status::IOError("madvise failed: ", std::strerror(errno));
+      }
+    }
+#endif
+    return Status::OK();
+  }
+
  private:
   // Initialize the mmap and set size, capacity and the data pointers
   Status InitMMap(int64_t initial_size, bool resize_file = false) {
@@ -634,6 +720,14 @@ Status MemoryMappedFile::Resize(int64_t new_size) {
   return Status::OK();
 }
 
+Status MemoryMappedFile::Advise(const std::vector<ReadRange>& ranges,
+                                AccessHint::type hint) {
+  auto guard_resize = memory_map_->writable()
+                          ? std::unique_lock<std::mutex>(memory_map_->resize_lock())
+                          : std::unique_lock<std::mutex>();
+  return memory_map_->Advise(ranges, hint);
+}
+
 int MemoryMappedFile::file_descriptor() const { return memory_map_->fd(); }
 
 }  // namespace io
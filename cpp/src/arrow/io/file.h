@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
@@ -99,6 +100,10 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
 
   int file_descriptor() const;
 
+ protected:
+  // Write the buffers with gather writes. Thread-safe
+  Status DoWrite(const std::vector<std::shared_ptr<Buffer>>& buffers) override;
+
  private:
   FileOutputStream();
 
@@ -162,6 +167,9 @@ class ARROW_EXPORT ReadableFile : public RandomAccessFile {
   Status GetSize(int64_t* size) override;
   Status Seek(int64_t position) override;
 
+  /// \brief Pass an access hint to the kernel using posix_fadvise(), if available
+  Status Advise(const std::vector<ReadRange>& ranges, AccessHint::type hint) override;
+
   int file_descriptor() const;
 
  private:
@@ -229,6 +237,9 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
   // @return: the size in bytes of the memory source
   Status GetSize(int64_t* size) override;
 
+  /// \brief Pass an access hint for the mapped pages using madvise(), if available
+  Status Advise(const std::vector<ReadRange>& ranges, AccessHint::type hint) override;
+
   int file_descriptor() const;
 
  private:
@@ -488,6 +488,48 @@ int LibHdfsShim::Utime(hdfsFS fs, const char* path, tTime mtime, tTime atime) {
   }
 }
 
+bool LibHdfsShim::HasReadZero() {
+  GET_SYMBOL(this, hadoopRzOptionsAlloc);
+  GET_SYMBOL(this, hadoopRzOptionsSetSkipChecksum);
+  GET_SYMBOL(this, hadoopRzOptionsFree);
+  GET_SYMBOL(this, hadoopReadZero);
+  GET_SYMBOL(this, hadoopRzBufferLength);
+  GET_SYMBOL(this, hadoopRzBufferGet);
+  GET_SYMBOL(this, hadoopRzBufferFree);
+  return this->hadoopRzOptionsAlloc != nullptr &&
+         this->hadoopRzOptionsSetSkipChecksum != nullptr &&
+         this->hadoopRzOptionsFree != nullptr && this->hadoopReadZero != nullptr &&
+         this->hadoopRzBufferLength != nullptr && this->hadoopRzBufferGet != nullptr &&
+         this->hadoopRzBufferFree != nullptr;
+}
+
+hadoopRzOptions* LibHdfsShim::RzOptionsAlloc() { return this->hadoopRzOptionsAlloc(); }
+
+int LibHdfsShim::RzOptionsSetSkipChecksum(hadoopRzOptions* opts, int skip) {
+  return this->hadoopRzOptionsSetSkipChecksum(opts, skip);
+}
+
+void LibHdfsShim::RzOptionsFree(hadoopRzOptions* opts) {
+  this->hadoopRzOptionsFree(opts);
+}
+
+hadoopRzBuffer* LibHdfsShim::ReadZero(hdfsFile file, hadoopRzOptions* opts,
+                                      int32_t maxLength) {
+  return this->hadoopReadZero(file, opts, maxLength);
+}
+
+int32_t LibHdfsShim::RzBufferLength(const hadoopRzBuffer* buffer) {
+  return this->hadoopRzBufferLength(buffer);
+}
+
+const void* LibHdfsShim::RzBufferGet(const hadoopRzBuffer* buffer) {
+  return this->hadoopRzBufferGet(buffer);
+}
+
+void LibHdfsShim::RzBufferFree(hdfsFile file, hadoopRzBuffer* buffer) {
+  this->hadoopRzBufferFree(file, buffer);
+}
+
 Status LibHdfsShim::GetRequiredSymbols() {
   GET_SYMBOL_REQUIRED(this, hdfsNewBuilder);
   GET_SYMBOL_REQUIRED(this, hdfsBuilderSetNameNode);
@@ -381,6 +381,37 @@ TYPED_TEST(TestHadoopFileSystem, ReadableMethods) {
   ASSERT_EQ(60, position);
 }
 
+TYPED_TEST(TestHadoopFileSystem, BuffersOutliveFile) {
+  SKIP_IF_NO_DRIVER();
+
+  ASSERT_OK(this->MakeScratchDir());
+
+  auto path = this->ScratchPath("test-file");
+  const int size = 1000;
+
+  std::vector<uint8_t> data = RandomData(size);
+  ASSERT_OK(this->WriteDummyFile(path, data.data(), size));
+
+  std::shared_ptr<HdfsReadableFile> file;
+  ASSERT_OK(this->client_->OpenReadable(path, &file));
+
+  // Buffers may be zero-copy reads, which keep the file open
+  std::shared_ptr<Buffer> first, second, at_end;
+  ASSERT_OK(file->Read(100, &first));
+  ASSERT_OK(file->ReadAt(500, 100, &second));
+  ASSERT_OK(file->ReadAt(900, 200, &at_end));
+  // ReadAt doesn't move the file position
+  int64_t position;
+  ASSERT_OK(file->Tell(&position));
+  ASSERT_EQ(100, position);
+  ASSERT_OK(file->Close());
+  file.reset();
+
+  ASSERT_TRUE(first->Equals(Buffer(data.data(), 100)));
+  ASSERT_TRUE(second->Equals(Buffer(data.data() + 500, 100)));
+  ASSERT_TRUE(at_end->Equals(Buffer(data.data() + 900, 100)));
+}
+
 TYPED_TEST(TestHadoopFileSystem, LargeFile) {
   SKIP_IF_NO_DRIVER();
 
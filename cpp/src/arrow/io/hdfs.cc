@@ -22,6 +22,7 @@
 #include <cerrno>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -66,6 +67,8 @@ std::string TranslateErrno(int error_code) {
 
 static constexpr int kDefaultHdfsBufferSize = 1 << 16;
 
+static constexpr char kSkipChecksumKey[] = "dfs.client.read.shortcircuit.skip.checksum";
+
 // ----------------------------------------------------------------------
 // File reading
 
@@ -118,24 +121,101 @@ Status GetPathInfoFailed(const std::string& path) {
   return Status::IOError(ss.str());
 }
 
+// State shared by a file and its zero-copy buffers, which must be released
+// before the file is closed
+struct ZeroCopyContext {
+  ZeroCopyContext(internal::LibHdfsShim* driver, hdfsFS fs, hdfsFile file,
+                  hadoopRzOptions* options)
+      : driver(driver), fs(fs), file(file), options(options), close_file(false) {}
+
+  ~ZeroCopyContext() {
+    driver->RzOptionsFree(options);
+    if (close_file) {
+      // The file was closed while zero-copy buffers were alive
+      ARROW_UNUSED(driver->CloseFile(fs, file));
+    }
+  }
+
+  internal::LibHdfsShim* driver;
+  hdfsFS fs;
+  hdfsFile file;
+  hadoopRzOptions* options;
+  bool close_file;
+};
+
+// A buffer wrapping the result of a zero-copy read
+class ZeroCopyBuffer : public Buffer {
+ public:
+  ZeroCopyBuffer(const std::shared_ptr<ZeroCopyContext>& context, hadoopRzBuffer* buffer)
+      : Buffer(reinterpret_cast<const uint8_t*>(context->driver->RzBufferGet(buffer)),
+               context->driver->RzBufferLength(buffer)),
+        context_(context),
+        buffer_(buffer) {}
+
+  ~ZeroCopyBuffer() override { context_->driver->RzBufferFree(context_->file, buffer_); }
+
+ private:
+  std::shared_ptr<ZeroCopyContext> context_;
+  hadoopRzBuffer* buffer_;
+};
+
 }  // namespace
 
 // Private implementation for read-only files
 class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
  public:
-  explicit HdfsReadableFileImpl(MemoryPool* pool) : pool_(pool) {}
+  explicit HdfsReadableFileImpl(MemoryPool* pool)
+      : pool_(pool), skip_checksum_(false), zero_copy_failed_(false) {}
 
   Status Close() {
     if (is_open_) {
+      is_open_ = false;
+      if (zero_copy_) {
+        if (zero_copy_.use_count() > 1) {
+          // Zero-copy buffers are still alive, close when they are released
+          zero_copy_->close_file = true;
+          zero_copy_.reset();
+          return Status::OK();
+        }
+        zero_copy_.reset();
+      }
       int ret = driver_->CloseFile(fs_, file_);
       CHECK_FAILURE(ret, "CloseFile");
-      is_open_ = false;
     }
     return Status::OK();
   }
 
   bool closed() const { return !is_open_; }
 
+  // Try a zero-copy read at the current position.  *out is left null if no
+  // zero-copy read could be done.  Must be called with the lock held.
+  Status ReadZeroCopy(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    if (nbytes > std::numeric_limits<int32_t>::max() || !EnsureZeroCopy()) {
+      return Status::OK();
+    }
+    hadoopRzBuffer* rz_buffer =
+        driver_->ReadZero(file_, zero_copy_->options, static_cast<int32_t>(nbytes));
+    if (rz_buffer == nullptr) {
+      // The block is not local, or needs checksumming: fall back on copying
+      return Status::OK();
+    }
+    auto buffer = std::make_shared<ZeroCopyBuffer>(zero_copy_, rz_buffer);
+    if (buffer->size() == nbytes || buffer->size() == 0) {
+      *out = buffer;
+      return Status::OK();
+    }
+    // Zero-copy reads stop at block boundaries, read the rest with a copy
+    std::shared_ptr<ResizableBuffer> combined;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &combined));
+    memcpy(combined->mutable_data(), buffer->data(), buffer->size());
+    int64_t bytes_read = 0;
+    RETURN_NOT_OK(Read(nbytes - buffer->size(), &bytes_read,
+                       combined->mutable_data() + buffer->size()));
+    RETURN_NOT_OK(combined->Resize(buffer->size() + bytes_read));
+    *out = combined;
+    return Status::OK();
+  }
+
   Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, void* buffer) {
     tSize ret;
     if (driver_->HasPread()) {
@@ -152,6 +232,22 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   }
 
   Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    if (driver_->HasReadZero()) {
+      // Zero-copy reads happen at the file position, restore it afterwards
+      std::lock_guard<std::mutex> guard(lock_);
+      int64_t current_position;
+      RETURN_NOT_OK(Tell(&current_position));
+      RETURN_NOT_OK(Seek(position));
+      std::shared_ptr<Buffer> zero_copy;
+      Status st = ReadZeroCopy(nbytes, &zero_copy);
+      RETURN_NOT_OK(Seek(current_position));
+      RETURN_NOT_OK(st);
+      if (zero_copy) {
+        *out = zero_copy;
+        return Status::OK();
+      }
+    }
+
     std::shared_ptr<ResizableBuffer> buffer;
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
 
@@ -185,6 +281,16 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
   }
 
   Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    if (driver_->HasReadZero()) {
+      std::lock_guard<std::mutex> guard(lock_);
+      std::shared_ptr<Buffer> zero_copy;
+      RETURN_NOT_OK(ReadZeroCopy(nbytes, &zero_copy));
+      if (zero_copy) {
+        *out = zero_copy;
+        return Status::OK();
+      }
+    }
+
     std::shared_ptr<ResizableBuffer> buffer;
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
 
@@ -213,9 +319,32 @@ class HdfsReadableFile::HdfsReadableFileImpl : public HdfsAnyFileImpl {
 
   void set_buffer_size(int32_t buffer_size) { buffer_size_ = buffer_size; }
 
+  void set_skip_checksum(bool skip_checksum) { skip_checksum_ = skip_checksum; }
+
  private:
+  // Set up zero-copy reads on first use.  Return false if unavailable.
+  bool EnsureZeroCopy() {
+    if (!zero_copy_ && !zero_copy_failed_) {
+      hadoopRzOptions* options = driver_->RzOptionsAlloc();
+      if (options == nullptr ||
+          driver_->RzOptionsSetSkipChecksum(options, skip_checksum_ ? 1 : 0) != 0) {
+        if (options != nullptr) {
+          driver_->RzOptionsFree(options);
+        }
+        zero_copy_failed_ = true;
+      } else {
+        zero_copy_ = std::make_shared<ZeroCopyContext>(driver_, fs_, file_, options);
+      }
+    }
+    return zero_copy_ != nullptr;
+  }
+
   MemoryPool* pool_;
   int32_t buffer_size_;
+  bool skip_checksum_;
+
+  bool zero_copy_failed_;
+  std::shared_ptr<ZeroCopyContext> zero_copy_;
 };
 
 HdfsReadableFile::HdfsReadableFile(MemoryPool* pool) {
@@ -336,7 +465,8 @@ static void SetPathInfo(const hdfsFileInfo* input, HdfsPathInfo* out) {
 // Private implementation
 class HadoopFileSystem::HadoopFileSystemImpl {
  public:
-  HadoopFileSystemImpl() : driver_(NULLPTR), port_(0), fs_(NULLPTR) {}
+  HadoopFileSystemImpl()
+      : driver_(NULLPTR), port_(0), skip_checksum_(false), fs_(NULLPTR) {}
 
   Status Connect(const HdfsConnectionConfig* config) {
     if (config->driver == HdfsDriver::LIBHDFS3) {
@@ -358,10 +488,22 @@ class HadoopFileSystem::HadoopFileSystemImpl {
       driver_->BuilderSetKerbTicketCachePath(builder, config->kerb_ticket.c_str());
     }
 
+    if (!config->domain_socket_path.empty()) {
+      int ret =
+          driver_->BuilderConfSetStr(builder, "dfs.client.read.shortcircuit", "true");
+      CHECK_FAILURE(ret, "confsetstr");
+      ret = driver_->BuilderConfSetStr(builder, "dfs.domain.socket.path",
+                                       config->domain_socket_path.c_str());
+      CHECK_FAILURE(ret, "confsetstr");
+    }
+
     for (auto& kv : config->extra_conf) {
       int ret = driver_->BuilderConfSetStr(builder, kv.first.c_str(), kv.second.c_str());
       CHECK_FAILURE(ret, "confsetstr");
     }
+    // Zero-copy reads of uncached blocks require skipping checksums
+    auto it = config->extra_conf.find(kSkipChecksumKey);
+    skip_checksum_ = it != config->extra_conf.end() && it->second == "true";
 
     driver_->BuilderSetForceNewInstance(builder);
     fs_ = driver_->BuilderConnect(builder);
@@ -497,6 +639,7 @@ class HadoopFileSystem::HadoopFileSystemImpl {
     *file = std::shared_ptr<HdfsReadableFile>(new HdfsReadableFile());
     (*file)->impl_->set_members(path, driver_, fs_, handle);
     (*file)->impl_->set_buffer_size(buffer_size);
+    (*file)->impl_->set_skip_checksum(skip_checksum_);
 
     return Status::OK();
   }
@@ -547,6 +690,7 @@ class HadoopFileSystem::HadoopFileSystemImpl {
   std::string user_;
   int port_;
   std::string kerb_ticket_;
+  bool skip_checksum_;
 
   hdfsFS fs_;
 };
@@ -66,6 +66,9 @@ struct HdfsConnectionConfig {
   std::string kerb_ticket;
   std::unordered_map<std::string, std::string> extra_conf;
   HdfsDriver driver;
+  // If not empty, enable short-circuit local reads through this UNIX domain
+  // socket, which must match the datanodes' dfs.domain.socket.path
+  std::string domain_socket_path;
 };
 
 class ARROW_EXPORT HadoopFileSystem : public FileSystem {
@@ -202,6 +205,11 @@ class ARROW_EXPORT HdfsReadableFile : public RandomAccessFile {
   Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
                 void* buffer) override;
 
+  // With libhdfs, the Buffer-returning reads first try a zero-copy read,
+  // which maps blocks stored on the local datanode (this requires
+  // short-circuit local reads, and either skipping checksums or blocks in the
+  // HDFS cache).  Such buffers keep the underlying HDFS file open until
+  // they are destroyed.  Other reads are copied into memory pool buffers.
   Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
 
   Status Seek(int64_t position) override;
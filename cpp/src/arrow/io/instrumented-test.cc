@@ -0,0 +1,151 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/instrumented.h"
+#include "arrow/io/memory.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace io {
+
+class TestInstrumented : public ::testing::Test {
+ public:
+  void SetUp() override {
+    GetIoStatisticsRegistry()->Clear();
+    data_ = Buffer::FromString("0123456789abcdefghij");
+  }
+
+  void TearDown() override { GetIoStatisticsRegistry()->Clear(); }
+
+ protected:
+  std::shared_ptr<Buffer> data_;
+};
+
+TEST_F(TestInstrumented, RandomAccessFile) {
+  auto file = std::make_shared<InstrumentedRandomAccessFile>(
+      std::make_shared<BufferReader>(data_), "file");
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file->Read(4, &buffer));
+  ASSERT_EQ("0123", buffer->ToString());
+  // Sequential: no seek
+  ASSERT_OK(file->ReadAt(4, 4, &buffer));
+  ASSERT_EQ("4567", buffer->ToString());
+  ASSERT_OK(file->ReadAt(16, 10, &buffer));
+  ASSERT_EQ("ghij", buffer->ToString());
+  ASSERT_OK(file->Seek(2));
+  char out[3];
+  int64_t bytes_read;
+  ASSERT_OK(file->Read(3, &bytes_read, out));
+  ASSERT_EQ("234", std::string(out, 3));
+
+  const IoStatistics stats = file->collector()->GetStatistics();
+  ASSERT_EQ(4, stats.num_reads);
+  ASSERT_EQ(15, stats.bytes_read);
+  ASSERT_EQ(2, stats.num_seeks);
+  // From 8 to 16 then from 20 to 2
+  ASSERT_EQ(26, stats.seek_distance);
+  int64_t histogram_total = 0;
+  for (int64_t count : stats.latency_histogram) {
+    histogram_total += count;
+  }
+  ASSERT_EQ(4, histogram_total);
+
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  ASSERT_OK(file->ReadRanges({{0, 2}, {10, 3}}, &buffers));
+  ASSERT_EQ(2, buffers.size());
+  ASSERT_EQ("abc", buffers[1]->ToString());
+  ASSERT_EQ(5, file->collector()->GetStatistics().num_reads);
+  ASSERT_EQ(20, file->collector()->GetStatistics().bytes_read);
+
+  ASSERT_OK(file->Close());
+  ASSERT_TRUE(file->raw()->closed());
+  ASSERT_TRUE(file->closed());
+}
+
+TEST_F(TestInstrumented, InputStream) {
+  InstrumentedInputStream stream(std::make_shared<BufferReader>(data_), "stream");
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream.Read(15, &buffer));
+  ASSERT_OK(stream.Read(15, &buffer));
+  ASSERT_EQ("fghij", buffer->ToString());
+  int64_t position;
+  ASSERT_OK(stream.Tell(&position));
+  ASSERT_EQ(20, position);
+
+  const IoStatistics stats = stream.collector()->GetStatistics();
+  ASSERT_EQ(2, stats.num_reads);
+  ASSERT_EQ(20, stats.bytes_read);
+  ASSERT_EQ(0, stats.num_seeks);
+}
+
+TEST_F(TestInstrumented, Registry) {
+  auto file = std::make_shared<InstrumentedRandomAccessFile>(
+      std::make_shared<BufferReader>(data_), "a");
+  InstrumentedInputStream stream(std::make_shared<BufferReader>(data_), "b");
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file->ReadAt(0, 5, &buffer));
+
+  auto all = GetIoStatisticsRegistry()->GetStatistics();
+  ASSERT_EQ(2, all.size());
+  ASSERT_EQ("a", all[0].first);
+  ASSERT_EQ(5, all[0].second.bytes_read);
+  ASSERT_EQ("b", all[1].first);
+  ASSERT_EQ(0, all[1].second.num_reads);
+
+  const std::string rendered = GetIoStatisticsRegistry()->ToString();
+  ASSERT_NE(std::string::npos, rendered.find("a: reads=1 bytes=5"));
+
+  // Statistics outlive the stream
+  file.reset();
+  ASSERT_EQ(2, GetIoStatisticsRegistry()->GetStatistics().size());
+  GetIoStatisticsRegistry()->Clear();
+  ASSERT_EQ(0, GetIoStatisticsRegistry()->GetStatistics().size());
+}
+
+TEST_F(TestInstrumented, MaybeInstrument) {
+  const bool was_enabled = IsIoInstrumentationEnabled();
+  std::shared_ptr<RandomAccessFile> raw = std::make_shared<BufferReader>(data_);
+
+  SetIoInstrumentationEnabled(false);
+  ASSERT_EQ(raw, internal::MaybeInstrumentFile(raw, "test"));
+  ASSERT_EQ(raw, internal::MaybeInstrumentStream(raw, "test"));
+  ASSERT_EQ(0, GetIoStatisticsRegistry()->GetStatistics().size());
+
+  SetIoInstrumentationEnabled(true);
+  auto file = internal::MaybeInstrumentFile(raw, "test");
+  ASSERT_NE(raw, file);
+  auto stream = internal::MaybeInstrumentStream(raw, "test");
+  ASSERT_NE(raw, stream);
+  auto all = GetIoStatisticsRegistry()->GetStatistics();
+  ASSERT_EQ(2, all.size());
+  ASSERT_EQ(0, all[0].first.find("test:"));
+  ASSERT_NE(all[0].first, all[1].first);
+
+  SetIoInstrumentationEnabled(was_enabled);
+}
+
+}  // namespace io
+}  // namespace arrow
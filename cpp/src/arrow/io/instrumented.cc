@@ -0,0 +1,352 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/instrumented.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/status.h"
+#include "arrow/util/io-util.h"
+
+namespace arrow {
+namespace io {
+
+constexpr int IoStatistics::kNumLatencyBuckets;
+
+namespace {
+
+// Times a read, recorded only if it succeeds
+class ReadTimer {
+ public:
+  explicit ReadTimer(IoStatisticsCollector* collector)
+      : collector_(collector), start_(std::chrono::steady_clock::now()) {}
+
+  void Finish(int64_t nbytes) {
+    const auto elapsed = std::chrono::steady_clock::now() - start_;
+    collector_->RecordRead(
+        nbytes, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  }
+
+ private:
+  IoStatisticsCollector* collector_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+bool InitialInstrumentationEnabled() {
+  std::string value;
+  if (!::arrow::internal::GetEnvVar("ARROW_IO_INSTRUMENTATION", &value).ok()) {
+    return false;
+  }
+  return !value.empty() && value != "0";
+}
+
+std::atomic<bool> instrumentation_enabled(InitialInstrumentationEnabled());
+
+std::atomic<int64_t> instrumented_count(0);
+
+std::string NextInstrumentedName(const std::string& kind) {
+  return kind + ":" + std::to_string(instrumented_count++);
+}
+
+}  // namespace
+
+std::string IoStatistics::ToString() const {
+  std::stringstream ss;
+  ss << "reads=" << num_reads << " bytes=" << bytes_read
+     << " time_us=" << read_time_ns / 1000 << " seeks=" << num_seeks
+     << " seek_distance=" << seek_distance << " latency_us={";
+  bool first = true;
+  for (int i = 0; i < kNumLatencyBuckets; ++i) {
+    if (latency_histogram[i] == 0) {
+      continue;
+    }
+    if (!first) {
+      ss << ", ";
+    }
+    first = false;
+    if (i == kNumLatencyBuckets - 1) {
+      ss << ">=" << (int64_t(1) << i);
+    } else {
+      ss << "<" << (int64_t(2) << i);
+    }
+    ss << ": " << latency_histogram[i];
+  }
+  ss << "}";
+  return ss.str();
+}
+
+// ----------------------------------------------------------------------
+// IoStatisticsCollector
+
+IoStatisticsCollector::IoStatisticsCollector(std::string name)
+    : name_(std::move(name)),
+      num_reads_(0),
+      bytes_read_(0),
+      read_time_ns_(0),
+      num_seeks_(0),
+      seek_distance_(0),
+      position_(0) {
+  for (auto& bucket : latency_histogram_) {
+    bucket = 0;
+  }
+}
+
+void IoStatisticsCollector::RecordRead(int64_t nbytes, int64_t elapsed_ns) {
+  ++num_reads_;
+  bytes_read_ += nbytes;
+  read_time_ns_ += elapsed_ns;
+  int bucket = 0;
+  for (int64_t us = elapsed_ns / 1000;
+       us >= 2 && bucket < IoStatistics::kNumLatencyBuckets - 1; us >>= 1) {
+    ++bucket;
+  }
+  ++latency_histogram_[bucket];
+}
+
+void IoStatisticsCollector::RecordPosition(int64_t position) {
+  const int64_t previous = position_.exchange(position);
+  if (previous != position) {
+    ++num_seeks_;
+    seek_distance_ += position > previous ? position - previous : previous - position;
+  }
+}
+
+void IoStatisticsCollector::RecordAdvance(int64_t nbytes) { position_ += nbytes; }
+
+IoStatistics IoStatisticsCollector::GetStatistics() const {
+  IoStatistics stats;
+  stats.num_reads = num_reads_;
+  stats.bytes_read = bytes_read_;
+  stats.read_time_ns = read_time_ns_;
+  stats.num_seeks = num_seeks_;
+  stats.seek_distance = seek_distance_;
+  for (int i = 0; i < IoStatistics::kNumLatencyBuckets; ++i) {
+    stats.latency_histogram[i] = latency_histogram_[i];
+  }
+  return stats;
+}
+
+// ----------------------------------------------------------------------
+// IoStatisticsRegistry
+
+void IoStatisticsRegistry::Register(std::shared_ptr<IoStatisticsCollector> collector) {
+  std::lock_guard<std::mutex> guard(lock_);
+  collectors_.push_back(std::move(collector));
+}
+
+std::vector<std::pair<std::string, IoStatistics>> IoStatisticsRegistry::GetStatistics()
+    const {
+  std::lock_guard<std::mutex> guard(lock_);
+  std::vector<std::pair<std::string, IoStatistics>> out;
+  for (const auto& collector : collectors_) {
+    out.emplace_back(collector->name(), collector->GetStatistics());
+  }
+  return out;
+}
+
+std::string IoStatisticsRegistry::ToString() const {
+  std::stringstream ss;
+  for (const auto& entry : GetStatistics()) {
+    ss << entry.first << ": " << entry.second.ToString() << "\n";
+  }
+  return ss.str();
+}
+
+void IoStatisticsRegistry::Clear() {
+  std::lock_guard<std::mutex> guard(lock_);
+  collectors_.clear();
+}
+
+IoStatisticsRegistry* GetIoStatisticsRegistry() {
+  static IoStatisticsRegistry registry;
+  return &registry;
+}
+
+void SetIoInstrumentationEnabled(bool enabled) { instrumentation_enabled = enabled; }
+
+bool IsIoInstrumentationEnabled() { return instrumentation_enabled; }
+
+// ----------------------------------------------------------------------
+// InstrumentedRandomAccessFile
+
+InstrumentedRandomAccessFile::InstrumentedRandomAccessFile(
+    std::shared_ptr<RandomAccessFile> raw, const std::string& name)
+    : raw_(std::move(raw)), collector_(std::make_shared<IoStatisticsCollector>(name)) {
+  GetIoStatisticsRegistry()->Register(collector_);
+}
+
+Status InstrumentedRandomAccessFile::Close() { return raw_->Close(); }
+
+bool InstrumentedRandomAccessFile::closed() const { return raw_->closed(); }
+
+Status InstrumentedRandomAccessFile::Tell(int64_t* position) const {
+  return raw_->Tell(position);
+}
+
+Status InstrumentedRandomAccessFile::Seek(int64_t position) {
+  RETURN_NOT_OK(raw_->Seek(position));
+  collector_->RecordPosition(position);
+  return Status::OK();
+}
+
+Status InstrumentedRandomAccessFile::GetSize(int64_t* size) {
+  return raw_->GetSize(size);
+}
+
+Status InstrumentedRandomAccessFile::Read(int64_t nbytes, int64_t* bytes_read,
+                                          void* out) {
+  ReadTimer timer(collector_.get());
+  RETURN_NOT_OK(raw_->Read(nbytes, bytes_read, out));
+  timer.Finish(*bytes_read);
+  collector_->RecordAdvance(*bytes_read);
+  return Status::OK();
+}
+
+Status InstrumentedRandomAccessFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  ReadTimer timer(collector_.get());
+  RETURN_NOT_OK(raw_->Read(nbytes, out));
+  timer.Finish((*out)->size());
+  collector_->RecordAdvance((*out)->size());
+  return Status::OK();
+}
+
+Status InstrumentedRandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
+                                            int64_t* bytes_read, void* out) {
+  ReadTimer timer(collector_.get());
+  RETURN_NOT_OK(raw_->ReadAt(position, nbytes, bytes_read, out));
+  timer.Finish(*bytes_read);
+  collector_->RecordPosition(position);
+  collector_->RecordAdvance(*bytes_read);
+  return Status::OK();
+}
+
+Status InstrumentedRandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
+                                            std::shared_ptr<Buffer>* out) {
+  ReadTimer timer(collector_.get());
+  RETURN_NOT_OK(raw_->ReadAt(position, nbytes, out));
+  timer.Finish((*out)->size());
+  collector_->RecordPosition(position);
+  collector_->RecordAdvance((*out)->size());
+  return Status::OK();
+}
+
+Status InstrumentedRandomAccessFile::ReadRanges(
+    const std::vector<ReadRange>& ranges, const CoalesceOptions& options,
+    std::vector<std::shared_ptr<Buffer>>* out) {
+  ReadTimer timer(collector_.get());
+  RETURN_NOT_OK(raw_->ReadRanges(ranges, options, out));
+  int64_t nbytes = 0;
+  for (const auto& buffer : *out) {
+    nbytes += buffer->size();
+  }
+  timer.Finish(nbytes);
+  return Status::OK();
+}
+
+Status InstrumentedRandomAccessFile::Advise(const std::vector<ReadRange>& ranges,
+                                            AccessHint::type hint) {
+  return raw_->Advise(ranges, hint);
+}
+
+util::string_view InstrumentedRandomAccessFile::Peek(int64_t nbytes) const {
+  return raw_->Peek(nbytes);
+}
+
+bool InstrumentedRandomAccessFile::supports_zero_copy() const {
+  return raw_->supports_zero_copy();
+}
+
+// ----------------------------------------------------------------------
+// InstrumentedInputStream
+
+InstrumentedInputStream::InstrumentedInputStream(std::shared_ptr<InputStream> raw,
+                                                 const std::string& name)
+    : raw_(std::move(raw)), collector_(std::make_shared<IoStatisticsCollector>(name)) {
+  GetIoStatisticsRegistry()->Register(collector_);
+}
+
+Status InstrumentedInputStream::Close() { return raw_->Close(); }
+
+bool InstrumentedInputStream::closed() const { return raw_->closed(); }
+
+Status InstrumentedInputStream::Tell(int64_t* position) const {
+  return raw_->Tell(position);
+}
+
+Status InstrumentedInputStream::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  ReadTimer timer(collector_.get());
+  RETURN_NOT_OK(raw_->Read(nbytes, bytes_read, out));
+  timer.Finish(*bytes_read);
+  collector_->RecordAdvance(*bytes_read);
+  return Status::OK();
+}
+
+Status InstrumentedInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  ReadTimer timer(collector_.get());
+  RETURN_NOT_OK(raw_->Read(nbytes, out));
+  timer.Finish((*out)->size());
+  collector_->RecordAdvance((*out)->size());
+  return Status::OK();
+}
+
+util::string_view InstrumentedInputStream::Peek(int64_t nbytes) const {
+  return raw_->Peek(nbytes);
+}
+
+bool InstrumentedInputStream::supports_zero_copy() const {
+  return raw_->supports_zero_copy();
+}
+
+namespace internal {
+
+std::shared_ptr<RandomAccessFile> MaybeInstrumentFile(
+    std::shared_ptr<RandomAccessFile> file, const std::string& kind) {
+  if (!IsIoInstrumentationEnabled()) {
+    return file;
+  }
+  return std::make_shared<InstrumentedRandomAccessFile>(std::move(file),
+                                                        NextInstrumentedName(kind));
+}
+
+std::shared_ptr<InputStream> MaybeInstrumentStream(std::shared_ptr<InputStream> stream,
+                                                   const std::string& kind) {
+  if (!IsIoInstrumentationEnabled()) {
+    return stream;
+  }
+  auto file = std::dynamic_pointer_cast<RandomAccessFile>(stream);
+  if (file) {
+    // Keep random access available to the reader
+    return MaybeInstrumentFile(std::move(file), kind);
+  }
+  return std::make_shared<InstrumentedInputStream>(std::move(stream),
+                                                   NextInstrumentedName(kind));
+}
+
+}  // namespace internal
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,220 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Per-stream I/O statistics
+
+#ifndef ARROW_IO_INSTRUMENTED_H
+#define ARROW_IO_INSTRUMENTED_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class Status;
+
+namespace io {
+
+/// \brief A snapshot of the I/O statistics of a stream
+struct ARROW_EXPORT IoStatistics {
+  /// The number of latency histogram buckets
+  static constexpr int kNumLatencyBuckets = 24;
+
+  /// The number of read calls
+  int64_t num_reads = 0;
+  /// The number of bytes returned by the reads
+  int64_t bytes_read = 0;
+  /// The total time spent in the reads, in nanoseconds
+  int64_t read_time_ns = 0;
+  /// The number of reads (or seeks) not starting where the previous read
+  /// ended
+  int64_t num_seeks = 0;
+  /// The sum of the absolute distances of the seeks, in bytes
+  int64_t seek_distance = 0;
+  /// Bucket i counts the reads taking less than 2^(i + 1) microseconds, and
+  /// at least 2^i microseconds for i > 0.  The last bucket counts all
+  /// longer reads.
+  std::array<int64_t, kNumLatencyBuckets> latency_histogram{};
+
+  std::string ToString() const;
+};
+
+/// \brief Thread-safe recorder of the I/O statistics of a stream
+class ARROW_EXPORT IoStatisticsCollector {
+ public:
+  explicit IoStatisticsCollector(std::string name);
+
+  /// \brief Record a read call returning nbytes
+  void RecordRead(int64_t nbytes, int64_t elapsed_ns);
+  /// \brief Record that the stream is accessed at the given position,
+  /// counting a seek unless the previous access ended there
+  void RecordPosition(int64_t position);
+  /// \brief Record that the stream moved forward by nbytes
+  void RecordAdvance(int64_t nbytes);
+
+  IoStatistics GetStatistics() const;
+
+  const std::string& name() const { return name_; }
+
+ private:
+  const std::string name_;
+  std::atomic<int64_t> num_reads_;
+  std::atomic<int64_t> bytes_read_;
+  std::atomic<int64_t> read_time_ns_;
+  std::atomic<int64_t> num_seeks_;
+  std::atomic<int64_t> seek_distance_;
+  std::atomic<int64_t> position_;
+  std::array<std::atomic<int64_t>, IoStatistics::kNumLatencyBuckets> latency_histogram_;
+};
+
+/// \brief The collectors of the instrumented streams of the process
+///
+/// Collectors stay registered after their stream is closed, until Clear().
+/// This class is thread-safe.
+class ARROW_EXPORT IoStatisticsRegistry {
+ public:
+  void Register(std::shared_ptr<IoStatisticsCollector> collector);
+
+  /// \brief Snapshot the statistics of all the registered collectors, by name
+  std::vector<std::pair<std::string, IoStatistics>> GetStatistics() const;
+
+  /// \brief Render the statistics of all the registered collectors, one
+  /// collector per line
+  std::string ToString() const;
+
+  void Clear();
+
+ private:
+  std::vector<std::shared_ptr<IoStatisticsCollector>> collectors_;
+  mutable std::mutex lock_;
+};
+
+/// \brief Return the process-wide registry
+ARROW_EXPORT IoStatisticsRegistry* GetIoStatisticsRegistry();
+
+/// \brief Enable or disable the instrumentation of the streams opened by the
+/// file format readers (Parquet, IPC and CSV)
+///
+/// It is initially enabled if the ARROW_IO_INSTRUMENTATION environment
+/// variable is set to a non-empty value other than "0".
+ARROW_EXPORT void SetIoInstrumentationEnabled(bool enabled);
+
+ARROW_EXPORT bool IsIoInstrumentationEnabled();
+
+/// \brief A RandomAccessFile recording the statistics of the calls to
+/// another file
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class ARROW_EXPORT InstrumentedRandomAccessFile : public RandomAccessFile {
+ public:
+  /// \brief Wrap a file, registering its collector in the global registry
+  InstrumentedRandomAccessFile(std::shared_ptr<RandomAccessFile> raw,
+                               const std::string& name);
+
+  std::shared_ptr<IoStatisticsCollector> collector() const { return collector_; }
+  std::shared_ptr<RandomAccessFile> raw() const { return raw_; }
+
+  Status Close() override;
+  bool closed() const override;
+
+  Status Tell(int64_t* position) const override;
+  Status Seek(int64_t position) override;
+  Status GetSize(int64_t* size) override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief Forward to the underlying file, recorded as a single read
+  Status ReadRanges(const std::vector<ReadRange>& ranges, const CoalesceOptions& options,
+                    std::vector<std::shared_ptr<Buffer>>* out) override;
+
+  using RandomAccessFile::ReadRanges;
+
+  Status Advise(const std::vector<ReadRange>& ranges, AccessHint::type hint) override;
+
+  util::string_view Peek(int64_t nbytes) const override;
+  bool supports_zero_copy() const override;
+
+ private:
+  std::shared_ptr<RandomAccessFile> raw_;
+  std::shared_ptr<IoStatisticsCollector> collector_;
+};
+
+/// \brief An InputStream recording the statistics of the calls to another
+/// stream
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class ARROW_EXPORT InstrumentedInputStream : public InputStream {
+ public:
+  /// \brief Wrap a stream, registering its collector in the global registry
+  InstrumentedInputStream(std::shared_ptr<InputStream> raw, const std::string& name);
+
+  std::shared_ptr<IoStatisticsCollector> collector() const { return collector_; }
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+
+  Status Close() override;
+  bool closed() const override;
+  Status Tell(int64_t* position) const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  util::string_view Peek(int64_t nbytes) const override;
+  bool supports_zero_copy() const override;
+
+ private:
+  std::shared_ptr<InputStream> raw_;
+  std::shared_ptr<IoStatisticsCollector> collector_;
+};
+
+namespace internal {
+
+/// \brief Wrap a file in an InstrumentedRandomAccessFile named
+/// "<kind>:<sequence number>" if instrumentation is enabled
+ARROW_EXPORT std::shared_ptr<RandomAccessFile> MaybeInstrumentFile(
+    std::shared_ptr<RandomAccessFile> file, const std::string& kind);
+
+/// \brief Wrap a stream in an InstrumentedInputStream named
+/// "<kind>:<sequence number>" if instrumentation is enabled
+///
+/// A RandomAccessFile is wrapped in an InstrumentedRandomAccessFile instead.
+ARROW_EXPORT std::shared_ptr<InputStream> MaybeInstrumentStream(
+    std::shared_ptr<InputStream> stream, const std::string& kind);
+
+}  // namespace internal
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_INSTRUMENTED_H
@@ -17,14 +17,24 @@
 
 #include "arrow/io/interfaces.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <numeric>
+#include <utility>
+#include <vector>
 
+#include "arrow/buffer.h"
 #include "arrow/status.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
+
+using internal::TaskGroup;
+
 namespace io {
 
 FileInterface::~FileInterface() = default;
@@ -49,6 +59,73 @@ RandomAccessFile::~RandomAccessFile() = default;
 RandomAccessFile::RandomAccessFile()
     : interface_impl_(new RandomAccessFile::RandomAccessFileImpl()) {}
 
+namespace {
+
+class FileSegmentReader : public InputStream {
+ public:
+  FileSegmentReader(std::shared_ptr<RandomAccessFile> file, int64_t file_offset,
+                    int64_t nbytes)
+      : file_(std::move(file)),
+        closed_(false),
+        position_(0),
+        file_offset_(file_offset),
+        nbytes_(nbytes) {
+    FileInterface::set_mode(FileMode::READ);
+  }
+
+  Status CheckOpen() const {
+    if (closed_) {
+      return Status::IOError("Stream is closed");
+    }
+    return Status::OK();
+  }
+
+  Status Close() override {
+    closed_ = true;
+    return Status::OK();
+  }
+
+  bool closed() const override { return closed_; }
+
+  Status Tell(int64_t* position) const override {
+    RETURN_NOT_OK(CheckOpen());
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
+    RETURN_NOT_OK(CheckOpen());
+    nbytes = std::min(nbytes, nbytes_ - position_);
+    RETURN_NOT_OK(file_->ReadAt(file_offset_ + position_, nbytes, bytes_read, out));
+    position_ += *bytes_read;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    RETURN_NOT_OK(CheckOpen());
+    nbytes = std::min(nbytes, nbytes_ - position_);
+    RETURN_NOT_OK(file_->ReadAt(file_offset_ + position_, nbytes, out));
+    position_ += (*out)->size();
+    return Status::OK();
+  }
+
+  bool supports_zero_copy() const override { return file_->supports_zero_copy(); }
+
+ private:
+  std::shared_ptr<RandomAccessFile> file_;
+  bool closed_;
+  int64_t position_;
+  int64_t file_offset_;
+  int64_t nbytes_;
+};
+
+}  // namespace
+
+std::shared_ptr<InputStream> RandomAccessFile::GetStream(
+    std::shared_ptr<RandomAccessFile> file, int64_t file_offset, int64_t nbytes) {
+  return std::make_shared<FileSegmentReader>(std::move(file), file_offset, nbytes);
+}
+
 Status RandomAccessFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
                                 void* out) {
   std::lock_guard<std::mutex> lock(interface_impl_->lock_);
@@ -63,10 +140,137 @@ Status RandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
   return Read(nbytes, out);
 }
 
+namespace {
+
+// A merged read covering the ranges with the given indices
+struct CoalescedRange {
+  ReadRange range;
+  std::vector<size_t> indices;
+};
+
+std::vector<CoalescedRange> CoalesceReadRanges(const std::vector<ReadRange>& ranges,
+                                               const CoalesceOptions& options) {
+  std::vector<size_t> order(ranges.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&ranges](size_t left, size_t right) {
+    return ranges[left].offset < ranges[right].offset;
+  });
+
+  std::vector<CoalescedRange> reads;
+  for (const size_t index : order) {
+    const ReadRange& range = ranges[index];
+    if (!reads.empty()) {
+      ReadRange& last = reads.back().range;
+      const int64_t last_end = last.offset + last.length;
+      const int64_t end = std::max(last_end, range.offset + range.length);
+      if (range.offset - last_end <= options.hole_size_limit &&
+          end - last.offset <= options.range_size_limit) {
+        last.length = end - last.offset;
+        reads.back().indices.push_back(index);
+        continue;
+      }
+    }
+    reads.push_back({range, {index}});
+  }
+  return reads;
+}
+
+std::shared_ptr<Buffer> SliceReadRange(const std::shared_ptr<Buffer>& buffer,
+                                       int64_t buffer_offset, const ReadRange& range) {
+  // The read may have stopped short at the end of the file
+  const int64_t offset = std::min(range.offset - buffer_offset, buffer->size());
+  const int64_t length = std::min(range.length, buffer->size() - offset);
+  return SliceBuffer(buffer, offset, length);
+}
+
+}  // namespace
+
+Status RandomAccessFile::ReadRanges(const std::vector<ReadRange>& ranges,
+                                    const CoalesceOptions& options,
+                                    std::vector<std::shared_ptr<Buffer>>* out) {
+  if (supports_zero_copy()) {
+    // Reads are slices of memory already, there is nothing to gain
+    out->resize(ranges.size());
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      RETURN_NOT_OK(ReadAt(ranges[i].offset, ranges[i].length, &(*out)[i]));
+    }
+    return Status::OK();
+  }
+
+  const std::vector<CoalescedRange> reads = CoalesceReadRanges(ranges, options);
+
+  std::vector<std::shared_ptr<Buffer>> buffers(reads.size());
+  auto task_group = options.use_threads && reads.size() > 1
+                        ? TaskGroup::MakeThreaded(internal::GetIOThreadPool())
+                        : TaskGroup::MakeSerial();
+  for (size_t i = 0; i < reads.size(); ++i) {
+    task_group->Append([this, i, &reads, &buffers]() {
+      return ReadAt(reads[i].range.offset, reads[i].range.length, &buffers[i]);
+    });
+  }
+  RETURN_NOT_OK(task_group->Finish());
+
+  out->resize(ranges.size());
+  for (size_t i = 0; i < reads.size(); ++i) {
+    for (const size_t index : reads[i].indices) {
+      (*out)[index] = SliceReadRange(buffers[i], reads[i].range.offset, ranges[index]);
+    }
+  }
+  return Status::OK();
+}
+
+Status RandomAccessFile::Advise(const std::vector<ReadRange>& ranges,
+                                AccessHint::type hint) {
+  return Status::OK();
+}
+
+Status RandomAccessFile::ReadRanges(const std::vector<ReadRange>& ranges,
+                                    std::vector<std::shared_ptr<Buffer>>* out) {
+  return ReadRanges(ranges, CoalesceOptions::Defaults(), out);
+}
+
+std::vector<ReadRange> SplitRange(int64_t offset, int64_t length, int64_t num_splits) {
+  std::vector<ReadRange> ranges;
+  if (length <= 0) {
+    return ranges;
+  }
+  num_splits = std::max<int64_t>(1, std::min(num_splits, length));
+  // The first (length % num_splits) ranges are one byte longer
+  const int64_t split_size = length / num_splits;
+  const int64_t remainder = length % num_splits;
+  for (int64_t i = 0; i < num_splits; ++i) {
+    const int64_t size = split_size + (i < remainder ? 1 : 0);
+    ranges.push_back({offset, size});
+    offset += size;
+  }
+  return ranges;
+}
+
+CoalesceOptions CoalesceOptions::Defaults() {
+  CoalesceOptions options;
+  options.hole_size_limit = 8192;
+  options.range_size_limit = 32 * 1024 * 1024;
+  options.use_threads = true;
+  return options;
+}
+
 Status Writable::Write(const std::string& data) {
   return Write(data.c_str(), static_cast<int64_t>(data.size()));
 }
 
+Status Writable::Write(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  return DoWrite(buffers);
+}
+
+Status Writable::DoWrite(const std::vector<std::shared_ptr<Buffer>>& buffers) {
+  for (const auto& buffer : buffers) {
+    if (buffer && buffer->size() > 0) {
+      RETURN_NOT_OK(Write(buffer->data(), buffer->size()));
+    }
+  }
+  return Status::OK();
+}
+
 Status Writable::Flush() { return Status::OK(); }
 
 }  // namespace io
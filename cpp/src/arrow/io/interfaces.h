@@ -42,6 +42,20 @@ struct ObjectType {
   enum type { FILE, DIRECTORY };
 };
 
+/// \brief How a range of a file is about to be accessed
+struct AccessHint {
+  enum type {
+    /// The data will be read soon, and may be prefetched
+    WILL_NEED,
+    /// The data will be read in order
+    SEQUENTIAL,
+    /// The data will be read in random order, readahead is pointless
+    RANDOM,
+    /// The data won't be read again soon, and may be evicted
+    DONT_NEED
+  };
+};
+
 struct ARROW_EXPORT FileStatistics {
   /// Size of file, -1 if finding length is unsupported
   int64_t size;
@@ -98,6 +112,16 @@ class ARROW_EXPORT Writable {
   virtual Status Flush();
 
   Status Write(const std::string& data);
+
+  /// \brief Write a sequence of buffers, in order
+  ///
+  /// Streams may implement this as a single gather write, without copying
+  /// the buffers.  Null buffers are skipped.
+  Status Write(const std::vector<std::shared_ptr<Buffer>>& buffers);
+
+ protected:
+  /// \brief Write a sequence of buffers, one by one unless overridden
+  virtual Status DoWrite(const std::vector<std::shared_ptr<Buffer>>& buffers);
 };
 
 class ARROW_EXPORT Readable {
@@ -136,11 +160,58 @@ class ARROW_EXPORT InputStream : virtual public FileInterface, virtual public Re
   InputStream() = default;
 };
 
+/// \brief A range of bytes in a file
+struct ARROW_EXPORT ReadRange {
+  int64_t offset;
+  int64_t length;
+};
+
+/// \brief Options for RandomAccessFile::ReadRanges()
+struct ARROW_EXPORT CoalesceOptions {
+  static CoalesceOptions Defaults();
+
+  /// Ranges separated by at most this number of bytes are read at once, along
+  /// with the bytes between them.  This trades extra bytes read for fewer
+  /// requests, which is worthwhile on high-latency storage.
+  int64_t hole_size_limit;
+  /// Ranges are not merged into reads larger than this number of bytes;
+  /// a single larger range is still read at once.
+  int64_t range_size_limit;
+  /// Whether to issue the merged reads concurrently on the I/O thread pool
+  bool use_threads;
+};
+
+/// \brief Cut a range of bytes into contiguous ranges of nearly equal sizes
+///
+/// Used to read a single large file as several independent ranges, e.g.
+/// concurrently with RandomAccessFile::GetStream().  The ranges are returned
+/// in order and cover [offset, offset + length) exactly; there are at most
+/// num_splits of them, and none if length is 0.
+///
+/// \param[in] offset The start of the range to split
+/// \param[in] length The length of the range to split
+/// \param[in] num_splits The number of ranges to produce
+ARROW_EXPORT std::vector<ReadRange> SplitRange(int64_t offset, int64_t length,
+                                               int64_t num_splits);
+
 class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
  public:
   /// Necessary because we hold a std::unique_ptr
   ~RandomAccessFile() override;
 
+  /// \brief Create an isolated InputStream reading a segment of a file
+  ///
+  /// The stream reads with ReadAt() and keeps its own position, so several
+  /// streams over the same file may be read concurrently if the file's
+  /// ReadAt() is thread-safe.  The stream does not close the file.
+  ///
+  /// \param[in] file The file to read from
+  /// \param[in] file_offset The start of the segment
+  /// \param[in] nbytes The length of the segment; reads stop at the end of
+  /// the file if it is shorter
+  static std::shared_ptr<InputStream> GetStream(std::shared_ptr<RandomAccessFile> file,
+                                                int64_t file_offset, int64_t nbytes);
+
   virtual Status GetSize(int64_t* size) = 0;
 
   /// \brief Read nbytes at position, provide default implementations using
@@ -166,6 +237,35 @@ class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
   /// retrieved by calling Buffer::size().
   virtual Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out);
 
+  /// \brief Read several ranges of the file
+  ///
+  /// The default implementation coalesces nearby ranges (see
+  /// CoalesceOptions), reads the merged ranges with ReadAt(), concurrently
+  /// if requested, and returns zero-copy slices of the merged reads.
+  /// Files supporting zero-copy reads simply read each range.
+  /// Ranges may be given in any order and may overlap.  As with ReadAt(),
+  /// ranges extending past the end of the file give shorter buffers.
+  ///
+  /// \param[in] ranges The ranges to read
+  /// \param[in] options How to coalesce and issue the reads
+  /// \param[out] out One buffer for each range, in order
+  virtual Status ReadRanges(const std::vector<ReadRange>& ranges,
+                            const CoalesceOptions& options,
+                            std::vector<std::shared_ptr<Buffer>>* out);
+
+  /// \brief Read several ranges of the file with the default options
+  Status ReadRanges(const std::vector<ReadRange>& ranges,
+                    std::vector<std::shared_ptr<Buffer>>* out);
+
+  /// \brief Tell the operating system how ranges of the file will be accessed
+  ///
+  /// This is only a hint, which can let the kernel prefetch or evict pages
+  /// ahead of time.  The default implementation does nothing.
+  ///
+  /// \param[in] ranges The ranges the hint applies to
+  /// \param[in] hint The expected access pattern
+  virtual Status Advise(const std::vector<ReadRange>& ranges, AccessHint::type hint);
+
  protected:
   RandomAccessFile();
 
@@ -216,6 +216,54 @@ TEST(TestBufferReader, RetainParentReference) {
   ASSERT_EQ(0, std::memcmp(slice2->data(), data.c_str() + 4, 6));
 }
 
+TEST(TestRandomAccessFile, GetStream) {
+  auto file = std::make_shared<BufferReader>(Buffer::FromString("data123456"));
+
+  auto stream1 = RandomAccessFile::GetStream(file, 2, 5);
+  auto stream2 = RandomAccessFile::GetStream(file, 7, 10);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream1->Read(3, &buffer));
+  ASSERT_EQ("ta1", buffer->ToString());
+  // Streams are independent of each other
+  ASSERT_OK(stream2->Read(10, &buffer));
+  ASSERT_EQ("456", buffer->ToString());
+  char out[10];
+  int64_t bytes_read;
+  ASSERT_OK(stream1->Read(10, &bytes_read, out));
+  ASSERT_EQ("23", std::string(out, bytes_read));
+  int64_t position;
+  ASSERT_OK(stream1->Tell(&position));
+  ASSERT_EQ(5, position);
+  ASSERT_OK(stream1->Read(10, &buffer));
+  ASSERT_EQ(0, buffer->size());
+
+  ASSERT_OK(stream1->Close());
+  ASSERT_TRUE(stream1->closed());
+  ASSERT_FALSE(file->closed());
+  ASSERT_RAISES(IOError, stream1->Read(1, &buffer));
+}
+
+TEST(TestSplitRange, Basics) {
+  auto ranges = SplitRange(10, 11, 3);
+  ASSERT_EQ(3, ranges.size());
+  ASSERT_EQ(10, ranges[0].offset);
+  ASSERT_EQ(4, ranges[0].length);
+  ASSERT_EQ(14, ranges[1].offset);
+  ASSERT_EQ(4, ranges[1].length);
+  ASSERT_EQ(18, ranges[2].offset);
+  ASSERT_EQ(3, ranges[2].length);
+
+  // Ranges are never empty
+  ranges = SplitRange(0, 2, 5);
+  ASSERT_EQ(2, ranges.size());
+  ASSERT_EQ(1, ranges[1].offset);
+  ASSERT_EQ(1, ranges[1].length);
+  ranges = SplitRange(0, 5, 0);
+  ASSERT_EQ(1, ranges.size());
+  ASSERT_EQ(5, ranges[0].length);
+  ASSERT_EQ(0, SplitRange(3, 0, 4).size());
+}
+
 TEST(TestMemcopy, ParallelMemcopy) {
 #if defined(ARROW_VALGRIND)
   // Compensate for Valgrind's slowness
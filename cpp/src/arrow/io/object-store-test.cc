@@ -0,0 +1,432 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/object-store.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+
+namespace arrow {
+namespace io {
+
+// An object store in memory, recording the requests made to it
+class MemoryObjectStore : public ObjectStoreClient {
+ public:
+  Status HeadObject(const std::string& key, int64_t* size) override {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = objects_.find(key);
+    if (it == objects_.end()) {
+      return Status::KeyError("No such key: ", key);
+    }
+    *size = static_cast<int64_t>(it->second.size());
+    return Status::OK();
+  }
+
+  Status GetRange(const std::string& key, int64_t offset, int64_t length,
+                  int64_t* bytes_read, void* out) override {
+    std::string data;
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      auto it = objects_.find(key);
+      if (it == objects_.end()) {
+        return Status::KeyError("No such key: ", key);
+      }
+      data = it->second;
+      ++num_gets_;
+      max_concurrent_gets_ = std::max(max_concurrent_gets_, ++concurrent_gets_);
+    }
+    // Give the other requests a chance to overlap
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    const int64_t size = static_cast<int64_t>(data.size());
+    offset = std::min(offset, size);
+    *bytes_read = std::min(length, size - offset);
+    std::memcpy(out, data.data() + offset, static_cast<size_t>(*bytes_read));
+    std::lock_guard<std::mutex> guard(lock_);
+    --concurrent_gets_;
+    return Status::OK();
+  }
+
+  Status PutObject(const std::string& key, const std::shared_ptr<Buffer>& data) override {
+    std::lock_guard<std::mutex> guard(lock_);
+    objects_[key] = data->ToString();
+    ++num_puts_;
+    return Status::OK();
+  }
+
+  Status DeleteObject(const std::string& key) override {
+    std::lock_guard<std::mutex> guard(lock_);
+    objects_.erase(key);
+    return Status::OK();
+  }
+
+  Status CopyObject(const std::string& src, const std::string& dst) override {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = objects_.find(src);
+    if (it == objects_.end()) {
+      return Status::KeyError("No such key: ", src);
+    }
+    objects_[dst] = it->second;
+    return Status::OK();
+  }
+
+  Status ListObjects(const std::string& prefix,
+                     std::vector<std::string>* keys) override {
+    std::lock_guard<std::mutex> guard(lock_);
+    keys->clear();
+    for (const auto& object : objects_) {
+      if (object.first.compare(0, prefix.size(), prefix) == 0) {
+        keys->push_back(object.first);
+      }
+    }
+    return Status::OK();
+  }
+
+  Status CreateMultipartUpload(const std::string& key, std::string* upload_id) override {
+    std::lock_guard<std::mutex> guard(lock_);
+    *upload_id = "upload-" + std::to_string(uploads_.size());
+    uploads_[*upload_id];
+    return Status::OK();
+  }
+
+  Status UploadPart(const std::string& key, const std::string& upload_id,
+                    int part_number, const std::shared_ptr<Buffer>& data,
+                    std::string* etag) override {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (part_number == fail_part_) {
+      return Status::IOError("Injected failure");
+    }
+    uploads_[upload_id][part_number] = data->ToString();
+    *etag = "etag-" + std::to_string(part_number);
+    return Status::OK();
+  }
+
+  Status CompleteMultipartUpload(const std::string& key, const std::string& upload_id,
+                                 const std::vector<std::string>& etags) override {
+    std::lock_guard<std::mutex> guard(lock_);
+    const auto& parts = uploads_[upload_id];
+    if (parts.size() != etags.size()) {
+      return Status::Invalid("Wrong number of parts");
+    }
+    std::string data;
+    int part_number = 1;
+    for (const auto& part : parts) {
+      if (part.first != part_number ||
+          etags[part_number - 1] != "etag-" + std::to_string(part_number)) {
+        return Status::Invalid("Wrong part ", part.first);
+      }
+      data += part.second;
+      ++part_number;
+    }
+    objects_[key] = data;
+    part_sizes_.clear();
+    for (const auto& part : parts) {
+      part_sizes_.push_back(static_cast<int64_t>(part.second.size()));
+    }
+    uploads_.erase(upload_id);
+    return Status::OK();
+  }
+
+  Status AbortMultipartUpload(const std::string& key,
+                              const std::string& upload_id) override {
+    std::lock_guard<std::mutex> guard(lock_);
+    uploads_.erase(upload_id);
+    ++num_aborts_;
+    return Status::OK();
+  }
+
+  void SetObject(const std::string& key, const std::string& data) {
+    objects_[key] = data;
+  }
+
+  bool HasObject(const std::string& key) const { return objects_.count(key) > 0; }
+  const std::string& GetObject(const std::string& key) { return objects_[key]; }
+
+  int64_t num_gets() const { return num_gets_; }
+  int64_t max_concurrent_gets() const { return max_concurrent_gets_; }
+  int64_t num_puts() const { return num_puts_; }
+  int64_t num_aborts() const { return num_aborts_; }
+  size_t num_uploads() const { return uploads_.size(); }
+  const std::vector<int64_t>& part_sizes() const { return part_sizes_; }
+
+  void set_fail_part(int part_number) { fail_part_ = part_number; }
+
+  void ResetCounters() {
+    num_gets_ = 0;
+    max_concurrent_gets_ = 0;
+  }
+
+ private:
+  std::map<std::string, std::string> objects_;
+  std::map<std::string, std::map<int, std::string>> uploads_;
+  std::vector<int64_t> part_sizes_;
+
+  int64_t num_gets_ = 0;
+  int64_t concurrent_gets_ = 0;
+  int64_t max_concurrent_gets_ = 0;
+  int64_t num_puts_ = 0;
+  int64_t num_aborts_ = 0;
+  int fail_part_ = -1;
+  std::mutex lock_;
+};
+
+class TestObjectStore : public ::testing::Test {
+ public:
+  void SetUp() override {
+    client_ = std::make_shared<MemoryObjectStore>();
+    options_ = ObjectStoreOptions::Defaults();
+    options_.range_size = 1000;
+    options_.footer_cache_size = 500;
+    options_.part_size = 1000;
+    MakeFileSystem();
+  }
+
+  void MakeFileSystem() {
+    ASSERT_OK(ObjectStoreFileSystem::Make(client_, options_, &fs_));
+  }
+
+  // Store random data under the given key
+  std::string MakeObject(const std::string& key, int64_t size) {
+    std::string data(static_cast<size_t>(size), '\0');
+    random_bytes(size, 42, reinterpret_cast<uint8_t*>(&data[0]));
+    client_->SetObject(key, data);
+    return data;
+  }
+
+  void AssertBufferEqual(const std::string& expected, const Buffer& actual) {
+    ASSERT_EQ(expected, actual.ToString());
+  }
+
+ protected:
+  std::shared_ptr<MemoryObjectStore> client_;
+  ObjectStoreOptions options_;
+  std::shared_ptr<ObjectStoreFileSystem> fs_;
+};
+
+TEST_F(TestObjectStore, ParallelRangedReads) {
+  const std::string data = MakeObject("bucket/file", 20000);
+  std::shared_ptr<ObjectStoreReadableFile> file;
+  ASSERT_OK(fs_->OpenReadable("/bucket/file", &file));
+
+  int64_t size;
+  ASSERT_OK(file->GetSize(&size));
+  ASSERT_EQ(20000, size);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file->ReadAt(100, 10500, &buffer));
+  AssertBufferEqual(data.substr(100, 10500), *buffer);
+  // One GET per range_size
+  ASSERT_EQ(11, client_->num_gets());
+  ASSERT_GT(client_->max_concurrent_gets(), 1);
+
+  // Serial requests when threads are disabled
+  options_.use_threads = false;
+  MakeFileSystem();
+  ASSERT_OK(fs_->OpenReadable("bucket/file", &file));
+  client_->ResetCounters();
+  std::string out(5000, '\0');
+  int64_t bytes_read;
+  ASSERT_OK(file->ReadAt(0, 5000, &bytes_read, &out[0]));
+  ASSERT_EQ(5000, bytes_read);
+  ASSERT_EQ(data.substr(0, 5000), out);
+  ASSERT_EQ(1, client_->num_gets());
+
+  ASSERT_OK(file->Seek(19000));
+  ASSERT_OK(file->Read(2000, &buffer));
+  AssertBufferEqual(data.substr(19000), *buffer);
+  int64_t position;
+  ASSERT_OK(file->Tell(&position));
+  ASSERT_EQ(20000, position);
+
+  ASSERT_RAISES(Invalid, file->ReadAt(-1, 10, &buffer));
+  ASSERT_OK(file->Close());
+  ASSERT_TRUE(file->closed());
+  ASSERT_RAISES(Invalid, file->ReadAt(0, 10, &buffer));
+}
+
+TEST_F(TestObjectStore, FooterCache) {
+  const std::string data = MakeObject("file", 20000);
+  std::shared_ptr<ObjectStoreReadableFile> file;
+  ASSERT_OK(fs_->OpenReadable("file", &file));
+
+  // Parquet-like footer reads: the length, then the metadata
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file->ReadAt(20000 - 8, 8, &buffer));
+  AssertBufferEqual(data.substr(20000 - 8), *buffer);
+  ASSERT_OK(file->ReadAt(20000 - 400, 392, &buffer));
+  AssertBufferEqual(data.substr(20000 - 400, 392), *buffer);
+  ASSERT_OK(file->ReadAt(20000 - 10, 100, &buffer));
+  AssertBufferEqual(data.substr(20000 - 10), *buffer);
+  ASSERT_EQ(1, client_->num_gets());
+
+  // Reads overlapping the start of the footer go to the store
+  ASSERT_OK(file->ReadAt(20000 - 600, 200, &buffer));
+  AssertBufferEqual(data.substr(20000 - 600, 200), *buffer);
+  ASSERT_EQ(2, client_->num_gets());
+
+  // Small objects are cached whole
+  const std::string small = MakeObject("small", 100);
+  ASSERT_OK(fs_->OpenReadable("small", &file));
+  client_->ResetCounters();
+  ASSERT_OK(file->ReadAt(90, 10, &buffer));
+  ASSERT_OK(file->ReadAt(0, 50, &buffer));
+  AssertBufferEqual(small.substr(0, 50), *buffer);
+  ASSERT_EQ(1, client_->num_gets());
+}
+
+TEST_F(TestObjectStore, ReadRanges) {
+  const std::string data = MakeObject("file", 20000);
+  std::shared_ptr<ObjectStoreReadableFile> file;
+  ASSERT_OK(fs_->OpenReadable("file", &file));
+
+  const std::vector<ReadRange> ranges = {
+      {5000, 100}, {0, 10}, {20, 10}, {2000, 3500}, {19990, 100}, {30000, 10}, {7, 0}};
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  ASSERT_OK(file->ReadRanges(ranges, &buffers));
+  ASSERT_EQ(ranges.size(), buffers.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const size_t offset = std::min<size_t>(ranges[i].offset, data.size());
+    AssertBufferEqual(data.substr(offset, ranges[i].length), *buffers[i]);
+  }
+  // The large range is split into GETs of at most range_size bytes, the
+  // last of which also covers {5000, 100}.  Nearby small ranges share a GET,
+  // and the footer takes one more.
+  ASSERT_EQ(6, client_->num_gets());
+  ASSERT_GT(client_->max_concurrent_gets(), 1);
+}
+
+TEST_F(TestObjectStore, MultipartUpload) {
+  std::shared_ptr<ObjectStoreOutputStream> stream;
+  ASSERT_OK(fs_->OpenWritable("dir/file", &stream));
+  std::string data(3500, '\0');
+  random_bytes(3500, 0, reinterpret_cast<uint8_t*>(&data[0]));
+  ASSERT_OK(stream->Write(data.substr(0, 10)));
+  ASSERT_OK(stream->Write(data.substr(10, 2500)));
+  ASSERT_OK(stream->Write(data.substr(2510)));
+  int64_t position;
+  ASSERT_OK(stream->Tell(&position));
+  ASSERT_EQ(3500, position);
+  // Not visible until closed
+  ASSERT_FALSE(client_->HasObject("dir/file"));
+  ASSERT_OK(stream->Close());
+  ASSERT_TRUE(stream->closed());
+  ASSERT_EQ(data, client_->GetObject("dir/file"));
+  ASSERT_EQ(std::vector<int64_t>({1000, 1000, 1000, 500}), client_->part_sizes());
+  ASSERT_EQ(0, client_->num_puts());
+
+  // Small files are a single PUT
+  ASSERT_OK(fs_->OpenWritable("dir/small", &stream));
+  ASSERT_OK(stream->Write("hello"));
+  ASSERT_OK(stream->Close());
+  ASSERT_EQ("hello", client_->GetObject("dir/small"));
+  ASSERT_EQ(1, client_->num_puts());
+  ASSERT_RAISES(Invalid, stream->Write("again"));
+
+  // Serial uploads
+  options_.use_threads = false;
+  MakeFileSystem();
+  ASSERT_OK(fs_->OpenWritable("dir/serial", &stream));
+  ASSERT_OK(stream->Write(data.substr(0, 2000)));
+  ASSERT_OK(stream->Close());
+  ASSERT_EQ(data.substr(0, 2000), client_->GetObject("dir/serial"));
+  ASSERT_EQ(std::vector<int64_t>({1000, 1000}), client_->part_sizes());
+}
+
+TEST_F(TestObjectStore, FailedUploadIsAborted) {
+  client_->set_fail_part(2);
+  std::shared_ptr<ObjectStoreOutputStream> stream;
+  ASSERT_OK(fs_->OpenWritable("file", &stream));
+  std::string data(5000, 'x');
+  // The failure surfaces in Write() or, at the latest, in Close()
+  ARROW_UNUSED(stream->Write(data));
+  ASSERT_RAISES(IOError, stream->Close());
+  ASSERT_EQ(1, client_->num_aborts());
+  ASSERT_EQ(0, client_->num_uploads());
+  ASSERT_FALSE(client_->HasObject("file"));
+}
+
+TEST_F(TestObjectStore, FileSystemOperations) {
+  ASSERT_OK(fs_->MakeDirectory("bucket/empty"));
+  MakeObject("bucket/a/1", 10);
+  MakeObject("bucket/a/b/2", 20);
+  MakeObject("bucket/c", 30);
+
+  std::vector<std::string> listing;
+  ASSERT_OK(fs_->GetChildren("bucket", &listing));
+  ASSERT_EQ(std::vector<std::string>({"bucket/a", "bucket/c", "bucket/empty"}), listing);
+  ASSERT_OK(fs_->GetChildren("/bucket/a/", &listing));
+  ASSERT_EQ(std::vector<std::string>({"bucket/a/1", "bucket/a/b"}), listing);
+  ASSERT_OK(fs_->GetChildren("bucket/empty", &listing));
+  ASSERT_EQ(0, listing.size());
+
+  FileStatistics stat;
+  ASSERT_OK(fs_->Stat("bucket/c", &stat));
+  ASSERT_EQ(ObjectType::FILE, stat.kind);
+  ASSERT_EQ(30, stat.size);
+  ASSERT_OK(fs_->Stat("bucket/a", &stat));
+  ASSERT_EQ(ObjectType::DIRECTORY, stat.kind);
+  ASSERT_OK(fs_->Stat("bucket/empty", &stat));
+  ASSERT_EQ(ObjectType::DIRECTORY, stat.kind);
+  ASSERT_RAISES(IOError, fs_->Stat("bucket/missing", &stat));
+
+  std::shared_ptr<ObjectStoreReadableFile> file;
+  ASSERT_RAISES(IOError, fs_->OpenReadable("bucket/missing", &file));
+  ASSERT_RAISES(IOError, fs_->OpenReadable("bucket/a", &file));
+
+  ASSERT_OK(fs_->Rename("bucket/c", "bucket/d"));
+  ASSERT_FALSE(client_->HasObject("bucket/c"));
+  ASSERT_TRUE(client_->HasObject("bucket/d"));
+  ASSERT_OK(fs_->Rename("bucket/a", "bucket/e"));
+  ASSERT_OK(fs_->GetChildren("bucket/e", &listing));
+  ASSERT_EQ(std::vector<std::string>({"bucket/e/1", "bucket/e/b"}), listing);
+  ASSERT_RAISES(IOError, fs_->Stat("bucket/a", &stat));
+  ASSERT_RAISES(IOError, fs_->Rename("bucket/a", "bucket/f"));
+
+  ASSERT_OK(fs_->DeleteFile("bucket/d"));
+  ASSERT_RAISES(IOError, fs_->DeleteFile("bucket/d"));
+  ASSERT_OK(fs_->DeleteDirectory("bucket/e"));
+  ASSERT_OK(fs_->GetChildren("bucket", &listing));
+  ASSERT_EQ(std::vector<std::string>({"bucket/empty"}), listing);
+  ASSERT_RAISES(IOError, fs_->DeleteDirectory("bucket/e"));
+}
+
+TEST_F(TestObjectStore, InvalidOptions) {
+  options_.range_size = 0;
+  ASSERT_RAISES(Invalid, ObjectStoreFileSystem::Make(client_, options_, &fs_));
+  options_ = ObjectStoreOptions::Defaults();
+  options_.part_size = 0;
+  ASSERT_RAISES(Invalid, ObjectStoreFileSystem::Make(client_, options_, &fs_));
+  options_ = ObjectStoreOptions::Defaults();
+  options_.footer_cache_size = -1;
+  ASSERT_RAISES(Invalid, ObjectStoreFileSystem::Make(client_, options_, &fs_));
+}
+
+}  // namespace io
+}  // namespace arrow
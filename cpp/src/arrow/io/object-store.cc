@@ -0,0 +1,759 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/object-store.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+
+using internal::TaskGroup;
+
+namespace io {
+
+namespace {
+
+constexpr int64_t kDefaultRangeSize = 8 * 1024 * 1024;
+constexpr int64_t kDefaultFooterCacheSize = 64 * 1024;
+constexpr int64_t kDefaultPartSize = 8 * 1024 * 1024;
+
+// Strip leading and trailing slashes, the root is the empty key
+std::string PathToKey(const std::string& path) {
+  const size_t begin = path.find_first_not_of('/');
+  if (begin == std::string::npos) {
+    return "";
+  }
+  const size_t end = path.find_last_not_of('/');
+  return path.substr(begin, end - begin + 1);
+}
+
+// The prefix of the keys below a directory
+std::string DirectoryPrefix(const std::string& key) {
+  return key.empty() ? key : key + "/";
+}
+
+Status PathNotFound(const std::string& path) {
+  return Status::IOError("Path does not exist: '", path, "'");
+}
+
+// One ranged GET, which must not stop short since reads are clamped to the
+// object size known when opening
+Status GetFullRange(ObjectStoreClient* client, const std::string& key, int64_t offset,
+                    int64_t length, uint8_t* out) {
+  int64_t bytes_read = 0;
+  RETURN_NOT_OK(client->GetRange(key, offset, length, &bytes_read, out));
+  if (bytes_read != length) {
+    return Status::IOError("Object '", key, "' changed while reading: expected ",
+                           length, " bytes at offset ", offset, ", got ", bytes_read);
+  }
+  return Status::OK();
+}
+
+int MaxPendingParts() { return std::max(2, internal::GetIOThreadPool()->GetCapacity()); }
+
+}  // namespace
+
+ObjectStoreOptions ObjectStoreOptions::Defaults() {
+  ObjectStoreOptions options;
+  options.range_size = kDefaultRangeSize;
+  options.footer_cache_size = kDefaultFooterCacheSize;
+  options.part_size = kDefaultPartSize;
+  options.use_threads = true;
+  return options;
+}
+
+// ----------------------------------------------------------------------
+// ObjectStoreReadableFile implementation
+
+class ObjectStoreReadableFile::Impl {
+ public:
+  Impl(const std::shared_ptr<ObjectStoreClient>& client, const std::string& key,
+       int64_t size, const ObjectStoreOptions& options, MemoryPool* pool)
+      : client_(client),
+        key_(key),
+        size_(size),
+        options_(options),
+        pool_(pool),
+        footer_offset_(std::max<int64_t>(0, size - options.footer_cache_size)),
+        position_(0),
+        closed_(false) {}
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    closed_ = true;
+    footer_.reset();
+    return Status::OK();
+  }
+
+  bool closed() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return closed_;
+  }
+
+  Status CheckClosed() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (closed_) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (closed_) {
+      return Status::Invalid("Operation on closed file");
+    }
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status Seek(int64_t position) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (closed_) {
+      return Status::Invalid("Operation on closed file");
+    }
+    if (position < 0) {
+      return Status::Invalid("Invalid position ", position);
+    }
+    position_ = position;
+    return Status::OK();
+  }
+
+  Status GetSize(int64_t* size) {
+    RETURN_NOT_OK(CheckClosed());
+    *size = size_;
+    return Status::OK();
+  }
+
+  // Validate a read and clamp it to the end of the object
+  Status CheckRead(int64_t position, int64_t* nbytes) const {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0 || *nbytes < 0) {
+      return Status::Invalid("Invalid read (offset = ", position, ", size = ", *nbytes,
+                             ")");
+    }
+    *nbytes = std::min(*nbytes, std::max<int64_t>(0, size_ - position));
+    return Status::OK();
+  }
+
+  bool InFooter(int64_t position, int64_t nbytes) const {
+    return options_.footer_cache_size > 0 && nbytes > 0 && position >= footer_offset_;
+  }
+
+  // Fetch the end of the object on first use
+  Status GetFooter(std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(footer_lock_);
+    if (!footer_) {
+      std::shared_ptr<Buffer> footer;
+      RETURN_NOT_OK(AllocateBuffer(pool_, size_ - footer_offset_, &footer));
+      RETURN_NOT_OK(GetFullRange(client_.get(), key_, footer_offset_, footer->size(),
+                                 footer->mutable_data()));
+      footer_ = footer;
+    }
+    *out = footer_;
+    return Status::OK();
+  }
+
+  // Read a clamped range with one GET per range_size bytes
+  Status ReadRange(int64_t position, int64_t nbytes, uint8_t* out) {
+    const int64_t range_size = options_.range_size;
+    const int64_t num_ranges = (nbytes + range_size - 1) / range_size;
+    // Reads issued from the I/O pool (e.g. by ReadRanges()) don't spawn
+    // further tasks, which could wait behind them
+    if (num_ranges <= 1 || !options_.use_threads ||
+        internal::GetIOThreadPool()->OwnsThisThread()) {
+      return GetFullRange(client_.get(), key_, position, nbytes, out);
+    }
+    auto task_group = TaskGroup::MakeThreaded(internal::GetIOThreadPool());
+    ObjectStoreClient* client = client_.get();
+    const std::string& key = key_;
+    for (int64_t i = 0; i < num_ranges; ++i) {
+      const int64_t offset = i * range_size;
+      const int64_t length = std::min(range_size, nbytes - offset);
+      task_group->Append([client, &key, position, offset, length, out]() {
+        return GetFullRange(client, key, position + offset, length, out + offset);
+      });
+    }
+    return task_group->Finish();
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, void* out) {
+    RETURN_NOT_OK(CheckRead(position, &nbytes));
+    if (InFooter(position, nbytes)) {
+      std::shared_ptr<Buffer> footer;
+      RETURN_NOT_OK(GetFooter(&footer));
+      std::memcpy(out, footer->data() + position - footer_offset_,
+                  static_cast<size_t>(nbytes));
+    } else if (nbytes > 0) {
+      RETURN_NOT_OK(ReadRange(position, nbytes, reinterpret_cast<uint8_t*>(out)));
+    }
+    *bytes_read = nbytes;
+    return Status::OK();
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(CheckRead(position, &nbytes));
+    if (InFooter(position, nbytes)) {
+      std::shared_ptr<Buffer> footer;
+      RETURN_NOT_OK(GetFooter(&footer));
+      *out = SliceBuffer(footer, position - footer_offset_, nbytes);
+      return Status::OK();
+    }
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(AllocateBuffer(pool_, nbytes, &buffer));
+    if (nbytes > 0) {
+      RETURN_NOT_OK(ReadRange(position, nbytes, buffer->mutable_data()));
+    }
+    *out = buffer;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    std::lock_guard<std::mutex> guard(read_lock_);
+    int64_t position = 0;
+    RETURN_NOT_OK(Tell(&position));
+    RETURN_NOT_OK(ReadAt(position, nbytes, bytes_read, out));
+    return Seek(position + *bytes_read);
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    std::lock_guard<std::mutex> guard(read_lock_);
+    int64_t position = 0;
+    RETURN_NOT_OK(Tell(&position));
+    RETURN_NOT_OK(ReadAt(position, nbytes, out));
+    return Seek(position + (*out)->size());
+  }
+
+  int64_t range_size() const { return options_.range_size; }
+
+ private:
+  std::shared_ptr<ObjectStoreClient> client_;
+  const std::string key_;
+  const int64_t size_;
+  const ObjectStoreOptions options_;
+  MemoryPool* pool_;
+
+  const int64_t footer_offset_;
+  std::shared_ptr<Buffer> footer_;
+  std::mutex footer_lock_;
+
+  int64_t position_;
+  bool closed_;
+  mutable std::mutex lock_;
+  // Serializes the stream reads, which update the position
+  std::mutex read_lock_;
+};
+
+ObjectStoreReadableFile::ObjectStoreReadableFile() {}
+
+ObjectStoreReadableFile::~ObjectStoreReadableFile() {}
+
+Status ObjectStoreReadableFile::Close() { return impl_->Close(); }
+
+bool ObjectStoreReadableFile::closed() const { return impl_->closed(); }
+
+Status ObjectStoreReadableFile::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status ObjectStoreReadableFile::Seek(int64_t position) { return impl_->Seek(position); }
+
+Status ObjectStoreReadableFile::GetSize(int64_t* size) { return impl_->GetSize(size); }
+
+Status ObjectStoreReadableFile::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status ObjectStoreReadableFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+Status ObjectStoreReadableFile::ReadAt(int64_t position, int64_t nbytes,
+                                       int64_t* bytes_read, void* out) {
+  return impl_->ReadAt(position, nbytes, bytes_read, out);
+}
+
+Status ObjectStoreReadableFile::ReadAt(int64_t position, int64_t nbytes,
+                                       std::shared_ptr<Buffer>* out) {
+  return impl_->ReadAt(position, nbytes, out);
+}
+
+Status ObjectStoreReadableFile::ReadRanges(const std::vector<ReadRange>& ranges,
+                                           const CoalesceOptions& options,
+                                           std::vector<std::shared_ptr<Buffer>>* out) {
+  RETURN_NOT_OK(impl_->CheckClosed());
+  const int64_t range_size = impl_->range_size();
+
+  // Split the ranges into pieces of at most range_size bytes, so that the
+  // base implementation issues all the GETs concurrently.  Footer hits are
+  // read directly.
+  struct Pieces {
+    size_t first;
+    size_t count;
+  };
+  std::vector<ReadRange> pieces;
+  std::vector<Pieces> range_pieces(ranges.size(), Pieces{0, 0});
+  out->assign(ranges.size(), nullptr);
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const ReadRange& range = ranges[i];
+    int64_t nbytes = range.length;
+    RETURN_NOT_OK(impl_->CheckRead(range.offset, &nbytes));
+    if (nbytes == 0 || impl_->InFooter(range.offset, nbytes)) {
+      RETURN_NOT_OK(impl_->ReadAt(range.offset, nbytes, &(*out)[i]));
+      continue;
+    }
+    range_pieces[i].first = pieces.size();
+    for (int64_t offset = 0; offset < nbytes; offset += range_size) {
+      pieces.push_back({range.offset + offset, std::min(range_size, nbytes - offset)});
+    }
+    range_pieces[i].count = pieces.size() - range_pieces[i].first;
+  }
+  if (pieces.empty()) {
+    return Status::OK();
+  }
+
+  CoalesceOptions piece_options = options;
+  piece_options.range_size_limit = std::min(options.range_size_limit, range_size);
+  std::vector<std::shared_ptr<Buffer>> piece_buffers;
+  RETURN_NOT_OK(RandomAccessFile::ReadRanges(pieces, piece_options, &piece_buffers));
+
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const Pieces& range = range_pieces[i];
+    if (range.count == 1) {
+      (*out)[i] = piece_buffers[range.first];
+    } else if (range.count > 1) {
+      // Ranges larger than range_size are reassembled
+      int64_t nbytes = 0;
+      for (size_t j = range.first; j < range.first + range.count; ++j) {
+        nbytes += piece_buffers[j]->size();
+      }
+      std::shared_ptr<Buffer> buffer;
+      RETURN_NOT_OK(AllocateBuffer(nbytes, &buffer));
+      uint8_t* dest = buffer->mutable_data();
+      for (size_t j = range.first; j < range.first + range.count; ++j) {
+        std::memcpy(dest, piece_buffers[j]->data(),
+                    static_cast<size_t>(piece_buffers[j]->size()));
+        dest += piece_buffers[j]->size();
+      }
+      (*out)[i] = buffer;
+    }
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// ObjectStoreOutputStream implementation
+
+class ObjectStoreOutputStream::Impl {
+ public:
+  Impl(const std::shared_ptr<ObjectStoreClient>& client, const std::string& key,
+       const ObjectStoreOptions& options, MemoryPool* pool)
+      : client_(client),
+        key_(key),
+        options_(options),
+        pool_(pool),
+        part_used_(0),
+        position_(0),
+        num_parts_(0),
+        max_pending_parts_(MaxPendingParts()),
+        closed_(false) {}
+
+  ~Impl() { DCHECK_OK(Close()); }
+
+  Status Init() { return AllocateResizableBuffer(pool_, options_.part_size, &part_); }
+
+  Status Close() {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (closed_) {
+      return Status::OK();
+    }
+    closed_ = true;
+    Status st = error_.ok() ? Finish() : error_;
+    if (!st.ok() && !upload_id_.empty()) {
+      // Wait for the uploads in flight before discarding their parts
+      for (auto& part : pending_parts_) {
+        part.Wait();
+      }
+      pending_parts_.clear();
+      ARROW_UNUSED(client_->AbortMultipartUpload(key_, upload_id_));
+    }
+    part_.reset();
+    return st;
+  }
+
+  bool closed() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return closed_;
+  }
+
+  Status Tell(int64_t* position) const {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (closed_) {
+      return Status::Invalid("Operation on closed stream");
+    }
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status Write(const void* data, int64_t nbytes) {
+    std::lock_guard<std::mutex> guard(lock_);
+    if (closed_) {
+      return Status::Invalid("Operation on closed stream");
+    }
+    RETURN_NOT_OK(error_);
+    auto src = reinterpret_cast<const uint8_t*>(data);
+    int64_t remaining = nbytes;
+    while (remaining > 0) {
+      const int64_t chunk = std::min(remaining, options_.part_size - part_used_);
+      std::memcpy(part_->mutable_data() + part_used_, src, static_cast<size_t>(chunk));
+      part_used_ += chunk;
+      src += chunk;
+      remaining -= chunk;
+      if (part_used_ == options_.part_size) {
+        // A failed upload can't be resumed, Close() will abort it
+        error_ = SubmitPart();
+        RETURN_NOT_OK(error_);
+      }
+    }
+    position_ += nbytes;
+    return Status::OK();
+  }
+
+ private:
+  // Hand the current part to its upload and start a new one
+  Status SubmitPart() {
+    if (upload_id_.empty()) {
+      RETURN_NOT_OK(client_->CreateMultipartUpload(key_, &upload_id_));
+    }
+    RETURN_NOT_OK(part_->Resize(part_used_, false /* shrink_to_fit */));
+    std::shared_ptr<Buffer> part = part_;
+    const int part_number = ++num_parts_;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, options_.part_size, &part_));
+    part_used_ = 0;
+
+    std::shared_ptr<ObjectStoreClient> client = client_;
+    const std::string key = key_;
+    const std::string upload_id = upload_id_;
+    auto task = [client, key, upload_id, part_number, part](std::string* etag) {
+      return client->UploadPart(key, upload_id, part_number, part, etag);
+    };
+    if (!options_.use_threads) {
+      std::string etag;
+      RETURN_NOT_OK(task(&etag));
+      etags_.push_back(std::move(etag));
+      return Status::OK();
+    }
+    pending_parts_.push_back(internal::GetIOThreadPool()->SubmitAsync<std::string>(task));
+    // Bound the memory held by the parts in flight
+    while (static_cast<int>(pending_parts_.size()) > max_pending_parts_) {
+      RETURN_NOT_OK(WaitNextPart());
+    }
+    return Status::OK();
+  }
+
+  Status WaitNextPart() {
+    auto part = pending_parts_.front();
+    pending_parts_.pop_front();
+    std::string etag;
+    RETURN_NOT_OK(part.Get(&etag));
+    etags_.push_back(std::move(etag));
+    return Status::OK();
+  }
+
+  Status Finish() {
+    if (upload_id_.empty()) {
+      // Small enough for a single request
+      RETURN_NOT_OK(part_->Resize(part_used_, false /* shrink_to_fit */));
+      return client_->PutObject(key_, part_);
+    }
+    if (part_used_ > 0) {
+      RETURN_NOT_OK(SubmitPart());
+    }
+    while (!pending_parts_.empty()) {
+      RETURN_NOT_OK(WaitNextPart());
+    }
+    return client_->CompleteMultipartUpload(key_, upload_id_, etags_);
+  }
+
+  std::shared_ptr<ObjectStoreClient> client_;
+  const std::string key_;
+  const ObjectStoreOptions options_;
+  MemoryPool* pool_;
+
+  std::shared_ptr<ResizableBuffer> part_;
+  int64_t part_used_;
+  int64_t position_;
+
+  std::string upload_id_;
+  int num_parts_;
+  int max_pending_parts_;
+  std::deque<Future<std::string>> pending_parts_;
+  std::vector<std::string> etags_;
+  Status error_;
+
+  bool closed_;
+  mutable std::mutex lock_;
+};
+
+ObjectStoreOutputStream::ObjectStoreOutputStream() {}
+
+ObjectStoreOutputStream::~ObjectStoreOutputStream() {}
+
+Status ObjectStoreOutputStream::Close() { return impl_->Close(); }
+
+bool ObjectStoreOutputStream::closed() const { return impl_->closed(); }
+
+Status ObjectStoreOutputStream::Tell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status ObjectStoreOutputStream::Write(const void* data, int64_t nbytes) {
+  return impl_->Write(data, nbytes);
+}
+
+// ----------------------------------------------------------------------
+// ObjectStoreFileSystem implementation
+
+class ObjectStoreFileSystem::Impl {
+ public:
+  Impl(const std::shared_ptr<ObjectStoreClient>& client,
+       const ObjectStoreOptions& options, MemoryPool* pool)
+      : client_(client), options_(options), pool_(pool) {}
+
+  Status MakeDirectory(const std::string& path) {
+    const std::string key = PathToKey(path);
+    if (key.empty()) {
+      return Status::OK();
+    }
+    std::shared_ptr<Buffer> empty;
+    RETURN_NOT_OK(AllocateBuffer(pool_, 0, &empty));
+    return client_->PutObject(DirectoryPrefix(key), empty);
+  }
+
+  Status DeleteDirectory(const std::string& path) {
+    const std::string key = PathToKey(path);
+    if (key.empty()) {
+      return Status::Invalid("Cannot delete the root directory");
+    }
+    std::vector<std::string> keys;
+    RETURN_NOT_OK(client_->ListObjects(DirectoryPrefix(key), &keys));
+    if (keys.empty()) {
+      return PathNotFound(path);
+    }
+    for (const auto& object : keys) {
+      RETURN_NOT_OK(client_->DeleteObject(object));
+    }
+    return Status::OK();
+  }
+
+  Status DeleteFile(const std::string& path) {
+    int64_t size;
+    const std::string key = PathToKey(path);
+    RETURN_NOT_OK(HeadFile(path, key, &size));
+    return client_->DeleteObject(key);
+  }
+
+  Status GetChildren(const std::string& path, std::vector<std::string>* listing) {
+    const std::string prefix = DirectoryPrefix(PathToKey(path));
+    std::vector<std::string> keys;
+    RETURN_NOT_OK(client_->ListObjects(prefix, &keys));
+    std::set<std::string> children;
+    for (const auto& key : keys) {
+      const std::string rest = key.substr(prefix.size());
+      if (!rest.empty()) {
+        // A directory marker has an empty rest
+        children.insert(prefix + rest.substr(0, rest.find('/')));
+      }
+    }
+    listing->assign(children.begin(), children.end());
+    return Status::OK();
+  }
+
+  Status Rename(const std::string& src, const std::string& dst) {
+    const std::string src_key = PathToKey(src);
+    const std::string dst_key = PathToKey(dst);
+    if (src_key.empty() || dst_key.empty()) {
+      return Status::Invalid("Cannot rename the root directory");
+    }
+    int64_t size;
+    Status st = client_->HeadObject(src_key, &size);
+    if (st.ok()) {
+      RETURN_NOT_OK(client_->CopyObject(src_key, dst_key));
+      return client_->DeleteObject(src_key);
+    } else if (!st.IsKeyError()) {
+      return st;
+    }
+    const std::string src_prefix = DirectoryPrefix(src_key);
+    const std::string dst_prefix = DirectoryPrefix(dst_key);
+    std::vector<std::string> keys;
+    RETURN_NOT_OK(client_->ListObjects(src_prefix, &keys));
+    if (keys.empty()) {
+      return PathNotFound(src);
+    }
+    for (const auto& key : keys) {
+      RETURN_NOT_OK(client_->CopyObject(key, dst_prefix + key.substr(src_prefix.size())));
+      RETURN_NOT_OK(client_->DeleteObject(key));
+    }
+    return Status::OK();
+  }
+
+  Status Stat(const std::string& path, FileStatistics* stat) {
+    const std::string key = PathToKey(path);
+    if (!key.empty()) {
+      Status st = client_->HeadObject(key, &stat->size);
+      if (st.ok()) {
+        stat->kind = ObjectType::FILE;
+        return Status::OK();
+      } else if (!st.IsKeyError()) {
+        return st;
+      }
+      std::vector<std::string> keys;
+      RETURN_NOT_OK(client_->ListObjects(DirectoryPrefix(key), &keys));
+      if (keys.empty()) {
+        return PathNotFound(path);
+      }
+    }
+    stat->size = 0;
+    stat->kind = ObjectType::DIRECTORY;
+    return Status::OK();
+  }
+
+  Status OpenReadable(const std::string& path, std::string* key, int64_t* size) {
+    *key = PathToKey(path);
+    return HeadFile(path, *key, size);
+  }
+
+  const std::shared_ptr<ObjectStoreClient>& client() const { return client_; }
+  const ObjectStoreOptions& options() const { return options_; }
+  MemoryPool* pool() const { return pool_; }
+
+ private:
+  Status HeadFile(const std::string& path, const std::string& key, int64_t* size) {
+    if (key.empty()) {
+      return Status::IOError("Not a file: '", path, "'");
+    }
+    Status st = client_->HeadObject(key, size);
+    if (st.IsKeyError()) {
+      return PathNotFound(path);
+    }
+    return st;
+  }
+
+  std::shared_ptr<ObjectStoreClient> client_;
+  const ObjectStoreOptions options_;
+  MemoryPool* pool_;
+};
+
+ObjectStoreFileSystem::ObjectStoreFileSystem() {}
+
+ObjectStoreFileSystem::~ObjectStoreFileSystem() {}
+
+Status ObjectStoreFileSystem::Make(const std::shared_ptr<ObjectStoreClient>& client,
+                                   const ObjectStoreOptions& options, MemoryPool* pool,
+                                   std::shared_ptr<ObjectStoreFileSystem>* fs) {
+  if (options.range_size <= 0) {
+    return Status::Invalid("Range size should be positive, got ", options.range_size);
+  }
+  if (options.part_size <= 0) {
+    return Status::Invalid("Part size should be positive, got ", options.part_size);
+  }
+  if (options.footer_cache_size < 0) {
+    return Status::Invalid("Footer cache size should be non-negative, got ",
+                           options.footer_cache_size);
+  }
+  std::shared_ptr<ObjectStoreFileSystem> result(new ObjectStoreFileSystem());
+  result->impl_.reset(new Impl(client, options, pool));
+  *fs = std::move(result);
+  return Status::OK();
+}
+
+Status ObjectStoreFileSystem::Make(const std::shared_ptr<ObjectStoreClient>& client,
+                                   const ObjectStoreOptions& options,
+                                   std::shared_ptr<ObjectStoreFileSystem>* fs) {
+  return Make(client, options, default_memory_pool(), fs);
+}
+
+Status ObjectStoreFileSystem::MakeDirectory(const std::string& path) {
+  return impl_->MakeDirectory(path);
+}
+
+Status ObjectStoreFileSystem::DeleteDirectory(const std::string& path) {
+  return impl_->DeleteDirectory(path);
+}
+
+Status ObjectStoreFileSystem::DeleteFile(const std::string& path) {
+  return impl_->DeleteFile(path);
+}
+
+Status ObjectStoreFileSystem::GetChildren(const std::string& path,
+                                          std::vector<std::string>* listing) {
+  return impl_->GetChildren(path, listing);
+}
+
+Status ObjectStoreFileSystem::Rename(const std::string& src, const std::string& dst) {
+  return impl_->Rename(src, dst);
+}
+
+Status ObjectStoreFileSystem::Stat(const std::string& path, FileStatistics* stat) {
+  return impl_->Stat(path, stat);
+}
+
+Status ObjectStoreFileSystem::OpenReadable(
+    const std::string& path, std::shared_ptr<ObjectStoreReadableFile>* file) {
+  std::string key;
+  int64_t size;
+  RETURN_NOT_OK(impl_->OpenReadable(path, &key, &size));
+  std::shared_ptr<ObjectStoreReadableFile> result(new ObjectStoreReadableFile());
+  result->impl_.reset(new ObjectStoreReadableFile::Impl(impl_->client(), key, size,
+                                                        impl_->options(), impl_->pool()));
+  *file = std::move(result);
+  return Status::OK();
+}
+
+Status ObjectStoreFileSystem::OpenWritable(
+    const std::string& path, std::shared_ptr<ObjectStoreOutputStream>* stream) {
+  const std::string key = PathToKey(path);
+  if (key.empty()) {
+    return Status::Invalid("Cannot write to the root directory");
+  }
+  std::shared_ptr<ObjectStoreOutputStream> result(new ObjectStoreOutputStream());
+  result->impl_.reset(new ObjectStoreOutputStream::Impl(impl_->client(), key,
+                                                        impl_->options(), impl_->pool()));
+  RETURN_NOT_OK(result->impl_->Init());
+  *stream = std::move(result);
+  return Status::OK();
+}
+
+}  // namespace io
+}  // namespace arrow
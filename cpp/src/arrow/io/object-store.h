@@ -0,0 +1,254 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// File system over an S3-like object store
+
+#ifndef ARROW_IO_OBJECT_STORE_H
+#define ARROW_IO_OBJECT_STORE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class MemoryPool;
+class Status;
+
+namespace io {
+
+/// \brief The requests of an S3-like object store
+///
+/// Implementations wrap the actual transport (e.g. an S3 SDK or an HTTP
+/// client) and must be thread-safe: the file system issues concurrent
+/// requests from the global I/O thread pool.  Keys are relative to the
+/// bucket and never start with a slash.  Requests on a missing object
+/// return KeyError.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class ARROW_EXPORT ObjectStoreClient {
+ public:
+  virtual ~ObjectStoreClient() = default;
+
+  /// \brief Get the size of an object
+  virtual Status HeadObject(const std::string& key, int64_t* size) = 0;
+
+  /// \brief Read a range of an object (a ranged GET)
+  ///
+  /// Fewer bytes than requested are read at the end of the object.
+  virtual Status GetRange(const std::string& key, int64_t offset, int64_t length,
+                          int64_t* bytes_read, void* out) = 0;
+
+  /// \brief Create or replace an object in a single request
+  virtual Status PutObject(const std::string& key,
+                           const std::shared_ptr<Buffer>& data) = 0;
+
+  virtual Status DeleteObject(const std::string& key) = 0;
+
+  virtual Status CopyObject(const std::string& src, const std::string& dst) = 0;
+
+  /// \brief List the keys starting with the given prefix, at any depth
+  virtual Status ListObjects(const std::string& prefix,
+                             std::vector<std::string>* keys) = 0;
+
+  /// \brief Start a multipart upload, whose parts may be uploaded concurrently
+  virtual Status CreateMultipartUpload(const std::string& key,
+                                       std::string* upload_id) = 0;
+
+  /// \brief Upload a part, numbered from 1
+  /// \param[out] etag an identifier to give to CompleteMultipartUpload
+  virtual Status UploadPart(const std::string& key, const std::string& upload_id,
+                            int part_number, const std::shared_ptr<Buffer>& data,
+                            std::string* etag) = 0;
+
+  /// \brief Assemble the parts into an object
+  /// \param[in] etags the identifiers of the parts, in order
+  virtual Status CompleteMultipartUpload(const std::string& key,
+                                         const std::string& upload_id,
+                                         const std::vector<std::string>& etags) = 0;
+
+  /// \brief Discard an upload and its parts
+  virtual Status AbortMultipartUpload(const std::string& key,
+                                      const std::string& upload_id) = 0;
+};
+
+/// \brief Options for ObjectStoreFileSystem
+struct ARROW_EXPORT ObjectStoreOptions {
+  static ObjectStoreOptions Defaults();
+
+  /// Reads larger than this are split into ranged GETs of this size, issued
+  /// concurrently on the I/O thread pool.  A single GET stream is limited
+  /// in throughput, while object stores scale with the number of requests.
+  int64_t range_size;
+  /// The number of bytes at the end of a file fetched in one GET, and kept,
+  /// the first time a read falls within them.  File formats such as Parquet
+  /// read their footer in several small reads at the end of the file.
+  /// 0 disables the cache.
+  int64_t footer_cache_size;
+  /// The size of the parts of multipart uploads.  S3 requires at least
+  /// 5 MiB for all parts but the last.  Files smaller than this are
+  /// uploaded in a single request.
+  int64_t part_size;
+  /// Whether to issue the ranged GETs and part uploads concurrently
+  bool use_threads;
+};
+
+class ObjectStoreReadableFile;
+class ObjectStoreOutputStream;
+
+/// \brief A file system over an object store
+///
+/// Paths map directly to the keys of the store, with leading and trailing
+/// slashes ignored.  As in most object store clients, directories are
+/// implicit: a path is a directory when keys exist below it.
+/// MakeDirectory() creates an empty marker object with a trailing slash, so
+/// that the directory exists before files are written to it.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class ARROW_EXPORT ObjectStoreFileSystem : public FileSystem {
+ public:
+  ~ObjectStoreFileSystem() override;
+
+  /// \brief Create a file system
+  /// \param[in] client the object store client
+  /// \param[in] options reading and writing options
+  /// \param[in] pool a MemoryPool for the read and write buffers
+  /// \param[out] fs ObjectStoreFileSystem instance
+  static Status Make(const std::shared_ptr<ObjectStoreClient>& client,
+                     const ObjectStoreOptions& options, MemoryPool* pool,
+                     std::shared_ptr<ObjectStoreFileSystem>* fs);
+
+  /// \brief Create a file system with the default memory pool
+  static Status Make(const std::shared_ptr<ObjectStoreClient>& client,
+                     const ObjectStoreOptions& options,
+                     std::shared_ptr<ObjectStoreFileSystem>* fs);
+
+  Status MakeDirectory(const std::string& path) override;
+
+  /// \brief Delete all objects below the path
+  Status DeleteDirectory(const std::string& path) override;
+
+  /// \brief Delete a single file
+  Status DeleteFile(const std::string& path);
+
+  /// \brief List the files and directories immediately below the path
+  Status GetChildren(const std::string& path,
+                     std::vector<std::string>* listing) override;
+
+  /// \brief Rename a file or directory
+  ///
+  /// Object stores have no rename: each object is copied then deleted.
+  /// This is neither atomic nor cheap for large directories.
+  Status Rename(const std::string& src, const std::string& dst) override;
+
+  Status Stat(const std::string& path, FileStatistics* stat) override;
+
+  /// \brief Open a file for reading
+  Status OpenReadable(const std::string& path,
+                      std::shared_ptr<ObjectStoreReadableFile>* file);
+
+  /// \brief Open a file for writing, replacing any existing file
+  ///
+  /// The file only becomes visible when the stream is closed.
+  Status OpenWritable(const std::string& path,
+                      std::shared_ptr<ObjectStoreOutputStream>* stream);
+
+ private:
+  ObjectStoreFileSystem();
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief A file of an object store, read with ranged GETs
+///
+/// See ObjectStoreOptions for how reads are split and cached.  All methods
+/// are thread-safe.
+class ARROW_EXPORT ObjectStoreReadableFile : public RandomAccessFile {
+ public:
+  ~ObjectStoreReadableFile() override;
+
+  Status Close() override;
+  bool closed() const override;
+
+  Status Tell(int64_t* position) const override;
+  Status Seek(int64_t position) override;
+  Status GetSize(int64_t* size) override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief Read several ranges of the file
+  ///
+  /// Ranges within the footer cache are served from it.  The other ranges
+  /// are coalesced, up to the range size of the file system, and all the
+  /// resulting GETs are issued at once.
+  Status ReadRanges(const std::vector<ReadRange>& ranges, const CoalesceOptions& options,
+                    std::vector<std::shared_ptr<Buffer>>* out) override;
+
+  using RandomAccessFile::ReadRanges;
+
+ private:
+  friend class ObjectStoreFileSystem;
+  ObjectStoreReadableFile();
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief A file of an object store, written with a multipart upload
+///
+/// Data is buffered into parts of the configured size, which are uploaded
+/// as they fill up, concurrently if requested.  Close() uploads the last
+/// part and completes the upload, or aborts it on error.  Flush() does
+/// nothing, since parts must have a minimum size.
+class ARROW_EXPORT ObjectStoreOutputStream : public OutputStream {
+ public:
+  ~ObjectStoreOutputStream() override;
+
+  Status Close() override;
+  bool closed() const override;
+
+  Status Tell(int64_t* position) const override;
+
+  Status Write(const void* data, int64_t nbytes) override;
+
+  using Writable::Write;
+
+ private:
+  friend class ObjectStoreFileSystem;
+  ObjectStoreOutputStream();
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
+
+#endif  // ARROW_IO_OBJECT_STORE_H
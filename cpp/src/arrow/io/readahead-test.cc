@@ -39,6 +39,8 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 
@@ -284,6 +286,156 @@ TEST(ReadaheadSpooler, StressReads) {
   ASSERT_EQ(pos, NBYTES);
 }
 
+TEST(ReadaheadSpooler, SharedIOThreadPool) {
+  // Several spoolers share a single I/O thread, including when read from
+  // an I/O task
+  const int capacity = GetIOThreadPoolCapacity();
+  ASSERT_OK(SetIOThreadPoolCapacity(1));
+
+  std::vector<std::shared_ptr<ReadaheadSpooler>> spoolers;
+  for (int i = 0; i < 3; ++i) {
+    spoolers.push_back(std::make_shared<ReadaheadSpooler>(DataReader("0123456789"), 4));
+  }
+  ReadaheadBuffer buf;
+  for (const auto& spooler : spoolers) {
+    ASSERT_OK(spooler->Read(&buf));
+    AssertReadaheadBuffer(buf, {0}, {0}, "0123");
+  }
+  auto fut = ::arrow::internal::GetIOThreadPool()->Submit([&]() {
+    std::string data;
+    for (const auto& spooler : spoolers) {
+      ReadaheadBuffer buf;
+      while (true) {
+        ARROW_CHECK_OK(spooler->Read(&buf));
+        if (buf.buffer == nullptr) {
+          break;
+        }
+        data += buf.buffer->ToString();
+      }
+    }
+    return data;
+  });
+  ASSERT_EQ(fut.get(), "456789456789456789");
+
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity));
+}
+
+// A stream taking some time to serve each read
+class SlowInputStream : public LockedInputStream {
+ public:
+  SlowInputStream(const std::shared_ptr<InputStream>& stream, double latency)
+      : LockedInputStream(stream), latency_(latency) {}
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* buffer) override {
+    sleep_for(latency_);
+    return LockedInputStream::Read(nbytes, bytes_read, buffer);
+  }
+
+ protected:
+  double latency_;
+};
+
+// Read the whole spooler, checking the data and the budget after each read
+static void ReadAll(ReadaheadSpooler* spooler, const Buffer& expected,
+                    double consumer_latency = 0,
+                    const std::shared_ptr<ReadaheadBudget>& budget = NULLPTR,
+                    int64_t max_reserved = 0) {
+  int64_t pos = 0;
+  while (true) {
+    ReadaheadBuffer buf;
+    ASSERT_OK(spooler->Read(&buf));
+    if (buf.buffer == nullptr) {
+      break;
+    }
+    const int64_t size = buf.buffer->size() - buf.left_padding - buf.right_padding;
+    ASSERT_LE(pos + size, expected.size());
+    AssertReadaheadBuffer(buf, {buf.left_padding}, {buf.right_padding},
+                          Buffer(expected.data() + pos, size));
+    pos += size;
+    if (budget) {
+      ASSERT_LE(budget->reserved(), max_reserved);
+    }
+    sleep_for(consumer_latency);
+  }
+  ASSERT_EQ(pos, expected.size());
+}
+
+TEST(ReadaheadSpooler, AdaptiveGrowsOnSlowStream) {
+  std::shared_ptr<ResizableBuffer> data;
+  ASSERT_OK(MakeRandomByteBuffer(1 << 16, default_memory_pool(), &data));
+  auto stream =
+      std::make_shared<SlowInputStream>(std::make_shared<BufferReader>(data), 0.001);
+
+  AdaptiveReadaheadOptions options = AdaptiveReadaheadOptions::Defaults();
+  options.min_read_size = 16;
+  options.max_read_size = 1 << 12;
+  options.max_queue_size = 4;
+  ReadaheadSpooler spooler(default_memory_pool(), stream, options, 3, 5);
+  ASSERT_EQ(16, spooler.GetReadSize());
+  ASSERT_EQ(1, spooler.GetQueueSize());
+
+  // The consumer is much faster than the stream: larger reads amortize
+  // the stream's latency
+  ASSERT_NO_FATAL_FAILURE(ReadAll(&spooler, *data));
+  ASSERT_GT(spooler.GetReadSize(), 16);
+  ASSERT_LE(spooler.GetReadSize(), 1 << 12);
+  ASSERT_LE(spooler.GetQueueSize(), 4);
+}
+
+TEST(ReadaheadSpooler, AdaptiveStaysSmallOnSlowConsumer) {
+  std::shared_ptr<ResizableBuffer> data;
+  ASSERT_OK(MakeRandomByteBuffer(2000, default_memory_pool(), &data));
+  auto stream = std::make_shared<BufferReader>(data);
+
+  AdaptiveReadaheadOptions options = AdaptiveReadaheadOptions::Defaults();
+  options.min_read_size = 50;
+  options.max_read_size = 1000;
+  options.max_queue_size = 8;
+  ReadaheadSpooler spooler(default_memory_pool(), stream, options);
+
+  // The stream keeps up with the consumer: no need for more readahead
+  ASSERT_NO_FATAL_FAILURE(ReadAll(&spooler, *data, 0.001));
+  ASSERT_EQ(50, spooler.GetReadSize());
+  ASSERT_EQ(1, spooler.GetQueueSize());
+}
+
+TEST(ReadaheadSpooler, SharedBudget) {
+  const int64_t read_size = 100;
+  auto budget = std::make_shared<ReadaheadBudget>(3 * read_size);
+
+  AdaptiveReadaheadOptions options = AdaptiveReadaheadOptions::Defaults();
+  options.min_read_size = options.max_read_size = read_size;
+  options.min_queue_size = options.max_queue_size = 8;
+  options.budget = budget;
+
+  std::vector<std::shared_ptr<ResizableBuffer>> data(2);
+  std::vector<std::unique_ptr<ReadaheadSpooler>> spoolers;
+  for (auto& buffer : data) {
+    ASSERT_OK(MakeRandomByteBuffer(5000, default_memory_pool(), &buffer));
+    spoolers.emplace_back(new ReadaheadSpooler(
+        default_memory_pool(), std::make_shared<BufferReader>(buffer), options));
+  }
+  // Readahead stops once the budget is exhausted
+  busy_wait(0.2, [&]() { return budget->reserved() >= budget->capacity(); });
+  sleep_for(0.01);
+  ASSERT_GE(budget->reserved(), budget->capacity());
+  ASSERT_LE(budget->reserved(), budget->capacity() + read_size);
+
+  // Each spooler may exceed the budget by one read when its queue is empty
+  auto consume = [&](int i) {
+    ReadAll(spoolers[i].get(), *data[i], 0.0001, budget,
+            budget->capacity() + 2 * read_size);
+  };
+  std::thread other(consume, 1);
+  ASSERT_NO_FATAL_FAILURE(consume(0));
+  other.join();
+
+  for (const auto& spooler : spoolers) {
+    ASSERT_OK(spooler->Close());
+  }
+  ASSERT_EQ(0, budget->reserved());
+}
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
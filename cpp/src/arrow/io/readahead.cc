@@ -17,69 +17,142 @@
 
 #include "arrow/io/readahead.h"
 
+#include <algorithm>
+#include <chrono>
 #include <condition_variable>
 #include <cstring>
 #include <deque>
 #include <memory>
 #include <mutex>
-#include <thread>
 #include <utility>
 
 #include "arrow/buffer.h"
+#include "arrow/buffer_pool.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 namespace io {
 namespace internal {
 
+// ----------------------------------------------------------------------
+// ReadaheadBudget implementation
+
+ReadaheadBudget::ReadaheadBudget(int64_t capacity) : capacity_(capacity), reserved_(0) {}
+
+bool ReadaheadBudget::TryReserve(int64_t nbytes) {
+  int64_t reserved = reserved_.load();
+  do {
+    if (reserved + nbytes > capacity_) {
+      return false;
+    }
+  } while (!reserved_.compare_exchange_weak(reserved, reserved + nbytes));
+  return true;
+}
+
+void ReadaheadBudget::Reserve(int64_t nbytes) { reserved_ += nbytes; }
+
+void ReadaheadBudget::Release(int64_t nbytes) { reserved_ -= nbytes; }
+
+AdaptiveReadaheadOptions AdaptiveReadaheadOptions::Defaults() {
+  AdaptiveReadaheadOptions options;
+  options.min_read_size = 1 << 16;
+  options.max_read_size = 1 << 24;
+  options.min_queue_size = 1;
+  options.max_queue_size = 16;
+  return options;
+}
+
 // ----------------------------------------------------------------------
 // ReadaheadSpooler implementation
 
+namespace {
+
+AdaptiveReadaheadOptions FixedOptions(int64_t read_size, int32_t readahead_queue_size) {
+  AdaptiveReadaheadOptions options;
+  options.min_read_size = options.max_read_size = read_size;
+  options.min_queue_size = options.max_queue_size = readahead_queue_size;
+  return options;
+}
+
+// The weight of new samples in the rate estimates
+constexpr double kRateSmoothing = 0.25;
+// The readahead is trimmed after finding the queue full this many times in a row
+constexpr int32_t kTrimAfterFullReads = 8;
+
+void UpdateEstimate(double sample, double* estimate) {
+  *estimate = *estimate == 0 ? sample : *estimate + kRateSmoothing * (sample - *estimate);
+}
+
+}  // namespace
+
 class ReadaheadSpooler::Impl {
  public:
-  Impl(MemoryPool* pool, std::shared_ptr<InputStream> raw, int64_t read_size,
-       int32_t readahead_queue_size, int64_t left_padding, int64_t right_padding)
-      : pool_(pool),
-        raw_(raw),
-        read_size_(read_size),
-        readahead_queue_size_(readahead_queue_size),
+  using Clock = std::chrono::steady_clock;
+
+  Impl(MemoryPool* pool, std::shared_ptr<InputStream> raw,
+       const AdaptiveReadaheadOptions& options, int64_t left_padding,
+       int64_t right_padding)
+      : raw_(raw),
+        options_(options),
+        read_size_(options.min_read_size),
+        readahead_queue_size_(options.min_queue_size),
         left_padding_(left_padding),
-        right_padding_(right_padding) {
+        right_padding_(right_padding),
+        // Enough idle buffers to refill the queue once the consumer
+        // released the previous ones
+        buffer_pool_(options.min_read_size + left_padding + right_padding,
+                     options.max_queue_size + 2, pool),
+        io_pool_(::arrow::internal::GetIOThreadPool()) {
     DCHECK_NE(raw, nullptr);
-    DCHECK_GT(read_size, 0);
-    DCHECK_GT(readahead_queue_size, 0);
-    io_worker_ = std::thread([&]() { WorkerLoop(); });
+    DCHECK_GT(options.min_read_size, 0);
+    DCHECK_GE(options.max_read_size, options.min_read_size);
+    DCHECK_GT(options.min_queue_size, 0);
+    DCHECK_GE(options.max_queue_size, options.min_queue_size);
+    std::lock_guard<std::mutex> lock(mutex_);
+    ScheduleReadsUnlocked();
   }
 
+  Impl(MemoryPool* pool, std::shared_ptr<InputStream> raw, int64_t read_size,
+       int32_t readahead_queue_size, int64_t left_padding, int64_t right_padding)
+      : Impl(pool, std::move(raw), FixedOptions(read_size, readahead_queue_size),
+             left_padding, right_padding) {}
+
   ~Impl() { ARROW_UNUSED(Close()); }
 
   Status Close() {
     std::unique_lock<std::mutex> lock(mutex_);
     please_close_ = true;
-    io_wakeup_.notify_one();
-    // Wait for IO thread to finish
-    if (io_worker_.joinable()) {
-      lock.unlock();
-      io_worker_.join();
-      lock.lock();
+    // Wait for the pending I/O task to finish
+    io_progress_.wait(lock, [this]() { return !read_in_flight_; });
+    eof_ = true;
+    // Queued buffers may still be read, but don't hold the budget anymore
+    for (auto& queued : buffer_queue_) {
+      ReleaseUnlocked(queued.reserved);
+      queued.reserved = 0;
     }
     return raw_->Close();
   }
 
   Status Read(ReadaheadBuffer* out) {
     std::unique_lock<std::mutex> lock(mutex_);
+    ObserveConsumerUnlocked();
+    bool starved = false;
     while (true) {
       // Drain queue before querying other flags
       if (buffer_queue_.size() > 0) {
-        *out = std::move(buffer_queue_.front());
+        AdaptUnlocked(starved);
+        *out = PopBufferUnlocked();
         DCHECK_NE(out->buffer, nullptr);
-        buffer_queue_.pop_front();
+        last_returned_bytes_ =
+            out->buffer->size() - out->left_padding - out->right_padding;
+        last_return_time_ = Clock::now();
         // Need to fill up queue again
-        io_wakeup_.notify_one();
+        ScheduleReadsUnlocked();
         return Status::OK();
       }
       if (!read_status_.ok()) {
@@ -91,7 +164,19 @@ class ReadaheadSpooler::Impl {
         return Status::OK();
       }
       // Readahead queue is empty and we're not closed yet, wait for more I/O
-      io_progress_.wait(lock);
+      starved = true;
+      if (io_pool_->OwnsThisThread()) {
+        // Called from an I/O task: our own read task may be queued behind
+        // us, so run pending tasks rather than block the worker.
+        lock.unlock();
+        const bool ran_task = io_pool_->RunPendingTask();
+        lock.lock();
+        if (!ran_task) {
+          io_progress_.wait_for(lock, std::chrono::milliseconds(1));
+        }
+      } else {
+        io_progress_.wait(lock);
+      }
     }
   }
 
@@ -115,57 +200,161 @@ class ReadaheadSpooler::Impl {
     right_padding_ = size;
   }
 
- protected:
-  // The background thread's main function
-  void WorkerLoop() {
+  int64_t read_size() {
     std::unique_lock<std::mutex> lock(mutex_);
-    Status st;
+    return read_size_;
+  }
 
-    while (true) {
+  int32_t queue_size() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return readahead_queue_size_;
+  }
+
+ protected:
+  // A buffer in the readahead queue, with its reservation in the budget
+  struct QueuedBuffer {
+    ReadaheadBuffer buffer;
+    int64_t reserved;
+  };
+
+  ReadaheadBuffer PopBufferUnlocked() {
+    QueuedBuffer queued = std::move(buffer_queue_.front());
+    buffer_queue_.pop_front();
+    if (options_.budget) {
+      options_.budget->Release(queued.reserved);
+    }
+    return std::move(queued.buffer);
+  }
+
+  // Measure how fast the consumer processed the previous buffer
+  void ObserveConsumerUnlocked() {
+    if (last_returned_bytes_ <= 0) {
+      return;
+    }
+    const double seconds =
+        std::chrono::duration<double>(Clock::now() - last_return_time_).count();
+    UpdateEstimate(static_cast<double>(last_returned_bytes_) / std::max(seconds, 1e-9),
+                   &consumer_rate_);
+  }
+
+  // Adjust the read size and queue size before handing out a buffer
+  void AdaptUnlocked(bool starved) {
+    if (starved && consumer_rate_ > 0 && stream_rate_ > 0) {
+      full_reads_ = 0;
+      if (consumer_rate_ > stream_rate_ && read_size_ < options_.max_read_size) {
+        read_size_ = std::min(read_size_ * 2, options_.max_read_size);
+      } else if (readahead_queue_size_ < options_.max_queue_size) {
+        readahead_queue_size_ =
+            std::min(readahead_queue_size_ * 2, options_.max_queue_size);
+      } else {
+        read_size_ = std::min(read_size_ * 2, options_.max_read_size);
+      }
+    } else if (buffer_queue_.size() >= static_cast<size_t>(readahead_queue_size_)) {
+      if (++full_reads_ < kTrimAfterFullReads) {
+        return;
+      }
+      full_reads_ = 0;
+      if (readahead_queue_size_ > options_.min_queue_size) {
+        --readahead_queue_size_;
+      } else {
+        read_size_ = std::max(read_size_ / 2, options_.min_read_size);
+      }
+    } else {
+      full_reads_ = 0;
+    }
+  }
+
+  // Spawn a task on the I/O thread pool to fill up the readahead queue,
+  // unless one is already running.  At most one read is in flight at any
+  // time, as the underlying stream must be read sequentially.
+  void ScheduleReadsUnlocked() {
+    if (read_in_flight_ || please_close_ || eof_ || !read_status_.ok() ||
+        buffer_queue_.size() >= static_cast<size_t>(readahead_queue_size_)) {
+      return;
+    }
+    read_in_flight_ = true;
+    Status st = io_pool_->Spawn([this]() { ReadTask(); });
+    if (!st.ok()) {
+      read_in_flight_ = false;
+      read_status_ = st;
+      io_progress_.notify_all();
+    }
+  }
+
+  // Reserve room for a read in the budget, if any.  Return false if the
+  // budget is exhausted and the queue has data for the consumer already.
+  bool ReserveUnlocked(int64_t nbytes) {
+    if (!options_.budget || options_.budget->TryReserve(nbytes)) {
+      return true;
+    }
+    if (!buffer_queue_.empty()) {
+      return false;
+    }
+    options_.budget->Reserve(nbytes);
+    return true;
+  }
+
+  void ReleaseUnlocked(int64_t nbytes) {
+    if (options_.budget) {
+      options_.budget->Release(nbytes);
+    }
+  }
+
+  // The I/O task's main function
+  void ReadTask() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // Fill up readahead queue until desired size
+    while (!please_close_ &&
+           buffer_queue_.size() < static_cast<size_t>(readahead_queue_size_)) {
+      const int64_t read_size = read_size_;
+      ReadaheadBuffer buf = {nullptr, left_padding_, right_padding_};
+      const int64_t reserved = read_size + buf.left_padding + buf.right_padding;
+      if (!ReserveUnlocked(reserved)) {
+        // Read() will reschedule once the consumer has taken a buffer
+        break;
+      }
+      lock.unlock();
+      const auto start = Clock::now();
+      Status st = ReadOneBufferUnlocked(read_size, &buf);
+      const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+      lock.lock();
+      if (!st.ok()) {
+        ReleaseUnlocked(reserved);
+        read_status_ = st;
+        break;
+      }
+      // Close() could have been called while unlocked above
       if (please_close_) {
-        goto eof;
+        ReleaseUnlocked(reserved);
+        break;
       }
-      // Fill up readahead queue until desired size
-      while (buffer_queue_.size() < static_cast<size_t>(readahead_queue_size_)) {
-        ReadaheadBuffer buf = {nullptr, left_padding_, right_padding_};
-        lock.unlock();
-        Status st = ReadOneBufferUnlocked(&buf);
-        lock.lock();
-        if (!st.ok()) {
-          read_status_ = st;
-          goto error;
-        }
-        // Close() could have been called while unlocked above
-        if (please_close_) {
-          goto eof;
-        }
-        // Got empty read?
-        if (buf.buffer->size() == buf.left_padding + buf.right_padding) {
-          goto eof;
-        }
-        buffer_queue_.push_back(std::move(buf));
-        io_progress_.notify_one();
+      // Got empty read?
+      if (buf.buffer->size() == buf.left_padding + buf.right_padding) {
+        ReleaseUnlocked(reserved);
+        eof_ = true;
+        break;
       }
-      // Wait for Close() or Read() call
-      io_wakeup_.wait(lock);
+      UpdateEstimate(static_cast<double>(read_size) / std::max(seconds, 1e-9),
+                     &stream_rate_);
+      buffer_queue_.push_back({std::move(buf), reserved});
+      io_progress_.notify_all();
     }
-  eof:
-    eof_ = true;
-  error:
-    // Make sure any pending Read() doesn't block indefinitely
-    io_progress_.notify_one();
+    read_in_flight_ = false;
+    // Wake up pending Read() and Close() calls.  This is done under the lock
+    // so that Close() cannot return (and this be destroyed) before.
+    io_progress_.notify_all();
   }
 
-  Status ReadOneBufferUnlocked(ReadaheadBuffer* buf) {
+  Status ReadOneBufferUnlocked(int64_t read_size, ReadaheadBuffer* buf) {
     // Note that left_padding_ and right_padding_ may be modified while unlocked
     std::shared_ptr<ResizableBuffer> buffer;
     int64_t bytes_read;
-    RETURN_NOT_OK(AllocateResizableBuffer(
-        pool_, read_size_ + buf->left_padding + buf->right_padding, &buffer));
+    RETURN_NOT_OK(buffer_pool_.GetBuffer(
+        read_size + buf->left_padding + buf->right_padding, &buffer));
     DCHECK_NE(buffer->mutable_data(), nullptr);
     RETURN_NOT_OK(
-        raw_->Read(read_size_, &bytes_read, buffer->mutable_data() + buf->left_padding));
-    if (bytes_read < read_size_) {
+        raw_->Read(read_size, &bytes_read, buffer->mutable_data() + buf->left_padding));
+    if (bytes_read < read_size) {
       // Got a short read
       RETURN_NOT_OK(buffer->Resize(bytes_read + buf->left_padding + buf->right_padding));
       DCHECK_NE(buffer->mutable_data(), nullptr);
@@ -178,21 +367,31 @@ class ReadaheadSpooler::Impl {
     return Status::OK();
   }
 
-  MemoryPool* pool_;
   std::shared_ptr<InputStream> raw_;
+  const AdaptiveReadaheadOptions options_;
   int64_t read_size_;
   int32_t readahead_queue_size_;
   int64_t left_padding_ = 0;
   int64_t right_padding_ = 0;
+  // Recycles the buffers released by the consumer
+  BufferPool buffer_pool_;
+
+  ::arrow::internal::ThreadPool* io_pool_;
 
   std::mutex mutex_;
-  std::condition_variable io_wakeup_;
   std::condition_variable io_progress_;
-  std::thread io_worker_;
+  bool read_in_flight_ = false;
   bool please_close_ = false;
   bool eof_ = false;
-  std::deque<ReadaheadBuffer> buffer_queue_;
+  std::deque<QueuedBuffer> buffer_queue_;
   Status read_status_;
+
+  // Rate estimates (in bytes per second) driving the adaptive readahead
+  double stream_rate_ = 0;
+  double consumer_rate_ = 0;
+  Clock::time_point last_return_time_;
+  int64_t last_returned_bytes_ = 0;
+  int32_t full_reads_ = 0;
 };
 
 ReadaheadSpooler::ReadaheadSpooler(MemoryPool* pool, std::shared_ptr<InputStream> raw,
@@ -207,6 +406,12 @@ ReadaheadSpooler::ReadaheadSpooler(std::shared_ptr<InputStream> raw, int64_t rea
     : ReadaheadSpooler(default_memory_pool(), raw, read_size, readahead_queue_size,
                        left_padding, right_padding) {}
 
+ReadaheadSpooler::ReadaheadSpooler(MemoryPool* pool, std::shared_ptr<InputStream> raw,
+                                   const AdaptiveReadaheadOptions& options,
+                                   int64_t left_padding, int64_t right_padding)
+    : impl_(new ReadaheadSpooler::Impl(pool, raw, options, left_padding,
+                                       right_padding)) {}
+
 int64_t ReadaheadSpooler::GetLeftPadding() { return impl_->left_padding(); }
 
 void ReadaheadSpooler::SetLeftPadding(int64_t size) { impl_->left_padding(size); }
@@ -219,6 +424,10 @@ Status ReadaheadSpooler::Close() { return impl_->Close(); }
 
 Status ReadaheadSpooler::Read(ReadaheadBuffer* out) { return impl_->Read(out); }
 
+int64_t ReadaheadSpooler::GetReadSize() { return impl_->read_size(); }
+
+int32_t ReadaheadSpooler::GetQueueSize() { return impl_->queue_size(); }
+
 ReadaheadSpooler::~ReadaheadSpooler() {}
 
 }  // namespace internal
@@ -18,6 +18,7 @@
 #ifndef ARROW_IO_READAHEAD_H
 #define ARROW_IO_READAHEAD_H
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 
@@ -41,12 +42,55 @@ struct ARROW_EXPORT ReadaheadBuffer {
   int64_t right_padding;
 };
 
+/// \brief A memory budget shared by several ReadaheadSpoolers
+///
+/// Buffers read ahead and not yet handed to the consumer are accounted
+/// against the budget.  A spooler with an empty queue may exceed the budget
+/// by one read, so that it always makes progress.  This class is thread-safe.
+class ARROW_EXPORT ReadaheadBudget {
+ public:
+  explicit ReadaheadBudget(int64_t capacity);
+
+  /// Reserve nbytes if it fits in the remaining budget, return whether it did
+  bool TryReserve(int64_t nbytes);
+  /// Reserve nbytes, even if it exceeds the budget
+  void Reserve(int64_t nbytes);
+  void Release(int64_t nbytes);
+
+  int64_t capacity() const { return capacity_; }
+  int64_t reserved() const { return reserved_.load(); }
+
+ private:
+  const int64_t capacity_;
+  std::atomic<int64_t> reserved_;
+};
+
+/// \brief Options for an adaptive ReadaheadSpooler
+///
+/// The spooler starts with the minimum read size and queue size.  Whenever
+/// the consumer has to wait for data, it compares the consumer's rate with
+/// the throughput of the underlying stream: if the stream is slower, a
+/// deeper queue can't help (reads are sequential) so the read size is
+/// doubled, to amortize per-read latency; otherwise the queue size is
+/// doubled, to absorb bursts.  When the queue is found full on several
+/// consecutive reads, the readahead is trimmed again.
+struct ARROW_EXPORT AdaptiveReadaheadOptions {
+  static AdaptiveReadaheadOptions Defaults();
+
+  int64_t min_read_size;
+  int64_t max_read_size;
+  int32_t min_queue_size;
+  int32_t max_queue_size;
+  /// An optional memory budget, possibly shared with other spoolers
+  std::shared_ptr<ReadaheadBudget> budget;
+};
+
 class ARROW_EXPORT ReadaheadSpooler {
  public:
   /// \brief EXPERIMENTAL: Create a readahead spooler wrapping the given input stream.
   ///
-  /// The spooler launches a background thread that reads up to a given number
-  /// of fixed-size blocks in advance from the underlying stream.
+  /// The spooler runs tasks on the global I/O thread pool that read up to
+  /// a given number of fixed-size blocks in advance from the underlying stream.
   /// The buffers returned by Read() will be padded at the beginning and the end
   /// with the configured amount of (zeroed) bytes.
   ReadaheadSpooler(MemoryPool* pool, std::shared_ptr<InputStream> raw,
@@ -58,6 +102,14 @@ class ARROW_EXPORT ReadaheadSpooler {
                             int32_t readahead_queue_size = 1, int64_t left_padding = 0,
                             int64_t right_padding = 0);
 
+  /// \brief EXPERIMENTAL: Create an adaptive readahead spooler
+  ///
+  /// The read size and readahead queue size vary within the given bounds,
+  /// depending on the measured consumer and stream rates.
+  ReadaheadSpooler(MemoryPool* pool, std::shared_ptr<InputStream> raw,
+                   const AdaptiveReadaheadOptions& options, int64_t left_padding = 0,
+                   int64_t right_padding = 0);
+
   ~ReadaheadSpooler();
 
   /// Configure zero-padding at beginning and end of buffers (default 0 bytes).
@@ -80,10 +132,13 @@ class ARROW_EXPORT ReadaheadSpooler {
   /// reached and/or the spooler was explicitly closed.
   /// Otherwise, the buffer will contain at most read_size bytes in addition
   /// to the configured padding (short reads are possible at the end of a file).
-  // How do we allow reusing the buffer in ReadaheadBuffer? perhaps by using
-  // a caching memory pool?
+  /// Once released, the buffer is recycled for subsequent reads.
   Status Read(ReadaheadBuffer* out);
 
+  /// The current read size and readahead queue size
+  int64_t GetReadSize();
+  int32_t GetQueueSize();
+
  private:
   static constexpr int64_t kDefaultReadSize = 1 << 20;  // 1 MB
 
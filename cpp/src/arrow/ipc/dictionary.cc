@@ -19,10 +19,19 @@
 
 #include <cstdint>
 #include <memory>
+#include <cstring>
 #include <sstream>
 #include <utility>
+#include <vector>
 
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
 namespace ipc {
@@ -76,5 +85,133 @@ Status DictionaryMemo::AddDictionary(int64_t id,
   return Status::OK();
 }
 
+Status DictionaryMemo::UpdateDictionary(int64_t id,
+                                        const std::shared_ptr<Array>& dictionary) {
+  auto it = id_to_dictionary_.find(id);
+  if (it == id_to_dictionary_.end()) {
+    return Status::KeyError("Dictionary with id ", id, " not found");
+  }
+  dictionary_to_id_.erase(reinterpret_cast<intptr_t>(it->second.get()));
+  it->second = dictionary;
+  dictionary_to_id_[reinterpret_cast<intptr_t>(dictionary.get())] = id;
+  return Status::OK();
+}
+
+namespace internal {
+
+using ::arrow::internal::checked_cast;
+
+namespace {
+
+// Concatenate the bitmaps of two arrays, null bitmaps being all set
+Status ConcatenateBitmaps(const uint8_t* left, int64_t left_offset, int64_t left_length,
+                          const uint8_t* right, int64_t right_offset,
+                          int64_t right_length, MemoryPool* pool,
+                          std::shared_ptr<Buffer>* out) {
+  RETURN_NOT_OK(AllocateEmptyBitmap(pool, left_length + right_length, out));
+  uint8_t* dest = (*out)->mutable_data();
+  if (left) {
+    ::arrow::internal::CopyBitmap(left, left_offset, left_length, dest, 0);
+  } else {
+    BitUtil::SetBitsTo(dest, 0, left_length, true);
+  }
+  if (right) {
+    ::arrow::internal::CopyBitmap(right, right_offset, right_length, dest, left_length);
+  } else {
+    BitUtil::SetBitsTo(dest, left_length, right_length, true);
+  }
+  return Status::OK();
+}
+
+Status ConcatenateValues(const uint8_t* left, int64_t left_size, const uint8_t* right,
+                         int64_t right_size, MemoryPool* pool,
+                         std::shared_ptr<Buffer>* out) {
+  RETURN_NOT_OK(AllocateBuffer(pool, left_size + right_size, out));
+  if (left_size > 0) {
+    std::memcpy((*out)->mutable_data(), left, left_size);
+  }
+  if (right_size > 0) {
+    std::memcpy((*out)->mutable_data() + left_size, right, right_size);
+  }
+  return Status::OK();
+}
+
+Status ConcatenateBinary(const BinaryArray& left, const BinaryArray& right,
+                         MemoryPool* pool, std::shared_ptr<Buffer>* offsets,
+                         std::shared_ptr<Buffer>* values) {
+  const int64_t length = left.length() + right.length();
+  RETURN_NOT_OK(AllocateBuffer(pool, (length + 1) * sizeof(int32_t), offsets));
+  auto out_offsets = reinterpret_cast<int32_t*>((*offsets)->mutable_data());
+
+  const int32_t left_start = left.value_offset(0);
+  const int32_t left_size = left.value_offset(left.length()) - left_start;
+  const int32_t right_start = right.value_offset(0);
+  const int32_t right_size = right.value_offset(right.length()) - right_start;
+  for (int64_t i = 0; i <= left.length(); ++i) {
+    out_offsets[i] = left.value_offset(i) - left_start;
+  }
+  for (int64_t i = 1; i <= right.length(); ++i) {
+    out_offsets[left.length() + i] = left_size + right.value_offset(i) - right_start;
+  }
+  return ConcatenateValues(left.value_data()->data() + left_start, left_size,
+                           right.value_data()->data() + right_start, right_size, pool,
+                           values);
+}
+
+}  // namespace
+
+bool CanConcatenateDictionaries(const DataType& value_type) {
+  const Type::type id = value_type.id();
+  return (is_primitive(id) && id != Type::NA) || is_binary_like(id) ||
+         id == Type::FIXED_SIZE_BINARY || id == Type::DECIMAL;
+}
+
+Status ConcatenateDictionaries(const Array& dictionary, const Array& delta,
+                               MemoryPool* pool, std::shared_ptr<Array>* out) {
+  const auto& type = dictionary.type();
+  if (!type->Equals(*delta.type())) {
+    return Status::Invalid("Delta dictionary of type ", delta.type()->ToString(),
+                           " does not match dictionary of type ", type->ToString());
+  }
+  if (!CanConcatenateDictionaries(*type)) {
+    return Status::NotImplemented("Delta dictionaries of type ", type->ToString());
+  }
+
+  const int64_t length = dictionary.length() + delta.length();
+  const int64_t null_count = dictionary.null_count() + delta.null_count();
+  std::vector<std::shared_ptr<Buffer>> buffers(is_binary_like(type->id()) ? 3 : 2);
+  if (null_count > 0) {
+    RETURN_NOT_OK(ConcatenateBitmaps(dictionary.null_bitmap_data(), dictionary.offset(),
+                                     dictionary.length(), delta.null_bitmap_data(),
+                                     delta.offset(), delta.length(), pool, &buffers[0]));
+  }
+
+  if (is_binary_like(type->id())) {
+    RETURN_NOT_OK(ConcatenateBinary(checked_cast<const BinaryArray&>(dictionary),
+                                    checked_cast<const BinaryArray&>(delta), pool,
+                                    &buffers[1], &buffers[2]));
+  } else if (type->id() == Type::BOOL) {
+    const auto& left = *dictionary.data();
+    const auto& right = *delta.data();
+    RETURN_NOT_OK(ConcatenateBitmaps(left.buffers[1]->data(), left.offset, left.length,
+                                     right.buffers[1]->data(), right.offset,
+                                     right.length, pool, &buffers[1]));
+  } else {
+    const int64_t byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+    const auto& left = *dictionary.data();
+    const auto& right = *delta.data();
+    RETURN_NOT_OK(
+        ConcatenateValues(left.buffers[1]->data() + left.offset * byte_width,
+                          left.length * byte_width,
+                          right.buffers[1]->data() + right.offset * byte_width,
+                          right.length * byte_width, pool, &buffers[1]));
+  }
+
+  *out = MakeArray(ArrayData::Make(type, length, std::move(buffers), null_count));
+  return Status::OK();
+}
+
+}  // namespace internal
+
 }  // namespace ipc
 }  // namespace arrow
@@ -31,7 +31,9 @@
 namespace arrow {
 
 class Array;
+class DataType;
 class Field;
+class MemoryPool;
 
 namespace ipc {
 
@@ -59,6 +61,11 @@ class ARROW_EXPORT DictionaryMemo {
   /// KeyError if that dictionary already exists
   Status AddDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
 
+  /// \brief Replace the dictionary with a particular id, e.g. after a
+  /// replacement or delta dictionary batch. Returns KeyError if there is no
+  /// dictionary with that id
+  Status UpdateDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
+
   const DictionaryMap& id_to_dictionary() const { return id_to_dictionary_; }
 
   /// \brief The number of dictionaries stored in the memo
@@ -75,6 +82,20 @@ class ARROW_EXPORT DictionaryMemo {
   ARROW_DISALLOW_COPY_AND_ASSIGN(DictionaryMemo);
 };
 
+namespace internal {
+
+/// \brief Return true if dictionaries of the given value type can be
+/// extended by delta dictionary batches
+ARROW_EXPORT
+bool CanConcatenateDictionaries(const DataType& value_type);
+
+/// \brief Append the values of a delta dictionary batch to a dictionary
+ARROW_EXPORT
+Status ConcatenateDictionaries(const Array& dictionary, const Array& delta,
+                               MemoryPool* pool, std::shared_ptr<Array>* out);
+
+}  // namespace internal
+
 }  // namespace ipc
 }  // namespace arrow
 
@@ -18,12 +18,14 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/feather-internal.h"
+#include "arrow/ipc/feather.h"
 #include "arrow/ipc/feather_generated.h"
 #include "arrow/ipc/test-common.h"
 #include "arrow/memory_pool.h"
@@ -513,6 +515,14 @@ TEST_F(TestTableWriter, PrimitiveNullRoundTrip) {
   }
 }
 
+TEST_F(TestTableWriter, ChunkedColumnsUnsupported) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch, batch}, &table));
+  ASSERT_RAISES(Invalid, writer_->Write(*table));
+}
+
 class TestTableWriterSlice : public TestTableWriter,
                              public ::testing::WithParamInterface<std::tuple<int, int>> {
  public:
@@ -564,6 +574,127 @@ INSTANTIATE_TEST_CASE_P(TestTableWriterSliceOffsets, TestTableWriterSlice,
                                                              304, 305, 306, 307),
                                            ::testing::Values(0, 1, 7, 8, 30, 32, 100)));
 
+// ----------------------------------------------------------------------
+// Feather V2 tests
+
+class TestFeatherV2 : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(MakeIntBatchSized(1000, &batch1_, 0));
+    ASSERT_OK(MakeIntBatchSized(500, &batch2_, 1));
+    ASSERT_OK(Table::FromRecordBatches({batch1_, batch2_}, &table_));
+  }
+
+  void WriteAndOpen(const Table& table,
+                    const WriteProperties& properties = WriteProperties::Defaults()) {
+    std::shared_ptr<io::BufferOutputStream> stream;
+    ASSERT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &stream));
+    ASSERT_OK(WriteTable(table, stream, properties));
+    ASSERT_OK(stream->Finish(&output_));
+    ASSERT_OK(TableReader::Open(std::make_shared<io::BufferReader>(output_), &reader_));
+  }
+
+  void CheckRoundTrip(const Table& table,
+                      const WriteProperties& properties = WriteProperties::Defaults()) {
+    WriteAndOpen(table, properties);
+    ASSERT_EQ(kFeatherV2Version, reader_->version());
+    ASSERT_EQ(table.num_rows(), reader_->num_rows());
+    ASSERT_EQ(table.num_columns(), reader_->num_columns());
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK(reader_->Read(&result));
+    AssertTablesEqual(table, *result);
+  }
+
+ protected:
+  std::shared_ptr<RecordBatch> batch1_, batch2_;
+  std::shared_ptr<Table> table_;
+  std::shared_ptr<Buffer> output_;
+  std::unique_ptr<TableReader> reader_;
+};
+
+TEST_F(TestFeatherV2, ChunkedRoundTrip) {
+  CheckRoundTrip(*table_);
+
+  // The chunks are preserved, and read without copying
+  std::shared_ptr<Column> column;
+  ASSERT_OK(reader_->GetColumn(1, &column));
+  ASSERT_EQ("f1", column->name());
+  ASSERT_EQ(2, column->data()->num_chunks());
+  ASSERT_TRUE(column->data()->chunk(0)->Equals(batch1_->column(1)));
+  ASSERT_TRUE(column->data()->chunk(1)->Equals(batch2_->column(1)));
+  const uint8_t* values = column->data()->chunk(1)->data()->buffers[1]->data();
+  ASSERT_GE(values, output_->data());
+  ASSERT_LT(values, output_->data() + output_->size());
+}
+
+TEST_F(TestFeatherV2, SplitChunks) {
+  auto properties = WriteProperties::Defaults();
+  properties.chunksize = 300;
+  CheckRoundTrip(*table_, properties);
+
+  std::shared_ptr<Column> column;
+  ASSERT_OK(reader_->GetColumn(0, &column));
+  // 1000 rows as 300 + 300 + 300 + 100, then 300 + 200
+  ASSERT_EQ(6, column->data()->num_chunks());
+}
+
+TEST_F(TestFeatherV2, ReadColumnSubset) {
+  WriteAndOpen(*table_);
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK(reader_->Read(std::vector<int>({1}), &result));
+  ASSERT_EQ(1, result->num_columns());
+  AssertChunkedEqual(*table_->column(1)->data(), *result->column(0)->data());
+
+  ASSERT_OK(reader_->Read(std::vector<std::string>({"f1", "f0"}), &result));
+  AssertTablesEqual(*table_, *result);
+
+  std::shared_ptr<Column> column;
+  ASSERT_RAISES(Invalid, reader_->GetColumn(2, &column));
+}
+
+TEST_F(TestFeatherV2, NestedTypes) {
+  // Not supported by V1 files
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeListRecordBatch(&batch));
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch}, &table));
+  CheckRoundTrip(*table);
+}
+
+TEST_F(TestFeatherV2, WriteV1) {
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch1_}, &table));
+  auto properties = WriteProperties::Defaults();
+  properties.version = kFeatherVersion;
+  WriteAndOpen(*table, properties);
+  ASSERT_EQ(kFeatherVersion, reader_->version());
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK(reader_->Read(&result));
+  AssertTablesEqual(*table, *result);
+
+  properties.version = 1;
+  std::shared_ptr<io::BufferOutputStream> stream;
+  ASSERT_OK(io::BufferOutputStream::Create(1024, default_memory_pool(), &stream));
+  ASSERT_RAISES(Invalid, WriteTable(*table, stream, properties));
+}
+
+#if defined(ARROW_WITH_LZ4) && defined(ARROW_WITH_ZSTD)
+TEST_F(TestFeatherV2, CompressedRoundTrip) {
+  for (auto compression : {Compression::LZ4, Compression::ZSTD}) {
+    auto properties = WriteProperties::Defaults();
+    properties.compression = compression;
+    CheckRoundTrip(*table_, properties);
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK(reader_->Read(std::vector<int>({1}), &result));
+    AssertChunkedEqual(*table_->column(1)->data(), *result->column(0)->data());
+  }
+}
+#endif
+
 }  // namespace feather
 }  // namespace ipc
 }  // namespace arrow
@@ -32,7 +32,11 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/ipc/feather-internal.h"
 #include "arrow/ipc/feather_generated.h"
+#include "arrow/ipc/metadata-internal.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/ipc/util.h"  // IWYU pragma: keep
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"  // IWYU pragma: keep
 #include "arrow/type.h"
@@ -277,6 +281,17 @@ class TableReader::TableReaderImpl {
   Status Open(const std::shared_ptr<io::RandomAccessFile>& source) {
     source_ = source;
 
+    // V2 files are Arrow IPC files, starting with their magic bytes
+    const int64_t ipc_magic_size =
+        static_cast<int64_t>(strlen(::arrow::ipc::internal::kArrowMagicBytes));
+    std::shared_ptr<Buffer> ipc_magic;
+    RETURN_NOT_OK(source->ReadAt(0, ipc_magic_size, &ipc_magic));
+    if (ipc_magic->size() == ipc_magic_size &&
+        memcmp(ipc_magic->data(), ::arrow::ipc::internal::kArrowMagicBytes,
+               ipc_magic_size) == 0) {
+      return OpenV2();
+    }
+
     int magic_size = static_cast<int>(strlen(kFeatherMagicBytes));
     int footer_size = magic_size + static_cast<int>(sizeof(uint32_t));
 
@@ -312,6 +327,18 @@ class TableReader::TableReaderImpl {
     return metadata_->Open(buffer);
   }
 
+  Status OpenV2() {
+    RETURN_NOT_OK(RecordBatchFileReader::Open(source_, &ipc_reader_));
+    // Reading no fields only reads the metadata of the batches
+    num_rows_ = 0;
+    for (int i = 0; i < ipc_reader_->num_record_batches(); ++i) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(ipc_reader_->ReadRecordBatch(i, {}, &batch));
+      num_rows_ += batch->num_rows();
+    }
+    return Status::OK();
+  }
+
   Status GetDataType(const fbs::PrimitiveArray* values, fbs::TypeMetadata metadata_type,
                      const void* metadata, std::shared_ptr<DataType>* out) {
 #define PRIMITIVE_CASE(CAP_TYPE, FACTORY_FUNC) \
@@ -419,20 +446,47 @@ class TableReader::TableReaderImpl {
     return Status::OK();
   }
 
-  bool HasDescription() const { return metadata_->HasDescription(); }
+  bool is_v2() const { return ipc_reader_ != nullptr; }
+
+  bool HasDescription() const { return !is_v2() && metadata_->HasDescription(); }
+
+  std::string GetDescription() const {
+    return is_v2() ? "" : metadata_->GetDescription();
+  }
+
+  int version() const { return is_v2() ? kFeatherV2Version : metadata_->version(); }
 
-  std::string GetDescription() const { return metadata_->GetDescription(); }
+  int64_t num_rows() const { return is_v2() ? num_rows_ : metadata_->num_rows(); }
 
-  int version() const { return metadata_->version(); }
-  int64_t num_rows() const { return metadata_->num_rows(); }
-  int64_t num_columns() const { return metadata_->num_columns(); }
+  int64_t num_columns() const {
+    return is_v2() ? ipc_reader_->schema()->num_fields() : metadata_->num_columns();
+  }
 
   std::string GetColumnName(int i) const {
+    if (is_v2()) {
+      return ipc_reader_->schema()->field(i)->name();
+    }
     const fbs::Column* col_meta = metadata_->column(i);
     return col_meta->name()->str();
   }
 
-  Status GetColumn(int i, std::shared_ptr<Column>* out) {
+  // Let the kernel prefetch the data of the given columns before they are
+  // read (or, for memory-mapped files, before the pages are touched)
+  Status WillNeedColumns(const std::vector<int>& indices) {
+    std::vector<io::ReadRange> ranges;
+    for (int i : indices) {
+      const fbs::Column* col_meta = metadata_->column(i);
+      const fbs::PrimitiveArray* values = col_meta->values();
+      ranges.push_back({values->offset(), values->total_bytes()});
+      if (col_meta->metadata_type() == fbs::TypeMetadata_CategoryMetadata) {
+        auto meta = static_cast<const fbs::CategoryMetadata*>(col_meta->metadata());
+        ranges.push_back({meta->levels()->offset(), meta->levels()->total_bytes()});
+      }
+    }
+    return source_->Advise(ranges, io::AccessHint::WILL_NEED);
+  }
+
+  Status ReadColumn(int i, std::shared_ptr<Column>* out) {
     const fbs::Column* col_meta = metadata_->column(i);
 
     // auto user_meta = column->user_metadata();
@@ -445,12 +499,49 @@ class TableReader::TableReaderImpl {
     return Status::OK();
   }
 
-  Status Read(std::shared_ptr<Table>* out) {
+  // Read the given columns of all the record batches of a V2 file, each
+  // batch becoming a chunk
+  Status ReadColumnsV2(const std::vector<int>& indices, std::shared_ptr<Table>* out) {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (int i = 0; i < ipc_reader_->num_record_batches(); ++i) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(ipc_reader_->ReadRecordBatch(i, indices, &batch));
+      batches.push_back(batch);
+    }
+    const auto& file_schema = ipc_reader_->schema();
+    std::vector<std::shared_ptr<Field>> fields;
+    for (int i : indices) {
+      fields.push_back(file_schema->field(i));
+    }
+    return Table::FromRecordBatches(schema(fields, file_schema->metadata()), batches,
+                                    out);
+  }
+
+  Status GetColumn(int i, std::shared_ptr<Column>* out) {
+    if (is_v2()) {
+      if (i < 0 || i >= num_columns()) {
+        return Status::Invalid("Column index ", i, " out of bounds");
+      }
+      std::shared_ptr<Table> table;
+      RETURN_NOT_OK(ReadColumnsV2({i}, &table));
+      *out = table->column(0);
+      return Status::OK();
+    }
+    RETURN_NOT_OK(WillNeedColumns({i}));
+    return ReadColumn(i, out);
+  }
+
+  // Read the given columns, in order
+  Status ReadColumns(const std::vector<int>& indices, std::shared_ptr<Table>* out) {
+    if (is_v2()) {
+      return ReadColumnsV2(indices, out);
+    }
+    RETURN_NOT_OK(WillNeedColumns(indices));
     std::vector<std::shared_ptr<Field>> fields;
     std::vector<std::shared_ptr<Column>> columns;
-    for (int i = 0; i < num_columns(); ++i) {
+    for (int i : indices) {
       std::shared_ptr<Column> column;
-      RETURN_NOT_OK(GetColumn(i, &column));
+      RETURN_NOT_OK(ReadColumn(i, &column));
       columns.push_back(column);
       fields.push_back(column->field());
     }
@@ -458,9 +549,16 @@ class TableReader::TableReaderImpl {
     return Status::OK();
   }
 
+  Status Read(std::shared_ptr<Table>* out) {
+    std::vector<int> indices;
+    for (int i = 0; i < num_columns(); ++i) {
+      indices.push_back(i);
+    }
+    return ReadColumns(indices, out);
+  }
+
   Status Read(const std::vector<int>& indices, std::shared_ptr<Table>* out) {
-    std::vector<std::shared_ptr<Field>> fields;
-    std::vector<std::shared_ptr<Column>> columns;
+    std::vector<int> selected;
     for (int i = 0; i < num_columns(); ++i) {
       bool found = false;
       for (auto j : indices) {
@@ -469,21 +567,15 @@ class TableReader::TableReaderImpl {
           break;
         }
       }
-      if (!found) {
-        continue;
+      if (found) {
+        selected.push_back(i);
       }
-      std::shared_ptr<Column> column;
-      RETURN_NOT_OK(GetColumn(i, &column));
-      columns.push_back(column);
-      fields.push_back(column->field());
     }
-    *out = Table::Make(schema(fields), columns);
-    return Status::OK();
+    return ReadColumns(selected, out);
   }
 
   Status Read(const std::vector<std::string>& names, std::shared_ptr<Table>* out) {
-    std::vector<std::shared_ptr<Field>> fields;
-    std::vector<std::shared_ptr<Column>> columns;
+    std::vector<int> selected;
     for (int i = 0; i < num_columns(); ++i) {
       auto name = GetColumnName(i);
       bool found = false;
@@ -493,22 +585,21 @@ class TableReader::TableReaderImpl {
           break;
         }
       }
-      if (!found) {
-        continue;
+      if (found) {
+        selected.push_back(i);
       }
-      std::shared_ptr<Column> column;
-      RETURN_NOT_OK(GetColumn(i, &column));
-      columns.push_back(column);
-      fields.push_back(column->field());
     }
-    *out = Table::Make(schema(fields), columns);
-    return Status::OK();
+    return ReadColumns(selected, out);
   }
 
  private:
   std::shared_ptr<io::RandomAccessFile> source_;
   std::unique_ptr<TableMetadata> metadata_;
 
+  // Set for V2 files only
+  std::shared_ptr<RecordBatchFileReader> ipc_reader_;
+  int64_t num_rows_ = 0;
+
   std::shared_ptr<Schema> schema_;
 };
 
@@ -814,6 +905,11 @@ class TableWriter::TableWriterImpl : public ArrayVisitor {
       auto column = table.column(i);
       current_column_ = metadata_.AddColumn(column->name());
       auto chunked_array = column->data();
+      if (chunked_array->num_chunks() > 1) {
+        return Status::Invalid("Feather V1 files only support columns with a single ",
+                               "chunk, column '", column->name(), "' has ",
+                               chunked_array->num_chunks());
+      }
       for (const auto chunk : chunked_array->chunks()) {
         RETURN_NOT_OK(chunk->Accept(this));
       }
@@ -866,6 +962,37 @@ Status TableWriter::Write(const Table& table) { return impl_->Write(table); }
 
 Status TableWriter::Finalize() { return impl_->Finalize(); }
 
+// ----------------------------------------------------------------------
+// Feather V2 and WriteTable
+
+WriteProperties WriteProperties::Defaults() { return WriteProperties(); }
+
+Status WriteTable(const Table& table, const std::shared_ptr<io::OutputStream>& stream,
+                  const WriteProperties& properties) {
+  if (properties.version == kFeatherVersion) {
+    std::unique_ptr<TableWriter> writer;
+    RETURN_NOT_OK(TableWriter::Open(stream, &writer));
+    writer->SetNumRows(table.num_rows());
+    RETURN_NOT_OK(writer->Write(table));
+    return writer->Finalize();
+  }
+  if (properties.version != kFeatherV2Version) {
+    return Status::Invalid("Unsupported Feather version ", properties.version);
+  }
+
+  IpcWriteOptions options = IpcWriteOptions::Defaults();
+  options.compression = properties.compression;
+  std::shared_ptr<RecordBatchWriter> writer;
+  RETURN_NOT_OK(
+      RecordBatchFileWriter::Open(stream.get(), table.schema(), options, &writer));
+  RETURN_NOT_OK(writer->WriteTable(table, properties.chunksize));
+  return writer->Close();
+}
+
+Status WriteTable(const Table& table, const std::shared_ptr<io::OutputStream>& stream) {
+  return WriteTable(table, stream, WriteProperties::Defaults());
+}
+
 }  // namespace feather
 }  // namespace ipc
 }  // namespace arrow
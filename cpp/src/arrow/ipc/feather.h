@@ -26,6 +26,7 @@
 #include <string>
 #include <vector>
 
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -45,13 +46,24 @@ class RandomAccessFile;
 namespace ipc {
 namespace feather {
 
+/// The metadata version of the original (V1) Feather files written by
+/// TableWriter
 static constexpr const int kFeatherVersion = 2;
 
+/// The version of Feather V2 files, which are Arrow IPC files
+static constexpr const int kFeatherV2Version = 3;
+
 // ----------------------------------------------------------------------
 // Metadata accessor classes
 
 /// \class TableReader
 /// \brief An interface for reading columns from Feather files
+///
+/// Both V1 files and V2 files (Arrow IPC files) are supported.  Reads of V2
+/// files only fetch the buffers of the selected columns, and are zero-copy
+/// for uncompressed files if the source supports zero-copy reads (e.g. a
+/// memory-mapped file).  Chunking is preserved, except that GetColumn and
+/// Read return a single chunk per column for V1 files.
 class ARROW_EXPORT TableReader {
  public:
   TableReader();
@@ -73,7 +85,8 @@ class ARROW_EXPORT TableReader {
   /// \brief Return true if the table has a description field populated
   bool HasDescription() const;
 
-  /// \brief Return the version number of the Feather file
+  /// \brief Return the version number of the Feather file: kFeatherVersion
+  /// for V1 files, kFeatherV2Version for V2 files
   int version() const;
 
   /// \brief Return the number of rows in the file
@@ -125,7 +138,10 @@ class ARROW_EXPORT TableReader {
 };
 
 /// \class TableWriter
-/// \brief Interface for writing Feather files
+/// \brief Interface for writing V1 Feather files
+///
+/// V1 files only hold a single chunk of primitive, binary, dictionary or
+/// temporal values per column.  See WriteTable for V2 files.
 class ARROW_EXPORT TableWriter {
  public:
   ~TableWriter();
@@ -166,6 +182,43 @@ class ARROW_EXPORT TableWriter {
   std::unique_ptr<TableWriterImpl> impl_;
 };
 
+/// \brief Options for WriteTable
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+struct ARROW_EXPORT WriteProperties {
+  /// The Feather version to write: kFeatherV2Version, or kFeatherVersion
+  /// for V1 files
+  int version = kFeatherV2Version;
+  /// The maximum number of rows of the record batches of V2 files.  Chunks
+  /// are never merged, only split.  If not positive, they are not split
+  /// either.
+  int64_t chunksize = 1LL << 16;
+  /// The codec compressing each buffer of V2 files: Compression::UNCOMPRESSED,
+  /// LZ4 or ZSTD
+  Compression::type compression = Compression::UNCOMPRESSED;
+
+  static WriteProperties Defaults();
+};
+
+/// \brief Write a table as a Feather file
+///
+/// V2 files are Arrow IPC files, which hold the table's chunks as record
+/// batches and support all the Arrow types.  V1 files are written with
+/// TableWriter and support neither chunking nor compression.
+///
+/// \param[in] table the table to write
+/// \param[in] stream the output stream
+/// \param[in] properties the version and compression to write with
+/// \return Status
+ARROW_EXPORT
+Status WriteTable(const Table& table, const std::shared_ptr<io::OutputStream>& stream,
+                  const WriteProperties& properties);
+
+/// \brief Write a table as a Feather V2 file, uncompressed
+ARROW_EXPORT
+Status WriteTable(const Table& table, const std::shared_ptr<io::OutputStream>& stream);
+
 }  // namespace feather
 }  // namespace ipc
 }  // namespace arrow
@@ -18,6 +18,7 @@
 #include "arrow/ipc/message.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <sstream>
@@ -30,6 +31,7 @@
 #include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/metadata-internal.h"
 #include "arrow/ipc/util.h"
+#include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
 
@@ -141,16 +143,21 @@ bool Message::Equals(const Message& other) const {
   }
 }
 
-Status Message::ReadFrom(const std::shared_ptr<Buffer>& metadata, io::InputStream* stream,
-                         std::unique_ptr<Message>* out) {
-  auto data = metadata->data();
-  flatbuffers::Verifier verifier(data, metadata->size(), 128);
+// Verify the flatbuffer of a message read from a stream, decoded in place
+static Status GetVerifiedBodyLength(const Buffer& metadata, int64_t* body_length) {
+  auto data = metadata.data();
+  flatbuffers::Verifier verifier(data, metadata.size(), 128);
   if (!flatbuf::VerifyMessageBuffer(verifier)) {
     return Status::IOError("Invalid flatbuffers message.");
   }
-  auto fb_message = flatbuf::GetMessage(data);
+  *body_length = flatbuf::GetMessage(data)->bodyLength();
+  return Status::OK();
+}
 
-  int64_t body_length = fb_message->bodyLength();
+Status Message::ReadFrom(const std::shared_ptr<Buffer>& metadata, io::InputStream* stream,
+                         std::unique_ptr<Message>* out) {
+  int64_t body_length = 0;
+  RETURN_NOT_OK(GetVerifiedBodyLength(*metadata, &body_length));
 
   std::shared_ptr<Buffer> body;
   RETURN_NOT_OK(stream->Read(body_length, &body));
@@ -278,19 +285,24 @@ Status CheckAligned(io::FileInterface* stream, int32_t alignment) {
   }
 }
 
-Status ReadMessage(io::InputStream* file, std::unique_ptr<Message>* message) {
-  int32_t message_length = 0;
+// Read the length prefix of a message, or 0 at the end of the stream
+static Status ReadMessageLength(io::InputStream* file, int32_t* message_length) {
+  *message_length = 0;
   int64_t bytes_read = 0;
   RETURN_NOT_OK(file->Read(sizeof(int32_t), &bytes_read,
-                           reinterpret_cast<uint8_t*>(&message_length)));
-
+                           reinterpret_cast<uint8_t*>(message_length)));
   if (bytes_read != sizeof(int32_t)) {
-    *message = nullptr;
-    return Status::OK();
+    *message_length = 0;
   }
+  return Status::OK();
+}
+
+Status ReadMessage(io::InputStream* file, std::unique_ptr<Message>* message) {
+  int32_t message_length = 0;
+  RETURN_NOT_OK(ReadMessageLength(file, &message_length));
 
   if (message_length == 0) {
-    // Optional 0 EOS control message
+    // End of stream, or optional 0 EOS control message
     *message = nullptr;
     return Status::OK();
   }
@@ -308,25 +320,84 @@ Status ReadMessage(io::InputStream* file, std::unique_ptr<Message>* message) {
 // ----------------------------------------------------------------------
 // Implement InputStream message reader
 
+MessageReaderOptions MessageReaderOptions::Defaults() { return MessageReaderOptions(); }
+
 /// \brief Implementation of MessageReader that reads from InputStream
 class InputStreamMessageReader : public MessageReader {
  public:
-  explicit InputStreamMessageReader(io::InputStream* stream) : stream_(stream) {}
-
-  explicit InputStreamMessageReader(const std::shared_ptr<io::InputStream>& owned_stream)
-      : InputStreamMessageReader(owned_stream.get()) {
+  explicit InputStreamMessageReader(
+      io::InputStream* stream,
+      const MessageReaderOptions& options = MessageReaderOptions::Defaults())
+      : stream_(stream),
+        reuse_buffers_(options.reuse_buffers && !stream->supports_zero_copy()),
+        pool_(options.pool ? options.pool : default_memory_pool()) {}
+
+  explicit InputStreamMessageReader(
+      const std::shared_ptr<io::InputStream>& owned_stream,
+      const MessageReaderOptions& options = MessageReaderOptions::Defaults())
+      : InputStreamMessageReader(owned_stream.get(), options) {
     owned_stream_ = owned_stream;
   }
 
   ~InputStreamMessageReader() {}
 
   Status ReadNextMessage(std::unique_ptr<Message>* message) {
-    return ReadMessage(stream_, message);
+    if (!reuse_buffers_) {
+      return ReadMessage(stream_, message);
+    }
+
+    int32_t message_length = 0;
+    RETURN_NOT_OK(ReadMessageLength(stream_, &message_length));
+    if (message_length == 0) {
+      *message = nullptr;
+      return Status::OK();
+    }
+
+    std::shared_ptr<Buffer> metadata;
+    RETURN_NOT_OK(ReadIntoScratch(message_length, &metadata_scratch_, &metadata));
+    if (metadata->size() != message_length) {
+      return Status::Invalid("Expected to read ", message_length, " metadata bytes, but ",
+                             "only read ", metadata->size());
+    }
+
+    int64_t body_length = 0;
+    RETURN_NOT_OK(GetVerifiedBodyLength(*metadata, &body_length));
+    std::shared_ptr<Buffer> body;
+    RETURN_NOT_OK(ReadIntoScratch(body_length, &body_scratch_, &body));
+    if (body->size() < body_length) {
+      return Status::IOError("Expected to be able to read ", body_length,
+                             " bytes for message body, got ", body->size());
+    }
+    return Message::Open(metadata, body, message);
   }
 
  private:
+  // Read into the scratch buffer if the previous message is not referenced
+  // anymore, otherwise into a new buffer which becomes the scratch buffer
+  Status ReadIntoScratch(int64_t nbytes, std::shared_ptr<ResizableBuffer>* scratch,
+                         std::shared_ptr<Buffer>* out) {
+    if (*scratch && scratch->use_count() == 1) {
+      // Synchronize with the thread which released the last other reference
+      std::atomic_thread_fence(std::memory_order_acquire);
+      RETURN_NOT_OK((*scratch)->Resize(nbytes, false /* shrink_to_fit */));
+    } else {
+      RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, scratch));
+    }
+    int64_t bytes_read = 0;
+    RETURN_NOT_OK(stream_->Read(nbytes, &bytes_read, (*scratch)->mutable_data()));
+    if (bytes_read < nbytes) {
+      RETURN_NOT_OK((*scratch)->Resize(bytes_read, false /* shrink_to_fit */));
+    }
+    *out = *scratch;
+    return Status::OK();
+  }
+
   io::InputStream* stream_;
   std::shared_ptr<io::InputStream> owned_stream_;
+  const bool reuse_buffers_;
+  MemoryPool* pool_;
+  std::shared_ptr<ResizableBuffer> metadata_scratch_;
+  std::shared_ptr<ResizableBuffer> body_scratch_;
 };
 
 std::unique_ptr<MessageReader> MessageReader::Open(io::InputStream* stream) {
@@ -338,5 +409,17 @@ std::unique_ptr<MessageReader> MessageReader::Open(
   return std::unique_ptr<MessageReader>(new InputStreamMessageReader(owned_stream));
 }
 
+std::unique_ptr<MessageReader> MessageReader::Open(io::InputStream* stream,
+                                                   const MessageReaderOptions& options) {
+  return std::unique_ptr<MessageReader>(new InputStreamMessageReader(stream, options));
+}
+
+std::unique_ptr<MessageReader> MessageReader::Open(
+    const std::shared_ptr<io::InputStream>& owned_stream,
+    const MessageReaderOptions& options) {
+  return std::unique_ptr<MessageReader>(
+      new InputStreamMessageReader(owned_stream, options));
+}
+
 }  // namespace ipc
 }  // namespace arrow
@@ -31,6 +31,7 @@
 namespace arrow {
 
 class Buffer;
+class MemoryPool;
 
 namespace io {
 
@@ -163,6 +164,23 @@ class ARROW_EXPORT Message {
 
 ARROW_EXPORT std::string FormatMessageType(Message::Type type);
 
+/// \brief Options for reading messages from an InputStream
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+struct ARROW_EXPORT MessageReaderOptions {
+  /// Read each message into the metadata and body buffers of the previous
+  /// one once nothing else references them, e.g. after the record batch read
+  /// from the previous message was released, instead of allocating new
+  /// buffers.  Streams supporting zero-copy reads never allocate and ignore
+  /// this option.
+  bool reuse_buffers = false;
+  /// The pool of the message buffers, or null for the default pool
+  MemoryPool* pool = NULLPTR;
+
+  static MessageReaderOptions Defaults();
+};
+
 /// \brief Abstract interface for a sequence of messages
 /// \since 0.5.0
 class ARROW_EXPORT MessageReader {
@@ -176,6 +194,17 @@ class ARROW_EXPORT MessageReader {
   static std::unique_ptr<MessageReader> Open(
       const std::shared_ptr<io::InputStream>& owned_stream);
 
+  /// \brief Create MessageReader that reads from InputStream with the
+  /// given options
+  static std::unique_ptr<MessageReader> Open(io::InputStream* stream,
+                                             const MessageReaderOptions& options);
+
+  /// \brief Create MessageReader that reads from owned InputStream with the
+  /// given options
+  static std::unique_ptr<MessageReader> Open(
+      const std::shared_ptr<io::InputStream>& owned_stream,
+      const MessageReaderOptions& options);
+
   /// \brief Read next Message from the interface
   ///
   /// \param[out] message an arrow::ipc::Message instance
@@ -21,6 +21,7 @@
 #include <memory>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include <flatbuffers/flatbuffers.h>
 
@@ -726,27 +727,75 @@ static Status WriteBuffers(FBB& fbb, const std::vector<BufferMetadata>& buffers,
   return Status::OK();
 }
 
+static Status WriteBodyCompression(FBB& fbb, Compression::type compression,
+                                   flatbuffers::Offset<flatbuf::BodyCompression>* out) {
+  flatbuf::CompressionType codec;
+  switch (compression) {
+    case Compression::UNCOMPRESSED:
+      // Absent from the metadata
+      *out = 0;
+      return Status::OK();
+    case Compression::LZ4:
+      codec = flatbuf::CompressionType_LZ4;
+      break;
+    case Compression::ZSTD:
+      codec = flatbuf::CompressionType_ZSTD;
+      break;
+    default:
+      return Status::Invalid("IPC body compression only supports LZ4 and ZSTD");
+  }
+  *out =
+      flatbuf::CreateBodyCompression(fbb, codec, flatbuf::BodyCompressionMethod_BUFFER);
+  return Status::OK();
+}
+
 static Status MakeRecordBatch(FBB& fbb, int64_t length, int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
-                              RecordBatchOffset* offset) {
+                              Compression::type compression, RecordBatchOffset* offset) {
   FieldNodeVector fb_nodes;
   BufferVector fb_buffers;
+  flatbuffers::Offset<flatbuf::BodyCompression> fb_compression;
 
   RETURN_NOT_OK(WriteFieldNodes(fbb, nodes, &fb_nodes));
   RETURN_NOT_OK(WriteBuffers(fbb, buffers, &fb_buffers));
+  RETURN_NOT_OK(WriteBodyCompression(fbb, compression, &fb_compression));
 
-  *offset = flatbuf::CreateRecordBatch(fbb, length, fb_nodes, fb_buffers);
+  *offset =
+      flatbuf::CreateRecordBatch(fbb, length, fb_nodes, fb_buffers, fb_compression);
   return Status::OK();
 }
 
+Status GetBodyCompression(const flatbuf::RecordBatch* batch, Compression::type* out) {
+  const flatbuf::BodyCompression* compression = batch->compression();
+  if (compression == nullptr) {
+    *out = Compression::UNCOMPRESSED;
+    return Status::OK();
+  }
+  if (compression->method() != flatbuf::BodyCompressionMethod_BUFFER) {
+    return Status::Invalid("Unsupported IPC body compression method");
+  }
+  switch (compression->codec()) {
+    case flatbuf::CompressionType_LZ4:
+      *out = Compression::LZ4;
+      return Status::OK();
+    case flatbuf::CompressionType_ZSTD:
+      *out = Compression::ZSTD;
+      return Status::OK();
+    default:
+      return Status::Invalid("Unsupported IPC body compression codec");
+  }
+}
+
 Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
-  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
+  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, compression,
+                                &record_batch));
   return WriteFBMessage(fbb, flatbuf::MessageHeader_RecordBatch, record_batch.Union(),
                         body_length, out);
 }
@@ -810,6 +859,49 @@ Status MakeSparseMatrixIndexCSR(FBB& fbb, const SparseCSRIndex& sparse_index,
   return Status::OK();
 }
 
+Status MakeSparseMatrixIndexCSC(FBB& fbb, const SparseCSCIndex& sparse_index,
+                                const std::vector<BufferMetadata>& buffers,
+                                flatbuf::SparseTensorIndex* fb_sparse_index_type,
+                                Offset* fb_sparse_index, size_t* num_buffers) {
+  *fb_sparse_index_type = flatbuf::SparseTensorIndex_SparseMatrixIndexCSC;
+  const BufferMetadata& indptr_metadata = buffers[0];
+  const BufferMetadata& indices_metadata = buffers[1];
+  flatbuf::Buffer indptr(indptr_metadata.offset, indptr_metadata.length);
+  flatbuf::Buffer indices(indices_metadata.offset, indices_metadata.length);
+  *fb_sparse_index = flatbuf::CreateSparseMatrixIndexCSC(fbb, &indptr, &indices).Union();
+  *num_buffers = 2;
+  return Status::OK();
+}
+
+Status MakeSparseTensorIndexCSF(FBB& fbb, const SparseCSFIndex& sparse_index,
+                                const std::vector<BufferMetadata>& buffers,
+                                flatbuf::SparseTensorIndex* fb_sparse_index_type,
+                                Offset* fb_sparse_index, size_t* num_buffers) {
+  *fb_sparse_index_type = flatbuf::SparseTensorIndex_SparseTensorIndexCSF;
+  // The indptr buffers come first, then the indices buffers
+  const size_t num_indptr = sparse_index.indptr().size();
+  const size_t num_indices = sparse_index.indices().size();
+  std::vector<flatbuf::Buffer> indptr;
+  for (size_t i = 0; i < num_indptr; ++i) {
+    indptr.emplace_back(buffers[i].offset, buffers[i].length);
+  }
+  std::vector<flatbuf::Buffer> indices;
+  for (size_t i = num_indptr; i < num_indptr + num_indices; ++i) {
+    indices.emplace_back(buffers[i].offset, buffers[i].length);
+  }
+  std::vector<int32_t> axis_order;
+  for (int64_t axis : sparse_index.axis_order()) {
+    axis_order.push_back(static_cast<int32_t>(axis));
+  }
+  *fb_sparse_index =
+      flatbuf::CreateSparseTensorIndexCSF(fbb, fbb.CreateVectorOfStructs(indptr),
+                                          fbb.CreateVectorOfStructs(indices),
+                                          fbb.CreateVector(axis_order))
+          .Union();
+  *num_buffers = num_indptr + num_indices;
+  return Status::OK();
+}
+
 Status MakeSparseTensorIndex(FBB& fbb, const SparseIndex& sparse_index,
                              const std::vector<BufferMetadata>& buffers,
                              flatbuf::SparseTensorIndex* fb_sparse_index_type,
@@ -827,6 +919,18 @@ Status MakeSparseTensorIndex(FBB& fbb, const SparseIndex& sparse_index,
           fb_sparse_index_type, fb_sparse_index, num_buffers));
       break;
 
+    case SparseTensorFormat::CSC:
+      RETURN_NOT_OK(MakeSparseMatrixIndexCSC(
+          fbb, checked_cast<const SparseCSCIndex&>(sparse_index), buffers,
+          fb_sparse_index_type, fb_sparse_index, num_buffers));
+      break;
+
+    case SparseTensorFormat::CSF:
+      RETURN_NOT_OK(MakeSparseTensorIndexCSF(
+          fbb, checked_cast<const SparseCSFIndex&>(sparse_index), buffers,
+          fb_sparse_index_type, fb_sparse_index, num_buffers));
+      break;
+
     default:
       std::stringstream ss;
       ss << "Unsupporoted sparse tensor format:: " << sparse_index.ToString()
@@ -887,11 +991,14 @@ Status WriteSparseTensorMessage(const SparseTensor& sparse_tensor, int64_t body_
 Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression, bool is_delta,
                               std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
-  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
-  auto dictionary_batch = flatbuf::CreateDictionaryBatch(fbb, id, record_batch).Union();
+  RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, compression,
+                                &record_batch));
+  auto dictionary_batch =
+      flatbuf::CreateDictionaryBatch(fbb, id, record_batch, is_delta).Union();
   return WriteFBMessage(fbb, flatbuf::MessageHeader_DictionaryBatch, dictionary_batch,
                         body_length, out);
 }
@@ -1075,6 +1182,14 @@ Status GetSparseTensorMetadata(const Buffer& metadata, std::shared_ptr<DataType>
       *sparse_tensor_format_id = SparseTensorFormat::CSR;
       break;
 
+    case flatbuf::SparseTensorIndex_SparseMatrixIndexCSC:
+      *sparse_tensor_format_id = SparseTensorFormat::CSC;
+      break;
+
+    case flatbuf::SparseTensorIndex_SparseTensorIndexCSF:
+      *sparse_tensor_format_id = SparseTensorFormat::CSF;
+      break;
+
     default:
       return Status::Invalid("Unrecognized sparse index type");
   }
@@ -29,12 +29,14 @@
 #include <flatbuffers/flatbuffers.h>
 
 #include "arrow/buffer.h"
+#include "arrow/ipc/Message_generated.h"
 #include "arrow/ipc/Schema_generated.h"
 #include "arrow/ipc/dictionary.h"  // IYWU pragma: keep
 #include "arrow/ipc/message.h"
 #include "arrow/memory_pool.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 
 namespace arrow {
 
@@ -137,11 +139,17 @@ Status WriteMessage(const Buffer& message, int32_t alignment, io::OutputStream*
 Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
                           std::shared_ptr<Buffer>* out);
 
+// The body buffers are described as compressed with the given codec, unless
+// it is Compression::UNCOMPRESSED
 Status WriteRecordBatchMessage(const int64_t length, const int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out);
 
+// Get the codec the body buffers of a record batch are compressed with
+Status GetBodyCompression(const flatbuf::RecordBatch* batch, Compression::type* out);
+
 Status WriteTensorMessage(const Tensor& tensor, const int64_t buffer_start_offset,
                           std::shared_ptr<Buffer>* out);
 
@@ -157,6 +165,7 @@ Status WriteDictionaryMessage(const int64_t id, const int64_t length,
                               const int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression, bool is_delta,
                               std::shared_ptr<Buffer>* out);
 
 static inline Status WriteFlatbufferBuilder(flatbuffers::FlatBufferBuilder& fbb,
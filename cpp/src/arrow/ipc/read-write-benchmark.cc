@@ -97,6 +97,59 @@ static void BM_ReadRecordBatch(benchmark::State& state) {  // NOLINT non-const r
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+// Read a message holding a small batch with the given number of fields
+static std::unique_ptr<ipc::Message> MakeSmallBatchMessage(
+    int64_t num_fields, std::shared_ptr<Schema>* schema) {
+  constexpr int64_t kNumRows = 50;
+  auto record_batch =
+      MakeRecordBatch(kNumRows * num_fields * sizeof(int64_t), num_fields);
+  *schema = record_batch->schema();
+
+  std::shared_ptr<ResizableBuffer> buffer;
+  ABORT_NOT_OK(AllocateResizableBuffer(0, &buffer));
+  io::BufferOutputStream stream(buffer);
+  int32_t metadata_length;
+  int64_t body_length;
+  ABORT_NOT_OK(ipc::WriteRecordBatch(*record_batch, 0, &stream, &metadata_length,
+                                     &body_length, default_memory_pool()));
+  ABORT_NOT_OK(stream.Close());
+
+  io::BufferReader reader(buffer);
+  std::unique_ptr<ipc::Message> message;
+  ABORT_NOT_OK(ipc::ReadMessage(&reader, &message));
+  return message;
+}
+
+static void BM_ReadSmallRecordBatch(  // NOLINT non-const reference
+    benchmark::State& state) {
+  std::shared_ptr<Schema> schema;
+  auto message = MakeSmallBatchMessage(state.range(0), &schema);
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<RecordBatch> result;
+    if (!ipc::ReadRecordBatch(*message, schema, &result).ok()) {
+      state.SkipWithError("Failed to read!");
+    }
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+static void BM_DecodeSmallRecordBatch(  // NOLINT non-const reference
+    benchmark::State& state) {
+  std::shared_ptr<Schema> schema;
+  auto message = MakeSmallBatchMessage(state.range(0), &schema);
+  std::unique_ptr<ipc::RecordBatchDecoder> decoder;
+  ABORT_NOT_OK(ipc::RecordBatchDecoder::Make(schema, &decoder));
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<RecordBatch> result;
+    if (!decoder->Decode(*message, &result).ok()) {
+      state.SkipWithError("Failed to read!");
+    }
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
 BENCHMARK(BM_WriteRecordBatch)
     ->RangeMultiplier(4)
     ->Range(1, 1 << 13)
@@ -109,4 +162,8 @@ BENCHMARK(BM_ReadRecordBatch)
     ->MinTime(1.0)
     ->UseRealTime();
 
+BENCHMARK(BM_ReadSmallRecordBatch)->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
+
+BENCHMARK(BM_DecodeSmallRecordBatch)->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
+
 }  // namespace arrow
@@ -20,6 +20,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include <flatbuffers/flatbuffers.h>
 #include <gtest/gtest.h>
@@ -27,6 +28,7 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
+#include "arrow/io/buffered.h"
 #include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/test-common.h"
@@ -40,7 +42,9 @@
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
+#include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/util/bit-util.h"
@@ -217,6 +221,19 @@ class IpcTestFixture : public io::MemoryMapFixture {
     return ReadRecordBatch(batch.schema(), &buf_reader, batch_result);
   }
 
+  Status DoDecoderRoundTrip(const RecordBatch& batch,
+                            std::shared_ptr<RecordBatch>* batch_result) {
+    std::shared_ptr<Buffer> serialized_batch;
+    RETURN_NOT_OK(SerializeRecordBatch(batch, pool_, &serialized_batch));
+
+    io::BufferReader buf_reader(serialized_batch);
+    std::unique_ptr<Message> message;
+    RETURN_NOT_OK(ReadMessage(&buf_reader, &message));
+    std::unique_ptr<RecordBatchDecoder> decoder;
+    RETURN_NOT_OK(RecordBatchDecoder::Make(batch.schema(), &decoder));
+    return decoder->Decode(*message, batch_result);
+  }
+
   Status DoLargeRoundTrip(const RecordBatch& batch, bool zero_data,
                           std::shared_ptr<RecordBatch>* result) {
     if (zero_data) {
@@ -261,6 +278,9 @@ class IpcTestFixture : public io::MemoryMapFixture {
     ASSERT_OK(DoStandardRoundTrip(batch, &result));
     CheckReadResult(*result, batch);
 
+    ASSERT_OK(DoDecoderRoundTrip(batch, &result));
+    CheckReadResult(*result, batch);
+
     ASSERT_OK(DoLargeRoundTrip(batch, true, &result));
     CheckReadResult(*result, batch);
   }
@@ -319,6 +339,31 @@ TEST_F(TestIpcRoundTrip, MetadataVersion) {
   ASSERT_EQ(MetadataVersion::V4, message->metadata_version());
 }
 
+TEST_F(TestIpcRoundTrip, DecoderSchemaMismatch) {
+  std::shared_ptr<RecordBatch> batch, other_batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  ASSERT_OK(MakeStringTypesRecordBatch(&other_batch));
+
+  std::shared_ptr<Buffer> serialized_batch;
+  ASSERT_OK(SerializeRecordBatch(*batch, pool_, &serialized_batch));
+  io::BufferReader buf_reader(serialized_batch);
+  std::unique_ptr<Message> message;
+  ASSERT_OK(ReadMessage(&buf_reader, &message));
+
+  // The string columns have more buffers
+  std::unique_ptr<RecordBatchDecoder> decoder;
+  ASSERT_OK(RecordBatchDecoder::Make(other_batch->schema(), &decoder));
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_RAISES(Invalid, decoder->Decode(*message, &result));
+
+  // The body is too short
+  auto truncated = SliceBuffer(message->body(), 0, message->body()->size() / 2);
+  std::unique_ptr<Message> truncated_message;
+  ASSERT_OK(Message::Open(message->metadata(), truncated, &truncated_message));
+  ASSERT_OK(RecordBatchDecoder::Make(batch->schema(), &decoder));
+  ASSERT_RAISES(Invalid, decoder->Decode(*truncated_message, &result));
+}
+
 TEST_P(TestIpcRoundTrip, SliceRoundTrip) {
   std::shared_ptr<RecordBatch> batch;
   ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
@@ -575,14 +620,13 @@ class TestFileFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
   }
   void TearDown() {}
 
-  Status RoundTripHelper(const BatchVector& in_batches, BatchVector* out_batches) {
+  Status WriteAndOpen(const BatchVector& in_batches,
+                      std::shared_ptr<RecordBatchFileReader>* reader) {
     // Write the file
     std::shared_ptr<RecordBatchWriter> writer;
     RETURN_NOT_OK(
         RecordBatchFileWriter::Open(sink_.get(), in_batches[0]->schema(), &writer));
 
-    const int num_batches = static_cast<int>(in_batches.size());
-
     for (const auto& batch : in_batches) {
       RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
     }
@@ -594,9 +638,14 @@ class TestFileFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
     RETURN_NOT_OK(sink_->Tell(&footer_offset));
 
     // Open the file
-    auto buf_reader = std::make_shared<io::BufferReader>(buffer_);
+    buf_reader_ = std::make_shared<io::BufferReader>(buffer_);
+    return RecordBatchFileReader::Open(buf_reader_, footer_offset, reader);
+  }
+
+  Status RoundTripHelper(const BatchVector& in_batches, BatchVector* out_batches) {
+    const int num_batches = static_cast<int>(in_batches.size());
     std::shared_ptr<RecordBatchFileReader> reader;
-    RETURN_NOT_OK(RecordBatchFileReader::Open(buf_reader.get(), footer_offset, &reader));
+    RETURN_NOT_OK(WriteAndOpen(in_batches, &reader));
 
     EXPECT_EQ(num_batches, reader->num_record_batches());
     for (int i = 0; i < num_batches; ++i) {
@@ -613,6 +662,7 @@ class TestFileFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
 
   std::unique_ptr<io::BufferOutputStream> sink_;
   std::shared_ptr<ResizableBuffer> buffer_;
+  std::shared_ptr<io::BufferReader> buf_reader_;
 };
 
 TEST_P(TestFileFormat, RoundTrip) {
@@ -641,11 +691,12 @@ class TestStreamFormat : public ::testing::TestWithParam<MakeRecordBatch*> {
   }
   void TearDown() {}
 
-  Status RoundTripHelper(const BatchVector& batches, BatchVector* out_batches) {
+  Status RoundTripHelper(const BatchVector& batches, BatchVector* out_batches,
+                         const IpcWriteOptions& options = IpcWriteOptions::Defaults()) {
     // Write the file
     std::shared_ptr<RecordBatchWriter> writer;
-    RETURN_NOT_OK(
-        RecordBatchStreamWriter::Open(sink_.get(), batches[0]->schema(), &writer));
+    RETURN_NOT_OK(RecordBatchStreamWriter::Open(sink_.get(), batches[0]->schema(),
+                                                options, &writer));
 
     for (const auto& batch : batches) {
       RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
@@ -744,6 +795,60 @@ TEST_F(TestStreamFormat, DictionaryRoundTrip) {
   CheckBatchDictionaries(*out_batches[0]);
 }
 
+// Batches whose dictionaries are extended, then replaced
+static void MakeEvolvingDictionaryBatches(BatchVector* out) {
+  std::vector<std::vector<std::string>> dictionary_values = {
+      {"foo", "bar"}, {"foo", "bar", "baz", "qux"}, {"foo", "bar", "baz", "qux"}, {"x"}};
+  std::vector<std::vector<int32_t>> index_values = {
+      {0, 1, 1}, {3, 2, 0}, {1, 1, 3}, {0, 0, 0}};
+  std::shared_ptr<Array> dictionary;
+  for (size_t i = 0; i < dictionary_values.size(); ++i) {
+    // The second and third batches share their dictionary array
+    if (i != 2) {
+      ArrayFromVector<StringType, std::string>(dictionary_values[i], &dictionary);
+    }
+    auto type = arrow::dictionary(int32(), dictionary);
+    std::shared_ptr<Array> indices;
+    ArrayFromVector<Int32Type, int32_t>(index_values[i], &indices);
+    auto array = std::make_shared<DictionaryArray>(type, indices);
+    // Two fields sharing the dictionary
+    auto schema = ::arrow::schema({field("f0", type), field("f1", type)});
+    out->push_back(RecordBatch::Make(schema, array->length(), {array, array}));
+  }
+}
+
+TEST_F(TestStreamFormat, DictionaryDeltasAndReplacements) {
+  BatchVector in_batches, out_batches;
+  MakeEvolvingDictionaryBatches(&in_batches);
+  ASSERT_OK(RoundTripHelper(in_batches, &out_batches));
+
+  ASSERT_EQ(in_batches.size(), out_batches.size());
+  for (size_t i = 0; i < in_batches.size(); ++i) {
+    ASSERT_TRUE(in_batches[i]->Equals(*out_batches[i])) << i;
+  }
+}
+
+TEST(TestConcatenateDictionaries, Basics) {
+  std::shared_ptr<Array> left, right, expected, out;
+  ArrayFromVector<StringType, std::string>({"a", "bc"}, &left);
+  ArrayFromVector<StringType, std::string>({"xyz", "d", "e"}, &right);
+  ArrayFromVector<StringType, std::string>({"a", "bc", "d", "e"}, &expected);
+  ASSERT_OK(internal::ConcatenateDictionaries(*left, *right->Slice(1),
+                                              default_memory_pool(), &out));
+  AssertArraysEqual(*expected, *out);
+
+  ArrayFromVector<Int16Type, int16_t>({true, false}, {1, 2}, &left);
+  ArrayFromVector<Int16Type, int16_t>({3}, &right);
+  ArrayFromVector<Int16Type, int16_t>({true, false, true}, {1, 2, 3}, &expected);
+  ASSERT_OK(
+      internal::ConcatenateDictionaries(*left, *right, default_memory_pool(), &out));
+  AssertArraysEqual(*expected, *out);
+
+  ArrayFromVector<StringType, std::string>({"a"}, &right);
+  ASSERT_RAISES(Invalid, internal::ConcatenateDictionaries(*left, *right,
+                                                           default_memory_pool(), &out));
+}
+
 TEST_F(TestStreamFormat, WriteTable) {
   std::shared_ptr<RecordBatch> b1, b2, b3;
   ASSERT_OK(MakeIntRecordBatch(&b1));
@@ -758,6 +863,197 @@ TEST_F(TestStreamFormat, WriteTable) {
   ASSERT_TRUE(b3->Equals(*out_batches[2]));
 }
 
+#if defined(ARROW_WITH_LZ4) && defined(ARROW_WITH_ZSTD)
+TEST_F(TestStreamFormat, CompressedRoundTrip) {
+  std::shared_ptr<RecordBatch> batch, dictionary_batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  ASSERT_OK(MakeDictionary(&dictionary_batch));
+
+  for (auto compression : {Compression::LZ4, Compression::ZSTD}) {
+    for (bool use_threads : {false, true}) {
+      auto options = IpcWriteOptions::Defaults();
+      options.compression = compression;
+      options.use_threads = use_threads;
+      // Also exercise the buffers too small to be compressed
+      options.min_compression_size = 64;
+
+      SetUp();
+      BatchVector out_batches;
+      ASSERT_OK(RoundTripHelper({batch, batch}, &out_batches, options));
+      ASSERT_EQ(2, out_batches.size());
+      CompareBatch(*batch, *out_batches[0]);
+      CompareBatch(*batch, *out_batches[1]);
+
+      SetUp();
+      ASSERT_OK(RoundTripHelper({dictionary_batch}, &out_batches, options));
+      CheckBatchDictionaries(*out_batches[0]);
+    }
+  }
+}
+
+TEST_F(TestStreamFormat, CompressedReadPool) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  auto write_options = IpcWriteOptions::Defaults();
+  write_options.compression = Compression::LZ4;
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(sink_.get(), batch->schema(), write_options,
+                                          &writer));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  // The decompressed buffers are allocated from the pool of the read options
+  ProxyMemoryPool read_pool(default_memory_pool());
+  auto options = MessageReaderOptions::Defaults();
+  options.pool = &read_pool;
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(std::make_shared<io::BufferReader>(buffer_),
+                                          options, &reader));
+  std::shared_ptr<RecordBatch> out;
+  ASSERT_OK(reader->ReadNext(&out));
+  CompareBatch(*batch, *out);
+  ASSERT_GT(read_pool.bytes_allocated(), 0);
+}
+#endif
+
+TEST_F(TestStreamFormat, ReuseMessageBuffers) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  std::shared_ptr<RecordBatchWriter> writer;
+  ASSERT_OK(RecordBatchStreamWriter::Open(sink_.get(), batch->schema(), &writer));
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(sink_->Close());
+
+  // Buffers are only reused for streams not supporting zero-copy reads
+  std::shared_ptr<io::BufferedInputStream> stream;
+  ASSERT_OK(io::BufferedInputStream::Create(
+      1 << 10, pool_, std::make_shared<io::BufferReader>(buffer_), &stream));
+  auto options = MessageReaderOptions::Defaults();
+  options.reuse_buffers = true;
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(stream, options, &reader));
+
+  auto data_address = [](const RecordBatch& batch) {
+    return batch.column(0)->data()->buffers[1]->data();
+  };
+  std::shared_ptr<RecordBatch> first, second, third;
+  ASSERT_OK(reader->ReadNext(&first));
+  ASSERT_OK(reader->ReadNext(&second));
+  // The first batch is still alive
+  ASSERT_NE(data_address(*first), data_address(*second));
+  CompareBatch(*batch, *first);
+  CompareBatch(*batch, *second);
+
+  const uint8_t* second_address = data_address(*second);
+  second.reset();
+  ASSERT_OK(reader->ReadNext(&third));
+  ASSERT_EQ(second_address, data_address(*third));
+  CompareBatch(*batch, *third);
+
+  ASSERT_OK(reader->ReadNext(&third));
+  ASSERT_EQ(nullptr, third);
+}
+
+TEST_F(TestStreamFormat, InvalidCompression) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  auto options = IpcWriteOptions::Defaults();
+  options.compression = Compression::BROTLI;
+  BatchVector out_batches;
+  ASSERT_RAISES(Invalid, RoundTripHelper({batch}, &out_batches, options));
+}
+
+TEST_P(TestFileFormat, ReadFieldSubset) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(WriteAndOpen({batch, batch}, &reader));
+
+  // Each field alone, then all of them in reverse order
+  std::vector<std::vector<int>> subsets;
+  std::vector<int> reversed;
+  for (int i = 0; i < batch->num_columns(); ++i) {
+    subsets.push_back({i});
+    reversed.insert(reversed.begin(), i);
+  }
+  subsets.push_back(reversed);
+
+  for (const auto& field_indices : subsets) {
+    std::shared_ptr<RecordBatch> subset;
+    ASSERT_OK(reader->ReadRecordBatch(1, field_indices, &subset));
+    ASSERT_EQ(static_cast<int>(field_indices.size()), subset->num_columns());
+    ASSERT_EQ(batch->num_rows(), subset->num_rows());
+    for (int j = 0; j < subset->num_columns(); ++j) {
+      ASSERT_TRUE(subset->schema()->field(j)->Equals(
+          batch->schema()->field(field_indices[j])));
+      AssertArraysEqual(*batch->column(field_indices[j]), *subset->column(j));
+    }
+  }
+
+  std::shared_ptr<RecordBatch> subset;
+  ASSERT_RAISES(Invalid, reader->ReadRecordBatch(0, {batch->num_columns()}, &subset));
+}
+
+TEST_F(TestFileFormat, WideTableParallelWrite) {
+  // Sliced columns, so that laying them out copies bitmaps and offsets
+  const int num_columns = 200;
+  const int64_t length = 300;
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < num_columns; ++i) {
+    std::shared_ptr<Array> column;
+    if (i % 2 == 0) {
+      ASSERT_OK(MakeRandomInt32Array(length + 3, true, pool_, &column));
+    } else {
+      ASSERT_OK(MakeRandomBinaryArray(length + 3, true, pool_, &column));
+    }
+    columns.push_back(column->Slice(3));
+    fields.push_back(field("f" + std::to_string(i), column->type()));
+  }
+  auto batch = RecordBatch::Make(::arrow::schema(fields), length, columns);
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch}, &table));
+
+  std::vector<std::shared_ptr<Buffer>> files;
+  for (bool use_threads : {false, true}) {
+    SetUp();
+    auto options = IpcWriteOptions::Defaults();
+    options.use_threads = use_threads;
+    std::shared_ptr<RecordBatchWriter> writer;
+    ASSERT_OK(
+        RecordBatchFileWriter::Open(sink_.get(), table->schema(), options, &writer));
+    ASSERT_OK(writer->WriteTable(*table, 100));
+    ASSERT_OK(writer->Close());
+    ASSERT_OK(sink_->Close());
+    files.push_back(buffer_);
+  }
+  // The layout doesn't depend on the threading
+  AssertBufferEqual(*files[1], *files[0]);
+
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(RecordBatchFileReader::Open(std::make_shared<io::BufferReader>(files[1]),
+                                        &reader));
+  ASSERT_EQ(3, reader->num_record_batches());
+  for (int i = 0; i < 3; ++i) {
+    std::shared_ptr<RecordBatch> chunk;
+    ASSERT_OK(reader->ReadRecordBatch(i, &chunk));
+    CompareBatch(*batch->Slice(i * 100, 100), *chunk);
+  }
+}
+
+TEST_F(TestFileFormat, DictionaryChangesUnsupported) {
+  BatchVector in_batches, out_batches;
+  MakeEvolvingDictionaryBatches(&in_batches);
+  ASSERT_RAISES(Invalid, RoundTripHelper(in_batches, &out_batches));
+}
+
 TEST_F(TestFileFormat, DictionaryRoundTrip) {
   std::shared_ptr<RecordBatch> batch;
   ASSERT_OK(MakeDictionary(&batch));
@@ -854,6 +1150,16 @@ class TestSparseTensorRoundTrip : public ::testing::Test, public IpcTestFixture
   void CheckSparseTensorRoundTrip(const SparseTensorImpl<SparseIndexType>& tensor) {
     GTEST_FAIL();
   }
+
+  // Check that the buffer read back references the memory map
+  void AssertZeroCopy(const std::shared_ptr<Buffer>& buffer) {
+    int64_t size = 0;
+    ASSERT_OK(mmap_->GetSize(&size));
+    std::shared_ptr<Buffer> region;
+    ASSERT_OK(mmap_->ReadAt(0, size, &region));
+    ASSERT_GE(buffer->data(), region->data());
+    ASSERT_LE(buffer->data() + buffer->size(), region->data() + region->size());
+  }
 };
 
 template <>
@@ -885,7 +1191,9 @@ void TestSparseTensorRoundTrip::CheckSparseTensorRoundTrip<SparseCOOIndex>(
       checked_cast<const SparseCOOIndex&>(*result->sparse_index());
   ASSERT_EQ(resulted_sparse_index.indices()->data()->size(), indices_length);
   ASSERT_EQ(result->data()->size(), data_length);
-  ASSERT_TRUE(result->Equals(*result));
+  ASSERT_TRUE(result->Equals(tensor));
+  AssertZeroCopy(resulted_sparse_index.indices()->data());
+  AssertZeroCopy(result->data());
 }
 
 template <>
@@ -919,7 +1227,77 @@ void TestSparseTensorRoundTrip::CheckSparseTensorRoundTrip<SparseCSRIndex>(
   ASSERT_EQ(resulted_sparse_index.indptr()->data()->size(), indptr_length);
   ASSERT_EQ(resulted_sparse_index.indices()->data()->size(), indices_length);
   ASSERT_EQ(result->data()->size(), data_length);
-  ASSERT_TRUE(result->Equals(*result));
+  ASSERT_TRUE(result->Equals(tensor));
+  AssertZeroCopy(resulted_sparse_index.indptr()->data());
+  AssertZeroCopy(resulted_sparse_index.indices()->data());
+  AssertZeroCopy(result->data());
+}
+
+template <>
+void TestSparseTensorRoundTrip::CheckSparseTensorRoundTrip<SparseCSCIndex>(
+    const SparseTensorImpl<SparseCSCIndex>& tensor) {
+  const auto& type = checked_cast<const FixedWidthType&>(*tensor.type());
+  const int elem_size = type.bit_width() / 8;
+
+  int32_t metadata_length;
+  int64_t body_length;
+
+  ASSERT_OK(mmap_->Seek(0));
+
+  ASSERT_OK(WriteSparseTensor(tensor, mmap_.get(), &metadata_length, &body_length,
+                              default_memory_pool()));
+
+  const auto& sparse_index = checked_cast<const SparseCSCIndex&>(*tensor.sparse_index());
+  const int64_t indptr_length = elem_size * sparse_index.indptr()->size();
+  const int64_t indices_length = elem_size * sparse_index.indices()->size();
+  const int64_t data_length = elem_size * tensor.non_zero_length();
+  const int64_t expected_body_length = indptr_length + indices_length + data_length;
+  ASSERT_EQ(expected_body_length, body_length);
+
+  ASSERT_OK(mmap_->Seek(0));
+
+  std::shared_ptr<SparseTensor> result;
+  ASSERT_OK(ReadSparseTensor(mmap_.get(), &result));
+  ASSERT_EQ(SparseTensorFormat::CSC, result->format_id());
+
+  const auto& resulted_sparse_index =
+      checked_cast<const SparseCSCIndex&>(*result->sparse_index());
+  ASSERT_EQ(resulted_sparse_index.indptr()->data()->size(), indptr_length);
+  ASSERT_EQ(resulted_sparse_index.indices()->data()->size(), indices_length);
+  ASSERT_EQ(result->data()->size(), data_length);
+  ASSERT_TRUE(result->Equals(tensor));
+  AssertZeroCopy(resulted_sparse_index.indices()->data());
+  AssertZeroCopy(result->data());
+}
+
+template <>
+void TestSparseTensorRoundTrip::CheckSparseTensorRoundTrip<SparseCSFIndex>(
+    const SparseTensorImpl<SparseCSFIndex>& tensor) {
+  int32_t metadata_length;
+  int64_t body_length;
+
+  ASSERT_OK(mmap_->Seek(0));
+
+  ASSERT_OK(WriteSparseTensor(tensor, mmap_.get(), &metadata_length, &body_length,
+                              default_memory_pool()));
+
+  ASSERT_OK(mmap_->Seek(0));
+
+  std::shared_ptr<SparseTensor> result;
+  ASSERT_OK(ReadSparseTensor(mmap_.get(), &result));
+  ASSERT_EQ(SparseTensorFormat::CSF, result->format_id());
+
+  const auto& sparse_index = checked_cast<const SparseCSFIndex&>(*tensor.sparse_index());
+  const auto& resulted_sparse_index =
+      checked_cast<const SparseCSFIndex&>(*result->sparse_index());
+  ASSERT_EQ(sparse_index.axis_order(), resulted_sparse_index.axis_order());
+  ASSERT_EQ(sparse_index.indptr().size(), resulted_sparse_index.indptr().size());
+  ASSERT_EQ(sparse_index.indices().size(), resulted_sparse_index.indices().size());
+  ASSERT_TRUE(result->Equals(tensor));
+  for (const auto& indices : resulted_sparse_index.indices()) {
+    AssertZeroCopy(indices->data());
+  }
+  AssertZeroCopy(result->data());
 }
 
 TEST_F(TestSparseTensorRoundTrip, WithSparseCOOIndex) {
@@ -956,6 +1334,40 @@ TEST_F(TestSparseTensorRoundTrip, WithSparseCSRIndex) {
   CheckSparseTensorRoundTrip(st);
 }
 
+TEST_F(TestSparseTensorRoundTrip, WithSparseCSCIndex) {
+  std::string path = "test-write-sparse-csc-matrix";
+  constexpr int64_t kBufferSize = 1 << 20;
+  ASSERT_OK(io::MemoryMapFixture::InitMemoryMap(kBufferSize, path, &mmap_));
+
+  std::vector<int64_t> shape = {4, 6};
+  std::vector<std::string> dim_names = {"foo", "bar"};
+  std::vector<int64_t> values = {1, 0,  2, 0,  0,  3, 0,  4, 5, 0,  6, 0,
+                                 0, 11, 0, 12, 13, 0, 14, 0, 0, 15, 0, 16};
+
+  auto data = Buffer::Wrap(values);
+  NumericTensor<Int64Type> t(data, shape, {}, dim_names);
+  SparseTensorImpl<SparseCSCIndex> st(t);
+
+  CheckSparseTensorRoundTrip(st);
+}
+
+TEST_F(TestSparseTensorRoundTrip, WithSparseCSFIndex) {
+  std::string path = "test-write-sparse-csf-tensor";
+  constexpr int64_t kBufferSize = 1 << 20;
+  ASSERT_OK(io::MemoryMapFixture::InitMemoryMap(kBufferSize, path, &mmap_));
+
+  std::vector<int64_t> shape = {2, 3, 4};
+  std::vector<std::string> dim_names = {"foo", "bar", "baz"};
+  std::vector<int32_t> values = {1, 0,  2, 0,  0,  3, 0,  4, 5, 0,  6, 0,
+                                 0, 11, 0, 12, 13, 0, 14, 0, 0, 15, 0, 16};
+
+  auto data = Buffer::Wrap(values);
+  NumericTensor<Int32Type> t(data, shape, {}, dim_names);
+  SparseTensorImpl<SparseCSFIndex> st(t);
+
+  CheckSparseTensorRoundTrip(st);
+}
+
 TEST(TestRecordBatchStreamReader, MalformedInput) {
   const std::string empty_str = "";
   const std::string garbage_str = "12345678";
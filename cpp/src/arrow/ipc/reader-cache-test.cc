@@ -0,0 +1,167 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/io/file.h"
+#include "arrow/io/test-common.h"
+#include "arrow/ipc/feather.h"
+#include "arrow/ipc/reader-cache.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/test-common.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace ipc {
+
+class TestReaderCache : public ::testing::Test, public io::MemoryMapFixture {
+ public:
+  void SetUp() { ASSERT_OK(ReaderCache::Make(1 << 20, &cache_)); }
+
+  void TearDown() { io::MemoryMapFixture::TearDown(); }
+
+  // Write an IPC file of `num_batches` copies of a batch, returning its size
+  void WriteFile(const std::string& path, int num_batches, int64_t* size) {
+    AppendFile(path);
+    ASSERT_OK(MakeIntRecordBatch(&batch_));
+    std::shared_ptr<io::FileOutputStream> sink;
+    ASSERT_OK(io::FileOutputStream::Open(path, &sink));
+    std::shared_ptr<RecordBatchWriter> writer;
+    ASSERT_OK(RecordBatchFileWriter::Open(sink.get(), batch_->schema(), &writer));
+    for (int i = 0; i < num_batches; ++i) {
+      ASSERT_OK(writer->WriteRecordBatch(*batch_));
+    }
+    ASSERT_OK(writer->Close());
+    ASSERT_OK(sink->Tell(size));
+    ASSERT_OK(sink->Close());
+  }
+
+  void WriteFeather(const std::string& path) {
+    AppendFile(path);
+    ASSERT_OK(MakeIntRecordBatch(&batch_));
+    std::shared_ptr<io::FileOutputStream> sink;
+    ASSERT_OK(io::FileOutputStream::Open(path, &sink));
+    std::unique_ptr<feather::TableWriter> writer;
+    ASSERT_OK(feather::TableWriter::Open(sink, &writer));
+    ASSERT_OK(writer->Append("f0", *batch_->column(0)));
+    ASSERT_OK(writer->Finalize());
+    ASSERT_OK(sink->Close());
+  }
+
+ protected:
+  std::shared_ptr<ReaderCache> cache_;
+  std::shared_ptr<RecordBatch> batch_;
+};
+
+TEST_F(TestReaderCache, OpenFile) {
+  const std::string path = "arrow-test-ipc-reader-cache-file";
+  int64_t size;
+  WriteFile(path, 1, &size);
+
+  std::shared_ptr<RecordBatchFileReader> reader, cached;
+  ASSERT_OK(cache_->OpenFile(path, &reader));
+  ASSERT_OK(cache_->OpenFile(path, &cached));
+  ASSERT_EQ(reader, cached);
+  ASSERT_EQ(1, cache_->hits());
+  ASSERT_EQ(1, cache_->misses());
+  ASSERT_EQ(size, cache_->bytes_mapped());
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(cached->ReadRecordBatch(0, &result));
+  CompareBatch(*batch_, *result);
+
+  // Rewriting the file invalidates the reader
+  WriteFile(path, 2, &size);
+  ASSERT_OK(cache_->OpenFile(path, &cached));
+  ASSERT_NE(reader, cached);
+  ASSERT_EQ(2, cached->num_record_batches());
+  ASSERT_EQ(2, cache_->misses());
+  ASSERT_EQ(size, cache_->bytes_mapped());
+
+  cache_->Invalidate(path);
+  ASSERT_EQ(0, cache_->bytes_mapped());
+  ASSERT_RAISES(IOError, cache_->OpenFile("arrow-test-ipc-no-such-file", &reader));
+}
+
+TEST_F(TestReaderCache, Eviction) {
+  const std::string path1 = "arrow-test-ipc-reader-cache-1";
+  const std::string path2 = "arrow-test-ipc-reader-cache-2";
+  int64_t size1, size2;
+  WriteFile(path1, 1, &size1);
+  WriteFile(path2, 1, &size2);
+  ASSERT_OK(cache_->SetCapacity(size1 + size2 - 1));
+
+  std::shared_ptr<RecordBatchFileReader> reader1, reader2, reader;
+  ASSERT_OK(cache_->OpenFile(path1, &reader1));
+  ASSERT_OK(cache_->OpenFile(path2, &reader2));
+  ASSERT_EQ(size2, cache_->bytes_mapped());
+
+  // The least recently used file was evicted, but its reader is still usable
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader1->ReadRecordBatch(0, &result));
+  CompareBatch(*batch_, *result);
+  ASSERT_OK(cache_->OpenFile(path2, &reader));
+  ASSERT_EQ(reader2, reader);
+  ASSERT_OK(cache_->OpenFile(path1, &reader));
+  ASSERT_NE(reader1, reader);
+  ASSERT_EQ(1, cache_->hits());
+  ASSERT_EQ(3, cache_->misses());
+
+  // Files larger than the capacity are not cached
+  ASSERT_OK(cache_->SetCapacity(0));
+  ASSERT_EQ(0, cache_->bytes_mapped());
+  ASSERT_OK(cache_->OpenFile(path1, &reader));
+  ASSERT_EQ(0, cache_->bytes_mapped());
+  ASSERT_RAISES(Invalid, cache_->SetCapacity(-1));
+}
+
+TEST_F(TestReaderCache, OpenFeather) {
+  const std::string path = "arrow-test-ipc-reader-cache-feather";
+  WriteFeather(path);
+
+  std::shared_ptr<feather::TableReader> reader, cached;
+  ASSERT_OK(cache_->OpenFeather(path, &reader));
+  ASSERT_OK(cache_->OpenFeather(path, &cached));
+  ASSERT_EQ(reader, cached);
+  ASSERT_EQ(1, reader->num_columns());
+
+  // A Feather file is not an IPC file; the Feather reader stays cached
+  std::shared_ptr<RecordBatchFileReader> file_reader;
+  ASSERT_RAISES(Invalid, cache_->OpenFile(path, &file_reader));
+  ASSERT_OK(cache_->OpenFeather(path, &cached));
+  ASSERT_EQ(reader, cached);
+
+  cache_->Clear();
+  ASSERT_EQ(0, cache_->bytes_mapped());
+  ASSERT_OK(cache_->OpenFeather(path, &cached));
+  ASSERT_NE(reader, cached);
+}
+
+TEST(ReaderCache, Global) {
+  ASSERT_EQ(ReaderCache::Global(), ReaderCache::Global());
+  ASSERT_EQ(ReaderCache::kDefaultCapacity, ReaderCache::Global()->capacity());
+}
+
+}  // namespace ipc
+}  // namespace arrow
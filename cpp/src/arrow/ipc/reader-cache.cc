@@ -0,0 +1,256 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/reader-cache.h"
+
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/io/file.h"
+#include "arrow/ipc/feather.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/status.h"
+#include "arrow/util/io-util.h"
+
+namespace arrow {
+namespace ipc {
+
+constexpr int64_t ReaderCache::kDefaultCapacity;
+
+namespace {
+
+Status OpenReader(const std::shared_ptr<io::MemoryMappedFile>& file,
+                  std::shared_ptr<RecordBatchFileReader>* out) {
+  return RecordBatchFileReader::Open(file, out);
+}
+
+Status OpenReader(const std::shared_ptr<io::MemoryMappedFile>& file,
+                  std::shared_ptr<feather::TableReader>* out) {
+  std::unique_ptr<feather::TableReader> reader;
+  RETURN_NOT_OK(feather::TableReader::Open(file, &reader));
+  *out = std::move(reader);
+  return Status::OK();
+}
+
+}  // namespace
+
+class ReaderCache::Impl {
+ public:
+  explicit Impl(int64_t capacity)
+      : capacity_(capacity), bytes_mapped_(0), hits_(0), misses_(0) {}
+
+  Status OpenFile(const std::string& path, std::shared_ptr<RecordBatchFileReader>* out) {
+    return Open(path, &Entry::ipc_reader, out);
+  }
+
+  Status OpenFeather(const std::string& path,
+                     std::shared_ptr<feather::TableReader>* out) {
+    return Open(path, &Entry::feather_reader, out);
+  }
+
+  void Invalidate(const std::string& path) {
+    std::lock_guard<std::mutex> guard(lock_);
+    auto it = entries_.find(path);
+    if (it != entries_.end()) {
+      Erase(it->second);
+    }
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> guard(lock_);
+    entries_.clear();
+    lru_.clear();
+    bytes_mapped_ = 0;
+  }
+
+  void SetCapacity(int64_t capacity) {
+    std::lock_guard<std::mutex> guard(lock_);
+    capacity_ = capacity;
+    Evict();
+  }
+
+  int64_t capacity() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return capacity_;
+  }
+
+  int64_t bytes_mapped() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return bytes_mapped_;
+  }
+
+  int64_t hits() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return hits_;
+  }
+
+  int64_t misses() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return misses_;
+  }
+
+ private:
+  // A mapped file, with the readers opened on it so far
+  struct Entry {
+    std::string path;
+    int64_t size;
+    int64_t mtime_ns;
+    std::shared_ptr<io::MemoryMappedFile> file;
+    std::shared_ptr<RecordBatchFileReader> ipc_reader;
+    std::shared_ptr<feather::TableReader> feather_reader;
+  };
+
+  template <typename Reader>
+  Status Open(const std::string& path, std::shared_ptr<Reader> Entry::*member,
+              std::shared_ptr<Reader>* out) {
+    int64_t size, mtime_ns;
+    internal::PlatformFilename file_name;
+    RETURN_NOT_OK(internal::FileNameFromString(path, &file_name));
+    Status st = internal::FileGetStatus(file_name, &size, &mtime_ns);
+    if (!st.ok()) {
+      Invalidate(path);
+      return st;
+    }
+
+    // Look up the reader, or at least the mapped file
+    std::shared_ptr<io::MemoryMappedFile> file;
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      auto it = entries_.find(path);
+      if (it != entries_.end()) {
+        Entry& entry = *it->second;
+        if (entry.size == size && entry.mtime_ns == mtime_ns) {
+          // Move to the front of the LRU list
+          lru_.splice(lru_.begin(), lru_, it->second);
+          if (entry.*member) {
+            ++hits_;
+            *out = entry.*member;
+            return Status::OK();
+          }
+          file = entry.file;
+        } else {
+          Erase(it->second);
+        }
+      }
+      ++misses_;
+    }
+
+    // Map the file and read its metadata without holding the lock
+    if (file == nullptr) {
+      RETURN_NOT_OK(io::MemoryMappedFile::Open(path, io::FileMode::READ, &file));
+    }
+    std::shared_ptr<Reader> reader;
+    RETURN_NOT_OK(OpenReader(file, &reader));
+
+    std::lock_guard<std::mutex> guard(lock_);
+    *out = reader;
+    auto it = entries_.find(path);
+    if (it != entries_.end() && it->second->file != file) {
+      // The file was replaced, or opened by another caller, in the meantime
+      Erase(it->second);
+      it = entries_.end();
+    }
+    if (it == entries_.end()) {
+      if (size > capacity_) {
+        return Status::OK();
+      }
+      lru_.push_front(Entry{path, size, mtime_ns, file, nullptr, nullptr});
+      it = entries_.emplace(path, lru_.begin()).first;
+      bytes_mapped_ += size;
+      Evict();
+    }
+    (*it->second).*member = reader;
+    return Status::OK();
+  }
+
+  void Erase(std::list<Entry>::iterator entry) {
+    bytes_mapped_ -= entry->size;
+    entries_.erase(entry->path);
+    lru_.erase(entry);
+  }
+
+  void Evict() {
+    while (bytes_mapped_ > capacity_) {
+      Erase(std::prev(lru_.end()));
+    }
+  }
+
+  int64_t capacity_;
+  // Most recently used first
+  std::list<Entry> lru_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> entries_;
+  int64_t bytes_mapped_;
+  int64_t hits_;
+  int64_t misses_;
+  mutable std::mutex lock_;
+};
+
+ReaderCache::ReaderCache(int64_t capacity) : impl_(new Impl(capacity)) {}
+
+ReaderCache::~ReaderCache() {}
+
+Status ReaderCache::Make(int64_t capacity, std::shared_ptr<ReaderCache>* out) {
+  if (capacity < 0) {
+    return Status::Invalid("Cache capacity should be non-negative, got ", capacity);
+  }
+  out->reset(new ReaderCache(capacity));
+  return Status::OK();
+}
+
+ReaderCache* ReaderCache::Global() {
+  static ReaderCache cache(kDefaultCapacity);
+  return &cache;
+}
+
+Status ReaderCache::OpenFile(const std::string& path,
+                             std::shared_ptr<RecordBatchFileReader>* out) {
+  return impl_->OpenFile(path, out);
+}
+
+Status ReaderCache::OpenFeather(const std::string& path,
+                                std::shared_ptr<feather::TableReader>* out) {
+  return impl_->OpenFeather(path, out);
+}
+
+void ReaderCache::Invalidate(const std::string& path) { impl_->Invalidate(path); }
+
+void ReaderCache::Clear() { impl_->Clear(); }
+
+Status ReaderCache::SetCapacity(int64_t capacity) {
+  if (capacity < 0) {
+    return Status::Invalid("Cache capacity should be non-negative, got ", capacity);
+  }
+  impl_->SetCapacity(capacity);
+  return Status::OK();
+}
+
+int64_t ReaderCache::capacity() const { return impl_->capacity(); }
+
+int64_t ReaderCache::bytes_mapped() const { return impl_->bytes_mapped(); }
+
+int64_t ReaderCache::hits() const { return impl_->hits(); }
+
+int64_t ReaderCache::misses() const { return impl_->misses(); }
+
+}  // namespace ipc
+}  // namespace arrow
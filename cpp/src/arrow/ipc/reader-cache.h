@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Cache of opened readers of memory-mapped IPC and Feather files
+
+#ifndef ARROW_IPC_READER_CACHE_H
+#define ARROW_IPC_READER_CACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Status;
+
+namespace ipc {
+
+class RecordBatchFileReader;
+
+namespace feather {
+
+class TableReader;
+
+}  // namespace feather
+
+/// \brief An LRU cache of readers of memory-mapped IPC and Feather files
+///
+/// Opening a file through the cache memory-maps it, then reads its footer,
+/// schema and dictionaries once.  Later opens of the same path return the
+/// same reader as long as the size and modification time of the file are
+/// unchanged, so that repeated reads skip all metadata parsing and return
+/// zero-copy record batches.  Files must be replaced (e.g. renamed over)
+/// rather than modified in place while they are mapped.
+///
+/// The least recently used readers are evicted when the total size of the
+/// cached files exceeds the capacity.  A file is unmapped once evicted and
+/// released by all callers, including the arrays read from it.  Files
+/// larger than the capacity are opened but not cached.  This class is
+/// thread-safe.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class ARROW_EXPORT ReaderCache {
+ public:
+  /// The capacity of the global cache, in mapped bytes
+  static constexpr int64_t kDefaultCapacity = int64_t(4) << 30;
+
+  ~ReaderCache();
+
+  /// \brief Create a cache
+  /// \param[in] capacity the maximum number of mapped bytes cached
+  /// \param[out] out the created cache
+  static Status Make(int64_t capacity, std::shared_ptr<ReaderCache>* out);
+
+  /// \brief The process-wide cache
+  static ReaderCache* Global();
+
+  /// \brief Open an IPC file, or return its cached reader
+  Status OpenFile(const std::string& path, std::shared_ptr<RecordBatchFileReader>* out);
+
+  /// \brief Open a Feather file, or return its cached reader
+  Status OpenFeather(const std::string& path,
+                     std::shared_ptr<feather::TableReader>* out);
+
+  /// \brief Drop the cached readers of a path
+  void Invalidate(const std::string& path);
+
+  /// \brief Drop all cached readers
+  void Clear();
+
+  /// \brief Change the capacity, evicting readers if needed
+  Status SetCapacity(int64_t capacity);
+
+  int64_t capacity() const;
+  /// \brief The total size of the cached files
+  int64_t bytes_mapped() const;
+
+  /// \brief The number of opens which found their reader
+  int64_t hits() const;
+  /// \brief The number of opens which didn't find their reader
+  int64_t misses() const;
+
+ private:
+  explicit ReaderCache(int64_t capacity);
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace ipc
+}  // namespace arrow
+
+#endif  // ARROW_IPC_READER_CACHE_H
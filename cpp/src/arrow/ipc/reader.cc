@@ -19,9 +19,11 @@
 
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -29,6 +31,7 @@
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/io/instrumented.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/File_generated.h"  // IWYU pragma: export
@@ -42,9 +45,14 @@
 #include "arrow/status.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 #include "arrow/visitor_inline.h"
 
+using arrow::internal::checked_cast;
 using arrow::internal::checked_pointer_cast;
 
 namespace arrow {
@@ -62,8 +70,11 @@ using internal::kArrowMagicBytes;
 /// Accessor class for flatbuffers metadata
 class IpcComponentSource {
  public:
-  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file)
-      : metadata_(metadata), file_(file) {}
+  /// \param[in] pool the pool of the decompressed buffers
+  /// \param[in] body_offset the position of the message body in the file
+  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file,
+                     MemoryPool* pool, int64_t body_offset = 0)
+      : metadata_(metadata), file_(file), pool_(pool), body_offset_(body_offset) {}
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
     const flatbuf::Buffer* buffer = metadata_->buffers()->Get(buffer_index);
@@ -75,7 +86,18 @@ class IpcComponentSource {
       DCHECK(BitUtil::IsMultipleOf8(buffer->offset()))
           << "Buffer " << buffer_index
           << " did not start on 8-byte aligned offset: " << buffer->offset();
-      return file_->ReadAt(buffer->offset(), buffer->length(), out);
+      auto it = prefetched_.find(buffer_index);
+      if (it != prefetched_.end()) {
+        *out = it->second;
+      } else {
+        RETURN_NOT_OK(
+            file_->ReadAt(body_offset_ + buffer->offset(), buffer->length(), out));
+      }
+      RETURN_NOT_OK(EnsureCodec());
+      if (codec_) {
+        return DecompressBuffer(*out, out);
+      }
+      return Status::OK();
     }
   }
 
@@ -93,9 +115,78 @@ class IpcComponentSource {
     return Status::OK();
   }
 
+  /// \brief Read the given buffers at once, coalescing nearby ranges, for
+  /// the following GetBuffer calls
+  Status Prefetch(const std::vector<int>& buffer_indices) {
+    std::vector<int> indices;
+    std::vector<io::ReadRange> ranges;
+    for (int buffer_index : buffer_indices) {
+      const flatbuf::Buffer* buffer = metadata_->buffers()->Get(buffer_index);
+      if (buffer->length() > 0) {
+        indices.push_back(buffer_index);
+        ranges.push_back({body_offset_ + buffer->offset(), buffer->length()});
+      }
+    }
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    RETURN_NOT_OK(file_->ReadRanges(ranges, &buffers));
+    for (size_t i = 0; i < indices.size(); ++i) {
+      prefetched_[indices[i]] = std::move(buffers[i]);
+    }
+    return Status::OK();
+  }
+
  private:
+  // Create the codec of the body buffers, if they are compressed
+  Status EnsureCodec() {
+    if (codec_checked_) {
+      return Status::OK();
+    }
+    Compression::type compression;
+    RETURN_NOT_OK(internal::GetBodyCompression(metadata_, &compression));
+    if (compression != Compression::UNCOMPRESSED) {
+      RETURN_NOT_OK(util::Codec::Create(compression, &codec_));
+    }
+    codec_checked_ = true;
+    return Status::OK();
+  }
+
+  // Body buffers are prefixed with their uncompressed length, or -1 if
+  // they were left uncompressed
+  Status DecompressBuffer(const std::shared_ptr<Buffer>& buffer,
+                          std::shared_ptr<Buffer>* out) {
+    const int64_t prefix_size = static_cast<int64_t>(sizeof(int64_t));
+    if (buffer->size() < prefix_size) {
+      return Status::Invalid("Compressed IPC buffer of size ", buffer->size(),
+                             " lacks its length prefix");
+    }
+    int64_t uncompressed_length;
+    std::memcpy(&uncompressed_length, buffer->data(), prefix_size);
+    uncompressed_length = BitUtil::FromLittleEndian(uncompressed_length);
+    if (uncompressed_length == -1) {
+      *out = SliceBuffer(buffer, prefix_size, buffer->size() - prefix_size);
+      return Status::OK();
+    }
+    if (uncompressed_length < 0) {
+      return Status::Invalid("Invalid uncompressed length in IPC buffer: ",
+                             uncompressed_length);
+    }
+    ARROW_TRACE_SPAN("ipc", "decompress");
+    std::shared_ptr<Buffer> result;
+    RETURN_NOT_OK(AllocateBuffer(pool_, uncompressed_length, &result));
+    RETURN_NOT_OK(codec_->Decompress(buffer->size() - prefix_size,
+                                     buffer->data() + prefix_size, uncompressed_length,
+                                     result->mutable_data()));
+    *out = result;
+    return Status::OK();
+  }
+
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
+  MemoryPool* pool_;
+  int64_t body_offset_;
+  std::unordered_map<int, std::shared_ptr<Buffer>> prefetched_;
+  bool codec_checked_ = false;
+  std::unique_ptr<util::Codec> codec_;
 };
 
 /// Bookkeeping struct for loading array objects from their constituent pieces of raw data
@@ -108,6 +199,11 @@ struct ArrayLoaderContext {
   int buffer_index;
   int field_index;
   int max_recursion_depth;
+  // If true, only walk the metadata of the field, leaving its buffers null
+  bool skip_buffers = false;
+  // If not null, record the indices of the buffers to read instead of
+  // reading them
+  std::vector<int>* planned_buffers = NULLPTR;
 };
 
 static Status LoadArray(const std::shared_ptr<DataType>& type,
@@ -131,6 +227,13 @@ class ArrayLoader {
   }
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
+    if (context_->skip_buffers || context_->planned_buffers != NULLPTR) {
+      if (!context_->skip_buffers) {
+        context_->planned_buffers->push_back(buffer_index);
+      }
+      *out = nullptr;
+      return Status::OK();
+    }
     return context_->source->GetBuffer(buffer_index, out);
   }
 
@@ -281,9 +384,15 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
 
 Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& schema,
                        std::shared_ptr<RecordBatch>* out) {
+  return ReadRecordBatch(message, schema, default_memory_pool(), out);
+}
+
+Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& schema,
+                       MemoryPool* pool, std::shared_ptr<RecordBatch>* out) {
   io::BufferReader reader(message.body());
   DCHECK_EQ(message.type(), Message::RECORD_BATCH);
-  return ReadRecordBatch(*message.metadata(), schema, kMaxNestingDepth, &reader, out);
+  return ReadRecordBatch(*message.metadata(), schema, kMaxNestingDepth, &reader, pool,
+                         out);
 }
 
 // ----------------------------------------------------------------------
@@ -311,11 +420,63 @@ static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
   return Status::OK();
 }
 
+// Load the given fields only, reading their buffers at once
+static Status LoadRecordBatchSubset(const std::shared_ptr<Schema>& schema,
+                                    const std::vector<int>& field_indices,
+                                    int64_t num_rows, int max_recursion_depth,
+                                    IpcComponentSource* source,
+                                    std::shared_ptr<RecordBatch>* out) {
+  std::vector<bool> selected(schema->num_fields(), false);
+  for (int i : field_indices) {
+    if (i < 0 || i >= schema->num_fields()) {
+      return Status::Invalid("Field index ", i, " out of bounds for schema with ",
+                             schema->num_fields(), " fields");
+    }
+    selected[i] = true;
+  }
+
+  // The buffers of a field follow those of the previous fields, so all the
+  // fields are walked to find the buffers of the selected ones, first to
+  // plan the reads, then to load the arrays
+  std::vector<int> planned_buffers;
+  std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
+  for (bool planning : {true, false}) {
+    ArrayLoaderContext context;
+    context.source = source;
+    context.field_index = 0;
+    context.buffer_index = 0;
+    context.max_recursion_depth = max_recursion_depth;
+    context.planned_buffers = planning ? &planned_buffers : NULLPTR;
+    for (int i = 0; i < schema->num_fields(); ++i) {
+      context.skip_buffers = !selected[i];
+      auto arr = std::make_shared<ArrayData>();
+      RETURN_NOT_OK(LoadArray(schema->field(i)->type(), &context, arr.get()));
+      arrays[i] = std::move(arr);
+    }
+    if (planning) {
+      RETURN_NOT_OK(source->Prefetch(planned_buffers));
+    }
+  }
+
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<ArrayData>> columns;
+  for (int i : field_indices) {
+    DCHECK_EQ(num_rows, arrays[i]->length)
+        << "Array length did not match record batch length";
+    fields.push_back(schema->field(i));
+    columns.push_back(arrays[i]);
+  }
+  *out = RecordBatch::Make(::arrow::schema(std::move(fields), schema->metadata()),
+                           num_rows, std::move(columns));
+  return Status::OK();
+}
+
 static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
                                      const std::shared_ptr<Schema>& schema,
                                      int max_recursion_depth, io::RandomAccessFile* file,
+                                     MemoryPool* pool,
                                      std::shared_ptr<RecordBatch>* out) {
-  IpcComponentSource source(metadata, file);
+  IpcComponentSource source(metadata, file, pool);
   return LoadRecordBatchFromSource(schema, metadata->length(), max_recursion_depth,
                                    &source, out);
 }
@@ -323,6 +484,13 @@ static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
 Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
                        int max_recursion_depth, io::RandomAccessFile* file,
                        std::shared_ptr<RecordBatch>* out) {
+  return ReadRecordBatch(metadata, schema, max_recursion_depth, file,
+                         default_memory_pool(), out);
+}
+
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       int max_recursion_depth, io::RandomAccessFile* file,
+                       MemoryPool* pool, std::shared_ptr<RecordBatch>* out) {
   auto message = flatbuf::GetMessage(metadata.data());
   if (message->header_type() != flatbuf::MessageHeader_RecordBatch) {
     DCHECK_EQ(message->header_type(), flatbuf::MessageHeader_RecordBatch);
@@ -331,12 +499,241 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
     return Status::IOError("Header-pointer of flatbuffer-encoded Message is null.");
   }
   auto batch = reinterpret_cast<const flatbuf::RecordBatch*>(message->header());
-  return ReadRecordBatch(batch, schema, max_recursion_depth, file, out);
+  return ReadRecordBatch(batch, schema, max_recursion_depth, file, pool, out);
 }
 
+// ----------------------------------------------------------------------
+// RecordBatchDecoder
+
+class RecordBatchDecoder::RecordBatchDecoderImpl {
+ public:
+  RecordBatchDecoderImpl(const std::shared_ptr<Schema>& schema, MemoryPool* pool)
+      : schema_(schema), pool_(pool), num_buffers_(0) {}
+
+  Status Init() {
+    for (const auto& field : schema_->fields()) {
+      int index;
+      RETURN_NOT_OK(PlanField(field->type(), field->type(), kMaxNestingDepth, &index));
+      top_level_nodes_.push_back(index);
+    }
+    return Status::OK();
+  }
+
+  Status Decode(const Message& message, std::shared_ptr<RecordBatch>* out) const {
+    if (message.type() != Message::RECORD_BATCH) {
+      return Status::Invalid("Expected a record batch message, got ",
+                             FormatMessageType(message.type()));
+    }
+    if (message.header() == nullptr) {
+      return Status::IOError("Header-pointer of flatbuffer-encoded Message is null.");
+    }
+    auto batch = static_cast<const flatbuf::RecordBatch*>(message.header());
+    Compression::type compression;
+    RETURN_NOT_OK(internal::GetBodyCompression(batch, &compression));
+    if (compression != Compression::UNCOMPRESSED) {
+      return ReadRecordBatch(message, schema_, pool_, out);
+    }
+
+    auto fb_nodes = batch->nodes();
+    auto fb_buffers = batch->buffers();
+    const int num_nodes = static_cast<int>(nodes_.size());
+    if (fb_nodes == nullptr || static_cast<int>(fb_nodes->size()) != num_nodes) {
+      return Status::Invalid("Expected ", num_nodes, " field nodes in record batch, got ",
+                             fb_nodes == nullptr ? 0 : fb_nodes->size());
+    }
+    if (fb_buffers == nullptr || static_cast<int>(fb_buffers->size()) != num_buffers_) {
+      return Status::Invalid("Expected ", num_buffers_, " buffers in record batch, got ",
+                             fb_buffers == nullptr ? 0 : fb_buffers->size());
+    }
+
+    // Slice all the buffers out of the body, empty ones being null
+    const std::shared_ptr<Buffer> body = message.body();
+    const int64_t body_size = body == nullptr ? 0 : body->size();
+    std::vector<std::shared_ptr<Buffer>> buffers(num_buffers_);
+    for (int i = 0; i < num_buffers_; ++i) {
+      const flatbuf::Buffer* buffer = fb_buffers->Get(i);
+      if (buffer->length() == 0) {
+        continue;
+      }
+      if (buffer->offset() < 0 || buffer->length() < 0 ||
+          buffer->offset() > body_size - buffer->length()) {
+        return Status::Invalid("Buffer ", i, " out of bounds of record batch body");
+      }
+      buffers[i] = SliceBuffer(body, buffer->offset(), buffer->length());
+    }
+
+    // Children are planned after their parent, so build the arrays backwards
+    std::vector<std::shared_ptr<ArrayData>> arrays(num_nodes);
+    for (int i = num_nodes - 1; i >= 0; --i) {
+      const NodeLayout& layout = nodes_[i];
+      const flatbuf::FieldNode* node = fb_nodes->Get(i);
+      auto data = std::make_shared<ArrayData>(layout.type, node->length(),
+                                              node->null_count(), 0);
+      data->buffers.resize(layout.buffer_indices.size());
+      for (size_t j = 0; j < layout.buffer_indices.size(); ++j) {
+        const int index = layout.buffer_indices[j];
+        if (index >= 0) {
+          data->buffers[j] = buffers[index];
+        }
+      }
+      if (layout.has_validity_bitmap && node->null_count() == 0) {
+        data->buffers[0] = nullptr;
+      }
+      if (node->length() == 0) {
+        if (layout.kind == NodeLayout::PRIMITIVE) {
+          data->buffers[1] = std::make_shared<Buffer>(nullptr, 0);
+        } else if (layout.kind == NodeLayout::UNION) {
+          data->buffers[1] = data->buffers[2] = nullptr;
+        }
+      }
+      for (int child : layout.children) {
+        data->child_data.push_back(arrays[child]);
+      }
+      arrays[i] = std::move(data);
+    }
+
+    const int64_t num_rows = batch->length();
+    std::vector<std::shared_ptr<ArrayData>> columns;
+    columns.reserve(top_level_nodes_.size());
+    for (int index : top_level_nodes_) {
+      if (arrays[index]->length != num_rows) {
+        return Status::Invalid("Array length ", arrays[index]->length,
+                               " did not match record batch length ", num_rows);
+      }
+      columns.push_back(arrays[index]);
+    }
+    *out = RecordBatch::Make(schema_, num_rows, std::move(columns));
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const { return schema_; }
+
+ private:
+  // The layout of a field node, mirroring ArrayLoader
+  struct NodeLayout {
+    enum Kind { PRIMITIVE, UNION, OTHER };
+
+    std::shared_ptr<DataType> type;
+    Kind kind;
+    bool has_validity_bitmap;
+    // For each buffer of the ArrayData, the index of the message buffer, or
+    // -1 if always null
+    std::vector<int> buffer_indices;
+    // The indices of the child nodes
+    std::vector<int> children;
+  };
+
+  // Append the layout of the node of a field (and of its descendants)
+  // with the given type, stored with out_type (a dictionary type for the
+  // indices of dictionary fields)
+  Status PlanField(const std::shared_ptr<DataType>& type,
+                   const std::shared_ptr<DataType>& out_type, int max_recursion_depth,
+                   int* out_index) {
+    if (max_recursion_depth <= 0) {
+      return Status::Invalid("Max recursion depth reached");
+    }
+    if (type->id() == Type::DICTIONARY) {
+      const auto& dict_type = checked_cast<const DictionaryType&>(*type);
+      return PlanField(dict_type.index_type(), out_type, max_recursion_depth, out_index);
+    }
+
+    const int index = static_cast<int>(nodes_.size());
+    nodes_.emplace_back();
+    NodeLayout layout;
+    layout.type = out_type;
+    layout.kind = NodeLayout::OTHER;
+    layout.has_validity_bitmap = true;
+
+    // Every node starts with its validity bitmap
+    const int first_buffer = num_buffers_++;
+    switch (type->id()) {
+      case Type::NA:
+        // The second buffer replaces the bitmap
+        layout.has_validity_bitmap = false;
+        layout.buffer_indices = {num_buffers_++};
+        break;
+      case Type::BINARY:
+      case Type::STRING:
+        layout.buffer_indices = {first_buffer, num_buffers_, num_buffers_ + 1};
+        num_buffers_ += 2;
+        break;
+      case Type::FIXED_SIZE_BINARY:
+      case Type::DECIMAL:
+      case Type::LIST:
+        layout.buffer_indices = {first_buffer, num_buffers_++};
+        break;
+      case Type::STRUCT:
+        layout.buffer_indices = {first_buffer};
+        break;
+      case Type::UNION: {
+        const auto& union_type = checked_cast<const UnionType&>(*type);
+        layout.kind = NodeLayout::UNION;
+        if (union_type.mode() == UnionMode::DENSE) {
+          layout.buffer_indices = {first_buffer, num_buffers_, num_buffers_ + 1};
+          num_buffers_ += 2;
+        } else {
+          layout.buffer_indices = {first_buffer, num_buffers_++, -1};
+        }
+        break;
+      }
+      default:
+        if (!is_fixed_width(type->id())) {
+          return Status::NotImplemented("Cannot decode record batches of type ",
+                                        type->ToString());
+        }
+        layout.kind = NodeLayout::PRIMITIVE;
+        layout.buffer_indices = {first_buffer, num_buffers_++};
+        break;
+    }
+
+    for (const auto& child : type->children()) {
+      int child_index;
+      RETURN_NOT_OK(
+          PlanField(child->type(), child->type(), max_recursion_depth - 1, &child_index));
+      layout.children.push_back(child_index);
+    }
+    nodes_[index] = std::move(layout);
+    *out_index = index;
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  // The pool of decompressed buffers
+  MemoryPool* pool_;
+  // The field nodes, in message order
+  std::vector<NodeLayout> nodes_;
+  std::vector<int> top_level_nodes_;
+  int num_buffers_;
+};
+
+RecordBatchDecoder::RecordBatchDecoder() {}
+
+RecordBatchDecoder::~RecordBatchDecoder() {}
+
+Status RecordBatchDecoder::Make(const std::shared_ptr<Schema>& schema,
+                                std::unique_ptr<RecordBatchDecoder>* out) {
+  return Make(schema, default_memory_pool(), out);
+}
+
+Status RecordBatchDecoder::Make(const std::shared_ptr<Schema>& schema, MemoryPool* pool,
+                                std::unique_ptr<RecordBatchDecoder>* out) {
+  std::unique_ptr<RecordBatchDecoder> result(new RecordBatchDecoder());
+  result->impl_.reset(new RecordBatchDecoderImpl(schema, pool));
+  RETURN_NOT_OK(result->impl_->Init());
+  *out = std::move(result);
+  return Status::OK();
+}
+
+Status RecordBatchDecoder::Decode(const Message& message,
+                                  std::shared_ptr<RecordBatch>* out) const {
+  return impl_->Decode(message, out);
+}
+
+std::shared_ptr<Schema> RecordBatchDecoder::schema() const { return impl_->schema(); }
+
 Status ReadDictionary(const Buffer& metadata, const DictionaryTypeMap& dictionary_types,
-                      io::RandomAccessFile* file, int64_t* dictionary_id,
-                      std::shared_ptr<Array>* out) {
+                      io::RandomAccessFile* file, MemoryPool* pool,
+                      int64_t* dictionary_id, std::shared_ptr<Array>* out) {
   auto message = flatbuf::GetMessage(metadata.data());
   auto dictionary_batch =
       reinterpret_cast<const flatbuf::DictionaryBatch*>(message->header());
@@ -357,7 +754,7 @@ Status ReadDictionary(const Buffer& metadata, const DictionaryTypeMap& dictionar
   auto batch_meta =
       reinterpret_cast<const flatbuf::RecordBatch*>(dictionary_batch->data());
   RETURN_NOT_OK(
-      ReadRecordBatch(batch_meta, dummy_schema, kMaxNestingDepth, file, &batch));
+      ReadRecordBatch(batch_meta, dummy_schema, kMaxNestingDepth, file, pool, &batch));
   if (batch->num_columns() != 1) {
     return Status::Invalid("Dictionary record batch must only contain one field");
   }
@@ -396,11 +793,12 @@ static inline FileBlock FileBlockFromFlatbuffer(const flatbuf::Block* block) {
 
 class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
  public:
-  RecordBatchStreamReaderImpl() {}
+  RecordBatchStreamReaderImpl() : pool_(default_memory_pool()) {}
   ~RecordBatchStreamReaderImpl() {}
 
-  Status Open(std::unique_ptr<MessageReader> message_reader) {
+  Status Open(std::unique_ptr<MessageReader> message_reader, MemoryPool* pool) {
     message_reader_ = std::move(message_reader);
+    pool_ = pool;
     return ReadSchema();
   }
 
@@ -413,8 +811,8 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
 
     std::shared_ptr<Array> dictionary;
     int64_t id;
-    RETURN_NOT_OK(ReadDictionary(*message->metadata(), dictionary_types_, &reader, &id,
-                                 &dictionary));
+    RETURN_NOT_OK(ReadDictionary(*message->metadata(), dictionary_types_, &reader, pool_,
+                                 &id, &dictionary));
     return dictionary_memo_.AddDictionary(id, dictionary);
   }
 
@@ -435,33 +833,82 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
       RETURN_NOT_OK(ReadNextDictionary());
     }
 
-    return internal::GetSchema(message->header(), dictionary_memo_, &schema_);
+    // Kept to rebuild the schema when dictionaries change
+    schema_message_ = std::move(message);
+    return UpdateSchema();
+  }
+
+  // Rebuild the schema from the current dictionaries, the decoder bound to
+  // it being made again on the next record batch
+  Status UpdateSchema() {
+    decoder_.reset();
+    return internal::GetSchema(schema_message_->header(), dictionary_memo_, &schema_);
+  }
+
+  // Apply a dictionary batch found between record batches, which replaces
+  // the dictionary with the same id or, if it is a delta, extends it
+  Status ReadDictionaryUpdate(const Message& message) {
+    auto fb_message = flatbuf::GetMessage(message.metadata()->data());
+    if (fb_message->header() == nullptr) {
+      return Status::IOError("Header-pointer of flatbuffer-encoded Message is null.");
+    }
+    auto dictionary_batch =
+        reinterpret_cast<const flatbuf::DictionaryBatch*>(fb_message->header());
+
+    io::BufferReader reader(message.body());
+    std::shared_ptr<Array> dictionary;
+    int64_t id;
+    RETURN_NOT_OK(ReadDictionary(*message.metadata(), dictionary_types_, &reader, pool_,
+                                 &id, &dictionary));
+    if (dictionary_batch->isDelta()) {
+      std::shared_ptr<Array> previous, delta = std::move(dictionary);
+      RETURN_NOT_OK(dictionary_memo_.GetDictionary(id, &previous));
+      RETURN_NOT_OK(
+          internal::ConcatenateDictionaries(*previous, *delta, pool_, &dictionary));
+    }
+    RETURN_NOT_OK(dictionary_memo_.UpdateDictionary(id, dictionary));
+    return UpdateSchema();
   }
 
   Status ReadNext(std::shared_ptr<RecordBatch>* batch) {
+    ARROW_TRACE_SPAN("ipc", "read_batch");
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessageAndValidate(message_reader_.get(), Message::RECORD_BATCH,
-                                         true, &message));
+    RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+    while (message != nullptr && message->type() == Message::DICTIONARY_BATCH) {
+      RETURN_NOT_OK(ReadDictionaryUpdate(*message));
+      RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+    }
 
     if (message == nullptr) {
       // End of stream
       *batch = nullptr;
       return Status::OK();
     }
+    if (message->type() != Message::RECORD_BATCH) {
+      return Status::IOError("Message not expected type: ",
+                             FormatMessageType(Message::RECORD_BATCH),
+                             ", was: ", message->type());
+    }
 
-    io::BufferReader reader(message->body());
-    return ReadRecordBatch(*message->metadata(), schema_, &reader, batch);
+    if (decoder_ == nullptr) {
+      RETURN_NOT_OK(RecordBatchDecoder::Make(schema_, pool_, &decoder_));
+    }
+    return decoder_->Decode(*message, batch);
   }
 
   std::shared_ptr<Schema> schema() const { return schema_; }
 
  private:
   std::unique_ptr<MessageReader> message_reader_;
+  // The pool of decompressed buffers and concatenated delta dictionaries
+  MemoryPool* pool_;
 
   // dictionary_id -> type
   DictionaryTypeMap dictionary_types_;
   DictionaryMemo dictionary_memo_;
+  std::unique_ptr<Message> schema_message_;
   std::shared_ptr<Schema> schema_;
+  std::unique_ptr<RecordBatchDecoder> decoder_;
 };
 
 RecordBatchStreamReader::RecordBatchStreamReader() {
@@ -472,9 +919,15 @@ RecordBatchStreamReader::~RecordBatchStreamReader() {}
 
 Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
                                      std::shared_ptr<RecordBatchReader>* reader) {
+  return Open(std::move(message_reader), default_memory_pool(), reader);
+}
+
+Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
+                                     MemoryPool* pool,
+                                     std::shared_ptr<RecordBatchReader>* reader) {
   // Private ctor
   auto result = std::shared_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
-  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader)));
+  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader), pool));
   *reader = result;
   return Status::OK();
 }
@@ -486,7 +939,16 @@ Status RecordBatchStreamReader::Open(io::InputStream* stream,
 
 Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& stream,
                                      std::shared_ptr<RecordBatchReader>* out) {
-  return Open(MessageReader::Open(stream), out);
+  return Open(MessageReader::Open(io::internal::MaybeInstrumentStream(stream, "ipc")),
+              out);
+}
+
+Status RecordBatchStreamReader::Open(const std::shared_ptr<io::InputStream>& stream,
+                                     const MessageReaderOptions& options,
+                                     std::shared_ptr<RecordBatchReader>* out) {
+  return Open(
+      MessageReader::Open(io::internal::MaybeInstrumentStream(stream, "ipc"), options),
+      options.pool != NULLPTR ? options.pool : default_memory_pool(), out);
 }
 
 std::shared_ptr<Schema> RecordBatchStreamReader::schema() const {
@@ -502,7 +964,8 @@ Status RecordBatchStreamReader::ReadNext(std::shared_ptr<RecordBatch>* batch) {
 
 class RecordBatchFileReader::RecordBatchFileReaderImpl {
  public:
-  RecordBatchFileReaderImpl() : file_(NULLPTR), footer_offset_(0), footer_(NULLPTR) {
+  explicit RecordBatchFileReaderImpl(MemoryPool* pool)
+      : file_(NULLPTR), pool_(pool), footer_offset_(0), footer_(NULLPTR) {
     dictionary_memo_ = std::make_shared<DictionaryMemo>();
   }
 
@@ -559,6 +1022,7 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
   }
 
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch) {
+    ARROW_TRACE_SPAN("ipc", "read_batch");
     DCHECK_GE(i, 0);
     DCHECK_LT(i, num_record_batches());
     FileBlock block = record_batch(i);
@@ -567,6 +1031,11 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     DCHECK(BitUtil::IsMultipleOf8(block.metadata_length));
     DCHECK(BitUtil::IsMultipleOf8(block.body_length));
 
+    // Let the kernel prefetch the whole block, which is read or mapped next
+    RETURN_NOT_OK(file_->Advise(
+        {io::ReadRange{block.offset, block.metadata_length + block.body_length}},
+        io::AccessHint::WILL_NEED));
+
     std::unique_ptr<Message> message;
     RETURN_NOT_OK(ReadMessage(block.offset, block.metadata_length, file_, &message));
 
@@ -574,7 +1043,42 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     // DCHECK_EQ(message->body_length(), block.body_length);
 
     io::BufferReader reader(message->body());
-    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &reader, batch);
+    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, kMaxNestingDepth,
+                                         &reader, pool_, batch);
+  }
+
+  Status ReadRecordBatch(int i, const std::vector<int>& field_indices,
+                         std::shared_ptr<RecordBatch>* batch) {
+    ARROW_TRACE_SPAN("ipc", "read_batch");
+    DCHECK_GE(i, 0);
+    DCHECK_LT(i, num_record_batches());
+    FileBlock block = record_batch(i);
+
+    // Only read the metadata here; the body buffers are read on demand
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(file_->ReadAt(block.offset, block.metadata_length, &buffer));
+    if (buffer->size() < block.metadata_length ||
+        block.metadata_length <= static_cast<int32_t>(sizeof(int32_t))) {
+      return Status::Invalid("Expected to read ", block.metadata_length,
+                             " metadata bytes but got ", buffer->size());
+    }
+    const int64_t prefix_size = static_cast<int64_t>(sizeof(int32_t));
+    auto metadata = SliceBuffer(buffer, prefix_size, buffer->size() - prefix_size);
+    flatbuffers::Verifier verifier(metadata->data(), metadata->size(), 128);
+    if (!flatbuf::VerifyMessageBuffer(verifier)) {
+      return Status::IOError("Invalid flatbuffers message.");
+    }
+    auto message = flatbuf::GetMessage(metadata->data());
+    if (message->header_type() != flatbuf::MessageHeader_RecordBatch ||
+        message->header() == nullptr) {
+      return Status::IOError("Expected record batch message in file block ", i);
+    }
+    auto batch_meta = reinterpret_cast<const flatbuf::RecordBatch*>(message->header());
+
+    IpcComponentSource source(batch_meta, file_, pool_,
+                              block.offset + block.metadata_length);
+    return LoadRecordBatchSubset(schema_, field_indices, batch_meta->length(),
+                                 kMaxNestingDepth, &source, batch);
   }
 
   Status ReadSchema() {
@@ -599,7 +1103,7 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
       std::shared_ptr<Array> dictionary;
       int64_t dictionary_id;
       RETURN_NOT_OK(ReadDictionary(*message->metadata(), dictionary_fields_, &reader,
-                                   &dictionary_id, &dictionary));
+                                   pool_, &dictionary_id, &dictionary));
       RETURN_NOT_OK(dictionary_memo_->AddDictionary(dictionary_id, dictionary));
     }
 
@@ -623,6 +1127,8 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
 
  private:
   io::RandomAccessFile* file_;
+  // The pool of decompressed buffers
+  MemoryPool* pool_;
 
   std::shared_ptr<io::RandomAccessFile> owned_file_;
 
@@ -641,8 +1147,8 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
   std::shared_ptr<Schema> schema_;
 };
 
-RecordBatchFileReader::RecordBatchFileReader() {
-  impl_.reset(new RecordBatchFileReaderImpl());
+RecordBatchFileReader::RecordBatchFileReader(MemoryPool* pool) {
+  impl_.reset(new RecordBatchFileReaderImpl(pool));
 }
 
 RecordBatchFileReader::~RecordBatchFileReader() {}
@@ -656,7 +1162,8 @@ Status RecordBatchFileReader::Open(io::RandomAccessFile* file,
 
 Status RecordBatchFileReader::Open(io::RandomAccessFile* file, int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
-  *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
+  *reader = std::shared_ptr<RecordBatchFileReader>(
+      new RecordBatchFileReader(default_memory_pool()));
   return (*reader)->impl_->Open(file, footer_offset);
 }
 
@@ -670,8 +1177,15 @@ Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>&
 Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
                                    int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
-  *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
-  return (*reader)->impl_->Open(file, footer_offset);
+  return Open(file, footer_offset, default_memory_pool(), reader);
+}
+
+Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                                   int64_t footer_offset, MemoryPool* pool,
+                                   std::shared_ptr<RecordBatchFileReader>* reader) {
+  *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader(pool));
+  return (*reader)->impl_->Open(io::internal::MaybeInstrumentFile(file, "ipc"),
+                                footer_offset);
 }
 
 std::shared_ptr<Schema> RecordBatchFileReader::schema() const { return impl_->schema(); }
@@ -687,6 +1201,12 @@ Status RecordBatchFileReader::ReadRecordBatch(int i,
   return impl_->ReadRecordBatch(i, batch);
 }
 
+Status RecordBatchFileReader::ReadRecordBatch(int i,
+                                              const std::vector<int>& field_indices,
+                                              std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadRecordBatch(i, field_indices, batch);
+}
+
 static Status ReadContiguousPayload(io::InputStream* file,
                                     std::unique_ptr<Message>* message) {
   RETURN_NOT_OK(ReadMessage(file, message));
@@ -737,62 +1257,115 @@ Status ReadTensor(const Message& message, std::shared_ptr<Tensor>* out) {
 
 namespace {
 
-Status ReadSparseCOOIndex(const flatbuf::SparseTensor* sparse_tensor, int64_t ndim,
-                          int64_t non_zero_length, io::RandomAccessFile* file,
-                          std::shared_ptr<SparseIndex>* out) {
-  auto* sparse_index = sparse_tensor->sparseIndex_as_SparseTensorIndexCOO();
-  auto* indices_buffer = sparse_index->indicesBuffer();
-  std::shared_ptr<Buffer> indices_data;
-  RETURN_NOT_OK(
-      file->ReadAt(indices_buffer->offset(), indices_buffer->length(), &indices_data));
-  std::vector<int64_t> shape({non_zero_length, ndim});
-  const int64_t elsize = sizeof(int64_t);
-  std::vector<int64_t> strides({elsize, elsize * non_zero_length});
-  *out = std::make_shared<SparseCOOIndex>(
-      std::make_shared<SparseCOOIndex::CoordsTensor>(indices_data, shape, strides));
+// Read a buffer of a sparse tensor body, without copying it if the file
+// supports zero-copy reads
+Status ReadSparseTensorBuffer(const flatbuf::Buffer* buffer, int64_t min_length,
+                              io::RandomAccessFile* file, std::shared_ptr<Buffer>* out) {
+  if (buffer == nullptr) {
+    return Status::IOError("Missing buffer in sparse tensor metadata");
+  }
+  if (buffer->length() < min_length) {
+    return Status::IOError("Sparse tensor buffer of ", buffer->length(),
+                           " bytes, expected at least ", min_length);
+  }
+  RETURN_NOT_OK(file->ReadAt(buffer->offset(), buffer->length(), out));
+  if ((*out)->size() < min_length) {
+    return Status::IOError("Expected to read ", min_length,
+                           " bytes of sparse tensor buffer, but only read ",
+                           (*out)->size());
+  }
   return Status::OK();
 }
 
-Status ReadSparseCSRIndex(const flatbuf::SparseTensor* sparse_tensor, int64_t ndim,
-                          int64_t non_zero_length, io::RandomAccessFile* file,
-                          std::shared_ptr<SparseIndex>* out) {
-  auto* sparse_index = sparse_tensor->sparseIndex_as_SparseMatrixIndexCSR();
-
-  auto* indptr_buffer = sparse_index->indptrBuffer();
-  std::shared_ptr<Buffer> indptr_data;
+// Read an index vector of the given length, or of the whole buffer if the
+// length is negative
+Status ReadSparseIndexVector(const flatbuf::Buffer* buffer, int64_t length,
+                             io::RandomAccessFile* file,
+                             std::shared_ptr<NumericTensor<Int64Type>>* out) {
+  const int64_t elsize = sizeof(int64_t);
+  std::shared_ptr<Buffer> data;
   RETURN_NOT_OK(
-      file->ReadAt(indptr_buffer->offset(), indptr_buffer->length(), &indptr_data));
+      ReadSparseTensorBuffer(buffer, length < 0 ? 0 : length * elsize, file, &data));
+  if (length < 0) {
+    length = data->size() / elsize;
+  }
+  *out = std::make_shared<NumericTensor<Int64Type>>(data, std::vector<int64_t>{length});
+  return Status::OK();
+}
 
-  auto* indices_buffer = sparse_index->indicesBuffer();
+Status ReadSparseCOOIndex(const flatbuf::SparseTensor* sparse_tensor,
+                          const std::vector<int64_t>& shape, int64_t non_zero_length,
+                          io::RandomAccessFile* file, std::shared_ptr<SparseIndex>* out) {
+  auto* sparse_index = sparse_tensor->sparseIndex_as_SparseTensorIndexCOO();
+  const int64_t ndim = static_cast<int64_t>(shape.size());
+  const int64_t elsize = sizeof(int64_t);
   std::shared_ptr<Buffer> indices_data;
-  RETURN_NOT_OK(
-      file->ReadAt(indices_buffer->offset(), indices_buffer->length(), &indices_data));
+  RETURN_NOT_OK(ReadSparseTensorBuffer(sparse_index->indicesBuffer(),
+                                       elsize * non_zero_length * ndim, file,
+                                       &indices_data));
+  std::vector<int64_t> indices_shape({non_zero_length, ndim});
+  std::vector<int64_t> strides({elsize, elsize * non_zero_length});
+  *out = std::make_shared<SparseCOOIndex>(std::make_shared<SparseCOOIndex::CoordsTensor>(
+      indices_data, indices_shape, strides));
+  return Status::OK();
+}
 
-  std::vector<int64_t> indptr_shape({ndim + 1});
-  std::vector<int64_t> indices_shape({non_zero_length});
-  *out = std::make_shared<SparseCSRIndex>(
-      std::make_shared<SparseCSRIndex::IndexTensor>(indptr_data, indptr_shape),
-      std::make_shared<SparseCSRIndex::IndexTensor>(indices_data, indices_shape));
+template <typename SparseIndexType, typename FlatbufIndexType>
+Status ReadSparseMatrixIndex(const FlatbufIndexType* sparse_index, int64_t indptr_length,
+                             int64_t non_zero_length, io::RandomAccessFile* file,
+                             std::shared_ptr<SparseIndex>* out) {
+  std::shared_ptr<typename SparseIndexType::IndexTensor> indptr;
+  RETURN_NOT_OK(
+      ReadSparseIndexVector(sparse_index->indptrBuffer(), indptr_length, file, &indptr));
+  std::shared_ptr<typename SparseIndexType::IndexTensor> indices;
+  RETURN_NOT_OK(ReadSparseIndexVector(sparse_index->indicesBuffer(), non_zero_length,
+                                      file, &indices));
+  *out = std::make_shared<SparseIndexType>(indptr, indices);
   return Status::OK();
 }
 
-Status MakeSparseTensorWithSparseCOOIndex(
-    const std::shared_ptr<DataType>& type, const std::vector<int64_t>& shape,
-    const std::vector<std::string>& dim_names,
-    const std::shared_ptr<SparseCOOIndex>& sparse_index, int64_t non_zero_length,
-    const std::shared_ptr<Buffer>& data, std::shared_ptr<SparseTensor>* out) {
-  *out = std::make_shared<SparseTensorImpl<SparseCOOIndex>>(sparse_index, type, data,
-                                                            shape, dim_names);
+Status ReadSparseCSFIndex(const flatbuf::SparseTensor* sparse_tensor,
+                          const std::vector<int64_t>& shape, int64_t non_zero_length,
+                          io::RandomAccessFile* file, std::shared_ptr<SparseIndex>* out) {
+  auto* sparse_index = sparse_tensor->sparseIndex_as_SparseTensorIndexCSF();
+  const size_t ndim = shape.size();
+  auto* fb_indptr = sparse_index->indptrBuffers();
+  auto* fb_indices = sparse_index->indicesBuffers();
+  auto* fb_axis_order = sparse_index->axisOrder();
+  if (ndim == 0 || fb_indptr == nullptr || fb_indices == nullptr ||
+      fb_axis_order == nullptr || fb_indptr->size() != ndim - 1 ||
+      fb_indices->size() != ndim || fb_axis_order->size() != ndim) {
+    return Status::IOError("Invalid CSF sparse index for a tensor of ", ndim,
+                           " dimensions");
+  }
+
+  // The size of each level is given by its indices; the leaves are the
+  // non-zero values
+  std::vector<std::shared_ptr<SparseCSFIndex::IndexTensor>> indices(ndim);
+  for (flatbuffers::uoffset_t i = 0; i < ndim; ++i) {
+    const int64_t length = i == ndim - 1 ? non_zero_length : -1;
+    RETURN_NOT_OK(ReadSparseIndexVector(fb_indices->Get(i), length, file, &indices[i]));
+  }
+  std::vector<std::shared_ptr<SparseCSFIndex::IndexTensor>> indptr(ndim - 1);
+  for (flatbuffers::uoffset_t i = 0; i < ndim - 1; ++i) {
+    RETURN_NOT_OK(ReadSparseIndexVector(fb_indptr->Get(i), indices[i]->shape()[0] + 1,
+                                        file, &indptr[i]));
+  }
+  std::vector<int64_t> axis_order(fb_axis_order->begin(), fb_axis_order->end());
+
+  *out = std::make_shared<SparseCSFIndex>(indptr, indices, axis_order);
   return Status::OK();
 }
 
-Status MakeSparseTensorWithSparseCSRIndex(
-    const std::shared_ptr<DataType>& type, const std::vector<int64_t>& shape,
-    const std::vector<std::string>& dim_names,
-    const std::shared_ptr<SparseCSRIndex>& sparse_index, int64_t non_zero_length,
-    const std::shared_ptr<Buffer>& data, std::shared_ptr<SparseTensor>* out) {
-  *out = std::make_shared<SparseTensorImpl<SparseCSRIndex>>(sparse_index, type, data,
-                                                            shape, dim_names);
+template <typename SparseIndexType>
+Status MakeSparseTensorWithSparseIndex(const std::shared_ptr<DataType>& type,
+                                       const std::vector<int64_t>& shape,
+                                       const std::vector<std::string>& dim_names,
+                                       const std::shared_ptr<SparseIndex>& sparse_index,
+                                       const std::shared_ptr<Buffer>& data,
+                                       std::shared_ptr<SparseTensor>* out) {
+  *out = std::make_shared<SparseTensorImpl<SparseIndexType>>(
+      checked_pointer_cast<SparseIndexType>(sparse_index), type, data, shape, dim_names);
   return Status::OK();
 }
 
@@ -812,28 +1385,50 @@ Status ReadSparseTensor(const Buffer& metadata, io::RandomAccessFile* file,
   auto message = flatbuf::GetMessage(metadata.data());
   auto sparse_tensor = reinterpret_cast<const flatbuf::SparseTensor*>(message->header());
   const flatbuf::Buffer* buffer = sparse_tensor->data();
-  DCHECK(BitUtil::IsMultipleOf8(buffer->offset()))
+  DCHECK(buffer == nullptr || BitUtil::IsMultipleOf8(buffer->offset()))
       << "Buffer of sparse index data "
       << "did not start on 8-byte aligned offset: " << buffer->offset();
 
+  const auto& fw_type = checked_cast<const FixedWidthType&>(*type);
   std::shared_ptr<Buffer> data;
-  RETURN_NOT_OK(file->ReadAt(buffer->offset(), buffer->length(), &data));
+  RETURN_NOT_OK(ReadSparseTensorBuffer(
+      buffer, non_zero_length * BitUtil::BytesForBits(fw_type.bit_width()), file, &data));
 
   std::shared_ptr<SparseIndex> sparse_index;
   switch (sparse_tensor_format_id) {
     case SparseTensorFormat::COO:
-      RETURN_NOT_OK(ReadSparseCOOIndex(sparse_tensor, shape.size(), non_zero_length, file,
-                                       &sparse_index));
-      return MakeSparseTensorWithSparseCOOIndex(
-          type, shape, dim_names, checked_pointer_cast<SparseCOOIndex>(sparse_index),
-          non_zero_length, data, out);
+      RETURN_NOT_OK(
+          ReadSparseCOOIndex(sparse_tensor, shape, non_zero_length, file, &sparse_index));
+      return MakeSparseTensorWithSparseIndex<SparseCOOIndex>(type, shape, dim_names,
+                                                             sparse_index, data, out);
 
     case SparseTensorFormat::CSR:
-      RETURN_NOT_OK(ReadSparseCSRIndex(sparse_tensor, shape.size(), non_zero_length, file,
-                                       &sparse_index));
-      return MakeSparseTensorWithSparseCSRIndex(
-          type, shape, dim_names, checked_pointer_cast<SparseCSRIndex>(sparse_index),
-          non_zero_length, data, out);
+      if (shape.size() != 2) {
+        return Status::IOError("CSR sparse index for a tensor of ", shape.size(),
+                               " dimensions");
+      }
+      RETURN_NOT_OK(ReadSparseMatrixIndex<SparseCSRIndex>(
+          sparse_tensor->sparseIndex_as_SparseMatrixIndexCSR(), shape[0] + 1,
+          non_zero_length, file, &sparse_index));
+      return MakeSparseTensorWithSparseIndex<SparseCSRIndex>(type, shape, dim_names,
+                                                             sparse_index, data, out);
+
+    case SparseTensorFormat::CSC:
+      if (shape.size() != 2) {
+        return Status::IOError("CSC sparse index for a tensor of ", shape.size(),
+                               " dimensions");
+      }
+      RETURN_NOT_OK(ReadSparseMatrixIndex<SparseCSCIndex>(
+          sparse_tensor->sparseIndex_as_SparseMatrixIndexCSC(), shape[1] + 1,
+          non_zero_length, file, &sparse_index));
+      return MakeSparseTensorWithSparseIndex<SparseCSCIndex>(type, shape, dim_names,
+                                                             sparse_index, data, out);
+
+    case SparseTensorFormat::CSF:
+      RETURN_NOT_OK(
+          ReadSparseCSFIndex(sparse_tensor, shape, non_zero_length, file, &sparse_index));
+      return MakeSparseTensorWithSparseIndex<SparseCSFIndex>(type, shape, dim_names,
+                                                             sparse_index, data, out);
 
     default:
       return Status::Invalid("Unsupported sparse index format");
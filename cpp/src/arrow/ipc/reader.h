@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/ipc/message.h"
 #include "arrow/record_batch.h"
@@ -30,6 +31,7 @@
 namespace arrow {
 
 class Buffer;
+class MemoryPool;
 class Schema;
 class Status;
 class Tensor;
@@ -64,6 +66,17 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   static Status Open(std::unique_ptr<MessageReader> message_reader,
                      std::shared_ptr<RecordBatchReader>* out);
 
+  /// Create batch reader from generic MessageReader, allocating from the
+  /// given pool
+  ///
+  /// \param[in] message_reader a MessageReader implementation
+  /// \param[in] pool the pool of decompressed buffers and concatenated delta
+  /// dictionaries
+  /// \param[out] out the created RecordBatchReader object
+  /// \return Status
+  static Status Open(std::unique_ptr<MessageReader> message_reader, MemoryPool* pool,
+                     std::shared_ptr<RecordBatchReader>* out);
+
   /// \brief Record batch stream reader from InputStream
   ///
   /// \param[in] stream an input stream instance. Must stay alive throughout
@@ -79,7 +92,27 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   static Status Open(const std::shared_ptr<io::InputStream>& stream,
                      std::shared_ptr<RecordBatchReader>* out);
 
+  /// \brief Open stream and retain ownership of stream object, reading the
+  /// messages with the given options
+  ///
+  /// With MessageReaderOptions::reuse_buffers, the batches share their memory
+  /// with the next ones, which is only written to once the previous batch and
+  /// all the arrays sliced from it are released.  MessageReaderOptions::pool
+  /// also applies to decompressed buffers and concatenated delta
+  /// dictionaries.
+  ///
+  /// \param[in] stream the input stream
+  /// \param[in] options the message reading options
+  /// \param[out] out the batch reader
+  /// \return Status
+  static Status Open(const std::shared_ptr<io::InputStream>& stream,
+                     const MessageReaderOptions& options,
+                     std::shared_ptr<RecordBatchReader>* out);
+
   /// \brief Returns the schema read from the stream
+  ///
+  /// Replacement and delta dictionary batches update the dictionaries of
+  /// this schema, so it matches the schema of the last batch read.
   std::shared_ptr<Schema> schema() const override;
 
   Status ReadNext(std::shared_ptr<RecordBatch>* batch) override;
@@ -137,6 +170,18 @@ class ARROW_EXPORT RecordBatchFileReader {
                      int64_t footer_offset,
                      std::shared_ptr<RecordBatchFileReader>* reader);
 
+  /// \brief Version of Open that retains ownership of file and allocates
+  /// from the given pool
+  ///
+  /// \param[in] file the data source
+  /// \param[in] footer_offset the position of the end of the Arrow file
+  /// \param[in] pool the pool of decompressed buffers
+  /// \param[out] reader the returned reader
+  /// \return Status
+  static Status Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                     int64_t footer_offset, MemoryPool* pool,
+                     std::shared_ptr<RecordBatchFileReader>* reader);
+
   /// \brief The schema read from the file
   std::shared_ptr<Schema> schema() const;
 
@@ -154,8 +199,21 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \return Status
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch);
 
+  /// \brief Read some fields of a particular record batch from the file
+  ///
+  /// Only the buffers of the selected fields are read, at once, coalescing
+  /// nearby ranges.
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \param[in] field_indices the indices in the file schema of the fields to
+  /// read, in the order of the columns of the returned batch
+  /// \param[out] batch the read batch
+  /// \return Status
+  Status ReadRecordBatch(int i, const std::vector<int>& field_indices,
+                         std::shared_ptr<RecordBatch>* batch);
+
  private:
-  RecordBatchFileReader();
+  explicit RecordBatchFileReader(MemoryPool* pool);
 
   class ARROW_NO_EXPORT RecordBatchFileReaderImpl;
   std::unique_ptr<RecordBatchFileReaderImpl> impl_;
@@ -215,6 +273,70 @@ ARROW_EXPORT
 Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& schema,
                        std::shared_ptr<RecordBatch>* out);
 
+/// \brief Read record batch from encapsulated Message, allocating from the
+/// given pool
+///
+/// \param[in] message a message instance containing metadata and body
+/// \param[in] schema the record batch schema
+/// \param[in] pool the pool of decompressed buffers
+/// \param[out] out the resulting RecordBatch
+/// \return Status
+ARROW_EXPORT
+Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& schema,
+                       MemoryPool* pool, std::shared_ptr<RecordBatch>* out);
+
+/// \class RecordBatchDecoder
+/// \brief Decoder of record batch messages bound to a schema
+///
+/// The layout of the field nodes and buffers of the schema is computed once,
+/// so that decoding a message only validates its node and buffer counts and
+/// slices its body.  This is cheaper than ReadRecordBatch for high rates of
+/// small batches.  Messages with compressed bodies are decoded with
+/// ReadRecordBatch.
+///
+/// The dictionaries of the decoded batches are those of the dictionary types
+/// of the schema; a new decoder must be made when they change.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class ARROW_EXPORT RecordBatchDecoder {
+ public:
+  ~RecordBatchDecoder();
+
+  /// \brief Create a decoder for the record batches of the given schema
+  ///
+  /// \param[in] schema the record batch schema
+  /// \param[out] out the created decoder
+  /// \return Status
+  static Status Make(const std::shared_ptr<Schema>& schema,
+                     std::unique_ptr<RecordBatchDecoder>* out);
+
+  /// \brief Create a decoder for the record batches of the given schema,
+  /// allocating from the given pool
+  ///
+  /// \param[in] schema the record batch schema
+  /// \param[in] pool the pool of decompressed buffers
+  /// \param[out] out the created decoder
+  /// \return Status
+  static Status Make(const std::shared_ptr<Schema>& schema, MemoryPool* pool,
+                     std::unique_ptr<RecordBatchDecoder>* out);
+
+  /// \brief Decode a record batch message
+  ///
+  /// \param[in] message a record batch message, with its body
+  /// \param[out] out the decoded record batch, sharing the body's memory
+  /// \return Status
+  Status Decode(const Message& message, std::shared_ptr<RecordBatch>* out) const;
+
+  std::shared_ptr<Schema> schema() const;
+
+ private:
+  RecordBatchDecoder();
+
+  class ARROW_NO_EXPORT RecordBatchDecoderImpl;
+  std::unique_ptr<RecordBatchDecoderImpl> impl_;
+};
+
 /// Read record batch from file given metadata and schema
 ///
 /// \param[in] metadata a Message containing the record batch metadata
@@ -228,6 +350,21 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
                        int max_recursion_depth, io::RandomAccessFile* file,
                        std::shared_ptr<RecordBatch>* out);
 
+/// Read record batch from file given metadata and schema, allocating from the
+/// given pool
+///
+/// \param[in] metadata a Message containing the record batch metadata
+/// \param[in] schema the record batch schema
+/// \param[in] file a random access file
+/// \param[in] max_recursion_depth the maximum permitted nesting depth
+/// \param[in] pool the pool of decompressed buffers
+/// \param[out] out the read record batch
+/// \return Status
+ARROW_EXPORT
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       int max_recursion_depth, io::RandomAccessFile* file,
+                       MemoryPool* pool, std::shared_ptr<RecordBatch>* out);
+
 /// \brief Read arrow::Tensor as encapsulated IPC message in file
 ///
 /// \param[in] file an InputStream pointed at the start of the message
@@ -0,0 +1,169 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/io/test-common.h"
+#include "arrow/ipc/shared-memory.h"
+#include "arrow/ipc/test-common.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace ipc {
+
+class TestSharedMemoryRing : public ::testing::Test, public io::MemoryMapFixture {
+ public:
+  void SetUp() {
+    path_ = "arrow-test-ipc-shared-memory-ring";
+    AppendFile(path_);
+  }
+
+  void TearDown() { io::MemoryMapFixture::TearDown(); }
+
+  // Write the batches from another thread, and read them back
+  void CheckRoundTrip(const std::vector<std::shared_ptr<RecordBatch>>& batches,
+                      const SharedMemoryRingOptions& options) {
+    std::shared_ptr<SharedMemoryRingWriter> writer;
+    ASSERT_OK(SharedMemoryRingWriter::Create(path_, batches[0]->schema(), options,
+                                             &writer));
+
+    std::shared_ptr<RecordBatchReader> reader;
+    ASSERT_OK(SharedMemoryRingReader::Open(path_, options, &reader));
+
+    Status write_status;
+    std::thread producer([&]() {
+      for (const auto& batch : batches) {
+        write_status = writer->WriteRecordBatch(*batch);
+        if (!write_status.ok()) {
+          break;
+        }
+      }
+      if (write_status.ok()) {
+        write_status = writer->Close();
+      }
+    });
+
+    for (const auto& batch : batches) {
+      std::shared_ptr<RecordBatch> result;
+      ASSERT_OK(reader->ReadNext(&result));
+      ASSERT_NE(nullptr, result);
+      CompareBatch(*batch, *result);
+    }
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->ReadNext(&result));
+    ASSERT_EQ(nullptr, result);
+
+    producer.join();
+    ASSERT_OK(write_status);
+  }
+
+ protected:
+  std::string path_;
+};
+
+TEST_F(TestSharedMemoryRing, RoundTrip) {
+  // The ring holds only a few batches, so that it wraps around and the
+  // writer waits for the reader
+  auto options = SharedMemoryRingOptions::Defaults();
+  options.capacity = 32 * 1024;
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (uint32_t i = 0; i < 20; ++i) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(MakeIntBatchSized(500 + 100 * (i % 5), &batch, i));
+    batches.push_back(batch);
+  }
+  CheckRoundTrip(batches, options);
+}
+
+TEST_F(TestSharedMemoryRing, Dictionaries) {
+  auto options = SharedMemoryRingOptions::Defaults();
+  options.capacity = 16 * 1024;
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeDictionaryFlat(&batch));
+  // The dictionaries are copied out of the ring, so that they do not hold
+  // back the batches
+  std::vector<std::shared_ptr<RecordBatch>> batches(10, batch);
+  CheckRoundTrip(batches, options);
+}
+
+TEST_F(TestSharedMemoryRing, ZeroCopyRelease) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(400, &batch));
+
+  auto options = SharedMemoryRingOptions::Defaults();
+  options.capacity = 6 * 1024;
+  std::shared_ptr<SharedMemoryRingWriter> writer;
+  ASSERT_OK(SharedMemoryRingWriter::Create(path_, batch->schema(), options, &writer));
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(SharedMemoryRingReader::Open(path_, options, &reader));
+
+  // Only one batch fits in the ring at a time: each write must wait for the
+  // previously read batch to be destroyed
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(reader->ReadNext(&result));
+  CompareBatch(*batch, *result);
+
+  Status write_status;
+  std::thread producer([&]() { write_status = writer->WriteRecordBatch(*batch); });
+  result.reset();
+  producer.join();
+  ASSERT_OK(write_status);
+
+  ASSERT_OK(reader->ReadNext(&result));
+  CompareBatch(*batch, *result);
+  result.reset();
+  ASSERT_OK(writer->Close());
+  ASSERT_OK(reader->ReadNext(&result));
+  ASSERT_EQ(nullptr, result);
+}
+
+TEST_F(TestSharedMemoryRing, MessageTooLarge) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(10000, &batch));
+
+  auto options = SharedMemoryRingOptions::Defaults();
+  options.capacity = 4 * 1024;
+  std::shared_ptr<SharedMemoryRingWriter> writer;
+  ASSERT_OK(SharedMemoryRingWriter::Create(path_, batch->schema(), options, &writer));
+  ASSERT_RAISES(CapacityError, writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestSharedMemoryRing, InvalidOptions) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  auto options = SharedMemoryRingOptions::Defaults();
+  options.capacity = 1001;
+  std::shared_ptr<SharedMemoryRingWriter> writer;
+  ASSERT_RAISES(Invalid,
+                SharedMemoryRingWriter::Create(path_, batch->schema(), options, &writer));
+}
+
+}  // namespace ipc
+}  // namespace arrow
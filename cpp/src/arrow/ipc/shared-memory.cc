@@ -0,0 +1,469 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/shared-memory.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/util.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace ipc {
+
+// ----------------------------------------------------------------------
+// Ring layout
+//
+// The file starts with a control block, followed by the ring data.  Each
+// message is stored contiguously in a record, starting at a multiple of 8
+// bytes from the start of the data:
+//
+//   <record header: 16 bytes><message metadata><message body>
+//
+// Records never wrap around the end of the ring.  If fewer than
+// sizeof(RecordHeader) bytes remain before the end, both sides skip them;
+// otherwise the writer fills the remaining space with a padding record.
+//
+// The writer publishes records by advancing the head.  The reader marks each
+// record as released once it is done with it, and the writer reclaims the
+// released records in order.  Positions are logical offsets which only ever
+// increase; the offset in the data is the position modulo the capacity.
+
+namespace {
+
+constexpr char kRingMagic[8] = {'A', 'R', 'R', 'O', 'W', 'S', 'H', 'M'};
+
+struct RingControl {
+  char magic[8];
+  int64_t capacity;
+  // The head, written by the writer only
+  alignas(64) std::atomic<int64_t> head;
+  // Set by the writer when the stream is finished
+  alignas(64) std::atomic<int32_t> closed;
+};
+
+struct RecordHeader {
+  // Set by the reader when the record can be reclaimed
+  std::atomic<int32_t> released;
+  int32_t is_padding;
+  // The size of the record, excluding this header
+  int64_t size;
+};
+
+static_assert(sizeof(std::atomic<int64_t>) == sizeof(int64_t),
+              "std::atomic<int64_t> must be usable in shared memory");
+static_assert(sizeof(RecordHeader) == 16, "unexpected record header size");
+
+constexpr int64_t kControlSize = 256;
+static_assert(sizeof(RingControl) <= kControlSize, "unexpected ring control size");
+
+inline void Wait(int64_t poll_interval_us) {
+  std::this_thread::sleep_for(std::chrono::microseconds(poll_interval_us));
+}
+
+Status MapRing(const std::string& path, std::shared_ptr<io::MemoryMappedFile>* file,
+               std::shared_ptr<Buffer>* region) {
+  int64_t size = 0;
+  RETURN_NOT_OK((*file)->GetSize(&size));
+  if (size < kControlSize) {
+    return Status::Invalid("Shared memory ring file '", path, "' is too small");
+  }
+  return (*file)->ReadAt(0, size, region);
+}
+
+}  // namespace
+
+SharedMemoryRingOptions SharedMemoryRingOptions::Defaults() {
+  return SharedMemoryRingOptions();
+}
+
+// ----------------------------------------------------------------------
+// Writer implementation
+
+class SharedMemoryRingWriter::SharedMemoryRingWriterImpl {
+ public:
+  SharedMemoryRingWriterImpl(const std::shared_ptr<Schema>& schema,
+                             const SharedMemoryRingOptions& options)
+      : schema_(schema),
+        options_(options),
+        pool_(default_memory_pool()),
+        control_(nullptr),
+        data_(nullptr),
+        capacity_(0),
+        head_(0),
+        tail_(0),
+        closed_(false) {}
+
+  Status Open(const std::string& path) {
+    if (options_.capacity <= 0 || options_.capacity % 8 != 0) {
+      return Status::Invalid("Shared memory ring capacity must be a positive ",
+                             "multiple of 8, got ", options_.capacity);
+    }
+    capacity_ = options_.capacity;
+    RETURN_NOT_OK(io::MemoryMappedFile::Create(path, kControlSize + capacity_, &file_));
+    RETURN_NOT_OK(MapRing(path, &file_, &region_));
+
+    uint8_t* base = const_cast<uint8_t*>(region_->data());
+    control_ = new (base) RingControl;
+    data_ = base + kControlSize;
+    control_->capacity = capacity_;
+    control_->head.store(0);
+    control_->closed.store(0);
+    // The magic is written last, so that a reader never sees a partially
+    // initialized control block
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(control_->magic, kRingMagic, sizeof(kRingMagic));
+
+    // The schema and dictionaries are the first messages of the stream
+    internal::IpcPayload payload;
+    DictionaryMemo dictionary_memo;
+    RETURN_NOT_OK(
+        internal::GetSchemaPayload(*schema_, pool_, &dictionary_memo, &payload));
+    RETURN_NOT_OK(WritePayload(payload));
+
+    std::vector<std::unique_ptr<internal::IpcPayload>> dictionaries;
+    RETURN_NOT_OK(internal::GetDictionaryPayloads(*schema_, &dictionaries));
+    for (const auto& dictionary : dictionaries) {
+      RETURN_NOT_OK(WritePayload(*dictionary));
+    }
+    return Status::OK();
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) {
+    if (closed_) {
+      return Status::Invalid("Shared memory ring writer is closed");
+    }
+    if (!batch.schema()->Equals(*schema_, false /* check_metadata */)) {
+      return Status::Invalid("Tried to write record batch with different schema");
+    }
+    internal::IpcPayload payload;
+    RETURN_NOT_OK(internal::GetRecordBatchPayload(batch, pool_, &payload));
+    return WritePayload(payload);
+  }
+
+  Status Close() {
+    if (!closed_) {
+      closed_ = true;
+      control_->closed.store(1, std::memory_order_release);
+    }
+    return Status::OK();
+  }
+
+  void set_memory_pool(MemoryPool* pool) { pool_ = pool; }
+
+ private:
+  RecordHeader* HeaderAt(int64_t position) {
+    return reinterpret_cast<RecordHeader*>(data_ + position % capacity_);
+  }
+
+  int64_t RemainingBeforeEnd(int64_t position) const {
+    return capacity_ - position % capacity_;
+  }
+
+  // Advance the tail over the records released by the reader
+  void Reclaim() {
+    while (tail_ < head_) {
+      const int64_t remaining = RemainingBeforeEnd(tail_);
+      if (remaining < static_cast<int64_t>(sizeof(RecordHeader))) {
+        tail_ += remaining;
+        continue;
+      }
+      RecordHeader* header = HeaderAt(tail_);
+      if (header->released.load(std::memory_order_acquire) == 0) {
+        break;
+      }
+      tail_ += static_cast<int64_t>(sizeof(RecordHeader)) + header->size;
+    }
+  }
+
+  Status WritePayload(const internal::IpcPayload& payload) {
+    const int64_t metadata_length = BitUtil::RoundUpToMultipleOf8(
+        payload.metadata->size() + static_cast<int64_t>(sizeof(int32_t)));
+    const int64_t record_size = metadata_length + payload.body_length;
+    const int64_t total = static_cast<int64_t>(sizeof(RecordHeader)) + record_size;
+    if (total > capacity_) {
+      return Status::CapacityError("IPC message of ", total,
+                                   " bytes does not fit in a shared memory ring of ",
+                                   capacity_, " bytes");
+    }
+
+    // Skip the end of the ring if the record does not fit before it
+    const int64_t remaining = RemainingBeforeEnd(head_);
+    const int64_t skip = total > remaining ? remaining : 0;
+
+    // Wait for the reader to release enough space
+    Reclaim();
+    while (head_ + skip + total - tail_ > capacity_) {
+      Wait(options_.poll_interval_us);
+      Reclaim();
+    }
+
+    if (skip >= static_cast<int64_t>(sizeof(RecordHeader))) {
+      RecordHeader* padding = HeaderAt(head_);
+      padding->is_padding = 1;
+      padding->size = skip - static_cast<int64_t>(sizeof(RecordHeader));
+      padding->released.store(1, std::memory_order_relaxed);
+    }
+    const int64_t position = head_ + skip;
+
+    RecordHeader* header = HeaderAt(position);
+    header->is_padding = 0;
+    header->size = record_size;
+    header->released.store(0, std::memory_order_relaxed);
+
+    auto record = std::make_shared<MutableBuffer>(
+        reinterpret_cast<uint8_t*>(header) + sizeof(RecordHeader), record_size);
+    io::FixedSizeBufferWriter stream(record);
+    int32_t written_metadata_length = 0;
+    RETURN_NOT_OK(internal::WriteIpcPayload(payload, &stream, &written_metadata_length));
+    int64_t written = 0;
+    RETURN_NOT_OK(stream.Tell(&written));
+    if (written != record_size) {
+      return Status::IOError("Wrote ", written, " bytes in a shared memory ring ",
+                             "record of ", record_size, " bytes");
+    }
+
+    // Publish the record
+    head_ = position + total;
+    control_->head.store(head_, std::memory_order_release);
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema_;
+  SharedMemoryRingOptions options_;
+  MemoryPool* pool_;
+
+  std::shared_ptr<io::MemoryMappedFile> file_;
+  std::shared_ptr<Buffer> region_;
+  RingControl* control_;
+  uint8_t* data_;
+  int64_t capacity_;
+
+  int64_t head_;
+  int64_t tail_;
+  bool closed_;
+};
+
+SharedMemoryRingWriter::SharedMemoryRingWriter() {}
+
+SharedMemoryRingWriter::~SharedMemoryRingWriter() {
+  if (impl_) {
+    DCHECK_OK(impl_->Close());
+  }
+}
+
+Status SharedMemoryRingWriter::Create(const std::string& path,
+                                      const std::shared_ptr<Schema>& schema,
+                                      const SharedMemoryRingOptions& options,
+                                      std::shared_ptr<SharedMemoryRingWriter>* out) {
+  std::shared_ptr<SharedMemoryRingWriter> result(new SharedMemoryRingWriter());
+  std::unique_ptr<SharedMemoryRingWriterImpl> impl(
+      new SharedMemoryRingWriterImpl(schema, options));
+  RETURN_NOT_OK(impl->Open(path));
+  result->impl_ = std::move(impl);
+  *out = result;
+  return Status::OK();
+}
+
+Status SharedMemoryRingWriter::WriteRecordBatch(const RecordBatch& batch,
+                                                bool allow_64bit) {
+  // Record batch payloads always allow 64-bit lengths
+  ARROW_UNUSED(allow_64bit);
+  return impl_->WriteRecordBatch(batch);
+}
+
+Status SharedMemoryRingWriter::Close() { return impl_->Close(); }
+
+void SharedMemoryRingWriter::set_memory_pool(MemoryPool* pool) {
+  impl_->set_memory_pool(pool);
+}
+
+// ----------------------------------------------------------------------
+// Reader implementation
+
+namespace {
+
+/// \brief A buffer referencing a ring record, which releases the record to
+/// the writer when destroyed
+class RingRecordBuffer : public Buffer {
+ public:
+  RingRecordBuffer(const std::shared_ptr<Buffer>& region, RecordHeader* header)
+      : Buffer(reinterpret_cast<const uint8_t*>(header) + sizeof(RecordHeader),
+               header->size),
+        header_(header) {
+    // Keep the mapping alive for as long as the record is referenced
+    parent_ = region;
+  }
+
+  ~RingRecordBuffer() override { header_->released.store(1, std::memory_order_release); }
+
+ private:
+  RecordHeader* header_;
+};
+
+}  // namespace
+
+class SharedMemoryRingReader::SharedMemoryRingReaderImpl {
+ public:
+  explicit SharedMemoryRingReaderImpl(const SharedMemoryRingOptions& options)
+      : options_(options),
+        control_(nullptr),
+        data_(nullptr),
+        capacity_(0),
+        position_(0) {}
+
+  Status Open(const std::string& path) {
+    RETURN_NOT_OK(io::MemoryMappedFile::Open(path, io::FileMode::READWRITE, &file_));
+    RETURN_NOT_OK(MapRing(path, &file_, &region_));
+
+    uint8_t* base = const_cast<uint8_t*>(region_->data());
+    control_ = reinterpret_cast<RingControl*>(base);
+    if (std::memcmp(control_->magic, kRingMagic, sizeof(kRingMagic)) != 0) {
+      return Status::Invalid("File '", path, "' is not a shared memory ring");
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    capacity_ = control_->capacity;
+    if (capacity_ <= 0 || kControlSize + capacity_ > region_->size()) {
+      return Status::Invalid("Invalid shared memory ring capacity: ", capacity_);
+    }
+    data_ = base + kControlSize;
+    return Status::OK();
+  }
+
+  Status ReadNextMessage(std::unique_ptr<Message>* message) {
+    std::shared_ptr<Buffer> record;
+    RETURN_NOT_OK(NextRecord(&record));
+    if (record == nullptr) {
+      // End of stream
+      *message = nullptr;
+      return Status::OK();
+    }
+    // The metadata and body are slices of the record
+    RETURN_NOT_OK(ParseRecord(record, message));
+    if ((*message)->type() != Message::RECORD_BATCH) {
+      // The schema and dictionaries live as long as the stream: copy them out
+      // of the ring, lest they hold back the reclaiming of later records
+      std::shared_ptr<Buffer> copy;
+      RETURN_NOT_OK(record->Copy(0, record->size(), &copy));
+      message->reset();
+      record.reset();
+      RETURN_NOT_OK(ParseRecord(copy, message));
+    }
+    return Status::OK();
+  }
+
+ private:
+  Status ParseRecord(const std::shared_ptr<Buffer>& record,
+                     std::unique_ptr<Message>* message) {
+    io::BufferReader stream(record);
+    RETURN_NOT_OK(ReadMessage(&stream, message));
+    if (*message == nullptr) {
+      return Status::IOError("Unexpected end of stream marker in shared memory ring");
+    }
+    return Status::OK();
+  }
+
+  Status NextRecord(std::shared_ptr<Buffer>* out) {
+    while (true) {
+      // Load the closed flag first: once it is set, the head is final
+      const bool closed = control_->closed.load(std::memory_order_acquire) != 0;
+      const int64_t head = control_->head.load(std::memory_order_acquire);
+
+      while (position_ < head) {
+        const int64_t remaining = capacity_ - position_ % capacity_;
+        if (remaining < static_cast<int64_t>(sizeof(RecordHeader))) {
+          position_ += remaining;
+          continue;
+        }
+        auto header = reinterpret_cast<RecordHeader*>(data_ + position_ % capacity_);
+        if (header->size < 0 ||
+            header->size > remaining - static_cast<int64_t>(sizeof(RecordHeader))) {
+          return Status::IOError("Corrupt shared memory ring record of size ",
+                                 header->size);
+        }
+        position_ += static_cast<int64_t>(sizeof(RecordHeader)) + header->size;
+        if (!header->is_padding) {
+          *out = std::make_shared<RingRecordBuffer>(region_, header);
+          return Status::OK();
+        }
+      }
+
+      if (closed) {
+        *out = nullptr;
+        return Status::OK();
+      }
+      Wait(options_.poll_interval_us);
+    }
+  }
+
+  SharedMemoryRingOptions options_;
+
+  std::shared_ptr<io::MemoryMappedFile> file_;
+  std::shared_ptr<Buffer> region_;
+  RingControl* control_;
+  uint8_t* data_;
+  int64_t capacity_;
+
+  int64_t position_;
+};
+
+SharedMemoryRingReader::SharedMemoryRingReader() {}
+
+SharedMemoryRingReader::~SharedMemoryRingReader() {}
+
+Status SharedMemoryRingReader::Open(const std::string& path,
+                                    const SharedMemoryRingOptions& options,
+                                    std::unique_ptr<MessageReader>* out) {
+  std::unique_ptr<SharedMemoryRingReader> result(new SharedMemoryRingReader());
+  result->impl_.reset(new SharedMemoryRingReaderImpl(options));
+  RETURN_NOT_OK(result->impl_->Open(path));
+  *out = std::move(result);
+  return Status::OK();
+}
+
+Status SharedMemoryRingReader::Open(const std::string& path,
+                                    const SharedMemoryRingOptions& options,
+                                    std::shared_ptr<RecordBatchReader>* out) {
+  std::unique_ptr<MessageReader> message_reader;
+  RETURN_NOT_OK(Open(path, options, &message_reader));
+  return RecordBatchStreamReader::Open(std::move(message_reader), out);
+}
+
+Status SharedMemoryRingReader::ReadNextMessage(std::unique_ptr<Message>* message) {
+  return impl_->ReadNextMessage(message);
+}
+
+}  // namespace ipc
+}  // namespace arrow
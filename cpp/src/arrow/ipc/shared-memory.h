@@ -0,0 +1,147 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Streaming of record batches between processes of the same host through a
+// ring buffer in a shared memory-mapped file
+
+#ifndef ARROW_IPC_SHARED_MEMORY_H
+#define ARROW_IPC_SHARED_MEMORY_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/ipc/message.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class MemoryPool;
+class Schema;
+class Status;
+
+namespace ipc {
+
+/// \brief Options for the shared-memory ring
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+struct ARROW_EXPORT SharedMemoryRingOptions {
+  /// The size in bytes of the ring data, when creating it.  Every message
+  /// (metadata and body) must fit in the ring.
+  int64_t capacity = 64 << 20;
+  /// How long to sleep between polls of the ring when waiting for space or
+  /// for messages, in microseconds
+  int64_t poll_interval_us = 20;
+
+  static SharedMemoryRingOptions Defaults();
+};
+
+/// \class SharedMemoryRingWriter
+/// \brief Write a stream of record batches into a ring buffer held by a
+/// memory-mapped file, e.g. in /dev/shm
+///
+/// Each IPC message is copied once, directly into the ring.  The writer
+/// waits for the reader to release earlier messages when the ring is full.
+/// The dictionaries are those of the schema; they must not change between
+/// batches.  There must be a single writer and a single reader per ring.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class ARROW_EXPORT SharedMemoryRingWriter : public RecordBatchWriter {
+ public:
+  ~SharedMemoryRingWriter() override;
+
+  /// \brief Create the ring file, replacing any existing file, and write the
+  /// schema (and dictionaries) into it
+  ///
+  /// \param[in] path the path of the file to create
+  /// \param[in] schema the schema of the record batches to be written
+  /// \param[in] options the ring options
+  /// \param[out] out the created writer
+  /// \return Status
+  static Status Create(const std::string& path, const std::shared_ptr<Schema>& schema,
+                       const SharedMemoryRingOptions& options,
+                       std::shared_ptr<SharedMemoryRingWriter>* out);
+
+  /// \brief Write a record batch, waiting for space in the ring if needed
+  Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit = false) override;
+
+  /// \brief Signal the end of the stream to the reader
+  Status Close() override;
+
+  void set_memory_pool(MemoryPool* pool) override;
+
+ private:
+  SharedMemoryRingWriter();
+
+  class ARROW_NO_EXPORT SharedMemoryRingWriterImpl;
+  std::unique_ptr<SharedMemoryRingWriterImpl> impl_;
+};
+
+/// \class SharedMemoryRingReader
+/// \brief Read the messages written by a SharedMemoryRingWriter, zero-copy
+///
+/// The metadata and body of each message reference the ring memory.  A
+/// message is released to the writer once all the buffers referencing it,
+/// including those of the record batches decoded from it, are destroyed.
+/// Messages may be released in any order, but their space is reclaimed in
+/// order.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class ARROW_EXPORT SharedMemoryRingReader : public MessageReader {
+ public:
+  ~SharedMemoryRingReader() override;
+
+  /// \brief Open a ring file created by a SharedMemoryRingWriter
+  ///
+  /// \param[in] path the path of the ring file
+  /// \param[in] options the ring options (the capacity is read from the file)
+  /// \param[out] out the message reader
+  /// \return Status
+  static Status Open(const std::string& path, const SharedMemoryRingOptions& options,
+                     std::unique_ptr<MessageReader>* out);
+
+  /// \brief Open a ring file as a stream of record batches
+  ///
+  /// \param[in] path the path of the ring file
+  /// \param[in] options the ring options (the capacity is read from the file)
+  /// \param[out] out the record batch reader
+  /// \return Status
+  static Status Open(const std::string& path, const SharedMemoryRingOptions& options,
+                     std::shared_ptr<RecordBatchReader>* out);
+
+  /// \brief Read the next message, waiting for it if needed
+  ///
+  /// The message is null once the writer is closed and all the messages are
+  /// read.
+  Status ReadNextMessage(std::unique_ptr<Message>* message) override;
+
+ private:
+  SharedMemoryRingReader();
+
+  class ARROW_NO_EXPORT SharedMemoryRingReaderImpl;
+  std::unique_ptr<SharedMemoryRingReaderImpl> impl_;
+};
+
+}  // namespace ipc
+}  // namespace arrow
+
+#endif  // ARROW_IPC_SHARED_MEMORY_H
@@ -21,7 +21,10 @@
 #include <cstdint>
 #include <cstring>
 #include <limits>
+#include <memory>
 #include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 #include "arrow/array.h"
@@ -42,6 +45,9 @@
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
+#include "arrow/util/tracing.h"
 #include "arrow/visitor.h"
 
 namespace arrow {
@@ -94,6 +100,39 @@ inline Status GetTruncatedBuffer(int64_t offset, int64_t length,
   return Status::OK();
 }
 
+// Compress a body buffer, prefixed with its uncompressed length, or with -1
+// and left uncompressed if compression doesn't pay off
+static Status CompressBodyBuffer(const Buffer& buffer, util::Codec* codec,
+                                 int64_t min_compression_size, MemoryPool* pool,
+                                 std::shared_ptr<Buffer>* out) {
+  const int64_t prefix_size = static_cast<int64_t>(sizeof(int64_t));
+  const int64_t size = buffer.size();
+  if (size >= min_compression_size) {
+    ARROW_TRACE_SPAN("ipc", "compress");
+    const int64_t max_length = codec->MaxCompressedLen(size, buffer.data());
+    std::shared_ptr<ResizableBuffer> result;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool, prefix_size + max_length, &result));
+    int64_t compressed_length = 0;
+    RETURN_NOT_OK(codec->Compress(size, buffer.data(), max_length,
+                                  result->mutable_data() + prefix_size,
+                                  &compressed_length));
+    if (compressed_length < size) {
+      const int64_t prefix = BitUtil::ToLittleEndian(size);
+      std::memcpy(result->mutable_data(), &prefix, prefix_size);
+      RETURN_NOT_OK(result->Resize(prefix_size + compressed_length));
+      *out = result;
+      return Status::OK();
+    }
+  }
+  std::shared_ptr<Buffer> result;
+  RETURN_NOT_OK(AllocateBuffer(pool, prefix_size + size, &result));
+  const int64_t prefix = BitUtil::ToLittleEndian(static_cast<int64_t>(-1));
+  std::memcpy(result->mutable_data(), &prefix, prefix_size);
+  std::memcpy(result->mutable_data() + prefix_size, buffer.data(), size);
+  *out = result;
+  return Status::OK();
+}
+
 static inline bool NeedTruncate(int64_t offset, const Buffer* buffer,
                                 int64_t min_length) {
   // buffer can be NULL
@@ -108,12 +147,14 @@ namespace internal {
 class RecordBatchSerializer : public ArrayVisitor {
  public:
   RecordBatchSerializer(MemoryPool* pool, int64_t buffer_start_offset,
-                        int max_recursion_depth, bool allow_64bit, IpcPayload* out)
+                        int max_recursion_depth, bool allow_64bit, IpcPayload* out,
+                        const IpcWriteOptions& options = IpcWriteOptions::Defaults())
       : out_(out),
         pool_(pool),
         max_recursion_depth_(max_recursion_depth),
         buffer_start_offset_(buffer_start_offset),
-        allow_64bit_(allow_64bit) {
+        allow_64bit_(allow_64bit),
+        options_(options) {
     DCHECK_GT(max_recursion_depth, 0);
   }
 
@@ -146,7 +187,62 @@ class RecordBatchSerializer : public ArrayVisitor {
   // Override this for writing dictionary metadata
   virtual Status SerializeMetadata(int64_t num_rows) {
     return WriteRecordBatchMessage(num_rows, out_->body_length, field_nodes_,
-                                   buffer_meta_, &out_->metadata);
+                                   buffer_meta_, options_.compression, &out_->metadata);
+  }
+
+  // Replace the body buffers with their compressed versions
+  Status CompressBodyBuffers() {
+    if (options_.compression != Compression::LZ4 &&
+        options_.compression != Compression::ZSTD) {
+      return Status::Invalid("IPC body compression only supports LZ4 and ZSTD");
+    }
+    std::unique_ptr<util::Codec> codec;
+    RETURN_NOT_OK(
+        util::Codec::Create(options_.compression, options_.compression_level, &codec));
+
+    // Wide batches have many buffers worth compressing concurrently
+    auto task_group = MakeTaskGroup(out_->body_buffers.size());
+    for (auto& body_buffer : out_->body_buffers) {
+      if (!body_buffer || body_buffer->size() == 0) {
+        // Written as an empty buffer, which readers don't decompress
+        continue;
+      }
+      std::shared_ptr<Buffer>* target = &body_buffer;
+      util::Codec* raw_codec = codec.get();
+      task_group->Append([this, target, raw_codec]() {
+        std::shared_ptr<Buffer> input = *target;
+        return CompressBodyBuffer(*input, raw_codec, options_.min_compression_size,
+                                  pool_, target);
+      });
+    }
+    return task_group->Finish();
+  }
+
+  // Lay out the columns concurrently, each with its own serializer, then
+  // append their field nodes and buffers in column order
+  Status VisitColumnsInParallel(const RecordBatch& batch) {
+    const int num_columns = batch.num_columns();
+    std::vector<IpcPayload> column_payloads(num_columns);
+    std::vector<std::unique_ptr<RecordBatchSerializer>> column_serializers(num_columns);
+    auto task_group = MakeTaskGroup(num_columns);
+    for (int i = 0; i < num_columns; ++i) {
+      column_serializers[i].reset(
+          new RecordBatchSerializer(pool_, 0, static_cast<int>(max_recursion_depth_),
+                                    allow_64bit_, &column_payloads[i], options_));
+      RecordBatchSerializer* serializer = column_serializers[i].get();
+      const Array* column = batch.column(i).get();
+      task_group->Append(
+          [serializer, column]() { return serializer->VisitArray(*column); });
+    }
+    RETURN_NOT_OK(task_group->Finish());
+
+    for (int i = 0; i < num_columns; ++i) {
+      const auto& nodes = column_serializers[i]->field_nodes_;
+      field_nodes_.insert(field_nodes_.end(), nodes.begin(), nodes.end());
+      const auto& buffers = column_payloads[i].body_buffers;
+      out_->body_buffers.insert(out_->body_buffers.end(), buffers.begin(), buffers.end());
+    }
+    return Status::OK();
   }
 
   Status Assemble(const RecordBatch& batch) {
@@ -156,9 +252,18 @@ class RecordBatchSerializer : public ArrayVisitor {
       out_->body_buffers.clear();
     }
 
-    // Perform depth-first traversal of the row-batch
-    for (int i = 0; i < batch.num_columns(); ++i) {
-      RETURN_NOT_OK(VisitArray(*batch.column(i)));
+    if (options_.use_threads && batch.num_columns() > 1 &&
+        !::arrow::internal::GetCpuThreadPool()->OwnsThisThread()) {
+      RETURN_NOT_OK(VisitColumnsInParallel(batch));
+    } else {
+      // Perform depth-first traversal of the row-batch
+      for (int i = 0; i < batch.num_columns(); ++i) {
+        RETURN_NOT_OK(VisitArray(*batch.column(i)));
+      }
+    }
+
+    if (options_.compression != Compression::UNCOMPRESSED) {
+      RETURN_NOT_OK(CompressBodyBuffers());
     }
 
     // The position for the start of a buffer relative to the passed frame of
@@ -195,6 +300,16 @@ class RecordBatchSerializer : public ArrayVisitor {
   }
 
  protected:
+  // A threaded task group if enabled and worth it for the given number of
+  // tasks, a serial one otherwise
+  std::shared_ptr<::arrow::internal::TaskGroup> MakeTaskGroup(size_t num_tasks) const {
+    auto thread_pool = ::arrow::internal::GetCpuThreadPool();
+    if (options_.use_threads && num_tasks > 1 && !thread_pool->OwnsThisThread()) {
+      return ::arrow::internal::TaskGroup::MakeThreaded(thread_pool);
+    }
+    return ::arrow::internal::TaskGroup::MakeSerial();
+  }
+
   template <typename ArrayType>
   Status VisitFixedWidth(const ArrayType& array) {
     std::shared_ptr<Buffer> data = array.values();
@@ -461,19 +576,24 @@ class RecordBatchSerializer : public ArrayVisitor {
   int64_t max_recursion_depth_;
   int64_t buffer_start_offset_;
   bool allow_64bit_;
+  IpcWriteOptions options_;
 };
 
 class DictionaryWriter : public RecordBatchSerializer {
  public:
   DictionaryWriter(int64_t dictionary_id, MemoryPool* pool, int64_t buffer_start_offset,
-                   int max_recursion_depth, bool allow_64bit, IpcPayload* out)
+                   int max_recursion_depth, bool allow_64bit, IpcPayload* out,
+                   const IpcWriteOptions& options = IpcWriteOptions::Defaults(),
+                   bool is_delta = false)
       : RecordBatchSerializer(pool, buffer_start_offset, max_recursion_depth, allow_64bit,
-                              out),
-        dictionary_id_(dictionary_id) {}
+                              out, options),
+        dictionary_id_(dictionary_id),
+        is_delta_(is_delta) {}
 
   Status SerializeMetadata(int64_t num_rows) override {
     return WriteDictionaryMessage(dictionary_id_, num_rows, out_->body_length,
-                                  field_nodes_, buffer_meta_, &out_->metadata);
+                                  field_nodes_, buffer_meta_, options_.compression,
+                                  is_delta_, &out_->metadata);
   }
 
   Status Assemble(const std::shared_ptr<Array>& dictionary) {
@@ -485,6 +605,7 @@ class DictionaryWriter : public RecordBatchSerializer {
 
  private:
   int64_t dictionary_id_;
+  bool is_delta_;
 };
 
 Status WriteIpcPayload(const IpcPayload& payload, io::OutputStream* dst,
@@ -496,9 +617,12 @@ Status WriteIpcPayload(const IpcPayload& payload, io::OutputStream* dst,
   RETURN_NOT_OK(CheckAligned(dst));
 #endif
 
-  // Now write the buffers
+  // Now write the buffers, handed over at once so that the sink can avoid
+  // copying them
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  buffers.reserve(payload.body_buffers.size() * 2);
   for (size_t i = 0; i < payload.body_buffers.size(); ++i) {
-    const Buffer* buffer = payload.body_buffers[i].get();
+    const std::shared_ptr<Buffer>& buffer = payload.body_buffers[i];
     int64_t size = 0;
     int64_t padding = 0;
 
@@ -509,13 +633,14 @@ Status WriteIpcPayload(const IpcPayload& payload, io::OutputStream* dst,
     }
 
     if (size > 0) {
-      RETURN_NOT_OK(dst->Write(buffer->data(), size));
+      buffers.push_back(buffer);
     }
 
     if (padding > 0) {
-      RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
+      buffers.push_back(std::make_shared<Buffer>(kPaddingBytes, padding));
     }
   }
+  RETURN_NOT_OK(dst->Write(buffers));
 
 #ifndef NDEBUG
   RETURN_NOT_OK(CheckAligned(dst));
@@ -539,15 +664,51 @@ Status GetRecordBatchPayload(const RecordBatch& batch, MemoryPool* pool,
   return writer.Assemble(batch);
 }
 
+Status GetRecordBatchPayload(const RecordBatch& batch, const IpcWriteOptions& options,
+                             MemoryPool* pool, IpcPayload* out) {
+  RecordBatchSerializer writer(pool, 0, kMaxNestingDepth, true, out, options);
+  return writer.Assemble(batch);
+}
+
+Status GetDictionaryPayloads(const Schema& schema,
+                             std::vector<std::unique_ptr<IpcPayload>>* out) {
+  // Assign the dictionary ids the same way as GetSchemaPayload does
+  DictionaryMemo dictionary_memo;
+  std::shared_ptr<Buffer> schema_metadata;
+  RETURN_NOT_OK(WriteSchemaMessage(schema, &dictionary_memo, &schema_metadata));
+
+  out->clear();
+  for (const auto& pair : dictionary_memo.id_to_dictionary()) {
+    std::unique_ptr<IpcPayload> payload(new IpcPayload);
+    DictionaryWriter writer(pair.first, default_memory_pool(), 0, kMaxNestingDepth,
+                            true, payload.get());
+    RETURN_NOT_OK(writer.Assemble(pair.second));
+    payload->type = Message::Type::DICTIONARY_BATCH;
+    out->emplace_back(std::move(payload));
+  }
+  return Status::OK();
+}
+
 }  // namespace internal
 
+IpcWriteOptions IpcWriteOptions::Defaults() { return IpcWriteOptions(); }
+
 Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
                         io::OutputStream* dst, int32_t* metadata_length,
                         int64_t* body_length, MemoryPool* pool, int max_recursion_depth,
                         bool allow_64bit) {
+  return WriteRecordBatch(batch, buffer_start_offset, dst, metadata_length, body_length,
+                          IpcWriteOptions::Defaults(), pool, max_recursion_depth,
+                          allow_64bit);
+}
+
+Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
+                        io::OutputStream* dst, int32_t* metadata_length,
+                        int64_t* body_length, const IpcWriteOptions& options,
+                        MemoryPool* pool, int max_recursion_depth, bool allow_64bit) {
   internal::IpcPayload payload;
   internal::RecordBatchSerializer writer(pool, buffer_start_offset, max_recursion_depth,
-                                         allow_64bit, &payload);
+                                         allow_64bit, &payload, options);
   RETURN_NOT_OK(writer.Assemble(batch));
 
   // TODO(wesm): it's a rough edge that the metadata and body length here are
@@ -703,6 +864,16 @@ class SparseTensorSerializer {
             VisitSparseCSRIndex(checked_cast<const SparseCSRIndex&>(sparse_index)));
         break;
 
+      case SparseTensorFormat::CSC:
+        RETURN_NOT_OK(
+            VisitSparseCSCIndex(checked_cast<const SparseCSCIndex&>(sparse_index)));
+        break;
+
+      case SparseTensorFormat::CSF:
+        RETURN_NOT_OK(
+            VisitSparseCSFIndex(checked_cast<const SparseCSFIndex&>(sparse_index)));
+        break;
+
       default:
         std::stringstream ss;
         ss << "Unable to convert type: " << sparse_index.ToString() << std::endl;
@@ -755,6 +926,22 @@ class SparseTensorSerializer {
     return Status::OK();
   }
 
+  Status VisitSparseCSCIndex(const SparseCSCIndex& sparse_index) {
+    out_->body_buffers.emplace_back(sparse_index.indptr()->data());
+    out_->body_buffers.emplace_back(sparse_index.indices()->data());
+    return Status::OK();
+  }
+
+  Status VisitSparseCSFIndex(const SparseCSFIndex& sparse_index) {
+    for (const auto& indptr : sparse_index.indptr()) {
+      out_->body_buffers.emplace_back(indptr->data());
+    }
+    for (const auto& indices : sparse_index.indices()) {
+      out_->body_buffers.emplace_back(indices->data());
+    }
+    return Status::OK();
+  }
+
   IpcPayload* out_;
 
   std::vector<internal::BufferMetadata> buffer_meta_;
@@ -783,10 +970,12 @@ Status WriteSparseTensor(const SparseTensor& sparse_tensor, io::OutputStream* ds
 
 Status WriteDictionary(int64_t dictionary_id, const std::shared_ptr<Array>& dictionary,
                        int64_t buffer_start_offset, io::OutputStream* dst,
-                       int32_t* metadata_length, int64_t* body_length, MemoryPool* pool) {
+                       int32_t* metadata_length, int64_t* body_length,
+                       const IpcWriteOptions& options, MemoryPool* pool,
+                       bool is_delta = false) {
   internal::IpcPayload payload;
   internal::DictionaryWriter writer(dictionary_id, pool, buffer_start_offset,
-                                    kMaxNestingDepth, true, &payload);
+                                    kMaxNestingDepth, true, &payload, options, is_delta);
   RETURN_NOT_OK(writer.Assemble(dictionary));
 
   // The body size is computed in the payload
@@ -878,14 +1067,28 @@ class StreamBookKeeper {
   int64_t position_;
 };
 
+// Collect the dictionary types of a type and its descendants, depth-first
+static void CollectDictionaryTypes(const DataType& type,
+                                   std::vector<const DictionaryType*>* out) {
+  if (type.id() == Type::DICTIONARY) {
+    out->push_back(&checked_cast<const DictionaryType&>(type));
+    return;
+  }
+  for (const auto& child : type.children()) {
+    CollectDictionaryTypes(*child->type(), out);
+  }
+}
+
 class SchemaWriter : public StreamBookKeeper {
  public:
   SchemaWriter(const Schema& schema, DictionaryMemo* dictionary_memo, MemoryPool* pool,
-               io::OutputStream* sink)
+               io::OutputStream* sink,
+               const IpcWriteOptions& options = IpcWriteOptions::Defaults())
       : StreamBookKeeper(sink),
         pool_(pool),
         schema_(schema),
-        dictionary_memo_(dictionary_memo) {}
+        dictionary_memo_(dictionary_memo),
+        options_(options) {}
 
   Status WriteSchema() {
 #ifndef NDEBUG
@@ -917,7 +1120,8 @@ class SchemaWriter : public StreamBookKeeper {
       // Frame of reference in file format is 0, see ARROW-384
       const int64_t buffer_start_offset = 0;
       RETURN_NOT_OK(WriteDictionary(entry.first, entry.second, buffer_start_offset, sink_,
-                                    &block->metadata_length, &block->body_length, pool_));
+                                    &block->metadata_length, &block->body_length,
+                                    options_, pool_));
       RETURN_NOT_OK(UpdatePositionCheckAligned());
     }
 
@@ -935,26 +1139,96 @@ class SchemaWriter : public StreamBookKeeper {
   MemoryPool* pool_;
   const Schema& schema_;
   DictionaryMemo* dictionary_memo_;
+  IpcWriteOptions options_;
 };
 
 class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKeeper {
  public:
   RecordBatchStreamWriterImpl(io::OutputStream* sink,
-                              const std::shared_ptr<Schema>& schema)
+                              const std::shared_ptr<Schema>& schema,
+                              const IpcWriteOptions& options)
       : StreamBookKeeper(sink),
         schema_(schema),
+        options_(options),
         pool_(default_memory_pool()),
         started_(false) {}
 
   virtual ~RecordBatchStreamWriterImpl() = default;
 
   virtual Status Start() {
-    SchemaWriter schema_writer(*schema_, &dictionary_memo_, pool_, sink_);
+    SchemaWriter schema_writer(*schema_, &dictionary_memo_, pool_, sink_, options_);
     RETURN_NOT_OK(schema_writer.Write(&dictionaries_));
+
+    std::vector<const DictionaryType*> dictionary_types;
+    for (const auto& field : schema_->fields()) {
+      CollectDictionaryTypes(*field->type(), &dictionary_types);
+    }
+    for (const DictionaryType* type : dictionary_types) {
+      const int64_t id = dictionary_memo_.GetId(type->dictionary());
+      dictionary_ids_.push_back(id);
+      current_dictionaries_[id] = type->dictionary();
+    }
     started_ = true;
     return Status::OK();
   }
 
+  // Write a replacement or delta dictionary batch for each dictionary of the
+  // batch differing from the last one written with the same id
+  Status WriteDictionaryUpdates(const RecordBatch& batch) {
+    std::vector<const DictionaryType*> dictionary_types;
+    for (int i = 0; i < batch.num_columns(); ++i) {
+      CollectDictionaryTypes(*batch.column(i)->type(), &dictionary_types);
+    }
+    if (dictionary_types.size() != dictionary_ids_.size()) {
+      return Status::Invalid("Record batch has ", dictionary_types.size(),
+                             " dictionary-encoded fields, schema has ",
+                             dictionary_ids_.size());
+    }
+
+    std::unordered_set<int64_t> updated_ids;
+    for (size_t i = 0; i < dictionary_types.size(); ++i) {
+      const int64_t id = dictionary_ids_[i];
+      const std::shared_ptr<Array>& dictionary = dictionary_types[i]->dictionary();
+      std::shared_ptr<Array>& current = current_dictionaries_[id];
+      if (dictionary.get() == current.get()) {
+        continue;
+      }
+
+      const int64_t current_length = current->length();
+      const bool extends_current =
+          dictionary->length() >= current_length &&
+          dictionary->type()->Equals(*current->type()) &&
+          dictionary->RangeEquals(0, current_length, 0, *current);
+      if (extends_current && dictionary->length() == current_length) {
+        current = dictionary;
+        continue;
+      }
+      if (!allow_dictionary_updates_) {
+        return Status::Invalid("Dictionaries cannot change in the IPC file format");
+      }
+      if (updated_ids.count(id) > 0) {
+        return Status::Invalid("Fields sharing a dictionary must have the same ",
+                               "dictionary in each record batch");
+      }
+
+      const bool is_delta =
+          extends_current && internal::CanConcatenateDictionaries(*dictionary->type());
+      RETURN_NOT_OK(UpdatePosition());
+      FileBlock block = {position_, 0, 0};
+      // Frame of reference in file format is 0, see ARROW-384
+      const int64_t buffer_start_offset = 0;
+      RETURN_NOT_OK(WriteDictionary(
+          id, is_delta ? dictionary->Slice(current_length) : dictionary,
+          buffer_start_offset, sink_, &block.metadata_length, &block.body_length,
+          options_, pool_, is_delta));
+      RETURN_NOT_OK(UpdatePositionCheckAligned());
+
+      current = dictionary;
+      updated_ids.insert(id);
+    }
+    return Status::OK();
+  }
+
   virtual Status Close() {
     // Write the schema if not already written
     // User is responsible for closing the OutputStream
@@ -973,7 +1247,9 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
   }
 
   Status WriteRecordBatch(const RecordBatch& batch, bool allow_64bit, FileBlock* block) {
+    ARROW_TRACE_SPAN("ipc", "write_batch");
     RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(WriteDictionaryUpdates(batch));
     RETURN_NOT_OK(UpdatePosition());
 
     block->offset = position_;
@@ -982,7 +1258,7 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
     const int64_t buffer_start_offset = 0;
     RETURN_NOT_OK(arrow::ipc::WriteRecordBatch(
         batch, buffer_start_offset, sink_, &block->metadata_length, &block->body_length,
-        pool_, kMaxNestingDepth, allow_64bit));
+        options_, pool_, kMaxNestingDepth, allow_64bit));
     RETURN_NOT_OK(UpdatePositionCheckAligned());
 
     return Status::OK();
@@ -999,6 +1275,7 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
 
  protected:
   std::shared_ptr<Schema> schema_;
+  IpcWriteOptions options_;
   MemoryPool* pool_;
   bool started_;
 
@@ -1006,6 +1283,12 @@ class RecordBatchStreamWriter::RecordBatchStreamWriterImpl : public StreamBookKe
   // encounter, as they must be written out first in the stream
   DictionaryMemo dictionary_memo_;
 
+  // The ids of the dictionary types of the schema, depth-first, and the last
+  // dictionary written for each id
+  std::vector<int64_t> dictionary_ids_;
+  std::unordered_map<int64_t, std::shared_ptr<Array>> current_dictionaries_;
+  bool allow_dictionary_updates_ = true;
+
   std::vector<FileBlock> dictionaries_;
   std::vector<FileBlock> record_batches_;
 };
@@ -1026,9 +1309,16 @@ void RecordBatchStreamWriter::set_memory_pool(MemoryPool* pool) {
 Status RecordBatchStreamWriter::Open(io::OutputStream* sink,
                                      const std::shared_ptr<Schema>& schema,
                                      std::shared_ptr<RecordBatchWriter>* out) {
+  return Open(sink, schema, IpcWriteOptions::Defaults(), out);
+}
+
+Status RecordBatchStreamWriter::Open(io::OutputStream* sink,
+                                     const std::shared_ptr<Schema>& schema,
+                                     const IpcWriteOptions& options,
+                                     std::shared_ptr<RecordBatchWriter>* out) {
   // ctor is private
   auto result = std::shared_ptr<RecordBatchStreamWriter>(new RecordBatchStreamWriter());
-  result->impl_.reset(new RecordBatchStreamWriterImpl(sink, schema));
+  result->impl_.reset(new RecordBatchStreamWriterImpl(sink, schema, options));
   *out = result;
   return Status::OK();
 }
@@ -1043,8 +1333,12 @@ class RecordBatchFileWriter::RecordBatchFileWriterImpl
  public:
   using BASE = RecordBatchStreamWriter::RecordBatchStreamWriterImpl;
 
-  RecordBatchFileWriterImpl(io::OutputStream* sink, const std::shared_ptr<Schema>& schema)
-      : BASE(sink, schema) {}
+  RecordBatchFileWriterImpl(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+                            const IpcWriteOptions& options)
+      : BASE(sink, schema, options) {
+    // The file reader loads all the dictionaries before any record batch
+    allow_dictionary_updates_ = false;
+  }
 
   Status Start() override {
     // ARROW-3236: The initial position -1 needs to be updated to the stream's
@@ -1095,9 +1389,16 @@ RecordBatchFileWriter::~RecordBatchFileWriter() {}
 Status RecordBatchFileWriter::Open(io::OutputStream* sink,
                                    const std::shared_ptr<Schema>& schema,
                                    std::shared_ptr<RecordBatchWriter>* out) {
+  return Open(sink, schema, IpcWriteOptions::Defaults(), out);
+}
+
+Status RecordBatchFileWriter::Open(io::OutputStream* sink,
+                                   const std::shared_ptr<Schema>& schema,
+                                   const IpcWriteOptions& options,
+                                   std::shared_ptr<RecordBatchWriter>* out) {
   // ctor is private
   auto result = std::shared_ptr<RecordBatchFileWriter>(new RecordBatchFileWriter());
-  result->file_impl_.reset(new RecordBatchFileWriterImpl(sink, schema));
+  result->file_impl_.reset(new RecordBatchFileWriterImpl(sink, schema, options));
   *out = result;
   return Status::OK();
 }
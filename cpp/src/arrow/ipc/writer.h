@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "arrow/ipc/message.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -48,6 +49,24 @@ namespace ipc {
 
 class DictionaryMemo;
 
+/// \brief Options for writing record batches
+struct ARROW_EXPORT IpcWriteOptions {
+  /// The codec compressing each body buffer: Compression::UNCOMPRESSED,
+  /// LZ4 or ZSTD.  Readers decompress transparently.
+  Compression::type compression = Compression::UNCOMPRESSED;
+  /// The compression level of the codec, or the codec's default
+  int compression_level = util::kUseDefaultCompressionLevel;
+  /// Buffers smaller than this are not compressed.  Buffers which don't get
+  /// smaller when compressed are not compressed either.
+  int64_t min_compression_size = 256;
+  /// Whether to lay out the columns of a batch, and compress its buffers,
+  /// concurrently on the CPU thread pool.  The batch is still written with a
+  /// single ordered write.
+  bool use_threads = true;
+
+  static IpcWriteOptions Defaults();
+};
+
 /// \class RecordBatchWriter
 /// \brief Abstract interface for writing a stream of record batches
 class ARROW_EXPORT RecordBatchWriter {
@@ -102,6 +121,17 @@ class ARROW_EXPORT RecordBatchStreamWriter : public RecordBatchWriter {
   static Status Open(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
                      std::shared_ptr<RecordBatchWriter>* out);
 
+  /// \brief Create a new writer with the given options
+  ///
+  /// \param[in] sink output stream to write to
+  /// \param[in] schema the schema of the record batches to be written
+  /// \param[in] options how to write the record batches
+  /// \param[out] out the created stream writer
+  /// \return Status
+  static Status Open(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+                     const IpcWriteOptions& options,
+                     std::shared_ptr<RecordBatchWriter>* out);
+
   /// \brief Write a record batch to the stream
   ///
   /// \param[in] batch the record batch to write
@@ -139,6 +169,17 @@ class ARROW_EXPORT RecordBatchFileWriter : public RecordBatchStreamWriter {
   static Status Open(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
                      std::shared_ptr<RecordBatchWriter>* out);
 
+  /// \brief Create a new writer with the given options
+  ///
+  /// \param[in] sink output stream to write to
+  /// \param[in] schema the schema of the record batches to be written
+  /// \param[in] options how to write the record batches
+  /// \param[out] out the created file writer
+  /// \return Status
+  static Status Open(io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+                     const IpcWriteOptions& options,
+                     std::shared_ptr<RecordBatchWriter>* out);
+
   /// \brief Write a record batch to the file
   ///
   /// \param[in] batch the record batch to write
@@ -192,6 +233,17 @@ Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
                         int max_recursion_depth = kMaxNestingDepth,
                         bool allow_64bit = false);
 
+/// \brief Low-level API for writing a record batch with the given options
+///
+/// Like the above, but the body buffers may be compressed as requested by
+/// options.
+ARROW_EXPORT
+Status WriteRecordBatch(const RecordBatch& batch, int64_t buffer_start_offset,
+                        io::OutputStream* dst, int32_t* metadata_length,
+                        int64_t* body_length, const IpcWriteOptions& options,
+                        MemoryPool* pool, int max_recursion_depth = kMaxNestingDepth,
+                        bool allow_64bit = false);
+
 /// \brief Serialize record batch as encapsulated IPC message in a new buffer
 ///
 /// \param[in] batch the record batch
@@ -333,6 +385,28 @@ Status GetSchemaPayload(const Schema& schema, MemoryPool* pool,
 ARROW_EXPORT
 Status GetRecordBatchPayload(const RecordBatch& batch, MemoryPool* pool, IpcPayload* out);
 
+/// \brief Compute IpcPayload for the given record batch, with the body
+/// buffers compressed as requested by options
+/// \param[in] batch the RecordBatch that is being serialized
+/// \param[in] options the compression of the body buffers
+/// \param[in,out] pool for any required temporary memory allocations
+/// \param[out] out the returned IpcPayload
+/// \return Status
+ARROW_EXPORT
+Status GetRecordBatchPayload(const RecordBatch& batch, const IpcWriteOptions& options,
+                             MemoryPool* pool, IpcPayload* out);
+
+/// \brief Write an IpcPayload (metadata prefixed by its length, then the
+/// padded body buffers) to an output stream
+/// \param[in] payload the IpcPayload to write
+/// \param[in,out] dst the OutputStream to write to
+/// \param[out] metadata_length the length of the metadata written, including
+/// the length prefix and padding
+/// \return Status
+ARROW_EXPORT
+Status WriteIpcPayload(const IpcPayload& payload, io::OutputStream* dst,
+                       int32_t* metadata_length);
+
 }  // namespace internal
 
 }  // namespace ipc
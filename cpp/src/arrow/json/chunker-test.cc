@@ -203,5 +203,32 @@ TEST_P(BaseChunkerTest, StraddlingEmpty) {
   ASSERT_EQ(completion.size(), 0);
 }
 
+TEST(ChunkerTest, FindObjectStart) {
+  auto joined = join(lines(), "\n");
+  auto chunker = MakeChunker(false);
+  bool found;
+  string_view rest;
+  // Starting one byte into the first object, the second one is found
+  ASSERT_OK(
+      chunker->FindObjectStart(string_view(joined).substr(1), false, &found, &rest));
+  ASSERT_TRUE(found);
+  ASSERT_EQ(std::string(rest.data(), rest.size()), joined.substr(lines()[0].size() + 1));
+  // Starting right before the second object
+  ASSERT_OK(chunker->FindObjectStart(string_view(joined).substr(lines()[0].size()), false,
+                                     &found, &rest));
+  ASSERT_TRUE(found);
+  ASSERT_EQ(std::string(rest.data(), rest.size()), joined.substr(lines()[0].size() + 1));
+  // Within the last object
+  auto last = string_view(joined).substr(joined.size() - 5);
+  ASSERT_OK(chunker->FindObjectStart(last, false, &found, &rest));
+  ASSERT_FALSE(found);
+  ASSERT_OK(chunker->FindObjectStart(last, true, &found, &rest));
+  ASSERT_TRUE(found);
+  ASSERT_EQ(rest.size(), 0);
+
+  ASSERT_RAISES(NotImplemented,
+                MakeChunker(true)->FindObjectStart(joined, true, &found, &rest));
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -95,6 +95,20 @@ class NewlinesStrictlyDelimitChunker : public Chunker {
     *completion = block.substr(0, first_newline + 1);
     return Status::OK();
   }
+
+  Status FindObjectStart(string_view block, bool final, bool* found,
+                         string_view* rest) override {
+    auto first_newline = block.find_first_of("\n\r");
+    if (first_newline == string_view::npos) {
+      // no newlines in this block: no object starts in it
+      *found = final;
+      *rest = string_view();
+      return Status::OK();
+    }
+    *found = true;
+    *rest = block.substr(first_newline + 1);
+    return Status::OK();
+  }
 };
 
 /// RapidJson custom stream for reading JSON stored in multiple buffers
@@ -199,6 +213,12 @@ class ParsingChunker : public Chunker {
     *completion = block.substr(0, length - partial.size());
     return Status::OK();
   }
+
+  Status FindObjectStart(string_view block, bool final, bool* found,
+                         string_view* rest) override {
+    return Status::NotImplemented(
+        "Cannot find object boundaries in JSON data with newlines in values");
+  }
 };
 
 std::unique_ptr<Chunker> Chunker::Make(ParseOptions options) {
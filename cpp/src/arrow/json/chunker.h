@@ -51,6 +51,18 @@ class ARROW_EXPORT Chunker {
   virtual Status Process(util::string_view partial, util::string_view block,
                          util::string_view* completion) = 0;
 
+  /// \brief Find the first object starting at or after a given file offset
+  ///
+  /// This resolves object boundaries when a file is read as several
+  /// independent byte ranges, each owning the objects starting in it.
+  /// Only supported if newlines_in_values is false.
+  /// \param[in] block json data starting one byte before the offset
+  /// \param[in] final whether block extends to the end of the file
+  /// \param[out] found false if block is too short to tell and not final
+  /// \param[out] rest subrange of block starting with the object
+  virtual Status FindObjectStart(util::string_view block, bool final, bool* found,
+                                 util::string_view* rest) = 0;
+
   static std::unique_ptr<Chunker> Make(ParseOptions options);
 
  protected:
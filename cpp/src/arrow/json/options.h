@@ -34,6 +34,15 @@ namespace json {
 
 enum class UnexpectedFieldBehavior : char { Ignore, Error, InferType };
 
+/// \brief The tokenizer used by BlockParser
+///
+/// RapidJSON drives a rapidjson::Reader over the block.  Structural first
+/// indexes the structural characters of the block with SIMD instructions,
+/// then walks those indices (as simdjson does); it is faster on large blocks.
+///
+/// \since 0.13.0
+enum class ParserBackend : char { RapidJSON, Structural };
+
 struct ARROW_EXPORT ParseOptions {
   // Parsing options
 
@@ -47,6 +56,17 @@ struct ARROW_EXPORT ParseOptions {
   // How should parse handle fields outside the explicit_schema?
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  // How to tokenize the JSON data.  With Structural and Ignore, the values of
+  // fields outside the explicit_schema are skipped by matching brackets, without
+  // being validated, which makes projecting a few fields out of wide objects cheap.
+  ParserBackend backend = ParserBackend::RapidJSON;
+
+  // Whether inferred string fields are converted to dictionary(utf8) arrays,
+  // with one dictionary per block (StreamingReader unifies them across chunks).
+  // Fields of the explicit_schema are dictionary-encoded when their type is a
+  // dictionary of strings or binaries, whatever this option.
+  bool dictionary_encode_strings = false;
+
   static ParseOptions Defaults();
 };
 
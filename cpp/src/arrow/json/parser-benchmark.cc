@@ -19,6 +19,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "arrow/json/options.h"
 #include "arrow/json/parser.h"
@@ -46,12 +47,14 @@ static void BenchmarkJSONParsing(benchmark::State& state,  // NOLINT non-const r
   state.SetBytesProcessed(state.iterations() * json.size());
 }
 
-static void BM_ParseJSONBlockWithSchema(
-    benchmark::State& state) {  // NOLINT non-const reference
+static void BenchmarkJSONParsingWithSchema(
+    benchmark::State& state,  // NOLINT non-const reference
+    ParserBackend backend) {
   const int32_t num_rows = 5000;
   auto options = ParseOptions::Defaults();
   options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
   options.explicit_schema = schema({field("int", int32()), field("str", utf8())});
+  options.backend = backend;
   std::mt19937_64 engine;
   std::string json;
   for (int i = 0; i != num_rows; ++i) {
@@ -64,7 +67,79 @@ static void BM_ParseJSONBlockWithSchema(
   BenchmarkJSONParsing(state, json, num_rows, options);
 }
 
+static void BM_ParseJSONBlockWithSchema(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkJSONParsingWithSchema(state, ParserBackend::RapidJSON);
+}
+
+static void BM_ParseJSONBlockWithSchemaStructural(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkJSONParsingWithSchema(state, ParserBackend::Structural);
+}
+
+// Project a few fields out of wide objects
+static void BenchmarkJSONParsingProjection(
+    benchmark::State& state,  // NOLINT non-const reference
+    ParserBackend backend) {
+  const int32_t num_rows = 500;
+  const int num_fields = 200;
+  const int num_projected = 10;
+  std::vector<std::shared_ptr<Field>> fields, projected_fields;
+  for (int i = 0; i != num_fields; ++i) {
+    std::shared_ptr<DataType> type;
+    switch (i % 4) {
+      case 0:
+        type = int64();
+        break;
+      case 1:
+        type = utf8();
+        break;
+      case 2:
+        type = list(float64());
+        break;
+      default:
+        type = struct_({field("x", int32()), field("y", list(utf8()))});
+    }
+    fields.push_back(field("field" + std::to_string(i), type));
+    if (i % (num_fields / num_projected) == 0) {
+      projected_fields.push_back(fields.back());
+    }
+  }
+  std::mt19937_64 engine;
+  std::string json;
+  for (int i = 0; i != num_rows; ++i) {
+    StringBuffer sb;
+    Writer writer(sb);
+    ABORT_NOT_OK(Generate(schema(fields), engine, &writer));
+    json += sb.GetString();
+    json += "\n";
+  }
+
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  options.explicit_schema = schema(projected_fields);
+  options.backend = backend;
+  BenchmarkJSONParsing(state, json, num_rows, options);
+}
+
+static void BM_ParseJSONBlockProjection(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkJSONParsingProjection(state, ParserBackend::RapidJSON);
+}
+
+static void BM_ParseJSONBlockProjectionStructural(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkJSONParsingProjection(state, ParserBackend::Structural);
+}
+
 BENCHMARK(BM_ParseJSONBlockWithSchema)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ParseJSONBlockWithSchemaStructural)
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ParseJSONBlockProjection)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ParseJSONBlockProjectionStructural)
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
 
 }  // namespace json
 }  // namespace arrow
@@ -25,12 +25,14 @@
 #include <rapidjson/error/en.h>
 #include <rapidjson/reader.h>
 
+#include "arrow/io/memory.h"
 #include "arrow/ipc/json-simple.h"
 #include "arrow/json/options.h"
 #include "arrow/json/parser.h"
 #include "arrow/json/reader.h"
 #include "arrow/json/test-common.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
@@ -210,6 +212,110 @@ TEST(BlockParser, Nested) {
                       R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
 }
 
+TEST(StructuralBlockParser, Basics) {
+  auto options = ParseOptions::Defaults();
+  options.backend = ParserBackend::Structural;
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  AssertParseColumns(
+      options, scalars_only_src(),
+      {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
+      {"[\"3.5\", \"3.2\", \"3.4\", \"0.0\"]", "[false, null, null, true]",
+       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
+}
+
+TEST(StructuralBlockParser, Nested) {
+  auto options = ParseOptions::Defaults();
+  options.backend = ParserBackend::Structural;
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  AssertParseColumns(options, nested_src(),
+                     {field("yo", utf8()), field("arr", list(utf8())),
+                      field("nuf", struct_({field("ps", utf8())}))},
+                     {"[\"thing\", null, \"\xe5\xbf\x8d\", null]",
+                      R"([["1", "2", "3"], ["2"], [], null])",
+                      R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
+}
+
+TEST(StructuralBlockParser, SkipFieldsOutsideSchema) {
+  auto options = ParseOptions::Defaults();
+  options.backend = ParserBackend::Structural;
+  options.explicit_schema = schema({field("hello", float64()), field("yo", utf8())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParseColumns(options, nested_src(), {field("hello", utf8()), field("yo", utf8())},
+                     {"[\"3.5\", \"3.2\", \"3.4\", \"0.0\"]",
+                      "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
+}
+
+TEST(StructuralBlockParser, SkipNestedFieldsOutsideSchema) {
+  auto options = ParseOptions::Defaults();
+  options.backend = ParserBackend::Structural;
+  options.explicit_schema = schema({field("a", int32()), field("c", list(int32()))});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParseColumns(options, R"(
+    { "x": { "y": [1, { "z": "]}\"" }], "w": {} }, "a": 1, "c": [2] }
+    { "a": 3, "x": [[[]], "{"], "b": { "a": true }, "c": [] }
+    { "b": "}", "x": null }
+  )",
+                     {field("a", utf8()), field("c", list(utf8()))},
+                     {R"(["1", "3", null])", R"([["2"], [], null])"});
+}
+
+TEST(StructuralBlockParser, Escapes) {
+  auto options = ParseOptions::Defaults();
+  options.backend = ParserBackend::Structural;
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  AssertParseColumns(options, R"(
+    { "s": "a\"b\\", "t\u0061b": "{[\":,]}\"" }
+    { "s": "\\\\\" \\n", "tab": "\u00e9\ud83d\ude00" }
+  )",
+                     {field("s", utf8()), field("tab", utf8())},
+                     {R"(["a\"b\\", "\\\\\" \\n"])",
+                      "[\"{[\\\":,]}\\\"\", \"\xc3\xa9\xf0\x9f\x98\x80\"]"});
+}
+
+TEST(StructuralBlockParser, FailOnInvalidJson) {
+  auto options = ParseOptions::Defaults();
+  options.backend = ParserBackend::Structural;
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  for (auto json : {"{\"a\":0, \"b\"", "{\"a\":}", "{\"a\": [1,]}", "{\"a\": [1 2]}",
+                    "{\"a\": tru}", "{\"a\": 01}", "{\"a\": 1.}", "{\"a\": \"b}",
+                    "{\"a\": \"\\x\"}", "{\"a\": \"\n\"}", "{\"a\": 1,}", "}"}) {
+    std::shared_ptr<Buffer> src;
+    ASSERT_OK(MakeBuffer(json, &src));
+    BlockParser parser(options, src);
+    ASSERT_RAISES(Invalid, parser.Parse(src));
+  }
+}
+
+TEST(StructuralBlockParser, SameAsRapidJSON) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema =
+      schema({field("int", int32()), field("str", utf8()), field("arr", list(float64())),
+              field("nuf", struct_({field("ps", int64()), field("b", boolean())}))});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  std::mt19937_64 engine;
+  std::string json;
+  // Several indexing regions
+  for (int i = 0; i != 5000; ++i) {
+    StringBuffer sb;
+    Writer writer(sb);
+    ASSERT_OK(Generate(options.explicit_schema, engine, &writer));
+    json += sb.GetString();
+    json += "\n";
+  }
+
+  std::shared_ptr<Array> expected, actual;
+  for (auto backend : {ParserBackend::RapidJSON, ParserBackend::Structural}) {
+    options.backend = backend;
+    std::shared_ptr<Buffer> src;
+    ASSERT_OK(MakeBuffer(json, &src));
+    BlockParser parser(options, src);
+    ASSERT_OK(parser.Parse(src));
+    ASSERT_EQ(parser.num_rows(), 5000);
+    ASSERT_OK(parser.Finish(backend == ParserBackend::RapidJSON ? &expected : &actual));
+  }
+  AssertArraysEqual(*expected, *actual);
+}
+
 void AssertParseOne(ParseOptions options, string_view src_str,
                     const std::vector<std::shared_ptr<Field>>& fields,
                     const std::vector<std::string>& columns_json) {
@@ -245,5 +351,140 @@ TEST(ParseOne, Nested) {
        R"([{"ps":null}, null, {"ps":78}, {"ps":90}])"});
 }
 
+TEST(ParseOne, DictionaryEncodeStrings) {
+  auto options = ParseOptions::Defaults();
+  options.dictionary_encode_strings = true;
+  std::shared_ptr<Buffer> src;
+  ASSERT_OK(MakeBuffer(
+      "{\"s\": \"b\", \"n\": 1}\n{\"s\": null}\n{\"s\": \"a\"}\n{\"s\": \"b\"}\n",
+      &src));
+  std::shared_ptr<RecordBatch> parsed;
+  ASSERT_OK(ParseOne(options, src, &parsed));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, null, null, null]"),
+                    *parsed->GetColumnByName("n"));
+  auto column = parsed->GetColumnByName("s");
+  ASSERT_EQ(column->type_id(), Type::DICTIONARY);
+  const auto& dict_array = static_cast<const DictionaryArray&>(*column);
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["b", "a"])"), *dict_array.dictionary());
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[0, null, 1, 0]"), *dict_array.indices());
+}
+
+TEST(ParseOne, DictionaryInSchema) {
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  options.explicit_schema =
+      schema({field("s", dictionary(int32(), ArrayFromJSON(utf8(), "[]")))});
+  std::shared_ptr<Buffer> src;
+  ASSERT_OK(MakeBuffer("{\"s\": \"x\"}\n{\"s\": \"y\"}\n{\"s\": \"x\"}\n", &src));
+  std::shared_ptr<RecordBatch> parsed;
+  ASSERT_OK(ParseOne(options, src, &parsed));
+  ASSERT_EQ(parsed->column(0)->type_id(), Type::DICTIONARY);
+  ASSERT_TRUE(parsed->schema()->field(0)->type()->Equals(parsed->column(0)->type()));
+  const auto& dict_array = static_cast<const DictionaryArray&>(*parsed->column(0));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["x", "y"])"), *dict_array.dictionary());
+  AssertArraysEqual(*ArrayFromJSON(int8(), "[0, 1, 0]"), *dict_array.indices());
+}
+
+void AssertStreamingRead(ReadOptions read_options, string_view src_str,
+                         const std::vector<std::shared_ptr<Field>>& fields,
+                         const std::vector<std::string>& columns_json) {
+  auto input =
+      std::make_shared<io::BufferReader>(Buffer::FromString(src_str.to_string()));
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_OK(StreamingReader::Make(default_memory_pool(), input, read_options, options,
+                                  &reader));
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  std::shared_ptr<RecordBatch> batch;
+  do {
+    ASSERT_OK(reader->ReadNext(&batch));
+    if (batch) {
+      ASSERT_TRUE(batch->schema()->Equals(*reader->schema()));
+      batches.push_back(batch);
+    }
+  } while (batch);
+
+  ASSERT_EQ(reader->schema()->num_fields(), static_cast<int>(fields.size()));
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches(reader->schema(), batches, &table));
+  for (size_t i = 0; i != fields.size(); ++i) {
+    auto column_expected = ArrayFromJSON(fields[i]->type(), columns_json[i]);
+    auto column = table->GetColumnByName(fields[i]->name());
+    ASSERT_NE(column, nullptr);
+    ASSERT_TRUE(column->data()->Equals(ChunkedArray(ArrayVector{column_expected})));
+  }
+}
+
+TEST(StreamingReader, Basics) {
+  for (bool use_threads : {false, true}) {
+    auto read_options = ReadOptions::Defaults();
+    read_options.use_threads = use_threads;
+    // Small blocks, so that objects straddle block boundaries
+    read_options.block_size = 16;
+    AssertStreamingRead(
+        read_options, scalars_only_src(),
+        {field("hello", float64()), field("world", boolean()), field("yo", utf8())},
+        {"[3.5, 3.2, 3.4, 0.0]", "[false, null, null, true]",
+         "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
+  }
+}
+
+TEST(StreamingReader, SchemaFromFirstBlock) {
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = false;
+  read_options.block_size = 16;
+  // Field "b" appears after the first block and is ignored
+  AssertStreamingRead(read_options, "{\"a\": 1}\n{\"a\": 2}\n{\"a\": 3, \"b\": true}\n",
+                      {field("a", int64())}, {"[1, 2, 3]"});
+}
+
+TEST(StreamingReader, UnifyDictionaries) {
+  auto read_options = ReadOptions::Defaults();
+  read_options.use_threads = false;
+  // One object per block
+  read_options.block_size = 12;
+  auto options = ParseOptions::Defaults();
+  options.dictionary_encode_strings = true;
+  auto input = std::make_shared<io::BufferReader>(Buffer::FromString(
+      "{\"s\": \"a\"}\n{\"s\": \"b\"}\n{\"s\": \"a\"}\n{\"s\": \"c\"}\n"));
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_OK(StreamingReader::Make(default_memory_pool(), input, read_options, options,
+                                  &reader));
+  std::vector<std::string> values;
+  std::shared_ptr<Array> last_dictionary;
+  std::shared_ptr<RecordBatch> batch;
+  while (true) {
+    ASSERT_OK(reader->ReadNext(&batch));
+    if (!batch) {
+      break;
+    }
+    ASSERT_TRUE(batch->schema()->field(0)->type()->Equals(batch->column(0)->type()));
+    const auto& dict_array = static_cast<const DictionaryArray&>(*batch->column(0));
+    const auto& dictionary = static_cast<const StringArray&>(*dict_array.dictionary());
+    // Dictionaries only grow, keeping the indices of previous values
+    if (last_dictionary) {
+      auto prefix = dictionary.Slice(0, last_dictionary->length());
+      ASSERT_TRUE(last_dictionary->Equals(prefix));
+    }
+    last_dictionary = dict_array.dictionary();
+    auto indices = dict_array.indices();
+    for (int64_t i = 0; i != batch->num_rows(); ++i) {
+      auto index = static_cast<const Int8Array&>(*indices).Value(i);
+      values.push_back(dictionary.GetString(index));
+    }
+  }
+  ASSERT_EQ(values, std::vector<std::string>({"a", "b", "a", "c"}));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["a", "b", "c"])"), *last_dictionary);
+}
+
+TEST(StreamingReader, Empty) {
+  auto input = std::make_shared<io::BufferReader>(Buffer::FromString(""));
+  std::shared_ptr<StreamingReader> reader;
+  ASSERT_RAISES(Invalid, StreamingReader::Make(default_memory_pool(), input,
+                                               ReadOptions::Defaults(),
+                                               ParseOptions::Defaults(), &reader));
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <limits>
 #include <sstream>
 #include <tuple>
@@ -32,6 +33,7 @@
 #include "arrow/buffer-builder.h"
 #include "arrow/builder.h"
 #include "arrow/csv/converter.h"
+#include "arrow/json/structural-internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
@@ -411,6 +413,10 @@ class HandlerBase : public BlockParser::Impl,
   /// Accessor for a stored error Status
   Status Error() { return status_; }
 
+  /// Whether the value of the last key is ignored, so that the structural
+  /// tokenizer may skip it (see Handler<UnexpectedFieldBehavior::Ignore>)
+  bool Skipping() { return false; }
+
   /// \defgroup rapidjson-handler-interface functions expected by rapidjson::Reader
   ///
   /// bool Key(const char* data, rapidjson::SizeType size, ...) is omitted since
@@ -500,8 +506,10 @@ class HandlerBase : public BlockParser::Impl,
   int32_t num_rows() override { return num_rows_; }
 
  protected:
-  HandlerBase(MemoryPool* pool, const std::shared_ptr<Buffer>& scalar_storage)
-      : pool_(pool),
+  HandlerBase(MemoryPool* pool, const std::shared_ptr<Buffer>& scalar_storage,
+              ParserBackend backend)
+      : backend_(backend),
+        pool_(pool),
         builder_(Kind::kObject, 0, false),
         scalar_values_builder_(pool, scalar_storage) {
     arena<Kind::kObject>().emplace_back(pool_);
@@ -516,6 +524,9 @@ class HandlerBase : public BlockParser::Impl,
 
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
+    if (backend_ == ParserBackend::Structural) {
+      return DoParseStructural(handler, json);
+    }
     constexpr auto parse_flags =
         rapidjson::kParseInsituFlag | rapidjson::kParseIterativeFlag |
         rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseNumbersAsStringsFlag;
@@ -545,6 +556,17 @@ class HandlerBase : public BlockParser::Impl,
     return Status::Invalid("Exceeded maximum rows");
   }
 
+  template <typename Handler>
+  Status DoParseStructural(Handler& handler, const std::shared_ptr<Buffer>& json) {
+    auto json_data = reinterpret_cast<char*>(json->mutable_data());
+    // The data ends at the null terminator
+    auto terminator = std::memchr(json_data, '\0', json->size());
+    auto json_size = terminator == nullptr ? json->size()
+                                           : static_cast<char*>(terminator) - json_data;
+    StructuralParser parser(pool_, json_data, json_size);
+    return parser.Parse(handler, &num_rows_);
+  }
+
   /// construct a builder of staticallly defined kind in arenas_
   template <Kind::type kind>
   Status MakeBuilder(int64_t leading_nulls, BuilderPtr* builder) {
@@ -757,6 +779,7 @@ class HandlerBase : public BlockParser::Impl,
   }
 
   Status status_;
+  ParserBackend backend_;
   MemoryPool* pool_;
   std::tuple<std::tuple<>, std::vector<RawArrayBuilder<Kind::kBoolean>>,
              std::vector<RawArrayBuilder<Kind::kNumber>>,
@@ -785,8 +808,9 @@ class Handler;
 template <>
 class Handler<UnexpectedFieldBehavior::Error> : public HandlerBase {
  public:
-  Handler(MemoryPool* pool, const std::shared_ptr<Buffer>& scalar_storage)
-      : HandlerBase(pool, scalar_storage) {}
+  Handler(MemoryPool* pool, const std::shared_ptr<Buffer>& scalar_storage,
+          ParserBackend backend)
+      : HandlerBase(pool, scalar_storage, backend) {}
 
   Status Parse(const std::shared_ptr<Buffer>& json) override {
     return DoParse(*this, json);
@@ -807,8 +831,9 @@ class Handler<UnexpectedFieldBehavior::Error> : public HandlerBase {
 template <>
 class Handler<UnexpectedFieldBehavior::Ignore> : public HandlerBase {
  public:
-  Handler(MemoryPool* pool, const std::shared_ptr<Buffer>& scalar_storage)
-      : HandlerBase(pool, scalar_storage) {}
+  Handler(MemoryPool* pool, const std::shared_ptr<Buffer>& scalar_storage,
+          ParserBackend backend)
+      : HandlerBase(pool, scalar_storage, backend) {}
 
   Status Parse(const std::shared_ptr<Buffer>& json) override {
     return DoParse(*this, json);
@@ -888,9 +913,9 @@ class Handler<UnexpectedFieldBehavior::Ignore> : public HandlerBase {
     return HandlerBase::EndArray(size);
   }
 
- private:
   bool Skipping() { return depth_ >= skip_depth_; }
 
+ private:
   void MaybeStopSkipping() {
     if (skip_depth_ == depth_) {
       skip_depth_ = std::numeric_limits<int>::max();
@@ -904,8 +929,9 @@ class Handler<UnexpectedFieldBehavior::Ignore> : public HandlerBase {
 template <>
 class Handler<UnexpectedFieldBehavior::InferType> : public HandlerBase {
  public:
-  Handler(MemoryPool* pool, const std::shared_ptr<Buffer>& scalar_storage)
-      : HandlerBase(pool, scalar_storage) {}
+  Handler(MemoryPool* pool, const std::shared_ptr<Buffer>& scalar_storage,
+          ParserBackend backend)
+      : HandlerBase(pool, scalar_storage, backend) {}
 
   Status Parse(const std::shared_ptr<Buffer>& json) override {
     return DoParse(*this, json);
@@ -1002,7 +1028,7 @@ BlockParser::BlockParser(MemoryPool* pool, ParseOptions options,
   switch (options_.unexpected_field_behavior) {
     case UnexpectedFieldBehavior::Ignore: {
       auto handler = internal::make_unique<Handler<UnexpectedFieldBehavior::Ignore>>(
-          pool_, scalar_storage);
+          pool_, scalar_storage, options_.backend);
       // FIXME(bkietz) move this to an Initialize()
       ARROW_IGNORE_EXPR(handler->SetSchema(*options_.explicit_schema));
       impl_ = std::move(handler);
@@ -1010,14 +1036,14 @@ BlockParser::BlockParser(MemoryPool* pool, ParseOptions options,
     }
     case UnexpectedFieldBehavior::Error: {
       auto handler = internal::make_unique<Handler<UnexpectedFieldBehavior::Error>>(
-          pool_, scalar_storage);
+          pool_, scalar_storage, options_.backend);
       ARROW_IGNORE_EXPR(handler->SetSchema(*options_.explicit_schema));
       impl_ = std::move(handler);
       break;
     }
     case UnexpectedFieldBehavior::InferType:
       auto handler = internal::make_unique<Handler<UnexpectedFieldBehavior::InferType>>(
-          pool_, scalar_storage);
+          pool_, scalar_storage, options_.backend);
       if (options.explicit_schema) {
         ARROW_IGNORE_EXPR(handler->SetSchema(*options_.explicit_schema));
       }
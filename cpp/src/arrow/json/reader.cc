@@ -17,18 +17,33 @@
 
 #include "arrow/json/reader.h"
 
+#include <cstring>
+#include <deque>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "arrow/array.h"
+#include "arrow/buffer.h"
 #include "arrow/builder.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/readahead.h"
+#include "arrow/json/chunker.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/parsing.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 namespace json {
 
+using internal::GetCpuThreadPool;
 using internal::StringConverter;
+using internal::ThreadPool;
+using io::internal::ReadaheadBuffer;
+using io::internal::ReadaheadSpooler;
 
 Kind::type KindFromTag(const std::shared_ptr<const KeyValueMetadata>& tag) {
   std::string kind_name = tag->value(0);
@@ -56,6 +71,12 @@ Kind::type KindFromTag(const std::shared_ptr<const KeyValueMetadata>& tag) {
 static Status Convert(const std::shared_ptr<DataType>& out_type,
                       std::shared_ptr<Array> in, std::shared_ptr<Array>* out);
 
+// Convert to a dictionary-encoded array of strings or binaries, with a dictionary
+// of the distinct values of the block
+static Status DictionaryEncode(const std::shared_ptr<DataType>& value_type,
+                               const std::shared_ptr<Array>& in,
+                               std::shared_ptr<Array>* out);
+
 struct ConvertImpl {
   Status Visit(const NullType&) {
     *out = in;
@@ -145,12 +166,18 @@ struct ConvertImpl {
     }
     return builder.Finish(out);
   }
+  Status Visit(const DictionaryType& t) {
+    return DictionaryEncode(t.dictionary()->type(), in, out);
+  }
+  // the converted type of nested types is built from the converted children,
+  // since the dictionary of a dictionary-encoded child depends on the data
   Status Visit(const ListType& t) {
     auto list_array = static_cast<const ListArray*>(in.get());
     std::shared_ptr<Array> values;
     auto value_type = t.value_type();
     RETURN_NOT_OK(Convert(value_type, list_array->values(), &values));
-    auto data = ArrayData::Make(out_type, in->length(),
+    auto data = ArrayData::Make(list(t.value_field()->WithType(values->type())),
+                                in->length(),
                                 {in->null_bitmap(), list_array->value_offsets()},
                                 {values->data()}, in->null_count());
     *out = MakeArray(data);
@@ -158,14 +185,17 @@ struct ConvertImpl {
   }
   Status Visit(const StructType& t) {
     auto struct_array = static_cast<const StructArray*>(in.get());
+    std::vector<std::shared_ptr<Field>> fields(t.num_children());
     std::vector<std::shared_ptr<ArrayData>> child_data(t.num_children());
     for (int i = 0; i != t.num_children(); ++i) {
       std::shared_ptr<Array> child;
       RETURN_NOT_OK(Convert(t.child(i)->type(), struct_array->field(i), &child));
+      fields[i] = t.child(i)->WithType(child->type());
       child_data[i] = child->data();
     }
-    auto data = ArrayData::Make(out_type, in->length(), {in->null_bitmap()},
-                                std::move(child_data), in->null_count());
+    auto data = ArrayData::Make(struct_(std::move(fields)), in->length(),
+                                {in->null_bitmap()}, std::move(child_data),
+                                in->null_count());
     *out = MakeArray(data);
     return Status::OK();
   }
@@ -183,7 +213,41 @@ static Status Convert(const std::shared_ptr<DataType>& out_type,
   return VisitTypeInline(*out_type, &visitor);
 }
 
-static Status InferAndConvert(std::shared_ptr<DataType> expected,
+template <typename T>
+static Status DictionaryEncodeAs(const std::shared_ptr<DataType>& value_type,
+                                 const std::shared_ptr<Array>& in,
+                                 std::shared_ptr<Array>* out) {
+  auto dict_array = static_cast<const DictionaryArray*>(in.get());
+  const StringArray& dict = static_cast<const StringArray&>(*dict_array->dictionary());
+  const Int32Array& indices = static_cast<const Int32Array&>(*dict_array->indices());
+  // Repeated values are memoized, so they are only stored once per block
+  DictionaryBuilder<T> builder(value_type, default_memory_pool());
+  RETURN_NOT_OK(builder.Resize(indices.length()));
+  for (int64_t i = 0; i != indices.length(); ++i) {
+    if (indices.IsNull(i)) {
+      RETURN_NOT_OK(builder.AppendNull());
+      continue;
+    }
+    RETURN_NOT_OK(builder.Append(dict.GetView(indices.GetView(i))));
+  }
+  return builder.Finish(out);
+}
+
+static Status DictionaryEncode(const std::shared_ptr<DataType>& value_type,
+                               const std::shared_ptr<Array>& in,
+                               std::shared_ptr<Array>* out) {
+  switch (value_type->id()) {
+    case Type::STRING:
+      return DictionaryEncodeAs<StringType>(value_type, in, out);
+    case Type::BINARY:
+      return DictionaryEncodeAs<BinaryType>(value_type, in, out);
+    default:
+      return Status::NotImplemented("JSON parsing of dictionary of ", *value_type);
+  }
+}
+
+static Status InferAndConvert(const ParseOptions& options,
+                              std::shared_ptr<DataType> expected,
                               const std::shared_ptr<const KeyValueMetadata>& tag,
                               const std::shared_ptr<Array>& in,
                               std::shared_ptr<Array>* out) {
@@ -212,8 +276,8 @@ static Status InferAndConvert(std::shared_ptr<DataType> expected,
         auto in_field = in_type->child(i);
         auto in_column = static_cast<StructArray*>(in.get())->field(i);
         std::shared_ptr<Array> column;
-        RETURN_NOT_OK(InferAndConvert(expected_field_type, in_field->metadata(),
-                                      in_column, &column));
+        RETURN_NOT_OK(InferAndConvert(options, expected_field_type,
+                                      in_field->metadata(), in_column, &column));
         fields[i] = field(in_field->name(), column->type());
         child_data[i] = column->data();
       }
@@ -228,10 +292,11 @@ static Status InferAndConvert(std::shared_ptr<DataType> expected,
       auto value_tag = list_array->list_type()->value_field()->metadata();
       std::shared_ptr<Array> values;
       if (expected != nullptr) {
-        RETURN_NOT_OK(InferAndConvert(expected->child(0)->type(), value_tag,
+        RETURN_NOT_OK(InferAndConvert(options, expected->child(0)->type(), value_tag,
                                       list_array->values(), &values));
       } else {
-        RETURN_NOT_OK(InferAndConvert(nullptr, value_tag, list_array->values(), &values));
+        RETURN_NOT_OK(
+            InferAndConvert(options, nullptr, value_tag, list_array->values(), &values));
       }
       auto data = ArrayData::Make(list(values->type()), in->length(),
                                   {in->null_bitmap(), list_array->value_offsets()},
@@ -261,15 +326,20 @@ static Status InferAndConvert(std::shared_ptr<DataType> expected,
       if (Convert(timestamp(TimeUnit::SECOND), in, out).ok()) {
         return Status::OK();
       }
+      if (options.dictionary_encode_strings) {
+        return DictionaryEncode(utf8(), in, out);
+      }
       return Convert(utf8(), in, out);
     default:
       return Status::Invalid("invalid JSON kind");
   }
 }
 
-Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
-                std::shared_ptr<RecordBatch>* out) {
-  BlockParser parser(default_memory_pool(), options, json);
+// Parse and convert a null-terminated block of whole objects
+static Status ParseBlock(MemoryPool* pool, const ParseOptions& options,
+                         const std::shared_ptr<Buffer>& json,
+                         std::shared_ptr<RecordBatch>* out) {
+  BlockParser parser(pool, options, json);
   RETURN_NOT_OK(parser.Parse(json));
   std::shared_ptr<Array> parsed;
   RETURN_NOT_OK(parser.Finish(&parsed));
@@ -277,14 +347,17 @@ Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
   auto schm = options.explicit_schema;
   if (options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType) {
     if (schm) {
-      RETURN_NOT_OK(InferAndConvert(struct_(schm->fields()), Tag(Kind::kObject), parsed,
-                                    &converted));
+      RETURN_NOT_OK(InferAndConvert(options, struct_(schm->fields()),
+                                    Tag(Kind::kObject), parsed, &converted));
     } else {
-      RETURN_NOT_OK(InferAndConvert(nullptr, Tag(Kind::kObject), parsed, &converted));
+      RETURN_NOT_OK(
+          InferAndConvert(options, nullptr, Tag(Kind::kObject), parsed, &converted));
     }
     schm = schema(converted->type()->children());
   } else {
     RETURN_NOT_OK(Convert(struct_(schm->fields()), parsed, &converted));
+    // Dictionary-encoded fields have the dictionary of this block
+    schm = schema(converted->type()->children(), schm->metadata());
   }
   std::vector<std::shared_ptr<Array>> columns(parsed->num_fields());
   for (int i = 0; i != parsed->num_fields(); ++i) {
@@ -294,5 +367,249 @@ Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
   return Status::OK();
 }
 
+Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
+                std::shared_ptr<RecordBatch>* out) {
+  return ParseBlock(default_memory_pool(), options, json, out);
+}
+
+/////////////////////////////////////////////////////////////////////////
+// StreamingReader implementation
+
+class StreamingReaderImpl : public StreamingReader {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                      ThreadPool* thread_pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options)
+      : pool_(pool),
+        thread_pool_(thread_pool),
+        read_options_(read_options),
+        parse_options_(parse_options),
+        chunker_(Chunker::Make(parse_options)) {
+    // Chunks are parsed and converted by windows of one chunk per worker
+    // thread, which also bounds the readahead
+    window_size_ = thread_pool_ ? thread_pool_->GetCapacity() : 1;
+    // The right padding null-terminates the blocks for the chunker
+    readahead_ = std::make_shared<ReadaheadSpooler>(pool_, std::move(input),
+                                                    read_options_.block_size,
+                                                    window_size_, 0, 1);
+  }
+
+  ~StreamingReaderImpl() {
+    if (task_group_) {
+      // In case of error, make sure all pending tasks are finished before
+      // we start destroying members
+      ARROW_UNUSED(task_group_->Finish());
+    }
+  }
+
+  // Read and convert the first chunk having objects, fixing the schema
+  Status Init() {
+    std::shared_ptr<Buffer> chunk;
+    RETURN_NOT_OK(NextChunk(&chunk));
+    if (!chunk) {
+      return Status::Invalid("Empty JSON input");
+    }
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      RETURN_NOT_OK(ParseBlock(pool_, parse_options_, chunk, &batch));
+      if (batch->num_rows() > 0) {
+        break;
+      }
+      // Blank chunk, nothing to infer from
+      RETURN_NOT_OK(NextChunk(&chunk));
+      if (!chunk) {
+        break;
+      }
+    }
+    schema_ = batch->schema();
+    for (const auto& f : schema_->fields()) {
+      dictionary_types_.push_back(f->type()->id() == Type::DICTIONARY ? f->type()
+                                                                       : nullptr);
+    }
+    if (batch->num_rows() > 0) {
+      pending_batches_.push_back(std::move(batch));
+    }
+
+    // Later chunks cannot add fields to the schema
+    parse_options_.explicit_schema = schema_;
+    if (parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType) {
+      parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    while (pending_batches_.empty() && !finished_) {
+      RETURN_NOT_OK(ReadWindow());
+    }
+    if (pending_batches_.empty()) {
+      batch->reset();
+      return Status::OK();
+    }
+    *batch = std::move(pending_batches_.front());
+    pending_batches_.pop_front();
+    return Status::OK();
+  }
+
+ protected:
+  // Parse and convert up to window_size_ chunks, one record batch each
+  Status ReadWindow() {
+    task_group_ = thread_pool_ ? internal::TaskGroup::MakeThreaded(thread_pool_)
+                               : internal::TaskGroup::MakeSerial();
+    std::vector<std::shared_ptr<RecordBatch>> batches(window_size_);
+    int32_t num_chunks = 0;
+    while (num_chunks < window_size_ && task_group_->ok()) {
+      std::shared_ptr<Buffer> chunk;
+      RETURN_NOT_OK(NextChunk(&chunk));
+      if (!chunk) {
+        finished_ = true;
+        break;
+      }
+      // We're careful that all references in the closure outlive the window
+      std::shared_ptr<RecordBatch>* out = &batches[num_chunks++];
+      task_group_->Append([this, chunk, out]() {
+        return ParseBlock(pool_, parse_options_, chunk, out);
+      });
+    }
+    RETURN_NOT_OK(task_group_->Finish());
+
+    for (int32_t i = 0; i < num_chunks; ++i) {
+      if (batches[i]->num_rows() > 0) {
+        RETURN_NOT_OK(UnifyDictionaries(&batches[i]));
+        pending_batches_.push_back(std::move(batches[i]));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Extend the dictionaries of the previous batches with the values of this
+  // batch, so that a value has the same index in all batches
+  Status UnifyDictionaries(std::shared_ptr<RecordBatch>* batch) {
+    const RecordBatch& in = **batch;
+    std::vector<std::shared_ptr<Field>> fields = in.schema()->fields();
+    std::vector<std::shared_ptr<Array>> columns(in.num_columns());
+    bool unified = false;
+    for (int i = 0; i < in.num_columns(); ++i) {
+      columns[i] = in.column(i);
+      if (dictionary_types_[i] == nullptr) {
+        continue;
+      }
+      std::shared_ptr<DataType> type;
+      std::vector<std::vector<int32_t>> transpose_maps;
+      RETURN_NOT_OK(DictionaryType::Unify(
+          pool_, {dictionary_types_[i].get(), columns[i]->type().get()}, &type,
+          &transpose_maps));
+      const auto& column = static_cast<const DictionaryArray&>(*columns[i]);
+      RETURN_NOT_OK(column.Transpose(pool_, type, transpose_maps[1], &columns[i]));
+      fields[i] = fields[i]->WithType(type);
+      dictionary_types_[i] = std::move(type);
+      unified = true;
+    }
+    if (unified) {
+      auto unified_schema = ::arrow::schema(std::move(fields), in.schema()->metadata());
+      *batch = RecordBatch::Make(std::move(unified_schema), in.num_rows(),
+                                 std::move(columns));
+    }
+    return Status::OK();
+  }
+
+  // Get the next chunk of whole objects as a null-terminated buffer
+  // (parsing is destructive), or null at the end of the input
+  Status NextChunk(std::shared_ptr<Buffer>* out) {
+    while (true) {
+      if (!cur_data_.empty()) {
+        util::string_view chunked;
+        if (eof_) {
+          // The last object may lack a final newline
+          chunked = cur_data_;
+        } else {
+          RETURN_NOT_OK(chunker_->Process(cur_data_, &chunked));
+        }
+        if (!chunked.empty()) {
+          std::shared_ptr<Buffer> chunk;
+          RETURN_NOT_OK(AllocateBuffer(pool_, chunked.size() + 1, &chunk));
+          std::memcpy(chunk->mutable_data(), chunked.data(), chunked.size());
+          chunk->mutable_data()[chunked.size()] = '\0';
+          cur_data_ = cur_data_.substr(chunked.size());
+          *out = std::move(chunk);
+          return Status::OK();
+        }
+      } else if (eof_) {
+        out->reset();
+        return Status::OK();
+      }
+      // Need to fetch more data to get at least one object
+      RETURN_NOT_OK(ReadNextBlock());
+    }
+  }
+
+  // Read a next data block, stitch it to trailing data
+  Status ReadNextBlock() {
+    ReadaheadBuffer rh;
+    RETURN_NOT_OK(readahead_->Read(&rh));
+    if (!rh.buffer) {
+      eof_ = true;
+      return Status::OK();
+    }
+    const char* new_data =
+        reinterpret_cast<const char*>(rh.buffer->data()) + rh.left_padding;
+    const int64_t new_size = rh.buffer->size() - rh.left_padding - rh.right_padding;
+
+    if (cur_data_.empty()) {
+      cur_block_ = rh.buffer;
+      cur_data_ = util::string_view(new_data, new_size);
+      return Status::OK();
+    }
+    // Concatenate trailing + present data, null-terminated
+    const int64_t size = static_cast<int64_t>(cur_data_.size()) + new_size;
+    std::shared_ptr<Buffer> block;
+    RETURN_NOT_OK(AllocateBuffer(pool_, size + 1, &block));
+    std::memcpy(block->mutable_data(), cur_data_.data(), cur_data_.size());
+    std::memcpy(block->mutable_data() + cur_data_.size(), new_data, new_size);
+    block->mutable_data()[size] = '\0';
+    cur_block_ = block;
+    cur_data_ = util::string_view(reinterpret_cast<const char*>(block->data()), size);
+    return Status::OK();
+  }
+
+  MemoryPool* pool_;
+  ThreadPool* thread_pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  std::unique_ptr<Chunker> chunker_;
+  int32_t window_size_;
+  std::shared_ptr<ReadaheadSpooler> readahead_;
+  std::shared_ptr<internal::TaskGroup> task_group_;
+  std::shared_ptr<Schema> schema_;
+  // The dictionary types of the batches so far, for each dictionary-encoded
+  // column (null for other columns)
+  std::vector<std::shared_ptr<DataType>> dictionary_types_;
+
+  // Current block and unconsumed data in it
+  std::shared_ptr<Buffer> cur_block_;
+  util::string_view cur_data_;
+  // Whether we reached input stream EOF.  There may still be data left to
+  // process in current block.
+  bool eof_ = false;
+  // Converted batches of the current window, not yet returned
+  std::deque<std::shared_ptr<RecordBatch>> pending_batches_;
+  // Whether all the data was handed to the parse tasks
+  bool finished_ = false;
+};
+
+Status StreamingReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                             const ReadOptions& read_options,
+                             const ParseOptions& parse_options,
+                             std::shared_ptr<StreamingReader>* out) {
+  ThreadPool* thread_pool = read_options.use_threads ? GetCpuThreadPool() : nullptr;
+  auto result = std::make_shared<StreamingReaderImpl>(pool, std::move(input), thread_pool,
+                                                      read_options, parse_options);
+  RETURN_NOT_OK(result->Init());
+  *out = result;
+  return Status::OK();
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -25,6 +25,7 @@
 
 #include "arrow/json/options.h"  // IWYU pragma: keep
 #include "arrow/json/parser.h"   // IWYU pragma: keep
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
@@ -51,6 +52,34 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// \brief A reader yielding JSON data as a stream of record batches
+///
+/// The data is cut into chunks of whole objects of about block_size bytes,
+/// which are parsed and converted by windows of one chunk per CPU thread (a
+/// single chunk without use_threads), each chunk yielding one record batch,
+/// so that memory use is bounded by a few blocks rather than by the size of
+/// the input.  Unless an explicit_schema is given with another
+/// unexpected_field_behavior, the schema is inferred from the first chunk,
+/// read by Make(); later chunks are converted to that schema, ignoring any
+/// new field, and values that do not convert to its types are an error.
+/// The dictionary of a dictionary-encoded column extends that of the previous
+/// batches, so that a value has the same index in every batch (only the
+/// dictionary of the first batch is in schema()); dictionary-encoded fields
+/// nested in lists or structs get a dictionary per batch.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  virtual ~StreamingReader() = default;
+
+  /// \brief Create a streaming reader of the JSON data from the current
+  /// position of input
+  static Status Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                     const ReadOptions&, const ParseOptions&,
+                     std::shared_ptr<StreamingReader>* out);
+};
+
 ARROW_EXPORT Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                              std::shared_ptr<RecordBatch>* out);
 
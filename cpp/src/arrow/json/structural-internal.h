@@ -0,0 +1,700 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Two-stage JSON tokenizing (ParserBackend::Structural): a vectorized pass
+// indexing the structural characters of a whole block, then a walk over
+// those indices emitting the same events as rapidjson::Reader
+
+#ifndef ARROW_JSON_STRUCTURAL_INTERNAL_H
+#define ARROW_JSON_STRUCTURAL_INTERNAL_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/json/parser.h"
+#include "arrow/status.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/logging.h"  // IWYU pragma: keep
+#include "arrow/util/macros.h"
+#include "arrow/util/sse-util.h"
+#include "arrow/util/string_view.h"
+
+#if defined(ARROW_USE_SIMD) && defined(__aarch64__)
+#define ARROW_JSON_HAVE_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace arrow {
+namespace json {
+
+/// \brief A tokenizer for a block of JSON values, driving a handler with the
+/// interface of a rapidjson::Reader handler
+///
+/// The block is indexed first, 64 bytes at a time (with SSE4.2 or NEON where
+/// available): the position of every structural character is recorded, that
+/// is the braces, brackets, colons and commas outside strings, the quotes
+/// delimiting strings and the first character of every other value.  Escaped
+/// characters are found from the runs of backslashes and string contents are
+/// masked out with a prefix-XOR of the unescaped quotes, so that no byte is
+/// examined one at a time except inside backslash runs.  The indices are then
+/// walked, validating the grammar and emitting each top-level value as one
+/// row.  Both stages alternate by regions of the block, which keeps the
+/// indices in cache.
+///
+/// Like rapidjson's insitu parsing, strings are unescaped in place and numbers
+/// are passed on unconverted.  In addition, when Handler::Skipping() is true
+/// after a key, the value of that key is skipped by matching brackets, without
+/// emitting or validating its contents.
+class StructuralParser {
+ public:
+  StructuralParser(MemoryPool* pool, char* data, int64_t size)
+      : pool_(pool), data_(data), size_(size) {
+    DCHECK_LE(size, static_cast<int64_t>(UINT32_MAX));
+  }
+
+  /// \brief Emit the values of the block to handler, counting them in num_rows
+  ///
+  /// Handler methods return false on error, which Handler::Error() returns.
+  template <typename Handler>
+  Status Parse(Handler& handler, int32_t* num_rows) {
+    // Room for the positions of a region, plus those written past the end
+    // by Flatten()
+    const int64_t capacity = std::min(size_, static_cast<int64_t>(kRegionSize)) + 64;
+    RETURN_NOT_OK(AllocateBuffer(pool_, capacity * sizeof(uint32_t), &indices_buffer_));
+    indices_ = reinterpret_cast<uint32_t*>(indices_buffer_->mutable_data());
+    while (HasNext()) {
+      if (*num_rows == kMaxParserNumRows) {
+        return Status::Invalid("Exceeded maximum rows");
+      }
+      RETURN_NOT_OK(ParseRow(handler));
+      if (ARROW_PREDICT_FALSE(control_in_string_ != 0)) {
+        return Error("Invalid encoding in string.");
+      }
+      ++*num_rows;
+    }
+    if (ARROW_PREDICT_FALSE(control_in_string_ != 0)) {
+      return Error("Invalid encoding in string.");
+    }
+    return Status::OK();
+  }
+
+ protected:
+  // The number of bytes indexed at a time, so that the indices stay in cache
+  static constexpr int64_t kRegionSize = 1 << 14;
+
+  // One bit per byte of a 64-byte window
+  struct CharMasks {
+    uint64_t quote, backslash, op, whitespace, control;
+  };
+
+  // An array or object being parsed, with the number of values seen
+  struct Scope {
+    bool is_object;
+    uint32_t count;
+  };
+
+  template <typename... T>
+  static Status Error(T&&... t) {
+    return Status::Invalid("JSON parse error: ", std::forward<T>(t)...);
+  }
+
+  template <typename Handler>
+  Status ParseRow(Handler& handler) {
+    enum { kValue, kKey, kAfterValue } state = kValue;
+    scopes_.clear();
+    while (true) {
+      switch (state) {
+        case kValue: {
+          if (ARROW_PREDICT_FALSE(!HasNext())) {
+            return Error("Invalid value.");
+          }
+          char* token = data_ + indices_[cursor_++];
+          state = kAfterValue;
+          switch (*token) {
+            case '{':
+              if (!handler.StartObject()) {
+                return handler.Error();
+              }
+              if (NextIs('}')) {
+                ++cursor_;
+                if (!handler.EndObject(0)) {
+                  return handler.Error();
+                }
+              } else {
+                scopes_.push_back({true, 0});
+                state = kKey;
+              }
+              break;
+            case '[':
+              if (!handler.StartArray()) {
+                return handler.Error();
+              }
+              if (NextIs(']')) {
+                ++cursor_;
+                if (!handler.EndArray(0)) {
+                  return handler.Error();
+                }
+              } else {
+                scopes_.push_back({false, 0});
+                state = kValue;
+              }
+              break;
+            case '"': {
+              util::string_view str;
+              RETURN_NOT_OK(ParseString(token, &str));
+              if (!handler.String(str.data(), static_cast<uint32_t>(str.size()))) {
+                return handler.Error();
+              }
+              break;
+            }
+            case '}':
+            case ']':
+            case ',':
+            case ':':
+              return Error("Invalid value.");
+            default:
+              RETURN_NOT_OK(ParseAtom(handler, token));
+          }
+          break;
+        }
+        case kKey: {
+          if (ARROW_PREDICT_FALSE(!NextIs('"'))) {
+            return Error("Missing a name for object member.");
+          }
+          util::string_view key;
+          RETURN_NOT_OK(ParseString(data_ + indices_[cursor_++], &key));
+          if (!handler.Key(key.data(), static_cast<uint32_t>(key.size()))) {
+            return handler.Error();
+          }
+          if (ARROW_PREDICT_FALSE(!NextIs(':'))) {
+            return Error("Missing a colon after a name of object member.");
+          }
+          ++cursor_;
+          if (handler.Skipping()) {
+            // The handler drops this field, don't tokenize its value
+            RETURN_NOT_OK(SkipValue());
+            state = kAfterValue;
+          } else {
+            state = kValue;
+          }
+          break;
+        }
+        case kAfterValue: {
+          if (scopes_.empty()) {
+            return Status::OK();
+          }
+          Scope& scope = scopes_.back();
+          ++scope.count;
+          if (NextIs(',')) {
+            ++cursor_;
+            state = scope.is_object ? kKey : kValue;
+          } else if (scope.is_object && NextIs('}')) {
+            ++cursor_;
+            const uint32_t count = scope.count;
+            scopes_.pop_back();
+            if (!handler.EndObject(count)) {
+              return handler.Error();
+            }
+          } else if (!scope.is_object && NextIs(']')) {
+            ++cursor_;
+            const uint32_t count = scope.count;
+            scopes_.pop_back();
+            if (!handler.EndArray(count)) {
+              return handler.Error();
+            }
+          } else {
+            return scope.is_object
+                       ? Error("Missing a comma or '}' after an object member.")
+                       : Error("Missing a comma or ']' after an array element.");
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  // Skip the next value by matching brackets, without validating it
+  Status SkipValue() {
+    if (ARROW_PREDICT_FALSE(!HasNext() || NextIs(',') || NextIs(':'))) {
+      return Error("Invalid value.");
+    }
+    int64_t depth = 0;
+    do {
+      // Strings and other values span at most two indices, neither a bracket
+      switch (data_[indices_[cursor_++]]) {
+        case '{':
+        case '[':
+          ++depth;
+          break;
+        case '}':
+        case ']':
+          --depth;
+          break;
+        case '"':
+          if (ARROW_PREDICT_FALSE(!NextIs('"'))) {
+            return Error("Missing a closing quotation mark in string.");
+          }
+          ++cursor_;
+          break;
+        default:
+          break;
+      }
+      if (depth > 0 && ARROW_PREDICT_FALSE(!HasNext())) {
+        return Error("Missing a closing bracket.");
+      }
+    } while (depth > 0);
+    if (ARROW_PREDICT_FALSE(depth < 0)) {
+      return Error("Invalid value.");
+    }
+    return Status::OK();
+  }
+
+  // Parse the string opened by the quote at token, unescaping it in place
+  Status ParseString(char* token, util::string_view* out) {
+    // Indexing masks string contents, so any next index is the closing quote
+    if (ARROW_PREDICT_FALSE(!NextIs('"'))) {
+      return Error("Missing a closing quotation mark in string.");
+    }
+    char* begin = token + 1;
+    size_t size = data_ + indices_[cursor_++] - begin;
+    // Indexing is past the string, so there is no escape in it if the last
+    // backslash seen comes before it
+    if (last_backslash_ >= begin - data_ &&
+        std::memchr(begin, '\\', size) != nullptr) {
+      RETURN_NOT_OK(Unescape(begin, &size));
+    }
+    *out = util::string_view(begin, size);
+    return Status::OK();
+  }
+
+  static Status Unescape(char* data, size_t* size) {
+    const char* in = data;
+    const char* in_end = data + *size;
+    char* out = data;
+    while (in != in_end) {
+      if (*in != '\\') {
+        *out++ = *in++;
+        continue;
+      }
+      // A backslash never ends the contents, since the closing quote is unescaped
+      ++in;
+      switch (*in++) {
+        case '"':
+          *out++ = '"';
+          break;
+        case '\\':
+          *out++ = '\\';
+          break;
+        case '/':
+          *out++ = '/';
+          break;
+        case 'b':
+          *out++ = '\b';
+          break;
+        case 'f':
+          *out++ = '\f';
+          break;
+        case 'n':
+          *out++ = '\n';
+          break;
+        case 'r':
+          *out++ = '\r';
+          break;
+        case 't':
+          *out++ = '\t';
+          break;
+        case 'u': {
+          uint32_t codepoint;
+          if (ARROW_PREDICT_FALSE(!ParseHex4(in, in_end, &codepoint))) {
+            return Error("Incorrect hex digit after \\u escape in string.");
+          }
+          in += 4;
+          if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+            // Leading surrogate, must be followed by a trailing one
+            uint32_t trailing;
+            if (ARROW_PREDICT_FALSE(in_end - in < 6 || in[0] != '\\' || in[1] != 'u' ||
+                                    !ParseHex4(in + 2, in_end, &trailing) ||
+                                    trailing < 0xDC00 || trailing > 0xDFFF)) {
+              return Error("The surrogate pair in string is invalid.");
+            }
+            in += 6;
+            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (trailing - 0xDC00);
+          }
+          out = EncodeUTF8(codepoint, out);
+          break;
+        }
+        default:
+          return Error("Invalid escape character in string.");
+      }
+    }
+    *size = out - data;
+    return Status::OK();
+  }
+
+  // Parse a number, true, false or null starting at token
+  template <typename Handler>
+  Status ParseAtom(Handler& handler, const char* token) {
+    // The value ends at the next structural character or whitespace
+    const char* end = HasNext() ? data_ + indices_[cursor_] : data_ + size_;
+    const char* atom_end = token;
+    while (atom_end != end && !IsWhitespace(*atom_end)) {
+      ++atom_end;
+    }
+    const auto size = static_cast<uint32_t>(atom_end - token);
+    bool ok;
+    switch (*token) {
+      case 't':
+        if (ARROW_PREDICT_FALSE(size != 4 || std::memcmp(token, "true", 4) != 0)) {
+          return Error("Invalid value.");
+        }
+        ok = handler.Bool(true);
+        break;
+      case 'f':
+        if (ARROW_PREDICT_FALSE(size != 5 || std::memcmp(token, "false", 5) != 0)) {
+          return Error("Invalid value.");
+        }
+        ok = handler.Bool(false);
+        break;
+      case 'n':
+        if (ARROW_PREDICT_FALSE(size != 4 || std::memcmp(token, "null", 4) != 0)) {
+          return Error("Invalid value.");
+        }
+        ok = handler.Null();
+        break;
+      default:
+        if (ARROW_PREDICT_FALSE(!IsNumber(token, atom_end))) {
+          return Error("Invalid value.");
+        }
+        ok = handler.RawNumber(token, size);
+    }
+    return ok ? Status::OK() : handler.Error();
+  }
+
+  // Whether [p, end) is a number in the JSON grammar
+  static bool IsNumber(const char* p, const char* end) {
+    if (p != end && *p == '-') {
+      ++p;
+    }
+    if (p == end) {
+      return false;
+    }
+    if (*p == '0') {
+      ++p;
+    } else if (IsDigit(*p)) {
+      while (++p != end && IsDigit(*p)) {
+      }
+    } else {
+      return false;
+    }
+    if (p != end && *p == '.') {
+      if (++p == end || !IsDigit(*p)) {
+        return false;
+      }
+      while (++p != end && IsDigit(*p)) {
+      }
+    }
+    if (p != end && (*p == 'e' || *p == 'E')) {
+      if (++p != end && (*p == '+' || *p == '-')) {
+        ++p;
+      }
+      if (p == end || !IsDigit(*p)) {
+        return false;
+      }
+      while (++p != end && IsDigit(*p)) {
+      }
+    }
+    return p == end;
+  }
+
+  static bool ParseHex4(const char* in, const char* end, uint32_t* out) {
+    if (end - in < 4) {
+      return false;
+    }
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+      const char c = in[i];
+      value <<= 4;
+      if (c >= '0' && c <= '9') {
+        value |= c - '0';
+      } else if (c >= 'a' && c <= 'f') {
+        value |= c - 'a' + 10;
+      } else if (c >= 'A' && c <= 'F') {
+        value |= c - 'A' + 10;
+      } else {
+        return false;
+      }
+    }
+    *out = value;
+    return true;
+  }
+
+  static char* EncodeUTF8(uint32_t codepoint, char* out) {
+    if (codepoint < 0x80) {
+      *out++ = static_cast<char>(codepoint);
+    } else if (codepoint < 0x800) {
+      *out++ = static_cast<char>(0xC0 | (codepoint >> 6));
+      *out++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else if (codepoint < 0x10000) {
+      *out++ = static_cast<char>(0xE0 | (codepoint >> 12));
+      *out++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+      *out++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else {
+      *out++ = static_cast<char>(0xF0 | (codepoint >> 18));
+      *out++ = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+      *out++ = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+      *out++ = static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+    return out;
+  }
+
+  // Whether there is a next structural character, indexing more data if needed
+  bool HasNext() {
+    while (cursor_ == num_indices_) {
+      if (offset_ >= size_) {
+        return false;
+      }
+      IndexRegion();
+    }
+    return true;
+  }
+
+  bool NextIs(char c) { return HasNext() && data_[indices_[cursor_]] == c; }
+
+  // Replace the indices with those of the next region of data
+  void IndexRegion() {
+    cursor_ = num_indices_ = 0;
+    const int64_t end = std::min(size_, offset_ + static_cast<int64_t>(kRegionSize));
+    for (; offset_ < end; offset_ += 64) {
+      CharMasks masks;
+      if (size_ - offset_ >= 64) {
+        ComputeMasks(data_ + offset_, &masks);
+      } else {
+        // Pad the last window with whitespace
+        char window[64];
+        std::memset(window, ' ', sizeof(window));
+        std::memcpy(window, data_ + offset_, size_ - offset_);
+        ComputeMasks(window, &masks);
+      }
+
+      // A character is escaped if it follows an odd-length run of backslashes
+      uint64_t escaped = prev_escaped_;
+      prev_escaped_ = 0;
+      if (masks.backslash != 0) {
+        last_backslash_ = offset_ + 63 - BitUtil::CountLeadingZeros(masks.backslash);
+      }
+      for (uint64_t backslash = masks.backslash & ~escaped; backslash != 0;
+           backslash &= backslash - 1) {
+        const int i = BitUtil::CountTrailingZeros(backslash);
+        if (escaped & (uint64_t(1) << i)) {
+          continue;
+        }
+        if (i == 63) {
+          prev_escaped_ = 1;
+        } else {
+          escaped |= uint64_t(1) << (i + 1);
+        }
+      }
+
+      // Strings span from their opening quote up to (excluding) the closing one
+      const uint64_t quote = masks.quote & ~escaped;
+      const uint64_t in_string = PrefixXor(quote) ^ prev_in_string_;
+      prev_in_string_ = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+      control_in_string_ |= masks.control & in_string;
+
+      // Other values are runs of characters neither structural nor whitespace
+      const uint64_t atom = ~(masks.op | masks.whitespace | quote | in_string);
+      const uint64_t atom_start = atom & ~((atom << 1) | prev_atom_);
+      prev_atom_ = atom >> 63;
+
+      Flatten((masks.op & ~in_string) | quote | atom_start,
+              static_cast<uint32_t>(offset_));
+    }
+  }
+
+  static bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+  static bool IsWhitespace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+  }
+
+  // Bit i of the result is the XOR of bits 0 to i of x
+  static uint64_t PrefixXor(uint64_t x) {
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+  }
+
+  // Append the positions of the set bits of a window starting at offset
+  void Flatten(uint64_t bits, uint32_t offset) {
+    uint32_t* out = indices_ + num_indices_;
+    num_indices_ += BitUtil::PopCount(bits);
+    // Write positions by groups of 8 so that the loop branch is predictable;
+    // the positions written past the last set bit are garbage
+    while (bits != 0) {
+      for (int i = 0; i < 8; ++i) {
+        out[i] = offset + BitUtil::CountTrailingZeros(bits);
+        bits &= bits - 1;
+      }
+      out += 8;
+    }
+  }
+
+#if defined(ARROW_HAVE_SSE4_2)
+  static void ComputeMasks(const char* data, CharMasks* masks) {
+    // Operators and whitespace are classified by looking up both nibbles of
+    // each byte: a byte is in a class if both lookups have its bit.  The
+    // classes are ',' (1), ':' (2), '[]{}' (4), ' ' (8) and '\t\n\r' (16).
+    const __m128i low_table =
+        _mm_setr_epi8(8, 0, 0, 0, 0, 0, 0, 0, 0, 16, 2 | 16, 4, 1, 4 | 16, 0, 0);
+    const __m128i high_table =
+        _mm_setr_epi8(16, 0, 1 | 8, 2, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    const __m128i op_classes = _mm_set1_epi8(1 | 2 | 4);
+    const __m128i whitespace_classes = _mm_set1_epi8(8 | 16);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i max_control = _mm_set1_epi8(0x1f);
+    *masks = CharMasks{0, 0, 0, 0, 0};
+    for (int i = 0; i < 4; ++i) {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * i));
+      const __m128i classes = _mm_and_si128(
+          _mm_shuffle_epi8(low_table, _mm_and_si128(v, nibble)),
+          _mm_shuffle_epi8(high_table, _mm_and_si128(_mm_srli_epi16(v, 4), nibble)));
+      const __m128i not_op = _mm_cmpeq_epi8(_mm_and_si128(classes, op_classes), zero);
+      const __m128i not_whitespace =
+          _mm_cmpeq_epi8(_mm_and_si128(classes, whitespace_classes), zero);
+      const __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(v, max_control), v);
+      masks->quote |= MoveMask(_mm_cmpeq_epi8(v, quote), i);
+      masks->backslash |= MoveMask(_mm_cmpeq_epi8(v, backslash), i);
+      masks->op |= ~MoveMask(not_op, i) & (uint64_t(0xffff) << (16 * i));
+      masks->whitespace |= ~MoveMask(not_whitespace, i) & (uint64_t(0xffff) << (16 * i));
+      masks->control |= MoveMask(control, i);
+    }
+  }
+
+  static uint64_t MoveMask(__m128i v, int i) {
+    return static_cast<uint64_t>(_mm_movemask_epi8(v) & 0xffff) << (16 * i);
+  }
+#elif defined(ARROW_JSON_HAVE_NEON)
+  static void ComputeMasks(const char* data, CharMasks* masks) {
+    // Same nibble lookups as with SSE4.2
+    const uint8x16_t low_table = {8,  0,      0, 0, 0, 0,      0, 0,
+                                  0, 16, 2 | 16, 4, 1, 4 | 16, 0, 0};
+    const uint8x16_t high_table = {16, 0, 1 | 8, 2, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0};
+    const uint8x16_t nibble = vdupq_n_u8(0x0f);
+    uint8x16_t quote[4], backslash[4], op[4], whitespace[4], control[4];
+    for (int i = 0; i < 4; ++i) {
+      const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(data + 16 * i));
+      const uint8x16_t classes = vandq_u8(vqtbl1q_u8(low_table, vandq_u8(v, nibble)),
+                                          vqtbl1q_u8(high_table, vshrq_n_u8(v, 4)));
+      quote[i] = vceqq_u8(v, vdupq_n_u8('"'));
+      backslash[i] = vceqq_u8(v, vdupq_n_u8('\\'));
+      op[i] = vtstq_u8(classes, vdupq_n_u8(1 | 2 | 4));
+      whitespace[i] = vtstq_u8(classes, vdupq_n_u8(8 | 16));
+      control[i] = vcleq_u8(v, vdupq_n_u8(0x1f));
+    }
+    masks->quote = MoveMask(quote);
+    masks->backslash = MoveMask(backslash);
+    masks->op = MoveMask(op);
+    masks->whitespace = MoveMask(whitespace);
+    masks->control = MoveMask(control);
+  }
+
+  // Gather the top bits of four comparison results into a 64-bit mask
+  static uint64_t MoveMask(const uint8x16_t* m) {
+    const uint8x16_t bits = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+                             0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+    uint8x16_t sum0 = vpaddq_u8(vandq_u8(m[0], bits), vandq_u8(m[1], bits));
+    uint8x16_t sum1 = vpaddq_u8(vandq_u8(m[2], bits), vandq_u8(m[3], bits));
+    sum0 = vpaddq_u8(sum0, sum1);
+    sum0 = vpaddq_u8(sum0, sum0);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+  }
+#else
+  static void ComputeMasks(const char* data, CharMasks* masks) {
+    *masks = CharMasks{0, 0, 0, 0, 0};
+    for (int i = 0; i < 64; ++i) {
+      const uint64_t bit = uint64_t(1) << i;
+      const char c = data[i];
+      switch (c) {
+        case '"':
+          masks->quote |= bit;
+          break;
+        case '\\':
+          masks->backslash |= bit;
+          break;
+        case '{':
+        case '}':
+        case '[':
+        case ']':
+        case ':':
+        case ',':
+          masks->op |= bit;
+          break;
+        case ' ':
+        case '\t':
+        case '\n':
+        case '\r':
+          masks->whitespace |= bit;
+          break;
+        default:
+          break;
+      }
+      if (static_cast<uint8_t>(c) <= 0x1f) {
+        masks->control |= bit;
+      }
+    }
+  }
+#endif
+
+  MemoryPool* pool_;
+  char* data_;
+  int64_t size_;
+  // Positions of the structural characters in the current region
+  std::shared_ptr<Buffer> indices_buffer_;
+  uint32_t* indices_ = nullptr;
+  int64_t num_indices_ = 0;
+  // Index of the next structural character to consume
+  int64_t cursor_ = 0;
+
+  // Indexing state: the start of the next window, whether its first character
+  // is escaped, whether it starts inside a string or a value
+  int64_t offset_ = 0;
+  uint64_t prev_escaped_ = 0;
+  uint64_t prev_in_string_ = 0;
+  uint64_t prev_atom_ = 0;
+  // The position of the last backslash indexed
+  int64_t last_backslash_ = -1;
+  // The control characters found inside strings, which are invalid
+  uint64_t control_in_string_ = 0;
+  std::vector<Scope> scopes_;
+};
+
+}  // namespace json
+}  // namespace arrow
+
+#endif  // ARROW_JSON_STRUCTURAL_INTERNAL_H
@@ -16,6 +16,9 @@
 // under the License.
 
 #include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -41,6 +44,19 @@ TEST_F(TestDefaultMemoryPool, OOM) {
 
 TEST_F(TestDefaultMemoryPool, Reallocate) { this->TestReallocate(); }
 
+// Use a separate instance, so as not to affect the default pool's max_memory()
+class TestDefaultMemoryPoolInstance : public ::arrow::TestMemoryPoolBase {
+ public:
+  void SetUp() override { pool_ = MemoryPool::CreateDefault(); }
+
+  ::arrow::MemoryPool* memory_pool() override { return pool_.get(); }
+
+ protected:
+  std::unique_ptr<MemoryPool> pool_;
+};
+
+TEST_F(TestDefaultMemoryPoolInstance, ReallocateLarge) { this->TestReallocateLarge(); }
+
 // Death tests and valgrind are known to not play well 100% of the time. See
 // googletest documentation
 #if !(defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER))
@@ -99,4 +115,299 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pool->bytes_allocated());
   ASSERT_EQ(0, pp.bytes_allocated());
 }
+
+class TestArenaMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  void SetUp() override { pool_.reset(new ArenaMemoryPool(default_memory_pool())); }
+
+  ::arrow::MemoryPool* memory_pool() override { return pool_.get(); }
+
+ protected:
+  std::unique_ptr<ArenaMemoryPool> pool_;
+};
+
+TEST_F(TestArenaMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestArenaMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestArenaMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST(TrackingMemoryPool, TagAccounting) {
+  ProxyMemoryPool underlying(default_memory_pool());
+  TrackingMemoryPool pool(&underlying);
+  MemoryPool* csv_pool = pool.GetTaggedPool("csv");
+  MemoryPool* parquet_pool = pool.GetTaggedPool("parquet");
+  ASSERT_EQ(csv_pool, pool.GetTaggedPool("csv"));
+
+  uint8_t* data1;
+  uint8_t* data2;
+  uint8_t* data3;
+  ASSERT_OK(csv_pool->Allocate(100, &data1));
+  ASSERT_OK(parquet_pool->Allocate(200, &data2));
+  ASSERT_OK(pool.Allocate(50, &data3));
+  ASSERT_EQ(100, csv_pool->bytes_allocated());
+  ASSERT_EQ(200, parquet_pool->bytes_allocated());
+  ASSERT_EQ(350, pool.bytes_allocated());
+  ASSERT_EQ(350, underlying.bytes_allocated());
+
+  ASSERT_OK(csv_pool->Reallocate(100, 400, &data1));
+  csv_pool->Free(data1, 400);
+  parquet_pool->Free(data2, 200);
+  pool.Free(data3, 50);
+
+  TrackingMemoryPool::TagStats stats;
+  ASSERT_OK(pool.GetTagStats("csv", &stats));
+  ASSERT_EQ(0, stats.bytes_allocated);
+  ASSERT_EQ(400, stats.max_memory);
+  ASSERT_OK(pool.GetTagStats("parquet", &stats));
+  ASSERT_EQ(200, stats.max_memory);
+  ASSERT_RAISES(KeyError, pool.GetTagStats("json", &stats));
+  ASSERT_EQ(std::vector<std::string>({"csv", "parquet"}), pool.tags());
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(650, pool.max_memory());
+}
+
+TEST(TrackingMemoryPool, Limits) {
+  ProxyMemoryPool underlying(default_memory_pool());
+  TrackingMemoryPool pool(&underlying, /*soft_limit=*/500, /*hard_limit=*/1000);
+  pool.SetTagLimits("hash", 100, 200);
+  MemoryPool* hash_pool = pool.GetTaggedPool("hash");
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(hash_pool->Allocate(150, &data1));
+  ASSERT_TRUE(pool.ExceedsSoftLimit("hash"));
+  ASSERT_FALSE(pool.ExceedsSoftLimit());
+  // Exceeds the tag's hard limit
+  ASSERT_RAISES(OutOfMemory, hash_pool->Allocate(100, &data2));
+  ASSERT_RAISES(OutOfMemory, hash_pool->Reallocate(150, 250, &data1));
+  ASSERT_EQ(150, hash_pool->bytes_allocated());
+  ASSERT_EQ(150, underlying.bytes_allocated());
+
+  // Exceeds the pool's hard limit
+  ASSERT_OK(pool.Allocate(600, &data2));
+  ASSERT_TRUE(pool.ExceedsSoftLimit());
+  ASSERT_RAISES(OutOfMemory, pool.Reallocate(600, 900, &data2));
+  ASSERT_EQ(750, pool.bytes_allocated());
+
+  hash_pool->Free(data1, 150);
+  ASSERT_FALSE(pool.ExceedsSoftLimit("hash"));
+  pool.Free(data2, 600);
+  ASSERT_FALSE(pool.ExceedsSoftLimit());
+  ASSERT_EQ(0, underlying.bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, ReuseFreedBlocks) {
+  ProxyMemoryPool underlying(default_memory_pool());
+  ArenaMemoryPool pool(&underlying, /*num_caches=*/1);
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(100, &data));
+  // Rounded up to the 128-byte size class
+  ASSERT_EQ(128, underlying.bytes_allocated());
+  ASSERT_EQ(100, pool.bytes_allocated());
+  pool.Free(data, 100);
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(128, pool.bytes_cached());
+  ASSERT_EQ(128, underlying.bytes_allocated());
+
+  // Same size class is served from the cache
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(65, &data2));
+  ASSERT_EQ(data, data2);
+  ASSERT_EQ(0, pool.bytes_cached());
+  ASSERT_EQ(128, underlying.bytes_allocated());
+
+  // Growing within the size class keeps the block
+  ASSERT_OK(pool.Reallocate(65, 120, &data2));
+  ASSERT_EQ(data, data2);
+  ASSERT_EQ(120, pool.bytes_allocated());
+
+  // Large allocations bypass the cache
+  uint8_t* data3;
+  ASSERT_OK(pool.Allocate(ArenaMemoryPool::kMaxCachedSize + 1, &data3));
+  ASSERT_EQ(128 + ArenaMemoryPool::kMaxCachedSize + 1, underlying.bytes_allocated());
+  pool.Free(data3, ArenaMemoryPool::kMaxCachedSize + 1);
+  ASSERT_EQ(0, pool.bytes_cached());
+
+  pool.Free(data2, 120);
+  pool.ReleaseCached();
+  ASSERT_EQ(0, pool.bytes_cached());
+  ASSERT_EQ(0, underlying.bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, CacheLimit) {
+  ProxyMemoryPool underlying(default_memory_pool());
+  ArenaMemoryPool pool(&underlying, /*num_caches=*/1,
+                       /*max_cached_bytes_per_cache=*/256);
+
+  std::vector<uint8_t*> blocks(4);
+  for (auto& block : blocks) {
+    ASSERT_OK(pool.Allocate(128, &block));
+  }
+  for (auto block : blocks) {
+    pool.Free(block, 128);
+  }
+  ASSERT_EQ(256, pool.bytes_cached());
+  ASSERT_EQ(256, underlying.bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, MultiThreaded) {
+  ProxyMemoryPool underlying(default_memory_pool());
+  {
+    ArenaMemoryPool pool(&underlying);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+      threads.emplace_back([&pool, i]() {
+        for (int j = 0; j < 1000; ++j) {
+          uint8_t* data;
+          const int64_t size = (i * 997 + j * 31) % 5000 + 1;
+          ASSERT_OK(pool.Allocate(size, &data));
+          ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % 64);
+          data[0] = data[size - 1] = static_cast<uint8_t>(j);
+          pool.Free(data, size);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    ASSERT_EQ(0, pool.bytes_allocated());
+  }
+  // Cached blocks are released on destruction
+  ASSERT_EQ(0, underlying.bytes_allocated());
+}
+
+TEST(ScopedArenaPool, Basics) {
+  ProxyMemoryPool underlying(default_memory_pool());
+  ScopedArenaPool pool(&underlying, /*min_chunk_size=*/1024);
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(pool.Allocate(100, &data1));
+  ASSERT_OK(pool.Allocate(27, &data2));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data1) % 64);
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data2) % 64);
+  ASSERT_EQ(data1 + 128, data2);
+  ASSERT_EQ(127, pool.bytes_allocated());
+  ASSERT_EQ(1024, pool.total_bytes());
+  ASSERT_EQ(1024, underlying.bytes_allocated());
+
+  // Free only updates the statistics
+  pool.Free(data1, 100);
+  ASSERT_EQ(27, pool.bytes_allocated());
+  ASSERT_EQ(1024, underlying.bytes_allocated());
+
+  // The most recent allocation grows in place
+  data2[0] = 42;
+  ASSERT_OK(pool.Reallocate(27, 300, &data2));
+  ASSERT_EQ(data1 + 128, data2);
+  ASSERT_EQ(42, data2[0]);
+
+  // Other allocations are moved
+  uint8_t* data3;
+  ASSERT_OK(pool.Allocate(10, &data3));
+  data2[299] = 43;
+  ASSERT_OK(pool.Reallocate(300, 400, &data2));
+  ASSERT_EQ(data3 + 64, data2);
+  ASSERT_EQ(42, data2[0]);
+  ASSERT_EQ(43, data2[299]);
+
+  // Allocations larger than the chunk size get their own chunk
+  uint8_t* data4;
+  ASSERT_OK(pool.Allocate(5000, &data4));
+  ASSERT_EQ(1024 + 5056, pool.total_bytes());
+
+  // Reset retains the first chunk only
+  pool.Reset();
+  ASSERT_EQ(0, pool.bytes_allocated());
+  ASSERT_EQ(1024, pool.total_bytes());
+  ASSERT_EQ(1024, underlying.bytes_allocated());
+  ASSERT_OK(pool.Allocate(64, &data4));
+  ASSERT_EQ(data1, data4);
+}
+
+TEST(ScopedArenaPool, ZeroSize) {
+  ProxyMemoryPool underlying(default_memory_pool());
+  {
+    ScopedArenaPool pool(&underlying);
+    uint8_t* data;
+    ASSERT_OK(pool.Allocate(0, &data));
+    ASSERT_NE(nullptr, data);
+    ASSERT_EQ(0, pool.total_bytes());
+    ASSERT_OK(pool.Reallocate(0, 10, &data));
+    ASSERT_EQ(10, pool.bytes_allocated());
+    ASSERT_RAISES(Invalid, pool.Allocate(-1, &data));
+  }
+  ASSERT_EQ(0, underlying.bytes_allocated());
+}
+
+class TestNumaMemoryPool : public ::arrow::TestMemoryPoolBase {
+ public:
+  void SetUp() override {
+    auto options = NumaMemoryPoolOptions::Defaults();
+    // Exercise the page mapping path with small sizes
+    options.large_allocation_threshold = 16;
+    options.numa_node = NumaMemoryPoolOptions::kCallerNode;
+    pool_.reset(new NumaMemoryPool(options));
+  }
+
+  ::arrow::MemoryPool* memory_pool() override { return pool_.get(); }
+
+ protected:
+  std::unique_ptr<NumaMemoryPool> pool_;
+};
+
+TEST_F(TestNumaMemoryPool, MemoryTracking) { this->TestMemoryTracking(); }
+
+TEST_F(TestNumaMemoryPool, OOM) {
+#ifndef ADDRESS_SANITIZER
+  this->TestOOM();
+#endif
+}
+
+TEST_F(TestNumaMemoryPool, Reallocate) { this->TestReallocate(); }
+
+TEST_F(TestNumaMemoryPool, ReallocateLarge) { this->TestReallocateLarge(); }
+
+TEST(NumaMemoryPool, LargeAllocations) {
+  for (bool explicit_huge_pages : {false, true}) {
+    for (bool transparent_huge_pages : {false, true}) {
+      auto options = NumaMemoryPoolOptions::Defaults();
+      options.explicit_huge_pages = explicit_huge_pages;
+      options.transparent_huge_pages = transparent_huge_pages;
+      options.numa_node = 0;
+      NumaMemoryPool pool(options);
+
+      const int64_t size = options.large_allocation_threshold + 10;
+      uint8_t* data;
+      ASSERT_OK(pool.Allocate(size, &data));
+      ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % 64);
+      ASSERT_EQ(size, pool.bytes_allocated());
+      data[0] = 1;
+      data[size - 1] = 2;
+
+      // Shrink below the threshold
+      ASSERT_OK(pool.Reallocate(size, 100, &data));
+      ASSERT_EQ(1, data[0]);
+      ASSERT_EQ(100, pool.bytes_allocated());
+
+      // Grow again
+      data[99] = 3;
+      ASSERT_OK(pool.Reallocate(100, 3 * size, &data));
+      ASSERT_EQ(1, data[0]);
+      ASSERT_EQ(3, data[99]);
+      data[3 * size - 1] = 4;
+
+      pool.Free(data, 3 * size);
+      ASSERT_EQ(0, pool.bytes_allocated());
+      ASSERT_EQ(3 * size, pool.max_memory());
+    }
+  }
+}
+
 }  // namespace arrow
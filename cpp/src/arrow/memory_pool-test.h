@@ -85,6 +85,44 @@ class TestMemoryPoolBase : public ::testing::Test {
     pool->Free(data, 5);
     ASSERT_EQ(0, pool->bytes_allocated());
   }
+
+  void TestReallocateLarge() {
+    auto pool = memory_pool();
+    const int64_t kLarge = 16 * 1024 * 1024;
+
+    uint8_t* data;
+    ASSERT_OK(pool->Allocate(1000, &data));
+    data[0] = 35;
+    data[999] = 12;
+
+    // Expand across a size threshold some allocators may use
+    ASSERT_OK(pool->Reallocate(1000, kLarge, &data));
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % 64);
+    ASSERT_EQ(data[0], 35);
+    ASSERT_EQ(data[999], 12);
+    data[kLarge - 1] = 42;
+
+    // Expand a large allocation several times
+    int64_t size = kLarge;
+    for (int i = 0; i < 3; ++i) {
+      ASSERT_OK(pool->Reallocate(size, size * 2, &data));
+      ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % 64);
+      ASSERT_EQ(data[0], 35);
+      ASSERT_EQ(data[kLarge - 1], 42);
+      size *= 2;
+      data[size - 1] = 43;
+      ASSERT_EQ(size, pool->bytes_allocated());
+    }
+
+    // Shrink back below the threshold
+    ASSERT_OK(pool->Reallocate(size, 1000, &data));
+    ASSERT_EQ(data[0], 35);
+    ASSERT_EQ(data[999], 12);
+    ASSERT_EQ(1000, pool->bytes_allocated());
+
+    pool->Free(data, 1000);
+    ASSERT_EQ(0, pool->bytes_allocated());
+  }
 };
 
 }  // namespace arrow
@@ -22,12 +22,24 @@
 #include <cstring>    // IWYU pragma: keep
 #include <iostream>   // IWYU pragma: keep
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>  // IWYU pragma: keep
+#include <thread>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
 
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define ARROW_HAVE_PAGE_MAPPING_POOL
+#endif
+
 #ifdef ARROW_JEMALLOC
 // Needed to support jemalloc 3 and 4
 #define JEMALLOC_MANGLE
@@ -45,6 +57,52 @@ namespace {
 // an aligned non-null pointer.
 alignas(kAlignment) static uint8_t zero_size_area[1];
 
+#ifdef ARROW_HAVE_PAGE_MAPPING_POOL
+
+int64_t GetPageSize() {
+  static const int64_t page_size = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+  return page_size;
+}
+
+// Map anonymous pages
+Status MapAnonymous(int64_t mapping_size, uint8_t** out) {
+  void* addr = mmap(nullptr, static_cast<size_t>(mapping_size), PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (addr == MAP_FAILED) {
+    return Status::OutOfMemory("mmap of size ", mapping_size, " failed");
+  }
+  *out = reinterpret_cast<uint8_t*>(addr);
+  return Status::OK();
+}
+
+// Resize a mapping, moving it if necessary.  The contents are preserved
+// without copying, as only the page table entries are moved.
+Status RemapAnonymous(int64_t old_mapping_size, int64_t new_mapping_size,
+                      uint8_t** ptr) {
+  void* addr = mremap(*ptr, static_cast<size_t>(old_mapping_size),
+                      static_cast<size_t>(new_mapping_size), MREMAP_MAYMOVE);
+  if (addr == MAP_FAILED) {
+    return Status::OutOfMemory("mremap of size ", new_mapping_size, " failed");
+  }
+  *ptr = reinterpret_cast<uint8_t*>(addr);
+  return Status::OK();
+}
+
+#endif  // ARROW_HAVE_PAGE_MAPPING_POOL
+
+#if defined(ARROW_HAVE_PAGE_MAPPING_POOL) && !defined(ARROW_JEMALLOC)
+// With the system allocator, large allocations are served from dedicated
+// mappings, so that they can be grown with mremap() instead of being copied.
+// (jemalloc already resizes large allocations in-place when possible.)
+#define ARROW_MMAP_LARGE_ALLOCATIONS
+
+constexpr int64_t kMmapThreshold = 4 * 1024 * 1024;
+
+bool IsMmapAllocation(int64_t size) { return size >= kMmapThreshold; }
+
+int64_t MmapAllocationSize(int64_t size) { return BitUtil::RoundUp(size, GetPageSize()); }
+#endif
+
 // Allocate memory according to the alignment requirements for Arrow
 // (as of May 2016 64 bytes)
 Status AllocateAligned(int64_t size, uint8_t** out) {
@@ -73,6 +131,14 @@ Status AllocateAligned(int64_t size, uint8_t** out) {
     return Status::OutOfMemory("malloc of size ", size, " failed");
   }
 #else
+#ifdef ARROW_MMAP_LARGE_ALLOCATIONS
+  if (IsMmapAllocation(size)) {
+    if (size > std::numeric_limits<int64_t>::max() - GetPageSize()) {
+      return Status::OutOfMemory("malloc of size ", size, " failed");
+    }
+    return MapAnonymous(MmapAllocationSize(size), out);
+  }
+#endif
   const int result = posix_memalign(reinterpret_cast<void**>(out), kAlignment,
                                     static_cast<size_t>(size));
   if (result == ENOMEM) {
@@ -95,6 +161,12 @@ void DeallocateAligned(uint8_t* ptr, int64_t size) {
 #elif defined(ARROW_JEMALLOC)
     dallocx(ptr, MALLOCX_ALIGN(kAlignment));
 #else
+#ifdef ARROW_MMAP_LARGE_ALLOCATIONS
+    if (IsMmapAllocation(size)) {
+      munmap(ptr, static_cast<size_t>(MmapAllocationSize(size)));
+      return;
+    }
+#endif
     std::free(ptr);
 #endif
   }
@@ -125,6 +197,19 @@ Status ReallocateAligned(int64_t old_size, int64_t new_size, uint8_t** ptr) {
     return Status::OutOfMemory("realloc of size ", new_size, " failed");
   }
 #else
+#ifdef ARROW_MMAP_LARGE_ALLOCATIONS
+  if (IsMmapAllocation(old_size) && IsMmapAllocation(new_size)) {
+    if (new_size > std::numeric_limits<int64_t>::max() - GetPageSize()) {
+      return Status::OutOfMemory("realloc of size ", new_size, " failed");
+    }
+    const int64_t old_mapping_size = MmapAllocationSize(old_size);
+    const int64_t new_mapping_size = MmapAllocationSize(new_size);
+    if (old_mapping_size == new_mapping_size) {
+      return Status::OK();
+    }
+    return RemapAnonymous(old_mapping_size, new_mapping_size, ptr);
+  }
+#endif
   // Note: We cannot use realloc() here as it doesn't guarantee alignment.
 
   // Allocate new chunk
@@ -133,17 +218,99 @@ Status ReallocateAligned(int64_t old_size, int64_t new_size, uint8_t** ptr) {
   DCHECK(out);
   // Copy contents and release old memory chunk
   memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
-#ifdef _WIN32
-  _aligned_free(*ptr);
-#else
-  std::free(*ptr);
-#endif  // defined(_MSC_VER)
+  DeallocateAligned(*ptr, old_size);
   *ptr = out;
 #endif  // defined(ARROW_JEMALLOC)
 
   return Status::OK();
 }
 
+#ifdef ARROW_HAVE_PAGE_MAPPING_POOL
+
+// Memory policies from <numaif.h>, so as not to require libnuma
+constexpr int kMemPolicyPreferred = 1;
+constexpr int kMemPolicyBind = 2;
+
+constexpr int64_t kHugePageSize = 2 * 1024 * 1024;
+
+int GetCallerNumaNode() {
+#ifdef SYS_getcpu
+  unsigned int cpu = 0, node = 0;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0) {
+    return static_cast<int>(node);
+  }
+#endif
+  return NumaMemoryPoolOptions::kAnyNode;
+}
+
+void BindToNumaNode(uint8_t* addr, int64_t size, int node, bool strict) {
+#ifdef SYS_mbind
+  if (node < 0 || node >= 64) {
+    return;
+  }
+  const uint64_t node_mask = uint64_t(1) << node;
+  // Failure (e.g. no NUMA support) is not fatal, the pages are just placed
+  // according to the system policy
+  syscall(SYS_mbind, addr, static_cast<unsigned long>(size),  // NOLINT
+          strict ? kMemPolicyBind : kMemPolicyPreferred, &node_mask,
+          static_cast<unsigned long>(sizeof(node_mask) * 8 + 1), 0);  // NOLINT
+#endif
+}
+
+// Map anonymous pages for a large allocation, according to the given options
+Status MapPages(const NumaMemoryPoolOptions& options, int64_t mapping_size,
+                uint8_t** out) {
+  void* addr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+  if (options.explicit_huge_pages) {
+    addr = mmap(nullptr, static_cast<size_t>(mapping_size), PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  }
+#endif
+  if (addr == MAP_FAILED && options.transparent_huge_pages) {
+    // Over-allocate so as to return a huge page-aligned region, which the
+    // kernel can back entirely with huge pages
+    const size_t padded_size = static_cast<size_t>(mapping_size + kHugePageSize);
+    void* padded = mmap(nullptr, padded_size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (padded != MAP_FAILED) {
+      const uintptr_t start = reinterpret_cast<uintptr_t>(padded);
+      const uintptr_t aligned_start = BitUtil::RoundUpToPowerOf2(
+          static_cast<int64_t>(start), kHugePageSize);
+      const size_t head = aligned_start - start;
+      const size_t tail = padded_size - head - static_cast<size_t>(mapping_size);
+      if (head > 0) {
+        munmap(padded, head);
+      }
+      if (tail > 0) {
+        munmap(reinterpret_cast<void*>(aligned_start + mapping_size), tail);
+      }
+      addr = reinterpret_cast<void*>(aligned_start);
+#ifdef MADV_HUGEPAGE
+      madvise(addr, static_cast<size_t>(mapping_size), MADV_HUGEPAGE);
+#endif
+    }
+  } else if (addr == MAP_FAILED) {
+    addr = mmap(nullptr, static_cast<size_t>(mapping_size), PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  }
+  if (addr == MAP_FAILED) {
+    return Status::OutOfMemory("mmap of size ", mapping_size, " failed");
+  }
+  *out = reinterpret_cast<uint8_t*>(addr);
+
+  int node = options.numa_node;
+  if (node == NumaMemoryPoolOptions::kCallerNode) {
+    node = GetCallerNumaNode();
+  }
+  if (node != NumaMemoryPoolOptions::kAnyNode) {
+    BindToNumaNode(*out, mapping_size, node, options.strict_numa_binding);
+  }
+  return Status::OK();
+}
+
+#endif  // ARROW_HAVE_PAGE_MAPPING_POOL
+
 }  // namespace
 
 MemoryPool::MemoryPool() {}
@@ -286,4 +453,714 @@ int64_t ProxyMemoryPool::bytes_allocated() const { return impl_->bytes_allocated
 
 int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
+///////////////////////////////////////////////////////////////////////
+// TrackingMemoryPool implementation
+
+namespace {
+
+// Allocation accounting subject to limits
+class LimitedMemoryStats : public internal::MemoryPoolStats {
+ public:
+  LimitedMemoryStats() : soft_limit_(-1), hard_limit_(-1) {}
+
+  // Account for `diff` more bytes if that doesn't exceed the hard limit
+  bool TryReserve(int64_t diff) {
+    const int64_t allocated = bytes_allocated_.fetch_add(diff) + diff;
+    const int64_t hard_limit = hard_limit_.load();
+    if (diff > 0 && hard_limit >= 0 && allocated > hard_limit) {
+      bytes_allocated_.fetch_sub(diff);
+      return false;
+    }
+    if (diff > 0 && allocated > max_memory_) {
+      max_memory_ = allocated;
+    }
+    return true;
+  }
+
+  void SetLimits(int64_t soft_limit, int64_t hard_limit) {
+    soft_limit_ = soft_limit;
+    hard_limit_ = hard_limit;
+  }
+
+  int64_t soft_limit() const { return soft_limit_.load(); }
+  int64_t hard_limit() const { return hard_limit_.load(); }
+
+  bool ExceedsSoftLimit() const {
+    const int64_t soft_limit = soft_limit_.load();
+    return soft_limit >= 0 && bytes_allocated() > soft_limit;
+  }
+
+ private:
+  std::atomic<int64_t> soft_limit_;
+  std::atomic<int64_t> hard_limit_;
+};
+
+// Reserve `diff` bytes in all `stats`, or none if a hard limit is exceeded
+Status ReserveAll(int64_t diff, LimitedMemoryStats* tag_stats,
+                  LimitedMemoryStats* pool_stats, const std::string& tag) {
+  if (tag_stats != nullptr && !tag_stats->TryReserve(diff)) {
+    return Status::OutOfMemory("allocation of ", diff, " bytes exceeds the limit of ",
+                               tag_stats->hard_limit(), " bytes for tag '", tag, "'");
+  }
+  if (!pool_stats->TryReserve(diff)) {
+    if (tag_stats != nullptr) {
+      tag_stats->TryReserve(-diff);
+    }
+    return Status::OutOfMemory("allocation of ", diff, " bytes exceeds the limit of ",
+                               pool_stats->hard_limit(), " bytes for the memory pool");
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+class TrackingMemoryPool::TrackingMemoryPoolImpl {
+ public:
+  // A pool forwarding to the tracking pool while accounting for a tag
+  class TaggedMemoryPool : public MemoryPool {
+   public:
+    TaggedMemoryPool(TrackingMemoryPoolImpl* parent, std::string tag)
+        : parent_(parent), tag_(std::move(tag)) {}
+
+    Status Allocate(int64_t size, uint8_t** out) override {
+      return parent_->Allocate(&stats_, tag_, size, out);
+    }
+
+    Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override {
+      return parent_->Reallocate(&stats_, tag_, old_size, new_size, ptr);
+    }
+
+    void Free(uint8_t* buffer, int64_t size) override {
+      parent_->Free(&stats_, buffer, size);
+    }
+
+    int64_t bytes_allocated() const override { return stats_.bytes_allocated(); }
+
+    int64_t max_memory() const override { return stats_.max_memory(); }
+
+    LimitedMemoryStats* stats() { return &stats_; }
+
+   private:
+    TrackingMemoryPoolImpl* parent_;
+    const std::string tag_;
+    LimitedMemoryStats stats_;
+  };
+
+  TrackingMemoryPoolImpl(MemoryPool* pool, int64_t soft_limit, int64_t hard_limit)
+      : pool_(pool) {
+    stats_.SetLimits(soft_limit, hard_limit);
+  }
+
+  Status Allocate(LimitedMemoryStats* tag_stats, const std::string& tag, int64_t size,
+                  uint8_t** out) {
+    RETURN_NOT_OK(ReserveAll(size, tag_stats, &stats_, tag));
+    Status st = pool_->Allocate(size, out);
+    if (!st.ok()) {
+      Unreserve(tag_stats, size);
+    }
+    return st;
+  }
+
+  Status Reallocate(LimitedMemoryStats* tag_stats, const std::string& tag,
+                    int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const int64_t diff = new_size - old_size;
+    RETURN_NOT_OK(ReserveAll(diff, tag_stats, &stats_, tag));
+    Status st = pool_->Reallocate(old_size, new_size, ptr);
+    if (!st.ok()) {
+      Unreserve(tag_stats, diff);
+    }
+    return st;
+  }
+
+  void Free(LimitedMemoryStats* tag_stats, uint8_t* buffer, int64_t size) {
+    pool_->Free(buffer, size);
+    Unreserve(tag_stats, size);
+  }
+
+  MemoryPool* GetTaggedPool(const std::string& tag) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = tagged_pools_.find(tag);
+    if (it == tagged_pools_.end()) {
+      it = tagged_pools_
+               .emplace(tag, std::unique_ptr<TaggedMemoryPool>(
+                                 new TaggedMemoryPool(this, tag)))
+               .first;
+    }
+    return it->second.get();
+  }
+
+  TaggedMemoryPool* FindTaggedPool(const std::string& tag) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = tagged_pools_.find(tag);
+    return it == tagged_pools_.end() ? nullptr : it->second.get();
+  }
+
+  std::vector<std::string> tags() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::string> out;
+    for (const auto& pair : tagged_pools_) {
+      out.push_back(pair.first);
+    }
+    return out;
+  }
+
+  LimitedMemoryStats* stats() { return &stats_; }
+
+ private:
+  void Unreserve(LimitedMemoryStats* tag_stats, int64_t size) {
+    if (tag_stats != nullptr) {
+      tag_stats->UpdateAllocatedBytes(-size);
+    }
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  MemoryPool* pool_;
+  LimitedMemoryStats stats_;
+  mutable std::mutex mutex_;
+  std::map<std::string, std::unique_ptr<TaggedMemoryPool>> tagged_pools_;
+};
+
+TrackingMemoryPool::TrackingMemoryPool(MemoryPool* pool, int64_t soft_limit,
+                                       int64_t hard_limit) {
+  impl_.reset(new TrackingMemoryPoolImpl(pool, soft_limit, hard_limit));
+}
+
+TrackingMemoryPool::~TrackingMemoryPool() {}
+
+Status TrackingMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(nullptr, "", size, out);
+}
+
+Status TrackingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                      uint8_t** ptr) {
+  return impl_->Reallocate(nullptr, "", old_size, new_size, ptr);
+}
+
+void TrackingMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  impl_->Free(nullptr, buffer, size);
+}
+
+int64_t TrackingMemoryPool::bytes_allocated() const {
+  return impl_->stats()->bytes_allocated();
+}
+
+int64_t TrackingMemoryPool::max_memory() const { return impl_->stats()->max_memory(); }
+
+MemoryPool* TrackingMemoryPool::GetTaggedPool(const std::string& tag) {
+  return impl_->GetTaggedPool(tag);
+}
+
+void TrackingMemoryPool::SetTagLimits(const std::string& tag, int64_t soft_limit,
+                                      int64_t hard_limit) {
+  impl_->GetTaggedPool(tag);
+  impl_->FindTaggedPool(tag)->stats()->SetLimits(soft_limit, hard_limit);
+}
+
+Status TrackingMemoryPool::GetTagStats(const std::string& tag, TagStats* out) const {
+  auto tagged_pool = impl_->FindTaggedPool(tag);
+  if (tagged_pool == nullptr) {
+    return Status::KeyError("no allocations were made for tag '", tag, "'");
+  }
+  const LimitedMemoryStats* stats = tagged_pool->stats();
+  out->bytes_allocated = stats->bytes_allocated();
+  out->max_memory = stats->max_memory();
+  out->soft_limit = stats->soft_limit();
+  out->hard_limit = stats->hard_limit();
+  return Status::OK();
+}
+
+std::vector<std::string> TrackingMemoryPool::tags() const { return impl_->tags(); }
+
+bool TrackingMemoryPool::ExceedsSoftLimit() const {
+  return impl_->stats()->ExceedsSoftLimit();
+}
+
+bool TrackingMemoryPool::ExceedsSoftLimit(const std::string& tag) const {
+  auto tagged_pool = impl_->FindTaggedPool(tag);
+  return tagged_pool != nullptr && tagged_pool->stats()->ExceedsSoftLimit();
+}
+
+///////////////////////////////////////////////////////////////////////
+// ArenaMemoryPool implementation
+
+constexpr int64_t ArenaMemoryPool::kMaxCachedSize;
+
+class ArenaMemoryPool::ArenaMemoryPoolImpl {
+ public:
+  // Size classes are powers of two from kAlignment to kMaxCachedSize
+  static constexpr int kMinSizeClassBits = 6;
+  static constexpr int kNumSizeClasses = 10;
+
+  static_assert((int64_t(1) << kMinSizeClassBits) == kAlignment,
+                "smallest size class should match the alignment");
+  static_assert((int64_t(1) << (kMinSizeClassBits + kNumSizeClasses - 1)) ==
+                    ArenaMemoryPool::kMaxCachedSize,
+                "largest size class should match kMaxCachedSize");
+
+  ArenaMemoryPoolImpl(MemoryPool* pool, int num_caches, int64_t max_cached_bytes)
+      : pool_(pool), max_cached_bytes_(max_cached_bytes), bytes_cached_(0) {
+    if (num_caches <= 0) {
+      num_caches = 2 * std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    caches_.reset(new ThreadCache[num_caches]);
+    num_caches_ = num_caches;
+  }
+
+  ~ArenaMemoryPoolImpl() { ReleaseCached(); }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    const int size_class = SizeClass(size);
+    if (size_class < 0) {
+      RETURN_NOT_OK(pool_->Allocate(size, out));
+    } else {
+      ThreadCache* cache = GetCache();
+      {
+        std::lock_guard<std::mutex> lock(cache->mutex);
+        auto& free_list = cache->free_lists[size_class];
+        if (!free_list.empty()) {
+          *out = free_list.back();
+          free_list.pop_back();
+          cache->bytes_cached -= SizeClassBytes(size_class);
+          bytes_cached_ -= SizeClassBytes(size_class);
+          stats_.UpdateAllocatedBytes(size);
+          return Status::OK();
+        }
+      }
+      RETURN_NOT_OK(pool_->Allocate(SizeClassBytes(size_class), out));
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    const int old_class = SizeClass(old_size);
+    const int new_class = SizeClass(new_size);
+    if (old_class < 0 && new_class < 0) {
+      // Neither block is cached, let the underlying pool resize in-place
+      // if it is able to
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    } else if (old_class != new_class) {
+      uint8_t* out = nullptr;
+      RETURN_NOT_OK(Allocate(new_size, &out));
+      memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
+      Free(*ptr, old_size);
+      *ptr = out;
+      // Allocate() and Free() already accounted for the sizes
+      return Status::OK();
+    }
+    // Otherwise, the existing block is large enough
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    stats_.UpdateAllocatedBytes(-size);
+    const int size_class = SizeClass(size);
+    if (size_class < 0) {
+      pool_->Free(buffer, size);
+      return;
+    }
+    const int64_t block_size = SizeClassBytes(size_class);
+    ThreadCache* cache = GetCache();
+    {
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      if (cache->bytes_cached + block_size <= max_cached_bytes_) {
+        cache->free_lists[size_class].push_back(buffer);
+        cache->bytes_cached += block_size;
+        bytes_cached_ += block_size;
+        return;
+      }
+    }
+    // Cache full, give the block back
+    pool_->Free(buffer, block_size);
+  }
+
+  void ReleaseCached() {
+    for (int i = 0; i < num_caches_; ++i) {
+      ThreadCache* cache = &caches_[i];
+      std::lock_guard<std::mutex> lock(cache->mutex);
+      for (int size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+        const int64_t block_size = SizeClassBytes(size_class);
+        for (uint8_t* block : cache->free_lists[size_class]) {
+          pool_->Free(block, block_size);
+        }
+        bytes_cached_ -=
+            block_size * static_cast<int64_t>(cache->free_lists[size_class].size());
+        cache->free_lists[size_class].clear();
+      }
+      cache->bytes_cached = 0;
+    }
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t bytes_cached() const { return bytes_cached_.load(); }
+
+ private:
+  struct ThreadCache {
+    std::mutex mutex;
+    std::vector<uint8_t*> free_lists[kNumSizeClasses];
+    int64_t bytes_cached = 0;
+  };
+
+  // Return the size class for an allocation, or -1 if it is not cached
+  static int SizeClass(int64_t size) {
+    if (size <= 0 || size > ArenaMemoryPool::kMaxCachedSize) {
+      return -1;
+    }
+    return std::max(0, BitUtil::Log2(static_cast<uint64_t>(size)) - kMinSizeClassBits);
+  }
+
+  static int64_t SizeClassBytes(int size_class) {
+    return int64_t(1) << (size_class + kMinSizeClassBits);
+  }
+
+  ThreadCache* GetCache() {
+    const size_t h = std::hash<std::thread::id>()(std::this_thread::get_id());
+    return &caches_[h % static_cast<size_t>(num_caches_)];
+  }
+
+  MemoryPool* pool_;
+  const int64_t max_cached_bytes_;
+  std::unique_ptr<ThreadCache[]> caches_;
+  int num_caches_;
+  std::atomic<int64_t> bytes_cached_;
+  internal::MemoryPoolStats stats_;
+};
+
+ArenaMemoryPool::ArenaMemoryPool(MemoryPool* pool, int num_caches,
+                                 int64_t max_cached_bytes_per_cache) {
+  impl_.reset(new ArenaMemoryPoolImpl(pool, num_caches, max_cached_bytes_per_cache));
+}
+
+ArenaMemoryPool::~ArenaMemoryPool() {}
+
+Status ArenaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ArenaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ArenaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t ArenaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ArenaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t ArenaMemoryPool::bytes_cached() const { return impl_->bytes_cached(); }
+
+void ArenaMemoryPool::ReleaseCached() { impl_->ReleaseCached(); }
+
+///////////////////////////////////////////////////////////////////////
+// ScopedArenaPool implementation
+
+class ScopedArenaPool::ScopedArenaPoolImpl {
+ public:
+  ScopedArenaPoolImpl(MemoryPool* pool, int64_t min_chunk_size)
+      : pool_(pool),
+        min_chunk_size_(BitUtil::RoundUpToMultipleOf64(min_chunk_size)),
+        total_bytes_(0),
+        avail_buf_(nullptr),
+        avail_bytes_(0),
+        last_alloc_(nullptr) {}
+
+  ~ScopedArenaPoolImpl() { ReleaseChunks(0); }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size == 0) {
+      *out = zero_size_area;
+      return Status::OK();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(AllocateUnlocked(size, out));
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (new_size <= BitUtil::RoundUpToMultipleOf64(old_size)) {
+      // Shrinking, or growing into the alignment padding
+      if (*ptr == last_alloc_) {
+        ReturnTail(old_size, new_size);
+      }
+    } else if (*ptr == last_alloc_ && GrowTail(old_size, new_size)) {
+      // Grown in place
+    } else {
+      uint8_t* out;
+      RETURN_NOT_OK(AllocateUnlocked(new_size, &out));
+      if (old_size > 0) {
+        memcpy(out, *ptr, static_cast<size_t>(old_size));
+      }
+      *ptr = out;
+    }
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) { stats_.UpdateAllocatedBytes(-size); }
+
+  void Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ReleaseChunks(1);
+    if (chunks_.empty()) {
+      avail_buf_ = nullptr;
+      avail_bytes_ = 0;
+    } else {
+      avail_buf_ = chunks_[0].first;
+      avail_bytes_ = chunks_[0].second;
+    }
+    last_alloc_ = nullptr;
+    stats_.UpdateAllocatedBytes(-stats_.bytes_allocated());
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t total_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return total_bytes_;
+  }
+
+ private:
+  Status AllocateUnlocked(int64_t size, uint8_t** out) {
+    const int64_t padded_size = BitUtil::RoundUpToMultipleOf64(size);
+    if (avail_bytes_ < padded_size) {
+      RETURN_NOT_OK(AllocateChunk(std::max(padded_size, min_chunk_size_)));
+    }
+    *out = last_alloc_ = avail_buf_;
+    avail_buf_ += padded_size;
+    avail_bytes_ -= padded_size;
+    return Status::OK();
+  }
+
+  // Shrink the most recent allocation, returning its tail to the chunk
+  void ReturnTail(int64_t old_size, int64_t new_size) {
+    const int64_t diff = BitUtil::RoundUpToMultipleOf64(old_size) -
+                         BitUtil::RoundUpToMultipleOf64(new_size);
+    avail_buf_ -= diff;
+    avail_bytes_ += diff;
+  }
+
+  // Try to extend the most recent allocation within the current chunk
+  bool GrowTail(int64_t old_size, int64_t new_size) {
+    const int64_t diff = BitUtil::RoundUpToMultipleOf64(new_size) -
+                         BitUtil::RoundUpToMultipleOf64(old_size);
+    if (diff > avail_bytes_) {
+      return false;
+    }
+    avail_buf_ += diff;
+    avail_bytes_ -= diff;
+    return true;
+  }
+
+  Status AllocateChunk(int64_t size) {
+    uint8_t* out;
+    RETURN_NOT_OK(pool_->Allocate(size, &out));
+    chunks_.emplace_back(out, size);
+    // Left-over bytes in the previous chunk are not used anymore
+    avail_buf_ = out;
+    avail_bytes_ = size;
+    total_bytes_ += size;
+    return Status::OK();
+  }
+
+  // Release all chunks but the first `retain`
+  void ReleaseChunks(size_t retain) {
+    for (size_t i = retain; i < chunks_.size(); ++i) {
+      pool_->Free(chunks_[i].first, chunks_[i].second);
+      total_bytes_ -= chunks_[i].second;
+    }
+    if (chunks_.size() > retain) {
+      chunks_.resize(retain);
+    }
+  }
+
+  MemoryPool* pool_;
+  const int64_t min_chunk_size_;
+  mutable std::mutex mutex_;
+  // (chunk start, chunk size)
+  std::vector<std::pair<uint8_t*, int64_t>> chunks_;
+  int64_t total_bytes_;
+  uint8_t* avail_buf_;
+  int64_t avail_bytes_;
+  // Start of the most recent allocation, which may be resized in place
+  uint8_t* last_alloc_;
+  internal::MemoryPoolStats stats_;
+};
+
+ScopedArenaPool::ScopedArenaPool(MemoryPool* pool, int64_t min_chunk_size) {
+  impl_.reset(new ScopedArenaPoolImpl(pool, min_chunk_size));
+}
+
+ScopedArenaPool::~ScopedArenaPool() {}
+
+Status ScopedArenaPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status ScopedArenaPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void ScopedArenaPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t ScopedArenaPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t ScopedArenaPool::max_memory() const { return impl_->max_memory(); }
+
+void ScopedArenaPool::Reset() { impl_->Reset(); }
+
+int64_t ScopedArenaPool::total_bytes() const { return impl_->total_bytes(); }
+
+///////////////////////////////////////////////////////////////////////
+// NumaMemoryPool implementation
+
+constexpr int NumaMemoryPoolOptions::kAnyNode;
+constexpr int NumaMemoryPoolOptions::kCallerNode;
+
+NumaMemoryPoolOptions NumaMemoryPoolOptions::Defaults() {
+  return NumaMemoryPoolOptions();
+}
+
+class NumaMemoryPool::NumaMemoryPoolImpl {
+ public:
+  explicit NumaMemoryPoolImpl(const NumaMemoryPoolOptions& options)
+      : options_(options) {
+#ifdef ARROW_HAVE_PAGE_MAPPING_POOL
+    const int64_t page_size = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+    page_size_ = (options_.explicit_huge_pages || options_.transparent_huge_pages)
+                     ? std::max(page_size, kHugePageSize)
+                     : page_size;
+#endif
+  }
+
+  Status Allocate(int64_t size, uint8_t** out) {
+    if (IsLarge(size)) {
+      RETURN_NOT_OK(AllocateLarge(size, out));
+    } else {
+      RETURN_NOT_OK(AllocateAligned(size, out));
+    }
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+    if (!IsLarge(old_size) && !IsLarge(new_size)) {
+      RETURN_NOT_OK(ReallocateAligned(old_size, new_size, ptr));
+    } else if (MappingSize(old_size) != MappingSize(new_size)) {
+#ifdef ARROW_HAVE_PAGE_MAPPING_POOL
+      if (IsLarge(old_size) && IsLarge(new_size) &&
+          new_size <= std::numeric_limits<int64_t>::max() - page_size_ &&
+          RemapAnonymous(MappingSize(old_size), MappingSize(new_size), ptr).ok()) {
+        // The mapping's memory policy moves along with it
+        stats_.UpdateAllocatedBytes(new_size - old_size);
+        return Status::OK();
+      }
+#endif
+      uint8_t* out = nullptr;
+      if (IsLarge(new_size)) {
+        RETURN_NOT_OK(AllocateLarge(new_size, &out));
+      } else {
+        RETURN_NOT_OK(AllocateAligned(new_size, &out));
+      }
+      memcpy(out, *ptr, static_cast<size_t>(std::min(new_size, old_size)));
+      FreeUntracked(*ptr, old_size);
+      *ptr = out;
+    }
+    // Otherwise, the existing mapping is large enough
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size) {
+    FreeUntracked(buffer, size);
+    stats_.UpdateAllocatedBytes(-size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  const NumaMemoryPoolOptions& options() const { return options_; }
+
+ private:
+  bool IsLarge(int64_t size) const {
+#ifdef ARROW_HAVE_PAGE_MAPPING_POOL
+    return size > 0 && size >= options_.large_allocation_threshold;
+#else
+    return false;
+#endif
+  }
+
+  // The size of the page mapping backing an allocation, or 0 if it is not large
+  int64_t MappingSize(int64_t size) const {
+    return IsLarge(size) ? BitUtil::RoundUp(size, page_size_) : 0;
+  }
+
+  Status AllocateLarge(int64_t size, uint8_t** out) {
+#ifdef ARROW_HAVE_PAGE_MAPPING_POOL
+    if (size > std::numeric_limits<int64_t>::max() - page_size_ - kHugePageSize) {
+      return Status::OutOfMemory("mmap of size ", size, " failed");
+    }
+    return MapPages(options_, MappingSize(size), out);
+#else
+    return Status::NotImplemented("page mappings not supported on this platform");
+#endif
+  }
+
+  void FreeUntracked(uint8_t* buffer, int64_t size) {
+#ifdef ARROW_HAVE_PAGE_MAPPING_POOL
+    if (IsLarge(size)) {
+      munmap(buffer, static_cast<size_t>(MappingSize(size)));
+      return;
+    }
+#endif
+    DeallocateAligned(buffer, size);
+  }
+
+  const NumaMemoryPoolOptions options_;
+  int64_t page_size_ = 1;
+  internal::MemoryPoolStats stats_;
+};
+
+NumaMemoryPool::NumaMemoryPool(const NumaMemoryPoolOptions& options) {
+  impl_.reset(new NumaMemoryPoolImpl(options));
+}
+
+NumaMemoryPool::~NumaMemoryPool() {}
+
+Status NumaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  return impl_->Allocate(size, out);
+}
+
+Status NumaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, ptr);
+}
+
+void NumaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  return impl_->Free(buffer, size);
+}
+
+int64_t NumaMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t NumaMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+const NumaMemoryPoolOptions& NumaMemoryPool::options() const { return impl_->options(); }
+
 }  // namespace arrow
@@ -21,6 +21,8 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "arrow/util/visibility.h"
 
@@ -142,6 +144,209 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief A MemoryPool attributing allocations to named tags, with limits
+///
+/// Allocations are attributed to a tag by going through the pool returned
+/// by GetTaggedPool(), e.g. by passing it to a CSV reader or a Parquet
+/// decoder.  Current and peak allocated bytes are tracked both per tag and for
+/// the pool as a whole (which includes allocations made directly on it).
+///
+/// Each tag, and the pool as a whole, can be given limits.  An allocation that
+/// would exceed a hard limit fails early with Status::OutOfMemory, without
+/// reaching the underlying pool.  Soft limits never fail allocations; callers
+/// can check ExceedsSoftLimit() to back off (e.g. reduce parallelism or
+/// spill) before a hard limit is hit.  A negative limit means no limit.
+class ARROW_EXPORT TrackingMemoryPool : public MemoryPool {
+ public:
+  struct TagStats {
+    int64_t bytes_allocated;
+    int64_t max_memory;
+    int64_t soft_limit;
+    int64_t hard_limit;
+  };
+
+  explicit TrackingMemoryPool(MemoryPool* pool, int64_t soft_limit = -1,
+                              int64_t hard_limit = -1);
+  ~TrackingMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief Return a pool attributing its allocations to the given tag
+  ///
+  /// The tagged pool is created on first use and lives as long as this pool.
+  MemoryPool* GetTaggedPool(const std::string& tag);
+
+  /// \brief Set the limits for the given tag
+  void SetTagLimits(const std::string& tag, int64_t soft_limit, int64_t hard_limit);
+
+  /// \brief Return the statistics for the given tag
+  Status GetTagStats(const std::string& tag, TagStats* out) const;
+
+  /// \brief Return the names of all tags, in sorted order
+  std::vector<std::string> tags() const;
+
+  /// \brief Whether the pool as a whole is above its soft limit
+  bool ExceedsSoftLimit() const;
+
+  /// \brief Whether the given tag is above its soft limit
+  bool ExceedsSoftLimit(const std::string& tag) const;
+
+ private:
+  class TrackingMemoryPoolImpl;
+  std::unique_ptr<TrackingMemoryPoolImpl> impl_;
+};
+
+/// \brief A MemoryPool caching small allocations in per-thread size classes
+///
+/// Allocations of at most kMaxCachedSize bytes are rounded up to a
+/// power-of-two size class (a multiple of the 64-byte alignment) and, once
+/// freed, kept in a free list owned by the freeing thread's cache instead of
+/// being returned to the underlying pool.  Subsequent allocations of the same
+/// class from that thread are served from the free list without taking a
+/// global lock.  Larger allocations are delegated to the underlying pool.
+///
+/// Threads are mapped onto a fixed number of caches, so that a cache is
+/// only shared when there are more threads than caches.
+class ARROW_EXPORT ArenaMemoryPool : public MemoryPool {
+ public:
+  /// Allocations above this size bypass the size-class caches
+  static constexpr int64_t kMaxCachedSize = 32 * 1024;
+
+  /// \brief Create a pool caching blocks allocated from the given pool
+  ///
+  /// \param[in] pool the underlying pool
+  /// \param[in] num_caches number of thread caches; by default, twice the
+  ///   hardware concurrency
+  /// \param[in] max_cached_bytes_per_cache upper bound on the number of
+  ///   bytes kept in the free lists of a single thread cache
+  explicit ArenaMemoryPool(MemoryPool* pool, int num_caches = 0,
+                           int64_t max_cached_bytes_per_cache = 1 << 20);
+  ~ArenaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  /// The number of bytes requested by callers and not yet free'd.  Bytes
+  /// held in the thread caches are not included.
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// The number of bytes currently held in the thread caches
+  int64_t bytes_cached() const;
+
+  /// Return all cached blocks to the underlying pool
+  void ReleaseCached();
+
+ private:
+  class ArenaMemoryPoolImpl;
+  std::unique_ptr<ArenaMemoryPoolImpl> impl_;
+};
+
+/// \brief A bump-pointer MemoryPool for short-lived temporary allocations
+///
+/// Memory is obtained from the underlying pool in chunks of at least
+/// min_chunk_size bytes and handed out sequentially.  Free() does not return
+/// memory; instead, all allocations are released at once by Reset() or when
+/// the pool is destroyed.  This makes it suitable for temporaries scoped to
+/// the processing of a single record batch, e.g. as the pool of a
+/// compute::FunctionContext or the pool passed to gandiva::Projector::Evaluate.
+///
+/// Reallocating the most recent allocation grows it in place when the current
+/// chunk has room left.
+class ARROW_EXPORT ScopedArenaPool : public MemoryPool {
+ public:
+  explicit ScopedArenaPool(MemoryPool* pool, int64_t min_chunk_size = 1 << 20);
+  ~ScopedArenaPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  /// Only updates the allocation statistics: the memory itself is reclaimed
+  /// by Reset().
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  /// \brief Release all allocations made from this pool
+  ///
+  /// The first chunk is retained for reuse, so that a steady-state workload
+  /// performs a single allocation from the underlying pool per scope.
+  /// All memory handed out by this pool becomes invalid.
+  void Reset();
+
+  /// The number of bytes obtained from the underlying pool
+  int64_t total_bytes() const;
+
+ private:
+  class ScopedArenaPoolImpl;
+  std::unique_ptr<ScopedArenaPoolImpl> impl_;
+};
+
+struct ARROW_EXPORT NumaMemoryPoolOptions {
+  /// Special values for `numa_node`
+  static constexpr int kAnyNode = -1;
+  static constexpr int kCallerNode = -2;
+
+  // Allocations of at least this many bytes get their own page mapping;
+  // smaller allocations are served like in the default memory pool
+  int64_t large_allocation_threshold = 2 * 1024 * 1024;
+  // Whether to advise the kernel to back large mappings with transparent
+  // huge pages
+  bool transparent_huge_pages = true;
+  // Whether to request explicit huge pages (from the hugetlbfs reserve) for
+  // large mappings.  Falls back to regular pages if none are available.
+  bool explicit_huge_pages = false;
+  // The NUMA node large mappings are placed on: a node number, kAnyNode to
+  // keep the system policy, or kCallerNode for the node of the allocating thread
+  int numa_node = kAnyNode;
+  // If true, large mappings may only use pages from `numa_node`, otherwise the
+  // node is merely preferred
+  bool strict_numa_binding = false;
+
+  static NumaMemoryPoolOptions Defaults();
+};
+
+/// \brief A MemoryPool placing large allocations on huge pages and NUMA nodes
+///
+/// Large allocations are served from anonymous memory mappings, which can be
+/// backed by transparent or explicit huge pages to reduce TLB misses, and bound
+/// to a NUMA node to avoid remote memory accesses.  Page placement settings
+/// are best-effort: they are silently ignored if the system doesn't support
+/// them.  On non-Linux platforms, this behaves like the default memory pool.
+class ARROW_EXPORT NumaMemoryPool : public MemoryPool {
+ public:
+  explicit NumaMemoryPool(
+      const NumaMemoryPoolOptions& options = NumaMemoryPoolOptions::Defaults());
+  ~NumaMemoryPool() override;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  const NumaMemoryPoolOptions& options() const;
+
+ private:
+  class NumaMemoryPoolImpl;
+  std::unique_ptr<NumaMemoryPoolImpl> impl_;
+};
+
 /// Return the process-wide default memory pool.
 ARROW_EXPORT MemoryPool* default_memory_pool();
 
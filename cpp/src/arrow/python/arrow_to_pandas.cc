@@ -21,8 +21,10 @@
 
 #include "arrow/python/arrow_to_pandas.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -41,6 +43,7 @@
 #include "arrow/util/macros.h"
 #include "arrow/util/parallel.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/utf8.h"
 #include "arrow/visitor_inline.h"
 
 #include "arrow/compute/api.h"
@@ -277,6 +280,58 @@ class PandasBlock {
     return Status::OK();
   }
 
+  // Make the block a view of the values of an Arrow array rather than
+  // allocating it. The block keeps the array alive
+  Status WrapNDArray(int npy_type, int ndim, const std::shared_ptr<Array>& arr,
+                     void* data) {
+    PyAcquireGIL lock;
+
+    PyArray_Descr* descr = GetSafeNumPyDtype(npy_type);
+    RETURN_IF_PYERROR();
+    set_numpy_metadata(npy_type, arr->type().get(), descr);
+
+    PyObject* block_arr;
+    if (ndim == 2) {
+      npy_intp block_dims[2] = {num_columns_, num_rows_};
+      block_arr = PyArray_NewFromDescr(&PyArray_Type, descr, 2, block_dims, nullptr,
+                                       data, NPY_ARRAY_CARRAY, nullptr);
+    } else {
+      npy_intp block_dims[1] = {num_rows_};
+      block_arr = PyArray_NewFromDescr(&PyArray_Type, descr, 1, block_dims, nullptr,
+                                       data, NPY_ARRAY_CARRAY, nullptr);
+    }
+    RETURN_IF_PYERROR();
+    block_arr_.reset(block_arr);
+
+    // Add a reference to the underlying Array. Otherwise the array may be
+    // deleted once we leave the block conversion.
+    auto capsule = new ArrowCapsule{{arr}};
+    PyObject* base = PyCapsule_New(reinterpret_cast<void*>(capsule), "arrow",
+                                   &ArrowCapsule_Destructor);
+    if (base == nullptr) {
+      delete capsule;
+      RETURN_IF_PYERROR();
+    }
+
+    if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(block_arr), base) == -1) {
+      Py_XDECREF(base);
+      RETURN_IF_PYERROR();
+    }
+
+    npy_intp placement_dims[1] = {num_columns_};
+    PyObject* placement_arr = PyArray_SimpleNew(1, placement_dims, NPY_INT64);
+    RETURN_IF_PYERROR();
+    placement_arr_.reset(placement_arr);
+
+    block_data_ = reinterpret_cast<uint8_t*>(
+        PyArray_DATA(reinterpret_cast<PyArrayObject*>(block_arr)));
+
+    placement_data_ = reinterpret_cast<int64_t*>(
+        PyArray_DATA(reinterpret_cast<PyArrayObject*>(placement_arr)));
+
+    return Status::OK();
+  }
+
   int64_t num_rows_;
   int num_columns_;
 
@@ -377,12 +432,12 @@ static void ConvertBooleanNoNulls(const PandasOptions& options, const ChunkedArr
 }
 
 // Generic Array -> PyObject** converter that handles object deduplication, if
-// requested
+// requested. Writes the values in [offset, offset + length)
 template <typename ArrayType, typename WriteValue>
-inline Status WriteArrayObjects(const ArrayType& arr, WriteValue&& write_func,
-                                PyObject** out_values) {
+inline Status WriteArrayObjects(const ArrayType& arr, int64_t offset, int64_t length,
+                                WriteValue&& write_func, PyObject** out_values) {
   const bool has_nulls = arr.null_count() > 0;
-  for (int64_t i = 0; i < arr.length(); ++i) {
+  for (int64_t i = offset; i < offset + length; ++i) {
     if (has_nulls && arr.IsNull(i)) {
       Py_INCREF(Py_None);
       *out_values = Py_None;
@@ -406,13 +461,19 @@ struct MemoizationTraits<T, enable_if_binary_like<T>> {
   using Scalar = util::string_view;
 };
 
-template <typename Type, typename WrapFunction>
+// The number of objects created each time the GIL is taken. It is released in
+// between, so that the columns converted by other threads proceed meanwhile
+constexpr int64_t kObjectBatchSize = 1 << 14;
+
+// Converts each batch of values by first calling prepare_func(arr, offset,
+// length) without the GIL, then wrap_func on each value with it
+template <typename Type, typename WrapFunction, typename PrepareFunction>
 inline Status ConvertAsPyObjects(const PandasOptions& options, const ChunkedArray& data,
-                                 WrapFunction&& wrap_func, PyObject** out_values) {
+                                 WrapFunction&& wrap_func, PrepareFunction&& prepare_func,
+                                 PyObject** out_values) {
   using ArrayType = typename TypeTraits<Type>::ArrayType;
   using Scalar = typename MemoizationTraits<Type>::Scalar;
 
-  PyAcquireGIL lock;
   ::arrow::internal::ScalarMemoTable<Scalar> memo_table;
   std::vector<PyObject*> unique_values;
   int32_t memo_size = 0;
@@ -438,16 +499,32 @@ inline Status ConvertAsPyObjects(const PandasOptions& options, const ChunkedArra
 
   for (int c = 0; c < data.num_chunks(); c++) {
     const auto& arr = checked_cast<const ArrayType&>(*data.chunk(c));
-    if (options.deduplicate_objects) {
-      RETURN_NOT_OK(WriteArrayObjects(arr, WrapMemoized, out_values));
-    } else {
-      RETURN_NOT_OK(WriteArrayObjects(arr, WrapUnmemoized, out_values));
+    for (int64_t offset = 0; offset < arr.length(); offset += kObjectBatchSize) {
+      const int64_t length = std::min(kObjectBatchSize, arr.length() - offset);
+      prepare_func(arr, offset, length);
+
+      PyAcquireGIL lock;
+      if (options.deduplicate_objects) {
+        RETURN_NOT_OK(WriteArrayObjects(arr, offset, length, WrapMemoized, out_values));
+      } else {
+        RETURN_NOT_OK(
+            WriteArrayObjects(arr, offset, length, WrapUnmemoized, out_values));
+      }
+      out_values += length;
     }
-    out_values += arr.length();
   }
   return Status::OK();
 }
 
+template <typename Type, typename WrapFunction>
+inline Status ConvertAsPyObjects(const PandasOptions& options, const ChunkedArray& data,
+                                 WrapFunction&& wrap_func, PyObject** out_values) {
+  using ArrayType = typename TypeTraits<Type>::ArrayType;
+  auto NoPrepare = [](const ArrayType& arr, int64_t offset, int64_t length) {};
+  return ConvertAsPyObjects<Type>(options, data, std::forward<WrapFunction>(wrap_func),
+                                  NoPrepare, out_values);
+}
+
 template <typename Type>
 static Status ConvertIntegerObjects(const PandasOptions& options,
                                     const ChunkedArray& data, PyObject** out_values) {
@@ -475,6 +552,44 @@ inline Status ConvertBinaryLike(const PandasOptions& options, const ChunkedArray
   return ConvertAsPyObjects<Type>(options, data, WrapValue, out_values);
 }
 
+#if PY_MAJOR_VERSION >= 3
+
+// Most strings are ASCII, whose str objects can be filled with a copy of the
+// bytes rather than by decoding them. Each batch is checked for non-ASCII
+// characters without holding the GIL
+template <>
+inline Status ConvertBinaryLike<StringType>(const PandasOptions& options,
+                                            const ChunkedArray& data,
+                                            PyObject** out_values) {
+  bool batch_is_ascii = false;
+  auto CheckAscii = [&batch_is_ascii](const StringArray& arr, int64_t offset,
+                                      int64_t length) {
+    const int32_t start = arr.value_offset(offset);
+    const int32_t end = arr.value_offset(offset + length);
+    batch_is_ascii = arr.value_data() == nullptr ||
+                     util::ValidateAscii(arr.value_data()->data() + start, end - start);
+  };
+  auto WrapValue = [&batch_is_ascii](const util::string_view& view, PyObject** out) {
+    if (batch_is_ascii) {
+      *out = PyUnicode_New(static_cast<Py_ssize_t>(view.length()), 127);
+      if (*out != nullptr) {
+        memcpy(PyUnicode_DATA(*out), view.data(), view.length());
+      }
+    } else {
+      *out = WrapBytes<StringType>::Wrap(view.data(), view.length());
+    }
+    if (*out == nullptr) {
+      PyErr_Clear();
+      return Status::UnknownError("Wrapping ", view, " failed");
+    }
+    return Status::OK();
+  };
+  return ConvertAsPyObjects<StringType>(options, data, WrapValue, CheckAscii,
+                                        out_values);
+}
+
+#endif
+
 inline Status ConvertNulls(const PandasOptions& options, const ChunkedArray& data,
                            PyObject** out_values) {
   PyAcquireGIL lock;
@@ -1210,59 +1325,48 @@ class CategoricalBlock : public PandasBlock {
   template <typename T>
   Status AllocateNDArrayFromIndices(int npy_type,
                                     const std::shared_ptr<PrimitiveArray>& indices) {
-    npy_intp block_dims[1] = {num_rows_};
-
     const T* in_values = GetPrimitiveValues<T>(*indices);
-    void* data = const_cast<T*>(in_values);
-
-    PyAcquireGIL lock;
+    return WrapNDArray(npy_type, 1, indices, const_cast<T*>(in_values));
+  }
 
-    PyArray_Descr* descr = GetSafeNumPyDtype(npy_type);
-    if (descr == nullptr) {
-      // Error occurred, trust error state is set
-      return Status::OK();
-    }
+  MemoryPool* pool_;
+  OwnedRefNoGIL dictionary_;
+  bool ordered_;
+  bool needs_copy_;
+};
 
-    PyObject* block_arr = PyArray_NewFromDescr(&PyArray_Type, descr, 1, block_dims,
-                                               nullptr, data, NPY_ARRAY_CARRAY, nullptr);
-    RETURN_IF_PYERROR();
+// A block of a single column which is a read-only view of its Arrow memory,
+// for columns split into their own blocks that need no conversion
+class ZeroCopyBlock : public PandasBlock {
+ public:
+  ZeroCopyBlock(const PandasOptions& options, int npy_type, int64_t num_rows)
+      : PandasBlock(options, num_rows, 1), npy_type_(npy_type) {}
 
-    // Add a reference to the underlying Array. Otherwise the array may be
-    // deleted once we leave the block conversion.
-    auto capsule = new ArrowCapsule{{indices}};
-    PyObject* base = PyCapsule_New(reinterpret_cast<void*>(capsule), "arrow",
-                                   &ArrowCapsule_Destructor);
-    if (base == nullptr) {
-      delete capsule;
-      RETURN_IF_PYERROR();
-    }
+  Status Allocate() override {
+    return Status::NotImplemented("ZeroCopyBlock allocation happens when calling Write");
+  }
 
-    if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(block_arr), base) == -1) {
-      // Error occurred, trust that SetBaseObject set the error state
-      Py_XDECREF(base);
-      return Status::OK();
+  Status Write(const std::shared_ptr<Column>& col, int64_t abs_placement,
+               int64_t rel_placement) override {
+    const std::shared_ptr<Array> arr = col->data()->chunk(0);
+    const auto& prim_arr = checked_cast<const PrimitiveArray&>(*arr);
+    const int byte_width =
+        checked_cast<const FixedWidthType&>(*arr->type()).bit_width() / 8;
+    const uint8_t* in_values = prim_arr.values()->data() + arr->offset() * byte_width;
+
+    RETURN_NOT_OK(WrapNDArray(npy_type_, 2, arr, const_cast<uint8_t*>(in_values)));
+    {
+      PyAcquireGIL lock;
+      // Arrow data is immutable.
+      PyArray_CLEARFLAGS(reinterpret_cast<PyArrayObject*>(block_arr_.obj()),
+                         NPY_ARRAY_WRITEABLE);
     }
-
-    npy_intp placement_dims[1] = {num_columns_};
-    PyObject* placement_arr = PyArray_SimpleNew(1, placement_dims, NPY_INT64);
-    RETURN_IF_PYERROR();
-
-    block_arr_.reset(block_arr);
-    placement_arr_.reset(placement_arr);
-
-    block_data_ = reinterpret_cast<uint8_t*>(
-        PyArray_DATA(reinterpret_cast<PyArrayObject*>(block_arr)));
-
-    placement_data_ = reinterpret_cast<int64_t*>(
-        PyArray_DATA(reinterpret_cast<PyArrayObject*>(placement_arr)));
-
+    placement_data_[rel_placement] = abs_placement;
     return Status::OK();
   }
 
-  MemoryPool* pool_;
-  OwnedRefNoGIL dictionary_;
-  bool ordered_;
-  bool needs_copy_;
+ private:
+  int npy_type_;
 };
 
 Status MakeBlock(const PandasOptions& options, PandasBlock::type type, int64_t num_rows,
@@ -1381,6 +1485,46 @@ static Status GetPandasBlockType(const Column& col, const PandasOptions& options
   return Status::OK();
 }
 
+// Whether a column of a block type can be a ZeroCopyBlock, whose NumPy type
+// is then returned
+static bool GetZeroCopyType(const Column& col, PandasBlock::type block_type,
+                            int* npy_type) {
+  if (col.data()->num_chunks() != 1 || col.null_count() > 0 || col.length() == 0) {
+    return false;
+  }
+
+#define NUMPY_TYPE_CASE(NAME, NPY_NAME) \
+  case PandasBlock::NAME:               \
+    *npy_type = NPY_NAME;               \
+    return true;
+
+  // Without nulls, columns of these block types have the same memory layout
+  switch (block_type) {
+    NUMPY_TYPE_CASE(UINT8, NPY_UINT8);
+    NUMPY_TYPE_CASE(INT8, NPY_INT8);
+    NUMPY_TYPE_CASE(UINT16, NPY_UINT16);
+    NUMPY_TYPE_CASE(INT16, NPY_INT16);
+    NUMPY_TYPE_CASE(UINT32, NPY_UINT32);
+    NUMPY_TYPE_CASE(INT32, NPY_INT32);
+    NUMPY_TYPE_CASE(UINT64, NPY_UINT64);
+    NUMPY_TYPE_CASE(INT64, NPY_INT64);
+    NUMPY_TYPE_CASE(HALF_FLOAT, NPY_FLOAT16);
+    NUMPY_TYPE_CASE(FLOAT, NPY_FLOAT32);
+    NUMPY_TYPE_CASE(DOUBLE, NPY_FLOAT64);
+    case PandasBlock::DATETIME:
+      if (col.type()->id() == Type::TIMESTAMP &&
+          checked_cast<const TimestampType&>(*col.type()).unit() == TimeUnit::NANO) {
+        *npy_type = NPY_DATETIME;
+        return true;
+      }
+      return false;
+    default:
+      return false;
+  }
+
+#undef NUMPY_TYPE_CASE
+}
+
 // Construct the exact pandas 0.x "BlockManager" memory layout
 //
 // * For each column determine the correct output pandas type
@@ -1388,6 +1532,9 @@ static Status GetPandasBlockType(const Column& col, const PandasOptions& options
 // * Allocate  block placement arrays
 // * Write Arrow columns out into each slice of memory; populate block
 // * placement arrays as we go
+//
+// With split_blocks, each column gets its own block instead, which is a view of
+// the Arrow memory when possible
 class DataFrameBlockCreator {
  public:
   explicit DataFrameBlockCreator(const PandasOptions& options,
@@ -1399,6 +1546,7 @@ class DataFrameBlockCreator {
     column_block_placement_.resize(table_->num_columns());
     type_counts_.clear();
     blocks_.clear();
+    split_blocks_.clear();
 
     RETURN_NOT_OK(CreateBlocks());
     RETURN_NOT_OK(WriteTableToBlocks());
@@ -1423,6 +1571,15 @@ class DataFrameBlockCreator {
                                                   table_->num_rows());
         RETURN_NOT_OK(block->Allocate());
         datetimetz_blocks_[i] = block;
+      } else if (options_.split_blocks) {
+        int npy_type;
+        if (GetZeroCopyType(*col, output_type, &npy_type)) {
+          block = std::make_shared<ZeroCopyBlock>(options_, npy_type, table_->num_rows());
+        } else {
+          RETURN_NOT_OK(
+              MakeBlock(options_, output_type, table_->num_rows(), 1, &block));
+        }
+        split_blocks_[i] = block;
       } else {
         auto it = type_counts_.find(output_type);
         if (it != type_counts_.end()) {
@@ -1452,7 +1609,10 @@ class DataFrameBlockCreator {
   Status GetBlock(int i, std::shared_ptr<PandasBlock>* block) {
     PandasBlock::type output_type = this->column_types_[i];
 
-    if (output_type == PandasBlock::CATEGORICAL) {
+    auto split_it = this->split_blocks_.find(i);
+    if (split_it != this->split_blocks_.end()) {
+      *block = split_it->second;
+    } else if (output_type == PandasBlock::CATEGORICAL) {
       auto it = this->categorical_blocks_.find(i);
       if (it == this->blocks_.end()) {
         return Status::KeyError("No categorical block allocated");
@@ -1514,6 +1674,7 @@ class DataFrameBlockCreator {
     RETURN_NOT_OK(AppendBlocks(blocks_, result));
     RETURN_NOT_OK(AppendBlocks(categorical_blocks_, result));
     RETURN_NOT_OK(AppendBlocks(datetimetz_blocks_, result));
+    RETURN_NOT_OK(AppendBlocks(split_blocks_, result));
 
     *out = result;
     return Status::OK();
@@ -1544,6 +1705,9 @@ class DataFrameBlockCreator {
 
   // column number -> datetimetz block
   BlockMap datetimetz_blocks_;
+
+  // column number -> block of its own, with split_blocks
+  BlockMap split_blocks_;
 };
 
 class ArrowDeserializer {
@@ -53,6 +53,12 @@ struct PandasOptions {
   /// objects. This only applies to immutable objects like strings or datetime
   /// objects
   bool deduplicate_objects = false;
+
+  /// \brief If true, give each column of a table its own block rather than
+  /// consolidating the columns of a type into one 2D block. The numeric and
+  /// timestamp[ns] columns of one chunk without nulls are then not copied,
+  /// but viewed as read-only arrays
+  bool split_blocks = false;
 };
 
 ARROW_PYTHON_EXPORT
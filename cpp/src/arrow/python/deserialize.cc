@@ -339,45 +339,29 @@ Status DeserializeObject(PyObject* context, const SerializedPyObject& obj, PyObj
 }
 
 Status GetSerializedFromComponents(int num_tensors, int num_ndarrays, int num_buffers,
-                                   PyObject* data, SerializedPyObject* out) {
-  PyAcquireGIL gil;
-  const Py_ssize_t data_length = PyList_Size(data);
-  RETURN_IF_PYERROR();
-
-  const Py_ssize_t expected_data_length =
+                                   const std::vector<std::shared_ptr<Buffer>>& data,
+                                   SerializedPyObject* out) {
+  const size_t expected_data_length =
       1 + num_tensors * 2 + num_ndarrays * 2 + num_buffers;
-  if (data_length != expected_data_length) {
+  if (data.size() != expected_data_length) {
     return Status::Invalid("Invalid number of buffers in data");
   }
 
-  auto GetBuffer = [&data](Py_ssize_t index, std::shared_ptr<Buffer>* out) {
-    PyObject* py_buf = PyList_GET_ITEM(data, index);
-    return unwrap_buffer(py_buf, out);
-  };
-
-  Py_ssize_t buffer_index = 0;
+  size_t buffer_index = 0;
 
   // Read the union batch describing object structure
   {
-    std::shared_ptr<Buffer> data_buffer;
-    RETURN_NOT_OK(GetBuffer(buffer_index++, &data_buffer));
-    gil.release();
-    io::BufferReader buf_reader(data_buffer);
+    io::BufferReader buf_reader(data[buffer_index++]);
     std::shared_ptr<RecordBatchReader> reader;
     RETURN_NOT_OK(ipc::RecordBatchStreamReader::Open(&buf_reader, &reader));
     RETURN_NOT_OK(reader->ReadNext(&out->batch));
-    gil.acquire();
   }
 
   // Zero-copy reconstruct tensors
   for (int i = 0; i < num_tensors; ++i) {
-    std::shared_ptr<Buffer> metadata;
-    std::shared_ptr<Buffer> body;
     std::shared_ptr<Tensor> tensor;
-    RETURN_NOT_OK(GetBuffer(buffer_index++, &metadata));
-    RETURN_NOT_OK(GetBuffer(buffer_index++, &body));
-
-    ipc::Message message(metadata, body);
+    ipc::Message message(data[buffer_index], data[buffer_index + 1]);
+    buffer_index += 2;
 
     RETURN_NOT_OK(ipc::ReadTensor(message, &tensor));
     out->tensors.emplace_back(std::move(tensor));
@@ -385,28 +369,40 @@ Status GetSerializedFromComponents(int num_tensors, int num_ndarrays, int num_bu
 
   // Zero-copy reconstruct tensors for numpy ndarrays
   for (int i = 0; i < num_ndarrays; ++i) {
-    std::shared_ptr<Buffer> metadata;
-    std::shared_ptr<Buffer> body;
     std::shared_ptr<Tensor> tensor;
-    RETURN_NOT_OK(GetBuffer(buffer_index++, &metadata));
-    RETURN_NOT_OK(GetBuffer(buffer_index++, &body));
-
-    ipc::Message message(metadata, body);
+    ipc::Message message(data[buffer_index], data[buffer_index + 1]);
+    buffer_index += 2;
 
     RETURN_NOT_OK(ipc::ReadTensor(message, &tensor));
     out->ndarrays.emplace_back(std::move(tensor));
   }
 
-  // Unwrap and append buffers
+  // Append buffers
   for (int i = 0; i < num_buffers; ++i) {
-    std::shared_ptr<Buffer> buffer;
-    RETURN_NOT_OK(GetBuffer(buffer_index++, &buffer));
-    out->buffers.emplace_back(std::move(buffer));
+    out->buffers.push_back(data[buffer_index++]);
   }
 
   return Status::OK();
 }
 
+Status GetSerializedFromComponents(int num_tensors, int num_ndarrays, int num_buffers,
+                                   PyObject* data, SerializedPyObject* out) {
+  std::vector<std::shared_ptr<Buffer>> components;
+  {
+    PyAcquireGIL gil;
+    const Py_ssize_t data_length = PyList_Size(data);
+    RETURN_IF_PYERROR();
+
+    for (Py_ssize_t i = 0; i < data_length; ++i) {
+      std::shared_ptr<Buffer> buffer;
+      RETURN_NOT_OK(unwrap_buffer(PyList_GET_ITEM(data, i), &buffer));
+      components.push_back(std::move(buffer));
+    }
+  }
+  return GetSerializedFromComponents(num_tensors, num_ndarrays, num_buffers, components,
+                                     out);
+}
+
 Status DeserializeNdarray(const SerializedPyObject& object,
                           std::shared_ptr<Tensor>* out) {
   if (object.ndarrays.size() != 1) {
@@ -28,6 +28,7 @@
 
 namespace arrow {
 
+class Buffer;
 class RecordBatch;
 class Tensor;
 
@@ -60,6 +61,22 @@ ARROW_PYTHON_EXPORT
 Status GetSerializedFromComponents(int num_tensors, int num_ndarrays, int num_buffers,
                                    PyObject* data, SerializedPyObject* out);
 
+/// \brief Reconstruct SerializedPyObject from the components produced by
+/// SerializedPyObject::GetComponents, without copying them. Does not need
+/// the GIL
+///
+/// \param[in] num_tensors number of tensors in the object
+/// \param[in] num_ndarrays number of numpy Ndarrays in the object
+/// \param[in] num_buffers number of buffers in the object
+/// \param[in] data the components. Must be 1 + num_tensors * 2 +
+/// num_ndarrays * 2 + num_buffers in length
+/// \param[out] out the reconstructed object
+/// \return Status
+ARROW_PYTHON_EXPORT
+Status GetSerializedFromComponents(int num_tensors, int num_ndarrays, int num_buffers,
+                                   const std::vector<std::shared_ptr<Buffer>>& data,
+                                   SerializedPyObject* out);
+
 /// \brief Reconstruct Python object from Arrow-serialized representation
 /// \param[in] context Serialization context which contains custom serialization
 /// and deserialization callbacks. Can be any Python object with a
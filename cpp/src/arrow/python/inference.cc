@@ -368,6 +368,18 @@ class TypeInferrer {
     });
   }
 
+  // Infer value type from the first values of a sequence
+  Status VisitSequence(PyObject* obj, int64_t max_values) {
+    return internal::VisitSequence(
+        obj, [this, max_values](PyObject* value, bool* keep_going) -> Status {
+          RETURN_NOT_OK(Visit(value, keep_going));
+          if (total_count_ >= max_values) {
+            *keep_going = false;
+          }
+          return Status::OK();
+        });
+  }
+
   Status GetType(std::shared_ptr<DataType>* out) const {
     // TODO(wesm): handling forming unions
     if (make_unions_) {
@@ -561,6 +573,19 @@ Status InferArrowType(PyObject* obj, std::shared_ptr<DataType>* out_type) {
   return Status::OK();
 }
 
+Status InferArrowTypeFromSample(PyObject* obj, int64_t sample_size,
+                                std::shared_ptr<DataType>* out_type) {
+  PyDateTime_IMPORT;
+  TypeInferrer inferrer;
+  RETURN_NOT_OK(inferrer.VisitSequence(obj, sample_size));
+  RETURN_NOT_OK(inferrer.GetType(out_type));
+  if (*out_type == nullptr) {
+    return Status::TypeError("Unable to determine data type");
+  }
+
+  return Status::OK();
+}
+
 Status InferArrowTypeAndSize(PyObject* obj, int64_t* size,
                              std::shared_ptr<DataType>* out_type) {
   if (!PySequence_Check(obj)) {
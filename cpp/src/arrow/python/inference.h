@@ -40,10 +40,15 @@ class Status;
 
 namespace py {
 
-// These three functions take a sequence input, not arbitrary iterables
+// These functions take a sequence input, not arbitrary iterables
 ARROW_PYTHON_EXPORT
 arrow::Status InferArrowType(PyObject* obj, std::shared_ptr<arrow::DataType>* out_type);
 
+/// Like InferArrowType, looking only at the first sample_size values
+ARROW_PYTHON_EXPORT
+arrow::Status InferArrowTypeFromSample(PyObject* obj, int64_t sample_size,
+                                       std::shared_ptr<arrow::DataType>* out_type);
+
 ARROW_PYTHON_EXPORT
 arrow::Status InferArrowTypeAndSize(PyObject* obj, int64_t* size,
                                     std::shared_ptr<arrow::DataType>* out_type);
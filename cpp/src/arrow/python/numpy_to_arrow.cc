@@ -43,6 +43,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string.h"
+#include "arrow/util/string_view.h"
 #include "arrow/util/utf8.h"
 #include "arrow/visitor_inline.h"
 
@@ -545,7 +546,7 @@ inline Status NumPyConverter::ConvertData<Date64Type>(std::shared_ptr<Buffer>* d
 constexpr int32_t kBinaryChunksize = 1 << 24;
 
 Status NumPyConverter::Visit(const BinaryType& type) {
-  ::arrow::internal::ChunkedBinaryBuilder builder(kBinaryChunksize, pool_);
+  ::arrow::ChunkedBinaryBuilder builder(kBinaryChunksize, pool_);
 
   auto data = reinterpret_cast<const uint8_t*>(PyArray_DATA(arr_));
 
@@ -610,33 +611,46 @@ namespace {
 // NumPy unicode is UCS4/UTF32 always
 constexpr int kNumPyUnicodeSize = 4;
 
-Status AppendUTF32(const char* data, int itemsize, int byteorder,
-                   StringBuilder* builder) {
-  // The binary \x00\x00\x00\x00 indicates a nul terminator in NumPy unicode,
-  // so we need to detect that here to truncate if necessary. Yep.
-  int actual_length = 0;
-  for (; actual_length < itemsize / kNumPyUnicodeSize; ++actual_length) {
-    const char* code_point = data + actual_length * kNumPyUnicodeSize;
-    if ((*code_point == '\0') && (*(code_point + 1) == '\0') &&
-        (*(code_point + 2) == '\0') && (*(code_point + 3) == '\0')) {
+// Encode a NumPy unicode value as UTF8 into out. The conversion happens here
+// rather than through the Python codecs, so that it doesn't need the GIL
+Status EncodeUTF32(const uint8_t* data, int itemsize, bool swap_bytes,
+                   std::string* out) {
+  out->clear();
+  for (int i = 0; i < itemsize / kNumPyUnicodeSize; ++i) {
+    uint32_t code_point;
+    memcpy(&code_point, data + i * kNumPyUnicodeSize, kNumPyUnicodeSize);
+    if (swap_bytes) {
+      code_point = BitUtil::ByteSwap(code_point);
+    }
+    // The binary \x00\x00\x00\x00 indicates a nul terminator in NumPy
+    // unicode, so we need to detect that here to truncate if necessary. Yep.
+    if (code_point == 0) {
       break;
     }
+    if (code_point < 0x80) {
+      out->push_back(static_cast<char>(code_point));
+    } else if (code_point < 0x800) {
+      out->push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+      out->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x10000) {
+      if (code_point >= 0xD800 && code_point <= 0xDFFF) {
+        return Status::Invalid("failed converting UTF32 to UTF8: surrogate code point ",
+                               code_point);
+      }
+      out->push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+      out->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+      out->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else if (code_point < 0x110000) {
+      out->push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+      out->push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+      out->push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+      out->push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+    } else {
+      return Status::Invalid("failed converting UTF32 to UTF8: code point ", code_point,
+                             " out of range");
+    }
   }
-
-  OwnedRef unicode_obj(PyUnicode_DecodeUTF32(data, actual_length * kNumPyUnicodeSize,
-                                             nullptr, &byteorder));
-  RETURN_IF_PYERROR();
-  OwnedRef utf8_obj(PyUnicode_AsUTF8String(unicode_obj.obj()));
-  if (utf8_obj.obj() == NULL) {
-    PyErr_Clear();
-    return Status::Invalid("failed converting UTF32 to UTF8");
-  }
-
-  const int32_t length = static_cast<int32_t>(PyBytes_GET_SIZE(utf8_obj.obj()));
-  if (builder->value_data_length() + length > kBinaryMemoryLimit) {
-    return Status::CapacityError("Encoded string length exceeds maximum size (2GB)");
-  }
-  return builder->Append(PyBytes_AS_STRING(utf8_obj.obj()), length);
+  return Status::OK();
 }
 
 }  // namespace
@@ -644,20 +658,23 @@ Status AppendUTF32(const char* data, int itemsize, int byteorder,
 Status NumPyConverter::Visit(const StringType& type) {
   util::InitializeUTF8();
 
-  StringBuilder builder(pool_);
+  // The values are split into several chunks rather than exceed the 2GB limit
+  // of a StringArray. No value is longer than itemsize_, so the chunk size
+  // leaves room for one more without overflowing
+  ::arrow::ChunkedStringBuilder builder(
+      static_cast<int32_t>(kBinaryMemoryLimit - itemsize_), pool_);
 
   auto data = reinterpret_cast<const uint8_t*>(PyArray_DATA(arr_));
 
-  char numpy_byteorder = dtype_->byteorder;
-
-  // For Python C API, -1 is little-endian, 1 is big-endian
-  int byteorder = numpy_byteorder == '>' ? 1 : -1;
-
-  PyAcquireGIL gil_lock;
+  // NumPy byte orders are '<' little-endian, '>' big-endian, or '=' native
+  const char numpy_byteorder = dtype_->byteorder;
+  const bool swap_bytes =
+      ARROW_LITTLE_ENDIAN ? numpy_byteorder == '>' : numpy_byteorder == '<';
 
   const bool is_binary_type = dtype_->type_num == NPY_STRING;
 
-  auto AppendNonNullValue = [&](const uint8_t* data) {
+  std::string utf8_value;
+  auto AppendNonNullValue = [&](const uint8_t* data) -> Status {
     if (is_binary_type) {
       if (ARROW_PREDICT_TRUE(util::ValidateUTF8(data, itemsize_))) {
         return builder.Append(data, itemsize_);
@@ -666,8 +683,8 @@ Status NumPyConverter::Visit(const StringType& type) {
                                HexEncode(data, itemsize_));
       }
     } else {
-      return AppendUTF32(reinterpret_cast<const char*>(data), itemsize_, byteorder,
-                         &builder);
+      RETURN_NOT_OK(EncodeUTF32(data, itemsize_, swap_bytes, &utf8_value));
+      return builder.Append(util::string_view(utf8_value));
     }
   };
   if (mask_ != nullptr) {
@@ -687,9 +704,12 @@ Status NumPyConverter::Visit(const StringType& type) {
     }
   }
 
-  std::shared_ptr<Array> result;
+  ArrayVector result;
   RETURN_NOT_OK(builder.Finish(&result));
-  return PushArray(result->data());
+  for (auto arr : result) {
+    RETURN_NOT_OK(PushArray(arr->data()));
+  }
+  return Status::OK();
 }
 
 Status NumPyConverter::Visit(const StructType& type) {
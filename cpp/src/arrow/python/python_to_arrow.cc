@@ -126,14 +126,31 @@ struct NullChecker<NullCoding::PANDAS_SENTINELS> {
 // Helper templates to append PyObject* to builder for each target conversion
 // type
 
+template <typename Int>
+inline bool IntegerFits(int64_t value) {
+  return value >= static_cast<int64_t>(std::numeric_limits<Int>::min()) &&
+         (value < 0 || static_cast<uint64_t>(value) <=
+                           static_cast<uint64_t>(std::numeric_limits<Int>::max()));
+}
+
 template <typename Type, typename Enable = void>
 struct Unbox {};
 
 template <typename Type>
 struct Unbox<Type, enable_if_integer<Type>> {
   using BuilderType = typename TypeTraits<Type>::BuilderType;
+  using c_type = typename Type::c_type;
   static inline Status Append(BuilderType* builder, PyObject* obj) {
-    typename Type::c_type value;
+    if (PyLong_CheckExact(obj)) {
+      // Fast path for Python ints in range, other values and errors go
+      // through CIntFromPython
+      int overflow = 0;
+      const int64_t value = PyLong_AsLongLongAndOverflow(obj, &overflow);
+      if (!overflow && IntegerFits<c_type>(value)) {
+        return builder->Append(static_cast<c_type>(value));
+      }
+    }
+    c_type value;
     RETURN_NOT_OK(internal::CIntFromPython(obj, &value));
     return builder->Append(value);
   }
@@ -950,6 +967,40 @@ Status ConvertToSequenceAndInferSize(PyObject* obj, PyObject** seq, int64_t* siz
   return Status::OK();
 }
 
+// Inferring the type of a sequence of Python ints means looking at all of
+// its values, as a float further on, say, makes it double. When a sample of
+// the sequence is inferred as int64, it is converted right away instead, and
+// inferred as a whole only if a value turns out not to be a Python int in the
+// int64 range or a null
+constexpr int64_t kInferenceSampleSize = 1024;
+
+Status TryConvertPyIntegers(PyObject* seq, int64_t size, bool from_pandas,
+                            MemoryPool* pool, bool* converted,
+                            std::shared_ptr<Array>* out) {
+  Int64Builder builder(pool);
+  RETURN_NOT_OK(builder.Reserve(size));
+  *converted = true;
+  RETURN_NOT_OK(internal::VisitSequence(
+      seq, [&builder, from_pandas, converted](PyObject* obj, bool* keep_going) -> Status {
+        if (PyLong_CheckExact(obj)) {
+          int overflow = 0;
+          const int64_t value = PyLong_AsLongLongAndOverflow(obj, &overflow);
+          if (!overflow) {
+            return builder.Append(value);
+          }
+        } else if (from_pandas ? internal::PandasObjectIsNull(obj) : obj == Py_None) {
+          return builder.AppendNull();
+        }
+        *converted = false;
+        *keep_going = false;
+        return Status::OK();
+      }));
+  if (*converted) {
+    RETURN_NOT_OK(builder.Finish(out));
+  }
+  return Status::OK();
+}
+
 Status ConvertPySequence(PyObject* sequence_source, PyObject* mask,
                          const PyConversionOptions& options,
                          std::shared_ptr<ChunkedArray>* out) {
@@ -972,6 +1023,20 @@ Status ConvertPySequence(PyObject* sequence_source, PyObject* mask,
   bool strict_conversions = false;
 
   if (options.type == nullptr) {
+    if ((mask == nullptr || mask == Py_None) && options.size < 0 &&
+        size > kInferenceSampleSize) {
+      RETURN_NOT_OK(InferArrowTypeFromSample(seq, kInferenceSampleSize, &real_type));
+      if (real_type->id() == Type::INT64) {
+        bool converted = false;
+        std::shared_ptr<Array> result;
+        RETURN_NOT_OK(TryConvertPyIntegers(seq, size, options.from_pandas, options.pool,
+                                           &converted, &result));
+        if (converted) {
+          *out = std::make_shared<ChunkedArray>(ArrayVector{result});
+          return Status::OK();
+        }
+      }
+    }
     RETURN_NOT_OK(InferArrowType(seq, &real_type));
   } else {
     real_type = options.type;
@@ -1006,9 +1071,14 @@ Status ConvertPySequence(PyObject* sequence_source, PyObject* mask,
     RETURN_NOT_OK(converter->AppendMultiple(seq, size));
   }
 
-  // Retrieve result. Conversion may yield one or more array values
+  // Retrieve result. Conversion may yield one or more array values. Finishing
+  // the builders doesn't touch Python objects, so the GIL is released for
+  // other threads meanwhile
   std::vector<std::shared_ptr<Array>> chunks;
-  RETURN_NOT_OK(converter->GetResult(&chunks));
+  lock.release();
+  Status status = converter->GetResult(&chunks);
+  lock.acquire();
+  RETURN_NOT_OK(status);
 
   *out = std::make_shared<ChunkedArray>(chunks);
   return Status::OK();
@@ -609,7 +609,47 @@ Status SerializedPyObject::WriteTo(io::OutputStream* dst) {
   return Status::OK();
 }
 
+Status SerializedPyObject::GetComponents(MemoryPool* memory_pool,
+                                         std::vector<std::shared_ptr<Buffer>>* out) {
+  out->clear();
+
+  constexpr int64_t kInitialCapacity = 1024;
+
+  // Write the record batch describing the object structure
+  std::shared_ptr<io::BufferOutputStream> stream;
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(io::BufferOutputStream::Create(kInitialCapacity, memory_pool, &stream));
+  RETURN_NOT_OK(ipc::WriteRecordBatchStream({this->batch}, stream.get()));
+  RETURN_NOT_OK(stream->Finish(&buffer));
+  out->push_back(buffer);
+
+  // For each tensor, get a metadata buffer and a buffer for the body
+  for (const auto& tensor : this->tensors) {
+    std::unique_ptr<ipc::Message> message;
+    RETURN_NOT_OK(ipc::GetTensorMessage(*tensor, memory_pool, &message));
+    out->push_back(message->metadata());
+    out->push_back(message->body());
+  }
+
+  // For each ndarray, get a metadata buffer and a buffer for the body
+  for (const auto& ndarray : this->ndarrays) {
+    std::unique_ptr<ipc::Message> message;
+    RETURN_NOT_OK(ipc::GetTensorMessage(*ndarray, memory_pool, &message));
+    out->push_back(message->metadata());
+    out->push_back(message->body());
+  }
+
+  for (const auto& buf : this->buffers) {
+    out->push_back(buf);
+  }
+
+  return Status::OK();
+}
+
 Status SerializedPyObject::GetComponents(MemoryPool* memory_pool, PyObject** out) {
+  std::vector<std::shared_ptr<Buffer>> components;
+  RETURN_NOT_OK(GetComponents(memory_pool, &components));
+
   PyAcquireGIL py_gil;
 
   OwnedRef result(PyDict_New());
@@ -630,7 +670,7 @@ Status SerializedPyObject::GetComponents(MemoryPool* memory_pool, PyObject** out
 
   Py_DECREF(buffers);
 
-  auto PushBuffer = [&buffers](const std::shared_ptr<Buffer>& buffer) {
+  for (const auto& buffer : components) {
     PyObject* wrapped_buffer = wrap_buffer(buffer);
     RETURN_IF_PYERROR();
     if (PyList_Append(buffers, wrapped_buffer) < 0) {
@@ -638,41 +678,6 @@ Status SerializedPyObject::GetComponents(MemoryPool* memory_pool, PyObject** out
       RETURN_IF_PYERROR();
     }
     Py_DECREF(wrapped_buffer);
-    return Status::OK();
-  };
-
-  constexpr int64_t kInitialCapacity = 1024;
-
-  // Write the record batch describing the object structure
-  std::shared_ptr<io::BufferOutputStream> stream;
-  std::shared_ptr<Buffer> buffer;
-
-  py_gil.release();
-  RETURN_NOT_OK(io::BufferOutputStream::Create(kInitialCapacity, memory_pool, &stream));
-  RETURN_NOT_OK(ipc::WriteRecordBatchStream({this->batch}, stream.get()));
-  RETURN_NOT_OK(stream->Finish(&buffer));
-  py_gil.acquire();
-
-  RETURN_NOT_OK(PushBuffer(buffer));
-
-  // For each tensor, get a metadata buffer and a buffer for the body
-  for (const auto& tensor : this->tensors) {
-    std::unique_ptr<ipc::Message> message;
-    RETURN_NOT_OK(ipc::GetTensorMessage(*tensor, memory_pool, &message));
-    RETURN_NOT_OK(PushBuffer(message->metadata()));
-    RETURN_NOT_OK(PushBuffer(message->body()));
-  }
-
-  // For each ndarray, get a metadata buffer and a buffer for the body
-  for (const auto& ndarray : this->ndarrays) {
-    std::unique_ptr<ipc::Message> message;
-    RETURN_NOT_OK(ipc::GetTensorMessage(*ndarray, memory_pool, &message));
-    RETURN_NOT_OK(PushBuffer(message->metadata()));
-    RETURN_NOT_OK(PushBuffer(message->body()));
-  }
-
-  for (const auto& buf : this->buffers) {
-    RETURN_NOT_OK(PushBuffer(buf));
   }
 
   *out = result.detach();
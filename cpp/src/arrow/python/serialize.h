@@ -72,6 +72,19 @@ struct ARROW_PYTHON_EXPORT SerializedPyObject {
   /// with the first buffer containing the serialized record batch containing
   /// the UnionArray that describes the whole object
   Status GetComponents(MemoryPool* pool, PyObject** out);
+
+  /// \brief Get the message components of SerializedPyObject, in the order
+  /// of the 'data' list of the above, for passing the object out-of-band
+  ///
+  /// Only the record batch and the tensor metadata are written to new
+  /// buffers. The bodies of contiguous tensors and ndarrays and the buffers
+  /// reference the memory of the serialized Python objects, so that large
+  /// objects can be sent with a gather write or copied into shared memory
+  /// without intermediate copies. Does not need the GIL
+  /// \param[in] pool memory pool for the new buffers
+  /// \param[out] out the components
+  /// \return Status
+  Status GetComponents(MemoryPool* pool, std::vector<std::shared_ptr<Buffer>>* out);
 };
 
 /// \brief Serialize Python sequence as a SerializedPyObject.
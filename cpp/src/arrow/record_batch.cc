@@ -19,12 +19,14 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <deque>
 #include <memory>
 #include <sstream>
 #include <string>
 #include <utility>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
@@ -262,4 +264,195 @@ Status RecordBatchReader::ReadAll(std::shared_ptr<Table>* table) {
   return Table::FromRecordBatches(schema(), batches, table);
 }
 
+// ----------------------------------------------------------------------
+// Record batch reader adapters
+
+namespace {
+
+class ProjectingReader : public RecordBatchReader {
+ public:
+  ProjectingReader(const std::shared_ptr<RecordBatchReader>& reader,
+                   const std::vector<int>& column_indices)
+      : reader_(reader), column_indices_(column_indices) {
+    const auto& source_schema = *reader_->schema();
+    std::vector<std::shared_ptr<Field>> fields;
+    for (int i : column_indices_) {
+      fields.push_back(source_schema.field(i));
+    }
+    schema_ = ::arrow::schema(std::move(fields), source_schema.metadata());
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader_->ReadNext(&batch));
+    if (!batch) {
+      *out = nullptr;
+      return Status::OK();
+    }
+    std::vector<std::shared_ptr<ArrayData>> columns;
+    for (int i : column_indices_) {
+      columns.push_back(batch->column_data(i));
+    }
+    *out = RecordBatch::Make(schema_, batch->num_rows(), std::move(columns));
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<RecordBatchReader> reader_;
+  std::vector<int> column_indices_;
+  std::shared_ptr<Schema> schema_;
+};
+
+class SlicingReader : public RecordBatchReader {
+ public:
+  SlicingReader(const std::shared_ptr<RecordBatchReader>& reader, int64_t offset,
+                int64_t length)
+      : reader_(reader), to_skip_(offset), remaining_(length) {}
+
+  std::shared_ptr<Schema> schema() const override { return reader_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    *out = nullptr;
+    while (remaining_ > 0) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader_->ReadNext(&batch));
+      if (!batch) {
+        break;
+      }
+      if (to_skip_ >= batch->num_rows()) {
+        to_skip_ -= batch->num_rows();
+        continue;
+      }
+      const int64_t length = std::min(batch->num_rows() - to_skip_, remaining_);
+      if (to_skip_ > 0 || length < batch->num_rows()) {
+        batch = batch->Slice(to_skip_, length);
+      }
+      to_skip_ = 0;
+      remaining_ -= length;
+      *out = std::move(batch);
+      break;
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<RecordBatchReader> reader_;
+  int64_t to_skip_;
+  int64_t remaining_;
+};
+
+class RechunkingReader : public RecordBatchReader {
+ public:
+  RechunkingReader(const std::shared_ptr<RecordBatchReader>& reader, int64_t batch_size,
+                   MemoryPool* pool)
+      : reader_(reader),
+        batch_size_(batch_size),
+        pool_(pool),
+        pending_rows_(0),
+        finished_(false) {}
+
+  std::shared_ptr<Schema> schema() const override { return reader_->schema(); }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    while (!finished_ && pending_rows_ < batch_size_) {
+      std::shared_ptr<RecordBatch> batch;
+      RETURN_NOT_OK(reader_->ReadNext(&batch));
+      if (!batch) {
+        finished_ = true;
+      } else if (batch->num_rows() > 0) {
+        pending_rows_ += batch->num_rows();
+        pending_.push_back(std::move(batch));
+      }
+    }
+    if (pending_rows_ == 0) {
+      *out = nullptr;
+      return Status::OK();
+    }
+
+    const int64_t length = std::min(batch_size_, pending_rows_);
+    pending_rows_ -= length;
+    if (pending_.front()->num_rows() >= length) {
+      // Zero-copy when the front batch covers the whole output
+      *out = TakeFront(length);
+      return Status::OK();
+    }
+
+    std::vector<std::shared_ptr<RecordBatch>> pieces;
+    int64_t collected = 0;
+    while (collected < length) {
+      pieces.push_back(TakeFront(length - collected));
+      collected += pieces.back()->num_rows();
+    }
+    const int num_columns = pieces[0]->num_columns();
+    std::vector<std::shared_ptr<Array>> columns(num_columns);
+    for (int i = 0; i < num_columns; ++i) {
+      std::vector<std::shared_ptr<Array>> chunks;
+      for (const auto& piece : pieces) {
+        chunks.push_back(piece->column(i));
+      }
+      RETURN_NOT_OK(Concatenate(chunks, pool_, &columns[i]));
+    }
+    *out = RecordBatch::Make(schema(), length, std::move(columns));
+    return Status::OK();
+  }
+
+ private:
+  // Remove and return up to `length` rows from the front pending batch
+  std::shared_ptr<RecordBatch> TakeFront(int64_t length) {
+    std::shared_ptr<RecordBatch> front = pending_.front();
+    if (front->num_rows() <= length) {
+      pending_.pop_front();
+      return front;
+    }
+    pending_.front() = front->Slice(length);
+    return front->Slice(0, length);
+  }
+
+  std::shared_ptr<RecordBatchReader> reader_;
+  int64_t batch_size_;
+  MemoryPool* pool_;
+  std::deque<std::shared_ptr<RecordBatch>> pending_;
+  int64_t pending_rows_;
+  bool finished_;
+};
+
+}  // namespace
+
+Status ProjectRecordBatchReader(const std::shared_ptr<RecordBatchReader>& reader,
+                                const std::vector<int>& column_indices,
+                                std::shared_ptr<RecordBatchReader>* out) {
+  const int num_fields = reader->schema()->num_fields();
+  for (int i : column_indices) {
+    if (i < 0 || i >= num_fields) {
+      return Status::Invalid("Column index ", i, " out of bounds for a schema with ",
+                             num_fields, " fields");
+    }
+  }
+  *out = std::make_shared<ProjectingReader>(reader, column_indices);
+  return Status::OK();
+}
+
+Status SliceRecordBatchReader(const std::shared_ptr<RecordBatchReader>& reader,
+                              int64_t offset, int64_t length,
+                              std::shared_ptr<RecordBatchReader>* out) {
+  if (offset < 0 || length < 0) {
+    return Status::Invalid("Slice offset and length must be non-negative, got ", offset,
+                           " and ", length);
+  }
+  *out = std::make_shared<SlicingReader>(reader, offset, length);
+  return Status::OK();
+}
+
+Status RechunkRecordBatchReader(const std::shared_ptr<RecordBatchReader>& reader,
+                                int64_t batch_size, MemoryPool* pool,
+                                std::shared_ptr<RecordBatchReader>* out) {
+  if (batch_size <= 0) {
+    return Status::Invalid("Batch size must be positive, got ", batch_size);
+  }
+  *out = std::make_shared<RechunkingReader>(reader, batch_size, pool);
+  return Status::OK();
+}
+
 }  // namespace arrow
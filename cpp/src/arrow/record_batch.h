@@ -31,6 +31,7 @@ namespace arrow {
 
 class Array;
 struct ArrayData;
+class MemoryPool;
 class Status;
 class Table;
 
@@ -193,6 +194,50 @@ class ARROW_EXPORT RecordBatchReader {
   Status ReadAll(std::shared_ptr<Table>* table);
 };
 
+/// \brief Lazily select columns of the batches of a reader
+///
+/// Batches are read from `reader` one at a time as the returned reader is
+/// consumed; each is a zero-copy view over the selected columns.
+///
+/// \param[in] reader the source of record batches
+/// \param[in] column_indices indices of the columns to keep, in output order;
+/// a column may be selected more than once
+/// \param[out] out the projecting reader
+ARROW_EXPORT
+Status ProjectRecordBatchReader(const std::shared_ptr<RecordBatchReader>& reader,
+                                const std::vector<int>& column_indices,
+                                std::shared_ptr<RecordBatchReader>* out);
+
+/// \brief Lazily restrict a reader to a range of rows
+///
+/// Rows before `offset` are skipped and the stream ends once `length` rows
+/// have been returned, without reading further from `reader`.  Batches are
+/// zero-copy slices of the source batches.
+///
+/// \param[in] reader the source of record batches
+/// \param[in] offset the number of leading rows to skip
+/// \param[in] length the maximum number of rows to return
+/// \param[out] out the slicing reader
+ARROW_EXPORT
+Status SliceRecordBatchReader(const std::shared_ptr<RecordBatchReader>& reader,
+                              int64_t offset, int64_t length,
+                              std::shared_ptr<RecordBatchReader>* out);
+
+/// \brief Lazily regroup the rows of a reader into batches of a given size
+///
+/// Every returned batch has `batch_size` rows, except the last one which may
+/// be shorter.  Larger source batches are sliced without copying; smaller
+/// ones are buffered until enough rows are available and concatenated.
+///
+/// \param[in] reader the source of record batches
+/// \param[in] batch_size the number of rows per returned batch, positive
+/// \param[in] pool memory pool for concatenated batches
+/// \param[out] out the rechunking reader
+ARROW_EXPORT
+Status RechunkRecordBatchReader(const std::shared_ptr<RecordBatchReader>& reader,
+                                int64_t batch_size, MemoryPool* pool,
+                                std::shared_ptr<RecordBatchReader>* out);
+
 }  // namespace arrow
 
 #endif  // ARROW_RECORD_BATCH_H
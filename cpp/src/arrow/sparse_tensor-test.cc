@@ -48,6 +48,12 @@ static inline void AssertCOOIndex(
   }
 }
 
+static inline std::vector<int64_t> IndexValues(
+    const std::shared_ptr<NumericTensor<Int64Type>>& index) {
+  const int64_t* begin = reinterpret_cast<const int64_t*>(index->raw_data());
+  return std::vector<int64_t>(begin, begin + index->shape()[0]);
+}
+
 TEST(TestSparseCOOTensor, CreationEmptyTensor) {
   std::vector<int64_t> shape = {2, 3, 4};
   SparseTensorImpl<SparseCOOIndex> st1(int64(), shape);
@@ -269,4 +275,175 @@ TEST(TestSparseCSRMatrix, CreationFromNonContiguousTensor) {
   ASSERT_EQ(std::vector<int64_t>({0, 2, 1, 3, 0, 2, 1, 3, 0, 2, 1, 3}), indices_values);
 }
 
+TEST(TestSparseCSRMatrix, MakeFromTensor) {
+  std::vector<int64_t> values = {1, 0, 2, 0, 0, 3, 0, 4};
+  std::shared_ptr<Buffer> buffer = Buffer::Wrap(values);
+  Tensor tensor(int64(), buffer, {2, 4});
+
+  std::shared_ptr<SparseMatrixCSR> st;
+  ASSERT_OK(SparseMatrixCSR::Make(tensor, &st));
+  ASSERT_TRUE(st->Equals(SparseMatrixCSR(tensor)));
+  ASSERT_EQ(std::vector<int64_t>({2, 4}), st->shape());
+  ASSERT_EQ(4, st->non_zero_length());
+}
+
+TEST(TestSparseCSRMatrix, MakeFromNon2DTensor) {
+  std::vector<int64_t> values = {1, 0, 2, 0, 0, 3, 0, 4};
+  std::shared_ptr<Buffer> buffer = Buffer::Wrap(values);
+  std::shared_ptr<SparseMatrixCSR> csr;
+  std::shared_ptr<SparseMatrixCSC> csc;
+
+  for (const auto& shape : std::vector<std::vector<int64_t>>{{}, {8}, {2, 2, 2}}) {
+    Tensor tensor(int64(), buffer, shape);
+    ASSERT_RAISES(Invalid, SparseMatrixCSR::Make(tensor, &csr));
+    ASSERT_RAISES(Invalid, SparseMatrixCSC::Make(tensor, &csc));
+  }
+}
+
+TEST(TestSparseCSCMatrix, CreationFromNumericTensor2D) {
+  std::vector<int64_t> shape = {6, 4};
+  std::vector<int64_t> values = {1, 0,  2, 0,  0,  3, 0,  4, 5, 0,  6, 0,
+                                 0, 11, 0, 12, 13, 0, 14, 0, 0, 15, 0, 16};
+  std::shared_ptr<Buffer> buffer = Buffer::Wrap(values);
+  NumericTensor<Int64Type> tensor(buffer, shape);
+
+  SparseTensorImpl<SparseCSCIndex> st(tensor);
+
+  CheckSparseIndexFormatType(SparseTensorFormat::CSC, st);
+
+  ASSERT_EQ(12, st.non_zero_length());
+  ASSERT_TRUE(st.is_mutable());
+
+  const int64_t* raw_data = reinterpret_cast<const int64_t*>(st.raw_data());
+  AssertNumericDataEqual(raw_data, {1, 5, 13, 3, 11, 15, 2, 6, 14, 4, 12, 16});
+
+  const auto& si = internal::checked_cast<const SparseCSCIndex&>(*st.sparse_index());
+  ASSERT_EQ(std::string("SparseCSCIndex"), si.ToString());
+  ASSERT_EQ(std::vector<int64_t>({0, 3, 6, 9, 12}), IndexValues(si.indptr()));
+  ASSERT_EQ(std::vector<int64_t>({0, 2, 4, 1, 3, 5, 0, 2, 4, 1, 3, 5}),
+            IndexValues(si.indices()));
+}
+
+TEST(TestSparseCSCMatrix, CreationFromNonContiguousTensor) {
+  std::vector<int64_t> shape = {6, 4};
+  std::vector<int64_t> values = {1,  0, 0, 0, 2,  0, 0, 0, 0, 0, 3,  0, 0, 0, 4,  0,
+                                 5,  0, 0, 0, 6,  0, 0, 0, 0, 0, 11, 0, 0, 0, 12, 0,
+                                 13, 0, 0, 0, 14, 0, 0, 0, 0, 0, 15, 0, 0, 0, 16, 0};
+  std::vector<int64_t> strides = {64, 16};
+  std::shared_ptr<Buffer> buffer = Buffer::Wrap(values);
+  Tensor tensor(int64(), buffer, shape, strides);
+  SparseTensorImpl<SparseCSCIndex> st(tensor);
+
+  ASSERT_EQ(12, st.non_zero_length());
+
+  const int64_t* raw_data = reinterpret_cast<const int64_t*>(st.raw_data());
+  AssertNumericDataEqual(raw_data, {1, 5, 13, 3, 11, 15, 2, 6, 14, 4, 12, 16});
+
+  const auto& si = internal::checked_cast<const SparseCSCIndex&>(*st.sparse_index());
+  ASSERT_EQ(std::vector<int64_t>({0, 3, 6, 9, 12}), IndexValues(si.indptr()));
+  ASSERT_EQ(std::vector<int64_t>({0, 2, 4, 1, 3, 5, 0, 2, 4, 1, 3, 5}),
+            IndexValues(si.indices()));
+
+  SparseTensorImpl<SparseCSCIndex> st2(tensor);
+  ASSERT_TRUE(st.Equals(st2));
+}
+
+TEST(TestSparseCSFTensor, CreationFromNumericTensor) {
+  std::vector<int64_t> shape = {2, 3, 4};
+  std::vector<int64_t> values = {1, 0,  2, 0,  0,  3, 0,  4, 5, 0,  6, 0,
+                                 0, 11, 0, 12, 13, 0, 14, 0, 0, 15, 0, 16};
+  std::shared_ptr<Buffer> buffer = Buffer::Wrap(values);
+  NumericTensor<Int64Type> tensor(buffer, shape);
+  SparseTensorImpl<SparseCSFIndex> st(tensor);
+
+  CheckSparseIndexFormatType(SparseTensorFormat::CSF, st);
+
+  ASSERT_EQ(12, st.non_zero_length());
+
+  const int64_t* raw_data = reinterpret_cast<const int64_t*>(st.raw_data());
+  AssertNumericDataEqual(raw_data, {1, 2, 3, 4, 5, 6, 11, 12, 13, 14, 15, 16});
+
+  const auto& si = internal::checked_cast<const SparseCSFIndex&>(*st.sparse_index());
+  ASSERT_EQ(std::string("SparseCSFIndex"), si.ToString());
+  ASSERT_EQ(std::vector<int64_t>({0, 1, 2}), si.axis_order());
+  ASSERT_EQ(2, si.indptr().size());
+  ASSERT_EQ(3, si.indices().size());
+  ASSERT_EQ(std::vector<int64_t>({0, 3, 6}), IndexValues(si.indptr()[0]));
+  ASSERT_EQ(std::vector<int64_t>({0, 2, 4, 6, 8, 10, 12}), IndexValues(si.indptr()[1]));
+  ASSERT_EQ(std::vector<int64_t>({0, 1}), IndexValues(si.indices()[0]));
+  ASSERT_EQ(std::vector<int64_t>({0, 1, 2, 0, 1, 2}), IndexValues(si.indices()[1]));
+  ASSERT_EQ(std::vector<int64_t>({0, 2, 1, 3, 0, 2, 1, 3, 0, 2, 1, 3}),
+            IndexValues(si.indices()[2]));
+
+  SparseTensorImpl<SparseCSFIndex> st2(tensor);
+  ASSERT_TRUE(st.Equals(st2));
+  SparseTensorImpl<SparseCOOIndex> st3(tensor);
+  ASSERT_FALSE(st.Equals(st3));
+}
+
+TEST(TestSparseTensorConversion, LargeTensor) {
+  // Large enough to be converted in parallel
+  const int64_t nrows = 1000;
+  const int64_t ncols = 300;
+  std::vector<int32_t> values(nrows * ncols, 0);
+  std::vector<int64_t> expected_indptr = {0};
+  std::vector<int64_t> expected_indices;
+  std::vector<int32_t> expected_values;
+  for (int64_t i = 0; i < nrows; ++i) {
+    for (int64_t j = 0; j < ncols; ++j) {
+      if ((i * 7 + j * 3) % 11 == 0) {
+        values[i * ncols + j] = static_cast<int32_t>(i * ncols + j + 1);
+        expected_indices.push_back(j);
+        expected_values.push_back(values[i * ncols + j]);
+      }
+    }
+    expected_indptr.push_back(static_cast<int64_t>(expected_indices.size()));
+  }
+  const int64_t nonzero_count = static_cast<int64_t>(expected_values.size());
+
+  NumericTensor<Int32Type> tensor(Buffer::Wrap(values), {nrows, ncols});
+
+  SparseTensorImpl<SparseCSRIndex> csr(tensor);
+  ASSERT_EQ(nonzero_count, csr.non_zero_length());
+  const auto& csr_index =
+      internal::checked_cast<const SparseCSRIndex&>(*csr.sparse_index());
+  ASSERT_EQ(expected_indptr, IndexValues(csr_index.indptr()));
+  ASSERT_EQ(expected_indices, IndexValues(csr_index.indices()));
+  const int32_t* csr_values = reinterpret_cast<const int32_t*>(csr.raw_data());
+  ASSERT_EQ(expected_values,
+            std::vector<int32_t>(csr_values, csr_values + nonzero_count));
+
+  SparseTensorImpl<SparseCOOIndex> coo(tensor);
+  ASSERT_EQ(nonzero_count, coo.non_zero_length());
+  const auto& coo_index =
+      internal::checked_cast<const SparseCOOIndex&>(*coo.sparse_index());
+  const int32_t* coo_values = reinterpret_cast<const int32_t*>(coo.raw_data());
+  ASSERT_EQ(expected_values,
+            std::vector<int32_t>(coo_values, coo_values + nonzero_count));
+  for (int64_t i = 0, k = 0; i < nrows; ++i) {
+    for (; k < expected_indptr[i + 1]; ++k) {
+      ASSERT_EQ(i, coo_index.indices()->Value({k, 0}));
+      ASSERT_EQ(expected_indices[k], coo_index.indices()->Value({k, 1}));
+    }
+  }
+
+  // The CSC matrix of the tensor is the CSR matrix of its transpose
+  std::vector<int32_t> transposed(nrows * ncols);
+  for (int64_t i = 0; i < nrows; ++i) {
+    for (int64_t j = 0; j < ncols; ++j) {
+      transposed[j * nrows + i] = values[i * ncols + j];
+    }
+  }
+  NumericTensor<Int32Type> transposed_tensor(Buffer::Wrap(transposed), {ncols, nrows});
+  SparseTensorImpl<SparseCSCIndex> csc(tensor);
+  SparseTensorImpl<SparseCSRIndex> transposed_csr(transposed_tensor);
+  const auto& csc_index =
+      internal::checked_cast<const SparseCSCIndex&>(*csc.sparse_index());
+  const auto& transposed_index =
+      internal::checked_cast<const SparseCSRIndex&>(*transposed_csr.sparse_index());
+  ASSERT_TRUE(csc_index.indptr()->Equals(*transposed_index.indptr()));
+  ASSERT_TRUE(csc_index.indices()->Equals(*transposed_index.indices()));
+  ASSERT_TRUE(csc.data()->Equals(*transposed_csr.data()));
+}
+
 }  // namespace arrow
@@ -17,17 +17,178 @@
 
 #include "arrow/sparse_tensor.h"
 
+#include <algorithm>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <numeric>
+#include <vector>
 
 #include "arrow/compare.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread-pool.h"
 
 namespace arrow {
 
 namespace {
 
+// ----------------------------------------------------------------------
+// Parallel conversion helpers
+
+// Tensors with fewer cells are converted on the calling thread
+constexpr int64_t kParallelConversionMinSize = 1 << 16;
+
+// Split the range of the outermost converted dimension into chunks which
+// are converted independently, in parallel for large tensors
+class ConversionChunks {
+ public:
+  ConversionChunks(int64_t tensor_size, int64_t length) : length_(length) {
+    int64_t num_chunks = 1;
+    if (tensor_size >= kParallelConversionMinSize) {
+      num_chunks = std::min<int64_t>(
+          length, ::arrow::internal::GetCpuThreadPool()->GetCapacity());
+    }
+    num_chunks_ = static_cast<int>(std::max<int64_t>(num_chunks, 1));
+  }
+
+  int num_chunks() const { return num_chunks_; }
+  int64_t begin(int i) const { return length_ * i / num_chunks_; }
+  int64_t end(int i) const { return length_ * (i + 1) / num_chunks_; }
+
+  // Call func(i) for every chunk i
+  template <typename FUNCTION>
+  Status Run(FUNCTION&& func) const {
+    if (num_chunks_ == 1) {
+      return func(0);
+    }
+    return ::arrow::internal::ParallelFor(num_chunks_, func);
+  }
+
+ private:
+  int64_t length_;
+  int num_chunks_;
+};
+
+// Call visit(coord, value) for every non-zero cell of the tensor whose first
+// coordinate is in [begin, end), in row-major order
+template <typename TYPE, typename VISITOR>
+void VisitNonZero(const NumericTensor<TYPE>& tensor, int64_t begin, int64_t end,
+                  VISITOR&& visit) {
+  using value_type = typename NumericTensor<TYPE>::value_type;
+  const int ndim = tensor.ndim();
+  const uint8_t* data = tensor.raw_data();
+  std::vector<int64_t> coord(ndim, 0);
+
+  if (ndim == 0) {
+    const value_type x = *reinterpret_cast<const value_type*>(data);
+    if (begin == 0 && end > 0 && x != 0) {
+      visit(coord, x);
+    }
+    return;
+  }
+  if (tensor.size() == 0 || begin >= end) {
+    return;
+  }
+
+  const std::vector<int64_t>& shape = tensor.shape();
+  const std::vector<int64_t>& strides = tensor.strides();
+  coord[0] = begin;
+  int64_t offset = begin * strides[0];
+  while (coord[0] < end) {
+    const value_type x = *reinterpret_cast<const value_type*>(data + offset);
+    if (x != 0) {
+      visit(coord, x);
+    }
+
+    // increment index
+    int d = ndim - 1;
+    ++coord[d];
+    offset += strides[d];
+    while (d > 0 && coord[d] == shape[d]) {
+      offset -= strides[d] * shape[d];
+      coord[d] = 0;
+      --d;
+      ++coord[d];
+      offset += strides[d];
+    }
+  }
+}
+
+// Compress a matrix along its rows (axis 0, CSR) or its columns (axis 1, CSC)
+template <typename TYPE>
+Status CompressMatrix(const NumericTensor<TYPE>& tensor, int axis,
+                      std::shared_ptr<Buffer>* indptr_buffer,
+                      std::shared_ptr<Buffer>* indices_buffer,
+                      std::shared_ptr<Buffer>* values_buffer, int64_t* nonzero_count) {
+  using value_type = typename NumericTensor<TYPE>::value_type;
+
+  const int64_t major_length = tensor.shape()[axis];
+  const int64_t minor_length = tensor.shape()[1 - axis];
+  const int64_t major_stride = tensor.strides()[axis];
+  const int64_t minor_stride = tensor.strides()[1 - axis];
+  const uint8_t* data = tensor.raw_data();
+  auto value_at = [&](int64_t i, int64_t j) {
+    return *reinterpret_cast<const value_type*>(data + i * major_stride +
+                                                j * minor_stride);
+  };
+
+  ConversionChunks chunks(tensor.size(), major_length);
+
+  // Count the non-zero values of each row (or column)
+  RETURN_NOT_OK(AllocateBuffer(sizeof(int64_t) * (major_length + 1), indptr_buffer));
+  int64_t* indptr = reinterpret_cast<int64_t*>((*indptr_buffer)->mutable_data());
+  indptr[0] = 0;
+  RETURN_NOT_OK(chunks.Run([&](int c) {
+    for (int64_t i = chunks.begin(c); i < chunks.end(c); ++i) {
+      int64_t count = 0;
+      for (int64_t j = 0; j < minor_length; ++j) {
+        if (value_at(i, j) != 0) {
+          ++count;
+        }
+      }
+      indptr[i + 1] = count;
+    }
+    return Status::OK();
+  }));
+  std::partial_sum(indptr + 1, indptr + major_length + 1, indptr + 1);
+  *nonzero_count = indptr[major_length];
+
+  RETURN_NOT_OK(AllocateBuffer(sizeof(int64_t) * *nonzero_count, indices_buffer));
+  int64_t* indices = reinterpret_cast<int64_t*>((*indices_buffer)->mutable_data());
+  RETURN_NOT_OK(AllocateBuffer(sizeof(value_type) * *nonzero_count, values_buffer));
+  value_type* values = reinterpret_cast<value_type*>((*values_buffer)->mutable_data());
+
+  // Each row (or column) is filled at the position computed above
+  return chunks.Run([&](int c) {
+    for (int64_t i = chunks.begin(c); i < chunks.end(c); ++i) {
+      int64_t k = indptr[i];
+      for (int64_t j = 0; j < minor_length; ++j) {
+        const value_type x = value_at(i, j);
+        if (x != 0) {
+          values[k] = x;
+          indices[k] = j;
+          ++k;
+        }
+      }
+    }
+    return Status::OK();
+  });
+}
+
+Status MakeIndexTensor(const std::vector<int64_t>& values,
+                       std::shared_ptr<NumericTensor<Int64Type>>* out) {
+  const int64_t length = static_cast<int64_t>(values.size());
+  std::shared_ptr<Buffer> buffer;
+  RETURN_NOT_OK(AllocateBuffer(sizeof(int64_t) * length, &buffer));
+  if (length > 0) {
+    std::memcpy(buffer->mutable_data(), values.data(), sizeof(int64_t) * length);
+  }
+  *out = std::make_shared<NumericTensor<Int64Type>>(buffer, std::vector<int64_t>{length});
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // SparseTensorConverter
 
@@ -63,9 +224,21 @@ class SparseTensorConverter<TYPE, SparseCOOIndex>
   explicit SparseTensorConverter(const NumericTensorType& tensor) : BaseClass(tensor) {}
 
   Status Convert() {
-    const int64_t ndim = tensor_.ndim();
-    int64_t nonzero_count = -1;
-    RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
+    const int ndim = tensor_.ndim();
+    ConversionChunks chunks(tensor_.size(), ndim == 0 ? 1 : tensor_.shape()[0]);
+
+    // Count the non-zero values of each chunk, to compute where its
+    // coordinates and values start
+    std::vector<int64_t> offsets(chunks.num_chunks() + 1, 0);
+    RETURN_NOT_OK(chunks.Run([&](int c) {
+      int64_t count = 0;
+      VisitNonZero(tensor_, chunks.begin(c), chunks.end(c),
+                   [&count](const std::vector<int64_t>&, value_type) { ++count; });
+      offsets[c + 1] = count;
+      return Status::OK();
+    }));
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    const int64_t nonzero_count = offsets.back();
 
     std::shared_ptr<Buffer> indices_buffer;
     RETURN_NOT_OK(
@@ -76,44 +249,19 @@ class SparseTensorConverter<TYPE, SparseCOOIndex>
     RETURN_NOT_OK(AllocateBuffer(sizeof(value_type) * nonzero_count, &values_buffer));
     value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
 
-    if (ndim <= 1) {
-      const value_type* data = reinterpret_cast<const value_type*>(tensor_.raw_data());
-      const int64_t count = ndim == 0 ? 1 : tensor_.shape()[0];
-      for (int64_t i = 0; i < count; ++i, ++data) {
-        if (*data != 0) {
-          *indices++ = i;
-          *values++ = *data;
-        }
-      }
-    } else {
-      const std::vector<int64_t>& shape = tensor_.shape();
-      std::vector<int64_t> coord(ndim, 0);
-
-      for (int64_t n = tensor_.size(); n > 0; n--) {
-        const value_type x = tensor_.Value(coord);
-        if (tensor_.Value(coord) != 0) {
-          *values++ = x;
-
-          int64_t* indp = indices;
-          for (int64_t i = 0; i < ndim; ++i) {
-            *indp = coord[i];
-            indp += nonzero_count;
-          }
-          indices++;
-        }
-
-        // increment index
-        ++coord[ndim - 1];
-        if (n > 1 && coord[ndim - 1] == shape[ndim - 1]) {
-          int64_t d = ndim - 1;
-          while (d > 0 && coord[d] == shape[d]) {
-            coord[d] = 0;
-            ++coord[d - 1];
-            --d;
-          }
-        }
-      }
-    }
+    // The coordinates matrix is column-major
+    RETURN_NOT_OK(chunks.Run([&](int c) {
+      int64_t k = offsets[c];
+      VisitNonZero(tensor_, chunks.begin(c), chunks.end(c),
+                   [&](const std::vector<int64_t>& coord, value_type x) {
+                     values[k] = x;
+                     for (int d = 0; d < ndim; ++d) {
+                       indices[d * nonzero_count + k] = coord[d];
+                     }
+                     ++k;
+                   });
+      return Status::OK();
+    }));
 
     // make results
     const std::vector<int64_t> indices_shape = {nonzero_count, ndim};
@@ -136,21 +284,111 @@ class SparseTensorConverter<TYPE, SparseCOOIndex>
 };
 
 template <typename TYPE, typename SparseIndexType>
-void MakeSparseTensorFromTensor(const Tensor& tensor,
-                                std::shared_ptr<SparseIndex>* sparse_index,
-                                std::shared_ptr<Buffer>* data) {
+Status MakeSparseTensorFromTensor(const Tensor& tensor,
+                                  std::shared_ptr<SparseIndex>* sparse_index,
+                                  std::shared_ptr<Buffer>* data) {
   NumericTensor<TYPE> numeric_tensor(tensor.data(), tensor.shape(), tensor.strides());
   SparseTensorConverter<TYPE, SparseIndexType> converter(numeric_tensor);
-  DCHECK_OK(converter.Convert());
+  RETURN_NOT_OK(converter.Convert());
   *sparse_index = converter.sparse_index;
   *data = converter.data;
+  return Status::OK();
+}
+
+template <typename SparseIndexType>
+Status MakeSparseTensorFromTensor(const Tensor& tensor,
+                                  std::shared_ptr<SparseIndex>* sparse_index,
+                                  std::shared_ptr<Buffer>* data) {
+#define SPARSE_TENSOR_FROM_TENSOR_CASE(TYPE_CLASS)                                       \
+  case TYPE_CLASS::type_id:                                                              \
+    return MakeSparseTensorFromTensor<TYPE_CLASS, SparseIndexType>(tensor, sparse_index, \
+                                                                   data)
+
+  switch (tensor.type()->id()) {
+    SPARSE_TENSOR_FROM_TENSOR_CASE(UInt8Type);
+    SPARSE_TENSOR_FROM_TENSOR_CASE(Int8Type);
+    SPARSE_TENSOR_FROM_TENSOR_CASE(UInt16Type);
+    SPARSE_TENSOR_FROM_TENSOR_CASE(Int16Type);
+    SPARSE_TENSOR_FROM_TENSOR_CASE(UInt32Type);
+    SPARSE_TENSOR_FROM_TENSOR_CASE(Int32Type);
+    SPARSE_TENSOR_FROM_TENSOR_CASE(UInt64Type);
+    SPARSE_TENSOR_FROM_TENSOR_CASE(Int64Type);
+    SPARSE_TENSOR_FROM_TENSOR_CASE(HalfFloatType);
+    SPARSE_TENSOR_FROM_TENSOR_CASE(FloatType);
+    SPARSE_TENSOR_FROM_TENSOR_CASE(DoubleType);
+    default:
+      break;
+  }
+#undef SPARSE_TENSOR_FROM_TENSOR_CASE
+  return Status::NotImplemented("Sparse tensor of ", tensor.type()->ToString());
 }
 
 // ----------------------------------------------------------------------
-// SparseTensorConverter for SparseCSRIndex
+// SparseTensorConverter for SparseCSRIndex and SparseCSCIndex
+
+template <typename TYPE, typename SparseIndexType, int AXIS>
+class SparseMatrixConverter : private SparseTensorConverterBase<TYPE> {
+ public:
+  using BaseClass = SparseTensorConverterBase<TYPE>;
+  using NumericTensorType = typename BaseClass::NumericTensorType;
+  using value_type = typename BaseClass::value_type;
+
+  explicit SparseMatrixConverter(const NumericTensorType& tensor) : BaseClass(tensor) {}
+
+  Status Convert() {
+    const int64_t ndim = tensor_.ndim();
+    if (ndim != 2) {
+      return Status::Invalid("Sparse matrix requires a 2-D tensor, got ", ndim,
+                             " dimensions");
+    }
+
+    std::shared_ptr<Buffer> indptr_buffer;
+    std::shared_ptr<Buffer> indices_buffer;
+    std::shared_ptr<Buffer> values_buffer;
+    int64_t nonzero_count = -1;
+    RETURN_NOT_OK(CompressMatrix(tensor_, AXIS, &indptr_buffer, &indices_buffer,
+                                 &values_buffer, &nonzero_count));
+
+    std::vector<int64_t> indptr_shape({tensor_.shape()[AXIS] + 1});
+    auto indptr_tensor = std::make_shared<typename SparseIndexType::IndexTensor>(
+        indptr_buffer, indptr_shape);
+
+    std::vector<int64_t> indices_shape({nonzero_count});
+    auto indices_tensor = std::make_shared<typename SparseIndexType::IndexTensor>(
+        indices_buffer, indices_shape);
+
+    sparse_index = std::make_shared<SparseIndexType>(indptr_tensor, indices_tensor);
+    data = values_buffer;
+
+    return Status::OK();
+  }
+
+  std::shared_ptr<SparseIndexType> sparse_index;
+  std::shared_ptr<Buffer> data;
+
+ private:
+  using BaseClass::tensor_;
+};
 
 template <typename TYPE>
 class SparseTensorConverter<TYPE, SparseCSRIndex>
+    : public SparseMatrixConverter<TYPE, SparseCSRIndex, 0> {
+ public:
+  using SparseMatrixConverter<TYPE, SparseCSRIndex, 0>::SparseMatrixConverter;
+};
+
+template <typename TYPE>
+class SparseTensorConverter<TYPE, SparseCSCIndex>
+    : public SparseMatrixConverter<TYPE, SparseCSCIndex, 1> {
+ public:
+  using SparseMatrixConverter<TYPE, SparseCSCIndex, 1>::SparseMatrixConverter;
+};
+
+// ----------------------------------------------------------------------
+// SparseTensorConverter for SparseCSFIndex
+
+template <typename TYPE>
+class SparseTensorConverter<TYPE, SparseCSFIndex>
     : private SparseTensorConverterBase<TYPE> {
  public:
   using BaseClass = SparseTensorConverterBase<TYPE>;
@@ -161,61 +399,60 @@ class SparseTensorConverter<TYPE, SparseCSRIndex>
 
   Status Convert() {
     const int64_t ndim = tensor_.ndim();
-    if (ndim > 2) {
+    if (ndim < 1) {
       return Status::Invalid("Invalid tensor dimension");
     }
 
-    const int64_t nr = tensor_.shape()[0];
-    const int64_t nc = tensor_.shape()[1];
-    int64_t nonzero_count = -1;
-    RETURN_NOT_OK(tensor_.CountNonZero(&nonzero_count));
-
-    std::shared_ptr<Buffer> indptr_buffer;
-    std::shared_ptr<Buffer> indices_buffer;
-
-    std::shared_ptr<Buffer> values_buffer;
-    RETURN_NOT_OK(AllocateBuffer(sizeof(value_type) * nonzero_count, &values_buffer));
-    value_type* values = reinterpret_cast<value_type*>(values_buffer->mutable_data());
-
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      RETURN_NOT_OK(AllocateBuffer(sizeof(int64_t) * (nr + 1), &indptr_buffer));
-      int64_t* indptr = reinterpret_cast<int64_t*>(indptr_buffer->mutable_data());
-
-      RETURN_NOT_OK(AllocateBuffer(sizeof(int64_t) * nonzero_count, &indices_buffer));
-      int64_t* indices = reinterpret_cast<int64_t*>(indices_buffer->mutable_data());
-
-      int64_t k = 0;
-      *indptr++ = 0;
-      for (int64_t i = 0; i < nr; ++i) {
-        for (int64_t j = 0; j < nc; ++j) {
-          const value_type x = tensor_.Value({i, j});
-          if (x != 0) {
-            *values++ = x;
-            *indices++ = j;
-            k++;
-          }
+    // The coordinates of the non-zero values, in row-major order, are the
+    // paths from the roots to the leaves of the tree
+    SparseTensorConverter<TYPE, SparseCOOIndex> coo_converter(tensor_);
+    RETURN_NOT_OK(coo_converter.Convert());
+    const int64_t nonzero_count = coo_converter.sparse_index->non_zero_length();
+    const auto& coords_tensor = coo_converter.sparse_index->indices();
+    const int64_t* coords = reinterpret_cast<const int64_t*>(coords_tensor->raw_data());
+
+    std::vector<std::vector<int64_t>> indptr(ndim - 1);
+    std::vector<std::vector<int64_t>> indices(ndim);
+    for (int64_t k = 0; k < nonzero_count; ++k) {
+      // Find the level where the path branches off the previous one
+      int64_t level = 0;
+      if (k > 0) {
+        const int64_t* coord = coords + level * nonzero_count + k;
+        while (level < ndim - 1 && coord[0] == coord[-1]) {
+          ++level;
+          coord += nonzero_count;
+        }
+      }
+      for (int64_t d = level; d < ndim; ++d) {
+        if (d < ndim - 1) {
+          indptr[d].push_back(static_cast<int64_t>(indices[d + 1].size()));
         }
-        *indptr++ = k;
+        indices[d].push_back(coords[d * nonzero_count + k]);
       }
     }
+    for (int64_t d = 0; d < ndim - 1; ++d) {
+      indptr[d].push_back(static_cast<int64_t>(indices[d + 1].size()));
+    }
 
-    std::vector<int64_t> indptr_shape({nr + 1});
-    std::shared_ptr<SparseCSRIndex::IndexTensor> indptr_tensor =
-        std::make_shared<SparseCSRIndex::IndexTensor>(indptr_buffer, indptr_shape);
-
-    std::vector<int64_t> indices_shape({nonzero_count});
-    std::shared_ptr<SparseCSRIndex::IndexTensor> indices_tensor =
-        std::make_shared<SparseCSRIndex::IndexTensor>(indices_buffer, indices_shape);
+    std::vector<std::shared_ptr<SparseCSFIndex::IndexTensor>> indptr_tensors(ndim - 1);
+    for (int64_t d = 0; d < ndim - 1; ++d) {
+      RETURN_NOT_OK(MakeIndexTensor(indptr[d], &indptr_tensors[d]));
+    }
+    std::vector<std::shared_ptr<SparseCSFIndex::IndexTensor>> indices_tensors(ndim);
+    for (int64_t d = 0; d < ndim; ++d) {
+      RETURN_NOT_OK(MakeIndexTensor(indices[d], &indices_tensors[d]));
+    }
+    std::vector<int64_t> axis_order(ndim);
+    std::iota(axis_order.begin(), axis_order.end(), 0);
 
-    sparse_index = std::make_shared<SparseCSRIndex>(indptr_tensor, indices_tensor);
-    data = values_buffer;
+    sparse_index =
+        std::make_shared<SparseCSFIndex>(indptr_tensors, indices_tensors, axis_order);
+    data = coo_converter.data;
 
     return Status::OK();
   }
 
-  std::shared_ptr<SparseCSRIndex> sparse_index;
+  std::shared_ptr<SparseCSFIndex> sparse_index;
   std::shared_ptr<Buffer> data;
 
  private:
@@ -240,6 +477,8 @@ class SparseTensorConverter<TYPE, SparseCSRIndex>
 
 INSTANTIATE_SPARSE_TENSOR_CONVERTER(SparseCOOIndex);
 INSTANTIATE_SPARSE_TENSOR_CONVERTER(SparseCSRIndex);
+INSTANTIATE_SPARSE_TENSOR_CONVERTER(SparseCSCIndex);
+INSTANTIATE_SPARSE_TENSOR_CONVERTER(SparseCSFIndex);
 
 }  // namespace
 
@@ -267,6 +506,53 @@ SparseCSRIndex::SparseCSRIndex(const std::shared_ptr<IndexTensor>& indptr,
 
 std::string SparseCSRIndex::ToString() const { return std::string("SparseCSRIndex"); }
 
+// ----------------------------------------------------------------------
+// SparseCSCIndex
+
+// Constructor with two index vectors
+SparseCSCIndex::SparseCSCIndex(const std::shared_ptr<IndexTensor>& indptr,
+                               const std::shared_ptr<IndexTensor>& indices)
+    : SparseIndexBase(indices->shape()[0]), indptr_(indptr), indices_(indices) {
+  DCHECK_EQ(1, indptr_->ndim());
+  DCHECK_EQ(1, indices_->ndim());
+}
+
+std::string SparseCSCIndex::ToString() const { return std::string("SparseCSCIndex"); }
+
+// ----------------------------------------------------------------------
+// SparseCSFIndex
+
+// Constructor with the index vectors of each level
+SparseCSFIndex::SparseCSFIndex(const std::vector<std::shared_ptr<IndexTensor>>& indptr,
+                               const std::vector<std::shared_ptr<IndexTensor>>& indices,
+                               const std::vector<int64_t>& axis_order)
+    : SparseIndexBase(indices.empty() ? 0 : indices.back()->shape()[0]),
+      indptr_(indptr),
+      indices_(indices),
+      axis_order_(axis_order) {
+  DCHECK_EQ(indices_.size(), axis_order_.size());
+  DCHECK_EQ(indptr_.size() + 1, indices_.size());
+}
+
+std::string SparseCSFIndex::ToString() const { return std::string("SparseCSFIndex"); }
+
+bool SparseCSFIndex::Equals(const SparseCSFIndex& other) const {
+  if (axis_order() != other.axis_order() || indptr().size() != other.indptr().size()) {
+    return false;
+  }
+  for (size_t i = 0; i < indptr().size(); ++i) {
+    if (!indptr()[i]->Equals(*other.indptr()[i])) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < indices().size(); ++i) {
+    if (!indices()[i]->Equals(*other.indices()[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
 // ----------------------------------------------------------------------
 // SparseTensor
 
@@ -329,54 +615,21 @@ template <typename SparseIndexType>
 SparseTensorImpl<SparseIndexType>::SparseTensorImpl(const Tensor& tensor)
     : SparseTensorImpl(nullptr, tensor.type(), nullptr, tensor.shape(),
                        tensor.dim_names_) {
-  switch (tensor.type()->id()) {
-    case Type::UINT8:
-      MakeSparseTensorFromTensor<UInt8Type, SparseIndexType>(tensor, &sparse_index_,
-                                                             &data_);
-      return;
-    case Type::INT8:
-      MakeSparseTensorFromTensor<Int8Type, SparseIndexType>(tensor, &sparse_index_,
-                                                            &data_);
-      return;
-    case Type::UINT16:
-      MakeSparseTensorFromTensor<UInt16Type, SparseIndexType>(tensor, &sparse_index_,
-                                                              &data_);
-      return;
-    case Type::INT16:
-      MakeSparseTensorFromTensor<Int16Type, SparseIndexType>(tensor, &sparse_index_,
-                                                             &data_);
-      return;
-    case Type::UINT32:
-      MakeSparseTensorFromTensor<UInt32Type, SparseIndexType>(tensor, &sparse_index_,
-                                                              &data_);
-      return;
-    case Type::INT32:
-      MakeSparseTensorFromTensor<Int32Type, SparseIndexType>(tensor, &sparse_index_,
-                                                             &data_);
-      return;
-    case Type::UINT64:
-      MakeSparseTensorFromTensor<UInt64Type, SparseIndexType>(tensor, &sparse_index_,
-                                                              &data_);
-      return;
-    case Type::INT64:
-      MakeSparseTensorFromTensor<Int64Type, SparseIndexType>(tensor, &sparse_index_,
-                                                             &data_);
-      return;
-    case Type::HALF_FLOAT:
-      MakeSparseTensorFromTensor<HalfFloatType, SparseIndexType>(tensor, &sparse_index_,
-                                                                 &data_);
-      return;
-    case Type::FLOAT:
-      MakeSparseTensorFromTensor<FloatType, SparseIndexType>(tensor, &sparse_index_,
-                                                             &data_);
-      return;
-    case Type::DOUBLE:
-      MakeSparseTensorFromTensor<DoubleType, SparseIndexType>(tensor, &sparse_index_,
-                                                              &data_);
-      return;
-    default:
-      break;
-  }
+  DCHECK_OK(MakeSparseTensorFromTensor<SparseIndexType>(tensor, &sparse_index_, &data_));
+}
+
+// Factory with a dense tensor
+template <typename SparseIndexType>
+Status SparseTensorImpl<SparseIndexType>::Make(
+    const Tensor& tensor, std::shared_ptr<SparseTensorImpl<SparseIndexType>>* out) {
+  std::shared_ptr<SparseIndex> sparse_index;
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(
+      MakeSparseTensorFromTensor<SparseIndexType>(tensor, &sparse_index, &data));
+  *out = std::make_shared<SparseTensorImpl<SparseIndexType>>(
+      internal::checked_pointer_cast<SparseIndexType>(sparse_index), tensor.type(), data,
+      tensor.shape(), tensor.dim_names_);
+  return Status::OK();
 }
 
 // ----------------------------------------------------------------------
@@ -409,5 +662,7 @@ SparseTensorImpl<SparseIndexType>::SparseTensorImpl(const Tensor& tensor)
 
 INSTANTIATE_SPARSE_TENSOR(SparseCOOIndex);
 INSTANTIATE_SPARSE_TENSOR(SparseCSRIndex);
+INSTANTIATE_SPARSE_TENSOR(SparseCSCIndex);
+INSTANTIATE_SPARSE_TENSOR(SparseCSFIndex);
 
 }  // namespace arrow
@@ -22,6 +22,7 @@
 #include <string>
 #include <vector>
 
+#include "arrow/status.h"
 #include "arrow/tensor.h"
 
 namespace arrow {
@@ -31,7 +32,7 @@ namespace arrow {
 
 /// \brief EXPERIMENTAL: Sparse tensor format enumeration
 struct SparseTensorFormat {
-  enum type { COO, CSR };
+  enum type { COO, CSR, CSC, CSF };
 };
 
 /// \brief EXPERIMENTAL: The base class for representing index of non-zero
@@ -113,6 +114,71 @@ class ARROW_EXPORT SparseCSRIndex : public SparseIndexBase<SparseCSRIndex> {
   std::shared_ptr<IndexTensor> indices_;
 };
 
+// ----------------------------------------------------------------------
+// SparseCSCIndex class
+
+/// \brief EXPERIMENTAL: The index data for CSC sparse matrix
+class ARROW_EXPORT SparseCSCIndex : public SparseIndexBase<SparseCSCIndex> {
+ public:
+  using IndexTensor = NumericTensor<Int64Type>;
+
+  static constexpr SparseTensorFormat::type format_id = SparseTensorFormat::CSC;
+
+  // Constructor with two index vectors: indptr spans the columns, and indices
+  // contains the row indices of the non-zero values
+  explicit SparseCSCIndex(const std::shared_ptr<IndexTensor>& indptr,
+                          const std::shared_ptr<IndexTensor>& indices);
+
+  const std::shared_ptr<IndexTensor>& indptr() const { return indptr_; }
+  const std::shared_ptr<IndexTensor>& indices() const { return indices_; }
+
+  std::string ToString() const override;
+
+  bool Equals(const SparseCSCIndex& other) const {
+    return indptr()->Equals(*other.indptr()) && indices()->Equals(*other.indices());
+  }
+
+ protected:
+  std::shared_ptr<IndexTensor> indptr_;
+  std::shared_ptr<IndexTensor> indices_;
+};
+
+// ----------------------------------------------------------------------
+// SparseCSFIndex class
+
+/// \brief EXPERIMENTAL: The index data for CSF sparse tensor
+///
+/// The compressed sparse fiber format stores the non-zero coordinates as a
+/// tree with one level per dimension, in the order given by axis_order.
+/// indices[i] contains the coordinates along dimension axis_order[i] of the
+/// nodes of level i, and the children of the j-th node of level i are the
+/// nodes indptr[i][j] to indptr[i][j + 1] of level i + 1.  The leaves are in
+/// the same order as the non-zero values.
+class ARROW_EXPORT SparseCSFIndex : public SparseIndexBase<SparseCSFIndex> {
+ public:
+  using IndexTensor = NumericTensor<Int64Type>;
+
+  static constexpr SparseTensorFormat::type format_id = SparseTensorFormat::CSF;
+
+  // Constructor with ndim - 1 indptr vectors and ndim indices vectors
+  explicit SparseCSFIndex(const std::vector<std::shared_ptr<IndexTensor>>& indptr,
+                          const std::vector<std::shared_ptr<IndexTensor>>& indices,
+                          const std::vector<int64_t>& axis_order);
+
+  const std::vector<std::shared_ptr<IndexTensor>>& indptr() const { return indptr_; }
+  const std::vector<std::shared_ptr<IndexTensor>>& indices() const { return indices_; }
+  const std::vector<int64_t>& axis_order() const { return axis_order_; }
+
+  std::string ToString() const override;
+
+  bool Equals(const SparseCSFIndex& other) const;
+
+ protected:
+  std::vector<std::shared_ptr<IndexTensor>> indptr_;
+  std::vector<std::shared_ptr<IndexTensor>> indices_;
+  std::vector<int64_t> axis_order_;
+};
+
 // ----------------------------------------------------------------------
 // SparseTensor class
 
@@ -194,8 +260,17 @@ class ARROW_EXPORT SparseTensorImpl : public SparseTensor {
   explicit SparseTensorImpl(const NumericTensor<TYPE>& tensor);
 
   // Constructor with a dense tensor
+  //
+  // Large tensors are converted in parallel on the CPU thread pool.
   explicit SparseTensorImpl(const Tensor& tensor);
 
+  /// \brief Create a sparse tensor from a dense tensor
+  ///
+  /// Unlike the constructor, this returns an error if the tensor cannot be
+  /// converted, such as a tensor that isn't 2-D for a sparse matrix.
+  static Status Make(const Tensor& tensor,
+                     std::shared_ptr<SparseTensorImpl<SparseIndexType>>* out);
+
  private:
   ARROW_DISALLOW_COPY_AND_ASSIGN(SparseTensorImpl);
 };
@@ -207,6 +282,12 @@ using SparseTensorCOO = SparseTensorImpl<SparseCOOIndex>;
 using SparseTensorCSR = SparseTensorImpl<SparseCSRIndex>;
 using SparseMatrixCSR = SparseTensorImpl<SparseCSRIndex>;
 
+/// \brief EXPERIMENTAL: Type alias for CSC sparse matrix
+using SparseMatrixCSC = SparseTensorImpl<SparseCSCIndex>;
+
+/// \brief EXPERIMENTAL: Type alias for CSF sparse tensor
+using SparseTensorCSF = SparseTensorImpl<SparseCSFIndex>;
+
 }  // namespace arrow
 
 #endif  // ARROW_SPARSE_TENSOR_H
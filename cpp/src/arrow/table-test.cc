@@ -358,6 +358,39 @@ TEST_F(TestTable, Equals) {
 
   other = Table::Make(schema_, other_columns);
   ASSERT_FALSE(table_->Equals(*other));
+  ASSERT_FALSE(table_->Equals(*other, /*use_threads=*/true));
+}
+
+TEST_F(TestTable, EqualsWithThreads) {
+  const int length = 100;
+  MakeExample1(length);
+
+  table_ = Table::Make(schema_, columns_);
+  ASSERT_TRUE(table_->Equals(*table_, /*use_threads=*/true));
+
+  // Same data with a different chunking
+  std::vector<std::shared_ptr<Column>> rechunked_columns;
+  for (int i = 0; i < schema_->num_fields(); ++i) {
+    ArrayVector chunks = {arrays_[i]->Slice(0, 30), arrays_[i]->Slice(30, 0),
+                          arrays_[i]->Slice(30, 45), arrays_[i]->Slice(75)};
+    rechunked_columns.push_back(std::make_shared<Column>(schema_->field(i), chunks));
+  }
+  auto rechunked = Table::Make(schema_, rechunked_columns);
+  ASSERT_TRUE(table_->Equals(*rechunked));
+  ASSERT_TRUE(table_->Equals(*rechunked, /*use_threads=*/true));
+  ASSERT_TRUE(rechunked->Equals(*table_, /*use_threads=*/true));
+
+  // A single differing value in the last column
+  std::vector<std::shared_ptr<Column>> other_columns = rechunked_columns;
+  std::shared_ptr<Array> last;
+  const int16_t* raw_values = static_cast<const Int16Array&>(*arrays_[2]).raw_values();
+  std::vector<int16_t> values(raw_values, raw_values + length);
+  values[80] = static_cast<int16_t>(values[80] + 1);
+  ArrayFromVector<Int16Type, int16_t>(values, &last);
+  other_columns[2] = std::make_shared<Column>(schema_->field(2), last);
+  auto other = Table::Make(schema_, other_columns);
+  ASSERT_FALSE(table_->Equals(*other));
+  ASSERT_FALSE(table_->Equals(*other, /*use_threads=*/true));
 }
 
 TEST_F(TestTable, FromRecordBatches) {
@@ -830,4 +863,130 @@ TEST_F(TestTableBatchReader, Chunksize) {
   ASSERT_EQ(nullptr, batch);
 }
 
+class TestRecordBatchReaderAdapters : public TestBase {
+ public:
+  void SetUp() override {
+    TestBase::SetUp();
+    schema_ = ::arrow::schema({field("f0", int32()), field("f1", int16())});
+    for (int64_t length : {10, 0, 25, 5, 30}) {
+      const int64_t null_count = length / 5;
+      batches_.push_back(RecordBatch::Make(
+          schema_, length,
+          {MakeRandomArray<Int32Array>(length, null_count),
+           MakeRandomArray<Int16Array>(length)}));
+    }
+    ASSERT_OK(Table::FromRecordBatches(schema_, batches_, &table_));
+  }
+
+  std::shared_ptr<RecordBatchReader> MakeSource() {
+    return std::make_shared<BatchIterator>(schema_, batches_);
+  }
+
+  void ReadAll(RecordBatchReader* reader, std::vector<int64_t> expected_lengths,
+               std::shared_ptr<Table>* out) {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    ASSERT_OK(reader->ReadAll(&batches));
+    std::vector<int64_t> lengths;
+    for (const auto& batch : batches) {
+      ASSERT_OK(batch->Validate());
+      ASSERT_TRUE(batch->schema()->Equals(*reader->schema()));
+      lengths.push_back(batch->num_rows());
+    }
+    ASSERT_EQ(expected_lengths, lengths);
+    ASSERT_OK(Table::FromRecordBatches(reader->schema(), batches, out));
+  }
+
+  // Rows [offset, offset + length) of the source as a table
+  std::shared_ptr<Table> SliceSource(int64_t offset, int64_t length) {
+    std::vector<std::shared_ptr<Column>> columns;
+    for (int i = 0; i < table_->num_columns(); ++i) {
+      columns.push_back(table_->column(i)->Slice(offset, length));
+    }
+    return Table::Make(schema_, columns);
+  }
+
+ protected:
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::shared_ptr<RecordBatch>> batches_;
+  std::shared_ptr<Table> table_;
+};
+
+TEST_F(TestRecordBatchReaderAdapters, Project) {
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(ProjectRecordBatchReader(MakeSource(), {1, 0, 1}, &reader));
+  auto expected_schema =
+      ::arrow::schema({field("f1", int16()), field("f0", int32()), field("f1", int16())});
+  ASSERT_TRUE(reader->schema()->Equals(*expected_schema));
+
+  std::shared_ptr<Table> result;
+  ReadAll(reader.get(), {10, 0, 25, 5, 30}, &result);
+  ASSERT_EQ(3, result->num_columns());
+  ASSERT_TRUE(result->column(0)->data()->Equals(table_->column(1)->data()));
+  ASSERT_TRUE(result->column(1)->data()->Equals(table_->column(0)->data()));
+  ASSERT_TRUE(result->column(2)->data()->Equals(table_->column(1)->data()));
+
+  ASSERT_RAISES(Invalid, ProjectRecordBatchReader(MakeSource(), {0, 2}, &reader));
+  ASSERT_RAISES(Invalid, ProjectRecordBatchReader(MakeSource(), {-1}, &reader));
+}
+
+TEST_F(TestRecordBatchReaderAdapters, Slice) {
+  std::shared_ptr<RecordBatchReader> reader;
+  std::shared_ptr<Table> result;
+
+  ASSERT_OK(SliceRecordBatchReader(MakeSource(), 0, 100, &reader));
+  ReadAll(reader.get(), {10, 25, 5, 30}, &result);
+  ASSERT_TRUE(result->Equals(*table_));
+
+  ASSERT_OK(SliceRecordBatchReader(MakeSource(), 12, 20, &reader));
+  ReadAll(reader.get(), {20}, &result);
+  ASSERT_TRUE(result->Equals(*SliceSource(12, 20)));
+
+  ASSERT_OK(SliceRecordBatchReader(MakeSource(), 10, 31, &reader));
+  ReadAll(reader.get(), {25, 5, 1}, &result);
+  ASSERT_TRUE(result->Equals(*SliceSource(10, 31)));
+
+  ASSERT_OK(SliceRecordBatchReader(MakeSource(), 65, 10, &reader));
+  ReadAll(reader.get(), {5}, &result);
+  ASSERT_TRUE(result->Equals(*SliceSource(65, 5)));
+
+  ASSERT_OK(SliceRecordBatchReader(MakeSource(), 70, 10, &reader));
+  ReadAll(reader.get(), {}, &result);
+  ASSERT_OK(SliceRecordBatchReader(MakeSource(), 0, 0, &reader));
+  ReadAll(reader.get(), {}, &result);
+
+  ASSERT_RAISES(Invalid, SliceRecordBatchReader(MakeSource(), -1, 10, &reader));
+  ASSERT_RAISES(Invalid, SliceRecordBatchReader(MakeSource(), 0, -1, &reader));
+}
+
+TEST_F(TestRecordBatchReaderAdapters, Rechunk) {
+  std::shared_ptr<RecordBatchReader> reader;
+  std::shared_ptr<Table> result;
+
+  ASSERT_OK(RechunkRecordBatchReader(MakeSource(), 8, pool_, &reader));
+  ReadAll(reader.get(), {8, 8, 8, 8, 8, 8, 8, 8, 6}, &result);
+  ASSERT_TRUE(result->Equals(*table_));
+
+  ASSERT_OK(RechunkRecordBatchReader(MakeSource(), 40, pool_, &reader));
+  ReadAll(reader.get(), {40, 30}, &result);
+  ASSERT_TRUE(result->Equals(*table_));
+
+  ASSERT_OK(RechunkRecordBatchReader(MakeSource(), 100, pool_, &reader));
+  ReadAll(reader.get(), {70}, &result);
+  ASSERT_TRUE(result->Equals(*table_));
+
+  ASSERT_RAISES(Invalid, RechunkRecordBatchReader(MakeSource(), 0, pool_, &reader));
+}
+
+TEST_F(TestRecordBatchReaderAdapters, Compose) {
+  // Rechunk a projected slice of the source
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(SliceRecordBatchReader(MakeSource(), 5, 60, &reader));
+  ASSERT_OK(ProjectRecordBatchReader(reader, {1}, &reader));
+  ASSERT_OK(RechunkRecordBatchReader(reader, 16, pool_, &reader));
+
+  std::shared_ptr<Table> result;
+  ReadAll(reader.get(), {16, 16, 16, 12}, &result);
+  ASSERT_TRUE(result->column(0)->data()->Equals(SliceSource(5, 60)->column(1)->data()));
+}
+
 }  // namespace arrow
@@ -18,24 +18,86 @@
 #include "arrow/table.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <limits>
 #include <memory>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/stl.h"
 
 namespace arrow {
 
 using internal::checked_cast;
 
+namespace {
+
+// Number of rows compared by a single task in a multi-threaded Table::Equals
+constexpr int64_t kTableEqualsPieceLength = 1 << 20;
+
+// Call visit(left, left_start, right, right_start, length) on the row ranges
+// that lie within a single chunk of both chunked arrays, splitting ranges
+// longer than max_length.  Stops at the first call returning false.
+template <typename Visitor>
+bool VisitCommonRanges(const ChunkedArray& left, const ChunkedArray& right,
+                       int64_t max_length, Visitor&& visit) {
+  DCHECK_EQ(left.length(), right.length());
+  int left_chunk_idx = 0;
+  int64_t left_start_idx = 0;
+  int right_chunk_idx = 0;
+  int64_t right_start_idx = 0;
+
+  int64_t elements_visited = 0;
+  while (elements_visited < left.length()) {
+    const std::shared_ptr<Array>& left_array = left.chunk(left_chunk_idx);
+    const std::shared_ptr<Array>& right_array = right.chunk(right_chunk_idx);
+    int64_t common_length = std::min(left_array->length() - left_start_idx,
+                                     right_array->length() - right_start_idx);
+    common_length = std::min(common_length, max_length);
+    if (common_length > 0 &&
+        !visit(left_array, left_start_idx, right_array, right_start_idx,
+               common_length)) {
+      return false;
+    }
+
+    elements_visited += common_length;
+
+    // If we have exhausted the current chunk, proceed to the next one individually.
+    if (left_start_idx + common_length == left_array->length()) {
+      left_chunk_idx++;
+      left_start_idx = 0;
+    } else {
+      left_start_idx += common_length;
+    }
+
+    if (right_start_idx + common_length == right_array->length()) {
+      right_chunk_idx++;
+      right_start_idx = 0;
+    } else {
+      right_start_idx += common_length;
+    }
+  }
+  return true;
+}
+
+bool RangeEqualsVisitor(const std::shared_ptr<Array>& left, int64_t left_start,
+                        const std::shared_ptr<Array>& right, int64_t right_start,
+                        int64_t length) {
+  return left->RangeEquals(left_start, left_start + length, right_start, right);
+}
+
+}  // namespace
+
 // ----------------------------------------------------------------------
 // ChunkedArray and Column methods
 
@@ -75,40 +137,8 @@ bool ChunkedArray::Equals(const ChunkedArray& other) const {
 
   // Check contents of the underlying arrays. This checks for equality of
   // the underlying data independently of the chunk size.
-  int this_chunk_idx = 0;
-  int64_t this_start_idx = 0;
-  int other_chunk_idx = 0;
-  int64_t other_start_idx = 0;
-
-  int64_t elements_compared = 0;
-  while (elements_compared < length_) {
-    const std::shared_ptr<Array> this_array = chunks_[this_chunk_idx];
-    const std::shared_ptr<Array> other_array = other.chunk(other_chunk_idx);
-    int64_t common_length = std::min(this_array->length() - this_start_idx,
-                                     other_array->length() - other_start_idx);
-    if (!this_array->RangeEquals(this_start_idx, this_start_idx + common_length,
-                                 other_start_idx, other_array)) {
-      return false;
-    }
-
-    elements_compared += common_length;
-
-    // If we have exhausted the current chunk, proceed to the next one individually.
-    if (this_start_idx + common_length == this_array->length()) {
-      this_chunk_idx++;
-      this_start_idx = 0;
-    } else {
-      this_start_idx += common_length;
-    }
-
-    if (other_start_idx + common_length == other_array->length()) {
-      other_chunk_idx++;
-      other_start_idx = 0;
-    } else {
-      other_start_idx += common_length;
-    }
-  }
-  return true;
+  return VisitCommonRanges(*this, other, std::numeric_limits<int64_t>::max(),
+                           RangeEqualsVisitor);
 }
 
 bool ChunkedArray::Equals(const std::shared_ptr<ChunkedArray>& other) const {
@@ -436,6 +466,31 @@ Status Table::FromRecordBatches(const std::vector<std::shared_ptr<RecordBatch>>&
   return FromRecordBatches(batches[0]->schema(), batches, table);
 }
 
+Status Table::CombineChunks(MemoryPool* pool, std::shared_ptr<Table>* out) const {
+  const int ncolumns = num_columns();
+  std::vector<std::shared_ptr<Field>> fields(ncolumns);
+  std::vector<std::shared_ptr<Column>> columns(ncolumns);
+  for (int i = 0; i < ncolumns; ++i) {
+    std::shared_ptr<Column> col = column(i);
+    fields[i] = col->field();
+    if (col->data()->num_chunks() <= 1) {
+      columns[i] = col;
+      continue;
+    }
+    std::shared_ptr<Array> combined;
+    RETURN_NOT_OK(Concatenate(col->data()->chunks(), pool, &combined));
+    if (!combined->type()->Equals(*col->type())) {
+      // The dictionaries were unified
+      fields[i] = std::make_shared<Field>(col->name(), combined->type(),
+                                          col->field()->nullable(),
+                                          col->field()->metadata());
+    }
+    columns[i] = std::make_shared<Column>(fields[i], combined);
+  }
+  *out = Table::Make(::arrow::schema(fields, schema_->metadata()), columns, num_rows_);
+  return Status::OK();
+}
+
 Status ConcatenateTables(const std::vector<std::shared_ptr<Table>>& tables,
                          std::shared_ptr<Table>* table) {
   if (tables.size() == 0) {
@@ -471,7 +526,7 @@ Status ConcatenateTables(const std::vector<std::shared_ptr<Table>>& tables,
   return Status::OK();
 }
 
-bool Table::Equals(const Table& other) const {
+bool Table::Equals(const Table& other, bool use_threads) const {
   if (this == &other) {
     return true;
   }
@@ -482,12 +537,56 @@ bool Table::Equals(const Table& other) const {
     return false;
   }
 
+  if (!use_threads) {
+    for (int i = 0; i < this->num_columns(); i++) {
+      if (!this->column(i)->Equals(other.column(i))) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Settle the cheap checks serially, then compare column pieces of bounded
+  // size as separate tasks
+  if (num_rows_ != other.num_rows()) {
+    return false;
+  }
+  struct Piece {
+    std::shared_ptr<Array> left, right;
+    int64_t left_start, right_start, length;
+  };
+  std::vector<Piece> pieces;
   for (int i = 0; i < this->num_columns(); i++) {
-    if (!this->column(i)->Equals(other.column(i))) {
+    const ChunkedArray& left = *this->column(i)->data();
+    const ChunkedArray& right = *other.column(i)->data();
+    if (left.length() != right.length() || left.null_count() != right.null_count()) {
       return false;
     }
-  }
-  return true;
+    VisitCommonRanges(left, right, kTableEqualsPieceLength,
+                      [&](const std::shared_ptr<Array>& left_array, int64_t left_start,
+                          const std::shared_ptr<Array>& right_array,
+                          int64_t right_start, int64_t length) -> bool {
+                        pieces.push_back(
+                            {left_array, right_array, left_start, right_start, length});
+                        return true;
+                      });
+  }
+
+  std::atomic<bool> equal(true);
+  auto compare_piece = [&](int i) -> Status {
+    // Skip the remaining pieces once a difference has been found
+    if (equal.load()) {
+      const Piece& piece = pieces[i];
+      if (!RangeEqualsVisitor(piece.left, piece.left_start, piece.right,
+                              piece.right_start, piece.length)) {
+        equal.store(false);
+      }
+    }
+    return Status::OK();
+  };
+  Status st = internal::ParallelFor(static_cast<int>(pieces.size()), compare_piece);
+  DCHECK_OK(st);
+  return equal.load();
 }
 
 // ----------------------------------------------------------------------
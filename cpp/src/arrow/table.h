@@ -285,6 +285,15 @@ class ARROW_EXPORT Table {
   /// \brief Perform any checks to validate the input arguments
   virtual Status Validate() const = 0;
 
+  /// \brief Make a new table by combining the chunks of each column into a
+  /// single contiguous array, with Concatenate
+  ///
+  /// Columns of dictionary arrays with different dictionaries get a unified
+  /// dictionary type.
+  /// \param[in] pool The pool for buffer allocations
+  /// \param[out] out The returned table
+  Status CombineChunks(MemoryPool* pool, std::shared_ptr<Table>* out) const;
+
   /// \brief Return the number of columns in the table
   int num_columns() const { return schema_->num_fields(); }
 
@@ -295,7 +304,10 @@ class ARROW_EXPORT Table {
   ///
   /// Two tables can be equal only if they have equal schemas.
   /// However, they may be equal even if they have different chunkings.
-  bool Equals(const Table& other) const;
+  /// \param[in] other the table to compare with
+  /// \param[in] use_threads if true, compare pieces of the columns in parallel
+  /// on the CPU thread pool
+  bool Equals(const Table& other, bool use_threads = false) const;
 
  protected:
   Table();
@@ -24,7 +24,11 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
@@ -260,4 +264,139 @@ TEST(TestNumericTensor, ElementAccessWithNonContiguousStrides) {
   ASSERT_EQ(11.1f, t_f32.Value({2, 2}));
 }
 
+class TestTensorConversion : public ::testing::Test {
+ public:
+  void SetUp() {
+    auto f0 = field("f0", int64(), false);
+    auto f1 = field("f1", int64(), false);
+    auto f2 = field("f2", int64(), false);
+    batch_ = RecordBatch::Make(schema({f0, f1, f2}), 2,
+                               {ArrayFromJSON(int64(), "[1, 4]"),
+                                ArrayFromJSON(int64(), "[2, 5]"),
+                                ArrayFromJSON(int64(), "[3, 6]")});
+  }
+
+  // A batch of num_rows rows of num_columns int32 columns, where the value of row i of
+  // column j is i * num_columns + j
+  std::shared_ptr<RecordBatch> MakeLargeBatch(int64_t num_rows, int num_columns) {
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int j = 0; j < num_columns; ++j) {
+      std::vector<int32_t> values;
+      for (int64_t i = 0; i < num_rows; ++i) {
+        values.push_back(static_cast<int32_t>(i * num_columns + j));
+      }
+      std::shared_ptr<Array> column;
+      ArrayFromVector<Int32Type, int32_t>(values, &column);
+      fields.push_back(field(std::to_string(j), int32(), false));
+      columns.push_back(column);
+    }
+    return RecordBatch::Make(schema(fields), num_rows, columns);
+  }
+
+ protected:
+  std::shared_ptr<RecordBatch> batch_;
+};
+
+TEST_F(TestTensorConversion, RecordBatchToTensor) {
+  std::shared_ptr<Tensor> tensor;
+  ASSERT_OK(RecordBatchToTensor(*batch_, true, false, default_memory_pool(), &tensor));
+  std::vector<int64_t> row_major_values = {1, 2, 3, 4, 5, 6};
+  Tensor row_major(int64(), Buffer::Wrap(row_major_values), {2, 3});
+  ASSERT_TRUE(tensor->is_row_major());
+  ASSERT_TRUE(tensor->Equals(row_major));
+
+  ASSERT_OK(RecordBatchToTensor(*batch_, false, false, default_memory_pool(), &tensor));
+  std::vector<int64_t> column_major_values = {1, 4, 2, 5, 3, 6};
+  Tensor column_major(int64(), Buffer::Wrap(column_major_values), {2, 3}, {8, 16});
+  ASSERT_TRUE(tensor->is_column_major());
+  ASSERT_TRUE(tensor->Equals(column_major));
+}
+
+TEST_F(TestTensorConversion, SingleColumnIsNotCopied) {
+  auto column = ArrayFromJSON(float64(), "[1, 2, 3, 4]")->Slice(1);
+  auto batch = RecordBatch::Make(schema({field("f0", float64())}), 3, {column});
+  std::shared_ptr<Tensor> tensor;
+  ASSERT_OK(RecordBatchToTensor(*batch, true, false, default_memory_pool(), &tensor));
+  ASSERT_EQ(tensor->shape(), std::vector<int64_t>({3, 1}));
+  ASSERT_EQ(tensor->raw_data(), column->data()->buffers[1]->data() + sizeof(double));
+}
+
+TEST_F(TestTensorConversion, InvalidColumns) {
+  std::shared_ptr<Tensor> tensor;
+  auto int64_schema = schema({field("f0", int64()), field("f1", int64())});
+  auto with_nulls = RecordBatch::Make(int64_schema, 2,
+                                      {ArrayFromJSON(int64(), "[1, null]"),
+                                       ArrayFromJSON(int64(), "[2, 3]")});
+  ASSERT_RAISES(Invalid,
+                RecordBatchToTensor(*with_nulls, true, false, default_memory_pool(),
+                                    &tensor));
+
+  auto mixed = RecordBatch::Make(schema({field("f0", int64()), field("f1", int32())}),
+                                 2,
+                                 {ArrayFromJSON(int64(), "[1, 2]"),
+                                  ArrayFromJSON(int32(), "[3, 4]")});
+  ASSERT_RAISES(TypeError, RecordBatchToTensor(*mixed, true, false,
+                                               default_memory_pool(), &tensor));
+}
+
+TEST_F(TestTensorConversion, TableToTensor) {
+  std::shared_ptr<Table> table;
+  ASSERT_OK(Table::FromRecordBatches({batch_, batch_}, &table));
+  std::shared_ptr<Tensor> tensor;
+  ASSERT_OK(TableToTensor(*table, true, false, default_memory_pool(), &tensor));
+  std::vector<int64_t> values = {1, 2, 3, 4, 5, 6, 1, 2, 3, 4, 5, 6};
+  Tensor expected(int64(), Buffer::Wrap(values), {4, 3});
+  ASSERT_TRUE(tensor->Equals(expected));
+}
+
+TEST_F(TestTensorConversion, TensorToRecordBatch) {
+  // Row-major tensors are transposed
+  std::vector<int64_t> row_major_values = {1, 2, 3, 4, 5, 6};
+  Tensor row_major(int64(), Buffer::Wrap(row_major_values), {2, 3});
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(TensorToRecordBatch(row_major, {"f0", "f1", "f2"}, false,
+                                default_memory_pool(), &batch));
+  ASSERT_TRUE(batch->Equals(*batch_));
+
+  // The columns of column-major tensors are slices of the tensor
+  std::vector<int64_t> column_major_values = {1, 4, 2, 5, 3, 6};
+  Tensor column_major(int64(), Buffer::Wrap(column_major_values), {2, 3}, {8, 16});
+  ASSERT_OK(TensorToRecordBatch(column_major, {"f0", "f1", "f2"}, false,
+                                default_memory_pool(), &batch));
+  ASSERT_TRUE(batch->Equals(*batch_));
+  ASSERT_EQ(batch->column(1)->data()->buffers[1]->data(),
+            column_major.raw_data() + 2 * sizeof(int64_t));
+
+  ASSERT_OK(TensorToRecordBatch(row_major, {}, false, default_memory_pool(), &batch));
+  ASSERT_EQ(batch->column_name(2), "2");
+  ASSERT_RAISES(Invalid, TensorToRecordBatch(row_major, {"f0"}, false,
+                                             default_memory_pool(), &batch));
+}
+
+TEST_F(TestTensorConversion, LargeRoundTrip) {
+  // Spans several tiles and parallel tasks
+  const int64_t num_rows = 40000;
+  const int num_columns = 21;
+  auto batch = MakeLargeBatch(num_rows, num_columns);
+
+  for (bool row_major : {true, false}) {
+    std::shared_ptr<Tensor> tensor;
+    ASSERT_OK(RecordBatchToTensor(*batch, row_major, true, default_memory_pool(),
+                                  &tensor));
+    ASSERT_EQ(tensor->shape(), std::vector<int64_t>({num_rows, num_columns}));
+    NumericTensor<Int32Type> values(tensor->data(), tensor->shape(), tensor->strides());
+    for (int64_t i : {int64_t(0), int64_t(255), int64_t(256), int64_t(num_rows - 1)}) {
+      for (int64_t j : {0, 15, 16, num_columns - 1}) {
+        ASSERT_EQ(values.Value({i, j}), i * num_columns + j);
+      }
+    }
+
+    std::shared_ptr<RecordBatch> round_trip;
+    ASSERT_OK(TensorToRecordBatch(*tensor, {}, true, default_memory_pool(),
+                                  &round_trip));
+    ASSERT_TRUE(round_trip->Equals(*batch));
+  }
+}
+
 }  // namespace arrow
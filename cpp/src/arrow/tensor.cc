@@ -17,6 +17,7 @@
 
 #include "arrow/tensor.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -26,11 +27,15 @@
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array.h"
 #include "arrow/compare.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -193,4 +198,305 @@ Status Tensor::CountNonZero(int64_t* result) const {
   return VisitTypeInline(*type(), &counter);
 }
 
+// ----------------------------------------------------------------------
+// Conversion between record batches and 2-D tensors
+
+namespace {
+
+// The transpositions between columns and a 2-D tensor go through tiles of kTileRows
+// rows and kTileColumns columns, so that the rows of a tile stay in cache while its
+// columns are read or written.
+constexpr int64_t kTileRows = 256;
+constexpr int64_t kTileColumns = 16;
+
+// The number of rows transposed by each task when running in parallel
+constexpr int64_t kRowsPerTask = 1 << 14;
+
+// Copies the rows [row_begin, row_end) of columns to a strided 2-D array, the strides
+// counting values. The inner loop reads a column sequentially and, for a column-major
+// array, writes sequentially too.
+template <typename T>
+void ColumnsToStrided(const std::vector<const uint8_t*>& columns, int64_t row_begin,
+                      int64_t row_end, int64_t row_stride, int64_t column_stride,
+                      uint8_t* out) {
+  T* out_values = reinterpret_cast<T*>(out);
+  const int64_t num_columns = static_cast<int64_t>(columns.size());
+  for (int64_t tile_row = row_begin; tile_row < row_end; tile_row += kTileRows) {
+    const int64_t tile_row_end = std::min(tile_row + kTileRows, row_end);
+    for (int64_t tile_column = 0; tile_column < num_columns;
+         tile_column += kTileColumns) {
+      const int64_t tile_column_end = std::min(tile_column + kTileColumns, num_columns);
+      for (int64_t j = tile_column; j < tile_column_end; ++j) {
+        const T* values = reinterpret_cast<const T*>(columns[j]);
+        T* out_column = out_values + j * column_stride;
+        for (int64_t i = tile_row; i < tile_row_end; ++i) {
+          out_column[i * row_stride] = values[i];
+        }
+      }
+    }
+  }
+}
+
+// The converse of ColumnsToStrided.
+template <typename T>
+void StridedToColumns(const uint8_t* data, int64_t row_stride, int64_t column_stride,
+                      int64_t row_begin, int64_t row_end,
+                      const std::vector<uint8_t*>& columns) {
+  const T* values = reinterpret_cast<const T*>(data);
+  const int64_t num_columns = static_cast<int64_t>(columns.size());
+  for (int64_t tile_row = row_begin; tile_row < row_end; tile_row += kTileRows) {
+    const int64_t tile_row_end = std::min(tile_row + kTileRows, row_end);
+    for (int64_t tile_column = 0; tile_column < num_columns;
+         tile_column += kTileColumns) {
+      const int64_t tile_column_end = std::min(tile_column + kTileColumns, num_columns);
+      for (int64_t j = tile_column; j < tile_column_end; ++j) {
+        const T* column_values = values + j * column_stride;
+        T* out = reinterpret_cast<T*>(columns[j]);
+        for (int64_t i = tile_row; i < tile_row_end; ++i) {
+          out[i] = column_values[i * row_stride];
+        }
+      }
+    }
+  }
+}
+
+using ColumnsToStridedFunction = void (*)(const std::vector<const uint8_t*>&, int64_t,
+                                          int64_t, int64_t, int64_t, uint8_t*);
+using StridedToColumnsFunction = void (*)(const uint8_t*, int64_t, int64_t, int64_t,
+                                          int64_t, const std::vector<uint8_t*>&);
+
+// The values are copied as unsigned integers of their width
+Status GetTranspositions(int byte_width, ColumnsToStridedFunction* to_strided,
+                         StridedToColumnsFunction* to_columns) {
+  switch (byte_width) {
+    case 1:
+      *to_strided = ColumnsToStrided<uint8_t>;
+      *to_columns = StridedToColumns<uint8_t>;
+      break;
+    case 2:
+      *to_strided = ColumnsToStrided<uint16_t>;
+      *to_columns = StridedToColumns<uint16_t>;
+      break;
+    case 4:
+      *to_strided = ColumnsToStrided<uint32_t>;
+      *to_columns = StridedToColumns<uint32_t>;
+      break;
+    case 8:
+      *to_strided = ColumnsToStrided<uint64_t>;
+      *to_columns = StridedToColumns<uint64_t>;
+      break;
+    default:
+      return Status::NotImplemented("Transposing values of ", byte_width, " bytes");
+  }
+  return Status::OK();
+}
+
+// Calls func(row_begin, row_end) over ranges of num_rows rows, in parallel on the CPU
+// thread pool if use_threads.
+template <typename Function>
+Status ForRowRanges(int64_t num_rows, bool use_threads, Function&& func) {
+  const int64_t num_tasks = (num_rows + kRowsPerTask - 1) / kRowsPerTask;
+  if (!use_threads || num_tasks <= 1) {
+    func(0, num_rows);
+    return Status::OK();
+  }
+  return internal::ParallelFor(static_cast<int>(num_tasks), [&](int task) -> Status {
+    const int64_t row_begin = task * kRowsPerTask;
+    func(row_begin, std::min(row_begin + kRowsPerTask, num_rows));
+    return Status::OK();
+  });
+}
+
+Status GetTensorType(const Schema& schema, std::shared_ptr<DataType>* out) {
+  if (schema.num_fields() == 0) {
+    return Status::Invalid("Cannot convert zero columns to a tensor");
+  }
+  const std::shared_ptr<DataType>& type = schema.field(0)->type();
+  if (!is_tensor_supported(type->id())) {
+    return Status::TypeError("Cannot convert a column of type ", type->ToString(),
+                             " to a tensor");
+  }
+  for (int i = 1; i < schema.num_fields(); ++i) {
+    if (!schema.field(i)->type()->Equals(*type)) {
+      return Status::TypeError("Cannot convert columns of types ", type->ToString(),
+                               " and ", schema.field(i)->type()->ToString(),
+                               " to a tensor");
+    }
+  }
+  *out = type;
+  return Status::OK();
+}
+
+const uint8_t* GetColumnValues(const Array& array, int byte_width) {
+  return array.data()->buffers[1]->data() + array.offset() * byte_width;
+}
+
+Status CheckNoNulls(const RecordBatch& batch) {
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    if (batch.column(i)->null_count() != 0) {
+      return Status::Invalid("Cannot convert column '", batch.column_name(i),
+                             "' with nulls to a tensor");
+    }
+  }
+  return Status::OK();
+}
+
+// The strides of a (num_rows, num_columns) tensor, as ComputeRowMajorStrides and
+// ComputeColumnMajorStrides would set them.
+std::vector<int64_t> Get2DStrides(int64_t num_rows, int64_t num_columns,
+                                  int byte_width, bool row_major) {
+  if (num_rows == 0 || num_columns == 0) {
+    return {byte_width, byte_width};
+  }
+  if (row_major) {
+    return {num_columns * byte_width, byte_width};
+  }
+  return {byte_width, num_rows * byte_width};
+}
+
+// Writes the values of a batch to the rows of a tensor, starting at row_offset.
+Status WriteBatchToTensor(const RecordBatch& batch, int64_t row_offset, int byte_width,
+                          bool row_major, int64_t num_tensor_rows, bool use_threads,
+                          uint8_t* tensor_data) {
+  RETURN_NOT_OK(CheckNoNulls(batch));
+  ColumnsToStridedFunction to_strided;
+  StridedToColumnsFunction to_columns;
+  RETURN_NOT_OK(GetTranspositions(byte_width, &to_strided, &to_columns));
+
+  std::vector<const uint8_t*> columns;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    columns.push_back(GetColumnValues(*batch.column(i), byte_width));
+  }
+  const int64_t row_stride = row_major ? batch.num_columns() : 1;
+  const int64_t column_stride = row_major ? 1 : num_tensor_rows;
+  uint8_t* out = tensor_data + row_offset * row_stride * byte_width;
+  return ForRowRanges(batch.num_rows(), use_threads,
+                      [&](int64_t row_begin, int64_t row_end) {
+                        to_strided(columns, row_begin, row_end, row_stride,
+                                   column_stride, out);
+                      });
+}
+
+}  // namespace
+
+Status RecordBatchToTensor(const RecordBatch& batch, bool row_major, bool use_threads,
+                           MemoryPool* pool, std::shared_ptr<Tensor>* out) {
+  std::shared_ptr<DataType> type;
+  RETURN_NOT_OK(GetTensorType(*batch.schema(), &type));
+  const int byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+  const int64_t num_rows = batch.num_rows();
+  const int64_t num_columns = batch.num_columns();
+
+  if (num_columns == 1) {
+    // Both layouts are the column itself
+    RETURN_NOT_OK(CheckNoNulls(batch));
+    const Array& column = *batch.column(0);
+    std::shared_ptr<Buffer> data = SliceBuffer(
+        column.data()->buffers[1], column.offset() * byte_width, num_rows * byte_width);
+    *out = std::make_shared<Tensor>(type, data, std::vector<int64_t>{num_rows, 1});
+    return Status::OK();
+  }
+
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(AllocateBuffer(pool, num_rows * num_columns * byte_width, &data));
+  RETURN_NOT_OK(WriteBatchToTensor(batch, 0, byte_width, row_major, num_rows,
+                                   use_threads, data->mutable_data()));
+  *out = std::make_shared<Tensor>(
+      type, data, std::vector<int64_t>{num_rows, num_columns},
+      Get2DStrides(num_rows, num_columns, byte_width, row_major));
+  return Status::OK();
+}
+
+Status TableToTensor(const Table& table, bool row_major, bool use_threads,
+                     MemoryPool* pool, std::shared_ptr<Tensor>* out) {
+  std::shared_ptr<DataType> type;
+  RETURN_NOT_OK(GetTensorType(*table.schema(), &type));
+  const int byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+  const int64_t num_rows = table.num_rows();
+  const int64_t num_columns = table.num_columns();
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  TableBatchReader reader(table);
+  RETURN_NOT_OK(reader.ReadAll(&batches));
+  if (batches.size() == 1) {
+    return RecordBatchToTensor(*batches[0], row_major, use_threads, pool, out);
+  }
+
+  std::shared_ptr<Buffer> data;
+  RETURN_NOT_OK(AllocateBuffer(pool, num_rows * num_columns * byte_width, &data));
+  int64_t row_offset = 0;
+  for (const std::shared_ptr<RecordBatch>& batch : batches) {
+    RETURN_NOT_OK(WriteBatchToTensor(*batch, row_offset, byte_width, row_major,
+                                     num_rows, use_threads, data->mutable_data()));
+    row_offset += batch->num_rows();
+  }
+  *out = std::make_shared<Tensor>(
+      type, data, std::vector<int64_t>{num_rows, num_columns},
+      Get2DStrides(num_rows, num_columns, byte_width, row_major));
+  return Status::OK();
+}
+
+Status TensorToRecordBatch(const Tensor& tensor,
+                           const std::vector<std::string>& column_names,
+                           bool use_threads, MemoryPool* pool,
+                           std::shared_ptr<RecordBatch>* out) {
+  if (tensor.ndim() != 2) {
+    return Status::Invalid("Cannot convert a tensor of ", tensor.ndim(),
+                           " dimensions to a record batch");
+  }
+  const std::shared_ptr<DataType>& type = tensor.type();
+  const int byte_width = checked_cast<const FixedWidthType&>(*type).bit_width() / 8;
+  const int64_t num_rows = tensor.shape()[0];
+  const int num_columns = static_cast<int>(tensor.shape()[1]);
+  if (!column_names.empty() && static_cast<int>(column_names.size()) != num_columns) {
+    return Status::Invalid("Got ", column_names.size(), " column names for ",
+                           num_columns, " columns");
+  }
+
+  std::vector<std::shared_ptr<Field>> fields;
+  for (int j = 0; j < num_columns; ++j) {
+    fields.push_back(
+        field(column_names.empty() ? std::to_string(j) : column_names[j], type, false));
+  }
+
+  const int64_t row_stride = tensor.strides()[0];
+  const int64_t column_stride = tensor.strides()[1];
+  std::vector<std::shared_ptr<Buffer>> buffers(num_columns);
+  if (row_stride == byte_width || num_rows <= 1) {
+    // The columns are contiguous in the tensor
+    for (int j = 0; j < num_columns; ++j) {
+      buffers[j] =
+          SliceBuffer(tensor.data(), j * column_stride, num_rows * byte_width);
+    }
+  } else {
+    if (row_stride % byte_width != 0 || column_stride % byte_width != 0) {
+      return Status::NotImplemented("Converting a tensor with strides not multiple of ",
+                                    "its value size to a record batch");
+    }
+    ColumnsToStridedFunction to_strided;
+    StridedToColumnsFunction to_columns;
+    RETURN_NOT_OK(GetTranspositions(byte_width, &to_strided, &to_columns));
+    std::vector<uint8_t*> columns;
+    for (int j = 0; j < num_columns; ++j) {
+      RETURN_NOT_OK(AllocateBuffer(pool, num_rows * byte_width, &buffers[j]));
+      columns.push_back(buffers[j]->mutable_data());
+    }
+    const uint8_t* data = tensor.raw_data();
+    RETURN_NOT_OK(ForRowRanges(num_rows, use_threads,
+                               [&](int64_t row_begin, int64_t row_end) {
+                                 to_columns(data, row_stride / byte_width,
+                                            column_stride / byte_width, row_begin,
+                                            row_end, columns);
+                               }));
+  }
+
+  std::vector<std::shared_ptr<Array>> arrays;
+  for (int j = 0; j < num_columns; ++j) {
+    arrays.push_back(
+        MakeArray(ArrayData::Make(type, num_rows, {nullptr, buffers[j]}, 0)));
+  }
+  *out = RecordBatch::Make(schema(fields), num_rows, std::move(arrays));
+  return Status::OK();
+}
+
 }  // namespace arrow
@@ -162,6 +162,52 @@ class NumericTensor : public Tensor {
   }
 };
 
+/// \brief Convert a record batch to a 2-D tensor of shape (num_rows, num_columns)
+///
+/// The columns must have the same numeric type and no nulls. A single column is
+/// converted without copying its values, while the values of several columns are
+/// transposed into the tensor by tiles that fit in cache.
+///
+/// \param[in] batch the record batch
+/// \param[in] row_major whether to lay the tensor out in row-major (C) order, rather
+/// than column-major (Fortran) order
+/// \param[in] use_threads whether to transpose ranges of rows in parallel on the CPU
+/// thread pool
+/// \param[in] pool the memory pool to allocate the tensor from
+/// \param[out] out the tensor
+/// \return Status
+ARROW_EXPORT
+Status RecordBatchToTensor(const RecordBatch& batch, bool row_major, bool use_threads,
+                           MemoryPool* pool, std::shared_ptr<Tensor>* out);
+
+/// \brief Convert a table to a 2-D tensor of shape (num_rows, num_columns)
+///
+/// Like RecordBatchToTensor, for each of the record batches of a TableBatchReader
+/// over the table in turn.
+ARROW_EXPORT
+Status TableToTensor(const Table& table, bool row_major, bool use_threads,
+                     MemoryPool* pool, std::shared_ptr<Tensor>* out);
+
+/// \brief Convert a 2-D tensor to a record batch with one column per tensor column
+///
+/// The columns of a tensor whose columns are contiguous, eg. in column-major order,
+/// are slices of the tensor data. Otherwise the values are transposed into new
+/// columns by tiles that fit in cache.
+///
+/// \param[in] tensor the tensor
+/// \param[in] column_names the names of the columns, or empty to name them by their
+/// index
+/// \param[in] use_threads whether to transpose ranges of rows in parallel on the CPU
+/// thread pool
+/// \param[in] pool the memory pool to allocate the columns from
+/// \param[out] out the record batch
+/// \return Status
+ARROW_EXPORT
+Status TensorToRecordBatch(const Tensor& tensor,
+                           const std::vector<std::string>& column_names,
+                           bool use_threads, MemoryPool* pool,
+                           std::shared_ptr<RecordBatch>* out);
+
 }  // namespace arrow
 
 #endif  // ARROW_TENSOR_H
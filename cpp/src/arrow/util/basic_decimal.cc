@@ -37,6 +37,8 @@ namespace arrow {
 using internal::SafeLeftShift;
 using internal::SafeSignedAdd;
 
+constexpr int32_t BasicDecimal128::kMaxDigits64;
+
 static const BasicDecimal128 ScaleMultipliers[] = {
     BasicDecimal128(1LL),
     BasicDecimal128(10LL),
@@ -414,39 +416,19 @@ static DecimalStatus SingleDivide(const uint32_t* dividend, int64_t dividend_len
   return DecimalStatus::kSuccess;
 }
 
-DecimalStatus BasicDecimal128::Divide(const BasicDecimal128& divisor,
-                                      BasicDecimal128* result,
-                                      BasicDecimal128* remainder) const {
-  // Split the dividend and divisor into integer pieces so that we can
-  // work on them.
-  uint32_t dividend_array[5];
-  uint32_t divisor_array[4];
-  bool dividend_was_negative;
-  bool divisor_was_negative;
-  // leave an extra zero before the dividend
-  dividend_array[0] = 0;
-  int64_t dividend_length =
-      FillInArray(*this, dividend_array + 1, dividend_was_negative) + 1;
-  int64_t divisor_length = FillInArray(divisor, divisor_array, divisor_was_negative);
-
-  // Handle some of the easy cases.
-  if (dividend_length <= divisor_length) {
-    *remainder = *this;
-    *result = 0;
-    return DecimalStatus::kSuccess;
-  }
-
-  if (divisor_length == 0) {
-    return DecimalStatus::kDivideByZero;
-  }
-
-  if (divisor_length == 1) {
-    return SingleDivide(dividend_array, dividend_length, divisor_array[0], remainder,
-                        dividend_was_negative, divisor_was_negative, result);
-  }
-
-  int64_t result_length = dividend_length - divisor_length;
-  uint32_t result_array[4];
+/// \brief Do a long division where the divisor has at least two 32 bit digits.
+///
+/// Both numbers are unsigned, most significant digit first, and the divisor
+/// has no leading zero.  The dividend has a leading zero digit and is
+/// replaced by the remainder.
+/// \param dividend_array the dividend, must have dividend_length elements
+/// \param divisor_array the divisor, must have divisor_length elements (it
+/// is normalized in place)
+/// \param result_array the quotient, dividend_length - divisor_length elements
+static void LongDivide(uint32_t* dividend_array, int64_t dividend_length,
+                       uint32_t* divisor_array, int64_t divisor_length,
+                       uint32_t* result_array) {
+  const int64_t result_length = dividend_length - divisor_length;
 
   // Normalize by shifting both by a multiple of 2 so that
   // the digit guessing is better. The requirement is that
@@ -510,6 +492,43 @@ DecimalStatus BasicDecimal128::Divide(const BasicDecimal128& divisor,
 
   // denormalize the remainder
   ShiftArrayRight(dividend_array, dividend_length, normalize_bits);
+}
+
+DecimalStatus BasicDecimal128::Divide(const BasicDecimal128& divisor,
+                                      BasicDecimal128* result,
+                                      BasicDecimal128* remainder) const {
+  // Split the dividend and divisor into integer pieces so that we can
+  // work on them.
+  uint32_t dividend_array[5];
+  uint32_t divisor_array[4];
+  bool dividend_was_negative;
+  bool divisor_was_negative;
+  // leave an extra zero before the dividend
+  dividend_array[0] = 0;
+  int64_t dividend_length =
+      FillInArray(*this, dividend_array + 1, dividend_was_negative) + 1;
+  int64_t divisor_length = FillInArray(divisor, divisor_array, divisor_was_negative);
+
+  // Handle some of the easy cases.
+  if (dividend_length <= divisor_length) {
+    *remainder = *this;
+    *result = 0;
+    return DecimalStatus::kSuccess;
+  }
+
+  if (divisor_length == 0) {
+    return DecimalStatus::kDivideByZero;
+  }
+
+  if (divisor_length == 1) {
+    return SingleDivide(dividend_array, dividend_length, divisor_array[0], remainder,
+                        dividend_was_negative, divisor_was_negative, result);
+  }
+
+  int64_t result_length = dividend_length - divisor_length;
+  uint32_t result_array[4];
+  LongDivide(dividend_array, dividend_length, divisor_array, divisor_length,
+             result_array);
 
   // return result and remainder
   auto status = BuildFromArray(result, result_array, result_length);
@@ -525,6 +544,116 @@ DecimalStatus BasicDecimal128::Divide(const BasicDecimal128& divisor,
   return DecimalStatus::kSuccess;
 }
 
+/// \brief Expand the absolute value of a number into exactly 4 ints, most
+/// significant first.
+static void FillInFixedArray(const BasicDecimal128& value, uint32_t* array,
+                             bool* was_negative) {
+  uint32_t digits[4];
+  const int64_t length = FillInArray(value, digits, *was_negative);
+  std::fill(array, array + 4 - length, 0);
+  std::copy(digits, digits + length, array + 4 - length);
+}
+
+/// \brief Multiply two 4-int unsigned numbers into an 8-int product.
+static void MultiplyArrays(const uint32_t* left, const uint32_t* right,
+                           uint32_t* product) {
+  std::fill(product, product + 8, 0);
+  for (int i = 3; i >= 0; --i) {
+    uint64_t carry = 0;
+    for (int j = 3; j >= 0; --j) {
+      carry += static_cast<uint64_t>(left[i]) * right[j] + product[i + j + 1];
+      product[i + j + 1] = static_cast<uint32_t>(carry);
+      carry >>= 32;
+    }
+    product[i] = static_cast<uint32_t>(carry);
+  }
+}
+
+/// \brief Build a BasicDecimal128 from the last 4 of length ints, checking
+/// that the value fits in 127 bits.  The value is set (truncated to 128 bits)
+/// even if it overflows.
+static DecimalStatus BuildFromWideArray(const uint32_t* array, int64_t length,
+                                        bool negative, BasicDecimal128* value) {
+  const uint32_t* low = array + length - 4;
+  *value = {static_cast<int64_t>((static_cast<uint64_t>(low[0]) << 32) | low[1]),
+            (static_cast<uint64_t>(low[2]) << 32) | low[3]};
+  if (negative) {
+    value->Negate();
+  }
+  for (const uint32_t* p = array; p < low; ++p) {
+    if (*p != 0) {
+      return DecimalStatus::kOverflow;
+    }
+  }
+  return (low[0] >> 31) != 0 ? DecimalStatus::kOverflow : DecimalStatus::kSuccess;
+}
+
+DecimalStatus BasicDecimal128::MultiplyAndReduceScaleBy(const BasicDecimal128& right,
+                                                        int32_t reduce_by,
+                                                        BasicDecimal128* result) const {
+  DCHECK_GE(reduce_by, 0);
+  DCHECK_LE(reduce_by, 38);
+
+  uint32_t left_array[4], right_array[4], product[8];
+  bool left_was_negative, right_was_negative;
+  FillInFixedArray(*this, left_array, &left_was_negative);
+  FillInFixedArray(right, right_array, &right_was_negative);
+  MultiplyArrays(left_array, right_array, product);
+
+  // Divide by 10^reduce_by in steps of at most 10^9, which fit in one int
+  while (reduce_by > 0) {
+    const int32_t step = std::min(reduce_by, 9);
+    const auto divisor = static_cast<uint32_t>(ScaleMultipliers[step].low_bits());
+    uint64_t r = 0;
+    for (int i = 0; i < 8; ++i) {
+      r = (r << 32) | product[i];
+      product[i] = static_cast<uint32_t>(r / divisor);
+      r %= divisor;
+    }
+    reduce_by -= step;
+  }
+  return BuildFromWideArray(product, 8, left_was_negative != right_was_negative, result);
+}
+
+DecimalStatus BasicDecimal128::IncreaseScaleAndDivide(int32_t increase_by,
+                                                      const BasicDecimal128& divisor,
+                                                      BasicDecimal128* result) const {
+  DCHECK_GE(increase_by, 0);
+  DCHECK_LE(increase_by, 38);
+
+  uint32_t value_array[4], multiplier_array[4], divisor_array[4];
+  bool value_was_negative, multiplier_was_negative, divisor_was_negative;
+  FillInFixedArray(*this, value_array, &value_was_negative);
+  FillInFixedArray(ScaleMultipliers[increase_by], multiplier_array,
+                   &multiplier_was_negative);
+  const int64_t divisor_length =
+      FillInArray(divisor, divisor_array, divisor_was_negative);
+  if (divisor_length == 0) {
+    return DecimalStatus::kDivideByZero;
+  }
+  // Leave an extra zero before the dividend, as LongDivide requires
+  uint32_t dividend_array[9];
+  dividend_array[0] = 0;
+  MultiplyArrays(value_array, multiplier_array, dividend_array + 1);
+
+  uint32_t result_array[8];
+  int64_t result_length;
+  if (divisor_length == 1) {
+    uint64_t r = 0;
+    for (int i = 1; i < 9; ++i) {
+      r = (r << 32) | dividend_array[i];
+      result_array[i - 1] = static_cast<uint32_t>(r / divisor_array[0]);
+      r %= divisor_array[0];
+    }
+    result_length = 8;
+  } else {
+    LongDivide(dividend_array, 9, divisor_array, divisor_length, result_array);
+    result_length = 9 - divisor_length;
+  }
+  return BuildFromWideArray(result_array, result_length,
+                            value_was_negative != divisor_was_negative, result);
+}
+
 bool operator==(const BasicDecimal128& left, const BasicDecimal128& right) {
   return left.high_bits() == right.high_bits() && left.low_bits() == right.low_bits();
 }
@@ -649,6 +778,14 @@ const BasicDecimal128& BasicDecimal128::GetScaleMultiplier(int32_t scale) {
   return ScaleMultipliers[scale];
 }
 
+int64_t BasicDecimal128::GetScaleMultiplier64(int32_t scale) {
+  DCHECK_GE(scale, 0);
+  DCHECK_LE(scale, 38);
+
+  return scale <= kMaxDigits64 ? static_cast<int64_t>(ScaleMultipliers[scale].low_bits())
+                               : 0;
+}
+
 BasicDecimal128 BasicDecimal128::IncreaseScaleBy(int32_t increase_by) const {
   DCHECK_GE(increase_by, 0);
   DCHECK_LE(increase_by, 38);
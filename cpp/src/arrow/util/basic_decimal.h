@@ -42,6 +42,9 @@ enum class DecimalStatus {
 /// streams and boost.
 class ARROW_EXPORT BasicDecimal128 {
  public:
+  /// \brief The largest scale whose multiplier fits in an int64_t.
+  static constexpr int32_t kMaxDigits64 = 18;
+
   /// \brief Create a BasicDecimal128 from the two's complement representation.
   constexpr BasicDecimal128(int64_t high, uint64_t low) noexcept
       : low_bits_(low), high_bits_(high) {}
@@ -89,6 +92,25 @@ class ARROW_EXPORT BasicDecimal128 {
   DecimalStatus Divide(const BasicDecimal128& divisor, BasicDecimal128* result,
                        BasicDecimal128* remainder) const;
 
+  /// \brief Multiply this number by right and scale the product down by
+  /// reduce_by digits, truncating towards zero.
+  ///
+  /// The product is computed on 256 bits, so that it may exceed 128 bits as
+  /// long as the scaled down result does not, e.g. when multiplying two
+  /// decimals of a large scale.  On overflow, result holds the scaled down
+  /// product truncated to 128 bits.
+  DecimalStatus MultiplyAndReduceScaleBy(const BasicDecimal128& right, int32_t reduce_by,
+                                         BasicDecimal128* result) const;
+
+  /// \brief Scale this number up by increase_by digits and divide it by
+  /// divisor, truncating towards zero.
+  ///
+  /// The scaled up dividend is computed on 256 bits, see
+  /// MultiplyAndReduceScaleBy.
+  DecimalStatus IncreaseScaleAndDivide(int32_t increase_by,
+                                       const BasicDecimal128& divisor,
+                                       BasicDecimal128* result) const;
+
   /// \brief In-place division.
   BasicDecimal128& operator/=(const BasicDecimal128& right);
 
@@ -121,6 +143,16 @@ class ARROW_EXPORT BasicDecimal128 {
   /// \brief Scale multiplier for given scale value.
   static const BasicDecimal128& GetScaleMultiplier(int32_t scale);
 
+  /// \brief Scale multiplier for given scale value as an int64_t, or 0 if it is
+  /// larger than kMaxDigits64.
+  static int64_t GetScaleMultiplier64(int32_t scale);
+
+  /// \brief Whether the number fits in an int64_t, which is then stored in out.
+  bool ToInt64(int64_t* out) const {
+    *out = static_cast<int64_t>(low_bits_);
+    return high_bits_ == (*out < 0 ? -1 : 0);
+  }
+
   /// \brief Convert BasicDecimal128 from one scale to another
   DecimalStatus Rescale(int32_t original_scale, int32_t new_scale,
                         BasicDecimal128* out) const;
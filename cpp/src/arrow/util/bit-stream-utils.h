@@ -135,6 +135,10 @@ class BitReader {
   template <typename T>
   int GetBatch(int num_bits, T* v, int batch_size);
 
+  /// Get a number of single-bit values from the buffer into the bitmap, starting
+  /// at bit bitmap_offset. Return the number of values actually read.
+  int GetBitmap(uint8_t* bitmap, int64_t bitmap_offset, int batch_size);
+
   /// Reads a 'num_bytes'-sized value from the buffer and stores it in 'v'. T
   /// needs to be a little-endian native type and big enough to store
   /// 'num_bytes'. The value is assumed to be byte-aligned so the stream will
@@ -359,6 +363,28 @@ inline int BitReader::GetBatch(int num_bits, T* v, int batch_size) {
   return batch_size;
 }
 
+inline int BitReader::GetBitmap(uint8_t* bitmap, int64_t bitmap_offset, int batch_size) {
+  DCHECK(buffer_ != NULL);
+
+  // Single-bit values are packed in the order of bitmap bits
+  const int64_t position = static_cast<int64_t>(byte_offset_) * 8 + bit_offset_;
+  const int64_t remaining_bits = static_cast<int64_t>(max_bytes_) * 8 - position;
+  if (remaining_bits < batch_size) {
+    batch_size = static_cast<int>(remaining_bits);
+  }
+  internal::CopyBitmap(buffer_, position, batch_size, bitmap, bitmap_offset);
+
+  byte_offset_ = static_cast<int>((position + batch_size) / 8);
+  bit_offset_ = static_cast<int>((position + batch_size) % 8);
+  int bytes_remaining = max_bytes_ - byte_offset_;
+  if (bytes_remaining >= 8) {
+    memcpy(&buffered_values_, buffer_ + byte_offset_, 8);
+  } else {
+    memcpy(&buffered_values_, buffer_ + byte_offset_, bytes_remaining);
+  }
+  return batch_size;
+}
+
 template <typename T>
 inline bool BitReader::GetAligned(int num_bytes, T* v) {
   DCHECK_LE(num_bytes, static_cast<int>(sizeof(T)));
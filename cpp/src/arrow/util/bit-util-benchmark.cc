@@ -25,9 +25,12 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/bpacking.h"
 
 namespace arrow {
 
+using internal::BitmapAnd;
+using internal::BitmapToIndices;
 using internal::CopyBitmap;
 
 namespace BitUtil {
@@ -230,6 +233,59 @@ static void BM_CopyBitmap(benchmark::State& state) {  // NOLINT non-const refere
   state.SetBytesProcessed(state.iterations() * kBufferSize * sizeof(int8_t));
 }
 
+static void BM_BitmapAnd(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t kBufferSize = state.range(0);
+  std::shared_ptr<Buffer> left = CreateRandomBuffer(kBufferSize);
+  std::shared_ptr<Buffer> right = CreateRandomBuffer(kBufferSize);
+  std::shared_ptr<Buffer> out = CreateRandomBuffer(kBufferSize);
+
+  // Leave room for the offset of the right input
+  const int64_t num_bits = (kBufferSize - 1) * 8;
+  while (state.KeepRunning()) {
+    BitmapAnd(left->data(), 0, right->data(), state.range(1), num_bits, 0,
+              out->mutable_data());
+  }
+  state.SetBytesProcessed(state.iterations() * kBufferSize * 2);
+}
+
+static void BM_BitmapToIndices(benchmark::State& state) {  // NOLINT non-const reference
+  const int64_t kBufferSize = state.range(0);
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(kBufferSize);
+
+  const int64_t num_bits = kBufferSize * 8;
+  std::vector<int32_t> indices(num_bits);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        BitmapToIndices(buffer->data(), 0, num_bits, indices.data()));
+  }
+  state.SetBytesProcessed(state.iterations() * kBufferSize);
+}
+
+static void BM_UnpackBits(benchmark::State& state) {  // NOLINT non-const reference
+  const int num_values = 4096;
+  const int num_bits = static_cast<int>(state.range(0));
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(num_values / 8 * num_bits);
+
+  std::vector<uint32_t> values(num_values);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        internal::unpack32(reinterpret_cast<const uint32_t*>(buffer->data()),
+                           values.data(), num_values, num_bits));
+  }
+  state.SetItemsProcessed(state.iterations() * num_values);
+}
+
+BENCHMARK(BM_BitmapAnd)
+    ->Args({100000, 0})
+    ->Args({100000, 3})
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(BM_BitmapToIndices)
+    ->Args({100000})
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
 BENCHMARK(BM_CopyBitmap)
     ->Args({100000, 0})
     ->Args({1000000, 0})
@@ -238,6 +294,17 @@ BENCHMARK(BM_CopyBitmap)
     ->MinTime(1.0)
     ->Unit(benchmark::kMicrosecond);
 
+BENCHMARK(BM_UnpackBits)
+    ->Args({1})
+    ->Args({3})
+    ->Args({8})
+    ->Args({13})
+    ->Args({20})
+    ->Args({25})
+    ->Args({32})
+    ->MinTime(1.0)
+    ->Unit(benchmark::kMicrosecond);
+
 BENCHMARK(BM_NaiveBitmapReader)
     ->Args({1000000})
     ->MinTime(5.0)
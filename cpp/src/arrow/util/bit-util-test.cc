@@ -15,12 +15,14 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <climits>
 #include <cstdint>
 #include <cstring>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -38,6 +40,7 @@
 namespace arrow {
 
 using internal::BitmapAnd;
+using internal::BitmapAndNot;
 using internal::BitmapOr;
 using internal::BitmapXor;
 using internal::CopyBitmap;
@@ -434,6 +437,22 @@ struct BitmapXorOp : public BitmapOperation {
   }
 };
 
+struct BitmapAndNotOp : public BitmapOperation {
+  Status Call(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+              const uint8_t* right, int64_t right_offset, int64_t length,
+              int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) const override {
+    return BitmapAndNot(pool, left, left_offset, right, right_offset, length, out_offset,
+                        out_buffer);
+  }
+
+  Status Call(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+              int64_t right_offset, int64_t length, int64_t out_offset,
+              uint8_t* out_buffer) const override {
+    BitmapAndNot(left, left_offset, right, right_offset, length, out_offset, out_buffer);
+    return Status::OK();
+  }
+};
+
 class BitmapOp : public TestBase {
  public:
   void TestAligned(const BitmapOperation& op, const std::vector<int>& left_bits,
@@ -490,6 +509,13 @@ class BitmapOp : public TestBase {
                             right_offset, length, out_offset, out->mutable_data()));
           reader = internal::BitmapReader(out->mutable_data(), out_offset, length);
           ASSERT_READER_VALUES(reader, result_bits);
+
+          // The non-allocating version overwrites any previous contents
+          std::memset(out->mutable_data(), 0xff, out->size());
+          ASSERT_OK(op.Call(left->mutable_data(), left_offset, right->mutable_data(),
+                            right_offset, length, out_offset, out->mutable_data()));
+          reader = internal::BitmapReader(out->mutable_data(), out_offset, length);
+          ASSERT_READER_VALUES(reader, result_bits);
         }
       }
     }
@@ -526,6 +552,114 @@ TEST_F(BitmapOp, XorAligned) {
   TestUnaligned(op, left, right, result);
 }
 
+TEST_F(BitmapOp, AndNot) {
+  BitmapAndNotOp op;
+  std::vector<int> left = {0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1};
+  std::vector<int> right = {0, 0, 1, 0, 1, 1, 0, 0, 1, 1, 1, 0, 1, 0};
+  std::vector<int> result = {0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1};
+
+  TestAligned(op, left, right, result);
+  TestUnaligned(op, left, right, result);
+}
+
+TEST_F(BitmapOp, WordwiseUnaligned) {
+  // Ranges spanning several words, checked against bit-by-bit results; the
+  // bits around the output range are preserved
+  const int64_t kBytes = 64;
+  std::vector<uint8_t> left(kBytes), right(kBytes), out(kBytes);
+  random_bytes(kBytes, 0, left.data());
+  random_bytes(kBytes, 1, right.data());
+
+  using Reference = std::function<bool(bool, bool)>;
+  std::vector<std::pair<std::shared_ptr<BitmapOperation>, Reference>> ops = {
+      {std::make_shared<BitmapAndOp>(), [](bool a, bool b) { return a && b; }},
+      {std::make_shared<BitmapOrOp>(), [](bool a, bool b) { return a || b; }},
+      {std::make_shared<BitmapXorOp>(), [](bool a, bool b) { return a != b; }},
+      {std::make_shared<BitmapAndNotOp>(), [](bool a, bool b) { return a && !b; }}};
+  for (const auto& op : ops) {
+    for (int64_t left_offset : {0, 3, 64}) {
+      for (int64_t right_offset : {0, 5, 17}) {
+        for (int64_t out_offset : {0, 1, 7, 9, 70}) {
+          for (int64_t length : {0, 1, 63, 64, 65, 130, 300}) {
+            std::memset(out.data(), 0xa5, kBytes);
+            ASSERT_OK(op.first->Call(left.data(), left_offset, right.data(),
+                                     right_offset, length, out_offset, out.data()));
+            for (int64_t i = 0; i < kBytes * 8; ++i) {
+              const int64_t j = i - out_offset;
+              const bool expected =
+                  (j >= 0 && j < length)
+                      ? op.second(BitUtil::GetBit(left.data(), left_offset + j),
+                                  BitUtil::GetBit(right.data(), right_offset + j))
+                      : ((0xa5 >> (i % 8)) & 1) != 0;
+              ASSERT_EQ(expected, BitUtil::GetBit(out.data(), i))
+                  << "bit " << i << ", offsets " << left_offset << " " << right_offset
+                  << " " << out_offset << ", length " << length;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(BitUtilTests, TestFindNextBit) {
+  std::shared_ptr<Buffer> buffer;
+  int64_t length;
+  std::vector<int> bits(200, 0);
+  bits[3] = bits[70] = bits[71] = bits[199] = 1;
+  for (int64_t offset : {0, 5, 64}) {
+    BitmapFromVector(bits, offset, &buffer, &length);
+    const uint8_t* data = buffer->data();
+    ASSERT_EQ(3, internal::FindNextSetBit(data, offset, length));
+    ASSERT_EQ(66, internal::FindNextSetBit(data, offset + 4, length - 4));
+    ASSERT_EQ(0, internal::FindNextSetBit(data, offset + 199, 1));
+    ASSERT_EQ(127, internal::FindNextSetBit(data, offset + 72, 127));
+    ASSERT_EQ(0, internal::FindNextSetBit(data, offset, 0));
+
+    ASSERT_EQ(0, internal::FindNextUnsetBit(data, offset, length));
+    ASSERT_EQ(2, internal::FindNextUnsetBit(data, offset + 70, 10));
+    ASSERT_EQ(2, internal::FindNextUnsetBit(data, offset + 70, 2));
+
+    std::vector<std::pair<int64_t, int64_t>> runs;
+    internal::VisitSetBitRuns(data, offset, length, [&](int64_t position, int64_t n) {
+      runs.emplace_back(position, n);
+    });
+    std::vector<std::pair<int64_t, int64_t>> expected_runs = {{3, 1}, {70, 2}, {199, 1}};
+    ASSERT_EQ(expected_runs, runs);
+  }
+}
+
+template <typename IndexType>
+void CheckBitmapToIndices(const uint8_t* bitmap, int64_t offset, int64_t length) {
+  std::vector<IndexType> expected;
+  for (int64_t i = 0; i < length; ++i) {
+    if (BitUtil::GetBit(bitmap, offset + i)) {
+      expected.push_back(static_cast<IndexType>(i));
+    }
+  }
+  std::vector<IndexType> indices(length);
+  indices.resize(internal::BitmapToIndices(bitmap, offset, length, indices.data()));
+  ASSERT_EQ(expected, indices);
+}
+
+TEST(BitUtilTests, TestBitmapToIndices) {
+  const int kBufferSize = 100;
+  uint8_t buffer[kBufferSize];
+  random_bytes(kBufferSize, 0, buffer);
+  // Some all-set and all-unset words
+  memset(buffer + 16, 0xff, 24);
+  memset(buffer + 48, 0, 16);
+
+  for (int64_t offset : {0, 1, 13, 64}) {
+    const int64_t length = kBufferSize * 8 - offset - 3;
+    CheckBitmapToIndices<uint16_t>(buffer, offset, length);
+    CheckBitmapToIndices<int32_t>(buffer, offset, length);
+    CheckBitmapToIndices<uint32_t>(buffer, offset, length);
+    CheckBitmapToIndices<int64_t>(buffer, offset, length);
+    CheckBitmapToIndices<uint64_t>(buffer, offset, length);
+  }
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
@@ -552,6 +686,13 @@ TEST(BitUtilTests, TestCountSetBits) {
     int64_t expected = SlowCountBits(buffer, offset, num_bits - offset);
 
     ASSERT_EQ(expected, result);
+
+    // Ranges within a single word
+    for (int64_t length : {0, 1, 5, 60}) {
+      length = std::min<int64_t>(length, num_bits - offset);
+      ASSERT_EQ(SlowCountBits(buffer, offset, length),
+                CountSetBits(buffer, offset, length));
+    }
   }
 }
 
@@ -15,18 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
-// Alias MSVC popcount to GCC name
-#ifdef _MSC_VER
-#include <intrin.h>
-#define __builtin_popcount __popcnt
-#include <nmmintrin.h>
-#define __builtin_popcountll _mm_popcnt_u64
-#endif
-
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
-#include <functional>
 #include <memory>
 #include <vector>
 
@@ -70,6 +61,82 @@ Status BytesToBits(const std::vector<uint8_t>& bytes, MemoryPool* pool,
 
 namespace internal {
 
+namespace {
+
+inline uint64_t LowBitsMask(int64_t length) {
+  return length >= 64 ? ~static_cast<uint64_t>(0)
+                      : (static_cast<uint64_t>(1) << length) - 1;
+}
+
+// Load the `length` (at most 64) bits of `bitmap` starting at bit `offset`
+// into the low bits of a word, reading only the bytes holding them
+inline uint64_t LoadBits(const uint8_t* bitmap, int64_t offset, int64_t length) {
+  if (length == 0) {
+    return 0;
+  }
+  const uint8_t* bytes = bitmap + offset / 8;
+  const int shift = static_cast<int>(offset % 8);
+  uint64_t word;
+  if (length == 64) {
+    std::memcpy(&word, bytes, sizeof(word));
+    word = BitUtil::FromLittleEndian(word) >> shift;
+  } else {
+    const int64_t nbytes = std::min<int64_t>(BitUtil::BytesForBits(shift + length), 8);
+    word = 0;
+    for (int64_t i = 0; i < nbytes; ++i) {
+      word |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+    }
+    word >>= shift;
+  }
+  if (shift + length > 64) {
+    word |= static_cast<uint64_t>(bytes[8]) << (64 - shift);
+  }
+  return word & LowBitsMask(length);
+}
+
+// Store the low `length` (at most 64) bits of `word` into `bitmap` from bit
+// `offset`, preserving the bits around them
+inline void StoreBits(uint8_t* bitmap, int64_t offset, int64_t length, uint64_t word) {
+  uint8_t* bytes = bitmap + offset / 8;
+  const int shift = static_cast<int>(offset % 8);
+  if (shift == 0 && length == 64) {
+    word = BitUtil::ToLittleEndian(word);
+    std::memcpy(bytes, &word, sizeof(word));
+    return;
+  }
+  const int64_t nbytes = BitUtil::BytesForBits(shift + length);
+  for (int64_t i = 0; i < nbytes; ++i) {
+    const uint8_t value =
+        static_cast<uint8_t>(i == 0 ? word << shift : word >> (8 * i - shift));
+    const int64_t begin = i == 0 ? shift : 0;
+    const int64_t end = std::min<int64_t>(8, shift + length - 8 * i);
+    const uint8_t end_mask = end == 8 ? 0xFF : BitUtil::kPrecedingBitmask[end];
+    const uint8_t mask = end_mask & BitUtil::kTrailingBitmask[begin];
+    bytes[i] = static_cast<uint8_t>((bytes[i] & ~mask) | (value & mask));
+  }
+}
+
+// Write `length` bits into `out` from bit `out_offset`, preserving the bits
+// around them.  `words(i, n)` gives the n (at most 64) bits to write from the
+// i-th; they are requested so that all but the first and last stores are
+// whole, byte-aligned words.
+template <typename Words>
+void WriteBitsWordwise(uint8_t* out, int64_t out_offset, int64_t length,
+                       Words&& words) {
+  int64_t i = std::min(length, BitUtil::RoundUp(out_offset, 8) - out_offset);
+  if (i > 0) {
+    StoreBits(out, out_offset, i, words(0, i));
+  }
+  for (; i + 64 <= length; i += 64) {
+    StoreBits(out, out_offset + i, 64, words(i, 64));
+  }
+  if (i < length) {
+    StoreBits(out, out_offset + i, length - i, words(i, length - i));
+  }
+}
+
+}  // namespace
+
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   constexpr int64_t pop_len = sizeof(uint64_t) * 8;
 
@@ -80,11 +147,7 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
 
   // The number of bits until fast_count_start
   const int64_t initial_bits = std::min(length, fast_count_start - bit_offset);
-  for (int64_t i = bit_offset; i < bit_offset + initial_bits; ++i) {
-    if (BitUtil::GetBit(data, i)) {
-      ++count;
-    }
-  }
+  count += BitUtil::PopCount(LoadBits(data, bit_offset, initial_bits));
 
   const int64_t fast_counts = (length - initial_bits) / pop_len;
 
@@ -96,17 +159,13 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
 
   // popcount as much as possible with the widest possible count
   for (auto iter = u64_data; iter < end; ++iter) {
-    count += __builtin_popcountll(*iter);
+    count += BitUtil::PopCount(*iter);
   }
 
-  // Account for left over bit (in theory we could fall back to smaller
-  // versions of popcount but the code complexity is likely not worth it)
+  // Account for the left over bits, fewer than a word
   const int64_t tail_index = bit_offset + initial_bits + fast_counts * pop_len;
-  for (int64_t i = tail_index; i < bit_offset + length; ++i) {
-    if (BitUtil::GetBit(data, i)) {
-      ++count;
-    }
-  }
+  const int64_t tail_bits = bit_offset + length - tail_index;
+  count += BitUtil::PopCount(LoadBits(data, tail_index, tail_bits));
 
   return count;
 }
@@ -123,19 +182,11 @@ void TransferBitmap(const uint8_t* data, int64_t offset, int64_t length,
   dest += dest_byte_offset;
 
   if (dest_bit_offset > 0) {
-    internal::BitmapReader valid_reader(data, offset, length);
-    internal::BitmapWriter valid_writer(dest, dest_bit_offset, length);
-
-    for (int64_t i = 0; i < length; i++) {
-      if (invert_bits ^ valid_reader.IsSet()) {
-        valid_writer.Set();
-      } else {
-        valid_writer.Clear();
-      }
-      valid_reader.Next();
-      valid_writer.Next();
-    }
-    valid_writer.Finish();
+    // Shift whole words of the source into place
+    WriteBitsWordwise(dest, dest_bit_offset, length, [&](int64_t i, int64_t n) {
+      const uint64_t word = LoadBits(data, offset + i, n);
+      return invert_bits ? ~word : word;
+    });
   } else {
     // Take care of the trailing bits in the last byte
     int64_t trailing_bits = num_bytes * 8 - length;
@@ -267,13 +318,28 @@ void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* ri
   DCHECK_EQ(left_offset % 8, right_offset % 8);
   DCHECK_EQ(left_offset % 8, out_offset % 8);
 
-  const int64_t nbytes = BitUtil::BytesForBits(length + left_offset);
+  if (length == 0) {
+    return;
+  }
+  const int64_t bit_offset = left_offset % 8;
+  const int64_t end_bit_offset = (bit_offset + length) % 8;
+  const int64_t nbytes = BitUtil::BytesForBits(length + bit_offset);
   left += left_offset / 8;
   right += right_offset / 8;
   out += out_offset / 8;
+  const uint8_t first_byte = out[0];
+  const uint8_t last_byte = out[nbytes - 1];
   for (int64_t i = 0; i < nbytes; ++i) {
     out[i] = op(left[i], right[i]);
   }
+  // Restore the output bits around the range
+  out[0] = static_cast<uint8_t>((out[0] & BitUtil::kTrailingBitmask[bit_offset]) |
+                                (first_byte & BitUtil::kPrecedingBitmask[bit_offset]));
+  if (end_bit_offset != 0) {
+    const uint8_t mask = BitUtil::kPrecedingBitmask[end_bit_offset];
+    out[nbytes - 1] =
+        static_cast<uint8_t>((out[nbytes - 1] & mask) | (last_byte & ~mask));
+  }
 }
 
 template <typename Op>
@@ -281,43 +347,62 @@ void UnalignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t*
                        int64_t right_offset, uint8_t* out, int64_t out_offset,
                        int64_t length) {
   Op op;
-  auto left_reader = internal::BitmapReader(left, left_offset, length);
-  auto right_reader = internal::BitmapReader(right, right_offset, length);
-  auto writer = internal::BitmapWriter(out, out_offset, length);
-  for (int64_t i = 0; i < length; ++i) {
-    if (op(left_reader.IsSet(), right_reader.IsSet())) {
-      writer.Set();
-    }
-    left_reader.Next();
-    right_reader.Next();
-    writer.Next();
-  }
-  writer.Finish();
+  WriteBitsWordwise(out, out_offset, length, [&](int64_t i, int64_t n) {
+    return op(LoadBits(left, left_offset + i, n), LoadBits(right, right_offset + i, n));
+  });
 }
 
-template <typename BitOp, typename LogicalOp>
+// Bitwise operators on bytes and words
+
+struct BitAnd {
+  template <typename T>
+  T operator()(T left, T right) const {
+    return static_cast<T>(left & right);
+  }
+};
+
+struct BitOr {
+  template <typename T>
+  T operator()(T left, T right) const {
+    return static_cast<T>(left | right);
+  }
+};
+
+struct BitXor {
+  template <typename T>
+  T operator()(T left, T right) const {
+    return static_cast<T>(left ^ right);
+  }
+};
+
+struct BitAndNot {
+  template <typename T>
+  T operator()(T left, T right) const {
+    return static_cast<T>(left & ~right);
+  }
+};
+
+template <typename Op>
 void BitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* dest) {
   if ((out_offset % 8 == left_offset % 8) && (out_offset % 8 == right_offset % 8)) {
     // Fast case: can use bytewise AND
-    AlignedBitmapOp<BitOp>(left, left_offset, right, right_offset, dest, out_offset,
-                           length);
+    AlignedBitmapOp<Op>(left, left_offset, right, right_offset, dest, out_offset, length);
   } else {
-    // Unaligned
-    UnalignedBitmapOp<LogicalOp>(left, left_offset, right, right_offset, dest, out_offset,
-                                 length);
+    // Unaligned: shift whole words into place
+    UnalignedBitmapOp<Op>(left, left_offset, right, right_offset, dest, out_offset,
+                          length);
   }
 }
 
-template <typename BitOp, typename LogicalOp>
+template <typename Op>
 Status BitmapOp(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                 const uint8_t* right, int64_t right_offset, int64_t length,
                 int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
   const int64_t phys_bits = length + out_offset;
   RETURN_NOT_OK(AllocateEmptyBitmap(pool, phys_bits, out_buffer));
   uint8_t* out = (*out_buffer)->mutable_data();
-  BitmapOp<BitOp, LogicalOp>(left, left_offset, right, right_offset, length, out_offset,
-                             out);
+  BitmapOp<Op>(left, left_offset, right, right_offset, length, out_offset, out);
   return Status::OK();
 }
 
@@ -326,41 +411,129 @@ Status BitmapOp(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
 Status BitmapAnd(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                  const uint8_t* right, int64_t right_offset, int64_t length,
                  int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
-  return BitmapOp<std::bit_and<uint8_t>, std::logical_and<bool>>(
+  return BitmapOp<BitAnd>(
       pool, left, left_offset, right, right_offset, length, out_offset, out_buffer);
 }
 
 void BitmapAnd(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_and<uint8_t>, std::logical_and<bool>>(
+  BitmapOp<BitAnd>(
       left, left_offset, right, right_offset, length, out_offset, out);
 }
 
 Status BitmapOr(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                 const uint8_t* right, int64_t right_offset, int64_t length,
                 int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
-  return BitmapOp<std::bit_or<uint8_t>, std::logical_or<bool>>(
+  return BitmapOp<BitOr>(
       pool, left, left_offset, right, right_offset, length, out_offset, out_buffer);
 }
 
 void BitmapOr(const uint8_t* left, int64_t left_offset, const uint8_t* right,
               int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_or<uint8_t>, std::logical_or<bool>>(
+  BitmapOp<BitOr>(
       left, left_offset, right, right_offset, length, out_offset, out);
 }
 
 Status BitmapXor(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
                  const uint8_t* right, int64_t right_offset, int64_t length,
                  int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
-  return BitmapOp<std::bit_xor<uint8_t>, std::bit_xor<bool>>(
+  return BitmapOp<BitXor>(
       pool, left, left_offset, right, right_offset, length, out_offset, out_buffer);
 }
 
 void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out) {
-  BitmapOp<std::bit_xor<uint8_t>, std::bit_xor<bool>>(
+  BitmapOp<BitXor>(
       left, left_offset, right, right_offset, length, out_offset, out);
 }
 
+Status BitmapAndNot(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                    const uint8_t* right, int64_t right_offset, int64_t length,
+                    int64_t out_offset, std::shared_ptr<Buffer>* out_buffer) {
+  return BitmapOp<BitAndNot>(pool, left, left_offset, right, right_offset, length,
+                             out_offset, out_buffer);
+}
+
+void BitmapAndNot(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+                  int64_t right_offset, int64_t length, int64_t out_offset,
+                  uint8_t* out) {
+  BitmapOp<BitAndNot>(left, left_offset, right, right_offset, length, out_offset, out);
+}
+
+namespace {
+
+template <bool kValue>
+int64_t FindNextBit(const uint8_t* bitmap, int64_t offset, int64_t length) {
+  for (int64_t i = 0; i < length; i += 64) {
+    const int64_t nbits = std::min<int64_t>(64, length - i);
+    uint64_t word = LoadBits(bitmap, offset + i, nbits);
+    if (!kValue) {
+      word = ~word & LowBitsMask(nbits);
+    }
+    if (word != 0) {
+      return i + BitUtil::CountTrailingZeros(word);
+    }
+  }
+  return length;
+}
+
+template <typename IndexType>
+int64_t BitmapToIndicesImpl(const uint8_t* bitmap, int64_t offset, int64_t length,
+                            IndexType* out) {
+  IndexType* out_begin = out;
+  for (int64_t i = 0; i < length; i += 64) {
+    uint64_t word = LoadBits(bitmap, offset + i, std::min<int64_t>(64, length - i));
+    if (word == ~static_cast<uint64_t>(0)) {
+      // Dense runs of positions are written without bit scans
+      for (int64_t j = 0; j < 64; ++j) {
+        out[j] = static_cast<IndexType>(i + j);
+      }
+      out += 64;
+      continue;
+    }
+    while (word != 0) {
+      *out++ = static_cast<IndexType>(i + BitUtil::CountTrailingZeros(word));
+      // Clear the lowest set bit
+      word &= word - 1;
+    }
+  }
+  return out - out_begin;
+}
+
+}  // namespace
+
+int64_t FindNextSetBit(const uint8_t* bitmap, int64_t offset, int64_t length) {
+  return FindNextBit<true>(bitmap, offset, length);
+}
+
+int64_t FindNextUnsetBit(const uint8_t* bitmap, int64_t offset, int64_t length) {
+  return FindNextBit<false>(bitmap, offset, length);
+}
+
+int64_t BitmapToIndices(const uint8_t* bitmap, int64_t offset, int64_t length,
+                        uint16_t* out) {
+  return BitmapToIndicesImpl(bitmap, offset, length, out);
+}
+
+int64_t BitmapToIndices(const uint8_t* bitmap, int64_t offset, int64_t length,
+                        int32_t* out) {
+  return BitmapToIndicesImpl(bitmap, offset, length, out);
+}
+
+int64_t BitmapToIndices(const uint8_t* bitmap, int64_t offset, int64_t length,
+                        uint32_t* out) {
+  return BitmapToIndicesImpl(bitmap, offset, length, out);
+}
+
+int64_t BitmapToIndices(const uint8_t* bitmap, int64_t offset, int64_t length,
+                        int64_t* out) {
+  return BitmapToIndicesImpl(bitmap, offset, length, out);
+}
+
+int64_t BitmapToIndices(const uint8_t* bitmap, int64_t offset, int64_t length,
+                        uint64_t* out) {
+  return BitmapToIndicesImpl(bitmap, offset, length, out);
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -255,6 +255,21 @@ static inline int CountTrailingZeros(uint64_t value) {
 #endif
 }
 
+// Returns the number of set bits in a 64-bit word
+static inline int PopCount(uint64_t value) {
+#if defined(__clang__) || defined(__GNUC__)
+  return __builtin_popcountll(value);
+#elif defined(_MSC_VER)
+  return static_cast<int>(__popcnt64(value));
+#else
+  int count = 0;
+  for (int i = 0; i < 8; ++i) {
+    count += kBytePopcount[(value >> (i * 8)) & 0xFF];
+  }
+  return count;
+#endif
+}
+
 // Returns the minimum number of bits needed to represent an unsigned value
 static inline int NumRequiredBits(uint64_t x) { return 64 - CountLeadingZeros(x); }
 
@@ -793,6 +808,96 @@ ARROW_EXPORT
 void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                int64_t right_offset, int64_t length, int64_t out_offset, uint8_t* out);
 
+/// \brief Do a "bitmap and not" (left and not right) for the given
+/// bit-length on right and left buffers starting at their respective
+/// bit-offsets and put the results in out_buffer starting at the given
+/// bit-offset.
+///
+/// out_buffer will be allocated and initialized to zeros using pool before
+/// the operation.
+ARROW_EXPORT
+Status BitmapAndNot(MemoryPool* pool, const uint8_t* left, int64_t left_offset,
+                    const uint8_t* right, int64_t right_offset, int64_t length,
+                    int64_t out_offset, std::shared_ptr<Buffer>* out_buffer);
+
+/// \brief Do a "bitmap and not" (left and not right) for the given
+/// bit-length on right and left buffers starting at their respective
+/// bit-offsets and put the results in out starting at the given bit-offset.
+ARROW_EXPORT
+void BitmapAndNot(const uint8_t* left, int64_t left_offset, const uint8_t* right,
+                  int64_t right_offset, int64_t length, int64_t out_offset,
+                  uint8_t* out);
+
+// The binary bitmap operations above work on whole bytes when the three
+// offsets agree modulo 8, and otherwise shift whole 64-bit words of the
+// inputs into place, only falling back to partial words at the ends of the
+// range.
+
+/// \brief Find the first set bit in a bit range
+///
+/// \param[in] bitmap a packed LSB-ordered bitmap
+/// \param[in] offset the bit offset of the range
+/// \param[in] length the number of bits in the range
+///
+/// \return The position of the first set bit, relative to offset, or length
+/// if no bit is set
+ARROW_EXPORT
+int64_t FindNextSetBit(const uint8_t* bitmap, int64_t offset, int64_t length);
+
+/// \brief Find the first unset bit in a bit range, see FindNextSetBit
+ARROW_EXPORT
+int64_t FindNextUnsetBit(const uint8_t* bitmap, int64_t offset, int64_t length);
+
+/// \brief Call visit(position, run_length) for each run of set bits in a
+/// bit range, in order, with positions relative to offset
+template <typename Visit>
+void VisitSetBitRuns(const uint8_t* bitmap, int64_t offset, int64_t length,
+                     Visit&& visit) {
+  int64_t position = 0;
+  while (position < length) {
+    position += FindNextSetBit(bitmap, offset + position, length - position);
+    if (position == length) {
+      break;
+    }
+    const int64_t run_length =
+        FindNextUnsetBit(bitmap, offset + position, length - position);
+    visit(position, run_length);
+    position += run_length;
+  }
+}
+
+/// \brief Write the positions of the set bits of a bit range
+///
+/// \param[in] bitmap a packed LSB-ordered bitmap
+/// \param[in] offset the bit offset of the range
+/// \param[in] length the number of bits in the range, whose positions must
+/// fit in the index type
+/// \param[out] out the positions relative to offset, in increasing order;
+/// must have room for CountSetBits(bitmap, offset, length) of them
+///
+/// \return The number of positions written
+///
+/// Overloads are provided for the index types of selection vectors.
+ARROW_EXPORT
+int64_t BitmapToIndices(const uint8_t* bitmap, int64_t offset, int64_t length,
+                        uint16_t* out);
+
+ARROW_EXPORT
+int64_t BitmapToIndices(const uint8_t* bitmap, int64_t offset, int64_t length,
+                        int32_t* out);
+
+ARROW_EXPORT
+int64_t BitmapToIndices(const uint8_t* bitmap, int64_t offset, int64_t length,
+                        uint32_t* out);
+
+ARROW_EXPORT
+int64_t BitmapToIndices(const uint8_t* bitmap, int64_t offset, int64_t length,
+                        int64_t* out);
+
+ARROW_EXPORT
+int64_t BitmapToIndices(const uint8_t* bitmap, int64_t offset, int64_t length,
+                        uint64_t* out);
+
 }  // namespace internal
 }  // namespace arrow
 
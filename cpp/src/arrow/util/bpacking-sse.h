@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Vectorized unpacking of bit-packed values, four 32-bit lanes at a time
+
+#ifndef ARROW_UTIL_BPACKING_SSE_H
+#define ARROW_UTIL_BPACKING_SSE_H
+
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/util/logging.h"
+#include "arrow/util/sse-util.h"
+
+namespace arrow {
+namespace internal {
+
+#ifdef ARROW_HAVE_SSE4_2
+
+/// Widest values unpack32_sse handles: a value starting at any bit of a
+/// byte must fit in the four bytes gathered into its lane
+static constexpr int kMaxSseUnpackBits = 25;
+
+/// \brief Unpack batch_size / 32 * 32 values of num_bits bits, with num_bits
+/// between 1 and kMaxSseUnpackBits, in the layout of unpack32
+///
+/// Eight consecutive values span num_bits bytes. The second four of them
+/// start num_bits / 2 bytes in, on a byte boundary or half-way through a
+/// byte, so one byte shuffle per half gathers the four bytes holding each
+/// value into its lane. Lanes are then shifted left by a multiplication to
+/// drop the bits above their value and right by 32 - num_bits. Input is
+/// never read past the packed bytes: the last values are unpacked from a
+/// padded copy.
+inline int unpack32_sse(const uint32_t* in, uint32_t* out, int batch_size,
+                        int num_bits) {
+  const int num_loops = batch_size / 32;
+  const int64_t num_octets = static_cast<int64_t>(num_loops) * 4;
+  const int64_t num_bytes = num_octets * num_bits;
+  const int half_offset = num_bits / 2;
+
+  __m128i shuffles[2];
+  __m128i multipliers[2];
+  for (int half = 0; half < 2; ++half) {
+    uint8_t shuffle[16];
+    uint32_t multiplier[4];
+    for (int lane = 0; lane < 4; ++lane) {
+      const int bit = (half * 4 + lane) * num_bits - half_offset * 8 * half;
+      for (int k = 0; k < 4; ++k) {
+        shuffle[lane * 4 + k] = static_cast<uint8_t>(bit / 8 + k);
+      }
+      multiplier[lane] = 1U << (32 - num_bits - bit % 8);
+    }
+    shuffles[half] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(shuffle));
+    multipliers[half] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(multiplier));
+  }
+  const __m128i low_shuffle = shuffles[0];
+  const __m128i high_shuffle = shuffles[1];
+  const __m128i low_multiplier = multipliers[0];
+  const __m128i high_multiplier = multipliers[1];
+  const __m128i shift = _mm_cvtsi32_si128(32 - num_bits);
+
+  auto UnpackOctet = [&](const uint8_t* octet_in, uint32_t* octet_out) {
+    __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(octet_in));
+    __m128i high =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(octet_in + half_offset));
+    low = _mm_srl_epi32(
+        _mm_mullo_epi32(_mm_shuffle_epi8(low, low_shuffle), low_multiplier), shift);
+    high = _mm_srl_epi32(
+        _mm_mullo_epi32(_mm_shuffle_epi8(high, high_shuffle), high_multiplier), shift);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(octet_out), low);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(octet_out + 4), high);
+  };
+
+  const uint8_t* bytes = reinterpret_cast<const uint8_t*>(in);
+  int64_t octet = 0;
+  for (; octet < num_octets; ++octet) {
+    const int64_t offset = octet * num_bits;
+    if (offset + half_offset + 16 > num_bytes) break;
+    UnpackOctet(bytes + offset, out + octet * 8);
+  }
+
+  if (octet < num_octets) {
+    // The remaining values lie within the last 16 + num_bits packed bytes
+    const int64_t tail_offset = octet * num_bits;
+    uint8_t tail[64] = {0};
+    memcpy(tail, bytes + tail_offset, static_cast<size_t>(num_bytes - tail_offset));
+    for (; octet < num_octets; ++octet) {
+      UnpackOctet(tail + (octet * num_bits - tail_offset), out + octet * 8);
+    }
+  }
+
+  return num_loops * 32;
+}
+
+#endif  // ARROW_HAVE_SSE4_2
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_BPACKING_SSE_H
@@ -27,6 +27,7 @@
 #ifndef ARROW_UTIL_BPACKING_H
 #define ARROW_UTIL_BPACKING_H
 
+#include "arrow/util/bpacking-sse.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -3195,6 +3196,12 @@ inline int unpack32(const uint32_t* in, uint32_t* out, int batch_size, int num_b
   batch_size = batch_size / 32 * 32;
   int num_loops = batch_size / 32;
 
+#ifdef ARROW_HAVE_SSE4_2
+  if (num_bits > 0 && num_bits <= kMaxSseUnpackBits) {
+    return unpack32_sse(in, out, batch_size, num_bits);
+  }
+#endif
+
   switch (num_bits) {
     case 0:
       for (int i = 0; i < num_loops; ++i) in = nullunpacker32(in, out + i * 32);
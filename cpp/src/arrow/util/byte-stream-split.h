@@ -0,0 +1,181 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Transposition of fixed-width values into byte streams and back, as
+// used by the Parquet BYTE_STREAM_SPLIT encoding: byte k of value i is
+// stored at position i of stream k
+
+#ifndef ARROW_UTIL_BYTE_STREAM_SPLIT_H
+#define ARROW_UTIL_BYTE_STREAM_SPLIT_H
+
+#include <cstdint>
+
+#include "arrow/util/sse-util.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief Scatter the bytes of num_values values of type T into
+/// sizeof(T) contiguous streams of num_values bytes each
+template <typename T>
+void ByteStreamSplitEncodeScalar(const uint8_t* raw_values, int64_t num_values,
+                                 uint8_t* out) {
+  constexpr int kNumStreams = static_cast<int>(sizeof(T));
+  for (int64_t i = 0; i < num_values; ++i) {
+    for (int k = 0; k < kNumStreams; ++k) {
+      out[k * num_values + i] = raw_values[i * kNumStreams + k];
+    }
+  }
+}
+
+/// \brief Gather num_values values of type T from sizeof(T) streams
+/// starting at data and stride bytes apart
+template <typename T>
+void ByteStreamSplitDecodeScalar(const uint8_t* data, int64_t num_values,
+                                 int64_t stride, T* out) {
+  constexpr int kNumStreams = static_cast<int>(sizeof(T));
+  auto out_bytes = reinterpret_cast<uint8_t*>(out);
+  for (int64_t i = 0; i < num_values; ++i) {
+    for (int k = 0; k < kNumStreams; ++k) {
+      out_bytes[i * kNumStreams + k] = data[k * stride + i];
+    }
+  }
+}
+
+#ifdef ARROW_HAVE_SSE2
+
+// Both kernels transpose blocks of 16 values, i.e. one 16-byte register
+// per stream.  Interleaving the bytes of the first half of the registers
+// with those of the second half, log2(sizeof(T)) times over, turns stream
+// registers into value registers; deinterleaving the even and odd bytes of
+// consecutive registers as many times is the inverse.
+
+template <typename T>
+void ByteStreamSplitEncodeSse2(const uint8_t* raw_values, int64_t num_values,
+                               uint8_t* out) {
+  constexpr int kNumStreams = static_cast<int>(sizeof(T));
+  constexpr int kNumStreamsLog2 = (kNumStreams == 8) ? 3 : 2;
+  constexpr int kHalf = kNumStreams / 2;
+  static_assert(kNumStreams == 4 || kNumStreams == 8, "only 4 and 8-byte types");
+
+  const int64_t num_blocks = num_values / 16;
+  const __m128i even_mask = _mm_set1_epi16(0x00FF);
+  __m128i stage[2][kNumStreams];
+  for (int64_t block = 0; block < num_blocks; ++block) {
+    for (int j = 0; j < kNumStreams; ++j) {
+      stage[0][j] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(raw_values + (block * kNumStreams + j) * 16));
+    }
+    int cur = 0;
+    for (int step = 0; step < kNumStreamsLog2; ++step, cur ^= 1) {
+      for (int j = 0; j < kHalf; ++j) {
+        const __m128i a = stage[cur][2 * j];
+        const __m128i b = stage[cur][2 * j + 1];
+        stage[cur ^ 1][j] =
+            _mm_packus_epi16(_mm_and_si128(a, even_mask), _mm_and_si128(b, even_mask));
+        stage[cur ^ 1][kHalf + j] =
+            _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+      }
+    }
+    for (int k = 0; k < kNumStreams; ++k) {
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k * num_values + block * 16),
+                       stage[cur][k]);
+    }
+  }
+
+  // Trailing values
+  for (int64_t i = num_blocks * 16; i < num_values; ++i) {
+    for (int k = 0; k < kNumStreams; ++k) {
+      out[k * num_values + i] = raw_values[i * kNumStreams + k];
+    }
+  }
+}
+
+template <typename T>
+void ByteStreamSplitDecodeSse2(const uint8_t* data, int64_t num_values, int64_t stride,
+                               T* out) {
+  constexpr int kNumStreams = static_cast<int>(sizeof(T));
+  constexpr int kNumStreamsLog2 = (kNumStreams == 8) ? 3 : 2;
+  constexpr int kHalf = kNumStreams / 2;
+  static_assert(kNumStreams == 4 || kNumStreams == 8, "only 4 and 8-byte types");
+
+  const int64_t num_blocks = num_values / 16;
+  auto out_bytes = reinterpret_cast<uint8_t*>(out);
+  __m128i stage[2][kNumStreams];
+  for (int64_t block = 0; block < num_blocks; ++block) {
+    for (int k = 0; k < kNumStreams; ++k) {
+      stage[0][k] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i*>(data + k * stride + block * 16));
+    }
+    int cur = 0;
+    for (int step = 0; step < kNumStreamsLog2; ++step, cur ^= 1) {
+      for (int j = 0; j < kHalf; ++j) {
+        const __m128i a = stage[cur][j];
+        const __m128i b = stage[cur][kHalf + j];
+        stage[cur ^ 1][2 * j] = _mm_unpacklo_epi8(a, b);
+        stage[cur ^ 1][2 * j + 1] = _mm_unpackhi_epi8(a, b);
+      }
+    }
+    for (int j = 0; j < kNumStreams; ++j) {
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(out_bytes + (block * kNumStreams + j) * 16),
+          stage[cur][j]);
+    }
+  }
+
+  // Trailing values
+  for (int64_t i = num_blocks * 16; i < num_values; ++i) {
+    for (int k = 0; k < kNumStreams; ++k) {
+      out_bytes[i * kNumStreams + k] = data[k * stride + i];
+    }
+  }
+}
+
+#endif  // ARROW_HAVE_SSE2
+
+/// \brief Scatter the bytes of num_values values of type T into
+/// sizeof(T) contiguous streams of num_values bytes each, with SSE2 where
+/// available
+template <typename T>
+void ByteStreamSplitEncode(const uint8_t* raw_values, int64_t num_values,
+                           uint8_t* out) {
+#ifdef ARROW_HAVE_SSE2
+  ByteStreamSplitEncodeSse2<T>(raw_values, num_values, out);
+#else
+  ByteStreamSplitEncodeScalar<T>(raw_values, num_values, out);
+#endif
+}
+
+/// \brief Gather num_values values of type T from sizeof(T) streams
+/// starting at data and stride bytes apart, with SSE2 where available
+///
+/// Decoding a range of values in the middle of the streams only requires
+/// offsetting data; stride remains the length of a whole stream.
+template <typename T>
+void ByteStreamSplitDecode(const uint8_t* data, int64_t num_values, int64_t stride,
+                           T* out) {
+#ifdef ARROW_HAVE_SSE2
+  ByteStreamSplitDecodeSse2<T>(data, num_values, stride, out);
+#else
+  ByteStreamSplitDecodeScalar<T>(data, num_values, stride, out);
+#endif
+}
+
+}  // namespace internal
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_BYTE_STREAM_SPLIT_H
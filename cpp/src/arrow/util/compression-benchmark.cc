@@ -17,14 +17,19 @@
 
 #include "benchmark/benchmark.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <random>
 #include <string>
 #include <vector>
 
+#include "arrow/buffer.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/compression.h"
+#ifdef ARROW_WITH_ZSTD
+#include "arrow/util/compression_zstd.h"
+#endif
 
 namespace arrow {
 namespace util {
@@ -180,6 +185,94 @@ static void BM_StreamingDecompression(
   BM_StreamingDecompression(COMPRESSION, data, state);
 }
 
+// One-shot compression at the level given as benchmark argument
+template <Compression::type COMPRESSION>
+static void BM_OneShotCompression(
+    benchmark::State& state) {                   // NOLINT non-const reference
+  auto data = MakeCompressibleData(1024 * 1024);  // 1 MB
+  std::unique_ptr<Codec> codec;
+  ABORT_NOT_OK(Codec::Create(COMPRESSION, static_cast<int>(state.range(0)), &codec));
+
+  std::vector<uint8_t> compressed(codec->MaxCompressedLen(data.size(), data.data()));
+  int64_t compressed_size = 0;
+  while (state.KeepRunning()) {
+    ABORT_NOT_OK(codec->Compress(data.size(), data.data(), compressed.size(),
+                                 compressed.data(), &compressed_size));
+  }
+  state.counters["ratio"] =
+      static_cast<double>(data.size()) / static_cast<double>(compressed_size);
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+// Small pages looking alike, as found in IPC streams and Parquet files
+std::vector<std::string> MakeSmallPages(int num_pages) {
+  std::vector<std::string> pages;
+  std::mt19937 engine(42);
+  std::uniform_int_distribution<> values(0, 1000000);
+  for (int i = 0; i < num_pages; ++i) {
+    std::string page;
+    for (int j = 0; j < 8; ++j) {
+      page += "{\"id\": " + std::to_string(values(engine)) + ", \"customer\": \"name " +
+              std::to_string(values(engine) % 100) +
+              "\", \"address\": \"Main Street, Springfield\", \"status\": \"active\"}";
+    }
+    pages.push_back(page);
+  }
+  return pages;
+}
+
+static void BM_SmallPagesCompression(
+    Codec* codec, const std::vector<std::string>& pages,
+    benchmark::State& state) {  // NOLINT non-const reference
+  int64_t total_size = 0;
+  int64_t max_page_size = 0;
+  for (const auto& page : pages) {
+    total_size += page.size();
+    max_page_size = std::max<int64_t>(max_page_size, page.size());
+  }
+  std::vector<uint8_t> compressed(codec->MaxCompressedLen(max_page_size, nullptr));
+
+  int64_t total_compressed_size = 0;
+  while (state.KeepRunning()) {
+    total_compressed_size = 0;
+    for (const auto& page : pages) {
+      const uint8_t* data = reinterpret_cast<const uint8_t*>(page.data());
+      int64_t compressed_size;
+      ABORT_NOT_OK(codec->Compress(page.size(), data, compressed.size(),
+                                   compressed.data(), &compressed_size));
+      total_compressed_size += compressed_size;
+    }
+  }
+  state.counters["ratio"] =
+      static_cast<double>(total_size) / static_cast<double>(total_compressed_size);
+  state.SetBytesProcessed(state.iterations() * total_size);
+}
+
+template <Compression::type COMPRESSION>
+static void BM_SmallPagesCompression(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::unique_ptr<Codec> codec;
+  ABORT_NOT_OK(Codec::Create(COMPRESSION, &codec));
+  BM_SmallPagesCompression(codec.get(), MakeSmallPages(1000), state);
+}
+
+#ifdef ARROW_WITH_ZSTD
+static void BM_SmallPagesCompressionZSTDDictionary(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto pages = MakeSmallPages(1000);
+  std::vector<std::shared_ptr<Buffer>> samples;
+  for (const auto& page : MakeSmallPages(500)) {
+    samples.push_back(Buffer::FromString(std::string(page)));
+  }
+  std::shared_ptr<Buffer> dictionary;
+  ABORT_NOT_OK(ZSTDCodec::TrainDictionary(samples, 16 * 1024, &dictionary));
+
+  ZSTDCodec codec;
+  ABORT_NOT_OK(codec.SetDictionary(*dictionary));
+  BM_SmallPagesCompression(&codec, pages, state);
+}
+#endif
+
 BENCHMARK_TEMPLATE(BM_StreamingCompression, Compression::GZIP)
     ->Unit(benchmark::kMillisecond)
     ->Repetitions(1);
@@ -206,5 +299,37 @@ BENCHMARK_TEMPLATE(BM_StreamingDecompression, Compression::LZ4)
     ->Unit(benchmark::kMillisecond)
     ->Repetitions(1);
 
+BENCHMARK_TEMPLATE(BM_OneShotCompression, Compression::GZIP)
+    ->Arg(1)
+    ->Arg(6)
+    ->Arg(9)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_OneShotCompression, Compression::BROTLI)
+    ->Arg(1)
+    ->Arg(5)
+    ->Arg(8)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_OneShotCompression, Compression::ZSTD)
+    ->Arg(-5)
+    ->Arg(1)
+    ->Arg(9)
+    ->Arg(19)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_OneShotCompression, Compression::LZ4)
+    ->Arg(-8)
+    ->Arg(1)
+    ->Arg(9)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_SmallPagesCompression, Compression::GZIP)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SmallPagesCompression, Compression::ZSTD)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SmallPagesCompression, Compression::LZ4)
+    ->Unit(benchmark::kMillisecond);
+#ifdef ARROW_WITH_ZSTD
+BENCHMARK(BM_SmallPagesCompressionZSTDDictionary)->Unit(benchmark::kMillisecond);
+#endif
+
 }  // namespace util
 }  // namespace arrow
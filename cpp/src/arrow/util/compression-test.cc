@@ -21,13 +21,18 @@
 #include <memory>
 #include <random>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/compression.h"
+#ifdef ARROW_WITH_ZSTD
+#include "arrow/util/compression_zstd.h"
+#endif
 
 using std::string;
 using std::vector;
@@ -447,6 +452,96 @@ TEST_P(CodecTest, StreamingRoundtrip) {
   }
 }
 
+TEST_P(CodecTest, CompressionLevels) {
+  std::vector<int> levels;
+  switch (GetCompression()) {
+    case Compression::GZIP:
+      levels = {0, 1, 9};
+      break;
+    case Compression::LZ4:
+      levels = {-8, 1, 3, 12};
+      break;
+    case Compression::BROTLI:
+      levels = {0, 5, 11};
+      break;
+    case Compression::ZSTD:
+      levels = {-5, 1, 19};
+      break;
+    case Compression::BZ2:
+      levels = {1, 9};
+      break;
+    default:
+      // SKIP: codec has no compression levels
+      return;
+  }
+
+  std::unique_ptr<Codec> default_codec = MakeCodec();
+  vector<uint8_t> data = MakeCompressibleData(100000);
+  for (int level : levels) {
+    std::unique_ptr<Codec> codec;
+    ASSERT_OK(Codec::Create(GetCompression(), level, &codec));
+    CheckStreamingRoundtrip(codec.get(), data);
+    if (GetCompression() == Compression::BZ2) {
+      // BZ2 doesn't support one-shot compression
+      continue;
+    }
+
+    // Data compressed at any level can be decompressed by any codec
+    int64_t max_compressed_len = codec->MaxCompressedLen(data.size(), data.data());
+    std::vector<uint8_t> compressed(max_compressed_len);
+    int64_t compressed_len;
+    ASSERT_OK(codec->Compress(data.size(), data.data(), max_compressed_len,
+                              compressed.data(), &compressed_len));
+    std::vector<uint8_t> decompressed(data.size());
+    int64_t decompressed_len;
+    ASSERT_OK(default_codec->Decompress(compressed_len, compressed.data(),
+                                        decompressed.size(), decompressed.data(),
+                                        &decompressed_len));
+    ASSERT_EQ(data.size(), decompressed_len);
+    ASSERT_EQ(data, decompressed);
+  }
+}
+
+TEST_P(CodecTest, ConcurrentOneShot) {
+  if (GetCompression() == Compression::BZ2) {
+    // SKIP: BZ2 doesn't support one-shot compression
+    return;
+  }
+
+  // Several threads sharing one codec, each compressing many small buffers
+  std::unique_ptr<Codec> codec = MakeCodec();
+  const int num_threads = 4;
+  std::vector<std::thread> threads;
+  std::vector<Status> statuses(num_threads);
+  for (int i = 0; i < num_threads; ++i) {
+    threads.emplace_back([&, i]() {
+      statuses[i] = [&]() -> Status {
+        for (int j = 0; j < 50; ++j) {
+          vector<uint8_t> data = MakeCompressibleData(1000 + 100 * i + j);
+          int64_t max_compressed_len = codec->MaxCompressedLen(data.size(), data.data());
+          std::vector<uint8_t> compressed(max_compressed_len);
+          int64_t compressed_len;
+          RETURN_NOT_OK(codec->Compress(data.size(), data.data(), max_compressed_len,
+                                        compressed.data(), &compressed_len));
+          std::vector<uint8_t> decompressed(data.size());
+          RETURN_NOT_OK(codec->Decompress(compressed_len, compressed.data(),
+                                          decompressed.size(), decompressed.data()));
+          if (decompressed != data) {
+            return Status::Invalid("Roundtrip mismatch");
+          }
+        }
+        return Status::OK();
+      }();
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& status : statuses) {
+    ASSERT_OK(status);
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(TestGZip, CodecTest, ::testing::Values(Compression::GZIP));
 
 INSTANTIATE_TEST_CASE_P(TestSnappy, CodecTest, ::testing::Values(Compression::SNAPPY));
@@ -466,5 +561,72 @@ INSTANTIATE_TEST_CASE_P(TestBZ2, CodecTest, ::testing::Values(Compression::BZ2))
 INSTANTIATE_TEST_CASE_P(TestZSTD, CodecTest, ::testing::Values(Compression::ZSTD));
 #endif
 
+TEST(TestCodecMisc, InvalidCompressionLevels) {
+  std::unique_ptr<Codec> codec;
+  ASSERT_RAISES(Invalid, Codec::Create(Compression::SNAPPY, 1, &codec));
+  ASSERT_RAISES(Invalid, Codec::Create(Compression::UNCOMPRESSED, 1, &codec));
+  ASSERT_RAISES(Invalid, Codec::Create(Compression::GZIP, 10, &codec));
+  ASSERT_RAISES(Invalid, Codec::Create(Compression::GZIP, -2, &codec));
+  ASSERT_RAISES(Invalid, Codec::Create(Compression::BROTLI, 12, &codec));
+  ASSERT_RAISES(Invalid, Codec::Create(Compression::BZ2, 0, &codec));
+}
+
+#ifdef ARROW_WITH_ZSTD
+TEST(TestZSTDCodec, Dictionary) {
+  // Many small pages sharing most of their contents
+  std::vector<std::shared_ptr<Buffer>> samples;
+  std::vector<std::string> pages;
+  for (int i = 0; i < 1000; ++i) {
+    std::string page = "{\"id\": " + std::to_string(i) + ", \"customer\": \"customer " +
+                       std::to_string(i % 37) + "\", \"address\": \"" +
+                       std::to_string(i % 101) + " Main Street, Springfield\", " +
+                       "\"status\": \"" + (i % 3 ? "active" : "suspended") + "\"}";
+    pages.push_back(page);
+    samples.push_back(Buffer::FromString(std::string(page)));
+  }
+  std::shared_ptr<Buffer> dictionary;
+  ASSERT_OK(ZSTDCodec::TrainDictionary(samples, 4096, &dictionary));
+  ASSERT_GT(dictionary->size(), 0);
+  ASSERT_LE(dictionary->size(), 4096);
+
+  ZSTDCodec c1, c2, plain;
+  Status st = c1.SetDictionary(*dictionary);
+  if (st.IsNotImplemented()) {
+    // SKIP: zstd too old for referenced dictionaries
+    return;
+  }
+  ASSERT_OK(st);
+  ASSERT_OK(c2.SetDictionary(*dictionary));
+
+  const std::string& page = pages[500];
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(page.data());
+  const int64_t size = static_cast<int64_t>(page.size());
+
+  auto compress = [&](Codec* codec, std::vector<uint8_t>* out) {
+    int64_t max_len = codec->MaxCompressedLen(size, data);
+    out->resize(max_len);
+    int64_t out_len;
+    ASSERT_OK(codec->Compress(size, data, max_len, out->data(), &out_len));
+    out->resize(out_len);
+  };
+  std::vector<uint8_t> with_dict, without_dict;
+  compress(&c1, &with_dict);
+  compress(&plain, &without_dict);
+  ASSERT_LT(with_dict.size(), without_dict.size());
+
+  std::vector<uint8_t> decompressed(size);
+  int64_t decompressed_len;
+  ASSERT_OK(c2.Decompress(with_dict.size(), with_dict.data(), size, decompressed.data(),
+                          &decompressed_len));
+  ASSERT_EQ(size, decompressed_len);
+  ASSERT_EQ(page, std::string(reinterpret_cast<const char*>(decompressed.data()),
+                              decompressed.size()));
+
+  // The dictionary is required to decompress
+  ASSERT_RAISES(IOError, plain.Decompress(with_dict.size(), with_dict.data(), size,
+                                          decompressed.data()));
+}
+#endif
+
 }  // namespace util
 }  // namespace arrow
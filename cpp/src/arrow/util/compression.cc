@@ -54,7 +54,53 @@ Decompressor::~Decompressor() {}
 
 Codec::~Codec() {}
 
+Status Codec::FindFrameLength(int64_t input_len, const uint8_t* input,
+                              int64_t* frame_len) {
+  return Status::NotImplemented(name(), " codec has no independent frames");
+}
+
+bool Codec::SupportsConcatenation() const { return false; }
+
+namespace {
+
+Status CheckCompressionLevel(const char* name, int level, int min_level,
+                             int max_level) {
+  if (level != kUseDefaultCompressionLevel && (level < min_level || level > max_level)) {
+    return Status::Invalid(name, " compression level must be between ", min_level,
+                           " and ", max_level, ", got ", level);
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
 Status Codec::Create(Compression::type codec_type, std::unique_ptr<Codec>* result) {
+  return Create(codec_type, kUseDefaultCompressionLevel, result);
+}
+
+Status Codec::Create(Compression::type codec_type, int compression_level,
+                     std::unique_ptr<Codec>* result) {
+  switch (codec_type) {
+    case Compression::UNCOMPRESSED:
+    case Compression::SNAPPY:
+    case Compression::LZO:
+      if (compression_level != kUseDefaultCompressionLevel) {
+        return Status::Invalid("Codec has no compression levels");
+      }
+      break;
+    case Compression::GZIP:
+      RETURN_NOT_OK(CheckCompressionLevel("Gzip", compression_level, 0, 9));
+      break;
+    case Compression::BROTLI:
+      RETURN_NOT_OK(CheckCompressionLevel("Brotli", compression_level, 0, 11));
+      break;
+    case Compression::BZ2:
+      RETURN_NOT_OK(CheckCompressionLevel("BZ2", compression_level, 1, 9));
+      break;
+    default:
+      break;
+  }
+
   switch (codec_type) {
     case Compression::UNCOMPRESSED:
       break;
@@ -67,7 +113,7 @@ Status Codec::Create(Compression::type codec_type, std::unique_ptr<Codec>* resul
 #endif
     case Compression::GZIP:
 #ifdef ARROW_WITH_ZLIB
-      result->reset(new GZipCodec());
+      result->reset(new GZipCodec(GZipCodec::GZIP, compression_level));
       break;
 #else
       return Status::NotImplemented("Gzip codec support not built");
@@ -76,28 +122,28 @@ Status Codec::Create(Compression::type codec_type, std::unique_ptr<Codec>* resul
       return Status::NotImplemented("LZO codec not implemented");
     case Compression::BROTLI:
 #ifdef ARROW_WITH_BROTLI
-      result->reset(new BrotliCodec());
+      result->reset(new BrotliCodec(compression_level));
       break;
 #else
       return Status::NotImplemented("Brotli codec support not built");
 #endif
     case Compression::LZ4:
 #ifdef ARROW_WITH_LZ4
-      result->reset(new Lz4Codec());
+      result->reset(new Lz4Codec(compression_level));
       break;
 #else
       return Status::NotImplemented("LZ4 codec support not built");
 #endif
     case Compression::ZSTD:
 #ifdef ARROW_WITH_ZSTD
-      result->reset(new ZSTDCodec());
+      result->reset(new ZSTDCodec(compression_level));
       break;
 #else
       return Status::NotImplemented("ZSTD codec support not built");
 #endif
     case Compression::BZ2:
 #ifdef ARROW_WITH_BZ2
-      result->reset(new BZ2Codec());
+      result->reset(new BZ2Codec(compression_level));
       break;
 #else
       return Status::NotImplemented("BZ2 codec support not built");
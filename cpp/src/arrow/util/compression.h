@@ -19,6 +19,7 @@
 #define ARROW_UTIL_COMPRESSION_H
 
 #include <cstdint>
+#include <limits>
 #include <memory>
 
 #include "arrow/util/visibility.h"
@@ -33,6 +34,9 @@ struct Compression {
 
 namespace util {
 
+/// Compression level standing for the default level of each codec
+constexpr int kUseDefaultCompressionLevel = std::numeric_limits<int>::min();
+
 /// \brief Streaming compressor interface
 ///
 class ARROW_EXPORT Compressor {
@@ -90,12 +94,33 @@ class ARROW_EXPORT Decompressor {
   // XXX add methods for buffer size heuristics?
 };
 
+/// \brief Compression codec
+///
+/// The one-shot functions may be called concurrently.  Codecs whose library
+/// has reusable contexts (zstd, zlib, LZ4 HC) keep a pool of them, so that
+/// compressing many small buffers doesn't set up a context each time.
 class ARROW_EXPORT Codec {
  public:
   virtual ~Codec();
 
   static Status Create(Compression::type codec, std::unique_ptr<Codec>* out);
 
+  /// \brief Create a codec compressing at the given level
+  ///
+  /// Higher levels trade speed for compression ratio.  Levels are those of
+  /// the underlying library: zstd (1 to 22, negative levels being faster),
+  /// gzip (0 to 9), brotli (0 to 11) and bz2 (1 to 9).  LZ4 levels of 3 and
+  /// more select the high-compression LZ4 HC compressor, negative levels -N
+  /// accelerate the fast compressor by N.
+  ///
+  /// \param[in] codec the compression type
+  /// \param[in] compression_level the level, or kUseDefaultCompressionLevel
+  /// \param[out] out the new codec
+  /// \return Invalid if the codec has no levels (e.g. Snappy) or the level
+  /// is out of range
+  static Status Create(Compression::type codec, int compression_level,
+                       std::unique_ptr<Codec>* out);
+
   /// \brief One-shot decompression function
   ///
   /// output_buffer_len must be correct and therefore be obtained in advance.
@@ -136,14 +161,33 @@ class ARROW_EXPORT Codec {
 
   virtual int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) = 0;
 
-  // XXX Should be able to choose compression level, or presets? ("fast", etc.)
-
   /// \brief Create a streaming compressor instance
   virtual Status MakeCompressor(std::shared_ptr<Compressor>* out) = 0;
 
   /// \brief Create a streaming decompressor instance
   virtual Status MakeDecompressor(std::shared_ptr<Decompressor>* out) = 0;
 
+  /// \brief Find the compressed length of the first frame of streaming data
+  ///
+  /// Some streaming formats consist of self-delimiting frames that can be
+  /// decompressed independently (e.g. zstd frames, LZ4 frames or BGZF gzip
+  /// members).  Their boundaries can be located without decompressing, which
+  /// allows decompressing several frames concurrently.
+  ///
+  /// \param[in] input_len the number of bytes of compressed data
+  /// \param[in] input the compressed data, starting at a frame boundary
+  /// \param[out] frame_len the length of the first frame, or 0 if more input
+  /// is needed to find it
+  /// \return NotImplemented if the data doesn't consist of such frames
+  virtual Status FindFrameLength(int64_t input_len, const uint8_t* input,
+                                 int64_t* frame_len);
+
+  /// \brief Whether concatenated compressed streams form a valid stream
+  ///
+  /// This is the case for gzip members, zstd and LZ4 frames, or bzip2
+  /// streams: standard decoders then output the concatenated data.
+  virtual bool SupportsConcatenation() const;
+
   virtual const char* name() const = 0;
 };
 
@@ -100,13 +100,12 @@ class BrotliCompressor : public Compressor {
     }
   }
 
-  Status Init() {
+  Status Init(int compression_level) {
     state_ = BrotliEncoderCreateInstance(nullptr, nullptr, nullptr);
     if (state_ == nullptr) {
       return BrotliError("Brotli init failed");
     }
-    if (!BrotliEncoderSetParameter(state_, BROTLI_PARAM_QUALITY,
-                                   kBrotliDefaultCompressionLevel)) {
+    if (!BrotliEncoderSetParameter(state_, BROTLI_PARAM_QUALITY, compression_level)) {
       return BrotliError("Brotli set compression level failed");
     }
     return Status::OK();
@@ -182,9 +181,14 @@ Status BrotliCompressor::End(int64_t output_len, uint8_t* output, int64_t* bytes
 // ----------------------------------------------------------------------
 // Brotli codec implementation
 
+BrotliCodec::BrotliCodec(int compression_level)
+    : compression_level_(compression_level == kUseDefaultCompressionLevel
+                             ? kBrotliDefaultCompressionLevel
+                             : compression_level) {}
+
 Status BrotliCodec::MakeCompressor(std::shared_ptr<Compressor>* out) {
   auto ptr = std::make_shared<BrotliCompressor>();
-  RETURN_NOT_OK(ptr->Init());
+  RETURN_NOT_OK(ptr->Init(compression_level_));
   *out = ptr;
   return Status::OK();
 }
@@ -224,7 +228,7 @@ Status BrotliCodec::Compress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer,
                              int64_t* output_len) {
   std::size_t output_size = output_buffer_len;
-  if (BrotliEncoderCompress(kBrotliDefaultCompressionLevel, BROTLI_DEFAULT_WINDOW,
+  if (BrotliEncoderCompress(compression_level_, BROTLI_DEFAULT_WINDOW,
                             BROTLI_DEFAULT_MODE, input_len, input, &output_size,
                             output_buffer) == BROTLI_FALSE) {
     return Status::IOError("Brotli compression failure.");
@@ -150,11 +150,11 @@ class BZ2Compressor : public Compressor {
     }
   }
 
-  Status Init() {
+  Status Init(int compression_level) {
     DCHECK(!initialized_);
     memset(&stream_, 0, sizeof(stream_));
     int ret;
-    ret = BZ2_bzCompressInit(&stream_, kBZ2DefaultCompressionLevel, 0, 0);
+    ret = BZ2_bzCompressInit(&stream_, compression_level, 0, 0);
     if (ret != BZ_OK) {
       return BZ2Error("bz2 compressor init failed: ", ret);
     }
@@ -171,7 +171,9 @@ class BZ2Compressor : public Compressor {
     int ret;
 
     ret = BZ2_bzCompress(&stream_, BZ_RUN);
-    if (ret == BZ_RUN_OK) {
+    // BZ2_bzCompress() reports a parameter error when it can't make any
+    // progress, which happens when a full block meets a full output buffer
+    if (ret == BZ_RUN_OK || (ret == BZ_PARAM_ERROR && stream_.avail_out == 0)) {
       *bytes_read = input_len - stream_.avail_in;
       *bytes_written = output_len - stream_.avail_out;
       return Status::OK();
@@ -224,9 +226,14 @@ class BZ2Compressor : public Compressor {
 // ----------------------------------------------------------------------
 // bz2 codec implementation
 
+BZ2Codec::BZ2Codec(int compression_level)
+    : compression_level_(compression_level == kUseDefaultCompressionLevel
+                             ? kBZ2DefaultCompressionLevel
+                             : compression_level) {}
+
 Status BZ2Codec::MakeCompressor(std::shared_ptr<Compressor>* out) {
   auto ptr = std::make_shared<BZ2Compressor>();
-  RETURN_NOT_OK(ptr->Init());
+  RETURN_NOT_OK(ptr->Init(compression_level_));
   *out = ptr;
   return Status::OK();
 }
@@ -31,6 +31,8 @@ namespace util {
 // BZ2 codec.
 class ARROW_EXPORT BZ2Codec : public Codec {
  public:
+  explicit BZ2Codec(int compression_level = kUseDefaultCompressionLevel);
+
   Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_buffer_len,
                     uint8_t* output_buffer) override;
 
@@ -46,7 +48,12 @@ class ARROW_EXPORT BZ2Codec : public Codec {
 
   Status MakeDecompressor(std::shared_ptr<Decompressor>* out) override;
 
+  bool SupportsConcatenation() const override { return true; }
+
   const char* name() const override { return "bz2"; }
+
+ private:
+  int compression_level_;
 };
 
 }  // namespace util
@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_COMPRESSION_INTERNAL_H
+#define ARROW_UTIL_COMPRESSION_INTERNAL_H
+
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace util {
+namespace internal {
+
+/// \brief A pool of reusable compression library contexts
+///
+/// One-shot compression and decompression borrow a context for the duration
+/// of the call, so that each thread ends up reusing the same few contexts
+/// instead of setting up a new one per call.  Contexts are created on demand
+/// and freed with the pool.
+template <typename Context>
+class ContextPool {
+ public:
+  using CreateFunc = std::function<Status(Context**)>;
+  using FreeFunc = std::function<void(Context*)>;
+
+  ContextPool(CreateFunc create, FreeFunc free)
+      : create_(std::move(create)), free_(std::move(free)) {}
+
+  ~ContextPool() {
+    for (Context* context : contexts_) {
+      free_(context);
+    }
+  }
+
+  /// \brief A borrowed context, returned to the pool on destruction
+  class Lease {
+   public:
+    Lease() : pool_(NULLPTR), context_(NULLPTR) {}
+    ~Lease() {
+      if (context_ != NULLPTR) {
+        pool_->Return(context_);
+      }
+    }
+
+    Context* get() const { return context_; }
+
+   private:
+    friend class ContextPool;
+
+    ContextPool* pool_;
+    Context* context_;
+
+    ARROW_DISALLOW_COPY_AND_ASSIGN(Lease);
+  };
+
+  /// \brief Borrow a context, creating one if none is free
+  Status Borrow(Lease* out) {
+    DCHECK_EQ(out->context_, NULLPTR);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!contexts_.empty()) {
+        out->context_ = contexts_.back();
+        contexts_.pop_back();
+      }
+    }
+    if (out->context_ == NULLPTR) {
+      RETURN_NOT_OK(create_(&out->context_));
+    }
+    out->pool_ = this;
+    return Status::OK();
+  }
+
+ private:
+  void Return(Context* context) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    contexts_.push_back(context);
+  }
+
+  CreateFunc create_;
+  FreeFunc free_;
+  std::mutex mutex_;
+  // Free contexts
+  std::vector<Context*> contexts_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ContextPool);
+};
+
+}  // namespace internal
+}  // namespace util
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_COMPRESSION_INTERNAL_H
@@ -23,14 +23,20 @@
 
 #include <lz4.h>
 #include <lz4frame.h>
+#include <lz4hc.h>
 
 #include "arrow/status.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/compression_internal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 
 namespace arrow {
 namespace util {
 
+// Levels from this one up select the high compression (HC) mode
+constexpr int kLz4MinHCCompressionLevel = 3;
+
 static Status LZ4Error(LZ4F_errorCode_t ret, const char* prefix_msg) {
   return Status::IOError(prefix_msg, LZ4F_getErrorName(ret));
 }
@@ -92,7 +98,8 @@ class LZ4Decompressor : public Decompressor {
 
 class LZ4Compressor : public Compressor {
  public:
-  LZ4Compressor() {}
+  explicit LZ4Compressor(int compression_level)
+      : compression_level_(compression_level) {}
 
   ~LZ4Compressor() override {
     if (ctx_ != nullptr) {
@@ -103,6 +110,9 @@ class LZ4Compressor : public Compressor {
   Status Init() {
     LZ4F_errorCode_t ret;
     memset(&prefs_, 0, sizeof(prefs_));
+    if (compression_level_ != kUseDefaultCompressionLevel) {
+      prefs_.compressionLevel = compression_level_;
+    }
     first_time_ = true;
 
     ret = LZ4F_createCompressionContext(&ctx_, LZ4F_VERSION);
@@ -123,6 +133,7 @@ class LZ4Compressor : public Compressor {
              bool* should_retry) override;
 
  protected:
+  int compression_level_;
   LZ4F_cctx* ctx_ = nullptr;
   LZ4F_preferences_t prefs_;
   bool first_time_;
@@ -229,8 +240,65 @@ Status LZ4Compressor::End(int64_t output_len, uint8_t* output, int64_t* bytes_wr
 // ----------------------------------------------------------------------
 // Lz4 codec implementation
 
+class Lz4Codec::Lz4CodecImpl {
+ public:
+  explicit Lz4CodecImpl(int compression_level)
+      : compression_level_(compression_level),
+        states_([this](char** out) { return CreateState(out); },
+                [](char* state) { delete[] state; }) {}
+
+  int compression_level() const { return compression_level_; }
+
+  Status Compress(int64_t input_len, const uint8_t* input, int64_t output_buffer_len,
+                  uint8_t* output_buffer, int64_t* output_len) {
+    // Reuse a compression state rather than have LZ4 set one up on the stack
+    // for every call
+    internal::ContextPool<char>::Lease lease;
+    RETURN_NOT_OK(states_.Borrow(&lease));
+    const char* src = reinterpret_cast<const char*>(input);
+    char* dst = reinterpret_cast<char*>(output_buffer);
+    const int src_size = static_cast<int>(input_len);
+    const int dst_capacity = static_cast<int>(output_buffer_len);
+    if (use_hc()) {
+      *output_len = LZ4_compress_HC_extStateHC(lease.get(), src, dst, src_size,
+                                               dst_capacity, compression_level_);
+    } else {
+      // Negative levels trade compression ratio for speed
+      const int acceleration =
+          compression_level_ != kUseDefaultCompressionLevel && compression_level_ < 0
+              ? -compression_level_
+              : 1;
+      *output_len = LZ4_compress_fast_extState(lease.get(), src, dst, src_size,
+                                               dst_capacity, acceleration);
+    }
+    if (*output_len == 0) {
+      return Status::IOError("Lz4 compression failure.");
+    }
+    return Status::OK();
+  }
+
+ private:
+  bool use_hc() const {
+    return compression_level_ != kUseDefaultCompressionLevel &&
+           compression_level_ >= kLz4MinHCCompressionLevel;
+  }
+
+  Status CreateState(char** out) {
+    *out = new char[use_hc() ? LZ4_sizeofStateHC() : LZ4_sizeofState()];
+    return Status::OK();
+  }
+
+  int compression_level_;
+  internal::ContextPool<char> states_;
+};
+
+Lz4Codec::Lz4Codec(int compression_level)
+    : impl_(new Lz4CodecImpl(compression_level)) {}
+
+Lz4Codec::~Lz4Codec() {}
+
 Status Lz4Codec::MakeCompressor(std::shared_ptr<Compressor>* out) {
-  auto ptr = std::make_shared<LZ4Compressor>();
+  auto ptr = std::make_shared<LZ4Compressor>(impl_->compression_level());
   RETURN_NOT_OK(ptr->Init());
   *out = ptr;
   return Status::OK();
@@ -243,6 +311,67 @@ Status Lz4Codec::MakeDecompressor(std::shared_ptr<Decompressor>* out) {
   return Status::OK();
 }
 
+namespace {
+
+constexpr uint32_t kLz4FrameMagic = 0x184D2204;
+constexpr uint32_t kLz4SkippableMagicMask = 0xFFFFFFF0;
+constexpr uint32_t kLz4SkippableMagic = 0x184D2A50;
+
+uint32_t LoadLittleEndian32(const uint8_t* data) {
+  uint32_t value;
+  memcpy(&value, data, sizeof(value));
+  return BitUtil::FromLittleEndian(value);
+}
+
+}  // namespace
+
+// Walk the frame header and block sizes, as described in the LZ4 frame format
+// specification, without decompressing anything
+Status Lz4Codec::FindFrameLength(int64_t input_len, const uint8_t* input,
+                                 int64_t* frame_len) {
+  *frame_len = 0;
+  if (input_len < 4) {
+    return Status::OK();
+  }
+  const uint32_t magic = LoadLittleEndian32(input);
+  if ((magic & kLz4SkippableMagicMask) == kLz4SkippableMagic) {
+    if (input_len >= 8) {
+      const int64_t length = 8 + static_cast<int64_t>(LoadLittleEndian32(input + 4));
+      *frame_len = length <= input_len ? length : 0;
+    }
+    return Status::OK();
+  }
+  if (magic != kLz4FrameMagic) {
+    return Status::NotImplemented("Not a LZ4 frame");
+  }
+  if (input_len < 5) {
+    return Status::OK();
+  }
+  const uint8_t flags = input[4];
+  const bool block_checksum = (flags & 0x10) != 0;
+  const bool content_size = (flags & 0x08) != 0;
+  const bool content_checksum = (flags & 0x04) != 0;
+  const bool dict_id = (flags & 0x01) != 0;
+
+  // Magic, FLG, BD, optional content size and dictionary id, header checksum
+  int64_t pos = 4 + 2 + (content_size ? 8 : 0) + (dict_id ? 4 : 0) + 1;
+  while (true) {
+    if (pos + 4 > input_len) {
+      return Status::OK();
+    }
+    const uint32_t block_size = LoadLittleEndian32(input + pos) & 0x7FFFFFFF;
+    pos += 4;
+    if (block_size == 0) {
+      // EndMark
+      break;
+    }
+    pos += block_size + (block_checksum ? 4 : 0);
+  }
+  pos += content_checksum ? 4 : 0;
+  *frame_len = pos <= input_len ? pos : 0;
+  return Status::OK();
+}
+
 Status Lz4Codec::Decompress(int64_t input_len, const uint8_t* input,
                             int64_t output_buffer_len, uint8_t* output_buffer) {
   return Decompress(input_len, input, output_buffer_len, output_buffer, nullptr);
@@ -271,13 +400,7 @@ int64_t Lz4Codec::MaxCompressedLen(int64_t input_len,
 Status Lz4Codec::Compress(int64_t input_len, const uint8_t* input,
                           int64_t output_buffer_len, uint8_t* output_buffer,
                           int64_t* output_len) {
-  *output_len = LZ4_compress_default(
-      reinterpret_cast<const char*>(input), reinterpret_cast<char*>(output_buffer),
-      static_cast<int>(input_len), static_cast<int>(output_buffer_len));
-  if (*output_len == 0) {
-    return Status::IOError("Lz4 compression failure.");
-  }
-  return Status::OK();
+  return impl_->Compress(input_len, input, output_buffer_len, output_buffer, output_len);
 }
 
 }  // namespace util
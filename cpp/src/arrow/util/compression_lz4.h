@@ -31,6 +31,9 @@ namespace util {
 // Lz4 codec.
 class ARROW_EXPORT Lz4Codec : public Codec {
  public:
+  explicit Lz4Codec(int compression_level = kUseDefaultCompressionLevel);
+  ~Lz4Codec() override;
+
   Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_buffer_len,
                     uint8_t* output_buffer) override;
 
@@ -46,7 +49,16 @@ class ARROW_EXPORT Lz4Codec : public Codec {
 
   Status MakeDecompressor(std::shared_ptr<Decompressor>* out) override;
 
+  Status FindFrameLength(int64_t input_len, const uint8_t* input,
+                         int64_t* frame_len) override;
+
+  bool SupportsConcatenation() const override { return true; }
+
   const char* name() const override { return "lz4"; }
+
+ private:
+  class Lz4CodecImpl;
+  std::unique_ptr<Lz4CodecImpl> impl_;
 };
 
 }  // namespace util
@@ -29,13 +29,16 @@
 #include <zlib.h>
 
 #include "arrow/status.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/compression_internal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 
 namespace arrow {
 namespace util {
 
-constexpr int kGZipDefaultCompressionLevel = 9;
+// zlib's memLevel: use the most memory, for speed
+constexpr int kGZipMemoryLevel = 9;
 
 // ----------------------------------------------------------------------
 // gzip implementation
@@ -167,15 +170,15 @@ class GZipCompressor : public Compressor {
     }
   }
 
-  Status Init(GZipCodec::Format format) {
+  Status Init(GZipCodec::Format format, int compression_level) {
     DCHECK(!initialized_);
     memset(&stream_, 0, sizeof(stream_));
 
     int ret;
     // Initialize to run specified format
     int window_bits = CompressionWindowBitsForFormat(format);
-    if ((ret = deflateInit2(&stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED, window_bits,
-                            kGZipDefaultCompressionLevel, Z_DEFAULT_STRATEGY)) != Z_OK) {
+    if ((ret = deflateInit2(&stream_, compression_level, Z_DEFLATED, window_bits,
+                            kGZipMemoryLevel, Z_DEFAULT_STRATEGY)) != Z_OK) {
       return ZlibError("zlib deflateInit failed: ");
     } else {
       initialized_ = true;
@@ -301,23 +304,33 @@ Status GZipCompressor::End(int64_t output_len, uint8_t* output, int64_t* bytes_w
 
 class GZipCodec::GZipCodecImpl {
  public:
-  explicit GZipCodecImpl(GZipCodec::Format format)
+  GZipCodecImpl(GZipCodec::Format format, int compression_level)
       : format_(format),
-        compressor_initialized_(false),
-        decompressor_initialized_(false) {}
-
-  ~GZipCodecImpl() {
-    EndCompressor();
-    EndDecompressor();
-  }
+        compression_level_(compression_level == kUseDefaultCompressionLevel
+                               ? Z_DEFAULT_COMPRESSION
+                               : compression_level),
+        compression_streams_(
+            [this](z_stream** out) { return CreateCompressionStream(out); },
+            [](z_stream* stream) {
+              (void)deflateEnd(stream);
+              delete stream;
+            }),
+        decompression_streams_(
+            [this](z_stream** out) { return CreateDecompressionStream(out); },
+            [](z_stream* stream) {
+              (void)inflateEnd(stream);
+              delete stream;
+            }) {}
 
   Status MakeCompressor(std::shared_ptr<Compressor>* out) {
     auto ptr = std::make_shared<GZipCompressor>();
-    RETURN_NOT_OK(ptr->Init(format_));
+    RETURN_NOT_OK(ptr->Init(format_, compression_level_));
     *out = ptr;
     return Status::OK();
   }
 
+  GZipCodec::Format format() const { return format_; }
+
   Status MakeDecompressor(std::shared_ptr<Decompressor>* out) {
     auto ptr = std::make_shared<GZipDecompressor>();
     RETURN_NOT_OK(ptr->Init(format_));
@@ -325,55 +338,9 @@ class GZipCodec::GZipCodecImpl {
     return Status::OK();
   }
 
-  Status InitCompressor() {
-    EndDecompressor();
-    memset(&stream_, 0, sizeof(stream_));
-
-    int ret;
-    // Initialize to run specified format
-    int window_bits = CompressionWindowBitsForFormat(format_);
-    if ((ret = deflateInit2(&stream_, Z_DEFAULT_COMPRESSION, Z_DEFLATED, window_bits,
-                            kGZipDefaultCompressionLevel, Z_DEFAULT_STRATEGY)) != Z_OK) {
-      return ZlibErrorPrefix("zlib deflateInit failed: ", stream_.msg);
-    }
-    compressor_initialized_ = true;
-    return Status::OK();
-  }
-
-  void EndCompressor() {
-    if (compressor_initialized_) {
-      (void)deflateEnd(&stream_);
-    }
-    compressor_initialized_ = false;
-  }
-
-  Status InitDecompressor() {
-    EndCompressor();
-    memset(&stream_, 0, sizeof(stream_));
-    int ret;
-
-    // Initialize to run either deflate or zlib/gzip format
-    int window_bits = DecompressionWindowBitsForFormat(format_);
-    if ((ret = inflateInit2(&stream_, window_bits)) != Z_OK) {
-      return ZlibErrorPrefix("zlib inflateInit failed: ", stream_.msg);
-    }
-    decompressor_initialized_ = true;
-    return Status::OK();
-  }
-
-  void EndDecompressor() {
-    if (decompressor_initialized_) {
-      (void)inflateEnd(&stream_);
-    }
-    decompressor_initialized_ = false;
-  }
-
   Status Decompress(int64_t input_length, const uint8_t* input,
                     int64_t output_buffer_length, uint8_t* output,
                     int64_t* output_length) {
-    if (!decompressor_initialized_) {
-      RETURN_NOT_OK(InitDecompressor());
-    }
     if (output_buffer_length == 0) {
       // The zlib library does not allow *output to be NULL, even when
       // output_buffer_length is 0 (inflate() will return Z_STREAM_ERROR). We don't
@@ -385,29 +352,28 @@ class GZipCodec::GZipCodecImpl {
       return Status::OK();
     }
 
+    internal::ContextPool<z_stream>::Lease lease;
+    RETURN_NOT_OK(decompression_streams_.Borrow(&lease));
+    z_stream* stream = lease.get();
+
     // Reset the stream for this block
-    if (inflateReset(&stream_) != Z_OK) {
-      return ZlibErrorPrefix("zlib inflateReset failed: ", stream_.msg);
+    if (inflateReset(stream) != Z_OK) {
+      return ZlibErrorPrefix("zlib inflateReset failed: ", stream->msg);
     }
 
-    int ret = 0;
     // gzip can run in streaming mode or non-streaming mode.  We only
     // support the non-streaming use case where we present it the entire
     // compressed input and a buffer big enough to contain the entire
-    // compressed output.  In the case where we don't know the output,
-    // we just make a bigger buffer and try the non-streaming mode
-    // from the beginning again.
-    while (ret != Z_STREAM_END) {
-      stream_.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input));
-      stream_.avail_in = static_cast<uInt>(input_length);
-      stream_.next_out = reinterpret_cast<Bytef*>(output);
-      stream_.avail_out = static_cast<uInt>(output_buffer_length);
-
-      // We know the output size.  In this case, we can use Z_FINISH
-      // which is more efficient.
-      ret = inflate(&stream_, Z_FINISH);
-      if (ret == Z_STREAM_END || ret != Z_OK) break;
-
+    // compressed output.
+    stream->next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input));
+    stream->avail_in = static_cast<uInt>(input_length);
+    stream->next_out = reinterpret_cast<Bytef*>(output);
+    stream->avail_out = static_cast<uInt>(output_buffer_length);
+
+    // We know the output size.  In this case, we can use Z_FINISH
+    // which is more efficient.
+    int ret = inflate(stream, Z_FINISH);
+    if (ret == Z_OK) {
       // Failure, buffer was too small
       return Status::IOError("Too small a buffer passed to GZipCodec. InputLength=",
                              input_length, " OutputLength=", output_buffer_length);
@@ -415,23 +381,21 @@ class GZipCodec::GZipCodecImpl {
 
     // Failure for some other reason
     if (ret != Z_STREAM_END) {
-      return ZlibErrorPrefix("GZipCodec failed: ", stream_.msg);
+      return ZlibErrorPrefix("GZipCodec failed: ", stream->msg);
     }
 
     if (output_length) {
-      *output_length = stream_.total_out;
+      *output_length = stream->total_out;
     }
 
     return Status::OK();
   }
 
   int64_t MaxCompressedLen(int64_t input_length, const uint8_t* ARROW_ARG_UNUSED(input)) {
-    // Must be in compression mode
-    if (!compressor_initialized_) {
-      Status s = InitCompressor();
-      DCHECK(s.ok());
-    }
-    int64_t max_len = deflateBound(&stream_, static_cast<uLong>(input_length));
+    internal::ContextPool<z_stream>::Lease lease;
+    Status s = compression_streams_.Borrow(&lease);
+    DCHECK(s.ok());
+    int64_t max_len = deflateBound(lease.get(), static_cast<uLong>(input_length));
     // ARROW-3514: return a more pessimistic estimate to account for bugs
     // in old zlib versions.
     return max_len + 12;
@@ -439,55 +403,77 @@ class GZipCodec::GZipCodecImpl {
 
   Status Compress(int64_t input_length, const uint8_t* input, int64_t output_buffer_len,
                   uint8_t* output, int64_t* output_len) {
-    if (!compressor_initialized_) {
-      RETURN_NOT_OK(InitCompressor());
+    internal::ContextPool<z_stream>::Lease lease;
+    RETURN_NOT_OK(compression_streams_.Borrow(&lease));
+    z_stream* stream = lease.get();
+
+    stream->next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input));
+    stream->avail_in = static_cast<uInt>(input_length);
+    stream->next_out = reinterpret_cast<Bytef*>(output);
+    stream->avail_out = static_cast<uInt>(output_buffer_len);
+
+    int64_t ret = deflate(stream, Z_FINISH);
+    // Reset the stream for the next call, whatever the outcome
+    const int64_t output_remaining = stream->avail_out;
+    const char* msg = stream->msg;
+    if (deflateReset(stream) != Z_OK) {
+      return ZlibErrorPrefix("zlib deflateReset failed: ", stream->msg);
     }
-    stream_.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(input));
-    stream_.avail_in = static_cast<uInt>(input_length);
-    stream_.next_out = reinterpret_cast<Bytef*>(output);
-    stream_.avail_out = static_cast<uInt>(output_buffer_len);
-
-    int64_t ret = 0;
-    if ((ret = deflate(&stream_, Z_FINISH)) != Z_STREAM_END) {
+    if (ret != Z_STREAM_END) {
       if (ret == Z_OK) {
         // Will return Z_OK (and stream.msg NOT set) if stream.avail_out is too
         // small
         return Status::IOError("zlib deflate failed, output buffer too small");
       }
 
-      return ZlibErrorPrefix("zlib deflate failed: ", stream_.msg);
-    }
-
-    if (deflateReset(&stream_) != Z_OK) {
-      return ZlibErrorPrefix("zlib deflateReset failed: ", stream_.msg);
+      return ZlibErrorPrefix("zlib deflate failed: ", msg);
     }
 
     // Actual output length
-    *output_len = output_buffer_len - stream_.avail_out;
+    *output_len = output_buffer_len - output_remaining;
     return Status::OK();
   }
 
  private:
-  // zlib is stateful and the z_stream state variable must be initialized
-  // before
-  z_stream stream_;
+  Status CreateCompressionStream(z_stream** out) {
+    std::unique_ptr<z_stream> stream(new z_stream);
+    memset(stream.get(), 0, sizeof(z_stream));
+    // Initialize to run specified format
+    int window_bits = CompressionWindowBitsForFormat(format_);
+    if (deflateInit2(stream.get(), compression_level_, Z_DEFLATED, window_bits,
+                     kGZipMemoryLevel, Z_DEFAULT_STRATEGY) != Z_OK) {
+      return ZlibErrorPrefix("zlib deflateInit failed: ", stream->msg);
+    }
+    *out = stream.release();
+    return Status::OK();
+  }
+
+  Status CreateDecompressionStream(z_stream** out) {
+    std::unique_ptr<z_stream> stream(new z_stream);
+    memset(stream.get(), 0, sizeof(z_stream));
+    // Initialize to run either deflate or zlib/gzip format
+    int window_bits = DecompressionWindowBitsForFormat(format_);
+    if (inflateInit2(stream.get(), window_bits) != Z_OK) {
+      return ZlibErrorPrefix("zlib inflateInit failed: ", stream->msg);
+    }
+    *out = stream.release();
+    return Status::OK();
+  }
 
   // Realistically, this will always be GZIP, but we leave the option open to
   // configure
   GZipCodec::Format format_;
+  int compression_level_;
 
-  // These variables are mutually exclusive. When the codec is in "compressor"
-  // state, compressor_initialized_ is true while decompressor_initialized_ is
-  // false. When it's decompressing, the opposite is true.
-  //
-  // Indeed, this is slightly hacky, but the alternative is having separate
-  // Compressor and Decompressor classes. If this ever becomes an issue, we can
-  // perform the refactoring then
-  bool compressor_initialized_;
-  bool decompressor_initialized_;
+  // zlib is stateful and each z_stream is set up for either compression or
+  // decompression.  One-shot calls borrow one for their duration, reset
+  // for each call.
+  internal::ContextPool<z_stream> compression_streams_;
+  internal::ContextPool<z_stream> decompression_streams_;
 };
 
-GZipCodec::GZipCodec(Format format) { impl_.reset(new GZipCodecImpl(format)); }
+GZipCodec::GZipCodec(Format format, int compression_level)
+    : impl_(new GZipCodecImpl(format, compression_level)) {}
 
 GZipCodec::~GZipCodec() {}
 
@@ -520,6 +506,55 @@ Status GZipCodec::MakeDecompressor(std::shared_ptr<Decompressor>* out) {
   return impl_->MakeDecompressor(out);
 }
 
+// BGZF files are made of gzip members announcing their own size in an
+// extra field (see the SAM/BAM format specification)
+Status GZipCodec::FindFrameLength(int64_t input_len, const uint8_t* input,
+                                  int64_t* frame_len) {
+  static constexpr uint8_t kGZipMagic[] = {31, 139, 8};
+  static constexpr uint8_t kFlagExtra = 4;
+  // The fixed header and the length of the extra field
+  static constexpr int64_t kHeaderLength = 12;
+
+  *frame_len = 0;
+  if (impl_->format() != GZIP) {
+    return Status::NotImplemented("Only gzip members can be delimited");
+  }
+  const int64_t magic_len = std::min<int64_t>(input_len, sizeof(kGZipMagic));
+  if (memcmp(input, kGZipMagic, static_cast<size_t>(magic_len)) != 0 ||
+      (input_len > 3 && (input[3] & kFlagExtra) == 0)) {
+    return Status::NotImplemented("Not a BGZF gzip member");
+  }
+  if (input_len < kHeaderLength) {
+    return Status::OK();
+  }
+  uint16_t extra_len;
+  memcpy(&extra_len, input + 10, sizeof(extra_len));
+  extra_len = BitUtil::FromLittleEndian(extra_len);
+  if (input_len < kHeaderLength + extra_len) {
+    return Status::OK();
+  }
+  // Look for the "BC" subfield, holding the member size minus 1
+  const uint8_t* subfield = input + kHeaderLength;
+  const uint8_t* extra_end = subfield + extra_len;
+  while (subfield + 4 <= extra_end) {
+    uint16_t subfield_len;
+    memcpy(&subfield_len, subfield + 2, sizeof(subfield_len));
+    subfield_len = BitUtil::FromLittleEndian(subfield_len);
+    if (subfield[0] == 'B' && subfield[1] == 'C' && subfield_len == 2 &&
+        subfield + 6 <= extra_end) {
+      uint16_t block_size;
+      memcpy(&block_size, subfield + 4, sizeof(block_size));
+      const int64_t member_len = BitUtil::FromLittleEndian(block_size) + 1;
+      *frame_len = member_len <= input_len ? member_len : 0;
+      return Status::OK();
+    }
+    subfield += 4 + subfield_len;
+  }
+  return Status::NotImplemented("Not a BGZF gzip member");
+}
+
+bool GZipCodec::SupportsConcatenation() const { return impl_->format() == GZIP; }
+
 const char* GZipCodec::name() const { return "gzip"; }
 
 }  // namespace util
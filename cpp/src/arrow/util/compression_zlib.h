@@ -38,7 +38,8 @@ class ARROW_EXPORT GZipCodec : public Codec {
     GZIP,
   };
 
-  explicit GZipCodec(Format format = GZIP);
+  explicit GZipCodec(Format format = GZIP,
+                     int compression_level = kUseDefaultCompressionLevel);
   ~GZipCodec() override;
 
   Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_buffer_len,
@@ -56,10 +57,14 @@ class ARROW_EXPORT GZipCodec : public Codec {
 
   Status MakeDecompressor(std::shared_ptr<Decompressor>* out) override;
 
+  Status FindFrameLength(int64_t input_len, const uint8_t* input,
+                         int64_t* frame_len) override;
+
+  bool SupportsConcatenation() const override;
+
   const char* name() const override;
 
  private:
-  // The gzip compressor is stateful
   class GZipCodecImpl;
   std::unique_ptr<GZipCodecImpl> impl_;
 };
@@ -19,11 +19,16 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <sstream>
 
+#include <zdict.h>
 #include <zstd.h>
+#include <zstd_errors.h>
 
+#include "arrow/buffer.h"
 #include "arrow/status.h"
+#include "arrow/util/compression_internal.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 
@@ -48,9 +53,22 @@ class ZSTDDecompressor : public Decompressor {
 
   ~ZSTDDecompressor() override { ZSTD_freeDStream(stream_); }
 
-  Status Init() {
+  Status Init(const ZSTD_DDict* dictionary) {
     finished_ = false;
-    size_t ret = ZSTD_initDStream(stream_);
+    size_t ret;
+    if (dictionary != nullptr) {
+#if ZSTD_VERSION_NUMBER >= 10400
+      ret = ZSTD_DCtx_reset(stream_, ZSTD_reset_session_only);
+      if (!ZSTD_isError(ret)) {
+        ret = ZSTD_DCtx_refDDict(stream_, dictionary);
+      }
+#else
+      return Status::NotImplemented(
+          "ZSTD streaming with a dictionary requires ZSTD >= 1.4.0");
+#endif
+    } else {
+      ret = ZSTD_initDStream(stream_);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
     } else {
@@ -99,8 +117,21 @@ class ZSTDCompressor : public Compressor {
 
   ~ZSTDCompressor() override { ZSTD_freeCStream(stream_); }
 
-  Status Init() {
-    size_t ret = ZSTD_initCStream(stream_, kZSTDDefaultCompressionLevel);
+  Status Init(int compression_level, const ZSTD_CDict* dictionary) {
+    size_t ret;
+    if (dictionary != nullptr) {
+#if ZSTD_VERSION_NUMBER >= 10400
+      ret = ZSTD_CCtx_reset(stream_, ZSTD_reset_session_only);
+      if (!ZSTD_isError(ret)) {
+        ret = ZSTD_CCtx_refCDict(stream_, dictionary);
+      }
+#else
+      return Status::NotImplemented(
+          "ZSTD streaming with a dictionary requires ZSTD >= 1.4.0");
+#endif
+    } else {
+      ret = ZSTD_initCStream(stream_, compression_level);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
     } else {
@@ -183,48 +214,194 @@ Status ZSTDCompressor::End(int64_t output_len, uint8_t* output, int64_t* bytes_w
 // ----------------------------------------------------------------------
 // ZSTD codec implementation
 
-Status ZSTDCodec::MakeCompressor(std::shared_ptr<Compressor>* out) {
-  auto ptr = std::make_shared<ZSTDCompressor>();
-  RETURN_NOT_OK(ptr->Init());
-  *out = ptr;
+class ZSTDCodec::ZSTDCodecImpl {
+ public:
+  explicit ZSTDCodecImpl(int compression_level)
+      : compression_level_(compression_level == kUseDefaultCompressionLevel
+                               ? kZSTDDefaultCompressionLevel
+                               : compression_level),
+        compression_contexts_(
+            [](ZSTD_CCtx** out) {
+              *out = ZSTD_createCCtx();
+              return *out != nullptr
+                         ? Status::OK()
+                         : Status::OutOfMemory("Failed to create ZSTD context");
+            },
+            [](ZSTD_CCtx* context) { ZSTD_freeCCtx(context); }),
+        decompression_contexts_(
+            [](ZSTD_DCtx** out) {
+              *out = ZSTD_createDCtx();
+              return *out != nullptr
+                         ? Status::OK()
+                         : Status::OutOfMemory("Failed to create ZSTD context");
+            },
+            [](ZSTD_DCtx* context) { ZSTD_freeDCtx(context); }) {}
+
+  ~ZSTDCodecImpl() {
+    ZSTD_freeCDict(cdict_);
+    ZSTD_freeDDict(ddict_);
+  }
+
+  Status SetDictionary(const Buffer& dictionary) {
+    ZSTD_freeCDict(cdict_);
+    ZSTD_freeDDict(ddict_);
+    // Digested dictionaries are built once and shared by all contexts
+    cdict_ = ZSTD_createCDict(dictionary.data(), static_cast<size_t>(dictionary.size()),
+                              compression_level_);
+    ddict_ = ZSTD_createDDict(dictionary.data(), static_cast<size_t>(dictionary.size()));
+    if (cdict_ == nullptr || ddict_ == nullptr) {
+      return Status::Invalid("Invalid ZSTD dictionary");
+    }
+    return Status::OK();
+  }
+
+  Status MakeCompressor(std::shared_ptr<Compressor>* out) {
+    auto ptr = std::make_shared<ZSTDCompressor>();
+    RETURN_NOT_OK(ptr->Init(compression_level_, cdict_));
+    *out = ptr;
+    return Status::OK();
+  }
+
+  Status MakeDecompressor(std::shared_ptr<Decompressor>* out) {
+    auto ptr = std::make_shared<ZSTDDecompressor>();
+    RETURN_NOT_OK(ptr->Init(ddict_));
+    *out = ptr;
+    return Status::OK();
+  }
+
+  Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_buffer_len,
+                    uint8_t* output_buffer, int64_t* output_len) {
+    if (output_buffer == nullptr) {
+      // We may pass a NULL 0-byte output buffer but some zstd versions demand
+      // a valid pointer: https://github.com/facebook/zstd/issues/1385
+      static uint8_t empty_buffer[1];
+      DCHECK_EQ(output_buffer_len, 0);
+      output_buffer = empty_buffer;
+    }
+
+    internal::ContextPool<ZSTD_DCtx>::Lease context;
+    RETURN_NOT_OK(decompression_contexts_.Borrow(&context));
+    size_t ret;
+    if (ddict_ != nullptr) {
+      ret = ZSTD_decompress_usingDDict(context.get(), output_buffer,
+                                       static_cast<size_t>(output_buffer_len), input,
+                                       static_cast<size_t>(input_len), ddict_);
+    } else {
+      ret = ZSTD_decompressDCtx(context.get(), output_buffer,
+                                static_cast<size_t>(output_buffer_len), input,
+                                static_cast<size_t>(input_len));
+    }
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD decompression failed: ");
+    }
+    if (static_cast<int64_t>(ret) != output_buffer_len) {
+      return Status::IOError("Corrupt ZSTD compressed data.");
+    }
+    if (output_len) {
+      *output_len = static_cast<int64_t>(ret);
+    }
+    return Status::OK();
+  }
+
+  Status Compress(int64_t input_len, const uint8_t* input, int64_t output_buffer_len,
+                  uint8_t* output_buffer, int64_t* output_len) {
+    internal::ContextPool<ZSTD_CCtx>::Lease context;
+    RETURN_NOT_OK(compression_contexts_.Borrow(&context));
+    size_t ret;
+    if (cdict_ != nullptr) {
+      ret = ZSTD_compress_usingCDict(context.get(), output_buffer,
+                                     static_cast<size_t>(output_buffer_len), input,
+                                     static_cast<size_t>(input_len), cdict_);
+    } else {
+      ret = ZSTD_compressCCtx(context.get(), output_buffer,
+                              static_cast<size_t>(output_buffer_len), input,
+                              static_cast<size_t>(input_len), compression_level_);
+    }
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD compression failed: ");
+    }
+    *output_len = static_cast<int64_t>(ret);
+    return Status::OK();
+  }
+
+ private:
+  int compression_level_;
+  ZSTD_CDict* cdict_ = nullptr;
+  ZSTD_DDict* ddict_ = nullptr;
+  internal::ContextPool<ZSTD_CCtx> compression_contexts_;
+  internal::ContextPool<ZSTD_DCtx> decompression_contexts_;
+};
+
+ZSTDCodec::ZSTDCodec(int compression_level)
+    : impl_(new ZSTDCodecImpl(compression_level)) {}
+
+ZSTDCodec::~ZSTDCodec() {}
+
+Status ZSTDCodec::SetDictionary(const Buffer& dictionary) {
+  return impl_->SetDictionary(dictionary);
+}
+
+Status ZSTDCodec::TrainDictionary(const std::vector<std::shared_ptr<Buffer>>& samples,
+                                  int64_t max_size, std::shared_ptr<Buffer>* out) {
+  // The trainer takes the samples concatenated
+  std::vector<uint8_t> sample_data;
+  std::vector<size_t> sample_sizes;
+  for (const auto& sample : samples) {
+    sample_data.insert(sample_data.end(), sample->data(),
+                       sample->data() + sample->size());
+    sample_sizes.push_back(static_cast<size_t>(sample->size()));
+  }
+  std::shared_ptr<ResizableBuffer> dictionary;
+  RETURN_NOT_OK(AllocateResizableBuffer(max_size, &dictionary));
+  size_t ret = ZDICT_trainFromBuffer(dictionary->mutable_data(),
+                                     static_cast<size_t>(max_size), sample_data.data(),
+                                     sample_sizes.data(),
+                                     static_cast<unsigned>(sample_sizes.size()));
+  if (ZDICT_isError(ret)) {
+    return Status::Invalid("ZSTD dictionary training failed: ", ZDICT_getErrorName(ret));
+  }
+  RETURN_NOT_OK(dictionary->Resize(static_cast<int64_t>(ret)));
+  *out = dictionary;
   return Status::OK();
 }
 
+Status ZSTDCodec::MakeCompressor(std::shared_ptr<Compressor>* out) {
+  return impl_->MakeCompressor(out);
+}
+
 Status ZSTDCodec::MakeDecompressor(std::shared_ptr<Decompressor>* out) {
-  auto ptr = std::make_shared<ZSTDDecompressor>();
-  RETURN_NOT_OK(ptr->Init());
-  *out = ptr;
-  return Status::OK();
+  return impl_->MakeDecompressor(out);
+}
+
+Status ZSTDCodec::FindFrameLength(int64_t input_len, const uint8_t* input,
+                                  int64_t* frame_len) {
+  *frame_len = 0;
+#if ZSTD_VERSION_NUMBER >= 10400
+  size_t ret = ZSTD_findFrameCompressedSize(input, static_cast<size_t>(input_len));
+  if (!ZSTD_isError(ret)) {
+    *frame_len = static_cast<int64_t>(ret);
+    return Status::OK();
+  }
+  if (ZSTD_getErrorCode(ret) == ZSTD_error_srcSize_wrong) {
+    // Incomplete frame
+    return Status::OK();
+  }
+  return Status::NotImplemented("Not a ZSTD frame: ", ZSTD_getErrorName(ret));
+#else
+  return Status::NotImplemented("ZSTD frame lookup requires ZSTD >= 1.4.0");
+#endif
 }
 
 Status ZSTDCodec::Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) {
-  return Decompress(input_len, input, output_buffer_len, output_buffer, nullptr);
+  return impl_->Decompress(input_len, input, output_buffer_len, output_buffer, nullptr);
 }
 
 Status ZSTDCodec::Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer,
                              int64_t* output_len) {
-  if (output_buffer == nullptr) {
-    // We may pass a NULL 0-byte output buffer but some zstd versions demand
-    // a valid pointer: https://github.com/facebook/zstd/issues/1385
-    static uint8_t empty_buffer[1];
-    DCHECK_EQ(output_buffer_len, 0);
-    output_buffer = empty_buffer;
-  }
-
-  size_t ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len),
-                               input, static_cast<size_t>(input_len));
-  if (ZSTD_isError(ret)) {
-    return ZSTDError(ret, "ZSTD decompression failed: ");
-  }
-  if (static_cast<int64_t>(ret) != output_buffer_len) {
-    return Status::IOError("Corrupt ZSTD compressed data.");
-  }
-  if (output_len) {
-    *output_len = static_cast<int64_t>(ret);
-  }
-  return Status::OK();
+  return impl_->Decompress(input_len, input, output_buffer_len, output_buffer,
+                           output_len);
 }
 
 int64_t ZSTDCodec::MaxCompressedLen(int64_t input_len,
@@ -235,14 +412,7 @@ int64_t ZSTDCodec::MaxCompressedLen(int64_t input_len,
 Status ZSTDCodec::Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer,
                            int64_t* output_len) {
-  size_t ret =
-      ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len), input,
-                    static_cast<size_t>(input_len), kZSTDDefaultCompressionLevel);
-  if (ZSTD_isError(ret)) {
-    return ZSTDError(ret, "ZSTD compression failed: ");
-  }
-  *output_len = static_cast<int64_t>(ret);
-  return Status::OK();
+  return impl_->Compress(input_len, input, output_buffer_len, output_buffer, output_len);
 }
 
 }  // namespace util
@@ -20,17 +20,41 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
+
+class Buffer;
+
 namespace util {
 
 // ZSTD codec.
 class ARROW_EXPORT ZSTDCodec : public Codec {
  public:
+  explicit ZSTDCodec(int compression_level = kUseDefaultCompressionLevel);
+  ~ZSTDCodec() override;
+
+  /// \brief Compress and decompress with a dictionary
+  ///
+  /// Small inputs sharing content with the dictionary, such as many similar
+  /// pages, compress much better.  Data compressed with a dictionary can only
+  /// be decompressed by a codec with the same dictionary.  This must be
+  /// called before using the codec.  Streaming with a dictionary requires
+  /// zstd 1.4.0 or later.
+  Status SetDictionary(const Buffer& dictionary);
+
+  /// \brief Train a dictionary on samples of the data to compress
+  ///
+  /// \param[in] samples typical inputs, e.g. a few hundred pages
+  /// \param[in] max_size the maximum dictionary size, e.g. 100 KB
+  /// \param[out] out the dictionary, for SetDictionary()
+  static Status TrainDictionary(const std::vector<std::shared_ptr<Buffer>>& samples,
+                                int64_t max_size, std::shared_ptr<Buffer>* out);
+
   Status Decompress(int64_t input_len, const uint8_t* input, int64_t output_buffer_len,
                     uint8_t* output_buffer) override;
 
@@ -46,7 +70,16 @@ class ARROW_EXPORT ZSTDCodec : public Codec {
 
   Status MakeDecompressor(std::shared_ptr<Decompressor>* out) override;
 
+  Status FindFrameLength(int64_t input_len, const uint8_t* input,
+                         int64_t* frame_len) override;
+
+  bool SupportsConcatenation() const override { return true; }
+
   const char* name() const override { return "zstd"; }
+
+ private:
+  class ZSTDCodecImpl;
+  std::unique_ptr<ZSTDCodecImpl> impl_;
 };
 
 }  // namespace util
@@ -49,6 +49,7 @@
 #include <string>
 
 #include "arrow/util/logging.h"
+#include "arrow/util/sse-util.h"
 
 using boost::algorithm::contains;
 using boost::algorithm::trim;
@@ -65,6 +66,7 @@ static struct {
     {"sse4_1", CpuInfo::SSE4_1},
     {"sse4_2", CpuInfo::SSE4_2},
     {"popcnt", CpuInfo::POPCNT},
+    {"avx2", CpuInfo::AVX2},
 };
 static const int64_t num_flags = sizeof(flag_mappings) / sizeof(flag_mappings[0]);
 
@@ -151,6 +153,13 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   __cpuidex(cpu_info.data(), register_ECX_id, 0);
   features_ECX = cpu_info[2];
 
+  // Extended features
+  std::bitset<32> features_EBX_7;
+  if (highest_valid_id >= 7) {
+    __cpuidex(cpu_info.data(), 7, 0);
+    features_EBX_7 = cpu_info[1];
+  }
+
   // Get highest extended id
   __cpuid(cpu_info.data(), 0x80000000);
   highest_extended_valid_id = cpu_info[0];
@@ -169,6 +178,7 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+  if (features_EBX_7[5]) *hardware_flags |= CpuInfo::AVX2;
   return true;
 }
 #endif
@@ -286,6 +296,14 @@ bool CpuInfo::CanUseSSE4_2() const {
 #endif
 }
 
+bool CpuInfo::CanUseAVX2() const {
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  return IsSupported(CpuInfo::AVX2);
+#else
+  return false;
+#endif
+}
+
 void CpuInfo::EnableFeature(int64_t flag, bool enable) {
   if (!enable) {
     hardware_flags_ &= ~flag;
@@ -39,6 +39,7 @@ class ARROW_EXPORT CpuInfo {
   static constexpr int64_t SSE4_1 = (1 << 2);
   static constexpr int64_t SSE4_2 = (1 << 3);
   static constexpr int64_t POPCNT = (1 << 4);
+  static constexpr int64_t AVX2 = (1 << 5);
 
   /// Cache enums for L1 (data), L2 and L3
   enum CacheLevel {
@@ -63,6 +64,10 @@ class ARROW_EXPORT CpuInfo {
   /// with support for it
   bool CanUseSSE4_2() const;
 
+  /// \brief The processor supports AVX2 and the Arrow libraries are built
+  /// with runtime-dispatched AVX2 kernels
+  bool CanUseAVX2() const;
+
   /// Toggle a hardware feature on and off.  It is not valid to turn on a feature
   /// that the underlying hardware cannot support. This is useful for testing.
   void EnableFeature(int64_t flag, bool enable);
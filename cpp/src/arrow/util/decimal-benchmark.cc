@@ -41,5 +41,21 @@ static void BM_FromString(benchmark::State& state) {  // NOLINT non-const refere
 
 BENCHMARK(BM_FromString)->Repetitions(3)->Unit(benchmark::kMicrosecond);
 
+// Values of at most 18 digits and without exponent, as commonly found in CSV files
+static void BM_FromStringSmall(benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<std::string> values = {"0", "1.23", "-123456.789", "99999999999.9999999"};
+
+  while (state.KeepRunning()) {
+    for (const auto& value : values) {
+      Decimal128 dec;
+      int32_t scale, precision;
+      ARROW_UNUSED(Decimal128::FromString(value, &dec, &scale, &precision));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+BENCHMARK(BM_FromStringSmall)->Repetitions(3)->Unit(benchmark::kMicrosecond);
+
 }  // namespace Decimal
 }  // namespace arrow
@@ -19,8 +19,10 @@
 #include <array>
 #include <cmath>
 #include <cstdint>
+#include <limits>
 #include <string>
 #include <tuple>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -225,6 +227,37 @@ TEST(DecimalZerosTest, NoLeadingZerosDecimalPoint) {
   ASSERT_EQ(0, d);
 }
 
+TEST(DecimalTest, FromStringDigitsBoundary) {
+  // Up to 18 digits without exponent are parsed as 64-bit integers, more
+  // digits by the general parser
+  struct Case {
+    std::string value;
+    std::string expected;
+    int32_t precision;
+    int32_t scale;
+  };
+  std::vector<Case> cases = {
+      {"123456789012345678", "123456789012345678", 18, 0},
+      {"-1234567890123456789", "-1234567890123456789", 19, 0},
+      {"+12345678901234567.8", "123456789012345678", 18, 1},
+      {"-0.000000000000000001", "-1", 18, 18},
+      {"00000000000000000000.5", "5", 1, 1},
+      {"-99999999999999999.9", "-999999999999999999", 18, 1},
+      {"999999999999999999.9", "9999999999999999999", 19, 1},
+  };
+  for (const auto& c : cases) {
+    Decimal128 d;
+    int32_t precision, scale;
+    ASSERT_OK(Decimal128::FromString(c.value, &d, &precision, &scale));
+    ASSERT_EQ(Decimal128(c.expected), d) << c.value;
+    ASSERT_EQ(c.precision, precision) << c.value;
+    ASSERT_EQ(c.scale, scale) << c.value;
+  }
+  Decimal128 d;
+  ASSERT_RAISES(Invalid, Decimal128::FromString("1.2.3", &d));
+  ASSERT_RAISES(Invalid, Decimal128::FromString("-.", &d));
+}
+
 template <typename T>
 class Decimal128Test : public ::testing::Test {
  public:
@@ -586,4 +619,58 @@ TEST(Decimal128Test, ReduceScaleAndRound) {
   ASSERT_EQ(-1238, out);
 }
 
+TEST(Decimal128Test, MultiplyAndReduceScaleBy) {
+  Decimal128 result;
+
+  // The unscaled product needs more than 128 bits
+  ASSERT_EQ(DecimalStatus::kSuccess,
+            Decimal128("150000000000000000000").MultiplyAndReduceScaleBy(
+                Decimal128("-200000000000000000000"), 20, &result));
+  ASSERT_EQ(result.ToIntegerString(), "-300000000000000000000");
+
+  ASSERT_EQ(DecimalStatus::kSuccess, Decimal128("-12345").MultiplyAndReduceScaleBy(
+                                         Decimal128("-10"), 3, &result));
+  ASSERT_EQ(result.ToIntegerString(), "123");
+
+  ASSERT_EQ(DecimalStatus::kOverflow,
+            Decimal128("100000000000000000000000000000000000000")
+                .MultiplyAndReduceScaleBy(Decimal128("100"), 1, &result));
+}
+
+TEST(Decimal128Test, IncreaseScaleAndDivide) {
+  Decimal128 result;
+
+  // The unscaled dividend needs more than 128 bits
+  ASSERT_EQ(DecimalStatus::kSuccess,
+            Decimal128("100000000000000000000000000000000").IncreaseScaleAndDivide(
+                20, Decimal128("300000000000000000000"), &result));
+  ASSERT_EQ(result.ToIntegerString(), "33333333333333333333333333333333");
+
+  // Divisors of a single 32-bit digit
+  ASSERT_EQ(DecimalStatus::kSuccess,
+            Decimal128("-7").IncreaseScaleAndDivide(2, Decimal128("2"), &result));
+  ASSERT_EQ(result.ToIntegerString(), "-350");
+
+  ASSERT_EQ(DecimalStatus::kDivideByZero,
+            Decimal128("1").IncreaseScaleAndDivide(2, Decimal128("0"), &result));
+  ASSERT_EQ(DecimalStatus::kOverflow,
+            Decimal128("100000000000000000000").IncreaseScaleAndDivide(
+                30, Decimal128("1"), &result));
+}
+
+TEST(Decimal128Test, Int64Helpers) {
+  ASSERT_EQ(1, BasicDecimal128::GetScaleMultiplier64(0));
+  ASSERT_EQ(1000000000000000000LL,
+            BasicDecimal128::GetScaleMultiplier64(BasicDecimal128::kMaxDigits64));
+  ASSERT_EQ(0, BasicDecimal128::GetScaleMultiplier64(BasicDecimal128::kMaxDigits64 + 1));
+
+  int64_t out;
+  ASSERT_TRUE(Decimal128("-9223372036854775808").ToInt64(&out));
+  ASSERT_EQ(std::numeric_limits<int64_t>::min(), out);
+  ASSERT_TRUE(Decimal128("9223372036854775807").ToInt64(&out));
+  ASSERT_EQ(std::numeric_limits<int64_t>::max(), out);
+  ASSERT_FALSE(Decimal128("9223372036854775808").ToInt64(&out));
+  ASSERT_FALSE(Decimal128("-9223372036854775809").ToInt64(&out));
+}
+
 }  // namespace arrow
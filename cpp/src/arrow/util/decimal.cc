@@ -277,6 +277,56 @@ bool ParseDecimalComponents(const char* s, size_t size, DecimalComponents* out)
   return pos == size;
 }
 
+// Parse the common case of a decimal without exponent and of at most 18
+// digits, which fits an int64_t, without allocating.  Return false if `s`
+// is not such a decimal, leaving the general parser to handle it.
+bool ParseSmallDecimal(const char* s, size_t size, Decimal128* out, int32_t* precision,
+                       int32_t* scale) {
+  size_t pos = 0;
+  bool negative = false;
+  if (pos < size && IsSign(s[pos])) {
+    negative = s[pos] == '-';
+    ++pos;
+  }
+  int64_t value = 0;
+  int32_t num_digits = 0;
+  // Digits of the whole part from the first non-zero one
+  int32_t whole_significant_digits = 0;
+  int32_t fractional_digits = 0;
+  bool has_dot = false;
+  for (; pos < size; ++pos) {
+    const char c = s[pos];
+    if (IsDigit(c)) {
+      if (++num_digits > static_cast<int32_t>(kInt64DecimalDigits)) {
+        return false;
+      }
+      value = value * 10 + (c - '0');
+      if (has_dot) {
+        ++fractional_digits;
+      } else if (value != 0) {
+        ++whole_significant_digits;
+      }
+    } else if (IsDot(c) && !has_dot) {
+      has_dot = true;
+    } else {
+      return false;
+    }
+  }
+  if (num_digits == 0) {
+    return false;
+  }
+  if (out != nullptr) {
+    *out = negative ? -value : value;
+  }
+  if (precision != nullptr) {
+    *precision = whole_significant_digits + fractional_digits;
+  }
+  if (scale != nullptr) {
+    *scale = fractional_digits;
+  }
+  return true;
+}
+
 }  // namespace
 
 Status Decimal128::FromString(const util::string_view& s, Decimal128* out,
@@ -284,6 +334,9 @@ Status Decimal128::FromString(const util::string_view& s, Decimal128* out,
   if (s.empty()) {
     return Status::Invalid("Empty string cannot be converted to decimal");
   }
+  if (ParseSmallDecimal(s.data(), s.size(), out, precision, scale)) {
+    return Status::OK();
+  }
 
   DecimalComponents dec;
   if (!ParseDecimalComponents(s.data(), s.size(), &dec)) {
@@ -0,0 +1,202 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/future.h"
+#include "arrow/util/thread-pool.h"
+
+namespace arrow {
+
+using internal::ThreadPool;
+
+static void SleepABit() { std::this_thread::sleep_for(std::chrono::milliseconds(5)); }
+
+TEST(Future, MakeFinished) {
+  auto fut = Future<int>::MakeFinished(42);
+  ASSERT_TRUE(fut.is_valid());
+  ASSERT_TRUE(fut.is_finished());
+  ASSERT_OK(fut.status());
+  int value = 0;
+  ASSERT_OK(fut.Get(&value));
+  ASSERT_EQ(value, 42);
+
+  fut = Future<int>::MakeFailed(Status::IOError("xxx"));
+  ASSERT_TRUE(fut.is_finished());
+  ASSERT_RAISES(IOError, fut.status());
+  ASSERT_RAISES(IOError, fut.Get(&value));
+  ASSERT_EQ(value, 42);
+
+  ASSERT_FALSE(Future<int>().is_valid());
+}
+
+TEST(Future, MarkFinishedFromThread) {
+  auto fut = Future<std::string>::Make();
+  ASSERT_FALSE(fut.is_finished());
+  ASSERT_FALSE(fut.Wait(0.001));
+
+  std::thread thread([fut]() {
+    SleepABit();
+    fut.MarkFinished("foo");
+  });
+  std::string value;
+  ASSERT_OK(fut.Get(&value));
+  ASSERT_EQ(value, "foo");
+  ASSERT_TRUE(fut.Wait(0.001));
+  thread.join();
+}
+
+TEST(Future, Callbacks) {
+  auto fut = Future<int>::Make();
+  std::vector<std::string> events;
+  fut.AddCallback([&](const Status& st) { events.push_back("1:" + st.ToString()); });
+  fut.AddCallback([&](const Status& st) { events.push_back("2:" + st.ToString()); });
+  ASSERT_EQ(events.size(), 0);
+  fut.MarkFailed(Status::Invalid("xxx"));
+  ASSERT_EQ(events.size(), 2);
+  ASSERT_EQ(events[0], "1:Invalid: xxx");
+  ASSERT_EQ(events[1], "2:Invalid: xxx");
+  // Already finished: callback runs immediately
+  fut.AddCallback([&](const Status& st) { events.push_back("3:" + st.ToString()); });
+  ASSERT_EQ(events.size(), 3);
+  ASSERT_EQ(events[2], "3:Invalid: xxx");
+}
+
+TEST(Future, Then) {
+  auto fut = Future<int>::Make();
+  auto next = fut.Then([](const int& x) {
+    return Future<std::string>::MakeFinished(std::to_string(x * 2));
+  });
+  auto last = next.Then([](const std::string& s) {
+    return Future<size_t>::MakeFinished(s.length());
+  });
+  ASSERT_FALSE(next.is_finished());
+  ASSERT_FALSE(last.is_finished());
+  fut.MarkFinished(512);
+
+  std::string s;
+  ASSERT_OK(next.Get(&s));
+  ASSERT_EQ(s, "1024");
+  size_t length = 0;
+  ASSERT_OK(last.Get(&length));
+  ASSERT_EQ(length, 4);
+
+  // Chaining on a finished Future
+  auto again = fut.Then([](const int& x) { return Future<int>::MakeFinished(x + 1); });
+  int value = 0;
+  ASSERT_OK(again.Get(&value));
+  ASSERT_EQ(value, 513);
+}
+
+TEST(Future, ThenErrors) {
+  int ncalls = 0;
+  auto on_success = [&](const int& x) {
+    ++ncalls;
+    return Future<int>::MakeFailed(Status::Invalid("continuation failed"));
+  };
+  // Error in the original Future
+  auto fut = Future<int>::MakeFailed(Status::IOError("xxx"));
+  auto next = fut.Then(on_success);
+  ASSERT_RAISES(IOError, next.status());
+  ASSERT_EQ(ncalls, 0);
+  // Error in the continuation
+  fut = Future<int>::MakeFinished(1);
+  next = fut.Then(on_success);
+  ASSERT_RAISES(Invalid, next.status());
+  ASSERT_EQ(ncalls, 1);
+}
+
+TEST(Future, WhenAll) {
+  std::vector<Future<int>> futures;
+  for (int i = 0; i < 5; ++i) {
+    futures.push_back(Future<int>::Make());
+  }
+  auto all = WhenAll(futures);
+  for (int i = 4; i >= 0; --i) {
+    ASSERT_FALSE(all.is_finished());
+    futures[i].MarkFinished(i * 10);
+  }
+  std::vector<int> values;
+  ASSERT_OK(all.Get(&values));
+  ASSERT_EQ(values, std::vector<int>({0, 10, 20, 30, 40}));
+
+  // Empty input
+  ASSERT_OK(WhenAll(std::vector<Future<int>>()).Get(&values));
+  ASSERT_EQ(values.size(), 0);
+}
+
+TEST(Future, WhenAllErrors) {
+  std::vector<Future<int>> futures;
+  for (int i = 0; i < 3; ++i) {
+    futures.push_back(Future<int>::Make());
+  }
+  auto all = WhenAll(futures);
+  futures[1].MarkFailed(Status::IOError("xxx"));
+  // The result isn't available until all inputs have finished
+  ASSERT_FALSE(all.is_finished());
+  futures[0].MarkFinished(1);
+  futures[2].MarkFailed(Status::Invalid("yyy"));
+  ASSERT_RAISES(IOError, all.status());
+}
+
+TEST(Future, SubmitAsync) {
+  std::shared_ptr<ThreadPool> pool;
+  ASSERT_OK(ThreadPool::Make(3, &pool));
+
+  const int N = 20;
+  std::vector<Future<int>> futures;
+  for (int i = 0; i < N; ++i) {
+    futures.push_back(pool->SubmitAsync<int>([i](int* out) {
+      SleepABit();
+      *out = i;
+      return Status::OK();
+    }));
+  }
+  // Chain CPU work on the pool after each result
+  std::vector<Future<int>> squares;
+  for (const auto& fut : futures) {
+    squares.push_back(fut.Then([pool](const int& x) {
+      return pool->SubmitAsync<int>([x](int* out) {
+        *out = x * x;
+        return Status::OK();
+      });
+    }));
+  }
+  std::vector<int> values;
+  ASSERT_OK(WhenAll(squares).Get(&values));
+  ASSERT_EQ(values.size(), N);
+  for (int i = 0; i < N; ++i) {
+    ASSERT_EQ(values[i], i * i);
+  }
+
+  auto failing = pool->SubmitAsync<int>([](int*) { return Status::IOError("xxx"); });
+  ASSERT_RAISES(IOError, failing.status());
+
+  ASSERT_OK(pool->Shutdown());
+  auto after_shutdown = pool->SubmitAsync<int>([](int*) { return Status::OK(); });
+  ASSERT_RAISES(Invalid, after_shutdown.status());
+}
+
+}  // namespace arrow
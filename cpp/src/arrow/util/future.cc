@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/future.h"
+
+#include <chrono>
+
+namespace arrow {
+namespace detail {
+
+bool FutureImpl::is_finished() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return finished_;
+}
+
+void FutureImpl::Wait() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  cv_.wait(lock, [this] { return finished_; });
+}
+
+bool FutureImpl::Wait(double seconds) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return cv_.wait_for(lock, std::chrono::duration<double>(seconds),
+                      [this] { return finished_; });
+}
+
+void FutureImpl::MarkFinished(Status st) {
+  std::vector<Callback> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DCHECK(!finished_) << "Future already finished";
+    status_ = std::move(st);
+    finished_ = true;
+    callbacks.swap(callbacks_);
+    cv_.notify_all();
+  }
+  // Run callbacks unlocked, as they may add callbacks to this Future
+  for (auto& callback : callbacks) {
+    callback(status_);
+  }
+}
+
+void FutureImpl::AddCallback(Callback callback) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!finished_) {
+      callbacks_.push_back(std::move(callback));
+      return;
+    }
+  }
+  callback(status_);
+}
+
+}  // namespace detail
+}  // namespace arrow
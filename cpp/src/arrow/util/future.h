@@ -0,0 +1,279 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_FUTURE_H
+#define ARROW_UTIL_FUTURE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+template <typename T>
+class Future;
+
+namespace detail {
+
+// The type-erased state shared by all copies of a Future
+class ARROW_EXPORT FutureImpl {
+ public:
+  using Callback = std::function<void(const Status&)>;
+
+  FutureImpl() = default;
+  virtual ~FutureImpl() = default;
+
+  bool is_finished();
+  void Wait();
+  bool Wait(double seconds);
+  // Only valid once finished
+  const Status& status() const { return status_; }
+
+  void MarkFinished(Status st);
+  void AddCallback(Callback callback);
+
+ protected:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool finished_ = false;
+  Status status_;
+  std::vector<Callback> callbacks_;
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(FutureImpl);
+};
+
+template <typename T>
+class FutureStorage : public FutureImpl {
+ public:
+  T value_;
+};
+
+template <typename T>
+struct is_future : std::false_type {};
+
+template <typename T>
+struct is_future<Future<T>> : std::true_type {};
+
+}  // namespace detail
+
+/// \brief The non-templated part of Future
+class ARROW_EXPORT FutureBase {
+ public:
+  /// Whether this Future refers to an asynchronous result
+  bool is_valid() const { return impl_ != NULLPTR; }
+
+  /// Whether the result is available.  Non-blocking.
+  bool is_finished() const { return impl_->is_finished(); }
+
+  /// Wait for the result to be available
+  void Wait() const { impl_->Wait(); }
+
+  /// Wait for at most the given number of seconds.
+  /// Return whether the result is available.
+  bool Wait(double seconds) const { return impl_->Wait(seconds); }
+
+  /// Wait for the result to be available and return its Status
+  Status status() const {
+    impl_->Wait();
+    return impl_->status();
+  }
+
+  /// \brief Add a callback to be run once the result is available
+  ///
+  /// The callback receives the final Status.  It is run in the thread that
+  /// completes the Future, or immediately in the calling thread if the
+  /// Future is already finished, so it should be cheap and non-blocking.
+  void AddCallback(std::function<void(const Status&)> callback) const {
+    impl_->AddCallback(std::move(callback));
+  }
+
+ protected:
+  FutureBase() = default;
+  explicit FutureBase(std::shared_ptr<detail::FutureImpl> impl)
+      : impl_(std::move(impl)) {}
+
+  std::shared_ptr<detail::FutureImpl> impl_;
+};
+
+/// \brief A handle to a value computed asynchronously
+///
+/// Contrary to std::future, a Future is copyable (all copies refer to the
+/// same result), carries an arrow::Status, and supports continuations
+/// through Then() and WhenAll().  It is completed by calling MarkFinished()
+/// or MarkFailed() exactly once, typically from a ThreadPool task
+/// (see ThreadPool::SubmitAsync()).
+///
+/// T must be default-constructible and copyable.
+template <typename T>
+class Future : public FutureBase {
+ public:
+  using ValueType = T;
+
+  /// Create an invalid Future, use Make() to create a pending one.
+  Future() = default;
+
+  /// Create a pending Future
+  static Future Make() { return Future(std::make_shared<detail::FutureStorage<T>>()); }
+
+  /// Create a Future already finished with the given value
+  static Future MakeFinished(T value) {
+    auto fut = Make();
+    fut.MarkFinished(std::move(value));
+    return fut;
+  }
+
+  /// Create a Future already failed with the given error Status
+  static Future MakeFailed(Status st) {
+    auto fut = Make();
+    fut.MarkFailed(std::move(st));
+    return fut;
+  }
+
+  /// Complete the Future with the given value
+  void MarkFinished(T value) const {
+    storage()->value_ = std::move(value);
+    impl_->MarkFinished(Status::OK());
+  }
+
+  /// Complete the Future with the given error Status
+  void MarkFailed(Status st) const {
+    DCHECK(!st.ok());
+    impl_->MarkFinished(std::move(st));
+  }
+
+  /// Wait for the result to be available.  If successful, store its value
+  /// in `out`, otherwise return the error Status.
+  Status Get(T* out) const {
+    impl_->Wait();
+    RETURN_NOT_OK(impl_->status());
+    *out = storage()->value_;
+    return Status::OK();
+  }
+
+  /// \brief Chain a continuation to be run on success
+  ///
+  /// `on_success` is called with the value as `const T&` and must return
+  /// a Future<U> (use Future<U>::MakeFinished() for synchronous results,
+  /// or ThreadPool::SubmitAsync() to run more work on a pool).
+  /// The returned Future<U> finishes when the continuation's Future does.
+  /// If this Future fails, `on_success` isn't called and the error is
+  /// propagated to the returned Future.
+  ///
+  /// As with AddCallback(), `on_success` runs in the thread completing
+  /// this Future.
+  template <typename OnSuccess,
+            typename NextFuture = typename std::result_of<OnSuccess(const T&)>::type>
+  NextFuture Then(OnSuccess on_success) const {
+    static_assert(detail::is_future<NextFuture>::value,
+                  "Then() continuation must return a Future");
+    using U = typename NextFuture::ValueType;
+
+    auto next = NextFuture::Make();
+    // Capturing a raw pointer is fine, as the state is kept alive while
+    // its callbacks are running.  Capturing a Future would create a
+    // reference cycle until completion.
+    detail::FutureStorage<T>* storage = this->storage();
+    AddCallback([storage, next, on_success](const Status& st) mutable {
+      if (!st.ok()) {
+        next.MarkFailed(st);
+        return;
+      }
+      NextFuture inner = on_success(storage->value_);
+      detail::FutureStorage<U>* inner_storage = inner.storage();
+      inner.AddCallback([inner_storage, next](const Status& st) {
+        if (st.ok()) {
+          next.MarkFinished(inner_storage->value_);
+        } else {
+          next.MarkFailed(st);
+        }
+      });
+    });
+    return next;
+  }
+
+ protected:
+  template <typename U>
+  friend class Future;
+
+  explicit Future(std::shared_ptr<detail::FutureImpl> impl)
+      : FutureBase(std::move(impl)) {}
+
+  detail::FutureStorage<T>* storage() const {
+    return static_cast<detail::FutureStorage<T>*>(impl_.get());
+  }
+};
+
+/// \brief Create a Future finishing when all given Futures have finished
+///
+/// On success, the result holds the values of all Futures, in order.
+/// Otherwise the error Status of the first failing Future (in order) is
+/// propagated.  In both cases, the returned Future only finishes once all
+/// input Futures have finished.
+template <typename T>
+Future<std::vector<T>> WhenAll(std::vector<Future<T>> futures) {
+  struct State {
+    std::vector<Future<T>> futures;
+    std::atomic<size_t> nremaining;
+    Future<std::vector<T>> result;
+  };
+
+  if (futures.empty()) {
+    return Future<std::vector<T>>::MakeFinished({});
+  }
+  auto state = std::make_shared<State>();
+  state->futures = std::move(futures);
+  state->nremaining = state->futures.size();
+  state->result = Future<std::vector<T>>::Make();
+  // Copy the Future so as to return it even if callbacks run (and release
+  // the state) immediately
+  auto result = state->result;
+
+  auto on_complete = [state](const Status&) {
+    if (state->nremaining.fetch_sub(1) != 1) {
+      return;
+    }
+    std::vector<T> values(state->futures.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      Status st = state->futures[i].Get(&values[i]);
+      if (!st.ok()) {
+        state->result.MarkFailed(std::move(st));
+        return;
+      }
+    }
+    state->result.MarkFinished(std::move(values));
+  };
+  for (const auto& fut : state->futures) {
+    fut.AddCallback(on_complete);
+  }
+  return result;
+}
+
+}  // namespace arrow
+
+#endif  // ARROW_UTIL_FUTURE_H
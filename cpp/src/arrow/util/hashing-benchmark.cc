@@ -111,6 +111,77 @@ static void BM_HashLargeStrings(benchmark::State& state) {  // NOLINT non-const
   BenchmarkStringHashing(state, values);
 }
 
+// Insert keys with `state.range(0)` distinct values into a fresh memo table,
+// each key appearing `kInsertsPerKey` times
+static constexpr int64_t kInsertsPerKey = 2;
+
+static std::vector<int64_t> MakeMemoTableKeys(int64_t n_distinct) {
+  std::vector<int64_t> values = MakeIntegers<int64_t>(static_cast<int32_t>(n_distinct));
+  std::vector<int64_t> keys;
+  keys.reserve(n_distinct * kInsertsPerKey);
+  for (int64_t i = 0; i < kInsertsPerKey; ++i) {
+    keys.insert(keys.end(), values.begin(), values.end());
+  }
+  std::shuffle(keys.begin(), keys.end(), std::default_random_engine(42));
+  return keys;
+}
+
+static void BM_MemoTableGetOrInsert(benchmark::State& state) {  // NOLINT non-const ref
+  const std::vector<int64_t> keys = MakeMemoTableKeys(state.range(0));
+
+  for (auto _ : state) {
+    ScalarMemoTable<int64_t> table(0);
+    for (const int64_t key : keys) {
+      table.GetOrInsert(key);
+    }
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+static void BM_MemoTableGetOrInsertBatch(benchmark::State& state) {  // NOLINT
+  const std::vector<int64_t> keys = MakeMemoTableKeys(state.range(0));
+
+  for (auto _ : state) {
+    ScalarMemoTable<int64_t> table(0);
+    table.GetOrInsertBatch(keys.data(), static_cast<int64_t>(keys.size()),
+                           [](int32_t) {}, [](int32_t) {});
+    benchmark::DoNotOptimize(table.size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// Look up keys in a memo table already holding all of them
+template <bool kBatched>
+static void BenchmarkMemoTableGet(benchmark::State& state) {  // NOLINT non-const ref
+  const std::vector<int64_t> keys = MakeMemoTableKeys(state.range(0));
+  ScalarMemoTable<int64_t> table(0);
+  for (const int64_t key : keys) {
+    table.GetOrInsert(key);
+  }
+
+  std::vector<int32_t> indices(keys.size());
+  for (auto _ : state) {
+    if (kBatched) {
+      table.GetBatch(keys.data(), static_cast<int64_t>(keys.size()), indices.data());
+    } else {
+      for (size_t i = 0; i < keys.size(); ++i) {
+        indices[i] = table.Get(keys[i]);
+      }
+    }
+    benchmark::DoNotOptimize(indices.data());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+static void BM_MemoTableGet(benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkMemoTableGet<false>(state);
+}
+
+static void BM_MemoTableGetBatch(benchmark::State& state) {  // NOLINT non-const ref
+  BenchmarkMemoTableGet<true>(state);
+}
+
 // ----------------------------------------------------------------------
 // Benchmark declarations
 
@@ -124,5 +195,19 @@ BENCHMARK(BM_HashMediumStrings)->Repetitions(kRepetitions)->Unit(benchmark::kMic
 
 BENCHMARK(BM_HashLargeStrings)->Repetitions(kRepetitions)->Unit(benchmark::kMicrosecond);
 
+// From 1M distinct keys, well past the last-level cache.  Larger counts
+// mostly measure page faults of the table growth.
+static void MemoTableArgs(benchmark::internal::Benchmark* bench) {
+  bench->Unit(benchmark::kMillisecond)->UseRealTime();
+  for (int64_t n_distinct : {1 << 20, 1 << 23, 1 << 25}) {
+    bench->Arg(n_distinct);
+  }
+}
+
+BENCHMARK(BM_MemoTableGetOrInsert)->Apply(MemoTableArgs);
+BENCHMARK(BM_MemoTableGetOrInsertBatch)->Apply(MemoTableArgs);
+BENCHMARK(BM_MemoTableGet)->Apply(MemoTableArgs);
+BENCHMARK(BM_MemoTableGetBatch)->Apply(MemoTableArgs);
+
 }  // namespace internal
 }  // namespace arrow
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <limits>
@@ -29,6 +30,7 @@
 
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 
@@ -333,6 +335,50 @@ TEST(ScalarMemoTable, StressInt64) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(ScalarMemoTable, BatchInt64) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> value_dist(-5000, 5000);
+  // Not a multiple of the batch size, with upsizing in the middle of batches
+  std::vector<int64_t> values(10001);
+  std::generate(values.begin(), values.end(), [&]() { return value_dist(gen); });
+
+  ScalarMemoTable<int64_t> expected_table(0);
+  std::vector<int32_t> expected;
+  for (const int64_t value : values) {
+    expected.push_back(expected_table.GetOrInsert(value));
+  }
+
+  ScalarMemoTable<int64_t> table(0);
+  std::vector<int32_t> indices;
+  std::vector<bool> inserted;
+  auto on_found = [&](int32_t memo_index) {
+    indices.push_back(memo_index);
+    inserted.push_back(false);
+  };
+  auto on_not_found = [&](int32_t memo_index) {
+    indices.push_back(memo_index);
+    inserted.push_back(true);
+  };
+  table.GetOrInsertBatch(values.data(), 0, on_found, on_not_found);
+  ASSERT_EQ(table.size(), 0);
+  table.GetOrInsertBatch(values.data(), static_cast<int64_t>(values.size()), on_found,
+                         on_not_found);
+  ASSERT_EQ(expected, indices);
+  ASSERT_EQ(expected_table.size(), table.size());
+  // A value is inserted at its first occurrence, under the next memo index
+  int32_t n_inserted = 0;
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(inserted[i], expected[i] == n_inserted);
+    n_inserted += inserted[i];
+  }
+
+  std::vector<int64_t> probes = {values[0], 1000000, values[1], -1000000};
+  std::vector<int32_t> probe_indices(probes.size());
+  table.GetBatch(probes.data(), static_cast<int64_t>(probes.size()),
+                 probe_indices.data());
+  ASSERT_EQ(std::vector<int32_t>({0, -1, table.Get(values[1]), -1}), probe_indices);
+}
+
 TEST(BinaryMemoTable, Basics) {
   std::string A = "", B = "a", C = "foo", D = "bar", E, F;
   E += '\0';
@@ -399,6 +445,83 @@ TEST(BinaryMemoTable, Basics) {
   }
 }
 
+TEST(LargeBinaryMemoTable, Basics) {
+  // Chunks of 8 bytes, so that values spread over several of them
+  LargeBinaryMemoTable table(0, 8);
+  ASSERT_EQ(table.size(), 0);
+  ASSERT_EQ(table.Get("foo"), -1);
+  ASSERT_EQ(table.GetOrInsert(""), 0);
+  ASSERT_EQ(table.GetOrInsert("foo"), 1);
+  ASSERT_EQ(table.GetOrInsert("bar"), 2);
+  ASSERT_EQ(table.GetOrInsert("xyz"), 3);
+  // Larger than the chunk capacity
+  ASSERT_EQ(table.GetOrInsert("0123456789abc"), 4);
+  ASSERT_EQ(table.GetOrInsert("q"), 5);
+
+  ASSERT_EQ(table.GetOrInsert(""), 0);
+  ASSERT_EQ(table.GetOrInsert("xyz"), 3);
+  ASSERT_EQ(table.Get("0123456789abc"), 4);
+  ASSERT_EQ(table.Get("0123456789ab"), -1);
+  ASSERT_EQ(table.size(), 6);
+  ASSERT_EQ(table.values_size(), 23);
+  ASSERT_EQ(table.num_chunks(), 4);
+  ASSERT_EQ(table.value(3), "xyz");
+
+  std::vector<std::string> actual;
+  table.VisitValues(2 /* start offset */, [&](const util::string_view& v) {
+    actual.emplace_back(v.data(), v.length());
+  });
+  ASSERT_EQ(actual, std::vector<std::string>({"bar", "xyz", "0123456789abc", "q"}));
+
+  std::shared_ptr<ChunkedArray> values;
+  ASSERT_OK(table.GetChunkedValues(default_memory_pool(), utf8(), 0, &values));
+  AssertChunkedEqual(*values, {ArrayFromJSON(utf8(), R"(["", "foo", "bar"])"),
+                               ArrayFromJSON(utf8(), R"(["xyz"])"),
+                               ArrayFromJSON(utf8(), R"(["0123456789abc"])"),
+                               ArrayFromJSON(utf8(), R"(["q"])")});
+
+  ASSERT_OK(table.GetChunkedValues(default_memory_pool(), binary(), 3, &values));
+  AssertChunkedEqual(*values, {ArrayFromJSON(binary(), R"(["xyz"])"),
+                               ArrayFromJSON(binary(), R"(["0123456789abc"])"),
+                               ArrayFromJSON(binary(), R"(["q"])")});
+
+  ASSERT_OK(table.GetChunkedValues(default_memory_pool(), binary(), 6, &values));
+  ASSERT_EQ(values->num_chunks(), 0);
+  ASSERT_EQ(values->length(), 0);
+}
+
+TEST(LargeBinaryMemoTable, Stress) {
+  const auto values = MakeDistinctStrings(5000);
+  LargeBinaryMemoTable table(0, 1024);
+  std::unordered_map<std::string, int32_t> map;
+  for (int32_t repeat = 0; repeat < 2; ++repeat) {
+    for (const auto& value : values) {
+      int32_t expected;
+      auto it = map.find(value);
+      if (it == map.end()) {
+        expected = static_cast<int32_t>(map.size());
+        map[value] = expected;
+      } else {
+        expected = it->second;
+      }
+      ASSERT_EQ(table.GetOrInsert(value), expected);
+    }
+  }
+  ASSERT_EQ(table.size(), map.size());
+
+  std::shared_ptr<ChunkedArray> chunked;
+  ASSERT_OK(table.GetChunkedValues(default_memory_pool(), binary(), 0, &chunked));
+  ASSERT_EQ(chunked->length(), table.size());
+  ASSERT_EQ(chunked->num_chunks(), table.num_chunks());
+  int32_t memo_index = 0;
+  for (const auto& chunk : chunked->chunks()) {
+    const auto& array = checked_cast<const BinaryArray&>(*chunk);
+    for (int64_t i = 0; i < array.length(); ++i) {
+      ASSERT_EQ(array.GetView(i), table.value(memo_index++));
+    }
+  }
+}
+
 TEST(BinaryMemoTable, Stress) {
 #ifdef ARROW_VALGRIND
   const int32_t n_values = 20;
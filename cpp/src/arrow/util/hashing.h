@@ -35,6 +35,8 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/builder.h"
+#include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit-util.h"
@@ -232,6 +234,10 @@ class HashTable {
     }
   }
 
+  // Hint that the entries probed first for the hash will be accessed soon.
+  // The hint is dropped by the next upsizing.
+  void Prefetch(hash_t h) const { ARROW_PREFETCH(&entries_[FixHash(h) & size_mask_]); }
+
   uint64_t size() const { return n_filled_; }
 
   // Visit all non-empty entries in the table
@@ -344,42 +350,52 @@ class ScalarMemoTable {
   explicit ScalarMemoTable(int64_t entries = 0)
       : hash_table_(static_cast<uint64_t>(entries)) {}
 
-  int32_t Get(const Scalar& value) const {
-    auto cmp_func = [value](const Payload* payload) -> bool {
-      return ScalarHelper<Scalar, 0>::CompareScalars(payload->value, value);
-    };
-    hash_t h = ComputeHash(value);
-    auto p = hash_table_.Lookup(h, cmp_func);
-    if (p.second) {
-      return p.first->payload.memo_index;
-    } else {
-      return -1;
-    }
-  }
+  int32_t Get(const Scalar& value) const { return Get(value, ComputeHash(value)); }
 
   template <typename Func1, typename Func2>
   int32_t GetOrInsert(const Scalar& value, Func1&& on_found, Func2&& on_not_found) {
-    auto cmp_func = [value](const Payload* payload) -> bool {
-      return ScalarHelper<Scalar, 0>::CompareScalars(value, payload->value);
-    };
-    hash_t h = ComputeHash(value);
-    auto p = hash_table_.Lookup(h, cmp_func);
-    int32_t memo_index;
-    if (p.second) {
-      memo_index = p.first->payload.memo_index;
-      on_found(memo_index);
-    } else {
-      memo_index = size();
-      hash_table_.Insert(p.first, h, {value, memo_index});
-      on_not_found(memo_index);
-    }
-    return memo_index;
+    return GetOrInsert(value, ComputeHash(value), std::forward<Func1>(on_found),
+                       std::forward<Func2>(on_not_found));
   }
 
   int32_t GetOrInsert(const Scalar& value) {
     return GetOrInsert(value, [](int32_t i) {}, [](int32_t i) {});
   }
 
+  // Same as calling GetOrInsert() on each of `values` in order.  The keys are
+  // hashed a block at a time and their table entries prefetched, so that
+  // the cache misses of large tables overlap.
+  template <typename Func1, typename Func2>
+  void GetOrInsertBatch(const Scalar* values, int64_t length, Func1&& on_found,
+                        Func2&& on_not_found) {
+    hash_t hashes[kBatchSize];
+    for (int64_t i = 0; i < length; i += kBatchSize) {
+      const int64_t batch_length = length - i < kBatchSize ? length - i : kBatchSize;
+      for (int64_t j = 0; j < batch_length; ++j) {
+        hashes[j] = ComputeHash(values[i + j]);
+        hash_table_.Prefetch(hashes[j]);
+      }
+      for (int64_t j = 0; j < batch_length; ++j) {
+        GetOrInsert(values[i + j], hashes[j], on_found, on_not_found);
+      }
+    }
+  }
+
+  // Same as calling Get() on each of `values`, storing the results in `out`
+  void GetBatch(const Scalar* values, int64_t length, int32_t* out) const {
+    hash_t hashes[kBatchSize];
+    for (int64_t i = 0; i < length; i += kBatchSize) {
+      const int64_t batch_length = length - i < kBatchSize ? length - i : kBatchSize;
+      for (int64_t j = 0; j < batch_length; ++j) {
+        hashes[j] = ComputeHash(values[i + j]);
+        hash_table_.Prefetch(hashes[j]);
+      }
+      for (int64_t j = 0; j < batch_length; ++j) {
+        out[i + j] = Get(values[i + j], hashes[j]);
+      }
+    }
+  }
+
   // The number of entries in the memo table
   // (which is also 1 + the largest memo index)
   int32_t size() const { return static_cast<int32_t>(hash_table_.size()); }
@@ -406,9 +422,45 @@ class ScalarMemoTable {
   using HashTableEntry = typename HashTableType::Entry;
   HashTableType hash_table_;
 
+  // The number of keys hashed and prefetched ahead of their lookups.
+  // Enough to cover the memory latency, small enough for the prefetched
+  // lines to stay in L1.
+  static constexpr int64_t kBatchSize = 32;
+
   hash_t ComputeHash(const Scalar& value) const {
     return ScalarHelper<Scalar, 0>::ComputeHash(value);
   }
+
+  int32_t Get(const Scalar& value, hash_t h) const {
+    auto cmp_func = [value](const Payload* payload) -> bool {
+      return ScalarHelper<Scalar, 0>::CompareScalars(payload->value, value);
+    };
+    auto p = hash_table_.Lookup(h, cmp_func);
+    if (p.second) {
+      return p.first->payload.memo_index;
+    } else {
+      return -1;
+    }
+  }
+
+  template <typename Func1, typename Func2>
+  int32_t GetOrInsert(const Scalar& value, hash_t h, Func1&& on_found,
+                      Func2&& on_not_found) {
+    auto cmp_func = [value](const Payload* payload) -> bool {
+      return ScalarHelper<Scalar, 0>::CompareScalars(value, payload->value);
+    };
+    auto p = hash_table_.Lookup(h, cmp_func);
+    int32_t memo_index;
+    if (p.second) {
+      memo_index = p.first->payload.memo_index;
+      on_found(memo_index);
+    } else {
+      memo_index = size();
+      hash_table_.Insert(p.first, h, {value, memo_index});
+      on_not_found(memo_index);
+    }
+    return memo_index;
+  }
 };
 
 // ----------------------------------------------------------------------
@@ -654,6 +706,198 @@ class BinaryMemoTable {
   }
 };
 
+// ----------------------------------------------------------------------
+// A memoization table for variable-sized binary data of any total size.
+
+// Unlike BinaryMemoTable, the values are not stored contiguously: each
+// value is copied once into a chunk of a growing arena, and chunks never
+// move, so that growing the table never copies existing values.  The values
+// are exported as a chunked array, one chunk per arena chunk.
+
+class LargeBinaryMemoTable {
+ public:
+  explicit LargeBinaryMemoTable(int64_t entries = 0,
+                                int64_t chunk_capacity = kDefaultChunkCapacity)
+      : hash_table_(static_cast<uint64_t>(entries)),
+        chunk_capacity_(chunk_capacity),
+        values_size_(0) {
+    values_.reserve(entries);
+  }
+
+  int32_t Get(const void* data, int64_t length) const {
+    hash_t h = ComputeStringHash<0>(data, length);
+    auto p = Lookup(h, data, length);
+    if (p.second) {
+      return p.first->payload.memo_index;
+    } else {
+      return -1;
+    }
+  }
+
+  int32_t Get(const util::string_view& value) const {
+    return Get(value.data(), static_cast<int64_t>(value.length()));
+  }
+
+  template <typename Func1, typename Func2>
+  int32_t GetOrInsert(const void* data, int64_t length, Func1&& on_found,
+                      Func2&& on_not_found) {
+    hash_t h = ComputeStringHash<0>(data, length);
+    auto p = Lookup(h, data, length);
+    int32_t memo_index;
+    if (p.second) {
+      memo_index = p.first->payload.memo_index;
+      on_found(memo_index);
+    } else {
+      memo_index = size();
+      values_.emplace_back(AppendValue(data, length), static_cast<size_t>(length));
+      hash_table_.Insert(const_cast<HashTableEntry*>(p.first), h, {memo_index});
+      on_not_found(memo_index);
+    }
+    return memo_index;
+  }
+
+  template <typename Func1, typename Func2>
+  int32_t GetOrInsert(const util::string_view& value, Func1&& on_found,
+                      Func2&& on_not_found) {
+    return GetOrInsert(value.data(), static_cast<int64_t>(value.length()),
+                       std::forward<Func1>(on_found), std::forward<Func2>(on_not_found));
+  }
+
+  int32_t GetOrInsert(const void* data, int64_t length) {
+    return GetOrInsert(data, length, [](int32_t i) {}, [](int32_t i) {});
+  }
+
+  int32_t GetOrInsert(const util::string_view& value) {
+    return GetOrInsert(value.data(), static_cast<int64_t>(value.length()));
+  }
+
+  // The number of entries in the memo table
+  // (which is also 1 + the largest memo index)
+  int32_t size() const { return static_cast<int32_t>(hash_table_.size()); }
+
+  // The total size of the values, in bytes
+  int64_t values_size() const { return values_size_; }
+
+  // The number of arena chunks
+  int32_t num_chunks() const { return static_cast<int32_t>(chunks_.size()); }
+
+  // The value with the given memo index, valid for the table's lifetime
+  util::string_view value(int32_t memo_index) const { return values_[memo_index]; }
+
+  // Visit the stored values in insertion order.
+  // The visitor function should have the signature `void(util::string_view)`
+  // or `void(const util::string_view&)`.
+  template <typename VisitFunc>
+  void VisitValues(int32_t start, VisitFunc&& visit) const {
+    for (int32_t i = start; i < size(); ++i) {
+      visit(values_[i]);
+    }
+  }
+
+  // Export the values starting from index `start` as a chunked array of the
+  // given binary-like type, with one chunk per arena chunk
+  Status GetChunkedValues(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                          int32_t start, std::shared_ptr<ChunkedArray>* out) const {
+    ArrayVector arrays;
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+      const int32_t chunk_start = std::max(start, chunks_[i].first_index);
+      const int32_t chunk_end =
+          i + 1 < chunks_.size() ? chunks_[i + 1].first_index : size();
+      if (chunk_start >= chunk_end) {
+        continue;
+      }
+      std::shared_ptr<Array> array;
+      RETURN_NOT_OK(MakeChunk(pool, type, chunk_start, chunk_end, &array));
+      arrays.push_back(std::move(array));
+    }
+    *out = std::make_shared<ChunkedArray>(arrays, type);
+    return Status::OK();
+  }
+
+ protected:
+  // Large enough to amortize the allocations, small enough not to waste
+  // much memory at the end of the last chunk
+  static constexpr int64_t kDefaultChunkCapacity = 1 << 24;
+
+  struct Payload {
+    int32_t memo_index;
+  };
+
+  struct ArenaChunk {
+    std::unique_ptr<char[]> data;
+    int64_t capacity;
+    int64_t size;
+    // The memo index of the first value in the chunk
+    int32_t first_index;
+  };
+
+  using HashTableType = HashTable<Payload>;
+  using HashTableEntry = typename HashTable<Payload>::Entry;
+  HashTableType hash_table_;
+
+  int64_t chunk_capacity_;
+  int64_t values_size_;
+  std::vector<ArenaChunk> chunks_;
+  // The value of each memo index, pointing into the arena chunks
+  std::vector<util::string_view> values_;
+
+  // Copy a value into the arena, beginning a new chunk if it does not fit
+  // in the last one.  A value larger than the chunk capacity gets its own.
+  const char* AppendValue(const void* data, int64_t length) {
+    if (chunks_.empty() || chunks_.back().size + length > chunks_.back().capacity) {
+      const int64_t capacity = std::max(chunk_capacity_, length);
+      chunks_.push_back(
+          {std::unique_ptr<char[]>(new char[capacity]), capacity, 0, size()});
+    }
+    ArenaChunk& chunk = chunks_.back();
+    char* out = chunk.data.get() + chunk.size;
+    if (length > 0) {
+      memcpy(out, data, static_cast<size_t>(length));
+    }
+    chunk.size += length;
+    values_size_ += length;
+    return out;
+  }
+
+  // Copy the values [start, end), which lie in the same arena chunk, to a
+  // binary-like array
+  Status MakeChunk(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                   int32_t start, int32_t end, std::shared_ptr<Array>* out) const {
+    const char* base = values_[start].data();
+    const int64_t data_size =
+        values_[end - 1].data() + values_[end - 1].size() - base;
+    if (data_size > std::numeric_limits<int32_t>::max()) {
+      return Status::CapacityError("Binary value of ", values_[end - 1].size(),
+                                   " bytes does not fit in an array");
+    }
+    const int32_t length = end - start;
+
+    std::shared_ptr<Buffer> offsets, data;
+    RETURN_NOT_OK(AllocateBuffer(pool, (length + 1) * sizeof(int32_t), &offsets));
+    RETURN_NOT_OK(AllocateBuffer(pool, data_size, &data));
+    auto out_offsets = reinterpret_cast<int32_t*>(offsets->mutable_data());
+    for (int32_t i = 0; i < length; ++i) {
+      out_offsets[i] = static_cast<int32_t>(values_[start + i].data() - base);
+    }
+    out_offsets[length] = static_cast<int32_t>(data_size);
+    if (data_size > 0) {
+      memcpy(data->mutable_data(), base, static_cast<size_t>(data_size));
+    }
+    *out = MakeArray(ArrayData::Make(type, length, {nullptr, offsets, data}, 0));
+    return Status::OK();
+  }
+
+  std::pair<const HashTableEntry*, bool> Lookup(hash_t h, const void* data,
+                                                int64_t length) const {
+    auto cmp_func = [=](const Payload* payload) {
+      const util::string_view& value = values_[payload->memo_index];
+      return static_cast<size_t>(length) == value.size() &&
+             memcmp(data, value.data(), static_cast<size_t>(length)) == 0;
+    };
+    return hash_table_.Lookup(h, cmp_func);
+  }
+};
+
 template <typename T, typename Enable = void>
 struct HashTraits {};
 
@@ -18,8 +18,10 @@
 #include "benchmark/benchmark.h"
 
 #include <cstdint>
+#include <cstring>
 #include <vector>
 
+#include "arrow/util/cpu-info.h"
 #include "arrow/util/int-util.h"
 
 namespace arrow {
@@ -49,8 +51,32 @@ std::vector<uint8_t> GetValidBytes(int n_values) {
   return valid_bytes;
 }
 
+// Disable the AVX2 kernels for the lifetime of the object if !kUseAvx2
+template <bool kUseAvx2>
+class ScopedAvx2Setting {
+ public:
+  ScopedAvx2Setting() : cpu_info_(CpuInfo::GetInstance()) {
+    disabled_ = !kUseAvx2 && cpu_info_->CanUseAVX2();
+    if (disabled_) {
+      cpu_info_->EnableFeature(CpuInfo::AVX2, false);
+    }
+  }
+
+  ~ScopedAvx2Setting() {
+    if (disabled_) {
+      cpu_info_->EnableFeature(CpuInfo::AVX2, true);
+    }
+  }
+
+ private:
+  CpuInfo* cpu_info_;
+  bool disabled_;
+};
+
+template <bool kUseAvx2>
 static void BM_DetectUIntWidthNoNulls(
     benchmark::State& state) {  // NOLINT non-const reference
+  ScopedAvx2Setting<kUseAvx2> avx2_setting;
   const auto values = GetUIntSequence(0x12345);
 
   while (state.KeepRunning()) {
@@ -60,8 +86,10 @@ static void BM_DetectUIntWidthNoNulls(
   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(uint64_t));
 }
 
+template <bool kUseAvx2>
 static void BM_DetectUIntWidthNulls(
     benchmark::State& state) {  // NOLINT non-const reference
+  ScopedAvx2Setting<kUseAvx2> avx2_setting;
   const auto values = GetUIntSequence(0x12345);
   const auto valid_bytes = GetValidBytes(0x12345);
 
@@ -73,8 +101,10 @@ static void BM_DetectUIntWidthNulls(
   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(uint64_t));
 }
 
+template <bool kUseAvx2>
 static void BM_DetectIntWidthNoNulls(
     benchmark::State& state) {  // NOLINT non-const reference
+  ScopedAvx2Setting<kUseAvx2> avx2_setting;
   const auto values = GetIntSequence(0x12345, -0x1234);
 
   while (state.KeepRunning()) {
@@ -84,8 +114,10 @@ static void BM_DetectIntWidthNoNulls(
   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(uint64_t));
 }
 
+template <bool kUseAvx2>
 static void BM_DetectIntWidthNulls(
     benchmark::State& state) {  // NOLINT non-const reference
+  ScopedAvx2Setting<kUseAvx2> avx2_setting;
   const auto values = GetIntSequence(0x12345, -0x1234);
   const auto valid_bytes = GetValidBytes(0x12345);
 
@@ -97,13 +129,74 @@ static void BM_DetectIntWidthNulls(
   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(uint64_t));
 }
 
-BENCHMARK(BM_DetectUIntWidthNoNulls)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+template <bool kUseAvx2>
+static void BM_DowncastInts(benchmark::State& state) {  // NOLINT non-const reference
+  ScopedAvx2Setting<kUseAvx2> avx2_setting;
+  const auto values = GetIntSequence(0x12345, -0x1234);
+  std::vector<int16_t> dest(values.size());
+
+  while (state.KeepRunning()) {
+    DowncastInts(values.data(), dest.data(), static_cast<int64_t>(values.size()));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int64_t));
+}
+
+template <bool kUseAvx2>
+static void BM_UpcastInts(benchmark::State& state) {  // NOLINT non-const reference
+  ScopedAvx2Setting<kUseAvx2> avx2_setting;
+  const auto values = GetIntSequence(0x12345, -0x1234);
+  std::vector<int8_t> source(values.size());
+  DowncastInts(values.data(), source.data(), static_cast<int64_t>(values.size()));
+  // Widen in place, like the adaptive builders
+  std::vector<int16_t> buffer(values.size());
+
+  while (state.KeepRunning()) {
+    memcpy(buffer.data(), source.data(), source.size() * sizeof(int8_t));
+    UpcastInts(reinterpret_cast<const int8_t*>(buffer.data()), buffer.data(),
+               static_cast<int64_t>(buffer.size()));
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * values.size() * sizeof(int16_t));
+}
+
+template <bool kUseAvx2>
+static void BM_TransposeInts(benchmark::State& state) {  // NOLINT non-const reference
+  ScopedAvx2Setting<kUseAvx2> avx2_setting;
+  // Remap int8 indices of a 100-value dictionary into a larger one
+  const int64_t length = 0x12345;
+  std::vector<int8_t> source(length);
+  for (int64_t i = 0; i < length; ++i) {
+    source[i] = static_cast<int8_t>((i * 37) % 100);
+  }
+  std::vector<int32_t> transpose_map(100);
+  for (int32_t j = 0; j < 100; ++j) {
+    transpose_map[j] = (j * 7919) % 1000;
+  }
+  std::vector<int16_t> dest(length);
+
+  while (state.KeepRunning()) {
+    TransposeInts(source.data(), dest.data(), length, transpose_map.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * length);
+}
+
+// The "false" variants measure the scalar fallbacks of the AVX2 kernels
 
-BENCHMARK(BM_DetectUIntWidthNulls)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+#define INT_UTIL_BENCHMARK(NAME)                                                   \
+  BENCHMARK_TEMPLATE(NAME, true)->MinTime(1.0)->Unit(benchmark::kMicrosecond);     \
+  BENCHMARK_TEMPLATE(NAME, false)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
 
-BENCHMARK(BM_DetectIntWidthNoNulls)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+INT_UTIL_BENCHMARK(BM_DetectUIntWidthNoNulls);
+INT_UTIL_BENCHMARK(BM_DetectUIntWidthNulls);
+INT_UTIL_BENCHMARK(BM_DetectIntWidthNoNulls);
+INT_UTIL_BENCHMARK(BM_DetectIntWidthNulls);
+INT_UTIL_BENCHMARK(BM_DowncastInts);
+INT_UTIL_BENCHMARK(BM_UpcastInts);
+INT_UTIL_BENCHMARK(BM_TransposeInts);
 
-BENCHMARK(BM_DetectIntWidthNulls)->MinTime(1.0)->Unit(benchmark::kMicrosecond);
+#undef INT_UTIL_BENCHMARK
 
 }  // namespace internal
 }  // namespace arrow
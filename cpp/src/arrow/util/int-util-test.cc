@@ -17,12 +17,16 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <random>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
 
+#include "arrow/util/cpu-info.h"
 #include "arrow/util/int-util.h"
 
 namespace arrow {
@@ -30,48 +34,68 @@ namespace internal {
 
 static std::vector<uint8_t> all_widths = {1, 2, 4, 8};
 
+// Run func with the default kernels, then with the AVX2 kernels disabled
+template <typename Func>
+void CheckWithAndWithoutAvx2(Func&& func) {
+  func();
+  auto cpu_info = CpuInfo::GetInstance();
+  if (cpu_info->CanUseAVX2()) {
+    cpu_info->EnableFeature(CpuInfo::AVX2, false);
+    func();
+    cpu_info->EnableFeature(CpuInfo::AVX2, true);
+  }
+}
+
 template <typename T>
 void CheckUIntWidth(const std::vector<T>& values, uint8_t expected_width) {
-  for (const uint8_t min_width : all_widths) {
-    uint8_t width =
-        DetectUIntWidth(values.data(), static_cast<int64_t>(values.size()), min_width);
-    ASSERT_EQ(width, std::max(min_width, expected_width));
-    width = DetectUIntWidth(values.data(), nullptr, static_cast<int64_t>(values.size()),
-                            min_width);
-    ASSERT_EQ(width, std::max(min_width, expected_width));
-  }
+  CheckWithAndWithoutAvx2([&]() {
+    for (const uint8_t min_width : all_widths) {
+      uint8_t width =
+          DetectUIntWidth(values.data(), static_cast<int64_t>(values.size()), min_width);
+      ASSERT_EQ(width, std::max(min_width, expected_width));
+      width = DetectUIntWidth(values.data(), nullptr, static_cast<int64_t>(values.size()),
+                              min_width);
+      ASSERT_EQ(width, std::max(min_width, expected_width));
+    }
+  });
 }
 
 template <typename T>
 void CheckUIntWidth(const std::vector<T>& values, const std::vector<uint8_t>& valid_bytes,
                     uint8_t expected_width) {
-  for (const uint8_t min_width : all_widths) {
-    uint8_t width = DetectUIntWidth(values.data(), valid_bytes.data(),
-                                    static_cast<int64_t>(values.size()), min_width);
-    ASSERT_EQ(width, std::max(min_width, expected_width));
-  }
+  CheckWithAndWithoutAvx2([&]() {
+    for (const uint8_t min_width : all_widths) {
+      uint8_t width = DetectUIntWidth(values.data(), valid_bytes.data(),
+                                      static_cast<int64_t>(values.size()), min_width);
+      ASSERT_EQ(width, std::max(min_width, expected_width));
+    }
+  });
 }
 
 template <typename T>
 void CheckIntWidth(const std::vector<T>& values, uint8_t expected_width) {
-  for (const uint8_t min_width : all_widths) {
-    uint8_t width =
-        DetectIntWidth(values.data(), static_cast<int64_t>(values.size()), min_width);
-    ASSERT_EQ(width, std::max(min_width, expected_width));
-    width = DetectIntWidth(values.data(), nullptr, static_cast<int64_t>(values.size()),
-                           min_width);
-    ASSERT_EQ(width, std::max(min_width, expected_width));
-  }
+  CheckWithAndWithoutAvx2([&]() {
+    for (const uint8_t min_width : all_widths) {
+      uint8_t width =
+          DetectIntWidth(values.data(), static_cast<int64_t>(values.size()), min_width);
+      ASSERT_EQ(width, std::max(min_width, expected_width));
+      width = DetectIntWidth(values.data(), nullptr, static_cast<int64_t>(values.size()),
+                             min_width);
+      ASSERT_EQ(width, std::max(min_width, expected_width));
+    }
+  });
 }
 
 template <typename T>
 void CheckIntWidth(const std::vector<T>& values, const std::vector<uint8_t>& valid_bytes,
                    uint8_t expected_width) {
-  for (const uint8_t min_width : all_widths) {
-    uint8_t width = DetectIntWidth(values.data(), valid_bytes.data(),
-                                   static_cast<int64_t>(values.size()), min_width);
-    ASSERT_EQ(width, std::max(min_width, expected_width));
-  }
+  CheckWithAndWithoutAvx2([&]() {
+    for (const uint8_t min_width : all_widths) {
+      uint8_t width = DetectIntWidth(values.data(), valid_bytes.data(),
+                                     static_cast<int64_t>(values.size()), min_width);
+      ASSERT_EQ(width, std::max(min_width, expected_width));
+    }
+  });
 }
 
 template <typename T>
@@ -373,6 +397,102 @@ TEST(IntWidth, NullsMany) {
   }
 }
 
+template <typename Source, typename Dest>
+void CheckUpcastInts(const std::vector<Source>& values) {
+  std::vector<Dest> expected(values.begin(), values.end());
+  CheckWithAndWithoutAvx2([&]() {
+    std::vector<Dest> dest(values.size());
+    UpcastInts(values.data(), dest.data(), static_cast<int64_t>(values.size()));
+    ASSERT_EQ(dest, expected);
+
+    // In place, as done by the adaptive builders
+    std::vector<Dest> buffer(values.size());
+    memcpy(buffer.data(), values.data(), values.size() * sizeof(Source));
+    UpcastInts(reinterpret_cast<const Source*>(buffer.data()), buffer.data(),
+               static_cast<int64_t>(values.size()));
+    ASSERT_EQ(buffer, expected);
+  });
+}
+
+template <typename Source>
+void CheckUpcastInts(int n_values) {
+  std::vector<Source> values(n_values);
+  for (int i = 0; i < n_values; ++i) {
+    values[i] = static_cast<Source>(std::is_signed<Source>::value && i % 2 ? -i : i * 3);
+  }
+  using Int16 = typename std::conditional<std::is_signed<Source>::value, int16_t,
+                                          uint16_t>::type;
+  using Int32 = typename std::conditional<std::is_signed<Source>::value, int32_t,
+                                          uint32_t>::type;
+  using Int64 = typename std::conditional<std::is_signed<Source>::value, int64_t,
+                                          uint64_t>::type;
+  if (sizeof(Source) < 2) {
+    CheckUpcastInts<Source, Int16>(values);
+  }
+  if (sizeof(Source) < 4) {
+    CheckUpcastInts<Source, Int32>(values);
+  }
+  CheckUpcastInts<Source, Int64>(values);
+}
+
+TEST(UpcastInts, Basics) {
+  // Lengths below, at and above the AVX2 batch sizes
+  for (const int n_values : {0, 1, 3, 4, 7, 8, 15, 16, 17, 33, 100}) {
+    CheckUpcastInts<int8_t>(n_values);
+    CheckUpcastInts<int16_t>(n_values);
+    CheckUpcastInts<int32_t>(n_values);
+    CheckUpcastInts<uint8_t>(n_values);
+    CheckUpcastInts<uint16_t>(n_values);
+    CheckUpcastInts<uint32_t>(n_values);
+  }
+}
+
+template <typename Dest>
+void CheckDowncastInts(const std::vector<int64_t>& values) {
+  std::vector<Dest> expected(values.size());
+  std::vector<Dest> dest(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    expected[i] = static_cast<Dest>(values[i]);
+  }
+  CheckWithAndWithoutAvx2([&]() {
+    DowncastInts(values.data(), dest.data(), static_cast<int64_t>(values.size()));
+    ASSERT_EQ(dest, expected);
+  });
+}
+
+template <typename Dest>
+void CheckDowncastUInts(const std::vector<uint64_t>& values) {
+  std::vector<Dest> expected(values.size());
+  std::vector<Dest> dest(values.size());
+  for (size_t i = 0; i < values.size(); ++i) {
+    expected[i] = static_cast<Dest>(values[i]);
+  }
+  CheckWithAndWithoutAvx2([&]() {
+    DowncastUInts(values.data(), dest.data(), static_cast<int64_t>(values.size()));
+    ASSERT_EQ(dest, expected);
+  });
+}
+
+TEST(DowncastInts, Basics) {
+  for (const int n_values : {0, 1, 3, 4, 15, 16, 17, 31, 32, 33, 100}) {
+    std::vector<int64_t> values(n_values);
+    std::vector<uint64_t> uvalues(n_values);
+    for (int i = 0; i < n_values; ++i) {
+      // Values in range of the narrowest type, and values to be truncated
+      values[i] = (i % 3 == 0) ? -i : (i % 3 == 1) ? i : 0x123456789LL * i;
+      uvalues[i] = static_cast<uint64_t>(values[i]);
+    }
+    CheckDowncastInts<int8_t>(values);
+    CheckDowncastInts<int16_t>(values);
+    CheckDowncastInts<int32_t>(values);
+    CheckDowncastInts<int64_t>(values);
+    CheckDowncastUInts<uint8_t>(uvalues);
+    CheckDowncastUInts<uint16_t>(uvalues);
+    CheckDowncastUInts<uint32_t>(uvalues);
+    CheckDowncastUInts<uint64_t>(uvalues);
+  }
+}
+
 TEST(TransposeInts, Int8ToInt64) {
   std::vector<int8_t> src = {1, 3, 5, 0, 3, 2};
   std::vector<int32_t> transpose_map = {1111, 2222, 3333, 4444, 5555, 6666, 7777};
@@ -382,5 +502,44 @@ TEST(TransposeInts, Int8ToInt64) {
   ASSERT_EQ(dest, std::vector<int64_t>({2222, 4444, 6666, 1111, 4444, 3333}));
 }
 
+template <typename Src, typename Dest>
+void CheckTransposeInts(int n_values) {
+  // Map values spread over the whole range of the destination type
+  const int64_t max_value =
+      std::min<int64_t>(std::numeric_limits<Dest>::max(), 1000000000LL);
+  std::vector<int32_t> transpose_map(100);
+  for (size_t j = 0; j < transpose_map.size(); ++j) {
+    transpose_map[j] = static_cast<int32_t>((j * 7919 * max_value / 100) % max_value);
+  }
+  std::vector<Src> src(n_values);
+  std::vector<Dest> expected(n_values);
+  for (int i = 0; i < n_values; ++i) {
+    src[i] = static_cast<Src>((i * 13) % transpose_map.size());
+    expected[i] = static_cast<Dest>(transpose_map[src[i]]);
+  }
+  std::vector<Dest> dest(n_values);
+  CheckWithAndWithoutAvx2([&]() {
+    TransposeInts(src.data(), dest.data(), n_values, transpose_map.data());
+    ASSERT_EQ(dest, expected);
+  });
+}
+
+template <typename Src>
+void CheckTransposeIntsFrom(int n_values) {
+  CheckTransposeInts<Src, int8_t>(n_values);
+  CheckTransposeInts<Src, int16_t>(n_values);
+  CheckTransposeInts<Src, int32_t>(n_values);
+  CheckTransposeInts<Src, int64_t>(n_values);
+}
+
+TEST(TransposeInts, AllTypes) {
+  for (const int n_values : {0, 1, 7, 8, 9, 15, 16, 17, 100}) {
+    CheckTransposeIntsFrom<int8_t>(n_values);
+    CheckTransposeIntsFrom<int16_t>(n_values);
+    CheckTransposeIntsFrom<int32_t>(n_values);
+    CheckTransposeIntsFrom<int64_t>(n_values);
+  }
+}
+
 }  // namespace internal
 }  // namespace arrow
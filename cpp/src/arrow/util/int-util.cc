@@ -22,7 +22,9 @@
 #include <limits>
 
 #include "arrow/util/bit-util.h"
+#include "arrow/util/cpu-info.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/sse-util.h"
 
 namespace arrow {
 namespace internal {
@@ -39,6 +41,15 @@ static constexpr uint64_t mask_uint8 = ~0xffULL;
 static constexpr uint64_t mask_uint16 = ~0xffffULL;
 static constexpr uint64_t mask_uint32 = ~0xffffffffULL;
 
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+// Whether to dispatch to the AVX2 kernels below.  The flag is read on every
+// call, so that it can be toggled with CpuInfo::EnableFeature().
+static bool UseAvx2() {
+  static CpuInfo* cpu_info = CpuInfo::GetInstance();
+  return cpu_info->CanUseAVX2();
+}
+#endif
+
 //
 // Unsigned integer width detection
 //
@@ -63,7 +74,8 @@ inline uint8_t ExpandedUIntWidth(uint64_t val, uint8_t current_width) {
   }
 }
 
-uint8_t DetectUIntWidth(const uint64_t* values, int64_t length, uint8_t min_width) {
+static uint8_t DetectUIntWidthScalar(const uint64_t* values, int64_t length,
+                                     uint8_t min_width) {
   uint8_t width = min_width;
   if (min_width < 8) {
     auto p = values;
@@ -111,11 +123,8 @@ uint8_t DetectUIntWidth(const uint64_t* values, int64_t length, uint8_t min_widt
   return width;
 }
 
-uint8_t DetectUIntWidth(const uint64_t* values, const uint8_t* valid_bytes,
-                        int64_t length, uint8_t min_width) {
-  if (valid_bytes == nullptr) {
-    return DetectUIntWidth(values, length, min_width);
-  }
+static uint8_t DetectUIntWidthScalar(const uint64_t* values, const uint8_t* valid_bytes,
+                                     int64_t length, uint8_t min_width) {
   uint8_t width = min_width;
   if (min_width < 8) {
     auto p = values;
@@ -158,7 +167,8 @@ uint8_t DetectUIntWidth(const uint64_t* values, const uint8_t* valid_bytes,
 // Signed integer width detection
 //
 
-uint8_t DetectIntWidth(const int64_t* values, int64_t length, uint8_t min_width) {
+static uint8_t DetectIntWidthScalar(const int64_t* values, int64_t length,
+                                    uint8_t min_width) {
   if (min_width == 8) {
     return min_width;
   }
@@ -249,12 +259,8 @@ width8:
   return 8;
 }
 
-uint8_t DetectIntWidth(const int64_t* values, const uint8_t* valid_bytes, int64_t length,
-                       uint8_t min_width) {
-  if (valid_bytes == nullptr) {
-    return DetectIntWidth(values, length, min_width);
-  }
-
+static uint8_t DetectIntWidthScalar(const int64_t* values, const uint8_t* valid_bytes,
+                                    int64_t length, uint8_t min_width) {
   if (min_width == 8) {
     return min_width;
   }
@@ -353,6 +359,152 @@ width8:
   return 8;
 }
 
+//
+// AVX2 integer width detection
+//
+
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+
+// The number of values tested at once
+static constexpr int64_t kAvx2WidthBlock = 32;
+
+// Zero the four values of v, starting at index i, whose validity byte is zero
+template <bool kHasNulls>
+ARROW_TARGET_AVX2 inline __m256i MaskNulls(__m256i v, const uint8_t* valid_bytes,
+                                           int64_t i) {
+  if (kHasNulls) {
+    int32_t valid;
+    memcpy(&valid, valid_bytes + i, sizeof(valid));
+    const __m256i is_null = _mm256_cmpeq_epi64(
+        _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(valid)), _mm256_setzero_si256());
+    v = _mm256_andnot_si256(is_null, v);
+  }
+  return v;
+}
+
+// OR together a block of values, each offset by addend (with wraparound) and
+// with null values zeroed
+template <bool kHasNulls>
+ARROW_TARGET_AVX2 inline __m256i OrBlock(const void* values, const uint8_t* valid_bytes,
+                                         int64_t i, uint64_t addend) {
+  const __m256i* p = reinterpret_cast<const __m256i*>(values);
+  const __m256i v_addend = _mm256_set1_epi64x(static_cast<int64_t>(addend));
+  __m256i acc = _mm256_setzero_si256();
+  for (int64_t j = i; j < i + kAvx2WidthBlock; j += 4) {
+    const __m256i v = _mm256_add_epi64(_mm256_loadu_si256(p + j / 4), v_addend);
+    acc = _mm256_or_si256(acc, MaskNulls<kHasNulls>(v, valid_bytes, j));
+  }
+  return acc;
+}
+
+static const uint64_t width_masks[] = {0, mask_uint8, mask_uint16, 0, mask_uint32,
+                                       0, 0,          0,           0};
+
+// Same strategy as the scalar functions, except that the values are ORed
+// a block at a time and the block is tested for the current width in a single
+// instruction.  When the test fails the block is tested again for the next
+// width.
+
+template <bool kHasNulls>
+ARROW_TARGET_AVX2 uint8_t DetectUIntWidthAvx2(const uint64_t* values,
+                                              const uint8_t* valid_bytes,
+                                              int64_t length, uint8_t min_width) {
+  uint8_t width = min_width;
+  int64_t i = 0;
+  while (width < 8 && i <= length - kAvx2WidthBlock) {
+    const __m256i acc = OrBlock<kHasNulls>(values, valid_bytes, i, 0);
+    const __m256i mask = _mm256_set1_epi64x(static_cast<int64_t>(width_masks[width]));
+    if (_mm256_testz_si256(acc, mask)) {
+      i += kAvx2WidthBlock;
+    } else {
+      width = static_cast<uint8_t>(width * 2);
+    }
+  }
+  if (width < 8 && i < length) {
+    width = kHasNulls
+                ? DetectUIntWidthScalar(values + i, valid_bytes + i, length - i, width)
+                : DetectUIntWidthScalar(values + i, length - i, width);
+  }
+  return width;
+}
+
+template <bool kHasNulls>
+ARROW_TARGET_AVX2 uint8_t DetectIntWidthAvx2(const int64_t* values,
+                                             const uint8_t* valid_bytes, int64_t length,
+                                             uint8_t min_width) {
+  // To test whether x fits in a width, test whether x + 2 ** (8 * width - 1)
+  // fits in the unsigned integer of that width
+  static const uint64_t addends[] = {0, 0x80ULL, 0x8000ULL, 0,          0x80000000ULL,
+                                     0, 0,       0,         0};
+  uint8_t width = min_width;
+  int64_t i = 0;
+  while (width < 8 && i <= length - kAvx2WidthBlock) {
+    const __m256i acc = OrBlock<kHasNulls>(values, valid_bytes, i, addends[width]);
+    const __m256i mask = _mm256_set1_epi64x(static_cast<int64_t>(width_masks[width]));
+    if (_mm256_testz_si256(acc, mask)) {
+      i += kAvx2WidthBlock;
+    } else {
+      width = static_cast<uint8_t>(width * 2);
+    }
+  }
+  if (width < 8 && i < length) {
+    width = kHasNulls
+                ? DetectIntWidthScalar(values + i, valid_bytes + i, length - i, width)
+                : DetectIntWidthScalar(values + i, length - i, width);
+  }
+  return width;
+}
+
+#endif  // ARROW_HAVE_RUNTIME_AVX2
+
+uint8_t DetectUIntWidth(const uint64_t* values, int64_t length, uint8_t min_width) {
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  if (UseAvx2()) {
+    return DetectUIntWidthAvx2<false>(values, nullptr, length, min_width);
+  }
+#endif
+  return DetectUIntWidthScalar(values, length, min_width);
+}
+
+uint8_t DetectUIntWidth(const uint64_t* values, const uint8_t* valid_bytes,
+                        int64_t length, uint8_t min_width) {
+  if (valid_bytes == nullptr) {
+    return DetectUIntWidth(values, length, min_width);
+  }
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  if (UseAvx2()) {
+    return DetectUIntWidthAvx2<true>(values, valid_bytes, length, min_width);
+  }
+#endif
+  return DetectUIntWidthScalar(values, valid_bytes, length, min_width);
+}
+
+uint8_t DetectIntWidth(const int64_t* values, int64_t length, uint8_t min_width) {
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  if (UseAvx2()) {
+    return DetectIntWidthAvx2<false>(values, nullptr, length, min_width);
+  }
+#endif
+  return DetectIntWidthScalar(values, length, min_width);
+}
+
+uint8_t DetectIntWidth(const int64_t* values, const uint8_t* valid_bytes, int64_t length,
+                       uint8_t min_width) {
+  if (valid_bytes == nullptr) {
+    return DetectIntWidth(values, length, min_width);
+  }
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  if (UseAvx2()) {
+    return DetectIntWidthAvx2<true>(values, valid_bytes, length, min_width);
+  }
+#endif
+  return DetectIntWidthScalar(values, valid_bytes, length, min_width);
+}
+
+//
+// Narrowing and widening copies
+//
+
 template <typename Source, typename Dest>
 inline void DowncastIntsInternal(const Source* src, Dest* dest, int64_t length) {
   while (length >= 4) {
@@ -370,16 +522,93 @@ inline void DowncastIntsInternal(const Source* src, Dest* dest, int64_t length)
   }
 }
 
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+
+// The low 32 bits of four 64-bit integers
+ARROW_TARGET_AVX2 inline __m128i NarrowTo32(__m256i v) {
+  const __m256i low_halves = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+  return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(v, low_halves));
+}
+
+// Sixteen 64-bit integers narrowed to 16 bits, after applying `mask` (at most
+// 0xffff) to their low 32 bits so that the saturating pack truncates instead
+ARROW_TARGET_AVX2 inline __m256i NarrowTo16(const int64_t* src, __m256i mask) {
+  __m256i v[4];
+  for (int i = 0; i < 4; ++i) {
+    v[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 4 * i));
+  }
+  const __m256i lo = _mm256_inserti128_si256(_mm256_castsi128_si256(NarrowTo32(v[0])),
+                                             NarrowTo32(v[1]), 1);
+  const __m256i hi = _mm256_inserti128_si256(_mm256_castsi128_si256(NarrowTo32(v[2])),
+                                             NarrowTo32(v[3]), 1);
+  // Packing works on each 128-bit lane, restore the order of the 64-bit quarters
+  return _mm256_permute4x64_epi64(
+      _mm256_packus_epi32(_mm256_and_si256(lo, mask), _mm256_and_si256(hi, mask)), 0xd8);
+}
+
+// The AVX2 downcasts convert as many values as they can in full registers
+// and return that number
+
+ARROW_TARGET_AVX2 int64_t DowncastIntsAvx2(const int64_t* src, int32_t* dest,
+                                           int64_t length) {
+  int64_t i = 0;
+  for (; i <= length - 4; i += 4) {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), NarrowTo32(v));
+  }
+  return i;
+}
+
+ARROW_TARGET_AVX2 int64_t DowncastIntsAvx2(const int64_t* src, int16_t* dest,
+                                           int64_t length) {
+  const __m256i mask = _mm256_set1_epi32(0xffff);
+  int64_t i = 0;
+  for (; i <= length - 16; i += 16) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i), NarrowTo16(src + i, mask));
+  }
+  return i;
+}
+
+ARROW_TARGET_AVX2 int64_t DowncastIntsAvx2(const int64_t* src, int8_t* dest,
+                                           int64_t length) {
+  const __m256i mask = _mm256_set1_epi32(0xff);
+  int64_t i = 0;
+  for (; i <= length - 32; i += 32) {
+    const __m256i packed =
+        _mm256_packus_epi16(NarrowTo16(src + i, mask), NarrowTo16(src + i + 16, mask));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i),
+                        _mm256_permute4x64_epi64(packed, 0xd8));
+  }
+  return i;
+}
+
+#endif  // ARROW_HAVE_RUNTIME_AVX2
+
+// Truncation is the same for signed and unsigned integers, so the unsigned
+// downcasts share the signed kernels
+template <typename Dest>
+inline void DowncastIntsDispatch(const int64_t* src, Dest* dest, int64_t length) {
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  if (UseAvx2()) {
+    const int64_t done = DowncastIntsAvx2(src, dest, length);
+    src += done;
+    dest += done;
+    length -= done;
+  }
+#endif
+  DowncastIntsInternal(src, dest, length);
+}
+
 void DowncastInts(const int64_t* source, int8_t* dest, int64_t length) {
-  DowncastIntsInternal(source, dest, length);
+  DowncastIntsDispatch(source, dest, length);
 }
 
 void DowncastInts(const int64_t* source, int16_t* dest, int64_t length) {
-  DowncastIntsInternal(source, dest, length);
+  DowncastIntsDispatch(source, dest, length);
 }
 
 void DowncastInts(const int64_t* source, int32_t* dest, int64_t length) {
-  DowncastIntsInternal(source, dest, length);
+  DowncastIntsDispatch(source, dest, length);
 }
 
 void DowncastInts(const int64_t* source, int64_t* dest, int64_t length) {
@@ -387,24 +616,230 @@ void DowncastInts(const int64_t* source, int64_t* dest, int64_t length) {
 }
 
 void DowncastUInts(const uint64_t* source, uint8_t* dest, int64_t length) {
-  DowncastIntsInternal(source, dest, length);
+  DowncastIntsDispatch(reinterpret_cast<const int64_t*>(source),
+                       reinterpret_cast<int8_t*>(dest), length);
 }
 
 void DowncastUInts(const uint64_t* source, uint16_t* dest, int64_t length) {
-  DowncastIntsInternal(source, dest, length);
+  DowncastIntsDispatch(reinterpret_cast<const int64_t*>(source),
+                       reinterpret_cast<int16_t*>(dest), length);
 }
 
 void DowncastUInts(const uint64_t* source, uint32_t* dest, int64_t length) {
-  DowncastIntsInternal(source, dest, length);
+  DowncastIntsDispatch(reinterpret_cast<const int64_t*>(source),
+                       reinterpret_cast<int32_t*>(dest), length);
 }
 
 void DowncastUInts(const uint64_t* source, uint64_t* dest, int64_t length) {
   memcpy(dest, source, length * sizeof(int64_t));
 }
 
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+
+// Load the `nbytes` (16, 8 or 4) bytes at p into the low part of a register
+ARROW_TARGET_AVX2 inline __m128i LoadLow(const void* p, int nbytes) {
+  if (nbytes == 16) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+  } else if (nbytes == 8) {
+    return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+  } else {
+    int32_t v;
+    memcpy(&v, p, sizeof(v));
+    return _mm_cvtsi32_si128(v);
+  }
+}
+
+template <typename InputInt, typename OutputInt>
+struct Avx2Upcast {};
+
+#define UPCAST_AVX2(INPUT, OUTPUT, CONVERT)                                          \
+  template <>                                                                      \
+  struct Avx2Upcast<INPUT, OUTPUT> {                                               \
+    ARROW_TARGET_AVX2 static __m256i Convert(__m128i v) { return CONVERT(v); }     \
+  };
+
+UPCAST_AVX2(int8_t, int16_t, _mm256_cvtepi8_epi16)
+UPCAST_AVX2(int8_t, int32_t, _mm256_cvtepi8_epi32)
+UPCAST_AVX2(int8_t, int64_t, _mm256_cvtepi8_epi64)
+UPCAST_AVX2(int16_t, int32_t, _mm256_cvtepi16_epi32)
+UPCAST_AVX2(int16_t, int64_t, _mm256_cvtepi16_epi64)
+UPCAST_AVX2(int32_t, int64_t, _mm256_cvtepi32_epi64)
+UPCAST_AVX2(uint8_t, uint16_t, _mm256_cvtepu8_epi16)
+UPCAST_AVX2(uint8_t, uint32_t, _mm256_cvtepu8_epi32)
+UPCAST_AVX2(uint8_t, uint64_t, _mm256_cvtepu8_epi64)
+UPCAST_AVX2(uint16_t, uint32_t, _mm256_cvtepu16_epi32)
+UPCAST_AVX2(uint16_t, uint64_t, _mm256_cvtepu16_epi64)
+UPCAST_AVX2(uint32_t, uint64_t, _mm256_cvtepu32_epi64)
+
+#undef UPCAST_AVX2
+
+// Widen the values from the end, a full output register at a time, and
+// return the number of leading values left to convert.  Each block is loaded
+// before being stored, and lands at or after its source, so in-place widening
+// never overwrites values not yet read.
+template <typename InputInt, typename OutputInt>
+ARROW_TARGET_AVX2 int64_t UpcastIntsAvx2(const InputInt* src, OutputInt* dest,
+                                         int64_t length) {
+  constexpr int64_t kBatch = sizeof(__m256i) / sizeof(OutputInt);
+  constexpr int kUnroll = 4;
+  int64_t i = length;
+  for (; i >= kUnroll * kBatch; i -= kUnroll * kBatch) {
+    __m128i v[kUnroll];
+    for (int k = 0; k < kUnroll; ++k) {
+      v[k] = LoadLow(src + i - (k + 1) * kBatch, kBatch * sizeof(InputInt));
+    }
+    for (int k = 0; k < kUnroll; ++k) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i - (k + 1) * kBatch),
+                          Avx2Upcast<InputInt, OutputInt>::Convert(v[k]));
+    }
+  }
+  return i;
+}
+
+#endif  // ARROW_HAVE_RUNTIME_AVX2
+
+template <typename InputInt, typename OutputInt>
+void UpcastInts(const InputInt* source, OutputInt* dest, int64_t length) {
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  if (UseAvx2()) {
+    length = UpcastIntsAvx2(source, dest, length);
+  }
+#endif
+  // Backwards, like the AVX2 kernel, to allow widening in place
+  while (length > 0) {
+    --length;
+    dest[length] = static_cast<OutputInt>(source[length]);
+  }
+}
+
+#define INSTANTIATE(SRC, DEST)           \
+  template ARROW_EXPORT void UpcastInts( \
+      const SRC* source, DEST* dest, int64_t length);
+
+INSTANTIATE(int8_t, int16_t)
+INSTANTIATE(int8_t, int32_t)
+INSTANTIATE(int8_t, int64_t)
+INSTANTIATE(int16_t, int32_t)
+INSTANTIATE(int16_t, int64_t)
+INSTANTIATE(int32_t, int64_t)
+INSTANTIATE(uint8_t, uint16_t)
+INSTANTIATE(uint8_t, uint32_t)
+INSTANTIATE(uint8_t, uint64_t)
+INSTANTIATE(uint16_t, uint32_t)
+INSTANTIATE(uint16_t, uint64_t)
+INSTANTIATE(uint32_t, uint64_t)
+
+#undef INSTANTIATE
+
+//
+// Index transposition
+//
+
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+
+// Eight indices, as 32-bit integers
+template <typename InputInt>
+struct Avx2TransposeLoad {};
+
+template <>
+struct Avx2TransposeLoad<int8_t> {
+  ARROW_TARGET_AVX2 static __m256i Load(const int8_t* src) {
+    return _mm256_cvtepi8_epi32(LoadLow(src, 8));
+  }
+};
+
+template <>
+struct Avx2TransposeLoad<int16_t> {
+  ARROW_TARGET_AVX2 static __m256i Load(const int16_t* src) {
+    return _mm256_cvtepi16_epi32(LoadLow(src, 16));
+  }
+};
+
+template <>
+struct Avx2TransposeLoad<int32_t> {
+  ARROW_TARGET_AVX2 static __m256i Load(const int32_t* src) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+  }
+};
+
+template <>
+struct Avx2TransposeLoad<int64_t> {
+  // Indices into a transpose map fit in 32 bits
+  ARROW_TARGET_AVX2 static __m256i Load(const int64_t* src) {
+    const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 4));
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(NarrowTo32(lo)),
+                                   NarrowTo32(hi), 1);
+  }
+};
+
+// Store eight transposed indices, which fit in OutputInt
+template <typename OutputInt>
+struct Avx2TransposeStore {};
+
+template <>
+struct Avx2TransposeStore<int8_t> {
+  ARROW_TARGET_AVX2 static void Store(int8_t* dest, __m256i v) {
+    const __m128i packed = _mm_packs_epi32(_mm256_castsi256_si128(v),
+                                           _mm256_extracti128_si256(v, 1));
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dest), _mm_packs_epi16(packed, packed));
+  }
+};
+
+template <>
+struct Avx2TransposeStore<int16_t> {
+  ARROW_TARGET_AVX2 static void Store(int16_t* dest, __m256i v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest),
+                     _mm_packs_epi32(_mm256_castsi256_si128(v),
+                                     _mm256_extracti128_si256(v, 1)));
+  }
+};
+
+template <>
+struct Avx2TransposeStore<int32_t> {
+  ARROW_TARGET_AVX2 static void Store(int32_t* dest, __m256i v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), v);
+  }
+};
+
+template <>
+struct Avx2TransposeStore<int64_t> {
+  ARROW_TARGET_AVX2 static void Store(int64_t* dest, __m256i v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest),
+                        _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 4),
+                        _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1)));
+  }
+};
+
+// Look up eight indices at a time with a gather, and return the number of
+// indices transposed
+template <typename InputInt, typename OutputInt>
+ARROW_TARGET_AVX2 int64_t TransposeIntsAvx2(const InputInt* src, OutputInt* dest,
+                                            int64_t length,
+                                            const int32_t* transpose_map) {
+  int64_t i = 0;
+  for (; i <= length - 8; i += 8) {
+    const __m256i indices = Avx2TransposeLoad<InputInt>::Load(src + i);
+    Avx2TransposeStore<OutputInt>::Store(
+        dest + i, _mm256_i32gather_epi32(transpose_map, indices, sizeof(int32_t)));
+  }
+  return i;
+}
+
+#endif  // ARROW_HAVE_RUNTIME_AVX2
+
 template <typename InputInt, typename OutputInt>
 void TransposeInts(const InputInt* src, OutputInt* dest, int64_t length,
                    const int32_t* transpose_map) {
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  if (UseAvx2()) {
+    const int64_t done = TransposeIntsAvx2(src, dest, length, transpose_map);
+    src += done;
+    dest += done;
+    length -= done;
+  }
+#endif
   while (length >= 4) {
     dest[0] = static_cast<OutputInt>(transpose_map[src[0]]);
     dest[1] = static_cast<OutputInt>(transpose_map[src[1]]);
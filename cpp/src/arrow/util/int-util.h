@@ -64,6 +64,13 @@ void DowncastUInts(const uint64_t* source, uint32_t* dest, int64_t length);
 ARROW_EXPORT
 void DowncastUInts(const uint64_t* source, uint64_t* dest, int64_t length);
 
+/// \brief Widen integers to a larger type of the same signedness
+///
+/// dest may overlap source provided they start at the same address, so that
+/// a buffer can be widened in place.
+template <typename InputInt, typename OutputInt>
+ARROW_EXPORT void UpcastInts(const InputInt* source, OutputInt* dest, int64_t length);
+
 template <typename InputInt, typename OutputInt>
 ARROW_EXPORT void TransposeInts(const InputInt* source, OutputInt* dest, int64_t length,
                                 const int32_t* transpose_map);
@@ -69,6 +69,7 @@
 #undef Free
 #else  // POSIX-like platforms
 #include <sys/mman.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #endif
 
@@ -369,6 +370,29 @@ Status FileGetSize(int fd, int64_t* size) {
   return Status::OK();
 }
 
+Status FileGetStatus(const PlatformFilename& file_name, int64_t* size,
+                     int64_t* mtime_ns) {
+#if defined(_MSC_VER)
+  struct __stat64 st;
+  int ret = _wstat64(file_name.wstring().c_str(), &st);
+#else
+  struct stat st;
+  int ret = stat(file_name.c_str(), &st);
+#endif
+  RETURN_NOT_OK(CheckFileOpResult(ret, errno, file_name, "stat"));
+
+  *size = static_cast<int64_t>(st.st_size);
+#if defined(_WIN32)
+  *mtime_ns = static_cast<int64_t>(st.st_mtime) * 1000000000LL;
+#elif defined(__APPLE__)
+  *mtime_ns = static_cast<int64_t>(st.st_mtimespec.tv_sec) * 1000000000LL +
+              st.st_mtimespec.tv_nsec;
+#else
+  *mtime_ns = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000LL + st.st_mtim.tv_nsec;
+#endif
+  return Status::OK();
+}
+
 //
 // Reading data
 //
@@ -488,6 +512,58 @@ Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes) {
   return Status::OK();
 }
 
+Status FileWriteV(int fd, const std::vector<std::shared_ptr<Buffer>>& buffers) {
+#ifdef _WIN32
+  for (const auto& buffer : buffers) {
+    if (buffer && buffer->size() > 0) {
+      RETURN_NOT_OK(FileWrite(fd, buffer->data(), buffer->size()));
+    }
+  }
+  return Status::OK();
+#else
+#ifdef IOV_MAX
+  const size_t max_vectors = IOV_MAX;
+#else
+  const size_t max_vectors = 1024;
+#endif
+  std::vector<struct iovec> vectors;
+  for (const auto& buffer : buffers) {
+    if (buffer && buffer->size() > 0) {
+      struct iovec vector;
+      vector.iov_base = const_cast<uint8_t*>(buffer->data());
+      vector.iov_len = static_cast<size_t>(buffer->size());
+      vectors.push_back(vector);
+    }
+  }
+
+  size_t index = 0;
+  while (index < vectors.size()) {
+    const int count = static_cast<int>(std::min(vectors.size() - index, max_vectors));
+    ssize_t ret = writev(fd, &vectors[index], count);
+    if (ret == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return Status::IOError(std::string("Error writing bytes from file: ") +
+                             std::string(strerror(errno)));
+    }
+    // Skip what was written, which may end in the middle of a buffer
+    size_t written = static_cast<size_t>(ret);
+    while (written > 0) {
+      if (written >= vectors[index].iov_len) {
+        written -= vectors[index].iov_len;
+        ++index;
+      } else {
+        vectors[index].iov_base = static_cast<uint8_t*>(vectors[index].iov_base) + written;
+        vectors[index].iov_len -= written;
+        written = 0;
+      }
+    }
+  }
+  return Status::OK();
+#endif
+}
+
 Status FileTruncate(int fd, const int64_t size) {
   int ret, errno_actual;
 
@@ -162,6 +162,9 @@ Status FileReadAt(int fd, uint8_t* buffer, int64_t position, int64_t nbytes,
                   int64_t* bytes_read);
 ARROW_EXPORT
 Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes);
+/// \brief Write buffers with gather writes where supported, skipping null ones
+ARROW_EXPORT
+Status FileWriteV(int fd, const std::vector<std::shared_ptr<Buffer>>& buffers);
 ARROW_EXPORT
 Status FileTruncate(int fd, const int64_t size);
 
@@ -173,6 +176,11 @@ ARROW_EXPORT
 Status FileSeek(int fd, int64_t pos, int whence);
 ARROW_EXPORT
 Status FileGetSize(int fd, int64_t* size);
+/// \brief Get the size of a file and its last modification time, in
+/// nanoseconds since the epoch
+ARROW_EXPORT
+Status FileGetStatus(const PlatformFilename& file_name, int64_t* size,
+                     int64_t* mtime_ns);
 
 ARROW_EXPORT
 Status FileClose(int fd);
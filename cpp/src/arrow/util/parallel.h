@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/task-group.h"
 #include "arrow/util/thread-pool.h"
 
 namespace arrow {
@@ -31,20 +32,16 @@ namespace internal {
 
 // A parallelizer that takes a `Status(int)` function and calls it with
 // arguments between 0 and `num_tasks - 1`, on an arbitrary number of threads.
+// It is safe to call from a task already running on the CPU thread pool:
+// the waiting worker executes pending tasks instead of blocking.
 
 template <class FUNCTION>
 Status ParallelFor(int num_tasks, FUNCTION&& func) {
-  auto pool = internal::GetCpuThreadPool();
-  std::vector<std::future<Status>> futures(num_tasks);
-
+  auto task_group = TaskGroup::MakeThreaded(internal::GetCpuThreadPool());
   for (int i = 0; i < num_tasks; ++i) {
-    futures[i] = pool->Submit(func, i);
-  }
-  auto st = Status::OK();
-  for (auto& fut : futures) {
-    st &= fut.get();
+    task_group->Append([&func, i]() { return func(i); });
   }
-  return st;
+  return task_group->Finish();
 }
 
 // A variant of ParallelFor() with an explicit number of dedicated threads.
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstdlib>
 #include <locale>
 #include <stdexcept>
 #include <string>
@@ -98,6 +99,38 @@ TEST(StringConversion, ToDouble) {
   AssertConversionFails(converter, "e");
 }
 
+TEST(StringConversion, ToDoubleFastPath) {
+  StringConverter<DoubleType> converter;
+
+  // These decimals are exactly converted without falling back to
+  // double-conversion; the results must match correctly rounded parsing
+  for (const std::string s :
+       {"5.67", "-5.67e-8", "0.0012345", "2.34567e8", "123456789012345678", "9.5e22",
+        "1e22", "1e-22", "4503599627370497", "0.1", "1E5", "1e+5", "-7e-3"}) {
+    AssertConversion(converter, s, std::strtod(s.c_str(), nullptr));
+  }
+  // These take the slow path
+  for (const std::string s : {"1e23", "9007199254740993", "12345678901234567890123",
+                              "1.7976931348623157e308", "4.9e-324", "1e-400"}) {
+    AssertConversion(converter, s, std::strtod(s.c_str(), nullptr));
+  }
+
+  AssertConversionFails(converter, "1e");
+  AssertConversionFails(converter, "1e+");
+  AssertConversionFails(converter, "-");
+  AssertConversionFails(converter, "1.5x");
+  AssertConversionFails(converter, "1.2.3");
+}
+
+TEST(StringConversion, ToFloatFastPath) {
+  StringConverter<FloatType> converter;
+
+  for (const std::string s :
+       {"5.67", "-5.67e-8", "0.0012345", "2.5e10", "16777217", "1e-10", "3.4e38"}) {
+    AssertConversion(converter, s, std::strtof(s.c_str(), nullptr));
+  }
+}
+
 TEST(StringConversion, ToFloatLocale) {
   // French locale uses the comma as decimal point
   LocaleGuard locale_guard("fr_FR.UTF-8");
@@ -217,12 +250,21 @@ TEST(StringConversion, ToUInt32) {
   AssertConversion(converter, "432198765", 432198765UL);
   AssertConversion(converter, "4294967295", 4294967295UL);
   AssertConversion(converter, "04294967295", 4294967295UL);
+  AssertConversion(converter, "12345678", 12345678UL);
+  AssertConversion(converter, "99999999", 99999999UL);
+  AssertConversion(converter, "100000000", 100000000UL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "4294967296");
   AssertConversionFails(converter, "12345678901");
 
+  // Invalid characters within a block of eight digits
+  AssertConversionFails(converter, "1234a678");
+  AssertConversionFails(converter, "1234567/");
+  AssertConversionFails(converter, ":2345678");
+  AssertConversionFails(converter, "12 45678");
+
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
   AssertConversionFails(converter, "0.0");
@@ -253,10 +295,17 @@ TEST(StringConversion, ToUInt64) {
 
   AssertConversion(converter, "0", 0);
   AssertConversion(converter, "18446744073709551615", 18446744073709551615ULL);
+  AssertConversion(converter, "1234567812345678", 1234567812345678ULL);
+  AssertConversion(converter, "9999999999999999999", 9999999999999999999ULL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "18446744073709551616");
+  AssertConversionFails(converter, "99999999999999999999");
+
+  // Invalid characters within a block of eight digits
+  AssertConversionFails(converter, "123456781234x678");
+  AssertConversionFails(converter, "1234567812345678\x80");
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
@@ -280,6 +329,9 @@ TEST(StringConversion, ToTimestamp1) {
     AssertConversionFails(converter, "1970/01/01");
     AssertConversionFails(converter, "1970-01-01 ");
     AssertConversionFails(converter, "1970-01-01Z");
+    AssertConversionFails(converter, "197a-01-01");
+    AssertConversionFails(converter, "1970-0:-01");
+    AssertConversionFails(converter, "1970-01-/1");
 
     // Invalid dates
     AssertConversionFails(converter, "1970-00-01");
@@ -332,6 +384,10 @@ TEST(StringConversion, ToTimestamp2) {
     AssertConversionFails(converter, "1970-01-01 24:00:00");
     AssertConversionFails(converter, "1970-01-01 00:60:00");
     AssertConversionFails(converter, "1970-01-01 00:00:60");
+    // Invalid characters
+    AssertConversionFails(converter, "1970-01-01 0a:00:00");
+    AssertConversionFails(converter, "1970-01-01 00-00:00");
+    AssertConversionFails(converter, "1970-01-01 00:00:0 ");
   }
   {
     StringConverter<TimestampType> converter(timestamp(TimeUnit::MILLI));
@@ -22,6 +22,8 @@
 
 #include <cassert>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <locale>
 #include <memory>
@@ -33,6 +35,7 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/vendored/datetime.h"
 
@@ -102,6 +105,9 @@ class StringToFloatConverterMixin {
                             "nan") {}
 
   bool operator()(const char* s, size_t length, value_type* out) {
+    if (ARROW_PREDICT_TRUE(FastConvert(s, length, out))) {
+      return true;
+    }
     value_type v;
     // double-conversion doesn't give us an error flag but signals parse
     // errors with sentinel values.  Since a sentinel value can appear as
@@ -119,6 +125,75 @@ class StringToFloatConverterMixin {
   }
 
  protected:
+  // Clinger's fast path: a decimal with a mantissa w and an exponent e is
+  // exactly w * 10^e or w / 10^-e, correctly rounded, if both w and 10^|e|
+  // are exactly representable.  Only plain "-?digits(.digits)?(e[+-]?digits)?"
+  // strings are handled; anything else is left to double-conversion.
+  static constexpr int kMaxExactPow10 = std::is_same<value_type, float>::value ? 10 : 22;
+  static constexpr uint64_t kMaxExactMantissa =
+      std::is_same<value_type, float>::value ? (1ULL << 24) : (1ULL << 53);
+
+  static bool FastConvert(const char* s, size_t length, value_type* out) {
+    // Narrowed to float exactly, as the powers used for it are at most 10^10
+    static const double kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                    1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                    1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    const char* end = s + length;
+    const bool negative = s != end && *s == '-';
+    s += negative;
+
+    // Mantissa digits, with at most 19 significant ones
+    uint64_t mantissa = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    const char* digits_start = s;
+    for (; s != end && static_cast<uint8_t>(*s - '0') <= 9; ++s) {
+      mantissa = mantissa * 10 + static_cast<uint8_t>(*s - '0');
+      num_digits += (num_digits > 0 || mantissa > 0);
+    }
+    if (s == digits_start) {
+      return false;
+    }
+    if (s != end && *s == '.') {
+      const char* fraction_start = ++s;
+      for (; s != end && static_cast<uint8_t>(*s - '0') <= 9; ++s) {
+        mantissa = mantissa * 10 + static_cast<uint8_t>(*s - '0');
+        num_digits += (num_digits > 0 || mantissa > 0);
+      }
+      if (s == fraction_start) {
+        return false;
+      }
+      exponent = -static_cast<int>(s - fraction_start);
+    }
+    if (s != end && (*s == 'e' || *s == 'E')) {
+      ++s;
+      const bool negative_exponent = s != end && *s == '-';
+      s += (s != end && (*s == '-' || *s == '+'));
+      const char* exponent_start = s;
+      int explicit_exponent = 0;
+      for (; s != end && static_cast<uint8_t>(*s - '0') <= 9 && s - exponent_start < 4;
+           ++s) {
+        explicit_exponent = explicit_exponent * 10 + static_cast<uint8_t>(*s - '0');
+      }
+      if (s == exponent_start) {
+        return false;
+      }
+      exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+    }
+    if (s != end || num_digits > 19 || mantissa > kMaxExactMantissa ||
+        exponent < -kMaxExactPow10 || exponent > kMaxExactPow10) {
+      return false;
+    }
+    value_type v = static_cast<value_type>(mantissa);
+    if (exponent < 0) {
+      v /= static_cast<value_type>(kPow10[-exponent]);
+    } else {
+      v *= static_cast<value_type>(kPow10[exponent]);
+    }
+    *out = negative ? -v : v;
+    return true;
+  }
+
   static const int flags_ =
       double_conversion::StringToDoubleConverter::ALLOW_CASE_INSENSIBILITY;
   // Two unlikely values to signal a parsing error
@@ -153,6 +228,51 @@ namespace detail {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+// Parse eight decimal digits at once, using SWAR arithmetic on a 64-bit word
+inline bool ParseEightDigits(const char* s, uint32_t* out) {
+  uint64_t v;
+  std::memcpy(&v, s, 8);
+  v = BitUtil::FromLittleEndian(v);
+  // Each byte must be in ['0', '9'], i.e. have 3 as its high nibble, and not
+  // overflow that nibble when adding 6
+  const uint64_t high_nibbles = v & 0xF0F0F0F0F0F0F0F0ULL;
+  const uint64_t carried = ((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4;
+  if (ARROW_PREDICT_FALSE((high_nibbles | carried) != 0x3333333333333333ULL)) {
+    return false;
+  }
+  v -= 0x3030303030303030ULL;
+  // Combine pairs of digits, then pairs of pairs, etc.
+  v = v * 10 + (v >> 8);
+  v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+       (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+      32;
+  *out = static_cast<uint32_t>(v);
+  return true;
+}
+
+// Parse 8 to 19 decimal digits, eight at a time.  This cannot overflow.
+inline bool ParseLongUnsigned(const char* s, size_t length, uint64_t* out) {
+  uint64_t result = 0;
+  while (length >= 8) {
+    uint32_t chunk;
+    if (ARROW_PREDICT_FALSE(!ParseEightDigits(s, &chunk))) {
+      return false;
+    }
+    result = result * 100000000ULL + chunk;
+    s += 8;
+    length -= 8;
+  }
+  for (; length > 0; --length) {
+    const uint8_t digit = ParseDecimalDigit(*s++);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = result * 10U + digit;
+  }
+  *out = result;
+  return true;
+}
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -213,6 +333,14 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
   uint32_t result = 0;
+  if (length >= 8 && length <= 9) {
+    uint64_t value;
+    if (ARROW_PREDICT_FALSE(!ParseLongUnsigned(s, length, &value))) {
+      return false;
+    }
+    *out = static_cast<uint32_t>(value);
+    return true;
+  }
 
   PARSE_UNSIGNED_ITERATION(uint32_t);
   PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -232,6 +360,9 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
   uint64_t result = 0;
+  if (length >= 8 && length <= 19) {
+    return ParseLongUnsigned(s, length, out);
+  }
 
   PARSE_UNSIGNED_ITERATION(uint64_t);
   PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -428,47 +559,39 @@ class StringConverter<TimestampType> {
     return true;
   }
 
+  // The fields of the fixed layouts are decoded without branching on each
+  // character: errors are accumulated and checked once.
+  static uint32_t DecodeDigit(char c, bool* error) {
+    const uint32_t digit = static_cast<uint8_t>(c - '0');
+    *error |= digit > 9U;
+    return digit;
+  }
+
+  static uint32_t DecodeTwoDigits(const char* s, bool* error) {
+    return 10U * DecodeDigit(s[0], error) + DecodeDigit(s[1], error);
+  }
+
   bool ParseYYYY_MM_DD(const char* s, arrow::util::date::year_month_day* out) {
-    uint16_t year;
-    uint8_t month, day;
-    if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 0, 4, &year))) {
+    bool error = (s[4] != '-') | (s[7] != '-');
+    const uint32_t year =
+        100U * DecodeTwoDigits(s + 0, &error) + DecodeTwoDigits(s + 2, &error);
+    const uint32_t month = DecodeTwoDigits(s + 5, &error);
+    const uint32_t day = DecodeTwoDigits(s + 8, &error);
+    if (ARROW_PREDICT_FALSE(error)) {
       return false;
     }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 5, 2, &month))) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 8, 2, &day))) {
-      return false;
-    }
-    *out = {arrow::util::date::year{year}, arrow::util::date::month{month},
-            arrow::util::date::day{day}};
+    *out = {arrow::util::date::year{static_cast<int>(year)},
+            arrow::util::date::month{month}, arrow::util::date::day{day}};
     return out->ok();
   }
 
   bool ParseHH_MM_SS(const char* s, std::chrono::duration<value_type>* out) {
-    uint8_t hours, minutes, seconds;
-    if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 0, 2, &hours))) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 3, 2, &minutes))) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 6, 2, &seconds))) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(hours >= 24)) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(minutes >= 60)) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(seconds >= 60)) {
+    bool error = (s[2] != ':') | (s[5] != ':');
+    const uint32_t hours = DecodeTwoDigits(s + 0, &error);
+    const uint32_t minutes = DecodeTwoDigits(s + 3, &error);
+    const uint32_t seconds = DecodeTwoDigits(s + 6, &error);
+    error |= (hours >= 24) | (minutes >= 60) | (seconds >= 60);
+    if (ARROW_PREDICT_FALSE(error)) {
       return false;
     }
     *out = std::chrono::duration<value_type>(3600U * hours + 60U * minutes + seconds);
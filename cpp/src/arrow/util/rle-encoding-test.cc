@@ -17,6 +17,7 @@
 
 // From Apache Impala (incubating) as of 2016-01-29
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <random>
@@ -135,6 +136,42 @@ TEST(BitArray, TestValues) {
   }
 }
 
+// Batch reads unpack 32 values at a time, from buffers sized exactly to the
+// packed values so that reads past their end are detected
+TEST(BitArray, TestBatchValues) {
+  std::default_random_engine gen(42);
+  for (int width = 1; width <= MAX_WIDTH; ++width) {
+    std::uniform_int_distribution<uint64_t> dist(0, (1ULL << width) - 1);
+    for (int num_values : {31, 32, 96, 1000, 2048}) {
+      vector<uint32_t> values(num_values);
+      for (auto& value : values) {
+        value = static_cast<uint32_t>(dist(gen));
+      }
+      const int len = static_cast<int>(BitUtil::BytesForBits(num_values * width));
+      vector<uint8_t> buffer(len);
+      BitUtil::BitWriter writer(buffer.data(), len);
+      for (uint32_t value : values) {
+        EXPECT_TRUE(writer.PutValue(value, width));
+      }
+      writer.Flush();
+
+      // Starting both on and off a byte boundary
+      for (int skip : {0, 1}) {
+        BitUtil::BitReader reader(buffer.data(), len);
+        uint32_t skipped = 0;
+        for (int i = 0; i < skip; ++i) {
+          EXPECT_TRUE(reader.GetValue(width, &skipped));
+        }
+        vector<uint32_t> values_read(num_values - skip);
+        EXPECT_EQ(num_values - skip,
+                  reader.GetBatch(width, values_read.data(), num_values - skip));
+        EXPECT_TRUE(std::equal(values.begin() + skip, values.end(), values_read.begin()))
+            << "width " << width << " num_values " << num_values << " skip " << skip;
+      }
+    }
+  }
+}
+
 // Test some mixed values
 TEST(BitArray, TestMixed) {
   const int len = 1024;
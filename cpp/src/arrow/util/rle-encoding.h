@@ -116,6 +116,10 @@ class RleDecoder {
   template <typename T>
   int GetBatch(T* values, int batch_size);
 
+  /// Like GetBatch for a bit width of 1, but the values are written as bits of
+  /// the bitmap starting at bit bitmap_offset
+  int GetBitmap(uint8_t* bitmap, int64_t bitmap_offset, int batch_size);
+
   /// Like GetBatch but the values are then decoded using the provided dictionary
   template <typename T>
   int GetBatchWithDict(const T* dictionary, T* values, int batch_size);
@@ -310,6 +314,35 @@ inline int RleDecoder::GetBatch(T* values, int batch_size) {
   return values_read;
 }
 
+inline int RleDecoder::GetBitmap(uint8_t* bitmap, int64_t bitmap_offset,
+                                 int batch_size) {
+  DCHECK_EQ(bit_width_, 1);
+  int values_read = 0;
+
+  while (values_read < batch_size) {
+    if (repeat_count_ > 0) {
+      int repeat_batch =
+          std::min(batch_size - values_read, static_cast<int>(repeat_count_));
+      BitUtil::SetBitsTo(bitmap, bitmap_offset + values_read, repeat_batch,
+                         current_value_ != 0);
+      repeat_count_ -= repeat_batch;
+      values_read += repeat_batch;
+    } else if (literal_count_ > 0) {
+      int literal_batch =
+          std::min(batch_size - values_read, static_cast<int>(literal_count_));
+      int actual_read =
+          bit_reader_.GetBitmap(bitmap, bitmap_offset + values_read, literal_batch);
+      DCHECK_EQ(actual_read, literal_batch);
+      literal_count_ -= literal_batch;
+      values_read += literal_batch;
+    } else {
+      if (!NextCounts<uint8_t>()) return values_read;
+    }
+  }
+
+  return values_read;
+}
+
 template <typename T>
 inline int RleDecoder::GetBatchWithDict(const T* dictionary, T* values, int batch_size) {
   DCHECK_GE(bit_width_, 0);
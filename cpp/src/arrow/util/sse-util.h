@@ -48,6 +48,19 @@
 
 #endif
 
+// AVX2 kernels are compiled for that instruction set through function
+// attributes and only called when CpuInfo::CanUseAVX2() says so, so that
+// the rest of the library keeps the baseline target
+
+#undef ARROW_HAVE_RUNTIME_AVX2
+
+#if defined(ARROW_USE_SIMD) && defined(__x86_64__) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define ARROW_HAVE_RUNTIME_AVX2 1
+#define ARROW_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
 namespace arrow {
 
 /// This class contains constants useful for text processing with SSE4.2 intrinsics.
@@ -212,6 +212,57 @@ void TestTasksSpawnTasks(std::shared_ptr<TaskGroup> task_group) {
   ASSERT_EQ(count.load(), (1 << (N + 1)) - 1);
 }
 
+// Check ThreadedTaskGroup behaviour with tasks creating and waiting for
+// their own task groups on the same thread pool
+void TestNestedTaskGroups(ThreadPool* thread_pool) {
+  const int NOUTER = 8;
+  const int NINNER = 8;
+
+  std::atomic<int> count(0);
+  auto task_group = TaskGroup::MakeThreaded(thread_pool);
+  for (int i = 0; i < NOUTER; ++i) {
+    task_group->Append([&]() {
+      auto inner_group = TaskGroup::MakeThreaded(thread_pool);
+      for (int j = 0; j < NINNER; ++j) {
+        inner_group->Append([&, j]() {
+          sleep_for(1e-4);
+          count += j;
+          return Status::OK();
+        });
+      }
+      // Would deadlock if all workers blocked waiting for their inner group
+      return inner_group->Finish();
+    });
+  }
+  ASSERT_OK(task_group->Finish());
+  ASSERT_EQ(count.load(), NOUTER * NINNER * (NINNER - 1) / 2);
+}
+
+// Check TaskGroup behaviour with Futures computed on a thread pool
+void TestTaskGroupFutures(std::shared_ptr<TaskGroup> task_group) {
+  std::shared_ptr<ThreadPool> thread_pool;
+  ASSERT_OK(ThreadPool::Make(2, &thread_pool));
+
+  std::atomic<int> count(0);
+  for (int i = 0; i < 5; ++i) {
+    task_group->AppendFuture(thread_pool->SubmitAsync<int>([&, i](int* out) {
+      sleep_for(1e-3);
+      count += i;
+      *out = i;
+      return Status::OK();
+    }));
+  }
+  ASSERT_OK(task_group->Finish());
+  ASSERT_EQ(count.load(), 10);
+
+  auto failing_group = task_group->MakeSubGroup();
+  failing_group->AppendFuture(thread_pool->SubmitAsync<int>([](int*) {
+    sleep_for(1e-3);
+    return Status::IOError("xxx");
+  }));
+  ASSERT_RAISES(IOError, failing_group->Finish());
+}
+
 TEST(SerialTaskGroup, Success) { TestTaskGroupSuccess(TaskGroup::MakeSerial()); }
 
 TEST(SerialTaskGroup, Errors) { TestTaskGroupErrors(TaskGroup::MakeSerial()); }
@@ -226,6 +277,8 @@ TEST(SerialTaskGroup, SubGroupsErrors) {
   TestTaskSubGroupsErrors(TaskGroup::MakeSerial());
 }
 
+TEST(SerialTaskGroup, Futures) { TestTaskGroupFutures(TaskGroup::MakeSerial()); }
+
 TEST(ThreadedTaskGroup, Success) {
   auto task_group = TaskGroup::MakeThreaded(GetCpuThreadPool());
   TestTaskGroupSuccess(task_group);
@@ -259,5 +312,25 @@ TEST(ThreadedTaskGroup, SubGroupsErrors) {
   TestTaskSubGroupsErrors(TaskGroup::MakeThreaded(thread_pool.get()));
 }
 
+TEST(ThreadedTaskGroup, Futures) {
+  TestTaskGroupFutures(TaskGroup::MakeThreaded(GetCpuThreadPool()));
+}
+
+TEST(ThreadedTaskGroup, NestedGroups) {
+  for (int nthreads : {1, 2, 4}) {
+    std::shared_ptr<ThreadPool> thread_pool;
+    ASSERT_OK(ThreadPool::Make(nthreads, &thread_pool));
+    TestNestedTaskGroups(thread_pool.get());
+  }
+}
+
+TEST(ThreadedTaskGroup, NestedGroupsWorkStealing) {
+  for (int nthreads : {1, 2, 4}) {
+    std::shared_ptr<ThreadPool> thread_pool;
+    ASSERT_OK(ThreadPool::MakeWorkStealing(nthreads, &thread_pool));
+    TestNestedTaskGroups(thread_pool.get());
+  }
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -18,11 +18,13 @@
 #include "arrow/util/task-group.h"
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <mutex>
 #include <utility>
 
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/thread-pool.h"
 
@@ -41,6 +43,11 @@ class SerialTaskGroup : public TaskGroup {
     }
   }
 
+  void AppendFuture(const FutureBase& future) override {
+    DCHECK(!finished_);
+    status_ &= future.status();
+  }
+
   Status current_status() override { return status_; }
 
   bool ok() override { return status_.ok(); }
@@ -100,6 +107,15 @@ class ThreadedTaskGroup : public TaskGroup {
     }
   }
 
+  void AppendFuture(const FutureBase& future) override {
+    // The future is already running, so track it even if errors occurred
+    nremaining_.fetch_add(1, std::memory_order_acquire);
+    future.AddCallback([this](const Status& st) {
+      UpdateStatus(Status(st));
+      OneTaskDone();
+    });
+  }
+
   Status current_status() override {
     std::lock_guard<std::mutex> lock(mutex_);
     return status_;
@@ -110,6 +126,22 @@ class ThreadedTaskGroup : public TaskGroup {
   Status Finish() override {
     std::unique_lock<std::mutex> lock(mutex_);
     if (!finished_) {
+      if (thread_pool_->OwnsThisThread()) {
+        // We're running inside a pool task (nested TaskGroup): blocking
+        // would tie up a worker, perhaps one needed to run our own tasks.
+        // Execute pending tasks instead while waiting.
+        while (nremaining_.load() != 0) {
+          lock.unlock();
+          const bool ran_task = thread_pool_->RunPendingTask();
+          lock.lock();
+          if (!ran_task) {
+            // Nothing to run right now, our tasks are executing elsewhere.
+            // Re-check periodically since other tasks may get queued.
+            cv_.wait_for(lock, std::chrono::milliseconds(1),
+                         [&]() { return nremaining_.load() == 0; });
+          }
+        }
+      }
       cv_.wait(lock, [&]() { return nremaining_.load() == 0; });
       // Current tasks may start other tasks, so only set this when done
       finished_ = true;
@@ -27,6 +27,9 @@
 #include "arrow/util/visibility.h"
 
 namespace arrow {
+
+class FutureBase;
+
 namespace internal {
 
 class ThreadPool;
@@ -49,6 +52,10 @@ class ARROW_EXPORT TaskGroup {
     return AppendReal(std::forward<Function>(func));
   }
 
+  /// Add a Future computed elsewhere (for example by ThreadPool::SubmitAsync()).
+  /// Finish() will wait for it to complete and propagate its error Status.
+  virtual void AppendFuture(const FutureBase& future) = 0;
+
   /// Wait for execution of all tasks (and subgroups) to be finished,
   /// or for at least one task (or subgroup) to error out.
   /// The returned Status propagates the error status of the first failing
@@ -21,6 +21,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstdio>
@@ -132,7 +133,8 @@ class AddTester {
   std::vector<int> outs;
 };
 
-class TestThreadPool : public ::testing::Test {
+// The test parameter selects whether the pool is work-stealing
+class TestThreadPool : public ::testing::TestWithParam<bool> {
  public:
   void TearDown() {
     fflush(stdout);
@@ -143,7 +145,8 @@ class TestThreadPool : public ::testing::Test {
 
   std::shared_ptr<ThreadPool> MakeThreadPool(int threads) {
     std::shared_ptr<ThreadPool> pool;
-    Status st = ThreadPool::Make(threads, &pool);
+    Status st = GetParam() ? ThreadPool::MakeWorkStealing(threads, &pool)
+                           : ThreadPool::Make(threads, &pool);
     return pool;
   }
 
@@ -175,7 +178,7 @@ class TestThreadPool : public ::testing::Test {
   }
 };
 
-TEST_F(TestThreadPool, ConstructDestruct) {
+TEST_P(TestThreadPool, ConstructDestruct) {
   // Stress shutdown-at-destruction logic
   for (int threads : {1, 2, 3, 8, 32, 70}) {
     auto pool = this->MakeThreadPool(threads);
@@ -184,22 +187,22 @@ TEST_F(TestThreadPool, ConstructDestruct) {
 
 // Correctness and stress tests using Spawn() and Shutdown()
 
-TEST_F(TestThreadPool, Spawn) {
+TEST_P(TestThreadPool, Spawn) {
   auto pool = this->MakeThreadPool(3);
   SpawnAdds(pool.get(), 7, task_add<int>);
 }
 
-TEST_F(TestThreadPool, StressSpawn) {
+TEST_P(TestThreadPool, StressSpawn) {
   auto pool = this->MakeThreadPool(30);
   SpawnAdds(pool.get(), 1000, task_add<int>);
 }
 
-TEST_F(TestThreadPool, StressSpawnThreaded) {
+TEST_P(TestThreadPool, StressSpawnThreaded) {
   auto pool = this->MakeThreadPool(30);
   SpawnAddsThreaded(pool.get(), 20, 100, task_add<int>);
 }
 
-TEST_F(TestThreadPool, SpawnSlow) {
+TEST_P(TestThreadPool, SpawnSlow) {
   // This checks that Shutdown() waits for all tasks to finish
   auto pool = this->MakeThreadPool(2);
   SpawnAdds(pool.get(), 7, [](int x, int y, int* out) {
@@ -207,21 +210,21 @@ TEST_F(TestThreadPool, SpawnSlow) {
   });
 }
 
-TEST_F(TestThreadPool, StressSpawnSlow) {
+TEST_P(TestThreadPool, StressSpawnSlow) {
   auto pool = this->MakeThreadPool(30);
   SpawnAdds(pool.get(), 1000, [](int x, int y, int* out) {
     return task_slow_add(0.002 /* seconds */, x, y, out);
   });
 }
 
-TEST_F(TestThreadPool, StressSpawnSlowThreaded) {
+TEST_P(TestThreadPool, StressSpawnSlowThreaded) {
   auto pool = this->MakeThreadPool(30);
   SpawnAddsThreaded(pool.get(), 20, 100, [](int x, int y, int* out) {
     return task_slow_add(0.002 /* seconds */, x, y, out);
   });
 }
 
-TEST_F(TestThreadPool, QuickShutdown) {
+TEST_P(TestThreadPool, QuickShutdown) {
   AddTester add_tester(100);
   {
     auto pool = this->MakeThreadPool(3);
@@ -234,7 +237,7 @@ TEST_F(TestThreadPool, QuickShutdown) {
   add_tester.CheckNotAllComputed();
 }
 
-TEST_F(TestThreadPool, SetCapacity) {
+TEST_P(TestThreadPool, SetCapacity) {
   auto pool = this->MakeThreadPool(3);
   ASSERT_EQ(pool->GetCapacity(), 3);
   ASSERT_EQ(pool->GetActualCapacity(), 3);
@@ -268,7 +271,7 @@ TEST_F(TestThreadPool, SetCapacity) {
 
 // Test Submit() functionality
 
-TEST_F(TestThreadPool, Submit) {
+TEST_P(TestThreadPool, Submit) {
   auto pool = this->MakeThreadPool(3);
   {
     auto fut = pool->Submit(add<int>, 4, 5);
@@ -296,11 +299,73 @@ TEST_F(TestThreadPool, Submit) {
   }
 }
 
+// Test tasks spawning other tasks
+
+static void spawn_tree(ThreadPool* pool, int depth, std::atomic<int>* count) {
+  ++*count;
+  if (depth > 0) {
+    for (int i = 0; i < 3; ++i) {
+      ASSERT_OK(pool->Spawn([=] { spawn_tree(pool, depth - 1, count); }));
+    }
+  }
+}
+
+TEST_P(TestThreadPool, NestedSpawn) {
+  for (int threads : {1, 4, 30}) {
+    auto pool = this->MakeThreadPool(threads);
+    std::atomic<int> count(0);
+    ASSERT_OK(pool->Spawn([&] { spawn_tree(pool.get(), 6, &count); }));
+    // 1 + 3 + ... + 3**6 tasks
+    busy_wait(5.0, [&] { return count.load() == 1093; });
+    ASSERT_OK(pool->Shutdown());
+    ASSERT_EQ(count.load(), 1093);
+  }
+}
+
+TEST_P(TestThreadPool, NestedSubmitWait) {
+  // A task waiting on tasks it spawned must not deadlock, as long as
+  // other workers are available
+  auto pool = this->MakeThreadPool(4);
+  auto fut = pool->Submit([&]() -> int {
+    std::vector<std::future<int>> futs;
+    for (int i = 0; i < 100; ++i) {
+      futs.push_back(pool->Submit(add<int>, i, 1));
+    }
+    int total = 0;
+    for (auto& f : futs) {
+      total += f.get();
+    }
+    return total;
+  });
+  ASSERT_EQ(fut.get(), 5050);
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST_P(TestThreadPool, NestedSpawnSetCapacity) {
+  // Downsizing must not lose tasks pending in local queues
+  auto pool = this->MakeThreadPool(8);
+  std::atomic<int> count(0);
+  for (int i = 0; i < 4; ++i) {
+    ASSERT_OK(pool->Spawn([&] {
+      for (int j = 0; j < 50; ++j) {
+        ASSERT_OK(pool->Spawn([&] {
+          sleep_for(0.0005);
+          ++count;
+        }));
+      }
+    }));
+  }
+  ASSERT_OK(pool->SetCapacity(1));
+  busy_wait(5.0, [&] { return count.load() == 200; });
+  ASSERT_EQ(count.load(), 200);
+  ASSERT_OK(pool->Shutdown());
+}
+
 // Test fork safety on Unix
 
 #if !(defined(_WIN32) || defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER) || \
       defined(THREAD_SANITIZER))
-TEST_F(TestThreadPool, ForkSafety) {
+TEST_P(TestThreadPool, ForkSafety) {
   pid_t child_pid;
   int child_status;
 
@@ -356,6 +421,102 @@ TEST_F(TestThreadPool, ForkSafety) {
 }
 #endif
 
+TEST_P(TestThreadPool, Stats) {
+  auto pool = this->MakeThreadPool(2);
+  std::atomic<int> finished(0);
+  const auto slow_task = [&] {
+    sleep_for(0.002);
+    ++finished;
+  };
+  // Not collected
+  ASSERT_OK(pool->Spawn(slow_task));
+  busy_wait(1.0, [&] { return finished.load() == 1; });
+  ASSERT_EQ(0, pool->GetStats().tasks_submitted);
+
+  pool->SetCollectStats(true);
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_OK(pool->Spawn(slow_task));
+  }
+  busy_wait(5.0, [&] { return pool->GetStats().tasks_completed == 20; });
+  auto stats = pool->GetStats();
+  ASSERT_EQ(20, stats.tasks_submitted);
+  ASSERT_EQ(20, stats.tasks_completed);
+  ASSERT_EQ(0, stats.queued_tasks);
+  ASSERT_GE(stats.max_queued_tasks, 1);
+  ASSERT_EQ(20, stats.queue_wait.count);
+  ASSERT_EQ(20, stats.execution.count);
+  ASSERT_GE(stats.execution.max_ns, 2000000);
+  ASSERT_GE(stats.execution.Quantile(0.5), 2000000);
+  ASSERT_GE(stats.execution.total_ns, 20 * 2000000);
+  ASSERT_EQ(2, stats.workers.size());
+  ASSERT_EQ(20, stats.workers[0].tasks_completed + stats.workers[1].tasks_completed);
+  ASSERT_EQ(stats.execution.total_ns, stats.total_busy_ns);
+  ASSERT_EQ(2, stats.capacity);
+  ASSERT_GT(stats.utilization(), 0);
+  ASSERT_LE(stats.utilization(), 1);
+
+  // Busy time of exited workers is kept
+  ASSERT_OK(pool->SetCapacity(1));
+  busy_wait(1.0, [&] { return pool->GetStats().workers.size() == 1; });
+  ASSERT_EQ(stats.total_busy_ns, pool->GetStats().total_busy_ns);
+
+  pool->ResetStats();
+  stats = pool->GetStats();
+  ASSERT_EQ(0, stats.tasks_submitted);
+  ASSERT_EQ(0, stats.execution.count);
+  ASSERT_EQ(0, stats.total_busy_ns);
+
+  pool->SetCollectStats(false);
+  ASSERT_OK(pool->Spawn(slow_task));
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(0, pool->GetStats().tasks_submitted);
+}
+
+TEST_P(TestThreadPool, StatsNestedTasks) {
+  auto pool = this->MakeThreadPool(1);
+  pool->SetCollectStats(true);
+  auto raw_pool = pool.get();
+  // The inner task is run by the outer one, on the same worker
+  auto fut = pool->Submit([raw_pool] {
+    if (!raw_pool->Spawn([] { sleep_for(0.002); }).ok()) {
+      return false;
+    }
+    return raw_pool->RunPendingTask();
+  });
+  ASSERT_TRUE(fut.get());
+  busy_wait(1.0, [&] { return pool->GetStats().tasks_completed == 2; });
+  auto stats = pool->GetStats();
+  ASSERT_EQ(2, stats.execution.count);
+  ASSERT_EQ(2, stats.workers[0].tasks_completed);
+  // Busy time is only counted once, for the outer task
+  ASSERT_GE(stats.total_busy_ns, 2000000);
+  ASSERT_LT(stats.total_busy_ns, stats.execution.total_ns);
+  ASSERT_EQ(stats.execution.max_ns, stats.total_busy_ns);
+  ASSERT_OK(pool->Shutdown());
+}
+
+INSTANTIATE_TEST_CASE_P(ThreadPoolModes, TestThreadPool, ::testing::Values(false, true));
+
+TEST(TestDurationHistogram, Quantile) {
+  DurationHistogram histogram;
+  ASSERT_EQ(0, histogram.Quantile(0.5));
+  // 0, 1, 2-3 and 4-7 ns
+  histogram.counts[0] = 1;
+  histogram.counts[1] = 1;
+  histogram.counts[2] = 1;
+  histogram.counts[3] = 7;
+  histogram.count = 10;
+  histogram.total_ns = 40;
+  histogram.max_ns = 6;
+  ASSERT_EQ(0, histogram.Quantile(0));
+  ASSERT_EQ(0, histogram.Quantile(0.1));
+  ASSERT_EQ(1, histogram.Quantile(0.2));
+  ASSERT_EQ(3, histogram.Quantile(0.3));
+  ASSERT_EQ(6, histogram.Quantile(0.5));
+  ASSERT_EQ(6, histogram.Quantile(1));
+  ASSERT_EQ(4.0, histogram.mean_ns());
+}
+
 TEST(TestGlobalThreadPool, Capacity) {
   // Sanity check
   auto pool = GetCpuThreadPool();
@@ -401,5 +562,24 @@ TEST(TestGlobalThreadPool, Capacity) {
   ASSERT_OK(DelEnvVar("OMP_THREAD_LIMIT"));
 }
 
+TEST(TestGlobalThreadPool, IOThreadPool) {
+  auto pool = GetIOThreadPool();
+  ASSERT_NE(pool, GetCpuThreadPool());
+  int capacity = pool->GetCapacity();
+  ASSERT_GT(capacity, 0);
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity);
+
+  // Sized independently from the CPU thread pool
+  int cpu_capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity + 3));
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity + 3);
+  ASSERT_EQ(GetCpuThreadPoolCapacity(), cpu_capacity);
+
+  auto fut = pool->Submit([]() { return 42; });
+  ASSERT_EQ(fut.get(), 42);
+
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity));
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -18,24 +18,333 @@
 #include "arrow/util/thread-pool.h"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
+#include "arrow/util/bit-util.h"
 #include "arrow/util/io-util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/tracing.h"
 
 namespace arrow {
 namespace internal {
 
-struct ThreadPool::State {
-  State() : desired_capacity_(0), please_shutdown_(false), quick_shutdown_(false) {}
+constexpr int DurationHistogram::kNumBuckets;
+
+int64_t DurationHistogram::Quantile(double q) const {
+  if (count == 0) {
+    return 0;
+  }
+  const double rank = std::min(std::max(q, 0.0), 1.0) * static_cast<double>(count);
+  int64_t cumulative = 0;
+  for (int i = 0; i < kNumBuckets; ++i) {
+    cumulative += counts[i];
+    if (counts[i] > 0 && static_cast<double>(cumulative) >= rank) {
+      const int64_t upper = i == 0 ? 0 : (int64_t(1) << i) - 1;
+      return std::min(upper, max_ns);
+    }
+  }
+  return max_ns;
+}
+
+namespace {
+
+using Task = std::function<void()>;
+
+// A single-producer, multi-consumer work-stealing deque of tasks.
+//
+// The owner worker pushes and pops tasks at the bottom end without locking,
+// while other workers steal tasks from the top end.  This is the Chase-Lev
+// deque, as formalized for the C11 memory model in "Correct and Efficient
+// Work-Stealing for Weak Memory Models" (Le et al., PPoPP 2013).
+class WorkStealingQueue {
+ public:
+  WorkStealingQueue() : top_(0), bottom_(0) {
+    arrays_.emplace_back(new Array(kInitialCapacity));
+    array_.store(arrays_.back().get(), std::memory_order_relaxed);
+  }
+
+  ~WorkStealingQueue() {
+    while (Task* task = Pop()) {
+      delete task;
+    }
+  }
+
+  // Push a task at the bottom.  Must only be called by the owner.
+  void Push(Task* task) {
+    const int64_t b = bottom_.load(std::memory_order_relaxed);
+    const int64_t t = top_.load(std::memory_order_acquire);
+    Array* array = array_.load(std::memory_order_relaxed);
+    if (b - t > array->capacity() - 1) {
+      array = Grow(array, t, b);
+    }
+    array->Put(b, task);
+    // (a release store rather than the paper's release fence + relaxed store,
+    // which is equivalent but understood by ThreadSanitizer)
+    bottom_.store(b + 1, std::memory_order_release);
+  }
+
+  // Pop a task from the bottom, or return null.  Must only be called by the owner.
+  Task* Pop() {
+    const int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+    Array* array = array_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top_.load(std::memory_order_relaxed);
+    Task* task = nullptr;
+    if (t <= b) {
+      task = array->Get(b);
+      if (t == b) {
+        // Last task, race against stealers
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+          task = nullptr;
+        }
+        bottom_.store(b + 1, std::memory_order_relaxed);
+      }
+    } else {
+      // Empty
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return task;
+  }
+
+  // Steal a task from the top, or return null.  May be called by any thread.
+  Task* Steal() {
+    while (true) {
+      int64_t t = top_.load(std::memory_order_acquire);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      const int64_t b = bottom_.load(std::memory_order_acquire);
+      if (t >= b) {
+        return nullptr;
+      }
+      Array* array = array_.load(std::memory_order_acquire);
+      Task* task = array->Get(t);
+      if (top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+        return task;
+      }
+      // Lost the race against another thief or the owner, retry
+    }
+  }
+
+  bool Empty() const {
+    const int64_t t = top_.load(std::memory_order_acquire);
+    const int64_t b = bottom_.load(std::memory_order_acquire);
+    return t >= b;
+  }
+
+ private:
+  static constexpr int64_t kInitialCapacity = 64;
+
+  // A circular array of tasks
+  class Array {
+   public:
+    explicit Array(int64_t capacity) : capacity_(capacity), tasks_(capacity) {}
+
+    int64_t capacity() const { return capacity_; }
+
+    Task* Get(int64_t i) const {
+      return tasks_[i & (capacity_ - 1)].load(std::memory_order_relaxed);
+    }
+
+    void Put(int64_t i, Task* task) {
+      tasks_[i & (capacity_ - 1)].store(task, std::memory_order_relaxed);
+    }
+
+   private:
+    const int64_t capacity_;
+    std::vector<std::atomic<Task*>> tasks_;
+  };
+
+  Array* Grow(Array* array, int64_t t, int64_t b) {
+    arrays_.emplace_back(new Array(array->capacity() * 2));
+    Array* new_array = arrays_.back().get();
+    for (int64_t i = t; i < b; ++i) {
+      new_array->Put(i, array->Get(i));
+    }
+    array_.store(new_array, std::memory_order_release);
+    // Thieves may still be reading from the old array, so it is only
+    // released when the queue is destroyed.
+    return new_array;
+  }
+
+  std::atomic<int64_t> top_;
+  std::atomic<int64_t> bottom_;
+  std::atomic<Array*> array_;
+  // Owned arrays (only accessed by the owner)
+  std::vector<std::unique_ptr<Array>> arrays_;
+};
+
+constexpr int64_t WorkStealingQueue::kInitialCapacity;
+
+int64_t NowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void UpdateMax(std::atomic<int64_t>* max, int64_t value) {
+  int64_t current = max->load(std::memory_order_relaxed);
+  while (value > current &&
+         !max->compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+// A DurationHistogram updated concurrently
+class AtomicDurationHistogram {
+ public:
+  AtomicDurationHistogram() { Reset(); }
+
+  void Add(int64_t ns) {
+    const int bucket = std::min(BitUtil::NumRequiredBits(static_cast<uint64_t>(ns)),
+                                DurationHistogram::kNumBuckets - 1);
+    counts_[bucket].fetch_add(1, std::memory_order_relaxed);
+    total_ns_.fetch_add(ns, std::memory_order_relaxed);
+    UpdateMax(&max_ns_, ns);
+  }
+
+  void Reset() {
+    for (auto& count : counts_) {
+      count.store(0, std::memory_order_relaxed);
+    }
+    total_ns_.store(0, std::memory_order_relaxed);
+    max_ns_.store(0, std::memory_order_relaxed);
+  }
+
+  void Snapshot(DurationHistogram* out) const {
+    out->count = 0;
+    for (int i = 0; i < DurationHistogram::kNumBuckets; ++i) {
+      out->counts[i] = counts_[i].load(std::memory_order_relaxed);
+      out->count += out->counts[i];
+    }
+    out->total_ns = total_ns_.load(std::memory_order_relaxed);
+    out->max_ns = max_ns_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<int64_t> counts_[DurationHistogram::kNumBuckets];
+  std::atomic<int64_t> total_ns_;
+  std::atomic<int64_t> max_ns_;
+};
+
+struct WorkerStats {
+  std::atomic<int64_t> busy_ns{0};
+  std::atomic<int64_t> tasks_completed{0};
+};
+
+// The task statistics of a pool, shared with the tasks wrapped for
+// collecting them so that they can outlive the pool state
+struct TaskStats {
+  TaskStats() { Reset(); }
+
+  void Reset() {
+    start_ns.store(NowNs());
+    tasks_submitted.store(0);
+    tasks_started.store(0);
+    tasks_completed.store(0);
+    max_queued_tasks.store(0);
+    queue_wait.Reset();
+    execution.Reset();
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& worker : workers) {
+      worker->busy_ns.store(0);
+      worker->tasks_completed.store(0);
+    }
+    retired_busy_ns = 0;
+  }
+
+  void AddWorker(const std::shared_ptr<WorkerStats>& worker) {
+    std::lock_guard<std::mutex> lock(mutex);
+    workers.push_back(worker);
+  }
+
+  void RemoveWorker(const std::shared_ptr<WorkerStats>& worker) {
+    std::lock_guard<std::mutex> lock(mutex);
+    retired_busy_ns += worker->busy_ns.load();
+    workers.erase(std::find(workers.begin(), workers.end(), worker));
+  }
+
+  std::atomic<int64_t> start_ns;
+  std::atomic<int64_t> tasks_submitted;
+  std::atomic<int64_t> tasks_started;
+  std::atomic<int64_t> tasks_completed;
+  std::atomic<int64_t> max_queued_tasks;
+  AtomicDurationHistogram queue_wait;
+  AtomicDurationHistogram execution;
+
+  // Protects the members below
+  std::mutex mutex;
+  std::vector<std::shared_ptr<WorkerStats>> workers;
+  // Busy time of the workers that exited
+  int64_t retired_busy_ns;
+};
+
+// The state of a worker thread, owned by its pool
+struct WorkerState {
+  // The worker's local queue, if the pool is work-stealing
+  std::shared_ptr<WorkStealingQueue> queue;
+  std::shared_ptr<WorkerStats> stats;
+  // The number of StatsTasks running on the worker, more than one if a task
+  // runs others through ThreadPool::RunPendingTask (only accessed by the
+  // worker itself)
+  int stats_task_depth = 0;
+};
+
+// A task recording its queue wait and execution times
+struct StatsTask {
+  StatsTask(std::shared_ptr<TaskStats> stats, Task task)
+      : stats_(std::move(stats)), submit_ns_(NowNs()), task_(std::move(task)) {
+    const int64_t submitted = stats_->tasks_submitted.fetch_add(1) + 1;
+    UpdateMax(&stats_->max_queued_tasks, submitted - stats_->tasks_started.load());
+  }
 
-  // NOTE: in case locking becomes too expensive, we can investigate lock-free FIFOs
-  // such as https://github.com/cameron314/concurrentqueue
+  // Workers run the task through Run() (see RunTask)
+  void operator()() const { Run(nullptr); }
+
+  void Run(WorkerState* worker) const {
+    const int64_t start_ns = NowNs();
+    stats_->tasks_started.fetch_add(1);
+    stats_->queue_wait.Add(start_ns - submit_ns_);
+    if (worker != nullptr) {
+      ++worker->stats_task_depth;
+    }
+    task_();
+    const int64_t busy_ns = NowNs() - start_ns;
+    if (worker != nullptr) {
+      // Nested tasks are already part of the outermost task's busy time
+      if (--worker->stats_task_depth == 0) {
+        worker->stats->busy_ns.fetch_add(busy_ns, std::memory_order_relaxed);
+      }
+      worker->stats->tasks_completed.fetch_add(1, std::memory_order_relaxed);
+    }
+    stats_->execution.Add(busy_ns);
+    stats_->tasks_completed.fetch_add(1);
+  }
+
+  std::shared_ptr<TaskStats> stats_;
+  int64_t submit_ns_;
+  Task task_;
+};
+
+}  // namespace
+
+struct ThreadPool::State {
+  explicit State(bool work_stealing)
+      : desired_capacity_(0),
+        please_shutdown_(false),
+        quick_shutdown_(false),
+        work_stealing_(work_stealing),
+        num_idle_workers_(0),
+        collect_stats_(false),
+        stats_(std::make_shared<TaskStats>()) {}
 
   std::mutex mutex_;
   std::condition_variable cv_;
@@ -48,13 +357,40 @@ struct ThreadPool::State {
 
   // Desired number of threads
   int desired_capacity_;
-  // Are we shutting down?
-  bool please_shutdown_;
-  bool quick_shutdown_;
+  // Are we shutting down?  (may be read without the lock by workers
+  // draining their local queue)
+  std::atomic<bool> please_shutdown_;
+  std::atomic<bool> quick_shutdown_;
+
+  // In work-stealing mode, tasks spawned from a worker go to that worker's
+  // local queue, which it drains without locking.  Idle workers steal
+  // from the other workers' queues.
+  const bool work_stealing_;
+  std::vector<std::shared_ptr<WorkStealingQueue>> worker_queues_;
+  // Number of workers waiting for tasks (so that local pushes know whether
+  // they need to wake one up)
+  std::atomic<int> num_idle_workers_;
+
+  // Whether spawned tasks are wrapped for collecting statistics
+  std::atomic<bool> collect_stats_;
+  std::shared_ptr<TaskStats> stats_;
+
+  // Return the state of the current thread, or null if it isn't one of our
+  // workers
+  WorkerState* CurrentWorker() {
+    std::lock_guard<std::mutex> lock(worker_states_mutex_);
+    auto it = worker_states_.find(std::this_thread::get_id());
+    return it != worker_states_.end() ? it->second.get() : nullptr;
+  }
+
+  // Protects worker_states_, separately from mutex_ so that workers can find
+  // their state without contending with the shared queue
+  std::mutex worker_states_mutex_;
+  std::unordered_map<std::thread::id, std::unique_ptr<WorkerState>> worker_states_;
 };
 
-ThreadPool::ThreadPool()
-    : sp_state_(std::make_shared<ThreadPool::State>()),
+ThreadPool::ThreadPool(bool work_stealing)
+    : sp_state_(std::make_shared<ThreadPool::State>(work_stealing)),
       state_(sp_state_.get()),
       shutdown_on_destroy_(true) {
 #ifndef _WIN32
@@ -78,9 +414,9 @@ void ThreadPool::ProtectAgainstFork() {
     // existing ThreadPools.
     int capacity = state_->desired_capacity_;
 
-    auto new_state = std::make_shared<ThreadPool::State>();
-    new_state->please_shutdown_ = state_->please_shutdown_;
-    new_state->quick_shutdown_ = state_->quick_shutdown_;
+    auto new_state = std::make_shared<ThreadPool::State>(state_->work_stealing_);
+    new_state->please_shutdown_ = state_->please_shutdown_.load();
+    new_state->quick_shutdown_ = state_->quick_shutdown_.load();
 
     pid_ = current_pid;
     sp_state_ = new_state;
@@ -135,8 +471,8 @@ Status ThreadPool::Shutdown(bool wait) {
   if (state_->please_shutdown_) {
     return Status::Invalid("Shutdown() already called");
   }
-  state_->please_shutdown_ = true;
   state_->quick_shutdown_ = !wait;
+  state_->please_shutdown_ = true;
   state_->cv_.notify_all();
   state_->cv_shutdown_.wait(lock, [this] { return state_->workers_.empty(); });
   if (!state_->quick_shutdown_) {
@@ -166,6 +502,44 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
   }
 }
 
+namespace {
+
+void RunTask(const Task& task, WorkerState* worker) {
+  ARROW_TRACE_SPAN("thread_pool", "task");
+  // Tasks wrapped for statistics account for the worker running them
+  const StatsTask* stats_task = task.target<StatsTask>();
+  if (ARROW_PREDICT_FALSE(stats_task != nullptr)) {
+    stats_task->Run(worker);
+  } else {
+    task();
+  }
+}
+
+// Take a task from the shared queue or, in work-stealing mode, steal one
+// from another worker.  Must be called with the state lock held.
+template <typename State>
+bool TakeTaskUnlocked(State* state, const WorkStealingQueue* local_queue,
+                      std::function<void()>* out) {
+  if (!state->pending_tasks_.empty()) {
+    *out = std::move(state->pending_tasks_.front());
+    state->pending_tasks_.pop_front();
+    return true;
+  }
+  for (const auto& queue : state->worker_queues_) {
+    if (queue.get() == local_queue) {
+      continue;
+    }
+    std::unique_ptr<Task> task(queue->Steal());
+    if (task) {
+      *out = std::move(*task);
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
 void ThreadPool::WorkerLoop(std::shared_ptr<State> state,
                             std::list<std::thread>::iterator it) {
   std::unique_lock<std::mutex> lock(state->mutex_);
@@ -179,32 +553,103 @@ void ThreadPool::WorkerLoop(std::shared_ptr<State> state,
     return state->workers_.size() > static_cast<size_t>(state->desired_capacity_);
   };
 
+  WorkerState* worker;
+  {
+    std::unique_ptr<WorkerState> worker_state(new WorkerState());
+    worker = worker_state.get();
+    std::lock_guard<std::mutex> states_lock(state->worker_states_mutex_);
+    state->worker_states_[std::this_thread::get_id()] = std::move(worker_state);
+  }
+  std::shared_ptr<WorkStealingQueue> local_queue;
+  if (state->work_stealing_) {
+    local_queue = std::make_shared<WorkStealingQueue>();
+    state->worker_queues_.push_back(local_queue);
+    worker->queue = local_queue;
+  }
+  worker->stats = std::make_shared<WorkerStats>();
+  state->stats_->AddWorker(worker->stats);
+
+  // Run tasks from the local queue until it is exhausted, without locking
+  const auto drain_local_queue = [&]() {
+    if (!local_queue) {
+      return;
+    }
+    while (!state->quick_shutdown_) {
+      std::unique_ptr<Task> task(local_queue->Pop());
+      if (!task) {
+        break;
+      }
+      RunTask(*task, worker);
+    }
+  };
+
   while (true) {
     // By the time this thread is started, some tasks may have been pushed
     // or shutdown could even have been requested.  So we only wait on the
     // condition variable at the end of the loop.
 
     // Execute pending tasks if any
-    while (!state->pending_tasks_.empty() && !state->quick_shutdown_) {
+    std::function<void()> task;
+    bool idle = false;
+    while (!state->quick_shutdown_) {
       // We check this opportunistically at each loop iteration since
       // it releases the lock below.
       if (should_secede()) {
         break;
       }
-      {
-        std::function<void()> task = std::move(state->pending_tasks_.front());
-        state->pending_tasks_.pop_front();
-        lock.unlock();
-        task();
+      if (!TakeTaskUnlocked(state.get(), local_queue.get(), &task)) {
+        if (!state->work_stealing_) {
+          break;
+        }
+        // Announce we're idle, then check again so as not to miss a
+        // concurrent push to a local queue (see SpawnReal)
+        ++state->num_idle_workers_;
+        idle = true;
+        if (!TakeTaskUnlocked(state.get(), local_queue.get(), &task)) {
+          break;
+        }
+        --state->num_idle_workers_;
+        idle = false;
       }
+      lock.unlock();
+      RunTask(task, worker);
+      task = nullptr;
+      // Tasks spawned by the task above are in the local queue
+      drain_local_queue();
       lock.lock();
     }
     // Now either the queue is empty *or* a quick shutdown was requested
     if (state->please_shutdown_ || should_secede()) {
+      if (idle) {
+        --state->num_idle_workers_;
+      }
       break;
     }
     // Wait for next wakeup
     state->cv_.wait(lock);
+    if (idle) {
+      --state->num_idle_workers_;
+    }
+  }
+
+  if (local_queue) {
+    // Hand over remaining local tasks, unless shutting down quickly
+    // (in which case they are dropped by the queue destructor)
+    while (!state->quick_shutdown_) {
+      std::unique_ptr<Task> task(local_queue->Pop());
+      if (!task) {
+        break;
+      }
+      state->pending_tasks_.push_back(std::move(*task));
+      state->cv_.notify_one();
+    }
+    state->worker_queues_.erase(std::find(state->worker_queues_.begin(),
+                                          state->worker_queues_.end(), local_queue));
+  }
+  state->stats_->RemoveWorker(worker->stats);
+  {
+    std::lock_guard<std::mutex> states_lock(state->worker_states_mutex_);
+    state->worker_states_.erase(std::this_thread::get_id());
   }
 
   // We're done.  Move our thread object to the trashcan of finished
@@ -223,7 +668,52 @@ void ThreadPool::WorkerLoop(std::shared_ptr<State> state,
   }
 }
 
+bool ThreadPool::OwnsThisThread() { return state_->CurrentWorker() != nullptr; }
+
+bool ThreadPool::RunPendingTask() {
+  WorkerState* worker = state_->CurrentWorker();
+  if (worker == nullptr) {
+    return false;
+  }
+  WorkStealingQueue* local_queue = worker->queue.get();
+  if (local_queue != nullptr) {
+    std::unique_ptr<Task> task(local_queue->Pop());
+    if (task) {
+      RunTask(*task, worker);
+      return true;
+    }
+  }
+  std::function<void()> task;
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    if (state_->quick_shutdown_ || !TakeTaskUnlocked(state_, local_queue, &task)) {
+      return false;
+    }
+  }
+  RunTask(task, worker);
+  return true;
+}
+
 Status ThreadPool::SpawnReal(std::function<void()> task) {
+  if (ARROW_PREDICT_FALSE(state_->collect_stats_.load(std::memory_order_relaxed))) {
+    task = StatsTask(state_->stats_, std::move(task));
+  }
+  WorkerState* worker = state_->work_stealing_ ? state_->CurrentWorker() : nullptr;
+  if (worker != nullptr) {
+    // Spawned from one of our workers: push to its local queue
+    if (state_->please_shutdown_) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    worker->queue->Push(new Task(std::move(task)));
+    // Pairs with the idle announcement in WorkerLoop: either the idle worker
+    // sees the pushed task, or we see it's idle and wake it up.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (state_->num_idle_workers_.load() > 0) {
+      std::lock_guard<std::mutex> lock(state_->mutex_);
+      state_->cv_.notify_one();
+    }
+    return Status::OK();
+  }
   {
     ProtectAgainstFork();
     std::lock_guard<std::mutex> lock(state_->mutex_);
@@ -237,6 +727,45 @@ Status ThreadPool::SpawnReal(std::function<void()> task) {
   return Status::OK();
 }
 
+void ThreadPool::SetCollectStats(bool collect) {
+  ProtectAgainstFork();
+  if (collect && !state_->collect_stats_.load()) {
+    state_->stats_->Reset();
+  }
+  state_->collect_stats_.store(collect);
+}
+
+ThreadPoolStats ThreadPool::GetStats() {
+  ProtectAgainstFork();
+  TaskStats* stats = state_->stats_.get();
+  ThreadPoolStats out;
+  out.tasks_submitted = stats->tasks_submitted.load();
+  out.tasks_completed = stats->tasks_completed.load();
+  out.queued_tasks =
+      std::max<int64_t>(0, out.tasks_submitted - stats->tasks_started.load());
+  out.max_queued_tasks = stats->max_queued_tasks.load();
+  stats->queue_wait.Snapshot(&out.queue_wait);
+  stats->execution.Snapshot(&out.execution);
+  {
+    std::lock_guard<std::mutex> lock(stats->mutex);
+    out.total_busy_ns = stats->retired_busy_ns;
+    for (const auto& worker : stats->workers) {
+      ThreadPoolStats::Worker worker_out = {worker->busy_ns.load(),
+                                            worker->tasks_completed.load()};
+      out.workers.push_back(worker_out);
+      out.total_busy_ns += worker_out.busy_ns;
+    }
+  }
+  out.elapsed_ns = NowNs() - stats->start_ns.load();
+  out.capacity = GetCapacity();
+  return out;
+}
+
+void ThreadPool::ResetStats() {
+  ProtectAgainstFork();
+  state_->stats_->Reset();
+}
+
 Status ThreadPool::Make(int threads, std::shared_ptr<ThreadPool>* out) {
   auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
   RETURN_NOT_OK(pool->SetCapacity(threads));
@@ -244,6 +773,13 @@ Status ThreadPool::Make(int threads, std::shared_ptr<ThreadPool>* out) {
   return Status::OK();
 }
 
+Status ThreadPool::MakeWorkStealing(int threads, std::shared_ptr<ThreadPool>* out) {
+  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool(true /* work_stealing */));
+  RETURN_NOT_OK(pool->SetCapacity(threads));
+  *out = std::move(pool);
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Global thread pool
 
@@ -283,10 +819,18 @@ int ThreadPool::DefaultCapacity() {
   return capacity;
 }
 
-// Helper for the singleton pattern
+static int DefaultIOThreadPoolCapacity() {
+  // I/O tasks are mostly waiting, so the capacity needn't follow the
+  // number of cores
+  constexpr int kDefaultCapacity = 8;
+  int capacity = ParseOMPEnvVar("ARROW_IO_THREADS");
+  return capacity > 0 ? capacity : kDefaultCapacity;
+}
+
+// Helpers for the singleton pattern
 std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
   std::shared_ptr<ThreadPool> pool;
-  DCHECK_OK(ThreadPool::Make(ThreadPool::DefaultCapacity(), &pool));
+  DCHECK_OK(ThreadPool::MakeWorkStealing(ThreadPool::DefaultCapacity(), &pool));
   // On Windows, the global ThreadPool destructor may be called after
   // non-main threads have been killed by the OS, and hang in a condition
   // variable.
@@ -297,11 +841,25 @@ std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
   return pool;
 }
 
+std::shared_ptr<ThreadPool> ThreadPool::MakeIOThreadPool() {
+  std::shared_ptr<ThreadPool> pool;
+  DCHECK_OK(ThreadPool::Make(DefaultIOThreadPoolCapacity(), &pool));
+#ifdef _WIN32
+  pool->shutdown_on_destroy_ = false;
+#endif
+  return pool;
+}
+
 ThreadPool* GetCpuThreadPool() {
   static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeCpuThreadPool();
   return singleton.get();
 }
 
+ThreadPool* GetIOThreadPool() {
+  static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeIOThreadPool();
+  return singleton.get();
+}
+
 }  // namespace internal
 
 int GetCpuThreadPoolCapacity() { return internal::GetCpuThreadPool()->GetCapacity(); }
@@ -310,4 +868,10 @@ Status SetCpuThreadPoolCapacity(int threads) {
   return internal::GetCpuThreadPool()->SetCapacity(threads);
 }
 
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
 }  // namespace arrow
@@ -32,8 +32,10 @@
 #include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -56,6 +58,25 @@ ARROW_EXPORT int GetCpuThreadPoolCapacity();
 /// The current number is returned by GetCpuThreadPoolCapacity().
 ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 
+/// \brief Get the capacity of the global I/O thread pool
+///
+/// Return the number of worker threads in the thread pool to which
+/// Arrow dispatches various blocking I/O tasks (such as readahead).
+/// This is an ideal number, not necessarily the exact number of threads
+/// at a given point in time.
+///
+/// The default is 8, unless overriden with the ARROW_IO_THREADS environment
+/// variable.  You can change this number using SetIOThreadPoolCapacity().
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+/// \brief Set the capacity of the global I/O thread pool
+///
+/// Set the number of worker threads in the thread pool to which
+/// Arrow dispatches various blocking I/O tasks.
+///
+/// The current number is returned by GetIOThreadPoolCapacity().
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
 namespace internal {
 
 namespace detail {
@@ -75,11 +96,85 @@ struct packaged_task_wrapper {
 
 }  // namespace detail
 
+/// \brief A histogram of durations, in power-of-two nanosecond buckets
+struct ARROW_EXPORT DurationHistogram {
+  static constexpr int kNumBuckets = 48;
+
+  /// counts[0] is the number of zero durations; counts[i] for i > 0 is the
+  /// number of durations d with 2^(i-1) <= d < 2^i nanoseconds, the last
+  /// bucket also counting all longer durations
+  std::vector<int64_t> counts = std::vector<int64_t>(kNumBuckets, 0);
+  int64_t count = 0;
+  int64_t total_ns = 0;
+  int64_t max_ns = 0;
+
+  double mean_ns() const {
+    return count > 0 ? static_cast<double>(total_ns) / static_cast<double>(count) : 0;
+  }
+
+  /// \brief An upper bound of the q-quantile of the durations, q in [0, 1]
+  ///
+  /// The bound is the upper end of the bucket holding the quantile, so it
+  /// overestimates the quantile by a factor of 2 at most.
+  int64_t Quantile(double q) const;
+};
+
+/// \brief Statistics of a thread pool's tasks, collected while enabled with
+/// ThreadPool::SetCollectStats
+///
+/// Only tasks spawned while collection is enabled are accounted for.  The
+/// figures are read without stopping the workers and may be slightly
+/// inconsistent with one another while tasks are running.
+struct ARROW_EXPORT ThreadPoolStats {
+  struct Worker {
+    /// Time spent running tasks, in nanoseconds.  Tasks run from within
+    /// another task by RunPendingTask are part of that task's time.
+    int64_t busy_ns;
+    int64_t tasks_completed;
+  };
+
+  int64_t tasks_submitted = 0;
+  int64_t tasks_completed = 0;
+  /// Number of submitted tasks not started yet
+  int64_t queued_tasks = 0;
+  /// Highest number of submitted tasks not started yet
+  int64_t max_queued_tasks = 0;
+  /// Time between the submission and the start of tasks
+  DurationHistogram queue_wait;
+  /// Running time of tasks, including the tasks each one ran through
+  /// RunPendingTask
+  DurationHistogram execution;
+  /// The current workers, in order of launch
+  std::vector<Worker> workers;
+  /// Time spent running tasks by all workers, including exited ones
+  int64_t total_busy_ns = 0;
+  /// Time since collection was enabled or reset
+  int64_t elapsed_ns = 0;
+  /// The pool's capacity
+  int capacity = 0;
+
+  /// \brief The fraction of the pool's capacity spent running tasks since
+  /// collection was enabled or reset
+  double utilization() const {
+    return elapsed_ns > 0 && capacity > 0
+               ? static_cast<double>(total_busy_ns) /
+                     (static_cast<double>(elapsed_ns) * capacity)
+               : 0;
+  }
+};
+
 class ARROW_EXPORT ThreadPool {
  public:
   // Construct a thread pool with the given number of worker threads
   static Status Make(int threads, std::shared_ptr<ThreadPool>* out);
 
+  // Construct a work-stealing thread pool with the given number of worker threads.
+  // Tasks spawned from a worker thread are pushed to a lock-free queue local
+  // to that worker, which runs them in LIFO order; idle workers steal tasks
+  // from other workers' queues.  Tasks spawned from other threads go to a
+  // shared FIFO queue, as with a regular pool.
+  static Status MakeWorkStealing(int threads, std::shared_ptr<ThreadPool>* out);
+
   // Destroy thread pool; the pool will first be shut down
   ~ThreadPool();
 
@@ -110,6 +205,26 @@ class ARROW_EXPORT ThreadPool {
     return SpawnReal(std::forward<Function>(func));
   }
 
+  // Enable or disable collecting task statistics.  Enabling resets them.
+  // Collection costs two clock reads and a few atomic updates per task;
+  // while disabled, it costs a relaxed atomic load per spawned task.
+  void SetCollectStats(bool collect);
+
+  // Return the task statistics collected so far.
+  ThreadPoolStats GetStats();
+
+  // Reset the task statistics.
+  void ResetStats();
+
+  // Whether the current thread is one of this pool's workers.
+  bool OwnsThisThread();
+
+  // If called from one of this pool's workers, run one pending task (if any)
+  // in the current thread and return true.  Otherwise, return false.
+  // This allows a worker waiting for other tasks to help executing them
+  // rather than blocking, which would risk deadlocking the pool.
+  bool RunPendingTask();
+
   // Submit a callable and arguments for execution.  Return a future that
   // will return the callable's result value once.
   // The callable's arguments are copied before execution.
@@ -134,14 +249,38 @@ class ARROW_EXPORT ThreadPool {
     return fut;
   }
 
+  // Submit a `Status(T* out)` callable for execution.  Return a Future
+  // that will finish with the output value or the error Status once the
+  // callable has run.  Contrary to Submit(), failing to spawn the task
+  // (e.g. after Shutdown()) is reported through the Future.
+  template <typename T, typename Function>
+  Future<T> SubmitAsync(Function&& func) {
+    auto fut = Future<T>::Make();
+    auto task = std::forward<Function>(func);
+    Status st = SpawnReal([fut, task]() mutable {
+      T value;
+      Status st = task(&value);
+      if (st.ok()) {
+        fut.MarkFinished(std::move(value));
+      } else {
+        fut.MarkFailed(std::move(st));
+      }
+    });
+    if (!st.ok()) {
+      fut.MarkFailed(std::move(st));
+    }
+    return fut;
+  }
+
  protected:
   FRIEND_TEST(TestThreadPool, SetCapacity);
   FRIEND_TEST(TestGlobalThreadPool, Capacity);
   friend ARROW_EXPORT ThreadPool* GetCpuThreadPool();
+  friend ARROW_EXPORT ThreadPool* GetIOThreadPool();
 
   struct State;
 
-  ThreadPool();
+  explicit ThreadPool(bool work_stealing = false);
 
   ARROW_DISALLOW_COPY_AND_ASSIGN(ThreadPool);
 
@@ -161,6 +300,7 @@ class ARROW_EXPORT ThreadPool {
                          std::list<std::thread>::iterator it);
 
   static std::shared_ptr<ThreadPool> MakeCpuThreadPool();
+  static std::shared_ptr<ThreadPool> MakeIOThreadPool();
 
   std::shared_ptr<State> sp_state_;
   State* state_;
@@ -171,8 +311,16 @@ class ARROW_EXPORT ThreadPool {
 };
 
 // Return the process-global thread pool for CPU-bound tasks.
+// This is a work-stealing pool, so that tasks spawning other tasks
+// (e.g. nested parallel loops) don't contend on a shared queue.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
+// Return the process-global thread pool for blocking I/O tasks.
+// It is sized independently from the CPU thread pool, so that tasks waiting
+// on slow storage (e.g. network filesystems) don't hold up CPU cores.
+// CPU-bound work should not be run on this pool.
+ARROW_EXPORT ThreadPool* GetIOThreadPool();
+
 }  // namespace internal
 }  // namespace arrow
 
@@ -0,0 +1,168 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstring>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread-pool.h"
+#include "arrow/util/tracing.h"
+
+namespace arrow {
+namespace util {
+
+class TestTracer : public ::testing::Test {
+ public:
+  void TearDown() override {
+    Tracer::Disable();
+    Tracer::Clear();
+  }
+};
+
+TEST_F(TestTracer, Disabled) {
+  ASSERT_FALSE(Tracer::IsEnabled());
+  { ARROW_TRACE_SPAN("test", "ignored"); }
+  ASSERT_EQ(0, Tracer::GetEvents().size());
+}
+
+TEST_F(TestTracer, Spans) {
+  ASSERT_OK(Tracer::Enable());
+  ASSERT_TRUE(Tracer::IsEnabled());
+  {
+    ARROW_TRACE_SPAN("test", "outer");
+    { ARROW_TRACE_SPAN("test", "inner"); }
+  }
+  Tracer::Disable();
+  { ARROW_TRACE_SPAN("test", "ignored"); }
+
+  auto events = Tracer::GetEvents();
+  ASSERT_EQ(2, events.size());
+  // Spans are recorded when they end
+  ASSERT_STREQ("inner", events[0].name);
+  ASSERT_STREQ("outer", events[1].name);
+  ASSERT_STREQ("test", events[1].category);
+  ASSERT_LE(events[1].start_ns, events[0].start_ns);
+  ASSERT_GE(events[1].start_ns + events[1].duration_ns,
+            events[0].start_ns + events[0].duration_ns);
+  ASSERT_EQ(Tracer::CurrentThreadId(), events[0].thread_id);
+
+  // Re-enabling discards previous spans
+  ASSERT_OK(Tracer::Enable());
+  ASSERT_EQ(0, Tracer::GetEvents().size());
+}
+
+TEST_F(TestTracer, RingBuffer) {
+  ASSERT_OK(Tracer::Enable(3));
+  const char* names[] = {"a", "b", "c", "d", "e"};
+  for (const char* name : names) {
+    TraceEvent event = {"test", name, 0, 1, 1};
+    Tracer::Record(event);
+  }
+  auto events = Tracer::GetEvents();
+  ASSERT_EQ(3, events.size());
+  ASSERT_STREQ("c", events[0].name);
+  ASSERT_STREQ("d", events[1].name);
+  ASSERT_STREQ("e", events[2].name);
+
+  Tracer::Clear();
+  ASSERT_EQ(0, Tracer::GetEvents().size());
+
+  ASSERT_RAISES(Invalid, Tracer::Enable(0));
+}
+
+TEST_F(TestTracer, Threads) {
+  ASSERT_OK(Tracer::Enable());
+  const int kNumThreads = 4;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([] {
+      for (int j = 0; j < 100; ++j) {
+        ARROW_TRACE_SPAN("test", "work");
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  auto events = Tracer::GetEvents();
+  ASSERT_EQ(kNumThreads * 100, events.size());
+  std::set<int> thread_ids;
+  for (const auto& event : events) {
+    thread_ids.insert(event.thread_id);
+  }
+  ASSERT_EQ(kNumThreads, thread_ids.size());
+  ASSERT_EQ(0, thread_ids.count(Tracer::CurrentThreadId()));
+}
+
+TEST_F(TestTracer, ThreadPoolTasks) {
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(2, &pool));
+  ASSERT_OK(Tracer::Enable());
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(pool->Spawn([] {}));
+  }
+  ASSERT_OK(pool->Shutdown());
+  auto events = Tracer::GetEvents();
+  ASSERT_EQ(10, events.size());
+  for (const auto& event : events) {
+    ASSERT_STREQ("thread_pool", event.category);
+    ASSERT_STREQ("task", event.name);
+  }
+}
+
+TEST_F(TestTracer, ThreadPoolPendingTasks) {
+  // Tasks run by a worker while waiting in another task are traced too
+  std::shared_ptr<internal::ThreadPool> pool;
+  ASSERT_OK(internal::ThreadPool::Make(1, &pool));
+  ASSERT_OK(Tracer::Enable());
+  auto raw_pool = pool.get();
+  auto fut = pool->Submit([raw_pool] {
+    return raw_pool->Spawn([] {}).ok() && raw_pool->RunPendingTask();
+  });
+  ASSERT_TRUE(fut.get());
+  ASSERT_OK(pool->Shutdown());
+  auto events = Tracer::GetEvents();
+  ASSERT_EQ(2, events.size());
+  for (const auto& event : events) {
+    ASSERT_STREQ("task", event.name);
+  }
+}
+
+TEST_F(TestTracer, ChromeTrace) {
+  ASSERT_OK(Tracer::Enable());
+  ASSERT_EQ("{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\"}\n",
+            Tracer::ToChromeTrace());
+
+  TraceEvent event = {"cat", "quote\"d", 1234567, 8000, 3};
+  Tracer::Record(event);
+  ASSERT_EQ(
+      "{\"traceEvents\":[\n"
+      "{\"name\":\"quote\\\"d\",\"cat\":\"cat\",\"ph\":\"X\",\"ts\":1234.567,"
+      "\"dur\":8.000,\"pid\":1,\"tid\":3}\n"
+      "],\"displayTimeUnit\":\"ns\"}\n",
+      Tracer::ToChromeTrace());
+}
+
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,192 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/tracing.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <unordered_map>
+
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace util {
+
+constexpr int64_t Tracer::kDefaultCapacity;
+
+std::atomic<bool> Tracer::enabled_(false);
+
+namespace {
+
+// The ring buffer of recorded spans
+struct TraceBuffer {
+  std::mutex mutex;
+  std::vector<TraceEvent> events;
+  // Total number of spans recorded since the last reset; the next span
+  // goes to events[num_recorded % events.size()]
+  int64_t num_recorded = 0;
+};
+
+TraceBuffer* GetTraceBuffer() {
+  static TraceBuffer buffer;
+  return &buffer;
+}
+
+std::chrono::steady_clock::time_point TraceEpoch() {
+  static const auto epoch = std::chrono::steady_clock::now();
+  return epoch;
+}
+
+// The trace identifiers of the threads, numbered in order of first use
+struct TraceThreadIds {
+  std::mutex mutex;
+  std::unordered_map<std::thread::id, int> ids;
+};
+
+TraceThreadIds* GetTraceThreadIds() {
+  static TraceThreadIds thread_ids;
+  return &thread_ids;
+}
+
+void WriteJSONString(const char* s, std::ostream* out) {
+  *out << '"';
+  for (; *s != '\0'; ++s) {
+    const char c = *s;
+    if (c == '"' || c == '\\') {
+      *out << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char escaped[8];
+      snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+      *out << escaped;
+    } else {
+      *out << c;
+    }
+  }
+  *out << '"';
+}
+
+// Chrome trace timestamps are in (fractional) microseconds
+void WriteMicros(int64_t ns, std::ostream* out) {
+  *out << ns / 1000 << '.';
+  const int64_t frac = ns % 1000;
+  *out << static_cast<char>('0' + frac / 100) << static_cast<char>('0' + frac / 10 % 10)
+       << static_cast<char>('0' + frac % 10);
+}
+
+}  // namespace
+
+Status Tracer::Enable(int64_t capacity) {
+  if (capacity <= 0) {
+    return Status::Invalid("Trace buffer capacity must be positive, got ", capacity);
+  }
+  TraceBuffer* buffer = GetTraceBuffer();
+  {
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+    buffer->events.assign(static_cast<size_t>(capacity), TraceEvent());
+    buffer->num_recorded = 0;
+  }
+  // Fix the epoch before the first span starts
+  TraceEpoch();
+  enabled_.store(true);
+  return Status::OK();
+}
+
+void Tracer::Disable() { enabled_.store(false); }
+
+void Tracer::Record(const TraceEvent& event) {
+  TraceBuffer* buffer = GetTraceBuffer();
+  std::lock_guard<std::mutex> lock(buffer->mutex);
+  if (buffer->events.empty()) {
+    return;
+  }
+  const int64_t capacity = static_cast<int64_t>(buffer->events.size());
+  buffer->events[buffer->num_recorded % capacity] = event;
+  ++buffer->num_recorded;
+}
+
+std::vector<TraceEvent> Tracer::GetEvents() {
+  TraceBuffer* buffer = GetTraceBuffer();
+  std::lock_guard<std::mutex> lock(buffer->mutex);
+  std::vector<TraceEvent> events;
+  const int64_t capacity = static_cast<int64_t>(buffer->events.size());
+  const int64_t first = std::max<int64_t>(0, buffer->num_recorded - capacity);
+  for (int64_t i = first; i < buffer->num_recorded; ++i) {
+    events.push_back(buffer->events[i % capacity]);
+  }
+  return events;
+}
+
+void Tracer::Clear() {
+  TraceBuffer* buffer = GetTraceBuffer();
+  std::lock_guard<std::mutex> lock(buffer->mutex);
+  buffer->num_recorded = 0;
+}
+
+Status Tracer::WriteChromeTrace(std::ostream* out) {
+  *out << "{\"traceEvents\":[";
+  bool first = true;
+  for (const TraceEvent& event : GetEvents()) {
+    *out << (first ? "\n" : ",\n") << "{\"name\":";
+    WriteJSONString(event.name, out);
+    *out << ",\"cat\":";
+    WriteJSONString(event.category, out);
+    *out << ",\"ph\":\"X\",\"ts\":";
+    WriteMicros(event.start_ns, out);
+    *out << ",\"dur\":";
+    WriteMicros(event.duration_ns, out);
+    *out << ",\"pid\":1,\"tid\":" << event.thread_id << "}";
+    first = false;
+  }
+  *out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+  if (!*out) {
+    return Status::IOError("Failed to write trace");
+  }
+  return Status::OK();
+}
+
+std::string Tracer::ToChromeTrace() {
+  std::stringstream ss;
+  DCHECK_OK(WriteChromeTrace(&ss));
+  return ss.str();
+}
+
+int64_t Tracer::Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now() - TraceEpoch())
+      .count();
+}
+
+int Tracer::CurrentThreadId() {
+  TraceThreadIds* thread_ids = GetTraceThreadIds();
+  std::lock_guard<std::mutex> lock(thread_ids->mutex);
+  auto it = thread_ids->ids.emplace(std::this_thread::get_id(),
+                                    static_cast<int>(thread_ids->ids.size()) + 1);
+  return it.first->second;
+}
+
+void TraceSpan::End() {
+  const int64_t end_ns = Tracer::Now();
+  Tracer::Record(
+      {category_, name_, start_ns_, end_ns - start_ns_, Tracer::CurrentThreadId()});
+}
+
+}  // namespace util
+}  // namespace arrow
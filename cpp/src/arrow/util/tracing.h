@@ -0,0 +1,135 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef ARROW_UTIL_TRACING_H
+#define ARROW_UTIL_TRACING_H
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace util {
+
+/// \brief A completed span of work
+struct ARROW_EXPORT TraceEvent {
+  /// The span's category, e.g. "csv" or "parquet"; a string literal
+  const char* category;
+  /// The span's name; a string literal
+  const char* name;
+  /// Start time, in nanoseconds since an arbitrary process-wide epoch
+  int64_t start_ns;
+  /// Duration in nanoseconds
+  int64_t duration_ns;
+  /// Small integer identifying the recording thread, numbered from 1 in
+  /// order of first use
+  int thread_id;
+};
+
+/// \brief Process-wide recorder of trace spans
+///
+/// Tracing is disabled by default, in which case a span costs a single
+/// relaxed atomic load.  Once enabled, completed spans are kept in a ring
+/// buffer of fixed capacity, the oldest spans being overwritten first.
+/// Spans are meant to cover coarse units of work such as a block, a batch
+/// or a thread pool task.
+class ARROW_EXPORT Tracer {
+ public:
+  static constexpr int64_t kDefaultCapacity = 1 << 16;
+
+  /// \brief Start recording spans, discarding any previously recorded ones
+  ///
+  /// \param[in] capacity the maximum number of spans kept, positive
+  static Status Enable(int64_t capacity = kDefaultCapacity);
+
+  /// \brief Stop recording spans; recorded spans are kept
+  static void Disable();
+
+  /// \brief Whether spans are currently recorded
+  static bool IsEnabled() { return enabled_.load(std::memory_order_relaxed); }
+
+  /// \brief Record a completed span
+  static void Record(const TraceEvent& event);
+
+  /// \brief Return the recorded spans, oldest first
+  static std::vector<TraceEvent> GetEvents();
+
+  /// \brief Discard the recorded spans
+  static void Clear();
+
+  /// \brief Write the recorded spans in the Chrome trace event format
+  ///
+  /// The output can be loaded in chrome://tracing or https://ui.perfetto.dev.
+  static Status WriteChromeTrace(std::ostream* out);
+
+  /// \brief Return the recorded spans in the Chrome trace event format
+  static std::string ToChromeTrace();
+
+  /// \brief Current time on the tracing clock, in nanoseconds
+  static int64_t Now();
+
+  /// \brief The identifier of the calling thread in trace events
+  static int CurrentThreadId();
+
+ private:
+  static std::atomic<bool> enabled_;
+};
+
+/// \brief A span recorded when it goes out of scope
+///
+/// Nothing is recorded if tracing was disabled when the span started.
+class ARROW_EXPORT TraceSpan {
+ public:
+  TraceSpan(const char* category, const char* name)
+      : category_(category),
+        name_(name),
+        start_ns_(ARROW_PREDICT_FALSE(Tracer::IsEnabled()) ? Tracer::Now() : -1) {}
+
+  ~TraceSpan() {
+    if (ARROW_PREDICT_FALSE(start_ns_ >= 0)) {
+      End();
+    }
+  }
+
+ private:
+  void End();
+
+  const char* category_;
+  const char* name_;
+  int64_t start_ns_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(TraceSpan);
+};
+
+}  // namespace util
+}  // namespace arrow
+
+#define ARROW_TRACE_SPAN_NAME(line) ARROW_CONCAT(arrow_trace_span_, line)
+
+/// \brief Trace the rest of the enclosing scope as a span
+///
+/// `category` and `name` must be string literals.
+#define ARROW_TRACE_SPAN(category, name) \
+  ::arrow::util::TraceSpan ARROW_TRACE_SPAN_NAME(__LINE__)(category, name)
+
+#endif  // ARROW_UTIL_TRACING_H
@@ -50,6 +50,7 @@ static std::string MakeLargeString(const std::string& base, int64_t nbytes) {
   return s;
 }
 
+template <bool (*Validate)(const uint8_t*, int64_t) = ValidateUTF8>
 static void BenchmarkUTF8Validation(
     benchmark::State& state,  // NOLINT non-const reference
     const std::string& s, bool expected) {
@@ -57,19 +58,54 @@ static void BenchmarkUTF8Validation(
   auto data_size = static_cast<int64_t>(s.size());
 
   InitializeUTF8();
-  bool b = ValidateUTF8(data, data_size);
+  bool b = Validate(data, data_size);
   if (b != expected) {
     std::cerr << "Unexpected validation result" << std::endl;
     std::abort();
   }
 
   while (state.KeepRunning()) {
-    bool b = ValidateUTF8(data, data_size);
+    bool b = Validate(data, data_size);
     benchmark::DoNotOptimize(b);
   }
   state.SetBytesProcessed(state.iterations() * s.size());
 }
 
+// Validate strings of `string_size` bytes cut from a large string, one by one
+// or all at once
+static void BenchmarkUTF8StringsValidation(
+    benchmark::State& state,  // NOLINT non-const reference
+    const std::string& base, int32_t string_size, bool all_at_once) {
+  auto s = MakeLargeString(base, 100000);
+  auto data = reinterpret_cast<const uint8_t*>(s.data());
+  // Cut at character boundaries
+  std::vector<int32_t> offsets = {0};
+  for (int32_t i = 1; i < static_cast<int32_t>(s.size()); ++i) {
+    if (i - offsets.back() >= string_size && (data[i] & 0xc0) != 0x80) {
+      offsets.push_back(i);
+    }
+  }
+  offsets.push_back(static_cast<int32_t>(s.size()));
+  const auto length = static_cast<int64_t>(offsets.size() - 1);
+
+  InitializeUTF8();
+  while (state.KeepRunning()) {
+    bool b = true;
+    if (all_at_once) {
+      b = ValidateUTF8Strings(data, offsets.data(), length);
+    } else {
+      for (int64_t i = 0; i < length; ++i) {
+        b &= ValidateUTF8(data + offsets[i], offsets[i + 1] - offsets[i]);
+      }
+    }
+    if (!b) {
+      std::cerr << "Unexpected validation result" << std::endl;
+      std::abort();
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * s.size());
+}
+
 static void BM_ValidateTinyAscii(benchmark::State& state) {  // NOLINT non-const reference
   BenchmarkUTF8Validation(state, tiny_valid_ascii, true);
 }
@@ -112,6 +148,36 @@ static void BM_ValidateLargeNonAscii(
   BenchmarkUTF8Validation(state, s, true);
 }
 
+// The same without the vectorized validator
+
+static void BM_ValidateLargeAsciiInline(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_ascii, 100000);
+  BenchmarkUTF8Validation<internal::ValidateUTF8Inline>(state, s, true);
+}
+
+static void BM_ValidateLargeAlmostAsciiInline(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_almost_ascii, 100000);
+  BenchmarkUTF8Validation<internal::ValidateUTF8Inline>(state, s, true);
+}
+
+static void BM_ValidateLargeNonAsciiInline(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto s = MakeLargeString(valid_non_ascii, 100000);
+  BenchmarkUTF8Validation<internal::ValidateUTF8Inline>(state, s, true);
+}
+
+static void BM_ValidateShortStringsOneByOne(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUTF8StringsValidation(state, valid_almost_ascii, 10, false);
+}
+
+static void BM_ValidateShortStringsAtOnce(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkUTF8StringsValidation(state, valid_almost_ascii, 10, true);
+}
+
 static const int kRepetitions = 1;
 
 BENCHMARK(BM_ValidateTinyAscii)->Repetitions(kRepetitions);
@@ -122,6 +188,11 @@ BENCHMARK(BM_ValidateSmallNonAscii)->Repetitions(kRepetitions);
 BENCHMARK(BM_ValidateLargeAscii)->Repetitions(kRepetitions);
 BENCHMARK(BM_ValidateLargeAlmostAscii)->Repetitions(kRepetitions);
 BENCHMARK(BM_ValidateLargeNonAscii)->Repetitions(kRepetitions);
+BENCHMARK(BM_ValidateLargeAsciiInline)->Repetitions(kRepetitions);
+BENCHMARK(BM_ValidateLargeAlmostAsciiInline)->Repetitions(kRepetitions);
+BENCHMARK(BM_ValidateLargeNonAsciiInline)->Repetitions(kRepetitions);
+BENCHMARK(BM_ValidateShortStringsOneByOne)->Repetitions(kRepetitions);
+BENCHMARK(BM_ValidateShortStringsAtOnce)->Repetitions(kRepetitions);
 
 }  // namespace util
 }  // namespace arrow
@@ -21,6 +21,7 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/util/cpu-info.h"
 #include "arrow/util/string.h"
 #include "arrow/util/utf8.h"
 
@@ -249,5 +250,78 @@ TEST_F(UTF8ValidationTest, RandomTruncated) {
   }
 }
 
+TEST_F(UTF8ValidationTest, SimdMatchesInline) {
+  // Valid sequences with the odd random byte, of all sizes around the block sizes
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<size_t> valid_dist(0, all_valid_sequences.size() - 1);
+  std::uniform_int_distribution<int> byte_dist(0, 255);
+  std::uniform_int_distribution<int> corrupt_dist(0, 199);
+
+  auto cpu_info = ::arrow::internal::CpuInfo::GetInstance();
+  const bool has_avx2 = cpu_info->CanUseAVX2();
+  for (int i = 0; i < 2000; ++i) {
+    std::string s;
+    const size_t size = static_cast<size_t>(i % 200);
+    while (s.size() < size) {
+      if (corrupt_dist(gen) == 0) {
+        s += static_cast<char>(byte_dist(gen));
+      } else {
+        s += all_valid_sequences[valid_dist(gen)];
+      }
+    }
+    const auto data = reinterpret_cast<const uint8_t*>(s.data());
+    const int64_t length = static_cast<int64_t>(s.size());
+    const bool expected = internal::ValidateUTF8Inline(data, length);
+    ASSERT_EQ(expected, internal::ValidateUTF8Simd(data, length)) << HexEncode(s);
+    if (has_avx2) {
+      cpu_info->EnableFeature(::arrow::internal::CpuInfo::AVX2, false);
+      const bool actual = internal::ValidateUTF8Simd(data, length);
+      cpu_info->EnableFeature(::arrow::internal::CpuInfo::AVX2, true);
+      ASSERT_EQ(expected, actual) << HexEncode(s);
+    }
+  }
+}
+
+TEST_F(UTF8ValidationTest, Strings) {
+  auto check = [](const std::vector<std::string>& strings, const uint8_t* null_bitmap,
+                  bool expected) {
+    std::string data;
+    std::vector<int32_t> offsets = {0};
+    for (const auto& s : strings) {
+      data += s;
+      offsets.push_back(static_cast<int32_t>(data.size()));
+    }
+    ASSERT_EQ(expected, ValidateUTF8Strings(reinterpret_cast<const uint8_t*>(data.data()),
+                                            offsets.data(),
+                                            static_cast<int64_t>(strings.size()),
+                                            null_bitmap));
+  };
+  check({}, nullptr, true);
+  check({"", "ab", "\xc3\xa9", ""}, nullptr, true);
+  check({"ab", "\xff", "cd"}, nullptr, false);
+  // Each string is invalid, the concatenation is valid
+  check({"a\xc3", "\xa9" "b"}, nullptr, false);
+  check({"\xe8\x9d", "\xa5"}, nullptr, false);
+  // Invalid data under a null
+  const uint8_t null_bitmap[] = {0x5};
+  check({"ab", "\xff", "\xc3\xa9"}, null_bitmap, true);
+  check({"ab", "\xc3", "\xa9"}, null_bitmap, false);
+}
+
+bool IsAscii(const std::string& s) {
+  return ValidateAscii(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+}
+
+TEST(ValidateAscii, Basics) {
+  ASSERT_TRUE(IsAscii(""));
+  ASSERT_TRUE(IsAscii("a"));
+  ASSERT_TRUE(IsAscii("abcdefgh"));
+  ASSERT_TRUE(IsAscii("abcdefghijklmnopq\x7f"));
+  ASSERT_FALSE(IsAscii("\xc3\xa9"));
+  // Non-ASCII in a full word, and in the tail
+  ASSERT_FALSE(IsAscii("abc\xc3\xa9" "defghij"));
+  ASSERT_FALSE(IsAscii("abcdefgh\xc3\xa9"));
+}
+
 }  // namespace util
 }  // namespace arrow
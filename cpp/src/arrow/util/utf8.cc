@@ -15,9 +15,13 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstring>
 #include <mutex>
 
+#include "arrow/util/bit-util.h"
+#include "arrow/util/cpu-info.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/sse-util.h"
 #include "arrow/util/utf8.h"
 
 namespace arrow {
@@ -71,6 +75,280 @@ ARROW_EXPORT void CheckUTF8Initialized() {
 }
 #endif
 
+// ----------------------------------------------------------------------
+// Vectorized validation
+//
+// This is the "lookup" algorithm from John Keiser and Daniel Lemire,
+// "Validating UTF-8 In Less Than One Instruction Per Byte" (2020), as
+// implemented in simdjson.  Each byte is checked together with the one
+// before it using three 16-entry table lookups (on the high nibble of the
+// previous byte, its low nibble and the high nibble of the current byte),
+// whose AND is non-zero for any invalid pair.  The remaining errors, missing
+// or extra continuation bytes of 3- and 4-byte sequences, are found by
+// comparing where continuations are expected with what the lookups saw.
+
+#if defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_RUNTIME_AVX2)
+
+// Error bits, each telling what is wrong with a pair of bytes
+static constexpr uint8_t kTooShort = 1 << 0;    // 11______ 0_______
+                                                // 11______ 11______
+static constexpr uint8_t kTooLong = 1 << 1;     // 0_______ 10______
+static constexpr uint8_t kOverlong3 = 1 << 2;   // 11100000 100_____
+static constexpr uint8_t kTooLarge = 1 << 3;    // 11110100 1001____
+                                                // 11110100 101_____
+                                                // 11110101 1001____
+                                                // 11110101 101_____
+                                                // 1111011_ 1001____
+                                                // 1111011_ 101_____
+                                                // 11111___ 1001____
+                                                // 11111___ 101_____
+static constexpr uint8_t kSurrogate = 1 << 4;   // 11101101 101_____
+static constexpr uint8_t kOverlong2 = 1 << 5;   // 1100000_ 10______
+static constexpr uint8_t kTooLarge1000 = 1 << 6;  // 11110101 1000____
+                                                  // 1111011_ 1000____
+                                                  // 11111___ 1000____
+static constexpr uint8_t kOverlong4 = 1 << 6;   // 11110000 1000____
+static constexpr uint8_t kTwoConts = 1 << 7;    // 10______ 10______
+
+// The errors that don't depend on the low nibble of the first byte
+static constexpr uint8_t kCarry = kTooShort | kTooLong | kTwoConts;
+
+// clang-format off
+static const uint8_t kByte1HighTable[16] = {
+  // 0_______ ________ <ASCII in byte 1>
+  kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong, kTooLong,
+  // 10______ ________ <continuation in byte 1>
+  kTwoConts, kTwoConts, kTwoConts, kTwoConts,
+  // 1100____ ________ <two byte lead in byte 1>
+  kTooShort | kOverlong2,
+  // 1101____ ________ <two byte lead in byte 1>
+  kTooShort,
+  // 1110____ ________ <three byte lead in byte 1>
+  kTooShort | kOverlong3 | kSurrogate,
+  // 1111____ ________ <four+ byte lead in byte 1>
+  kTooShort | kTooLarge | kTooLarge1000 | kOverlong4
+};
+
+static const uint8_t kByte1LowTable[16] = {
+  // ____0000 ________
+  kCarry | kOverlong3 | kOverlong2 | kOverlong4,
+  // ____0001 ________
+  kCarry | kOverlong2,
+  // ____001_ ________
+  kCarry, kCarry,
+  // ____0100 ________
+  kCarry | kTooLarge,
+  // ____0101 ________
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____011_ ________
+  kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+  // ____1___ ________
+  kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000,
+  kCarry | kTooLarge | kTooLarge1000,
+  // ____1101 ________
+  kCarry | kTooLarge | kTooLarge1000 | kSurrogate,
+  kCarry | kTooLarge | kTooLarge1000, kCarry | kTooLarge | kTooLarge1000
+};
+
+static const uint8_t kByte2HighTable[16] = {
+  // ________ 0_______ <ASCII in byte 2>
+  kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort, kTooShort,
+  // ________ 1000____
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge1000 | kOverlong4,
+  // ________ 1001____
+  kTooLong | kOverlong2 | kTwoConts | kOverlong3 | kTooLarge,
+  // ________ 101_____
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  kTooLong | kOverlong2 | kTwoConts | kSurrogate | kTooLarge,
+  // ________ 11______
+  kTooShort, kTooShort, kTooShort, kTooShort
+};
+
+// A block ends with an incomplete sequence if any of its last three bytes
+// exceeds the corresponding entry: 1111____ 111_____ 11______
+static const uint8_t kIncompleteMax[32] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1
+};
+// clang-format on
+
+#endif
+
+#ifdef ARROW_HAVE_SSE4_2
+
+static inline __m128i LoadTable16(const uint8_t* table) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(table));
+}
+
+// Validate 16-byte blocks with SSE4.2.  As the last partial block is padded
+// with zeros, an incomplete sequence at the end is an error like any other.
+class UTF8ValidatorSse42 {
+ public:
+  UTF8ValidatorSse42()
+      : byte_1_high_table_(LoadTable16(kByte1HighTable)),
+        byte_1_low_table_(LoadTable16(kByte1LowTable)),
+        byte_2_high_table_(LoadTable16(kByte2HighTable)),
+        incomplete_max_(LoadTable16(kIncompleteMax + 16)),
+        error_(_mm_setzero_si128()),
+        prev_input_(_mm_setzero_si128()),
+        prev_incomplete_(_mm_setzero_si128()) {}
+
+  void CheckBlock(__m128i input) {
+    if (_mm_movemask_epi8(input) == 0) {
+      // Pure ASCII: only an incomplete sequence before is an error
+      error_ = _mm_or_si128(error_, prev_incomplete_);
+      prev_incomplete_ = _mm_setzero_si128();
+    } else {
+      const __m128i low_nibble = _mm_set1_epi8(0x0f);
+      const __m128i prev1 = _mm_alignr_epi8(input, prev_input_, 15);
+      const __m128i byte_1_high = _mm_shuffle_epi8(
+          byte_1_high_table_, _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble));
+      const __m128i byte_1_low =
+          _mm_shuffle_epi8(byte_1_low_table_, _mm_and_si128(prev1, low_nibble));
+      const __m128i byte_2_high = _mm_shuffle_epi8(
+          byte_2_high_table_, _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble));
+      const __m128i special_cases =
+          _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+      // The 2nd and 3rd bytes after a 3- or 4-byte lead must be continuations
+      const __m128i prev2 = _mm_alignr_epi8(input, prev_input_, 14);
+      const __m128i prev3 = _mm_alignr_epi8(input, prev_input_, 13);
+      const __m128i is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(0xe0u - 0x80));
+      const __m128i is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(0xf0u - 0x80));
+      const __m128i must_be_23_continuation = _mm_and_si128(
+          _mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(0x80u));
+      error_ =
+          _mm_or_si128(error_, _mm_xor_si128(must_be_23_continuation, special_cases));
+
+      prev_incomplete_ = _mm_subs_epu8(input, incomplete_max_);
+    }
+    prev_input_ = input;
+  }
+
+  bool ok() const { return _mm_testz_si128(error_, error_); }
+
+ private:
+  const __m128i byte_1_high_table_;
+  const __m128i byte_1_low_table_;
+  const __m128i byte_2_high_table_;
+  const __m128i incomplete_max_;
+  __m128i error_;
+  __m128i prev_input_;
+  __m128i prev_incomplete_;
+};
+
+static bool ValidateUTF8Sse42(const uint8_t* data, int64_t size) {
+  UTF8ValidatorSse42 validator;
+  for (; size >= 16; data += 16, size -= 16) {
+    validator.CheckBlock(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+  }
+  uint8_t tail[16] = {0};
+  memcpy(tail, data, size);
+  validator.CheckBlock(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tail)));
+  return validator.ok();
+}
+
+#endif  // ARROW_HAVE_SSE4_2
+
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+
+ARROW_TARGET_AVX2 static inline __m256i LoadTable32(const uint8_t* table) {
+  return _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+}
+
+// The bytes of input shifted right by N bytes, with the last N bytes of
+// prev_input shifted in
+template <int N>
+ARROW_TARGET_AVX2 static inline __m256i Prev(__m256i input, __m256i prev_input) {
+  return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev_input, input, 0x21),
+                            16 - N);
+}
+
+// Same as ValidateUTF8Sse42, with 32-byte blocks
+class UTF8ValidatorAvx2 {
+ public:
+  ARROW_TARGET_AVX2 UTF8ValidatorAvx2()
+      : byte_1_high_table_(LoadTable32(kByte1HighTable)),
+        byte_1_low_table_(LoadTable32(kByte1LowTable)),
+        byte_2_high_table_(LoadTable32(kByte2HighTable)),
+        incomplete_max_(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(kIncompleteMax))),
+        error_(_mm256_setzero_si256()),
+        prev_input_(_mm256_setzero_si256()),
+        prev_incomplete_(_mm256_setzero_si256()) {}
+
+  ARROW_TARGET_AVX2 void CheckBlock(__m256i input) {
+    if (_mm256_movemask_epi8(input) == 0) {
+      error_ = _mm256_or_si256(error_, prev_incomplete_);
+      prev_incomplete_ = _mm256_setzero_si256();
+    } else {
+      const __m256i low_nibble = _mm256_set1_epi8(0x0f);
+      const __m256i prev1 = Prev<1>(input, prev_input_);
+      const __m256i byte_1_high = _mm256_shuffle_epi8(
+          byte_1_high_table_, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble));
+      const __m256i byte_1_low =
+          _mm256_shuffle_epi8(byte_1_low_table_, _mm256_and_si256(prev1, low_nibble));
+      const __m256i byte_2_high = _mm256_shuffle_epi8(
+          byte_2_high_table_, _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble));
+      const __m256i special_cases =
+          _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+      const __m256i is_third_byte =
+          _mm256_subs_epu8(Prev<2>(input, prev_input_), _mm256_set1_epi8(0xe0u - 0x80));
+      const __m256i is_fourth_byte =
+          _mm256_subs_epu8(Prev<3>(input, prev_input_), _mm256_set1_epi8(0xf0u - 0x80));
+      const __m256i must_be_23_continuation = _mm256_and_si256(
+          _mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8(0x80u));
+      error_ = _mm256_or_si256(error_,
+                               _mm256_xor_si256(must_be_23_continuation, special_cases));
+
+      prev_incomplete_ = _mm256_subs_epu8(input, incomplete_max_);
+    }
+    prev_input_ = input;
+  }
+
+  ARROW_TARGET_AVX2 bool ok() const { return _mm256_testz_si256(error_, error_); }
+
+ private:
+  const __m256i byte_1_high_table_;
+  const __m256i byte_1_low_table_;
+  const __m256i byte_2_high_table_;
+  const __m256i incomplete_max_;
+  __m256i error_;
+  __m256i prev_input_;
+  __m256i prev_incomplete_;
+};
+
+ARROW_TARGET_AVX2 static bool ValidateUTF8Avx2(const uint8_t* data, int64_t size) {
+  UTF8ValidatorAvx2 validator;
+  for (; size >= 32; data += 32, size -= 32) {
+    validator.CheckBlock(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)));
+  }
+  uint8_t tail[32] = {0};
+  memcpy(tail, data, size);
+  validator.CheckBlock(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(tail)));
+  return validator.ok();
+}
+
+#endif  // ARROW_HAVE_RUNTIME_AVX2
+
+bool ValidateUTF8Simd(const uint8_t* data, int64_t size) {
+#ifdef ARROW_HAVE_RUNTIME_AVX2
+  static auto cpu_info = ::arrow::internal::CpuInfo::GetInstance();
+  if (cpu_info->CanUseAVX2()) {
+    return ValidateUTF8Avx2(data, size);
+  }
+#endif
+#ifdef ARROW_HAVE_SSE4_2
+  return ValidateUTF8Sse42(data, size);
+#else
+  return ValidateUTF8Inline(data, size);
+#endif
+}
+
 }  // namespace internal
 
 static std::once_flag utf8_initialized;
@@ -79,5 +357,38 @@ void InitializeUTF8() {
   std::call_once(utf8_initialized, internal::InitializeLargeTable);
 }
 
+bool ValidateUTF8Strings(const uint8_t* data, const int32_t* offsets, int64_t length,
+                         const uint8_t* null_bitmap, int64_t null_bitmap_offset) {
+  if (length == 0) {
+    return true;
+  }
+  const uint8_t* begin = data + offsets[0];
+  const int64_t size = offsets[length] - offsets[0];
+  if (ValidateUTF8(begin, size)) {
+    // The concatenation is valid, so are the strings unless one starts in the
+    // middle of a character
+    bool starts_valid = true;
+    for (int64_t i = 1; i < length; ++i) {
+      if (offsets[i] < offsets[length]) {
+        starts_valid &= (data[offsets[i]] & 0xc0) != 0x80;
+      }
+    }
+    if (ARROW_PREDICT_TRUE(starts_valid)) {
+      return true;
+    }
+  }
+  // Check one by one, as nulls may point to invalid data
+  for (int64_t i = 0; i < length; ++i) {
+    if (null_bitmap != NULLPTR &&
+        !BitUtil::GetBit(null_bitmap, null_bitmap_offset + i)) {
+      continue;
+    }
+    if (!ValidateUTF8(data + offsets[i], offsets[i + 1] - offsets[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
 }  // namespace util
 }  // namespace arrow
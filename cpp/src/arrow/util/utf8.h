@@ -78,7 +78,10 @@ ARROW_EXPORT void CheckUTF8Initialized();
 // This function needs to be called before doing UTF8 validation.
 ARROW_EXPORT void InitializeUTF8();
 
-inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+namespace internal {
+
+// Byte-at-a-time validation, with a shortcut for runs of ASCII
+inline bool ValidateUTF8Inline(const uint8_t* data, int64_t size) {
   static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
   // For some reason, defining this variable outside the loop helps clang
   uint64_t mask;
@@ -158,6 +161,22 @@ inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
   return ARROW_PREDICT_TRUE(state == internal::kUTF8ValidateAccept);
 }
 
+// Vectorized validation, falling back on ValidateUTF8Inline when the CPU
+// or the build has no suitable instruction set
+ARROW_EXPORT bool ValidateUTF8Simd(const uint8_t* data, int64_t size);
+
+// Data at least this large is validated with ValidateUTF8Simd
+static constexpr int64_t kUTF8SimdMinSize = 64;
+
+}  // namespace internal
+
+inline bool ValidateUTF8(const uint8_t* data, int64_t size) {
+  if (size >= internal::kUTF8SimdMinSize) {
+    return internal::ValidateUTF8Simd(data, size);
+  }
+  return internal::ValidateUTF8Inline(data, size);
+}
+
 inline bool ValidateUTF8(const util::string_view& str) {
   const uint8_t* data = reinterpret_cast<const uint8_t*>(str.data());
   const size_t length = str.size();
@@ -165,6 +184,43 @@ inline bool ValidateUTF8(const util::string_view& str) {
   return ValidateUTF8(data, length);
 }
 
+/// \brief Validate that the `length` strings delimited by `offsets` in `data`
+/// are UTF8, skipping null entries
+///
+/// The data of all strings is validated at once, which is much faster than
+/// validating each string on its own when strings are short.  Only if that
+/// fails are the strings validated one by one, to ignore null entries.
+/// \param[in] data the string data
+/// \param[in] offsets the `length + 1` string offsets into data
+/// \param[in] length the number of strings
+/// \param[in] null_bitmap the validity bitmap of the strings, may be null
+/// \param[in] null_bitmap_offset the bit offset of the first string in null_bitmap
+ARROW_EXPORT
+bool ValidateUTF8Strings(const uint8_t* data, const int32_t* offsets, int64_t length,
+                         const uint8_t* null_bitmap = NULLPTR,
+                         int64_t null_bitmap_offset = 0);
+
+// Return whether the data is pure ASCII, which is valid UTF8 with one byte
+// per character
+inline bool ValidateAscii(const uint8_t* data, int64_t size) {
+  static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
+  uint64_t mask;
+
+  while (size >= 8) {
+    memcpy(&mask, data, 8);
+    if (ARROW_PREDICT_FALSE((mask & high_bits_64) != 0)) {
+      return false;
+    }
+    size -= 8;
+    data += 8;
+  }
+  uint8_t tail = 0;
+  while (size-- > 0) {
+    tail |= *data++;
+  }
+  return (tail & 0x80) == 0;
+}
+
 }  // namespace util
 }  // namespace arrow
 
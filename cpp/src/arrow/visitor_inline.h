@@ -192,7 +192,9 @@ struct ArrayDataVisitor<T, enable_if_binary<T>> {
     if (!arr.buffers[2]) {
       data = &empty_value;
     } else {
-      data = arr.GetValues<uint8_t>(2);
+      // Do not apply the array offset to the values pointer; it's only
+      // relevant for the offsets
+      data = arr.buffers[2]->data();
     }
 
     if (arr.null_count != 0) {
@@ -20,6 +20,8 @@
 #include <memory>
 #include <string>
 
+#include "arrow/util/bit-util.h"
+
 #include "gandiva/field_descriptor.h"
 
 namespace gandiva {
@@ -42,6 +44,13 @@ FieldDescriptorPtr Annotator::AddOutputFieldDescriptor(FieldPtr field) {
   return desc;
 }
 
+FieldDescriptorPtr Annotator::AddTempFieldDescriptor(FieldPtr field) {
+  auto desc = MakeDesc(field);
+  in_name_to_desc_[field->name()] = desc;
+  temp_descs_.push_back(desc);
+  return desc;
+}
+
 FieldDescriptorPtr Annotator::MakeDesc(FieldPtr field) {
   int data_idx = buffer_count_++;
   int validity_idx = buffer_count_++;
@@ -54,33 +63,45 @@ FieldDescriptorPtr Annotator::MakeDesc(FieldPtr field) {
 
 void Annotator::PrepareBuffersForField(const FieldDescriptor& desc,
                                        const arrow::ArrayData& array_data,
-                                       EvalBatch* eval_batch) {
+                                       int64_t offset, EvalBatch* eval_batch) {
   int buffer_idx = 0;
 
   // The validity buffer is optional. Use nullptr if it does not have one.
   if (array_data.buffers[buffer_idx]) {
     uint8_t* validity_buf = const_cast<uint8_t*>(array_data.buffers[buffer_idx]->data());
-    eval_batch->SetBuffer(desc.validity_idx(), validity_buf);
+    eval_batch->SetBuffer(desc.validity_idx(), validity_buf + offset / 8);
   } else {
     eval_batch->SetBuffer(desc.validity_idx(), nullptr);
   }
   ++buffer_idx;
 
   if (desc.HasOffsetsIdx()) {
+    // The offsets point into the whole data buffer.
     uint8_t* offsets_buf = const_cast<uint8_t*>(array_data.buffers[buffer_idx]->data());
-    eval_batch->SetBuffer(desc.offsets_idx(), offsets_buf);
+    eval_batch->SetBuffer(desc.offsets_idx(), offsets_buf + offset * sizeof(int32_t));
     ++buffer_idx;
   }
 
   uint8_t* data_buf = const_cast<uint8_t*>(array_data.buffers[buffer_idx]->data());
+  if (!desc.HasOffsetsIdx() && offset > 0) {
+    const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*array_data.type);
+    data_buf += offset * fw_type.bit_width() / 8;
+  }
   eval_batch->SetBuffer(desc.data_idx(), data_buf);
   ++buffer_idx;
 }
 
 EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
                                          const ArrayDataVector& out_vector) {
-  EvalBatchPtr eval_batch = std::make_shared<EvalBatch>(
-      record_batch.num_rows(), buffer_count_, local_bitmap_count_);
+  return PrepareEvalBatch(record_batch, out_vector, 0, record_batch.num_rows());
+}
+
+EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
+                                         const ArrayDataVector& out_vector,
+                                         int64_t offset, int64_t length) {
+  DCHECK_EQ(offset % 64, 0);
+  EvalBatchPtr eval_batch =
+      std::make_shared<EvalBatch>(length, buffer_count_, local_bitmap_count_);
 
   // Fill in the entries for the input fields.
   for (int i = 0; i < record_batch.num_columns(); ++i) {
@@ -91,7 +112,7 @@ EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
       continue;
     }
 
-    PrepareBuffersForField(*(found->second), *(record_batch.column(i))->data(),
+    PrepareBuffersForField(*(found->second), *(record_batch.column(i))->data(), offset,
                            eval_batch.get());
   }
 
@@ -99,10 +120,67 @@ EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
   int idx = 0;
   for (auto& arraydata : out_vector) {
     const FieldDescriptorPtr& desc = out_descs_.at(idx);
-    PrepareBuffersForField(*desc, *arraydata, eval_batch.get());
+    PrepareBuffersForField(*desc, *arraydata, offset, eval_batch.get());
     ++idx;
   }
+
+  AllocateTempBuffers(length, eval_batch.get());
   return eval_batch;
 }
 
+EvalBatchPtr Annotator::PrepareEvalBatch(const arrow::RecordBatch& record_batch,
+                                         const SelectionVector& selection_vector,
+                                         const ArrayDataVector& out_vector) {
+  int64_t num_slots = selection_vector.GetNumSlots();
+  EvalBatchPtr eval_batch =
+      std::make_shared<EvalBatch>(num_slots, buffer_count_, local_bitmap_count_);
+
+  // Fill in the entries for the input fields, with their validity gathered for the
+  // selected rows.
+  for (int i = 0; i < record_batch.num_columns(); ++i) {
+    const std::string& name = record_batch.column_name(i);
+    auto found = in_name_to_desc_.find(name);
+    if (found == in_name_to_desc_.end()) {
+      // skip columns not involved in the expression.
+      continue;
+    }
+
+    const FieldDescriptor& desc = *(found->second);
+    const arrow::ArrayData& array_data = *(record_batch.column(i))->data();
+    PrepareBuffersForField(desc, array_data, 0, eval_batch.get());
+    if (array_data.buffers[0]) {
+      const uint8_t* validity = array_data.buffers[0]->data();
+      uint8_t* gathered =
+          eval_batch->AllocateBuffer(arrow::BitUtil::BytesForBits(num_slots));
+      for (int64_t slot = 0; slot < num_slots; ++slot) {
+        int64_t position = static_cast<int64_t>(selection_vector.GetIndex(slot));
+        arrow::BitUtil::SetBitTo(gathered, slot,
+                                 arrow::BitUtil::GetBit(validity, position));
+      }
+      eval_batch->SetBuffer(desc.validity_idx(), gathered);
+    }
+  }
+
+  // Fill in the entries for the output fields, which hold a row per slot.
+  int idx = 0;
+  for (auto& arraydata : out_vector) {
+    const FieldDescriptorPtr& desc = out_descs_.at(idx);
+    PrepareBuffersForField(*desc, *arraydata, 0, eval_batch.get());
+    ++idx;
+  }
+
+  AllocateTempBuffers(num_slots, eval_batch.get());
+  return eval_batch;
+}
+
+void Annotator::AllocateTempBuffers(int64_t length, EvalBatch* eval_batch) {
+  for (auto& desc : temp_descs_) {
+    const auto& fw_type = dynamic_cast<const arrow::FixedWidthType&>(*desc->Type());
+    int64_t validity_size = arrow::BitUtil::BytesForBits(length);
+    int64_t data_size = arrow::BitUtil::BytesForBits(length * fw_type.bit_width());
+    eval_batch->SetBuffer(desc->validity_idx(), eval_batch->AllocateBuffer(validity_size));
+    eval_batch->SetBuffer(desc->data_idx(), eval_batch->AllocateBuffer(data_size));
+  }
+}
+
 }  // namespace gandiva
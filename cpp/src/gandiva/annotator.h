@@ -27,6 +27,7 @@
 #include "gandiva/eval_batch.h"
 #include "gandiva/gandiva_aliases.h"
 #include "gandiva/logging.h"
+#include "gandiva/selection_vector.h"
 #include "gandiva/visibility.h"
 
 namespace gandiva {
@@ -44,6 +45,10 @@ class GANDIVA_EXPORT Annotator {
   /// Add an annotated field descriptor for an output field.
   FieldDescriptorPtr AddOutputFieldDescriptor(FieldPtr field);
 
+  /// Add an annotated field descriptor for a temporary field, which is computed
+  /// into buffers allocated for each eval batch, and read like an input field.
+  FieldDescriptorPtr AddTempFieldDescriptor(FieldPtr field);
+
   /// Add a local bitmap (for saving validity bits of an intermediate node).
   /// Returns the index of the bitmap in the list of local bitmaps.
   int AddLocalBitMap() { return local_bitmap_count_++; }
@@ -52,6 +57,20 @@ class GANDIVA_EXPORT Annotator {
   EvalBatchPtr PrepareEvalBatch(const arrow::RecordBatch& record_batch,
                                 const ArrayDataVector& out_vector);
 
+  /// Prepare an eval batch for the rows [offset, offset + length) of the incoming
+  /// record batch. The offset must be a multiple of 64, so that the bitmaps of the
+  /// range start at a word.
+  EvalBatchPtr PrepareEvalBatch(const arrow::RecordBatch& record_batch,
+                                const ArrayDataVector& out_vector, int64_t offset,
+                                int64_t length);
+
+  /// Prepare an eval batch for the selected rows of the incoming record batch. The
+  /// data of the input fields is read at the selected positions, while their
+  /// validity is gathered so that bit i is the validity of the i-th selected row.
+  EvalBatchPtr PrepareEvalBatch(const arrow::RecordBatch& record_batch,
+                                const SelectionVector& selection_vector,
+                                const ArrayDataVector& out_vector);
+
  private:
   /// Annotate a field and return the descriptor.
   FieldDescriptorPtr MakeDesc(FieldPtr field);
@@ -59,7 +78,11 @@ class GANDIVA_EXPORT Annotator {
   /// Populate eval_batch by extracting the raw buffers from the arrow array, whose
   /// contents are represent by the annotated descriptor 'desc'.
   void PrepareBuffersForField(const FieldDescriptor& desc,
-                              const arrow::ArrayData& array_data, EvalBatch* eval_batch);
+                              const arrow::ArrayData& array_data, int64_t offset,
+                              EvalBatch* eval_batch);
+
+  /// Allocate the buffers of the temporary fields for 'length' rows.
+  void AllocateTempBuffers(int64_t length, EvalBatch* eval_batch);
 
   /// The list of input/output buffers (includes bitmap buffers, value buffers and
   /// offset buffers).
@@ -74,6 +97,9 @@ class GANDIVA_EXPORT Annotator {
 
   /// vector of annotated output field descriptors.
   std::vector<FieldDescriptorPtr> out_descs_;
+
+  /// vector of annotated temporary field descriptors.
+  std::vector<FieldDescriptorPtr> temp_descs_;
 };
 
 }  // namespace gandiva
@@ -18,33 +18,66 @@
 #ifndef GANDIVA_MODULE_CACHE_H
 #define GANDIVA_MODULE_CACHE_H
 
+#include <cstdint>
 #include <mutex>
 
+#include "gandiva/cache_stats.h"
 #include "gandiva/lru_cache.h"
 
 namespace gandiva {
 
+/// Caches modules, evicting the least recently used ones once the size of
+/// their generated code exceeds the capacity.
 template <class KeyType, typename ValueType>
 class Cache {
  public:
-  explicit Cache(size_t capacity = CACHE_SIZE) : cache_(capacity) {}
+  explicit Cache(size_t capacity = CACHE_SIZE)
+      : cache_(capacity), hits_(0), misses_(0) {}
+
   ValueType GetModule(KeyType cache_key) {
     boost::optional<ValueType> result;
     mtx_.lock();
     result = cache_.get(cache_key);
+    if (result != boost::none) {
+      ++hits_;
+    } else {
+      ++misses_;
+    }
     mtx_.unlock();
     return result != boost::none ? *result : nullptr;
   }
 
-  void PutModule(KeyType cache_key, ValueType module) {
+  /// \param[in] size the approximate size in bytes of the generated code of module
+  void PutModule(KeyType cache_key, ValueType module, size_t size) {
+    mtx_.lock();
+    cache_.insert(cache_key, module, size);
+    mtx_.unlock();
+  }
+
+  void SetCapacity(size_t capacity) {
+    mtx_.lock();
+    cache_.set_capacity(capacity);
+    mtx_.unlock();
+  }
+
+  CacheStats GetStats() {
+    CacheStats stats;
     mtx_.lock();
-    cache_.insert(cache_key, module);
+    stats.hits = hits_;
+    stats.misses = misses_;
+    stats.evictions = static_cast<int64_t>(cache_.num_evictions());
+    stats.entries = static_cast<int64_t>(cache_.size());
+    stats.size = static_cast<int64_t>(cache_.cost());
+    stats.capacity = static_cast<int64_t>(cache_.capacity());
     mtx_.unlock();
+    return stats;
   }
 
  private:
   LruCache<KeyType, ValueType> cache_;
-  static const int CACHE_SIZE = 250;
+  int64_t hits_;
+  int64_t misses_;
+  static const size_t CACHE_SIZE = 128 << 20;
   std::mutex mtx_;
 };
 }  // namespace gandiva
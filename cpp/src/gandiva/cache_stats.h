@@ -0,0 +1,40 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace gandiva {
+
+/// \brief Counters of the cache of built projectors or filters.
+struct CacheStats {
+  /// Number of builds that found an equivalent projector or filter in the cache.
+  int64_t hits = 0;
+  /// Number of builds that compiled the expressions.
+  int64_t misses = 0;
+  /// Number of cached entries evicted to make room for others.
+  int64_t evictions = 0;
+  /// Number of cached entries.
+  int64_t entries = 0;
+  /// Approximate size in bytes of the generated code of the cached entries.
+  int64_t size = 0;
+  /// Capacity in bytes of the cache.
+  int64_t capacity = 0;
+};
+
+}  // namespace gandiva
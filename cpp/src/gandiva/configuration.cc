@@ -25,11 +25,20 @@ const std::shared_ptr<Configuration> ConfigurationBuilder::default_configuration
     InitDefaultConfig();
 
 std::size_t Configuration::Hash() const {
-  return 0;  // dummy for now, no configuration properties yet
+  std::size_t result = 0;
+  boost::hash_combine(result, object_cache_dir_);
+  boost::hash_combine(result, tiered_compilation_);
+  boost::hash_combine(result, target_cpu_);
+  boost::hash_combine(result, target_features_);
+  // The cache capacity does not change the generated code, so projectors and
+  // filters are shared by configurations that only differ in it.
+  return result;
 }
 
 bool Configuration::operator==(const Configuration& other) const {
-  return true;  // always true, no configuration properties yet
+  return object_cache_dir_ == other.object_cache_dir_ &&
+         tiered_compilation_ == other.tiered_compilation_ &&
+         target_cpu_ == other.target_cpu_ && target_features_ == other.target_features_;
 }
 
 bool Configuration::operator!=(const Configuration& other) const {
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <cstdlib>
 #include <memory>
 #include <string>
 
@@ -38,6 +40,32 @@ class GANDIVA_EXPORT Configuration {
   std::size_t Hash() const;
   bool operator==(const Configuration& other) const;
   bool operator!=(const Configuration& other) const;
+
+  /// The directory where compiled object code is cached across processes, or
+  /// empty if compiled code is not cached on disk.
+  const std::string& object_cache_dir() const { return object_cache_dir_; }
+
+  /// Whether expressions are first compiled without optimisation, and switched
+  /// to optimised code compiled in the background once it is ready.
+  bool tiered_compilation() const { return tiered_compilation_; }
+
+  /// The capacity in bytes of generated code of the caches of built projectors
+  /// and filters, or 0 to keep their current capacity.
+  int64_t cache_capacity() const { return cache_capacity_; }
+
+  /// The LLVM name of the CPU code is generated for, or empty for the host CPU.
+  const std::string& target_cpu() const { return target_cpu_; }
+
+  /// The comma-separated LLVM features, e.g. "+avx2,-avx512f", enabled or
+  /// disabled on top of those of the target CPU.
+  const std::string& target_features() const { return target_features_; }
+
+ private:
+  std::string object_cache_dir_;
+  bool tiered_compilation_ = false;
+  int64_t cache_capacity_ = 0;
+  std::string target_cpu_;
+  std::string target_features_;
 };
 
 /// \brief configuration builder for gandiva
@@ -48,9 +76,53 @@ class GANDIVA_EXPORT ConfigurationBuilder {
  public:
   std::shared_ptr<Configuration> build() {
     std::shared_ptr<Configuration> configuration(new Configuration());
+    configuration->object_cache_dir_ = object_cache_dir_;
+    configuration->tiered_compilation_ = tiered_compilation_;
+    configuration->cache_capacity_ = cache_capacity_;
+    configuration->target_cpu_ = target_cpu_;
+    configuration->target_features_ = target_features_;
     return configuration;
   }
 
+  /// Cache the compiled object code of modules in the directory, so that other
+  /// processes building the same expressions skip the LLVM optimiser and
+  /// code generation. The directory must exist.
+  ConfigurationBuilder& set_object_cache_dir(const std::string& dir) {
+    object_cache_dir_ = dir;
+    return *this;
+  }
+
+  /// Make projectors and filters without waiting for the LLVM optimiser. They
+  /// evaluate with unoptimised code until the optimised code, compiled on the
+  /// CPU thread pool, is ready. This cuts the latency of one-off expressions.
+  ConfigurationBuilder& set_tiered_compilation(bool tiered) {
+    tiered_compilation_ = tiered;
+    return *this;
+  }
+
+  /// Set the capacity of the caches of built projectors and filters, in bytes
+  /// of generated code. The caches are shared by the process, so building a
+  /// projector or filter resizes them to the capacity of its configuration.
+  ConfigurationBuilder& set_cache_capacity(int64_t bytes) {
+    cache_capacity_ = bytes;
+    return *this;
+  }
+
+  /// Generate code for a CPU other than the host's, e.g. "haswell" or
+  /// "skylake-avx512", so that benchmarks on different hosts run the same code.
+  /// The code is only run on the host, which must support the CPU's features.
+  ConfigurationBuilder& set_target_cpu(const std::string& cpu) {
+    target_cpu_ = cpu;
+    return *this;
+  }
+
+  /// Enable or disable LLVM features on top of those of the target CPU, e.g.
+  /// "-avx512f" to keep code generated for the host from using AVX-512.
+  ConfigurationBuilder& set_target_features(const std::string& features) {
+    target_features_ = features;
+    return *this;
+  }
+
   static std::shared_ptr<Configuration> DefaultConfiguration() {
     return default_configuration_;
   }
@@ -58,9 +130,27 @@ class GANDIVA_EXPORT ConfigurationBuilder {
  private:
   static std::shared_ptr<Configuration> InitDefaultConfig() {
     std::shared_ptr<Configuration> configuration(new Configuration());
+    const char* object_cache_dir = std::getenv("GANDIVA_OBJECT_CACHE_DIR");
+    if (object_cache_dir != nullptr) {
+      configuration->object_cache_dir_ = object_cache_dir;
+    }
+    const char* target_cpu = std::getenv("GANDIVA_TARGET_CPU");
+    if (target_cpu != nullptr) {
+      configuration->target_cpu_ = target_cpu;
+    }
+    const char* target_features = std::getenv("GANDIVA_TARGET_FEATURES");
+    if (target_features != nullptr) {
+      configuration->target_features_ = target_features;
+    }
     return configuration;
   }
 
+  std::string object_cache_dir_;
+  bool tiered_compilation_ = false;
+  int64_t cache_capacity_ = 0;
+  std::string target_cpu_;
+  std::string target_features_;
+
   static const std::shared_ptr<Configuration> default_configuration_;
 };
 
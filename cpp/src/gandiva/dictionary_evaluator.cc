@@ -0,0 +1,270 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/dictionary_evaluator.h"
+
+#include <cstring>
+#include <unordered_set>
+#include <vector>
+
+#include "arrow/memory_pool.h"
+#include "arrow/util/bit-util.h"
+
+#include "gandiva/node_visitor.h"
+#include "gandiva/projector.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+namespace {
+
+// Collects the names of the fields an expression refers to, and rewrites it to
+// refer to the values of a dictionary-encoded field instead.
+class DictionaryFieldRewriter : public NodeVisitor {
+ public:
+  explicit DictionaryFieldRewriter(FieldPtr field) : field_(field) {
+    if (field_ != nullptr) {
+      const auto& type = static_cast<const arrow::DictionaryType&>(*field_->type());
+      value_field_ = arrow::field(field_->name(), type.dictionary()->type());
+    }
+  }
+
+  const std::unordered_set<std::string>& field_names() const { return field_names_; }
+
+  Status Rewrite(const Node& node, NodePtr* out) {
+    ARROW_RETURN_NOT_OK(node.Accept(*this));
+    *out = result_;
+    return Status::OK();
+  }
+
+  Status Visit(const FieldNode& node) override {
+    field_names_.insert(node.field()->name());
+    if (field_ != nullptr && node.field()->name() == field_->name()) {
+      result_ = TreeExprBuilder::MakeField(value_field_);
+    } else {
+      result_ = std::make_shared<FieldNode>(node.field());
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const FunctionNode& node) override {
+    NodeVector children;
+    ARROW_RETURN_NOT_OK(RewriteAll(node.children(), &children));
+    result_ = TreeExprBuilder::MakeFunction(node.descriptor()->name(), children,
+                                            ValueType(node.return_type()));
+    return Status::OK();
+  }
+
+  Status Visit(const IfNode& node) override {
+    NodeVector children;
+    ARROW_RETURN_NOT_OK(RewriteAll(
+        {node.condition(), node.then_node(), node.else_node()}, &children));
+    result_ = TreeExprBuilder::MakeIf(children[0], children[1], children[2],
+                                      ValueType(node.return_type()));
+    return Status::OK();
+  }
+
+  Status Visit(const LiteralNode& node) override {
+    result_ = std::make_shared<LiteralNode>(node);
+    return Status::OK();
+  }
+
+  Status Visit(const BooleanNode& node) override {
+    NodeVector children;
+    ARROW_RETURN_NOT_OK(RewriteAll(node.children(), &children));
+    result_ = std::make_shared<BooleanNode>(node.expr_type(), children);
+    return Status::OK();
+  }
+
+  Status Visit(const InExpressionNode<int32_t>& node) override {
+    return VisitIn(node);
+  }
+
+  Status Visit(const InExpressionNode<int64_t>& node) override {
+    return VisitIn(node);
+  }
+
+  Status Visit(const InExpressionNode<std::string>& node) override {
+    return VisitIn(node);
+  }
+
+ private:
+  template <typename Type>
+  Status VisitIn(const InExpressionNode<Type>& node) {
+    NodePtr eval_expr;
+    ARROW_RETURN_NOT_OK(Rewrite(*node.eval_expr(), &eval_expr));
+    result_ = std::make_shared<InExpressionNode<Type>>(eval_expr, node.values());
+    return Status::OK();
+  }
+
+  Status RewriteAll(const NodeVector& nodes, NodeVector* out) {
+    for (auto& node : nodes) {
+      NodePtr rewritten;
+      ARROW_RETURN_NOT_OK(Rewrite(*node, &rewritten));
+      out->push_back(rewritten);
+    }
+    return Status::OK();
+  }
+
+  DataTypePtr ValueType(const DataTypePtr& type) {
+    if (field_ != nullptr && type->Equals(*field_->type())) {
+      return value_field_->type();
+    }
+    return type;
+  }
+
+  FieldPtr field_;
+  FieldPtr value_field_;
+  std::unordered_set<std::string> field_names_;
+  NodePtr result_;
+};
+
+}  // namespace
+
+FieldPtr DictionaryEvaluator::GetDictionaryField(const arrow::Schema& schema,
+                                                 const Node& root) {
+  DictionaryFieldRewriter collector(nullptr);
+  NodePtr rewritten;
+  if (!collector.Rewrite(root, &rewritten).ok() ||
+      collector.field_names().size() != 1) {
+    return nullptr;
+  }
+  auto field = schema.GetFieldByName(*collector.field_names().begin());
+  if (field == nullptr || field->type()->id() != arrow::Type::DICTIONARY) {
+    return nullptr;
+  }
+  return field;
+}
+
+Status DictionaryEvaluator::Make(FieldPtr field, ExpressionPtr expr,
+                                 std::shared_ptr<Configuration> configuration,
+                                 std::unique_ptr<DictionaryEvaluator>* evaluator) {
+  ARROW_RETURN_IF(field->type()->id() != arrow::Type::DICTIONARY,
+                  Status::Invalid("Field ", field->name(), " is not dictionary-encoded"));
+  const auto& result_type = expr->result()->type();
+  ARROW_RETURN_IF(result_type->id() == arrow::Type::DICTIONARY ||
+                      dynamic_cast<const arrow::FixedWidthType*>(result_type.get()) ==
+                          nullptr,
+                  Status::Invalid("Unsupported output data type ", result_type));
+
+  DictionaryFieldRewriter rewriter(field);
+  NodePtr root;
+  ARROW_RETURN_NOT_OK(rewriter.Rewrite(*expr->root(), &root));
+
+  const auto& type = static_cast<const arrow::DictionaryType&>(*field->type());
+  auto dictionary = type.dictionary();
+  if (dictionary->length() == 0) {
+    // All the indices are null.
+    evaluator->reset(new DictionaryEvaluator(field->name(), nullptr));
+    return Status::OK();
+  }
+
+  // Evaluate the expression over the dictionary.
+  auto schema = arrow::schema({arrow::field(field->name(), dictionary->type())});
+  std::shared_ptr<Projector> projector;
+  ARROW_RETURN_NOT_OK(Projector::Make(
+      schema, {TreeExprBuilder::MakeExpression(root, expr->result())}, configuration,
+      &projector));
+  auto batch = arrow::RecordBatch::Make(schema, dictionary->length(), {dictionary});
+  arrow::ArrayVector values;
+  ARROW_RETURN_NOT_OK(
+      projector->Evaluate(*batch, arrow::default_memory_pool(), &values));
+
+  evaluator->reset(new DictionaryEvaluator(field->name(), values[0]));
+  return Status::OK();
+}
+
+template <typename IndexType>
+void DictionaryEvaluator::Lookup(const arrow::ArrayData& indices,
+                                 const SelectionVector* selection_vector,
+                                 const arrow::ArrayData& output) const {
+  const IndexType* index_data = indices.GetValues<IndexType>(1);
+  const uint8_t* index_validity =
+      indices.buffers[0] != nullptr ? indices.buffers[0]->data() : nullptr;
+  uint8_t* out_validity = const_cast<uint8_t*>(output.buffers[0]->data());
+  uint8_t* out_data = const_cast<uint8_t*>(output.buffers[1]->data());
+  const int64_t length =
+      selection_vector != nullptr ? selection_vector->GetNumSlots() : indices.length;
+
+  if (values_ == nullptr) {
+    memset(out_validity, 0, arrow::BitUtil::BytesForBits(length));
+    return;
+  }
+
+  const auto& values = *values_->data();
+  const uint8_t* value_validity = values_->null_bitmap_data();
+  const uint8_t* value_data = values.buffers[1]->data();
+  const int bit_width =
+      static_cast<const arrow::FixedWidthType&>(*values.type).bit_width();
+  const int byte_width = bit_width / 8;
+
+  for (int64_t i = 0; i < length; ++i) {
+    int64_t row = selection_vector != nullptr
+                      ? static_cast<int64_t>(selection_vector->GetIndex(i))
+                      : i;
+    bool valid = index_validity == nullptr ||
+                 arrow::BitUtil::GetBit(index_validity, indices.offset + row);
+    // The index of a null may be anything.
+    int64_t index = valid ? static_cast<int64_t>(index_data[row]) : 0;
+    valid = valid &&
+            (value_validity == nullptr || arrow::BitUtil::GetBit(value_validity, index));
+    arrow::BitUtil::SetBitTo(out_validity, i, valid);
+    if (bit_width == 1) {
+      arrow::BitUtil::SetBitTo(out_data, i,
+                               valid && arrow::BitUtil::GetBit(value_data, index));
+    } else if (valid) {
+      memcpy(out_data + i * byte_width, value_data + index * byte_width, byte_width);
+    } else {
+      memset(out_data + i * byte_width, 0, byte_width);
+    }
+  }
+}
+
+Status DictionaryEvaluator::Evaluate(const arrow::RecordBatch& batch,
+                                     const arrow::ArrayData& output) const {
+  return Evaluate(batch, nullptr, output);
+}
+
+Status DictionaryEvaluator::Evaluate(const arrow::RecordBatch& batch,
+                                     const SelectionVector* selection_vector,
+                                     const arrow::ArrayData& output) const {
+  auto column = batch.GetColumnByName(field_name_);
+  ARROW_RETURN_IF(column == nullptr,
+                  Status::Invalid("RecordBatch has no field ", field_name_));
+  const auto& indices = *column->data();
+  const auto& type = static_cast<const arrow::DictionaryType&>(*indices.type);
+
+  switch (type.index_type()->id()) {
+    case arrow::Type::INT8:
+      Lookup<int8_t>(indices, selection_vector, output);
+      break;
+    case arrow::Type::INT16:
+      Lookup<int16_t>(indices, selection_vector, output);
+      break;
+    case arrow::Type::INT32:
+      Lookup<int32_t>(indices, selection_vector, output);
+      break;
+    case arrow::Type::INT64:
+      Lookup<int64_t>(indices, selection_vector, output);
+      break;
+    default:
+      return Status::Invalid("Unsupported dictionary index type ", type.index_type());
+  }
+  return Status::OK();
+}
+
+}  // namespace gandiva
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef GANDIVA_DICTIONARY_EVALUATOR_H
+#define GANDIVA_DICTIONARY_EVALUATOR_H
+
+#include <memory>
+#include <string>
+
+#include "arrow/status.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/configuration.h"
+#include "gandiva/expression.h"
+#include "gandiva/node.h"
+#include "gandiva/selection_vector.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Evaluates an expression that only refers to a dictionary-encoded field.
+///
+/// The expression is evaluated once per entry of the dictionary when the
+/// evaluator is built, and the result for each row is looked up by its index.
+/// The result must be fixed-width.
+class GANDIVA_EXPORT DictionaryEvaluator {
+ public:
+  /// Return the dictionary-encoded field of the schema that the expression
+  /// refers to, or null if it refers to no such field, or to other fields too.
+  static FieldPtr GetDictionaryField(const arrow::Schema& schema, const Node& root);
+
+  /// Build an evaluator for the expression.
+  ///
+  /// \param[in] field the dictionary-encoded field the expression refers to.
+  /// \param[in] expr the expression.
+  /// \param[in] configuration run time configuration.
+  /// \param[out] evaluator the returned evaluator.
+  static Status Make(FieldPtr field, ExpressionPtr expr,
+                     std::shared_ptr<Configuration> configuration,
+                     std::unique_ptr<DictionaryEvaluator>* evaluator);
+
+  /// Populate the validity and data buffers of the output, of the type of the
+  /// expression's result, for the rows of the batch.
+  Status Evaluate(const arrow::RecordBatch& batch, const arrow::ArrayData& output) const;
+
+  /// Populate the validity and data buffers of the output for the rows of the batch
+  /// in the selection vector, or for all of them if it is null.
+  Status Evaluate(const arrow::RecordBatch& batch,
+                  const SelectionVector* selection_vector,
+                  const arrow::ArrayData& output) const;
+
+ private:
+  DictionaryEvaluator(const std::string& field_name, ArrayPtr values)
+      : field_name_(field_name), values_(values) {}
+
+  template <typename IndexType>
+  void Lookup(const arrow::ArrayData& indices, const SelectionVector* selection_vector,
+              const arrow::ArrayData& output) const;
+
+  const std::string field_name_;
+  // The result for each entry of the dictionary, or null if it is empty.
+  const ArrayPtr values_;
+};
+
+}  // namespace gandiva
+
+#endif  // GANDIVA_DICTIONARY_EVALUATOR_H
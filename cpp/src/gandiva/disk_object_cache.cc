@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/disk_object_cache.h"
+
+#include <cstdio>
+#include <fstream>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4141)
+#pragma warning(disable : 4146)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#pragma warning(disable : 4624)
+#endif
+
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SHA1.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Target/TargetMachine.h>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#include "gandiva/logging.h"
+
+namespace gandiva {
+
+DiskObjectCache::DiskObjectCache(const std::string& dir, const std::string& key)
+    : path_(dir + "/" + key + ".o") {}
+
+std::string DiskObjectCache::MakeKey(const llvm::Module& module, bool optimise_ir,
+                                     const llvm::TargetMachine& target_machine) {
+  std::string ir;
+  llvm::raw_string_ostream stream(ir);
+  module.print(stream, nullptr);
+  stream.flush();
+
+  // The object code depends on the CPU it is generated for, and on the
+  // version of LLVM generating it.
+  llvm::SHA1 hasher;
+  hasher.update(ir);
+  hasher.update(optimise_ir ? "O3" : "O0");
+  hasher.update(target_machine.getTargetTriple().str());
+  hasher.update(target_machine.getTargetCPU());
+  hasher.update(target_machine.getTargetFeatureString());
+  hasher.update(LLVM_VERSION_STRING);
+  return llvm::toHex(hasher.final());
+}
+
+bool DiskObjectCache::Contains() const { return llvm::sys::fs::exists(path_); }
+
+void DiskObjectCache::notifyObjectCompiled(const llvm::Module* module,
+                                           llvm::MemoryBufferRef object) {
+  // Write to a file of our own and rename it, so that processes compiling the
+  // same module concurrently never read a partial object.
+  llvm::SmallString<128> temp_path;
+  int fd;
+  if (llvm::sys::fs::createUniqueFile(path_ + ".%%%%%%.tmp", fd, temp_path)) {
+    ARROW_LOG(WARNING) << "Could not create a file to cache object code in " << path_;
+    return;
+  }
+  {
+    llvm::raw_fd_ostream out(fd, /*shouldClose=*/true);
+    out << object.getBuffer();
+    out.close();
+    if (out.has_error()) {
+      out.clear_error();
+      llvm::sys::fs::remove(temp_path);
+      return;
+    }
+  }
+  if (llvm::sys::fs::rename(temp_path, path_)) {
+    llvm::sys::fs::remove(temp_path);
+  }
+}
+
+std::unique_ptr<llvm::MemoryBuffer> DiskObjectCache::getObject(
+    const llvm::Module* module) {
+  auto buffer_or_error = llvm::MemoryBuffer::getFile(path_);
+  if (!buffer_or_error) {
+    return nullptr;
+  }
+  return std::move(buffer_or_error.get());
+}
+
+}  // namespace gandiva
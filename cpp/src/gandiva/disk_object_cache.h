@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef GANDIVA_DISK_OBJECT_CACHE_H
+#define GANDIVA_DISK_OBJECT_CACHE_H
+
+#include <memory>
+#include <string>
+
+#include "gandiva/llvm_includes.h"
+#include "gandiva/visibility.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4141)
+#pragma warning(disable : 4146)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#pragma warning(disable : 4624)
+#endif
+
+#include <llvm/ExecutionEngine/ObjectCache.h>
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+namespace gandiva {
+
+/// \brief Caches the object code of a compiled module in a directory, so
+/// that processes building the same module load the code instead of
+/// optimising and compiling the IR again.
+///
+/// The object code is stored in <dir>/<key>.o, where the key is a hash of
+/// the unoptimised IR of the module and of the target it is compiled for.
+/// The IR covers the expressions, the types of the schema fields they use
+/// and the pre-compiled functions they call.
+class GANDIVA_EXPORT DiskObjectCache : public llvm::ObjectCache {
+ public:
+  /// \param[in] dir the cache directory
+  /// \param[in] key the key of the module, from MakeKey()
+  DiskObjectCache(const std::string& dir, const std::string& key);
+
+  /// Compute the key of a module about to be compiled by the target machine.
+  static std::string MakeKey(const llvm::Module& module, bool optimise_ir,
+                             const llvm::TargetMachine& target_machine);
+
+  /// \return true if the object code of the module is in the cache.
+  bool Contains() const;
+
+  void notifyObjectCompiled(const llvm::Module* module,
+                            llvm::MemoryBufferRef object) override;
+
+  std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override;
+
+ private:
+  std::string path_;
+};
+
+}  // namespace gandiva
+
+#endif  // GANDIVA_DISK_OBJECT_CACHE_H
@@ -28,6 +28,7 @@
 #include <string>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -42,11 +43,14 @@
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/Bitcode/BitcodeReader.h>
 #include <llvm/ExecutionEngine/MCJIT.h>
+#include <llvm/ExecutionEngine/SectionMemoryManager.h>
 #include <llvm/IR/DataLayout.h>
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/IR/Verifier.h>
 #include <llvm/Linker/Linker.h>
+#include <llvm/MC/MCSubtargetInfo.h>
 #include <llvm/Support/DynamicLibrary.h>
+#include <llvm/Support/Host.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Transforms/IPO.h>
@@ -71,6 +75,30 @@ extern const size_t kPrecompiledBitcodeSize;
 
 std::once_flag init_once_flag;
 
+// Memory manager of the JIT that counts the bytes of the sections it allocates.
+class CodeSizeMemoryManager : public llvm::SectionMemoryManager {
+ public:
+  uint8_t* allocateCodeSection(uintptr_t size, unsigned alignment, unsigned section_id,
+                               llvm::StringRef section_name) override {
+    code_size_ += size;
+    return llvm::SectionMemoryManager::allocateCodeSection(size, alignment, section_id,
+                                                           section_name);
+  }
+
+  uint8_t* allocateDataSection(uintptr_t size, unsigned alignment, unsigned section_id,
+                               llvm::StringRef section_name,
+                               bool is_read_only) override {
+    code_size_ += size;
+    return llvm::SectionMemoryManager::allocateDataSection(
+        size, alignment, section_id, section_name, is_read_only);
+  }
+
+  int64_t code_size() const { return code_size_; }
+
+ private:
+  int64_t code_size_ = 0;
+};
+
 bool Engine::init_once_done_ = false;
 std::set<std::string> Engine::loaded_libs_ = {};
 std::mutex Engine::mtx_;
@@ -89,10 +117,42 @@ void Engine::InitOnce() {
   init_once_done_ = true;
 }
 
+// Get the CPU and features to generate code for. The host's are detected by
+// LLVM, which knows about many more features, e.g. AVX-512 and its subsets,
+// than arrow::internal::CpuInfo does.
+static void GetTarget(const Configuration& config, std::string* cpu,
+                      std::vector<std::string>* features) {
+  if (config.target_cpu().empty()) {
+    *cpu = llvm::sys::getHostCPUName().str();
+    llvm::StringMap<bool> host_features;
+    if (llvm::sys::getHostCPUFeatures(host_features)) {
+      for (auto& feature : host_features) {
+        features->push_back((feature.getValue() ? "+" : "-") + feature.getKey().str());
+      }
+    }
+  } else {
+    *cpu = config.target_cpu();
+  }
+
+  std::stringstream ss(config.target_features());
+  std::string feature;
+  while (std::getline(ss, feature, ',')) {
+    if (!feature.empty()) {
+      features->push_back(feature);
+    }
+  }
+}
+
 /// factory method to construct the engine.
 Status Engine::Make(std::shared_ptr<Configuration> config,
                     std::unique_ptr<Engine>* engine) {
+  return Make(config, true, engine);
+}
+
+Status Engine::Make(std::shared_ptr<Configuration> config, bool optimise_code,
+                    std::unique_ptr<Engine>* engine) {
   std::unique_ptr<Engine> engine_obj(new Engine());
+  engine_obj->object_cache_dir_ = config->object_cache_dir();
 
   std::call_once(init_once_flag, [&engine_obj] { engine_obj->InitOnce(); });
   engine_obj->context_.reset(new llvm::LLVMContext());
@@ -106,13 +166,27 @@ Status Engine::Make(std::shared_ptr<Configuration> config,
 
   llvm::EngineBuilder engineBuilder(std::move(cg_module));
   engineBuilder.setEngineKind(llvm::EngineKind::JIT);
-  engineBuilder.setOptLevel(llvm::CodeGenOpt::Aggressive);
+  engineBuilder.setOptLevel(optimise_code ? llvm::CodeGenOpt::Aggressive
+                                          : llvm::CodeGenOpt::None);
   engineBuilder.setErrorStr(&(engine_obj->llvm_error_));
+  std::string cpu;
+  std::vector<std::string> features;
+  GetTarget(*config, &cpu, &features);
+  engineBuilder.setMCPU(cpu);
+  engineBuilder.setMAttrs(features);
+  std::unique_ptr<CodeSizeMemoryManager> memory_manager(new CodeSizeMemoryManager());
+  engine_obj->memory_manager_ = memory_manager.get();
+  engineBuilder.setMCJITMemoryManager(std::move(memory_manager));
   engine_obj->execution_engine_.reset(engineBuilder.create());
   if (engine_obj->execution_engine_ == NULL) {
     engine_obj->module_ = NULL;
     return Status::CodeGenError(engine_obj->llvm_error_);
   }
+  ARROW_RETURN_IF(
+      !engine_obj->execution_engine_->getTargetMachine()
+           ->getMCSubtargetInfo()
+           ->isCPUStringValid(cpu),
+      Status::Invalid("Unknown target CPU ", cpu));
 
   // Add mappings for functions that can be accessed from LLVM/IR module.
   engine_obj->AddGlobalMappings();
@@ -154,6 +228,26 @@ Status Engine::LoadPreCompiledIR() {
   }
   std::unique_ptr<llvm::Module> ir_module = move(module_or_error.get());
 
+  // The pre-compiled functions are generic, like the build of gandiva. Compile
+  // them for the target of the generated code instead, so that they are
+  // vectorized with its instructions, and can be inlined in the generated code.
+  auto target_machine = execution_engine_->getTargetMachine();
+  std::string cpu = target_machine->getTargetCPU().str();
+  std::string features = target_machine->getTargetFeatureString().str();
+  for (auto& function : *ir_module) {
+    if (function.hasFnAttribute("target-cpu")) {
+      function.addFnAttr("target-cpu", cpu);
+    }
+    if (function.hasFnAttribute("target-features") && !features.empty()) {
+      std::string function_features =
+          function.getFnAttribute("target-features").getValueAsString().str();
+      if (!function_features.empty()) {
+        function_features += ",";
+      }
+      function.addFnAttr("target-features", function_features + features);
+    }
+  }
+
   ARROW_RETURN_IF(llvm::verifyModule(*ir_module, &llvm::errs()),
                   Status::CodeGenError("verify of IR Module failed"));
   ARROW_RETURN_IF(llvm::Linker::linkModules(*module_, move(ir_module)),
@@ -195,7 +289,19 @@ Status Engine::FinalizeModule(bool optimise_ir, bool dump_ir) {
     DumpIR("Before optimise");
   }
 
-  if (optimise_ir) {
+  // The module is compiled the same way whenever its IR is, so its object code
+  // can be cached across processes.
+  bool cached = false;
+  if (!object_cache_dir_.empty()) {
+    auto key = DiskObjectCache::MakeKey(*module_, optimise_ir,
+                                        *execution_engine_->getTargetMachine());
+    object_cache_.reset(new DiskObjectCache(object_cache_dir_, key));
+    execution_engine_->setObjectCache(object_cache_.get());
+    // finalizeObject() loads the object code instead of compiling the module.
+    cached = object_cache_->Contains();
+  }
+
+  if (optimise_ir && !cached) {
     // misc passes to allow for inlining, vectorization, ..
     std::unique_ptr<llvm::legacy::PassManager> pass_manager(
         new llvm::legacy::PassManager());
@@ -239,6 +345,16 @@ void* Engine::CompiledFunction(llvm::Function* irFunction) {
   return execution_engine_->getPointerToFunction(irFunction);
 }
 
+int64_t Engine::code_size() const { return memory_manager_->code_size(); }
+
+std::string Engine::target_cpu() const {
+  return execution_engine_->getTargetMachine()->getTargetCPU().str();
+}
+
+std::string Engine::target_features() const {
+  return execution_engine_->getTargetMachine()->getTargetFeatureString().str();
+}
+
 void Engine::AddGlobalMappingForFunc(const std::string& name, llvm::Type* ret_type,
                                      const std::vector<llvm::Type*>& args,
                                      void* function_ptr) {
@@ -27,6 +27,7 @@
 #include "arrow/util/macros.h"
 
 #include "gandiva/configuration.h"
+#include "gandiva/disk_object_cache.h"
 #include "gandiva/llvm_includes.h"
 #include "gandiva/llvm_types.h"
 #include "gandiva/logging.h"
@@ -34,6 +35,7 @@
 
 namespace gandiva {
 
+class CodeSizeMemoryManager;
 class FunctionIRBuilder;
 
 /// \brief LLVM Execution engine wrapper.
@@ -51,6 +53,15 @@ class GANDIVA_EXPORT Engine {
   static Status Make(std::shared_ptr<Configuration> config,
                      std::unique_ptr<Engine>* engine);
 
+  /// Factory method to create and initialize the engine object.
+  ///
+  /// \param[in] config the engine configuration
+  /// \param[in] optimise_code false to generate machine code quickly, without
+  ///            optimising it
+  /// \param[out] engine the created engine
+  static Status Make(std::shared_ptr<Configuration> config, bool optimise_code,
+                     std::unique_ptr<Engine>* engine);
+
   /// Add the function to the list of IR functions that need to be compiled.
   /// Compiling only the functions that are used by the module saves time.
   void AddFunctionToCompile(const std::string& fname) {
@@ -64,6 +75,15 @@ class GANDIVA_EXPORT Engine {
   /// Get the compiled function corresponding to the irfunction.
   void* CompiledFunction(llvm::Function* irFunction);
 
+  /// The number of bytes of the sections of the compiled code.
+  int64_t code_size() const;
+
+  /// The CPU code is generated for.
+  std::string target_cpu() const;
+
+  /// The features enabled or disabled on top of those of the target CPU.
+  std::string target_features() const;
+
   // Create and add a mapping for the cpp function to make it accessible from LLVM.
   void AddGlobalMappingForFunc(const std::string& name, llvm::Type* ret_type,
                                const std::vector<llvm::Type*>& args, void* func);
@@ -71,7 +91,7 @@ class GANDIVA_EXPORT Engine {
  private:
   /// private constructor to ensure engine is created
   /// only through the factory.
-  Engine() : module_finalized_(false) {}
+  Engine() : memory_manager_(NULLPTR), module_finalized_(false) {}
 
   /// do one time inits.
   static void InitOnce();
@@ -93,7 +113,10 @@ class GANDIVA_EXPORT Engine {
   void DumpIR(std::string prefix);
 
   std::unique_ptr<llvm::LLVMContext> context_;
+  // Declared before the execution engine, which refers to it until destroyed.
+  std::unique_ptr<DiskObjectCache> object_cache_;
   std::unique_ptr<llvm::ExecutionEngine> execution_engine_;
+  CodeSizeMemoryManager* memory_manager_;  // owned by the execution_engine_
   std::unique_ptr<LLVMTypes> types_;
   std::unique_ptr<llvm::IRBuilder<>> ir_builder_;
   llvm::Module* module_;  // This is owned by the execution_engine_, so doesn't need to be
@@ -103,6 +126,7 @@ class GANDIVA_EXPORT Engine {
 
   bool module_finalized_;
   std::string llvm_error_;
+  std::string object_cache_dir_;
 
   static std::set<std::string> loaded_libs_;
   static std::mutex mtx_;
@@ -18,6 +18,8 @@
 #include "gandiva/engine.h"
 
 #include <gtest/gtest.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Host.h>
 #include "gandiva/llvm_types.h"
 #include "gandiva/tests/test_util.h"
 
@@ -130,6 +132,68 @@ TEST_F(TestEngine, TestAddOptimised) {
   EXPECT_EQ(add_func(my_array, 5), 17);
 }
 
+TEST_F(TestEngine, TestAddCachedObject) {
+  llvm::SmallString<128> cache_dir;
+  ASSERT_FALSE(llvm::sys::fs::createUniqueDirectory("gandiva-object-cache", cache_dir));
+  auto config = ConfigurationBuilder().set_object_cache_dir(cache_dir.str()).build();
+
+  // The first engine compiles the module and caches its object code, which the
+  // second one loads.
+  for (int i = 0; i < 2; ++i) {
+    std::unique_ptr<Engine> engine;
+    auto status = Engine::Make(config, &engine);
+    EXPECT_TRUE(status.ok()) << status.message();
+    LLVMTypes types(*engine->context());
+    llvm::Function* ir_func = BuildVecAdd(engine.get(), &types);
+    status = engine->FinalizeModule(true, false);
+    EXPECT_TRUE(status.ok()) << status.message();
+
+    add_vector_func_t add_func =
+        reinterpret_cast<add_vector_func_t>(engine->CompiledFunction(ir_func));
+
+    int64_t my_array[] = {1, 3, -5, 8, 10};
+    EXPECT_EQ(add_func(my_array, 5), 17);
+
+    int num_objects = 0;
+    std::error_code error;
+    for (llvm::sys::fs::directory_iterator it(cache_dir, error), end;
+         it != end && !error; it.increment(error)) {
+      ++num_objects;
+    }
+    EXPECT_EQ(num_objects, 1);
+  }
+
+  llvm::sys::fs::remove_directories(cache_dir);
+}
+
+TEST_F(TestEngine, TestTargetCpu) {
+  // The host CPU by default.
+  std::unique_ptr<Engine> engine;
+  auto status = Engine::Make(TestConfiguration(), &engine);
+  EXPECT_TRUE(status.ok()) << status.message();
+  EXPECT_EQ(engine->target_cpu(), llvm::sys::getHostCPUName().str());
+
+  // A forced CPU, which generates the same code on all hosts.
+  auto config = ConfigurationBuilder().set_target_cpu("generic").build();
+  status = Engine::Make(config, &engine);
+  EXPECT_TRUE(status.ok()) << status.message();
+  EXPECT_EQ(engine->target_cpu(), "generic");
+  EXPECT_EQ(engine->target_features(), "");
+
+  LLVMTypes types(*engine->context());
+  llvm::Function* ir_func = BuildVecAdd(engine.get(), &types);
+  status = engine->FinalizeModule(true, false);
+  EXPECT_TRUE(status.ok()) << status.message();
+  add_vector_func_t add_func =
+      reinterpret_cast<add_vector_func_t>(engine->CompiledFunction(ir_func));
+  int64_t my_array[] = {1, 3, -5, 8, 10};
+  EXPECT_EQ(add_func(my_array, 5), 17);
+
+  config = ConfigurationBuilder().set_target_cpu("no-such-cpu").build();
+  status = Engine::Make(config, &engine);
+  EXPECT_TRUE(status.IsInvalid()) << status.message();
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
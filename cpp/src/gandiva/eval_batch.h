@@ -19,6 +19,7 @@
 #define GANDIVA_EXPR_EVALBATCH_H
 
 #include <memory>
+#include <vector>
 
 #include "arrow/util/logging.h"
 
@@ -75,6 +76,15 @@ class EvalBatch {
 
   ExecutionContext* GetExecutionContext() const { return execution_context_.get(); }
 
+  /// Allocate a zeroed buffer that lives as long as the batch, 64-bit aligned.
+  uint8_t* AllocateBuffer(int64_t size) {
+    int64_t num_words = (size + 7) >> 3;
+    std::unique_ptr<uint64_t[]> buffer(new uint64_t[num_words]());
+    uint8_t* data = reinterpret_cast<uint8_t*>(buffer.get());
+    buffers_.push_back(std::move(buffer));
+    return data;
+  }
+
  private:
   /// number of records in the current batch.
   int64_t num_records_;
@@ -90,6 +100,9 @@ class EvalBatch {
   std::unique_ptr<LocalBitMapsHolder> local_bitmaps_holder_;
 
   std::unique_ptr<ExecutionContext> execution_context_;
+
+  /// Buffers allocated for the batch, e.g. for temporary fields.
+  std::vector<std::unique_ptr<uint64_t[]>> buffers_;
 };
 
 }  // namespace gandiva
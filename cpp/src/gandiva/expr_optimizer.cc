@@ -0,0 +1,400 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/expr_optimizer.h"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+namespace {
+
+const char kTempFieldPrefix[] = "__gandiva_temp_";
+
+// Get the children of a node, and whether each is evaluated for all the rows
+// the node is evaluated for.
+void GetChildren(const Node& node, NodeVector* children, std::vector<bool>* unconditional) {
+  if (auto function = dynamic_cast<const FunctionNode*>(&node)) {
+    *children = function->children();
+    unconditional->assign(children->size(), true);
+  } else if (auto if_node = dynamic_cast<const IfNode*>(&node)) {
+    *children = {if_node->condition(), if_node->then_node(), if_node->else_node()};
+    *unconditional = {true, false, false};
+  } else if (auto boolean = dynamic_cast<const BooleanNode*>(&node)) {
+    // The operands after the first are short-circuited.
+    *children = boolean->children();
+    unconditional->assign(children->size(), false);
+    if (!unconditional->empty()) {
+      (*unconditional)[0] = true;
+    }
+  } else if (auto in32 = dynamic_cast<const InExpressionNode<int32_t>*>(&node)) {
+    *children = {in32->eval_expr()};
+    *unconditional = {true};
+  } else if (auto in64 = dynamic_cast<const InExpressionNode<int64_t>*>(&node)) {
+    *children = {in64->eval_expr()};
+    *unconditional = {true};
+  } else if (auto in_str = dynamic_cast<const InExpressionNode<std::string>*>(&node)) {
+    *children = {in_str->eval_expr()};
+    *unconditional = {true};
+  } else {
+    children->clear();
+    unconditional->clear();
+  }
+}
+
+// Make a copy of a node with other children.
+NodePtr WithChildren(const NodePtr& node, const NodeVector& children) {
+  if (auto function = dynamic_cast<const FunctionNode*>(node.get())) {
+    return TreeExprBuilder::MakeFunction(function->descriptor()->name(), children,
+                                         function->return_type());
+  } else if (dynamic_cast<const IfNode*>(node.get()) != nullptr) {
+    return TreeExprBuilder::MakeIf(children[0], children[1], children[2],
+                                   node->return_type());
+  } else if (auto boolean = dynamic_cast<const BooleanNode*>(node.get())) {
+    return std::make_shared<BooleanNode>(boolean->expr_type(), children);
+  } else if (auto in32 = dynamic_cast<const InExpressionNode<int32_t>*>(node.get())) {
+    return std::make_shared<InExpressionNode<int32_t>>(children[0], in32->values());
+  } else if (auto in64 = dynamic_cast<const InExpressionNode<int64_t>*>(node.get())) {
+    return std::make_shared<InExpressionNode<int64_t>>(children[0], in64->values());
+  } else if (auto in_str = dynamic_cast<const InExpressionNode<std::string>*>(node.get())) {
+    return std::make_shared<InExpressionNode<std::string>>(children[0], in_str->values());
+  }
+  return node;
+}
+
+bool IsLeaf(const Node& node) {
+  return dynamic_cast<const FieldNode*>(&node) != nullptr ||
+         dynamic_cast<const LiteralNode*>(&node) != nullptr;
+}
+
+// Whether literals of the type can be made from a value.
+bool IsFoldableType(const arrow::DataType& type) {
+  switch (type.id()) {
+    case arrow::Type::BOOL:
+    case arrow::Type::INT8:
+    case arrow::Type::INT16:
+    case arrow::Type::INT32:
+    case arrow::Type::INT64:
+    case arrow::Type::UINT8:
+    case arrow::Type::UINT16:
+    case arrow::Type::UINT32:
+    case arrow::Type::UINT64:
+    case arrow::Type::FLOAT:
+    case arrow::Type::DOUBLE:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Whether the value of a subtree can be kept in a temporary field.
+bool IsTempCandidate(const Node& node) {
+  return !IsLeaf(node) &&
+         dynamic_cast<const arrow::FixedWidthType*>(node.return_type().get()) != nullptr;
+}
+
+template <typename ArrowType>
+NodePtr MakeNumericLiteral(const arrow::Array& array) {
+  return TreeExprBuilder::MakeLiteral(
+      static_cast<const arrow::NumericArray<ArrowType>&>(array).Value(0));
+}
+
+// Make a literal from the first value of an array.
+NodePtr MakeLiteral(const arrow::Array& array) {
+  if (array.IsNull(0)) {
+    return TreeExprBuilder::MakeNull(array.type());
+  }
+  switch (array.type_id()) {
+    case arrow::Type::BOOL:
+      return TreeExprBuilder::MakeLiteral(
+          static_cast<const arrow::BooleanArray&>(array).Value(0));
+    case arrow::Type::INT8:
+      return MakeNumericLiteral<arrow::Int8Type>(array);
+    case arrow::Type::INT16:
+      return MakeNumericLiteral<arrow::Int16Type>(array);
+    case arrow::Type::INT32:
+      return MakeNumericLiteral<arrow::Int32Type>(array);
+    case arrow::Type::INT64:
+      return MakeNumericLiteral<arrow::Int64Type>(array);
+    case arrow::Type::UINT8:
+      return MakeNumericLiteral<arrow::UInt8Type>(array);
+    case arrow::Type::UINT16:
+      return MakeNumericLiteral<arrow::UInt16Type>(array);
+    case arrow::Type::UINT32:
+      return MakeNumericLiteral<arrow::UInt32Type>(array);
+    case arrow::Type::UINT64:
+      return MakeNumericLiteral<arrow::UInt64Type>(array);
+    case arrow::Type::FLOAT:
+      return MakeNumericLiteral<arrow::FloatType>(array);
+    case arrow::Type::DOUBLE:
+      return MakeNumericLiteral<arrow::DoubleType>(array);
+    default:
+      return nullptr;
+  }
+}
+
+template <typename Type>
+std::vector<std::string> SortedValues(const std::unordered_set<Type>& values) {
+  std::vector<std::string> sorted;
+  for (auto& value : values) {
+    std::stringstream ss;
+    ss << value;
+    sorted.push_back(ss.str());
+  }
+  std::sort(sorted.begin(), sorted.end());
+  return sorted;
+}
+
+}  // namespace
+
+bool ExprOptimizer::IsTempField(const arrow::Field& field) {
+  return field.name().compare(0, sizeof(kTempFieldPrefix) - 1, kTempFieldPrefix) == 0;
+}
+
+const std::string& ExprOptimizer::Key(const NodePtr& node) {
+  auto found = keys_.find(node.get());
+  if (found != keys_.end()) {
+    return found->second;
+  }
+
+  // Each part is prefixed by its length, so that the values of string literals
+  // can't be mistaken for the structure of the tree.
+  std::stringstream ss;
+  auto append = [&ss](const std::string& part) { ss << part.size() << ":" << part; };
+
+  std::vector<std::string> values;
+  if (auto function = dynamic_cast<const FunctionNode*>(node.get())) {
+    append("fn " + function->descriptor()->name());
+  } else if (dynamic_cast<const IfNode*>(node.get()) != nullptr) {
+    append("if");
+  } else if (auto boolean = dynamic_cast<const BooleanNode*>(node.get())) {
+    append(boolean->expr_type() == BooleanNode::AND ? "and" : "or");
+  } else if (auto in32 = dynamic_cast<const InExpressionNode<int32_t>*>(node.get())) {
+    append("in");
+    values = SortedValues(in32->values());
+  } else if (auto in64 = dynamic_cast<const InExpressionNode<int64_t>*>(node.get())) {
+    append("in");
+    values = SortedValues(in64->values());
+  } else if (auto in_str = dynamic_cast<const InExpressionNode<std::string>*>(node.get())) {
+    append("in");
+    values = SortedValues(in_str->values());
+  } else {
+    // Fields and literals
+    append(node->ToString());
+  }
+  append(node->return_type()->ToString());
+  ss << values.size() << "[";
+  for (auto& value : values) {
+    append(value);
+  }
+
+  NodeVector children;
+  std::vector<bool> unconditional;
+  GetChildren(*node, &children, &unconditional);
+  ss << "]" << children.size() << "(";
+  for (auto& child : children) {
+    append(Key(child));
+  }
+  ss << ")";
+  return keys_.emplace(node.get(), ss.str()).first->second;
+}
+
+bool ExprOptimizer::IsConstant(const NodePtr& node) {
+  if (dynamic_cast<const LiteralNode*>(node.get()) != nullptr) {
+    return true;
+  }
+  NodeVector children;
+  std::vector<bool> unconditional;
+  GetChildren(*node, &children, &unconditional);
+  // Fields are not constant, and neither are functions without arguments.
+  if (children.empty()) {
+    return false;
+  }
+  for (auto& child : children) {
+    if (!IsConstant(child)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ExprOptimizer::CollectConstants(const NodePtr& node,
+                                     std::vector<NodePtr>* constants) {
+  if (IsLeaf(*node)) {
+    return;
+  }
+  if (IsFoldableType(*node->return_type()) && IsConstant(node)) {
+    constants->push_back(node);
+    return;
+  }
+  NodeVector children;
+  std::vector<bool> unconditional;
+  GetChildren(*node, &children, &unconditional);
+  for (auto& child : children) {
+    CollectConstants(child, constants);
+  }
+}
+
+NodePtr ExprOptimizer::ReplaceConstants(
+    const NodePtr& node, const std::unordered_map<std::string, NodePtr>& literals) {
+  if (IsLeaf(*node)) {
+    return node;
+  }
+  auto found = literals.find(Key(node));
+  if (found != literals.end()) {
+    return found->second;
+  }
+  NodeVector children;
+  std::vector<bool> unconditional;
+  GetChildren(*node, &children, &unconditional);
+  for (auto& child : children) {
+    child = ReplaceConstants(child, literals);
+  }
+  return WithChildren(node, children);
+}
+
+Status ExprOptimizer::FoldConstants(const ExpressionVector& exprs,
+                                    ExpressionVector* folded) {
+  *folded = exprs;
+
+  std::vector<NodePtr> constants;
+  for (auto& expr : exprs) {
+    CollectConstants(expr->root(), &constants);
+  }
+  if (constants.empty()) {
+    return Status::OK();
+  }
+
+  // Evaluate each distinct subtree once.
+  std::vector<std::string> keys;
+  ExpressionVector constant_exprs;
+  std::unordered_set<std::string> seen;
+  for (auto& node : constants) {
+    const std::string& key = Key(node);
+    if (seen.insert(key).second) {
+      auto field = arrow::field("const_" + std::to_string(keys.size()),
+                                node->return_type());
+      keys.push_back(key);
+      constant_exprs.push_back(TreeExprBuilder::MakeExpression(node, field));
+    }
+  }
+
+  // If the evaluation fails, e.g. on a division by zero, the subtrees are
+  // evaluated per row as written, and fail then.
+  arrow::ArrayVector values;
+  if (!evaluator_(constant_exprs, &values).ok()) {
+    return Status::OK();
+  }
+  DCHECK_EQ(values.size(), keys.size());
+
+  std::unordered_map<std::string, NodePtr> literals;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    auto literal = MakeLiteral(*values[i]);
+    if (literal != nullptr) {
+      literals[keys[i]] = literal;
+    }
+  }
+
+  folded->clear();
+  for (auto& expr : exprs) {
+    folded->push_back(TreeExprBuilder::MakeExpression(
+        ReplaceConstants(expr->root(), literals), expr->result()));
+  }
+  return Status::OK();
+}
+
+void ExprOptimizer::CountSubexpressions(const NodePtr& node) {
+  if (IsTempCandidate(*node)) {
+    // The subtrees of a repeated subexpression were counted with its first
+    // evaluation, and won't be evaluated again.
+    if (++counts_[Key(node)] > 1) {
+      return;
+    }
+  }
+  NodeVector children;
+  std::vector<bool> unconditional;
+  GetChildren(*node, &children, &unconditional);
+  for (size_t i = 0; i < children.size(); ++i) {
+    if (unconditional[i]) {
+      CountSubexpressions(children[i]);
+    }
+  }
+}
+
+NodePtr ExprOptimizer::ReplaceSubexpressions(const NodePtr& node,
+                                             ExpressionVector* temp_exprs) {
+  if (IsLeaf(*node)) {
+    return node;
+  }
+
+  bool shared = false;
+  if (IsTempCandidate(*node)) {
+    const std::string& key = Key(node);
+    auto found = temp_fields_.find(key);
+    if (found != temp_fields_.end()) {
+      return TreeExprBuilder::MakeField(found->second);
+    }
+    auto count = counts_.find(key);
+    shared = count != counts_.end() && count->second > 1;
+  }
+
+  // The temporary fields the node refers to are computed before it.
+  NodeVector children;
+  std::vector<bool> unconditional;
+  GetChildren(*node, &children, &unconditional);
+  for (auto& child : children) {
+    child = ReplaceSubexpressions(child, temp_exprs);
+  }
+  NodePtr rewritten = WithChildren(node, children);
+  if (!shared) {
+    return rewritten;
+  }
+
+  auto field = arrow::field(kTempFieldPrefix + std::to_string(temp_fields_.size()),
+                            node->return_type());
+  temp_exprs->push_back(TreeExprBuilder::MakeExpression(rewritten, field));
+  temp_fields_[Key(node)] = field;
+  return TreeExprBuilder::MakeField(field);
+}
+
+Status ExprOptimizer::Optimize(const ExpressionVector& exprs,
+                               ExpressionVector* temp_exprs,
+                               ExpressionVector* out_exprs) {
+  // The keys are memoised by address, and the nodes of a previous call may
+  // have been freed.
+  keys_.clear();
+  counts_.clear();
+  temp_fields_.clear();
+
+  ExpressionVector folded;
+  ARROW_RETURN_NOT_OK(FoldConstants(exprs, &folded));
+
+  for (auto& expr : folded) {
+    CountSubexpressions(expr->root());
+  }
+  for (auto& expr : folded) {
+    out_exprs->push_back(TreeExprBuilder::MakeExpression(
+        ReplaceSubexpressions(expr->root(), temp_exprs), expr->result()));
+  }
+  return Status::OK();
+}
+
+}  // namespace gandiva
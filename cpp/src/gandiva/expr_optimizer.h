@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef GANDIVA_EXPR_OPTIMIZER_H
+#define GANDIVA_EXPR_OPTIMIZER_H
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "arrow/status.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/expression.h"
+#include "gandiva/gandiva_aliases.h"
+#include "gandiva/node.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Rewrites the expressions of a projector or filter before code is
+/// generated for them.
+///
+/// 1. Subtrees that only refer to literals, and return a boolean or a number,
+///    are evaluated once and replaced by literals.
+/// 2. Subexpressions that are evaluated at least twice for every row, in one
+///    or several of the expressions, are replaced by temporary fields. These
+///    are computed once per batch, before the expressions. Subexpressions in
+///    the branches of if-else and the short-circuited operands of and/or are
+///    not moved to temporary fields, since computing them for all rows could
+///    raise errors. They reuse a temporary field computed for other reasons,
+///    though. Only fixed-width results are kept in temporary fields.
+class GANDIVA_EXPORT ExprOptimizer {
+ public:
+  /// Evaluates expressions without fields on a single row, returning arrays of
+  /// length 1.
+  using ConstantEvaluator =
+      std::function<Status(const ExpressionVector& exprs, arrow::ArrayVector* values)>;
+
+  explicit ExprOptimizer(ConstantEvaluator evaluator) : evaluator_(evaluator) {}
+
+  /// \brief Rewrite the expressions.
+  ///
+  /// \param[in] exprs the expressions
+  /// \param[out] temp_exprs the expressions of the temporary fields, in the order
+  ///             they must be computed
+  /// \param[out] out_exprs the rewritten expressions, in the same order as exprs
+  Status Optimize(const ExpressionVector& exprs, ExpressionVector* temp_exprs,
+                  ExpressionVector* out_exprs);
+
+  /// \return true if the field is a temporary field introduced by Optimize().
+  static bool IsTempField(const arrow::Field& field);
+
+ private:
+  /// Unambiguous structural key of a subtree.
+  const std::string& Key(const NodePtr& node);
+
+  /// Replace the subtrees of literals by the literals they evaluate to.
+  Status FoldConstants(const ExpressionVector& exprs, ExpressionVector* folded);
+  void CollectConstants(const NodePtr& node, std::vector<NodePtr>* constants);
+  bool IsConstant(const NodePtr& node);
+  NodePtr ReplaceConstants(const NodePtr& node,
+                           const std::unordered_map<std::string, NodePtr>& literals);
+
+  /// Count the unconditional evaluations of the subtrees.
+  void CountSubexpressions(const NodePtr& node);
+
+  /// Replace the shared subtrees by temporary fields.
+  NodePtr ReplaceSubexpressions(const NodePtr& node, ExpressionVector* temp_exprs);
+
+  ConstantEvaluator evaluator_;
+  std::unordered_map<const Node*, std::string> keys_;
+  std::unordered_map<std::string, int> counts_;
+  std::unordered_map<std::string, FieldPtr> temp_fields_;
+};
+
+}  // namespace gandiva
+
+#endif  // GANDIVA_EXPR_OPTIMIZER_H
@@ -0,0 +1,196 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/expr_optimizer.h"
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "gandiva/tests/test_util.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+using arrow::int32;
+
+class TestExprOptimizer : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    field_a_ = arrow::field("a", int32());
+    field_b_ = arrow::field("b", int32());
+    field_c_ = arrow::field("c", int32());
+    num_evaluations_ = 0;
+  }
+
+  // Evaluates every constant to 3.
+  ExprOptimizer::ConstantEvaluator EvaluateToThree() {
+    return [this](const ExpressionVector& exprs, arrow::ArrayVector* values) {
+      num_evaluations_ += static_cast<int>(exprs.size());
+      for (size_t i = 0; i < exprs.size(); ++i) {
+        values->push_back(MakeArrowArrayInt32({3}, {true}));
+      }
+      return Status::OK();
+    };
+  }
+
+  NodePtr Add(NodePtr left, NodePtr right) {
+    return TreeExprBuilder::MakeFunction("add", {left, right}, int32());
+  }
+
+  FieldPtr field_a_;
+  FieldPtr field_b_;
+  FieldPtr field_c_;
+  int num_evaluations_;
+};
+
+TEST_F(TestExprOptimizer, TestSharedSubexpression) {
+  auto node_a = TreeExprBuilder::MakeField(field_a_);
+  auto node_b = TreeExprBuilder::MakeField(field_b_);
+  auto node_c = TreeExprBuilder::MakeField(field_c_);
+
+  // (a + b) + c and (a + b) + (a + b)
+  auto expr0 = TreeExprBuilder::MakeExpression(Add(Add(node_a, node_b), node_c),
+                                               arrow::field("out0", int32()));
+  auto expr1 = TreeExprBuilder::MakeExpression(
+      Add(Add(node_a, node_b), Add(node_a, node_b)), arrow::field("out1", int32()));
+
+  ExprOptimizer optimizer(EvaluateToThree());
+  ExpressionVector temp_exprs;
+  ExpressionVector out_exprs;
+  auto status = optimizer.Optimize({expr0, expr1}, &temp_exprs, &out_exprs);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  ASSERT_EQ(temp_exprs.size(), 1);
+  auto temp_field = temp_exprs[0]->result();
+  EXPECT_TRUE(ExprOptimizer::IsTempField(*temp_field));
+  EXPECT_EQ(temp_exprs[0]->root()->ToString(), Add(node_a, node_b)->ToString());
+
+  auto node_temp = TreeExprBuilder::MakeField(temp_field);
+  ASSERT_EQ(out_exprs.size(), 2);
+  EXPECT_EQ(out_exprs[0]->result(), expr0->result());
+  EXPECT_EQ(out_exprs[0]->root()->ToString(), Add(node_temp, node_c)->ToString());
+  EXPECT_EQ(out_exprs[1]->root()->ToString(), Add(node_temp, node_temp)->ToString());
+  EXPECT_EQ(num_evaluations_, 0);
+}
+
+TEST_F(TestExprOptimizer, TestConditionalSubexpression) {
+  auto node_a = TreeExprBuilder::MakeField(field_a_);
+  auto node_b = TreeExprBuilder::MakeField(field_b_);
+  auto node_c = TreeExprBuilder::MakeField(field_c_);
+
+  // a / b is only evaluated when b != 0, so it must not be computed for all rows.
+  auto divide = TreeExprBuilder::MakeFunction("divide", {node_a, node_b}, int32());
+  auto condition = TreeExprBuilder::MakeFunction(
+      "not_equal", {node_b, TreeExprBuilder::MakeLiteral(static_cast<int32_t>(0))},
+      arrow::boolean());
+  auto if0 = TreeExprBuilder::MakeIf(condition, divide, node_a, int32());
+  auto if1 = TreeExprBuilder::MakeIf(condition, divide, node_c, int32());
+  auto expr0 = TreeExprBuilder::MakeExpression(if0, arrow::field("out0", int32()));
+  auto expr1 = TreeExprBuilder::MakeExpression(if1, arrow::field("out1", int32()));
+
+  ExprOptimizer optimizer(EvaluateToThree());
+  ExpressionVector temp_exprs;
+  ExpressionVector out_exprs;
+  auto status = optimizer.Optimize({expr0, expr1}, &temp_exprs, &out_exprs);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Only the condition is shared.
+  ASSERT_EQ(temp_exprs.size(), 1);
+  EXPECT_EQ(temp_exprs[0]->root()->ToString(), condition->ToString());
+  EXPECT_NE(out_exprs[0]->root()->ToString().find("divide"), std::string::npos);
+  EXPECT_NE(out_exprs[1]->root()->ToString().find("divide"), std::string::npos);
+}
+
+TEST_F(TestExprOptimizer, TestFoldConstants) {
+  auto node_a = TreeExprBuilder::MakeField(field_a_);
+  auto one = TreeExprBuilder::MakeLiteral(static_cast<int32_t>(1));
+  auto two = TreeExprBuilder::MakeLiteral(static_cast<int32_t>(2));
+
+  // a + (1 + 2) and (1 + 2) + a
+  auto expr0 = TreeExprBuilder::MakeExpression(Add(node_a, Add(one, two)),
+                                               arrow::field("out0", int32()));
+  auto expr1 = TreeExprBuilder::MakeExpression(Add(Add(one, two), node_a),
+                                               arrow::field("out1", int32()));
+
+  ExprOptimizer optimizer(EvaluateToThree());
+  ExpressionVector temp_exprs;
+  ExpressionVector out_exprs;
+  auto status = optimizer.Optimize({expr0, expr1}, &temp_exprs, &out_exprs);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // The constant is evaluated once.
+  EXPECT_EQ(num_evaluations_, 1);
+  EXPECT_TRUE(temp_exprs.empty());
+  auto three = TreeExprBuilder::MakeLiteral(static_cast<int32_t>(3));
+  EXPECT_EQ(out_exprs[0]->root()->ToString(), Add(node_a, three)->ToString());
+  EXPECT_EQ(out_exprs[1]->root()->ToString(), Add(three, node_a)->ToString());
+}
+
+TEST_F(TestExprOptimizer, TestFoldConstantsError) {
+  auto node_a = TreeExprBuilder::MakeField(field_a_);
+  auto one = TreeExprBuilder::MakeLiteral(static_cast<int32_t>(1));
+  auto zero = TreeExprBuilder::MakeLiteral(static_cast<int32_t>(0));
+  auto divide = TreeExprBuilder::MakeFunction("divide", {one, zero}, int32());
+  auto expr = TreeExprBuilder::MakeExpression(Add(node_a, divide),
+                                              arrow::field("out", int32()));
+
+  // The subtree is left as is if it can't be evaluated.
+  ExprOptimizer optimizer([](const ExpressionVector& exprs, arrow::ArrayVector* values) {
+    return Status::ExecutionError("divide by zero error");
+  });
+  ExpressionVector temp_exprs;
+  ExpressionVector out_exprs;
+  auto status = optimizer.Optimize({expr}, &temp_exprs, &out_exprs);
+  EXPECT_TRUE(status.ok()) << status.message();
+  EXPECT_EQ(out_exprs[0]->root()->ToString(), expr->root()->ToString());
+}
+
+TEST_F(TestExprOptimizer, TestStringLiteralsKeys) {
+  auto node_a = TreeExprBuilder::MakeField(arrow::field("s", arrow::utf8()));
+
+  // The printed forms of these are the same, but they differ.
+  auto equal0 = TreeExprBuilder::MakeFunction(
+      "equal", {node_a, TreeExprBuilder::MakeStringLiteral("x) || (utf8) s")},
+      arrow::boolean());
+  auto equal1 = TreeExprBuilder::MakeFunction(
+      "equal", {node_a, TreeExprBuilder::MakeStringLiteral("x) || (utf8) s")},
+      arrow::boolean());
+  auto equal2 = TreeExprBuilder::MakeFunction(
+      "equal", {node_a, TreeExprBuilder::MakeStringLiteral("y")}, arrow::boolean());
+  auto expr0 = TreeExprBuilder::MakeExpression(TreeExprBuilder::MakeAnd({equal0, equal2}),
+                                               arrow::field("out0", arrow::boolean()));
+  auto expr1 = TreeExprBuilder::MakeExpression(equal1,
+                                               arrow::field("out1", arrow::boolean()));
+
+  ExprOptimizer optimizer(EvaluateToThree());
+  ExpressionVector temp_exprs;
+  ExpressionVector out_exprs;
+  auto status = optimizer.Optimize({expr0, expr1}, &temp_exprs, &out_exprs);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // equal0 and equal1 are the same, and shared.
+  ASSERT_EQ(temp_exprs.size(), 1);
+  EXPECT_EQ(temp_exprs[0]->root()->ToString(), equal0->ToString());
+}
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+}  // namespace gandiva
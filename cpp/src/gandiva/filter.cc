@@ -24,6 +24,7 @@
 #include "gandiva/bitmap_accumulator.h"
 #include "gandiva/cache.h"
 #include "gandiva/condition.h"
+#include "gandiva/dictionary_evaluator.h"
 #include "gandiva/expr_validator.h"
 #include "gandiva/filter_cache_key.h"
 #include "gandiva/llvm_generator.h"
@@ -31,12 +32,25 @@
 
 namespace gandiva {
 
+using FilterCache = Cache<FilterCacheKey, std::shared_ptr<Filter>>;
+
+static FilterCache& GetCache() {
+  static FilterCache cache;
+  return cache;
+}
+
 Filter::Filter(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
                std::shared_ptr<Configuration> configuration)
     : llvm_generator_(std::move(llvm_generator)),
       schema_(schema),
       configuration_(configuration) {}
 
+Filter::Filter(std::unique_ptr<DictionaryEvaluator> dictionary_evaluator,
+               SchemaPtr schema, std::shared_ptr<Configuration> configuration)
+    : dictionary_evaluator_(std::move(dictionary_evaluator)),
+      schema_(schema),
+      configuration_(configuration) {}
+
 Filter::~Filter() {}
 
 Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
@@ -47,7 +61,10 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
   ARROW_RETURN_IF(configuration == nullptr,
                   Status::Invalid("Configuration cannot be null"));
 
-  static Cache<FilterCacheKey, std::shared_ptr<Filter>> cache;
+  FilterCache& cache = GetCache();
+  if (configuration->cache_capacity() > 0) {
+    cache.SetCapacity(static_cast<size_t>(configuration->cache_capacity()));
+  }
   FilterCacheKey cache_key(schema, configuration, *(condition.get()));
   auto cachedFilter = cache.GetModule(cache_key);
   if (cachedFilter != nullptr) {
@@ -55,6 +72,17 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
     return Status::OK();
   }
 
+  // Evaluate the condition over the dictionary if possible.
+  auto field = DictionaryEvaluator::GetDictionaryField(*schema, *condition->root());
+  if (field != nullptr) {
+    std::unique_ptr<DictionaryEvaluator> evaluator;
+    ARROW_RETURN_NOT_OK(
+        DictionaryEvaluator::Make(field, condition, configuration, &evaluator));
+    *filter = std::make_shared<Filter>(std::move(evaluator), schema, configuration);
+    cache.PutModule(cache_key, *filter, 0);
+    return Status::OK();
+  }
+
   // Build LLVM generator, and generate code for the specified expression
   std::unique_ptr<LLVMGenerator> llvm_gen;
   ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
@@ -66,14 +94,28 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
   ARROW_RETURN_NOT_OK(llvm_gen->Build({condition}));
 
   // Instantiate the filter with the completely built llvm generator
+  auto code_size = static_cast<size_t>(llvm_gen->code_size());
   *filter = std::make_shared<Filter>(std::move(llvm_gen), schema, configuration);
-  cache.PutModule(cache_key, *filter);
+  cache.PutModule(cache_key, *filter, code_size);
 
   return Status::OK();
 }
 
+CacheStats Filter::GetCacheStats() { return GetCache().GetStats(); }
+
 Status Filter::Evaluate(const arrow::RecordBatch& batch,
                         std::shared_ptr<SelectionVector> out_selection) {
+  return EvaluateImpl(batch, out_selection, false);
+}
+
+Status Filter::EvaluateParallel(const arrow::RecordBatch& batch,
+                                std::shared_ptr<SelectionVector> out_selection) {
+  return EvaluateImpl(batch, out_selection, true);
+}
+
+Status Filter::EvaluateImpl(const arrow::RecordBatch& batch,
+                            std::shared_ptr<SelectionVector> out_selection,
+                            bool parallel) {
   const auto num_rows = batch.num_rows();
   ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
                   Status::Invalid("RecordBatch schema must expected filter schema"));
@@ -93,9 +135,16 @@ Status Filter::Evaluate(const arrow::RecordBatch& batch,
   auto array_data = arrow::ArrayData::Make(arrow::boolean(), num_rows, {validity, value});
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(llvm_generator_->Execute(batch, {array_data}));
+  if (dictionary_evaluator_ != nullptr) {
+    ARROW_RETURN_NOT_OK(dictionary_evaluator_->Evaluate(batch, *array_data));
+  } else if (parallel) {
+    ARROW_RETURN_NOT_OK(llvm_generator_->ExecuteParallel(batch, {array_data}));
+  } else {
+    ARROW_RETURN_NOT_OK(llvm_generator_->Execute(batch, {array_data}));
+  }
 
-  // Compute the intersection of the value and validity.
+  // Compute the intersection of the value and validity. Populating the selection
+  // vector is cheap next to evaluating the condition, so it is not split up.
   auto result = bitmaps.GetLocalBitMap(2);
   BitMapAccumulator::IntersectBitMaps(
       result, {bitmaps.GetLocalBitMap(0), bitmaps.GetLocalBitMap((1))}, num_rows);
@@ -25,6 +25,7 @@
 #include "arrow/status.h"
 
 #include "gandiva/arrow.h"
+#include "gandiva/cache_stats.h"
 #include "gandiva/condition.h"
 #include "gandiva/configuration.h"
 #include "gandiva/selection_vector.h"
@@ -32,17 +33,25 @@
 
 namespace gandiva {
 
+class DictionaryEvaluator;
 class LLVMGenerator;
 
 /// \brief filter records based on a condition.
 ///
 /// A filter is built for a specific schema and condition. Once the filter is built, it
 /// can be used to evaluate many row batches.
+///
+/// A condition that only refers to a dictionary-encoded field is evaluated once per
+/// entry of the dictionary, when the filter is built, and the results are looked up
+/// by the indices of each batch.
 class GANDIVA_EXPORT Filter {
  public:
   Filter(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
          std::shared_ptr<Configuration> config);
 
+  Filter(std::unique_ptr<DictionaryEvaluator> dictionary_evaluator, SchemaPtr schema,
+         std::shared_ptr<Configuration> config);
+
   // Inline dtor will attempt to resolve the destructor for
   // LLVMGenerator on MSVC, so we compile the dtor in the object code
   ~Filter();
@@ -76,8 +85,21 @@ class GANDIVA_EXPORT Filter {
   Status Evaluate(const arrow::RecordBatch& batch,
                   std::shared_ptr<SelectionVector> out_selection);
 
+  /// Like Evaluate(), but splits the record batch into ranges of rows whose
+  /// condition is evaluated on the threads of the CPU thread pool.
+  Status EvaluateParallel(const arrow::RecordBatch& batch,
+                          std::shared_ptr<SelectionVector> out_selection);
+
+  /// \brief The counters of the cache of built filters, shared by the process.
+  static CacheStats GetCacheStats();
+
  private:
+  Status EvaluateImpl(const arrow::RecordBatch& batch,
+                      std::shared_ptr<SelectionVector> out_selection, bool parallel);
+
+  // Exactly one of these is set.
   const std::unique_ptr<LLVMGenerator> llvm_generator_;
+  const std::unique_ptr<DictionaryEvaluator> dictionary_evaluator_;
   const SchemaPtr schema_;
   const std::shared_ptr<Configuration> configuration_;
 };
@@ -37,10 +37,14 @@ std::vector<NativeFunction> GetStringFunctionRegistry() {
 
       BINARY_RELATIONAL_SAFE_NULL_IF_NULL_UTF8_FN(starts_with),
       BINARY_RELATIONAL_SAFE_NULL_IF_NULL_UTF8_FN(ends_with),
+      BINARY_RELATIONAL_SAFE_NULL_IF_NULL_UTF8_FN(is_substr),
 
       NativeFunction("upper", DataTypeVector{utf8()}, utf8(), kResultNullIfNull,
                      "upper_utf8", NativeFunction::kNeedsContext),
 
+      NativeFunction("lower", DataTypeVector{utf8()}, utf8(), kResultNullIfNull,
+                     "lower_utf8", NativeFunction::kNeedsContext),
+
       NativeFunction("like", DataTypeVector{utf8(), utf8()}, boolean(), kResultNullIfNull,
                      "gdv_fn_like_utf8_utf8", NativeFunction::kNeedsFunctionHolder)};
 
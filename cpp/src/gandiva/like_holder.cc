@@ -25,9 +25,10 @@ namespace gandiva {
 
 RE2 LikeHolder::starts_with_regex_(R"((\w|\s)*\.\*)");
 RE2 LikeHolder::ends_with_regex_(R"(\.\*(\w|\s)*)");
+RE2 LikeHolder::is_substr_regex_(R"(\.\*(\w|\s)*\.\*)");
 
-// Short-circuit pattern matches for the two common sub cases :
-// - starts_with and ends_with.
+// Short-circuit pattern matches for the three common sub cases :
+// - starts_with, ends_with and is_substr.
 const FunctionNode LikeHolder::TryOptimize(const FunctionNode& node) {
   std::shared_ptr<LikeHolder> holder;
   auto status = Make(node, &holder);
@@ -35,7 +36,13 @@ const FunctionNode LikeHolder::TryOptimize(const FunctionNode& node) {
     std::string& pattern = holder->pattern_;
     auto literal_type = node.children().at(1)->return_type();
 
-    if (RE2::FullMatch(pattern, starts_with_regex_)) {
+    if (RE2::FullMatch(pattern, is_substr_regex_)) {
+      auto substr = pattern.substr(2, pattern.length() - 4);  // trim .* on both sides
+      auto substr_node =
+          std::make_shared<LiteralNode>(literal_type, LiteralHolder(substr), false);
+      return FunctionNode("is_substr", {node.children().at(0), substr_node},
+                          node.return_type());
+    } else if (RE2::FullMatch(pattern, starts_with_regex_)) {
       auto prefix = pattern.substr(0, pattern.length() - 2);  // trim .*
       auto prefix_node =
           std::make_shared<LiteralNode>(literal_type, LiteralHolder(prefix), false);
@@ -44,7 +44,7 @@ class GANDIVA_EXPORT LikeHolder : public FunctionHolder {
   static const FunctionNode TryOptimize(const FunctionNode& node);
 
   /// Return true if the data matches the pattern.
-  bool operator()(const std::string& data) { return RE2::FullMatch(data, regex_); }
+  bool operator()(const re2::StringPiece& data) { return RE2::FullMatch(data, regex_); }
 
  private:
   explicit LikeHolder(const std::string& pattern) : pattern_(pattern), regex_(pattern) {}
@@ -54,6 +54,7 @@ class GANDIVA_EXPORT LikeHolder : public FunctionHolder {
 
   static RE2 starts_with_regex_;  // pre-compiled pattern for matching starts_with
   static RE2 ends_with_regex_;    // pre-compiled pattern for matching ends_with
+  static RE2 is_substr_regex_;    // pre-compiled pattern for matching is_substr
 };
 
 }  // namespace gandiva
@@ -112,8 +112,10 @@ TEST_F(TestLikeHolder, TestOptimise) {
   fnode = LikeHolder::TryOptimize(BuildLike("_xyz"));
   EXPECT_EQ(fnode.descriptor()->name(), "like");
 
-  fnode = LikeHolder::TryOptimize(BuildLike("%xyz%"));
-  EXPECT_EQ(fnode.descriptor()->name(), "like");
+  // optimise for 'is_substr'
+  fnode = LikeHolder::TryOptimize(BuildLike("%xy z%"));
+  EXPECT_EQ(fnode.descriptor()->name(), "is_substr");
+  EXPECT_EQ(fnode.ToString(), "bool is_substr((utf8) in, (const string) xy z)");
 
   fnode = LikeHolder::TryOptimize(BuildLike("_xyz_"));
   EXPECT_EQ(fnode.descriptor()->name(), "like");
@@ -123,6 +125,9 @@ TEST_F(TestLikeHolder, TestOptimise) {
 
   fnode = LikeHolder::TryOptimize(BuildLike("x_yz%"));
   EXPECT_EQ(fnode.descriptor()->name(), "like");
+
+  fnode = LikeHolder::TryOptimize(BuildLike("%x_yz%"));
+  EXPECT_EQ(fnode.descriptor()->name(), "like");
 }
 
 int main(int argc, char** argv) {
@@ -17,6 +17,8 @@
 
 #include "gandiva/llvm_generator.h"
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -24,9 +26,16 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/buffer.h"
+#include "arrow/memory_pool.h"
+#include "arrow/util/bit-util.h"
+#include "arrow/util/task-group.h"
+#include "arrow/util/thread-pool.h"
+
 #include "gandiva/bitmap_accumulator.h"
 #include "gandiva/dex.h"
 #include "gandiva/expr_decomposer.h"
+#include "gandiva/expr_optimizer.h"
 #include "gandiva/expression.h"
 #include "gandiva/function_registry.h"
 #include "gandiva/lvalue.h"
@@ -39,13 +48,28 @@ namespace gandiva {
   }
 
 LLVMGenerator::LLVMGenerator()
-    : dump_ir_(false), optimise_ir_(true), enable_ir_traces_(false) {}
+    : dump_ir_(false),
+      optimise_ir_(true),
+      enable_ir_traces_(false),
+      optimise_exprs_(true),
+      selection_vector_mode_(SelectionVector::MODE_NONE),
+      tiered_(false) {}
 
 Status LLVMGenerator::Make(std::shared_ptr<Configuration> config,
                            std::unique_ptr<LLVMGenerator>* llvm_generator) {
+  bool tiered = config->tiered_compilation();
+  ARROW_RETURN_NOT_OK(Make(config, !tiered, llvm_generator));
+  (*llvm_generator)->tiered_ = tiered;
+  return Status::OK();
+}
+
+Status LLVMGenerator::Make(std::shared_ptr<Configuration> config, bool optimise,
+                           std::unique_ptr<LLVMGenerator>* llvm_generator) {
   std::unique_ptr<LLVMGenerator> llvmgen_obj(new LLVMGenerator());
+  llvmgen_obj->config_ = config;
+  llvmgen_obj->optimise_ir_ = optimise;
 
-  ARROW_RETURN_NOT_OK(Engine::Make(config, &(llvmgen_obj->engine_)));
+  ARROW_RETURN_NOT_OK(Engine::Make(config, optimise, &(llvmgen_obj->engine_)));
   *llvm_generator = std::move(llvmgen_obj);
 
   return Status::OK();
@@ -73,7 +97,34 @@ Status LLVMGenerator::Add(const ExpressionPtr expr, const FieldDescriptorPtr out
 
 /// Build and optimise module for projection expression.
 Status LLVMGenerator::Build(const ExpressionVector& exprs) {
-  for (auto& expr : exprs) {
+  return Build(exprs, SelectionVector::MODE_NONE);
+}
+
+/// Build and optimise module for projection expression over a selection vector.
+Status LLVMGenerator::Build(const ExpressionVector& exprs, SelectionVector::Mode mode) {
+  selection_vector_mode_ = mode;
+
+  ExpressionVector temp_exprs;
+  ExpressionVector out_exprs;
+  if (optimise_exprs_) {
+    // Fold the constant subtrees, and compute the shared subexpressions once
+    // into temporary fields.
+    auto config = config_;
+    ExprOptimizer optimizer(
+        [config](const ExpressionVector& constants, arrow::ArrayVector* values) {
+          return EvaluateConstants(config, constants, values);
+        });
+    ARROW_RETURN_NOT_OK(optimizer.Optimize(exprs, &temp_exprs, &out_exprs));
+  } else {
+    out_exprs = exprs;
+  }
+
+  // The temporary fields are computed first, in order.
+  for (auto& expr : temp_exprs) {
+    auto output = annotator_.AddTempFieldDescriptor(expr->result());
+    ARROW_RETURN_NOT_OK(Add(expr, output));
+  }
+  for (auto& expr : out_exprs) {
     auto output = annotator_.AddOutputFieldDescriptor(expr->result());
     ARROW_RETURN_NOT_OK(Add(expr, output));
   }
@@ -88,34 +139,150 @@ Status LLVMGenerator::Build(const ExpressionVector& exprs) {
     compiled_expr->set_jit_function(fn);
   }
 
+  if (tiered_) {
+    // The task only refers to copies, so it may outlive this generator.
+    auto config = config_;
+    optimised_ =
+        arrow::internal::GetCpuThreadPool()->SubmitAsync<std::shared_ptr<LLVMGenerator>>(
+            [config, exprs, mode](std::shared_ptr<LLVMGenerator>* out) {
+              std::unique_ptr<LLVMGenerator> optimised;
+              ARROW_RETURN_NOT_OK(LLVMGenerator::Make(config, true, &optimised));
+              ARROW_RETURN_NOT_OK(optimised->Build(exprs, mode));
+              *out = std::move(optimised);
+              return Status::OK();
+            });
+  }
+
+  return Status::OK();
+}
+
+/// Build and execute the expressions on a single row without fields.
+Status LLVMGenerator::EvaluateConstants(std::shared_ptr<Configuration> config,
+                                        const ExpressionVector& exprs,
+                                        arrow::ArrayVector* values) {
+  // The expressions are only evaluated once, so don't spend time optimising them.
+  std::unique_ptr<LLVMGenerator> generator;
+  ARROW_RETURN_NOT_OK(Make(config, false, &generator));
+  generator->optimise_exprs_ = false;
+  ARROW_RETURN_NOT_OK(generator->Build(exprs));
+
+  auto pool = arrow::default_memory_pool();
+  ArrayDataVector outputs;
+  for (auto& expr : exprs) {
+    // A row of any fixed-width type, bitmaps included, fits in a word or two.
+    std::shared_ptr<arrow::Buffer> validity;
+    ARROW_RETURN_NOT_OK(arrow::AllocateBuffer(pool, 8, &validity));
+    std::shared_ptr<arrow::Buffer> data;
+    ARROW_RETURN_NOT_OK(arrow::AllocateBuffer(pool, 16, &data));
+    memset(data->mutable_data(), 0, data->size());
+    outputs.push_back(
+        arrow::ArrayData::Make(expr->result()->type(), 1, {validity, data}));
+  }
+
+  auto batch = arrow::RecordBatch::Make(arrow::schema({}), 1, arrow::ArrayVector{});
+  ARROW_RETURN_NOT_OK(generator->Execute(*batch, outputs));
+
+  values->clear();
+  for (auto& output : outputs) {
+    values->push_back(arrow::MakeArray(output));
+  }
   return Status::OK();
 }
 
 /// Execute the compiled module against the provided vectors.
 Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                               const ArrayDataVector& output_vector) {
-  DCHECK_GT(record_batch.num_rows(), 0);
+  return Execute(record_batch, 0, record_batch.num_rows(), output_vector);
+}
+
+/// Execute the compiled module against a range of the provided vectors.
+Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch, int64_t offset,
+                              int64_t length, const ArrayDataVector& output_vector) {
+  DCHECK_GT(length, 0);
 
-  auto eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector);
-  DCHECK_GT(eval_batch->GetNumBuffers(), 0);
+  // Keep executing the unoptimised code if building the optimised one failed.
+  std::shared_ptr<LLVMGenerator> optimised;
+  if (optimised_.is_valid() && optimised_.is_finished() &&
+      optimised_.Get(&optimised).ok()) {
+    return optimised->Execute(record_batch, offset, length, output_vector);
+  }
+
+  DCHECK_EQ(selection_vector_mode_, SelectionVector::MODE_NONE);
+  auto eval_batch =
+      annotator_.PrepareEvalBatch(record_batch, output_vector, offset, length);
+  return Execute(*eval_batch, nullptr, length);
+}
+
+/// Execute the compiled module against the selected rows of the provided vectors.
+Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
+                              const SelectionVector& selection_vector,
+                              const ArrayDataVector& output_vector) {
+  DCHECK_EQ(selection_vector.GetMode(), selection_vector_mode_);
+  int64_t num_slots = selection_vector.GetNumSlots();
+  if (num_slots == 0) {
+    return Status::OK();
+  }
+
+  std::shared_ptr<LLVMGenerator> optimised;
+  if (optimised_.is_valid() && optimised_.is_finished() &&
+      optimised_.Get(&optimised).ok()) {
+    return optimised->Execute(record_batch, selection_vector, output_vector);
+  }
+
+  auto eval_batch =
+      annotator_.PrepareEvalBatch(record_batch, selection_vector, output_vector);
+  return Execute(*eval_batch, selection_vector.GetData(), num_slots);
+}
+
+Status LLVMGenerator::Execute(const EvalBatch& eval_batch,
+                              const uint8_t* selection_data, int64_t length) {
+  DCHECK_GT(eval_batch.GetNumBuffers(), 0);
 
   for (auto& compiled_expr : compiled_exprs_) {
     // generate data/offset vectors.
     EvalFunc jit_function = compiled_expr->jit_function();
-    jit_function(eval_batch->GetBufferArray(), eval_batch->GetLocalBitMapArray(),
-                 (int64_t)eval_batch->GetExecutionContext(), record_batch.num_rows());
+    jit_function(eval_batch.GetBufferArray(), eval_batch.GetLocalBitMapArray(),
+                 selection_data, (int64_t)eval_batch.GetExecutionContext(), length);
 
     ARROW_RETURN_IF(
-        eval_batch->GetExecutionContext()->has_error(),
-        Status::ExecutionError(eval_batch->GetExecutionContext()->get_error()));
+        eval_batch.GetExecutionContext()->has_error(),
+        Status::ExecutionError(eval_batch.GetExecutionContext()->get_error()));
 
     // generate validity vectors.
-    ComputeBitMapsForExpr(*compiled_expr, *eval_batch);
+    ComputeBitMapsForExpr(*compiled_expr, eval_batch);
   }
 
   return Status::OK();
 }
 
+// Below this many rows per thread, evaluating on several threads does not pay off.
+static constexpr int64_t kMinRowsPerTask = 16 * 1024;
+
+/// Execute the compiled module against ranges of the provided vectors in parallel.
+Status LLVMGenerator::ExecuteParallel(const arrow::RecordBatch& record_batch,
+                                      const ArrayDataVector& output_vector) {
+  int64_t num_rows = record_batch.num_rows();
+  auto thread_pool = arrow::internal::GetCpuThreadPool();
+  int64_t num_tasks = thread_pool->GetCapacity();
+
+  // The ranges start at whole words of the bitmaps, so that the threads write
+  // to disjoint words of the output bitmaps.
+  int64_t rows_per_task = (num_rows + num_tasks - 1) / num_tasks;
+  rows_per_task = arrow::BitUtil::RoundUp(std::max(rows_per_task, kMinRowsPerTask), 64);
+  if (rows_per_task >= num_rows) {
+    return Execute(record_batch, output_vector);
+  }
+
+  auto task_group = arrow::internal::TaskGroup::MakeThreaded(thread_pool);
+  for (int64_t offset = 0; offset < num_rows; offset += rows_per_task) {
+    int64_t length = std::min(rows_per_task, num_rows - offset);
+    task_group->Append([this, &record_batch, &output_vector, offset, length] {
+      return Execute(record_batch, offset, length, output_vector);
+    });
+  }
+  return task_group->Finish();
+}
+
 llvm::Value* LLVMGenerator::LoadVectorAtIndex(llvm::Value* arg_addrs, int idx,
                                               const std::string& name) {
   llvm::IRBuilder<>* builder = ir_builder();
@@ -218,10 +385,12 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, FieldDescriptorPtr out
   llvm::IRBuilder<>* builder = ir_builder();
 
   // Create fn prototype :
-  //   int expr_1 (long **addrs, long **bitmaps, long *context_ptr, long nrec)
+  //   int expr_1 (long **addrs, long **bitmaps, char *selection_vector,
+  //               long *context_ptr, long nrec)
   std::vector<llvm::Type*> arguments;
   arguments.push_back(types()->i64_ptr_type());
   arguments.push_back(types()->i64_ptr_type());
+  arguments.push_back(types()->i8_ptr_type());
   arguments.push_back(types()->i64_type());
   arguments.push_back(types()->i64_type());
   llvm::FunctionType* prototype =
@@ -242,6 +411,9 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, FieldDescriptorPtr out
   llvm::Value* arg_local_bitmaps = &*args;
   arg_local_bitmaps->setName("local_bitmaps");
   ++args;
+  llvm::Value* arg_selection_vector = &*args;
+  arg_selection_vector->setName("selection_vector");
+  ++args;
   llvm::Value* arg_context_ptr = &*args;
   arg_context_ptr->setName("context_ptr");
   ++args;
@@ -257,15 +429,43 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, FieldDescriptorPtr out
   llvm::Value* output_ref =
       GetDataReference(arg_addrs, output->data_idx(), output->field());
 
+  llvm::Type* selection_type = nullptr;
+  switch (selection_vector_mode_) {
+    case SelectionVector::MODE_UINT16:
+      selection_type = types()->i16_type();
+      break;
+    case SelectionVector::MODE_UINT32:
+      selection_type = types()->i32_type();
+      break;
+    case SelectionVector::MODE_UINT64:
+      selection_type = types()->i64_type();
+      break;
+    default:
+      break;
+  }
+  llvm::Value* selection_ref = nullptr;
+  if (selection_type != nullptr) {
+    selection_ref = builder->CreateBitCast(arg_selection_vector,
+                                           selection_type->getPointerTo(), "selection");
+  }
+
   // Loop body
   builder->SetInsertPoint(loop_body);
 
   // define loop_var : start with 0, +1 after each iter
   llvm::PHINode* loop_var = builder->CreatePHI(types()->i64_type(), 2, "loop_var");
 
+  // => input_index = selection[loop_var], the row the input values are read from.
+  llvm::Value* input_index = loop_var;
+  if (selection_ref != nullptr) {
+    llvm::Value* slot = builder->CreateGEP(selection_ref, loop_var);
+    input_index = builder->CreateZExt(builder->CreateLoad(slot, "selected"),
+                                      types()->i64_type(), "input_index");
+  }
+
   // The visitor can add code to both the entry/loop blocks.
   Visitor visitor(this, *fn, loop_entry, arg_addrs, arg_local_bitmaps, arg_context_ptr,
-                  loop_var);
+                  loop_var, input_index);
   value_expr->Accept(visitor);
   LValuePtr output_value = visitor.result();
 
@@ -419,7 +619,8 @@ std::shared_ptr<DecimalLValue> LLVMGenerator::BuildDecimalLValue(llvm::Value* va
 LLVMGenerator::Visitor::Visitor(LLVMGenerator* generator, llvm::Function* function,
                                 llvm::BasicBlock* entry_block, llvm::Value* arg_addrs,
                                 llvm::Value* arg_local_bitmaps,
-                                llvm::Value* arg_context_ptr, llvm::Value* loop_var)
+                                llvm::Value* arg_context_ptr, llvm::Value* loop_var,
+                                llvm::Value* input_index)
     : generator_(generator),
       function_(function),
       entry_block_(entry_block),
@@ -427,6 +628,7 @@ LLVMGenerator::Visitor::Visitor(LLVMGenerator* generator, llvm::Function* functi
       arg_local_bitmaps_(arg_local_bitmaps),
       arg_context_ptr_(arg_context_ptr),
       loop_var_(loop_var),
+      input_index_(input_index),
       has_arena_allocs_(false) {
   ADD_VISITOR_TRACE("Iteration %T", loop_var);
 }
@@ -434,24 +636,25 @@ LLVMGenerator::Visitor::Visitor(LLVMGenerator* generator, llvm::Function* functi
 void LLVMGenerator::Visitor::Visit(const VectorReadFixedLenValueDex& dex) {
   llvm::IRBuilder<>* builder = ir_builder();
   llvm::Value* slot_ref = GetBufferReference(dex.DataIdx(), kBufferTypeData, dex.Field());
+  llvm::Value* data_index = GetDataIndex(dex.Field());
   llvm::Value* slot_value;
   std::shared_ptr<LValue> lvalue;
 
   switch (dex.FieldType()->id()) {
     case arrow::Type::BOOL:
-      slot_value = generator_->GetPackedBitValue(slot_ref, loop_var_);
+      slot_value = generator_->GetPackedBitValue(slot_ref, data_index);
       lvalue = std::make_shared<LValue>(slot_value);
       break;
 
     case arrow::Type::DECIMAL: {
-      auto slot_offset = builder->CreateGEP(slot_ref, loop_var_);
+      auto slot_offset = builder->CreateGEP(slot_ref, data_index);
       slot_value = builder->CreateLoad(slot_offset, dex.FieldName());
       lvalue = generator_->BuildDecimalLValue(slot_value, dex.FieldType());
       break;
     }
 
     default: {
-      auto slot_offset = builder->CreateGEP(slot_ref, loop_var_);
+      auto slot_offset = builder->CreateGEP(slot_ref, data_index);
       slot_value = builder->CreateLoad(slot_offset, dex.FieldName());
       lvalue = std::make_shared<LValue>(slot_value);
       break;
@@ -470,14 +673,15 @@ void LLVMGenerator::Visitor::Visit(const VectorReadVarLenValueDex& dex) {
   llvm::Value* offsets_slot_ref =
       GetBufferReference(dex.OffsetsIdx(), kBufferTypeOffsets, dex.Field());
 
-  // => offset_start = offsets[loop_var]
-  slot = builder->CreateGEP(offsets_slot_ref, loop_var_);
+  // => offset_start = offsets[data_index]
+  llvm::Value* data_index = GetDataIndex(dex.Field());
+  slot = builder->CreateGEP(offsets_slot_ref, data_index);
   llvm::Value* offset_start = builder->CreateLoad(slot, "offset_start");
 
-  // => offset_end = offsets[loop_var + 1]
-  llvm::Value* loop_var_next =
-      builder->CreateAdd(loop_var_, generator_->types()->i64_constant(1), "loop_var+1");
-  slot = builder->CreateGEP(offsets_slot_ref, loop_var_next);
+  // => offset_end = offsets[data_index + 1]
+  llvm::Value* data_index_next = builder->CreateAdd(
+      data_index, generator_->types()->i64_constant(1), "data_index+1");
+  slot = builder->CreateGEP(offsets_slot_ref, data_index_next);
   llvm::Value* offset_end = builder->CreateLoad(slot, "offset_end");
 
   // => len_value = offset_end - offset_start
@@ -1159,6 +1363,10 @@ void LLVMGenerator::Visitor::ClearLocalBitMapIfNotValid(int local_bitmap_idx,
   generator_->ClearPackedBitValueIfFalse(slot_ref, loop_var_, is_valid);
 }
 
+llvm::Value* LLVMGenerator::Visitor::GetDataIndex(FieldPtr field) {
+  return ExprOptimizer::IsTempField(*field) ? loop_var_ : input_index_;
+}
+
 // Hooks for tracing/printfs.
 //
 // replace %T with the type-specific format specifier.
@@ -23,6 +23,7 @@
 #include <string>
 #include <vector>
 
+#include "arrow/util/future.h"
 #include "arrow/util/macros.h"
 
 #include "gandiva/annotator.h"
@@ -35,6 +36,7 @@
 #include "gandiva/gandiva_aliases.h"
 #include "gandiva/llvm_types.h"
 #include "gandiva/lvalue.h"
+#include "gandiva/selection_vector.h"
 #include "gandiva/value_validity_pair.h"
 #include "gandiva/visibility.h"
 
@@ -51,12 +53,43 @@ class GANDIVA_EXPORT LLVMGenerator {
 
   /// \brief Build the code for the expression trees. Each element in the vector
   /// represents an expression tree
+  ///
+  /// With tiered compilation, the code is not optimised, and optimised code is
+  /// built on the CPU thread pool. Execute() switches to it once it is ready.
   Status Build(const ExpressionVector& exprs);
 
+  /// \brief Build the code for the expression trees, to be executed over the rows
+  /// of a selection vector with the given mode.
+  Status Build(const ExpressionVector& exprs, SelectionVector::Mode mode);
+
   /// \brief Execute the built expression against the provided arguments.
   Status Execute(const arrow::RecordBatch& record_batch,
                  const ArrayDataVector& output_vector);
 
+  /// \brief Execute the built expression against the rows [offset, offset + length)
+  /// of the provided arguments. The offset must be a multiple of 64.
+  Status Execute(const arrow::RecordBatch& record_batch, int64_t offset, int64_t length,
+                 const ArrayDataVector& output_vector);
+
+  /// \brief Execute the built expression against the rows of the provided arguments
+  /// in the selection vector, writing the results of the i-th selected row at
+  /// position i of the outputs. The code must have been built for the mode of the
+  /// selection vector.
+  Status Execute(const arrow::RecordBatch& record_batch,
+                 const SelectionVector& selection_vector,
+                 const ArrayDataVector& output_vector);
+
+  /// \brief Execute the built expression against the provided arguments, splitting
+  /// the rows into ranges that are evaluated on the CPU thread pool.
+  Status ExecuteParallel(const arrow::RecordBatch& record_batch,
+                         const ArrayDataVector& output_vector);
+
+  /// \brief The approximate size in bytes of the generated code.
+  int64_t code_size() const { return engine_->code_size(); }
+
+  /// \brief The mode of the selection vectors the code was built for.
+  SelectionVector::Mode selection_vector_mode() const { return selection_vector_mode_; }
+
   LLVMTypes* types() { return engine_->types(); }
   llvm::Module* module() { return engine_->module(); }
 
@@ -66,6 +99,15 @@ class GANDIVA_EXPORT LLVMGenerator {
   FRIEND_TEST(TestLLVMGenerator, VerifyPCFunctions);
   FRIEND_TEST(TestLLVMGenerator, TestAdd);
   FRIEND_TEST(TestLLVMGenerator, TestNullInternal);
+  FRIEND_TEST(TestLLVMGenerator, TestTieredBuild);
+
+  static Status Make(std::shared_ptr<Configuration> config, bool optimise,
+                     std::unique_ptr<LLVMGenerator>* llvm_generator);
+
+  /// Evaluate expressions that only refer to literals, for constant folding.
+  static Status EvaluateConstants(std::shared_ptr<Configuration> config,
+                                  const ExpressionVector& exprs,
+                                  arrow::ArrayVector* values);
 
   llvm::LLVMContext* context() { return engine_->context(); }
   llvm::IRBuilder<>* ir_builder() { return engine_->ir_builder(); }
@@ -76,7 +118,7 @@ class GANDIVA_EXPORT LLVMGenerator {
     Visitor(LLVMGenerator* generator, llvm::Function* function,
             llvm::BasicBlock* entry_block, llvm::Value* arg_addrs,
             llvm::Value* arg_local_bitmaps, llvm::Value* arg_context_ptr,
-            llvm::Value* loop_var);
+            llvm::Value* loop_var, llvm::Value* input_index);
 
     void Visit(const VectorReadValidityDex& dex) override;
     void Visit(const VectorReadFixedLenValueDex& dex) override;
@@ -137,6 +179,10 @@ class GANDIVA_EXPORT LLVMGenerator {
     // Clear the bit in the local bitmap, if is_valid is 'false'
     void ClearLocalBitMapIfNotValid(int local_bitmap_idx, llvm::Value* is_valid);
 
+    // The position of the current row in the data of the field. The temporary fields
+    // are computed for the selected rows only.
+    llvm::Value* GetDataIndex(FieldPtr field);
+
     LLVMGenerator* generator_;
     LValuePtr result_;
     llvm::Function* function_;
@@ -145,6 +191,7 @@ class GANDIVA_EXPORT LLVMGenerator {
     llvm::Value* arg_local_bitmaps_;
     llvm::Value* arg_context_ptr_;
     llvm::Value* loop_var_;
+    llvm::Value* input_index_;
     bool has_arena_allocs_;
   };
 
@@ -195,6 +242,10 @@ class GANDIVA_EXPORT LLVMGenerator {
   llvm::Value* AddFunctionCall(const std::string& full_name, llvm::Type* ret_type,
                                const std::vector<llvm::Value*>& args);
 
+  /// Execute the compiled functions against an eval batch of 'length' rows.
+  Status Execute(const EvalBatch& eval_batch, const uint8_t* selection_data,
+                 int64_t length);
+
   /// Compute the result bitmap for the expression.
   ///
   /// \param[in] compiled_expr the compiled expression (includes the bitmap indices to be
@@ -211,6 +262,7 @@ class GANDIVA_EXPORT LLVMGenerator {
   /// Generate the code to print a trace msg with one optional argument (%T)
   void AddTrace(const std::string& msg, llvm::Value* value = NULLPTR);
 
+  std::shared_ptr<Configuration> config_;
   std::unique_ptr<Engine> engine_;
   std::vector<std::unique_ptr<CompiledExpr>> compiled_exprs_;
   FunctionRegistry function_registry_;
@@ -221,6 +273,16 @@ class GANDIVA_EXPORT LLVMGenerator {
   bool optimise_ir_;
   bool enable_ir_traces_;
   std::vector<std::string> trace_strings_;
+
+  // Whether expressions are rewritten by the ExprOptimizer before code generation.
+  bool optimise_exprs_;
+
+  // The width of the indices of the selection vectors the code reads the rows from.
+  SelectionVector::Mode selection_vector_mode_;
+
+  // The generator of the optimised code, with tiered compilation.
+  bool tiered_;
+  arrow::Future<std::shared_ptr<LLVMGenerator>> optimised_;
 };
 
 }  // namespace gandiva
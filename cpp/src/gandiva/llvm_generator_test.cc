@@ -27,6 +27,7 @@
 #include "gandiva/func_descriptor.h"
 #include "gandiva/function_registry.h"
 #include "gandiva/tests/test_util.h"
+#include "gandiva/tree_expr_builder.h"
 
 namespace gandiva {
 
@@ -107,7 +108,7 @@ TEST_F(TestLLVMGenerator, TestAdd) {
       reinterpret_cast<uint8_t*>(a1),  reinterpret_cast<uint8_t*>(&in_bitmap),
       reinterpret_cast<uint8_t*>(out), reinterpret_cast<uint8_t*>(&out_bitmap),
   };
-  eval_func(addrs, nullptr, 0 /* dummy context ptr */, num_records);
+  eval_func(addrs, nullptr, nullptr, 0 /* dummy context ptr */, num_records);
 
   uint32_t expected[] = {6, 8, 10, 12};
   for (int i = 0; i < num_records; i++) {
@@ -115,6 +116,29 @@ TEST_F(TestLLVMGenerator, TestAdd) {
   }
 }
 
+TEST_F(TestLLVMGenerator, TestTieredBuild) {
+  auto config = ConfigurationBuilder().set_tiered_compilation(true).build();
+  std::unique_ptr<LLVMGenerator> generator;
+  auto status = LLVMGenerator::Make(config, &generator);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  auto field0 = arrow::field("f0", arrow::int32());
+  auto field1 = arrow::field("f1", arrow::int32());
+  auto field_sum = arrow::field("out", arrow::int32());
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+  status = generator->Build({sum_expr});
+  EXPECT_TRUE(status.ok()) << status.message();
+  EXPECT_FALSE(generator->optimise_ir_);
+
+  // The optimised code is built in the background.
+  ASSERT_TRUE(generator->optimised_.is_valid());
+  std::shared_ptr<LLVMGenerator> optimised;
+  status = generator->optimised_.Get(&optimised);
+  EXPECT_TRUE(status.ok()) << status.message();
+  EXPECT_TRUE(optimised->optimise_ir_);
+  EXPECT_FALSE(optimised->optimised_.is_valid());
+}
+
 int main(int argc, char** argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
@@ -27,7 +27,8 @@
 // modified from boost LRU cache -> the boost cache supported only an
 // ordered map.
 namespace gandiva {
-// a cache which evicts the least recently used item when it is full
+// a cache which evicts the least recently used items when it is full. Each item
+// has a cost, e.g. its size in bytes, and the capacity bounds the total cost.
 template <class Key, class Value>
 class LruCache {
  public:
@@ -40,11 +41,15 @@ class LruCache {
       return i.Hash();
     }
   };
-  using map_type =
-      std::unordered_map<key_type, std::pair<value_type, typename list_type::iterator>,
-                         hasher>;
+  struct entry_type {
+    value_type value;
+    size_t cost;
+    typename list_type::iterator position_in_lru_list;
+  };
+  using map_type = std::unordered_map<key_type, entry_type, hasher>;
 
-  explicit LruCache(size_t capacity) : cache_capacity_(capacity) {}
+  explicit LruCache(size_t capacity)
+      : cache_capacity_(capacity), cost_(0), num_evictions_(0) {}
 
   ~LruCache() {}
 
@@ -52,22 +57,42 @@ class LruCache {
 
   size_t capacity() const { return cache_capacity_; }
 
+  // the total cost of the items in the cache.
+  size_t cost() const { return cost_; }
+
+  // the number of items evicted to make room for others.
+  size_t num_evictions() const { return num_evictions_; }
+
+  // change the capacity, evicting items if the cache holds more.
+  void set_capacity(size_t capacity) {
+    cache_capacity_ = capacity;
+    while (cost_ > cache_capacity_) {
+      evict();
+    }
+  }
+
   bool empty() const { return map_.empty(); }
 
   bool contains(const key_type& key) { return map_.find(key) != map_.end(); }
 
-  void insert(const key_type& key, const value_type& value) {
+  void insert(const key_type& key, const value_type& value, size_t cost = 1) {
     typename map_type::iterator i = map_.find(key);
     if (i == map_.end()) {
+      // an item costing more than the capacity is not cached at all.
+      if (cost > cache_capacity_) {
+        return;
+      }
+
       // insert item into the cache, but first check if it is full
-      if (size() >= cache_capacity_) {
+      while (cost_ + cost > cache_capacity_) {
         // cache is full, evict the least recently used item
         evict();
       }
 
       // insert the new item
       lru_list_.push_front(key);
-      map_[key] = std::make_pair(value, lru_list_.begin());
+      map_.emplace(key, entry_type{value, cost, lru_list_.begin()});
+      cost_ += cost;
     }
   }
 
@@ -79,45 +104,38 @@ class LruCache {
       return boost::none;
     }
 
-    // return the value, but first update its place in the most
+    // return the value, but first move it to the front of the most
     // recently used list
-    typename list_type::iterator postition_in_lru_list = value_for_key->second.second;
-    if (postition_in_lru_list != lru_list_.begin()) {
-      // move item to the front of the most recently used list
-      lru_list_.erase(postition_in_lru_list);
-      lru_list_.push_front(key);
-
-      // update iterator in map
-      postition_in_lru_list = lru_list_.begin();
-      const value_type& value = value_for_key->second.first;
-      map_[key] = std::make_pair(value, postition_in_lru_list);
-
-      // return the value
-      return value;
-    } else {
-      // the item is already at the front of the most recently
-      // used list so just return it
-      return value_for_key->second.first;
+    entry_type& entry = value_for_key->second;
+    if (entry.position_in_lru_list != lru_list_.begin()) {
+      lru_list_.splice(lru_list_.begin(), lru_list_, entry.position_in_lru_list);
     }
+    return entry.value;
   }
 
   void clear() {
     map_.clear();
     lru_list_.clear();
+    cost_ = 0;
   }
 
  private:
   void evict() {
     // evict item from the end of most recently used list
     typename list_type::iterator i = --lru_list_.end();
-    map_.erase(*i);
+    typename map_type::iterator entry = map_.find(*i);
+    cost_ -= entry->second.cost;
+    map_.erase(entry);
     lru_list_.erase(i);
+    ++num_evictions_;
   }
 
  private:
   map_type map_;
   list_type lru_list_;
   size_t cache_capacity_;
+  size_t cost_;
+  size_t num_evictions_;
 };
 }  // namespace gandiva
 #endif  // LRU_CACHE_H
@@ -61,4 +61,28 @@ TEST_F(TestLruCache, TestLruBehavior) {
   // should have evicted key 2.
   ASSERT_EQ(*cache_.get(TestCacheKey(1)), "hello");
 }
+
+TEST_F(TestLruCache, TestEvictByCost) {
+  LruCache<TestCacheKey, std::string> cache(10);
+  cache.insert(TestCacheKey(1), "hello", 4);
+  cache.insert(TestCacheKey(2), "hello", 4);
+  cache.get(TestCacheKey(1));
+  // should evict key 2 only.
+  cache.insert(TestCacheKey(3), "hello", 6);
+  ASSERT_EQ(2, cache.size());
+  ASSERT_EQ(10, cache.cost());
+  ASSERT_EQ(1, cache.num_evictions());
+  ASSERT_EQ(cache.get(TestCacheKey(2)), boost::none);
+
+  // an item costing more than the capacity is not cached.
+  cache.insert(TestCacheKey(4), "hello", 11);
+  ASSERT_EQ(cache.get(TestCacheKey(4)), boost::none);
+  ASSERT_EQ(2, cache.size());
+
+  // shrinking the cache evicts the least recently used items.
+  cache.set_capacity(6);
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(*cache.get(TestCacheKey(3)), "hello");
+  ASSERT_EQ(2, cache.num_evictions());
+}
 }  // namespace gandiva
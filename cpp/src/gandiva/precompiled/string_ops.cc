@@ -89,6 +89,29 @@ bool ends_with_utf8_utf8(const char* data, int32 data_len, const char* suffix,
           (memcmp(data + data_len - suffix_len, suffix, suffix_len) == 0));
 }
 
+// The first byte of the substring is looked for with memchr, which scans many
+// bytes at a time, and the rest is compared from there.
+FORCE_INLINE
+bool is_substr_utf8_utf8(const char* data, int32 data_len, const char* substr,
+                         int32 substr_len) {
+  if (substr_len == 0) {
+    return true;
+  }
+  const char* last = data + data_len - substr_len;
+  const char* cur = data;
+  while (cur <= last) {
+    cur = reinterpret_cast<const char*>(memchr(cur, substr[0], last - cur + 1));
+    if (cur == NULL) {
+      return false;
+    }
+    if (memcmp(cur + 1, substr + 1, substr_len - 1) == 0) {
+      return true;
+    }
+    ++cur;
+  }
+  return false;
+}
+
 FORCE_INLINE
 int32 utf8_char_length(char c) {
   if (c >= 0) {  // 1-byte char
@@ -140,24 +163,30 @@ UTF8_LENGTH(char_length, utf8)
 UTF8_LENGTH(length, utf8)
 UTF8_LENGTH(lengthUtf8, binary)
 
+// Convert the ascii letters of a utf8 sequence, leaving other bytes as is. The
+// loop has no branches, so that it gets vectorized.
+#define CONVERT_ASCII_CASE(NAME, FROM, TO)                                       \
+  FORCE_INLINE                                                                   \
+  char* NAME##_utf8(int64 context, const char* data, int32 data_len,             \
+                    int32_t* out_len) {                                          \
+    char* ret =                                                                  \
+        reinterpret_cast<char*>(gdv_fn_context_arena_malloc(context, data_len)); \
+    /* TODO: handle allocation failures */                                       \
+    for (int32 i = 0; i < data_len; ++i) {                                       \
+      char cur = data[i];                                                        \
+      bool convert = cur >= FROM && cur <= FROM + 25;                            \
+      ret[i] = static_cast<char>(cur + convert * (TO - FROM));                   \
+    }                                                                            \
+    *out_len = data_len;                                                         \
+    return ret;                                                                  \
+  }
+
 // Convert a utf8 sequence to upper case.
 // TODO : This handles only ascii characters.
-FORCE_INLINE
-char* upper_utf8(int64 context, const char* data, int32 data_len, int32_t* out_len) {
-  char* ret = reinterpret_cast<char*>(gdv_fn_context_arena_malloc(context, data_len));
-  // TODO: handle allocation failures
-  for (int32 i = 0; i < data_len; ++i) {
-    char cur = data[i];
-
-    // 'A- - 'Z' : 0x41 - 0x5a
-    // 'a' - 'z' : 0x61 - 0x7a
-    if (cur >= 0x61 && cur <= 0x7a) {
-      cur = static_cast<char>(cur - 0x20);
-    }
-    ret[i] = cur;
-  }
-  *out_len = data_len;
-  return ret;
-}
+CONVERT_ASCII_CASE(upper, 'a', 'A')
+
+// Convert a utf8 sequence to lower case.
+// TODO : This handles only ascii characters.
+CONVERT_ASCII_CASE(lower, 'A', 'a')
 
 }  // extern "C"
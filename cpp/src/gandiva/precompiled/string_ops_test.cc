@@ -51,6 +51,38 @@ TEST(TestStringOps, TestBeginsEnds) {
   EXPECT_TRUE(ends_with_utf8_utf8("sir", 3, "sir", 3));
   EXPECT_FALSE(ends_with_utf8_utf8("ir", 2, "sir", 3));
   EXPECT_FALSE(ends_with_utf8_utf8("hello", 5, "sir", 3));
+
+  // is_substr
+  EXPECT_TRUE(is_substr_utf8_utf8("hello sir", 9, "lo s", 4));
+  EXPECT_TRUE(is_substr_utf8_utf8("hello sir", 9, "hello", 5));
+  EXPECT_TRUE(is_substr_utf8_utf8("hello sir", 9, "sir", 3));
+  EXPECT_TRUE(is_substr_utf8_utf8("hello", 5, "", 0));
+  EXPECT_TRUE(is_substr_utf8_utf8("llllo", 5, "llo", 3));
+  EXPECT_FALSE(is_substr_utf8_utf8("hello sir", 9, "sirs", 4));
+  EXPECT_FALSE(is_substr_utf8_utf8("hello", 5, "hellos", 6));
+  EXPECT_FALSE(is_substr_utf8_utf8("", 0, "h", 1));
+}
+
+TEST(TestStringOps, TestUpperLower) {
+  gandiva::ExecutionContext ctx;
+  uint64_t ctx_ptr = reinterpret_cast<int64>(&ctx);
+  int32 out_len = 0;
+
+  const char* out = upper_utf8(ctx_ptr, "asdf@Z[`{09", 11, &out_len);
+  EXPECT_EQ(std::string(out, out_len), "ASDF@Z[`{09");
+
+  out = lower_utf8(ctx_ptr, "ASDF@z[`{09", 11, &out_len);
+  EXPECT_EQ(std::string(out, out_len), "asdf@z[`{09");
+
+  // non-ascii bytes are left as is
+  std::string a("âpPle");
+  out = upper_utf8(ctx_ptr, a.data(), static_cast<int32>(a.length()), &out_len);
+  EXPECT_EQ(std::string(out, out_len), "âPPLE");
+  out = lower_utf8(ctx_ptr, a.data(), static_cast<int32>(a.length()), &out_len);
+  EXPECT_EQ(std::string(out, out_len), "âpple");
+
+  out = upper_utf8(ctx_ptr, "", 0, &out_len);
+  EXPECT_EQ(out_len, 0);
 }
 
 TEST(TestStringOps, TestCharLength) {
@@ -152,6 +152,11 @@ bool starts_with_utf8_utf8(const char* data, int32 data_len, const char* prefix,
                            int32 prefix_len);
 bool ends_with_utf8_utf8(const char* data, int32 data_len, const char* suffix,
                          int32 suffix_len);
+bool is_substr_utf8_utf8(const char* data, int32 data_len, const char* substr,
+                         int32 substr_len);
+
+char* upper_utf8(int64 context, const char* data, int32 data_len, int32_t* out_len);
+char* lower_utf8(int64 context, const char* data, int32 data_len, int32_t* out_len);
 
 int32 utf8_length(int64 context, const char* data, int32 data_len);
 
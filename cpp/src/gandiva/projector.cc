@@ -22,18 +22,31 @@
 #include <vector>
 
 #include "gandiva/cache.h"
+#include "gandiva/dictionary_evaluator.h"
 #include "gandiva/expr_validator.h"
 #include "gandiva/llvm_generator.h"
 #include "gandiva/projector_cache_key.h"
 
 namespace gandiva {
 
-Projector::Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
-                     const FieldVector& output_fields,
-                     std::shared_ptr<Configuration> configuration)
+using ProjectorCache = Cache<ProjectorCacheKey, std::shared_ptr<Projector>>;
+
+static ProjectorCache& GetCache() {
+  static ProjectorCache cache;
+  return cache;
+}
+
+Projector::Projector(
+    std::unique_ptr<LLVMGenerator> llvm_generator,
+    std::vector<std::unique_ptr<DictionaryEvaluator>> dictionary_evaluators,
+    SchemaPtr schema, const FieldVector& output_fields,
+    SelectionVector::Mode selection_vector_mode,
+    std::shared_ptr<Configuration> configuration)
     : llvm_generator_(std::move(llvm_generator)),
+      dictionary_evaluators_(std::move(dictionary_evaluators)),
       schema_(schema),
       output_fields_(output_fields),
+      selection_vector_mode_(selection_vector_mode),
       configuration_(configuration) {}
 
 Projector::~Projector() {}
@@ -47,33 +60,63 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
                        std::shared_ptr<Configuration> configuration,
                        std::shared_ptr<Projector>* projector) {
+  return Projector::Make(schema, exprs, SelectionVector::MODE_NONE, configuration,
+                         projector);
+}
+
+Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
+                       SelectionVector::Mode selection_vector_mode,
+                       std::shared_ptr<Configuration> configuration,
+                       std::shared_ptr<Projector>* projector) {
   ARROW_RETURN_IF(schema == nullptr, Status::Invalid("Schema cannot be null"));
   ARROW_RETURN_IF(exprs.empty(), Status::Invalid("Expressions cannot be empty"));
   ARROW_RETURN_IF(configuration == nullptr,
                   Status::Invalid("Configuration cannot be null"));
 
   // see if equivalent projector was already built
-  static Cache<ProjectorCacheKey, std::shared_ptr<Projector>> cache;
-  ProjectorCacheKey cache_key(schema, configuration, exprs);
+  ProjectorCache& cache = GetCache();
+  if (configuration->cache_capacity() > 0) {
+    cache.SetCapacity(static_cast<size_t>(configuration->cache_capacity()));
+  }
+  ProjectorCacheKey cache_key(schema, configuration, exprs, selection_vector_mode);
   std::shared_ptr<Projector> cached_projector = cache.GetModule(cache_key);
   if (cached_projector != nullptr) {
     *projector = cached_projector;
     return Status::OK();
   }
 
-  // Build LLVM generator, and generate code for the specified expressions
-  std::unique_ptr<LLVMGenerator> llvm_gen;
-  ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
-
-  // Run the validation on the expressions.
-  // Return if any of the expression is invalid since
-  // we will not be able to process further.
-  ExprValidator expr_validator(llvm_gen->types(), schema);
+  // Evaluate the expressions over dictionaries where possible.
+  std::vector<std::unique_ptr<DictionaryEvaluator>> dictionary_evaluators;
+  ExpressionVector generated_exprs;
   for (auto& expr : exprs) {
-    ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
+    std::unique_ptr<DictionaryEvaluator> evaluator;
+    auto field = DictionaryEvaluator::GetDictionaryField(*schema, *expr->root());
+    if (field != nullptr) {
+      ARROW_RETURN_NOT_OK(
+          DictionaryEvaluator::Make(field, expr, configuration, &evaluator));
+    } else {
+      generated_exprs.push_back(expr);
+    }
+    dictionary_evaluators.push_back(std::move(evaluator));
   }
 
-  ARROW_RETURN_NOT_OK(llvm_gen->Build(exprs));
+  // Build LLVM generator, and generate code for the other expressions
+  std::unique_ptr<LLVMGenerator> llvm_gen;
+  size_t code_size = 0;
+  if (!generated_exprs.empty()) {
+    ARROW_RETURN_NOT_OK(LLVMGenerator::Make(configuration, &llvm_gen));
+
+    // Run the validation on the expressions.
+    // Return if any of the expression is invalid since
+    // we will not be able to process further.
+    ExprValidator expr_validator(llvm_gen->types(), schema);
+    for (auto& expr : generated_exprs) {
+      ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
+    }
+
+    ARROW_RETURN_NOT_OK(llvm_gen->Build(generated_exprs, selection_vector_mode));
+    code_size = static_cast<size_t>(llvm_gen->code_size());
+  }
 
   // save the output field types. Used for validation at Evaluate() time.
   std::vector<FieldPtr> output_fields;
@@ -84,19 +127,57 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 
   // Instantiate the projector with the completely built llvm generator
   *projector = std::shared_ptr<Projector>(
-      new Projector(std::move(llvm_gen), schema, output_fields, configuration));
-  cache.PutModule(cache_key, *projector);
+      new Projector(std::move(llvm_gen), std::move(dictionary_evaluators), schema,
+                    output_fields, selection_vector_mode, configuration));
+  cache.PutModule(cache_key, *projector, code_size);
 
   return Status::OK();
 }
 
+CacheStats Projector::GetCacheStats() { return GetCache().GetStats(); }
+
 Status Projector::Evaluate(const arrow::RecordBatch& batch,
                            const ArrayDataVector& output_data_vecs) {
-  ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch));
+  return EvaluateImpl(batch, nullptr, output_data_vecs, false);
+}
+
+Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                           arrow::ArrayVector* output) {
+  return EvaluateImpl(batch, nullptr, pool, output, false);
+}
+
+Status Projector::Evaluate(const arrow::RecordBatch& batch,
+                           const SelectionVector* selection_vector,
+                           const ArrayDataVector& output_data_vecs) {
+  return EvaluateImpl(batch, selection_vector, output_data_vecs, false);
+}
+
+Status Projector::Evaluate(const arrow::RecordBatch& batch,
+                           const SelectionVector* selection_vector,
+                           arrow::MemoryPool* pool, arrow::ArrayVector* output) {
+  return EvaluateImpl(batch, selection_vector, pool, output, false);
+}
+
+Status Projector::EvaluateParallel(const arrow::RecordBatch& batch,
+                                   const ArrayDataVector& output_data_vecs) {
+  return EvaluateImpl(batch, nullptr, output_data_vecs, true);
+}
+
+Status Projector::EvaluateParallel(const arrow::RecordBatch& batch,
+                                   arrow::MemoryPool* pool, arrow::ArrayVector* output) {
+  return EvaluateImpl(batch, nullptr, pool, output, true);
+}
+
+Status Projector::EvaluateImpl(const arrow::RecordBatch& batch,
+                               const SelectionVector* selection_vector,
+                               const ArrayDataVector& output_data_vecs, bool parallel) {
+  ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch, selection_vector));
   ARROW_RETURN_IF(
       output_data_vecs.size() != output_fields_.size(),
       Status::Invalid("Number of output buffers must match number of fields"));
 
+  int64_t num_rows =
+      selection_vector != nullptr ? selection_vector->GetNumSlots() : batch.num_rows();
   int idx = 0;
   for (auto& array_data : output_data_vecs) {
     const auto output_field = output_fields_[idx];
@@ -106,32 +187,36 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
     }
 
     ARROW_RETURN_NOT_OK(
-        ValidateArrayDataCapacity(*array_data, *output_field, batch.num_rows()));
+        ValidateArrayDataCapacity(*array_data, *output_field, num_rows));
     ++idx;
   }
 
-  return llvm_generator_->Execute(batch, output_data_vecs);
+  return Execute(batch, selection_vector, output_data_vecs, parallel);
 }
 
-Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
-                           arrow::ArrayVector* output) {
-  ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch));
+Status Projector::EvaluateImpl(const arrow::RecordBatch& batch,
+                               const SelectionVector* selection_vector,
+                               arrow::MemoryPool* pool, arrow::ArrayVector* output,
+                               bool parallel) {
+  ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch, selection_vector));
   ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
   ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
 
-  // Allocate the output data vecs.
+  // Allocate the output data vecs, with a row for each selected row.
+  int64_t num_rows =
+      selection_vector != nullptr ? selection_vector->GetNumSlots() : batch.num_rows();
   ArrayDataVector output_data_vecs;
   output_data_vecs.reserve(output_fields_.size());
   for (auto& field : output_fields_) {
     ArrayDataPtr output_data;
 
     ARROW_RETURN_NOT_OK(
-        AllocArrayData(field->type(), batch.num_rows(), pool, &output_data));
+        AllocArrayData(field->type(), num_rows, pool, &output_data));
     output_data_vecs.push_back(output_data);
   }
 
   // Execute the expression(s).
-  ARROW_RETURN_NOT_OK(llvm_generator_->Execute(batch, output_data_vecs));
+  ARROW_RETURN_NOT_OK(Execute(batch, selection_vector, output_data_vecs, parallel));
 
   // Create and return array arrays.
   output->clear();
@@ -142,6 +227,30 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* p
   return Status::OK();
 }
 
+Status Projector::Execute(const arrow::RecordBatch& batch,
+                          const SelectionVector* selection_vector,
+                          const ArrayDataVector& output_data_vecs, bool parallel) {
+  ArrayDataVector generated_outputs;
+  for (size_t i = 0; i < output_data_vecs.size(); ++i) {
+    if (dictionary_evaluators_[i] != nullptr) {
+      ARROW_RETURN_NOT_OK(dictionary_evaluators_[i]->Evaluate(batch, selection_vector,
+                                                              *output_data_vecs[i]));
+    } else {
+      generated_outputs.push_back(output_data_vecs[i]);
+    }
+  }
+  if (generated_outputs.empty()) {
+    return Status::OK();
+  }
+  if (selection_vector != nullptr) {
+    return llvm_generator_->Execute(batch, *selection_vector, generated_outputs);
+  }
+  if (parallel) {
+    return llvm_generator_->ExecuteParallel(batch, generated_outputs);
+  }
+  return llvm_generator_->Execute(batch, generated_outputs);
+}
+
 // TODO : handle variable-len vectors
 Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
                                  arrow::MemoryPool* pool, ArrayDataPtr* array_data) {
@@ -167,11 +276,16 @@ Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
   return Status::OK();
 }
 
-Status Projector::ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch) {
+Status Projector::ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch,
+                                              const SelectionVector* selection_vector) {
   ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
                   Status::Invalid("Schema in RecordBatch must match schema in Make()"));
   ARROW_RETURN_IF(batch.num_rows() == 0,
                   Status::Invalid("RecordBatch must be non-empty."));
+  auto mode = selection_vector != nullptr ? selection_vector->GetMode()
+                                          : SelectionVector::MODE_NONE;
+  ARROW_RETURN_IF(mode != selection_vector_mode_,
+                  Status::Invalid("Selection vector mode must match mode in Make()"));
 
   return Status::OK();
 }
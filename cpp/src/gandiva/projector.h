@@ -25,18 +25,25 @@
 #include "arrow/status.h"
 
 #include "gandiva/arrow.h"
+#include "gandiva/cache_stats.h"
 #include "gandiva/configuration.h"
 #include "gandiva/expression.h"
+#include "gandiva/selection_vector.h"
 #include "gandiva/visibility.h"
 
 namespace gandiva {
 
+class DictionaryEvaluator;
 class LLVMGenerator;
 
 /// \brief projection using expressions.
 ///
 /// A projector is built for a specific schema and vector of expressions.
 /// Once the projector is built, it can be used to evaluate many row batches.
+///
+/// An expression that only refers to a dictionary-encoded field is evaluated
+/// once per entry of the dictionary, when the projector is built, and the
+/// results are looked up by the indices of each batch.
 class GANDIVA_EXPORT Projector {
  public:
   // Inline dtor will attempt to resolve the destructor for
@@ -63,6 +70,20 @@ class GANDIVA_EXPORT Projector {
                      std::shared_ptr<Configuration> configuration,
                      std::shared_ptr<Projector>* projector);
 
+  /// Build a projector for the given schema to evaluate the vector of expressions
+  /// over the rows in selection vectors of the given mode, such as the output of
+  /// a Filter. Customize the projector with runtime configuration.
+  ///
+  /// \param[in] schema schema for the record batches, and the expressions.
+  /// \param[in] exprs vector of expressions.
+  /// \param[in] selection_vector_mode mode of the selection vectors to evaluate over.
+  /// \param[in] configuration run time configuration.
+  /// \param[out] projector the returned projector object
+  static Status Make(SchemaPtr schema, const ExpressionVector& exprs,
+                     SelectionVector::Mode selection_vector_mode,
+                     std::shared_ptr<Configuration> configuration,
+                     std::shared_ptr<Projector>* projector);
+
   /// Evaluate the specified record batch, and return the allocated and populated output
   /// arrays. The output arrays will be allocated from the memory pool 'pool', and added
   /// to the vector 'output'.
@@ -81,24 +102,77 @@ class GANDIVA_EXPORT Projector {
   ///                populated by Evaluate.
   Status Evaluate(const arrow::RecordBatch& batch, const ArrayDataVector& output);
 
+  /// Evaluate the rows of the record batch in the selection vector, and return the
+  /// allocated and populated output arrays, with a row for each selected row. The
+  /// mode of the selection vector must be the one in 'Make'.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] selection_vector the rows to evaluate.
+  /// \param[in] pool memory pool used to allocate output arrays (if required).
+  /// \param[out] output the vector of allocated/populated arrays.
+  Status Evaluate(const arrow::RecordBatch& batch,
+                  const SelectionVector* selection_vector, arrow::MemoryPool* pool,
+                  arrow::ArrayVector* output);
+
+  /// Evaluate the rows of the record batch in the selection vector, and populate the
+  /// output arrays, which must be allocated by the caller with a row for each
+  /// selected row.
+  Status Evaluate(const arrow::RecordBatch& batch,
+                  const SelectionVector* selection_vector,
+                  const ArrayDataVector& output);
+
+  /// Like Evaluate(), but splits the record batch into ranges of rows that are
+  /// evaluated on the threads of the CPU thread pool. Batches of fewer than tens
+  /// of thousands of rows are evaluated on the calling thread.
+  Status EvaluateParallel(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                          arrow::ArrayVector* output);
+
+  /// Like Evaluate(), but splits the record batch into ranges of rows that are
+  /// evaluated on the threads of the CPU thread pool, each writing to its slice
+  /// of the output arrays.
+  Status EvaluateParallel(const arrow::RecordBatch& batch, const ArrayDataVector& output);
+
+  /// \brief The counters of the cache of built projectors, shared by the process.
+  static CacheStats GetCacheStats();
+
  private:
-  Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
-            const FieldVector& output_fields, std::shared_ptr<Configuration>);
+  Projector(std::unique_ptr<LLVMGenerator> llvm_generator,
+            std::vector<std::unique_ptr<DictionaryEvaluator>> dictionary_evaluators,
+            SchemaPtr schema, const FieldVector& output_fields,
+            SelectionVector::Mode selection_vector_mode, std::shared_ptr<Configuration>);
+
+  /// Execute the expressions, populating the output arrays.
+  Status Execute(const arrow::RecordBatch& batch, const SelectionVector* selection_vector,
+                 const ArrayDataVector& output, bool parallel);
 
   /// Allocate an ArrowData of length 'length'.
   Status AllocArrayData(const DataTypePtr& type, int64_t length, arrow::MemoryPool* pool,
                         ArrayDataPtr* array_data);
 
+  Status EvaluateImpl(const arrow::RecordBatch& batch,
+                      const SelectionVector* selection_vector, arrow::MemoryPool* pool,
+                      arrow::ArrayVector* output, bool parallel);
+
+  Status EvaluateImpl(const arrow::RecordBatch& batch,
+                      const SelectionVector* selection_vector,
+                      const ArrayDataVector& output, bool parallel);
+
   /// Validate that the ArrayData has sufficient capacity to accomodate 'num_records'.
   Status ValidateArrayDataCapacity(const arrow::ArrayData& array_data,
                                    const arrow::Field& field, int64_t num_records);
 
   /// Validate the common args for Evaluate() APIs.
-  Status ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch);
+  Status ValidateEvaluateArgsCommon(const arrow::RecordBatch& batch,
+                                    const SelectionVector* selection_vector);
 
+  // The generator of the code for the expressions that are not evaluated over a
+  // dictionary, or null if there are none.
   const std::unique_ptr<LLVMGenerator> llvm_generator_;
+  // The evaluator of each output, or null for the outputs of the generated code.
+  const std::vector<std::unique_ptr<DictionaryEvaluator>> dictionary_evaluators_;
   const SchemaPtr schema_;
   const FieldVector output_fields_;
+  const SelectionVector::Mode selection_vector_mode_;
   const std::shared_ptr<Configuration> configuration_;
 };
 
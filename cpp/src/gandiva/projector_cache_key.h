@@ -31,8 +31,8 @@ namespace gandiva {
 class ProjectorCacheKey {
  public:
   ProjectorCacheKey(SchemaPtr schema, std::shared_ptr<Configuration> configuration,
-                    ExpressionVector expression_vector)
-      : schema_(schema), configuration_(configuration), uniqifier_(0) {
+                    ExpressionVector expression_vector, SelectionVector::Mode mode)
+      : schema_(schema), configuration_(configuration), mode_(mode), uniqifier_(0) {
     static const int kSeedValue = 4;
     size_t result = kSeedValue;
     for (auto& expr : expression_vector) {
@@ -43,6 +43,7 @@ class ProjectorCacheKey {
     }
     boost::hash_combine(result, configuration->Hash());
     boost::hash_combine(result, schema_->ToString());
+    boost::hash_combine(result, static_cast<int>(mode_));
     boost::hash_combine(result, uniqifier_);
     hash_code_ = result;
   }
@@ -59,6 +60,10 @@ class ProjectorCacheKey {
       return false;
     }
 
+    if (mode_ != other.mode_) {
+      return false;
+    }
+
     if (expressions_as_strings_ != other.expressions_as_strings_) {
       return false;
     }
@@ -108,6 +113,7 @@ class ProjectorCacheKey {
   const SchemaPtr schema_;
   const std::shared_ptr<Configuration> configuration_;
   std::vector<std::string> expressions_as_strings_;
+  SelectionVector::Mode mode_;
   size_t hash_code_;
   uint32_t uniqifier_;
 };
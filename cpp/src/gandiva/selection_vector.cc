@@ -17,6 +17,7 @@
 
 #include "gandiva/selection_vector.h"
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -40,45 +41,12 @@ Status SelectionVector::PopulateFromBitMap(const uint8_t* bitmap, int64_t bitmap
       Status::Invalid("max_bitmap_index ", max_idx, " must be <= maxSupportedValue ",
                       GetMaxSupportedValue(), " in selection vector"));
 
-  int64_t max_slots = GetMaxSlots();
-
-  // jump 8-bytes at a time, add the index corresponding to each valid bit to the
-  // the selection vector.
-  int64_t selection_idx = 0;
-  const uint64_t* bitmap_64 = reinterpret_cast<const uint64_t*>(bitmap);
-  for (int64_t bitmap_idx = 0; bitmap_idx < bitmap_size / 8; ++bitmap_idx) {
-    uint64_t current_word = bitmap_64[bitmap_idx];
-
-    while (current_word != 0) {
-#if defined(_MSC_VER)
-#pragma warning(push)
-#pragma warning(disable : 4146)
-#endif
-      // MSVC warns about negating an unsigned type. We suppress it for now
-      uint64_t highest_only = current_word & -current_word;
-
-#if defined(_MSC_VER)
-#pragma warning(pop)
-#endif
-
-      int pos_in_word = arrow::BitUtil::CountTrailingZeros(highest_only);
-
-      int64_t pos_in_bitmap = bitmap_idx * 64 + pos_in_word;
-      if (pos_in_bitmap > max_bitmap_index) {
-        // the bitmap may be slighly larger for alignment/padding.
-        break;
-      }
-
-      ARROW_RETURN_IF(selection_idx >= max_slots,
-                      Status::Invalid("selection vector has no remaining slots"));
-
-      SetIndex(selection_idx, pos_in_bitmap);
-      ++selection_idx;
-
-      current_word ^= highest_only;
-    }
-  }
+  // the bitmap may be slighly larger for alignment/padding.
+  const int64_t length = std::min(bitmap_size * 8, max_bitmap_index + 1);
+  ARROW_RETURN_IF(arrow::internal::CountSetBits(bitmap, 0, length) > GetMaxSlots(),
+                  Status::Invalid("selection vector has no remaining slots"));
 
+  const int64_t selection_idx = PopulateIndices(bitmap, length);
   SetNumSlots(selection_idx);
   return Status::OK();
 }
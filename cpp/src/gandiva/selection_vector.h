@@ -34,6 +34,21 @@ class GANDIVA_EXPORT SelectionVector {
  public:
   virtual ~SelectionVector() = default;
 
+  /// The width of the indices, which code evaluating over a selection vector is
+  /// generated for.
+  enum Mode : int {
+    MODE_NONE,
+    MODE_UINT16,
+    MODE_UINT32,
+    MODE_UINT64,
+  };
+
+  /// The width of the indices.
+  virtual Mode GetMode() const = 0;
+
+  /// The raw indices.
+  virtual const uint8_t* GetData() const = 0;
+
   /// Get the value at a given index.
   virtual uint64_t GetIndex(int64_t index) const = 0;
 
@@ -112,6 +127,11 @@ class GANDIVA_EXPORT SelectionVector {
   ///             pool.
   static Status MakeInt64(int64_t max_slots, arrow::MemoryPool* pool,
                           std::shared_ptr<SelectionVector>* selection_vector);
+
+ protected:
+  /// \brief Write the positions of the set bits in the first 'length' bits of
+  /// the bitmap, which fit in the available slots, and return their number.
+  virtual int64_t PopulateIndices(const uint8_t* bitmap, int64_t length) = 0;
 };
 
 }  // namespace gandiva
@@ -22,6 +22,7 @@
 #include <memory>
 
 #include "arrow/status.h"
+#include "arrow/util/bit-util.h"
 #include "arrow/util/macros.h"
 
 #include "gandiva/arrow.h"
@@ -48,6 +49,15 @@ class SelectionVectorImpl : public SelectionVector {
 
   ArrayPtr ToArray() const override;
 
+  Mode GetMode() const override {
+    return sizeof(C_TYPE) == 2 ? MODE_UINT16
+                               : sizeof(C_TYPE) == 4 ? MODE_UINT32 : MODE_UINT64;
+  }
+
+  const uint8_t* GetData() const override {
+    return reinterpret_cast<const uint8_t*>(raw_data_);
+  }
+
   int64_t GetMaxSlots() const override { return max_slots_; }
 
   int64_t GetNumSlots() const override { return num_slots_; }
@@ -67,6 +77,10 @@ class SelectionVectorImpl : public SelectionVector {
   static Status ValidateBuffer(int64_t max_slots, std::shared_ptr<arrow::Buffer> buffer);
 
  protected:
+  int64_t PopulateIndices(const uint8_t* bitmap, int64_t length) override {
+    return arrow::internal::BitmapToIndices(bitmap, 0, length, raw_data_);
+  }
+
   /// maximum slots in the vector
   int64_t max_slots_;
 
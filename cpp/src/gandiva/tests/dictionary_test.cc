@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+#include "arrow/memory_pool.h"
+#include "gandiva/filter.h"
+#include "gandiva/projector.h"
+#include "gandiva/tests/test_util.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+using arrow::boolean;
+using arrow::int32;
+using arrow::int8;
+using arrow::utf8;
+
+class TestDictionary : public ::testing::Test {
+ public:
+  void SetUp() {
+    pool_ = arrow::default_memory_pool();
+    auto dictionary = MakeArrowArrayUtf8({"apple", "banana", "cherry"});
+    dict_type_ = arrow::dictionary(int8(), dictionary);
+  }
+
+  ArrayPtr MakeDictionaryArray(ArrayPtr indices) {
+    return std::make_shared<arrow::DictionaryArray>(dict_type_, indices);
+  }
+
+ protected:
+  arrow::MemoryPool* pool_;
+  DataTypePtr dict_type_;
+};
+
+TEST_F(TestDictionary, TestProject) {
+  // schema for input fields
+  auto field_d = field("d", dict_type_);
+  auto field_x = field("x", int32());
+  auto schema = arrow::schema({field_d, field_x});
+
+  // output fields
+  auto field_length = field("length", int32());
+  auto field_like = field("like", boolean());
+  auto field_sum = field("sum", int32());
+
+  // octet_length(d), like(d, "%an%") and x + x. The first two are evaluated over the
+  // dictionary.
+  auto node_d = TreeExprBuilder::MakeField(field_d);
+  auto length = TreeExprBuilder::MakeFunction("octet_length", {node_d}, int32());
+  auto like = TreeExprBuilder::MakeFunction(
+      "like", {node_d, TreeExprBuilder::MakeStringLiteral("%an%")}, boolean());
+  auto length_expr = TreeExprBuilder::MakeExpression(length, field_length);
+  auto like_expr = TreeExprBuilder::MakeExpression(like, field_like);
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field_x, field_x}, field_sum);
+
+  std::shared_ptr<Projector> projector;
+  auto status = Projector::Make(schema, {length_expr, like_expr, sum_expr},
+                                TestConfiguration(), &projector);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Create a row-batch with some sample data
+  int num_records = 5;
+  auto array_d = MakeDictionaryArray(
+      MakeArrowArrayInt8({0, 1, 2, 0, 1}, {true, true, true, false, true}));
+  auto array_x = MakeArrowArrayInt32({1, 2, 3, 4, 5}, {true, true, true, true, false});
+  // expected output
+  auto exp_length =
+      MakeArrowArrayInt32({5, 6, 6, 0, 6}, {true, true, true, false, true});
+  auto exp_like =
+      MakeArrowArrayBool({false, true, false, false, true}, {true, true, true, false, true});
+  auto exp_sum = MakeArrowArrayInt32({2, 4, 6, 8, 0}, {true, true, true, true, false});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array_d, array_x});
+
+  // Evaluate expression
+  arrow::ArrayVector outputs;
+  status = projector->Evaluate(*in_batch, pool_, &outputs);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Validate results
+  EXPECT_ARROW_ARRAY_EQUALS(exp_length, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_like, outputs.at(1));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(2));
+}
+
+TEST_F(TestDictionary, TestFilter) {
+  // schema for input fields
+  auto field_d = field("d", dict_type_);
+  auto schema = arrow::schema({field_d});
+
+  // d == "banana"
+  auto node_d = TreeExprBuilder::MakeField(field_d);
+  auto equal = TreeExprBuilder::MakeFunction(
+      "equal", {node_d, TreeExprBuilder::MakeStringLiteral("banana")}, boolean());
+  auto condition = TreeExprBuilder::MakeCondition(equal);
+
+  std::shared_ptr<Filter> filter;
+  auto status = Filter::Make(schema, condition, TestConfiguration(), &filter);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Create a row-batch with some sample data
+  int num_records = 6;
+  auto array_d = MakeDictionaryArray(
+      MakeArrowArrayInt8({1, 0, 1, 2, 1, 1}, {true, true, false, true, true, true}));
+  // expected output (indices for which condition matches)
+  auto exp = MakeArrowArrayUint16({0, 4, 5});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array_d});
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  status = SelectionVector::MakeInt16(num_records, pool_, &selection_vector);
+  EXPECT_TRUE(status.ok());
+
+  // Evaluate expression
+  status = filter->Evaluate(*in_batch, selection_vector);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Validate results
+  EXPECT_ARROW_ARRAY_EQUALS(exp, selection_vector->ToArray());
+}
+
+TEST_F(TestDictionary, TestMixedFields) {
+  // schema for input fields
+  auto field_d = field("d", dict_type_);
+  auto field_s = field("s", utf8());
+  auto schema = arrow::schema({field_d, field_s});
+
+  // d == s refers to a field that isn't dictionary-encoded, which isn't supported.
+  auto equal = TreeExprBuilder::MakeFunction(
+      "equal", {TreeExprBuilder::MakeField(field_d), TreeExprBuilder::MakeField(field_s)},
+      boolean());
+  auto condition = TreeExprBuilder::MakeCondition(equal);
+
+  std::shared_ptr<Filter> filter;
+  auto status = Filter::Make(schema, condition, TestConfiguration(), &filter);
+  EXPECT_FALSE(status.ok());
+}
+
+}  // namespace gandiva
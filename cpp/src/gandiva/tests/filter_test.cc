@@ -81,6 +81,50 @@ TEST_F(TestFilter, TestFilterCache) {
   EXPECT_TRUE(cached_filter.get() != should_be_new_filter1.get());
 }
 
+TEST_F(TestFilter, TestEvaluateParallel) {
+  // schema for input fields
+  auto field0 = field("f0", arrow::utf8());
+  auto schema = arrow::schema({field0});
+
+  // Build condition starts_with(f0, "a")
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto literal_a = TreeExprBuilder::MakeStringLiteral("a");
+  auto starts_with = TreeExprBuilder::MakeFunction("starts_with", {node_f0, literal_a},
+                                                   arrow::boolean());
+  auto condition = TreeExprBuilder::MakeCondition(starts_with);
+
+  std::shared_ptr<Filter> filter;
+  auto status = Filter::Make(schema, condition, TestConfiguration(), &filter);
+  EXPECT_TRUE(status.ok());
+
+  // Create a row-batch that is split into several ranges
+  int num_records = 500 * 1000 + 3;
+  std::vector<std::string> values(num_records);
+  std::vector<bool> validity(num_records);
+  for (int i = 0; i < num_records; i++) {
+    values[i] = (i % 7 == 0) ? "abc" : "bcd";
+    validity[i] = (i % 11 != 0);
+  }
+  auto array0 = MakeArrowArrayUtf8(values, validity);
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0});
+
+  std::shared_ptr<SelectionVector> expected;
+  status = SelectionVector::MakeInt32(num_records, pool_, &expected);
+  EXPECT_TRUE(status.ok());
+  status = filter->Evaluate(*in_batch, expected);
+  EXPECT_TRUE(status.ok());
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  status = SelectionVector::MakeInt32(num_records, pool_, &selection_vector);
+  EXPECT_TRUE(status.ok());
+  status = filter->EvaluateParallel(*in_batch, selection_vector);
+  EXPECT_TRUE(status.ok());
+
+  // Validate results
+  EXPECT_GT(selection_vector->GetNumSlots(), 0);
+  EXPECT_ARROW_ARRAY_EQUALS(expected->ToArray(), selection_vector->ToArray());
+}
+
 TEST_F(TestFilter, TestSimple) {
   // schema for input fields
   auto field0 = field("f0", int32());
@@ -18,6 +18,7 @@
 #include "gandiva/projector.h"
 #include <gtest/gtest.h>
 #include "arrow/memory_pool.h"
+#include "gandiva/filter.h"
 #include "gandiva/tests/test_util.h"
 #include "gandiva/tree_expr_builder.h"
 
@@ -86,6 +87,36 @@ TEST_F(TestProjector, TestProjectCache) {
   EXPECT_EQ(cached_projector, projector);
 }
 
+TEST_F(TestProjector, TestProjectCacheStats) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_mul = field("multiply", int32());
+  auto mul_expr = TreeExprBuilder::MakeExpression("multiply", {field0, field1}, field_mul);
+
+  auto configuration = ConfigurationBuilder().set_cache_capacity(64 << 20).build();
+  CacheStats before = Projector::GetCacheStats();
+
+  std::shared_ptr<Projector> projector;
+  auto status = Projector::Make(schema, {mul_expr}, configuration, &projector);
+  EXPECT_TRUE(status.ok());
+
+  std::shared_ptr<Projector> cached_projector;
+  status = Projector::Make(schema, {mul_expr}, configuration, &cached_projector);
+  EXPECT_TRUE(status.ok());
+  EXPECT_EQ(cached_projector.get(), projector.get());
+
+  CacheStats after = Projector::GetCacheStats();
+  EXPECT_EQ(after.capacity, 64 << 20);
+  EXPECT_GE(after.misses, before.misses + 1);
+  EXPECT_GE(after.hits, before.hits + 1);
+  EXPECT_GT(after.size, 0);
+  EXPECT_LE(after.size, after.capacity);
+}
+
 TEST_F(TestProjector, TestProjectCacheFieldNames) {
   // schema for input fields
   auto field0 = field("f0", int32());
@@ -199,6 +230,144 @@ TEST_F(TestProjector, TestIntSumSub) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(1));
 }
 
+TEST_F(TestProjector, TestSharedSubexpressions) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("sum", int32());
+  auto field_scaled = field("scaled", int32());
+
+  // (f0 + f1) + (3 * 4) and (f0 + f1) * (f0 + f1), where f0 + f1 is computed
+  // once and 3 * 4 is folded.
+  auto node0 = TreeExprBuilder::MakeField(field0);
+  auto node1 = TreeExprBuilder::MakeField(field1);
+  auto add = TreeExprBuilder::MakeFunction("add", {node0, node1}, int32());
+  auto constant = TreeExprBuilder::MakeFunction(
+      "multiply",
+      {TreeExprBuilder::MakeLiteral(static_cast<int32_t>(3)),
+       TreeExprBuilder::MakeLiteral(static_cast<int32_t>(4))},
+      int32());
+  auto sum_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("add", {add, constant}, int32()), field_sum);
+  auto scaled_expr = TreeExprBuilder::MakeExpression(
+      TreeExprBuilder::MakeFunction("multiply", {add, add}, int32()), field_scaled);
+
+  std::shared_ptr<Projector> projector;
+  auto status =
+      Projector::Make(schema, {sum_expr, scaled_expr}, TestConfiguration(), &projector);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Create a row-batch with some sample data
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 15, 17}, {true, true, false, true});
+  // expected output
+  auto exp_sum = MakeArrowArrayInt32({24, 27, 0, 0}, {true, true, false, false});
+  auto exp_scaled = MakeArrowArrayInt32({144, 225, 0, 0}, {true, true, false, false});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Evaluate expression
+  arrow::ArrayVector outputs;
+  status = projector->Evaluate(*in_batch, pool_, &outputs);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Validate results
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_scaled, outputs.at(1));
+}
+
+TEST_F(TestProjector, TestTieredCompilation) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f2", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  auto configuration = ConfigurationBuilder().set_tiered_compilation(true).build();
+  std::shared_ptr<Projector> projector;
+  auto status = Projector::Make(schema, {sum_expr}, configuration, &projector);
+  EXPECT_TRUE(status.ok());
+
+  // Create a row-batch with some sample data
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 15, 17}, {true, true, false, true});
+  // expected output
+  auto exp_sum = MakeArrowArrayInt32({12, 15, 0, 0}, {true, true, false, false});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // The results are the same before and after switching to the optimised code.
+  for (int i = 0; i < 100; i++) {
+    arrow::ArrayVector outputs;
+    status = projector->Evaluate(*in_batch, pool_, &outputs);
+    EXPECT_TRUE(status.ok());
+    EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  }
+}
+
+TEST_F(TestProjector, TestEvaluateParallel) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+  auto field_less = field("less_than", boolean());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+  auto less_expr =
+      TreeExprBuilder::MakeExpression("less_than", {field0, field1}, field_less);
+
+  std::shared_ptr<Projector> projector;
+  auto status =
+      Projector::Make(schema, {sum_expr, less_expr}, TestConfiguration(), &projector);
+  EXPECT_TRUE(status.ok());
+
+  // Create a row-batch that is split into several ranges, the last of which is
+  // not a multiple of 64 rows.
+  int num_records = 1000 * 1000 + 7;
+  std::vector<int32_t> values0(num_records);
+  std::vector<int32_t> values1(num_records);
+  std::vector<bool> validity0(num_records);
+  std::vector<bool> validity1(num_records);
+  for (int i = 0; i < num_records; i++) {
+    values0[i] = i;
+    values1[i] = i % 1000;
+    validity0[i] = (i % 3 != 0);
+    validity1[i] = (i % 5 != 0);
+  }
+  auto array0 = MakeArrowArrayInt32(values0, validity0);
+  auto array1 = MakeArrowArrayInt32(values1, validity1);
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // Evaluate expression on the calling thread, and on the thread pool
+  arrow::ArrayVector expected;
+  status = projector->Evaluate(*in_batch, pool_, &expected);
+  EXPECT_TRUE(status.ok());
+
+  arrow::ArrayVector outputs;
+  status = projector->EvaluateParallel(*in_batch, pool_, &outputs);
+  EXPECT_TRUE(status.ok());
+
+  // Validate results
+  EXPECT_ARROW_ARRAY_EQUALS(expected.at(0), outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(expected.at(1), outputs.at(1));
+}
+
 template <typename TYPE, typename C_TYPE>
 static void TestArithmeticOpsForType(arrow::MemoryPool* pool) {
   auto atype = arrow::TypeTraits<TYPE>::type_singleton();
@@ -640,4 +809,65 @@ TEST_F(TestProjector, TestModZero) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_mod, outputs.at(0));
 }
 
+TEST_F(TestProjector, TestSelectionVector) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+
+  // Build the condition f0 > 2, and the expression f0 + f1
+  auto literal_2 = TreeExprBuilder::MakeLiteral(2);
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto condition = TreeExprBuilder::MakeCondition(
+      TreeExprBuilder::MakeFunction("greater_than", {node_f0, literal_2}, boolean()));
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+
+  std::shared_ptr<Filter> filter;
+  auto status = Filter::Make(schema, condition, TestConfiguration(), &filter);
+  ASSERT_OK(status);
+
+  std::shared_ptr<Projector> projector;
+  status = Projector::Make(schema, {sum_expr}, SelectionVector::MODE_UINT16,
+                           TestConfiguration(), &projector);
+  ASSERT_OK(status);
+
+  // Create a row-batch with some sample data
+  int num_records = 6;
+  auto array0 =
+      MakeArrowArrayInt32({1, 3, 2, 4, 5, 6}, {true, true, true, true, true, true});
+  auto array1 =
+      MakeArrowArrayInt32({10, 20, 30, 40, 50, 60}, {true, true, true, false, true, true});
+  // expected output, for the rows 1, 3, 4 and 5.
+  auto exp = MakeArrowArrayInt32({23, 0, 55, 66}, {true, false, true, true});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  std::shared_ptr<SelectionVector> selection_vector;
+  status = SelectionVector::MakeInt16(num_records, pool_, &selection_vector);
+  ASSERT_OK(status);
+  status = filter->Evaluate(*in_batch, selection_vector);
+  ASSERT_OK(status);
+
+  // Evaluate expression over the selected rows
+  arrow::ArrayVector outputs;
+  status = projector->Evaluate(*in_batch, selection_vector.get(), pool_, &outputs);
+  ASSERT_OK(status);
+
+  // Validate results
+  EXPECT_ARROW_ARRAY_EQUALS(exp, outputs.at(0));
+
+  // The mode of the selection vector must match the projector's.
+  std::shared_ptr<SelectionVector> selection_vector32;
+  status = SelectionVector::MakeInt32(num_records, pool_, &selection_vector32);
+  ASSERT_OK(status);
+  status = projector->Evaluate(*in_batch, selection_vector32.get(), pool_, &outputs);
+  EXPECT_EQ(status.code(), StatusCode::Invalid);
+  status = projector->Evaluate(*in_batch, pool_, &outputs);
+  EXPECT_EQ(status.code(), StatusCode::Invalid);
+}
+
 }  // namespace gandiva
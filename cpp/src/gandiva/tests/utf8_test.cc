@@ -317,6 +317,50 @@ TEST_F(TestUtf8, TestInternalAllocs) {
   EXPECT_ARROW_ARRAY_EQUALS(exp, outputs.at(0));
 }
 
+TEST_F(TestUtf8, TestLower) {
+  // schema for input fields
+  auto field_a = field("a", utf8());
+  auto schema = arrow::schema({field_a});
+
+  // output fields
+  auto res = field("res", boolean());
+
+  // build expressions.
+  // lower(a) == literal("spark")
+
+  auto node_a = TreeExprBuilder::MakeField(field_a);
+  auto lower_a = TreeExprBuilder::MakeFunction("lower", {node_a}, utf8());
+  auto literal_spark = TreeExprBuilder::MakeStringLiteral("spark");
+  auto is_equal =
+      TreeExprBuilder::MakeFunction("equal", {lower_a, literal_spark}, boolean());
+  auto expr = TreeExprBuilder::MakeExpression(is_equal, res);
+
+  // Build a projector for the expressions.
+  std::shared_ptr<Projector> projector;
+  auto status = Projector::Make(schema, {expr}, TestConfiguration(), &projector);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Create a row-batch with some sample data
+  int num_records = 5;
+  auto array_a = MakeArrowArrayUtf8({"Spark", "SPARK", "sparks", "spark", "मदन"},
+                                    {true, true, true, false, true});
+
+  // expected output
+  auto exp = MakeArrowArrayBool({true, true, false, false, false},
+                                {true, true, true, false, true});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array_a});
+
+  // Evaluate expression
+  arrow::ArrayVector outputs;
+  status = projector->Evaluate(*in_batch, pool_, &outputs);
+  EXPECT_TRUE(status.ok()) << status.message();
+
+  // Validate results
+  EXPECT_ARROW_ARRAY_EQUALS(exp, outputs.at(0));
+}
+
 TEST_F(TestUtf8, TestCastDate) {
   // schema for input fields
   auto field_a = field("a", utf8());
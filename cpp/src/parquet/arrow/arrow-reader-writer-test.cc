@@ -37,6 +37,7 @@
 #include "parquet/api/reader.h"
 #include "parquet/api/writer.h"
 
+#include "parquet/arrow/predicate.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/test-util.h"
@@ -1585,6 +1586,289 @@ TEST(TestArrowReadWrite, MultithreadedRead) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedReadManyRowGroups) {
+  // Few columns and many row groups: chunks are decoded in parallel across
+  // row groups and must be assembled in order
+  const int num_columns = 3;
+  const int num_rows = 1000;
+  const int64_t row_group_size = 20;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Table> result;
+  ASSERT_NO_FATAL_FAILURE(
+      DoSimpleRoundtrip(table, true /* use_threads */, row_group_size, {}, &result));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+
+  ASSERT_NO_FATAL_FAILURE(
+      DoSimpleRoundtrip(table, true /* use_threads */, row_group_size, {0, 2}, &result));
+  ASSERT_EQ(2, result->num_columns());
+  ASSERT_TRUE(table->column(2)->data()->Equals(*result->column(1)->data()));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, row_group_size,
+                                             default_arrow_writer_properties(), &buffer));
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(),
+                              ::parquet::default_reader_properties(), nullptr, &reader));
+  reader->set_use_threads(true);
+  ASSERT_EQ(50, reader->num_row_groups());
+  ASSERT_OK_NO_THROW(reader->ReadRowGroups({3, 1, 4}, &result));
+  ASSERT_EQ(60, result->num_rows());
+  for (int i = 0; i < num_columns; ++i) {
+    ASSERT_TRUE(table->column(i)->data()->Slice(60, 20)->Equals(
+        *result->column(i)->data()->Slice(0, 20)));
+    ASSERT_TRUE(table->column(i)->data()->Slice(20, 20)->Equals(
+        *result->column(i)->data()->Slice(20, 20)));
+  }
+}
+
+TEST(TestArrowReadWrite, PreBuffer) {
+  const int num_columns = 4;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, 100, default_arrow_writer_properties(), &buffer));
+
+  for (bool use_threads : {false, true}) {
+    ReaderProperties properties = ::parquet::default_reader_properties();
+    properties.enable_pre_buffer();
+    ::arrow::io::CoalesceOptions options = ::arrow::io::CoalesceOptions::Defaults();
+    // Merge some column chunks but not all of them
+    options.range_size_limit = 3000;
+    options.use_threads = use_threads;
+    properties.set_pre_buffer_options(options);
+
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(), properties, nullptr,
+                                &reader));
+    reader->set_use_threads(use_threads);
+    ASSERT_EQ(10, reader->num_row_groups());
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+
+    ASSERT_OK_NO_THROW(reader->ReadRowGroups({7, 8}, {1, 3}, &result));
+    ASSERT_EQ(200, result->num_rows());
+    ASSERT_TRUE(
+        table->column(3)->data()->Slice(700, 200)->Equals(result->column(1)->data()));
+
+    // Chunks outside of the pre-buffered ranges are read directly
+    ASSERT_OK_NO_THROW(reader->ReadRowGroup(5, &result));
+    for (int i = 0; i < num_columns; ++i) {
+      ASSERT_TRUE(
+          table->column(i)->data()->Slice(500, 100)->Equals(result->column(i)->data()));
+    }
+
+    std::shared_ptr<::arrow::RecordBatchReader> batch_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({2, 4}, &batch_reader));
+    std::shared_ptr<::arrow::RecordBatch> batch;
+    ASSERT_OK(batch_reader->ReadNext(&batch));
+    ASSERT_EQ(100, batch->num_rows());
+    ASSERT_OK(batch_reader->ReadNext(&batch));
+    ASSERT_TRUE(batch->column(0)->Equals(
+        table->column(0)->data()->Slice(400, 100)->chunk(0)));
+  }
+}
+
+TEST(TestArrowReadWrite, ParallelWrite) {
+  const int num_columns = 4;
+  const int num_rows = 1000;
+  const int64_t row_group_size = 400;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  // Small pages so that several of them are compressed concurrently
+  auto WriteBuffer = [&](bool parallel, std::shared_ptr<Buffer>* out) {
+    WriterProperties::Builder builder;
+    builder.compression(Compression::GZIP)->data_pagesize(512);
+    if (parallel) {
+      builder.enable_parallel_compression(2);
+    }
+    auto arrow_properties =
+        ArrowWriterProperties::Builder().set_use_threads(parallel)->build();
+    auto sink = std::make_shared<InMemoryOutputStream>();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                  row_group_size, builder.build(), arrow_properties));
+    *out = sink->GetBuffer();
+  };
+
+  for (bool parallel : {false, true}) {
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_NO_FATAL_FAILURE(WriteBuffer(parallel, &buffer));
+
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(),
+                                ::parquet::default_reader_properties(), nullptr,
+                                &reader));
+    ASSERT_EQ(3, reader->num_row_groups());
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+  }
+}
+
+TEST(TestArrowReadWrite, WriteRecordBatches) {
+  const int num_rows = 1000;
+  const int batch_size = 100;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(2, num_rows, 1, &table));
+
+  auto WriteBatches = [&](int64_t max_row_group_bytes, std::shared_ptr<Buffer>* out) {
+    // Small pages so that the row group size grows with every batch
+    auto properties = WriterProperties::Builder()
+                          .disable_dictionary()
+                          ->data_pagesize(512)
+                          ->max_row_group_length(300)
+                          ->max_row_group_bytes(max_row_group_bytes)
+                          ->build();
+    auto sink = std::make_shared<InMemoryOutputStream>();
+    std::unique_ptr<FileWriter> writer;
+    ASSERT_OK_NO_THROW(FileWriter::Open(*table->schema(), ::arrow::default_memory_pool(),
+                                        sink, properties, &writer));
+    for (int offset = 0; offset < num_rows; offset += batch_size) {
+      auto batch = ::arrow::RecordBatch::Make(
+          table->schema(), batch_size,
+          {table->column(0)->data()->chunk(0)->Slice(offset, batch_size),
+           table->column(1)->data()->chunk(0)->Slice(offset, batch_size)});
+      ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batch));
+    }
+    ASSERT_OK_NO_THROW(writer->Close());
+    *out = sink->GetBuffer();
+  };
+
+  // Row groups are closed once they reach max_row_group_length rows, or
+  // max_row_group_bytes bytes after a batch
+  for (int64_t max_bytes : {DEFAULT_MAX_ROW_GROUP_BYTES, static_cast<int64_t>(1)}) {
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_NO_FATAL_FAILURE(WriteBatches(max_bytes, &buffer));
+
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(),
+                                ::parquet::default_reader_properties(), nullptr,
+                                &reader));
+    auto metadata = reader->parquet_reader()->metadata();
+    if (max_bytes == DEFAULT_MAX_ROW_GROUP_BYTES) {
+      ASSERT_EQ(4, metadata->num_row_groups());
+      ASSERT_EQ(300, metadata->RowGroup(0)->num_rows());
+      ASSERT_EQ(100, metadata->RowGroup(3)->num_rows());
+    } else {
+      ASSERT_EQ(num_rows / batch_size, metadata->num_row_groups());
+    }
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+  }
+
+  // Batches must match the schema the file was opened with
+  std::shared_ptr<Table> other;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(3, 10, 1, &other));
+  auto sink = std::make_shared<InMemoryOutputStream>();
+  std::unique_ptr<FileWriter> writer;
+  ASSERT_OK_NO_THROW(FileWriter::Open(*table->schema(), ::arrow::default_memory_pool(),
+                                      sink, default_writer_properties(), &writer));
+  auto batch = ::arrow::RecordBatch::Make(
+      other->schema(), 10,
+      {other->column(0)->data()->chunk(0), other->column(1)->data()->chunk(0),
+       other->column(2)->data()->chunk(0)});
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batch));
+}
+
+TEST(TestArrowReadWrite, SortedRowGroups) {
+  using ::arrow::ArrayFromVector;
+
+  const int64_t num_rows = 100;
+  const int64_t row_group_size = 40;
+  std::vector<int32_t> keys;
+  std::vector<int64_t> values;
+  for (int64_t i = 0; i < num_rows; ++i) {
+    keys.push_back(static_cast<int32_t>((i * 37) % 11));
+    values.push_back(i);
+  }
+  std::shared_ptr<Array> key_array, value_array;
+  ArrayFromVector<::arrow::Int32Type, int32_t>(keys, &key_array);
+  ArrayFromVector<::arrow::Int64Type, int64_t>(values, &value_array);
+  auto schema = ::arrow::schema({field("value", ::arrow::int64(), false),
+                                 field("key", ::arrow::int32(), false)});
+
+  for (bool use_threads : {false, true}) {
+    auto sink = std::make_shared<InMemoryOutputStream>();
+    std::unique_ptr<FileWriter> writer;
+    ASSERT_OK_NO_THROW(FileWriter::Open(
+        *schema, ::arrow::default_memory_pool(), sink, default_writer_properties(),
+        ArrowWriterProperties::Builder()
+            .sort_row_groups_by({1})
+            ->set_use_threads(use_threads)
+            ->build(),
+        &writer));
+    // Rows are buffered across calls until a row group is full
+    for (int64_t offset : {0, 60}) {
+      const int64_t length = offset == 0 ? 60 : num_rows - 60;
+      auto table = Table::Make(schema, {value_array->Slice(offset, length),
+                                        key_array->Slice(offset, length)});
+      ASSERT_OK_NO_THROW(writer->WriteTable(*table, row_group_size));
+    }
+    ASSERT_OK_NO_THROW(writer->Close());
+
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(sink->GetBuffer()),
+                                ::arrow::default_memory_pool(),
+                                ::parquet::default_reader_properties(), nullptr,
+                                &reader));
+    ASSERT_EQ(3, reader->num_row_groups());
+    for (int i = 0; i < reader->num_row_groups(); ++i) {
+      auto metadata = reader->parquet_reader()->metadata()->RowGroup(i);
+      ASSERT_EQ(1, metadata->sorting_columns().size());
+      ASSERT_EQ(1, metadata->sorting_columns()[0].column_idx);
+      ASSERT_FALSE(metadata->sorting_columns()[0].descending);
+      ASSERT_FALSE(metadata->sorting_columns()[0].nulls_first);
+
+      // The rows of the row group in a stable sort by key
+      const int64_t begin = i * row_group_size;
+      const int64_t end = std::min(num_rows, begin + row_group_size);
+      std::vector<int64_t> expected_values(values.begin() + begin, values.begin() + end);
+      std::stable_sort(expected_values.begin(), expected_values.end(),
+                       [&](int64_t a, int64_t b) { return keys[a] < keys[b]; });
+      std::vector<int32_t> expected_keys;
+      for (int64_t value : expected_values) {
+        expected_keys.push_back(keys[value]);
+      }
+      std::shared_ptr<Array> expected_value_array, expected_key_array;
+      ArrayFromVector<::arrow::Int64Type, int64_t>(expected_values,
+                                                   &expected_value_array);
+      ArrayFromVector<::arrow::Int32Type, int32_t>(expected_keys, &expected_key_array);
+      auto expected = Table::Make(schema, {expected_value_array, expected_key_array});
+
+      std::shared_ptr<Table> result;
+      ASSERT_OK_NO_THROW(reader->ReadRowGroup(i, &result));
+      ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*expected, *result, false));
+    }
+  }
+
+  // Nested fields cannot be sorted by
+  auto list_schema = ::arrow::schema({field("list", ::arrow::list(::arrow::int32()))});
+  auto list_table = Table::Make(
+      list_schema, {::arrow::ArrayFromJSON(::arrow::list(::arrow::int32()), "[[1]]")});
+  auto sink = std::make_shared<InMemoryOutputStream>();
+  auto arrow_properties =
+      ArrowWriterProperties::Builder().sort_row_groups_by({0})->build();
+  ASSERT_RAISES(NotImplemented,
+                WriteTable(*list_table, ::arrow::default_memory_pool(), sink, 10,
+                           default_writer_properties(), arrow_properties));
+}
+
 TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -1621,6 +1905,142 @@ TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   ASSERT_TRUE(table->Equals(*concatenated));
 }
 
+// Check that table holds the rows of expected in rows, row group
+// row_group_offset of expected
+void AssertSelectedRows(const Table& expected, int64_t row_group_offset,
+                        const std::vector<RowRange>& rows, const Table& table) {
+  int64_t num_rows = 0;
+  for (const RowRange& range : rows) {
+    num_rows += range.length;
+  }
+  ASSERT_EQ(num_rows, table.num_rows());
+  for (int i = 0; i < expected.num_columns(); ++i) {
+    const ChunkedArray& result = *table.column(i)->data();
+    ASSERT_EQ(1, result.num_chunks());
+    const std::shared_ptr<Array> values = expected.column(i)->data()->chunk(0);
+    int64_t position = 0;
+    for (const RowRange& range : rows) {
+      auto expected_rows = values->Slice(row_group_offset + range.offset, range.length);
+      auto actual_rows = result.chunk(0)->Slice(position, range.length);
+      ASSERT_TRUE(actual_rows->Equals(*expected_rows))
+          << "column " << i << " rows " << range.offset << "+" << range.length;
+      position += range.length;
+    }
+  }
+}
+
+TEST(TestArrowReadWrite, ReadRowGroupRowRanges) {
+  const int num_rows = 1000;
+  const int64_t row_group_size = num_rows / 2;
+
+  std::shared_ptr<Table> doubles;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(2, num_rows, 1, &doubles));
+  std::shared_ptr<::DataType> list_type;
+  std::shared_ptr<Array> lists;
+  ASSERT_NO_FATAL_FAILURE(MakeListArray(num_rows, 20, &list_type, &lists));
+  auto list_column = std::make_shared<Column>(field("lists", list_type), lists);
+  std::shared_ptr<Table> table;
+  ASSERT_OK(doubles->AddColumn(2, list_column, &table));
+
+  // Small pages, so that whole pages are skipped
+  WriterProperties::Builder builder;
+  builder.data_pagesize(256);
+  auto sink = std::make_shared<InMemoryOutputStream>();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                row_group_size, builder.build(),
+                                default_arrow_writer_properties()));
+  std::shared_ptr<Buffer> buffer = sink->GetBuffer();
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(),
+                              ::parquet::default_reader_properties(), nullptr, &reader));
+
+  std::vector<std::vector<RowRange>> selections = {
+      {},
+      {{0, 3}, {10, 1}, {200, 150}, {499, 1}},
+      {{1, 498}},
+      {{0, row_group_size}},
+      {{5, 1}, {6, 2}, {480, 10}}};
+  for (const auto& rows : selections) {
+    for (int row_group = 0; row_group < 2; ++row_group) {
+      std::shared_ptr<Table> result;
+      ASSERT_OK_NO_THROW(reader->ReadRowGroup(row_group, {0, 1, 2}, rows, &result));
+      ASSERT_NO_FATAL_FAILURE(
+          AssertSelectedRows(*table, row_group * row_group_size, rows, *result));
+    }
+  }
+
+  std::shared_ptr<Table> result;
+  ASSERT_RAISES(Invalid, reader->ReadRowGroup(0, {0}, {{10, 5}, {12, 1}}, &result));
+  ASSERT_RAISES(Invalid, reader->ReadRowGroup(0, {0}, {{490, 11}}, &result));
+}
+
+TEST(TestArrowReadWrite, ReadRowGroupWithRowFilter) {
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(3, num_rows, 1, &table));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(
+      WriteTableToBuffer(table, num_rows, default_arrow_writer_properties(), &buffer));
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(),
+                              ::parquet::default_reader_properties(), nullptr, &reader));
+
+  // Select the rows whose first column is above 0.9
+  std::shared_ptr<Array> selection;
+  auto filter = [&selection](const Table& columns, std::shared_ptr<Array>* out) {
+    EXPECT_EQ(1, columns.num_columns());
+    const auto& values =
+        static_cast<const ::arrow::DoubleArray&>(*columns.column(0)->data()->chunk(0));
+    ::arrow::BooleanBuilder builder;
+    for (int64_t i = 0; i < values.length(); ++i) {
+      RETURN_NOT_OK(builder.Append(values.IsValid(i) && values.Value(i) > 0.9));
+    }
+    RETURN_NOT_OK(builder.Finish(out));
+    selection = *out;
+    return ::arrow::Status::OK();
+  };
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadRowGroup(0, {0}, filter, {0, 1, 2}, &result));
+  std::vector<RowRange> rows;
+  ASSERT_OK(SelectionToRowRanges(*selection, &rows));
+  ASSERT_FALSE(rows.empty());
+  ASSERT_NO_FATAL_FAILURE(AssertSelectedRows(*table, 0, rows, *result));
+
+  auto bad_filter = [](const Table& columns, std::shared_ptr<Array>* out) {
+    *out = ::arrow::ArrayFromJSON(::arrow::boolean(), "[true]");
+    return ::arrow::Status::OK();
+  };
+  ASSERT_RAISES(Invalid, reader->ReadRowGroup(0, {0}, bad_filter, {1}, &result));
+}
+
+TEST(TestArrowReadWrite, SelectionToRowRanges) {
+  std::vector<RowRange> rows;
+  auto selection = ::arrow::ArrayFromJSON(
+      ::arrow::boolean(), "[true, true, null, false, true, false, false, true]");
+  ASSERT_OK(SelectionToRowRanges(*selection, &rows));
+  ASSERT_EQ(3, rows.size());
+  ASSERT_EQ(0, rows[0].offset);
+  ASSERT_EQ(2, rows[0].length);
+  ASSERT_EQ(4, rows[1].offset);
+  ASSERT_EQ(1, rows[1].length);
+  ASSERT_EQ(7, rows[2].offset);
+  ASSERT_EQ(1, rows[2].length);
+
+  ASSERT_OK(SelectionToRowRanges(*selection->Slice(2, 3), &rows));
+  ASSERT_EQ(1, rows.size());
+  ASSERT_EQ(2, rows[0].offset);
+  ASSERT_EQ(1, rows[0].length);
+
+  ASSERT_RAISES(TypeError, SelectionToRowRanges(
+                               *::arrow::ArrayFromJSON(::arrow::int8(), "[1]"), &rows));
+}
+
 TEST(TestArrowReadWrite, GetRecordBatchReader) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -1654,6 +2074,303 @@ TEST(TestArrowReadWrite, GetRecordBatchReader) {
   ASSERT_EQ(nullptr, batch);
 }
 
+void ReadAllBatches(FileReader* reader, int64_t max_batch_rows,
+                    std::shared_ptr<Table>* out) {
+  std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &rb_reader));
+
+  std::vector<std::shared_ptr<::arrow::RecordBatch>> batches;
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  ASSERT_OK(rb_reader->ReadNext(&batch));
+  while (batch != nullptr) {
+    ASSERT_GT(batch->num_rows(), 0);
+    ASSERT_LE(batch->num_rows(), max_batch_rows);
+    batches.push_back(batch);
+    ASSERT_OK(rb_reader->ReadNext(&batch));
+  }
+  ASSERT_OK(Table::FromRecordBatches(rb_reader->schema(), batches, out));
+}
+
+TEST(TestArrowReadWrite, GetRecordBatchReaderBatchSize) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 2,
+                                             default_arrow_writer_properties(), &buffer));
+
+  for (bool use_threads : {false, true}) {
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                ::arrow::default_memory_pool(),
+                                ::parquet::default_reader_properties(), nullptr,
+                                &reader));
+    reader->set_use_threads(use_threads);
+    reader->set_batch_size(64);
+
+    std::shared_ptr<Table> result;
+    ASSERT_NO_FATAL_FAILURE(ReadAllBatches(reader.get(), 64, &result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+  }
+
+  // 20 double columns take at least 160 bytes a row once decoded; the size
+  // of the first batch is only estimated from the column chunk sizes
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(),
+                              ::parquet::default_reader_properties(), nullptr, &reader));
+  reader->set_batch_memory_limit(160 * 50);
+
+  std::shared_ptr<Table> result;
+  ASSERT_NO_FATAL_FAILURE(ReadAllBatches(reader.get(), 100, &result));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+}
+
+// Ten row groups of ten rows: ts is the row number, value half of it and
+// name is null throughout row group 5
+void MakePredicateTable(std::shared_ptr<Table>* out) {
+  using ::arrow::ArrayFromVector;
+
+  std::vector<int64_t> ts;
+  std::vector<double> values;
+  std::vector<bool> name_valid;
+  std::vector<std::string> names;
+  for (int64_t i = 0; i < 100; ++i) {
+    ts.push_back(i);
+    values.push_back(static_cast<double>(i) / 2);
+    name_valid.push_back(i / 10 != 5);
+    names.push_back(std::string(1, static_cast<char>('a' + i / 10)) +
+                    std::to_string(i % 10));
+  }
+  std::shared_ptr<Array> ts_array, value_array, name_array;
+  ArrayFromVector<::arrow::Int64Type, int64_t>(ts, &ts_array);
+  ArrayFromVector<::arrow::DoubleType, double>(values, &value_array);
+  ArrayFromVector<::arrow::StringType, std::string>(name_valid, names, &name_array);
+
+  auto schema = ::arrow::schema({field("ts", ::arrow::int64(), false),
+                                 field("value", ::arrow::float64(), false),
+                                 field("name", ::arrow::utf8())});
+  *out = Table::Make(schema, {ts_array, value_array, name_array});
+}
+
+void OpenPredicateFile(const std::shared_ptr<Table>& table,
+                       const std::shared_ptr<WriterProperties>& properties,
+                       std::unique_ptr<FileReader>* reader) {
+  auto sink = std::make_shared<InMemoryOutputStream>();
+  ASSERT_OK_NO_THROW(
+      WriteTable(*table, ::arrow::default_memory_pool(), sink, 10, properties));
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(sink->GetBuffer()),
+                              ::arrow::default_memory_pool(),
+                              ::parquet::default_reader_properties(), nullptr, reader));
+}
+
+TEST(TestArrowReadWrite, RowGroupPredicate) {
+  using Predicate = RowGroupPredicate;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakePredicateTable(&table));
+  std::unique_ptr<FileReader> reader;
+  ASSERT_NO_FATAL_FAILURE(OpenPredicateFile(table, default_writer_properties(), &reader));
+  ASSERT_EQ(10, reader->num_row_groups());
+
+  auto CheckRowGroups = [&reader](const Predicate& predicate,
+                                  const std::vector<int>& expected) {
+    std::vector<int> row_groups;
+    ASSERT_OK(reader->FilterRowGroups(predicate, &row_groups));
+    ASSERT_EQ(expected, row_groups) << predicate.ToString();
+  };
+
+  CheckRowGroups(*Predicate::And(Predicate::Compare(0, Predicate::GREATER_EQUAL, 25L),
+                                 Predicate::Compare(0, Predicate::LESS, 47L)),
+                 {2, 3, 4});
+  CheckRowGroups(*Predicate::Or(Predicate::Compare(0, Predicate::LESS, 5L),
+                                Predicate::Compare(0, Predicate::GREATER, 94L)),
+                 {0, 9});
+  CheckRowGroups(*Predicate::Compare(0, Predicate::EQUAL, 1000L), {});
+  CheckRowGroups(*Predicate::Compare(0, Predicate::NOT_EQUAL, 0L),
+                 {0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+  CheckRowGroups(*Predicate::Compare(1, Predicate::LESS_EQUAL, 10), {0, 1, 2});
+  CheckRowGroups(*Predicate::Compare(1, Predicate::GREATER, 44.75), {9});
+  CheckRowGroups(*Predicate::Compare(2, Predicate::LESS, "c"), {0, 1});
+  // Row group 5 only holds nulls, which satisfy no comparison
+  CheckRowGroups(*Predicate::Compare(2, Predicate::NOT_EQUAL, "zz"),
+                 {0, 1, 2, 3, 4, 6, 7, 8, 9});
+
+  auto predicate = Predicate::And(Predicate::Compare(0, Predicate::GREATER_EQUAL, 25L),
+                                  Predicate::Compare(0, Predicate::LESS, 47L));
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable({0, 2}, *predicate, &result));
+  ASSERT_EQ(2, result->num_columns());
+  ASSERT_EQ(30, result->num_rows());
+  ASSERT_TRUE(result->column(0)->data()->Equals(table->column(0)->data()->Slice(20, 30)));
+  ASSERT_TRUE(result->column(1)->data()->Equals(table->column(2)->data()->Slice(20, 30)));
+
+  // Nothing matches: an empty table with the selected schema
+  ASSERT_OK_NO_THROW(
+      reader->ReadTable({0}, *Predicate::Compare(0, Predicate::LESS, 0L), &result));
+  ASSERT_EQ(0, result->num_rows());
+  ASSERT_EQ(1, result->num_columns());
+  ASSERT_TRUE(result->schema()->field(0)->Equals(table->schema()->field(0)));
+
+  // The order of the requested row groups is kept
+  std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader(
+      {9, 0, 3}, {0}, *Predicate::Compare(0, Predicate::LESS, 35L), &rb_reader));
+  auto ts_array = table->column(0)->data()->chunk(0);
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  ASSERT_OK(rb_reader->ReadNext(&batch));
+  ASSERT_EQ(10, batch->num_rows());
+  ASSERT_TRUE(batch->column(0)->Equals(ts_array->Slice(0, 10)));
+  ASSERT_OK(rb_reader->ReadNext(&batch));
+  ASSERT_TRUE(batch->column(0)->Equals(ts_array->Slice(30, 10)));
+  ASSERT_OK(rb_reader->ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+
+  std::vector<int> row_groups;
+  ASSERT_RAISES(Invalid,
+                reader->FilterRowGroups(*Predicate::Compare(3, Predicate::EQUAL, 1L),
+                                        &row_groups));
+  ASSERT_RAISES(Invalid, reader->FilterRowGroups(
+                             *Predicate::Compare(0, Predicate::EQUAL, "1"), &row_groups));
+  ASSERT_RAISES(Invalid, reader->FilterRowGroups(
+                             {10}, *Predicate::Compare(0, Predicate::EQUAL, 1L),
+                             &row_groups));
+}
+
+TEST(TestArrowReadWrite, RowGroupPredicateWithoutStatistics) {
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakePredicateTable(&table));
+  std::unique_ptr<FileReader> reader;
+  ASSERT_NO_FATAL_FAILURE(OpenPredicateFile(
+      table, WriterProperties::Builder().disable_statistics()->build(), &reader));
+
+  std::vector<int> row_groups;
+  ASSERT_OK(reader->FilterRowGroups(
+      *RowGroupPredicate::Compare(0, RowGroupPredicate::EQUAL, 1000L), &row_groups));
+  ASSERT_EQ(10, row_groups.size());
+}
+
+TEST(TestArrowReadWrite, RowGroupPredicateWithBloomFilter) {
+  using Predicate = RowGroupPredicate;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakePredicateTable(&table));
+  std::unique_ptr<FileReader> reader;
+  ASSERT_NO_FATAL_FAILURE(OpenPredicateFile(table,
+                                            WriterProperties::Builder()
+                                                .enable_bloom_filter("value", 100)
+                                                ->enable_bloom_filter("name", 100)
+                                                ->build(),
+                                            &reader));
+  auto row_group_metadata = reader->parquet_reader()->metadata()->RowGroup(0);
+  ASSERT_FALSE(row_group_metadata->ColumnChunk(0)->has_bloom_filter());
+  ASSERT_TRUE(row_group_metadata->ColumnChunk(1)->has_bloom_filter());
+  ASSERT_TRUE(row_group_metadata->ColumnChunk(2)->has_bloom_filter());
+
+  auto CheckRowGroups = [&reader](const Predicate& predicate,
+                                  const std::vector<int>& expected) {
+    std::vector<int> row_groups;
+    ASSERT_OK(reader->FilterRowGroups(predicate, &row_groups));
+    ASSERT_EQ(expected, row_groups) << predicate.ToString();
+  };
+
+  // 7.25 and "b45" lie within the statistics bounds of row group 1
+  CheckRowGroups(*Predicate::Compare(1, Predicate::EQUAL, 7.25), {});
+  CheckRowGroups(*Predicate::Compare(1, Predicate::EQUAL, 7.5), {1});
+  CheckRowGroups(*Predicate::In(2, {"b45", "c3", "d"}), {2});
+  CheckRowGroups(*Predicate::In(2, {}), {});
+  CheckRowGroups(*Predicate::Or(Predicate::Compare(2, Predicate::EQUAL, "b45"),
+                                Predicate::Compare(1, Predicate::EQUAL, 49)),
+                 {9});
+  // Without a Bloom filter only the statistics apply
+  CheckRowGroups(*Predicate::In(0, {5L, 1000L}), {0});
+}
+
+TEST(TestArrowReadWrite, PlanDatasetScan) {
+  using Predicate = RowGroupPredicate;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakePredicateTable(&table));
+
+  // Two files with row groups of 10 and 50 rows, and their summary file
+  std::vector<std::string> paths = {"part-0.parquet", "part-1.parquet"};
+  std::vector<int64_t> row_group_sizes = {10, 50};
+  std::vector<std::shared_ptr<Buffer>> files;
+  std::shared_ptr<FileMetaData> summary;
+  for (size_t i = 0; i < paths.size(); ++i) {
+    auto sink = std::make_shared<InMemoryOutputStream>();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                  row_group_sizes[i], default_writer_properties()));
+    files.push_back(sink->GetBuffer());
+    auto metadata = ::parquet::ReadMetaData(std::make_shared<BufferReader>(files[i]));
+    metadata->set_file_path(paths[i]);
+    if (summary == nullptr) {
+      summary = metadata;
+    } else {
+      summary->AppendRowGroups(*metadata);
+    }
+  }
+  auto summary_sink = std::make_shared<InMemoryOutputStream>();
+  ASSERT_OK_NO_THROW(::parquet::arrow::WriteMetaDataFile(*summary, summary_sink.get()));
+  summary = ::parquet::ReadMetaData(
+      std::make_shared<BufferReader>(summary_sink->GetBuffer()));
+  ASSERT_EQ(12, summary->num_row_groups());
+  ASSERT_EQ(200, summary->num_rows());
+
+  auto CheckScans = [&](const Predicate* predicate,
+                        const std::vector<std::vector<int>>& expected) {
+    std::vector<DatasetFileScan> scans;
+    ASSERT_OK(PlanDatasetScan(*summary, predicate, &scans));
+    size_t num_paths = 0;
+    for (size_t i = 0; i < expected.size(); ++i) {
+      if (expected[i].empty()) {
+        continue;
+      }
+      ASSERT_LT(num_paths, scans.size());
+      const DatasetFileScan& scan = scans[num_paths++];
+      ASSERT_EQ(paths[i], scan.path);
+      ASSERT_EQ(expected[i], scan.row_groups);
+
+      // The file is read at the offsets recorded in the summary
+      std::unique_ptr<FileReader> reader, expected_reader;
+      ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(files[i]),
+                                  ::arrow::default_memory_pool(),
+                                  ::parquet::default_reader_properties(), scan.metadata,
+                                  &reader));
+      ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(files[i]),
+                                  ::arrow::default_memory_pool(), &expected_reader));
+      std::shared_ptr<Table> result, expected_result;
+      ASSERT_OK_NO_THROW(reader->ReadRowGroups(scan.row_groups, &result));
+      ASSERT_OK_NO_THROW(
+          expected_reader->ReadRowGroups(scan.row_groups, &expected_result));
+      ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*expected_result, *result));
+    }
+    ASSERT_EQ(num_paths, scans.size());
+  };
+
+  ASSERT_NO_FATAL_FAILURE(CheckScans(nullptr, {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, {0, 1}}));
+  auto predicate = Predicate::And(Predicate::Compare(0, Predicate::GREATER_EQUAL, 25L),
+                                  Predicate::Compare(0, Predicate::LESS, 47L));
+  ASSERT_NO_FATAL_FAILURE(CheckScans(predicate.get(), {{2, 3, 4}, {0}}));
+  predicate = Predicate::Compare(0, Predicate::GREATER, 94L);
+  ASSERT_NO_FATAL_FAILURE(CheckScans(predicate.get(), {{9}, {1}}));
+  predicate = Predicate::Compare(0, Predicate::EQUAL, 1000L);
+  ASSERT_NO_FATAL_FAILURE(CheckScans(predicate.get(), {{}, {}}));
+
+  // Row groups of files with another schema cannot be appended
+  std::shared_ptr<Table> other_table;
+  ASSERT_OK(table->RemoveColumn(0, &other_table));
+  std::shared_ptr<Buffer> other_file;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(other_table, 100,
+                                             default_arrow_writer_properties(),
+                                             &other_file));
+  auto other = ::parquet::ReadMetaData(std::make_shared<BufferReader>(other_file));
+  ASSERT_THROW(summary->AppendRowGroups(*other), ParquetException);
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -1825,6 +2542,48 @@ TEST(TestArrowReadWrite, TableWithChunkedColumns) {
   }
 }
 
+TEST(TestArrowReadWrite, NestedListsAndStructs) {
+  using ::arrow::ArrayFromJSON;
+
+  auto element_type = ::arrow::struct_(
+      {field("a", ::arrow::int32()), field("b", ::arrow::list(::arrow::utf8()))});
+  auto list_of_structs = ::arrow::list(field("element", element_type));
+  auto list_of_structs_array = ArrayFromJSON(list_of_structs, R"([
+      [{"a": 1, "b": ["x", null]}, null, {"a": null, "b": []}],
+      null,
+      [],
+      [{"a": 4, "b": null}],
+      [null, {"a": 5, "b": ["y", "z"]}]
+    ])");
+
+  auto struct_of_lists =
+      ::arrow::struct_({field("c", ::arrow::list(::arrow::int64())),
+                        field("d", ::arrow::struct_({field("e", ::arrow::float64())}))});
+  auto struct_of_lists_array = ArrayFromJSON(struct_of_lists, R"([
+      {"c": [1, 2], "d": {"e": 1.5}},
+      {"c": null, "d": null},
+      null,
+      {"c": [], "d": {"e": null}},
+      {"c": [null, 3], "d": {"e": 2.5}}
+    ])");
+
+  auto f0 = field("list_of_structs", list_of_structs);
+  auto f1 = field("struct_of_lists", struct_of_lists);
+  auto schema = ::arrow::schema({f0, f1});
+
+  std::shared_ptr<Table> table = Table::Make(
+      schema, {std::make_shared<Column>(f0, list_of_structs_array),
+               std::make_shared<Column>(f1, struct_of_lists_array)});
+  ASSERT_NO_FATAL_FAILURE(CheckSimpleRoundtrip(table, table->num_rows()));
+  ASSERT_NO_FATAL_FAILURE(CheckSimpleRoundtrip(table, 2));
+
+  // Slices start part-way into the nested values
+  std::shared_ptr<Table> sliced_table = Table::Make(
+      schema, {std::make_shared<Column>(f0, list_of_structs_array->Slice(1, 4)),
+               std::make_shared<Column>(f1, struct_of_lists_array->Slice(1, 4))});
+  ASSERT_NO_FATAL_FAILURE(CheckSimpleRoundtrip(sliced_table, 3));
+}
+
 TEST(TestArrowReadWrite, TableWithDuplicateColumns) {
   // See ARROW-1974
   using ::arrow::ArrayFromVector;
@@ -1851,8 +2610,8 @@ TEST(TestArrowReadWrite, DictionaryColumnChunkedWrite) {
   //
   // https://issues.apache.org/jira/browse/ARROW-1938
   //
-  // As of the writing of this test, columns of type
-  // dictionary are written as their raw/expanded values.
+  // When this test was written, columns of type
+  // dictionary were written as their raw/expanded values.
   // The regression was that the whole column was being
   // written for each chunk.
   using ::arrow::ArrayFromVector;
@@ -1909,6 +2668,150 @@ TEST(TestArrowReadWrite, DictionaryColumnChunkedWrite) {
   ::arrow::AssertTablesEqual(*expected_table, *result, false);
 }
 
+TEST(TestArrowReadWrite, DictionaryColumnReplacedDictionary) {
+  // Dictionary indices are written through to the column chunk's dictionary,
+  // also when the dictionary changes between chunks and after falling back
+  // to plain encoding
+  using ::arrow::ArrayFromVector;
+
+  std::shared_ptr<Array> dict0, dict1, indices0, indices1, indices2;
+  ArrayFromVector<::arrow::StringType, std::string>({"first", "second", "third"},
+                                                    &dict0);
+  ArrayFromVector<::arrow::StringType, std::string>({"fourth", "first"}, &dict1);
+  ArrayFromVector<::arrow::Int8Type, int8_t>({true, false, true, true}, {0, 1, 2, 0},
+                                             &indices0);
+  ArrayFromVector<::arrow::Int16Type, int16_t>({0, 1, 0}, &indices1);
+  ArrayFromVector<::arrow::Int8Type, int8_t>({true, true, false}, {2, 1, 0}, &indices2);
+
+  auto dict_type = ::arrow::dictionary(::arrow::int8(), dict0);
+  ::arrow::ArrayVector chunks = {
+      std::make_shared<::arrow::DictionaryArray>(dict_type, indices0),
+      std::make_shared<::arrow::DictionaryArray>(
+          ::arrow::dictionary(::arrow::int16(), dict1), indices1),
+      std::make_shared<::arrow::DictionaryArray>(dict_type, indices2)};
+  auto f0 = field("dictionary", dict_type);
+  auto table = Table::Make(::arrow::schema({f0}),
+                           {std::make_shared<Column>(f0, chunks)});
+
+  std::shared_ptr<Array> expected;
+  ArrayFromVector<::arrow::StringType, std::string>(
+      {true, false, true, true, true, true, true, true, true, false},
+      {"first", "", "third", "first", "fourth", "first", "fourth", "third", "second", ""},
+      &expected);
+
+  for (int64_t dictionary_pagesize_limit :
+       std::vector<int64_t>{DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT, 1}) {
+    auto properties = WriterProperties::Builder()
+                          .dictionary_pagesize_limit(dictionary_pagesize_limit)
+                          ->write_batch_size(2)
+                          ->build();
+    auto sink = std::make_shared<InMemoryOutputStream>();
+    ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                  table->num_rows(), properties));
+
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(sink->GetBuffer()),
+                                ::arrow::default_memory_pool(),
+                                ::parquet::default_reader_properties(), nullptr,
+                                &reader));
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ASSERT_TRUE(result->column(0)->data()->Equals(ChunkedArray({expected})));
+
+    auto column_chunk = reader->parquet_reader()->metadata()->RowGroup(0)->ColumnChunk(0);
+    ASSERT_TRUE(column_chunk->has_dictionary_page());
+    auto statistics = std::static_pointer_cast<TypedRowGroupStatistics<ByteArrayType>>(
+        column_chunk->statistics());
+    ASSERT_EQ(2, statistics->null_count());
+    ASSERT_EQ("first", ByteArrayToString(statistics->min()));
+    ASSERT_EQ("third", ByteArrayToString(statistics->max()));
+  }
+}
+
+// Decode the chunks of a dictionary-encoded column read with
+// FileReader::set_read_dictionary
+void DecodeDictionaryColumn(const Column& column, std::shared_ptr<ChunkedArray>* out) {
+  ASSERT_EQ(::arrow::Type::DICTIONARY, column.type()->id());
+  const auto& dict_type = static_cast<const ::arrow::DictionaryType&>(*column.type());
+
+  FunctionContext ctx(default_memory_pool());
+  ::arrow::ArrayVector chunks;
+  for (const auto& chunk : column.data()->chunks()) {
+    // All chunks share the dictionary
+    ASSERT_TRUE(chunk->type()->Equals(*column.type()));
+    std::shared_ptr<Array> decoded;
+    ASSERT_OK(::arrow::compute::Cast(&ctx, *chunk, dict_type.dictionary()->type(),
+                                     ::arrow::compute::CastOptions(), &decoded));
+    chunks.push_back(decoded);
+  }
+  *out = std::make_shared<ChunkedArray>(chunks);
+}
+
+TEST(TestArrowReadWrite, ReadDictionary) {
+  const int num_rows = 1000;
+  const int num_distinct = 7;
+
+  ::arrow::StringBuilder builder;
+  for (int i = 0; i < num_rows; ++i) {
+    if (i % 11 == 0) {
+      ASSERT_OK(builder.AppendNull());
+    } else {
+      ASSERT_OK(builder.Append("value" + std::to_string(i % num_distinct)));
+    }
+  }
+  std::shared_ptr<Array> values;
+  ASSERT_OK(builder.Finish(&values));
+
+  std::vector<std::shared_ptr<Column>> columns = {MakeColumn("dict", values, true),
+                                                   MakeColumn("dense", values, true)};
+  auto schema = ::arrow::schema({columns[0]->field(), columns[1]->field()});
+  auto table = Table::Make(schema, columns);
+
+  // Two row groups with different dictionary orders
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 2,
+                                             default_arrow_writer_properties(), &buffer));
+
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                              ::arrow::default_memory_pool(),
+                              ::parquet::default_reader_properties(), nullptr, &reader));
+  reader->set_read_dictionary(true);
+  reader->set_read_dictionary(1, false);
+
+  auto CheckTable = [&](const Table& result, const ChunkedArray& expected) {
+    ASSERT_EQ(2, result.num_columns());
+    const auto& dict_type =
+        static_cast<const ::arrow::DictionaryType&>(*result.column(0)->type());
+    ASSERT_EQ(num_distinct, dict_type.dictionary()->length());
+
+    std::shared_ptr<ChunkedArray> decoded;
+    ASSERT_NO_FATAL_FAILURE(DecodeDictionaryColumn(*result.column(0), &decoded));
+    ASSERT_EQ(::arrow::Type::STRING, decoded->type()->id());
+    ASSERT_TRUE(decoded->Equals(expected));
+
+    ASSERT_EQ(::arrow::Type::STRING, result.column(1)->type()->id());
+    ASSERT_TRUE(result.column(1)->data()->Equals(expected));
+  };
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(CheckTable(*result, ChunkedArray({values})));
+
+  ASSERT_OK_NO_THROW(reader->ReadRowGroups({0, 1}, &result));
+  ASSERT_OK(result->Validate());
+  ASSERT_NO_FATAL_FAILURE(CheckTable(*result, ChunkedArray({values})));
+
+  ASSERT_OK_NO_THROW(reader->ReadRowGroup(1, &result));
+  ASSERT_NO_FATAL_FAILURE(
+      CheckTable(*result, ChunkedArray({values->Slice(num_rows / 2)})));
+
+  // The schema keeps reporting the value type
+  std::shared_ptr<::arrow::Schema> read_schema;
+  ASSERT_OK_NO_THROW(reader->GetSchema({0, 1}, &read_schema));
+  ASSERT_EQ(::arrow::Type::STRING, read_schema->field(0)->type()->id());
+}
+
 TEST(TestArrowWrite, CheckChunkSize) {
   const int num_columns = 2;
   const int num_rows = 128;
@@ -2257,10 +3160,47 @@ TEST_F(TestNestedSchemaRead, ReadTablePartial) {
   ASSERT_NO_FATAL_FAILURE(ValidateTableArrayTypes(*table));
 }
 
-TEST_F(TestNestedSchemaRead, StructAndListTogetherUnsupported) {
+TEST_F(TestNestedSchemaRead, StructAndListTogether) {
   ASSERT_NO_FATAL_FAILURE(CreateSimpleNestedParquet(Repetition::REPEATED));
   std::shared_ptr<Table> table;
-  ASSERT_RAISES(NotImplemented, reader_->ReadTable(&table));
+  ASSERT_OK_NO_THROW(reader_->ReadTable(&table));
+  ASSERT_EQ(table->num_rows(), NUM_SIMPLE_TEST_ROWS);
+  ASSERT_EQ(table->num_columns(), 2);
+
+  // The repeated group is read as a list of structs: every row starts a new
+  // list, which is empty when leaf1 is not defined
+  auto list_array =
+      std::static_pointer_cast<::arrow::ListArray>(table->column(0)->data()->chunk(0));
+  ASSERT_EQ(list_array->null_count(), 0);
+  auto struct_array =
+      std::static_pointer_cast<::arrow::StructArray>(list_array->values());
+  ASSERT_EQ(struct_array->null_count(), 0);
+  auto leaf1_array =
+      std::static_pointer_cast<::arrow::Int32Array>(struct_array->field(0));
+  auto leaf2_array =
+      std::static_pointer_cast<::arrow::Int32Array>(struct_array->field(1));
+
+  const int32_t* values =
+      reinterpret_cast<const int32_t*>(values_array_->values()->data());
+  int64_t element = 0;
+  int leaf1_value = 0;
+  int leaf2_value = 0;
+  for (int i = 0; i < NUM_SIMPLE_TEST_ROWS; i++) {
+    if (i % 3 == 0) {
+      ASSERT_EQ(list_array->value_length(i), 0);
+      continue;
+    }
+    ASSERT_EQ(list_array->value_length(i), 1);
+    ASSERT_EQ(list_array->value_offset(i), element);
+    ASSERT_EQ(leaf1_array->Value(element), values[leaf1_value++]);
+    if (i % 3 == 1) {
+      ASSERT_TRUE(leaf2_array->IsNull(element));
+    } else {
+      ASSERT_EQ(leaf2_array->Value(element), values[leaf2_value++]);
+    }
+    ++element;
+  }
+  ASSERT_EQ(struct_array->length(), element);
 }
 
 TEST_P(TestNestedSchemaRead, DeepNestedSchemaRead) {
@@ -0,0 +1,371 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// End-to-end conversion benchmarks: CSV to Parquet, JSON to IPC stream,
+// Parquet to Arrow and Feather round trips, over generated datasets and
+// several CPU thread pool capacities.  Besides throughput, each run reports
+// as "peak_memory" the highest number of bytes allocated at once by an
+// iteration.
+//
+// Throughput is reported against the size of the dataset's CSV (or, for the
+// nested dataset, JSON) text, so that the stages compare on the same scale.
+
+#include "benchmark/benchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "parquet/arrow/reader.h"
+#include "parquet/arrow/writer.h"
+
+#include "arrow/api.h"
+#include "arrow/csv/api.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/feather.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/json/api.h"
+#include "arrow/util/thread-pool.h"
+
+#define EXIT_NOT_OK(s)                                        \
+  do {                                                        \
+    ::arrow::Status _s = (s);                                 \
+    if (ARROW_PREDICT_FALSE(!_s.ok())) {                      \
+      std::cout << "Exiting: " << _s.ToString() << std::endl; \
+      exit(EXIT_FAILURE);                                     \
+    }                                                         \
+  } while (0)
+
+namespace parquet {
+
+using ::arrow::Buffer;
+using ::arrow::MemoryPool;
+using ::arrow::Table;
+using arrow::FileReader;
+
+namespace benchmark {
+
+// Approximate size of the text of each dataset
+constexpr int64_t kTextSize = 16 * 1024 * 1024;
+
+enum Dataset : int64_t {
+  // A few columns of mixed types
+  kNarrow,
+  // Many numeric columns
+  kWide,
+  // String columns only
+  kStrings,
+  // Struct and list columns, only generated as JSON
+  kNested
+};
+
+enum class TextFormat { CSV, JSON };
+
+struct TextField {
+  std::string name;
+  std::string text;
+  bool quoted;
+};
+
+class RowGenerator {
+ public:
+  explicit RowGenerator(Dataset dataset) : dataset_(dataset), engine_(0x5eed) {}
+
+  // The fields of the next row, in column order
+  void Next(std::vector<TextField>* fields) {
+    fields->clear();
+    switch (dataset_) {
+      case kNarrow:
+        fields->push_back({"id", std::to_string(row_), false});
+        fields->push_back({"value", Double(), false});
+        fields->push_back({"flag", Int(0, 1) ? "true" : "false", false});
+        fields->push_back({"label", Word(4, 12), true});
+        break;
+      case kWide:
+        for (int i = 0; i < 64; ++i) {
+          fields->push_back({"c" + std::to_string(i),
+                             i % 2 ? Double() : std::to_string(Int(-100000, 100000)),
+                             false});
+        }
+        break;
+      case kStrings:
+        for (int i = 0; i < 8; ++i) {
+          fields->push_back({"s" + std::to_string(i), Word(8, 64), true});
+        }
+        break;
+      case kNested: {
+        fields->push_back({"id", std::to_string(row_), false});
+        fields->push_back({"point", "{\"x\":" + Double() + ",\"y\":" + Double() + "}",
+                           false});
+        std::string tags = "[";
+        for (int64_t i = Int(0, 8); i > 0; --i) {
+          tags += std::to_string(Int(0, 1000));
+          tags += i > 1 ? "," : "";
+        }
+        fields->push_back({"tags", tags + "]", false});
+        fields->push_back({"name", Word(4, 16), true});
+        break;
+      }
+    }
+    ++row_;
+  }
+
+ private:
+  int64_t Int(int64_t min, int64_t max) {
+    return std::uniform_int_distribution<int64_t>(min, max)(engine_);
+  }
+
+  std::string Double() {
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.4f",
+             std::uniform_real_distribution<double>(-1000, 1000)(engine_));
+    return buffer;
+  }
+
+  std::string Word(int64_t min_length, int64_t max_length) {
+    std::string word(static_cast<size_t>(Int(min_length, max_length)), ' ');
+    for (char& c : word) {
+      c = static_cast<char>('a' + Int(0, 25));
+    }
+    return word;
+  }
+
+  Dataset dataset_;
+  std::mt19937_64 engine_;
+  int64_t row_ = 0;
+};
+
+std::shared_ptr<Buffer> GenerateText(Dataset dataset, TextFormat format) {
+  RowGenerator generator(dataset);
+  std::vector<TextField> fields;
+  std::string text;
+  text.reserve(kTextSize + 4096);
+  while (static_cast<int64_t>(text.size()) < kTextSize) {
+    generator.Next(&fields);
+    if (format == TextFormat::CSV) {
+      if (text.empty()) {
+        for (size_t i = 0; i < fields.size(); ++i) {
+          text += (i > 0 ? "," : "") + fields[i].name;
+        }
+        text += '\n';
+      }
+      for (size_t i = 0; i < fields.size(); ++i) {
+        text += (i > 0 ? "," : "") + fields[i].text;
+      }
+    } else {
+      text += '{';
+      for (size_t i = 0; i < fields.size(); ++i) {
+        const char* quote = fields[i].quoted ? "\"" : "";
+        text += (i > 0 ? ",\"" : "\"") + fields[i].name + "\":" + quote +
+                fields[i].text + quote;
+      }
+      text += '}';
+    }
+    text += '\n';
+  }
+  return Buffer::FromString(std::move(text));
+}
+
+// The dataset's text, generated on first use
+std::shared_ptr<Buffer> DatasetText(Dataset dataset, TextFormat format) {
+  static std::map<std::pair<Dataset, TextFormat>, std::shared_ptr<Buffer>> texts;
+  auto& text = texts[std::make_pair(dataset, format)];
+  if (text == nullptr) {
+    text = GenerateText(dataset, format);
+  }
+  return text;
+}
+
+TextFormat SourceFormat(Dataset dataset) {
+  return dataset == kNested ? TextFormat::JSON : TextFormat::CSV;
+}
+
+std::shared_ptr<Table> ReadCsv(const std::shared_ptr<Buffer>& text, MemoryPool* pool,
+                               bool use_threads) {
+  auto read_options = ::arrow::csv::ReadOptions::Defaults();
+  read_options.use_threads = use_threads;
+  std::shared_ptr<::arrow::csv::TableReader> reader;
+  EXIT_NOT_OK(::arrow::csv::TableReader::Make(
+      pool, std::make_shared<::arrow::io::BufferReader>(text), read_options,
+      ::arrow::csv::ParseOptions::Defaults(), ::arrow::csv::ConvertOptions::Defaults(),
+      &reader));
+  std::shared_ptr<Table> table;
+  EXIT_NOT_OK(reader->Read(&table));
+  return table;
+}
+
+std::shared_ptr<Table> ReadJson(const std::shared_ptr<Buffer>& text, MemoryPool* pool,
+                                bool use_threads) {
+  auto read_options = ::arrow::json::ReadOptions::Defaults();
+  read_options.use_threads = use_threads;
+  std::shared_ptr<::arrow::json::TableReader> reader;
+  EXIT_NOT_OK(::arrow::json::TableReader::Make(
+      pool, std::make_shared<::arrow::io::BufferReader>(text), read_options,
+      ::arrow::json::ParseOptions::Defaults(), &reader));
+  std::shared_ptr<Table> table;
+  EXIT_NOT_OK(reader->Read(&table));
+  return table;
+}
+
+std::shared_ptr<Table> DatasetTable(Dataset dataset) {
+  std::shared_ptr<Buffer> text = DatasetText(dataset, SourceFormat(dataset));
+  if (SourceFormat(dataset) == TextFormat::CSV) {
+    return ReadCsv(text, ::arrow::default_memory_pool(), true);
+  }
+  return ReadJson(text, ::arrow::default_memory_pool(), true);
+}
+
+std::shared_ptr<Buffer> WriteParquet(const Table& table, MemoryPool* pool,
+                                     bool use_threads) {
+  std::shared_ptr<::arrow::io::BufferOutputStream> output;
+  EXIT_NOT_OK(::arrow::io::BufferOutputStream::Create(1024, pool, &output));
+  auto arrow_properties =
+      arrow::ArrowWriterProperties::Builder().set_use_threads(use_threads)->build();
+  EXIT_NOT_OK(arrow::WriteTable(table, pool, output, 1 << 16,
+                                default_writer_properties(), arrow_properties));
+  std::shared_ptr<Buffer> buffer;
+  EXIT_NOT_OK(output->Finish(&buffer));
+  return buffer;
+}
+
+// Sets the capacity of the CPU thread pool for the lifetime of the object
+class ScopedCpuThreads {
+ public:
+  explicit ScopedCpuThreads(int threads)
+      : previous_(::arrow::GetCpuThreadPoolCapacity()) {
+    EXIT_NOT_OK(::arrow::SetCpuThreadPoolCapacity(threads));
+  }
+  ~ScopedCpuThreads() { EXIT_NOT_OK(::arrow::SetCpuThreadPoolCapacity(previous_)); }
+
+ private:
+  int previous_;
+};
+
+// Runs iteration(pool, use_threads) with a fresh pool per iteration, then
+// reports throughput and the peak memory of the iterations
+template <typename Iteration>
+void RunPipeline(::benchmark::State& state, Dataset dataset, Iteration&& iteration) {
+  const int threads = static_cast<int>(state.range(1));
+  const int64_t text_size = DatasetText(dataset, SourceFormat(dataset))->size();
+  ScopedCpuThreads scoped_threads(threads);
+  int64_t peak_memory = 0;
+  int64_t num_rows = 0;
+  while (state.KeepRunning()) {
+    ::arrow::ProxyMemoryPool pool(::arrow::default_memory_pool());
+    num_rows = iteration(&pool, threads > 1);
+    peak_memory = std::max(peak_memory, pool.max_memory());
+  }
+  state.SetBytesProcessed(state.iterations() * text_size);
+  state.SetItemsProcessed(state.iterations() * num_rows);
+  state.counters["peak_memory"] = static_cast<double>(peak_memory);
+}
+
+static void BM_CsvToParquet(::benchmark::State& state) {
+  const auto dataset = static_cast<Dataset>(state.range(0));
+  std::shared_ptr<Buffer> text = DatasetText(dataset, TextFormat::CSV);
+  RunPipeline(state, dataset, [&](MemoryPool* pool, bool use_threads) -> int64_t {
+    std::shared_ptr<Table> table = ReadCsv(text, pool, use_threads);
+    WriteParquet(*table, pool, use_threads);
+    return table->num_rows();
+  });
+}
+
+static void BM_JsonToIpc(::benchmark::State& state) {
+  const auto dataset = static_cast<Dataset>(state.range(0));
+  std::shared_ptr<Buffer> text = DatasetText(dataset, TextFormat::JSON);
+  RunPipeline(state, dataset, [&](MemoryPool* pool, bool use_threads) -> int64_t {
+    std::shared_ptr<Table> table = ReadJson(text, pool, use_threads);
+    std::shared_ptr<::arrow::io::BufferOutputStream> output;
+    EXIT_NOT_OK(::arrow::io::BufferOutputStream::Create(1024, pool, &output));
+    std::shared_ptr<::arrow::ipc::RecordBatchWriter> writer;
+    EXIT_NOT_OK(::arrow::ipc::RecordBatchStreamWriter::Open(output.get(),
+                                                            table->schema(), &writer));
+    EXIT_NOT_OK(writer->WriteTable(*table));
+    EXIT_NOT_OK(writer->Close());
+    std::shared_ptr<Buffer> buffer;
+    EXIT_NOT_OK(output->Finish(&buffer));
+    return table->num_rows();
+  });
+}
+
+static void BM_ParquetToArrow(::benchmark::State& state) {
+  const auto dataset = static_cast<Dataset>(state.range(0));
+  std::shared_ptr<Buffer> file =
+      WriteParquet(*DatasetTable(dataset), ::arrow::default_memory_pool(), true);
+  RunPipeline(state, dataset, [&](MemoryPool* pool, bool use_threads) -> int64_t {
+    std::unique_ptr<FileReader> reader;
+    EXIT_NOT_OK(arrow::OpenFile(std::make_shared<::arrow::io::BufferReader>(file), pool,
+                                &reader));
+    reader->set_use_threads(use_threads);
+    std::shared_ptr<Table> table;
+    EXIT_NOT_OK(reader->ReadTable(&table));
+    return table->num_rows();
+  });
+}
+
+// Feather files are written and read on the calling thread; the thread pool
+// capacity is varied for uniformity with the other pipelines
+static void BM_FeatherRoundtrip(::benchmark::State& state) {
+  const auto dataset = static_cast<Dataset>(state.range(0));
+  std::shared_ptr<Table> table = DatasetTable(dataset);
+  RunPipeline(state, dataset, [&](MemoryPool* pool, bool) -> int64_t {
+    std::shared_ptr<::arrow::io::BufferOutputStream> output;
+    EXIT_NOT_OK(::arrow::io::BufferOutputStream::Create(1024, pool, &output));
+    EXIT_NOT_OK(::arrow::ipc::feather::WriteTable(*table, output));
+    std::shared_ptr<Buffer> buffer;
+    EXIT_NOT_OK(output->Finish(&buffer));
+    std::unique_ptr<::arrow::ipc::feather::TableReader> reader;
+    EXIT_NOT_OK(::arrow::ipc::feather::TableReader::Open(
+        std::make_shared<::arrow::io::BufferReader>(buffer), &reader));
+    std::shared_ptr<Table> result;
+    EXIT_NOT_OK(reader->Read(&result));
+    return result->num_rows();
+  });
+}
+
+static void SetPipelineArgs(::benchmark::internal::Benchmark* bench,
+                            const std::vector<Dataset>& datasets) {
+  bench->Unit(::benchmark::kMillisecond)->UseRealTime();
+  for (Dataset dataset : datasets) {
+    for (int64_t threads : {1, 4, 8}) {
+      bench->Args({dataset, threads});
+    }
+  }
+}
+
+static void SetCsvPipelineArgs(::benchmark::internal::Benchmark* bench) {
+  SetPipelineArgs(bench, {kNarrow, kWide, kStrings});
+}
+
+static void SetAllPipelineArgs(::benchmark::internal::Benchmark* bench) {
+  SetPipelineArgs(bench, {kNarrow, kWide, kStrings, kNested});
+}
+
+BENCHMARK(BM_CsvToParquet)->Apply(SetCsvPipelineArgs);
+BENCHMARK(BM_JsonToIpc)->Apply(SetAllPipelineArgs);
+BENCHMARK(BM_ParquetToArrow)->Apply(SetAllPipelineArgs);
+BENCHMARK(BM_FeatherRoundtrip)->Apply(SetAllPipelineArgs);
+
+}  // namespace benchmark
+
+}  // namespace parquet
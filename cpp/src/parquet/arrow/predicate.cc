@@ -0,0 +1,532 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/arrow/predicate.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+
+#include "parquet/bloom_filter.h"
+#include "parquet/exception.h"
+#include "parquet/file_reader.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
+#include "parquet/statistics.h"
+#include "parquet/types.h"
+#include "parquet/util/comparison.h"
+
+using arrow::Status;
+
+namespace parquet {
+namespace arrow {
+
+using Literal = RowGroupPredicate::Literal;
+
+// ----------------------------------------------------------------------
+// Literal
+
+Literal::Literal(bool value) : kind_(BOOL), integer_value_(value ? 1 : 0) {}
+
+Literal::Literal(int32_t value) : kind_(INTEGER), integer_value_(value) {}
+
+Literal::Literal(int64_t value) : kind_(INTEGER), integer_value_(value) {}
+
+Literal::Literal(float value) : kind_(FLOATING), floating_value_(value) {}
+
+Literal::Literal(double value) : kind_(FLOATING), floating_value_(value) {}
+
+Literal::Literal(const char* value) : kind_(BYTES), bytes_value_(value) {}
+
+Literal::Literal(const std::string& value) : kind_(BYTES), bytes_value_(value) {}
+
+std::string Literal::ToString() const {
+  std::stringstream ss;
+  switch (kind_) {
+    case BOOL:
+      ss << (bool_value() ? "true" : "false");
+      break;
+    case INTEGER:
+      ss << integer_value_;
+      break;
+    case FLOATING:
+      ss << floating_value_;
+      break;
+    case BYTES:
+      ss << '"' << bytes_value_ << '"';
+      break;
+  }
+  return ss.str();
+}
+
+namespace {
+
+const char* OperatorToString(RowGroupPredicate::Operator op) {
+  switch (op) {
+    case RowGroupPredicate::EQUAL:
+      return "==";
+    case RowGroupPredicate::NOT_EQUAL:
+      return "!=";
+    case RowGroupPredicate::LESS:
+      return "<";
+    case RowGroupPredicate::LESS_EQUAL:
+      return "<=";
+    case RowGroupPredicate::GREATER:
+      return ">";
+    case RowGroupPredicate::GREATER_EQUAL:
+      return ">=";
+  }
+  return "?";
+}
+
+// Whether a column chunk whose non-null values all lie in [min, max] may hold
+// a value v with "v op value", where less is the column's sort order
+template <typename T, typename Less>
+bool RangeMayMatch(RowGroupPredicate::Operator op, const T& min, const T& max,
+                   const T& value, Less&& less) {
+  switch (op) {
+    case RowGroupPredicate::EQUAL:
+      return !less(value, min) && !less(max, value);
+    case RowGroupPredicate::NOT_EQUAL:
+      // Only a chunk holding nothing but value is ruled out
+      return less(min, value) || less(value, max);
+    case RowGroupPredicate::LESS:
+      return less(min, value);
+    case RowGroupPredicate::LESS_EQUAL:
+      return !less(value, min);
+    case RowGroupPredicate::GREATER:
+      return less(value, max);
+    case RowGroupPredicate::GREATER_EQUAL:
+      return !less(max, value);
+  }
+  return true;
+}
+
+Status IncompatibleLiteral(const ColumnDescriptor& descr, const Literal& value) {
+  return Status::Invalid("Cannot compare column '", descr.path()->ToDotString(),
+                         "' of physical type ", TypeToString(descr.physical_type()),
+                         " with literal ", value.ToString());
+}
+
+// Converts the literal to the physical type T of descr, checking that it is
+// representable
+template <typename DType>
+struct PhysicalLiteral {
+  using T = typename DType::c_type;
+
+  static Status Convert(const ColumnDescriptor& descr, const Literal& value, T* out) {
+    if (value.kind() != Literal::INTEGER) {
+      return IncompatibleLiteral(descr, value);
+    }
+    const int64_t v = value.integer_value();
+    using Unsigned = typename std::make_unsigned<T>::type;
+    if (descr.sort_order() == SortOrder::UNSIGNED) {
+      // Unsigned columns store the bit pattern of the unsigned value
+      if (v < 0 || static_cast<uint64_t>(v) > std::numeric_limits<Unsigned>::max()) {
+        return IncompatibleLiteral(descr, value);
+      }
+      *out = static_cast<T>(static_cast<Unsigned>(v));
+    } else {
+      if (v < std::numeric_limits<T>::min() || v > std::numeric_limits<T>::max()) {
+        return IncompatibleLiteral(descr, value);
+      }
+      *out = static_cast<T>(v);
+    }
+    return Status::OK();
+  }
+};
+
+template <>
+struct PhysicalLiteral<BooleanType> {
+  static Status Convert(const ColumnDescriptor& descr, const Literal& value, bool* out) {
+    if (value.kind() != Literal::BOOL) {
+      return IncompatibleLiteral(descr, value);
+    }
+    *out = value.bool_value();
+    return Status::OK();
+  }
+};
+
+template <>
+struct PhysicalLiteral<ByteArrayType> {
+  static Status Convert(const ColumnDescriptor& descr, const Literal& value,
+                        ByteArray* out) {
+    if (value.kind() != Literal::BYTES) {
+      return IncompatibleLiteral(descr, value);
+    }
+    const std::string& bytes = value.bytes_value();
+    *out = ByteArray(static_cast<uint32_t>(bytes.size()),
+                     reinterpret_cast<const uint8_t*>(bytes.data()));
+    return Status::OK();
+  }
+};
+
+template <>
+struct PhysicalLiteral<FLBAType> {
+  static Status Convert(const ColumnDescriptor& descr, const Literal& value, FLBA* out) {
+    if (value.kind() != Literal::BYTES ||
+        value.bytes_value().size() != static_cast<size_t>(descr.type_length())) {
+      return IncompatibleLiteral(descr, value);
+    }
+    *out = FLBA(reinterpret_cast<const uint8_t*>(value.bytes_value().data()));
+    return Status::OK();
+  }
+};
+
+template <typename DType>
+Status TypedMayMatch(const ColumnDescriptor& descr, const RowGroupStatistics* stats,
+                     RowGroupPredicate::Operator op, const Literal& value,
+                     bool* may_match) {
+  using T = typename DType::c_type;
+
+  T physical_value;
+  RETURN_NOT_OK(PhysicalLiteral<DType>::Convert(descr, value, &physical_value));
+  if (stats == nullptr) {
+    return Status::OK();
+  }
+  const auto& typed_stats = static_cast<const TypedRowGroupStatistics<DType>&>(*stats);
+  auto comparator =
+      std::static_pointer_cast<CompareDefault<DType>>(Comparator::Make(&descr));
+  auto less = [&comparator](const T& a, const T& b) { return (*comparator)(a, b); };
+  *may_match =
+      RangeMayMatch(op, typed_stats.min(), typed_stats.max(), physical_value, less);
+  return Status::OK();
+}
+
+// FLOAT and DOUBLE compare in double precision so that narrowing the literal
+// to float cannot round it across a statistics bound
+template <typename DType>
+Status FloatingMayMatch(const ColumnDescriptor& descr, const RowGroupStatistics* stats,
+                        RowGroupPredicate::Operator op, const Literal& value,
+                        bool* may_match) {
+  double physical_value;
+  if (value.kind() == Literal::FLOATING) {
+    physical_value = value.floating_value();
+  } else if (value.kind() == Literal::INTEGER) {
+    physical_value = static_cast<double>(value.integer_value());
+  } else {
+    return IncompatibleLiteral(descr, value);
+  }
+  if (stats == nullptr) {
+    return Status::OK();
+  }
+  const auto& typed_stats = static_cast<const TypedRowGroupStatistics<DType>&>(*stats);
+  *may_match = RangeMayMatch(op, static_cast<double>(typed_stats.min()),
+                             static_cast<double>(typed_stats.max()), physical_value,
+                             [](double a, double b) { return a < b; });
+  return Status::OK();
+}
+
+// Computes the Bloom filter hash of a literal already validated against the
+// column. hashable is set to false where the filter cannot tell whether the
+// column holds the literal's value
+Status HashLiteral(const ColumnDescriptor& descr, const BloomFilter& filter,
+                   const Literal& value, uint64_t* hash, bool* hashable) {
+  *hashable = true;
+  switch (descr.physical_type()) {
+    case Type::INT32: {
+      int32_t v;
+      RETURN_NOT_OK(PhysicalLiteral<Int32Type>::Convert(descr, value, &v));
+      *hash = filter.Hash(v);
+      return Status::OK();
+    }
+    case Type::INT64: {
+      int64_t v;
+      RETURN_NOT_OK(PhysicalLiteral<Int64Type>::Convert(descr, value, &v));
+      *hash = filter.Hash(v);
+      return Status::OK();
+    }
+    case Type::FLOAT:
+    case Type::DOUBLE: {
+      // Integers up to 2^53 convert to double exactly
+      const int64_t kMaxExactInteger = INT64_C(1) << 53;
+      double v = value.kind() == Literal::FLOATING
+                     ? value.floating_value()
+                     : static_cast<double>(value.integer_value());
+      // Hashes are of the bit patterns: -0.0 equals 0.0 but hashes differently,
+      // and NaN equals nothing
+      if (v == 0 || std::isnan(v) ||
+          (value.kind() == Literal::INTEGER &&
+           (value.integer_value() > kMaxExactInteger ||
+            value.integer_value() < -kMaxExactInteger))) {
+        *hashable = false;
+      } else if (descr.physical_type() == Type::FLOAT) {
+        float f = static_cast<float>(v);
+        *hashable = static_cast<double>(f) == v;
+        *hash = filter.Hash(f);
+      } else {
+        *hash = filter.Hash(v);
+      }
+      return Status::OK();
+    }
+    case Type::BYTE_ARRAY: {
+      ByteArray v;
+      RETURN_NOT_OK(PhysicalLiteral<ByteArrayType>::Convert(descr, value, &v));
+      *hash = filter.Hash(&v);
+      return Status::OK();
+    }
+    case Type::FIXED_LEN_BYTE_ARRAY: {
+      FLBA v;
+      RETURN_NOT_OK(PhysicalLiteral<FLBAType>::Convert(descr, value, &v));
+      *hash = filter.Hash(&v, static_cast<uint32_t>(descr.type_length()));
+      return Status::OK();
+    }
+    default:
+      *hashable = false;
+      return Status::OK();
+  }
+}
+
+// Sets may_match to false if the column chunk has a Bloom filter holding none
+// of values
+Status BloomFilterMayMatch(::parquet::RowGroupReader* row_group, int column_index,
+                           const std::vector<Literal>& values, bool* may_match) {
+  std::shared_ptr<BloomFilter> filter;
+  PARQUET_CATCH_NOT_OK(filter = row_group->GetBloomFilter(column_index));
+  if (filter == nullptr) {
+    return Status::OK();
+  }
+  const ColumnDescriptor* descr = row_group->metadata()->schema()->Column(column_index);
+  for (const Literal& value : values) {
+    uint64_t hash = 0;
+    bool hashable;
+    RETURN_NOT_OK(HashLiteral(*descr, *filter, value, &hash, &hashable));
+    if (!hashable || filter->FindHash(hash)) {
+      return Status::OK();
+    }
+  }
+  *may_match = false;
+  return Status::OK();
+}
+
+class ComparisonPredicate : public RowGroupPredicate {
+ public:
+  ComparisonPredicate(int column_index, Operator op, const Literal& value)
+      : column_index_(column_index), op_(op), value_(value) {}
+
+  Status MayMatch(const RowGroupMetaData& row_group, bool* may_match) const override {
+    if (column_index_ < 0 || column_index_ >= row_group.num_columns()) {
+      return Status::Invalid("Predicate column index ", column_index_,
+                             " is either < 0 or >= num_columns(",
+                             row_group.num_columns(), ")");
+    }
+    const ColumnDescriptor* descr = row_group.schema()->Column(column_index_);
+
+    std::shared_ptr<RowGroupStatistics> stats;
+    PARQUET_CATCH_NOT_OK(stats = row_group.ColumnChunk(column_index_)->statistics());
+    // Without min/max, only a chunk of nothing but nulls (or no values at all)
+    // can be ruled out: comparisons never hold for nulls
+    bool all_null = false;
+    if (stats != nullptr && !stats->HasMinMax()) {
+      all_null = stats->num_values() == 0;
+      stats.reset();
+    }
+
+    *may_match = true;
+    Status status;
+    switch (descr->physical_type()) {
+      case Type::BOOLEAN:
+        status = TypedMayMatch<BooleanType>(*descr, stats.get(), op_, value_, may_match);
+        break;
+      case Type::INT32:
+        status = TypedMayMatch<Int32Type>(*descr, stats.get(), op_, value_, may_match);
+        break;
+      case Type::INT64:
+        status = TypedMayMatch<Int64Type>(*descr, stats.get(), op_, value_, may_match);
+        break;
+      case Type::FLOAT:
+        status = FloatingMayMatch<FloatType>(*descr, stats.get(), op_, value_, may_match);
+        break;
+      case Type::DOUBLE:
+        status =
+            FloatingMayMatch<DoubleType>(*descr, stats.get(), op_, value_, may_match);
+        break;
+      case Type::BYTE_ARRAY:
+        status =
+            TypedMayMatch<ByteArrayType>(*descr, stats.get(), op_, value_, may_match);
+        break;
+      case Type::FIXED_LEN_BYTE_ARRAY:
+        status = TypedMayMatch<FLBAType>(*descr, stats.get(), op_, value_, may_match);
+        break;
+      default:
+        return Status::NotImplemented("Predicates on column '",
+                                      descr->path()->ToDotString(), "' of physical type ",
+                                      TypeToString(descr->physical_type()));
+    }
+    RETURN_NOT_OK(status);
+    if (all_null) {
+      *may_match = false;
+    }
+    return Status::OK();
+  }
+
+  Status MayMatch(::parquet::RowGroupReader* row_group,
+                  bool* may_match) const override {
+    RETURN_NOT_OK(MayMatch(*row_group->metadata(), may_match));
+    if (*may_match && op_ == EQUAL) {
+      return BloomFilterMayMatch(row_group, column_index_, {value_}, may_match);
+    }
+    return Status::OK();
+  }
+
+  std::string ToString() const override {
+    std::stringstream ss;
+    ss << "column(" << column_index_ << ") " << OperatorToString(op_) << " "
+       << value_.ToString();
+    return ss.str();
+  }
+
+ private:
+  int column_index_;
+  Operator op_;
+  Literal value_;
+};
+
+class InPredicate : public RowGroupPredicate {
+ public:
+  InPredicate(int column_index, const std::vector<Literal>& values)
+      : column_index_(column_index), values_(values) {}
+
+  Status MayMatch(const RowGroupMetaData& row_group, bool* may_match) const override {
+    std::vector<Literal> candidates;
+    RETURN_NOT_OK(Candidates(row_group, &candidates));
+    *may_match = !candidates.empty();
+    return Status::OK();
+  }
+
+  Status MayMatch(::parquet::RowGroupReader* row_group,
+                  bool* may_match) const override {
+    std::vector<Literal> candidates;
+    RETURN_NOT_OK(Candidates(*row_group->metadata(), &candidates));
+    *may_match = !candidates.empty();
+    if (*may_match) {
+      return BloomFilterMayMatch(row_group, column_index_, candidates, may_match);
+    }
+    return Status::OK();
+  }
+
+  std::string ToString() const override {
+    std::stringstream ss;
+    ss << "column(" << column_index_ << ") in (";
+    for (size_t i = 0; i < values_.size(); ++i) {
+      ss << (i > 0 ? ", " : "") << values_[i].ToString();
+    }
+    ss << ")";
+    return ss.str();
+  }
+
+ private:
+  // The values the statistics of the row group do not rule out
+  Status Candidates(const RowGroupMetaData& row_group,
+                    std::vector<Literal>* candidates) const {
+    for (const Literal& value : values_) {
+      ComparisonPredicate equal(column_index_, EQUAL, value);
+      bool may_match;
+      RETURN_NOT_OK(equal.MayMatch(row_group, &may_match));
+      if (may_match) {
+        candidates->push_back(value);
+      }
+    }
+    return Status::OK();
+  }
+
+  int column_index_;
+  std::vector<Literal> values_;
+};
+
+class ConjunctionPredicate : public RowGroupPredicate {
+ public:
+  ConjunctionPredicate(bool is_and, const std::shared_ptr<RowGroupPredicate>& lhs,
+                       const std::shared_ptr<RowGroupPredicate>& rhs)
+      : is_and_(is_and), lhs_(lhs), rhs_(rhs) {
+    DCHECK(lhs_ && rhs_);
+  }
+
+  Status MayMatch(const RowGroupMetaData& row_group, bool* may_match) const override {
+    bool lhs_match, rhs_match;
+    // Both sides are always evaluated so that invalid predicates are reported
+    // regardless of the statistics
+    RETURN_NOT_OK(lhs_->MayMatch(row_group, &lhs_match));
+    RETURN_NOT_OK(rhs_->MayMatch(row_group, &rhs_match));
+    *may_match = is_and_ ? (lhs_match && rhs_match) : (lhs_match || rhs_match);
+    return Status::OK();
+  }
+
+  Status MayMatch(::parquet::RowGroupReader* row_group,
+                  bool* may_match) const override {
+    bool lhs_match, rhs_match;
+    RETURN_NOT_OK(lhs_->MayMatch(row_group, &lhs_match));
+    // Once the left side decides the outcome, the right side is only
+    // validated and its Bloom filters are not read
+    if (is_and_ != lhs_match) {
+      RETURN_NOT_OK(rhs_->MayMatch(*row_group->metadata(), &rhs_match));
+    } else {
+      RETURN_NOT_OK(rhs_->MayMatch(row_group, &rhs_match));
+    }
+    *may_match = is_and_ ? (lhs_match && rhs_match) : (lhs_match || rhs_match);
+    return Status::OK();
+  }
+
+  std::string ToString() const override {
+    return "(" + lhs_->ToString() + (is_and_ ? " and " : " or ") + rhs_->ToString() +
+           ")";
+  }
+
+ private:
+  bool is_and_;
+  std::shared_ptr<RowGroupPredicate> lhs_;
+  std::shared_ptr<RowGroupPredicate> rhs_;
+};
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// RowGroupPredicate factories
+
+std::shared_ptr<RowGroupPredicate> RowGroupPredicate::Compare(int column_index,
+                                                              Operator op,
+                                                              const Literal& value) {
+  return std::make_shared<ComparisonPredicate>(column_index, op, value);
+}
+
+std::shared_ptr<RowGroupPredicate> RowGroupPredicate::In(
+    int column_index, const std::vector<Literal>& values) {
+  return std::make_shared<InPredicate>(column_index, values);
+}
+
+std::shared_ptr<RowGroupPredicate> RowGroupPredicate::And(
+    const std::shared_ptr<RowGroupPredicate>& lhs,
+    const std::shared_ptr<RowGroupPredicate>& rhs) {
+  return std::make_shared<ConjunctionPredicate>(true, lhs, rhs);
+}
+
+std::shared_ptr<RowGroupPredicate> RowGroupPredicate::Or(
+    const std::shared_ptr<RowGroupPredicate>& lhs,
+    const std::shared_ptr<RowGroupPredicate>& rhs) {
+  return std::make_shared<ConjunctionPredicate>(false, lhs, rhs);
+}
+
+}  // namespace arrow
+}  // namespace parquet
@@ -0,0 +1,143 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PARQUET_ARROW_PREDICATE_H
+#define PARQUET_ARROW_PREDICATE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/util/visibility.h"
+
+namespace arrow {
+
+class Status;
+
+}  // namespace arrow
+
+namespace parquet {
+
+class RowGroupMetaData;
+class RowGroupReader;
+
+namespace arrow {
+
+/// \brief A filter expression over leaf column values, used to skip row
+/// groups whose statistics show that no row can satisfy it.
+///
+/// Predicates are built from comparisons of a leaf column against a literal
+/// and from IN lists, combined with And and Or. A row group is only skipped
+/// when its column chunk min/max statistics rule it out or, for EQUAL and In
+/// evaluated against a RowGroupReader, when the column chunk's Bloom filter
+/// holds none of the literals; rows of the remaining row groups are returned
+/// unfiltered. Column chunks without usable statistics (not written, unknown
+/// sort order, or known to be incorrect for the writer version) never cause a
+/// row group to be skipped.
+///
+/// Literals are compared with the column's physical values using the sort
+/// order of its logical type, e.g. an INT32 column annotated UINT_32 is
+/// compared unsigned and a UTF8 column bytewise unsigned:
+///
+/// * BOOLEAN columns take bool literals
+/// * INT32 and INT64 columns take integer literals in the range of the column
+/// * FLOAT and DOUBLE columns take floating point or integer literals
+/// * BYTE_ARRAY columns take string literals; FIXED_LEN_BYTE_ARRAY columns
+///   take string literals of the column's type length
+///
+/// INT96 columns are not supported.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class PARQUET_EXPORT RowGroupPredicate {
+ public:
+  enum Operator { EQUAL, NOT_EQUAL, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL };
+
+  /// \brief A typed constant to compare a column against
+  class PARQUET_EXPORT Literal {
+   public:
+    enum Kind { BOOL, INTEGER, FLOATING, BYTES };
+
+    Literal(bool value);                // NOLINT implicit conversion
+    Literal(int32_t value);             // NOLINT implicit conversion
+    Literal(int64_t value);             // NOLINT implicit conversion
+    Literal(float value);               // NOLINT implicit conversion
+    Literal(double value);              // NOLINT implicit conversion
+    Literal(const char* value);         // NOLINT implicit conversion
+    Literal(const std::string& value);  // NOLINT implicit conversion
+
+    Kind kind() const { return kind_; }
+    bool bool_value() const { return integer_value_ != 0; }
+    int64_t integer_value() const { return integer_value_; }
+    double floating_value() const { return floating_value_; }
+    const std::string& bytes_value() const { return bytes_value_; }
+
+    std::string ToString() const;
+
+   private:
+    Kind kind_;
+    int64_t integer_value_ = 0;
+    double floating_value_ = 0;
+    std::string bytes_value_;
+  };
+
+  /// \brief Compare the leaf column column_index (relative to the file
+  /// schema) against value
+  static std::shared_ptr<RowGroupPredicate> Compare(int column_index, Operator op,
+                                                    const Literal& value);
+
+  /// \brief Satisfied when the leaf column column_index equals any of values
+  static std::shared_ptr<RowGroupPredicate> In(int column_index,
+                                               const std::vector<Literal>& values);
+
+  /// \brief Satisfied when both lhs and rhs are
+  static std::shared_ptr<RowGroupPredicate> And(
+      const std::shared_ptr<RowGroupPredicate>& lhs,
+      const std::shared_ptr<RowGroupPredicate>& rhs);
+
+  /// \brief Satisfied when either lhs or rhs is
+  static std::shared_ptr<RowGroupPredicate> Or(
+      const std::shared_ptr<RowGroupPredicate>& lhs,
+      const std::shared_ptr<RowGroupPredicate>& rhs);
+
+  virtual ~RowGroupPredicate() = default;
+
+  /// \brief Check the predicate against the statistics of a row group
+  ///
+  /// \param[in] row_group the row group metadata
+  /// \param[out] may_match set to false if no row of the row group can
+  /// satisfy the predicate, true otherwise
+  /// \return error Status if a column index is out of range or a literal
+  /// cannot be compared with its column
+  virtual ::arrow::Status MayMatch(const RowGroupMetaData& row_group,
+                                   bool* may_match) const = 0;
+
+  /// \brief Check the predicate against the statistics and Bloom filters of
+  /// a row group
+  ///
+  /// Bloom filters are read from the file as needed.
+  virtual ::arrow::Status MayMatch(::parquet::RowGroupReader* row_group,
+                                   bool* may_match) const = 0;
+
+  virtual std::string ToString() const = 0;
+};
+
+}  // namespace arrow
+}  // namespace parquet
+
+#endif  // PARQUET_ARROW_PREDICATE_H
@@ -18,6 +18,8 @@
 #include "benchmark/benchmark.h"
 
 #include <iostream>
+#include <numeric>
+#include <vector>
 
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/writer.h"
@@ -28,6 +30,7 @@
 #include "parquet/util/memory.h"
 
 #include "arrow/api.h"
+#include "arrow/testing/random.h"
 
 using arrow::BooleanBuilder;
 using arrow::NumericBuilder;
@@ -261,6 +264,189 @@ static void BM_ReadMultipleRowGroups(::benchmark::State& state) {
 
 BENCHMARK(BM_ReadMultipleRowGroups);
 
+// ----------------------------------------------------------------------
+// Benchmark matrix
+//
+// WriteTable, ReadTable and GetRecordBatchReader over a column, for every
+// combination of encoding, codec, null percentage, nesting depth and row group
+// length. Each run reports its parameters as counters besides bytes and rows
+// per second, so that
+//
+//   parquet-arrow-reader-writer-benchmark --benchmark_filter=Matrix
+//       --benchmark_format=json
+//
+// prints machine-readable results. Bytes processed are those of the values
+// and validity bitmaps of the Arrow column.
+
+constexpr int64_t kMatrixRows = 1 << 20;
+
+// Encoding arguments, the dictionary being enabled for RLE_DICTIONARY
+constexpr int64_t kDictionaryEncoding = Encoding::RLE_DICTIONARY;
+
+static void SetMatrixArgs(::benchmark::internal::Benchmark* bench,
+                          Encoding::type dense_encoding) {
+  bench->Unit(::benchmark::kMillisecond)->UseRealTime();
+  for (int64_t encoding : {static_cast<int64_t>(Encoding::PLAIN), kDictionaryEncoding,
+                           static_cast<int64_t>(dense_encoding)}) {
+    for (int64_t codec : {Compression::UNCOMPRESSED, Compression::SNAPPY,
+                          Compression::ZSTD}) {
+      for (int64_t null_percent : {0, 10, 50}) {
+        for (int64_t nesting_depth : {0, 1, 2}) {
+          for (int64_t row_group_length : {kMatrixRows / 16, kMatrixRows}) {
+            bench->Args({encoding, codec, null_percent, nesting_depth, row_group_length});
+          }
+        }
+      }
+    }
+  }
+}
+
+static void SetInt64MatrixArgs(::benchmark::internal::Benchmark* bench) {
+  SetMatrixArgs(bench, Encoding::DELTA_BINARY_PACKED);
+}
+
+static void SetDoubleMatrixArgs(::benchmark::internal::Benchmark* bench) {
+  SetMatrixArgs(bench, Encoding::BYTE_STREAM_SPLIT);
+}
+
+template <typename ParquetType>
+std::shared_ptr<::arrow::Array> MatrixValues(::arrow::random::RandomArrayGenerator* rand,
+                                             double null_probability);
+
+// Values of a few thousand distinct ones, to leave the dictionary a chance
+template <>
+std::shared_ptr<::arrow::Array> MatrixValues<Int64Type>(
+    ::arrow::random::RandomArrayGenerator* rand, double null_probability) {
+  return rand->Int64(kMatrixRows, 0, 4096, null_probability);
+}
+
+template <>
+std::shared_ptr<::arrow::Array> MatrixValues<DoubleType>(
+    ::arrow::random::RandomArrayGenerator* rand, double null_probability) {
+  return rand->Float64(kMatrixRows, -1000, 1000, null_probability);
+}
+
+// A one-column table of the values nested in nesting_depth structs
+template <typename ParquetType>
+std::shared_ptr<::arrow::Table> MatrixTable(int64_t null_percent, int64_t nesting_depth,
+                                            int64_t* nbytes) {
+  ::arrow::random::RandomArrayGenerator rand(0x5eed);
+  std::shared_ptr<::arrow::Array> array =
+      MatrixValues<ParquetType>(&rand, static_cast<double>(null_percent) / 100);
+  *nbytes = array->length() * sizeof(typename ParquetType::c_type);
+  if (array->null_count() > 0) {
+    *nbytes += ::arrow::BitUtil::BytesForBits(array->length());
+  }
+  for (int64_t i = 0; i < nesting_depth; ++i) {
+    auto type = ::arrow::struct_({::arrow::field("child", array->type())});
+    array = std::make_shared<::arrow::StructArray>(type, array->length(),
+                                                   ::arrow::ArrayVector{array});
+  }
+  auto field = ::arrow::field("column", array->type());
+  return ::arrow::Table::Make(::arrow::schema({field}), {array});
+}
+
+std::shared_ptr<WriterProperties> MatrixWriterProperties(int64_t encoding,
+                                                        int64_t codec) {
+  WriterProperties::Builder builder;
+  builder.version(ParquetVersion::PARQUET_2_0)
+      ->compression(static_cast<Compression::type>(codec));
+  if (encoding == kDictionaryEncoding) {
+    builder.enable_dictionary();
+  } else {
+    builder.disable_dictionary()->encoding(static_cast<Encoding::type>(encoding));
+  }
+  return builder.build();
+}
+
+struct MatrixInput {
+  std::shared_ptr<::arrow::Table> table;
+  std::shared_ptr<WriterProperties> properties;
+  int64_t row_group_length;
+  int64_t nbytes;
+};
+
+template <typename ParquetType>
+MatrixInput MakeMatrixInput(const ::benchmark::State& state) {
+  MatrixInput input;
+  input.table = MatrixTable<ParquetType>(state.range(2), state.range(3), &input.nbytes);
+  input.properties = MatrixWriterProperties(state.range(0), state.range(1));
+  input.row_group_length = state.range(4);
+  return input;
+}
+
+std::shared_ptr<Buffer> WriteMatrixInput(const MatrixInput& input) {
+  auto output = std::make_shared<InMemoryOutputStream>();
+  EXIT_NOT_OK(WriteTable(*input.table, ::arrow::default_memory_pool(), output,
+                         input.row_group_length, input.properties));
+  return output->GetBuffer();
+}
+
+void SetMatrixCounters(::benchmark::State& state, const MatrixInput& input,
+                       int64_t file_size) {
+  state.SetItemsProcessed(state.iterations() * kMatrixRows);
+  state.SetBytesProcessed(state.iterations() * input.nbytes);
+  state.counters["encoding"] = static_cast<double>(state.range(0));
+  state.counters["codec"] = static_cast<double>(state.range(1));
+  state.counters["null_percent"] = static_cast<double>(state.range(2));
+  state.counters["nesting_depth"] = static_cast<double>(state.range(3));
+  state.counters["row_group_length"] = static_cast<double>(state.range(4));
+  state.counters["file_size"] = static_cast<double>(file_size);
+}
+
+template <typename ParquetType>
+static void BM_MatrixWriteTable(::benchmark::State& state) {
+  MatrixInput input = MakeMatrixInput<ParquetType>(state);
+  int64_t file_size = 0;
+  while (state.KeepRunning()) {
+    file_size = WriteMatrixInput(input)->size();
+  }
+  SetMatrixCounters(state, input, file_size);
+}
+
+template <typename ParquetType>
+static void BM_MatrixReadTable(::benchmark::State& state) {
+  MatrixInput input = MakeMatrixInput<ParquetType>(state);
+  std::shared_ptr<Buffer> buffer = WriteMatrixInput(input);
+  while (state.KeepRunning()) {
+    auto reader =
+        ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+    FileReader filereader(::arrow::default_memory_pool(), std::move(reader));
+    std::shared_ptr<::arrow::Table> table;
+    EXIT_NOT_OK(filereader.ReadTable(&table));
+  }
+  SetMatrixCounters(state, input, buffer->size());
+}
+
+template <typename ParquetType>
+static void BM_MatrixRecordBatchReader(::benchmark::State& state) {
+  MatrixInput input = MakeMatrixInput<ParquetType>(state);
+  std::shared_ptr<Buffer> buffer = WriteMatrixInput(input);
+  while (state.KeepRunning()) {
+    auto reader =
+        ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+    FileReader filereader(::arrow::default_memory_pool(), std::move(reader));
+    std::vector<int> row_groups(filereader.num_row_groups());
+    std::iota(row_groups.begin(), row_groups.end(), 0);
+    std::shared_ptr<::arrow::RecordBatchReader> batch_reader;
+    EXIT_NOT_OK(filereader.GetRecordBatchReader(row_groups, &batch_reader));
+    std::shared_ptr<::arrow::RecordBatch> batch;
+    do {
+      EXIT_NOT_OK(batch_reader->ReadNext(&batch));
+    } while (batch != nullptr);
+  }
+  SetMatrixCounters(state, input, buffer->size());
+}
+
+BENCHMARK_TEMPLATE(BM_MatrixWriteTable, Int64Type)->Apply(SetInt64MatrixArgs);
+BENCHMARK_TEMPLATE(BM_MatrixWriteTable, DoubleType)->Apply(SetDoubleMatrixArgs);
+
+BENCHMARK_TEMPLATE(BM_MatrixReadTable, Int64Type)->Apply(SetInt64MatrixArgs);
+BENCHMARK_TEMPLATE(BM_MatrixReadTable, DoubleType)->Apply(SetDoubleMatrixArgs);
+
+BENCHMARK_TEMPLATE(BM_MatrixRecordBatchReader, Int64Type)->Apply(SetInt64MatrixArgs);
+BENCHMARK_TEMPLATE(BM_MatrixRecordBatchReader, DoubleType)->Apply(SetDoubleMatrixArgs);
+
 }  // namespace benchmark
 
 }  // namespace parquet
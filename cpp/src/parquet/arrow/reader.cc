@@ -20,8 +20,11 @@
 #include <algorithm>
 #include <climits>
 #include <cstring>
+#include <deque>
 #include <future>
+#include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -37,10 +40,14 @@
 #include "arrow/util/int-util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/thread-pool.h"
+#include "arrow/util/tracing.h"
 
 // For arrow::compute::Datum. This should perhaps be promoted. See ARROW-4022
+#include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/take.h"
 
+#include "parquet/arrow/predicate.h"
 #include "parquet/arrow/record_reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/column_reader.h"
@@ -57,6 +64,7 @@ using arrow::Array;
 using arrow::BooleanArray;
 using arrow::ChunkedArray;
 using arrow::Column;
+using arrow::DictionaryArray;
 using arrow::Field;
 using arrow::Int32Array;
 using arrow::ListArray;
@@ -69,6 +77,7 @@ using arrow::TimestampArray;
 
 // For Array/ChunkedArray variant
 using arrow::compute::Datum;
+using arrow::compute::FunctionContext;
 
 using parquet::schema::Node;
 
@@ -90,6 +99,26 @@ using ArrayType = typename ::arrow::TypeTraits<ArrowType>::ArrayType;
 
 namespace {
 
+void FindNestedTypes(const ::arrow::DataType& type, bool* has_lists,
+                     bool* has_structs) {
+  if (type.id() == ::arrow::Type::LIST) {
+    *has_lists = true;
+  } else if (type.id() == ::arrow::Type::STRUCT) {
+    *has_structs = true;
+  }
+  for (int i = 0; i < type.num_children(); ++i) {
+    FindNestedTypes(*type.child(i)->type(), has_lists, has_structs);
+  }
+}
+
+// Whether a type nests lists and structs within each other, at any depth
+bool HasListsAndStructs(const ::arrow::DataType& type) {
+  bool has_lists = false;
+  bool has_structs = false;
+  FindNestedTypes(type, &has_lists, &has_structs);
+  return has_lists && has_structs;
+}
+
 Status GetSingleChunk(const ChunkedArray& chunked, std::shared_ptr<Array>* out) {
   DCHECK_GT(chunked.num_chunks(), 0);
   if (chunked.num_chunks() > 1) {
@@ -99,6 +128,264 @@ Status GetSingleChunk(const ChunkedArray& chunked, std::shared_ptr<Array>* out)
   return Status::OK();
 }
 
+// Dictionary-encoded columns (see FileReader::set_read_dictionary) have a
+// type depending on their dictionary, which the schema can't know upfront
+std::shared_ptr<Field> FieldForData(const std::shared_ptr<Field>& field,
+                                    const ChunkedArray& data) {
+  if (data.type()->Equals(*field->type())) {
+    return field;
+  }
+  return field->WithType(data.type());
+}
+
+std::shared_ptr<::arrow::Schema> SchemaForColumns(
+    const ::arrow::Schema& schema, const std::vector<std::shared_ptr<Column>>& columns) {
+  std::vector<std::shared_ptr<Field>> fields(columns.size());
+  for (size_t i = 0; i < columns.size(); ++i) {
+    fields[i] = columns[i]->field();
+  }
+  return ::arrow::schema(std::move(fields), schema.metadata());
+}
+
+// Transpose the dictionary-encoded columns of tables to a common dictionary,
+// so that they can be concatenated
+Status UnifyDictionaryColumns(MemoryPool* pool,
+                              std::vector<std::shared_ptr<Table>>* tables) {
+  if (tables->size() < 2) {
+    return Status::OK();
+  }
+  const int num_columns = tables->front()->num_columns();
+  for (int i = 0; i < num_columns; ++i) {
+    if (tables->front()->column(i)->type()->id() != ::arrow::Type::DICTIONARY) {
+      continue;
+    }
+    // The chunks of a column share the type of the column
+    std::vector<const ::arrow::DataType*> types;
+    for (const auto& table : *tables) {
+      types.push_back(table->column(i)->type().get());
+    }
+    std::shared_ptr<::arrow::DataType> type;
+    std::vector<std::vector<int32_t>> transpose_maps;
+    RETURN_NOT_OK(::arrow::DictionaryType::Unify(pool, types, &type, &transpose_maps));
+    for (size_t j = 0; j < tables->size(); ++j) {
+      auto& table = (*tables)[j];
+      const auto& column = *table->column(i);
+      ::arrow::ArrayVector chunks(column.data()->num_chunks());
+      for (int k = 0; k < column.data()->num_chunks(); ++k) {
+        const auto& chunk = static_cast<const DictionaryArray&>(*column.data()->chunk(k));
+        RETURN_NOT_OK(chunk.Transpose(pool, type, transpose_maps[j], &chunks[k]));
+      }
+      RETURN_NOT_OK(table->SetColumn(
+          i, std::make_shared<Column>(column.field()->WithType(type), chunks), &table));
+    }
+  }
+  return Status::OK();
+}
+
+// The levels and values of the records read from one leaf of a nested field
+struct NestedLeaf {
+  // nullptr if the leaf has no definition levels, i.e. the leaf and all of its
+  // ancestors are required
+  const int16_t* def_levels;
+  // nullptr if the leaf has no repetition levels
+  const int16_t* rep_levels;
+  int64_t num_levels;
+  // Minimal definition level of the levels that have a slot in values
+  int16_t values_def_level;
+  std::shared_ptr<Array> values;
+};
+
+// Reassembles a nested field from the levels and values of its leaves, given
+// in schema order. The slots of each list or struct are found in one pass over
+// the levels of its first leaf, which writes their validity bitmap and list
+// offsets to preallocated buffers. A level starts a slot of a node if it
+// doesn't repeat a list below the node's innermost enclosing list and defines
+// that list as non-empty.
+class NestedArrayBuilder {
+ public:
+  NestedArrayBuilder(MemoryPool* pool, const std::vector<NestedLeaf>& leaves)
+      : pool_(pool), leaves_(leaves), next_leaf_(0) {}
+
+  Status Build(const Field& field, std::shared_ptr<Array>* out) {
+    next_leaf_ = 0;
+    return BuildNode(field, 0, 0, 0, out);
+  }
+
+ private:
+  // slot_rep_level and slot_def_level identify the levels starting a slot of
+  // field, def_level is the definition level of a null slot
+  Status BuildNode(const Field& field, int16_t slot_rep_level, int16_t slot_def_level,
+                   int16_t def_level, std::shared_ptr<Array>* out) {
+    if (next_leaf_ >= leaves_.size()) {
+      return Status::Invalid("Nested field has more leaves than were read");
+    }
+    const auto defined_level = static_cast<int16_t>(def_level + field.nullable());
+    switch (field.type()->id()) {
+      case ::arrow::Type::STRUCT:
+        return BuildStruct(field, slot_rep_level, slot_def_level, defined_level, out);
+      case ::arrow::Type::LIST:
+        return BuildList(field, slot_rep_level, slot_def_level, defined_level, out);
+      default:
+        return BuildLeaf(slot_def_level, out);
+    }
+  }
+
+  Status BuildStruct(const Field& field, int16_t slot_rep_level, int16_t slot_def_level,
+                     int16_t defined_level, std::shared_ptr<Array>* out) {
+    const NestedLeaf& leaf = leaves_[next_leaf_];
+    std::shared_ptr<Buffer> valid_bits;
+    int64_t length = 0;
+    int64_t null_count = 0;
+    if (leaf.def_levels == nullptr) {
+      // Neither the struct nor its ancestors can be null or repeated
+      length = leaf.num_levels;
+    } else {
+      RETURN_NOT_OK(AllocateEmptyBitmap(pool_, leaf.num_levels, &valid_bits));
+      uint8_t* valid_bits_data = valid_bits->mutable_data();
+      for (int64_t i = 0; i < leaf.num_levels; ++i) {
+        const int16_t def = leaf.def_levels[i];
+        if (IsSlot(leaf, i, slot_rep_level, slot_def_level)) {
+          if (def >= defined_level) {
+            ::arrow::BitUtil::SetBit(valid_bits_data, length);
+          } else {
+            ++null_count;
+          }
+          ++length;
+        }
+      }
+    }
+
+    const auto& type = *field.type();
+    std::vector<std::shared_ptr<Array>> children(type.num_children());
+    std::vector<std::shared_ptr<Field>> fields(type.num_children());
+    for (int i = 0; i < type.num_children(); ++i) {
+      RETURN_NOT_OK(BuildNode(*type.child(i), slot_rep_level, slot_def_level,
+                              defined_level, &children[i]));
+      if (children[i]->length() != length) {
+        return Status::Invalid("Struct children had different lengths");
+      }
+      // The children types may differ from the fields' when reading dictionaries
+      fields[i] = type.child(i)->WithType(children[i]->type());
+    }
+    *out = std::make_shared<StructArray>(::arrow::struct_(fields), length, children,
+                                         null_count > 0 ? valid_bits : nullptr,
+                                         null_count);
+    return Status::OK();
+  }
+
+  Status BuildList(const Field& field, int16_t slot_rep_level, int16_t slot_def_level,
+                   int16_t defined_level, std::shared_ptr<Array>* out) {
+    const NestedLeaf& leaf = leaves_[next_leaf_];
+    if (leaf.def_levels == nullptr || leaf.rep_levels == nullptr) {
+      return Status::Invalid("Leaf of a list has no repetition levels");
+    }
+    // The repeated node below the list adds a repetition and definition level
+    const auto values_rep_level = static_cast<int16_t>(slot_rep_level + 1);
+    const auto values_def_level = static_cast<int16_t>(defined_level + 1);
+
+    std::shared_ptr<ResizableBuffer> offsets;
+    std::shared_ptr<Buffer> valid_bits;
+    RETURN_NOT_OK(::arrow::AllocateResizableBuffer(
+        pool_, (leaf.num_levels + 1) * sizeof(int32_t), &offsets));
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool_, leaf.num_levels, &valid_bits));
+    auto offsets_data = reinterpret_cast<int32_t*>(offsets->mutable_data());
+    uint8_t* valid_bits_data = valid_bits->mutable_data();
+
+    int64_t length = 0;
+    int64_t null_count = 0;
+    int32_t num_values = 0;
+    for (int64_t i = 0; i < leaf.num_levels; ++i) {
+      const int16_t def = leaf.def_levels[i];
+      if (IsSlot(leaf, i, slot_rep_level, slot_def_level)) {
+        offsets_data[length] = num_values;
+        if (def >= defined_level) {
+          ::arrow::BitUtil::SetBit(valid_bits_data, length);
+        } else {
+          ++null_count;
+        }
+        ++length;
+      }
+      // Levels repeating a deeper list don't start a value of this one
+      if (leaf.rep_levels[i] <= values_rep_level && def >= values_def_level) {
+        ++num_values;
+      }
+    }
+    offsets_data[length] = num_values;
+    RETURN_NOT_OK(offsets->Resize((length + 1) * sizeof(int32_t)));
+
+    const Field& value_field = *field.type()->child(0);
+    std::shared_ptr<Array> values;
+    RETURN_NOT_OK(BuildNode(value_field, values_rep_level, values_def_level,
+                            values_def_level, &values));
+    if (values->length() != num_values) {
+      return Status::Invalid("List values had a different length than the list offsets");
+    }
+    *out = std::make_shared<ListArray>(
+        ::arrow::list(value_field.WithType(values->type())), length, offsets, values,
+        null_count > 0 ? valid_bits : nullptr, null_count);
+    return Status::OK();
+  }
+
+  Status BuildLeaf(int16_t slot_def_level, std::shared_ptr<Array>* out) {
+    const NestedLeaf& leaf = leaves_[next_leaf_++];
+    if (leaf.values_def_level <= slot_def_level) {
+      // Every slot has a value
+      *out = leaf.values;
+      return Status::OK();
+    }
+
+    // Slots below a null struct within a list have no value in the leaf, spread
+    // its values leaving them null
+    int64_t num_slots = 0;
+    for (int64_t i = 0; i < leaf.num_levels; ++i) {
+      num_slots += leaf.def_levels[i] >= slot_def_level;
+    }
+    std::shared_ptr<Buffer> indices;
+    std::shared_ptr<Buffer> indices_valid_bits;
+    RETURN_NOT_OK(::arrow::AllocateBuffer(pool_, num_slots * sizeof(int32_t), &indices));
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool_, num_slots, &indices_valid_bits));
+    auto indices_data = reinterpret_cast<int32_t*>(indices->mutable_data());
+    uint8_t* indices_valid_bits_data = indices_valid_bits->mutable_data();
+    int64_t slot = 0;
+    int32_t value = 0;
+    for (int64_t i = 0; i < leaf.num_levels; ++i) {
+      const int16_t def = leaf.def_levels[i];
+      if (def < slot_def_level) {
+        continue;
+      }
+      if (def >= leaf.values_def_level) {
+        ::arrow::BitUtil::SetBit(indices_valid_bits_data, slot);
+        indices_data[slot] = value++;
+      } else {
+        indices_data[slot] = 0;
+      }
+      ++slot;
+    }
+    if (value != leaf.values->length()) {
+      return Status::Invalid("Leaf had a different number of values than levels");
+    }
+
+    Int32Array indices_array(num_slots, indices, indices_valid_bits,
+                             num_slots - value);
+    FunctionContext ctx(pool_);
+    Datum spread;
+    RETURN_NOT_OK(::arrow::compute::Take(&ctx, Datum(leaf.values),
+                                         Datum(indices_array.data()), &spread));
+    *out = spread.make_array();
+    return Status::OK();
+  }
+
+  static bool IsSlot(const NestedLeaf& leaf, int64_t i, int16_t slot_rep_level,
+                     int16_t slot_def_level) {
+    return (leaf.rep_levels == nullptr || leaf.rep_levels[i] <= slot_rep_level) &&
+           leaf.def_levels[i] >= slot_def_level;
+  }
+
+  MemoryPool* pool_;
+  const std::vector<NestedLeaf>& leaves_;
+  size_t next_leaf_;
+};
+
 }  // namespace
 
 // ----------------------------------------------------------------------
@@ -237,7 +524,12 @@ using FileColumnIteratorFactory =
 class FileReader::Impl {
  public:
   Impl(MemoryPool* pool, std::unique_ptr<ParquetFileReader> reader)
-      : pool_(pool), reader_(std::move(reader)), use_threads_(false) {}
+      : pool_(pool),
+        reader_(std::move(reader)),
+        use_threads_(false),
+        read_dictionary_(false),
+        batch_size_(0),
+        batch_memory_limit_(0) {}
 
   virtual ~Impl() {}
 
@@ -252,10 +544,19 @@ class FileReader::Impl {
                          std::shared_ptr<ChunkedArray>* out);
   Status ReadColumnChunk(int column_index, const std::vector<int>& indices,
                          int row_group_index, std::shared_ptr<ChunkedArray>* out);
+  // Read only the rows of the row group in rows, unless null
+  Status ReadColumnChunk(int column_index, const std::vector<int>& indices,
+                         int row_group_index, const std::vector<RowRange>* rows,
+                         std::shared_ptr<ChunkedArray>* out);
 
   Status GetReaderForNode(int index, const Node* node, const std::vector<int>& indices,
                           int16_t def_level, FileColumnIteratorFactory iterator_factory,
                           std::unique_ptr<ColumnReader::ColumnReaderImpl>* out);
+  // Get a NestedImpl reading the leaf columns column_indices of field
+  Status GetNestedReader(const std::shared_ptr<Field>& field,
+                         const std::vector<int>& column_indices,
+                         FileColumnIteratorFactory iterator_factory,
+                         std::unique_ptr<ColumnReader::ColumnReaderImpl>* out);
 
   Status GetSchema(std::shared_ptr<::arrow::Schema>* out);
   Status GetSchema(const std::vector<int>& indices,
@@ -263,12 +564,34 @@ class FileReader::Impl {
   Status ReadRowGroup(int row_group_index, std::shared_ptr<Table>* table);
   Status ReadRowGroup(int row_group_index, const std::vector<int>& indices,
                       std::shared_ptr<::arrow::Table>* out);
+  Status ReadRowGroup(int row_group_index, const std::vector<int>& indices,
+                      const std::vector<RowRange>* rows,
+                      std::shared_ptr<::arrow::Table>* out);
+  Status ReadRowGroup(int row_group_index, const std::vector<int>& filter_indices,
+                      const RowFilter& filter, const std::vector<int>& indices,
+                      std::shared_ptr<::arrow::Table>* out);
   Status ReadTable(const std::vector<int>& indices, std::shared_ptr<Table>* table);
   Status ReadTable(std::shared_ptr<Table>* table);
   Status ReadRowGroups(const std::vector<int>& row_groups, std::shared_ptr<Table>* table);
   Status ReadRowGroups(const std::vector<int>& row_groups,
                        const std::vector<int>& indices,
                        std::shared_ptr<::arrow::Table>* out);
+  // Decode the (row group, column) chunks of row_groups as independent tasks
+  // on the CPU thread pool, yielding one table per row group
+  Status ReadRowGroupsParallel(const std::vector<int>& row_groups,
+                               const std::vector<int>& indices,
+                               std::vector<std::shared_ptr<Table>>* tables);
+  Status ReadTable(const std::vector<int>& indices, const RowGroupPredicate& predicate,
+                   std::shared_ptr<Table>* out);
+  Status FilterRowGroups(const std::vector<int>& row_groups,
+                         const RowGroupPredicate& predicate, std::vector<int>* out);
+
+  // Get a RecordBatchReader decoding the row groups incrementally, in
+  // batches of batch_size_ rows
+  Status GetStreamingBatchReader(const std::vector<int>& row_groups,
+                                 const std::vector<int>& indices,
+                                 const std::shared_ptr<::arrow::Schema>& schema,
+                                 std::shared_ptr<RecordBatchReader>* out);
 
   bool CheckForFlatColumn(const ColumnDescriptor* descr);
   bool CheckForFlatListColumn(const ColumnDescriptor* descr);
@@ -281,12 +604,39 @@ class FileReader::Impl {
 
   void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
 
+  void set_read_dictionary(bool read_dictionary) { read_dictionary_ = read_dictionary; }
+
+  void set_read_dictionary(int column_index, bool read_dictionary) {
+    column_read_dictionary_[column_index] = read_dictionary;
+  }
+
+  bool read_dictionary(int column_index) const {
+    auto it = column_read_dictionary_.find(column_index);
+    return it != column_read_dictionary_.end() ? it->second : read_dictionary_;
+  }
+
+  void set_batch_size(int64_t batch_size) { batch_size_ = batch_size; }
+
+  void set_batch_memory_limit(int64_t memory_limit) {
+    batch_memory_limit_ = memory_limit;
+  }
+
+  // Whether GetRecordBatchReader splits row groups into batches
+  bool streams_batches() const { return batch_size_ > 0 || batch_memory_limit_ > 0; }
+
   ParquetFileReader* reader() { return reader_.get(); }
 
  private:
+  class StreamingBatchReader;
+
   MemoryPool* pool_;
   std::unique_ptr<ParquetFileReader> reader_;
   bool use_threads_;
+  bool read_dictionary_;
+  // Per-column overrides of read_dictionary_
+  std::unordered_map<int, bool> column_read_dictionary_;
+  int64_t batch_size_;
+  int64_t batch_memory_limit_;
 };
 
 class ColumnReader::ColumnReaderImpl {
@@ -294,6 +644,10 @@ class ColumnReader::ColumnReaderImpl {
   virtual ~ColumnReaderImpl() {}
   virtual Status NextBatch(int64_t records_to_read,
                            std::shared_ptr<ChunkedArray>* out) = 0;
+  // Read the records in rows, counted from the next record to read, skipping
+  // the others
+  virtual Status NextBatch(const std::vector<RowRange>& rows,
+                           std::shared_ptr<ChunkedArray>* out) = 0;
   virtual Status GetDefLevels(const int16_t** data, size_t* length) = 0;
   virtual Status GetRepLevels(const int16_t** data, size_t* length) = 0;
   virtual const std::shared_ptr<Field> field() = 0;
@@ -302,14 +656,36 @@ class ColumnReader::ColumnReaderImpl {
 // Reader implementation for primitive arrays
 class PARQUET_NO_EXPORT PrimitiveImpl : public ColumnReader::ColumnReaderImpl {
  public:
-  PrimitiveImpl(MemoryPool* pool, std::unique_ptr<FileColumnIterator> input)
-      : pool_(pool), input_(std::move(input)), descr_(input_->descr()) {
-    record_reader_ = RecordReader::Make(descr_, pool_);
+  // A nested leaf yields the values of the leaf column only, leaving the
+  // reassembly of its lists to NestedImpl
+  PrimitiveImpl(MemoryPool* pool, std::unique_ptr<FileColumnIterator> input,
+                bool read_dictionary = false, bool nested_leaf = false)
+      : pool_(pool),
+        input_(std::move(input)),
+        descr_(input_->descr()),
+        nested_leaf_(nested_leaf) {
     DCHECK(NodeToField(*input_->descr()->schema_node(), &field_).ok());
+    if (nested_leaf_ && descr_->schema_node()->is_repeated()) {
+      // A repeated primitive node is a list of its values
+      field_ = field_->type()->child(0);
+    }
+    // Only plain strings and binary can be dictionary-encoded
+    read_dictionary = read_dictionary &&
+                      descr_->physical_type() == ::parquet::Type::BYTE_ARRAY &&
+                      (field_->type()->id() == ::arrow::Type::STRING ||
+                       field_->type()->id() == ::arrow::Type::BINARY);
+    // Definition levels of a top-level column are only needed to build its
+    // validity bitmap. Children of a struct also provide them to their parent
+    const Node* parent = descr_->schema_node()->parent();
+    const bool levels_to_bitmap = parent != nullptr && parent->parent() == nullptr;
+    record_reader_ =
+        RecordReader::Make(descr_, pool_, read_dictionary, levels_to_bitmap);
     NextRowGroup();
   }
 
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override;
+  Status NextBatch(const std::vector<RowRange>& rows,
+                   std::shared_ptr<ChunkedArray>* out) override;
 
   template <typename ParquetType>
   Status WrapIntoListArray(Datum* inout_array);
@@ -319,18 +695,34 @@ class PARQUET_NO_EXPORT PrimitiveImpl : public ColumnReader::ColumnReaderImpl {
 
   const std::shared_ptr<Field> field() override { return field_; }
 
+  const ColumnDescriptor* descr() const { return descr_; }
+
+  // The levels of the records read by the last call to NextBatch
+  const int16_t* def_levels() const { return record_reader_->def_levels(); }
+  const int16_t* rep_levels() const { return record_reader_->rep_levels(); }
+  int64_t levels_read() const { return record_reader_->levels_position(); }
+
  private:
   void NextRowGroup();
+  void ReadRecords(int64_t records_to_read);
+  void SkipRecords(int64_t records_to_skip);
+  // Convert the records read into an array of the field's type
+  Status TransferBatch(std::shared_ptr<ChunkedArray>* out);
 
   MemoryPool* pool_;
   std::unique_ptr<FileColumnIterator> input_;
   const ColumnDescriptor* descr_;
+  bool nested_leaf_;
 
   std::shared_ptr<RecordReader> record_reader_;
 
   std::shared_ptr<Field> field_;
 };
 
+// Reads the same records from a child reader of a nested field
+using ReadChildFunc = std::function<Status(ColumnReader::ColumnReaderImpl* child,
+                                           std::shared_ptr<ChunkedArray>* out)>;
+
 // Reader implementation for struct array
 class PARQUET_NO_EXPORT StructImpl : public ColumnReader::ColumnReaderImpl {
  public:
@@ -341,11 +733,17 @@ class PARQUET_NO_EXPORT StructImpl : public ColumnReader::ColumnReaderImpl {
   }
 
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override;
+  Status NextBatch(const std::vector<RowRange>& rows,
+                   std::shared_ptr<ChunkedArray>* out) override;
   Status GetDefLevels(const int16_t** data, size_t* length) override;
   Status GetRepLevels(const int16_t** data, size_t* length) override;
   const std::shared_ptr<Field> field() override { return field_; }
 
  private:
+  // Assemble the struct from the batches read_child reads from the children
+  Status AssembleBatch(const ReadChildFunc& read_child,
+                       std::shared_ptr<ChunkedArray>* out);
+
   std::vector<std::shared_ptr<ColumnReaderImpl>> children_;
   int16_t struct_def_level_;
   MemoryPool* pool_;
@@ -357,6 +755,233 @@ class PARQUET_NO_EXPORT StructImpl : public ColumnReader::ColumnReaderImpl {
                  const std::vector<std::shared_ptr<ColumnReaderImpl>>& children);
 };
 
+// Reader implementation for nested fields holding both lists and structs,
+// such as lists of structs or structs of lists
+class PARQUET_NO_EXPORT NestedImpl : public ColumnReader::ColumnReaderImpl {
+ public:
+  NestedImpl(MemoryPool* pool, const std::shared_ptr<Field>& field,
+             std::vector<std::unique_ptr<PrimitiveImpl>> leaves)
+      : pool_(pool), field_(field), leaves_(std::move(leaves)) {}
+
+  Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override;
+  Status NextBatch(const std::vector<RowRange>& rows,
+                   std::shared_ptr<ChunkedArray>* out) override;
+
+  Status GetDefLevels(const int16_t** data, size_t* length) override {
+    return Status::NotImplemented("GetDefLevels is not implemented for nested fields");
+  }
+
+  Status GetRepLevels(const int16_t** data, size_t* length) override {
+    return Status::NotImplemented("GetRepLevels is not implemented for nested fields");
+  }
+
+  const std::shared_ptr<Field> field() override { return field_; }
+
+ private:
+  Status AssembleBatch(const ReadChildFunc& read_leaf,
+                       std::shared_ptr<ChunkedArray>* out);
+
+  MemoryPool* pool_;
+  std::shared_ptr<Field> field_;
+  std::vector<std::unique_ptr<PrimitiveImpl>> leaves_;
+};
+
+// Number of bytes of the buffers of data and its children
+int64_t ArrayDataSize(const ::arrow::ArrayData& data) {
+  int64_t size = 0;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      size += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    size += ArrayDataSize(*child);
+  }
+  return size;
+}
+
+// Streams the rows of a list of row groups as batches of at most
+// batch_size_ rows. Every column of a row group is read through its own
+// ColumnReaderImpl, which keeps decoding from where the previous batch
+// stopped. Columns read as several chunks yield several batches
+class FileReader::Impl::StreamingBatchReader : public RecordBatchReader {
+ public:
+  StreamingBatchReader(FileReader::Impl* impl, const std::vector<int>& row_groups,
+                       const std::vector<int>& indices, std::vector<int> field_indices,
+                       const std::shared_ptr<::arrow::Schema>& schema)
+      : impl_(impl),
+        row_groups_(row_groups),
+        indices_(indices),
+        field_indices_(std::move(field_indices)),
+        schema_(schema),
+        next_row_group_(0),
+        rows_left_(0),
+        bytes_per_row_(0) {}
+
+  std::shared_ptr<::arrow::Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<::arrow::RecordBatch>* out) override {
+    try {
+      while (pending_.empty()) {
+        if (rows_left_ == 0) {
+          if (next_row_group_ == row_groups_.size()) {
+            readers_.clear();
+            *out = nullptr;
+            return Status::OK();
+          }
+          RETURN_NOT_OK(NextRowGroup());
+          continue;
+        }
+        RETURN_NOT_OK(ReadBatch(BatchRows()));
+      }
+    } catch (const ::parquet::ParquetException& e) {
+      return Status::IOError(e.what());
+    }
+    *out = std::move(pending_.front());
+    pending_.pop_front();
+    return Status::OK();
+  }
+
+ private:
+  Status NextRowGroup() {
+    const int row_group_index = row_groups_[next_row_group_++];
+    auto metadata = impl_->reader_->metadata()->RowGroup(row_group_index);
+    rows_left_ = metadata->num_rows();
+
+    // Until a batch was read, estimate the size of a row from the column chunks
+    if (bytes_per_row_ == 0 && rows_left_ > 0) {
+      int64_t row_group_size = 0;
+      for (int column_index : indices_) {
+        row_group_size += metadata->ColumnChunk(column_index)->total_uncompressed_size();
+      }
+      bytes_per_row_ = std::max<int64_t>(1, row_group_size / rows_left_);
+    }
+
+    FileColumnIteratorFactory iterator_factory = [row_group_index](
+                                                     int i, ParquetFileReader* reader) {
+      return new SingleRowGroupIterator(i, row_group_index, reader);
+    };
+    const GroupNode* root = impl_->reader_->metadata()->schema()->group_node();
+    readers_.clear();
+    readers_.resize(field_indices_.size());
+    for (size_t i = 0; i < field_indices_.size(); ++i) {
+      RETURN_NOT_OK(impl_->GetReaderForNode(field_indices_[i],
+                                            root->field(field_indices_[i]).get(),
+                                            indices_, 1, iterator_factory, &readers_[i]));
+      DCHECK(readers_[i] != nullptr);
+    }
+    return Status::OK();
+  }
+
+  int64_t BatchRows() const {
+    int64_t num_rows = impl_->batch_size_ > 0 ? impl_->batch_size_ : rows_left_;
+    if (impl_->batch_memory_limit_ > 0) {
+      num_rows = std::min(num_rows, std::max<int64_t>(
+                                        1, impl_->batch_memory_limit_ / bytes_per_row_));
+    }
+    return std::min(num_rows, rows_left_);
+  }
+
+  Status ReadBatch(int64_t num_rows) {
+    const int num_fields = static_cast<int>(readers_.size());
+    std::vector<std::shared_ptr<ChunkedArray>> columns(num_fields);
+    auto ReadColumnFunc = [num_rows, &columns, this](int i) {
+      return readers_[i]->NextBatch(num_rows, &columns[i]);
+    };
+    if (impl_->use_threads_ && num_fields > 1) {
+      std::vector<std::future<Status>> futures;
+      auto pool = ::arrow::internal::GetCpuThreadPool();
+      for (int i = 0; i < num_fields; i++) {
+        futures.push_back(pool->Submit(ReadColumnFunc, i));
+      }
+      Status final_status = Status::OK();
+      for (auto& fut : futures) {
+        Status st = fut.get();
+        if (!st.ok()) {
+          final_status = std::move(st);
+        }
+      }
+      RETURN_NOT_OK(final_status);
+    } else {
+      for (int i = 0; i < num_fields; i++) {
+        RETURN_NOT_OK(ReadColumnFunc(i));
+      }
+    }
+
+    int64_t batch_size = 0;
+    std::vector<std::shared_ptr<Field>> fields(num_fields);
+    for (int i = 0; i < num_fields; ++i) {
+      if (columns[i]->length() != num_rows) {
+        return Status::IOError("Column ", schema_->field(i)->name(), " has ",
+                               columns[i]->length(), " rows left, expected ", num_rows);
+      }
+      fields[i] = FieldForData(schema_->field(i), *columns[i]);
+      for (const auto& chunk : columns[i]->chunks()) {
+        batch_size += ArrayDataSize(*chunk->data());
+      }
+    }
+    rows_left_ -= num_rows;
+    if (num_rows > 0) {
+      bytes_per_row_ = std::max<int64_t>(1, batch_size / num_rows);
+    }
+    auto schema = ::arrow::schema(std::move(fields), schema_->metadata());
+
+    // Cut the batch where any column starts a new chunk
+    std::vector<int> chunk_index(num_fields, 0);
+    std::vector<int64_t> chunk_offset(num_fields, 0);
+    int64_t position = 0;
+    while (position < num_rows) {
+      int64_t end = num_rows;
+      for (int i = 0; i < num_fields; ++i) {
+        while (chunk_offset[i] == columns[i]->chunk(chunk_index[i])->length()) {
+          ++chunk_index[i];
+          chunk_offset[i] = 0;
+        }
+        end = std::min(end, position + columns[i]->chunk(chunk_index[i])->length() -
+                                chunk_offset[i]);
+      }
+      std::vector<std::shared_ptr<Array>> arrays(num_fields);
+      for (int i = 0; i < num_fields; ++i) {
+        const auto& chunk = columns[i]->chunk(chunk_index[i]);
+        arrays[i] = chunk_offset[i] == 0 && chunk->length() == end - position
+                        ? chunk
+                        : chunk->Slice(chunk_offset[i], end - position);
+        chunk_offset[i] += end - position;
+      }
+      pending_.push_back(::arrow::RecordBatch::Make(schema, end - position, arrays));
+      position = end;
+    }
+    return Status::OK();
+  }
+
+  FileReader::Impl* impl_;
+  std::vector<int> row_groups_;
+  std::vector<int> indices_;
+  std::vector<int> field_indices_;
+  std::shared_ptr<::arrow::Schema> schema_;
+  size_t next_row_group_;
+  std::vector<std::unique_ptr<ColumnReader::ColumnReaderImpl>> readers_;
+  // Rows of the current row group not read yet
+  int64_t rows_left_;
+  // Decoded size of a row, for batch_memory_limit_
+  int64_t bytes_per_row_;
+  std::deque<std::shared_ptr<::arrow::RecordBatch>> pending_;
+};
+
+Status FileReader::Impl::GetStreamingBatchReader(
+    const std::vector<int>& row_groups, const std::vector<int>& indices,
+    const std::shared_ptr<::arrow::Schema>& schema,
+    std::shared_ptr<RecordBatchReader>* out) {
+  std::vector<int> field_indices;
+  if (!ColumnIndicesToFieldIndices(*reader_->metadata()->schema(), indices,
+                                   &field_indices)) {
+    return Status::Invalid("Invalid column index");
+  }
+  *out = std::make_shared<StreamingBatchReader>(this, row_groups, indices,
+                                                std::move(field_indices), schema);
+  return Status::OK();
+}
+
 FileReader::FileReader(MemoryPool* pool, std::unique_ptr<ParquetFileReader> reader)
     : impl_(new FileReader::Impl(pool, std::move(reader))) {}
 
@@ -367,7 +992,7 @@ Status FileReader::Impl::GetColumn(int i, FileColumnIteratorFactory iterator_fac
   std::unique_ptr<FileColumnIterator> input(iterator_factory(i, reader_.get()));
 
   std::unique_ptr<ColumnReader::ColumnReaderImpl> impl(
-      new PrimitiveImpl(pool_, std::move(input)));
+      new PrimitiveImpl(pool_, std::move(input), read_dictionary(i)));
   *out = std::unique_ptr<ColumnReader>(new ColumnReader(std::move(impl)));
   return Status::OK();
 }
@@ -378,6 +1003,35 @@ Status FileReader::Impl::GetReaderForNode(
     std::unique_ptr<ColumnReader::ColumnReaderImpl>* out) {
   *out = nullptr;
 
+  if (node->is_group()) {
+    // Lists of structs, structs of lists and deeper combinations are
+    // reassembled from all of their leaves at once
+    const SchemaDescriptor* schema = reader_->metadata()->schema();
+    std::vector<int> column_indices;
+    for (int column_index : indices) {
+      const Node* walker = schema->Column(column_index)->schema_node().get();
+      while (walker != nullptr && walker != node) {
+        walker = walker->parent();
+      }
+      if (walker != nullptr) {
+        column_indices.push_back(column_index);
+      }
+    }
+    if (column_indices.empty()) {
+      return Status::OK();
+    }
+    std::sort(column_indices.begin(), column_indices.end());
+    column_indices.erase(std::unique(column_indices.begin(), column_indices.end()),
+                         column_indices.end());
+
+    std::shared_ptr<::arrow::Schema> arrow_schema;
+    RETURN_NOT_OK(FromParquetSchema(schema, column_indices, &arrow_schema));
+    std::shared_ptr<Field> field = arrow_schema->field(0);
+    if (HasListsAndStructs(*field->type())) {
+      return GetNestedReader(field, column_indices, iterator_factory, out);
+    }
+  }
+
   if (IsSimpleStruct(node)) {
     const schema::GroupNode* group = static_cast<const schema::GroupNode*>(node);
     std::vector<std::shared_ptr<ColumnReader::ColumnReaderImpl>> children;
@@ -424,6 +1078,22 @@ Status FileReader::Impl::GetReaderForNode(
   return Status::OK();
 }
 
+Status FileReader::Impl::GetNestedReader(
+    const std::shared_ptr<Field>& field, const std::vector<int>& column_indices,
+    FileColumnIteratorFactory iterator_factory,
+    std::unique_ptr<ColumnReader::ColumnReaderImpl>* out) {
+  std::vector<std::unique_ptr<PrimitiveImpl>> leaves;
+  for (int column_index : column_indices) {
+    std::unique_ptr<FileColumnIterator> input(
+        iterator_factory(column_index, reader_.get()));
+    leaves.emplace_back(new PrimitiveImpl(pool_, std::move(input),
+                                          read_dictionary(column_index),
+                                          true /* nested_leaf */));
+  }
+  out->reset(new NestedImpl(pool_, field, std::move(leaves)));
+  return Status::OK();
+}
+
 Status FileReader::Impl::ReadSchemaField(int i, std::shared_ptr<ChunkedArray>* out) {
   std::vector<int> indices(reader_->metadata()->num_columns());
 
@@ -436,6 +1106,7 @@ Status FileReader::Impl::ReadSchemaField(int i, std::shared_ptr<ChunkedArray>* o
 
 Status FileReader::Impl::ReadSchemaField(int i, const std::vector<int>& indices,
                                          std::shared_ptr<ChunkedArray>* out) {
+  ARROW_TRACE_SPAN("parquet", "read_column");
   FileColumnIteratorFactory iterator_factory = [](int i, ParquetFileReader* reader) {
     return new AllRowGroupsIterator(i, reader);
   };
@@ -465,6 +1136,7 @@ Status FileReader::Impl::ReadSchemaField(int i, const std::vector<int>& indices,
 }
 
 Status FileReader::Impl::ReadColumn(int i, std::shared_ptr<ChunkedArray>* out) {
+  ARROW_TRACE_SPAN("parquet", "read_column");
   FileColumnIteratorFactory iterator_factory = [](int i, ParquetFileReader* reader) {
     return new AllRowGroupsIterator(i, reader);
   };
@@ -501,6 +1173,14 @@ Status FileReader::Impl::ReadColumnChunk(int column_index,
                                          const std::vector<int>& indices,
                                          int row_group_index,
                                          std::shared_ptr<ChunkedArray>* out) {
+  return ReadColumnChunk(column_index, indices, row_group_index, nullptr, out);
+}
+
+Status FileReader::Impl::ReadColumnChunk(int column_index,
+                                         const std::vector<int>& indices,
+                                         int row_group_index,
+                                         const std::vector<RowRange>* rows,
+                                         std::shared_ptr<ChunkedArray>* out) {
   auto rg_metadata = reader_->metadata()->RowGroup(row_group_index);
   int64_t records_to_read = rg_metadata->ColumnChunk(column_index)->num_values();
 
@@ -518,14 +1198,23 @@ Status FileReader::Impl::ReadColumnChunk(int column_index,
     *out = nullptr;
     return Status::OK();
   }
-  ColumnReader reader(std::move(reader_impl));
+  if (rows != nullptr) {
+    return reader_impl->NextBatch(*rows, out);
+  }
+  return reader_impl->NextBatch(records_to_read, out);
+}
 
-  return reader.NextBatch(records_to_read, out);
+Status FileReader::Impl::ReadRowGroup(int row_group_index,
+                                      const std::vector<int>& indices,
+                                      std::shared_ptr<Table>* out) {
+  return ReadRowGroup(row_group_index, indices, nullptr, out);
 }
 
 Status FileReader::Impl::ReadRowGroup(int row_group_index,
                                       const std::vector<int>& indices,
+                                      const std::vector<RowRange>* rows,
                                       std::shared_ptr<Table>* out) {
+  ARROW_TRACE_SPAN("parquet", "read_row_group");
   std::shared_ptr<::arrow::Schema> schema;
   RETURN_NOT_OK(GetSchema(indices, &schema));
 
@@ -543,11 +1232,25 @@ Status FileReader::Impl::ReadRowGroup(int row_group_index,
 
   // TODO(wesm): Refactor to share more code with ReadTable
 
-  auto ReadColumnFunc = [&indices, &field_indices, &row_group_index, &schema, &columns,
-                         this](int i) {
+  if (rows != nullptr) {
+    const int64_t num_rows = rg_metadata->num_rows();
+    int64_t end = 0;
+    for (const RowRange& range : *rows) {
+      if (range.offset < end || range.length < 0 ||
+          range.offset + range.length > num_rows) {
+        return Status::Invalid(
+            "Row ranges must be sorted, not overlap and lie within the row group");
+      }
+      end = range.offset + range.length;
+    }
+  }
+
+  auto ReadColumnFunc = [&indices, &field_indices, &row_group_index, rows, &schema,
+                         &columns, this](int i) {
     std::shared_ptr<ChunkedArray> array;
-    RETURN_NOT_OK(ReadColumnChunk(field_indices[i], indices, row_group_index, &array));
-    columns[i] = std::make_shared<Column>(schema->field(i), array);
+    RETURN_NOT_OK(
+        ReadColumnChunk(field_indices[i], indices, row_group_index, rows, &array));
+    columns[i] = std::make_shared<Column>(FieldForData(schema->field(i), *array), array);
     return Status::OK();
   };
 
@@ -571,12 +1274,47 @@ Status FileReader::Impl::ReadRowGroup(int row_group_index,
     }
   }
 
-  *out = Table::Make(schema, columns);
+  *out = Table::Make(SchemaForColumns(*schema, columns), columns);
   return Status::OK();
 }
 
+Status FileReader::Impl::ReadRowGroup(int row_group_index,
+                                      const std::vector<int>& filter_indices,
+                                      const RowFilter& filter,
+                                      const std::vector<int>& indices,
+                                      std::shared_ptr<Table>* out) {
+  std::shared_ptr<Table> filter_table;
+  RETURN_NOT_OK(ReadRowGroup(row_group_index, filter_indices, nullptr, &filter_table));
+
+  std::shared_ptr<Array> selection;
+  RETURN_NOT_OK(filter(*filter_table, &selection));
+  if (selection == nullptr || selection->type_id() != ::arrow::Type::BOOL ||
+      selection->length() != reader_->metadata()->RowGroup(row_group_index)->num_rows()) {
+    return Status::Invalid(
+        "Row filter must return a boolean array with one value per row");
+  }
+
+  std::vector<RowRange> rows;
+  RETURN_NOT_OK(SelectionToRowRanges(*selection, &rows));
+  return ReadRowGroup(row_group_index, indices, &rows, out);
+}
+
 Status FileReader::Impl::ReadTable(const std::vector<int>& indices,
                                    std::shared_ptr<Table>* out) {
+  ARROW_TRACE_SPAN("parquet", "read_table");
+  if (use_threads_ && num_row_groups() > 1) {
+    // Parallelizing over columns alone leaves cores idle on narrow tables
+    std::vector<int> row_groups(num_row_groups());
+    for (size_t i = 0; i < row_groups.size(); ++i) {
+      row_groups[i] = static_cast<int>(i);
+    }
+    std::shared_ptr<Table> table;
+    RETURN_NOT_OK(ReadRowGroups(row_groups, indices, &table));
+    RETURN_NOT_OK(table->Validate());
+    *out = table;
+    return Status::OK();
+  }
+
   std::shared_ptr<::arrow::Schema> schema;
   RETURN_NOT_OK(GetSchema(indices, &schema));
 
@@ -588,13 +1326,19 @@ Status FileReader::Impl::ReadTable(const std::vector<int>& indices,
     return Status::Invalid("Invalid column index");
   }
 
+  std::vector<int> row_groups(num_row_groups());
+  for (size_t i = 0; i < row_groups.size(); ++i) {
+    row_groups[i] = static_cast<int>(i);
+  }
+  reader_->PreBuffer(row_groups, indices);
+
   int num_fields = static_cast<int>(field_indices.size());
   std::vector<std::shared_ptr<Column>> columns(num_fields);
 
   auto ReadColumnFunc = [&indices, &field_indices, &schema, &columns, this](int i) {
     std::shared_ptr<ChunkedArray> array;
     RETURN_NOT_OK(ReadSchemaField(field_indices[i], indices, &array));
-    columns[i] = std::make_shared<Column>(schema->field(i), array);
+    columns[i] = std::make_shared<Column>(FieldForData(schema->field(i), *array), array);
     return Status::OK();
   };
 
@@ -618,7 +1362,7 @@ Status FileReader::Impl::ReadTable(const std::vector<int>& indices,
     }
   }
 
-  std::shared_ptr<Table> table = Table::Make(schema, columns);
+  std::shared_ptr<Table> table = Table::Make(SchemaForColumns(*schema, columns), columns);
   RETURN_NOT_OK(table->Validate());
   *out = table;
   return Status::OK();
@@ -638,12 +1382,71 @@ Status FileReader::Impl::ReadRowGroups(const std::vector<int>& row_groups,
                                        std::shared_ptr<Table>* table) {
   std::vector<std::shared_ptr<Table>> tables(row_groups.size(), nullptr);
 
-  for (size_t i = 0; i < row_groups.size(); ++i) {
-    RETURN_NOT_OK(ReadRowGroup(row_groups[i], indices, &tables[i]));
+  // No-op unless pre-buffering is enabled in the reader properties
+  reader_->PreBuffer(row_groups, indices);
+  if (use_threads_ && row_groups.size() > 1) {
+    RETURN_NOT_OK(ReadRowGroupsParallel(row_groups, indices, &tables));
+  } else {
+    for (size_t i = 0; i < row_groups.size(); ++i) {
+      RETURN_NOT_OK(ReadRowGroup(row_groups[i], indices, &tables[i]));
+    }
   }
+  RETURN_NOT_OK(UnifyDictionaryColumns(pool_, &tables));
   return ConcatenateTables(tables, table);
 }
 
+Status FileReader::Impl::ReadRowGroupsParallel(
+    const std::vector<int>& row_groups, const std::vector<int>& indices,
+    std::vector<std::shared_ptr<Table>>* tables) {
+  std::shared_ptr<::arrow::Schema> schema;
+  RETURN_NOT_OK(GetSchema(indices, &schema));
+
+  std::vector<int> field_indices;
+  if (!ColumnIndicesToFieldIndices(*reader_->metadata()->schema(), indices,
+                                   &field_indices)) {
+    return Status::Invalid("Invalid column index");
+  }
+  const int num_fields = static_cast<int>(field_indices.size());
+  const int num_tasks = static_cast<int>(row_groups.size()) * num_fields;
+
+  // Every column chunk is decoded independently, so that the number of
+  // tasks doesn't depend on the schema width. Task i reads field
+  // i % num_fields of row group i / num_fields
+  std::vector<std::shared_ptr<Column>> columns(num_tasks);
+  auto ReadChunkFunc = [&row_groups, &indices, &field_indices, &schema, &columns,
+                        num_fields, this](int i) {
+    const int field = i % num_fields;
+    std::shared_ptr<ChunkedArray> array;
+    RETURN_NOT_OK(ReadColumnChunk(field_indices[field], indices,
+                                  row_groups[i / num_fields], &array));
+    columns[i] =
+        std::make_shared<Column>(FieldForData(schema->field(field), *array), array);
+    return Status::OK();
+  };
+
+  std::vector<std::future<Status>> futures;
+  auto pool = ::arrow::internal::GetCpuThreadPool();
+  for (int i = 0; i < num_tasks; i++) {
+    futures.push_back(pool->Submit(ReadChunkFunc, i));
+  }
+  Status final_status = Status::OK();
+  for (auto& fut : futures) {
+    Status st = fut.get();
+    if (!st.ok()) {
+      final_status = std::move(st);
+    }
+  }
+  RETURN_NOT_OK(final_status);
+
+  for (size_t i = 0; i < row_groups.size(); ++i) {
+    std::vector<std::shared_ptr<Column>> row_group_columns(
+        columns.begin() + i * num_fields, columns.begin() + (i + 1) * num_fields);
+    (*tables)[i] =
+        Table::Make(SchemaForColumns(*schema, row_group_columns), row_group_columns);
+  }
+  return Status::OK();
+}
+
 Status FileReader::Impl::ReadRowGroups(const std::vector<int>& row_groups,
                                        std::shared_ptr<Table>* table) {
   std::vector<int> indices(reader_->metadata()->num_columns());
@@ -654,6 +1457,52 @@ Status FileReader::Impl::ReadRowGroups(const std::vector<int>& row_groups,
   return ReadRowGroups(row_groups, indices, table);
 }
 
+Status FileReader::Impl::ReadTable(const std::vector<int>& indices,
+                                   const RowGroupPredicate& predicate,
+                                   std::shared_ptr<Table>* out) {
+  std::vector<int> all_row_groups(num_row_groups());
+  for (size_t i = 0; i < all_row_groups.size(); ++i) {
+    all_row_groups[i] = static_cast<int>(i);
+  }
+  std::vector<int> row_groups;
+  RETURN_NOT_OK(FilterRowGroups(all_row_groups, predicate, &row_groups));
+
+  if (row_groups.size() == all_row_groups.size()) {
+    // Nothing to skip, read whole columns at once
+    return ReadTable(indices, out);
+  }
+  if (!row_groups.empty()) {
+    return ReadRowGroups(row_groups, indices, out);
+  }
+
+  std::shared_ptr<::arrow::Schema> schema;
+  RETURN_NOT_OK(GetSchema(indices, &schema));
+  std::vector<std::shared_ptr<Column>> columns(schema->num_fields());
+  for (int i = 0; i < schema->num_fields(); ++i) {
+    auto array = std::make_shared<ChunkedArray>(::arrow::ArrayVector{},
+                                                schema->field(i)->type());
+    columns[i] = std::make_shared<Column>(schema->field(i), array);
+  }
+  *out = Table::Make(schema, columns, 0);
+  return Status::OK();
+}
+
+Status FileReader::Impl::FilterRowGroups(const std::vector<int>& row_groups,
+                                         const RowGroupPredicate& predicate,
+                                         std::vector<int>* out) {
+  out->clear();
+  for (int row_group_index : row_groups) {
+    std::shared_ptr<::parquet::RowGroupReader> row_group;
+    PARQUET_CATCH_NOT_OK(row_group = reader_->RowGroup(row_group_index));
+    bool may_match = true;
+    RETURN_NOT_OK(predicate.MayMatch(row_group.get(), &may_match));
+    if (may_match) {
+      out->push_back(row_group_index);
+    }
+  }
+  return Status::OK();
+}
+
 Status FileReader::Impl::ReadRowGroup(int i, std::shared_ptr<Table>* table) {
   std::vector<int> indices(reader_->metadata()->num_columns());
 
@@ -663,6 +1512,37 @@ Status FileReader::Impl::ReadRowGroup(int i, std::shared_ptr<Table>* table) {
   return ReadRowGroup(i, indices, table);
 }
 
+Status SelectionToRowRanges(const Array& selection, std::vector<RowRange>* out) {
+  if (selection.type_id() != ::arrow::Type::BOOL) {
+    return Status::TypeError("Row selection must be boolean, got ",
+                             selection.type()->ToString());
+  }
+  out->clear();
+  const auto& values = static_cast<const BooleanArray&>(selection);
+  const int64_t length = values.length();
+  const uint8_t* null_bitmap = values.null_bitmap_data();
+  ::arrow::internal::BitmapReader value_reader(values.values()->data(),
+                                               values.offset(), length);
+  int64_t range_start = -1;
+  for (int64_t i = 0; i < length; ++i) {
+    const bool selected =
+        value_reader.IsSet() &&
+        (null_bitmap == nullptr ||
+         ::arrow::BitUtil::GetBit(null_bitmap, values.offset() + i));
+    value_reader.Next();
+    if (selected && range_start < 0) {
+      range_start = i;
+    } else if (!selected && range_start >= 0) {
+      out->push_back({range_start, i - range_start});
+      range_start = -1;
+    }
+  }
+  if (range_start >= 0) {
+    out->push_back({range_start, length - range_start});
+  }
+  return Status::OK();
+}
+
 // Static ctor
 Status OpenFile(const std::shared_ptr<::arrow::io::ReadableFileInterface>& file,
                 MemoryPool* allocator, const ReaderProperties& props,
@@ -682,6 +1562,52 @@ Status OpenFile(const std::shared_ptr<::arrow::io::ReadableFileInterface>& file,
                   reader);
 }
 
+Status PlanDatasetScan(const FileMetaData& summary, const RowGroupPredicate* predicate,
+                       std::vector<DatasetFileScan>* out) {
+  out->clear();
+  // The row groups of each file in the summary, and which of them to read
+  std::vector<std::vector<int>> file_row_groups;
+  std::vector<std::vector<int>> file_selected_row_groups;
+  std::unordered_map<std::string, size_t> file_indices;
+  std::vector<std::string> paths;
+  for (int i = 0; i < summary.num_row_groups(); ++i) {
+    std::unique_ptr<RowGroupMetaData> row_group;
+    std::string path;
+    PARQUET_CATCH_NOT_OK(row_group = summary.RowGroup(i));
+    if (row_group->num_columns() > 0) {
+      PARQUET_CATCH_NOT_OK(path = row_group->ColumnChunk(0)->file_path());
+    }
+    auto it = file_indices.find(path);
+    if (it == file_indices.end()) {
+      it = file_indices.emplace(path, paths.size()).first;
+      paths.push_back(path);
+      file_row_groups.emplace_back();
+      file_selected_row_groups.emplace_back();
+    }
+    bool may_match = true;
+    if (predicate != nullptr) {
+      RETURN_NOT_OK(predicate->MayMatch(*row_group, &may_match));
+    }
+    if (may_match) {
+      file_selected_row_groups[it->second].push_back(
+          static_cast<int>(file_row_groups[it->second].size()));
+    }
+    file_row_groups[it->second].push_back(i);
+  }
+
+  for (size_t i = 0; i < paths.size(); ++i) {
+    if (file_selected_row_groups[i].empty()) {
+      continue;
+    }
+    DatasetFileScan scan;
+    scan.path = paths[i];
+    PARQUET_CATCH_NOT_OK(scan.metadata = summary.Subset(file_row_groups[i]));
+    scan.row_groups = std::move(file_selected_row_groups[i]);
+    out->push_back(std::move(scan));
+  }
+  return Status::OK();
+}
+
 Status FileReader::GetColumn(int i, std::unique_ptr<ColumnReader>* out) {
   FileColumnIteratorFactory iterator_factory = [](int i, ParquetFileReader* reader) {
     return new AllRowGroupsIterator(i, reader);
@@ -749,11 +1675,51 @@ Status FileReader::GetRecordBatchReader(const std::vector<int>& row_group_indice
     }
   }
 
+  PARQUET_CATCH_NOT_OK(impl_->reader()->PreBuffer(row_group_indices, column_indices));
+  if (impl_->streams_batches()) {
+    return impl_->GetStreamingBatchReader(row_group_indices, column_indices, schema,
+                                          out);
+  }
   *out = std::make_shared<RowGroupRecordBatchReader>(row_group_indices, column_indices,
                                                      schema, this);
   return Status::OK();
 }
 
+Status FileReader::GetRecordBatchReader(const std::vector<int>& row_group_indices,
+                                        const std::vector<int>& column_indices,
+                                        const RowGroupPredicate& predicate,
+                                        std::shared_ptr<RecordBatchReader>* out) {
+  std::vector<int> selected_row_groups;
+  RETURN_NOT_OK(FilterRowGroups(row_group_indices, predicate, &selected_row_groups));
+  return GetRecordBatchReader(selected_row_groups, column_indices, out);
+}
+
+Status FileReader::FilterRowGroups(const RowGroupPredicate& predicate,
+                                   std::vector<int>* row_group_indices) {
+  std::vector<int> all_row_groups(num_row_groups());
+  for (size_t i = 0; i < all_row_groups.size(); ++i) {
+    all_row_groups[i] = static_cast<int>(i);
+  }
+  return FilterRowGroups(all_row_groups, predicate, row_group_indices);
+}
+
+Status FileReader::FilterRowGroups(const std::vector<int>& row_group_indices,
+                                   const RowGroupPredicate& predicate,
+                                   std::vector<int>* out) {
+  int max_num = num_row_groups();
+  for (auto row_group_index : row_group_indices) {
+    if (row_group_index < 0 || row_group_index >= max_num) {
+      return Status::Invalid("Some index in row_group_indices is ", row_group_index,
+                             ", which is either < 0 or >= num_row_groups(", max_num, ")");
+    }
+  }
+  try {
+    return impl_->FilterRowGroups(row_group_indices, predicate, out);
+  } catch (const ::parquet::ParquetException& e) {
+    return ::arrow::Status::IOError(e.what());
+  }
+}
+
 Status FileReader::ReadTable(std::shared_ptr<Table>* out) {
   try {
     return impl_->ReadTable(out);
@@ -771,6 +1737,16 @@ Status FileReader::ReadTable(const std::vector<int>& indices,
   }
 }
 
+Status FileReader::ReadTable(const std::vector<int>& indices,
+                             const RowGroupPredicate& predicate,
+                             std::shared_ptr<Table>* out) {
+  try {
+    return impl_->ReadTable(indices, predicate, out);
+  } catch (const ::parquet::ParquetException& e) {
+    return ::arrow::Status::IOError(e.what());
+  }
+}
+
 Status FileReader::ReadRowGroup(int i, std::shared_ptr<Table>* out) {
   try {
     return impl_->ReadRowGroup(i, out);
@@ -788,6 +1764,26 @@ Status FileReader::ReadRowGroup(int i, const std::vector<int>& indices,
   }
 }
 
+Status FileReader::ReadRowGroup(int i, const std::vector<int>& indices,
+                                const std::vector<RowRange>& rows,
+                                std::shared_ptr<Table>* out) {
+  try {
+    return impl_->ReadRowGroup(i, indices, &rows, out);
+  } catch (const ::parquet::ParquetException& e) {
+    return ::arrow::Status::IOError(e.what());
+  }
+}
+
+Status FileReader::ReadRowGroup(int i, const std::vector<int>& filter_indices,
+                                const RowFilter& filter, const std::vector<int>& indices,
+                                std::shared_ptr<Table>* out) {
+  try {
+    return impl_->ReadRowGroup(i, filter_indices, filter, indices, out);
+  } catch (const ::parquet::ParquetException& e) {
+    return ::arrow::Status::IOError(e.what());
+  }
+}
+
 Status FileReader::ReadRowGroups(const std::vector<int>& row_groups,
                                  std::shared_ptr<Table>* out) {
   try {
@@ -820,6 +1816,22 @@ void FileReader::set_use_threads(bool use_threads) {
   impl_->set_use_threads(use_threads);
 }
 
+void FileReader::set_read_dictionary(bool read_dictionary) {
+  impl_->set_read_dictionary(read_dictionary);
+}
+
+void FileReader::set_read_dictionary(int column_index, bool read_dictionary) {
+  impl_->set_read_dictionary(column_index, read_dictionary);
+}
+
+void FileReader::set_batch_size(int64_t batch_size) {
+  impl_->set_batch_size(batch_size);
+}
+
+void FileReader::set_batch_memory_limit(int64_t memory_limit) {
+  impl_->set_batch_memory_limit(memory_limit);
+}
+
 Status FileReader::ScanContents(std::vector<int> columns, const int32_t column_batch_size,
                                 int64_t* num_rows) {
   try {
@@ -836,7 +1848,7 @@ const ParquetFileReader* FileReader::parquet_reader() const {
 
 template <typename ParquetType>
 Status PrimitiveImpl::WrapIntoListArray(Datum* inout_array) {
-  if (descr_->max_repetition_level() == 0) {
+  if (descr_->max_repetition_level() == 0 || nested_leaf_) {
     // Flat, no action
     return Status::OK();
   }
@@ -869,8 +1881,6 @@ Status PrimitiveImpl::WrapIntoListArray(Datum* inout_array) {
 
   // Walk downwards to extract nullability
   std::vector<bool> nullable;
-  std::vector<std::shared_ptr<::arrow::Int32Builder>> offset_builders;
-  std::vector<std::shared_ptr<::arrow::BooleanBuilder>> valid_bits_builders;
   nullable.push_back(current_field->nullable());
   while (current_field->type()->num_children() > 0) {
     if (current_field->type()->num_children() > 1) {
@@ -881,14 +1891,10 @@ Status PrimitiveImpl::WrapIntoListArray(Datum* inout_array) {
       }
       current_field = current_field->type()->child(0);
     }
-    offset_builders.emplace_back(
-        std::make_shared<::arrow::Int32Builder>(::arrow::int32(), pool_));
-    valid_bits_builders.emplace_back(
-        std::make_shared<::arrow::BooleanBuilder>(::arrow::boolean(), pool_));
     nullable.push_back(current_field->nullable());
   }
 
-  int64_t list_depth = offset_builders.size();
+  const int64_t list_depth = static_cast<int64_t>(nullable.size()) - 1;
   // This describes the minimal definition that describes a level that
   // reflects a value in the primitive values array.
   int16_t values_def_level = descr_->max_definition_level();
@@ -908,25 +1914,40 @@ Status PrimitiveImpl::WrapIntoListArray(Datum* inout_array) {
     def_level++;
   }
 
+  // Each level starts at most one list per depth: the offsets and validity
+  // bitmaps of all depths are written in a single pass over the levels
+  std::vector<std::shared_ptr<ResizableBuffer>> offsets(list_depth);
+  std::vector<std::shared_ptr<Buffer>> valid_bits(list_depth);
+  std::vector<int32_t*> offsets_data(list_depth);
+  std::vector<uint8_t*> valid_bits_data(list_depth);
+  for (int64_t j = 0; j < list_depth; j++) {
+    RETURN_NOT_OK(::arrow::AllocateResizableBuffer(
+        pool_, (total_levels_read + 1) * sizeof(int32_t), &offsets[j]));
+    RETURN_NOT_OK(AllocateEmptyBitmap(pool_, total_levels_read, &valid_bits[j]));
+    offsets_data[j] = reinterpret_cast<int32_t*>(offsets[j]->mutable_data());
+    valid_bits_data[j] = valid_bits[j]->mutable_data();
+  }
+
   int32_t values_offset = 0;
+  std::vector<int64_t> list_lengths(list_depth, 0);
   std::vector<int64_t> null_counts(list_depth, 0);
   for (int64_t i = 0; i < total_levels_read; i++) {
     int16_t rep_level = rep_levels[i];
     if (rep_level < descr_->max_repetition_level()) {
       for (int64_t j = rep_level; j < list_depth; j++) {
         if (j == (list_depth - 1)) {
-          RETURN_NOT_OK(offset_builders[j]->Append(values_offset));
+          offsets_data[j][list_lengths[j]] = values_offset;
         } else {
-          RETURN_NOT_OK(offset_builders[j]->Append(
-              static_cast<int32_t>(offset_builders[j + 1]->length())));
+          offsets_data[j][list_lengths[j]] = static_cast<int32_t>(list_lengths[j + 1]);
         }
 
         if (((empty_def_level[j] - 1) == def_levels[i]) && (nullable[j])) {
-          RETURN_NOT_OK(valid_bits_builders[j]->Append(false));
+          list_lengths[j]++;
           null_counts[j]++;
           break;
         } else {
-          RETURN_NOT_OK(valid_bits_builders[j]->Append(true));
+          ::arrow::BitUtil::SetBit(valid_bits_data[j], list_lengths[j]);
+          list_lengths[j]++;
           if (empty_def_level[j] == def_levels[i]) {
             break;
           }
@@ -940,31 +1961,20 @@ Status PrimitiveImpl::WrapIntoListArray(Datum* inout_array) {
   // Add the final offset to all lists
   for (int64_t j = 0; j < list_depth; j++) {
     if (j == (list_depth - 1)) {
-      RETURN_NOT_OK(offset_builders[j]->Append(values_offset));
+      offsets_data[j][list_lengths[j]] = values_offset;
     } else {
-      RETURN_NOT_OK(offset_builders[j]->Append(
-          static_cast<int32_t>(offset_builders[j + 1]->length())));
+      offsets_data[j][list_lengths[j]] = static_cast<int32_t>(list_lengths[j + 1]);
     }
-  }
-
-  std::vector<std::shared_ptr<Buffer>> offsets;
-  std::vector<std::shared_ptr<Buffer>> valid_bits;
-  std::vector<int64_t> list_lengths;
-  for (int64_t j = 0; j < list_depth; j++) {
-    list_lengths.push_back(offset_builders[j]->length() - 1);
-    std::shared_ptr<Array> array;
-    RETURN_NOT_OK(offset_builders[j]->Finish(&array));
-    offsets.emplace_back(std::static_pointer_cast<Int32Array>(array)->values());
-    RETURN_NOT_OK(valid_bits_builders[j]->Finish(&array));
-    valid_bits.emplace_back(std::static_pointer_cast<BooleanArray>(array)->values());
+    RETURN_NOT_OK(offsets[j]->Resize((list_lengths[j] + 1) * sizeof(int32_t)));
   }
 
   std::shared_ptr<Array> output = flat_array;
   for (int64_t j = list_depth - 1; j >= 0; j--) {
     auto list_type =
         ::arrow::list(::arrow::field("item", output->type(), nullable[j + 1]));
-    output = std::make_shared<::arrow::ListArray>(list_type, list_lengths[j], offsets[j],
-                                                  output, valid_bits[j], null_counts[j]);
+    output = std::make_shared<::arrow::ListArray>(
+        list_type, list_lengths[j], offsets[j], output,
+        null_counts[j] > 0 ? valid_bits[j] : nullptr, null_counts[j]);
   }
   *inout_array = output;
   return Status::OK();
@@ -1126,6 +2136,18 @@ struct TransferFunctor<::arrow::Date64Type, Int32Type> {
   }
 };
 
+// The type of the dictionary-encoded binary dict_type, with its dictionary
+// values retyped to value_type
+static std::shared_ptr<::arrow::DataType> StringDictionaryType(
+    const ::arrow::DataType& dict_type,
+    const std::shared_ptr<::arrow::DataType>& value_type) {
+  const auto& binary_dict_type = static_cast<const ::arrow::DictionaryType&>(dict_type);
+  auto dict_data = binary_dict_type.dictionary()->data()->Copy();
+  dict_data->type = value_type;
+  return ::arrow::dictionary(binary_dict_type.index_type(), ::arrow::MakeArray(dict_data),
+                             binary_dict_type.ordered());
+}
+
 template <typename ArrowType, typename ParquetType>
 struct TransferFunctor<
     ArrowType, ParquetType,
@@ -1140,9 +2162,19 @@ struct TransferFunctor<
 
     if (type->id() == ::arrow::Type::STRING) {
       // Convert from BINARY type to STRING
+      std::shared_ptr<::arrow::DataType> binary_dict_type, string_dict_type;
       for (size_t i = 0; i < chunks.size(); ++i) {
         auto new_data = chunks[i]->data()->Copy();
-        new_data->type = type;
+        if (chunks[i]->type_id() == ::arrow::Type::DICTIONARY) {
+          // Dictionary chunks usually share their type
+          if (chunks[i]->type() != binary_dict_type) {
+            binary_dict_type = chunks[i]->type();
+            string_dict_type = StringDictionaryType(*binary_dict_type, type);
+          }
+          new_data->type = string_dict_type;
+        } else {
+          new_data->type = type;
+        }
         chunks[i] = ::arrow::MakeArray(new_data);
       }
     }
@@ -1480,6 +2512,32 @@ struct TransferFunctor<::arrow::Decimal128Type, Int64Type> {
     TRANSFER_DATA(ArrowType, ParquetType);          \
   } break;
 
+void PrimitiveImpl::ReadRecords(int64_t records_to_read) {
+  while (records_to_read > 0) {
+    if (!record_reader_->HasMoreData()) {
+      break;
+    }
+    int64_t records_read = record_reader_->ReadRecords(records_to_read);
+    records_to_read -= records_read;
+    if (records_read == 0) {
+      NextRowGroup();
+    }
+  }
+}
+
+void PrimitiveImpl::SkipRecords(int64_t records_to_skip) {
+  while (records_to_skip > 0) {
+    if (!record_reader_->HasMoreData()) {
+      break;
+    }
+    int64_t records_skipped = record_reader_->SkipRecords(records_to_skip);
+    records_to_skip -= records_skipped;
+    if (records_skipped == 0) {
+      NextRowGroup();
+    }
+  }
+}
+
 Status PrimitiveImpl::NextBatch(int64_t records_to_read,
                                 std::shared_ptr<ChunkedArray>* out) {
   try {
@@ -1487,20 +2545,36 @@ Status PrimitiveImpl::NextBatch(int64_t records_to_read,
     record_reader_->Reserve(records_to_read);
 
     record_reader_->Reset();
-    while (records_to_read > 0) {
-      if (!record_reader_->HasMoreData()) {
-        break;
-      }
-      int64_t records_read = record_reader_->ReadRecords(records_to_read);
-      records_to_read -= records_read;
-      if (records_read == 0) {
-        NextRowGroup();
-      }
+    ReadRecords(records_to_read);
+  } catch (const ::parquet::ParquetException& e) {
+    return ::arrow::Status::IOError(e.what());
+  }
+  return TransferBatch(out);
+}
+
+Status PrimitiveImpl::NextBatch(const std::vector<RowRange>& rows,
+                                std::shared_ptr<ChunkedArray>* out) {
+  try {
+    int64_t records_to_read = 0;
+    for (const RowRange& range : rows) {
+      records_to_read += range.length;
+    }
+    record_reader_->Reserve(records_to_read);
+
+    record_reader_->Reset();
+    int64_t position = 0;
+    for (const RowRange& range : rows) {
+      SkipRecords(range.offset - position);
+      ReadRecords(range.length);
+      position = range.offset + range.length;
     }
   } catch (const ::parquet::ParquetException& e) {
     return ::arrow::Status::IOError(e.what());
   }
+  return TransferBatch(out);
+}
 
+Status PrimitiveImpl::TransferBatch(std::shared_ptr<ChunkedArray>* out) {
   Datum result;
   switch (field_->type()->id()) {
     TRANSFER_CASE(BOOL, ::arrow::BooleanType, BooleanType)
@@ -1611,6 +2685,69 @@ Status ColumnReader::NextBatch(int64_t records_to_read, std::shared_ptr<Array>*
   return GetSingleChunk(*chunked_out, out);
 }
 
+// NestedImpl methods
+
+Status NestedImpl::NextBatch(int64_t records_to_read,
+                             std::shared_ptr<ChunkedArray>* out) {
+  return AssembleBatch(
+      [records_to_read](ColumnReaderImpl* leaf, std::shared_ptr<ChunkedArray>* values) {
+        return leaf->NextBatch(records_to_read, values);
+      },
+      out);
+}
+
+Status NestedImpl::NextBatch(const std::vector<RowRange>& rows,
+                             std::shared_ptr<ChunkedArray>* out) {
+  return AssembleBatch(
+      [&rows](ColumnReaderImpl* leaf, std::shared_ptr<ChunkedArray>* values) {
+        return leaf->NextBatch(rows, values);
+      },
+      out);
+}
+
+Status NestedImpl::AssembleBatch(const ReadChildFunc& read_leaf,
+                                 std::shared_ptr<ChunkedArray>* out) {
+  std::vector<NestedLeaf> leaves(leaves_.size());
+  for (size_t i = 0; i < leaves_.size(); ++i) {
+    PrimitiveImpl* reader = leaves_[i].get();
+    std::shared_ptr<ChunkedArray> values;
+    RETURN_NOT_OK(read_leaf(reader, &values));
+    if (values->num_chunks() != 1) {
+      return Status::NotImplemented(
+          "Nested data conversions not implemented for "
+          "chunked array outputs");
+    }
+
+    const ColumnDescriptor* descr = reader->descr();
+    NestedLeaf& leaf = leaves[i];
+    leaf.values = values->chunk(0);
+    if (descr->max_definition_level() > 0) {
+      leaf.def_levels = reader->def_levels();
+      leaf.num_levels = reader->levels_read();
+    } else {
+      leaf.def_levels = nullptr;
+      leaf.num_levels = leaf.values->length();
+    }
+    if (descr->max_repetition_level() > 0) {
+      leaf.rep_levels = reader->rep_levels();
+      // Within lists, the leaf has slots for its own nulls only
+      leaf.values_def_level = descr->max_definition_level();
+      if (descr->schema_node()->is_optional()) {
+        leaf.values_def_level--;
+      }
+    } else {
+      leaf.rep_levels = nullptr;
+      leaf.values_def_level = 0;
+    }
+  }
+
+  std::shared_ptr<Array> result;
+  NestedArrayBuilder builder(pool_, leaves);
+  RETURN_NOT_OK(builder.Build(*field_, &result));
+  *out = std::make_shared<ChunkedArray>(result);
+  return Status::OK();
+}
+
 // StructImpl methods
 
 Status StructImpl::DefLevelsToNullArray(std::shared_ptr<Buffer>* null_bitmap_out,
@@ -1697,6 +2834,24 @@ Status StructImpl::GetRepLevels(const int16_t** data, size_t* length) {
 
 Status StructImpl::NextBatch(int64_t records_to_read,
                              std::shared_ptr<ChunkedArray>* out) {
+  return AssembleBatch(
+      [records_to_read](ColumnReaderImpl* child, std::shared_ptr<ChunkedArray>* field) {
+        return child->NextBatch(records_to_read, field);
+      },
+      out);
+}
+
+Status StructImpl::NextBatch(const std::vector<RowRange>& rows,
+                             std::shared_ptr<ChunkedArray>* out) {
+  return AssembleBatch(
+      [&rows](ColumnReaderImpl* child, std::shared_ptr<ChunkedArray>* field) {
+        return child->NextBatch(rows, field);
+      },
+      out);
+}
+
+Status StructImpl::AssembleBatch(const ReadChildFunc& read_child,
+                                 std::shared_ptr<ChunkedArray>* out) {
   std::vector<std::shared_ptr<Array>> children_arrays;
   std::shared_ptr<Buffer> null_bitmap;
   int64_t null_count;
@@ -1704,7 +2859,7 @@ Status StructImpl::NextBatch(int64_t records_to_read,
   // Gather children arrays and def levels
   for (auto& child : children_) {
     std::shared_ptr<ChunkedArray> field;
-    RETURN_NOT_OK(child->NextBatch(records_to_read, &field));
+    RETURN_NOT_OK(read_child(child.get(), &field));
 
     if (field->num_chunks() > 1) {
       return Status::Invalid("Chunked field reads not yet supported with StructArray");
@@ -1723,8 +2878,15 @@ Status StructImpl::NextBatch(int64_t records_to_read,
     }
   }
 
-  auto result = std::make_shared<StructArray>(field()->type(), struct_length,
-                                              children_arrays, null_bitmap, null_count);
+  // The children types may differ from the fields' when reading dictionaries
+  std::vector<std::shared_ptr<Field>> fields(children_arrays.size());
+  for (size_t i = 0; i < children_arrays.size(); ++i) {
+    fields[i] = field()->type()->child(static_cast<int>(i))->WithType(
+        children_arrays[i]->type());
+  }
+  auto result =
+      std::make_shared<StructArray>(::arrow::struct_(fields), struct_length,
+                                    children_arrays, null_bitmap, null_count);
   *out = std::make_shared<ChunkedArray>(result);
   return Status::OK();
 }
@@ -19,7 +19,9 @@
 #define PARQUET_ARROW_READER_H
 
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "parquet/util/visibility.h"
@@ -49,8 +51,35 @@ namespace arrow {
 
 class ColumnChunkReader;
 class ColumnReader;
+class RowGroupPredicate;
 class RowGroupReader;
 
+/// \brief length consecutive rows starting at row offset
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+struct PARQUET_EXPORT RowRange {
+  int64_t offset;
+  int64_t length;
+};
+
+/// \brief Compute the ranges of the rows selected by a boolean array, in
+/// increasing order. Null slots are not selected
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+PARQUET_EXPORT
+::arrow::Status SelectionToRowRanges(const ::arrow::Array& selection,
+                                     std::vector<RowRange>* out);
+
+/// \brief Selects rows from the columns read for it, given as a table, by
+/// returning a boolean array of the table's length
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+using RowFilter = std::function<::arrow::Status(const ::arrow::Table& columns,
+                                                std::shared_ptr<::arrow::Array>* out)>;
+
 // Arrow read adapter class for deserializing Parquet files as Arrow row
 // batches.
 //
@@ -165,6 +194,34 @@ class PARQUET_EXPORT FileReader {
                                        const std::vector<int>& column_indices,
                                        std::shared_ptr<::arrow::RecordBatchReader>* out);
 
+  /// \brief Return a RecordBatchReader of the row groups selected from
+  ///     row_group_indices whose statistics do not rule out predicate (see
+  ///     FilterRowGroups), with columns selected by column_indices.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  ::arrow::Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
+                                       const std::vector<int>& column_indices,
+                                       const RowGroupPredicate& predicate,
+                                       std::shared_ptr<::arrow::RecordBatchReader>* out);
+
+  /// \brief Return the indices of the row groups whose statistics do not rule
+  ///     out predicate, in file order. Skipped row groups are never read.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  ::arrow::Status FilterRowGroups(const RowGroupPredicate& predicate,
+                                  std::vector<int>* row_group_indices);
+
+  /// \brief Keep the indices of row_group_indices whose statistics do not
+  ///     rule out predicate, preserving their order.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  ::arrow::Status FilterRowGroups(const std::vector<int>& row_group_indices,
+                                  const RowGroupPredicate& predicate,
+                                  std::vector<int>* out);
+
   // Read a table of columns into a Table
   ::arrow::Status ReadTable(std::shared_ptr<::arrow::Table>* out);
 
@@ -173,11 +230,48 @@ class PARQUET_EXPORT FileReader {
   ::arrow::Status ReadTable(const std::vector<int>& column_indices,
                             std::shared_ptr<::arrow::Table>* out);
 
+  /// \brief Read the indicated column indices of the row groups whose
+  ///     statistics do not rule out predicate. Rows of the row groups read are
+  ///     not filtered.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  ::arrow::Status ReadTable(const std::vector<int>& column_indices,
+                            const RowGroupPredicate& predicate,
+                            std::shared_ptr<::arrow::Table>* out);
+
   ::arrow::Status ReadRowGroup(int i, const std::vector<int>& column_indices,
                                std::shared_ptr<::arrow::Table>* out);
 
   ::arrow::Status ReadRowGroup(int i, std::shared_ptr<::arrow::Table>* out);
 
+  /// \brief Read the rows of row group i in rows, given relative to the row
+  ///     group, sorted and not overlapping. The rows in between are skipped
+  ///     without being materialized; the data pages of flat columns holding
+  ///     skipped rows only are not even decompressed.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  ::arrow::Status ReadRowGroup(int i, const std::vector<int>& column_indices,
+                               const std::vector<RowRange>& rows,
+                               std::shared_ptr<::arrow::Table>* out);
+
+  /// \brief Read row group i with late materialization: the columns
+  ///     filter_column_indices are read first and passed to filter, then
+  ///     only the rows selected by filter are decoded from the columns
+  ///     column_indices (see ReadRowGroup with RowRange).
+  ///
+  /// Columns used by the filter may also be part of the result; they are
+  /// read again, restricted to the selected rows. This is cheap when few rows
+  /// are selected, which is when late materialization pays off.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  ::arrow::Status ReadRowGroup(int i, const std::vector<int>& filter_column_indices,
+                               const RowFilter& filter,
+                               const std::vector<int>& column_indices,
+                               std::shared_ptr<::arrow::Table>* out);
+
   ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                 const std::vector<int>& column_indices,
                                 std::shared_ptr<::arrow::Table>* out);
@@ -207,6 +301,48 @@ class PARQUET_EXPORT FileReader {
   /// By default only one thread is used.
   void set_use_threads(bool use_threads);
 
+  /// \brief Set whether BYTE_ARRAY columns read as string or binary are
+  /// returned as DictionaryArray, keeping dictionary-encoded pages encoded.
+  /// By default values are fully decoded.
+  ///
+  /// Each column chunk yields dictionary indices into its dictionary page;
+  /// chunks are unified into a single dictionary type per column. As the
+  /// dictionary type embeds its values, GetSchema and
+  /// RecordBatchReader::schema() keep reporting the value type.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  void set_read_dictionary(bool read_dictionary);
+
+  /// \brief Override set_read_dictionary(bool) for the given leaf column
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  void set_read_dictionary(int column_index, bool read_dictionary);
+
+  /// \brief Set the number of rows of the batches yielded by
+  /// GetRecordBatchReader. By default (0) every batch holds a whole row group.
+  ///
+  /// With a batch size, the readers decode each row group incrementally
+  /// instead, keeping only the current batch and the current data page of
+  /// each column in memory. Enable ReaderProperties::enable_buffered_stream
+  /// to avoid loading whole column chunks before decoding them.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  void set_batch_size(int64_t batch_size);
+
+  /// \brief Limit the decoded size of the batches yielded by
+  /// GetRecordBatchReader to about memory_limit bytes, by shrinking their
+  /// number of rows below the batch size. By default (0) there is no limit.
+  ///
+  /// The size of a row is estimated from the uncompressed size of the
+  /// column chunks, then from the batches read.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  void set_batch_memory_limit(int64_t memory_limit);
+
   virtual ~FileReader();
 
  private:
@@ -306,6 +442,37 @@ PARQUET_EXPORT
                          ::arrow::MemoryPool* allocator,
                          std::unique_ptr<FileReader>* reader);
 
+/// \brief The row groups to read from one file of a dataset, planned from the
+/// dataset's metadata summary file
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+struct PARQUET_EXPORT DatasetFileScan {
+  /// The file_path recorded in the summary for the column chunks of the file
+  std::string path;
+  /// The metadata of the file, taken from the summary. Passing it to
+  /// OpenFile() opens the file without reading its footer
+  std::shared_ptr<FileMetaData> metadata;
+  /// The row groups of the file to read, in the numbering of metadata
+  std::vector<int> row_groups;
+};
+
+/// \brief Plan the read of a dataset from its metadata summary (_metadata)
+/// file, e.g. as built with FileMetaData::AppendRowGroups
+///
+/// Row groups are grouped by the file_path of their column chunks, in the
+/// order the files first appear in summary. The row groups that predicate
+/// rules out using their statistics are skipped, as are files with no row
+/// group left.
+///
+/// \param[in] summary the metadata of the summary file
+/// \param[in] predicate the predicate filtering the row groups, may be null
+/// \param[out] out the files to open with the row groups to read
+PARQUET_EXPORT
+::arrow::Status PlanDatasetScan(const FileMetaData& summary,
+                                const RowGroupPredicate* predicate,
+                                std::vector<DatasetFileScan>* out);
+
 }  // namespace arrow
 }  // namespace parquet
 
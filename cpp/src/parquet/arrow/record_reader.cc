@@ -24,6 +24,7 @@
 #include <memory>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
@@ -73,6 +74,8 @@ class RecordReader::RecordReaderImpl {
         levels_written_(0),
         levels_position_(0),
         levels_capacity_(0),
+        levels_to_bitmap_(false),
+        records_to_skip_(0),
         uses_values_(!(descr->physical_type() == Type::BYTE_ARRAY)) {
     nullable_values_ = internal::HasSpacedValues(descr);
     if (uses_values_) {
@@ -135,7 +138,18 @@ class RecordReader::RecordReaderImpl {
         break;
       }
 
-      if (max_def_level_ > 0) {
+      if (levels_to_bitmap_) {
+        // Each level is a record: decode it straight into the validity bitmap
+        batch_size = std::min(num_records - records_read, batch_size);
+        int64_t levels_read = ReadLevelsToBitmap(batch_size);
+
+        // Exhausted column chunk
+        if (levels_read == 0) {
+          break;
+        }
+
+        records_read += levels_read;
+      } else if (max_def_level_ > 0) {
         ReserveLevels(batch_size);
 
         int16_t* def_levels = this->def_levels() + levels_written_;
@@ -169,12 +183,49 @@ class RecordReader::RecordReaderImpl {
     return records_read;
   }
 
+  // Skip num_records records without keeping their levels or values. Levels
+  // of the records read before are kept
+  int64_t SkipRecords(int64_t num_records) {
+    if (num_records == 0) {
+      return 0;
+    }
+    if (max_rep_level_ > 0) {
+      return SkipRepeatedRecords(num_records);
+    }
+    return SkipFlatRecords(num_records);
+  }
+
   // Dictionary decoders must be reset when advancing row groups
   virtual void ResetDecoders() = 0;
 
+  // Decode and discard the next num_values encoded values of the current page
+  virtual void SkipValues(int64_t num_values) = 0;
+
+  // Read values_with_nulls values, of which null_count are null as given by
+  // valid_bits_ from values_written_ onwards
+  virtual void ReadValuesSpaced(int64_t values_with_nulls, int64_t null_count) = 0;
+
+  // Only for flat optional columns: definition levels are then not kept, but
+  // decoded directly into the validity bitmap
+  void EnableLevelsToBitmap() {
+    levels_to_bitmap_ = max_def_level_ == 1 && max_rep_level_ == 0 && nullable_values_;
+  }
+
   void SetPageReader(std::unique_ptr<PageReader> reader) {
     at_record_start_ = true;
     pager_ = std::move(reader);
+    if (pager_ != nullptr && max_rep_level_ == 0) {
+      // Each value of a flat column is a record, so that data pages that
+      // only hold skipped records can be dropped from their header alone.
+      // Pages of repeated columns need not start at a record boundary
+      pager_->set_data_page_filter([this](int64_t num_values) {
+        if (records_to_skip_ == 0 || num_values > records_to_skip_) {
+          return false;
+        }
+        records_to_skip_ -= num_values;
+        return true;
+      });
+    }
     ResetDecoders();
   }
 
@@ -266,6 +317,115 @@ class RecordReader::RecordReaderImpl {
     return records_read;
   }
 
+  int64_t SkipFlatRecords(int64_t num_records) {
+    int64_t records_skipped = 0;
+
+    // Levels decoded ahead by the last read
+    if (levels_position_ < levels_written_) {
+      const int64_t start = levels_position_;
+      records_skipped = std::min(levels_written_ - levels_position_, num_records);
+      SkipValues(CountValues(def_levels() + start, records_skipped));
+      ConsumeBufferedValues(records_skipped);
+      levels_position_ += records_skipped;
+      DropLevels(start);
+    }
+
+    while (records_skipped < num_records) {
+      // Data pages holding skipped records only are passed over unread
+      records_to_skip_ = num_records - records_skipped;
+      const bool has_next = HasNext();
+      records_skipped = num_records - records_to_skip_;
+      records_to_skip_ = 0;
+      if (!has_next || records_skipped == num_records) {
+        break;
+      }
+
+      int64_t batch_size = std::min(
+          std::min(kMinLevelBatchSize, available_values_current_page()),
+          num_records - records_skipped);
+      int64_t values_to_skip = batch_size;
+      if (max_def_level_ > 0) {
+        skipped_levels_.resize(static_cast<size_t>(batch_size));
+        batch_size = ReadDefinitionLevels(batch_size, skipped_levels_.data());
+        if (batch_size == 0) {
+          break;
+        }
+        values_to_skip = CountValues(skipped_levels_.data(), batch_size);
+      }
+      SkipValues(values_to_skip);
+      ConsumeBufferedValues(batch_size);
+      records_skipped += batch_size;
+    }
+    return records_skipped;
+  }
+
+  int64_t SkipRepeatedRecords(int64_t num_records) {
+    const int64_t start = levels_position_;
+    int64_t records_skipped = 0;
+
+    while (true) {
+      if (levels_position_ < levels_written_) {
+        const int64_t levels_start = levels_position_;
+        int64_t values_to_skip = 0;
+        records_skipped += DelimitRecords(num_records - records_skipped, &values_to_skip);
+        SkipValues(values_to_skip);
+        ConsumeBufferedValues(levels_position_ - levels_start);
+        if (records_skipped == num_records) {
+          break;
+        }
+      }
+      if (!HasNext()) {
+        if (!at_record_start_) {
+          // The last record of the row group ends with it
+          ++records_skipped;
+          at_record_start_ = true;
+        }
+        break;
+      }
+
+      const int64_t batch_size =
+          std::min(kMinLevelBatchSize, available_values_current_page());
+      ReserveLevels(batch_size);
+      int64_t levels_read =
+          ReadDefinitionLevels(batch_size, def_levels() + levels_written_);
+      if (ReadRepetitionLevels(batch_size, rep_levels() + levels_written_) !=
+          levels_read) {
+        throw ParquetException("Number of decoded rep / def levels did not match");
+      }
+      if (levels_read == 0) {
+        break;
+      }
+      levels_written_ += levels_read;
+    }
+
+    DropLevels(start);
+    return records_skipped;
+  }
+
+  // Number of levels with a value
+  int64_t CountValues(const int16_t* def_levels, int64_t num_levels) const {
+    if (max_def_level_ == 0) {
+      return num_levels;
+    }
+    return std::count(def_levels, def_levels + num_levels, max_def_level_);
+  }
+
+  // Remove the levels consumed from start up to levels_position_
+  void DropLevels(int64_t start) {
+    if (max_def_level_ == 0 || start == levels_position_) {
+      return;
+    }
+    int16_t* def_data = def_levels();
+    std::copy(def_data + levels_position_, def_data + levels_written_, def_data + start);
+    if (max_rep_level_ > 0) {
+      int16_t* rep_data = rep_levels();
+      std::copy(rep_data + levels_position_, rep_data + levels_written_,
+                rep_data + start);
+    }
+    levels_written_ -= levels_position_ - start;
+    levels_position_ = start;
+  }
+
   // Read multiple definition levels into preallocated memory
   //
   // Returns the number of decoded definition levels
@@ -276,6 +436,27 @@ class RecordReader::RecordReaderImpl {
     return definition_level_decoder_.Decode(static_cast<int>(batch_size), levels);
   }
 
+  // Decode batch_size definition levels of a flat optional column into
+  // valid_bits_ and read the corresponding values
+  //
+  // Returns the number of decoded definition levels
+  int64_t ReadLevelsToBitmap(int64_t batch_size) {
+    ReserveValues(batch_size);
+    int64_t levels_read = definition_level_decoder_.DecodeBitmap(
+        static_cast<int>(batch_size), valid_bits_->mutable_data(), values_written_);
+    if (levels_read == 0) {
+      return 0;
+    }
+    const int64_t null_count =
+        levels_read - ::arrow::internal::CountSetBits(valid_bits_->data(),
+                                                      values_written_, levels_read);
+    ReadValuesSpaced(levels_read, null_count);
+    ConsumeBufferedValues(levels_read);
+    values_written_ += levels_read;
+    null_count_ += null_count;
+    return levels_read;
+  }
+
   int64_t ReadRepetitionLevels(int64_t batch_size, int16_t* levels) {
     if (descr_->max_repetition_level() == 0) {
       return 0;
@@ -353,15 +534,17 @@ class RecordReader::RecordReaderImpl {
       // Shift remaining levels to beginning of buffer and trim to only the number
       // of decoded levels remaining
       int16_t* def_data = def_levels();
-      int16_t* rep_data = rep_levels();
-
       std::copy(def_data + levels_position_, def_data + levels_written_, def_data);
-      std::copy(rep_data + levels_position_, rep_data + levels_written_, rep_data);
-
       PARQUET_THROW_NOT_OK(
           def_levels_->Resize(levels_remaining * sizeof(int16_t), false));
-      PARQUET_THROW_NOT_OK(
-          rep_levels_->Resize(levels_remaining * sizeof(int16_t), false));
+
+      // Repetition levels are only allocated for repeated columns
+      if (max_rep_level_ > 0) {
+        int16_t* rep_data = rep_levels();
+        std::copy(rep_data + levels_position_, rep_data + levels_written_, rep_data);
+        PARQUET_THROW_NOT_OK(
+            rep_levels_->Resize(levels_remaining * sizeof(int16_t), false));
+      }
 
       levels_written_ -= levels_position_;
       levels_position_ = 0;
@@ -433,6 +616,12 @@ class RecordReader::RecordReaderImpl {
   int64_t levels_position_;
   int64_t levels_capacity_;
 
+  bool levels_to_bitmap_;
+
+  // Records left to skip while SkipRecords looks for the next data page
+  int64_t records_to_skip_;
+  std::vector<int16_t> skipped_levels_;
+
   std::shared_ptr<::arrow::ResizableBuffer> values_;
   // In the case of false, don't allocate the values buffer (when we directly read into
   // builder classes).
@@ -455,7 +644,7 @@ struct RecordReaderTraits {
 
 template <>
 struct RecordReaderTraits<ByteArrayType> {
-  using BuilderType = ::arrow::internal::ChunkedBinaryBuilder;
+  using BuilderType = ::arrow::ChunkedBinaryBuilder;
 };
 
 template <>
@@ -471,13 +660,15 @@ class TypedRecordReader : public RecordReader::RecordReaderImpl {
   using BuilderType = typename RecordReaderTraits<DType>::BuilderType;
 
   TypedRecordReader(const ColumnDescriptor* descr, ::arrow::MemoryPool* pool)
-      : RecordReader::RecordReaderImpl(descr, pool), current_decoder_(nullptr) {
+      : RecordReader::RecordReaderImpl(descr, pool),
+        current_decoder_(nullptr),
+        new_dictionary_(false) {
     InitializeBuilder();
   }
 
   void ResetDecoders() override { decoders_.clear(); }
 
-  inline void ReadValuesSpaced(int64_t values_with_nulls, int64_t null_count) {
+  void ReadValuesSpaced(int64_t values_with_nulls, int64_t null_count) override {
     uint8_t* valid_bits = valid_bits_->mutable_data();
     const int64_t valid_bits_offset = values_written_;
 
@@ -487,12 +678,26 @@ class TypedRecordReader : public RecordReader::RecordReaderImpl {
     DCHECK_EQ(num_decoded, values_with_nulls);
   }
 
-  inline void ReadValuesDense(int64_t values_to_read) {
+  virtual void ReadValuesDense(int64_t values_to_read) {
     int64_t num_decoded =
         current_decoder_->Decode(ValuesHead<T>(), static_cast<int>(values_to_read));
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
+  void SkipValues(int64_t num_values) override {
+    constexpr int64_t kSkipBatchSize = 1024;
+    if (skipped_values_ == nullptr) {
+      skipped_values_ = AllocateBuffer(pool_, kSkipBatchSize * sizeof(T));
+    }
+    T* values = reinterpret_cast<T*>(skipped_values_->mutable_data());
+    while (num_values > 0) {
+      const int batch_size = static_cast<int>(std::min(kSkipBatchSize, num_values));
+      int num_decoded = current_decoder_->Decode(values, batch_size);
+      DCHECK_EQ(num_decoded, batch_size);
+      num_values -= batch_size;
+    }
+  }
+
   // Return number of logical records read
   int64_t ReadRecordData(const int64_t num_records) override {
     // Conservative upper bound
@@ -568,9 +773,16 @@ class TypedRecordReader : public RecordReader::RecordReaderImpl {
     throw ParquetException("GetChunks only implemented for binary types");
   }
 
- private:
+ protected:
   using DecoderType = typename EncodingTraits<DType>::Decoder;
 
+  DecoderType* current_decoder_;
+
+  // Set when a dictionary page is read, for subclasses which use the
+  // dictionary itself to reset
+  bool new_dictionary_;
+
+ private:
   // Map of encoding type to the respective decoder object. For example, a
   // column chunk's data pages may include both dictionary-encoded and
   // plain-encoded data.
@@ -578,7 +790,8 @@ class TypedRecordReader : public RecordReader::RecordReaderImpl {
 
   std::unique_ptr<BuilderType> builder_;
 
-  DecoderType* current_decoder_;
+  // Scratch space for the values decoded by SkipValues
+  std::shared_ptr<ResizableBuffer> skipped_values_;
 
   // Advance to the next data page
   bool ReadNewPage() override;
@@ -603,7 +816,7 @@ void TypedRecordReader<ByteArrayType>::InitializeBuilder() {
   // Maximum of 16MB chunks
   constexpr int32_t kBinaryChunksize = 1 << 24;
   DCHECK_EQ(descr_->physical_type(), Type::BYTE_ARRAY);
-  builder_.reset(new ::arrow::internal::ChunkedBinaryBuilder(kBinaryChunksize, pool_));
+  builder_.reset(new ::arrow::ChunkedBinaryBuilder(kBinaryChunksize, pool_));
 }
 
 template <>
@@ -715,8 +928,208 @@ inline void TypedRecordReader<DType>::ConfigureDictionary(const DictionaryPage*
 
   current_decoder_ = decoders_[encoding].get();
   DCHECK(current_decoder_);
+  new_dictionary_ = true;
 }
 
+// Reads BYTE_ARRAY columns as DictionaryArray. The indices of
+// dictionary-encoded pages are decoded directly from the RLE / bit-packed
+// stream, against an Arrow copy of the dictionary page which is reused by
+// the following column chunks if their dictionary is the same. Pages which
+// fell back to another encoding are dictionary-encoded while reading.
+class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType> {
+ public:
+  ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr,
+                                  ::arrow::MemoryPool* pool)
+      : TypedRecordReader<ByteArrayType>(descr, pool),
+        dict_decoder_(nullptr),
+        indices_builder_(pool) {}
+
+  void ReadValuesDense(int64_t values_to_read) override {
+    if (current_decoder_->encoding() == Encoding::RLE_DICTIONARY) {
+      const int32_t* indices = DecodeIndices(values_to_read);
+      PARQUET_THROW_NOT_OK(indices_builder_.AppendValues(indices, values_to_read));
+    } else {
+      const ByteArray* values = DecodeFallbackValues(values_to_read);
+      for (int64_t i = 0; i < values_to_read; ++i) {
+        PARQUET_THROW_NOT_OK(fallback_builder_->Append(values[i].ptr, values[i].len));
+      }
+    }
+    ResetValues();
+  }
+
+  void ReadValuesSpaced(int64_t values_with_nulls, int64_t null_count) override {
+    const uint8_t* valid_bits = valid_bits_->data();
+    const int64_t valid_bits_offset = values_written_;
+
+    if (current_decoder_->encoding() == Encoding::RLE_DICTIONARY) {
+      const int32_t* indices = DecodeIndices(values_with_nulls - null_count);
+      PARQUET_THROW_NOT_OK(indices_builder_.Reserve(values_with_nulls));
+      ::arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset,
+                                                 values_with_nulls);
+      for (int64_t i = 0; i < values_with_nulls; ++i) {
+        if (bit_reader.IsSet()) {
+          indices_builder_.UnsafeAppend(*indices++);
+        } else {
+          indices_builder_.UnsafeAppendNull();
+        }
+        bit_reader.Next();
+      }
+    } else {
+      BeginFallbackValues();
+      fallback_values_.resize(values_with_nulls);
+      int64_t num_decoded = current_decoder_->DecodeSpaced(
+          fallback_values_.data(), static_cast<int>(values_with_nulls),
+          static_cast<int>(null_count), valid_bits, valid_bits_offset);
+      DCHECK_EQ(num_decoded, values_with_nulls);
+      for (int64_t i = 0; i < values_with_nulls; ++i) {
+        if (::arrow::BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+          const ByteArray& value = fallback_values_[i];
+          PARQUET_THROW_NOT_OK(fallback_builder_->Append(value.ptr, value.len));
+        } else {
+          PARQUET_THROW_NOT_OK(fallback_builder_->AppendNull());
+        }
+      }
+    }
+    ResetValues();
+  }
+
+  ::arrow::ArrayVector GetBuilderChunks() override {
+    if (fallback_builder_ != nullptr) {
+      FlushFallbackValues();
+    }
+    if (indices_builder_.length() > 0 || chunks_.empty()) {
+      FlushIndices();
+    }
+    ::arrow::ArrayVector chunks = std::move(chunks_);
+    chunks_.clear();
+
+    // Give all chunks the same type, unless they already share one
+    for (const auto& chunk : chunks) {
+      if (chunk->type() != chunks[0]->type()) {
+        UnifyChunks(&chunks);
+        break;
+      }
+    }
+    return chunks;
+  }
+
+ private:
+  const int32_t* DecodeIndices(int64_t num_values) {
+    if (fallback_builder_ != nullptr) {
+      FlushFallbackValues();
+    }
+    if (new_dictionary_) {
+      SetDictionary();
+    }
+    indices_scratch_.resize(num_values);
+    int64_t num_decoded = dict_decoder_->DecodeIndices(static_cast<int>(num_values),
+                                                       indices_scratch_.data());
+    DCHECK_EQ(num_decoded, num_values);
+    return indices_scratch_.data();
+  }
+
+  const ByteArray* DecodeFallbackValues(int64_t num_values) {
+    BeginFallbackValues();
+    fallback_values_.resize(num_values);
+    int64_t num_decoded =
+        current_decoder_->Decode(fallback_values_.data(), static_cast<int>(num_values));
+    DCHECK_EQ(num_decoded, num_values);
+    return fallback_values_.data();
+  }
+
+  void BeginFallbackValues() {
+    if (indices_builder_.length() > 0) {
+      FlushIndices();
+    }
+    if (fallback_builder_ == nullptr) {
+      fallback_builder_.reset(
+          new ::arrow::BinaryDictionaryBuilder(::arrow::binary(), pool_));
+    }
+  }
+
+  // Convert the dictionary of the column chunk being read, keeping the current
+  // one if equal
+  void SetDictionary() {
+    new_dictionary_ = false;
+    dict_decoder_ = dynamic_cast<DictDecoder<ByteArrayType>*>(current_decoder_);
+    DCHECK(dict_decoder_);
+
+    const ByteArray* values;
+    int32_t num_values;
+    dict_decoder_->GetDictionary(&values, &num_values);
+    int64_t total_length = 0;
+    for (int32_t i = 0; i < num_values; ++i) {
+      total_length += values[i].len;
+    }
+    ::arrow::BinaryBuilder builder(pool_);
+    PARQUET_THROW_NOT_OK(builder.Reserve(num_values));
+    PARQUET_THROW_NOT_OK(builder.ReserveData(total_length));
+    for (int32_t i = 0; i < num_values; ++i) {
+      PARQUET_THROW_NOT_OK(builder.Append(values[i].ptr, values[i].len));
+    }
+    std::shared_ptr<::arrow::Array> dictionary;
+    PARQUET_THROW_NOT_OK(builder.Finish(&dictionary));
+
+    if (dict_type_ != nullptr &&
+        static_cast<const ::arrow::DictionaryType&>(*dict_type_).dictionary()->Equals(
+            *dictionary)) {
+      return;
+    }
+    if (indices_builder_.length() > 0) {
+      FlushIndices();
+    }
+    dict_type_ = ::arrow::dictionary(::arrow::int32(), dictionary);
+  }
+
+  void FlushIndices() {
+    if (dict_type_ == nullptr) {
+      // No dictionary page read yet
+      std::shared_ptr<::arrow::Array> dictionary;
+      PARQUET_THROW_NOT_OK(::arrow::BinaryBuilder(pool_).Finish(&dictionary));
+      dict_type_ = ::arrow::dictionary(::arrow::int32(), dictionary);
+    }
+    std::shared_ptr<::arrow::Array> indices;
+    PARQUET_THROW_NOT_OK(indices_builder_.Finish(&indices));
+    chunks_.push_back(std::make_shared<::arrow::DictionaryArray>(dict_type_, indices));
+  }
+
+  void FlushFallbackValues() {
+    // A finished DictionaryBuilder only yields the delta of its dictionary
+    // afterwards, hence a new builder per chunk
+    std::shared_ptr<::arrow::Array> chunk;
+    PARQUET_THROW_NOT_OK(fallback_builder_->Finish(&chunk));
+    fallback_builder_.reset();
+    chunks_.push_back(chunk);
+  }
+
+  void UnifyChunks(::arrow::ArrayVector* chunks) {
+    std::vector<const ::arrow::DataType*> types;
+    for (const auto& chunk : *chunks) {
+      types.push_back(chunk->type().get());
+    }
+    std::shared_ptr<::arrow::DataType> type;
+    std::vector<std::vector<int32_t>> transpose_maps;
+    PARQUET_THROW_NOT_OK(
+        ::arrow::DictionaryType::Unify(pool_, types, &type, &transpose_maps));
+    for (size_t i = 0; i < chunks->size(); ++i) {
+      const auto& chunk = static_cast<const ::arrow::DictionaryArray&>(*(*chunks)[i]);
+      PARQUET_THROW_NOT_OK(
+          chunk.Transpose(pool_, type, transpose_maps[i], &(*chunks)[i]));
+    }
+  }
+
+  DictDecoder<ByteArrayType>* dict_decoder_;
+  std::shared_ptr<::arrow::DataType> dict_type_;
+
+  ::arrow::Int32Builder indices_builder_;
+  std::vector<int32_t> indices_scratch_;
+
+  std::unique_ptr<::arrow::BinaryDictionaryBuilder> fallback_builder_;
+  std::vector<ByteArray> fallback_values_;
+
+  ::arrow::ArrayVector chunks_;
+};
+
 template <typename DType>
 bool TypedRecordReader<DType>::ReadNewPage() {
   // Loop until we find the next data page.
@@ -787,8 +1200,12 @@ bool TypedRecordReader<DType>::ReadNewPage() {
         current_decoder_ = it->second.get();
       } else {
         switch (encoding) {
-          case Encoding::PLAIN: {
-            auto decoder = MakeTypedDecoder<DType>(Encoding::PLAIN, descr_);
+          case Encoding::PLAIN:
+          case Encoding::DELTA_BINARY_PACKED:
+          case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+          case Encoding::DELTA_BYTE_ARRAY:
+          case Encoding::BYTE_STREAM_SPLIT: {
+            auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
             current_decoder_ = decoder.get();
             decoders_[static_cast<int>(encoding)] = std::move(decoder);
             break;
@@ -796,11 +1213,6 @@ bool TypedRecordReader<DType>::ReadNewPage() {
           case Encoding::RLE_DICTIONARY:
             throw ParquetException("Dictionary page must be before data page.");
 
-          case Encoding::DELTA_BINARY_PACKED:
-          case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-          case Encoding::DELTA_BYTE_ARRAY:
-            ParquetException::NYI("Unsupported encoding");
-
           default:
             throw ParquetException("Unknown encoding type.");
         }
@@ -817,33 +1229,31 @@ bool TypedRecordReader<DType>::ReadNewPage() {
   return true;
 }
 
-std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
-                                                 MemoryPool* pool) {
+namespace {
+
+RecordReader::RecordReaderImpl* MakeRecordReaderImpl(const ColumnDescriptor* descr,
+                                                     MemoryPool* pool,
+                                                     bool read_dictionary) {
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
-      return std::shared_ptr<RecordReader>(
-          new RecordReader(new TypedRecordReader<BooleanType>(descr, pool)));
+      return new TypedRecordReader<BooleanType>(descr, pool);
     case Type::INT32:
-      return std::shared_ptr<RecordReader>(
-          new RecordReader(new TypedRecordReader<Int32Type>(descr, pool)));
+      return new TypedRecordReader<Int32Type>(descr, pool);
     case Type::INT64:
-      return std::shared_ptr<RecordReader>(
-          new RecordReader(new TypedRecordReader<Int64Type>(descr, pool)));
+      return new TypedRecordReader<Int64Type>(descr, pool);
     case Type::INT96:
-      return std::shared_ptr<RecordReader>(
-          new RecordReader(new TypedRecordReader<Int96Type>(descr, pool)));
+      return new TypedRecordReader<Int96Type>(descr, pool);
     case Type::FLOAT:
-      return std::shared_ptr<RecordReader>(
-          new RecordReader(new TypedRecordReader<FloatType>(descr, pool)));
+      return new TypedRecordReader<FloatType>(descr, pool);
     case Type::DOUBLE:
-      return std::shared_ptr<RecordReader>(
-          new RecordReader(new TypedRecordReader<DoubleType>(descr, pool)));
+      return new TypedRecordReader<DoubleType>(descr, pool);
     case Type::BYTE_ARRAY:
-      return std::shared_ptr<RecordReader>(
-          new RecordReader(new TypedRecordReader<ByteArrayType>(descr, pool)));
+      if (read_dictionary) {
+        return new ByteArrayDictionaryRecordReader(descr, pool);
+      }
+      return new TypedRecordReader<ByteArrayType>(descr, pool);
     case Type::FIXED_LEN_BYTE_ARRAY:
-      return std::shared_ptr<RecordReader>(
-          new RecordReader(new TypedRecordReader<FLBAType>(descr, pool)));
+      return new TypedRecordReader<FLBAType>(descr, pool);
     default: {
       // PARQUET-1481: This can occur if the file is corrupt
       std::stringstream ss;
@@ -855,6 +1265,19 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
   return nullptr;
 }
 
+}  // namespace
+
+std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
+                                                 MemoryPool* pool, bool read_dictionary,
+                                                 bool levels_to_bitmap) {
+  std::unique_ptr<RecordReaderImpl> impl(
+      MakeRecordReaderImpl(descr, pool, read_dictionary));
+  if (levels_to_bitmap) {
+    impl->EnableLevelsToBitmap();
+  }
+  return std::shared_ptr<RecordReader>(new RecordReader(impl.release()));
+}
+
 // ----------------------------------------------------------------------
 // Implement public API
 
@@ -866,6 +1289,10 @@ int64_t RecordReader::ReadRecords(int64_t num_records) {
   return impl_->ReadRecords(num_records);
 }
 
+int64_t RecordReader::SkipRecords(int64_t num_records) {
+  return impl_->SkipRecords(num_records);
+}
+
 void RecordReader::Reset() { return impl_->Reset(); }
 
 void RecordReader::Reserve(int64_t num_values) { impl_->Reserve(num_values); }
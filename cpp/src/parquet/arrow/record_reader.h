@@ -49,9 +49,17 @@ class RecordReader {
   // So that we can create subclasses
   class RecordReaderImpl;
 
+  /// \param[in] descr the column to read
+  /// \param[in] pool memory pool to allocate values from
+  /// \param[in] read_dictionary for BYTE_ARRAY columns, have GetBuilderChunks
+  /// return DictionaryArray chunks, decoding dictionary indices directly
+  /// \param[in] levels_to_bitmap for flat optional columns (maximum definition
+  /// level 1, no repetition), decode definition levels directly into the
+  /// validity bitmap. def_levels() then remains empty
   static std::shared_ptr<RecordReader> Make(
       const ColumnDescriptor* descr,
-      ::arrow::MemoryPool* pool = ::arrow::default_memory_pool());
+      ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
+      bool read_dictionary = false, bool levels_to_bitmap = false);
 
   virtual ~RecordReader();
 
@@ -68,6 +76,13 @@ class RecordReader {
   /// \return number of records read
   int64_t ReadRecords(int64_t num_records);
 
+  /// \brief Skip the indicated number of records without decoding them
+  /// into the reader. Levels and values of the records read before are
+  /// kept. Data pages of flat columns holding skipped records only are not
+  /// read or decompressed
+  /// \return number of records skipped
+  int64_t SkipRecords(int64_t num_records);
+
   /// \brief Pre-allocate space for data. Results in better flat read performance
   void Reserve(int64_t num_values);
 
@@ -105,7 +120,8 @@ class RecordReader {
 
   void DebugPrintState();
 
-  // For BYTE_ARRAY, FIXED_LEN_BYTE_ARRAY types that may have chunked output
+  // For BYTE_ARRAY, FIXED_LEN_BYTE_ARRAY types that may have chunked output.
+  // With read_dictionary, all chunks share the same DictionaryType.
   std::vector<std::shared_ptr<::arrow::Array>> GetBuilderChunks();
 
  private:
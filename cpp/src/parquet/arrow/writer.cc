@@ -19,19 +19,25 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <future>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
+#include "arrow/buffer-builder.h"
 #include "arrow/builder.h"
 #include "arrow/compute/api.h"
+#include "arrow/compute/kernels/sort.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
-#include "arrow/visitor_inline.h"
+#include "arrow/util/thread-pool.h"
+#include "arrow/util/tracing.h"
 
 #include "arrow/util/logging.h"
 
@@ -49,14 +55,14 @@ using arrow::ChunkedArray;
 using arrow::Decimal128Array;
 using arrow::Field;
 using arrow::FixedSizeBinaryArray;
-using arrow::Int16Array;
-using arrow::Int16Builder;
 using arrow::ListArray;
 using arrow::MemoryPool;
 using arrow::NumericArray;
 using arrow::PrimitiveArray;
+using arrow::RecordBatch;
 using arrow::ResizableBuffer;
 using arrow::Status;
+using arrow::StructArray;
 using arrow::Table;
 using arrow::TimeUnit;
 
@@ -81,77 +87,45 @@ std::shared_ptr<ArrowWriterProperties> default_arrow_writer_properties() {
 
 namespace {
 
+int CountLeaves(const ::arrow::DataType& type) {
+  if (type.id() == ::arrow::Type::LIST) {
+    return CountLeaves(*type.child(0)->type());
+  } else if (type.id() == ::arrow::Type::STRUCT) {
+    int num_leaves = 0;
+    for (int i = 0; i < type.num_children(); ++i) {
+      num_leaves += CountLeaves(*type.child(i)->type());
+    }
+    return num_leaves;
+  }
+  return 1;
+}
+
+// Generates the repetition and definition levels of one leaf column of an
+// array nesting lists and structs. The array is walked one range of slots at a
+// time: the values of each list and the runs of non-null structs are handed to
+// the next nesting level whole, and the levels of leaf ranges are appended in
+// bulk.
 class LevelBuilder {
  public:
   explicit LevelBuilder(MemoryPool* pool)
-      : def_levels_(::arrow::int16(), pool), rep_levels_(::arrow::int16(), pool) {}
-
-  Status VisitInline(const Array& array);
-
-  template <typename T>
-  typename std::enable_if<std::is_base_of<::arrow::FlatArray, T>::value, Status>::type
-  Visit(const T& array) {
-    array_offsets_.push_back(static_cast<int32_t>(array.offset()));
-    valid_bitmaps_.push_back(array.null_bitmap_data());
-    null_counts_.push_back(array.null_count());
-    values_array_ = std::make_shared<T>(array.data());
-    return Status::OK();
-  }
-
-  Status Visit(const ListArray& array) {
-    array_offsets_.push_back(static_cast<int32_t>(array.offset()));
-    valid_bitmaps_.push_back(array.null_bitmap_data());
-    null_counts_.push_back(array.null_count());
-    offsets_.push_back(array.raw_value_offsets());
-
-    min_offset_idx_ = array.value_offset(min_offset_idx_);
-    max_offset_idx_ = array.value_offset(max_offset_idx_);
-
-    return VisitInline(*array.values());
-  }
-
-#define NOT_IMPLEMENTED_VISIT(ArrowTypePrefix)                             \
-  Status Visit(const ::arrow::ArrowTypePrefix##Array& array) {             \
-    return Status::NotImplemented("Level generation for " #ArrowTypePrefix \
-                                  " not supported yet");                   \
-  }
-
-  NOT_IMPLEMENTED_VISIT(Struct)
-  NOT_IMPLEMENTED_VISIT(Union)
-  NOT_IMPLEMENTED_VISIT(Dictionary)
+      : pool_(pool), def_levels_(pool), rep_levels_(pool) {}
 
+  // Generate the levels of the leaf_index-th leaf of array. field is the field
+  // of array restricted to that leaf, as returned by FromParquetSchema for its
+  // column. values_array receives the leaf values the column holds a slot
+  // for, i.e. those of non-null and non-empty ancestors.
   Status GenerateLevels(const Array& array, const std::shared_ptr<Field>& field,
-                        int64_t* values_offset, int64_t* num_values, int64_t* num_levels,
+                        int leaf_index, int64_t* num_levels,
                         const std::shared_ptr<ResizableBuffer>& def_levels_scratch,
                         std::shared_ptr<Buffer>* def_levels_out,
                         std::shared_ptr<Buffer>* rep_levels_out,
                         std::shared_ptr<Array>* values_array) {
-    // Work downwards to extract bitmaps and offsets
-    min_offset_idx_ = 0;
-    max_offset_idx_ = array.length();
-    RETURN_NOT_OK(VisitInline(array));
-    *num_values = max_offset_idx_ - min_offset_idx_;
-    *values_offset = min_offset_idx_;
-    *values_array = values_array_;
-
-    // Walk downwards to extract nullability
-    std::shared_ptr<Field> current_field = field;
-    nullable_.push_back(current_field->nullable());
-    while (current_field->type()->num_children() > 0) {
-      if (current_field->type()->num_children() > 1) {
-        return Status::NotImplemented(
-            "Fields with more than one child are not supported.");
-      } else {
-        current_field = current_field->type()->child(0);
-      }
-      nullable_.push_back(current_field->nullable());
-    }
+    RETURN_NOT_OK(FindLeaf(array, field, leaf_index));
 
-    // Generate the levels.
-    if (nullable_.size() == 1) {
+    if (path_.size() == 1) {
       // We have a PrimitiveArray
       *rep_levels_out = nullptr;
-      if (nullable_[0]) {
+      if (field->nullable()) {
         RETURN_NOT_OK(
             def_levels_scratch->Resize(array.length() * sizeof(int16_t), false));
         auto def_levels_ptr =
@@ -174,109 +148,210 @@ class LevelBuilder {
         *def_levels_out = nullptr;
       }
       *num_levels = array.length();
-    } else {
-      RETURN_NOT_OK(rep_levels_.Append(0));
-      RETURN_NOT_OK(HandleListEntries(0, 0, 0, array.length()));
-
-      std::shared_ptr<Array> def_levels_array;
-      std::shared_ptr<Array> rep_levels_array;
-
-      RETURN_NOT_OK(def_levels_.Finish(&def_levels_array));
-      RETURN_NOT_OK(rep_levels_.Finish(&rep_levels_array));
-
-      *def_levels_out = static_cast<PrimitiveArray*>(def_levels_array.get())->values();
-      *rep_levels_out = static_cast<PrimitiveArray*>(rep_levels_array.get())->values();
-      *num_levels = rep_levels_array->length();
+      *values_array = path_[0].array;
+      return Status::OK();
     }
 
-    return Status::OK();
+    RETURN_NOT_OK(AppendSlots(0, 0, array.length(), 0, 0, 0));
+    *num_levels = def_levels_.length();
+    RETURN_NOT_OK(def_levels_.Finish(def_levels_out));
+    if (has_lists_) {
+      RETURN_NOT_OK(rep_levels_.Finish(rep_levels_out));
+    } else {
+      *rep_levels_out = nullptr;
+    }
+    return GetLeafValues(values_array);
   }
 
-  Status HandleList(int16_t def_level, int16_t rep_level, int64_t index) {
-    if (nullable_[rep_level]) {
-      if (null_counts_[rep_level] == 0 ||
-          BitUtil::GetBit(valid_bitmaps_[rep_level], index + array_offsets_[rep_level])) {
-        return HandleNonNullList(static_cast<int16_t>(def_level + 1), rep_level, index);
+ private:
+  struct PathNode {
+    std::shared_ptr<Array> array;
+    bool nullable;
+  };
+
+  // Collect the arrays from array down to its leaf_index-th leaf
+  Status FindLeaf(const Array& array, const std::shared_ptr<Field>& field,
+                  int leaf_index) {
+    path_.clear();
+    has_lists_ = false;
+    std::shared_ptr<Array> current = ::arrow::MakeArray(array.data());
+    const Field* current_field = field.get();
+    while (true) {
+      path_.push_back({current, current_field->nullable()});
+      if (current->type_id() == ::arrow::Type::LIST) {
+        current = static_cast<const ListArray&>(*current).values();
+        has_lists_ = true;
+      } else if (current->type_id() == ::arrow::Type::STRUCT) {
+        const auto& type = *current->type();
+        int child = 0;
+        for (; child < type.num_children(); ++child) {
+          const int child_leaves = CountLeaves(*type.child(child)->type());
+          if (leaf_index < child_leaves) {
+            break;
+          }
+          leaf_index -= child_leaves;
+        }
+        if (child == type.num_children()) {
+          return Status::Invalid("Leaf index out of bounds for type ", type);
+        }
+        current = static_cast<const StructArray&>(*current).field(child);
+      } else if (current->type_id() == ::arrow::Type::UNION) {
+        return Status::NotImplemented("Level generation for Union not supported yet");
       } else {
-        return def_levels_.Append(def_level);
+        return Status::OK();
       }
-    } else {
-      return HandleNonNullList(def_level, rep_level, index);
+      if (current_field->type()->num_children() != 1) {
+        return Status::Invalid("Field ", current_field->name(),
+                               " does not lead to a single leaf");
+      }
+      current_field = current_field->type()->child(0).get();
     }
   }
 
-  Status HandleNonNullList(int16_t def_level, int16_t rep_level, int64_t index) {
-    const int32_t inner_offset = offsets_[rep_level][index];
-    const int32_t inner_length = offsets_[rep_level][index + 1] - inner_offset;
-    const int64_t recursion_level = rep_level + 1;
-    if (inner_length == 0) {
-      return def_levels_.Append(def_level);
+  // Append the levels of the slots [start, end) of the array at depth in the
+  // path. def_level is the definition level of a null slot and rep_level the
+  // repetition level of the innermost enclosing list, which the first slot
+  // only repeats with first_rep_level.
+  Status AppendSlots(size_t depth, int64_t start, int64_t end, int16_t def_level,
+                     int16_t rep_level, int16_t first_rep_level) {
+    const Array& array = *path_[depth].array;
+    const bool nullable = path_[depth].nullable;
+    const auto defined_level = static_cast<int16_t>(def_level + nullable);
+    if (depth + 1 == path_.size()) {
+      return AppendLeafSlots(array, nullable, start, end, def_level, defined_level,
+                             rep_level, first_rep_level);
     }
-    if (recursion_level < static_cast<int64_t>(offsets_.size())) {
-      return HandleListEntries(static_cast<int16_t>(def_level + 1),
-                               static_cast<int16_t>(rep_level + 1), inner_offset,
-                               inner_length);
-    } else {
-      // We have reached the leaf: primitive list, handle remaining nullables
-      const bool nullable_level = nullable_[recursion_level];
-      const int64_t level_null_count = null_counts_[recursion_level];
-      const uint8_t* level_valid_bitmap = valid_bitmaps_[recursion_level];
-
-      for (int64_t i = 0; i < inner_length; i++) {
-        if (i > 0) {
-          RETURN_NOT_OK(rep_levels_.Append(static_cast<int16_t>(rep_level + 1)));
-        }
-        if (level_null_count && level_valid_bitmap == nullptr) {
-          // Special case: this is a null array (all elements are null)
-          RETURN_NOT_OK(def_levels_.Append(static_cast<int16_t>(def_level + 1)));
-        } else if (nullable_level &&
-                   ((level_null_count == 0) ||
-                    BitUtil::GetBit(
-                        level_valid_bitmap,
-                        inner_offset + i + array_offsets_[recursion_level]))) {
-          // Non-null element in a null level
-          RETURN_NOT_OK(def_levels_.Append(static_cast<int16_t>(def_level + 2)));
+
+    if (array.type_id() == ::arrow::Type::LIST) {
+      const auto& list_array = static_cast<const ListArray&>(array);
+      const int32_t* offsets = list_array.raw_value_offsets();
+      const bool may_be_null = nullable && list_array.null_count() > 0;
+      for (int64_t i = start; i < end; ++i) {
+        const int16_t slot_rep_level = i == start ? first_rep_level : rep_level;
+        if (may_be_null && list_array.IsNull(i)) {
+          RETURN_NOT_OK(AppendLevels(1, def_level, slot_rep_level, rep_level));
+        } else if (offsets[i] == offsets[i + 1]) {
+          RETURN_NOT_OK(AppendLevels(1, defined_level, slot_rep_level, rep_level));
         } else {
-          // This can be produced in two case:
-          //  * elements are nullable and this one is null (i.e. max_def_level = def_level
-          //  + 2)
-          //  * elements are non-nullable (i.e. max_def_level = def_level + 1)
-          RETURN_NOT_OK(def_levels_.Append(static_cast<int16_t>(def_level + 1)));
+          // The repeated node below the list adds a repetition and definition
+          // level
+          RETURN_NOT_OK(AppendSlots(depth + 1, offsets[i], offsets[i + 1],
+                                    static_cast<int16_t>(defined_level + 1),
+                                    static_cast<int16_t>(rep_level + 1),
+                                    slot_rep_level));
         }
       }
       return Status::OK();
     }
+
+    // A struct
+    if (!nullable || array.null_count() == 0) {
+      return AppendSlots(depth + 1, start, end, defined_level, rep_level,
+                         first_rep_level);
+    }
+    int64_t run_start = start;
+    while (run_start < end) {
+      const bool is_null = array.IsNull(run_start);
+      int64_t run_end = run_start + 1;
+      while (run_end < end && array.IsNull(run_end) == is_null) {
+        ++run_end;
+      }
+      const int16_t run_rep_level = run_start == start ? first_rep_level : rep_level;
+      if (is_null) {
+        RETURN_NOT_OK(AppendLevels(run_end - run_start, def_level, run_rep_level,
+                                   rep_level));
+      } else {
+        RETURN_NOT_OK(AppendSlots(depth + 1, run_start, run_end, defined_level,
+                                  rep_level, run_rep_level));
+      }
+      run_start = run_end;
+    }
+    return Status::OK();
   }
 
-  Status HandleListEntries(int16_t def_level, int16_t rep_level, int64_t offset,
-                           int64_t length) {
-    for (int64_t i = 0; i < length; i++) {
-      if (i > 0) {
-        RETURN_NOT_OK(rep_levels_.Append(rep_level));
+  Status AppendLeafSlots(const Array& array, bool nullable, int64_t start, int64_t end,
+                         int16_t def_level, int16_t defined_level, int16_t rep_level,
+                         int16_t first_rep_level) {
+    const int64_t length = end - start;
+    if (!value_ranges_.empty() && value_ranges_.back().second == start) {
+      value_ranges_.back().second = end;
+    } else {
+      value_ranges_.emplace_back(start, end);
+    }
+
+    if (has_lists_) {
+      RETURN_NOT_OK(rep_levels_.Append(first_rep_level));
+      RETURN_NOT_OK(rep_levels_.Append(length - 1, rep_level));
+    }
+    if (!nullable || array.null_count() == 0) {
+      return def_levels_.Append(length, defined_level);
+    } else if (array.null_bitmap_data() == nullptr) {
+      // Special case: this is a null array (all elements are null)
+      return def_levels_.Append(length, def_level);
+    }
+    RETURN_NOT_OK(def_levels_.Reserve(length));
+    ::arrow::internal::BitmapReader valid_bits_reader(
+        array.null_bitmap_data(), array.offset() + start, length);
+    for (int64_t i = 0; i < length; ++i) {
+      def_levels_.UnsafeAppend(valid_bits_reader.IsSet() ? defined_level : def_level);
+      valid_bits_reader.Next();
+    }
+    return Status::OK();
+  }
+
+  Status AppendLevels(int64_t num_levels, int16_t def_level, int16_t first_rep_level,
+                      int16_t rep_level) {
+    if (has_lists_) {
+      RETURN_NOT_OK(rep_levels_.Append(first_rep_level));
+      RETURN_NOT_OK(rep_levels_.Append(num_levels - 1, rep_level));
+    }
+    return def_levels_.Append(num_levels, def_level);
+  }
+
+  Status GetLeafValues(std::shared_ptr<Array>* out) {
+    const std::shared_ptr<Array>& leaf = path_.back().array;
+    if (value_ranges_.empty()) {
+      *out = leaf->Slice(0, 0);
+      return Status::OK();
+    } else if (value_ranges_.size() == 1) {
+      const auto& range = value_ranges_.front();
+      *out = leaf->Slice(range.first, range.second - range.first);
+      return Status::OK();
+    }
+
+    // Leaf values below null structs (or null lists with values) have no slot
+    // in the column, gather the others
+    int64_t num_values = 0;
+    for (const auto& range : value_ranges_) {
+      num_values += range.second - range.first;
+    }
+    std::shared_ptr<Buffer> indices;
+    RETURN_NOT_OK(::arrow::AllocateBuffer(pool_, num_values * sizeof(int64_t), &indices));
+    auto indices_data = reinterpret_cast<int64_t*>(indices->mutable_data());
+    for (const auto& range : value_ranges_) {
+      for (int64_t i = range.first; i < range.second; ++i) {
+        *indices_data++ = i;
       }
-      RETURN_NOT_OK(HandleList(def_level, rep_level, offset + i));
     }
+    ::arrow::Int64Array indices_array(num_values, indices);
+    FunctionContext ctx(pool_);
+    ::arrow::compute::Datum values;
+    RETURN_NOT_OK(::arrow::compute::Take(&ctx, ::arrow::compute::Datum(leaf),
+                                         ::arrow::compute::Datum(indices_array.data()),
+                                         &values));
+    *out = values.make_array();
     return Status::OK();
   }
 
- private:
-  Int16Builder def_levels_;
-  Int16Builder rep_levels_;
-
-  std::vector<int64_t> null_counts_;
-  std::vector<const uint8_t*> valid_bitmaps_;
-  std::vector<const int32_t*> offsets_;
-  std::vector<int32_t> array_offsets_;
-  std::vector<bool> nullable_;
-
-  int64_t min_offset_idx_;
-  int64_t max_offset_idx_;
-  std::shared_ptr<Array> values_array_;
-};
+  MemoryPool* pool_;
+  ::arrow::TypedBufferBuilder<int16_t> def_levels_;
+  ::arrow::TypedBufferBuilder<int16_t> rep_levels_;
 
-Status LevelBuilder::VisitInline(const Array& array) {
-  return VisitArrayInline(array, this);
-}
+  std::vector<PathNode> path_;
+  bool has_lists_;
+  // The ranges of leaf values below non-null and non-empty ancestors
+  std::vector<std::pair<int64_t, int64_t>> value_ranges_;
+};
 
 struct ColumnWriterContext {
   ColumnWriterContext(MemoryPool* memory_pool, ArrowWriterProperties* properties)
@@ -303,23 +378,12 @@ struct ColumnWriterContext {
   std::shared_ptr<ResizableBuffer> def_levels_buffer;
 };
 
-Status GetLeafType(const ::arrow::DataType& type, ::arrow::Type::type* leaf_type) {
-  if (type.id() == ::arrow::Type::LIST || type.id() == ::arrow::Type::STRUCT) {
-    if (type.num_children() != 1) {
-      return Status::Invalid("Nested column branch had multiple children");
-    }
-    return GetLeafType(*type.child(0)->type(), leaf_type);
-  } else {
-    *leaf_type = type.id();
-    return Status::OK();
-  }
-}
-
 class ArrowColumnWriter {
  public:
+  // Writes the leaf_index-th leaf of the arrays of field to column_writer
   ArrowColumnWriter(ColumnWriterContext* ctx, ColumnWriter* column_writer,
-                    const std::shared_ptr<Field>& field)
-      : ctx_(ctx), writer_(column_writer), field_(field) {}
+                    const std::shared_ptr<Field>& field, int leaf_index = 0)
+      : ctx_(ctx), writer_(column_writer), field_(field), leaf_index_(leaf_index) {}
 
   Status Write(const Array& data);
 
@@ -369,16 +433,40 @@ class ArrowColumnWriter {
     return Status::OK();
   }
 
-  Status Close() {
-    PARQUET_CATCH_NOT_OK(writer_->Close());
-    return Status::OK();
-  }
-
  private:
+  Status WriteLeafValues(const Array& values_array, int64_t num_levels,
+                         const int16_t* def_levels, const int16_t* rep_levels);
+
   template <typename ParquetType, typename ArrowType>
   Status TypedWriteBatch(const Array& data, int64_t num_levels, const int16_t* def_levels,
                          const int16_t* rep_levels);
 
+  Status WriteDictionary(const Array& data, int64_t num_levels,
+                         const int16_t* def_levels, const int16_t* rep_levels);
+
+  template <typename ParquetType>
+  Status TypedWriteDictionary(const ::arrow::DictionaryArray& data, int64_t num_levels,
+                              const int16_t* def_levels, const int16_t* rep_levels,
+                              bool* written) {
+    auto typed_writer =
+        ::arrow::internal::checked_cast<TypedColumnWriter<ParquetType>*>(writer_);
+    PARQUET_CATCH_NOT_OK(*written = typed_writer->WriteArrowDictionary(
+                             num_levels, def_levels, rep_levels, data));
+    return Status::OK();
+  }
+
+  // Write the array through TypedColumnWriter::WriteArrow, written being set
+  // to false if it does not support the column or the array type
+  template <typename ParquetType>
+  Status TypedWriteArrow(const Array& data, int64_t num_levels, const int16_t* def_levels,
+                         const int16_t* rep_levels, bool* written) {
+    auto typed_writer =
+        ::arrow::internal::checked_cast<TypedColumnWriter<ParquetType>*>(writer_);
+    PARQUET_CATCH_NOT_OK(*written = typed_writer->WriteArrow(num_levels, def_levels,
+                                                             rep_levels, data));
+    return Status::OK();
+  }
+
   Status WriteTimestamps(const Array& data, int64_t num_levels, const int16_t* def_levels,
                          const int16_t* rep_levels);
 
@@ -430,6 +518,7 @@ class ArrowColumnWriter {
   ColumnWriterContext* ctx_;
   ColumnWriter* writer_;
   std::shared_ptr<Field> field_;
+  int leaf_index_;
 };
 
 template <typename ParquetType, typename ArrowType>
@@ -438,6 +527,14 @@ Status ArrowColumnWriter::TypedWriteBatch(const Array& array, int64_t num_levels
                                           const int16_t* rep_levels) {
   using ArrowCType = typename ArrowType::c_type;
 
+  // Flat columns of values stored as the Parquet type are encoded in place
+  bool written = false;
+  RETURN_NOT_OK(TypedWriteArrow<ParquetType>(array, num_levels, def_levels, rep_levels,
+                                             &written));
+  if (written) {
+    return Status::OK();
+  }
+
   const auto& data = static_cast<const PrimitiveArray&>(array);
   const ArrowCType* values = nullptr;
   // The values buffer may be null if the array is empty (ARROW-2744)
@@ -900,19 +997,14 @@ Status ArrowColumnWriter::Write(const Array& data) {
     return Status::OK();
   }
 
-  ::arrow::Type::type values_type;
-  RETURN_NOT_OK(GetLeafType(*data.type(), &values_type));
-
-  std::shared_ptr<Array> _values_array;
-  int64_t values_offset = 0;
+  std::shared_ptr<Array> values_array;
   int64_t num_levels = 0;
-  int64_t num_values = 0;
   LevelBuilder level_builder(ctx_->memory_pool);
 
   std::shared_ptr<Buffer> def_levels_buffer, rep_levels_buffer;
   RETURN_NOT_OK(level_builder.GenerateLevels(
-      data, field_, &values_offset, &num_values, &num_levels, ctx_->def_levels_buffer,
-      &def_levels_buffer, &rep_levels_buffer, &_values_array));
+      data, field_, leaf_index_, &num_levels, ctx_->def_levels_buffer,
+      &def_levels_buffer, &rep_levels_buffer, &values_array));
   const int16_t* def_levels = nullptr;
   if (def_levels_buffer) {
     def_levels = reinterpret_cast<const int16_t*>(def_levels_buffer->data());
@@ -921,28 +1013,34 @@ Status ArrowColumnWriter::Write(const Array& data) {
   if (rep_levels_buffer) {
     rep_levels = reinterpret_cast<const int16_t*>(rep_levels_buffer->data());
   }
-  std::shared_ptr<Array> values_array = _values_array->Slice(values_offset, num_values);
+  return WriteLeafValues(*values_array, num_levels, def_levels, rep_levels);
+}
 
-#define WRITE_BATCH_CASE(ArrowEnum, ArrowType, ParquetType)                            \
-  case ::arrow::Type::ArrowEnum:                                                       \
-    return TypedWriteBatch<ParquetType, ::arrow::ArrowType>(*values_array, num_levels, \
+Status ArrowColumnWriter::WriteLeafValues(const Array& values_array, int64_t num_levels,
+                                          const int16_t* def_levels,
+                                          const int16_t* rep_levels) {
+#define WRITE_BATCH_CASE(ArrowEnum, ArrowType, ParquetType)                           \
+  case ::arrow::Type::ArrowEnum:                                                      \
+    return TypedWriteBatch<ParquetType, ::arrow::ArrowType>(values_array, num_levels, \
                                                             def_levels, rep_levels);
 
-  switch (values_type) {
+  switch (values_array.type_id()) {
     case ::arrow::Type::UINT32: {
       if (writer_->properties()->version() == ParquetVersion::PARQUET_1_0) {
         // Parquet 1.0 reader cannot read the UINT_32 logical type. Thus we need
         // to use the larger Int64Type to store them lossless.
-        return TypedWriteBatch<Int64Type, ::arrow::UInt32Type>(*values_array, num_levels,
+        return TypedWriteBatch<Int64Type, ::arrow::UInt32Type>(values_array, num_levels,
                                                                def_levels, rep_levels);
       } else {
-        return TypedWriteBatch<Int32Type, ::arrow::UInt32Type>(*values_array, num_levels,
+        return TypedWriteBatch<Int32Type, ::arrow::UInt32Type>(values_array, num_levels,
                                                                def_levels, rep_levels);
       }
     }
       WRITE_BATCH_CASE(NA, NullType, Int32Type)
     case ::arrow::Type::TIMESTAMP:
-      return WriteTimestamps(*values_array, num_levels, def_levels, rep_levels);
+      return WriteTimestamps(values_array, num_levels, def_levels, rep_levels);
+    case ::arrow::Type::DICTIONARY:
+      return WriteDictionary(values_array, num_levels, def_levels, rep_levels);
       WRITE_BATCH_CASE(BOOL, BooleanType, BooleanType)
       WRITE_BATCH_CASE(INT8, Int8Type, Int32Type)
       WRITE_BATCH_CASE(UINT8, UInt8Type, Int32Type)
@@ -965,7 +1063,52 @@ Status ArrowColumnWriter::Write(const Array& data) {
       break;
   }
   return Status::NotImplemented("Data type not supported as list value: ",
-                                values_array->type()->ToString());
+                                values_array.type()->ToString());
+}
+
+Status ArrowColumnWriter::WriteDictionary(const Array& data, int64_t num_levels,
+                                          const int16_t* def_levels,
+                                          const int16_t* rep_levels) {
+  const auto& dict_data = static_cast<const ::arrow::DictionaryArray&>(data);
+  bool written = false;
+  switch (writer_->type()) {
+    case Type::INT32:
+      RETURN_NOT_OK(TypedWriteDictionary<Int32Type>(dict_data, num_levels, def_levels,
+                                                    rep_levels, &written));
+      break;
+    case Type::INT64:
+      RETURN_NOT_OK(TypedWriteDictionary<Int64Type>(dict_data, num_levels, def_levels,
+                                                    rep_levels, &written));
+      break;
+    case Type::FLOAT:
+      RETURN_NOT_OK(TypedWriteDictionary<FloatType>(dict_data, num_levels, def_levels,
+                                                    rep_levels, &written));
+      break;
+    case Type::DOUBLE:
+      RETURN_NOT_OK(TypedWriteDictionary<DoubleType>(dict_data, num_levels, def_levels,
+                                                     rep_levels, &written));
+      break;
+    case Type::BYTE_ARRAY:
+      RETURN_NOT_OK(TypedWriteDictionary<ByteArrayType>(
+          dict_data, num_levels, def_levels, rep_levels, &written));
+      break;
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      RETURN_NOT_OK(TypedWriteDictionary<FLBAType>(dict_data, num_levels, def_levels,
+                                                   rep_levels, &written));
+      break;
+    default:
+      break;
+  }
+  if (written) {
+    return Status::OK();
+  }
+
+  // The dictionary values need converting: write them expanded
+  FunctionContext ctx(ctx_->memory_pool);
+  std::shared_ptr<Array> dense_array;
+  RETURN_NOT_OK(Cast(&ctx, data, dict_data.dictionary()->type(), CastOptions(),
+                     &dense_array));
+  return WriteLeafValues(*dense_array, num_levels, def_levels, rep_levels);
 }
 
 }  // namespace
@@ -973,6 +1116,23 @@ Status ArrowColumnWriter::Write(const Array& data) {
 // ----------------------------------------------------------------------
 // FileWriter implementation
 
+// Whether dictionary values of the given type are written without conversion,
+// which TypedColumnWriter::WriteArrowDictionary requires
+static bool IsDictionaryValueTypeWrittenAsIs(const ::arrow::DataType& type) {
+  switch (type.id()) {
+    case ::arrow::Type::INT32:
+    case ::arrow::Type::INT64:
+    case ::arrow::Type::FLOAT:
+    case ::arrow::Type::DOUBLE:
+    case ::arrow::Type::BINARY:
+    case ::arrow::Type::STRING:
+    case ::arrow::Type::FIXED_SIZE_BINARY:
+      return true;
+    default:
+      return false;
+  }
+}
+
 class FileWriter::Impl {
  public:
   Impl(MemoryPool* pool, std::unique_ptr<ParquetFileWriter> writer,
@@ -981,13 +1141,80 @@ class FileWriter::Impl {
         row_group_writer_(nullptr),
         column_write_context_(pool, arrow_properties.get()),
         arrow_properties_(arrow_properties),
-        closed_(false) {}
+        closed_(false),
+        batch_row_group_(false),
+        batch_row_group_rows_(0),
+        pending_rows_(0) {}
 
   Status NewRowGroup(int64_t chunk_size) {
     if (row_group_writer_ != nullptr) {
       PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
     }
     PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendRowGroup());
+    batch_row_group_ = false;
+    return Status::OK();
+  }
+
+  // Append the rows of batch to the current buffered row group of
+  // WriteRecordBatch, starting a new one whenever it is full
+  Status WriteRecordBatch(const RecordBatch& batch) {
+    if (!arrow_properties_->sort_fields().empty()) {
+      return Status::NotImplemented("WriteRecordBatch with sorted row groups");
+    }
+    int num_leaves = 0;
+    for (const auto& field : batch.schema()->fields()) {
+      num_leaves += CountLeaves(*field->type());
+    }
+    if (num_leaves != writer_->schema()->num_columns()) {
+      return Status::Invalid("Record batch has ", num_leaves, " leaf columns, expected ",
+                             writer_->schema()->num_columns());
+    }
+
+    const int64_t max_rows = properties().max_row_group_length();
+    const int64_t max_bytes = properties().max_row_group_bytes();
+    int64_t offset = 0;
+    while (offset < batch.num_rows()) {
+      if (!batch_row_group_) {
+        if (row_group_writer_ != nullptr) {
+          PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+        }
+        PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+        batch_row_group_ = true;
+        batch_row_group_rows_ = 0;
+      }
+      const int64_t size =
+          std::min(batch.num_rows() - offset, max_rows - batch_row_group_rows_);
+      RETURN_NOT_OK(AppendRows(batch, offset, size));
+      offset += size;
+      batch_row_group_rows_ += size;
+
+      // Pages written to the buffered row group, and data pages held back
+      // until the dictionary page is written
+      int64_t buffered_bytes;
+      PARQUET_CATCH_NOT_OK(buffered_bytes = row_group_writer_->total_bytes_written() +
+                                            row_group_writer_->total_compressed_bytes());
+      if (batch_row_group_rows_ >= max_rows || buffered_bytes >= max_bytes) {
+        PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+        batch_row_group_ = false;
+      }
+    }
+    return Status::OK();
+  }
+
+  // Write the rows [offset, offset + size) of batch to the open column writers
+  // of the buffered row group
+  Status AppendRows(const RecordBatch& batch, int64_t offset, int64_t size) {
+    int column_index = 0;
+    for (int i = 0; i < batch.num_columns(); i++) {
+      auto data = std::make_shared<ChunkedArray>(::arrow::ArrayVector{batch.column(i)});
+      const int num_leaves = CountLeaves(*data->type());
+      for (int leaf_index = 0; leaf_index < num_leaves; ++leaf_index, ++column_index) {
+        ColumnWriter* column_writer;
+        PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->column(column_index));
+        RETURN_NOT_OK(WriteColumnValues(column_writer, column_index, leaf_index,
+                                        &column_write_context_, data, offset, size));
+      }
+    }
     return Status::OK();
   }
 
@@ -995,14 +1222,111 @@ class FileWriter::Impl {
     if (!closed_) {
       // Make idempotent
       closed_ = true;
+      Status status = Status::OK();
+      if (pending_rows_ > 0) {
+        status = WriteSortedRowGroup(pending_rows_);
+      }
       if (row_group_writer_ != nullptr) {
         PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
       }
       PARQUET_CATCH_NOT_OK(writer_->Close());
+      return status;
+    }
+    return Status::OK();
+  }
+
+  // Write the rows [offset, offset + size) of table as a row group
+  Status WriteRowGroup(const Table& table, int64_t offset, int64_t size) {
+    ARROW_TRACE_SPAN("parquet", "write_row_group");
+    if (arrow_properties_->use_threads() && table.num_columns() > 1) {
+      return WriteRowGroupParallel(table, offset, size);
+    }
+    RETURN_NOT_OK(NewRowGroup(size));
+    for (int i = 0; i < table.num_columns(); i++) {
+      RETURN_NOT_OK(WriteColumnChunk(table.column(i)->data(), offset, size));
     }
     return Status::OK();
   }
 
+  // Buffer the rows of table, and write a sorted row group of the first
+  // chunk_size buffered rows as long as there are that many
+  Status BufferSortedRows(const Table& table, int64_t chunk_size) {
+    if (sorted_schema_ == nullptr) {
+      RETURN_NOT_OK(InitSortedRows(table.schema()));
+    } else if (!table.schema()->Equals(*sorted_schema_)) {
+      return Status::Invalid("Table schema does not match the schema of the rows ",
+                             "buffered for sorting");
+    }
+    for (int i = 0; i < table.num_columns(); i++) {
+      for (const auto& chunk : table.column(i)->data()->chunks()) {
+        if (chunk->length() > 0) {
+          pending_chunks_[i].push_back(chunk);
+        }
+      }
+    }
+    pending_rows_ += table.num_rows();
+    while (pending_rows_ >= chunk_size) {
+      RETURN_NOT_OK(WriteSortedRowGroup(chunk_size));
+    }
+    return Status::OK();
+  }
+
+  Status InitSortedRows(const std::shared_ptr<::arrow::Schema>& schema) {
+    // Leaf column index of the first leaf of each field
+    std::vector<int> first_leaves;
+    int num_leaves = 0;
+    for (const auto& field : schema->fields()) {
+      first_leaves.push_back(num_leaves);
+      num_leaves += CountLeaves(*field->type());
+    }
+    for (int field_index : arrow_properties_->sort_fields()) {
+      if (!(field_index >= 0 && field_index < schema->num_fields())) {
+        return Status::Invalid("Sort field index ", field_index, " out of range, ",
+                               "the schema has ", schema->num_fields(), " fields");
+      }
+      if (schema->field(field_index)->type()->num_children() > 0) {
+        return Status::NotImplemented("Sorting by nested field ",
+                                      schema->field(field_index)->name());
+      }
+      sorting_columns_.push_back({first_leaves[field_index], false, false});
+    }
+    sorted_schema_ = schema;
+    pending_chunks_.resize(schema->num_fields());
+    return Status::OK();
+  }
+
+  // Sort the first size buffered rows and write them as a row group
+  Status WriteSortedRowGroup(int64_t size) {
+    const int num_columns = sorted_schema_->num_fields();
+    std::vector<std::shared_ptr<ChunkedArray>> columns(num_columns);
+    for (int i = 0; i < num_columns; i++) {
+      ChunkedArray pending(pending_chunks_[i], sorted_schema_->field(i)->type());
+      columns[i] = pending.Slice(0, size);
+      pending_chunks_[i] = pending.Slice(size)->chunks();
+    }
+    pending_rows_ -= size;
+
+    FunctionContext ctx(memory_pool());
+    std::vector<::arrow::compute::Datum> keys;
+    for (int field_index : arrow_properties_->sort_fields()) {
+      keys.emplace_back(columns[field_index]);
+    }
+    ::arrow::compute::Datum indices;
+    RETURN_NOT_OK(::arrow::compute::SortToIndices(&ctx, keys, &indices));
+    std::vector<std::shared_ptr<Array>> sorted_columns(num_columns);
+    for (int i = 0; i < num_columns; i++) {
+      ::arrow::compute::Datum sorted;
+      RETURN_NOT_OK(::arrow::compute::Take(&ctx, ::arrow::compute::Datum(columns[i]),
+                                           indices, &sorted));
+      sorted_columns[i] = sorted.make_array();
+    }
+
+    auto table = Table::Make(sorted_schema_, sorted_columns, size);
+    RETURN_NOT_OK(WriteRowGroup(*table, 0, size));
+    PARQUET_CATCH_NOT_OK(row_group_writer_->set_sorting_columns(sorting_columns_));
+    return Status::OK();
+  }
+
   Status WriteColumnChunk(const Array& data) {
     // A bit awkward here since cannot instantiate ChunkedArray from const Array&
     ::arrow::ArrayVector chunks = {::arrow::MakeArray(data.data())};
@@ -1012,9 +1336,78 @@ class FileWriter::Impl {
 
   Status WriteColumnChunk(const std::shared_ptr<ChunkedArray>& data, int64_t offset,
                           const int64_t size) {
-    // DictionaryArrays are not yet handled with a fast path. To still support
-    // writing them as a workaround, we convert them back to their non-dictionary
-    // representation.
+    // Nested data is written to one column per leaf
+    const int num_leaves = CountLeaves(*data->type());
+    for (int leaf_index = 0; leaf_index < num_leaves; ++leaf_index) {
+      ColumnWriter* column_writer;
+      PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
+      int column_index = row_group_writer_->current_column() - 1;
+      RETURN_NOT_OK(WriteColumnChunk(column_writer, column_index, leaf_index,
+                                     &column_write_context_, data, offset, size));
+    }
+    return Status::OK();
+  }
+
+  // Write the columns of a row group concurrently on the CPU thread pool. The
+  // row group is buffered in memory until all of its columns are written
+  Status WriteRowGroupParallel(const Table& table, int64_t offset, int64_t size) {
+    if (row_group_writer_ != nullptr) {
+      PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
+    }
+    PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+    batch_row_group_ = false;
+
+    auto WriteColumnFunc = [&table, offset, size, this](int i, int leaf_index,
+                                                        int column_index) {
+      ColumnWriter* column_writer;
+      PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->column(column_index));
+      // The scratch buffers of a context can't be shared between threads
+      ColumnWriterContext context(memory_pool(), arrow_properties_.get());
+      try {
+        return WriteColumnChunk(column_writer, column_index, leaf_index, &context,
+                                table.column(i)->data(), offset, size);
+      } catch (const ::parquet::ParquetException& e) {
+        return Status::IOError(e.what());
+      }
+    };
+
+    std::vector<std::future<Status>> futures;
+    auto pool = ::arrow::internal::GetCpuThreadPool();
+    int column_index = 0;
+    for (int i = 0; i < table.num_columns(); i++) {
+      const int num_leaves = CountLeaves(*table.column(i)->type());
+      for (int leaf_index = 0; leaf_index < num_leaves; ++leaf_index) {
+        futures.push_back(pool->Submit(WriteColumnFunc, i, leaf_index, column_index++));
+      }
+    }
+    Status final_status = Status::OK();
+    for (auto& fut : futures) {
+      Status st = fut.get();
+      if (!st.ok()) {
+        final_status = std::move(st);
+      }
+    }
+    return final_status;
+  }
+
+  Status WriteColumnChunk(ColumnWriter* column_writer, int column_index, int leaf_index,
+                          ColumnWriterContext* context,
+                          const std::shared_ptr<ChunkedArray>& data, int64_t offset,
+                          const int64_t size) {
+    RETURN_NOT_OK(WriteColumnValues(column_writer, column_index, leaf_index, context,
+                                    data, offset, size));
+    PARQUET_CATCH_NOT_OK(column_writer->Close());
+    return Status::OK();
+  }
+
+  // Write values to a column writer, leaving it open
+  Status WriteColumnValues(ColumnWriter* column_writer, int column_index,
+                           int leaf_index, ColumnWriterContext* context,
+                           const std::shared_ptr<ChunkedArray>& data, int64_t offset,
+                           const int64_t size) {
+    // DictionaryArrays whose values are stored as is feed their dictionary and
+    // indices to the column writer. Others are converted back to their
+    // non-dictionary representation.
     if (data->type()->id() == ::arrow::Type::DICTIONARY) {
       const ::arrow::DictionaryType& dict_type =
           static_cast<const ::arrow::DictionaryType&>(*data->type());
@@ -1023,32 +1416,33 @@ class FileWriter::Impl {
       // version that has this fixed.
       if (dict_type.dictionary()->type()->id() == ::arrow::Type::NA) {
         auto null_array = std::make_shared<::arrow::NullArray>(data->length());
-        return WriteColumnChunk(*null_array);
+        auto null_chunks =
+            std::make_shared<ChunkedArray>(::arrow::ArrayVector{null_array});
+        return WriteColumnValues(column_writer, column_index, leaf_index, context,
+                                 null_chunks, offset, size);
       }
 
-      FunctionContext ctx(this->memory_pool());
-      ::arrow::compute::Datum cast_input(data);
-      ::arrow::compute::Datum cast_output;
-      RETURN_NOT_OK(Cast(&ctx, cast_input, dict_type.dictionary()->type(), CastOptions(),
-                         &cast_output));
-      return WriteColumnChunk(cast_output.chunked_array(), offset, size);
+      if (!IsDictionaryValueTypeWrittenAsIs(*dict_type.dictionary()->type())) {
+        FunctionContext ctx(this->memory_pool());
+        ::arrow::compute::Datum cast_input(data);
+        ::arrow::compute::Datum cast_output;
+        RETURN_NOT_OK(Cast(&ctx, cast_input, dict_type.dictionary()->type(),
+                           CastOptions(), &cast_output));
+        return WriteColumnValues(column_writer, column_index, leaf_index, context,
+                                 cast_output.chunked_array(), offset, size);
+      }
     }
 
-    ColumnWriter* column_writer;
-    PARQUET_CATCH_NOT_OK(column_writer = row_group_writer_->NextColumn());
-
-    // TODO(wesm): This trick to construct a schema for one Parquet root node
-    // will not work for arbitrary nested data
-    int current_column_idx = row_group_writer_->current_column();
+    ARROW_TRACE_SPAN("parquet", "write_column");
+    // The field of the Parquet root node restricted to the column's leaf
     std::shared_ptr<::arrow::Schema> arrow_schema;
-    RETURN_NOT_OK(FromParquetSchema(writer_->schema(), {current_column_idx - 1},
+    RETURN_NOT_OK(FromParquetSchema(writer_->schema(), {column_index},
                                     writer_->key_value_metadata(), &arrow_schema));
 
-    ArrowColumnWriter arrow_writer(&column_write_context_, column_writer,
-                                   arrow_schema->field(0));
+    ArrowColumnWriter arrow_writer(context, column_writer, arrow_schema->field(0),
+                                   leaf_index);
 
-    RETURN_NOT_OK(arrow_writer.Write(*data, offset, size));
-    return arrow_writer.Close();
+    return arrow_writer.Write(*data, offset, size);
   }
 
   const WriterProperties& properties() const { return *writer_->properties(); }
@@ -1065,6 +1459,17 @@ class FileWriter::Impl {
   ColumnWriterContext column_write_context_;
   std::shared_ptr<ArrowWriterProperties> arrow_properties_;
   bool closed_;
+  // Whether row_group_writer_ is a buffered row group of WriteRecordBatch
+  // still open for more rows, and its number of rows
+  bool batch_row_group_;
+  int64_t batch_row_group_rows_;
+
+  // Rows buffered to be sorted, by column, if ArrowWriterProperties has
+  // sort fields
+  std::shared_ptr<::arrow::Schema> sorted_schema_;
+  std::vector<::arrow::ArrayVector> pending_chunks_;
+  int64_t pending_rows_;
+  std::vector<SortingColumn> sorting_columns_;
 };
 
 Status FileWriter::NewRowGroup(int64_t chunk_size) {
@@ -1147,22 +1552,41 @@ Status WriteFileMetaData(const FileMetaData& file_metadata,
   return ::parquet::arrow::WriteFileMetaData(file_metadata, &wrapper);
 }
 
+Status WriteMetaDataFile(const FileMetaData& file_metadata, OutputStream* sink) {
+  PARQUET_CATCH_NOT_OK(::parquet::WriteMetaDataFile(file_metadata, sink));
+  return Status::OK();
+}
+
+Status WriteMetaDataFile(const FileMetaData& file_metadata,
+                         const std::shared_ptr<::arrow::io::OutputStream>& sink) {
+  ArrowOutputStream wrapper(sink);
+  return ::parquet::arrow::WriteMetaDataFile(file_metadata, &wrapper);
+}
+
 namespace {}  // namespace
 
+Status FileWriter::WriteRecordBatch(const RecordBatch& batch) {
+  ARROW_TRACE_SPAN("parquet", "write_record_batch");
+  RETURN_NOT_OK_ELSE(impl_->WriteRecordBatch(batch), PARQUET_IGNORE_NOT_OK(Close()));
+  return Status::OK();
+}
+
 Status FileWriter::WriteTable(const Table& table, int64_t chunk_size) {
+  ARROW_TRACE_SPAN("parquet", "write_table");
   if (chunk_size <= 0 && table.num_rows() > 0) {
     return Status::Invalid("chunk size per row_group must be greater than 0");
   } else if (chunk_size > impl_->properties().max_row_group_length()) {
     chunk_size = impl_->properties().max_row_group_length();
   }
 
-  auto WriteRowGroup = [&](int64_t offset, int64_t size) {
-    RETURN_NOT_OK(NewRowGroup(size));
-    for (int i = 0; i < table.num_columns(); i++) {
-      auto chunked_data = table.column(i)->data();
-      RETURN_NOT_OK(WriteColumnChunk(chunked_data, offset, size));
-    }
+  if (!impl_->arrow_properties_->sort_fields().empty()) {
+    RETURN_NOT_OK_ELSE(impl_->BufferSortedRows(table, chunk_size),
+                       PARQUET_IGNORE_NOT_OK(Close()));
     return Status::OK();
+  }
+
+  auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+    return impl_->WriteRowGroup(table, offset, size);
   };
 
   if (table.num_rows() == 0) {
@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "parquet/properties.h"
 #include "parquet/types.h"
@@ -32,6 +33,7 @@ namespace arrow {
 class Array;
 class ChunkedArray;
 class MemoryPool;
+class RecordBatch;
 class Status;
 class Table;
 
@@ -59,7 +61,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
         : write_timestamps_as_int96_(false),
           coerce_timestamps_enabled_(false),
           coerce_timestamps_unit_(::arrow::TimeUnit::SECOND),
-          truncated_timestamps_allowed_(false) {}
+          truncated_timestamps_allowed_(false),
+          use_threads_(false) {}
     virtual ~Builder() {}
 
     Builder* disable_deprecated_int96_timestamps() {
@@ -88,10 +91,41 @@ class PARQUET_EXPORT ArrowWriterProperties {
       return this;
     }
 
+    /// \brief Write the columns of each row group of FileWriter::WriteTable
+    /// concurrently on the CPU thread pool
+    ///
+    /// Row groups are then buffered in memory until all of their columns are
+    /// written.
+    ///
+    /// \since 0.13.0
+    /// \note API not yet finalized
+    Builder* set_use_threads(bool use_threads) {
+      use_threads_ = use_threads;
+      return this;
+    }
+
+    /// \brief Sort the rows of each row group by the given top-level fields,
+    /// most significant first, ascending with nulls last
+    ///
+    /// FileWriter::WriteTable then buffers rows until a row group is full,
+    /// so that row groups are sorted across calls, and Close writes the
+    /// remaining rows. The order is recorded as the sorting_columns of the
+    /// row groups. Fields must be of a primitive type.
+    ///
+    /// Sorted row groups tend to compress better and have tighter
+    /// statistics for the sort keys.
+    ///
+    /// \since 0.13.0
+    /// \note API not yet finalized
+    Builder* sort_row_groups_by(const std::vector<int>& field_indices) {
+      sort_fields_ = field_indices;
+      return this;
+    }
+
     std::shared_ptr<ArrowWriterProperties> build() {
       return std::shared_ptr<ArrowWriterProperties>(new ArrowWriterProperties(
           write_timestamps_as_int96_, coerce_timestamps_enabled_, coerce_timestamps_unit_,
-          truncated_timestamps_allowed_));
+          truncated_timestamps_allowed_, use_threads_, sort_fields_));
     }
 
    private:
@@ -100,6 +134,8 @@ class PARQUET_EXPORT ArrowWriterProperties {
     bool coerce_timestamps_enabled_;
     ::arrow::TimeUnit::type coerce_timestamps_unit_;
     bool truncated_timestamps_allowed_;
+    bool use_threads_;
+    std::vector<int> sort_fields_;
   };
 
   bool support_deprecated_int96_timestamps() const { return write_timestamps_as_int96_; }
@@ -111,20 +147,30 @@ class PARQUET_EXPORT ArrowWriterProperties {
 
   bool truncated_timestamps_allowed() const { return truncated_timestamps_allowed_; }
 
+  bool use_threads() const { return use_threads_; }
+
+  /// The top-level fields row groups are sorted by, empty if they are not
+  const std::vector<int>& sort_fields() const { return sort_fields_; }
+
  private:
   explicit ArrowWriterProperties(bool write_nanos_as_int96,
                                  bool coerce_timestamps_enabled,
                                  ::arrow::TimeUnit::type coerce_timestamps_unit,
-                                 bool truncated_timestamps_allowed)
+                                 bool truncated_timestamps_allowed, bool use_threads,
+                                 const std::vector<int>& sort_fields)
       : write_timestamps_as_int96_(write_nanos_as_int96),
         coerce_timestamps_enabled_(coerce_timestamps_enabled),
         coerce_timestamps_unit_(coerce_timestamps_unit),
-        truncated_timestamps_allowed_(truncated_timestamps_allowed) {}
+        truncated_timestamps_allowed_(truncated_timestamps_allowed),
+        use_threads_(use_threads),
+        sort_fields_(sort_fields) {}
 
   const bool write_timestamps_as_int96_;
   const bool coerce_timestamps_enabled_;
   const ::arrow::TimeUnit::type coerce_timestamps_unit_;
   const bool truncated_timestamps_allowed_;
+  const bool use_threads_;
+  const std::vector<int> sort_fields_;
 };
 
 std::shared_ptr<ArrowWriterProperties> PARQUET_EXPORT default_arrow_writer_properties();
@@ -167,6 +213,23 @@ class PARQUET_EXPORT FileWriter {
   /// \brief Write a Table to Parquet.
   ::arrow::Status WriteTable(const ::arrow::Table& table, int64_t chunk_size);
 
+  /// \brief Append the rows of a record batch to the current row group
+  ///
+  /// The columns of the row group are encoded and compressed into pages as
+  /// rows arrive, and the pages are buffered until the row group is written
+  /// out, as Parquet column chunks must be contiguous. A new row group is
+  /// started once the pages hold WriterProperties::max_row_group_bytes, or
+  /// the row group max_row_group_length rows, so that memory use is bounded
+  /// by that size plus about a page per column whatever the number of rows
+  /// written. Close writes out the last row group.
+  ///
+  /// Calls may be mixed with WriteTable, which starts its own row groups.
+  /// Sorted row groups are not supported.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  ::arrow::Status WriteRecordBatch(const ::arrow::RecordBatch& batch);
+
   ::arrow::Status NewRowGroup(int64_t chunk_size);
   ::arrow::Status WriteColumnChunk(const ::arrow::Array& data);
 
@@ -194,6 +257,22 @@ PARQUET_EXPORT
 ::arrow::Status WriteFileMetaData(const FileMetaData& file_metadata,
                                   const std::shared_ptr<::arrow::io::OutputStream>& sink);
 
+/// \brief Write a metadata-only Parquet file, such as the _metadata summary
+/// file of a dataset, to indicated OutputStream
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+PARQUET_EXPORT
+::arrow::Status WriteMetaDataFile(const FileMetaData& file_metadata, OutputStream* sink);
+
+/// \brief Write a metadata-only Parquet file to indicated Arrow OutputStream
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+PARQUET_EXPORT
+::arrow::Status WriteMetaDataFile(const FileMetaData& file_metadata,
+                                  const std::shared_ptr<::arrow::io::OutputStream>& sink);
+
 /**
  * Write a Table to Parquet.
  *
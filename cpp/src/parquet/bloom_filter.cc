@@ -22,6 +22,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/sse-util.h"
 #include "parquet/bloom_filter.h"
 #include "parquet/exception.h"
 #include "parquet/murmur3.h"
@@ -129,6 +130,51 @@ void BlockSplitBloomFilter::SetMask(uint32_t key, BlockMask& block_mask) const {
   }
 }
 
+#ifdef ARROW_HAVE_SSE4_2
+
+namespace {
+
+// The masks of SetMask for words [4 * half, 4 * half + 4) of a block.
+// 1 << n is computed as the float 2^n converted to an integer, which for
+// n = 31 overflows to 0x80000000, the wanted bit pattern.
+inline __m128i BlockMaskHalf(uint32_t key, const uint32_t* salt) {
+  __m128i salts = _mm_loadu_si128(reinterpret_cast<const __m128i*>(salt));
+  __m128i shifts = _mm_srli_epi32(_mm_mullo_epi32(_mm_set1_epi32(key), salts), 27);
+  __m128i exponents = _mm_slli_epi32(_mm_add_epi32(shifts, _mm_set1_epi32(127)), 23);
+  return _mm_cvttps_epi32(_mm_castsi128_ps(exponents));
+}
+
+}  // namespace
+
+bool BlockSplitBloomFilter::FindHash(uint64_t hash) const {
+  const uint32_t bucket_index =
+      static_cast<uint32_t>((hash >> 32) & (num_bytes_ / kBytesPerFilterBlock - 1));
+  uint32_t key = static_cast<uint32_t>(hash);
+  // Blocks are 32-byte aligned as the buffer is allocated from a memory pool
+  const __m128i* block =
+      reinterpret_cast<const __m128i*>(data_->data()) + 2 * bucket_index;
+
+  // A word of the block with none of its mask bits set rules the hash out
+  __m128i lo = _mm_and_si128(_mm_load_si128(block), BlockMaskHalf(key, SALT));
+  __m128i hi = _mm_and_si128(_mm_load_si128(block + 1), BlockMaskHalf(key, SALT + 4));
+  __m128i zero = _mm_setzero_si128();
+  __m128i empty = _mm_or_si128(_mm_cmpeq_epi32(lo, zero), _mm_cmpeq_epi32(hi, zero));
+  return _mm_movemask_epi8(empty) == 0;
+}
+
+void BlockSplitBloomFilter::InsertHash(uint64_t hash) {
+  const uint32_t bucket_index =
+      static_cast<uint32_t>(hash >> 32) & (num_bytes_ / kBytesPerFilterBlock - 1);
+  uint32_t key = static_cast<uint32_t>(hash);
+  __m128i* block = reinterpret_cast<__m128i*>(data_->mutable_data()) + 2 * bucket_index;
+
+  _mm_store_si128(block, _mm_or_si128(_mm_load_si128(block), BlockMaskHalf(key, SALT)));
+  _mm_store_si128(block + 1, _mm_or_si128(_mm_load_si128(block + 1),
+                                          BlockMaskHalf(key, SALT + 4)));
+}
+
+#else
+
 bool BlockSplitBloomFilter::FindHash(uint64_t hash) const {
   const uint32_t bucket_index =
       static_cast<uint32_t>((hash >> 32) & (num_bytes_ / kBytesPerFilterBlock - 1));
@@ -162,4 +208,6 @@ void BlockSplitBloomFilter::InsertHash(uint64_t hash) {
   }
 }
 
+#endif  // ARROW_HAVE_SSE4_2
+
 }  // namespace parquet
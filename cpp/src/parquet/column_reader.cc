@@ -28,6 +28,7 @@
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle-encoding.h"
+#include "arrow/util/tracing.h"
 
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
@@ -90,6 +91,22 @@ int LevelDecoder::Decode(int batch_size, int16_t* levels) {
   return num_decoded;
 }
 
+int LevelDecoder::DecodeBitmap(int batch_size, uint8_t* valid_bits,
+                               int64_t valid_bits_offset) {
+  DCHECK_EQ(bit_width_, 1);
+  int num_decoded = 0;
+
+  int num_values = std::min(num_values_remaining_, batch_size);
+  if (encoding_ == Encoding::RLE) {
+    num_decoded = rle_decoder_->GetBitmap(valid_bits, valid_bits_offset, num_values);
+  } else {
+    num_decoded =
+        bit_packed_decoder_->GetBitmap(valid_bits, valid_bits_offset, num_values);
+  }
+  num_values_remaining_ -= num_decoded;
+  return num_decoded;
+}
+
 ReaderProperties default_reader_properties() {
   static ReaderProperties default_reader_properties;
   return default_reader_properties;
@@ -119,7 +136,21 @@ class SerializedPageReader : public PageReader {
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
+  void set_data_page_filter(DataPageFilter filter) override {
+    data_page_filter_ = std::move(filter);
+  }
+
  private:
+  // Whether to pass over the data page of the current header unread
+  bool SkipDataPage(int64_t num_values) {
+    if (!data_page_filter_ || !data_page_filter_(num_values)) {
+      return false;
+    }
+    stream_->Advance(current_page_header_.compressed_page_size);
+    seen_num_rows_ += num_values;
+    return true;
+  }
+
   std::unique_ptr<InputStream> stream_;
 
   format::PageHeader current_page_header_;
@@ -137,6 +168,8 @@ class SerializedPageReader : public PageReader {
 
   // Number of rows in all the data pages
   int64_t total_num_rows_;
+
+  DataPageFilter data_page_filter_;
 };
 
 std::shared_ptr<Page> SerializedPageReader::NextPage() {
@@ -177,6 +210,16 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
     // Advance the stream offset
     stream_->Advance(header_size);
 
+    if (current_page_header_.type == format::PageType::DATA_PAGE) {
+      if (SkipDataPage(current_page_header_.data_page_header.num_values)) {
+        continue;
+      }
+    } else if (current_page_header_.type == format::PageType::DATA_PAGE_V2) {
+      if (SkipDataPage(current_page_header_.data_page_header_v2.num_values)) {
+        continue;
+      }
+    }
+
     int compressed_len = current_page_header_.compressed_page_size;
     int uncompressed_len = current_page_header_.uncompressed_page_size;
 
@@ -191,6 +234,7 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
 
     // Uncompress it if we need to
     if (decompressor_ != nullptr) {
+      ARROW_TRACE_SPAN("parquet", "decompress");
       // Grow the uncompressed buffer if we need to.
       if (uncompressed_len > static_cast<int>(decompression_buffer_->size())) {
         PARQUET_THROW_NOT_OK(decompression_buffer_->Resize(uncompressed_len, false));
@@ -666,8 +710,12 @@ bool TypedColumnReaderImpl<DType>::ReadNewPage() {
         current_decoder_ = it->second.get();
       } else {
         switch (encoding) {
-          case Encoding::PLAIN: {
-            auto decoder = MakeTypedDecoder<DType>(Encoding::PLAIN, descr_);
+          case Encoding::PLAIN:
+          case Encoding::DELTA_BINARY_PACKED:
+          case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+          case Encoding::DELTA_BYTE_ARRAY:
+          case Encoding::BYTE_STREAM_SPLIT: {
+            auto decoder = MakeTypedDecoder<DType>(encoding, descr_);
             current_decoder_ = decoder.get();
             decoders_[static_cast<int>(encoding)] = std::move(decoder);
             break;
@@ -675,11 +723,6 @@ bool TypedColumnReaderImpl<DType>::ReadNewPage() {
           case Encoding::RLE_DICTIONARY:
             throw ParquetException("Dictionary page must be before data page.");
 
-          case Encoding::DELTA_BINARY_PACKED:
-          case Encoding::DELTA_LENGTH_BYTE_ARRAY:
-          case Encoding::DELTA_BYTE_ARRAY:
-            ParquetException::NYI("Unsupported encoding");
-
           default:
             throw ParquetException("Unknown encoding type.");
         }
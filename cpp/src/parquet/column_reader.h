@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -73,6 +74,11 @@ class PARQUET_EXPORT LevelDecoder {
   // Decodes a batch of levels into an array and returns the number of levels decoded
   int Decode(int batch_size, int16_t* levels);
 
+  // For a maximum level of 1, decodes a batch of levels as the bits of
+  // valid_bits starting at valid_bits_offset, set where the level is 1, and
+  // returns the number of levels decoded
+  int DecodeBitmap(int batch_size, uint8_t* valid_bits, int64_t valid_bits_offset);
+
  private:
   int bit_width_;
   int num_values_remaining_;
@@ -97,6 +103,15 @@ class PARQUET_EXPORT PageReader {
   virtual std::shared_ptr<Page> NextPage() = 0;
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
+
+  /// \brief Decides from the number of values of a data page, before it is
+  /// read, whether to skip it. Dictionary pages are never skipped
+  using DataPageFilter = std::function<bool(int64_t num_values)>;
+
+  /// \brief Have NextPage pass over the data pages for which filter returns
+  /// true without reading or decompressing them. Readers which cannot do
+  /// so ignore the filter
+  virtual void set_data_page_filter(DataPageFilter filter) {}
 };
 
 class PARQUET_EXPORT ColumnReader {
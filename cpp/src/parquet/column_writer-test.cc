@@ -17,6 +17,9 @@
 
 #include <gtest/gtest.h>
 
+#include <numeric>
+#include <string>
+
 #include <arrow/testing/gtest_util.h>
 
 #include "parquet/column_reader.h"
@@ -100,6 +103,10 @@ class TestPrimitiveWriter : public PrimitiveTypedTest<TestType> {
       wp_builder.encoding(column_properties.encoding());
     }
     wp_builder.max_statistics_size(column_properties.max_statistics_size());
+    if (column_properties.adaptive_encoding_enabled()) {
+      wp_builder.enable_adaptive_encoding(
+          column_properties.adaptive_encoding_sample_size());
+    }
     writer_properties_ = wp_builder.build();
 
     metadata_ = ColumnChunkMetaDataBuilder::Make(writer_properties_, this->descr_);
@@ -366,22 +373,96 @@ TYPED_TEST(TestPrimitiveWriter, RequiredBitPacked) {
   this->TestRequiredWithEncoding(Encoding::BIT_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaBinaryPacked) {
+TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
+  this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
+}
+*/
+
+// The delta encodings only apply to some physical types
+using TestInt32ValuesWriter = TestPrimitiveWriter<Int32Type>;
+using TestInt64ValuesWriter = TestPrimitiveWriter<Int64Type>;
+
+TEST_F(TestInt32ValuesWriter, RequiredDeltaBinaryPacked) {
   this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaLengthByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+TEST_F(TestInt64ValuesWriter, RequiredDeltaBinaryPacked) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BINARY_PACKED);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredDeltaByteArray) {
-  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
+TEST_F(TestInt64ValuesWriter, OptionalDeltaBinaryPacked) {
+  this->SetUpSchema(Repetition::OPTIONAL);
+  this->GenerateData(SMALL_SIZE);
+  std::vector<int16_t> definition_levels(SMALL_SIZE, 1);
+  definition_levels[1] = 0;
+
+  ColumnProperties column_properties(Encoding::DELTA_BINARY_PACKED);
+  auto writer = this->BuildWriter(SMALL_SIZE, column_properties);
+  writer->WriteBatch(this->values_.size(), definition_levels.data(), nullptr,
+                     this->values_ptr_);
+  writer->Close();
+
+  this->ReadColumn();
+  ASSERT_EQ(99, this->values_read_);
+  this->values_out_.resize(99);
+  this->values_.resize(99);
+  ASSERT_EQ(this->values_, this->values_out_);
 }
 
-TYPED_TEST(TestPrimitiveWriter, RequiredRLEDictionary) {
-  this->TestRequiredWithEncoding(Encoding::RLE_DICTIONARY);
+TEST_F(TestInt32ValuesWriter, OptionalWriteArrow) {
+  this->SetUpSchema(Repetition::OPTIONAL);
+  this->GenerateData(SMALL_SIZE);
+  std::vector<bool> is_valid(SMALL_SIZE, true);
+  is_valid[1] = false;
+  is_valid[SMALL_SIZE - 1] = false;
+  std::shared_ptr<::arrow::Array> array;
+  ::arrow::ArrayFromVector<::arrow::Int32Type, int32_t>(is_valid, this->values_, &array);
+
+  // The definition levels are derived from the validity bitmap
+  auto writer = this->BuildWriter();
+  ASSERT_TRUE(writer->WriteArrow(SMALL_SIZE, nullptr, nullptr, *array));
+  writer->Close();
+
+  ASSERT_EQ(SMALL_SIZE, this->metadata_num_values());
+  ASSERT_TRUE(this->metadata_is_stats_set());
+
+  this->ReadColumn();
+  ASSERT_EQ(SMALL_SIZE - 2, this->values_read_);
+  ASSERT_EQ(0, this->definition_levels_out_[1]);
+  ASSERT_EQ(0, this->definition_levels_out_[SMALL_SIZE - 1]);
+  this->values_out_.resize(SMALL_SIZE - 2);
+  this->values_.resize(SMALL_SIZE - 1);
+  this->values_.erase(this->values_.begin() + 1);
+  ASSERT_EQ(this->values_, this->values_out_);
+}
+
+TEST_F(TestInt32ValuesWriter, WriteArrowUnsupported) {
+  this->GenerateData(SMALL_SIZE);
+  std::shared_ptr<::arrow::Array> array;
+  ::arrow::ArrayFromVector<::arrow::Int32Type, int32_t>(this->values_, &array);
+  std::vector<int64_t> values(this->values_.begin(), this->values_.end());
+  std::shared_ptr<::arrow::Array> int64_array;
+  ::arrow::ArrayFromVector<::arrow::Int64Type, int64_t>(values, &int64_array);
+
+  // Another array type, or fewer levels than entries
+  auto writer = this->BuildWriter();
+  ASSERT_FALSE(writer->WriteArrow(SMALL_SIZE, nullptr, nullptr, *int64_array));
+  ASSERT_FALSE(writer->WriteArrow(SMALL_SIZE - 1, nullptr, nullptr, *array));
+  writer->Close();
+  ASSERT_EQ(0, this->metadata_num_values());
+}
+
+using TestFloatValuesWriter = TestPrimitiveWriter<FloatType>;
+using TestDoubleValuesWriter = TestPrimitiveWriter<DoubleType>;
+
+TEST_F(TestFloatValuesWriter, RequiredByteStreamSplit) {
+  this->TestRequiredWithEncoding(Encoding::BYTE_STREAM_SPLIT);
+}
+
+TEST_F(TestDoubleValuesWriter, RequiredByteStreamSplitWithGzipCompression) {
+  this->TestRequiredWithSettings(Encoding::BYTE_STREAM_SPLIT, Compression::GZIP, false,
+                                 false, LARGE_SIZE);
 }
-*/
 
 TYPED_TEST(TestPrimitiveWriter, RequiredPlainWithSnappyCompression) {
   this->TestRequiredWithSettings(Encoding::PLAIN, Compression::SNAPPY, false, false,
@@ -541,6 +622,55 @@ TYPED_TEST(TestPrimitiveWriter, DictionaryFallbackVersion2_0) {
   this->TestDictionaryFallbackEncoding(ParquetVersion::PARQUET_2_0);
 }
 
+TYPED_TEST(TestPrimitiveWriter, AdaptiveEncoding) {
+  this->GenerateData(LARGE_SIZE);
+  ColumnProperties column_properties(Encoding::RLE_DICTIONARY);
+  column_properties.set_adaptive_encoding(SMALL_SIZE);
+  auto writer =
+      this->BuildWriter(LARGE_SIZE, column_properties, ParquetVersion::PARQUET_2_0);
+  writer->WriteBatch(this->values_.size(), nullptr, nullptr, this->values_ptr_);
+  writer->Close();
+  ASSERT_NO_FATAL_FAILURE(this->ReadAndCompare(Compression::UNCOMPRESSED, LARGE_SIZE));
+}
+
+TEST_F(TestInt32ValuesWriter, AdaptiveEncodingDropsDictionary) {
+  // Distinct values in order are best delta encoded
+  this->values_.resize(LARGE_SIZE);
+  std::iota(this->values_.begin(), this->values_.end(), 0);
+  this->values_ptr_ = this->values_.data();
+  ColumnProperties column_properties(Encoding::RLE_DICTIONARY);
+  column_properties.set_adaptive_encoding(SMALL_SIZE);
+  auto writer =
+      this->BuildWriter(LARGE_SIZE, column_properties, ParquetVersion::PARQUET_2_0);
+  writer->WriteBatch(this->values_.size(), nullptr, nullptr, this->values_ptr_);
+  writer->Close();
+  ASSERT_NO_FATAL_FAILURE(this->ReadAndCompare(Compression::UNCOMPRESSED, LARGE_SIZE));
+
+  std::vector<Encoding::type> expected({Encoding::RLE_DICTIONARY, Encoding::PLAIN,
+                                        Encoding::RLE, Encoding::DELTA_BINARY_PACKED});
+  ASSERT_EQ(expected, this->metadata_encodings());
+}
+
+TEST_F(TestInt32ValuesWriter, AdaptiveEncodingKeepsDictionary) {
+  this->values_.resize(LARGE_SIZE);
+  for (int i = 0; i < LARGE_SIZE; ++i) {
+    // Few distinct values, far apart
+    this->values_[i] = ((i * 7) % 10) * 100000007;
+  }
+  this->values_ptr_ = this->values_.data();
+  ColumnProperties column_properties(Encoding::RLE_DICTIONARY);
+  column_properties.set_adaptive_encoding(SMALL_SIZE);
+  auto writer =
+      this->BuildWriter(LARGE_SIZE, column_properties, ParquetVersion::PARQUET_2_0);
+  writer->WriteBatch(this->values_.size(), nullptr, nullptr, this->values_ptr_);
+  writer->Close();
+  ASSERT_NO_FATAL_FAILURE(this->ReadAndCompare(Compression::UNCOMPRESSED, LARGE_SIZE));
+
+  std::vector<Encoding::type> expected(
+      {Encoding::RLE_DICTIONARY, Encoding::PLAIN, Encoding::RLE});
+  ASSERT_EQ(expected, this->metadata_encodings());
+}
+
 // PARQUET-719
 // Test case for NULL values
 TEST_F(TestNullValuesWriter, OptionalNullValueChunk) {
@@ -623,6 +753,37 @@ TEST_F(TestByteArrayValuesWriter, CheckDefaultStats) {
   ASSERT_TRUE(this->metadata_is_stats_set());
 }
 
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaLengthByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+}
+
+TEST_F(TestByteArrayValuesWriter, RequiredDeltaByteArray) {
+  this->TestRequiredWithEncoding(Encoding::DELTA_BYTE_ARRAY);
+}
+
+TEST_F(TestByteArrayValuesWriter, AdaptiveEncodingWithoutDictionary) {
+  // Values sharing long prefixes are best encoded with DELTA_BYTE_ARRAY
+  std::vector<std::string> strings(LARGE_SIZE);
+  this->values_.resize(LARGE_SIZE);
+  for (int i = 0; i < LARGE_SIZE; ++i) {
+    strings[i] = "a fairly long common prefix " + std::to_string(i);
+    this->values_[i] = ByteArray(static_cast<uint32_t>(strings[i].size()),
+                                 reinterpret_cast<const uint8_t*>(strings[i].data()));
+  }
+  this->values_ptr_ = this->values_.data();
+  ColumnProperties column_properties(Encoding::PLAIN);
+  column_properties.set_adaptive_encoding(SMALL_SIZE);
+  auto writer =
+      this->BuildWriter(LARGE_SIZE, column_properties, ParquetVersion::PARQUET_2_0);
+  writer->WriteBatch(this->values_.size(), nullptr, nullptr, this->values_ptr_);
+  writer->Close();
+  ASSERT_NO_FATAL_FAILURE(this->ReadAndCompare(Compression::UNCOMPRESSED, LARGE_SIZE));
+
+  std::vector<Encoding::type> expected(
+      {Encoding::PLAIN, Encoding::DELTA_BYTE_ARRAY, Encoding::RLE});
+  ASSERT_EQ(expected, this->metadata_encodings());
+}
+
 TEST(TestColumnWriter, RepeatedListsUpdateSpacedBug) {
   // In ARROW-3930 we discovered a bug when writing from Arrow when we had data
   // that looks like this:
@@ -832,6 +993,39 @@ TEST(TestLevels, TestLevelsDecodeMultipleSetData) {
   }
 }
 
+// Levels of a flat optional column decoded as a validity bitmap
+TEST(TestLevels, TestLevelsDecodeBitmap) {
+  // Start off a byte boundary of the bitmap
+  const int64_t bitmap_offset = 3;
+
+  for (auto encoding : {Encoding::RLE, Encoding::BIT_PACKED}) {
+    std::vector<int16_t> input_levels;
+    std::vector<uint8_t> bytes;
+    // BIT_PACKED requires a sequence of atleast 8
+    GenerateLevels(encoding == Encoding::RLE ? 0 : 3, 7, 1, input_levels);
+    const int num_levels = static_cast<int>(input_levels.size());
+    ASSERT_NO_FATAL_FAILURE(
+        EncodeLevels(encoding, 1, num_levels, input_levels.data(), bytes));
+    LevelDecoder decoder;
+    decoder.SetData(encoding, 1, num_levels, bytes.data());
+
+    std::vector<uint8_t> valid_bits(
+        static_cast<size_t>(BitUtil::BytesForBits(bitmap_offset + num_levels)), 0xFF);
+    int levels_count = 0;
+    // Batches that end in the middle of runs
+    for (int batch_size : {1, 13, 100, num_levels}) {
+      levels_count += decoder.DecodeBitmap(batch_size, valid_bits.data(),
+                                           bitmap_offset + levels_count);
+    }
+    ASSERT_EQ(num_levels, levels_count);
+    ASSERT_EQ(0, decoder.DecodeBitmap(1, valid_bits.data(), 0));
+    for (int i = 0; i < num_levels; i++) {
+      EXPECT_EQ(input_levels[i] == 1,
+                BitUtil::GetBit(valid_bits.data(), bitmap_offset + i));
+    }
+  }
+}
+
 TEST(TestLevelEncoder, MinimumBufferSize) {
   // PARQUET-676, PARQUET-698
   const int kNumToEncode = 1024;
@@ -19,18 +19,28 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <deque>
+#include <limits>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
+#include "arrow/array.h"
 #include "arrow/status.h"
 #include "arrow/util/bit-stream-utils.h"
 #include "arrow/util/bit-util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle-encoding.h"
+#include "arrow/util/thread-pool.h"
+#include "arrow/util/tracing.h"
 
+#include "parquet/bloom_filter.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 #include "parquet/thrift.h"
@@ -140,7 +150,8 @@ class SerializedPageWriter : public PageWriter {
  public:
   SerializedPageWriter(OutputStream* sink, Compression::type codec,
                        ColumnChunkMetaDataBuilder* metadata,
-                       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool())
+                       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
+                       bool write_page_index = false)
       : sink_(sink),
         metadata_(metadata),
         pool_(pool),
@@ -148,7 +159,11 @@ class SerializedPageWriter : public PageWriter {
         dictionary_page_offset_(0),
         data_page_offset_(0),
         total_uncompressed_size_(0),
-        total_compressed_size_(0) {
+        total_compressed_size_(0),
+        // Page boundaries of repeated columns do not fall on row boundaries
+        // in this writer, so first_row_index would be wrong for them
+        write_page_index_(write_page_index &&
+                          metadata->descr()->max_repetition_level() == 0) {
     compressor_ = GetCodecFromArrow(codec);
     thrift_serializer_.reset(new ThriftSerializer);
   }
@@ -195,6 +210,7 @@ class SerializedPageWriter : public PageWriter {
     metadata_->Finish(num_values_, dictionary_page_offset_, -1, data_page_offset_,
                       total_compressed_size_, total_uncompressed_size_, has_dictionary,
                       fallback);
+    FinishPageIndex(0);
 
     // Write metadata at end of column chunk
     metadata_->WriteTo(sink_);
@@ -204,6 +220,7 @@ class SerializedPageWriter : public PageWriter {
    * Compress a buffer.
    */
   void Compress(const Buffer& src_buffer, ResizableBuffer* dest_buffer) override {
+    ARROW_TRACE_SPAN("parquet", "compress");
     DCHECK(compressor_ != nullptr);
 
     // Compress the data
@@ -249,6 +266,13 @@ class SerializedPageWriter : public PageWriter {
     int64_t header_size = thrift_serializer_->Serialize(&page_header, sink_);
     sink_->Write(compressed_data->data(), compressed_data->size());
 
+    if (write_page_index_) {
+      page_locations_.push_back(
+          {start_pos, static_cast<int32_t>(header_size + compressed_data->size()),
+           num_values_});
+      page_statistics_.push_back(page.statistics());
+    }
+
     total_uncompressed_size_ += uncompressed_size + header_size;
     total_compressed_size_ += compressed_data->size() + header_size;
     num_values_ += page.num_values();
@@ -268,6 +292,44 @@ class SerializedPageWriter : public PageWriter {
 
   int64_t total_uncompressed_size() { return total_uncompressed_size_; }
 
+  // Pass the page index of the chunk to the metadata builder. base_offset is
+  // added to the page offsets, which are relative to sink_
+  void FinishPageIndex(int64_t base_offset) {
+    if (!write_page_index_ || page_locations_.empty()) {
+      return;
+    }
+    for (PageLocation& location : page_locations_) {
+      location.offset += base_offset;
+    }
+    auto offset_index = std::make_shared<OffsetIndex>(page_locations_);
+
+    // The column index needs the statistics of every page
+    std::shared_ptr<ColumnIndex> column_index;
+    const ColumnDescriptor* descr = metadata_->descr();
+    bool has_statistics = descr->sort_order() != SortOrder::UNKNOWN;
+    for (const EncodedStatistics& statistics : page_statistics_) {
+      has_statistics = has_statistics && statistics.has_null_count;
+    }
+    if (has_statistics) {
+      std::vector<bool> null_pages;
+      std::vector<std::string> min_values;
+      std::vector<std::string> max_values;
+      std::vector<int64_t> null_counts;
+      for (const EncodedStatistics& statistics : page_statistics_) {
+        bool null_page = !statistics.has_min || !statistics.has_max;
+        null_pages.push_back(null_page);
+        min_values.push_back(null_page ? "" : statistics.min());
+        max_values.push_back(null_page ? "" : statistics.max());
+        null_counts.push_back(statistics.null_count);
+      }
+      BoundaryOrder::type boundary_order =
+          ColumnIndex::DetermineBoundaryOrder(descr, null_pages, min_values, max_values);
+      column_index = std::make_shared<ColumnIndex>(boundary_order, null_pages,
+                                                   min_values, max_values, null_counts);
+    }
+    metadata_->SetPageIndex(column_index, offset_index);
+  }
+
  private:
   OutputStream* sink_;
   ColumnChunkMetaDataBuilder* metadata_;
@@ -278,6 +340,10 @@ class SerializedPageWriter : public PageWriter {
   int64_t total_uncompressed_size_;
   int64_t total_compressed_size_;
 
+  bool write_page_index_;
+  std::vector<PageLocation> page_locations_;
+  std::vector<EncodedStatistics> page_statistics_;
+
   std::unique_ptr<ThriftSerializer> thrift_serializer_;
 
   // Compression codec to use.
@@ -289,11 +355,13 @@ class BufferedPageWriter : public PageWriter {
  public:
   BufferedPageWriter(OutputStream* sink, Compression::type codec,
                      ColumnChunkMetaDataBuilder* metadata,
-                     ::arrow::MemoryPool* pool = ::arrow::default_memory_pool())
+                     ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
+                     bool write_page_index = false)
       : final_sink_(sink),
         metadata_(metadata),
         in_memory_sink_(new InMemoryOutputStream(pool)),
-        pager_(new SerializedPageWriter(in_memory_sink_.get(), codec, metadata, pool)) {}
+        pager_(new SerializedPageWriter(in_memory_sink_.get(), codec, metadata, pool,
+                                        write_page_index)) {}
 
   int64_t WriteDictionaryPage(const DictionaryPage& page) override {
     return pager_->WriteDictionaryPage(page);
@@ -305,6 +373,7 @@ class BufferedPageWriter : public PageWriter {
         pager_->num_values(), pager_->dictionary_page_offset() + final_sink_->Tell(), -1,
         pager_->data_page_offset() + final_sink_->Tell(), pager_->total_compressed_size(),
         pager_->total_uncompressed_size(), has_dictionary, fallback);
+    pager_->FinishPageIndex(final_sink_->Tell());
 
     // Write metadata at end of column chunk
     metadata_->WriteTo(in_memory_sink_.get());
@@ -334,19 +403,55 @@ class BufferedPageWriter : public PageWriter {
 std::unique_ptr<PageWriter> PageWriter::Open(OutputStream* sink, Compression::type codec,
                                              ColumnChunkMetaDataBuilder* metadata,
                                              ::arrow::MemoryPool* pool,
-                                             bool buffered_row_group) {
+                                             bool buffered_row_group,
+                                             bool write_page_index) {
   if (buffered_row_group) {
     return std::unique_ptr<PageWriter>(
-        new BufferedPageWriter(sink, codec, metadata, pool));
+        new BufferedPageWriter(sink, codec, metadata, pool, write_page_index));
   } else {
     return std::unique_ptr<PageWriter>(
-        new SerializedPageWriter(sink, codec, metadata, pool));
+        new SerializedPageWriter(sink, codec, metadata, pool, write_page_index));
   }
 }
 
 // ----------------------------------------------------------------------
 // ColumnWriter
 
+namespace {
+
+::arrow::Status CompressPage(::arrow::util::Codec* codec, const Buffer& src_buffer,
+                             ::arrow::MemoryPool* pool, std::shared_ptr<Buffer>* out) {
+  int64_t max_compressed_size =
+      codec->MaxCompressedLen(src_buffer.size(), src_buffer.data());
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(::arrow::AllocateResizableBuffer(pool, max_compressed_size, &buffer));
+  int64_t compressed_size;
+  RETURN_NOT_OK(codec->Compress(src_buffer.size(), src_buffer.data(), max_compressed_size,
+                                buffer->mutable_data(), &compressed_size));
+  // The page may be buffered until the end of the column chunk
+  RETURN_NOT_OK(buffer->Resize(compressed_size));
+  *out = buffer;
+  return ::arrow::Status::OK();
+}
+
+// Wait for the result of a CPU thread pool task. When already running on the
+// pool, e.g. when columns are written in parallel, run pending tasks meanwhile
+// rather than tie up a worker that may be needed to run ours.
+template <typename T>
+::arrow::Status WaitForCpuTask(const ::arrow::Future<T>& future, T* out) {
+  auto pool = ::arrow::internal::GetCpuThreadPool();
+  if (pool->OwnsThisThread()) {
+    while (!future.is_finished()) {
+      if (!pool->RunPendingTask()) {
+        future.Wait(0.001);
+      }
+    }
+  }
+  return future.Get(out);
+}
+
+}  // namespace
+
 std::shared_ptr<WriterProperties> default_writer_properties() {
   static std::shared_ptr<WriterProperties> default_writer_properties =
       WriterProperties::Builder().build();
@@ -383,6 +488,19 @@ class ColumnWriterImpl {
     if (pager_->has_compressor()) {
       compressed_data_ =
           std::static_pointer_cast<ResizableBuffer>(AllocateBuffer(allocator_, 0));
+      // Codecs may keep state, so that every page being compressed gets its own
+      for (int i = 0; i < properties->max_pending_compressed_pages(); ++i) {
+        compressors_.push_back(
+            GetCodecFromArrow(properties->compression(descr_->path())));
+      }
+    }
+    if (properties->bloom_filter_enabled(descr_->path()) &&
+        descr_->physical_type() != Type::BOOLEAN) {
+      uint32_t num_bits = BlockSplitBloomFilter::OptimalNumOfBits(
+          static_cast<uint32_t>(properties->bloom_filter_ndv(descr_->path())),
+          properties->bloom_filter_fpp(descr_->path()));
+      bloom_filter_ = std::make_shared<BlockSplitBloomFilter>();
+      bloom_filter_->Init(num_bits / 8);
     }
   }
 
@@ -412,6 +530,13 @@ class ColumnWriterImpl {
   // Serializes Data Pages
   void WriteDataPage(const CompressedDataPage& page);
 
+  // Hands the page in uncompressed_data_ to the CPU thread pool for compression
+  void AddPendingDataPage(int64_t uncompressed_size, const EncodedStatistics& page_stats);
+
+  // Waits for the compression of the oldest pending page and serializes or
+  // buffers it
+  void FinishPendingDataPage();
+
   // Write multiple definition levels
   void WriteDefinitionLevels(int64_t num_levels, const int16_t* levels) {
     DCHECK(!closed_);
@@ -433,6 +558,14 @@ class ColumnWriterImpl {
   // Serialize the buffered Data Pages
   void FlushBufferedDataPages();
 
+  // Records an encoding the data pages to come are not dictionary encoded with
+  void AddDataPageEncoding(Encoding::type encoding) {
+    if (std::find(data_page_encodings_.begin(), data_page_encodings_.end(), encoding) ==
+        data_page_encodings_.end()) {
+      data_page_encodings_.push_back(encoding);
+    }
+  }
+
   ColumnChunkMetaDataBuilder* metadata_;
   const ColumnDescriptor* descr_;
 
@@ -484,6 +617,28 @@ class ColumnWriterImpl {
 
   std::vector<CompressedDataPage> data_pages_;
 
+  // Data pages being compressed with parallel compression, oldest first
+  struct PendingDataPage {
+    ::arrow::Future<std::shared_ptr<Buffer>> compressed_data;
+    int32_t num_values;
+    Encoding::type encoding;
+    int64_t uncompressed_size;
+    EncodedStatistics statistics;
+    // Whether the page is to be buffered until the dictionary page is written
+    bool buffered;
+  };
+  std::deque<PendingDataPage> pending_pages_;
+  // The codec of pending page i is compressors_[i % compressors_.size()]
+  std::vector<std::shared_ptr<::arrow::util::Codec>> compressors_;
+  int64_t num_pending_pages_added_ = 0;
+
+  // Holds the hashes of all values written, if enabled
+  std::shared_ptr<BlockSplitBloomFilter> bloom_filter_;
+
+  // The encodings of the data pages not dictionary encoded, if they may differ
+  // from the one the WriterProperties set for the column
+  std::vector<Encoding::type> data_page_encodings_;
+
  private:
   void InitSinks() {
     definition_levels_sink_->Clear();
@@ -552,6 +707,14 @@ void ColumnWriterImpl::AddDataPage() {
   EncodedStatistics page_stats = GetPageStatistics();
   ResetPageStatistics();
 
+  if (!compressors_.empty()) {
+    AddPendingDataPage(uncompressed_size, page_stats);
+    InitSinks();
+    num_buffered_values_ = 0;
+    num_buffered_encoded_values_ = 0;
+    return;
+  }
+
   std::shared_ptr<Buffer> compressed_data;
   if (pager_->has_compressor()) {
     pager_->Compress(*(uncompressed_data_.get()), compressed_data_.get());
@@ -588,6 +751,58 @@ void ColumnWriterImpl::WriteDataPage(const CompressedDataPage& page) {
   total_bytes_written_ += pager_->WriteDataPage(page);
 }
 
+void ColumnWriterImpl::AddPendingDataPage(int64_t uncompressed_size,
+                                          const EncodedStatistics& page_stats) {
+  // Bound the memory held by pages in flight
+  if (pending_pages_.size() == compressors_.size()) {
+    FinishPendingDataPage();
+  }
+
+  // The task keeps the page's data, the next page gets a new buffer
+  std::shared_ptr<Buffer> uncompressed_data = uncompressed_data_;
+  uncompressed_data_ =
+      std::static_pointer_cast<ResizableBuffer>(AllocateBuffer(allocator_, 0));
+  std::shared_ptr<::arrow::util::Codec> codec =
+      compressors_[num_pending_pages_added_++ % compressors_.size()];
+  ::arrow::MemoryPool* pool = allocator_;
+
+  PendingDataPage page;
+  page.compressed_data =
+      ::arrow::internal::GetCpuThreadPool()->SubmitAsync<std::shared_ptr<Buffer>>(
+          [uncompressed_data, codec, pool](std::shared_ptr<Buffer>* out) {
+            return CompressPage(codec.get(), *uncompressed_data, pool, out);
+          });
+  page.num_values = static_cast<int32_t>(num_buffered_values_);
+  page.encoding = encoding_;
+  page.uncompressed_size = uncompressed_size;
+  page.statistics = page_stats;
+  page.buffered = has_dictionary_ && !fallback_;
+  pending_pages_.push_back(std::move(page));
+
+  // Serialize the pages compressed meanwhile
+  while (!pending_pages_.empty() &&
+         pending_pages_.front().compressed_data.is_finished()) {
+    FinishPendingDataPage();
+  }
+}
+
+void ColumnWriterImpl::FinishPendingDataPage() {
+  PendingDataPage pending = std::move(pending_pages_.front());
+  pending_pages_.pop_front();
+
+  std::shared_ptr<Buffer> compressed_data;
+  PARQUET_THROW_NOT_OK(WaitForCpuTask(pending.compressed_data, &compressed_data));
+  CompressedDataPage page(compressed_data, pending.num_values, pending.encoding,
+                          Encoding::RLE, Encoding::RLE, pending.uncompressed_size,
+                          pending.statistics);
+  if (pending.buffered) {
+    total_compressed_bytes_ += page.size() + sizeof(format::PageHeader);
+    data_pages_.push_back(std::move(page));
+  } else {
+    WriteDataPage(page);
+  }
+}
+
 int64_t ColumnWriterImpl::Close() {
   if (!closed_) {
     closed_ = true;
@@ -610,6 +825,12 @@ int64_t ColumnWriterImpl::Close() {
       metadata_->SetStatistics(SortOrder::SIGNED == descr_->sort_order(),
                                chunk_statistics);
     }
+    if (bloom_filter_ != nullptr) {
+      metadata_->SetBloomFilter(bloom_filter_);
+    }
+    if (!data_page_encodings_.empty()) {
+      metadata_->set_data_page_encodings(data_page_encodings_);
+    }
     pager_->Close(has_dictionary_, fallback_);
   }
 
@@ -621,6 +842,9 @@ void ColumnWriterImpl::FlushBufferedDataPages() {
   if (num_buffered_values_ > 0) {
     AddDataPage();
   }
+  while (!pending_pages_.empty()) {
+    FinishPendingDataPage();
+  }
   for (size_t i = 0; i < data_pages_.size(); i++) {
     WriteDataPage(data_pages_[i]);
   }
@@ -628,6 +852,247 @@ void ColumnWriterImpl::FlushBufferedDataPages() {
   total_compressed_bytes_ = 0;
 }
 
+// ----------------------------------------------------------------------
+// Arrow dictionaries
+
+namespace {
+
+// Views the values of an Arrow dictionary as values of the Parquet physical
+// type, referencing the dictionary's data. Returns false if the dictionary's
+// type does not store such values
+template <typename DType>
+struct ArrowDictionaryValues {
+  static bool View(const ::arrow::Array& dictionary, const ColumnDescriptor* descr,
+                   std::vector<typename DType::c_type>* out) {
+    return false;
+  }
+};
+
+template <typename DType, typename ArrowType>
+struct ArrowPrimitiveDictionaryValues {
+  static bool View(const ::arrow::Array& dictionary, const ColumnDescriptor* descr,
+                   std::vector<typename DType::c_type>* out) {
+    if (dictionary.type_id() != ArrowType::type_id) {
+      return false;
+    }
+    const auto& values = static_cast<const ::arrow::NumericArray<ArrowType>&>(dictionary);
+    out->assign(values.raw_values(), values.raw_values() + values.length());
+    return true;
+  }
+};
+
+template <>
+struct ArrowDictionaryValues<Int32Type>
+    : public ArrowPrimitiveDictionaryValues<Int32Type, ::arrow::Int32Type> {};
+
+template <>
+struct ArrowDictionaryValues<Int64Type>
+    : public ArrowPrimitiveDictionaryValues<Int64Type, ::arrow::Int64Type> {};
+
+template <>
+struct ArrowDictionaryValues<FloatType>
+    : public ArrowPrimitiveDictionaryValues<FloatType, ::arrow::FloatType> {};
+
+template <>
+struct ArrowDictionaryValues<DoubleType>
+    : public ArrowPrimitiveDictionaryValues<DoubleType, ::arrow::DoubleType> {};
+
+template <>
+struct ArrowDictionaryValues<ByteArrayType> {
+  static bool View(const ::arrow::Array& dictionary, const ColumnDescriptor* descr,
+                   std::vector<ByteArray>* out) {
+    if (dictionary.type_id() != ::arrow::Type::BINARY &&
+        dictionary.type_id() != ::arrow::Type::STRING) {
+      return false;
+    }
+    const auto& values = static_cast<const ::arrow::BinaryArray&>(dictionary);
+    out->resize(values.length());
+    for (int64_t i = 0; i < values.length(); ++i) {
+      int32_t length;
+      const uint8_t* ptr = values.GetValue(i, &length);
+      (*out)[i] = ByteArray(static_cast<uint32_t>(length), ptr);
+    }
+    return true;
+  }
+};
+
+template <>
+struct ArrowDictionaryValues<FLBAType> {
+  static bool View(const ::arrow::Array& dictionary, const ColumnDescriptor* descr,
+                   std::vector<FLBA>* out) {
+    if (dictionary.type_id() != ::arrow::Type::FIXED_SIZE_BINARY) {
+      return false;
+    }
+    const auto& values = static_cast<const ::arrow::FixedSizeBinaryArray&>(dictionary);
+    if (values.byte_width() != descr->type_length()) {
+      return false;
+    }
+    out->resize(values.length());
+    for (int64_t i = 0; i < values.length(); ++i) {
+      (*out)[i] = FLBA(values.GetValue(i));
+    }
+    return true;
+  }
+};
+
+// Arrow types whose values are stored as those of the Parquet physical type,
+// for WriteArrow to encode them from the array's buffer
+template <typename DType>
+struct ArrowPrimitiveValues {
+  static bool Accepts(const ::arrow::DataType& type) { return false; }
+};
+
+template <>
+struct ArrowPrimitiveValues<Int32Type> {
+  static bool Accepts(const ::arrow::DataType& type) {
+    return type.id() == ::arrow::Type::INT32 || type.id() == ::arrow::Type::DATE32;
+  }
+};
+
+template <>
+struct ArrowPrimitiveValues<Int64Type> {
+  static bool Accepts(const ::arrow::DataType& type) {
+    return type.id() == ::arrow::Type::INT64 || type.id() == ::arrow::Type::TIME64;
+  }
+};
+
+template <>
+struct ArrowPrimitiveValues<FloatType> {
+  static bool Accepts(const ::arrow::DataType& type) {
+    return type.id() == ::arrow::Type::FLOAT;
+  }
+};
+
+template <>
+struct ArrowPrimitiveValues<DoubleType> {
+  static bool Accepts(const ::arrow::DataType& type) {
+    return type.id() == ::arrow::Type::DOUBLE;
+  }
+};
+
+// Copies the indices of a DictionaryArray, checking the valid ones against the
+// dictionary length
+template <typename ArrowType>
+void CopyDictionaryIndices(const ::arrow::Array& indices, int64_t dictionary_length,
+                           int32_t* out) {
+  const auto* values =
+      static_cast<const ::arrow::NumericArray<ArrowType>&>(indices).raw_values();
+  for (int64_t i = 0; i < indices.length(); ++i) {
+    if (indices.IsNull(i)) {
+      out[i] = 0;
+      continue;
+    }
+    if (ARROW_PREDICT_FALSE(values[i] < 0 || values[i] >= dictionary_length)) {
+      throw ParquetException("Dictionary index out of range");
+    }
+    out[i] = static_cast<int32_t>(values[i]);
+  }
+}
+
+void CopyDictionaryIndices(const ::arrow::Array& indices, int64_t dictionary_length,
+                           int32_t* out) {
+  switch (indices.type_id()) {
+    case ::arrow::Type::INT8:
+      return CopyDictionaryIndices<::arrow::Int8Type>(indices, dictionary_length, out);
+    case ::arrow::Type::INT16:
+      return CopyDictionaryIndices<::arrow::Int16Type>(indices, dictionary_length, out);
+    case ::arrow::Type::INT32:
+      return CopyDictionaryIndices<::arrow::Int32Type>(indices, dictionary_length, out);
+    case ::arrow::Type::INT64:
+      return CopyDictionaryIndices<::arrow::Int64Type>(indices, dictionary_length, out);
+    default:
+      throw ParquetException("Dictionary indices must be signed integers, got " +
+                             indices.type()->ToString());
+  }
+}
+
+// Calls visit(i) for the num_spaced entries valid in valid_bits (all of them if
+// it is null)
+template <typename Visitor>
+void VisitValidEntries(int64_t num_spaced, const uint8_t* valid_bits,
+                       int64_t valid_bits_offset, Visitor&& visit) {
+  if (valid_bits == nullptr) {
+    for (int64_t i = 0; i < num_spaced; ++i) {
+      visit(i);
+    }
+    return;
+  }
+  ::arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                    num_spaced);
+  for (int64_t i = 0; i < num_spaced; ++i) {
+    if (valid_bits_reader.IsSet()) {
+      visit(i);
+    }
+    valid_bits_reader.Next();
+  }
+}
+
+// The hash a Bloom filter holds for a value, that of its plain encoding
+template <typename T>
+uint64_t BloomFilterHash(const BloomFilter& filter, const T& value, int type_length) {
+  return filter.Hash(value);
+}
+
+// Only instantiated, BOOLEAN columns get no Bloom filter
+inline uint64_t BloomFilterHash(const BloomFilter& filter, bool value, int type_length) {
+  return filter.Hash(static_cast<int32_t>(value));
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const Int96& value,
+                                int type_length) {
+  return filter.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const ByteArray& value,
+                                int type_length) {
+  return filter.Hash(&value);
+}
+
+inline uint64_t BloomFilterHash(const BloomFilter& filter, const FLBA& value,
+                                int type_length) {
+  return filter.Hash(&value, static_cast<uint32_t>(type_length));
+}
+
+// The encodings other than dictionary encoding adaptive encoding chooses from
+std::vector<Encoding::type> AdaptiveEncodingCandidates(Type::type type_num,
+                                                       Encoding::type configured,
+                                                       ParquetVersion::type version,
+                                                       bool compressed) {
+  // The configured encoding comes first, to be kept on ties
+  std::vector<Encoding::type> candidates({configured});
+  auto add = [&candidates](Encoding::type encoding) {
+    if (std::find(candidates.begin(), candidates.end(), encoding) == candidates.end()) {
+      candidates.push_back(encoding);
+    }
+  };
+  add(Encoding::PLAIN);
+  // Readers of PARQUET_1_0 files may not support the other encodings
+  if (version == ParquetVersion::PARQUET_2_0) {
+    switch (type_num) {
+      case Type::INT32:
+      case Type::INT64:
+        add(Encoding::DELTA_BINARY_PACKED);
+        break;
+      case Type::BYTE_ARRAY:
+        add(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+        add(Encoding::DELTA_BYTE_ARRAY);
+        break;
+      case Type::FLOAT:
+      case Type::DOUBLE:
+        // Only helps compression
+        if (compressed) {
+          add(Encoding::BYTE_STREAM_SPLIT);
+        }
+        break;
+      default:
+        break;
+    }
+  }
+  return candidates;
+}
+
+}  // namespace
+
 // ----------------------------------------------------------------------
 // TypedColumnWriter
 
@@ -643,6 +1108,10 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
                          properties) {
     current_encoder_ = MakeEncoder(DType::type_num, encoding, use_dictionary, descr_,
                                    properties->memory_pool());
+    if (properties->adaptive_encoding_enabled(descr_->path()) &&
+        DType::type_num != Type::BOOLEAN) {
+      InitEncodingSample();
+    }
 
     if (properties->statistics_enabled(descr_->path()) &&
         (SortOrder::UNKNOWN != descr_->sort_order())) {
@@ -660,6 +1129,13 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
                         const int16_t* rep_levels, const uint8_t* valid_bits,
                         int64_t valid_bits_offset, const T* values) override;
 
+  bool WriteArrowDictionary(int64_t num_levels, const int16_t* def_levels,
+                            const int16_t* rep_levels,
+                            const ::arrow::DictionaryArray& values) override;
+
+  bool WriteArrow(int64_t num_levels, const int16_t* def_levels,
+                  const int16_t* rep_levels, const ::arrow::Array& values) override;
+
   int64_t EstimatedBufferedValueBytes() const override {
     return current_encoder_->EstimatedDataEncodedSize();
   }
@@ -672,9 +1148,26 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
   // Checks if the Dictionary Page size limit is reached
   // If the limit is reached, the Dictionary and Data Pages are serialized
-  // The encoding is switched to PLAIN
+  // The encoding is switched to fallback_encoding_
   void CheckDictionarySizeLimit();
 
+  // Serializes the Dictionary and Data Pages and switches to fallback_encoding_
+  void FallBackFromDictionary();
+
+  // Sets up the encoders adaptive encoding samples the first values with
+  void InitEncodingSample();
+
+  // Encodes values with the sample encoders
+  void SampleValues(int64_t num_values, const T* values);
+  void SampleValuesSpaced(int64_t num_values, const uint8_t* valid_bits,
+                          int64_t valid_bits_offset, const T* values);
+
+  // Switches to the encoding of the sample encoder giving the fewest bytes
+  void SelectEncoding();
+
+  // The size of the sample encoded by encoder, compressed if the column is
+  int64_t SampleEncodedSize(Encoder* encoder);
+
   EncodedStatistics GetPageStatistics() override {
     EncodedStatistics result;
     if (page_statistics_) result = page_statistics_->Encode();
@@ -711,17 +1204,83 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
                                       int64_t valid_bits_offset, const T* values,
                                       int64_t* num_spaced_written);
 
+  int64_t WriteMiniBatchArrowDictionary(int64_t num_levels, const int16_t* def_levels,
+                                        const int16_t* rep_levels,
+                                        const uint8_t* valid_bits,
+                                        int64_t valid_bits_offset,
+                                        const int32_t* indices,
+                                        int64_t* num_spaced_written);
+
+  // Write a span of WriteArrow, valid_bits being null if it has no nulls
+  void WriteArrowSpan(int64_t num_levels, const int16_t* def_levels,
+                      const uint8_t* valid_bits, int64_t valid_bits_offset,
+                      const T* values);
+
+  // The number of values WriteArrow writes next, at most num_remaining: as
+  // many as fit in the current data page and below the dictionary page size
+  // limit, and no more than the encoding sample still takes
+  int64_t ArrowSpanLength(int64_t num_remaining) const;
+
+  // Write the levels of a spaced mini batch and count the values it holds, with
+  // and without the null entries on the lowest nesting level
+  void WriteLevelsSpaced(int64_t num_levels, const int16_t* def_levels,
+                         const int16_t* rep_levels, int64_t* values_to_write,
+                         int64_t* spaced_values_to_write);
+
+  // Account for a written mini batch, cutting a data page or falling back from
+  // dictionary encoding if due
+  void CommitWriteAndCheckLimits(int64_t num_levels, int64_t num_values);
+
   // Write values to a temporary buffer before they are encoded into pages
   void WriteValues(int64_t num_values, const T* values);
   void WriteValuesSpaced(int64_t num_values, const uint8_t* valid_bits,
                          int64_t valid_bits_offset, const T* values);
 
+  // Insert the hashes of values into the Bloom filter
+  void UpdateBloomFilter(int64_t num_values, const T* values) {
+    const int type_length = descr_->type_length();
+    for (int64_t i = 0; i < num_values; ++i) {
+      bloom_filter_->InsertHash(BloomFilterHash(*bloom_filter_, values[i], type_length));
+    }
+  }
+
+  void UpdateBloomFilterSpaced(int64_t num_spaced, const uint8_t* valid_bits,
+                               int64_t valid_bits_offset, const T* values) {
+    const int type_length = descr_->type_length();
+    VisitValidEntries(num_spaced, valid_bits, valid_bits_offset, [&](int64_t i) {
+      bloom_filter_->InsertHash(BloomFilterHash(*bloom_filter_, values[i], type_length));
+    });
+  }
+
   using ValueEncoderType = typename EncodingTraits<DType>::Encoder;
   std::unique_ptr<Encoder> current_encoder_;
 
+  // Encoding to fall back to from dictionary encoding
+  Encoding::type fallback_encoding_ = Encoding::PLAIN;
+
+  // With adaptive encoding, an encoder per candidate encoding, fed with the
+  // values written until sample_size_ of them are
+  std::vector<std::unique_ptr<Encoder>> sample_encoders_;
+  int64_t sample_size_ = 0;
+  int64_t num_sampled_values_ = 0;
+
   typedef TypedRowGroupStatistics<DType> TypedStats;
   std::unique_ptr<TypedStats> page_statistics_;
   std::unique_ptr<TypedStats> chunk_statistics_;
+
+  // The last dictionary passed to WriteArrowDictionary, its values and, once
+  // added to the dictionary encoder, their indices in it
+  std::shared_ptr<::arrow::Array> arrow_dictionary_;
+  std::vector<T> arrow_dictionary_values_;
+  std::vector<int32_t> arrow_dictionary_memo_indices_;
+
+  // Scratch space for WriteArrow
+  std::vector<int16_t> arrow_def_levels_;
+
+  // Scratch space for WriteArrowDictionary
+  std::vector<int32_t> arrow_indices_;
+  std::vector<int32_t> memo_indices_;
+  std::vector<T> dictionary_values_;
 };
 
 // Only one Dictionary Page is written.
@@ -732,14 +1291,114 @@ void TypedColumnWriterImpl<DType>::CheckDictionarySizeLimit() {
   // don't want to cast through virtual inheritance
   auto dict_encoder = dynamic_cast<DictEncoder<DType>*>(current_encoder_.get());
   if (dict_encoder->dict_encoded_size() >= properties_->dictionary_pagesize_limit()) {
-    WriteDictionaryPage();
-    // Serialize the buffered Dictionary Indicies
-    FlushBufferedDataPages();
-    fallback_ = true;
-    // Only PLAIN encoding is supported for fallback in V1
-    current_encoder_ = MakeEncoder(DType::type_num, Encoding::PLAIN, false, descr_,
+    FallBackFromDictionary();
+  }
+}
+
+template <typename DType>
+void TypedColumnWriterImpl<DType>::FallBackFromDictionary() {
+  WriteDictionaryPage();
+  // Serialize the buffered Dictionary Indicies
+  FlushBufferedDataPages();
+  fallback_ = true;
+  // Only PLAIN encoding is supported for fallback in V1, unless chosen by
+  // adaptive encoding
+  current_encoder_ = MakeEncoder(DType::type_num, fallback_encoding_, false, descr_,
+                                 properties_->memory_pool());
+  encoding_ = fallback_encoding_;
+  AddDataPageEncoding(encoding_);
+}
+
+template <typename DType>
+void TypedColumnWriterImpl<DType>::InitEncodingSample() {
+  ::arrow::MemoryPool* pool = properties_->memory_pool();
+  if (has_dictionary_) {
+    sample_encoders_.push_back(
+        MakeEncoder(DType::type_num, encoding_, true, descr_, pool));
+  } else {
+    AddDataPageEncoding(encoding_);
+  }
+  for (Encoding::type encoding : AdaptiveEncodingCandidates(
+           DType::type_num, properties_->encoding(descr_->path()),
+           properties_->version(), pager_->has_compressor())) {
+    sample_encoders_.push_back(
+        MakeEncoder(DType::type_num, encoding, false, descr_, pool));
+  }
+  sample_size_ = properties_->adaptive_encoding_sample_size(descr_->path());
+}
+
+template <typename DType>
+void TypedColumnWriterImpl<DType>::SampleValues(int64_t num_values, const T* values) {
+  for (const auto& encoder : sample_encoders_) {
+    dynamic_cast<ValueEncoderType*>(encoder.get())
+        ->Put(values, static_cast<int>(num_values));
+  }
+  num_sampled_values_ += num_values;
+}
+
+template <typename DType>
+void TypedColumnWriterImpl<DType>::SampleValuesSpaced(int64_t num_values,
+                                                      const uint8_t* valid_bits,
+                                                      int64_t valid_bits_offset,
+                                                      const T* values) {
+  for (const auto& encoder : sample_encoders_) {
+    dynamic_cast<ValueEncoderType*>(encoder.get())
+        ->PutSpaced(values, static_cast<int>(num_values), valid_bits, valid_bits_offset);
+  }
+  num_sampled_values_ += num_values;
+}
+
+template <typename DType>
+int64_t TypedColumnWriterImpl<DType>::SampleEncodedSize(Encoder* encoder) {
+  auto compressed_size = [this](const Buffer& data) {
+    if (!pager_->has_compressor()) {
+      return data.size();
+    }
+    pager_->Compress(data, compressed_data_.get());
+    return compressed_data_->size();
+  };
+
+  int64_t size = compressed_size(*encoder->FlushValues());
+  auto dict_encoder = dynamic_cast<DictEncoder<DType>*>(encoder);
+  if (dict_encoder != nullptr) {
+    std::shared_ptr<ResizableBuffer> dictionary =
+        AllocateBuffer(properties_->memory_pool(), dict_encoder->dict_encoded_size());
+    dict_encoder->WriteDict(dictionary->mutable_data());
+    size += compressed_size(*dictionary);
+  }
+  return size;
+}
+
+template <typename DType>
+void TypedColumnWriterImpl<DType>::SelectEncoding() {
+  int64_t dictionary_size = std::numeric_limits<int64_t>::max();
+  int64_t best_size = std::numeric_limits<int64_t>::max();
+  Encoding::type best_encoding = Encoding::PLAIN;
+  for (const auto& encoder : sample_encoders_) {
+    const int64_t size = SampleEncodedSize(encoder.get());
+    if (dynamic_cast<DictEncoder<DType>*>(encoder.get()) != nullptr) {
+      dictionary_size = size;
+    } else if (size < best_size) {
+      best_size = size;
+      best_encoding = encoder->encoding();
+    }
+  }
+  sample_encoders_.clear();
+
+  fallback_encoding_ = best_encoding;
+  if (has_dictionary_ && !fallback_) {
+    // The values written meanwhile stay dictionary encoded
+    if (best_size < dictionary_size) {
+      FallBackFromDictionary();
+    }
+  } else if (best_encoding != encoding_) {
+    if (num_buffered_values_ > 0) {
+      AddDataPage();
+    }
+    current_encoder_ = MakeEncoder(DType::type_num, best_encoding, false, descr_,
                                    properties_->memory_pool());
-    encoding_ = Encoding::PLAIN;
+    encoding_ = best_encoding;
+    AddDataPageEncoding(encoding_);
   }
 }
 
@@ -815,25 +1474,19 @@ int64_t TypedColumnWriterImpl<DType>::WriteMiniBatch(int64_t num_values,
   if (page_statistics_ != nullptr) {
     page_statistics_->Update(values, values_to_write, num_values - values_to_write);
   }
-
-  num_buffered_values_ += num_values;
-  num_buffered_encoded_values_ += values_to_write;
-
-  if (current_encoder_->EstimatedDataEncodedSize() >= properties_->data_pagesize()) {
-    AddDataPage();
-  }
-  if (has_dictionary_ && !fallback_) {
-    CheckDictionarySizeLimit();
+  if (bloom_filter_ != nullptr) {
+    UpdateBloomFilter(values_to_write, values);
   }
 
+  CommitWriteAndCheckLimits(num_values, values_to_write);
+
   return values_to_write;
 }
 
 template <typename DType>
-int64_t TypedColumnWriterImpl<DType>::WriteMiniBatchSpaced(
+void TypedColumnWriterImpl<DType>::WriteLevelsSpaced(
     int64_t num_levels, const int16_t* def_levels, const int16_t* rep_levels,
-    const uint8_t* valid_bits, int64_t valid_bits_offset, const T* values,
-    int64_t* num_spaced_written) {
+    int64_t* out_values_to_write, int64_t* out_spaced_values_to_write) {
   int64_t values_to_write = 0;
   int64_t spaced_values_to_write = 0;
   // If the field is required and non-repeated, there are no definition levels
@@ -875,6 +1528,37 @@ int64_t TypedColumnWriterImpl<DType>::WriteMiniBatchSpaced(
     rows_written_ += static_cast<int>(num_levels);
   }
 
+  *out_values_to_write = values_to_write;
+  *out_spaced_values_to_write = spaced_values_to_write;
+}
+
+template <typename DType>
+void TypedColumnWriterImpl<DType>::CommitWriteAndCheckLimits(int64_t num_levels,
+                                                             int64_t num_values) {
+  num_buffered_values_ += num_levels;
+  num_buffered_encoded_values_ += num_values;
+
+  if (!sample_encoders_.empty() && num_sampled_values_ >= sample_size_) {
+    SelectEncoding();
+  }
+  if (current_encoder_->EstimatedDataEncodedSize() >= properties_->data_pagesize()) {
+    AddDataPage();
+  }
+  if (has_dictionary_ && !fallback_) {
+    CheckDictionarySizeLimit();
+  }
+}
+
+template <typename DType>
+int64_t TypedColumnWriterImpl<DType>::WriteMiniBatchSpaced(
+    int64_t num_levels, const int16_t* def_levels, const int16_t* rep_levels,
+    const uint8_t* valid_bits, int64_t valid_bits_offset, const T* values,
+    int64_t* num_spaced_written) {
+  int64_t values_to_write = 0;
+  int64_t spaced_values_to_write = 0;
+  WriteLevelsSpaced(num_levels, def_levels, rep_levels, &values_to_write,
+                    &spaced_values_to_write);
+
   if (descr_->schema_node()->is_optional()) {
     WriteValuesSpaced(spaced_values_to_write, valid_bits, valid_bits_offset, values);
   } else {
@@ -886,17 +1570,75 @@ int64_t TypedColumnWriterImpl<DType>::WriteMiniBatchSpaced(
     page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset, values_to_write,
                                    spaced_values_to_write - values_to_write);
   }
+  if (bloom_filter_ != nullptr) {
+    UpdateBloomFilterSpaced(spaced_values_to_write, valid_bits, valid_bits_offset,
+                            values);
+  }
 
-  num_buffered_values_ += num_levels;
-  num_buffered_encoded_values_ += values_to_write;
+  CommitWriteAndCheckLimits(num_levels, values_to_write);
 
-  if (current_encoder_->EstimatedDataEncodedSize() >= properties_->data_pagesize()) {
-    AddDataPage();
+  return values_to_write;
+}
+
+template <typename DType>
+int64_t TypedColumnWriterImpl<DType>::WriteMiniBatchArrowDictionary(
+    int64_t num_levels, const int16_t* def_levels, const int16_t* rep_levels,
+    const uint8_t* valid_bits, int64_t valid_bits_offset, const int32_t* indices,
+    int64_t* num_spaced_written) {
+  int64_t values_to_write = 0;
+  int64_t spaced_values_to_write = 0;
+  WriteLevelsSpaced(num_levels, def_levels, rep_levels, &values_to_write,
+                    &spaced_values_to_write);
+  *num_spaced_written = spaced_values_to_write;
+
+  const bool dictionary_encoded = has_dictionary_ && !fallback_;
+  if (dictionary_encoded) {
+    auto dict_encoder = dynamic_cast<DictEncoder<DType>*>(current_encoder_.get());
+    if (arrow_dictionary_memo_indices_.size() != arrow_dictionary_values_.size()) {
+      arrow_dictionary_memo_indices_.resize(arrow_dictionary_values_.size());
+      dict_encoder->PutDictionary(arrow_dictionary_values_.data(),
+                                  static_cast<int>(arrow_dictionary_values_.size()),
+                                  arrow_dictionary_memo_indices_.data());
+    }
+    memo_indices_.resize(values_to_write);
+    int64_t num_valid = 0;
+    VisitValidEntries(spaced_values_to_write, valid_bits, valid_bits_offset,
+                      [&](int64_t i) {
+                        memo_indices_[num_valid++] =
+                            arrow_dictionary_memo_indices_[indices[i]];
+                      });
+    DCHECK_EQ(num_valid, values_to_write);
+    dict_encoder->PutIndices(memo_indices_.data(), static_cast<int>(values_to_write));
   }
-  if (has_dictionary_ && !fallback_) {
-    CheckDictionarySizeLimit();
+
+  // Plain encoding, statistics, Bloom filters and the encoding sample need the
+  // values themselves
+  const bool sampled = !sample_encoders_.empty();
+  if (!dictionary_encoded || page_statistics_ != nullptr || bloom_filter_ != nullptr ||
+      sampled) {
+    dictionary_values_.resize(values_to_write);
+    int64_t num_valid = 0;
+    VisitValidEntries(
+        spaced_values_to_write, valid_bits, valid_bits_offset, [&](int64_t i) {
+          dictionary_values_[num_valid++] = arrow_dictionary_values_[indices[i]];
+        });
+    DCHECK_EQ(num_valid, values_to_write);
+    if (!dictionary_encoded) {
+      WriteValues(values_to_write, dictionary_values_.data());
+    } else if (sampled) {
+      SampleValues(values_to_write, dictionary_values_.data());
+    }
+    if (page_statistics_ != nullptr) {
+      page_statistics_->Update(dictionary_values_.data(), values_to_write,
+                               spaced_values_to_write - values_to_write);
+    }
+    if (bloom_filter_ != nullptr) {
+      UpdateBloomFilter(values_to_write, dictionary_values_.data());
+    }
   }
 
+  CommitWriteAndCheckLimits(num_levels, values_to_write);
+
   return values_to_write;
 }
 
@@ -954,10 +1696,176 @@ void TypedColumnWriterImpl<DType>::WriteBatchSpaced(
                        values + values_offset, &num_spaced_written);
 }
 
+template <typename DType>
+bool TypedColumnWriterImpl<DType>::WriteArrowDictionary(
+    int64_t num_levels, const int16_t* def_levels, const int16_t* rep_levels,
+    const ::arrow::DictionaryArray& values) {
+  const std::shared_ptr<::arrow::Array>& dictionary = values.dictionary();
+  if (dictionary != arrow_dictionary_ &&
+      !(arrow_dictionary_ != nullptr && arrow_dictionary_->Equals(*dictionary))) {
+    std::vector<T> dictionary_values;
+    if (dictionary->null_count() > 0 ||
+        !ArrowDictionaryValues<DType>::View(*dictionary, descr_, &dictionary_values)) {
+      return false;
+    }
+    // A replaced dictionary is added to the dictionary encoder in turn
+    arrow_dictionary_ = dictionary;
+    arrow_dictionary_values_.swap(dictionary_values);
+    arrow_dictionary_memo_indices_.clear();
+  }
+
+  const std::shared_ptr<::arrow::Array> indices = values.indices();
+  arrow_indices_.resize(indices->length());
+  CopyDictionaryIndices(*indices, dictionary->length(), arrow_indices_.data());
+  const uint8_t* valid_bits = indices->null_count() > 0 ? indices->null_bitmap_data()
+                                                        : nullptr;
+  const int64_t valid_bits_offset = indices->offset();
+
+  // Chunk as WriteBatchSpaced does
+  int64_t write_batch_size = properties_->write_batch_size();
+  int num_batches = static_cast<int>(num_levels / write_batch_size);
+  int64_t num_remaining = num_levels % write_batch_size;
+  int64_t num_spaced_written = 0;
+  int64_t values_offset = 0;
+  for (int round = 0; round < num_batches; round++) {
+    int64_t offset = round * write_batch_size;
+    WriteMiniBatchArrowDictionary(write_batch_size, &def_levels[offset],
+                                  &rep_levels[offset], valid_bits,
+                                  valid_bits_offset + values_offset,
+                                  arrow_indices_.data() + values_offset,
+                                  &num_spaced_written);
+    values_offset += num_spaced_written;
+  }
+  // Write the remaining values
+  int64_t offset = num_batches * write_batch_size;
+  WriteMiniBatchArrowDictionary(num_remaining, &def_levels[offset], &rep_levels[offset],
+                                valid_bits, valid_bits_offset + values_offset,
+                                arrow_indices_.data() + values_offset,
+                                &num_spaced_written);
+  return true;
+}
+
+template <typename DType>
+int64_t TypedColumnWriterImpl<DType>::ArrowSpanLength(int64_t num_remaining) const {
+  const int64_t value_size = static_cast<int64_t>(sizeof(T));
+  int64_t length = (properties_->data_pagesize() -
+                    current_encoder_->EstimatedDataEncodedSize()) /
+                   value_size;
+  if (has_dictionary_ && !fallback_) {
+    auto dict_encoder = dynamic_cast<DictEncoder<DType>*>(current_encoder_.get());
+    length = std::min(length, (properties_->dictionary_pagesize_limit() -
+                               dict_encoder->dict_encoded_size()) /
+                                  value_size);
+  }
+  length = std::max(length, properties_->write_batch_size());
+  if (!sample_encoders_.empty()) {
+    length = std::min(length, sample_size_ - num_sampled_values_);
+  }
+  return std::max<int64_t>(1, std::min(length, num_remaining));
+}
+
+template <typename DType>
+void TypedColumnWriterImpl<DType>::WriteArrowSpan(int64_t num_levels,
+                                                  const int16_t* def_levels,
+                                                  const uint8_t* valid_bits,
+                                                  int64_t valid_bits_offset,
+                                                  const T* values) {
+  int64_t values_to_write = num_levels;
+  if (valid_bits != nullptr) {
+    values_to_write =
+        ::arrow::internal::CountSetBits(valid_bits, valid_bits_offset, num_levels);
+  }
+
+  if (descr_->max_definition_level() > 0) {
+    if (def_levels == nullptr) {
+      arrow_def_levels_.resize(num_levels);
+      if (valid_bits == nullptr) {
+        std::fill(arrow_def_levels_.begin(), arrow_def_levels_.end(), 1);
+      } else {
+        ::arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                          num_levels);
+        for (int64_t i = 0; i < num_levels; ++i) {
+          arrow_def_levels_[i] = valid_bits_reader.IsSet() ? 1 : 0;
+          valid_bits_reader.Next();
+        }
+      }
+      def_levels = arrow_def_levels_.data();
+    }
+    WriteDefinitionLevels(num_levels, def_levels);
+  }
+  rows_written_ += static_cast<int>(num_levels);
+
+  if (values_to_write == num_levels) {
+    WriteValues(num_levels, values);
+    if (page_statistics_ != nullptr) {
+      page_statistics_->Update(values, num_levels, 0);
+    }
+    if (bloom_filter_ != nullptr) {
+      UpdateBloomFilter(num_levels, values);
+    }
+  } else {
+    WriteValuesSpaced(num_levels, valid_bits, valid_bits_offset, values);
+    if (page_statistics_ != nullptr) {
+      page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset,
+                                     values_to_write, num_levels - values_to_write);
+    }
+    if (bloom_filter_ != nullptr) {
+      UpdateBloomFilterSpaced(num_levels, valid_bits, valid_bits_offset, values);
+    }
+  }
+
+  CommitWriteAndCheckLimits(num_levels, values_to_write);
+}
+
+template <typename DType>
+bool TypedColumnWriterImpl<DType>::WriteArrow(int64_t num_levels,
+                                              const int16_t* def_levels,
+                                              const int16_t* rep_levels,
+                                              const ::arrow::Array& values) {
+  // Only flat columns, whose levels match the entries of the array one to one
+  const int16_t max_definition_level = descr_->max_definition_level();
+  if (descr_->max_repetition_level() > 0 || max_definition_level > 1 ||
+      (max_definition_level == 1 && !descr_->schema_node()->is_optional()) ||
+      values.length() != num_levels ||
+      !ArrowPrimitiveValues<DType>::Accepts(*values.type())) {
+    return false;
+  }
+  if (num_levels == 0) {
+    return true;
+  }
+
+  const auto& data = static_cast<const ::arrow::PrimitiveArray&>(values);
+  const T* raw_values = reinterpret_cast<const T*>(data.values()->data()) + data.offset();
+  const uint8_t* valid_bits = nullptr;
+  if (max_definition_level > 0 && data.null_count() > 0) {
+    valid_bits = data.null_bitmap_data();
+  }
+
+  int64_t offset = 0;
+  while (offset < num_levels) {
+    const int64_t length = ArrowSpanLength(num_levels - offset);
+    WriteArrowSpan(length, def_levels == nullptr ? nullptr : def_levels + offset,
+                   valid_bits, data.offset() + offset, raw_values + offset);
+    offset += length;
+  }
+  return true;
+}
+
+// BOOLEAN columns are never dictionary-encoded: write their dictionaries expanded
+template <>
+bool TypedColumnWriterImpl<BooleanType>::WriteArrowDictionary(
+    int64_t num_levels, const int16_t* def_levels, const int16_t* rep_levels,
+    const ::arrow::DictionaryArray& values) {
+  return false;
+}
+
 template <typename DType>
 void TypedColumnWriterImpl<DType>::WriteValues(int64_t num_values, const T* values) {
   dynamic_cast<ValueEncoderType*>(current_encoder_.get())
       ->Put(values, static_cast<int>(num_values));
+  if (!sample_encoders_.empty()) {
+    SampleValues(num_values, values);
+  }
 }
 
 template <typename DType>
@@ -967,6 +1875,9 @@ void TypedColumnWriterImpl<DType>::WriteValuesSpaced(int64_t num_values,
                                                      const T* values) {
   dynamic_cast<ValueEncoderType*>(current_encoder_.get())
       ->PutSpaced(values, static_cast<int>(num_values), valid_bits, valid_bits_offset);
+  if (!sample_encoders_.empty()) {
+    SampleValuesSpaced(num_values, valid_bits, valid_bits_offset, values);
+  }
 }
 
 // ----------------------------------------------------------------------
@@ -34,6 +34,9 @@
 
 namespace arrow {
 
+class Array;
+class DictionaryArray;
+
 namespace BitUtil {
 class BitWriter;
 }  // namespace BitUtil
@@ -86,7 +89,7 @@ class PARQUET_EXPORT PageWriter {
   static std::unique_ptr<PageWriter> Open(
       OutputStream* sink, Compression::type codec, ColumnChunkMetaDataBuilder* metadata,
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
-      bool buffered_row_group = false);
+      bool buffered_row_group = false, bool write_page_index = false);
 
   // The Column Writer decides if dictionary encoding is used if set and
   // if the dictionary encoding has fallen back to default encoding on reaching dictionary
@@ -177,6 +180,49 @@ class TypedColumnWriter : public ColumnWriter {
                                 const int16_t* rep_levels, const uint8_t* valid_bits,
                                 int64_t valid_bits_offset, const T* values) = 0;
 
+  /// \brief Write a batch of levels and values, the values being the entries of an
+  /// Arrow DictionaryArray, laid out as for WriteBatchSpaced
+  ///
+  /// While the column chunk is dictionary-encoded, the Arrow dictionary is
+  /// added to the column chunk's dictionary once, when first seen, and the
+  /// indices are written through without hashing the values they reference.
+  /// Passing another dictionary in a later batch adds its values in turn; once
+  /// the column chunk falls back to plain encoding, values are looked up in
+  /// the dictionary and written like those of WriteBatchSpaced.
+  ///
+  /// Supported dictionary value types are binary and string for BYTE_ARRAY,
+  /// fixed_size_binary for FIXED_LEN_BYTE_ARRAY, and int32, int64, float and
+  /// double for the Parquet type of the same width.
+  ///
+  /// \return false, without writing anything, if the dictionary value type is
+  ///   not supported or the dictionary contains nulls
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  virtual bool WriteArrowDictionary(int64_t num_levels, const int16_t* def_levels,
+                                    const int16_t* rep_levels,
+                                    const ::arrow::DictionaryArray& values) = 0;
+
+  /// \brief Write the levels and values of a flat column from an Arrow array,
+  /// encoding the values in place from the array's buffers
+  ///
+  /// Values are written in spans as long as the room left in the current data
+  /// page, rather than in batches of write_batch_size, and the statistics and
+  /// Bloom filter are updated once per span. Null values are counted from the
+  /// validity bitmap. For an optional column, def_levels may be null, in which
+  /// case the definition levels are derived from the validity bitmap; the
+  /// validity bitmap of a required column is ignored.
+  ///
+  /// Supported are columns neither repeated nor nested in an optional group,
+  /// and int32 and date32 arrays for INT32, int64 and time64 for INT64, float
+  /// for FLOAT and double for DOUBLE.
+  ///
+  /// \return false, without writing anything, if the column or the array type
+  ///   is not supported or num_levels is not the length of the array
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  virtual bool WriteArrow(int64_t num_levels, const int16_t* def_levels,
+                          const int16_t* rep_levels, const ::arrow::Array& values) = 0;
+
   // Estimated size of the values that are not written to a page yet
   virtual int64_t EstimatedBufferedValueBytes() const = 0;
 };
@@ -98,6 +98,82 @@ static void BM_PlainDecodingInt64(benchmark::State& state) {
 
 BENCHMARK(BM_PlainDecodingInt64)->Range(1024, 65536);
 
+template <typename Type>
+static void EncodeFloatingPoint(Encoding::type encoding, benchmark::State& state) {
+  typedef typename Type::c_type T;
+  std::vector<T> values(state.range(0));
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<T>(i) / 7;
+  }
+  auto encoder = MakeTypedEncoder<Type>(encoding);
+  while (state.KeepRunning()) {
+    encoder->Put(values.data(), static_cast<int>(values.size()));
+    encoder->FlushValues();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+template <typename Type>
+static void DecodeFloatingPoint(Encoding::type encoding, benchmark::State& state) {
+  typedef typename Type::c_type T;
+  std::vector<T> values(state.range(0));
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<T>(i) / 7;
+  }
+  auto encoder = MakeTypedEncoder<Type>(encoding);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> buf = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<Type>(encoding);
+  while (state.KeepRunning()) {
+    decoder->SetData(static_cast<int>(values.size()), buf->data(),
+                     static_cast<int>(buf->size()));
+    decoder->Decode(values.data(), static_cast<int>(values.size()));
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(T));
+}
+
+static void BM_PlainEncodingFloat(benchmark::State& state) {
+  EncodeFloatingPoint<FloatType>(Encoding::PLAIN, state);
+}
+
+static void BM_ByteStreamSplitEncodingFloat(benchmark::State& state) {
+  EncodeFloatingPoint<FloatType>(Encoding::BYTE_STREAM_SPLIT, state);
+}
+
+static void BM_PlainDecodingFloat(benchmark::State& state) {
+  DecodeFloatingPoint<FloatType>(Encoding::PLAIN, state);
+}
+
+static void BM_ByteStreamSplitDecodingFloat(benchmark::State& state) {
+  DecodeFloatingPoint<FloatType>(Encoding::BYTE_STREAM_SPLIT, state);
+}
+
+static void BM_PlainEncodingDouble(benchmark::State& state) {
+  EncodeFloatingPoint<DoubleType>(Encoding::PLAIN, state);
+}
+
+static void BM_ByteStreamSplitEncodingDouble(benchmark::State& state) {
+  EncodeFloatingPoint<DoubleType>(Encoding::BYTE_STREAM_SPLIT, state);
+}
+
+static void BM_PlainDecodingDouble(benchmark::State& state) {
+  DecodeFloatingPoint<DoubleType>(Encoding::PLAIN, state);
+}
+
+static void BM_ByteStreamSplitDecodingDouble(benchmark::State& state) {
+  DecodeFloatingPoint<DoubleType>(Encoding::BYTE_STREAM_SPLIT, state);
+}
+
+BENCHMARK(BM_PlainEncodingFloat)->Range(1024, 65536);
+BENCHMARK(BM_ByteStreamSplitEncodingFloat)->Range(1024, 65536);
+BENCHMARK(BM_PlainDecodingFloat)->Range(1024, 65536);
+BENCHMARK(BM_ByteStreamSplitDecodingFloat)->Range(1024, 65536);
+BENCHMARK(BM_PlainEncodingDouble)->Range(1024, 65536);
+BENCHMARK(BM_ByteStreamSplitEncodingDouble)->Range(1024, 65536);
+BENCHMARK(BM_PlainDecodingDouble)->Range(1024, 65536);
+BENCHMARK(BM_ByteStreamSplitDecodingDouble)->Range(1024, 65536);
+
 template <typename Type>
 static void DecodeDict(std::vector<typename Type::c_type>& values,
                        benchmark::State& state) {
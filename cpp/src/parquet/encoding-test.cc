@@ -16,12 +16,17 @@
 // under the License.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
 #include <string>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/testing/gtest_util.h"
 #include "arrow/util/bit-util.h"
 
 #include "parquet/encoding.h"
@@ -297,6 +302,21 @@ class TestDictionaryEncoding : public TestEncodingBase<Type> {
         decoder->DecodeSpaced(decode_buf_, num_values_, 0, valid_bits.data(), 0);
     ASSERT_EQ(num_values_, values_decoded);
     ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+
+    // Also test decoding the indices alone
+    const T* dictionary;
+    int32_t dictionary_length;
+    decoder->GetDictionary(&dictionary, &dictionary_length);
+    ASSERT_EQ(dict_traits->num_entries(), dictionary_length);
+
+    std::vector<int32_t> decoded_indices(num_values_);
+    decoder->SetData(num_values_, indices->data(), static_cast<int>(indices->size()));
+    values_decoded = decoder->DecodeIndices(num_values_, decoded_indices.data());
+    ASSERT_EQ(num_values_, values_decoded);
+    for (int i = 0; i < num_values_; ++i) {
+      decode_buf_[i] = dictionary[decoded_indices[i]];
+    }
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
   }
 
  protected:
@@ -314,6 +334,317 @@ TEST(TestDictionaryEncoding, CannotDictDecodeBoolean) {
   ASSERT_THROW(MakeDictDecoder<BooleanType>(nullptr), ParquetException);
 }
 
+TEST(TestDictionaryEncoding, DecodeIndicesOutOfRange) {
+  const std::vector<int32_t> dict_values = {7, 8};
+  auto dict_decoder = MakeTypedDecoder<Int32Type>(Encoding::PLAIN);
+  dict_decoder->SetData(2, reinterpret_cast<const uint8_t*>(dict_values.data()),
+                        static_cast<int>(dict_values.size() * sizeof(int32_t)));
+  auto decoder = MakeDictDecoder<Int32Type>(nullptr);
+  decoder->SetDict(dict_decoder.get());
+
+  // Bit width 8, then a RLE run of one index 2
+  const uint8_t indices[] = {8, 2, 2};
+  decoder->SetData(1, indices, static_cast<int>(sizeof(indices)));
+  int32_t index;
+  ASSERT_THROW(decoder->DecodeIndices(1, &index), ParquetException);
+}
+
+TEST(TestDictionaryEncoding, PutDictionaryAndIndices) {
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::PLAIN, true);
+  auto dict_encoder = dynamic_cast<DictEncoder<Int32Type>*>(encoder.get());
+  const std::vector<int32_t> values = {5, 7};
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+
+  // Known values keep their index, others are appended
+  const std::vector<int32_t> dictionary = {9, 5, 3};
+  std::vector<int32_t> memo_indices(dictionary.size());
+  dict_encoder->PutDictionary(dictionary.data(), static_cast<int>(dictionary.size()),
+                              memo_indices.data());
+  ASSERT_EQ(std::vector<int32_t>({2, 0, 3}), memo_indices);
+  ASSERT_EQ(4, dict_encoder->num_entries());
+
+  const std::vector<int32_t> indices = {memo_indices[2], memo_indices[0],
+                                        memo_indices[1]};
+  dict_encoder->PutIndices(indices.data(), static_cast<int>(indices.size()));
+  std::shared_ptr<Buffer> indices_buffer = encoder->FlushValues();
+
+  std::vector<uint8_t> dict_buffer(dict_encoder->dict_encoded_size());
+  dict_encoder->WriteDict(dict_buffer.data());
+  auto dict_decoder = MakeTypedDecoder<Int32Type>(Encoding::PLAIN);
+  dict_decoder->SetData(dict_encoder->num_entries(), dict_buffer.data(),
+                        static_cast<int>(dict_buffer.size()));
+  auto decoder = MakeDictDecoder<Int32Type>(nullptr);
+  decoder->SetDict(dict_decoder.get());
+  decoder->SetData(5, indices_buffer->data(), static_cast<int>(indices_buffer->size()));
+
+  std::vector<int32_t> decoded(5);
+  ASSERT_EQ(5, decoder->Decode(decoded.data(), 5));
+  ASSERT_EQ(std::vector<int32_t>({5, 7, 3, 9, 5}), decoded);
+}
+
+// ----------------------------------------------------------------------
+// Delta encoding tests
+
+typedef ::testing::Types<Int32Type, Int64Type> DeltaBitPackedTypes;
+
+template <typename Type>
+class TestDeltaBitPackEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+  static constexpr int TYPE = Type::type_num;
+
+  virtual void CheckRoundtrip() {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::DELTA_BINARY_PACKED, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::DELTA_BINARY_PACKED, descr_.get());
+
+    // Put() calls need not be aligned on blocks
+    int first_batch = std::min(num_values_, 7);
+    encoder->Put(draws_, first_batch);
+    encoder->Put(draws_ + first_batch, num_values_ - first_batch);
+    encode_buffer_ = encoder->FlushValues();
+
+    // Nor do Decode() calls need to be aligned on miniblocks
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    int values_decoded = 0;
+    while (values_decoded < num_values_) {
+      int batch_size = std::min(33, num_values_ - values_decoded);
+      ASSERT_EQ(batch_size, decoder->Decode(decode_buf_ + values_decoded, batch_size));
+      values_decoded += batch_size;
+    }
+    ASSERT_EQ(0, decoder->values_left());
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+  }
+
+  void ExecuteSequence(int nvalues, T start, T step) {
+    InitData(nvalues, 1);
+    for (int i = 0; i < nvalues; ++i) {
+      draws_[i] = static_cast<T>(start + step * i + i % 5);
+    }
+    CheckRoundtrip();
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+  using TestEncodingBase<Type>::InitData;
+};
+
+TYPED_TEST_CASE(TestDeltaBitPackEncoding, DeltaBitPackedTypes);
+
+TYPED_TEST(TestDeltaBitPackEncoding, BasicRoundTrip) {
+  // Random values over the whole range need the widest miniblocks
+  ASSERT_NO_FATAL_FAILURE(this->Execute(10000, 1));
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, PartialBlocks) {
+  for (int nvalues : {0, 1, 2, 31, 32, 33, 127, 128, 129, 1000}) {
+    ASSERT_NO_FATAL_FAILURE(this->ExecuteSequence(nvalues, -50, 3));
+  }
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, Sequence) {
+  typedef typename TypeParam::c_type T;
+  ASSERT_NO_FATAL_FAILURE(this->ExecuteSequence(10000, 1000, 7));
+  // Deltas between 7 and 11 take 3 bits each
+  ASSERT_LT(this->encode_buffer_->size(), 10000 * static_cast<int64_t>(sizeof(T)) / 4);
+}
+
+TYPED_TEST(TestDeltaBitPackEncoding, Extremes) {
+  typedef typename TypeParam::c_type T;
+  this->InitData(300, 1);
+  for (int i = 0; i < 300; ++i) {
+    this->draws_[i] = (i % 3 == 0) ? std::numeric_limits<T>::min()
+                                   : ((i % 3 == 1) ? std::numeric_limits<T>::max() : 0);
+  }
+  ASSERT_NO_FATAL_FAILURE(this->CheckRoundtrip());
+}
+
+TEST(TestDeltaBitPackEncoding, SpecExample) {
+  // From the Parquet format specification: with a constant delta, the
+  // miniblocks have a bit width of 0 and hold no data
+  std::vector<int32_t> values = {1, 2, 3, 4, 5};
+  std::vector<uint8_t> expected = {0x80, 0x01, 0x04, 0x05, 0x02,
+                                   0x02, 0x00, 0x00, 0x00, 0x00};
+
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), static_cast<int>(values.size()));
+  std::shared_ptr<Buffer> encoded = encoder->FlushValues();
+  ASSERT_EQ(expected, std::vector<uint8_t>(encoded->data(),
+                                           encoded->data() + encoded->size()));
+
+  auto decoder = MakeTypedDecoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(5, expected.data(), static_cast<int>(expected.size()));
+  std::vector<int32_t> decoded(5);
+  ASSERT_EQ(5, decoder->Decode(decoded.data(), 5));
+  ASSERT_EQ(values, decoded);
+}
+
+TEST(TestDeltaBitPackEncoding, TruncatedData) {
+  std::vector<int32_t> values(100);
+  for (int i = 0; i < 100; ++i) {
+    values[i] = i * i;
+  }
+  auto encoder = MakeTypedEncoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  encoder->Put(values.data(), 100);
+  std::shared_ptr<Buffer> encoded = encoder->FlushValues();
+
+  auto decoder = MakeTypedDecoder<Int32Type>(Encoding::DELTA_BINARY_PACKED);
+  decoder->SetData(100, encoded->data(), static_cast<int>(encoded->size() / 2));
+  std::vector<int32_t> decoded(100);
+  ASSERT_THROW(decoder->Decode(decoded.data(), 100), ParquetException);
+}
+
+class TestDeltaByteArrayEncoding : public TestEncodingBase<ByteArrayType>,
+                                   public ::testing::WithParamInterface<Encoding::type> {
+ public:
+  void CheckRoundtrip() override {
+    const Encoding::type encoding = GetParam();
+    auto encoder = MakeTypedEncoder<ByteArrayType>(encoding, false, descr_.get());
+    auto decoder = MakeTypedDecoder<ByteArrayType>(encoding, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+
+    // Decoded values must stay valid across Decode() calls
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    int values_decoded = 0;
+    while (values_decoded < num_values_) {
+      int batch_size = std::min(100, num_values_ - values_decoded);
+      ASSERT_EQ(batch_size, decoder->Decode(decode_buf_ + values_decoded, batch_size));
+      values_decoded += batch_size;
+    }
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<ByteArray>(decode_buf_, draws_, num_values_));
+  }
+
+  void ExecuteSorted(int nvalues) {
+    InitData(nvalues, 1);
+    std::sort(draws_, draws_ + num_values_, [](const ByteArray& a, const ByteArray& b) {
+      return std::string(reinterpret_cast<const char*>(a.ptr), a.len) <
+             std::string(reinterpret_cast<const char*>(b.ptr), b.len);
+    });
+    CheckRoundtrip();
+  }
+};
+
+TEST_P(TestDeltaByteArrayEncoding, BasicRoundTrip) {
+  ASSERT_NO_FATAL_FAILURE(Execute(2000, 2));
+}
+
+TEST_P(TestDeltaByteArrayEncoding, SortedRoundTrip) {
+  // Sorted values share prefixes with their predecessors
+  ASSERT_NO_FATAL_FAILURE(ExecuteSorted(2000));
+}
+
+TEST_P(TestDeltaByteArrayEncoding, DecodeArrow) {
+  InitData(100, 1);
+  auto encoder = MakeTypedEncoder<ByteArrayType>(GetParam(), false, descr_.get());
+  encoder->Put(draws_, num_values_);
+  encode_buffer_ = encoder->FlushValues();
+
+  // Every third slot is null
+  std::vector<uint8_t> valid_bits(::arrow::BitUtil::BytesForBits(150), 0);
+  int null_count = 0;
+  for (int i = 0, j = 0; i < 150; ++i) {
+    if (i % 3 == 2 || j == num_values_) {
+      ++null_count;
+    } else {
+      ::arrow::BitUtil::SetBit(valid_bits.data(), i);
+      ++j;
+    }
+  }
+  ASSERT_EQ(50, null_count);
+
+  auto decoder = MakeTypedDecoder<ByteArrayType>(GetParam(), descr_.get());
+  decoder->SetData(num_values_, encode_buffer_->data(),
+                   static_cast<int>(encode_buffer_->size()));
+  ::arrow::ChunkedBinaryBuilder builder(1 << 20);
+  ASSERT_EQ(150, decoder->DecodeArrow(150, null_count, valid_bits.data(), 0, &builder));
+  ::arrow::ArrayVector chunks;
+  ASSERT_OK(builder.Finish(&chunks));
+  ASSERT_EQ(1, chunks.size());
+
+  const auto& result = static_cast<const ::arrow::BinaryArray&>(*chunks[0]);
+  ASSERT_EQ(150, result.length());
+  ASSERT_EQ(50, result.null_count());
+  for (int i = 0, j = 0; i < 150; ++i) {
+    if (result.IsValid(i)) {
+      ASSERT_EQ(ByteArrayToString(draws_[j++]), result.GetString(i));
+    }
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(DeltaByteArrayEncodings, TestDeltaByteArrayEncoding,
+                        ::testing::Values(Encoding::DELTA_LENGTH_BYTE_ARRAY,
+                                          Encoding::DELTA_BYTE_ARRAY));
+
+// ----------------------------------------------------------------------
+// BYTE_STREAM_SPLIT encoding tests
+
+typedef ::testing::Types<FloatType, DoubleType> ByteStreamSplitTypes;
+
+template <typename Type>
+class TestByteStreamSplitEncoding : public TestEncodingBase<Type> {
+ public:
+  typedef typename Type::c_type T;
+  static constexpr int TYPE = Type::type_num;
+
+  virtual void CheckRoundtrip() {
+    auto encoder =
+        MakeTypedEncoder<Type>(Encoding::BYTE_STREAM_SPLIT, false, descr_.get());
+    auto decoder = MakeTypedDecoder<Type>(Encoding::BYTE_STREAM_SPLIT, descr_.get());
+    encoder->Put(draws_, num_values_);
+    encode_buffer_ = encoder->FlushValues();
+    ASSERT_EQ(num_values_ * static_cast<int64_t>(sizeof(T)), encode_buffer_->size());
+
+    // Byte k of value i is at position i of stream k
+    const uint8_t* raw_values = reinterpret_cast<const uint8_t*>(draws_);
+    for (int i = 0; i < num_values_; ++i) {
+      for (int k = 0; k < static_cast<int>(sizeof(T)); ++k) {
+        ASSERT_EQ(raw_values[i * sizeof(T) + k],
+                  encode_buffer_->data()[k * num_values_ + i]);
+      }
+    }
+
+    // Decode in batches not aligned on the width of the vectorized kernels
+    decoder->SetData(num_values_, encode_buffer_->data(),
+                     static_cast<int>(encode_buffer_->size()));
+    int values_decoded = 0;
+    while (values_decoded < num_values_) {
+      int batch_size = std::min(37, num_values_ - values_decoded);
+      ASSERT_EQ(batch_size, decoder->Decode(decode_buf_ + values_decoded, batch_size));
+      values_decoded += batch_size;
+    }
+    ASSERT_EQ(0, decoder->values_left());
+    ASSERT_NO_FATAL_FAILURE(VerifyResults<T>(decode_buf_, draws_, num_values_));
+  }
+
+ protected:
+  USING_BASE_MEMBERS();
+};
+
+TYPED_TEST_CASE(TestByteStreamSplitEncoding, ByteStreamSplitTypes);
+
+TYPED_TEST(TestByteStreamSplitEncoding, BasicRoundTrip) {
+  for (int nvalues : {0, 1, 15, 16, 17, 10000}) {
+    ASSERT_NO_FATAL_FAILURE(this->Execute(nvalues, 1));
+  }
+}
+
+TEST(TestByteStreamSplitEncoding, InvalidData) {
+  std::vector<uint8_t> data(10);
+  auto decoder = MakeTypedDecoder<FloatType>(Encoding::BYTE_STREAM_SPLIT);
+  ASSERT_THROW(decoder->SetData(2, data.data(), 10), ParquetException);
+
+  // 2 values of data for 3 values
+  float values[3];
+  decoder->SetData(3, data.data(), 8);
+  ASSERT_THROW(decoder->Decode(values, 3), ParquetException);
+
+  ASSERT_THROW(MakeTypedEncoder<Int32Type>(Encoding::BYTE_STREAM_SPLIT),
+               ParquetException);
+}
+
 }  // namespace test
 
 }  // namespace parquet
@@ -20,7 +20,11 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -28,6 +32,8 @@
 #include "arrow/status.h"
 #include "arrow/util/bit-stream-utils.h"
 #include "arrow/util/bit-util.h"
+#include "arrow/util/bpacking.h"
+#include "arrow/util/byte-stream-split.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -324,6 +330,12 @@ class DictEncoderImpl : public EncoderImpl, virtual public DictEncoder<DType> {
   /// The number of entries in the dictionary.
   int num_entries() const override { return memo_table_.size(); }
 
+  void PutDictionary(const T* values, int num_values, int32_t* memo_indices) override;
+
+  void PutIndices(const int32_t* indices, int num_values) override {
+    buffered_indices_.insert(buffered_indices_.end(), indices, indices + num_values);
+  }
+
  private:
   /// Clears all the indices (but leaves the dictionary).
   void ClearIndices() { buffered_indices_.clear(); }
@@ -466,6 +478,17 @@ inline void DictEncoderImpl<FLBAType>::Put(const FixedLenByteArray& v) {
   buffered_indices_.push_back(memo_index);
 }
 
+template <typename DType>
+void DictEncoderImpl<DType>::PutDictionary(const T* values, int num_values,
+                                           int32_t* memo_indices) {
+  // Put() the values, then take their indices back out of the buffered ones
+  const size_t num_buffered = buffered_indices_.size();
+  Put(values, num_values);
+  std::copy(buffered_indices_.begin() + num_buffered, buffered_indices_.end(),
+            memo_indices);
+  buffered_indices_.resize(num_buffered);
+}
+
 class DictByteArrayEncoder : public DictEncoderImpl<ByteArrayType>,
                              virtual public ByteArrayEncoder {
  public:
@@ -479,6 +502,299 @@ class DictFLBAEncoder : public DictEncoderImpl<FLBAType>, virtual public FLBAEnc
   using BASE::DictEncoderImpl;
 };
 
+// ----------------------------------------------------------------------
+// DELTA_BINARY_PACKED encoder
+
+// Layout of the DELTA_BINARY_PACKED data written (the spec allows others on read)
+static constexpr int kDeltaBlockSize = 128;
+static constexpr int kDeltaMiniBlocksPerBlock = 4;
+static constexpr int kDeltaValuesPerMiniBlock =
+    kDeltaBlockSize / kDeltaMiniBlocksPerBlock;
+// Maximum length of a ULEB128 encoded 64-bit integer
+static constexpr int kMaxVlqLength = 10;
+
+static inline int PutVlq(uint64_t value, uint8_t* out) {
+  int length = 0;
+  while (value >= 0x80) {
+    out[length++] = static_cast<uint8_t>(value | 0x80);
+    value >>= 7;
+  }
+  out[length++] = static_cast<uint8_t>(value);
+  return length;
+}
+
+static inline uint64_t ZigZagEncode(int64_t value) {
+  return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+static inline int64_t ZigZagDecode(uint64_t value) {
+  return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+/// Values are buffered by block of kDeltaBlockSize deltas, each block being
+/// bit packed once full.  The page header, which holds the total number of
+/// values, is only written by FlushValues().
+template <typename DType>
+class DeltaBitPackEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
+
+  explicit DeltaBitPackEncoder(const ColumnDescriptor* descr,
+                               ::arrow::MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BINARY_PACKED, pool),
+        values_sink_(new InMemoryOutputStream(pool)) {
+    if (DType::type_num != Type::INT32 && DType::type_num != Type::INT64) {
+      throw ParquetException("Delta bit pack encoding should only be for integer data.");
+    }
+  }
+
+  int64_t EstimatedDataEncodedSize() override {
+    return 4 * kMaxVlqLength + values_sink_->Tell() + num_deltas_ * sizeof(T);
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    FlushBlock();
+    uint8_t header[4 * kMaxVlqLength];
+    int header_length = PutVlq(kDeltaBlockSize, header);
+    header_length += PutVlq(kDeltaMiniBlocksPerBlock, header + header_length);
+    header_length += PutVlq(total_values_, header + header_length);
+    header_length += PutVlq(ZigZagEncode(static_cast<T>(first_value_)),
+                            header + header_length);
+
+    std::shared_ptr<Buffer> blocks = values_sink_->GetBuffer();
+    InMemoryOutputStream out(pool_, header_length + blocks->size());
+    out.Write(header, header_length);
+    out.Write(blocks->data(), blocks->size());
+    values_sink_.reset(new InMemoryOutputStream(pool_));
+    total_values_ = 0;
+    return out.GetBuffer();
+  }
+
+  void Put(const T* src, int num_values) override {
+    int i = 0;
+    if (num_values > 0 && total_values_ == 0) {
+      first_value_ = last_value_ = static_cast<UT>(src[0]);
+      ++i;
+    }
+    for (; i < num_values; ++i) {
+      // Deltas wrap around, as allowed by the spec
+      const UT value = static_cast<UT>(src[i]);
+      deltas_[num_deltas_++] = value - last_value_;
+      last_value_ = value;
+      if (num_deltas_ == kDeltaBlockSize) {
+        FlushBlock();
+      }
+    }
+    total_values_ += num_values;
+  }
+
+ private:
+  // Write <min delta> <miniblock bit widths> <miniblocks> for the buffered deltas
+  void FlushBlock() {
+    if (num_deltas_ == 0) {
+      return;
+    }
+    T min_delta = std::numeric_limits<T>::max();
+    for (int i = 0; i < num_deltas_; ++i) {
+      min_delta = std::min(min_delta, static_cast<T>(deltas_[i]));
+    }
+    // Pad the last miniblock with zeros
+    const int num_mini_blocks = static_cast<int>(
+        BitUtil::CeilDiv(num_deltas_, kDeltaValuesPerMiniBlock));
+    for (int i = 0; i < num_mini_blocks * kDeltaValuesPerMiniBlock; ++i) {
+      deltas_[i] = i < num_deltas_ ? deltas_[i] - static_cast<UT>(min_delta) : 0;
+    }
+
+    uint8_t header[kMaxVlqLength + kDeltaMiniBlocksPerBlock];
+    int header_length = PutVlq(ZigZagEncode(min_delta), header);
+    uint8_t* bit_widths = header + header_length;
+    for (int j = 0; j < kDeltaMiniBlocksPerBlock; ++j) {
+      // The widths of unused miniblocks are zero
+      UT bits = 0;
+      for (int i = 0; j < num_mini_blocks && i < kDeltaValuesPerMiniBlock; ++i) {
+        bits |= deltas_[j * kDeltaValuesPerMiniBlock + i];
+      }
+      bit_widths[j] = static_cast<uint8_t>(BitUtil::NumRequiredBits(bits));
+    }
+    values_sink_->Write(header, header_length + kDeltaMiniBlocksPerBlock);
+
+    uint8_t packed[kDeltaValuesPerMiniBlock * sizeof(T)];
+    for (int j = 0; j < num_mini_blocks; ++j) {
+      const int bit_width = bit_widths[j];
+      if (bit_width == 0) {
+        continue;
+      }
+      BitUtil::BitWriter writer(packed, sizeof(packed));
+      const UT* values = deltas_ + j * kDeltaValuesPerMiniBlock;
+      for (int i = 0; i < kDeltaValuesPerMiniBlock; ++i) {
+        // Values are packed from the least significant bit, so that wide values
+        // can be written as two halves
+        const uint64_t value = values[i];
+        if (bit_width <= 32) {
+          writer.PutValue(value, bit_width);
+        } else {
+          writer.PutValue(value & 0xFFFFFFFFU, 32);
+          writer.PutValue(value >> 32, bit_width - 32);
+        }
+      }
+      writer.Flush();
+      values_sink_->Write(packed, bit_width * kDeltaValuesPerMiniBlock / 8);
+    }
+    num_deltas_ = 0;
+  }
+
+  std::unique_ptr<InMemoryOutputStream> values_sink_;
+  int64_t total_values_ = 0;
+  UT first_value_ = 0;
+  UT last_value_ = 0;
+  UT deltas_[kDeltaBlockSize];
+  int num_deltas_ = 0;
+};
+
+// ----------------------------------------------------------------------
+// DELTA_LENGTH_BYTE_ARRAY encoder
+
+/// The lengths are DELTA_BINARY_PACKED, followed by the concatenated values
+class DeltaLengthByteArrayEncoder : public EncoderImpl, virtual public ByteArrayEncoder {
+ public:
+  explicit DeltaLengthByteArrayEncoder(
+      const ColumnDescriptor* descr,
+      ::arrow::MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY, pool),
+        length_encoder_(nullptr, pool),
+        values_sink_(new InMemoryOutputStream(pool)) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return length_encoder_.EstimatedDataEncodedSize() + values_sink_->Tell();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> lengths = length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> values = values_sink_->GetBuffer();
+    InMemoryOutputStream out(pool_, lengths->size() + values->size());
+    out.Write(lengths->data(), lengths->size());
+    out.Write(values->data(), values->size());
+    values_sink_.reset(new InMemoryOutputStream(pool_));
+    return out.GetBuffer();
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    constexpr int kBatchSize = 256;
+    int32_t lengths[kBatchSize];
+    for (int i = 0; i < num_values; i += kBatchSize) {
+      const int batch_size = std::min(kBatchSize, num_values - i);
+      for (int j = 0; j < batch_size; ++j) {
+        const ByteArray& value = src[i + j];
+        lengths[j] = static_cast<int32_t>(value.len);
+        values_sink_->Write(value.ptr, value.len);
+      }
+      length_encoder_.Put(lengths, batch_size);
+    }
+  }
+
+ private:
+  DeltaBitPackEncoder<Int32Type> length_encoder_;
+  std::unique_ptr<InMemoryOutputStream> values_sink_;
+};
+
+// ----------------------------------------------------------------------
+// DELTA_BYTE_ARRAY encoder
+
+/// Each value is written as the length of its common prefix with the previous
+/// value (DELTA_BINARY_PACKED), and the remaining suffix
+/// (DELTA_LENGTH_BYTE_ARRAY).  This suits sorted data best.
+class DeltaByteArrayEncoder : public EncoderImpl, virtual public ByteArrayEncoder {
+ public:
+  explicit DeltaByteArrayEncoder(
+      const ColumnDescriptor* descr,
+      ::arrow::MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::DELTA_BYTE_ARRAY, pool),
+        prefix_length_encoder_(nullptr, pool),
+        suffix_encoder_(nullptr, pool) {}
+
+  int64_t EstimatedDataEncodedSize() override {
+    return prefix_length_encoder_.EstimatedDataEncodedSize() +
+           suffix_encoder_.EstimatedDataEncodedSize();
+  }
+
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> prefix_lengths = prefix_length_encoder_.FlushValues();
+    std::shared_ptr<Buffer> suffixes = suffix_encoder_.FlushValues();
+    InMemoryOutputStream out(pool_, prefix_lengths->size() + suffixes->size());
+    out.Write(prefix_lengths->data(), prefix_lengths->size());
+    out.Write(suffixes->data(), suffixes->size());
+    // Each page is decoded independently
+    last_value_.clear();
+    return out.GetBuffer();
+  }
+
+  void Put(const ByteArray* src, int num_values) override {
+    constexpr int kBatchSize = 256;
+    int32_t prefix_lengths[kBatchSize];
+    ByteArray suffixes[kBatchSize];
+    for (int i = 0; i < num_values; i += kBatchSize) {
+      const int batch_size = std::min(kBatchSize, num_values - i);
+      for (int j = 0; j < batch_size; ++j) {
+        const ByteArray& value = src[i + j];
+        const uint32_t max_prefix_length =
+            std::min(value.len, static_cast<uint32_t>(last_value_.size()));
+        uint32_t prefix_length = 0;
+        while (prefix_length < max_prefix_length &&
+               value.ptr[prefix_length] ==
+                   static_cast<uint8_t>(last_value_[prefix_length])) {
+          ++prefix_length;
+        }
+        prefix_lengths[j] = static_cast<int32_t>(prefix_length);
+        suffixes[j] = ByteArray(value.len - prefix_length, value.ptr + prefix_length);
+        last_value_.assign(reinterpret_cast<const char*>(value.ptr), value.len);
+      }
+      prefix_length_encoder_.Put(prefix_lengths, batch_size);
+      suffix_encoder_.Put(suffixes, batch_size);
+    }
+  }
+
+ private:
+  DeltaBitPackEncoder<Int32Type> prefix_length_encoder_;
+  DeltaLengthByteArrayEncoder suffix_encoder_;
+  std::string last_value_;
+};
+
+// ----------------------------------------------------------------------
+// BYTE_STREAM_SPLIT encoder
+
+template <typename DType>
+class ByteStreamSplitEncoder : public EncoderImpl, virtual public TypedEncoder<DType> {
+ public:
+  using T = typename DType::c_type;
+
+  explicit ByteStreamSplitEncoder(
+      const ColumnDescriptor* descr,
+      ::arrow::MemoryPool* pool = ::arrow::default_memory_pool())
+      : EncoderImpl(descr, Encoding::BYTE_STREAM_SPLIT, pool),
+        values_sink_(new InMemoryOutputStream(pool)) {}
+
+  int64_t EstimatedDataEncodedSize() override { return values_sink_->Tell(); }
+
+  // The values are buffered as PLAIN and transposed into the streams on flush
+  std::shared_ptr<Buffer> FlushValues() override {
+    std::shared_ptr<Buffer> values = values_sink_->GetBuffer();
+    values_sink_.reset(new InMemoryOutputStream(pool_));
+    std::shared_ptr<ResizableBuffer> out = AllocateBuffer(pool_, values->size());
+    ::arrow::internal::ByteStreamSplitEncode<T>(
+        values->data(), values->size() / static_cast<int64_t>(sizeof(T)),
+        out->mutable_data());
+    return out;
+  }
+
+  void Put(const T* buffer, int num_values) override {
+    values_sink_->Write(reinterpret_cast<const uint8_t*>(buffer), num_values * sizeof(T));
+  }
+
+ private:
+  std::unique_ptr<InMemoryOutputStream> values_sink_;
+};
+
 // ----------------------------------------------------------------------
 // Encoder and decoder factory functions
 
@@ -527,6 +843,35 @@ std::unique_ptr<Encoder> MakeEncoder(Type::type type_num, Encoding::type encodin
         DCHECK(false) << "Encoder not implemented";
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int32Type>(descr, pool));
+      case Type::INT64:
+        return std::unique_ptr<Encoder>(new DeltaBitPackEncoder<Int64Type>(descr, pool));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY ||
+             encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException(EncodingToString(encoding) + " only supports BYTE_ARRAY");
+    }
+    if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+      return std::unique_ptr<Encoder>(new DeltaLengthByteArrayEncoder(descr, pool));
+    }
+    return std::unique_ptr<Encoder>(new DeltaByteArrayEncoder(descr, pool));
+  } else if (encoding == Encoding::BYTE_STREAM_SPLIT) {
+    switch (type_num) {
+      case Type::FLOAT:
+        return std::unique_ptr<Encoder>(
+            new ByteStreamSplitEncoder<FloatType>(descr, pool));
+      case Type::DOUBLE:
+        return std::unique_ptr<Encoder>(
+            new ByteStreamSplitEncoder<DoubleType>(descr, pool));
+      default:
+        throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
+    }
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
@@ -699,7 +1044,7 @@ class PlainByteArrayDecoder : public PlainDecoder<ByteArrayType>,
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
-                  ::arrow::internal::ChunkedBinaryBuilder* out) override {
+                  ::arrow::ChunkedBinaryBuilder* out) override {
     int result = 0;
     PARQUET_THROW_NOT_OK(
         DecodeArrow(num_values, null_count, valid_bits, valid_bits_offset, out, &result));
@@ -715,8 +1060,7 @@ class PlainByteArrayDecoder : public PlainDecoder<ByteArrayType>,
     return result;
   }
 
-  int DecodeArrowNonNull(int num_values,
-                         ::arrow::internal::ChunkedBinaryBuilder* out) override {
+  int DecodeArrowNonNull(int num_values, ::arrow::ChunkedBinaryBuilder* out) override {
     int result = 0;
     PARQUET_THROW_NOT_OK(DecodeArrowNonNull(num_values, out, &result));
     return result;
@@ -751,6 +1095,7 @@ class PlainByteArrayDecoder : public PlainDecoder<ByteArrayType>,
         ++i;
       } else {
         ARROW_RETURN_NOT_OK(out->AppendNull());
+        ++i;
       }
       bit_reader.Next();
     }
@@ -762,8 +1107,7 @@ class PlainByteArrayDecoder : public PlainDecoder<ByteArrayType>,
     return ::arrow::Status::OK();
   }
 
-  ::arrow::Status DecodeArrowNonNull(int num_values,
-                                     ::arrow::internal::ChunkedBinaryBuilder* out,
+  ::arrow::Status DecodeArrowNonNull(int num_values, ::arrow::ChunkedBinaryBuilder* out,
                                      int* values_decoded) {
     num_values = std::min(num_values, num_values_);
     ARROW_RETURN_NOT_OK(out->Reserve(num_values));
@@ -846,6 +1190,26 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     return decoded_values;
   }
 
+  int DecodeIndices(int num_values, int32_t* indices) override {
+    num_values = std::min(num_values, num_values_);
+    if (idx_decoder_.GetBatch(indices, num_values) != num_values) {
+      ParquetException::EofException();
+    }
+    const int32_t dictionary_length = static_cast<int32_t>(dictionary_.size());
+    for (int i = 0; i < num_values; ++i) {
+      if (ARROW_PREDICT_FALSE(indices[i] < 0 || indices[i] >= dictionary_length)) {
+        throw ParquetException("Dictionary index out of range");
+      }
+    }
+    num_values_ -= num_values;
+    return num_values;
+  }
+
+  void GetDictionary(const T** dictionary, int32_t* dictionary_length) override {
+    *dictionary = dictionary_.data();
+    *dictionary_length = static_cast<int32_t>(dictionary_.size());
+  }
+
  protected:
   // Only one is set.
   Vector<T> dictionary_;
@@ -918,7 +1282,7 @@ class DictByteArrayDecoder : public DictDecoderImpl<ByteArrayType>,
 
   int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                   int64_t valid_bits_offset,
-                  ::arrow::internal::ChunkedBinaryBuilder* out) override {
+                  ::arrow::ChunkedBinaryBuilder* out) override {
     int result = 0;
     PARQUET_THROW_NOT_OK(
         DecodeArrow(num_values, null_count, valid_bits, valid_bits_offset, out, &result));
@@ -934,8 +1298,7 @@ class DictByteArrayDecoder : public DictDecoderImpl<ByteArrayType>,
     return result;
   }
 
-  int DecodeArrowNonNull(int num_values,
-                         ::arrow::internal::ChunkedBinaryBuilder* out) override {
+  int DecodeArrowNonNull(int num_values, ::arrow::ChunkedBinaryBuilder* out) override {
     int result = 0;
     PARQUET_THROW_NOT_OK(DecodeArrowNonNull(num_values, out, &result));
     return result;
@@ -1002,7 +1365,9 @@ class DictByteArrayDecoder : public DictDecoderImpl<ByteArrayType>,
     int32_t indices_buffer[buffer_size];
     int values_decoded = 0;
     while (values_decoded < num_values) {
-      int num_indices = idx_decoder_.GetBatch(indices_buffer, buffer_size);
+      // Bit-packed runs are padded: do not read past the requested values
+      int32_t batch_size = std::min<int32_t>(buffer_size, num_values - values_decoded);
+      int num_indices = idx_decoder_.GetBatch(indices_buffer, batch_size);
       if (num_indices == 0) break;
       for (int i = 0; i < num_indices; ++i) {
         const auto& val = dictionary_[indices_buffer[i]];
@@ -1027,10 +1392,13 @@ class DictFLBADecoder : public DictDecoderImpl<FLBAType>, virtual public FLBADec
 // ----------------------------------------------------------------------
 // DeltaBitPackDecoder
 
+/// Miniblocks are unpacked at once with the bpacking routines, and the
+/// values are then computed by a running sum of the deltas.
 template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
-  typedef typename DType::c_type T;
+  using T = typename DType::c_type;
+  using UT = typename std::make_unsigned<T>::type;
 
   explicit DeltaBitPackDecoder(const ColumnDescriptor* descr,
                                ::arrow::MemoryPool* pool = ::arrow::default_memory_pool())
@@ -1040,91 +1408,249 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
     }
   }
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
-    this->num_values_ = num_values;
-    decoder_ = ::arrow::BitUtil::BitReader(data, len);
-    values_current_block_ = 0;
-    values_current_mini_block_ = 0;
+  /// num_values is ignored in favor of the value count of the page header,
+  /// which excludes nulls
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    data_ = data;
+    len_ = len;
+    num_values_ = 0;
+    deltas_left_ = 0;
+    deltas_position_ = deltas_size_ = 0;
+    if (len == 0) {
+      return;
+    }
+    uint64_t block_size, num_mini_blocks, total_values, first_value;
+    if (!GetVlq(&block_size) || !GetVlq(&num_mini_blocks) || !GetVlq(&total_values) ||
+        !GetVlq(&first_value)) {
+      ParquetException::EofException();
+    }
+    if (block_size == 0 || block_size % 128 != 0 || num_mini_blocks == 0 ||
+        block_size % num_mini_blocks != 0 ||
+        (block_size / num_mini_blocks) % 32 != 0 ||
+        total_values > static_cast<uint64_t>(std::numeric_limits<int>::max())) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED page header");
+    }
+    values_per_mini_block_ = static_cast<int>(block_size / num_mini_blocks);
+    bit_widths_.resize(num_mini_blocks);
+    mini_block_index_ = bit_widths_.size();
+    deltas_.resize(values_per_mini_block_);
+    num_values_ = static_cast<int>(total_values);
+    deltas_left_ = num_values_ > 0 ? num_values_ - 1 : 0;
+    last_value_ = static_cast<UT>(ZigZagDecode(first_value));
+    first_value_pending_ = num_values_ > 0;
   }
 
-  virtual int Decode(T* buffer, int max_values) {
-    return GetInternal(buffer, max_values);
+  int Decode(T* buffer, int max_values) override {
+    max_values = std::min(max_values, num_values_);
+    int i = 0;
+    if (max_values > 0 && first_value_pending_) {
+      buffer[i++] = static_cast<T>(last_value_);
+      first_value_pending_ = false;
+    }
+    UT value = last_value_;
+    while (i < max_values) {
+      if (deltas_position_ == deltas_size_) {
+        NextMiniBlock();
+      }
+      const int batch_size = std::min(max_values - i, deltas_size_ - deltas_position_);
+      const UT* deltas = deltas_.data() + deltas_position_;
+      for (int j = 0; j < batch_size; ++j) {
+        value += deltas[j];
+        buffer[i + j] = static_cast<T>(value);
+      }
+      i += batch_size;
+      deltas_position_ += batch_size;
+    }
+    last_value_ = value;
+    num_values_ -= max_values;
+    return max_values;
   }
 
+  /// The number of bytes after the miniblocks decoded so far
+  int bytes_left() const { return len_; }
+
  private:
-  void InitBlock() {
-    int32_t block_size;
-    if (!decoder_.GetVlqInt(&block_size)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&num_mini_blocks_)) ParquetException::EofException();
-    if (!decoder_.GetVlqInt(&values_current_block_)) {
-      ParquetException::EofException();
+  bool GetVlq(uint64_t* out) {
+    uint64_t value = 0;
+    for (int shift = 0; len_ > 0 && shift < 64; shift += 7) {
+      const uint8_t byte = *data_++;
+      --len_;
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        *out = value;
+        return true;
+      }
     }
-    if (!decoder_.GetZigZagVlqInt(&last_value_)) ParquetException::EofException();
+    return false;
+  }
 
-    delta_bit_widths_ = AllocateBuffer(pool_, num_mini_blocks_);
-    uint8_t* bit_width_data = delta_bit_widths_->mutable_data();
+  // Read the <min delta> <bit widths> prefix of a block
+  void InitBlock() {
+    uint64_t min_delta;
+    if (!GetVlq(&min_delta)) ParquetException::EofException();
+    min_delta_ = static_cast<UT>(ZigZagDecode(min_delta));
+    const int num_mini_blocks = static_cast<int>(bit_widths_.size());
+    if (len_ < num_mini_blocks) ParquetException::EofException();
+    for (int i = 0; i < num_mini_blocks; ++i) {
+      bit_widths_[i] = data_[i];
+    }
+    data_ += num_mini_blocks;
+    len_ -= num_mini_blocks;
+    mini_block_index_ = 0;
+  }
 
-    if (!decoder_.GetZigZagVlqInt(&min_delta_)) ParquetException::EofException();
-    for (int i = 0; i < num_mini_blocks_; ++i) {
-      if (!decoder_.GetAligned<uint8_t>(1, bit_width_data + i)) {
+  // Unpack the deltas of the next miniblock, adding min_delta_
+  void NextMiniBlock() {
+    if (mini_block_index_ == bit_widths_.size()) {
+      InitBlock();
+    }
+    const int bit_width = bit_widths_[mini_block_index_++];
+    if (bit_width > static_cast<int>(sizeof(T) * 8)) {
+      throw ParquetException("Invalid DELTA_BINARY_PACKED bit width");
+    }
+    const int num_deltas =
+        static_cast<int>(std::min<int64_t>(values_per_mini_block_, deltas_left_));
+    const int num_bytes = bit_width * values_per_mini_block_ / 8;
+    const uint8_t* data = data_;
+    if (num_bytes > len_) {
+      // Only the deltas actually encoded need be present
+      if (BitUtil::BytesForBits(bit_width * num_deltas) > len_) {
         ParquetException::EofException();
       }
+      padded_.assign(num_bytes, 0);
+      std::memcpy(padded_.data(), data_, len_);
+      data = padded_.data();
+    }
+    UnpackDeltas(data, bit_width);
+    for (int i = 0; i < values_per_mini_block_; ++i) {
+      deltas_[i] += min_delta_;
     }
-    values_per_mini_block_ = block_size / num_mini_blocks_;
-    mini_block_idx_ = 0;
-    delta_bit_width_ = bit_width_data[0];
-    values_current_mini_block_ = values_per_mini_block_;
+    const int consumed = std::min(num_bytes, len_);
+    data_ += consumed;
+    len_ -= consumed;
+    deltas_left_ -= num_deltas;
+    deltas_position_ = 0;
+    deltas_size_ = num_deltas;
   }
 
-  template <typename T>
-  int GetInternal(T* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    const uint8_t* bit_width_data = delta_bit_widths_->data();
-    for (int i = 0; i < max_values; ++i) {
-      if (ARROW_PREDICT_FALSE(values_current_mini_block_ == 0)) {
-        ++mini_block_idx_;
-        if (mini_block_idx_ < static_cast<size_t>(delta_bit_widths_->size())) {
-          delta_bit_width_ = bit_width_data[mini_block_idx_];
-          values_current_mini_block_ = values_per_mini_block_;
-        } else {
-          InitBlock();
-          buffer[i] = last_value_;
-          continue;
-        }
+  void UnpackDeltas(const uint8_t* data, int bit_width) {
+    const int num_values = values_per_mini_block_;
+    if (bit_width == 0) {
+      std::fill(deltas_.begin(), deltas_.end(), 0);
+    } else if (sizeof(UT) == 4) {
+      ::arrow::internal::unpack32(reinterpret_cast<const uint32_t*>(data),
+                                  reinterpret_cast<uint32_t*>(deltas_.data()),
+                                  num_values, bit_width);
+    } else if (bit_width <= 32) {
+      unpacked_.resize(num_values);
+      ::arrow::internal::unpack32(reinterpret_cast<const uint32_t*>(data),
+                                  unpacked_.data(), num_values, bit_width);
+      std::copy(unpacked_.begin(), unpacked_.end(), deltas_.begin());
+    } else {
+      // Wider than bpacking supports: read values as two halves, since values
+      // are packed from the least significant bit
+      BitUtil::BitReader reader(data, bit_width * num_values / 8);
+      for (int i = 0; i < num_values; ++i) {
+        uint64_t low = 0, high = 0;
+        reader.GetValue(32, &low);
+        reader.GetValue(bit_width - 32, &high);
+        deltas_[i] = static_cast<UT>(low | (high << 32));
       }
-
-      // TODO: the key to this algorithm is to decode the entire miniblock at once.
-      int64_t delta;
-      if (!decoder_.GetValue(delta_bit_width_, &delta)) ParquetException::EofException();
-      delta += min_delta_;
-      last_value_ += static_cast<int32_t>(delta);
-      buffer[i] = last_value_;
-      --values_current_mini_block_;
     }
-    this->num_values_ -= max_values;
-    return max_values;
   }
 
   ::arrow::MemoryPool* pool_;
-  ::arrow::BitUtil::BitReader decoder_;
-  int32_t values_current_block_;
-  int32_t num_mini_blocks_;
-  uint64_t values_per_mini_block_;
-  uint64_t values_current_mini_block_;
-
-  int32_t min_delta_;
-  size_t mini_block_idx_;
-  std::shared_ptr<ResizableBuffer> delta_bit_widths_;
-  int delta_bit_width_;
-
-  int32_t last_value_;
+  int values_per_mini_block_;
+  std::vector<uint8_t> bit_widths_;
+  size_t mini_block_index_;
+  UT min_delta_;
+  // Number of deltas not yet unpacked
+  int64_t deltas_left_;
+  // The unpacked deltas of the current miniblock
+  std::vector<UT> deltas_;
+  int deltas_position_;
+  int deltas_size_;
+  std::vector<uint32_t> unpacked_;
+  std::vector<uint8_t> padded_;
+
+  bool first_value_pending_;
+  UT last_value_;
 };
 
+// ----------------------------------------------------------------------
+// Arrow decoding of DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY, through Decode()
+
+template <typename BuilderType>
+static ::arrow::Status DecodeArrowWith(TypedDecoder<ByteArrayType>* decoder,
+                                       int num_values, int null_count,
+                                       const uint8_t* valid_bits,
+                                       int64_t valid_bits_offset, BuilderType* builder,
+                                       int* values_decoded) {
+  std::vector<ByteArray> values(num_values - null_count);
+  const int num_valid = decoder->Decode(values.data(), num_values - null_count);
+  if (num_valid != num_values - null_count) {
+    ParquetException::EofException();
+  }
+  ARROW_RETURN_NOT_OK(builder->Reserve(num_values));
+  ::arrow::internal::BitmapReader bit_reader(valid_bits, valid_bits_offset, num_values);
+  for (int i = 0, j = 0; i < num_values; ++i) {
+    if (bit_reader.IsSet()) {
+      ARROW_RETURN_NOT_OK(builder->Append(values[j].ptr, values[j].len));
+      ++j;
+    } else {
+      ARROW_RETURN_NOT_OK(builder->AppendNull());
+    }
+    bit_reader.Next();
+  }
+  *values_decoded = num_values;
+  return ::arrow::Status::OK();
+}
+
+template <typename BuilderType>
+static ::arrow::Status DecodeArrowNonNullWith(TypedDecoder<ByteArrayType>* decoder,
+                                              int num_values, BuilderType* builder,
+                                              int* values_decoded) {
+  std::vector<ByteArray> values(num_values);
+  num_values = decoder->Decode(values.data(), num_values);
+  ARROW_RETURN_NOT_OK(builder->Reserve(num_values));
+  for (int i = 0; i < num_values; ++i) {
+    ARROW_RETURN_NOT_OK(builder->Append(values[i].ptr, values[i].len));
+  }
+  *values_decoded = num_values;
+  return ::arrow::Status::OK();
+}
+
+#define DELTA_BYTE_ARRAY_DECODE_ARROW()                                                 \
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,            \
+                  int64_t valid_bits_offset,                                            \
+                  ::arrow::ChunkedBinaryBuilder* out) override {                        \
+    int result = 0;                                                                     \
+    PARQUET_THROW_NOT_OK(DecodeArrowWith(this, num_values, null_count, valid_bits,      \
+                                         valid_bits_offset, out, &result));             \
+    return result;                                                                      \
+  }                                                                                     \
+                                                                                        \
+  int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,            \
+                  int64_t valid_bits_offset,                                            \
+                  ::arrow::BinaryDictionaryBuilder* out) override {                     \
+    int result = 0;                                                                     \
+    PARQUET_THROW_NOT_OK(DecodeArrowWith(this, num_values, null_count, valid_bits,      \
+                                         valid_bits_offset, out, &result));             \
+    return result;                                                                      \
+  }                                                                                     \
+                                                                                        \
+  int DecodeArrowNonNull(int num_values,                                                \
+                         ::arrow::ChunkedBinaryBuilder* out) override {                 \
+    int result = 0;                                                                     \
+    PARQUET_THROW_NOT_OK(DecodeArrowNonNullWith(this, num_values, out, &result));       \
+    return result;                                                                      \
+  }
+
 // ----------------------------------------------------------------------
 // DELTA_LENGTH_BYTE_ARRAY
 
 class DeltaLengthByteArrayDecoder : public DecoderImpl,
-                                    virtual public TypedDecoder<ByteArrayType> {
+                                    virtual public ByteArrayDecoder {
  public:
   explicit DeltaLengthByteArrayDecoder(
       const ColumnDescriptor* descr,
@@ -1132,86 +1658,168 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
       : DecoderImpl(descr, Encoding::DELTA_LENGTH_BYTE_ARRAY),
         len_decoder_(nullptr, pool) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int total_lengths_len = *reinterpret_cast<const int*>(data);
-    data += 4;
-    this->len_decoder_.SetData(num_values, data, total_lengths_len);
-    data_ = data + total_lengths_len;
-    this->len_ = len - 4 - total_lengths_len;
+  using ByteArrayDecoder::DecodeSpaced;
+
+  /// The lengths are all decoded upfront, to find the start of the values
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    len_decoder_.SetData(num_values, data, len);
+    num_values_ = len_decoder_.values_left();
+    lengths_.resize(num_values_);
+    len_decoder_.Decode(lengths_.data(), num_values_);
+    length_index_ = 0;
+    int64_t total_length = 0;
+    for (int32_t length : lengths_) {
+      if (length < 0) {
+        throw ParquetException("Invalid DELTA_LENGTH_BYTE_ARRAY value length");
+      }
+      total_length += length;
+    }
+    len_ = len_decoder_.bytes_left();
+    if (total_length > len_) ParquetException::EofException();
+    data_ = data + (len - len_);
   }
 
-  virtual int Decode(ByteArray* buffer, int max_values) {
+  int Decode(ByteArray* buffer, int max_values) override {
     max_values = std::min(max_values, num_values_);
-    std::vector<int> lengths(max_values);
-    len_decoder_.Decode(lengths.data(), max_values);
     for (int i = 0; i < max_values; ++i) {
-      buffer[i].len = lengths[i];
+      const int32_t length = lengths_[length_index_++];
+      buffer[i].len = static_cast<uint32_t>(length);
       buffer[i].ptr = data_;
-      this->data_ += lengths[i];
-      this->len_ -= lengths[i];
+      data_ += length;
+      len_ -= length;
     }
-    this->num_values_ -= max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
+  DELTA_BYTE_ARRAY_DECODE_ARROW()
+
  private:
   DeltaBitPackDecoder<Int32Type> len_decoder_;
+  std::vector<int32_t> lengths_;
+  int length_index_;
 };
 
 // ----------------------------------------------------------------------
 // DELTA_BYTE_ARRAY
 
-class DeltaByteArrayDecoder : public DecoderImpl,
-                              virtual public TypedDecoder<ByteArrayType> {
+/// Decoded values are stored in buffers owned by the decoder, valid until the
+/// next call to SetData(), except for values without a prefix, which point
+/// into the page data.
+class DeltaByteArrayDecoder : public DecoderImpl, virtual public ByteArrayDecoder {
  public:
   explicit DeltaByteArrayDecoder(
       const ColumnDescriptor* descr,
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool())
       : DecoderImpl(descr, Encoding::DELTA_BYTE_ARRAY),
+        pool_(pool),
         prefix_len_decoder_(nullptr, pool),
-        suffix_decoder_(nullptr, pool),
-        last_value_(0, nullptr) {}
+        suffix_decoder_(nullptr, pool) {}
 
-  virtual void SetData(int num_values, const uint8_t* data, int len) {
-    num_values_ = num_values;
-    if (len == 0) return;
-    int prefix_len_length = *reinterpret_cast<const int*>(data);
-    data += 4;
-    len -= 4;
-    prefix_len_decoder_.SetData(num_values, data, prefix_len_length);
-    data += prefix_len_length;
-    len -= prefix_len_length;
-    suffix_decoder_.SetData(num_values, data, len);
-  }
-
-  // TODO: this doesn't work and requires memory management. We need to allocate
-  // new strings to store the results.
-  virtual int Decode(ByteArray* buffer, int max_values) {
-    max_values = std::min(max_values, this->num_values_);
-    for (int i = 0; i < max_values; ++i) {
-      int prefix_len = 0;
-      prefix_len_decoder_.Decode(&prefix_len, 1);
-      ByteArray suffix = {0, nullptr};
-      suffix_decoder_.Decode(&suffix, 1);
-      buffer[i].len = prefix_len + suffix.len;
+  using ByteArrayDecoder::DecodeSpaced;
 
-      uint8_t* result = reinterpret_cast<uint8_t*>(malloc(buffer[i].len));
-      memcpy(result, last_value_.ptr, prefix_len);
-      memcpy(result + prefix_len, suffix.ptr, suffix.len);
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    prefix_len_decoder_.SetData(num_values, data, len);
+    num_values_ = prefix_len_decoder_.values_left();
+    prefix_lengths_.resize(num_values_);
+    prefix_len_decoder_.Decode(prefix_lengths_.data(), num_values_);
+    prefix_index_ = 0;
+    const int suffixes_len = prefix_len_decoder_.bytes_left();
+    suffix_decoder_.SetData(num_values, data + (len - suffixes_len), suffixes_len);
+    if (suffix_decoder_.values_left() != num_values_) {
+      throw ParquetException("DELTA_BYTE_ARRAY prefix and suffix counts differ");
+    }
+    last_value_ = ByteArray();
+    value_buffers_.clear();
+  }
 
-      buffer[i].ptr = result;
+  int Decode(ByteArray* buffer, int max_values) override {
+    max_values = suffix_decoder_.Decode(buffer, std::min(max_values, num_values_));
+    const int32_t* prefix_lengths = prefix_lengths_.data() + prefix_index_;
+    int64_t total_length = 0;
+    for (int i = 0; i < max_values; ++i) {
+      if (prefix_lengths[i] != 0) {
+        total_length += prefix_lengths[i] + buffer[i].len;
+      }
+    }
+    uint8_t* out = nullptr;
+    if (total_length > 0) {
+      value_buffers_.push_back(AllocateBuffer(pool_, total_length));
+      out = value_buffers_.back()->mutable_data();
+    }
+    for (int i = 0; i < max_values; ++i) {
+      const int32_t prefix_length = prefix_lengths[i];
+      if (prefix_length != 0) {
+        if (prefix_length < 0 || static_cast<uint32_t>(prefix_length) > last_value_.len) {
+          throw ParquetException("Invalid DELTA_BYTE_ARRAY prefix length");
+        }
+        std::memcpy(out, last_value_.ptr, prefix_length);
+        std::memcpy(out + prefix_length, buffer[i].ptr, buffer[i].len);
+        buffer[i].len += prefix_length;
+        buffer[i].ptr = out;
+        out += buffer[i].len;
+      }
       last_value_ = buffer[i];
     }
-    this->num_values_ -= max_values;
+    prefix_index_ += max_values;
+    num_values_ -= max_values;
     return max_values;
   }
 
+  DELTA_BYTE_ARRAY_DECODE_ARROW()
+
  private:
+  ::arrow::MemoryPool* pool_;
   DeltaBitPackDecoder<Int32Type> prefix_len_decoder_;
+  std::vector<int32_t> prefix_lengths_;
+  int prefix_index_;
   DeltaLengthByteArrayDecoder suffix_decoder_;
   ByteArray last_value_;
+  std::vector<std::shared_ptr<ResizableBuffer>> value_buffers_;
+};
+
+#undef DELTA_BYTE_ARRAY_DECODE_ARROW
+
+// ----------------------------------------------------------------------
+// BYTE_STREAM_SPLIT decoder
+
+template <typename DType>
+class ByteStreamSplitDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
+ public:
+  using T = typename DType::c_type;
+
+  explicit ByteStreamSplitDecoder(const ColumnDescriptor* descr)
+      : DecoderImpl(descr, Encoding::BYTE_STREAM_SPLIT),
+        num_values_in_buffer_(0),
+        values_decoded_(0) {}
+
+  // num_values counts the nulls of the page too, so the length of the
+  // streams is derived from the size of the data
+  void SetData(int num_values, const uint8_t* data, int len) override {
+    if (len % static_cast<int>(sizeof(T)) != 0) {
+      throw ParquetException("BYTE_STREAM_SPLIT data size is not a multiple of " +
+                             std::to_string(sizeof(T)));
+    }
+    DecoderImpl::SetData(num_values, data, len);
+    num_values_in_buffer_ = len / static_cast<int>(sizeof(T));
+    values_decoded_ = 0;
+  }
+
+  int Decode(T* buffer, int max_values) override {
+    max_values = std::min(max_values, num_values_);
+    if (max_values > num_values_in_buffer_ - values_decoded_) {
+      ParquetException::EofException();
+    }
+    ::arrow::internal::ByteStreamSplitDecode<T>(data_ + values_decoded_, max_values,
+                                                num_values_in_buffer_, buffer);
+    values_decoded_ += max_values;
+    num_values_ -= max_values;
+    return max_values;
+  }
+
+ private:
+  int num_values_in_buffer_;
+  int values_decoded_;
 };
 
 // ----------------------------------------------------------------------
@@ -1239,6 +1847,33 @@ std::unique_ptr<Decoder> MakeDecoder(Type::type type_num, Encoding::type encodin
       default:
         break;
     }
+  } else if (encoding == Encoding::DELTA_BINARY_PACKED) {
+    switch (type_num) {
+      case Type::INT32:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int32Type>(descr));
+      case Type::INT64:
+        return std::unique_ptr<Decoder>(new DeltaBitPackDecoder<Int64Type>(descr));
+      default:
+        throw ParquetException("DELTA_BINARY_PACKED only supports INT32 and INT64");
+    }
+  } else if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY ||
+             encoding == Encoding::DELTA_BYTE_ARRAY) {
+    if (type_num != Type::BYTE_ARRAY) {
+      throw ParquetException(EncodingToString(encoding) + " only supports BYTE_ARRAY");
+    }
+    if (encoding == Encoding::DELTA_LENGTH_BYTE_ARRAY) {
+      return std::unique_ptr<Decoder>(new DeltaLengthByteArrayDecoder(descr));
+    }
+    return std::unique_ptr<Decoder>(new DeltaByteArrayDecoder(descr));
+  } else if (encoding == Encoding::BYTE_STREAM_SPLIT) {
+    switch (type_num) {
+      case Type::FLOAT:
+        return std::unique_ptr<Decoder>(new ByteStreamSplitDecoder<FloatType>(descr));
+      case Type::DOUBLE:
+        return std::unique_ptr<Decoder>(new ByteStreamSplitDecoder<DoubleType>(descr));
+      default:
+        throw ParquetException("BYTE_STREAM_SPLIT only supports FLOAT and DOUBLE");
+    }
   } else {
     ParquetException::NYI("Selected encoding is not supported");
   }
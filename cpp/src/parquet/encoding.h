@@ -35,12 +35,8 @@
 namespace arrow {
 
 class BinaryDictionaryBuilder;
-
-namespace internal {
-
 class ChunkedBinaryBuilder;
 
-}  // namespace internal
 }  // namespace arrow
 
 namespace parquet {
@@ -93,6 +89,8 @@ class TypedEncoder : virtual public Encoder {
 template <typename DType>
 class DictEncoder : virtual public TypedEncoder<DType> {
  public:
+  using T = typename DType::c_type;
+
   /// Writes out any buffered indices to buffer preceded by the bit width of this data.
   /// Returns the number of bytes written.
   /// If the supplied buffer is not big enough, returns -1.
@@ -110,6 +108,23 @@ class DictEncoder : virtual public TypedEncoder<DType> {
   virtual void WriteDict(uint8_t* buffer) = 0;
 
   virtual int num_entries() const = 0;
+
+  /// \brief Add the values of an existing dictionary to the encoder's dictionary
+  /// without buffering any index, storing in memo_indices the encoder's index
+  /// of each of them (values already present keep their index). Indices into
+  /// values can then be mapped through memo_indices and passed to PutIndices(),
+  /// sparing the hashing of every value they reference.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  virtual void PutDictionary(const T* values, int num_values, int32_t* memo_indices) = 0;
+
+  /// \brief Buffer indices into the encoder's dictionary, as obtained from
+  /// PutDictionary()
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  virtual void PutIndices(const int32_t* indices, int num_values) = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -172,7 +187,19 @@ class TypedDecoder : virtual public Decoder {
 template <typename DType>
 class DictDecoder : virtual public TypedDecoder<DType> {
  public:
+  using T = typename DType::c_type;
+
   virtual void SetDict(TypedDecoder<DType>* dictionary) = 0;
+
+  /// \brief Decode the next num_values dictionary indices of the data page
+  /// without looking them up in the dictionary
+  ///
+  /// Throws if an index falls outside of the dictionary.
+  /// \return the number of indices decoded
+  virtual int DecodeIndices(int num_values, int32_t* indices) = 0;
+
+  /// \brief The decoded dictionary values, valid until the next SetDict()
+  virtual void GetDictionary(const T** dictionary, int32_t* dictionary_length) = 0;
 };
 
 // ----------------------------------------------------------------------
@@ -209,7 +236,7 @@ class ByteArrayDecoder : virtual public TypedDecoder<ByteArrayType> {
   using TypedDecoder<ByteArrayType>::DecodeSpaced;
   virtual int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                           int64_t valid_bits_offset,
-                          ::arrow::internal::ChunkedBinaryBuilder* builder) = 0;
+                          ::arrow::ChunkedBinaryBuilder* builder) = 0;
 
   virtual int DecodeArrow(int num_values, int null_count, const uint8_t* valid_bits,
                           int64_t valid_bits_offset,
@@ -218,7 +245,7 @@ class ByteArrayDecoder : virtual public TypedDecoder<ByteArrayType> {
   // TODO(wesm): Implement DecodeArrowNonNull as part of ARROW-3325
   // See also ARROW-3772, ARROW-3769
   virtual int DecodeArrowNonNull(int num_values,
-                                 ::arrow::internal::ChunkedBinaryBuilder* builder) = 0;
+                                 ::arrow::ChunkedBinaryBuilder* builder) = 0;
 };
 
 class FLBADecoder : virtual public TypedDecoder<FLBAType> {
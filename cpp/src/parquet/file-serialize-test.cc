@@ -21,6 +21,8 @@
 #include "parquet/column_writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/file_writer.h"
+#include "parquet/page_index.h"
+#include "parquet/statistics.h"
 #include "parquet/test-specialization.h"
 #include "parquet/test-util.h"
 #include "parquet/types.h"
@@ -307,6 +309,100 @@ TYPED_TEST(TestSerialize, SmallFileZstd) {
 }
 #endif
 
+TEST(TestPageIndex, WriteAndRead) {
+  const int num_rows = 1000;
+  const int rows_per_page = 100;
+  auto schema = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {PrimitiveNode::Make("a", Repetition::REQUIRED, Type::INT32),
+       PrimitiveNode::Make("b", Repetition::OPTIONAL, Type::INT32),
+       PrimitiveNode::Make("c", Repetition::OPTIONAL, Type::INT32)}));
+
+  std::vector<int32_t> values(num_rows);
+  std::vector<int16_t> def_levels(num_rows);
+  std::vector<int16_t> null_def_levels(num_rows, 0);
+  for (int i = 0; i < num_rows; ++i) {
+    values[i] = num_rows - i;
+    def_levels[i] = i % 2;
+  }
+
+  // One page per write batch
+  auto props = WriterProperties::Builder()
+                   .disable_dictionary()
+                   ->write_batch_size(rows_per_page)
+                   ->data_pagesize(1)
+                   ->enable_page_index()
+                   ->build();
+  std::shared_ptr<InMemoryOutputStream> sink(new InMemoryOutputStream());
+  auto file_writer = ParquetFileWriter::Open(sink, schema, props);
+  for (int rg = 0; rg < 2; ++rg) {
+    RowGroupWriter* row_group_writer = rg == 0 ? file_writer->AppendRowGroup()
+                                               : file_writer->AppendBufferedRowGroup();
+    for (int col = 0; col < 3; ++col) {
+      auto column_writer = static_cast<Int32Writer*>(
+          rg == 0 ? row_group_writer->NextColumn() : row_group_writer->column(col));
+      const int16_t* levels = col == 0 ? nullptr
+                              : col == 1 ? def_levels.data()
+                                         : null_def_levels.data();
+      column_writer->WriteBatch(num_rows, levels, nullptr, values.data());
+    }
+    row_group_writer->Close();
+  }
+  file_writer->Close();
+
+  auto source = std::make_shared<::arrow::io::BufferReader>(sink->GetBuffer());
+  auto file_reader = ParquetFileReader::Open(source);
+  for (int rg = 0; rg < 2; ++rg) {
+    auto rg_reader = file_reader->RowGroup(rg);
+    for (int col = 0; col < 3; ++col) {
+      auto col_metadata = rg_reader->metadata()->ColumnChunk(col);
+      ASSERT_TRUE(col_metadata->has_column_index());
+      ASSERT_TRUE(col_metadata->has_offset_index());
+
+      std::shared_ptr<OffsetIndex> offset_index = rg_reader->GetOffsetIndex(col);
+      std::shared_ptr<ColumnIndex> column_index = rg_reader->GetColumnIndex(col);
+      ASSERT_NE(nullptr, offset_index);
+      ASSERT_NE(nullptr, column_index);
+      const int num_pages = col == 2 ? 1 : num_rows / rows_per_page;
+      ASSERT_EQ(num_pages, offset_index->num_pages());
+      ASSERT_EQ(num_pages, column_index->num_pages());
+
+      // The pages are contiguous and make up the column chunk
+      const auto& locations = offset_index->page_locations();
+      ASSERT_EQ(col_metadata->data_page_offset(), locations[0].offset);
+      for (int i = 0; i < num_pages; ++i) {
+        ASSERT_EQ(i * rows_per_page, locations[i].first_row_index);
+        ASSERT_EQ(i, offset_index->FindPage(i * rows_per_page + rows_per_page - 1));
+        if (i > 0) {
+          ASSERT_EQ(locations[i - 1].offset + locations[i - 1].compressed_page_size,
+                    locations[i].offset);
+        }
+      }
+      ASSERT_EQ(locations.back().offset + locations.back().compressed_page_size,
+                col_metadata->data_page_offset() + col_metadata->total_compressed_size());
+
+      if (col == 2) {
+        ASSERT_TRUE(column_index->null_pages()[0]);
+        ASSERT_EQ(num_rows, column_index->null_counts()[0]);
+        continue;
+      }
+      ASSERT_EQ(BoundaryOrder::DESCENDING, column_index->boundary_order());
+      for (int i = 0; i < num_pages; ++i) {
+        ASSERT_FALSE(column_index->null_pages()[i]);
+        ASSERT_EQ(col == 0 ? 0 : rows_per_page / 2, column_index->null_counts()[i]);
+        TypedRowGroupStatistics<Int32Type> page_stats(
+            rg_reader->metadata()->schema()->Column(col),
+            column_index->encoded_min_values()[i], column_index->encoded_max_values()[i],
+            0, 0, 0, true);
+        // Column b only holds values at odd rows
+        const int values_per_page = col == 0 ? rows_per_page : rows_per_page / 2;
+        ASSERT_EQ(num_rows - i * values_per_page, page_stats.max());
+        ASSERT_EQ(num_rows - (i + 1) * values_per_page + 1, page_stats.min());
+      }
+    }
+  }
+}
+
 }  // namespace test
 
 }  // namespace parquet
@@ -17,22 +17,35 @@
 
 #include "parquet/file_reader.h"
 
+#include <sys/stat.h>
+
 #include <algorithm>
+#include <cerrno>
 #include <cstdint>
 #include <cstring>
+#include <list>
 #include <memory>
+#include <mutex>
+#include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/file.h"
+#include "arrow/io/instrumented.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread-pool.h"
 
+#include "parquet/bloom_filter.h"
 #include "parquet/column_reader.h"
 #include "parquet/column_scanner.h"
 #include "parquet/exception.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
 #include "parquet/types.h"
@@ -50,6 +63,149 @@ static constexpr uint8_t PARQUET_MAGIC[4] = {'P', 'A', 'R', '1'};
 // For PARQUET-816
 static constexpr int64_t kMaxDictHeaderSize = 100;
 
+// ----------------------------------------------------------------------
+// Column chunk ranges
+
+using ::arrow::io::CoalesceOptions;
+using ::arrow::io::ReadRange;
+
+// The bytes of a column chunk, including its dictionary page
+static ReadRange ComputeColumnChunkRange(const FileMetaData& file_metadata,
+                                         const ColumnChunkMetaData& col,
+                                         int64_t source_size) {
+  int64_t col_start = col.data_page_offset();
+  if (col.has_dictionary_page() && col_start > col.dictionary_page_offset()) {
+    col_start = col.dictionary_page_offset();
+  }
+
+  int64_t col_length = col.total_compressed_size();
+
+  // PARQUET-816 workaround for old files created by older parquet-mr
+  const ApplicationVersion& version = file_metadata.writer_version();
+  if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
+    // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
+    // dictionary page header size in total_compressed_size and total_uncompressed_size
+    // (see IMPALA-694). We add padding to compensate.
+    int64_t bytes_remaining = source_size - (col_start + col_length);
+    int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
+    col_length += padding;
+  }
+
+  return {col_start, col_length};
+}
+
+static ::arrow::Status ReadSourceRange(RandomAccessSource* source,
+                                       const ReadRange& range,
+                                       std::shared_ptr<Buffer>* out) {
+  try {
+    *out = source->ReadAt(range.offset, range.length);
+  } catch (const ParquetException& e) {
+    return ::arrow::Status::IOError(e.what());
+  }
+  if ((*out)->size() != range.length) {
+    return ::arrow::Status::IOError("Failed reading ", range.length,
+                                    " bytes of column chunk data at offset ",
+                                    range.offset);
+  }
+  return ::arrow::Status::OK();
+}
+
+// Column chunk ranges read ahead of decoding on the I/O thread pool, see
+// ParquetFileReader::PreBuffer. Ranges close to each other are merged into
+// a single read
+class PreBufferedRanges {
+ public:
+  PreBufferedRanges(RandomAccessSource* source, std::vector<ReadRange> ranges,
+                    const CoalesceOptions& options) {
+    std::sort(ranges.begin(), ranges.end(),
+              [](const ReadRange& left, const ReadRange& right) {
+                return left.offset < right.offset;
+              });
+    std::vector<ReadRange> reads;
+    for (const ReadRange& range : ranges) {
+      if (!reads.empty()) {
+        ReadRange& last = reads.back();
+        const int64_t last_end = last.offset + last.length;
+        const int64_t end = std::max(last_end, range.offset + range.length);
+        if (range.offset - last_end <= options.hole_size_limit &&
+            end - last.offset <= options.range_size_limit) {
+          last.length = end - last.offset;
+          continue;
+        }
+      }
+      reads.push_back(range);
+    }
+
+    auto pool = ::arrow::internal::GetIOThreadPool();
+    for (const ReadRange& read : reads) {
+      Entry entry{read, ::arrow::Future<std::shared_ptr<Buffer>>()};
+      if (options.use_threads) {
+        entry.buffer = pool->SubmitAsync<std::shared_ptr<Buffer>>(
+            [source, read](std::shared_ptr<Buffer>* out) {
+              return ReadSourceRange(source, read, out);
+            });
+      } else {
+        entry.buffer = ::arrow::Future<std::shared_ptr<Buffer>>::Make();
+      }
+      entries_.push_back(entry);
+    }
+    if (!options.use_threads && !entries_.empty()) {
+      // Issue the reads one after the other, in file order
+      std::vector<Entry> entries = entries_;
+      ::arrow::Status st = pool->Spawn([source, entries]() {
+        for (const Entry& entry : entries) {
+          std::shared_ptr<Buffer> buffer;
+          ::arrow::Status st = ReadSourceRange(source, entry.range, &buffer);
+          if (st.ok()) {
+            entry.buffer.MarkFinished(buffer);
+          } else {
+            entry.buffer.MarkFailed(st);
+          }
+        }
+      });
+      if (!st.ok()) {
+        for (const Entry& entry : entries_) {
+          entry.buffer.MarkFailed(st);
+        }
+      }
+    }
+  }
+
+  ~PreBufferedRanges() { Wait(); }
+
+  // The bytes [offset, offset + length), waiting for them to be read, or null
+  // if they were not pre-buffered
+  std::shared_ptr<Buffer> Read(int64_t offset, int64_t length) const {
+    auto it = std::upper_bound(
+        entries_.begin(), entries_.end(), offset,
+        [](int64_t offset, const Entry& entry) { return offset < entry.range.offset; });
+    while (it != entries_.begin()) {
+      const Entry& entry = *--it;
+      if (offset + length <= entry.range.offset + entry.range.length) {
+        std::shared_ptr<Buffer> buffer;
+        PARQUET_THROW_NOT_OK(entry.buffer.Get(&buffer));
+        return ::arrow::SliceBuffer(buffer, offset - entry.range.offset, length);
+      }
+    }
+    return nullptr;
+  }
+
+  // Wait for all reads to complete, so that the source can be closed
+  void Wait() const {
+    for (const Entry& entry : entries_) {
+      entry.buffer.Wait();
+    }
+  }
+
+ private:
+  struct Entry {
+    ReadRange range;
+    ::arrow::Future<std::shared_ptr<Buffer>> buffer;
+  };
+  // Ordered by offset
+  std::vector<Entry> entries_;
+};
+
 // ----------------------------------------------------------------------
 // RowGroupReader public API
 
@@ -75,6 +231,27 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::shared_ptr<ColumnIndex> RowGroupReader::GetColumnIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnIndex(i);
+}
+
+std::shared_ptr<OffsetIndex> RowGroupReader::GetOffsetIndex(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetOffsetIndex(i);
+}
+
+std::shared_ptr<BloomFilter> RowGroupReader::GetBloomFilter(int i) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetBloomFilter(i);
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
@@ -82,8 +259,12 @@ const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->met
 class SerializedRowGroup : public RowGroupReader::Contents {
  public:
   SerializedRowGroup(RandomAccessSource* source, FileMetaData* file_metadata,
-                     int row_group_number, const ReaderProperties& props)
-      : source_(source), file_metadata_(file_metadata), properties_(props) {
+                     int row_group_number, const ReaderProperties& props,
+                     const std::shared_ptr<PreBufferedRanges>& pre_buffered = nullptr)
+      : source_(source),
+        file_metadata_(file_metadata),
+        properties_(props),
+        pre_buffered_(pre_buffered) {
     row_group_metadata_ = file_metadata->RowGroup(row_group_number);
   }
 
@@ -94,37 +275,86 @@ class SerializedRowGroup : public RowGroupReader::Contents {
   std::unique_ptr<PageReader> GetColumnPageReader(int i) override {
     // Read column chunk from the file
     auto col = row_group_metadata_->ColumnChunk(i);
+    ReadRange range = ComputeColumnChunkRange(*file_metadata_, *col, source_->Size());
 
-    int64_t col_start = col->data_page_offset();
-    if (col->has_dictionary_page() && col_start > col->dictionary_page_offset()) {
-      col_start = col->dictionary_page_offset();
+    std::unique_ptr<InputStream> stream;
+    std::shared_ptr<Buffer> buffer;
+    if (pre_buffered_) {
+      buffer = pre_buffered_->Read(range.offset, range.length);
+    }
+    if (buffer) {
+      stream.reset(new InMemoryInputStream(buffer));
+    } else {
+      stream = properties_.GetStream(source_, range.offset, range.length);
     }
 
-    int64_t col_length = col->total_compressed_size();
-    std::unique_ptr<InputStream> stream;
+    return PageReader::Open(std::move(stream), col->num_values(), col->compression(),
+                            properties_.memory_pool());
+  }
 
-    // PARQUET-816 workaround for old files created by older parquet-mr
-    const ApplicationVersion& version = file_metadata_->writer_version();
-    if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
-      // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
-      // dictionary page header size in total_compressed_size and total_uncompressed_size
-      // (see IMPALA-694). We add padding to compensate.
-      int64_t bytes_remaining = source_->Size() - (col_start + col_length);
-      int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
-      col_length += padding;
+  std::shared_ptr<ColumnIndex> GetColumnIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_column_index()) {
+      return nullptr;
     }
+    std::shared_ptr<Buffer> buffer =
+        ReadIndex(col->column_index_offset(), col->column_index_length());
+    uint32_t index_len = static_cast<uint32_t>(buffer->size());
+    return ColumnIndex::Make(buffer->data(), &index_len);
+  }
 
-    stream = properties_.GetStream(source_, col_start, col_length);
+  std::shared_ptr<OffsetIndex> GetOffsetIndex(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_offset_index()) {
+      return nullptr;
+    }
+    std::shared_ptr<Buffer> buffer =
+        ReadIndex(col->offset_index_offset(), col->offset_index_length());
+    uint32_t index_len = static_cast<uint32_t>(buffer->size());
+    return OffsetIndex::Make(buffer->data(), &index_len);
+  }
 
-    return PageReader::Open(std::move(stream), col->num_values(), col->compression(),
-                            properties_.memory_pool());
+  std::shared_ptr<BloomFilter> GetBloomFilter(int i) override {
+    auto col = row_group_metadata_->ColumnChunk(i);
+    if (!col->has_bloom_filter()) {
+      return nullptr;
+    }
+    // The bitset follows a header of its length, hash strategy and algorithm
+    const int64_t header_size = 3 * sizeof(uint32_t);
+    const int64_t offset = col->bloom_filter_offset();
+    std::shared_ptr<Buffer> header = ReadIndex(offset, header_size);
+    uint32_t num_bytes;
+    memcpy(&num_bytes, header->data(), sizeof(uint32_t));
+    if (num_bytes > BloomFilter::kMaximumBloomFilterBytes ||
+        offset + header_size + num_bytes > source_->Size()) {
+      throw ParquetException("Bloom filter lies outside the file");
+    }
+    std::unique_ptr<InputStream> stream =
+        properties_.GetStream(source_, offset, header_size + num_bytes);
+    return std::make_shared<BlockSplitBloomFilter>(
+        BlockSplitBloomFilter::Deserialize(stream.get()));
   }
 
  private:
+  // Reads a page index or Bloom filter header
+  std::shared_ptr<Buffer> ReadIndex(int64_t offset, int64_t length) {
+    if (offset < 0 || length < 0 || offset + length > source_->Size()) {
+      throw ParquetException("Index lies outside the file");
+    }
+    std::shared_ptr<Buffer> buffer = source_->ReadAt(offset, length);
+    if (buffer->size() != length) {
+      std::stringstream ss;
+      ss << "Failed reading " << length << " bytes of index at offset " << offset;
+      throw ParquetException(ss.str());
+    }
+    return buffer;
+  }
+
   RandomAccessSource* source_;
   FileMetaData* file_metadata_;
   std::unique_ptr<RowGroupMetaData> row_group_metadata_;
   ReaderProperties properties_;
+  std::shared_ptr<PreBufferedRanges> pre_buffered_;
 };
 
 // ----------------------------------------------------------------------
@@ -146,16 +376,50 @@ class SerializedFile : public ParquetFileReader::Contents {
     }
   }
 
-  void Close() override { source_->Close(); }
+  void Close() override {
+    if (pre_buffered_) {
+      pre_buffered_->Wait();
+    }
+    source_->Close();
+  }
 
   std::shared_ptr<RowGroupReader> GetRowGroup(int i) override {
-    std::unique_ptr<SerializedRowGroup> contents(
-        new SerializedRowGroup(source_.get(), file_metadata_.get(), i, properties_));
+    std::unique_ptr<SerializedRowGroup> contents(new SerializedRowGroup(
+        source_.get(), file_metadata_.get(), i, properties_, pre_buffered_));
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
   std::shared_ptr<FileMetaData> metadata() const override { return file_metadata_; }
 
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices) override {
+    if (!properties_.is_pre_buffer_enabled()) {
+      return;
+    }
+    std::vector<ReadRange> ranges;
+    const int64_t source_size = source_->Size();
+    for (int row_group : row_groups) {
+      if (row_group < 0 || row_group >= file_metadata_->num_row_groups()) {
+        throw ParquetException("Pre-buffered row group index out of range");
+      }
+      auto row_group_metadata = file_metadata_->RowGroup(row_group);
+      for (int column : column_indices) {
+        if (column < 0 || column >= row_group_metadata->num_columns()) {
+          throw ParquetException("Pre-buffered column index out of range");
+        }
+        ranges.push_back(ComputeColumnChunkRange(
+            *file_metadata_, *row_group_metadata->ColumnChunk(column), source_size));
+      }
+    }
+    // Row group readers may still hold the previous ranges; don't let their
+    // reads outlive the source
+    if (pre_buffered_) {
+      pre_buffered_->Wait();
+    }
+    pre_buffered_ = std::make_shared<PreBufferedRanges>(
+        source_.get(), std::move(ranges), properties_.pre_buffer_options());
+  }
+
   void set_metadata(const std::shared_ptr<FileMetaData>& metadata) {
     file_metadata_ = metadata;
   }
@@ -203,13 +467,15 @@ class SerializedFile : public ParquetFileReader::Contents {
       }
     }
 
-    file_metadata_ = FileMetaData::Make(metadata_buffer->data(), &metadata_len);
+    file_metadata_ = FileMetaData::Make(metadata_buffer->data(), &metadata_len,
+                                        properties_.is_lazy_metadata_enabled());
   }
 
  private:
   std::unique_ptr<RandomAccessSource> source_;
   std::shared_ptr<FileMetaData> file_metadata_;
   ReaderProperties properties_;
+  std::shared_ptr<PreBufferedRanges> pre_buffered_;
 };
 
 // ----------------------------------------------------------------------
@@ -248,7 +514,8 @@ std::unique_ptr<ParquetFileReader::Contents> ParquetFileReader::Contents::Open(
 std::unique_ptr<ParquetFileReader> ParquetFileReader::Open(
     const std::shared_ptr<::arrow::io::ReadableFileInterface>& source,
     const ReaderProperties& props, const std::shared_ptr<FileMetaData>& metadata) {
-  std::unique_ptr<RandomAccessSource> io_wrapper(new ArrowInputFile(source));
+  std::unique_ptr<RandomAccessSource> io_wrapper(
+      new ArrowInputFile(::arrow::io::internal::MaybeInstrumentFile(source, "parquet")));
   return Open(std::move(io_wrapper), props, metadata);
 }
 
@@ -261,9 +528,10 @@ std::unique_ptr<ParquetFileReader> ParquetFileReader::Open(
   return result;
 }
 
-std::unique_ptr<ParquetFileReader> ParquetFileReader::OpenFile(
-    const std::string& path, bool memory_map, const ReaderProperties& props,
-    const std::shared_ptr<FileMetaData>& metadata) {
+namespace {
+
+std::shared_ptr<::arrow::io::ReadableFileInterface> OpenLocalFile(
+    const std::string& path, bool memory_map, const ReaderProperties& props) {
   std::shared_ptr<::arrow::io::ReadableFileInterface> source;
   if (memory_map) {
     std::shared_ptr<::arrow::io::MemoryMappedFile> handle;
@@ -276,8 +544,51 @@ std::unique_ptr<ParquetFileReader> ParquetFileReader::OpenFile(
         ::arrow::io::ReadableFile::Open(path, props.memory_pool(), &handle));
     source = handle;
   }
+  return source;
+}
 
-  return Open(source, props, metadata);
+// Modification time of the file at path, in seconds since the epoch
+int64_t FileModificationTime(const std::string& path) {
+#ifdef _WIN32
+  struct _stat64 st;
+  int ret = _stat64(path.c_str(), &st);
+#else
+  struct stat st;
+  int ret = stat(path.c_str(), &st);
+#endif
+  if (ret != 0) {
+    throw ParquetException("Cannot stat file " + path + ": " + std::strerror(errno));
+  }
+  return static_cast<int64_t>(st.st_mtime);
+}
+
+}  // namespace
+
+std::unique_ptr<ParquetFileReader> ParquetFileReader::OpenFile(
+    const std::string& path, bool memory_map, const ReaderProperties& props,
+    const std::shared_ptr<FileMetaData>& metadata) {
+  return Open(OpenLocalFile(path, memory_map, props), props, metadata);
+}
+
+std::unique_ptr<ParquetFileReader> ParquetFileReader::OpenFile(
+    const std::string& path, FileMetaDataCache* cache, bool memory_map,
+    const ReaderProperties& props) {
+  auto source = OpenLocalFile(path, memory_map, props);
+  if (cache == nullptr) {
+    return Open(source, props);
+  }
+  int64_t size;
+  PARQUET_THROW_NOT_OK(source->GetSize(&size));
+  const int64_t mtime = FileModificationTime(path);
+  auto metadata = cache->Get(path, size, mtime);
+  if (metadata != nullptr) {
+    return Open(source, props, metadata);
+  }
+  // Concurrent readers of an uncached file each parse its metadata; the last
+  // one parsed is kept
+  auto reader = Open(source, props);
+  cache->Put(path, size, mtime, reader->metadata());
+  return reader;
 }
 
 void ParquetFileReader::Open(std::unique_ptr<ParquetFileReader::Contents> contents) {
@@ -294,6 +605,11 @@ std::shared_ptr<FileMetaData> ParquetFileReader::metadata() const {
   return contents_->metadata();
 }
 
+void ParquetFileReader::PreBuffer(const std::vector<int>& row_groups,
+                                  const std::vector<int>& column_indices) {
+  contents_->PreBuffer(row_groups, column_indices);
+}
+
 std::shared_ptr<RowGroupReader> ParquetFileReader::RowGroup(int i) {
   DCHECK(i < metadata()->num_row_groups())
       << "The file only has " << metadata()->num_row_groups()
@@ -309,6 +625,105 @@ std::shared_ptr<FileMetaData> ReadMetaData(
   return ParquetFileReader::Open(source)->metadata();
 }
 
+// ----------------------------------------------------------------------
+// FileMetaDataCache
+
+constexpr int64_t FileMetaDataCache::kDefaultCapacity;
+
+class FileMetaDataCache::Impl {
+ public:
+  explicit Impl(int64_t capacity) : capacity_(capacity) {}
+
+  std::shared_ptr<FileMetaData> Get(const std::string& path, int64_t size,
+                                    int64_t mtime) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(path);
+    if (it == entries_.end()) {
+      return nullptr;
+    }
+    if (it->second.size != size || it->second.mtime != mtime) {
+      // The file changed since it was cached
+      EraseEntry(it);
+      return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    return it->second.metadata;
+  }
+
+  void Put(const std::string& path, int64_t size, int64_t mtime,
+           const std::shared_ptr<FileMetaData>& metadata) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(path);
+    if (it != entries_.end()) {
+      EraseEntry(it);
+    }
+    lru_.push_front(path);
+    entries_[path] = Entry{size, mtime, metadata, lru_.begin()};
+    while (static_cast<int64_t>(entries_.size()) > capacity_) {
+      EraseEntry(entries_.find(lru_.back()));
+    }
+  }
+
+  void Erase(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(path);
+    if (it != entries_.end()) {
+      EraseEntry(it);
+    }
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+  }
+
+  int64_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<int64_t>(entries_.size());
+  }
+
+ private:
+  struct Entry {
+    int64_t size;
+    int64_t mtime;
+    std::shared_ptr<FileMetaData> metadata;
+    std::list<std::string>::iterator lru_position;
+  };
+  using EntryMap = std::unordered_map<std::string, Entry>;
+
+  void EraseEntry(EntryMap::iterator it) {
+    lru_.erase(it->second.lru_position);
+    entries_.erase(it);
+  }
+
+  int64_t capacity_;
+  mutable std::mutex mutex_;
+  EntryMap entries_;
+  // Cached paths, most recently used first
+  std::list<std::string> lru_;
+};
+
+FileMetaDataCache::FileMetaDataCache(int64_t capacity) : impl_(new Impl(capacity)) {}
+
+FileMetaDataCache::~FileMetaDataCache() {}
+
+std::shared_ptr<FileMetaData> FileMetaDataCache::Get(const std::string& path,
+                                                     int64_t size, int64_t mtime) {
+  return impl_->Get(path, size, mtime);
+}
+
+void FileMetaDataCache::Put(const std::string& path, int64_t size, int64_t mtime,
+                            const std::shared_ptr<FileMetaData>& metadata) {
+  impl_->Put(path, size, mtime, metadata);
+}
+
+void FileMetaDataCache::Erase(const std::string& path) { impl_->Erase(path); }
+
+void FileMetaDataCache::Clear() { impl_->Clear(); }
+
+int64_t FileMetaDataCache::size() const { return impl_->size(); }
+
 // ----------------------------------------------------------------------
 // File scanner for performance testing
 
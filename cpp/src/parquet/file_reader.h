@@ -32,8 +32,11 @@
 
 namespace parquet {
 
+class BloomFilter;
+class ColumnIndex;
 class ColumnReader;
 class FileMetaData;
+class OffsetIndex;
 class PageReader;
 class RandomAccessSource;
 class RowGroupMetaData;
@@ -48,6 +51,9 @@ class PARQUET_EXPORT RowGroupReader {
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
+    virtual std::shared_ptr<ColumnIndex> GetColumnIndex(int i) { return NULLPTR; }
+    virtual std::shared_ptr<OffsetIndex> GetOffsetIndex(int i) { return NULLPTR; }
+    virtual std::shared_ptr<BloomFilter> GetBloomFilter(int i) { return NULLPTR; }
   };
 
   explicit RowGroupReader(std::unique_ptr<Contents> contents);
@@ -61,11 +67,34 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  /// \brief The page statistics of a row group-relative column, or null if
+  /// the file has no column index for it
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  std::shared_ptr<ColumnIndex> GetColumnIndex(int i);
+
+  /// \brief The page locations of a row group-relative column, or null if
+  /// the file has no offset index for it
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  std::shared_ptr<OffsetIndex> GetOffsetIndex(int i);
+
+  /// \brief The Bloom filter of a row group-relative column, or null if the
+  /// file has none for it
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  std::shared_ptr<BloomFilter> GetBloomFilter(int i);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
 };
 
+class FileMetaDataCache;
+
 class PARQUET_EXPORT ParquetFileReader {
  public:
   // Declare a virtual class 'Contents' to aid dependency injection and more
@@ -82,6 +111,8 @@ class PARQUET_EXPORT ParquetFileReader {
     virtual void Close() = 0;
     virtual std::shared_ptr<RowGroupReader> GetRowGroup(int i) = 0;
     virtual std::shared_ptr<FileMetaData> metadata() const = 0;
+    virtual void PreBuffer(const std::vector<int>& row_groups,
+                           const std::vector<int>& column_indices) {}
   };
 
   ParquetFileReader();
@@ -111,6 +142,18 @@ class PARQUET_EXPORT ParquetFileReader {
       const ReaderProperties& props = default_reader_properties(),
       const std::shared_ptr<FileMetaData>& metadata = NULLPTR);
 
+  /// \brief Open a Parquet file on disk, taking its metadata from cache
+  ///
+  /// The metadata is looked up by path, file size and modification time. If
+  /// it is not cached, it is parsed from the footer of the file and added to
+  /// cache.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  static std::unique_ptr<ParquetFileReader> OpenFile(
+      const std::string& path, FileMetaDataCache* cache, bool memory_map = true,
+      const ReaderProperties& props = default_reader_properties());
+
   void Open(std::unique_ptr<Contents> contents);
   void Close();
 
@@ -120,6 +163,25 @@ class PARQUET_EXPORT ParquetFileReader {
   // Returns the file metadata. Only one instance is ever created
   std::shared_ptr<FileMetaData> metadata() const;
 
+  /// \brief Start reading the given column chunks in the background
+  ///
+  /// If pre-buffering is enabled in the ReaderProperties, the byte ranges of
+  /// the column_indices chunks of row_groups are merged as configured by
+  /// ReaderProperties::pre_buffer_options() and read asynchronously on the
+  /// I/O thread pool. Column readers of these chunks then wait for the data
+  /// instead of reading it themselves. The data is held until the next call
+  /// to PreBuffer() or until the file is closed.
+  ///
+  /// Otherwise, this is a no-op.
+  ///
+  /// \param[in] row_groups the row groups to read
+  /// \param[in] column_indices the leaf columns to read in each row group
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  void PreBuffer(const std::vector<int>& row_groups,
+                 const std::vector<int>& column_indices);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -129,6 +191,48 @@ class PARQUET_EXPORT ParquetFileReader {
 std::shared_ptr<FileMetaData> PARQUET_EXPORT
 ReadMetaData(const std::shared_ptr<::arrow::io::ReadableFileInterface>& source);
 
+/// \brief A cache of the metadata of Parquet files, to be shared by the
+/// readers of a dataset
+///
+/// Entries are keyed by file path and validated against the size and
+/// modification time of the file, so that a file rewritten in place is
+/// parsed again. Once more than capacity files are cached, the least
+/// recently used entry is evicted. Cached FileMetaData, and with it their
+/// SchemaDescriptor, are shared by all readers opened with them. All methods
+/// are thread-safe.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class PARQUET_EXPORT FileMetaDataCache {
+ public:
+  static constexpr int64_t kDefaultCapacity = 1024;
+
+  explicit FileMetaDataCache(int64_t capacity = kDefaultCapacity);
+  ~FileMetaDataCache();
+
+  /// \brief Return the cached metadata of the file at path, or null if it is
+  /// not cached or was cached for another size or modification time
+  std::shared_ptr<FileMetaData> Get(const std::string& path, int64_t size,
+                                    int64_t mtime);
+
+  /// \brief Cache the metadata of the file at path, replacing any previous
+  /// entry for it
+  void Put(const std::string& path, int64_t size, int64_t mtime,
+           const std::shared_ptr<FileMetaData>& metadata);
+
+  /// \brief Remove the entry of the file at path, if any
+  void Erase(const std::string& path);
+
+  void Clear();
+
+  /// \brief The number of files cached
+  int64_t size() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// \brief Scan all values in file. Useful for performance testing
 /// \param[in] columns the column numbers to scan. If empty scans all
 /// \param[in] column_batch_size number of values to read at a time when scanning column
@@ -63,6 +63,10 @@ int RowGroupWriter::num_columns() const { return contents_->num_columns(); }
 
 int64_t RowGroupWriter::num_rows() const { return contents_->num_rows(); }
 
+void RowGroupWriter::set_sorting_columns(const std::vector<SortingColumn>& columns) {
+  contents_->set_sorting_columns(columns);
+}
+
 inline void ThrowRowsMisMatchError(int col, int64_t prev, int64_t curr) {
   std::stringstream ss;
   ss << "Column " << col << " had " << curr << " while previous column had " << prev;
@@ -122,7 +126,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     const ColumnDescriptor* column_descr = col_meta->descr();
     std::unique_ptr<PageWriter> pager =
         PageWriter::Open(sink_, properties_->compression(column_descr->path()), col_meta,
-                         properties_->memory_pool());
+                         properties_->memory_pool(), false,
+                         properties_->page_index_enabled(column_descr->path()));
     column_writers_[0] = ColumnWriter::Make(col_meta, std::move(pager), properties_);
     return column_writers_[0].get();
   }
@@ -181,6 +186,10 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
     }
   }
 
+  void set_sorting_columns(const std::vector<SortingColumn>& columns) override {
+    metadata_->set_sorting_columns(columns);
+  }
+
  private:
   OutputStream* sink_;
   mutable RowGroupMetaDataBuilder* metadata_;
@@ -219,7 +228,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
       const ColumnDescriptor* column_descr = col_meta->descr();
       std::unique_ptr<PageWriter> pager =
           PageWriter::Open(sink_, properties_->compression(column_descr->path()),
-                           col_meta, properties_->memory_pool(), buffered_row_group_);
+                           col_meta, properties_->memory_pool(), buffered_row_group_,
+                           properties_->page_index_enabled(column_descr->path()));
       column_writers_.push_back(
           ColumnWriter::Make(col_meta, std::move(pager), properties_));
     }
@@ -257,6 +267,11 @@ class FileSerializer : public ParquetFileWriter::Contents {
       }
       row_group_writer_.reset();
 
+      // Bloom filters and page indexes go between the last row group and the
+      // footer
+      metadata_->WriteBloomFilters(sink_.get());
+      metadata_->WritePageIndex(sink_.get());
+
       // Write magic bytes and metadata
       auto metadata = metadata_->Finish();
       WriteFileMetaData(*metadata, sink_.get());
@@ -372,6 +387,11 @@ void WriteFileMetaData(const FileMetaData& file_metadata, OutputStream* sink) {
   sink->Write(PARQUET_MAGIC, 4);
 }
 
+void WriteMetaDataFile(const FileMetaData& file_metadata, OutputStream* sink) {
+  sink->Write(PARQUET_MAGIC, 4);
+  WriteFileMetaData(file_metadata, sink);
+}
+
 const SchemaDescriptor* ParquetFileWriter::schema() const { return contents_->schema(); }
 
 const ColumnDescriptor* ParquetFileWriter::descr(int i) const {
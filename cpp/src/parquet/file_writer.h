@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <memory>
 #include <ostream>
+#include <vector>
 
 #include "arrow/util/macros.h"
 
@@ -68,6 +69,8 @@ class PARQUET_EXPORT RowGroupWriter {
     virtual int64_t total_bytes_written() const = 0;
     // total bytes still compressed but not written
     virtual int64_t total_compressed_bytes() const = 0;
+
+    virtual void set_sorting_columns(const std::vector<SortingColumn>& columns) {}
   };
 
   explicit RowGroupWriter(std::unique_ptr<Contents> contents);
@@ -102,6 +105,15 @@ class PARQUET_EXPORT RowGroupWriter {
   int64_t total_bytes_written() const;
   int64_t total_compressed_bytes() const;
 
+  /// \brief Record in the row group metadata that its rows are sorted by
+  /// columns, most significant first
+  ///
+  /// Must be called before Close. The order of the rows is not checked.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  void set_sorting_columns(const std::vector<SortingColumn>& columns);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -110,6 +122,14 @@ class PARQUET_EXPORT RowGroupWriter {
 PARQUET_EXPORT
 void WriteFileMetaData(const FileMetaData& file_metadata, OutputStream* sink);
 
+/// \brief Write a metadata-only Parquet file, such as the _metadata summary
+/// file of a dataset: the magic bytes followed by the file footer
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+PARQUET_EXPORT
+void WriteMetaDataFile(const FileMetaData& file_metadata, OutputStream* sink);
+
 class PARQUET_EXPORT ParquetFileWriter {
  public:
   // Forward declare a virtual class 'Contents' to aid dependency injection and more
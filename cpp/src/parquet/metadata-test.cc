@@ -188,6 +188,54 @@ TEST(Metadata, TestV1Version) {
   ASSERT_EQ(ParquetVersion::PARQUET_1_0, f_accessor->version());
 }
 
+TEST(Metadata, TestAppendRowGroups) {
+  parquet::schema::NodeVector fields;
+  parquet::SchemaDescriptor schema;
+  fields.push_back(parquet::schema::Int32("int_col", Repetition::REQUIRED));
+  schema.Init(parquet::schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+  auto props = WriterProperties::Builder().build();
+
+  // A file with a row group of each of num_rows rows
+  auto MakeMetaData = [&](const std::vector<int64_t>& num_rows) {
+    auto f_builder = FileMetaDataBuilder::Make(&schema, props);
+    for (size_t i = 0; i < num_rows.size(); ++i) {
+      auto rg_builder = f_builder->AppendRowGroup();
+      auto col_builder = rg_builder->NextColumnChunk();
+      col_builder->Finish(num_rows[i], 0, 0, 4 + 100 * i, 100, 100, false, false);
+      rg_builder->set_num_rows(num_rows[i]);
+      rg_builder->Finish(100);
+    }
+    return f_builder->Finish();
+  };
+
+  auto f1 = MakeMetaData({10, 20});
+  auto f2 = MakeMetaData({30});
+  f1->set_file_path("a");
+  f2->set_file_path("b");
+  f1->AppendRowGroups(*f2);
+  ASSERT_EQ(3, f1->num_row_groups());
+  ASSERT_EQ(60, f1->num_rows());
+  ASSERT_EQ("a", f1->RowGroup(1)->ColumnChunk(0)->file_path());
+  ASSERT_EQ("b", f1->RowGroup(2)->ColumnChunk(0)->file_path());
+  ASSERT_EQ(30, f1->RowGroup(2)->num_rows());
+  ASSERT_EQ(4, f1->RowGroup(2)->ColumnChunk(0)->data_page_offset());
+
+  auto subset = f1->Subset({2, 0});
+  ASSERT_EQ(2, subset->num_row_groups());
+  ASSERT_EQ(40, subset->num_rows());
+  ASSERT_EQ("b", subset->RowGroup(0)->ColumnChunk(0)->file_path());
+  ASSERT_EQ(10, subset->RowGroup(1)->num_rows());
+  ASSERT_TRUE(subset->schema()->Equals(*f1->schema()));
+  ASSERT_THROW(f1->Subset({3}), ParquetException);
+
+  parquet::SchemaDescriptor other_schema;
+  fields.push_back(parquet::schema::Float("float_col", Repetition::REQUIRED));
+  other_schema.Init(
+      parquet::schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+  auto f3 = FileMetaDataBuilder::Make(&other_schema, props)->Finish();
+  ASSERT_THROW(f1->AppendRowGroups(*f3), ParquetException);
+}
+
 TEST(ApplicationVersion, Basics) {
   ApplicationVersion version("parquet-mr version 1.7.9");
   ApplicationVersion version1("parquet-mr version 1.8.0");
@@ -16,14 +16,18 @@
 // under the License.
 
 #include <algorithm>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/util/logging.h"
 
+#include "parquet/bloom_filter.h"
 #include "parquet/exception.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/schema-internal.h"
 #include "parquet/schema.h"
 #include "parquet/statistics.h"
@@ -195,6 +199,30 @@ class ColumnChunkMetaData::ColumnChunkMetaDataImpl {
     return column_->meta_data.total_uncompressed_size;
   }
 
+  inline bool has_column_index() const {
+    return column_->__isset.column_index_offset && column_->__isset.column_index_length;
+  }
+
+  inline int64_t column_index_offset() const { return column_->column_index_offset; }
+
+  inline int32_t column_index_length() const { return column_->column_index_length; }
+
+  inline bool has_offset_index() const {
+    return column_->__isset.offset_index_offset && column_->__isset.offset_index_length;
+  }
+
+  inline int64_t offset_index_offset() const { return column_->offset_index_offset; }
+
+  inline int32_t offset_index_length() const { return column_->offset_index_length; }
+
+  inline bool has_bloom_filter() const {
+    return column_->meta_data.__isset.bloom_filter_offset;
+  }
+
+  inline int64_t bloom_filter_offset() const {
+    return column_->meta_data.bloom_filter_offset;
+  }
+
  private:
   mutable std::shared_ptr<RowGroupStatistics> possible_stats_;
   std::vector<Encoding::type> encodings_;
@@ -272,6 +300,32 @@ int64_t ColumnChunkMetaData::total_compressed_size() const {
   return impl_->total_compressed_size();
 }
 
+bool ColumnChunkMetaData::has_column_index() const { return impl_->has_column_index(); }
+
+int64_t ColumnChunkMetaData::column_index_offset() const {
+  return impl_->column_index_offset();
+}
+
+int32_t ColumnChunkMetaData::column_index_length() const {
+  return impl_->column_index_length();
+}
+
+bool ColumnChunkMetaData::has_offset_index() const { return impl_->has_offset_index(); }
+
+int64_t ColumnChunkMetaData::offset_index_offset() const {
+  return impl_->offset_index_offset();
+}
+
+int32_t ColumnChunkMetaData::offset_index_length() const {
+  return impl_->offset_index_length();
+}
+
+bool ColumnChunkMetaData::has_bloom_filter() const { return impl_->has_bloom_filter(); }
+
+int64_t ColumnChunkMetaData::bloom_filter_offset() const {
+  return impl_->bloom_filter_offset();
+}
+
 // row-group metadata
 class RowGroupMetaData::RowGroupMetaDataImpl {
  public:
@@ -299,6 +353,16 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
                                      writer_version_);
   }
 
+  std::vector<SortingColumn> sorting_columns() const {
+    std::vector<SortingColumn> columns;
+    if (row_group_->__isset.sorting_columns) {
+      for (const format::SortingColumn& column : row_group_->sorting_columns) {
+        columns.push_back({column.column_idx, column.descending, column.nulls_first});
+      }
+    }
+    return columns;
+  }
+
  private:
   const format::RowGroup* row_group_;
   const SchemaDescriptor* schema_;
@@ -331,34 +395,40 @@ std::unique_ptr<ColumnChunkMetaData> RowGroupMetaData::ColumnChunk(int i) const
   return impl_->ColumnChunk(i);
 }
 
+std::vector<SortingColumn> RowGroupMetaData::sorting_columns() const {
+  return impl_->sorting_columns();
+}
+
 // file metadata
 class FileMetaData::FileMetaDataImpl {
  public:
-  FileMetaDataImpl() : metadata_len_(0) {}
+  FileMetaDataImpl() : metadata_len_(0), lazy_(false) {}
 
-  explicit FileMetaDataImpl(const void* metadata, uint32_t* metadata_len)
-      : metadata_len_(0) {
+  explicit FileMetaDataImpl(const void* metadata, uint32_t* metadata_len, bool lazy)
+      : metadata_len_(0), lazy_(lazy) {
     metadata_.reset(new format::FileMetaData);
-    DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(metadata), metadata_len,
-                         metadata_.get());
-    metadata_len_ = *metadata_len;
-
-    if (metadata_->__isset.created_by) {
-      writer_version_ = ApplicationVersion(metadata_->created_by);
+    if (lazy_) {
+      DeserializeWithoutRowGroups(reinterpret_cast<const uint8_t*>(metadata),
+                                  metadata_len);
     } else {
-      writer_version_ = ApplicationVersion("unknown 0.0.0");
+      DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(metadata), metadata_len,
+                           metadata_.get());
     }
+    metadata_len_ = *metadata_len;
+    InitFromMetadata();
+  }
 
-    InitSchema();
-    InitColumnOrders();
-    InitKeyValueMetadata();
+  explicit FileMetaDataImpl(std::unique_ptr<format::FileMetaData> metadata)
+      : metadata_len_(0), metadata_(std::move(metadata)), lazy_(false) {
+    InitFromMetadata();
   }
 
   inline uint32_t size() const { return metadata_len_; }
   inline int num_columns() const { return schema_.num_columns(); }
   inline int64_t num_rows() const { return metadata_->num_rows; }
   inline int num_row_groups() const {
-    return static_cast<int>(metadata_->row_groups.size());
+    return static_cast<int>(lazy_ ? row_group_ranges_.size()
+                                  : metadata_->row_groups.size());
   }
   inline int32_t version() const { return metadata_->version; }
   inline const std::string& created_by() const { return metadata_->created_by; }
@@ -368,9 +438,56 @@ class FileMetaData::FileMetaDataImpl {
 
   const ApplicationVersion& writer_version() const { return writer_version_; }
 
-  void WriteTo(OutputStream* dst) const {
+  void WriteTo(OutputStream* dst) {
     ThriftSerializer serializer;
-    serializer.Serialize(metadata_.get(), dst);
+    if (lazy_) {
+      format::FileMetaData metadata = *metadata_;
+      for (int i = 0; i < num_row_groups(); ++i) {
+        metadata.row_groups.push_back(*GetRowGroup(i));
+      }
+      serializer.Serialize(&metadata, dst);
+    } else {
+      serializer.Serialize(metadata_.get(), dst);
+    }
+  }
+
+  void set_file_path(const std::string& path) {
+    Materialize();
+    for (format::RowGroup& row_group : metadata_->row_groups) {
+      for (format::ColumnChunk& column_chunk : row_group.columns) {
+        column_chunk.__set_file_path(path);
+      }
+    }
+  }
+
+  void AppendRowGroups(FileMetaDataImpl* other) {
+    if (!schema_.Equals(other->schema_)) {
+      throw ParquetException("AppendRowGroups requires equal schemas.");
+    }
+    Materialize();
+    const int num_other_row_groups = other->num_row_groups();
+    for (int i = 0; i < num_other_row_groups; ++i) {
+      metadata_->row_groups.push_back(*other->GetRowGroup(i));
+      metadata_->num_rows += metadata_->row_groups.back().num_rows;
+    }
+  }
+
+  std::unique_ptr<FileMetaDataImpl> Subset(const std::vector<int>& row_groups) {
+    std::unique_ptr<format::FileMetaData> metadata(new format::FileMetaData);
+    *metadata = *metadata_;
+    metadata->row_groups.clear();
+    metadata->num_rows = 0;
+    for (int i : row_groups) {
+      if (!(i >= 0 && i < num_row_groups())) {
+        std::stringstream ss;
+        ss << "The file only has " << num_row_groups()
+           << " row groups, requested metadata for row group: " << i;
+        throw ParquetException(ss.str());
+      }
+      metadata->row_groups.push_back(*GetRowGroup(i));
+      metadata->num_rows += metadata->row_groups.back().num_rows;
+    }
+    return std::unique_ptr<FileMetaDataImpl>(new FileMetaDataImpl(std::move(metadata)));
   }
 
   std::unique_ptr<RowGroupMetaData> RowGroup(int i) {
@@ -380,7 +497,7 @@ class FileMetaData::FileMetaDataImpl {
          << " row groups, requested metadata for row group: " << i;
       throw ParquetException(ss.str());
     }
-    return RowGroupMetaData::Make(&metadata_->row_groups[i], &schema_, &writer_version_);
+    return RowGroupMetaData::Make(GetRowGroup(i), &schema_, &writer_version_);
   }
 
   const SchemaDescriptor* schema() const { return &schema_; }
@@ -391,8 +508,122 @@ class FileMetaData::FileMetaDataImpl {
 
  private:
   friend FileMetaDataBuilder;
+
+  void InitFromMetadata() {
+    if (metadata_->__isset.created_by) {
+      writer_version_ = ApplicationVersion(metadata_->created_by);
+    } else {
+      writer_version_ = ApplicationVersion("unknown 0.0.0");
+    }
+
+    InitSchema();
+    InitColumnOrders();
+    InitKeyValueMetadata();
+  }
+
+  // Deserialize all row groups into metadata_, before it is modified. Row
+  // groups deserialized before stay valid
+  void Materialize() {
+    if (!lazy_) {
+      return;
+    }
+    for (int i = 0; i < num_row_groups(); ++i) {
+      metadata_->row_groups.push_back(*GetRowGroup(i));
+    }
+    lazy_ = false;
+  }
+
+  const format::RowGroup* GetRowGroup(int i) {
+    if (!lazy_) {
+      return &metadata_->row_groups[i];
+    }
+    std::lock_guard<std::mutex> lock(row_groups_mutex_);
+    if (row_groups_[i] == nullptr) {
+      std::unique_ptr<format::RowGroup> row_group(new format::RowGroup);
+      uint32_t length = row_group_ranges_[i].second;
+      DeserializeThriftMsg(serialized_.data() + row_group_ranges_[i].first, &length,
+                           row_group.get());
+      row_groups_[i] = std::move(row_group);
+    }
+    return row_groups_[i].get();
+  }
+
+  // Deserialize everything but the row groups, of which only the position in
+  // the serialized message is recorded. A copy of the message with an empty
+  // row group list is deserialized instead of the message
+  void DeserializeWithoutRowGroups(const uint8_t* metadata, uint32_t* metadata_len) {
+    using ::apache::thrift::protocol::TType;
+    // FileMetaData.row_groups, in parquet.thrift
+    constexpr int16_t kRowGroupsFieldId = 4;
+
+    shared_ptr<ThriftBuffer> tmem_transport(
+        new ThriftBuffer(const_cast<uint8_t*>(metadata), *metadata_len));
+    apache::thrift::protocol::TCompactProtocolFactoryT<ThriftBuffer> tproto_factory;
+    shared_ptr<apache::thrift::protocol::TProtocol> tproto =  //
+        tproto_factory.getProtocol(tmem_transport);
+    auto Position = [&]() { return *metadata_len - tmem_transport->available_read(); };
+
+    uint32_t list_begin = 0;
+    uint32_t list_end = 0;
+    try {
+      std::string name;
+      TType field_type;
+      int16_t field_id;
+      tproto->readStructBegin(name);
+      while (true) {
+        tproto->readFieldBegin(name, field_type, field_id);
+        if (field_type == ::apache::thrift::protocol::T_STOP) {
+          break;
+        }
+        if (field_id == kRowGroupsFieldId &&
+            field_type == ::apache::thrift::protocol::T_LIST) {
+          list_begin = Position();
+          TType element_type;
+          uint32_t size;
+          tproto->readListBegin(element_type, size);
+          for (uint32_t i = 0; i < size; ++i) {
+            uint32_t begin = Position();
+            ::apache::thrift::protocol::skip(*tproto, element_type);
+            row_group_ranges_.emplace_back(begin, Position() - begin);
+          }
+          tproto->readListEnd();
+          list_end = Position();
+        } else {
+          ::apache::thrift::protocol::skip(*tproto, field_type);
+        }
+        tproto->readFieldEnd();
+      }
+      tproto->readStructEnd();
+    } catch (std::exception& e) {
+      std::stringstream ss;
+      ss << "Couldn't deserialize thrift: " << e.what() << "\n";
+      throw ParquetException(ss.str());
+    }
+    *metadata_len = Position();
+    if (list_end == 0) {
+      throw ParquetException("Couldn't deserialize thrift: row groups not set");
+    }
+    serialized_.assign(metadata, metadata + *metadata_len);
+    row_groups_.resize(row_group_ranges_.size());
+
+    // The compact protocol header of an empty list of structs
+    constexpr uint8_t kEmptyStructList = 0x0C;
+    std::vector<uint8_t> stripped(serialized_.begin(), serialized_.begin() + list_begin);
+    stripped.push_back(kEmptyStructList);
+    stripped.insert(stripped.end(), serialized_.begin() + list_end, serialized_.end());
+    uint32_t stripped_len = static_cast<uint32_t>(stripped.size());
+    DeserializeThriftMsg(stripped.data(), &stripped_len, metadata_.get());
+  }
+
   uint32_t metadata_len_;
   std::unique_ptr<format::FileMetaData> metadata_;
+  // Whether row groups are deserialized on first access, from serialized_
+  bool lazy_;
+  std::vector<uint8_t> serialized_;
+  // Offset and length of each row group in serialized_
+  std::vector<std::pair<uint32_t, uint32_t>> row_group_ranges_;
+  std::vector<std::unique_ptr<format::RowGroup>> row_groups_;
+  std::mutex row_groups_mutex_;
   void InitSchema() {
     schema::FlatSchemaConverter converter(&metadata_->schema[0],
                                           static_cast<int>(metadata_->schema.size()));
@@ -433,14 +664,14 @@ class FileMetaData::FileMetaDataImpl {
 };
 
 std::shared_ptr<FileMetaData> FileMetaData::Make(const void* metadata,
-                                                 uint32_t* metadata_len) {
+                                                 uint32_t* metadata_len, bool lazy) {
   // This FileMetaData ctor is private, not compatible with std::make_shared
-  return std::shared_ptr<FileMetaData>(new FileMetaData(metadata, metadata_len));
+  return std::shared_ptr<FileMetaData>(new FileMetaData(metadata, metadata_len, lazy));
 }
 
-FileMetaData::FileMetaData(const void* metadata, uint32_t* metadata_len)
+FileMetaData::FileMetaData(const void* metadata, uint32_t* metadata_len, bool lazy)
     : impl_{std::unique_ptr<FileMetaDataImpl>(
-          new FileMetaDataImpl(metadata, metadata_len))} {}
+          new FileMetaDataImpl(metadata, metadata_len, lazy))} {}
 
 FileMetaData::FileMetaData()
     : impl_{std::unique_ptr<FileMetaDataImpl>(new FileMetaDataImpl())} {}
@@ -488,6 +719,20 @@ std::shared_ptr<const KeyValueMetadata> FileMetaData::key_value_metadata() const
 
 void FileMetaData::WriteTo(OutputStream* dst) const { return impl_->WriteTo(dst); }
 
+void FileMetaData::set_file_path(const std::string& path) { impl_->set_file_path(path); }
+
+void FileMetaData::AppendRowGroups(const FileMetaData& other) {
+  impl_->AppendRowGroups(other.impl_.get());
+}
+
+std::shared_ptr<FileMetaData> FileMetaData::Subset(
+    const std::vector<int>& row_groups) const {
+  // This FileMetaData ctor is private, not compatible with std::make_shared
+  std::shared_ptr<FileMetaData> metadata(new FileMetaData());
+  metadata->impl_ = impl_->Subset(row_groups);
+  return metadata;
+}
+
 ApplicationVersion::ApplicationVersion(const std::string& application, int major,
                                        int minor, int patch)
     : application_(application), version{major, minor, patch, "", "", ""} {}
@@ -594,6 +839,15 @@ bool ApplicationVersion::HasCorrectStatistics(Type::type col_type,
 
 // MetaData Builders
 // row-group metadata
+
+// The page index and Bloom filter of a column chunk, kept until all row
+// groups are written
+struct ColumnChunkIndexes {
+  std::shared_ptr<ColumnIndex> column_index;
+  std::shared_ptr<OffsetIndex> offset_index;
+  std::shared_ptr<BloomFilter> bloom_filter;
+};
+
 class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
  public:
   explicit ColumnChunkMetaDataBuilderImpl(const std::shared_ptr<WriterProperties>& props,
@@ -639,6 +893,10 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
     column_chunk_->meta_data.__set_statistics(stats);
   }
 
+  void set_data_page_encodings(const std::vector<Encoding::type>& encodings) {
+    data_page_encodings_ = encodings;
+  }
+
   void Finish(int64_t num_values, int64_t dictionary_page_offset,
               int64_t index_page_offset, int64_t data_page_offset,
               int64_t compressed_size, int64_t uncompressed_size, bool has_dictionary,
@@ -665,14 +923,23 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
       } else {
         thrift_encodings.push_back(ToThrift(properties_->dictionary_page_encoding()));
       }
-    } else {  // Dictionary not enabled
+    } else if (data_page_encodings_.empty()) {  // Dictionary not enabled
       thrift_encodings.push_back(ToThrift(properties_->encoding(column_->path())));
+    } else {
+      for (Encoding::type encoding : data_page_encodings_) {
+        thrift_encodings.push_back(ToThrift(encoding));
+      }
     }
     thrift_encodings.push_back(ToThrift(Encoding::RLE));
-    // Only PLAIN encoding is supported for fallback in V1
-    // TODO(majetideepak): Use user specified encoding for V2
     if (dictionary_fallback) {
-      thrift_encodings.push_back(ToThrift(Encoding::PLAIN));
+      if (data_page_encodings_.empty()) {
+        // Only PLAIN encoding is supported for fallback in V1
+        thrift_encodings.push_back(ToThrift(Encoding::PLAIN));
+      } else {
+        for (Encoding::type encoding : data_page_encodings_) {
+          thrift_encodings.push_back(ToThrift(encoding));
+        }
+      }
     }
     column_chunk_->meta_data.__set_encodings(thrift_encodings);
   }
@@ -684,6 +951,18 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
 
   const ColumnDescriptor* descr() const { return column_; }
 
+  void SetPageIndex(const std::shared_ptr<ColumnIndex>& column_index,
+                    const std::shared_ptr<OffsetIndex>& offset_index) {
+    indexes_.column_index = column_index;
+    indexes_.offset_index = offset_index;
+  }
+
+  void SetBloomFilter(const std::shared_ptr<BloomFilter>& bloom_filter) {
+    indexes_.bloom_filter = bloom_filter;
+  }
+
+  const ColumnChunkIndexes& indexes() const { return indexes_; }
+
  private:
   void Init(format::ColumnChunk* column_chunk) {
     column_chunk_ = column_chunk;
@@ -697,6 +976,9 @@ class ColumnChunkMetaDataBuilder::ColumnChunkMetaDataBuilderImpl {
   std::unique_ptr<format::ColumnChunk> owned_column_chunk_;
   const std::shared_ptr<WriterProperties> properties_;
   const ColumnDescriptor* column_;
+  ColumnChunkIndexes indexes_;
+  // The encodings of the non-dictionary data pages, if set by the column writer
+  std::vector<Encoding::type> data_page_encodings_;
 };
 
 std::unique_ptr<ColumnChunkMetaDataBuilder> ColumnChunkMetaDataBuilder::Make(
@@ -748,11 +1030,27 @@ const ColumnDescriptor* ColumnChunkMetaDataBuilder::descr() const {
   return impl_->descr();
 }
 
+void ColumnChunkMetaDataBuilder::set_data_page_encodings(
+    const std::vector<Encoding::type>& encodings) {
+  impl_->set_data_page_encodings(encodings);
+}
+
 void ColumnChunkMetaDataBuilder::SetStatistics(bool is_signed,
                                                const EncodedStatistics& result) {
   impl_->SetStatistics(is_signed, result);
 }
 
+void ColumnChunkMetaDataBuilder::SetPageIndex(
+    const std::shared_ptr<ColumnIndex>& column_index,
+    const std::shared_ptr<OffsetIndex>& offset_index) {
+  impl_->SetPageIndex(column_index, offset_index);
+}
+
+void ColumnChunkMetaDataBuilder::SetBloomFilter(
+    const std::shared_ptr<BloomFilter>& bloom_filter) {
+  impl_->SetBloomFilter(bloom_filter);
+}
+
 class RowGroupMetaDataBuilder::RowGroupMetaDataBuilderImpl {
  public:
   explicit RowGroupMetaDataBuilderImpl(const std::shared_ptr<WriterProperties>& props,
@@ -804,10 +1102,35 @@ class RowGroupMetaDataBuilder::RowGroupMetaDataBuilderImpl {
 
   void set_num_rows(int64_t num_rows) { row_group_->num_rows = num_rows; }
 
+  void set_sorting_columns(const std::vector<SortingColumn>& columns) {
+    std::vector<format::SortingColumn> sorting_columns(columns.size());
+    for (size_t i = 0; i < columns.size(); ++i) {
+      if (!(columns[i].column_idx >= 0 && columns[i].column_idx < num_columns())) {
+        std::stringstream ss;
+        ss << "The schema only has " << num_columns()
+           << " columns, cannot sort by column: " << columns[i].column_idx;
+        throw ParquetException(ss.str());
+      }
+      sorting_columns[i].__set_column_idx(columns[i].column_idx);
+      sorting_columns[i].__set_descending(columns[i].descending);
+      sorting_columns[i].__set_nulls_first(columns[i].nulls_first);
+    }
+    row_group_->__set_sorting_columns(sorting_columns);
+  }
+
   int num_columns() { return static_cast<int>(row_group_->columns.size()); }
 
   int64_t num_rows() { return row_group_->num_rows; }
 
+  // Indexes of the column chunks, in column order
+  std::vector<ColumnChunkIndexes> indexes() const {
+    std::vector<ColumnChunkIndexes> indexes;
+    for (const auto& column_builder : column_builders_) {
+      indexes.push_back(column_builder->impl_->indexes());
+    }
+    return indexes;
+  }
+
  private:
   void InitializeColumns(int ncols) { row_group_->columns.resize(ncols); }
 
@@ -847,6 +1170,11 @@ void RowGroupMetaDataBuilder::set_num_rows(int64_t num_rows) {
   impl_->set_num_rows(num_rows);
 }
 
+void RowGroupMetaDataBuilder::set_sorting_columns(
+    const std::vector<SortingColumn>& columns) {
+  impl_->set_sorting_columns(columns);
+}
+
 void RowGroupMetaDataBuilder::Finish(int64_t total_bytes_written) {
   impl_->Finish(total_bytes_written);
 }
@@ -863,12 +1191,55 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
   }
 
   RowGroupMetaDataBuilder* AppendRowGroup() {
+    CollectIndexes();
     row_groups_.emplace_back();
     current_row_group_builder_ =
         RowGroupMetaDataBuilder::Make(properties_, schema_, &row_groups_.back());
     return current_row_group_builder_.get();
   }
 
+  void WriteBloomFilters(OutputStream* sink) {
+    CollectIndexes();
+    DCHECK_EQ(indexes_.size(), row_groups_.size());
+    for (size_t i = 0; i < indexes_.size(); ++i) {
+      for (size_t j = 0; j < indexes_[i].size(); ++j) {
+        const auto& bloom_filter = indexes_[i][j].bloom_filter;
+        if (bloom_filter == nullptr) continue;
+        row_groups_[i].columns[j].meta_data.__set_bloom_filter_offset(sink->Tell());
+        bloom_filter->WriteTo(sink);
+      }
+    }
+  }
+
+  void WritePageIndex(OutputStream* sink) {
+    CollectIndexes();
+    DCHECK_EQ(indexes_.size(), row_groups_.size());
+    for (size_t i = 0; i < indexes_.size(); ++i) {
+      for (size_t j = 0; j < indexes_[i].size(); ++j) {
+        const auto& column_index = indexes_[i][j].column_index;
+        if (column_index == nullptr) continue;
+        format::ColumnChunk& column_chunk = row_groups_[i].columns[j];
+        int64_t offset = sink->Tell();
+        column_index->WriteTo(sink);
+        column_chunk.__set_column_index_offset(offset);
+        column_chunk.__set_column_index_length(
+            static_cast<int32_t>(sink->Tell() - offset));
+      }
+    }
+    for (size_t i = 0; i < indexes_.size(); ++i) {
+      for (size_t j = 0; j < indexes_[i].size(); ++j) {
+        const auto& offset_index = indexes_[i][j].offset_index;
+        if (offset_index == nullptr) continue;
+        format::ColumnChunk& column_chunk = row_groups_[i].columns[j];
+        int64_t offset = sink->Tell();
+        offset_index->WriteTo(sink);
+        column_chunk.__set_offset_index_offset(offset);
+        column_chunk.__set_offset_index_length(
+            static_cast<int32_t>(sink->Tell() - offset));
+      }
+    }
+  }
+
   std::unique_ptr<FileMetaData> Finish() {
     int64_t total_rows = 0;
     for (auto row_group : row_groups_) {
@@ -932,7 +1303,18 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
   const std::shared_ptr<WriterProperties> properties_;
   std::vector<format::RowGroup> row_groups_;
 
+  // Moves the indexes of the current row group out of its builder, which
+  // is destroyed by the next AppendRowGroup
+  void CollectIndexes() {
+    if (current_row_group_builder_ != nullptr) {
+      indexes_.push_back(current_row_group_builder_->impl_->indexes());
+      current_row_group_builder_.reset();
+    }
+  }
+
   std::unique_ptr<RowGroupMetaDataBuilder> current_row_group_builder_;
+  // Page indexes and Bloom filters of the column chunks of all row groups
+  std::vector<std::vector<ColumnChunkIndexes>> indexes_;
   const SchemaDescriptor* schema_;
   std::shared_ptr<const KeyValueMetadata> key_value_metadata_;
 };
@@ -956,6 +1338,14 @@ RowGroupMetaDataBuilder* FileMetaDataBuilder::AppendRowGroup() {
   return impl_->AppendRowGroup();
 }
 
+void FileMetaDataBuilder::WriteBloomFilters(OutputStream* sink) {
+  impl_->WriteBloomFilters(sink);
+}
+
+void FileMetaDataBuilder::WritePageIndex(OutputStream* sink) {
+  impl_->WritePageIndex(sink);
+}
+
 std::unique_ptr<FileMetaData> FileMetaDataBuilder::Finish() { return impl_->Finish(); }
 
 }  // namespace parquet
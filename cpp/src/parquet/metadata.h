@@ -32,8 +32,11 @@
 
 namespace parquet {
 
+class BloomFilter;
 class ColumnDescriptor;
+class ColumnIndex;
 class EncodedStatistics;
+class OffsetIndex;
 class OutputStream;
 class RowGroupStatistics;
 class SchemaDescriptor;
@@ -127,6 +130,16 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   int64_t index_page_offset() const;
   int64_t total_compressed_size() const;
   int64_t total_uncompressed_size() const;
+  // page index
+  bool has_column_index() const;
+  int64_t column_index_offset() const;
+  int32_t column_index_length() const;
+  bool has_offset_index() const;
+  int64_t offset_index_offset() const;
+  int32_t offset_index_length() const;
+  // Bloom filter
+  bool has_bloom_filter() const;
+  int64_t bloom_filter_offset() const;
 
  private:
   explicit ColumnChunkMetaData(const void* metadata, const ColumnDescriptor* descr,
@@ -136,6 +149,18 @@ class PARQUET_EXPORT ColumnChunkMetaData {
   std::unique_ptr<ColumnChunkMetaDataImpl> impl_;
 };
 
+/// \brief A column the rows of a row group are sorted by
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+struct PARQUET_EXPORT SortingColumn {
+  /// The leaf column index, in the row group
+  int column_idx;
+  bool descending;
+  /// Whether nulls come before the other values
+  bool nulls_first;
+};
+
 class PARQUET_EXPORT RowGroupMetaData {
  public:
   // API convenience to get a MetaData accessor
@@ -153,6 +178,10 @@ class PARQUET_EXPORT RowGroupMetaData {
   const SchemaDescriptor* schema() const;
   std::unique_ptr<ColumnChunkMetaData> ColumnChunk(int i) const;
 
+  /// \brief The columns the rows are sorted by, most significant first;
+  /// empty if the writer recorded no order
+  std::vector<SortingColumn> sorting_columns() const;
+
  private:
   explicit RowGroupMetaData(const void* metadata, const SchemaDescriptor* schema,
                             const ApplicationVersion* writer_version = NULLPTR);
@@ -166,8 +195,11 @@ class FileMetaDataBuilder;
 class PARQUET_EXPORT FileMetaData {
  public:
   // API convenience to get a MetaData accessor
+  //
+  // If lazy is true, the row groups are only deserialized by RowGroup(), the
+  // first time each is requested. The serialized metadata is copied.
   static std::shared_ptr<FileMetaData> Make(const void* serialized_metadata,
-                                            uint32_t* metadata_len);
+                                            uint32_t* metadata_len, bool lazy = false);
 
   ~FileMetaData();
 
@@ -190,9 +222,34 @@ class PARQUET_EXPORT FileMetaData {
 
   std::shared_ptr<const KeyValueMetadata> key_value_metadata() const;
 
+  /// \brief Set the file_path of every column chunk, relative to the
+  /// location of a metadata summary file the row groups are appended to
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  void set_file_path(const std::string& path);
+
+  /// \brief Append the row groups of other, e.g. to build the metadata
+  /// summary (_metadata) file of a dataset out of the metadata of its files
+  ///
+  /// Throws ParquetException if the schemas differ. RowGroupMetaData
+  /// obtained from this FileMetaData before are invalidated.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  void AppendRowGroups(const FileMetaData& other);
+
+  /// \brief Return a copy of the metadata with only the given row groups,
+  /// in the given order
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  std::shared_ptr<FileMetaData> Subset(const std::vector<int>& row_groups) const;
+
  private:
   friend FileMetaDataBuilder;
-  explicit FileMetaData(const void* serialized_metadata, uint32_t* metadata_len);
+  explicit FileMetaData(const void* serialized_metadata, uint32_t* metadata_len,
+                        bool lazy);
 
   // PIMPL Idiom
   FileMetaData();
@@ -218,6 +275,9 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   void set_file_path(const std::string& path);
   // column metadata
   void SetStatistics(bool is_signed, const EncodedStatistics& stats);
+  // The encodings of the data pages not dictionary encoded, in order of first
+  // use, when they are not the one the WriterProperties set for the column
+  void set_data_page_encodings(const std::vector<Encoding::type>& encodings);
   // get the column descriptor
   const ColumnDescriptor* descr() const;
   // commit the metadata
@@ -232,7 +292,18 @@ class PARQUET_EXPORT ColumnChunkMetaDataBuilder {
   // For writing metadata at end of column chunk
   void WriteTo(OutputStream* sink);
 
+  // Page index of the column chunk, written ahead of the file footer by
+  // FileMetaDataBuilder::WritePageIndex. column_index may be null
+  void SetPageIndex(const std::shared_ptr<ColumnIndex>& column_index,
+                    const std::shared_ptr<OffsetIndex>& offset_index);
+
+  // Bloom filter of the column chunk, written by
+  // FileMetaDataBuilder::WriteBloomFilters
+  void SetBloomFilter(const std::shared_ptr<BloomFilter>& bloom_filter);
+
  private:
+  friend class RowGroupMetaDataBuilder;
+
   explicit ColumnChunkMetaDataBuilder(const std::shared_ptr<WriterProperties>& props,
                                       const ColumnDescriptor* column);
   explicit ColumnChunkMetaDataBuilder(const std::shared_ptr<WriterProperties>& props,
@@ -258,10 +329,16 @@ class PARQUET_EXPORT RowGroupMetaDataBuilder {
 
   void set_num_rows(int64_t num_rows);
 
+  /// \brief Record that the rows of the row group are sorted by columns,
+  /// most significant first
+  void set_sorting_columns(const std::vector<SortingColumn>& columns);
+
   // commit the metadata
   void Finish(int64_t total_bytes_written);
 
  private:
+  friend class FileMetaDataBuilder;
+
   explicit RowGroupMetaDataBuilder(const std::shared_ptr<WriterProperties>& props,
                                    const SchemaDescriptor* schema_, void* contents);
   // PIMPL Idiom
@@ -281,6 +358,16 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // The prior RowGroupMetaDataBuilder (if any) is destroyed
   RowGroupMetaDataBuilder* AppendRowGroup();
 
+  // Write the Bloom filters set on column chunks of all row groups to sink and
+  // record their offsets in the column chunk metadata. Called after the last
+  // row group and before Finish()
+  void WriteBloomFilters(OutputStream* sink);
+
+  // Write the page indexes set on column chunks of all row groups to sink,
+  // column indexes first, and record their locations in the column chunk
+  // metadata. Called after the last row group and before Finish()
+  void WritePageIndex(OutputStream* sink);
+
   // Complete the Thrift structure
   std::unique_ptr<FileMetaData> Finish();
 
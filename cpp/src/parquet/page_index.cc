@@ -0,0 +1,212 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/page_index.h"
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "parquet/exception.h"
+#include "parquet/schema.h"
+#include "parquet/thrift.h"
+#include "parquet/util/comparison.h"
+#include "parquet/util/memory.h"
+
+namespace parquet {
+
+// ----------------------------------------------------------------------
+// ColumnIndex
+
+ColumnIndex::ColumnIndex(BoundaryOrder::type boundary_order,
+                         const std::vector<bool>& null_pages,
+                         const std::vector<std::string>& encoded_min_values,
+                         const std::vector<std::string>& encoded_max_values,
+                         const std::vector<int64_t>& null_counts)
+    : boundary_order_(boundary_order),
+      null_pages_(null_pages),
+      encoded_min_values_(encoded_min_values),
+      encoded_max_values_(encoded_max_values),
+      null_counts_(null_counts) {
+  if (encoded_min_values_.size() != null_pages_.size() ||
+      encoded_max_values_.size() != null_pages_.size() ||
+      (!null_counts_.empty() && null_counts_.size() != null_pages_.size())) {
+    throw ParquetException("ColumnIndex lists must have one entry per page");
+  }
+}
+
+std::unique_ptr<ColumnIndex> ColumnIndex::Make(const void* serialized_index,
+                                               uint32_t* index_len) {
+  format::ColumnIndex column_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), index_len,
+                       &column_index);
+  std::vector<int64_t> null_counts;
+  if (column_index.__isset.null_counts) {
+    null_counts = column_index.null_counts;
+  }
+  return std::unique_ptr<ColumnIndex>(new ColumnIndex(
+      static_cast<BoundaryOrder::type>(column_index.boundary_order),
+      column_index.null_pages, column_index.min_values, column_index.max_values,
+      null_counts));
+}
+
+namespace {
+
+template <typename DType>
+BoundaryOrder::type TypedBoundaryOrder(const ColumnDescriptor* descr,
+                                       const std::vector<bool>& null_pages,
+                                       const std::vector<std::string>& min_values,
+                                       const std::vector<std::string>& max_values) {
+  using Stats = TypedRowGroupStatistics<DType>;
+
+  auto less = std::static_pointer_cast<CompareDefault<DType>>(Comparator::Make(descr));
+  bool ascending = true;
+  bool descending = true;
+  std::unique_ptr<Stats> previous;
+  for (size_t i = 0; i < null_pages.size(); ++i) {
+    // Null pages have no bounds and do not take part in the order
+    if (null_pages[i]) continue;
+    std::unique_ptr<Stats> current(
+        new Stats(descr, min_values[i], max_values[i], 0, 0, 0, true));
+    if (previous) {
+      if ((*less)(current->min(), previous->min()) ||
+          (*less)(current->max(), previous->max())) {
+        ascending = false;
+      }
+      if ((*less)(previous->min(), current->min()) ||
+          (*less)(previous->max(), current->max())) {
+        descending = false;
+      }
+    }
+    previous = std::move(current);
+  }
+  if (ascending) return BoundaryOrder::ASCENDING;
+  if (descending) return BoundaryOrder::DESCENDING;
+  return BoundaryOrder::UNORDERED;
+}
+
+}  // namespace
+
+BoundaryOrder::type ColumnIndex::DetermineBoundaryOrder(
+    const ColumnDescriptor* descr, const std::vector<bool>& null_pages,
+    const std::vector<std::string>& encoded_min_values,
+    const std::vector<std::string>& encoded_max_values) {
+  if (descr->sort_order() == SortOrder::UNKNOWN) {
+    return BoundaryOrder::UNORDERED;
+  }
+  switch (descr->physical_type()) {
+    case Type::BOOLEAN:
+      return TypedBoundaryOrder<BooleanType>(descr, null_pages, encoded_min_values,
+                                             encoded_max_values);
+    case Type::INT32:
+      return TypedBoundaryOrder<Int32Type>(descr, null_pages, encoded_min_values,
+                                           encoded_max_values);
+    case Type::INT64:
+      return TypedBoundaryOrder<Int64Type>(descr, null_pages, encoded_min_values,
+                                           encoded_max_values);
+    case Type::INT96:
+      return TypedBoundaryOrder<Int96Type>(descr, null_pages, encoded_min_values,
+                                           encoded_max_values);
+    case Type::FLOAT:
+      return TypedBoundaryOrder<FloatType>(descr, null_pages, encoded_min_values,
+                                           encoded_max_values);
+    case Type::DOUBLE:
+      return TypedBoundaryOrder<DoubleType>(descr, null_pages, encoded_min_values,
+                                            encoded_max_values);
+    case Type::BYTE_ARRAY:
+      return TypedBoundaryOrder<ByteArrayType>(descr, null_pages, encoded_min_values,
+                                               encoded_max_values);
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return TypedBoundaryOrder<FLBAType>(descr, null_pages, encoded_min_values,
+                                          encoded_max_values);
+    default:
+      break;
+  }
+  return BoundaryOrder::UNORDERED;
+}
+
+EncodedStatistics ColumnIndex::page_statistics(int i) const {
+  EncodedStatistics statistics;
+  if (!null_pages_[i]) {
+    statistics.set_min(encoded_min_values_[i]);
+    statistics.set_max(encoded_max_values_[i]);
+  }
+  if (has_null_counts()) {
+    statistics.set_null_count(null_counts_[i]);
+  }
+  return statistics;
+}
+
+void ColumnIndex::WriteTo(OutputStream* sink) const {
+  format::ColumnIndex column_index;
+  column_index.__set_boundary_order(
+      static_cast<format::BoundaryOrder::type>(boundary_order_));
+  column_index.__set_null_pages(null_pages_);
+  column_index.__set_min_values(encoded_min_values_);
+  column_index.__set_max_values(encoded_max_values_);
+  if (has_null_counts()) {
+    column_index.__set_null_counts(null_counts_);
+  }
+  ThriftSerializer serializer;
+  serializer.Serialize(&column_index, sink);
+}
+
+// ----------------------------------------------------------------------
+// OffsetIndex
+
+OffsetIndex::OffsetIndex(const std::vector<PageLocation>& page_locations)
+    : page_locations_(page_locations) {}
+
+std::unique_ptr<OffsetIndex> OffsetIndex::Make(const void* serialized_index,
+                                               uint32_t* index_len) {
+  format::OffsetIndex offset_index;
+  DeserializeThriftMsg(reinterpret_cast<const uint8_t*>(serialized_index), index_len,
+                       &offset_index);
+  std::vector<PageLocation> page_locations;
+  page_locations.reserve(offset_index.page_locations.size());
+  for (const format::PageLocation& location : offset_index.page_locations) {
+    page_locations.push_back(
+        {location.offset, location.compressed_page_size, location.first_row_index});
+  }
+  return std::unique_ptr<OffsetIndex>(new OffsetIndex(page_locations));
+}
+
+int OffsetIndex::FindPage(int64_t row_index) const {
+  auto it = std::upper_bound(page_locations_.begin(), page_locations_.end(), row_index,
+                             [](int64_t row, const PageLocation& location) {
+                               return row < location.first_row_index;
+                             });
+  return static_cast<int>(it - page_locations_.begin()) - 1;
+}
+
+void OffsetIndex::WriteTo(OutputStream* sink) const {
+  format::OffsetIndex offset_index;
+  std::vector<format::PageLocation> page_locations(page_locations_.size());
+  for (size_t i = 0; i < page_locations_.size(); ++i) {
+    page_locations[i].__set_offset(page_locations_[i].offset);
+    page_locations[i].__set_compressed_page_size(
+        page_locations_[i].compressed_page_size);
+    page_locations[i].__set_first_row_index(page_locations_[i].first_row_index);
+  }
+  offset_index.__set_page_locations(page_locations);
+  ThriftSerializer serializer;
+  serializer.Serialize(&offset_index, sink);
+}
+
+}  // namespace parquet
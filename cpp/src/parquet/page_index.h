@@ -0,0 +1,138 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PARQUET_PAGE_INDEX_H
+#define PARQUET_PAGE_INDEX_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/statistics.h"
+#include "parquet/util/visibility.h"
+
+namespace parquet {
+
+class ColumnDescriptor;
+class OutputStream;
+
+// Mirrors parquet::BoundaryOrder
+struct BoundaryOrder {
+  enum type { UNORDERED = 0, ASCENDING = 1, DESCENDING = 2 };
+};
+
+// Location of a data page within the file, see OffsetIndex
+struct PageLocation {
+  // File offset of the page header
+  int64_t offset;
+  // Size of the page including its header
+  int32_t compressed_page_size;
+  // Index within the row group of the first row of the page
+  int64_t first_row_index;
+};
+
+/// \brief The per-page statistics of a column chunk.
+///
+/// Entry i describes the data page at OffsetIndex::page_locations()[i]. Min
+/// and max values are plain-encoded like EncodedStatistics and ordered by
+/// the column's sort order.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class PARQUET_EXPORT ColumnIndex {
+ public:
+  ColumnIndex(BoundaryOrder::type boundary_order, const std::vector<bool>& null_pages,
+              const std::vector<std::string>& encoded_min_values,
+              const std::vector<std::string>& encoded_max_values,
+              const std::vector<int64_t>& null_counts = {});
+
+  // Deserialize a Thrift ColumnIndex. On return index_len is set to the
+  // number of bytes consumed
+  static std::unique_ptr<ColumnIndex> Make(const void* serialized_index,
+                                           uint32_t* index_len);
+
+  // Whether the min/max values of the pages are ordered
+  static BoundaryOrder::type DetermineBoundaryOrder(
+      const ColumnDescriptor* descr, const std::vector<bool>& null_pages,
+      const std::vector<std::string>& encoded_min_values,
+      const std::vector<std::string>& encoded_max_values);
+
+  int num_pages() const { return static_cast<int>(null_pages_.size()); }
+
+  BoundaryOrder::type boundary_order() const { return boundary_order_; }
+
+  // null_pages()[i] is true if page i only holds nulls; its min and max values
+  // are then empty
+  const std::vector<bool>& null_pages() const { return null_pages_; }
+
+  const std::vector<std::string>& encoded_min_values() const {
+    return encoded_min_values_;
+  }
+
+  const std::vector<std::string>& encoded_max_values() const {
+    return encoded_max_values_;
+  }
+
+  bool has_null_counts() const { return !null_counts_.empty(); }
+
+  const std::vector<int64_t>& null_counts() const { return null_counts_; }
+
+  // The statistics of page i in the form they take in its page header
+  EncodedStatistics page_statistics(int i) const;
+
+  void WriteTo(OutputStream* sink) const;
+
+ private:
+  BoundaryOrder::type boundary_order_;
+  std::vector<bool> null_pages_;
+  std::vector<std::string> encoded_min_values_;
+  std::vector<std::string> encoded_max_values_;
+  std::vector<int64_t> null_counts_;
+};
+
+/// \brief The file locations of the data pages of a column chunk, ordered by
+/// offset, allowing readers to seek to the page holding a given row.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class PARQUET_EXPORT OffsetIndex {
+ public:
+  explicit OffsetIndex(const std::vector<PageLocation>& page_locations);
+
+  // Deserialize a Thrift OffsetIndex. On return index_len is set to the
+  // number of bytes consumed
+  static std::unique_ptr<OffsetIndex> Make(const void* serialized_index,
+                                           uint32_t* index_len);
+
+  int num_pages() const { return static_cast<int>(page_locations_.size()); }
+
+  const std::vector<PageLocation>& page_locations() const { return page_locations_; }
+
+  // The page holding the row group-relative row, or -1 if it precedes the
+  // first page
+  int FindPage(int64_t row_index) const;
+
+  void WriteTo(OutputStream* sink) const;
+
+ private:
+  std::vector<PageLocation> page_locations_;
+};
+
+}  // namespace parquet
+
+#endif  // PARQUET_PAGE_INDEX_H
@@ -449,6 +449,15 @@ enum Encoding {
   /** Dictionary encoding: the ids are encoded using the RLE encoding
    */
   RLE_DICTIONARY = 8;
+
+  /** Encoding for floating-point data.
+   * K byte-streams are created where K is the size in bytes of the data type.
+   * The individual bytes of an FP value are scattered to the corresponding stream and
+   * the streams are concatenated.
+   * This itself does not reduce the size of the data but can lead to better compression
+   * afterwards.
+   */
+  BYTE_STREAM_SPLIT = 9;
 }
 
 /**
@@ -659,6 +668,9 @@ struct ColumnMetaData {
    * This information can be used to determine if all data pages are
    * dictionary encoded for example **/
   13: optional list<PageEncodingStats> encoding_stats;
+
+  /** Byte offset from beginning of file to Bloom filter data. **/
+  14: optional i64 bloom_filter_offset;
 }
 
 struct EncryptionWithFooterKey {
@@ -21,6 +21,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 #include "parquet/exception.h"
 #include "parquet/parquet_version.h"
@@ -38,6 +39,8 @@ struct ParquetVersion {
 
 static int64_t DEFAULT_BUFFER_SIZE = 0;
 static bool DEFAULT_USE_BUFFERED_STREAM = false;
+static bool DEFAULT_USE_PRE_BUFFER = false;
+static bool DEFAULT_USE_LAZY_METADATA = false;
 
 class PARQUET_EXPORT ReaderProperties {
  public:
@@ -45,6 +48,9 @@ class PARQUET_EXPORT ReaderProperties {
       : pool_(pool) {
     buffered_stream_enabled_ = DEFAULT_USE_BUFFERED_STREAM;
     buffer_size_ = DEFAULT_BUFFER_SIZE;
+    pre_buffer_enabled_ = DEFAULT_USE_PRE_BUFFER;
+    pre_buffer_options_ = ::arrow::io::CoalesceOptions::Defaults();
+    lazy_metadata_enabled_ = DEFAULT_USE_LAZY_METADATA;
   }
 
   ::arrow::MemoryPool* memory_pool() const { return pool_; }
@@ -71,10 +77,49 @@ class PARQUET_EXPORT ReaderProperties {
 
   int64_t buffer_size() const { return buffer_size_; }
 
+  /// \brief Whether ParquetFileReader::PreBuffer() reads column chunks ahead
+  /// of decoding; it is a no-op otherwise
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  bool is_pre_buffer_enabled() const { return pre_buffer_enabled_; }
+
+  void enable_pre_buffer() { pre_buffer_enabled_ = true; }
+
+  void disable_pre_buffer() { pre_buffer_enabled_ = false; }
+
+  /// \brief How pre-buffered column chunks are merged into reads, and
+  /// whether the merged reads are issued concurrently
+  void set_pre_buffer_options(const ::arrow::io::CoalesceOptions& options) {
+    pre_buffer_options_ = options;
+  }
+
+  const ::arrow::io::CoalesceOptions& pre_buffer_options() const {
+    return pre_buffer_options_;
+  }
+
+  /// \brief Whether the row groups of the file metadata are only
+  /// deserialized when first accessed
+  ///
+  /// Planning over many files often needs the schema and a few row groups
+  /// of each; the other row groups are then skipped over when the footer is
+  /// parsed.
+  ///
+  /// \since 0.13.0
+  /// \note API not yet finalized
+  bool is_lazy_metadata_enabled() const { return lazy_metadata_enabled_; }
+
+  void enable_lazy_metadata() { lazy_metadata_enabled_ = true; }
+
+  void disable_lazy_metadata() { lazy_metadata_enabled_ = false; }
+
  private:
   ::arrow::MemoryPool* pool_;
   int64_t buffer_size_;
   bool buffered_stream_enabled_;
+  bool pre_buffer_enabled_;
+  ::arrow::io::CoalesceOptions pre_buffer_options_;
+  bool lazy_metadata_enabled_;
 };
 
 ReaderProperties PARQUET_EXPORT default_reader_properties();
@@ -84,8 +129,13 @@ static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = DEFAULT_PAGE_SIZE;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 64 * 1024 * 1024;
+static constexpr int64_t DEFAULT_MAX_ROW_GROUP_BYTES = 128 * 1024 * 1024;
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
+static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = false;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.01;
+static constexpr int64_t DEFAULT_ADAPTIVE_ENCODING_SAMPLE_SIZE = 16 * 1024;
+static constexpr int DEFAULT_MAX_PENDING_COMPRESSED_PAGES = 4;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::PLAIN;
 static constexpr ParquetVersion::type DEFAULT_WRITER_VERSION =
     ParquetVersion::PARQUET_1_0;
@@ -98,12 +148,17 @@ class PARQUET_EXPORT ColumnProperties {
                    Compression::type codec = DEFAULT_COMPRESSION_TYPE,
                    bool dictionary_enabled = DEFAULT_IS_DICTIONARY_ENABLED,
                    bool statistics_enabled = DEFAULT_ARE_STATISTICS_ENABLED,
-                   size_t max_stats_size = DEFAULT_MAX_STATISTICS_SIZE)
+                   size_t max_stats_size = DEFAULT_MAX_STATISTICS_SIZE,
+                   bool page_index_enabled = DEFAULT_IS_PAGE_INDEX_ENABLED)
       : encoding_(encoding),
         codec_(codec),
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
-        max_stats_size_(max_stats_size) {}
+        max_stats_size_(max_stats_size),
+        page_index_enabled_(page_index_enabled),
+        bloom_filter_ndv_(0),
+        bloom_filter_fpp_(DEFAULT_BLOOM_FILTER_FPP),
+        adaptive_encoding_sample_size_(0) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
 
@@ -121,6 +176,21 @@ class PARQUET_EXPORT ColumnProperties {
     max_stats_size_ = max_stats_size;
   }
 
+  void set_page_index_enabled(bool page_index_enabled) {
+    page_index_enabled_ = page_index_enabled;
+  }
+
+  // A Bloom filter is written if ndv > 0
+  void set_bloom_filter(int32_t ndv, double fpp) {
+    bloom_filter_ndv_ = ndv;
+    bloom_filter_fpp_ = fpp;
+  }
+
+  // The encoding is chosen from the first sample_size values if sample_size > 0
+  void set_adaptive_encoding(int64_t sample_size) {
+    adaptive_encoding_sample_size_ = sample_size;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -131,12 +201,28 @@ class PARQUET_EXPORT ColumnProperties {
 
   size_t max_statistics_size() const { return max_stats_size_; }
 
+  bool page_index_enabled() const { return page_index_enabled_; }
+
+  bool bloom_filter_enabled() const { return bloom_filter_ndv_ > 0; }
+
+  int32_t bloom_filter_ndv() const { return bloom_filter_ndv_; }
+
+  double bloom_filter_fpp() const { return bloom_filter_fpp_; }
+
+  bool adaptive_encoding_enabled() const { return adaptive_encoding_sample_size_ > 0; }
+
+  int64_t adaptive_encoding_sample_size() const { return adaptive_encoding_sample_size_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
   bool dictionary_enabled_;
   bool statistics_enabled_;
   size_t max_stats_size_;
+  bool page_index_enabled_;
+  int32_t bloom_filter_ndv_;
+  double bloom_filter_fpp_;
+  int64_t adaptive_encoding_sample_size_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -148,9 +234,11 @@ class PARQUET_EXPORT WriterProperties {
           dictionary_pagesize_limit_(DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT),
           write_batch_size_(DEFAULT_WRITE_BATCH_SIZE),
           max_row_group_length_(DEFAULT_MAX_ROW_GROUP_LENGTH),
+          max_row_group_bytes_(DEFAULT_MAX_ROW_GROUP_BYTES),
           pagesize_(DEFAULT_PAGE_SIZE),
           version_(DEFAULT_WRITER_VERSION),
-          created_by_(DEFAULT_CREATED_BY) {}
+          created_by_(DEFAULT_CREATED_BY),
+          max_pending_compressed_pages_(0) {}
     virtual ~Builder() {}
 
     Builder* memory_pool(::arrow::MemoryPool* pool) {
@@ -201,6 +289,20 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// \brief The size of the encoded pages of a row group written by
+    /// parquet::arrow::FileWriter::WriteRecordBatch, beyond which a new row
+    /// group is started
+    ///
+    /// \since 0.13.0
+    /// \note API not yet finalized
+    Builder* max_row_group_bytes(int64_t max_row_group_bytes) {
+      if (max_row_group_bytes <= 0) {
+        throw ParquetException("The maximum row group size must be positive");
+      }
+      max_row_group_bytes_ = max_row_group_bytes;
+      return this;
+    }
+
     Builder* data_pagesize(int64_t pg_size) {
       pagesize_ = pg_size;
       return this;
@@ -216,11 +318,40 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// \brief Compress data pages on the CPU thread pool
+    ///
+    /// Each column writer hands its full data pages to the pool and goes on
+    /// encoding, keeping at most max_pending_pages pages being compressed;
+    /// pages are still written in order.
+    ///
+    /// \since 0.13.0
+    /// \note API not yet finalized
+    Builder* enable_parallel_compression(
+        int max_pending_pages = DEFAULT_MAX_PENDING_COMPRESSED_PAGES) {
+      if (max_pending_pages <= 0) {
+        throw ParquetException("The number of pending pages must be positive");
+      }
+      max_pending_compressed_pages_ = max_pending_pages;
+      return this;
+    }
+
+    Builder* disable_parallel_compression() {
+      max_pending_compressed_pages_ = 0;
+      return this;
+    }
+
     /**
      * Define the encoding that is used when we don't utilise dictionary encoding.
      *
      * This either apply if dictionary encoding is disabled or if we fallback
      * as the dictionary grew too large.
+     *
+     * Besides PLAIN, DELTA_BINARY_PACKED can be used for INT32 and INT64 columns,
+     * DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY for BYTE_ARRAY columns and
+     * BYTE_STREAM_SPLIT for FLOAT and DOUBLE columns; writing a column of another
+     * type with them throws.  BYTE_STREAM_SPLIT does not shrink the data by itself
+     * but makes it compress better, so it is to be combined with a compression
+     * codec.
      */
     Builder* encoding(Encoding::type encoding_type) {
       if (encoding_type == Encoding::PLAIN_DICTIONARY ||
@@ -236,7 +367,8 @@ class PARQUET_EXPORT WriterProperties {
      * Define the encoding that is used when we don't utilise dictionary encoding.
      *
      * This either apply if dictionary encoding is disabled or if we fallback
-     * as the dictionary grew too large.
+     * as the dictionary grew too large.  See encoding(Encoding::type) for the
+     * supported encodings.
      */
     Builder* encoding(const std::string& path, Encoding::type encoding_type) {
       if (encoding_type == Encoding::PLAIN_DICTIONARY ||
@@ -307,6 +439,129 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_statistics(path->ToDotString());
     }
 
+    /// \brief Write the page index (ColumnIndex and OffsetIndex) of column
+    /// chunks ahead of the file footer. Repeated columns, whose pages may not
+    /// start on a row boundary, never get a page index; a ColumnIndex is only
+    /// written along with page statistics.
+    ///
+    /// \since 0.13.0
+    /// \note API not yet finalized
+    Builder* enable_page_index() {
+      default_column_properties_.set_page_index_enabled(true);
+      return this;
+    }
+
+    Builder* disable_page_index() {
+      default_column_properties_.set_page_index_enabled(false);
+      return this;
+    }
+
+    Builder* enable_page_index(const std::string& path) {
+      page_index_enabled_[path] = true;
+      return this;
+    }
+
+    Builder* enable_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_page_index(path->ToDotString());
+    }
+
+    Builder* disable_page_index(const std::string& path) {
+      page_index_enabled_[path] = false;
+      return this;
+    }
+
+    Builder* disable_page_index(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_page_index(path->ToDotString());
+    }
+
+    /// \brief Write a Bloom filter for each column chunk of the column, sized
+    /// for ndv distinct values at a false positive probability of fpp. The
+    /// filters are written after the last row group. BOOLEAN columns get no
+    /// Bloom filter.
+    ///
+    /// \since 0.13.0
+    /// \note API not yet finalized
+    Builder* enable_bloom_filter(const std::string& path, int32_t ndv,
+                                 double fpp = DEFAULT_BLOOM_FILTER_FPP) {
+      if (ndv <= 0) {
+        throw ParquetException("Bloom filter NDV must be positive");
+      }
+      if (!(fpp > 0.0 && fpp < 1.0)) {
+        throw ParquetException("Bloom filter FPP must lie in (0, 1)");
+      }
+      bloom_filters_[path] = std::make_pair(ndv, fpp);
+      return this;
+    }
+
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 int32_t ndv, double fpp = DEFAULT_BLOOM_FILTER_FPP) {
+      return this->enable_bloom_filter(path->ToDotString(), ndv, fpp);
+    }
+
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filters_.erase(path);
+      return this;
+    }
+
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
+    /// \brief Choose the encoding of each column chunk from its first values
+    ///
+    /// The first sample_size values written to a column chunk are encoded
+    /// with every candidate encoding as well, and the chunk goes on with the
+    /// one giving the fewest bytes, after compression if the column is
+    /// compressed. The candidates are dictionary encoding, if enabled, PLAIN
+    /// and the encoding set for the column and, for PARQUET_2_0 files, the
+    /// delta encodings applying to its physical type and BYTE_STREAM_SPLIT
+    /// for compressed FLOAT and DOUBLE columns. A dictionary that does not
+    /// pay off is dropped once the sample is encoded, and a dictionary
+    /// outgrowing dictionary_pagesize_limit() falls back to the best other
+    /// candidate rather than to PLAIN. Column chunks with fewer values, and
+    /// BOOLEAN columns, keep the configured encoding.
+    ///
+    /// \since 0.13.0
+    /// \note API not yet finalized
+    Builder* enable_adaptive_encoding(
+        int64_t sample_size = DEFAULT_ADAPTIVE_ENCODING_SAMPLE_SIZE) {
+      if (sample_size <= 0) {
+        throw ParquetException("The adaptive encoding sample size must be positive");
+      }
+      default_column_properties_.set_adaptive_encoding(sample_size);
+      return this;
+    }
+
+    Builder* disable_adaptive_encoding() {
+      default_column_properties_.set_adaptive_encoding(0);
+      return this;
+    }
+
+    Builder* enable_adaptive_encoding(
+        const std::string& path,
+        int64_t sample_size = DEFAULT_ADAPTIVE_ENCODING_SAMPLE_SIZE) {
+      if (sample_size <= 0) {
+        throw ParquetException("The adaptive encoding sample size must be positive");
+      }
+      adaptive_encoding_[path] = sample_size;
+      return this;
+    }
+
+    Builder* enable_adaptive_encoding(
+        const std::shared_ptr<schema::ColumnPath>& path,
+        int64_t sample_size = DEFAULT_ADAPTIVE_ENCODING_SAMPLE_SIZE) {
+      return this->enable_adaptive_encoding(path->ToDotString(), sample_size);
+    }
+
+    Builder* disable_adaptive_encoding(const std::string& path) {
+      adaptive_encoding_[path] = 0;
+      return this;
+    }
+
+    Builder* disable_adaptive_encoding(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_adaptive_encoding(path->ToDotString());
+    }
+
     std::shared_ptr<WriterProperties> build() {
       std::unordered_map<std::string, ColumnProperties> column_properties;
       auto get = [&](const std::string& key) -> ColumnProperties& {
@@ -323,10 +578,17 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_dictionary_enabled(item.second);
       for (const auto& item : statistics_enabled_)
         get(item.first).set_statistics_enabled(item.second);
+      for (const auto& item : page_index_enabled_)
+        get(item.first).set_page_index_enabled(item.second);
+      for (const auto& item : bloom_filters_)
+        get(item.first).set_bloom_filter(item.second.first, item.second.second);
+      for (const auto& item : adaptive_encoding_)
+        get(item.first).set_adaptive_encoding(item.second);
 
       return std::shared_ptr<WriterProperties>(
           new WriterProperties(pool_, dictionary_pagesize_limit_, write_batch_size_,
-                               max_row_group_length_, pagesize_, version_, created_by_,
+                               max_row_group_length_, max_row_group_bytes_, pagesize_,
+                               version_, created_by_, max_pending_compressed_pages_,
                                default_column_properties_, column_properties));
     }
 
@@ -335,9 +597,11 @@ class PARQUET_EXPORT WriterProperties {
     int64_t dictionary_pagesize_limit_;
     int64_t write_batch_size_;
     int64_t max_row_group_length_;
+    int64_t max_row_group_bytes_;
     int64_t pagesize_;
     ParquetVersion::type version_;
     std::string created_by_;
+    int max_pending_compressed_pages_;
 
     // Settings used for each column unless overridden in any of the maps below
     ColumnProperties default_column_properties_;
@@ -345,6 +609,9 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, Compression::type> codecs_;
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
+    std::unordered_map<std::string, bool> page_index_enabled_;
+    std::unordered_map<std::string, std::pair<int32_t, double>> bloom_filters_;
+    std::unordered_map<std::string, int64_t> adaptive_encoding_;
   };
 
   inline ::arrow::MemoryPool* memory_pool() const { return pool_; }
@@ -355,12 +622,18 @@ class PARQUET_EXPORT WriterProperties {
 
   inline int64_t max_row_group_length() const { return max_row_group_length_; }
 
+  inline int64_t max_row_group_bytes() const { return max_row_group_bytes_; }
+
   inline int64_t data_pagesize() const { return pagesize_; }
 
   inline ParquetVersion::type version() const { return parquet_version_; }
 
   inline std::string created_by() const { return parquet_created_by_; }
 
+  bool parallel_compression_enabled() const { return max_pending_compressed_pages_ > 0; }
+
+  int max_pending_compressed_pages() const { return max_pending_compressed_pages_; }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -404,20 +677,47 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).max_statistics_size();
   }
 
+  bool page_index_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).page_index_enabled();
+  }
+
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  int32_t bloom_filter_ndv(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_ndv();
+  }
+
+  double bloom_filter_fpp(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_fpp();
+  }
+
+  bool adaptive_encoding_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).adaptive_encoding_enabled();
+  }
+
+  int64_t adaptive_encoding_sample_size(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).adaptive_encoding_sample_size();
+  }
+
  private:
   explicit WriterProperties(
       ::arrow::MemoryPool* pool, int64_t dictionary_pagesize_limit,
-      int64_t write_batch_size, int64_t max_row_group_length, int64_t pagesize,
-      ParquetVersion::type version, const std::string& created_by,
-      const ColumnProperties& default_column_properties,
+      int64_t write_batch_size, int64_t max_row_group_length, int64_t max_row_group_bytes,
+      int64_t pagesize, ParquetVersion::type version, const std::string& created_by,
+      int max_pending_compressed_pages, const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties)
       : pool_(pool),
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
         max_row_group_length_(max_row_group_length),
+        max_row_group_bytes_(max_row_group_bytes),
         pagesize_(pagesize),
         parquet_version_(version),
         parquet_created_by_(created_by),
+        max_pending_compressed_pages_(max_pending_compressed_pages),
         default_column_properties_(default_column_properties),
         column_properties_(column_properties) {}
 
@@ -425,9 +725,11 @@ class PARQUET_EXPORT WriterProperties {
   int64_t dictionary_pagesize_limit_;
   int64_t write_batch_size_;
   int64_t max_row_group_length_;
+  int64_t max_row_group_bytes_;
   int64_t pagesize_;
   ParquetVersion::type parquet_version_;
   std::string parquet_created_by_;
+  int max_pending_compressed_pages_;
   ColumnProperties default_column_properties_;
   std::unordered_map<std::string, ColumnProperties> column_properties_;
 };
@@ -233,6 +233,65 @@ TEST_F(TestLocalFile, OpenWithMetadata) {
   ASSERT_EQ(metadata.get(), reader2->metadata().get());
 }
 
+TEST_F(TestLocalFile, OpenWithMetadataCache) {
+  FileMetaDataCache cache(1);
+  auto reader = ParquetFileReader::OpenFile(alltypes_plain(), &cache, false);
+  ASSERT_EQ(1, cache.size());
+
+  // The second reader shares the metadata parsed by the first
+  auto reader2 = ParquetFileReader::OpenFile(alltypes_plain(), &cache, false);
+  ASSERT_EQ(reader->metadata().get(), reader2->metadata().get());
+
+  // Entries for another size or modification time are not used
+  int64_t size;
+  PARQUET_THROW_NOT_OK(handle->GetSize(&size));
+  ASSERT_EQ(nullptr, cache.Get(alltypes_plain(), size + 1, 0));
+  ASSERT_EQ(0, cache.size());
+
+  // Least recently used entries are evicted
+  cache.Put("a", 1, 1, reader->metadata());
+  cache.Put("b", 1, 1, reader->metadata());
+  ASSERT_EQ(1, cache.size());
+  ASSERT_EQ(nullptr, cache.Get("a", 1, 1));
+  ASSERT_EQ(reader->metadata(), cache.Get("b", 1, 1));
+
+  cache.Clear();
+  ASSERT_EQ(0, cache.size());
+}
+
+TEST_F(TestLocalFile, LazyMetadata) {
+  ReaderProperties properties;
+  properties.enable_lazy_metadata();
+  auto lazy_reader = ParquetFileReader::Open(handle, properties);
+  auto reader = ParquetFileReader::OpenFile(alltypes_plain(), false);
+
+  auto lazy_metadata = lazy_reader->metadata();
+  auto metadata = reader->metadata();
+  ASSERT_EQ(metadata->size(), lazy_metadata->size());
+  ASSERT_EQ(metadata->num_rows(), lazy_metadata->num_rows());
+  ASSERT_EQ(metadata->num_row_groups(), lazy_metadata->num_row_groups());
+  ASSERT_TRUE(metadata->schema()->Equals(*lazy_metadata->schema()));
+  for (int i = 0; i < metadata->num_row_groups(); ++i) {
+    auto row_group = metadata->RowGroup(i);
+    auto lazy_row_group = lazy_metadata->RowGroup(i);
+    ASSERT_EQ(row_group->num_rows(), lazy_row_group->num_rows());
+    ASSERT_EQ(row_group->num_columns(), lazy_row_group->num_columns());
+    for (int j = 0; j < row_group->num_columns(); ++j) {
+      ASSERT_EQ(row_group->ColumnChunk(j)->data_page_offset(),
+                lazy_row_group->ColumnChunk(j)->data_page_offset());
+    }
+  }
+
+  // Row groups are serialized again, e.g. for _metadata files
+  InMemoryOutputStream stream, lazy_stream;
+  metadata->WriteTo(&stream);
+  lazy_metadata->WriteTo(&lazy_stream);
+  ASSERT_TRUE(stream.GetBuffer()->Equals(*lazy_stream.GetBuffer()));
+
+  ASSERT_EQ(reader->metadata()->num_rows(),
+            ScanFileContents({}, 128, lazy_reader.get()));
+}
+
 TEST(TestFileReaderAdHoc, NationDictTruncatedDataPage) {
   // PARQUET-816. Some files generated by older Parquet implementations may
   // contain malformed data page metadata, and we can successfully decode them
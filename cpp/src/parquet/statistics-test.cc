@@ -773,6 +773,59 @@ TEST(TestStatisticsDoubleNaN, NaNValues) {
   ASSERT_EQ(max, 4.0);
 }
 
+// Batches longer than the lanes min and max are reduced into
+TEST(TestStatisticsDoubleNaN, NaNValuesLongBatch) {
+  constexpr int NUM_VALUES = 1000;
+  NodePtr node = PrimitiveNode::Make("nan_double", Repetition::OPTIONAL, Type::DOUBLE);
+  ColumnDescriptor descr(node, 1, 1);
+  std::vector<double> values(NUM_VALUES);
+  std::vector<uint8_t> valid_bits(BitUtil::BytesForBits(NUM_VALUES), 255);
+  for (int i = 0; i < NUM_VALUES; i++) {
+    values[i] = i % 7 == 3 ? std::nan("") : static_cast<double>(i - NUM_VALUES / 2);
+  }
+  // Null entries hold values beyond those of the valid ones
+  values[10] = -1e9;
+  BitUtil::ClearBit(valid_bits.data(), 10);
+  values[NUM_VALUES - 1] = 1e9;
+  BitUtil::ClearBit(valid_bits.data(), NUM_VALUES - 1);
+
+  TypedRowGroupStatistics<DoubleType> stats(&descr);
+  stats.Update(values.data(), NUM_VALUES, 0);
+  ASSERT_EQ(-1e9, stats.min());
+  ASSERT_EQ(1e9, stats.max());
+
+  TypedRowGroupStatistics<DoubleType> spaced_stats(&descr);
+  spaced_stats.UpdateSpaced(values.data(), valid_bits.data(), 0, NUM_VALUES - 2, 2);
+  ASSERT_EQ(-NUM_VALUES / 2, spaced_stats.min());
+  ASSERT_EQ(NUM_VALUES / 2 - 2, spaced_stats.max());
+}
+
+// ByteArrays are compared by their first eight bytes, then as a whole
+TEST(TestStatisticsByteArray, SharedPrefixes) {
+  std::vector<std::string> strings = {"abcdefgh1", "abcdefgh", "abcdefgh\x80",
+                                      "abcdefgh\x80\x01", "abcdefg"};
+  std::vector<ByteArray> values;
+  for (const std::string& string : strings) {
+    values.emplace_back(static_cast<uint32_t>(string.size()),
+                        reinterpret_cast<const uint8_t*>(string.data()));
+  }
+  std::vector<uint8_t> valid_bits(1, 0x0e);
+
+  NodePtr node = PrimitiveNode::Make("binary", Repetition::OPTIONAL, Type::BYTE_ARRAY);
+  ColumnDescriptor descr(node, 1, 0);
+  ASSERT_EQ(SortOrder::UNSIGNED, descr.sort_order());
+  TypedRowGroupStatistics<ByteArrayType> stats(&descr);
+  stats.Update(values.data(), static_cast<int64_t>(values.size()), 0);
+  ASSERT_EQ("abcdefg", stats.EncodeMin());
+  ASSERT_EQ("abcdefgh\x80\x01", stats.EncodeMax());
+
+  // Without the first and last values
+  TypedRowGroupStatistics<ByteArrayType> spaced_stats(&descr);
+  spaced_stats.UpdateSpaced(values.data(), valid_bits.data(), 0, 3, 2);
+  ASSERT_EQ("abcdefgh", spaced_stats.EncodeMin());
+  ASSERT_EQ("abcdefgh\x80\x01", spaced_stats.EncodeMax());
+}
+
 // Test statistics for binary column with UNSIGNED sort order
 TEST(TestStatisticsMinMax, Unsigned) {
   std::string dir_string(test::get_data_dir());
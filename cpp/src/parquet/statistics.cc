@@ -20,6 +20,7 @@
 #include <cstring>
 #include <type_traits>
 
+#include "arrow/util/bit-util.h"
 #include "arrow/util/logging.h"
 
 #include "parquet/encoding.h"
@@ -92,6 +93,7 @@ template <typename DType>
 void TypedRowGroupStatistics<DType>::SetComparator() {
   comparator_ =
       std::static_pointer_cast<CompareDefault<DType> >(Comparator::Make(descr_));
+  unsigned_order_ = SortOrder::UNSIGNED == descr_->sort_order();
 }
 
 template <typename DType>
@@ -146,6 +148,215 @@ struct StatsHelper<T, typename std::enable_if<std::is_floating_point<T>::value>:
   inline bool IsNaN(const T value) { return std::isnan(value); }
 };
 
+// Min and max of arithmetic values, computed with plain comparisons instead
+// of calls to the comparator. NaNs are skipped, values[0] must not be one.
+//
+// The values are reduced into 32 bytes of independent lanes, which the
+// compiler turns into vector min/max instructions. A single accumulator is
+// not vectorized for floating point values, whose reduction order matters
+// to the compiler.
+template <typename T>
+void ArithmeticMinMax(const T* values, int64_t length, T* out_min, T* out_max) {
+  constexpr int64_t kLanes = 32 / sizeof(T);
+  T mins[kLanes];
+  T maxs[kLanes];
+  for (int64_t j = 0; j < kLanes; ++j) {
+    mins[j] = values[0];
+    maxs[j] = values[0];
+  }
+  int64_t i = 0;
+  for (; i + kLanes <= length; i += kLanes) {
+    for (int64_t j = 0; j < kLanes; ++j) {
+      mins[j] = values[i + j] < mins[j] ? values[i + j] : mins[j];
+      maxs[j] = maxs[j] < values[i + j] ? values[i + j] : maxs[j];
+    }
+  }
+  T min = mins[0];
+  T max = maxs[0];
+  for (int64_t j = 1; j < kLanes; ++j) {
+    min = mins[j] < min ? mins[j] : min;
+    max = max < maxs[j] ? maxs[j] : max;
+  }
+  for (; i < length; ++i) {
+    min = values[i] < min ? values[i] : min;
+    max = max < values[i] ? values[i] : max;
+  }
+  *out_min = min;
+  *out_max = max;
+}
+
+// The same over the valid entries of spaced values, values[0] being valid
+template <typename T>
+void ArithmeticMinMaxSpaced(const T* values, int64_t length, const uint8_t* valid_bits,
+                            int64_t valid_bits_offset, T* out_min, T* out_max) {
+  constexpr int64_t kBlockSize = 64;
+  T min = values[0];
+  T max = values[0];
+  for (int64_t start = 0; start < length; start += kBlockSize) {
+    const int64_t block_size = std::min(kBlockSize, length - start);
+    const int64_t num_valid = ::arrow::internal::CountSetBits(
+        valid_bits, valid_bits_offset + start, block_size);
+    if (num_valid == block_size) {
+      T block_min, block_max;
+      ArithmeticMinMax(values + start, block_size, &block_min, &block_max);
+      min = block_min < min ? block_min : min;
+      max = max < block_max ? block_max : max;
+    } else if (num_valid > 0) {
+      for (int64_t i = start; i < start + block_size; ++i) {
+        if (::arrow::BitUtil::GetBit(valid_bits, valid_bits_offset + i)) {
+          min = values[i] < min ? values[i] : min;
+          max = max < values[i] ? values[i] : max;
+        }
+      }
+    }
+  }
+  *out_min = min;
+  *out_max = max;
+}
+
+// Computes min and max without the comparator for the arithmetic types,
+// returns false for the others
+template <typename T, typename Enable = void>
+struct FastMinMax {
+  static bool Compute(const T* values, int64_t length, bool unsigned_order, T* min,
+                      T* max) {
+    return false;
+  }
+
+  static bool ComputeSpaced(const T* values, int64_t length, const uint8_t* valid_bits,
+                            int64_t valid_bits_offset, bool unsigned_order, T* min,
+                            T* max) {
+    return false;
+  }
+};
+
+template <typename T>
+struct FastMinMax<T, typename std::enable_if<std::is_arithmetic<T>::value &&
+                                             !std::is_same<T, bool>::value>::type> {
+  // Unsigned order only applies to integers
+  using UT = typename std::conditional<std::is_integral<T>::value, std::make_unsigned<T>,
+                                       std::common_type<T>>::type::type;
+
+  static bool Compute(const T* values, int64_t length, bool unsigned_order, T* min,
+                      T* max) {
+    if (unsigned_order) {
+      UT unsigned_min, unsigned_max;
+      ArithmeticMinMax(reinterpret_cast<const UT*>(values), length, &unsigned_min,
+                       &unsigned_max);
+      *min = static_cast<T>(unsigned_min);
+      *max = static_cast<T>(unsigned_max);
+    } else {
+      ArithmeticMinMax(values, length, min, max);
+    }
+    return true;
+  }
+
+  static bool ComputeSpaced(const T* values, int64_t length, const uint8_t* valid_bits,
+                            int64_t valid_bits_offset, bool unsigned_order, T* min,
+                            T* max) {
+    if (unsigned_order) {
+      UT unsigned_min, unsigned_max;
+      ArithmeticMinMaxSpaced(reinterpret_cast<const UT*>(values), length, valid_bits,
+                             valid_bits_offset, &unsigned_min, &unsigned_max);
+      *min = static_cast<T>(unsigned_min);
+      *max = static_cast<T>(unsigned_max);
+    } else {
+      ArithmeticMinMaxSpaced(values, length, valid_bits, valid_bits_offset, min, max);
+    }
+    return true;
+  }
+};
+
+// The first eight bytes of a ByteArray as a big-endian integer, zero-padded,
+// ordered as the values for the first eight bytes. Under signed order the
+// sign bits of the bytes are flipped to compare them as unsigned
+inline uint64_t ByteArrayPrefix(const ByteArray& value, uint8_t sign_flip) {
+  uint64_t prefix = 0;
+  const uint32_t length = std::min<uint32_t>(value.len, 8);
+  for (uint32_t i = 0; i < length; ++i) {
+    prefix |= static_cast<uint64_t>(value.ptr[i] ^ sign_flip) << (56 - 8 * i);
+  }
+  return prefix;
+}
+
+inline bool ByteArrayLess(const ByteArray& a, const ByteArray& b, bool unsigned_order) {
+  if (unsigned_order) {
+    return std::lexicographical_compare(a.ptr, a.ptr + a.len, b.ptr, b.ptr + b.len);
+  }
+  const int8_t* aptr = reinterpret_cast<const int8_t*>(a.ptr);
+  const int8_t* bptr = reinterpret_cast<const int8_t*>(b.ptr);
+  return std::lexicographical_compare(aptr, aptr + a.len, bptr, bptr + b.len);
+}
+
+// Min and max of ByteArrays, comparing their prefixes first. The values
+// themselves are only compared when their prefixes are equal
+template <>
+struct FastMinMax<ByteArray> {
+  class Accumulator {
+   public:
+    Accumulator(const ByteArray& first, bool unsigned_order)
+        : unsigned_order_(unsigned_order),
+          sign_flip_(unsigned_order ? 0 : 0x80),
+          min_(first),
+          max_(first),
+          min_prefix_(ByteArrayPrefix(first, sign_flip_)),
+          max_prefix_(min_prefix_) {}
+
+    void Update(const ByteArray& value) {
+      const uint64_t prefix = ByteArrayPrefix(value, sign_flip_);
+      if (prefix < min_prefix_ ||
+          (prefix == min_prefix_ && ByteArrayLess(value, min_, unsigned_order_))) {
+        min_ = value;
+        min_prefix_ = prefix;
+      }
+      if (prefix > max_prefix_ ||
+          (prefix == max_prefix_ && ByteArrayLess(max_, value, unsigned_order_))) {
+        max_ = value;
+        max_prefix_ = prefix;
+      }
+    }
+
+    const ByteArray& min() const { return min_; }
+    const ByteArray& max() const { return max_; }
+
+   private:
+    bool unsigned_order_;
+    uint8_t sign_flip_;
+    ByteArray min_;
+    ByteArray max_;
+    uint64_t min_prefix_;
+    uint64_t max_prefix_;
+  };
+
+  static bool Compute(const ByteArray* values, int64_t length, bool unsigned_order,
+                      ByteArray* min, ByteArray* max) {
+    Accumulator accumulator(values[0], unsigned_order);
+    for (int64_t i = 1; i < length; ++i) {
+      accumulator.Update(values[i]);
+    }
+    *min = accumulator.min();
+    *max = accumulator.max();
+    return true;
+  }
+
+  static bool ComputeSpaced(const ByteArray* values, int64_t length,
+                            const uint8_t* valid_bits, int64_t valid_bits_offset,
+                            bool unsigned_order, ByteArray* min, ByteArray* max) {
+    Accumulator accumulator(values[0], unsigned_order);
+    ::arrow::internal::BitmapReader valid_bits_reader(valid_bits, valid_bits_offset,
+                                                      length);
+    for (int64_t i = 0; i < length; ++i) {
+      if (valid_bits_reader.IsSet()) {
+        accumulator.Update(values[i]);
+      }
+      valid_bits_reader.Next();
+    }
+    *min = accumulator.min();
+    *max = accumulator.max();
+    return true;
+  }
+};
+
 template <typename T>
 void SetNaN(T* value) {
   // no-op
@@ -191,6 +402,13 @@ void TypedRowGroupStatistics<DType>::Update(const T* values, int64_t num_not_nul
     return;
   }
 
+  T min, max;
+  if (FastMinMax<T>::Compute(values + begin_offset, end_offset - begin_offset,
+                             unsigned_order_, &min, &max)) {
+    SetMinMax(min, max);
+    return;
+  }
+
   auto batch_minmax = std::minmax_element(values + begin_offset, values + end_offset,
                                           std::ref(*(this->comparator_)));
 
@@ -239,6 +457,11 @@ void TypedRowGroupStatistics<DType>::UpdateSpaced(const T* values,
 
   T min = values[i];
   T max = values[i];
+  if (FastMinMax<T>::ComputeSpaced(values + i, length - i, valid_bits,
+                                   valid_bits_offset + i, unsigned_order_, &min, &max)) {
+    SetMinMax(min, max);
+    return;
+  }
   for (; i < length; i++) {
     if (valid_bits_reader.IsSet()) {
       if ((std::ref(*(this->comparator_)))(values[i], min)) {
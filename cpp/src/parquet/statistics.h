@@ -179,6 +179,8 @@ class PARQUET_TEMPLATE_CLASS_EXPORT TypedRowGroupStatistics : public RowGroupSta
   T max_;
   ::arrow::MemoryPool* pool_;
   std::shared_ptr<CompareDefault<DType> > comparator_;
+  // Whether integers are compared as unsigned
+  bool unsigned_order_ = false;
 
   void PlainEncode(const T& src, std::string* dst);
   void PlainDecode(const std::string& src, T* dst);
@@ -20,8 +20,10 @@
 #include <openssl/evp.h>
 #include <openssl/rand.h>
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include "parquet/exception.h"
@@ -134,117 +136,157 @@ class EvpCipher {
   EVP_CIPHER_CTX* ctx_;
 };
 
-int gcm_encrypt(const uint8_t* plaintext, int plaintext_len, uint8_t* key, int key_len,
-                uint8_t* aad, int aad_len, uint8_t* ciphertext) {
-  int len;
-  int ciphertext_len;
+namespace {
 
-  uint8_t tag[gcmTagLen];
-  memset(tag, 0, gcmTagLen);
-  uint8_t iv[gcmIvLen];
-  memset(iv, 0, gcmIvLen);
+// Metadata modules are always encrypted with AES-GCM, pages with AES-CTR if the
+// algorithm is AES_GCM_CTR_V1
+int ModuleCipher(Encryption::type alg_id, bool metadata) {
+  if (Encryption::AES_GCM_V1 != alg_id && Encryption::AES_GCM_CTR_V1 != alg_id) {
+    std::stringstream ss;
+    ss << "Crypto algorithm " << alg_id << " is not supported";
+    throw ParquetException(ss.str());
+  }
+  return (metadata || Encryption::AES_GCM_V1 == alg_id) ? aesGcm : aesCtr;
+}
 
-  // Random IV
-  RAND_load_file("/dev/urandom", rndMaxBytes);
-  RAND_bytes(iv, sizeof(iv));
+// Random IV
+void GenerateIv(uint8_t* iv, int iv_len) {
+  static std::once_flag seeded;
+  std::call_once(seeded, [] { RAND_load_file("/dev/urandom", rndMaxBytes); });
+  if (1 != RAND_bytes(iv, iv_len)) {
+    throw ParquetException("Couldn't generate IV");
+  }
+}
 
-  // Init cipher context
-  EvpCipher cipher(aesGcm, key_len, encryptType);
+}  // namespace
 
-  // Setting key and IV
-  if (1 != EVP_EncryptInit_ex(cipher.get(), nullptr, nullptr, key, iv)) {
-    throw ParquetException("Couldn't set key and IV");
+class AesEncryptor::Impl {
+ public:
+  Impl(Encryption::type alg_id, bool metadata, const uint8_t* key, int key_len)
+      : cipher_type_(ModuleCipher(alg_id, metadata)),
+        cipher_(cipher_type_, key_len, encryptType) {
+    // The key schedule is kept for all modules, only the IV changes
+    if (1 != EVP_EncryptInit_ex(cipher_.get(), nullptr, nullptr, key, nullptr)) {
+      throw ParquetException("Couldn't set key");
+    }
   }
 
-  // Setting additional authenticated data
-  if ((nullptr != aad) &&
-      (1 != EVP_EncryptUpdate(cipher.get(), nullptr, &len, aad, aad_len))) {
-    throw ParquetException("Couldn't set AAD");
+  int Encrypt(const uint8_t* plaintext, int plaintext_len, const uint8_t* aad,
+              int aad_len, uint8_t* ciphertext) {
+    if (aesGcm == cipher_type_) {
+      return GcmEncrypt(plaintext, plaintext_len, aad, aad_len, ciphertext);
+    }
+    return CtrEncrypt(plaintext, plaintext_len, ciphertext);
   }
 
-  // Encryption
-  if (1 != EVP_EncryptUpdate(cipher.get(), ciphertext + gcmIvLen, &len, plaintext,
-                             plaintext_len)) {
-    throw ParquetException("Failed encryption update");
+  int CiphertextSizeDelta() const {
+    return aesGcm == cipher_type_ ? gcmIvLen + gcmTagLen : ctrIvLen;
   }
 
-  ciphertext_len = len;
+ private:
+  int GcmEncrypt(const uint8_t* plaintext, int plaintext_len, const uint8_t* aad,
+                 int aad_len, uint8_t* ciphertext) {
+    int len;
+    int ciphertext_len;
+
+    uint8_t tag[gcmTagLen];
+    memset(tag, 0, gcmTagLen);
+    uint8_t iv[gcmIvLen];
+    GenerateIv(iv, gcmIvLen);
+
+    // Setting IV
+    if (1 != EVP_EncryptInit_ex(cipher_.get(), nullptr, nullptr, nullptr, iv)) {
+      throw ParquetException("Couldn't set IV");
+    }
 
-  // Finalization
-  if (1 != EVP_EncryptFinal_ex(cipher.get(), ciphertext + gcmIvLen + len, &len)) {
-    throw ParquetException("Failed encryption finalization");
-  }
+    // Setting additional authenticated data
+    if ((nullptr != aad) &&
+        (1 != EVP_EncryptUpdate(cipher_.get(), nullptr, &len, aad, aad_len))) {
+      throw ParquetException("Couldn't set AAD");
+    }
 
-  ciphertext_len += len;
+    // Encryption
+    if (1 != EVP_EncryptUpdate(cipher_.get(), ciphertext + gcmIvLen, &len, plaintext,
+                               plaintext_len)) {
+      throw ParquetException("Failed encryption update");
+    }
 
-  // Getting the tag
-  if (1 != EVP_CIPHER_CTX_ctrl(cipher.get(), EVP_CTRL_GCM_GET_TAG, gcmTagLen, tag)) {
-    throw ParquetException("Couldn't get AES-GCM tag");
-  }
+    ciphertext_len = len;
 
-  // Copying the IV and tag to ciphertext
-  std::copy(iv, iv + gcmIvLen, ciphertext);
-  std::copy(tag, tag + gcmTagLen, ciphertext + gcmIvLen + ciphertext_len);
+    // Finalization
+    if (1 != EVP_EncryptFinal_ex(cipher_.get(), ciphertext + gcmIvLen + len, &len)) {
+      throw ParquetException("Failed encryption finalization");
+    }
 
-  return gcmIvLen + ciphertext_len + gcmTagLen;
-}
+    ciphertext_len += len;
 
-int ctr_encrypt(const uint8_t* plaintext, int plaintext_len, uint8_t* key, int key_len,
-                uint8_t* ciphertext) {
-  int len;
-  int ciphertext_len;
+    // Getting the tag
+    if (1 != EVP_CIPHER_CTX_ctrl(cipher_.get(), EVP_CTRL_GCM_GET_TAG, gcmTagLen, tag)) {
+      throw ParquetException("Couldn't get AES-GCM tag");
+    }
 
-  uint8_t iv[ctrIvLen];
-  memset(iv, 0, ctrIvLen);
+    // Copying the IV and tag to ciphertext
+    std::copy(iv, iv + gcmIvLen, ciphertext);
+    std::copy(tag, tag + gcmTagLen, ciphertext + gcmIvLen + ciphertext_len);
 
-  // Random IV
-  RAND_load_file("/dev/urandom", rndMaxBytes);
-  RAND_bytes(iv, sizeof(iv));
+    return gcmIvLen + ciphertext_len + gcmTagLen;
+  }
 
-  // Init cipher context
-  EvpCipher cipher(aesCtr, key_len, encryptType);
+  int CtrEncrypt(const uint8_t* plaintext, int plaintext_len, uint8_t* ciphertext) {
+    int len;
+    int ciphertext_len;
 
-  // Setting key and IV
-  if (1 != EVP_EncryptInit_ex(cipher.get(), nullptr, nullptr, key, iv)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+    uint8_t iv[ctrIvLen];
+    GenerateIv(iv, ctrIvLen);
 
-  // Encryption
-  if (1 != EVP_EncryptUpdate(cipher.get(), ciphertext + ctrIvLen, &len, plaintext,
-                             plaintext_len)) {
-    throw ParquetException("Failed encryption update");
-  }
+    // Setting IV
+    if (1 != EVP_EncryptInit_ex(cipher_.get(), nullptr, nullptr, nullptr, iv)) {
+      throw ParquetException("Couldn't set IV");
+    }
+
+    // Encryption
+    if (1 != EVP_EncryptUpdate(cipher_.get(), ciphertext + ctrIvLen, &len, plaintext,
+                               plaintext_len)) {
+      throw ParquetException("Failed encryption update");
+    }
+
+    ciphertext_len = len;
+
+    // Finalization
+    if (1 != EVP_EncryptFinal_ex(cipher_.get(), ciphertext + ctrIvLen + len, &len)) {
+      throw ParquetException("Failed encryption finalization");
+    }
 
-  ciphertext_len = len;
+    ciphertext_len += len;
 
-  // Finalization
-  if (1 != EVP_EncryptFinal_ex(cipher.get(), ciphertext + ctrIvLen + len, &len)) {
-    throw ParquetException("Failed encryption finalization");
+    // Copying the IV ciphertext
+    std::copy(iv, iv + ctrIvLen, ciphertext);
+
+    return ctrIvLen + ciphertext_len;
   }
 
-  ciphertext_len += len;
+  int cipher_type_;
+  EvpCipher cipher_;
+};
+
+AesEncryptor::AesEncryptor(Encryption::type alg_id, bool metadata, const uint8_t* key,
+                           int key_len)
+    : impl_(new Impl(alg_id, metadata, key, key_len)) {}
 
-  // Copying the IV ciphertext
-  std::copy(iv, iv + ctrIvLen, ciphertext);
+AesEncryptor::~AesEncryptor() {}
 
-  return ctrIvLen + ciphertext_len;
+int AesEncryptor::Encrypt(const uint8_t* plaintext, int plaintext_len,
+                          const uint8_t* aad, int aad_len, uint8_t* ciphertext) {
+  return impl_->Encrypt(plaintext, plaintext_len, aad, aad_len, ciphertext);
 }
 
+int AesEncryptor::CiphertextSizeDelta() const { return impl_->CiphertextSizeDelta(); }
+
 int Encrypt(Encryption::type alg_id, bool metadata, const uint8_t* plaintext,
             int plaintext_len, uint8_t* key, int key_len, uint8_t* aad, int aad_len,
             uint8_t* ciphertext) {
-  if (Encryption::AES_GCM_V1 != alg_id && Encryption::AES_GCM_CTR_V1 != alg_id) {
-    std::stringstream ss;
-    ss << "Crypto algorithm " << alg_id << " is not supported";
-    throw ParquetException(ss.str());
-  }
-
-  if (metadata || (Encryption::AES_GCM_V1 == alg_id)) {
-    return gcm_encrypt(plaintext, plaintext_len, key, key_len, aad, aad_len, ciphertext);
-  }
-
-  // Data (page) encryption with AES_GCM_CTR_V1
-  return ctr_encrypt(plaintext, plaintext_len, key, key_len, ciphertext);
+  AesEncryptor encryptor(alg_id, metadata, key, key_len);
+  return encryptor.Encrypt(plaintext, plaintext_len, aad, aad_len, ciphertext);
 }
 
 int Encrypt(std::shared_ptr<EncryptionProperties> encryption_props, bool metadata,
@@ -255,107 +297,134 @@ int Encrypt(std::shared_ptr<EncryptionProperties> encryption_props, bool metadat
                  ciphertext);
 }
 
-int gcm_decrypt(const uint8_t* ciphertext, int ciphertext_len, uint8_t* key, int key_len,
-                uint8_t* aad, int aad_len, uint8_t* plaintext) {
-  int len;
-  int plaintext_len;
+class AesDecryptor::Impl {
+ public:
+  Impl(Encryption::type alg_id, bool metadata, const uint8_t* key, int key_len)
+      : cipher_type_(ModuleCipher(alg_id, metadata)),
+        cipher_(cipher_type_, key_len, decryptType) {
+    // The key schedule is kept for all modules, only the IV changes
+    if (1 != EVP_DecryptInit_ex(cipher_.get(), nullptr, nullptr, key, nullptr)) {
+      throw ParquetException("Couldn't set key");
+    }
+  }
 
-  uint8_t tag[gcmTagLen];
-  memset(tag, 0, gcmTagLen);
-  uint8_t iv[gcmIvLen];
-  memset(iv, 0, gcmIvLen);
+  int Decrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* aad,
+              int aad_len, uint8_t* plaintext) {
+    if (ciphertext_len < CiphertextSizeDelta()) {
+      throw ParquetException("Ciphertext too short");
+    }
+    if (aesGcm == cipher_type_) {
+      return GcmDecrypt(ciphertext, ciphertext_len, aad, aad_len, plaintext);
+    }
+    return CtrDecrypt(ciphertext, ciphertext_len, plaintext);
+  }
 
-  // Extracting IV and tag
-  std::copy(ciphertext, ciphertext + gcmIvLen, iv);
-  std::copy(ciphertext + ciphertext_len - gcmTagLen, ciphertext + ciphertext_len, tag);
+  int CiphertextSizeDelta() const {
+    return aesGcm == cipher_type_ ? gcmIvLen + gcmTagLen : ctrIvLen;
+  }
 
-  // Init cipher context
-  EvpCipher cipher(aesGcm, key_len, decryptType);
+ private:
+  int GcmDecrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* aad,
+                 int aad_len, uint8_t* plaintext) {
+    int len;
+    int plaintext_len;
+
+    uint8_t tag[gcmTagLen];
+    memset(tag, 0, gcmTagLen);
+    uint8_t iv[gcmIvLen];
+    memset(iv, 0, gcmIvLen);
+
+    // Extracting IV and tag
+    std::copy(ciphertext, ciphertext + gcmIvLen, iv);
+    std::copy(ciphertext + ciphertext_len - gcmTagLen, ciphertext + ciphertext_len, tag);
+
+    // Setting IV
+    if (1 != EVP_DecryptInit_ex(cipher_.get(), nullptr, nullptr, nullptr, iv)) {
+      throw ParquetException("Couldn't set IV");
+    }
 
-  // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(cipher.get(), nullptr, nullptr, key, iv)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+    // Setting additional authenticated data
+    if ((nullptr != aad) &&
+        (1 != EVP_DecryptUpdate(cipher_.get(), nullptr, &len, aad, aad_len))) {
+      throw ParquetException("Couldn't set AAD");
+    }
 
-  // Setting additional authenticated data
-  if ((nullptr != aad) &&
-      (1 != EVP_DecryptUpdate(cipher.get(), nullptr, &len, aad, aad_len))) {
-    throw ParquetException("Couldn't set AAD");
-  }
+    // Decryption
+    if (!EVP_DecryptUpdate(cipher_.get(), plaintext, &len, ciphertext + gcmIvLen,
+                           ciphertext_len - gcmIvLen - gcmTagLen)) {
+      throw ParquetException("Failed decryption update");
+    }
 
-  // Decryption
-  if (!EVP_DecryptUpdate(cipher.get(), plaintext, &len, ciphertext + gcmIvLen,
-                         ciphertext_len - gcmIvLen - gcmTagLen)) {
-    throw ParquetException("Failed decryption update");
-  }
+    plaintext_len = len;
 
-  plaintext_len = len;
+    // Checking the tag (authentication)
+    if (!EVP_CIPHER_CTX_ctrl(cipher_.get(), EVP_CTRL_GCM_SET_TAG, gcmTagLen, tag)) {
+      throw ParquetException("Failed authentication");
+    }
 
-  // Checking the tag (authentication)
-  if (!EVP_CIPHER_CTX_ctrl(cipher.get(), EVP_CTRL_GCM_SET_TAG, gcmTagLen, tag)) {
-    throw ParquetException("Failed authentication");
-  }
+    // Finalization
+    if (1 != EVP_DecryptFinal_ex(cipher_.get(), plaintext + len, &len)) {
+      throw ParquetException("Failed decryption finalization");
+    }
 
-  // Finalization
-  if (1 != EVP_DecryptFinal_ex(cipher.get(), plaintext + len, &len)) {
-    throw ParquetException("Failed decryption finalization");
+    plaintext_len += len;
+    return plaintext_len;
   }
 
-  plaintext_len += len;
-  return plaintext_len;
-}
+  int CtrDecrypt(const uint8_t* ciphertext, int ciphertext_len, uint8_t* plaintext) {
+    int len;
+    int plaintext_len;
 
-int ctr_decrypt(const uint8_t* ciphertext, int ciphertext_len, uint8_t* key, int key_len,
-                uint8_t* plaintext) {
-  int len;
-  int plaintext_len;
+    uint8_t iv[ctrIvLen];
+    memset(iv, 0, ctrIvLen);
 
-  uint8_t iv[ctrIvLen];
-  memset(iv, 0, ctrIvLen);
+    // Extracting IV
+    std::copy(ciphertext, ciphertext + ctrIvLen, iv);
 
-  // Extracting IV and tag
-  std::copy(ciphertext, ciphertext + ctrIvLen, iv);
+    // Setting IV
+    if (1 != EVP_DecryptInit_ex(cipher_.get(), nullptr, nullptr, nullptr, iv)) {
+      throw ParquetException("Couldn't set IV");
+    }
 
-  // Init cipher context
-  EvpCipher cipher(aesCtr, key_len, decryptType);
+    // Decryption
+    if (!EVP_DecryptUpdate(cipher_.get(), plaintext, &len, ciphertext + ctrIvLen,
+                           ciphertext_len - ctrIvLen)) {
+      throw ParquetException("Failed decryption update");
+    }
 
-  // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(cipher.get(), nullptr, nullptr, key, iv)) {
-    throw ParquetException("Couldn't set key and IV");
-  }
+    plaintext_len = len;
 
-  // Decryption
-  if (!EVP_DecryptUpdate(cipher.get(), plaintext, &len, ciphertext + ctrIvLen,
-                         ciphertext_len - ctrIvLen)) {
-    throw ParquetException("Failed decryption update");
+    // Finalization
+    if (1 != EVP_DecryptFinal_ex(cipher_.get(), plaintext + len, &len)) {
+      throw ParquetException("Failed decryption finalization");
+    }
+
+    plaintext_len += len;
+    return plaintext_len;
   }
 
-  plaintext_len = len;
+  int cipher_type_;
+  EvpCipher cipher_;
+};
 
-  // Finalization
-  if (1 != EVP_DecryptFinal_ex(cipher.get(), plaintext + len, &len)) {
-    throw ParquetException("Failed decryption finalization");
-  }
+AesDecryptor::AesDecryptor(Encryption::type alg_id, bool metadata, const uint8_t* key,
+                           int key_len)
+    : impl_(new Impl(alg_id, metadata, key, key_len)) {}
+
+AesDecryptor::~AesDecryptor() {}
 
-  plaintext_len += len;
-  return plaintext_len;
+int AesDecryptor::Decrypt(const uint8_t* ciphertext, int ciphertext_len,
+                          const uint8_t* aad, int aad_len, uint8_t* plaintext) {
+  return impl_->Decrypt(ciphertext, ciphertext_len, aad, aad_len, plaintext);
 }
 
+int AesDecryptor::CiphertextSizeDelta() const { return impl_->CiphertextSizeDelta(); }
+
 int Decrypt(Encryption::type alg_id, bool metadata, const uint8_t* ciphertext,
             int ciphertext_len, uint8_t* key, int key_len, uint8_t* aad, int aad_len,
             uint8_t* plaintext) {
-  if (Encryption::AES_GCM_V1 != alg_id && Encryption::AES_GCM_CTR_V1 != alg_id) {
-    std::stringstream ss;
-    ss << "Crypto algorithm " << alg_id << " is not supported";
-    throw ParquetException(ss.str());
-  }
-
-  if (metadata || (Encryption::AES_GCM_V1 == alg_id)) {
-    return gcm_decrypt(ciphertext, ciphertext_len, key, key_len, aad, aad_len, plaintext);
-  }
-
-  // Data (page) decryption with AES_GCM_CTR_V1
-  return ctr_decrypt(ciphertext, ciphertext_len, key, key_len, plaintext);
+  AesDecryptor decryptor(alg_id, metadata, key, key_len);
+  return decryptor.Decrypt(ciphertext, ciphertext_len, aad, aad_len, plaintext);
 }
 
 int Decrypt(std::shared_ptr<EncryptionProperties> encryption_props, bool metadata,
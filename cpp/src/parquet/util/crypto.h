@@ -28,6 +28,56 @@ using parquet::EncryptionProperties;
 
 namespace parquet_encryption {
 
+/// \brief Encrypts modules with one key, keeping the cipher context and key
+/// schedule for all of them
+///
+/// A column encrypts all its pages with the same key: an AesEncryptor made
+/// once per column saves Encrypt() from setting up a cipher context and
+/// expanding the key on every call. Instances are not thread-safe.
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class AesEncryptor {
+ public:
+  AesEncryptor(Encryption::type alg_id, bool metadata, const uint8_t* key, int key_len);
+  ~AesEncryptor();
+
+  /// \brief Encrypt plaintext_len bytes into ciphertext, which must hold
+  /// plaintext_len + CiphertextSizeDelta() bytes. Returns the ciphertext length
+  int Encrypt(const uint8_t* plaintext, int plaintext_len, const uint8_t* aad,
+              int aad_len, uint8_t* ciphertext);
+
+  /// \brief The number of bytes the ciphertext adds to the plaintext
+  int CiphertextSizeDelta() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief Decrypts modules with one key, keeping the cipher context and key
+/// schedule for all of them. Instances are not thread-safe
+///
+/// \since 0.13.0
+/// \note API not yet finalized
+class AesDecryptor {
+ public:
+  AesDecryptor(Encryption::type alg_id, bool metadata, const uint8_t* key, int key_len);
+  ~AesDecryptor();
+
+  /// \brief Decrypt ciphertext_len bytes into plaintext, which must hold
+  /// ciphertext_len - CiphertextSizeDelta() bytes. Returns the plaintext length
+  int Decrypt(const uint8_t* ciphertext, int ciphertext_len, const uint8_t* aad,
+              int aad_len, uint8_t* plaintext);
+
+  /// \brief The number of bytes the ciphertext adds to the plaintext
+  int CiphertextSizeDelta() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 int Encrypt(Encryption::type alg_id, bool metadata, const uint8_t* plaintext,
             int plaintext_len, uint8_t* key, int key_len, uint8_t* aad, int aad_len,
             uint8_t* ciphertext);
@@ -69,6 +69,8 @@ class PARQUET_EXPORT Vector {
   T* data() { return data_; }
   const T* data() const { return data_; }
 
+  int64_t size() const { return size_; }
+
  private:
   std::shared_ptr<ResizableBuffer> buffer_;
   int64_t size_;
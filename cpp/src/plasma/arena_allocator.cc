@@ -0,0 +1,193 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/arena_allocator.h"
+
+#include <algorithm>
+#include <iterator>
+
+#include "arrow/util/logging.h"
+
+namespace plasma {
+
+constexpr int64_t ArenaAllocator::kMinSlotSize;
+constexpr int ArenaAllocator::kNumSizeClasses;
+constexpr int64_t ArenaAllocator::kMaxSlotSize;
+constexpr int64_t ArenaAllocator::kSlotsPerSlab;
+
+namespace {
+
+int64_t RoundUp(int64_t value, int64_t multiple) {
+  return (value + multiple - 1) / multiple * multiple;
+}
+
+}  // namespace
+
+ArenaAllocator::ArenaAllocator(uint8_t* base, int64_t size)
+    : free_bytes_(0), partial_slabs_(kNumSizeClasses), slab_bytes_(0) {
+  // Align the region, so that aligning offsets aligns the memory.
+  const int64_t address = static_cast<int64_t>(reinterpret_cast<uintptr_t>(base));
+  const int64_t padding = RoundUp(address, kMinSlotSize) - address;
+  base_ = base + padding;
+  size_ = std::max<int64_t>(size - padding, 0) / kMinSlotSize * kMinSlotSize;
+  if (size_ > 0) {
+    AddFreeBlock(0, size_);
+  }
+}
+
+void* ArenaAllocator::Allocate(size_t alignment, size_t bytes) {
+  const int64_t size = std::max<int64_t>(static_cast<int64_t>(bytes), 1);
+  if (size <= kMaxSlotSize && static_cast<int64_t>(alignment) <= kMinSlotSize) {
+    int size_class = 0;
+    while (SlotSize(size_class) < size) {
+      ++size_class;
+    }
+    return AllocateSlot(size_class);
+  }
+  const int64_t offset = AllocateBlock(RoundUp(size, kMinSlotSize), alignment);
+  return offset < 0 ? nullptr : base_ + offset;
+}
+
+void ArenaAllocator::Free(void* mem, size_t bytes) {
+  const int64_t offset = static_cast<uint8_t*>(mem) - base_;
+  ARROW_CHECK(offset >= 0 && offset < size_) << "The memory is not in the arena";
+  auto slab_it = slabs_.upper_bound(offset);
+  if (slab_it != slabs_.begin()) {
+    --slab_it;
+    if (offset < slab_it->first + SlabSize(slab_it->second.size_class)) {
+      FreeSlot(slab_it, offset);
+      return;
+    }
+  }
+  const int64_t size = std::max<int64_t>(static_cast<int64_t>(bytes), 1);
+  FreeBlock(offset, RoundUp(size, kMinSlotSize));
+}
+
+void ArenaAllocator::GetStats(PlasmaAllocatorStats* stats) const {
+  stats->free_bytes = free_bytes_;
+  stats->largest_free_block =
+      free_blocks_by_size_.empty() ? 0 : free_blocks_by_size_.rbegin()->first;
+  stats->num_free_blocks = static_cast<int64_t>(free_blocks_.size());
+  stats->slab_bytes = slab_bytes_;
+}
+
+void* ArenaAllocator::AllocateSlot(int size_class) {
+  auto& partial_slabs = partial_slabs_[size_class];
+  if (partial_slabs.empty()) {
+    const int64_t slab_offset = AllocateBlock(SlabSize(size_class), kMinSlotSize);
+    if (slab_offset < 0) {
+      return nullptr;
+    }
+    Slab& slab = slabs_[slab_offset];
+    slab.size_class = size_class;
+    // Hand out the slots from the start of the slab.
+    for (int64_t slot = kSlotsPerSlab - 1; slot >= 0; --slot) {
+      slab.free_slots.push_back(slot);
+    }
+    partial_slabs.insert(slab_offset);
+    slab_bytes_ += SlabSize(size_class);
+  }
+  // Fill up the slabs with the lowest offsets first, so that the others
+  // empty out and are given back.
+  const int64_t slab_offset = *partial_slabs.begin();
+  Slab& slab = slabs_[slab_offset];
+  const int64_t slot = slab.free_slots.back();
+  slab.free_slots.pop_back();
+  if (slab.free_slots.empty()) {
+    partial_slabs.erase(slab_offset);
+  }
+  return base_ + slab_offset + slot * SlotSize(size_class);
+}
+
+void ArenaAllocator::FreeSlot(std::map<int64_t, Slab>::iterator slab_it,
+                              int64_t offset) {
+  const int64_t slab_offset = slab_it->first;
+  Slab& slab = slab_it->second;
+  const int64_t slot_size = SlotSize(slab.size_class);
+  ARROW_CHECK((offset - slab_offset) % slot_size == 0) << "The memory is not a slot";
+  slab.free_slots.push_back((offset - slab_offset) / slot_size);
+  auto& partial_slabs = partial_slabs_[slab.size_class];
+  if (static_cast<int64_t>(slab.free_slots.size()) == kSlotsPerSlab) {
+    // Give back the memory of empty slabs.
+    partial_slabs.erase(slab_offset);
+    slab_bytes_ -= SlabSize(slab.size_class);
+    FreeBlock(slab_offset, SlabSize(slab.size_class));
+    slabs_.erase(slab_it);
+  } else if (slab.free_slots.size() == 1) {
+    partial_slabs.insert(slab_offset);
+  }
+}
+
+int64_t ArenaAllocator::AllocateBlock(int64_t size, size_t alignment) {
+  for (auto it = free_blocks_by_size_.lower_bound(std::make_pair(size, int64_t(0)));
+       it != free_blocks_by_size_.end(); ++it) {
+    const int64_t block_size = it->first;
+    const int64_t block_offset = it->second;
+    // Skip blocks that are too small once the start is aligned.
+    const int64_t address =
+        static_cast<int64_t>(reinterpret_cast<uintptr_t>(base_ + block_offset));
+    const int64_t offset =
+        block_offset + RoundUp(address, static_cast<int64_t>(alignment)) - address;
+    if (offset + size > block_offset + block_size) {
+      continue;
+    }
+    EraseFreeBlock(free_blocks_.find(block_offset));
+    if (offset > block_offset) {
+      AddFreeBlock(block_offset, offset - block_offset);
+    }
+    if (offset + size < block_offset + block_size) {
+      AddFreeBlock(offset + size, block_offset + block_size - offset - size);
+    }
+    return offset;
+  }
+  return -1;
+}
+
+void ArenaAllocator::FreeBlock(int64_t offset, int64_t size) {
+  auto next = free_blocks_.lower_bound(offset);
+  ARROW_CHECK(next == free_blocks_.end() || next->first >= offset + size)
+      << "The memory was freed already";
+  if (next != free_blocks_.end() && next->first == offset + size) {
+    size += next->second;
+    next = std::next(next);
+    EraseFreeBlock(std::prev(next));
+  }
+  if (next != free_blocks_.begin()) {
+    auto prev = std::prev(next);
+    ARROW_CHECK(prev->first + prev->second <= offset) << "The memory was freed already";
+    if (prev->first + prev->second == offset) {
+      offset = prev->first;
+      size += prev->second;
+      EraseFreeBlock(prev);
+    }
+  }
+  AddFreeBlock(offset, size);
+}
+
+void ArenaAllocator::AddFreeBlock(int64_t offset, int64_t size) {
+  free_blocks_.emplace(offset, size);
+  free_blocks_by_size_.emplace(size, offset);
+  free_bytes_ += size;
+}
+
+void ArenaAllocator::EraseFreeBlock(std::map<int64_t, int64_t>::iterator it) {
+  free_blocks_by_size_.erase(std::make_pair(it->second, it->first));
+  free_bytes_ -= it->second;
+  free_blocks_.erase(it);
+}
+
+}  // namespace plasma
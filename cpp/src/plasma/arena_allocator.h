@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_ARENA_ALLOCATOR_H
+#define PLASMA_ARENA_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "plasma/plasma_allocator.h"
+
+namespace plasma {
+
+/// An allocator of a single region of memory, which it hands out in multiples
+/// of kBlockSize. Objects of up to kMaxSlotSize bytes are allocated from
+/// slabs of equally sized slots, so that small objects of different lifetimes
+/// do not split up the free space. Larger objects get the smallest free block
+/// they fit in, and freed blocks are merged with the free blocks next to them.
+///
+/// The bookkeeping is kept outside of the region, which is never accessed.
+class ArenaAllocator {
+ public:
+  /// The size of the smallest slots, which is also the alignment of every
+  /// allocation by default.
+  static constexpr int64_t kMinSlotSize = 64;
+  /// The number of size classes of slots, each twice the size of the last.
+  static constexpr int kNumSizeClasses = 7;
+  /// The size of the largest slots.
+  static constexpr int64_t kMaxSlotSize = kMinSlotSize << (kNumSizeClasses - 1);
+  /// The number of slots in a slab.
+  static constexpr int64_t kSlotsPerSlab = 64;
+
+  /// \param base The start of the region.
+  /// \param size The size of the region in bytes.
+  ArenaAllocator(uint8_t* base, int64_t size);
+
+  /// Allocate memory from the region.
+  ///
+  /// \param alignment The alignment of the memory, a power of two.
+  /// \param bytes The number of bytes to allocate.
+  /// \return The memory, or null if there is no free block large enough.
+  void* Allocate(size_t alignment, size_t bytes);
+
+  /// Free memory returned by Allocate().
+  ///
+  /// \param mem The memory to free.
+  /// \param bytes The number of bytes that were allocated.
+  void Free(void* mem, size_t bytes);
+
+  /// Fill in the statistics about the free memory of the region.
+  ///
+  /// \param[out] stats The statistics, of which allocated and footprint_limit
+  ///             are left as they are.
+  void GetStats(PlasmaAllocatorStats* stats) const;
+
+ private:
+  struct Slab {
+    int size_class;
+    /// The indices of the free slots.
+    std::vector<int64_t> free_slots;
+  };
+
+  int64_t SlotSize(int size_class) const { return kMinSlotSize << size_class; }
+
+  int64_t SlabSize(int size_class) const { return SlotSize(size_class) * kSlotsPerSlab; }
+
+  void* AllocateSlot(int size_class);
+
+  void FreeSlot(std::map<int64_t, Slab>::iterator slab_it, int64_t offset);
+
+  /// \return The offset of the block, or -1 if no free block is large enough.
+  int64_t AllocateBlock(int64_t size, size_t alignment);
+
+  void FreeBlock(int64_t offset, int64_t size);
+
+  void AddFreeBlock(int64_t offset, int64_t size);
+
+  void EraseFreeBlock(std::map<int64_t, int64_t>::iterator it);
+
+  uint8_t* base_;
+  int64_t size_;
+  /// The free blocks by offset, to merge them, and by size and then offset,
+  /// to find the best fit.
+  std::map<int64_t, int64_t> free_blocks_;
+  std::set<std::pair<int64_t, int64_t>> free_blocks_by_size_;
+  int64_t free_bytes_;
+  /// The slabs by offset, and the offsets of those with free slots for every
+  /// size class.
+  std::map<int64_t, Slab> slabs_;
+  std::vector<std::set<int64_t>> partial_slabs_;
+  int64_t slab_bytes_;
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_ARENA_ALLOCATOR_H
@@ -50,6 +50,8 @@
 #include "plasma/fling.h"
 #include "plasma/io.h"
 #include "plasma/malloc.h"
+#include "plasma/numa.h"
+#include "plasma/object_directory.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
 
@@ -87,17 +89,11 @@ constexpr int64_t kBytesInMB = 1 << 20;
 // GPU support
 
 #ifdef PLASMA_CUDA
-struct GpuProcessHandle {
-  /// Pointer to CUDA buffer that is backing this GPU object.
-  std::shared_ptr<CudaBuffer> ptr;
-  /// Number of client using this GPU object.
-  int client_count;
-};
-
-// This is necessary as IPC handles can only be mapped once per process.
-// Thus if multiple clients in the same process get the same gpu object,
-// they need to access the same mapped CudaBuffer.
-static std::unordered_map<ObjectID, GpuProcessHandle*> gpu_object_map;
+// The regions of device memory of the store that this process opened, by
+// their serialized IPC handle. GPU objects are slices of the regions, which
+// are opened once per process since IPC handles can only be mapped once per
+// process, and opening one takes milliseconds.
+static std::unordered_map<std::string, std::shared_ptr<CudaBuffer>> gpu_region_map;
 static std::mutex gpu_mutex;
 #endif
 
@@ -161,7 +157,13 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
                  int num_retries = -1);
 
   Status Create(const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
-                int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0);
+                int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0,
+                int64_t priority = 0);
+
+  Status Create(const std::vector<ObjectID>& object_ids,
+                const std::vector<int64_t>& data_sizes,
+                const std::vector<std::string>& metadata,
+                std::vector<std::shared_ptr<Buffer>>* data);
 
   Status CreateAndSeal(const ObjectID& object_id, const std::string& data,
                        const std::string& metadata);
@@ -174,25 +176,41 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   Status Release(const ObjectID& object_id);
 
+  Status Release(const std::vector<ObjectID>& object_ids);
+
+  Status SetReleaseBatchSize(int64_t batch_size);
+
+  Status FlushReleases();
+
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   Status Contains(const ObjectID& object_id, bool* has_object);
 
   Status List(ObjectTable* objects);
 
+  Status Metrics(PlasmaStoreMetrics* metrics);
+
   Status Abort(const ObjectID& object_id);
 
   Status Seal(const ObjectID& object_id);
 
+  Status Seal(const std::vector<ObjectID>& object_ids);
+
   Status Delete(const std::vector<ObjectID>& object_ids);
 
   Status Evict(int64_t num_bytes, int64_t& num_bytes_evicted);
 
   Status Hash(const ObjectID& object_id, uint8_t* digest);
 
-  Status Subscribe(int* fd);
+  Status Subscribe(int* fd, bool batched);
 
   Status DecodeNotification(const uint8_t* buffer, ObjectID* object_id,
                             int64_t* data_size, int64_t* metadata_size);
 
+  Status DecodeNotifications(const uint8_t* buffer, std::vector<ObjectID>* object_ids,
+                             std::vector<int64_t>* data_sizes,
+                             std::vector<int64_t>* metadata_sizes);
+
   Status GetNotification(int fd, ObjectID* object_id, int64_t* data_size,
                          int64_t* metadata_size);
 
@@ -215,6 +233,13 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   /// \return The return status.
   Status MarkObjectUnused(const ObjectID& object_id);
 
+  /// Decrement the count of an object in use. If this client no longer uses
+  /// it, queue its release to be sent to the store.
+  ///
+  /// \param object_id The object ID we release.
+  /// \return The return status.
+  Status DecrementObjectCount(const ObjectID& object_id);
+
   /// Common helper for Get() variants
   Status GetBuffers(const ObjectID* object_ids, int64_t num_objects, int64_t timeout_ms,
                     const std::function<std::shared_ptr<Buffer>(
@@ -225,6 +250,16 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
   uint8_t* LookupMmappedFile(int store_fd_val);
 
+#ifdef PLASMA_CUDA
+  /// Get the device memory of a GPU object, opening the region of device
+  /// memory it is in unless this process did already.
+  ///
+  /// \param object The object.
+  /// \param out The data and metadata of the object.
+  /// \return The return status.
+  Status GetGpuBuffer(const PlasmaObject& object, std::shared_ptr<CudaBuffer>* out);
+#endif
+
   void IncrementObjectCount(const ObjectID& object_id, PlasmaObject* object,
                             bool is_sealed);
 
@@ -252,6 +287,23 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
   int64_t store_capacity_;
   /// A hash set to record the ids that users want to delete but still in use.
   std::unordered_set<ObjectID> deletion_cache_;
+  /// Objects no longer in use whose release has not been sent to the store.
+  /// They are sent before any other request, so that the store sees requests
+  /// in the order they were made.
+  std::vector<ObjectID> pending_releases_;
+  /// The number of releases sent to the store in one message.
+  int64_t release_batch_size_;
+  /// The directory of sealed objects in the shared memory of the store, or
+  /// null if the store has none.
+  std::unique_ptr<ObjectDirectory> object_directory_;
+  /// The notifications read in batches from each batched subscription that
+  /// GetNotification did not return yet.
+  struct Notification {
+    ObjectID object_id;
+    int64_t data_size;
+    int64_t metadata_size;
+  };
+  std::unordered_map<int, std::deque<Notification>> notification_batches_;
 
 #ifdef PLASMA_CUDA
   /// Cuda Device Manager.
@@ -261,7 +313,8 @@ class PlasmaClient::Impl : public std::enable_shared_from_this<PlasmaClient::Imp
 
 PlasmaBuffer::~PlasmaBuffer() { ARROW_UNUSED(client_->Release(object_id_)); }
 
-PlasmaClient::Impl::Impl() : store_conn_(0), store_capacity_(0) {
+PlasmaClient::Impl::Impl()
+    : store_conn_(0), store_capacity_(0), release_batch_size_(1) {
 #ifdef PLASMA_CUDA
   DCHECK_OK(CudaDeviceManager::GetInstance(&manager_));
 #endif
@@ -303,6 +356,26 @@ uint8_t* PlasmaClient::Impl::LookupMmappedFile(int store_fd_val) {
   return entry->second.pointer;
 }
 
+#ifdef PLASMA_CUDA
+Status PlasmaClient::Impl::GetGpuBuffer(const PlasmaObject& object,
+                                        std::shared_ptr<CudaBuffer>* out) {
+  std::shared_ptr<Buffer> handle;
+  RETURN_NOT_OK(object.ipc_handle->Serialize(arrow::default_memory_pool(), &handle));
+  std::lock_guard<std::mutex> lock(gpu_mutex);
+  auto it = gpu_region_map.find(handle->ToString());
+  if (it == gpu_region_map.end()) {
+    std::shared_ptr<CudaContext> context;
+    RETURN_NOT_OK(manager_->GetContext(object.device_num - 1, &context));
+    std::shared_ptr<CudaBuffer> region;
+    RETURN_NOT_OK(context->OpenIpcBuffer(*object.ipc_handle, &region));
+    it = gpu_region_map.emplace(handle->ToString(), region).first;
+  }
+  *out = std::make_shared<CudaBuffer>(it->second, object.data_offset,
+                                      object.data_size + object.metadata_size);
+  return Status::OK();
+}
+#endif
+
 bool PlasmaClient::Impl::IsInUse(const ObjectID& object_id) {
   const auto elem = objects_in_use_.find(object_id);
   return (elem != objects_in_use_.end());
@@ -346,11 +419,13 @@ void PlasmaClient::Impl::IncrementObjectCount(const ObjectID& object_id,
 
 Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
                                   const uint8_t* metadata, int64_t metadata_size,
-                                  std::shared_ptr<Buffer>* data, int device_num) {
+                                  std::shared_ptr<Buffer>* data, int device_num,
+                                  int64_t priority) {
   ARROW_LOG(DEBUG) << "called plasma_create on conn " << store_conn_ << " with size "
                    << data_size << " and metadata size " << metadata_size;
-  RETURN_NOT_OK(
-      SendCreateRequest(store_conn_, object_id, data_size, metadata_size, device_num));
+  RETURN_NOT_OK(FlushReleases());
+  RETURN_NOT_OK(SendCreateRequest(store_conn_, object_id, data_size, metadata_size,
+                                  device_num, priority, CurrentNumaNode()));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaCreateReply, &buffer));
   ObjectID id;
@@ -378,16 +453,12 @@ Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
     }
   } else {
 #ifdef PLASMA_CUDA
-    std::lock_guard<std::mutex> lock(gpu_mutex);
-    std::shared_ptr<CudaContext> context;
-    RETURN_NOT_OK(manager_->GetContext(device_num - 1, &context));
-    GpuProcessHandle* handle = new GpuProcessHandle();
-    RETURN_NOT_OK(context->OpenIpcBuffer(*object.ipc_handle, &handle->ptr));
-    gpu_object_map[object_id] = handle;
-    *data = handle->ptr;
+    std::shared_ptr<CudaBuffer> buffer;
+    RETURN_NOT_OK(GetGpuBuffer(object, &buffer));
+    *data = buffer;
     if (metadata != NULL) {
       // Copy the metadata to the buffer.
-      CudaBufferWriter writer(std::dynamic_pointer_cast<CudaBuffer>(*data));
+      CudaBufferWriter writer(buffer);
       RETURN_NOT_OK(writer.WriteAt(object.data_size, metadata, metadata_size));
     }
 #else
@@ -407,6 +478,56 @@ Status PlasmaClient::Impl::Create(const ObjectID& object_id, int64_t data_size,
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::Create(const std::vector<ObjectID>& object_ids,
+                                  const std::vector<int64_t>& data_sizes,
+                                  const std::vector<std::string>& metadata,
+                                  std::vector<std::shared_ptr<Buffer>>* data) {
+  ARROW_LOG(DEBUG) << "called plasma_create on conn " << store_conn_ << " for "
+                   << object_ids.size() << " objects";
+  if (data_sizes.size() != object_ids.size() || metadata.size() != object_ids.size()) {
+    return Status::Invalid("Create() needs a data size and metadata for each object");
+  }
+  std::vector<int64_t> metadata_sizes;
+  for (const auto& object_metadata : metadata) {
+    metadata_sizes.push_back(static_cast<int64_t>(object_metadata.size()));
+  }
+  RETURN_NOT_OK(FlushReleases());
+  RETURN_NOT_OK(SendCreateManyRequest(store_conn_, object_ids, data_sizes,
+                                      metadata_sizes, CurrentNumaNode()));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaCreateManyReply, &buffer));
+  std::vector<ObjectID> ids;
+  std::vector<PlasmaObject> objects;
+  std::vector<int> store_fds;
+  std::vector<int64_t> mmap_sizes;
+  // If the CreateManyReply included an error, then none of the objects were
+  // created and the store will not send file descriptors.
+  RETURN_NOT_OK(ReadCreateManyReply(buffer.data(), buffer.size(), &ids, &objects,
+                                    &store_fds, &mmap_sizes));
+  ARROW_CHECK(ids.size() == object_ids.size());
+  for (size_t i = 0; i < store_fds.size(); i++) {
+    int fd = GetStoreFd(store_fds[i]);
+    LookupOrMmap(fd, store_fds[i], mmap_sizes[i]);
+  }
+
+  data->clear();
+  for (size_t i = 0; i < object_ids.size(); ++i) {
+    PlasmaObject* object = &objects[i];
+    ARROW_CHECK(ids[i] == object_ids[i]);
+    ARROW_CHECK(object->data_size == data_sizes[i]);
+    ARROW_CHECK(object->metadata_size == metadata_sizes[i]);
+    // The metadata should come right after the data.
+    ARROW_CHECK(object->metadata_offset == object->data_offset + data_sizes[i]);
+    uint8_t* pointer = LookupMmappedFile(object->store_fd) + object->data_offset;
+    memcpy(pointer + object->data_size, metadata[i].data(), metadata[i].size());
+    data->push_back(std::make_shared<MutableBuffer>(pointer, data_sizes[i]));
+    // As in Create() for one object, the second count is released by Seal().
+    IncrementObjectCount(object_ids[i], object, false);
+    IncrementObjectCount(object_ids[i], object, false);
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::CreateAndSeal(const ObjectID& object_id,
                                          const std::string& data,
                                          const std::string& metadata) {
@@ -422,6 +543,7 @@ Status PlasmaClient::Impl::CreateAndSeal(const ObjectID& object_id,
       reinterpret_cast<const uint8_t*>(metadata.data()), metadata.size(), device_num);
   memcpy(&digest[0], &hash, sizeof(hash));
 
+  RETURN_NOT_OK(FlushReleases());
   RETURN_NOT_OK(SendCreateAndSealRequest(store_conn_, object_id, data, metadata, digest));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(
@@ -435,14 +557,29 @@ Status PlasmaClient::Impl::GetBuffers(
     const std::function<std::shared_ptr<Buffer>(
         const ObjectID&, const std::shared_ptr<Buffer>&)>& wrap_buffer,
     ObjectBuffer* object_buffers) {
-  // Fill out the info for the objects that are already in use locally.
+  // Fill out the info for the objects that are already in use locally, or
+  // that can be pinned through the object directory.
   bool all_present = true;
+  std::vector<ObjectID> pinned_ids;
   for (int64_t i = 0; i < num_objects; ++i) {
     auto object_entry = objects_in_use_.find(object_ids[i]);
+    PlasmaObject pinned_object = {};
+    PlasmaObject* object;
     if (object_entry == objects_in_use_.end()) {
-      // This object is not currently in use by this client, so we need to send
-      // a request to the store.
-      all_present = false;
+      if (!object_directory_ || !object_directory_->Pin(object_ids[i], &pinned_object)) {
+        // This object is not currently in use by this client, so we need to
+        // send a request to the store.
+        all_present = false;
+        continue;
+      }
+      pinned_ids.push_back(object_ids[i]);
+      if (mmap_table_.find(pinned_object.store_fd) == mmap_table_.end()) {
+        // The object is in a file this client has not mapped yet, which the
+        // store sends along with its reply.
+        all_present = false;
+        continue;
+      }
+      object = &pinned_object;
     } else if (!object_entry->second->is_sealed) {
       // This client created the object but hasn't sealed it. If we call Get
       // with no timeout, we will deadlock, because this client won't be able to
@@ -452,30 +589,41 @@ Status PlasmaClient::Impl::GetBuffers(
       ARROW_LOG(WARNING)
           << "Attempting to get an object that this client created but hasn't sealed.";
       all_present = false;
+      continue;
     } else {
-      PlasmaObject* object = &object_entry->second->object;
-      std::shared_ptr<Buffer> physical_buf;
+      object = &object_entry->second->object;
+    }
+    std::shared_ptr<Buffer> physical_buf;
 
-      if (object->device_num == 0) {
-        uint8_t* data = LookupMmappedFile(object->store_fd);
-        physical_buf = std::make_shared<Buffer>(
-            data + object->data_offset, object->data_size + object->metadata_size);
-      } else {
+    if (object->device_num == 0) {
+      uint8_t* data = LookupMmappedFile(object->store_fd);
+      physical_buf = std::make_shared<Buffer>(
+          data + object->data_offset, object->data_size + object->metadata_size);
+    } else {
 #ifdef PLASMA_CUDA
-        physical_buf = gpu_object_map.find(object_ids[i])->second->ptr;
+      std::shared_ptr<CudaBuffer> buffer;
+      RETURN_NOT_OK(GetGpuBuffer(*object, &buffer));
+      physical_buf = buffer;
 #else
-        ARROW_LOG(FATAL) << "Arrow GPU library is not enabled.";
+      ARROW_LOG(FATAL) << "Arrow GPU library is not enabled.";
 #endif
-      }
-      physical_buf = wrap_buffer(object_ids[i], physical_buf);
-      object_buffers[i].data = SliceBuffer(physical_buf, 0, object->data_size);
-      object_buffers[i].metadata =
-          SliceBuffer(physical_buf, object->data_size, object->metadata_size);
-      object_buffers[i].device_num = object->device_num;
-      // Increment the count of the number of instances of this object that this
-      // client is using. Cache the reference to the object.
-      IncrementObjectCount(object_ids[i], object, true);
     }
+    physical_buf = wrap_buffer(object_ids[i], physical_buf);
+    object_buffers[i].data = SliceBuffer(physical_buf, 0, object->data_size);
+    object_buffers[i].metadata =
+        SliceBuffer(physical_buf, object->data_size, object->metadata_size);
+    object_buffers[i].device_num = object->device_num;
+    object_buffers[i].numa_node = object->numa_node;
+    // Increment the count of the number of instances of this object that this
+    // client is using. Cache the reference to the object.
+    IncrementObjectCount(object_ids[i], object, true);
+  }
+
+  if (!pinned_ids.empty()) {
+    // Releases queued before the pins must reach the store first, or it would
+    // release the references the pins turn into.
+    RETURN_NOT_OK(FlushReleases());
+    RETURN_NOT_OK(SendPinRequest(store_conn_, pinned_ids));
   }
 
   if (all_present) {
@@ -484,7 +632,9 @@ Status PlasmaClient::Impl::GetBuffers(
 
   // If we get here, then the objects aren't all currently in use by this
   // client, so we need to send a request to the plasma store.
-  RETURN_NOT_OK(SendGetRequest(store_conn_, &object_ids[0], num_objects, timeout_ms));
+  RETURN_NOT_OK(FlushReleases());
+  RETURN_NOT_OK(SendGetRequest(store_conn_, &object_ids[0], num_objects, timeout_ms,
+                               CurrentNumaNode()));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaGetReply, &buffer));
   std::vector<ObjectID> received_object_ids(num_objects);
@@ -524,19 +674,9 @@ Status PlasmaClient::Impl::GetBuffers(
             data + object->data_offset, object->data_size + object->metadata_size);
       } else {
 #ifdef PLASMA_CUDA
-        std::lock_guard<std::mutex> lock(gpu_mutex);
-        auto handle = gpu_object_map.find(object_ids[i]);
-        if (handle == gpu_object_map.end()) {
-          std::shared_ptr<CudaContext> context;
-          RETURN_NOT_OK(manager_->GetContext(object->device_num - 1, &context));
-          GpuProcessHandle* obj_handle = new GpuProcessHandle();
-          RETURN_NOT_OK(context->OpenIpcBuffer(*object->ipc_handle, &obj_handle->ptr));
-          gpu_object_map[object_ids[i]] = obj_handle;
-          physical_buf = obj_handle->ptr;
-        } else {
-          handle->second->client_count += 1;
-          physical_buf = handle->second->ptr;
-        }
+        std::shared_ptr<CudaBuffer> buffer;
+        RETURN_NOT_OK(GetGpuBuffer(*object, &buffer));
+        physical_buf = buffer;
 #else
         ARROW_LOG(FATAL) << "Arrow GPU library is not enabled.";
 #endif
@@ -547,6 +687,7 @@ Status PlasmaClient::Impl::GetBuffers(
       object_buffers[i].metadata =
           SliceBuffer(physical_buf, object->data_size, object->metadata_size);
       object_buffers[i].device_num = object->device_num;
+      object_buffers[i].numa_node = object->numa_node;
       // Increment the count of the number of instances of this object that this
       // client is using. Cache the reference to the object.
       IncrementObjectCount(received_object_ids[i], object, true);
@@ -588,11 +729,7 @@ Status PlasmaClient::Impl::MarkObjectUnused(const ObjectID& object_id) {
   return Status::OK();
 }
 
-Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
-  // If the client is already disconnected, ignore release requests.
-  if (store_conn_ < 0) {
-    return Status::OK();
-  }
+Status PlasmaClient::Impl::DecrementObjectCount(const ObjectID& object_id) {
   auto object_entry = objects_in_use_.find(object_id);
   ARROW_CHECK(object_entry != objects_in_use_.end());
   object_entry->second->count -= 1;
@@ -601,17 +738,78 @@ Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
   if (object_entry->second->count == 0) {
     // Tell the store that the client no longer needs the object.
     RETURN_NOT_OK(MarkObjectUnused(object_id));
-    RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_id));
-    auto iter = deletion_cache_.find(object_id);
-    if (iter != deletion_cache_.end()) {
-      deletion_cache_.erase(object_id);
-      RETURN_NOT_OK(Delete({object_id}));
+    pending_releases_.push_back(object_id);
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::Release(const ObjectID& object_id) {
+  // If the client is already disconnected, ignore release requests.
+  if (store_conn_ < 0) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(DecrementObjectCount(object_id));
+  if (static_cast<int64_t>(pending_releases_.size()) >= release_batch_size_) {
+    RETURN_NOT_OK(FlushReleases());
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::Release(const std::vector<ObjectID>& object_ids) {
+  // If the client is already disconnected, ignore release requests.
+  if (store_conn_ < 0) {
+    return Status::OK();
+  }
+  for (const auto& object_id : object_ids) {
+    RETURN_NOT_OK(DecrementObjectCount(object_id));
+  }
+  if (static_cast<int64_t>(pending_releases_.size()) >= release_batch_size_) {
+    RETURN_NOT_OK(FlushReleases());
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::SetReleaseBatchSize(int64_t batch_size) {
+  if (batch_size < 1) {
+    return Status::Invalid("The release batch size must be positive");
+  }
+  release_batch_size_ = batch_size;
+  if (static_cast<int64_t>(pending_releases_.size()) >= release_batch_size_) {
+    RETURN_NOT_OK(FlushReleases());
+  }
+  return Status::OK();
+}
+
+Status PlasmaClient::Impl::FlushReleases() {
+  if (pending_releases_.empty() || store_conn_ < 0) {
+    return Status::OK();
+  }
+  std::vector<ObjectID> object_ids;
+  object_ids.swap(pending_releases_);
+  if (object_ids.size() == 1) {
+    RETURN_NOT_OK(SendReleaseRequest(store_conn_, object_ids[0]));
+  } else {
+    RETURN_NOT_OK(SendReleaseManyRequest(store_conn_, object_ids));
+  }
+  // Delete the released objects that users wanted to delete while in use.
+  std::vector<ObjectID> object_ids_to_delete;
+  for (const auto& object_id : object_ids) {
+    if (deletion_cache_.erase(object_id) > 0) {
+      object_ids_to_delete.push_back(object_id);
     }
   }
+  if (!object_ids_to_delete.empty()) {
+    RETURN_NOT_OK(Delete(object_ids_to_delete));
+  }
   return Status::OK();
 }
 
 // This method is used to query whether the plasma store contains an object.
+Status PlasmaClient::Impl::Prefetch(const std::vector<ObjectID>& object_ids) {
+  RETURN_NOT_OK(FlushReleases());
+  return SendPrefetchRequest(store_conn_, object_ids);
+}
+
 Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object) {
   // Check if we already have a reference to the object.
   if (objects_in_use_.count(object_id) > 0) {
@@ -619,6 +817,7 @@ Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object)
   } else {
     // If we don't already have a reference to the object, check with the store
     // to see if we have the object.
+    RETURN_NOT_OK(FlushReleases());
     RETURN_NOT_OK(SendContainsRequest(store_conn_, object_id));
     std::vector<uint8_t> buffer;
     RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaContainsReply, &buffer));
@@ -631,12 +830,21 @@ Status PlasmaClient::Impl::Contains(const ObjectID& object_id, bool* has_object)
 }
 
 Status PlasmaClient::Impl::List(ObjectTable* objects) {
+  RETURN_NOT_OK(FlushReleases());
   RETURN_NOT_OK(SendListRequest(store_conn_));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaListReply, &buffer));
   return ReadListReply(buffer.data(), buffer.size(), objects);
 }
 
+Status PlasmaClient::Impl::Metrics(PlasmaStoreMetrics* metrics) {
+  RETURN_NOT_OK(FlushReleases());
+  RETURN_NOT_OK(SendMetricsRequest(store_conn_));
+  std::vector<uint8_t> buffer;
+  RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaMetricsReply, &buffer));
+  return ReadMetricsReply(buffer.data(), buffer.size(), metrics);
+}
+
 static void ComputeBlockHash(const unsigned char* data, int64_t nbytes, uint64_t* hash) {
   XXH64_state_t hash_state;
   XXH64_reset(&hash_state, XXH64_DEFAULT_SEED);
@@ -725,6 +933,7 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   /// Send the seal request to Plasma.
   static unsigned char digest[kDigestSize];
   RETURN_NOT_OK(Hash(object_id, &digest[0]));
+  RETURN_NOT_OK(FlushReleases());
   RETURN_NOT_OK(SendSealRequest(store_conn_, object_id, &digest[0]));
   // We call PlasmaClient::Release to decrement the number of instances of this
   // object
@@ -734,6 +943,36 @@ Status PlasmaClient::Impl::Seal(const ObjectID& object_id) {
   return Release(object_id);
 }
 
+Status PlasmaClient::Impl::Seal(const std::vector<ObjectID>& object_ids) {
+  // Make sure this client has a reference to all of the objects before
+  // sealing any of them.
+  std::unordered_set<ObjectID> unique_ids;
+  for (const auto& object_id : object_ids) {
+    auto object_entry = objects_in_use_.find(object_id);
+    if (object_entry == objects_in_use_.end()) {
+      return Status::PlasmaObjectNonexistent(
+          "Seal() called on an object without a reference to it");
+    }
+    if (object_entry->second->is_sealed || !unique_ids.insert(object_id).second) {
+      return Status::PlasmaObjectAlreadySealed(
+          "Seal() called on an already sealed object");
+    }
+  }
+
+  std::vector<std::string> digests;
+  digests.reserve(object_ids.size());
+  for (const auto& object_id : object_ids) {
+    objects_in_use_[object_id]->is_sealed = true;
+    unsigned char digest[kDigestSize] = {0};
+    RETURN_NOT_OK(Hash(object_id, &digest[0]));
+    digests.emplace_back(reinterpret_cast<char*>(&digest[0]), kDigestSize);
+  }
+  RETURN_NOT_OK(FlushReleases());
+  RETURN_NOT_OK(SendSealManyRequest(store_conn_, object_ids, digests));
+  // Release the references taken by Create(), as in Seal() for one object.
+  return Release(object_ids);
+}
+
 Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
   auto object_entry = objects_in_use_.find(object_id);
   ARROW_CHECK(object_entry != objects_in_use_.end())
@@ -749,6 +988,7 @@ Status PlasmaClient::Impl::Abort(const ObjectID& object_id) {
   }
 
   // Send the abort request.
+  RETURN_NOT_OK(FlushReleases());
   RETURN_NOT_OK(SendAbortRequest(store_conn_, object_id));
   // Decrease the reference count to zero, then remove the object.
   object_entry->second->count--;
@@ -772,6 +1012,7 @@ Status PlasmaClient::Impl::Delete(const std::vector<ObjectID>& object_ids) {
     }
   }
   if (not_in_use_ids.size() > 0) {
+    RETURN_NOT_OK(FlushReleases());
     RETURN_NOT_OK(SendDeleteRequest(store_conn_, not_in_use_ids));
     std::vector<uint8_t> buffer;
     RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaDeleteReply, &buffer));
@@ -786,6 +1027,7 @@ Status PlasmaClient::Impl::Delete(const std::vector<ObjectID>& object_ids) {
 
 Status PlasmaClient::Impl::Evict(int64_t num_bytes, int64_t& num_bytes_evicted) {
   // Send a request to the store to evict objects.
+  RETURN_NOT_OK(FlushReleases());
   RETURN_NOT_OK(SendEvictRequest(store_conn_, num_bytes));
   // Wait for a response with the number of bytes actually evicted.
   std::vector<uint8_t> buffer;
@@ -809,7 +1051,7 @@ Status PlasmaClient::Impl::Hash(const ObjectID& object_id, uint8_t* digest) {
   return Status::OK();
 }
 
-Status PlasmaClient::Impl::Subscribe(int* fd) {
+Status PlasmaClient::Impl::Subscribe(int* fd, bool batched) {
   int sock[2];
   // Create a non-blocking socket pair. This will only be used to send
   // notifications from the Plasma store to the client.
@@ -818,7 +1060,8 @@ Status PlasmaClient::Impl::Subscribe(int* fd) {
   int flags = fcntl(sock[1], F_GETFL, 0);
   ARROW_CHECK(fcntl(sock[1], F_SETFL, flags | O_NONBLOCK) == 0);
   // Tell the Plasma store about the subscription.
-  RETURN_NOT_OK(SendSubscribeRequest(store_conn_));
+  RETURN_NOT_OK(FlushReleases());
+  RETURN_NOT_OK(SendSubscribeRequest(store_conn_, batched));
   // Send the file descriptor that the Plasma store should use to push
   // notifications about sealed objects to this client.
   ARROW_CHECK(send_fd(store_conn_, sock[1]) >= 0);
@@ -826,6 +1069,9 @@ Status PlasmaClient::Impl::Subscribe(int* fd) {
   // Return the file descriptor that the client should use to read notifications
   // about sealed objects.
   *fd = sock[0];
+  if (batched) {
+    notification_batches_[*fd].clear();
+  }
   return Status::OK();
 }
 
@@ -845,13 +1091,60 @@ Status PlasmaClient::Impl::DecodeNotification(const uint8_t* buffer, ObjectID* o
   return Status::OK();
 }
 
+Status PlasmaClient::Impl::DecodeNotifications(const uint8_t* buffer,
+                                               std::vector<ObjectID>* object_ids,
+                                               std::vector<int64_t>* data_sizes,
+                                               std::vector<int64_t>* metadata_sizes) {
+  auto batch = flatbuffers::GetRoot<fb::ObjectInfoBatch>(buffer);
+  object_ids->clear();
+  data_sizes->clear();
+  metadata_sizes->clear();
+  for (const auto object_info : *batch->objects()) {
+    ARROW_CHECK(object_info->object_id()->size() == sizeof(ObjectID));
+    object_ids->push_back(ObjectID::from_binary(object_info->object_id()->str()));
+    if (object_info->is_deletion()) {
+      data_sizes->push_back(-1);
+      metadata_sizes->push_back(-1);
+    } else {
+      data_sizes->push_back(object_info->data_size());
+      metadata_sizes->push_back(object_info->metadata_size());
+    }
+  }
+  return Status::OK();
+}
+
 Status PlasmaClient::Impl::GetNotification(int fd, ObjectID* object_id,
                                            int64_t* data_size, int64_t* metadata_size) {
-  auto notification = ReadMessageAsync(fd);
-  if (notification == NULL) {
-    return Status::IOError("Failed to read object notification from Plasma socket");
+  auto it = notification_batches_.find(fd);
+  if (it == notification_batches_.end()) {
+    auto notification = ReadMessageAsync(fd);
+    if (notification == NULL) {
+      return Status::IOError("Failed to read object notification from Plasma socket");
+    }
+    return DecodeNotification(notification.get(), object_id, data_size, metadata_size);
   }
-  return DecodeNotification(notification.get(), object_id, data_size, metadata_size);
+  std::deque<Notification>& pending = it->second;
+  while (pending.empty()) {
+    auto notification = ReadMessageAsync(fd);
+    if (notification == NULL) {
+      // ReadMessageAsync closed the socket.
+      notification_batches_.erase(it);
+      return Status::IOError("Failed to read object notification from Plasma socket");
+    }
+    std::vector<ObjectID> object_ids;
+    std::vector<int64_t> data_sizes;
+    std::vector<int64_t> metadata_sizes;
+    RETURN_NOT_OK(DecodeNotifications(notification.get(), &object_ids, &data_sizes,
+                                      &metadata_sizes));
+    for (size_t i = 0; i < object_ids.size(); ++i) {
+      pending.push_back({object_ids[i], data_sizes[i], metadata_sizes[i]});
+    }
+  }
+  *object_id = pending.front().object_id;
+  *data_size = pending.front().data_size;
+  *metadata_size = pending.front().metadata_size;
+  pending.pop_front();
+  return Status::OK();
 }
 
 Status PlasmaClient::Impl::Connect(const std::string& store_socket_name,
@@ -869,7 +1162,19 @@ Status PlasmaClient::Impl::Connect(const std::string& store_socket_name,
   RETURN_NOT_OK(SendConnectRequest(store_conn_));
   std::vector<uint8_t> buffer;
   RETURN_NOT_OK(PlasmaReceive(store_conn_, MessageType::PlasmaConnectReply, &buffer));
-  RETURN_NOT_OK(ReadConnectReply(buffer.data(), buffer.size(), &store_capacity_));
+  int directory_store_fd;
+  int64_t directory_mmap_size;
+  int64_t directory_offset;
+  int64_t directory_capacity;
+  RETURN_NOT_OK(ReadConnectReply(buffer.data(), buffer.size(), &store_capacity_,
+                                 &directory_store_fd, &directory_mmap_size,
+                                 &directory_offset, &directory_capacity));
+  if (directory_store_fd != -1) {
+    int fd = GetStoreFd(directory_store_fd);
+    uint8_t* pointer = LookupOrMmap(fd, directory_store_fd, directory_mmap_size);
+    object_directory_.reset(
+        new ObjectDirectory(pointer + directory_offset, directory_capacity));
+  }
   return Status::OK();
 }
 
@@ -882,6 +1187,8 @@ Status PlasmaClient::Impl::Disconnect() {
   // that were in use by us when handling the SIGPIPE.
   close(store_conn_);
   store_conn_ = -1;
+  pending_releases_.clear();
+  object_directory_.reset();
   return Status::OK();
 }
 
@@ -901,8 +1208,17 @@ Status PlasmaClient::Connect(const std::string& store_socket_name,
 
 Status PlasmaClient::Create(const ObjectID& object_id, int64_t data_size,
                             const uint8_t* metadata, int64_t metadata_size,
-                            std::shared_ptr<Buffer>* data, int device_num) {
-  return impl_->Create(object_id, data_size, metadata, metadata_size, data, device_num);
+                            std::shared_ptr<Buffer>* data, int device_num,
+                            int64_t priority) {
+  return impl_->Create(object_id, data_size, metadata, metadata_size, data, device_num,
+                       priority);
+}
+
+Status PlasmaClient::Create(const std::vector<ObjectID>& object_ids,
+                            const std::vector<int64_t>& data_sizes,
+                            const std::vector<std::string>& metadata,
+                            std::vector<std::shared_ptr<Buffer>>* data) {
+  return impl_->Create(object_ids, data_sizes, metadata, data);
 }
 
 Status PlasmaClient::CreateAndSeal(const ObjectID& object_id, const std::string& data,
@@ -924,16 +1240,38 @@ Status PlasmaClient::Release(const ObjectID& object_id) {
   return impl_->Release(object_id);
 }
 
+Status PlasmaClient::Release(const std::vector<ObjectID>& object_ids) {
+  return impl_->Release(object_ids);
+}
+
+Status PlasmaClient::SetReleaseBatchSize(int64_t batch_size) {
+  return impl_->SetReleaseBatchSize(batch_size);
+}
+
+Status PlasmaClient::FlushReleases() { return impl_->FlushReleases(); }
+
+Status PlasmaClient::Prefetch(const std::vector<ObjectID>& object_ids) {
+  return impl_->Prefetch(object_ids);
+}
+
 Status PlasmaClient::Contains(const ObjectID& object_id, bool* has_object) {
   return impl_->Contains(object_id, has_object);
 }
 
 Status PlasmaClient::List(ObjectTable* objects) { return impl_->List(objects); }
 
+Status PlasmaClient::Metrics(PlasmaStoreMetrics* metrics) {
+  return impl_->Metrics(metrics);
+}
+
 Status PlasmaClient::Abort(const ObjectID& object_id) { return impl_->Abort(object_id); }
 
 Status PlasmaClient::Seal(const ObjectID& object_id) { return impl_->Seal(object_id); }
 
+Status PlasmaClient::Seal(const std::vector<ObjectID>& object_ids) {
+  return impl_->Seal(object_ids);
+}
+
 Status PlasmaClient::Delete(const ObjectID& object_id) {
   return impl_->Delete(std::vector<ObjectID>{object_id});
 }
@@ -950,7 +1288,11 @@ Status PlasmaClient::Hash(const ObjectID& object_id, uint8_t* digest) {
   return impl_->Hash(object_id, digest);
 }
 
-Status PlasmaClient::Subscribe(int* fd) { return impl_->Subscribe(fd); }
+Status PlasmaClient::Subscribe(int* fd) { return impl_->Subscribe(fd, false); }
+
+Status PlasmaClient::Subscribe(int* fd, bool batched) {
+  return impl_->Subscribe(fd, batched);
+}
 
 Status PlasmaClient::GetNotification(int fd, ObjectID* object_id, int64_t* data_size,
                                      int64_t* metadata_size) {
@@ -962,6 +1304,13 @@ Status PlasmaClient::DecodeNotification(const uint8_t* buffer, ObjectID* object_
   return impl_->DecodeNotification(buffer, object_id, data_size, metadata_size);
 }
 
+Status PlasmaClient::DecodeNotifications(const uint8_t* buffer,
+                                         std::vector<ObjectID>* object_ids,
+                                         std::vector<int64_t>* data_sizes,
+                                         std::vector<int64_t>* metadata_sizes) {
+  return impl_->DecodeNotifications(buffer, object_ids, data_sizes, metadata_sizes);
+}
+
 Status PlasmaClient::Disconnect() { return impl_->Disconnect(); }
 
 bool PlasmaClient::IsInUse(const ObjectID& object_id) {
@@ -28,6 +28,7 @@
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 #include "plasma/common.h"
+#include "plasma/metrics.h"
 
 using arrow::Buffer;
 using arrow::Status;
@@ -42,6 +43,10 @@ struct ObjectBuffer {
   std::shared_ptr<Buffer> metadata;
   /// The device number.
   int device_num;
+  /// The NUMA node of the memory of the buffers, or -1 if it is unknown. The
+  /// store returns copies of objects on the node of the calling thread where
+  /// it has them.
+  int numa_node;
 };
 
 class ARROW_EXPORT PlasmaClient {
@@ -83,12 +88,35 @@ class ARROW_EXPORT PlasmaClient {
   ///        device_num = 0 corresponds to the host,
   ///        device_num = 1 corresponds to GPU0,
   ///        device_num = 2 corresponds to GPU1, etc.
+  /// \param priority A hint for the eviction policy of the store, which may
+  ///        keep objects of higher priority longer, for instance because
+  ///        they are more costly to recreate. Only the "gds" policy uses it.
   /// \return The return status.
   ///
   /// The returned object must be released once it is done with.  It must also
   /// be either sealed or aborted.
   Status Create(const ObjectID& object_id, int64_t data_size, const uint8_t* metadata,
-                int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0);
+                int64_t metadata_size, std::shared_ptr<Buffer>* data, int device_num = 0,
+                int64_t priority = 0);
+
+  /// Create several objects on the host with a single request to the Plasma
+  /// Store. Either all of the objects are created or, if one of them cannot
+  /// be, none of them is.
+  ///
+  /// \param object_ids The IDs to use for the newly created objects.
+  /// \param data_sizes The sizes in bytes of the space to be allocated for the
+  ///        objects' data, in the same order as their IDs.
+  /// \param metadata The objects' metadata, in the same order as their IDs.
+  /// \param[out] data The newly created objects, in the same order as their
+  ///        IDs.
+  /// \return The return status.
+  ///
+  /// As with Create(), each object must be released once it is done with and
+  /// be either sealed or aborted.
+  Status Create(const std::vector<ObjectID>& object_ids,
+                const std::vector<int64_t>& data_sizes,
+                const std::vector<std::string>& metadata,
+                std::vector<std::shared_ptr<Buffer>>* data);
 
   /// Create and seal an object in the object store. This is an optimization
   /// which allows small objects to be created quickly with fewer messages to
@@ -141,6 +169,36 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Release(const ObjectID& object_id);
 
+  /// Tell Plasma that the client no longer needs several objects, with a
+  /// single message to the store.
+  ///
+  /// \param object_ids The IDs of the objects that are no longer needed.
+  /// \return The return status.
+  Status Release(const std::vector<ObjectID>& object_ids);
+
+  /// Send the releases of objects to the store in batches. Until a batch is
+  /// full, the store still considers the released objects in use, so they
+  /// cannot be evicted. Pending releases are also sent before any other
+  /// request of this client and by FlushReleases().
+  ///
+  /// \param batch_size The number of releases sent in one message. The
+  ///        default of 1 sends each release right away.
+  /// \return The return status.
+  Status SetReleaseBatchSize(int64_t batch_size);
+
+  /// Send the pending releases of objects to the store.
+  ///
+  /// \return The return status.
+  Status FlushReleases();
+
+  /// Hint that objects are about to be gotten. The store starts restoring
+  /// those it evicted to its external store, so that a later Get() waits less
+  /// for them. This does not wait for the store to do so.
+  ///
+  /// \param object_ids The IDs of the objects to restore.
+  /// \return The return status.
+  Status Prefetch(const std::vector<ObjectID>& object_ids);
+
   /// Check if the object store contains a particular object and the object has
   /// been sealed. The result will be stored in has_object.
   ///
@@ -168,6 +226,15 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status List(ObjectTable* objects);
 
+  /// Get the metrics of the object store: counters such as of evictions and
+  /// bytes spilled, gauges such as of queued requests, notifications not sent
+  /// yet and free memory, and histograms of how long the store takes to
+  /// handle each type of request.
+  ///
+  /// \param[out] metrics The metrics.
+  /// \return The return status.
+  Status Metrics(PlasmaStoreMetrics* metrics);
+
   /// Abort an unsealed object in the object store. If the abort succeeds, then
   /// it will be as if the object was never created at all. The unsealed object
   /// must have only a single reference (the one that would have been removed by
@@ -185,6 +252,13 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Seal(const ObjectID& object_id);
 
+  /// Seal several objects in the object store with a single message to the
+  /// store. No object is sealed if one of them cannot be.
+  ///
+  /// \param object_ids The IDs of the objects to seal.
+  /// \return The return status.
+  Status Seal(const std::vector<ObjectID>& object_ids);
+
   /// Delete an object from the object store. This currently assumes that the
   /// object is present, has been sealed and not used by another client. Otherwise,
   /// it is a no operation.
@@ -231,6 +305,20 @@ class ARROW_EXPORT PlasmaClient {
   /// \return The return status.
   Status Subscribe(int* fd);
 
+  /// Subscribe to notifications when objects are sealed or deleted in the
+  /// object store, optionally in batches. The store then sends the
+  /// notifications of many objects in one message, which costs it and the
+  /// client less when objects are sealed at a high rate, and disconnects the
+  /// subscription if it falls too far behind. GetNotification still returns
+  /// them one at a time.
+  ///
+  /// \param fd Out parameter for the file descriptor the client should use to
+  ///        read notifications from the object store.
+  /// \param batched Whether to receive the notifications in batches, which
+  ///        must be read with GetNotification or DecodeNotifications.
+  /// \return The return status.
+  Status Subscribe(int* fd, bool batched);
+
   /// Receive next object notification for this client if Subscribe has been called.
   ///
   /// \param fd The file descriptor we are reading the notification from.
@@ -244,6 +332,19 @@ class ARROW_EXPORT PlasmaClient {
   Status DecodeNotification(const uint8_t* buffer, ObjectID* object_id,
                             int64_t* data_size, int64_t* metadata_size);
 
+  /// Decode a batch of notifications read from a batched subscription.
+  ///
+  /// \param buffer The message, without its length prefix.
+  /// \param object_ids Out parameter, the IDs of the objects sealed or deleted.
+  /// \param data_sizes Out parameter, the data sizes of the objects, which are
+  ///        -1 for deleted objects.
+  /// \param metadata_sizes Out parameter, the metadata sizes of the objects,
+  ///        which are -1 for deleted objects.
+  /// \return The return status.
+  Status DecodeNotifications(const uint8_t* buffer, std::vector<ObjectID>* object_ids,
+                             std::vector<int64_t>* data_sizes,
+                             std::vector<int64_t>* metadata_sizes);
+
   /// Disconnect from the local plasma instance, including the local store and
   /// manager.
   ///
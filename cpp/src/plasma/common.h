@@ -23,6 +23,7 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <vector>
 // TODO(pcm): Convert getopt and sscanf in the store to use more idiomatic C++
 // and get rid of the next three lines:
 #ifndef __STDC_FORMAT_MACROS
@@ -72,6 +73,12 @@ enum class ObjectState : int {
   PLASMA_SEALED = 2,
   /// Object is evicted to external store.
   PLASMA_EVICTED = 3,
+  /// Object is sealed and being written to the external store, after which its
+  /// memory is freed.
+  PLASMA_SPILLING = 4,
+  /// Object is being read back from the external store into memory allocated
+  /// for it.
+  PLASMA_RESTORING = 5,
 };
 
 namespace internal {
@@ -80,6 +87,21 @@ struct CudaIpcPlaceholder {};
 
 }  //  namespace internal
 
+/// A copy of a sealed object on another NUMA node than the object, which the
+/// store makes for objects that clients on that node get often.
+struct ObjectReplica {
+  /// The NUMA node of the copy.
+  int numa_node;
+  /// Memory mapped file containing the copy.
+  int fd;
+  /// Size of the underlying map.
+  int64_t map_size;
+  /// Offset from the base of the mmap.
+  ptrdiff_t offset;
+  /// Pointer to the copy of the data and metadata.
+  uint8_t* pointer;
+};
+
 /// This type is used by the Plasma store. It is here because it is exposed to
 /// the eviction policy.
 struct ObjectTableEntry {
@@ -97,12 +119,22 @@ struct ObjectTableEntry {
   ptrdiff_t offset;
   /// Pointer to the object data. Needed to free the object.
   uint8_t* pointer;
+  /// The NUMA node of the object data, or -1 if it is unknown.
+  int numa_node;
+  /// Copies of the object on other NUMA nodes, which are freed with it.
+  std::vector<ObjectReplica> replicas;
+  /// The number of times clients on each NUMA node without a copy got the
+  /// object, indexed by node.
+  std::vector<int64_t> remote_gets;
   /// Size of the object in bytes.
   int64_t data_size;
   /// Size of the object metadata in bytes.
   int64_t metadata_size;
   /// Number of clients currently using this object.
   int ref_count;
+  /// The priority the object was created with. Eviction policies may keep
+  /// objects of higher priority longer.
+  int64_t priority;
   /// Unix epoch of when this object was created.
   int64_t create_time;
   /// How long creation of this object took.
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/cuda_memory_pool.h"
+
+#include <algorithm>
+
+#include "arrow/util/logging.h"
+
+#include "plasma/arena_allocator.h"
+#include "plasma/plasma.h"
+
+namespace plasma {
+
+using arrow::Status;
+using arrow::cuda::CudaBuffer;
+using arrow::cuda::CudaContext;
+using arrow::cuda::CudaDeviceManager;
+using arrow::cuda::CudaIpcMemHandle;
+
+struct CudaMemoryPool::Region {
+  int device_num;
+  int64_t size;
+  /// The device memory, which is not freed once it was exported.
+  std::shared_ptr<CudaBuffer> buffer;
+  std::shared_ptr<CudaIpcMemHandle> ipc_handle;
+  std::unique_ptr<ArenaAllocator> arena;
+};
+
+std::map<const uint8_t*, std::unique_ptr<CudaMemoryPool::Region>>
+    CudaMemoryPool::regions_;
+int64_t CudaMemoryPool::region_size_ = int64_t(1) << 28;
+int64_t CudaMemoryPool::reserved_ = 0;
+int64_t CudaMemoryPool::allocated_ = 0;
+
+Status CudaMemoryPool::Allocate(int device_num, int64_t bytes, CudaAllocation* out) {
+  DCHECK_NE(device_num, 0);
+  // Take the memory from the first region of the device it fits in.
+  for (auto& entry : regions_) {
+    Region* region = entry.second.get();
+    if (region->device_num != device_num) {
+      continue;
+    }
+    void* pointer = region->arena->Allocate(kBlockSize, static_cast<size_t>(bytes));
+    if (pointer != nullptr) {
+      out->pointer = static_cast<uint8_t*>(pointer);
+      out->offset = out->pointer - entry.first;
+      out->ipc_handle = region->ipc_handle;
+      allocated_ += bytes;
+      return Status::OK();
+    }
+  }
+
+  CudaDeviceManager* manager;
+  RETURN_NOT_OK(CudaDeviceManager::GetInstance(&manager));
+  std::shared_ptr<CudaContext> context;
+  RETURN_NOT_OK(manager->GetContext(device_num - 1, &context));
+  std::unique_ptr<Region> region(new Region());
+  region->device_num = device_num;
+  region->size =
+      std::max(region_size_, (bytes + kBlockSize - 1) / kBlockSize * kBlockSize);
+  RETURN_NOT_OK(context->Allocate(region->size, &region->buffer));
+  RETURN_NOT_OK(region->buffer->ExportForIpc(&region->ipc_handle));
+  uint8_t* base = region->buffer->mutable_data();
+  region->arena.reset(new ArenaAllocator(base, region->size));
+  ARROW_LOG(DEBUG) << "Allocated a region of " << region->size << " bytes on GPU"
+                   << device_num - 1;
+  reserved_ += region->size;
+
+  void* pointer = region->arena->Allocate(kBlockSize, static_cast<size_t>(bytes));
+  ARROW_CHECK(pointer != nullptr);
+  out->pointer = static_cast<uint8_t*>(pointer);
+  out->offset = out->pointer - base;
+  out->ipc_handle = region->ipc_handle;
+  allocated_ += bytes;
+  regions_.emplace(base, std::move(region));
+  return Status::OK();
+}
+
+void CudaMemoryPool::Free(void* pointer, int64_t bytes) {
+  if (pointer == nullptr) {
+    return;
+  }
+  auto it = regions_.upper_bound(static_cast<const uint8_t*>(pointer));
+  ARROW_CHECK(it != regions_.begin()) << "The memory is not from a region";
+  --it;
+  ARROW_CHECK(static_cast<const uint8_t*>(pointer) < it->first + it->second->size)
+      << "The memory is not from a region";
+  it->second->arena->Free(pointer, static_cast<size_t>(bytes));
+  allocated_ -= bytes;
+}
+
+void CudaMemoryPool::SetRegionSize(int64_t bytes) { region_size_ = bytes; }
+
+int64_t CudaMemoryPool::GetReserved() { return reserved_; }
+
+int64_t CudaMemoryPool::GetAllocated() { return allocated_; }
+
+}  // namespace plasma
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_CUDA_MEMORY_POOL_H
+#define PLASMA_CUDA_MEMORY_POOL_H
+
+#include <cstdint>
+#include <map>
+#include <memory>
+
+#include "arrow/gpu/cuda_api.h"
+#include "arrow/status.h"
+
+namespace plasma {
+
+/// The device memory of an object.
+struct CudaAllocation {
+  /// The device memory.
+  uint8_t* pointer = nullptr;
+  /// The offset of the memory in its region.
+  int64_t offset = 0;
+  /// The IPC handle of the whole region, which clients open once per process
+  /// for all of the objects in it.
+  std::shared_ptr<arrow::cuda::CudaIpcMemHandle> ipc_handle;
+};
+
+/// Allocates the device memory of GPU objects from large regions, instead of
+/// allocating and exporting device memory for each object, which takes
+/// milliseconds. The regions are exported for IPC when they are allocated
+/// and kept for the life of the store, since clients keep their handles open.
+/// An object larger than the region size gets a region of its own, which is
+/// reused for other objects once it is freed.
+class CudaMemoryPool {
+ public:
+  /// Allocate device memory for an object.
+  ///
+  /// \param device_num The device, where 1 is GPU0, 2 is GPU1 and so on.
+  /// \param bytes The number of bytes.
+  /// \param[out] out The memory.
+  /// \return The status of allocating a new region, if that was needed.
+  static arrow::Status Allocate(int device_num, int64_t bytes, CudaAllocation* out);
+
+  /// Free memory returned by Allocate().
+  ///
+  /// \param pointer The device memory.
+  /// \param bytes The number of bytes that were allocated.
+  static void Free(void* pointer, int64_t bytes);
+
+  /// Set the size of the regions allocated from then on.
+  ///
+  /// \param bytes The region size in bytes.
+  static void SetRegionSize(int64_t bytes);
+
+  /// \return The number of bytes of device memory in regions.
+  static int64_t GetReserved();
+
+  /// \return The number of bytes of device memory allocated to objects.
+  static int64_t GetAllocated();
+
+ private:
+  struct Region;
+
+  /// The regions by their base address.
+  static std::map<const uint8_t*, std::unique_ptr<Region>> regions_;
+  static int64_t region_size_;
+  static int64_t reserved_;
+  static int64_t allocated_;
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_CUDA_MEMORY_POOL_H
@@ -18,9 +18,13 @@
 #ifndef PLASMA_EVENTS
 #define PLASMA_EVENTS
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 struct aeEventLoop;
 
@@ -88,6 +92,18 @@ class EventLoop {
   /// \return The ae.c error code. TODO(pcm): needs to be standardized
   int RemoveTimer(int64_t timer_id);
 
+  /// Run a task on the thread running the event loop. Unlike the other
+  /// methods, this one may be called from any thread.
+  ///
+  /// \param task The task, run on the next iteration of the loop after the
+  ///        tasks posted before it.
+  void Post(const std::function<void()>& task);
+
+  /// Check if the calling thread is the one running the event loop.
+  ///
+  /// \return False if the event loop is not running.
+  bool IsLoopThread() const;
+
   /// \brief Run the event loop.
   void Start();
 
@@ -101,7 +117,14 @@ class EventLoop {
 
   static int TimerEventCallback(aeEventLoop* loop, TimerID timer_id, void* context);
 
+  void RunPostedTasks();
+
   aeEventLoop* loop_;
+  std::atomic<std::thread::id> thread_id_;
+  /// Pipe written to wake the loop up when tasks are posted.
+  int wakeup_fds_[2];
+  std::mutex posted_tasks_mutex_;
+  std::vector<std::function<void()>> posted_tasks_;
   std::unordered_map<int, std::unique_ptr<FileCallback>> file_callbacks_;
   std::unordered_map<int64_t, std::unique_ptr<TimerCallback>> timer_callbacks_;
 };
@@ -51,20 +51,21 @@ int64_t LRUCache::ChooseObjectsToEvict(int64_t num_bytes_required,
 
 EvictionPolicy::EvictionPolicy(PlasmaStoreInfo* store_info) : store_info_(store_info) {}
 
-int64_t EvictionPolicy::ChooseObjectsToEvict(int64_t num_bytes_required,
-                                             std::vector<ObjectID>* objects_to_evict) {
-  int64_t bytes_evicted =
-      cache_.ChooseObjectsToEvict(num_bytes_required, objects_to_evict);
-  // Update the LRU cache.
-  for (auto& object_id : *objects_to_evict) {
-    cache_.Remove(object_id);
+std::unique_ptr<EvictionPolicy> EvictionPolicy::Make(const std::string& name,
+                                                     PlasmaStoreInfo* store_info) {
+  if (name == "lru") {
+    return std::unique_ptr<EvictionPolicy>(new LRUEvictionPolicy(store_info));
+  } else if (name == "lru2") {
+    return std::unique_ptr<EvictionPolicy>(new LRUKEvictionPolicy(store_info, 2));
+  } else if (name == "gds") {
+    return std::unique_ptr<EvictionPolicy>(new GreedyDualSizeEvictionPolicy(store_info));
   }
-  return bytes_evicted;
+  return nullptr;
 }
 
-void EvictionPolicy::ObjectCreated(const ObjectID& object_id) {
+int64_t EvictionPolicy::ObjectSize(const ObjectID& object_id) const {
   auto entry = store_info_->objects[object_id].get();
-  cache_.Add(object_id, entry->data_size + entry->metadata_size);
+  return entry->data_size + entry->metadata_size;
 }
 
 bool EvictionPolicy::RequireSpace(int64_t size, std::vector<ObjectID>* objects_to_evict) {
@@ -78,29 +79,191 @@ bool EvictionPolicy::RequireSpace(int64_t size, std::vector<ObjectID>* objects_t
   ARROW_LOG(DEBUG) << "not enough space to create this object, so evicting objects";
   // Choose some objects to evict, and update the return pointers.
   int64_t num_bytes_evicted = ChooseObjectsToEvict(space_to_free, objects_to_evict);
+  PlasmaAllocatorStats stats;
+  PlasmaAllocator::GetStats(&stats);
   ARROW_LOG(INFO) << "There is not enough space to create this object, so evicting "
                   << objects_to_evict->size() << " objects to free up "
                   << num_bytes_evicted << " bytes. The number of bytes in use (before "
-                  << "this eviction) is " << PlasmaAllocator::Allocated() << ".";
+                  << "this eviction) is " << stats.allocated << ", and the largest "
+                  << "free block has " << stats.largest_free_block << " of the "
+                  << stats.free_bytes << " free bytes.";
   return num_bytes_evicted >= required_space && num_bytes_evicted > 0;
 }
 
-void EvictionPolicy::BeginObjectAccess(const ObjectID& object_id,
-                                       std::vector<ObjectID>* objects_to_evict) {
+// ----------------------------------------------------------------------
+// LRUEvictionPolicy
+
+LRUEvictionPolicy::LRUEvictionPolicy(PlasmaStoreInfo* store_info)
+    : EvictionPolicy(store_info) {}
+
+int64_t LRUEvictionPolicy::ChooseObjectsToEvict(int64_t num_bytes_required,
+                                                std::vector<ObjectID>* objects_to_evict) {
+  int64_t bytes_evicted =
+      cache_.ChooseObjectsToEvict(num_bytes_required, objects_to_evict);
+  // Update the LRU cache.
+  for (auto& object_id : *objects_to_evict) {
+    cache_.Remove(object_id);
+  }
+  return bytes_evicted;
+}
+
+void LRUEvictionPolicy::ObjectCreated(const ObjectID& object_id) {
+  cache_.Add(object_id, ObjectSize(object_id));
+}
+
+void LRUEvictionPolicy::BeginObjectAccess(const ObjectID& object_id,
+                                          std::vector<ObjectID>* objects_to_evict) {
   // If the object is in the LRU cache, remove it.
   cache_.Remove(object_id);
 }
 
-void EvictionPolicy::EndObjectAccess(const ObjectID& object_id,
-                                     std::vector<ObjectID>* objects_to_evict) {
-  auto entry = store_info_->objects[object_id].get();
+void LRUEvictionPolicy::EndObjectAccess(const ObjectID& object_id,
+                                        std::vector<ObjectID>* objects_to_evict) {
   // Add the object to the LRU cache.
-  cache_.Add(object_id, entry->data_size + entry->metadata_size);
+  cache_.Add(object_id, ObjectSize(object_id));
 }
 
-void EvictionPolicy::RemoveObject(const ObjectID& object_id) {
+void LRUEvictionPolicy::RemoveObject(const ObjectID& object_id) {
   // If the object is in the LRU cache, remove it.
   cache_.Remove(object_id);
 }
 
+// ----------------------------------------------------------------------
+// LRUKEvictionPolicy
+
+LRUKEvictionPolicy::LRUKEvictionPolicy(PlasmaStoreInfo* store_info, int k)
+    : EvictionPolicy(store_info), k_(k), clock_(0) {
+  ARROW_CHECK(k_ > 0);
+}
+
+LRUKEvictionPolicy::EvictionKey LRUKEvictionPolicy::Key(const History& history) const {
+  bool used_k_times = static_cast<int>(history.uses.size()) == k_;
+  int64_t kth_use = used_k_times ? history.uses.front() : -1;
+  int64_t last_use = history.uses.empty() ? history.created : history.uses.back();
+  return EvictionKey(kth_use, last_use);
+}
+
+void LRUKEvictionPolicy::PruneHistories() {
+  for (auto it = histories_.begin(); it != histories_.end();) {
+    if (store_info_->objects.count(it->first) == 0) {
+      it = histories_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void LRUKEvictionPolicy::ObjectCreated(const ObjectID& object_id) {
+  // The store drops the objects that are deleted while in use without telling
+  // the eviction policy, which leaves their histories behind.
+  auto it = histories_.find(object_id);
+  if (it != histories_.end()) {
+    ARROW_CHECK(!it->second.unused);
+    histories_.erase(it);
+  } else if (histories_.size() > 2 * store_info_->objects.size() + 16) {
+    PruneHistories();
+  }
+  History& history = histories_[object_id];
+  history.created = clock_++;
+  history.creating = true;
+  history.unused = true;
+  unused_objects_.emplace(Key(history), object_id);
+}
+
+void LRUKEvictionPolicy::BeginObjectAccess(const ObjectID& object_id,
+                                           std::vector<ObjectID>* objects_to_evict) {
+  auto it = histories_.find(object_id);
+  ARROW_CHECK(it != histories_.end() && it->second.unused);
+  History& history = it->second;
+  unused_objects_.erase(Key(history));
+  history.unused = false;
+  if (history.creating) {
+    history.creating = false;
+    return;
+  }
+  history.uses.push_back(clock_++);
+  if (static_cast<int>(history.uses.size()) > k_) {
+    history.uses.pop_front();
+  }
+}
+
+void LRUKEvictionPolicy::EndObjectAccess(const ObjectID& object_id,
+                                         std::vector<ObjectID>* objects_to_evict) {
+  auto it = histories_.find(object_id);
+  ARROW_CHECK(it != histories_.end() && !it->second.unused);
+  it->second.unused = true;
+  unused_objects_.emplace(Key(it->second), object_id);
+}
+
+int64_t LRUKEvictionPolicy::ChooseObjectsToEvict(
+    int64_t num_bytes_required, std::vector<ObjectID>* objects_to_evict) {
+  int64_t bytes_evicted = 0;
+  auto it = unused_objects_.begin();
+  while (bytes_evicted < num_bytes_required && it != unused_objects_.end()) {
+    objects_to_evict->push_back(it->second);
+    bytes_evicted += ObjectSize(it->second);
+    histories_.erase(it->second);
+    it = unused_objects_.erase(it);
+  }
+  return bytes_evicted;
+}
+
+void LRUKEvictionPolicy::RemoveObject(const ObjectID& object_id) {
+  auto it = histories_.find(object_id);
+  ARROW_CHECK(it != histories_.end() && it->second.unused);
+  unused_objects_.erase(Key(it->second));
+  histories_.erase(it);
+}
+
+// ----------------------------------------------------------------------
+// GreedyDualSizeEvictionPolicy
+
+GreedyDualSizeEvictionPolicy::GreedyDualSizeEvictionPolicy(PlasmaStoreInfo* store_info)
+    : EvictionPolicy(store_info), inflation_(0), clock_(0) {}
+
+void GreedyDualSizeEvictionPolicy::AddUnusedObject(const ObjectID& object_id) {
+  auto entry = store_info_->objects[object_id].get();
+  double cost = 1.0 + static_cast<double>(std::max<int64_t>(entry->priority, 0));
+  double size =
+      static_cast<double>(std::max<int64_t>(entry->data_size + entry->metadata_size, 1));
+  EvictionKey key(inflation_ + cost / size, clock_++);
+  ARROW_CHECK(keys_.emplace(object_id, key).second);
+  unused_objects_.emplace(key, object_id);
+}
+
+void GreedyDualSizeEvictionPolicy::ObjectCreated(const ObjectID& object_id) {
+  AddUnusedObject(object_id);
+}
+
+void GreedyDualSizeEvictionPolicy::BeginObjectAccess(
+    const ObjectID& object_id, std::vector<ObjectID>* objects_to_evict) {
+  RemoveObject(object_id);
+}
+
+void GreedyDualSizeEvictionPolicy::EndObjectAccess(
+    const ObjectID& object_id, std::vector<ObjectID>* objects_to_evict) {
+  AddUnusedObject(object_id);
+}
+
+int64_t GreedyDualSizeEvictionPolicy::ChooseObjectsToEvict(
+    int64_t num_bytes_required, std::vector<ObjectID>* objects_to_evict) {
+  int64_t bytes_evicted = 0;
+  auto it = unused_objects_.begin();
+  while (bytes_evicted < num_bytes_required && it != unused_objects_.end()) {
+    objects_to_evict->push_back(it->second);
+    bytes_evicted += ObjectSize(it->second);
+    inflation_ = it->first.first;
+    keys_.erase(it->second);
+    it = unused_objects_.erase(it);
+  }
+  return bytes_evicted;
+}
+
+void GreedyDualSizeEvictionPolicy::RemoveObject(const ObjectID& object_id) {
+  auto it = keys_.find(object_id);
+  ARROW_CHECK(it != keys_.end());
+  unused_objects_.erase(it->second);
+  keys_.erase(it);
+}
+
 }  // namespace plasma
@@ -18,7 +18,11 @@
 #ifndef PLASMA_EVICTION_POLICY_H
 #define PLASMA_EVICTION_POLICY_H
 
+#include <deque>
 #include <list>
+#include <map>
+#include <memory>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -55,7 +59,8 @@ class LRUCache {
   std::unordered_map<ObjectID, ItemList::iterator> item_map_;
 };
 
-/// The eviction policy.
+/// The eviction policy. Implementations keep track of the objects that are
+/// not in use, and choose which of them to evict when the store needs space.
 class EvictionPolicy {
  public:
   /// Construct an eviction policy.
@@ -64,13 +69,32 @@ class EvictionPolicy {
   ///        to the eviction policy.
   explicit EvictionPolicy(PlasmaStoreInfo* store_info);
 
+  virtual ~EvictionPolicy() = default;
+
+  /// Create an eviction policy by name:
+  ///  - "lru" evicts the least recently used objects first.
+  ///  - "lru2" evicts the objects whose second to last use is the oldest
+  ///    first (LRU-K with K = 2), so that objects used once are evicted
+  ///    before objects used repeatedly.
+  ///  - "gds" evicts the objects of lowest priority per byte first, aged as
+  ///    in GreedyDual-Size, so that large objects are evicted before small
+  ///    ones that were used as recently and objects created with a higher
+  ///    priority are kept longer.
+  ///
+  /// @param name The name of the eviction policy.
+  /// @param store_info Information about the Plasma store that is exposed
+  ///        to the eviction policy.
+  /// @return The eviction policy, or null if there is none of this name.
+  static std::unique_ptr<EvictionPolicy> Make(const std::string& name,
+                                              PlasmaStoreInfo* store_info);
+
   /// This method will be called whenever an object is first created in order to
-  /// add it to the LRU cache. This is done so that the first time, the Plasma
-  /// store calls begin_object_access, we can remove the object from the LRU
-  /// cache.
+  /// add it to the unused objects. This is done so that the first time, the
+  /// Plasma store calls begin_object_access, we can remove the object from the
+  /// unused objects.
   ///
   /// @param object_id The object ID of the object that was created.
-  void ObjectCreated(const ObjectID& object_id);
+  virtual void ObjectCreated(const ObjectID& object_id) = 0;
 
   /// This method will be called when the Plasma store needs more space, perhaps
   /// to create a new object. When this method is called, the eviction
@@ -92,8 +116,8 @@ class EvictionPolicy {
   /// @param object_id The ID of the object that is now being used.
   /// @param objects_to_evict The object IDs that were chosen for eviction will
   ///        be stored into this vector.
-  void BeginObjectAccess(const ObjectID& object_id,
-                         std::vector<ObjectID>* objects_to_evict);
+  virtual void BeginObjectAccess(const ObjectID& object_id,
+                                 std::vector<ObjectID>* objects_to_evict) = 0;
 
   /// This method will be called whenever an object in the Plasma store that was
   /// being used is no longer being used. When this method is called, the
@@ -103,8 +127,8 @@ class EvictionPolicy {
   /// @param object_id The ID of the object that is no longer being used.
   /// @param objects_to_evict The object IDs that were chosen for eviction will
   ///        be stored into this vector.
-  void EndObjectAccess(const ObjectID& object_id,
-                       std::vector<ObjectID>* objects_to_evict);
+  virtual void EndObjectAccess(const ObjectID& object_id,
+                               std::vector<ObjectID>* objects_to_evict) = 0;
 
   /// Choose some objects to evict from the Plasma store. When this method is
   /// called, the eviction policy will assume that the objects chosen to be
@@ -117,21 +141,131 @@ class EvictionPolicy {
   /// @param objects_to_evict The object IDs that were chosen for eviction will
   ///        be stored into this vector.
   /// @return The total number of bytes of space chosen to be evicted.
-  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
-                               std::vector<ObjectID>* objects_to_evict);
+  virtual int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                                       std::vector<ObjectID>* objects_to_evict) = 0;
 
   /// This method will be called when an object is going to be removed
   ///
   /// @param object_id The ID of the object that is now being used.
-  void RemoveObject(const ObjectID& object_id);
+  virtual void RemoveObject(const ObjectID& object_id) = 0;
+
+ protected:
+  /// The size in bytes of an object, including both data and metadata.
+  int64_t ObjectSize(const ObjectID& object_id) const;
 
- private:
   /// Pointer to the plasma store info.
   PlasmaStoreInfo* store_info_;
+};
+
+/// Evict the least recently used objects first.
+class LRUEvictionPolicy : public EvictionPolicy {
+ public:
+  explicit LRUEvictionPolicy(PlasmaStoreInfo* store_info);
+
+  void ObjectCreated(const ObjectID& object_id) override;
+
+  void BeginObjectAccess(const ObjectID& object_id,
+                         std::vector<ObjectID>* objects_to_evict) override;
+
+  void EndObjectAccess(const ObjectID& object_id,
+                       std::vector<ObjectID>* objects_to_evict) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void RemoveObject(const ObjectID& object_id) override;
+
+ private:
   /// Datastructure for the LRU cache.
   LRUCache cache_;
 };
 
+/// Evict the objects whose k-th most recent use is the oldest first. Objects
+/// used fewer than k times are evicted before the others, least recently
+/// used first. The access of the client creating an object is not a use.
+class LRUKEvictionPolicy : public EvictionPolicy {
+ public:
+  LRUKEvictionPolicy(PlasmaStoreInfo* store_info, int k);
+
+  void ObjectCreated(const ObjectID& object_id) override;
+
+  void BeginObjectAccess(const ObjectID& object_id,
+                         std::vector<ObjectID>* objects_to_evict) override;
+
+  void EndObjectAccess(const ObjectID& object_id,
+                       std::vector<ObjectID>* objects_to_evict) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void RemoveObject(const ObjectID& object_id) override;
+
+ private:
+  /// The position of an object in the eviction order: the time of its k-th
+  /// most recent use, or -1 if it was used fewer than k times, and the time of
+  /// its most recent use or of its creation, which is unique.
+  typedef std::pair<int64_t, int64_t> EvictionKey;
+
+  struct History {
+    /// The times of the k most recent uses of the object, oldest first.
+    std::deque<int64_t> uses;
+    /// The time the object was created.
+    int64_t created;
+    /// Whether the next access to the object is that of its creator.
+    bool creating;
+    /// Whether the object is unused, and thus in unused_objects_.
+    bool unused;
+  };
+
+  EvictionKey Key(const History& history) const;
+
+  /// Drop the histories of the objects that are no longer in the store.
+  void PruneHistories();
+
+  int k_;
+  /// A logical clock, ticking at every creation and use of an object.
+  int64_t clock_;
+  std::unordered_map<ObjectID, History> histories_;
+  /// The unused objects in eviction order.
+  std::map<EvictionKey, ObjectID> unused_objects_;
+};
+
+/// Evict the objects of lowest credit first. An object gets a credit of
+/// (1 + priority) / size, on top of the credit of the last object evicted,
+/// every time it stops being used. The latter ages the objects that were not
+/// used in a while, as in the GreedyDual-Size algorithm.
+class GreedyDualSizeEvictionPolicy : public EvictionPolicy {
+ public:
+  explicit GreedyDualSizeEvictionPolicy(PlasmaStoreInfo* store_info);
+
+  void ObjectCreated(const ObjectID& object_id) override;
+
+  void BeginObjectAccess(const ObjectID& object_id,
+                         std::vector<ObjectID>* objects_to_evict) override;
+
+  void EndObjectAccess(const ObjectID& object_id,
+                       std::vector<ObjectID>* objects_to_evict) override;
+
+  int64_t ChooseObjectsToEvict(int64_t num_bytes_required,
+                               std::vector<ObjectID>* objects_to_evict) override;
+
+  void RemoveObject(const ObjectID& object_id) override;
+
+ private:
+  /// The credit of an object and the time it became unused, which is unique.
+  typedef std::pair<double, int64_t> EvictionKey;
+
+  void AddUnusedObject(const ObjectID& object_id);
+
+  /// The credit of the last object evicted.
+  double inflation_;
+  /// A logical clock, ticking every time an object becomes unused.
+  int64_t clock_;
+  std::unordered_map<ObjectID, EvictionKey> keys_;
+  /// The unused objects in eviction order.
+  std::map<EvictionKey, ObjectID> unused_objects_;
+};
+
 }  // namespace plasma
 
 #endif  // PLASMA_EVICTION_POLICY_H
@@ -53,7 +53,8 @@ class ExternalStore {
   virtual Status Connect(const std::string& endpoint) = 0;
 
   /// This method will be called whenever an object in the Plasma store needs
-  /// to be evicted to the external store.
+  /// to be evicted to the external store. It is called from background
+  /// threads, possibly concurrently with other calls of Put() and Get().
   ///
   /// This API is experimental and might change in the future.
   ///
@@ -64,12 +65,13 @@ class ExternalStore {
                      const std::vector<std::shared_ptr<Buffer>>& data) = 0;
 
   /// This method will be called whenever an evicted object in the external
-  /// store store needs to be accessed.
+  /// store store needs to be accessed. It is called from background threads,
+  /// possibly concurrently with other calls of Put() and Get().
   ///
   /// This API is experimental and might change in the future.
   ///
   /// \param ids The IDs of the objects to get.
-  /// \param buffers List of buffers the data should be written to.
+  /// \param buffers List of buffers the data and metadata should be written to.
   /// \return The return status.
   virtual Status Get(const std::vector<ObjectID>& ids,
                      std::vector<std::shared_ptr<Buffer>> buffers) = 0;
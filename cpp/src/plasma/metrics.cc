@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/metrics.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace plasma {
+
+constexpr int LatencyHistogram::kNumBuckets;
+
+void LatencyHistogram::Record(int64_t micros) {
+  int bucket = 0;
+  while (bucket < kNumBuckets - 1 && micros >= (int64_t(1) << bucket)) {
+    ++bucket;
+  }
+  buckets[bucket] += 1;
+  count += 1;
+  total_micros += micros;
+  max_micros = std::max(max_micros, micros);
+}
+
+int64_t LatencyHistogram::Percentile(double fraction) const {
+  const double rank = fraction * static_cast<double>(count);
+  int64_t seen = 0;
+  for (int bucket = 0; bucket < kNumBuckets - 1; ++bucket) {
+    seen += buckets[bucket];
+    if (seen > 0 && static_cast<double>(seen) >= rank) {
+      return std::min(int64_t(1) << bucket, max_micros);
+    }
+  }
+  return max_micros;
+}
+
+int64_t PlasmaStoreMetrics::Value(const std::string& name) const {
+  for (const auto& value : values) {
+    if (value.first == name) {
+      return value.second;
+    }
+  }
+  return -1;
+}
+
+std::string PlasmaStoreMetrics::ToString() const {
+  std::stringstream ss;
+  for (const auto& value : values) {
+    ss << value.first << " " << value.second << "\n";
+  }
+  for (const auto& latency : latencies) {
+    const LatencyHistogram& histogram = latency.second;
+    if (histogram.count == 0) {
+      continue;
+    }
+    ss << latency.first << " count=" << histogram.count
+       << " mean_us=" << histogram.total_micros / histogram.count
+       << " p50_us=" << histogram.Percentile(0.5)
+       << " p99_us=" << histogram.Percentile(0.99) << " max_us=" << histogram.max_micros
+       << "\n";
+  }
+  return ss.str();
+}
+
+int64_t* MetricsRegistry::Value(const std::string& name) {
+  for (auto& value : values_) {
+    if (value.first == name) {
+      return &value.second;
+    }
+  }
+  values_.emplace_back(name, 0);
+  return &values_.back().second;
+}
+
+LatencyHistogram* MetricsRegistry::Latency(const std::string& name) {
+  for (auto& latency : latencies_) {
+    if (latency.first == name) {
+      return &latency.second;
+    }
+  }
+  latencies_.emplace_back(name, LatencyHistogram());
+  return &latencies_.back().second;
+}
+
+void MetricsRegistry::Snapshot(PlasmaStoreMetrics* metrics) const {
+  metrics->values.assign(values_.begin(), values_.end());
+  metrics->latencies.assign(latencies_.begin(), latencies_.end());
+}
+
+}  // namespace plasma
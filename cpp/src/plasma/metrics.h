@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_METRICS_H
+#define PLASMA_METRICS_H
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/visibility.h"
+
+namespace plasma {
+
+/// A histogram of latencies in microseconds, whose buckets are powers of two.
+struct ARROW_EXPORT LatencyHistogram {
+  static constexpr int kNumBuckets = 32;
+
+  /// Count a latency.
+  ///
+  /// \param micros The latency in microseconds.
+  void Record(int64_t micros);
+
+  /// Estimate a percentile of the latencies.
+  ///
+  /// \param fraction The fraction of latencies below the percentile, e.g. 0.99.
+  /// \return The upper bound of the bucket of the percentile in microseconds.
+  int64_t Percentile(double fraction) const;
+
+  /// The number of latencies of less than a microsecond in bucket 0, and of
+  /// less than 2^i but at least 2^(i-1) microseconds in bucket i. The last
+  /// bucket also counts all longer latencies.
+  std::array<int64_t, kNumBuckets> buckets = {};
+  /// The number of latencies.
+  int64_t count = 0;
+  /// The sum of the latencies in microseconds.
+  int64_t total_micros = 0;
+  /// The longest latency in microseconds.
+  int64_t max_micros = 0;
+};
+
+/// The metrics of a Plasma store at one point in time.
+struct ARROW_EXPORT PlasmaStoreMetrics {
+  /// Counters and the current values of gauges by name.
+  std::vector<std::pair<std::string, int64_t>> values;
+  /// Latency histograms by name.
+  std::vector<std::pair<std::string, LatencyHistogram>> latencies;
+
+  /// Get a value by name.
+  ///
+  /// \return The value, or -1 if there is none of that name.
+  int64_t Value(const std::string& name) const;
+
+  /// Print the values, and the request count, mean and percentiles of each
+  /// histogram, one per line.
+  std::string ToString() const;
+};
+
+/// The named counters, gauges and latency histograms of the store. Metrics
+/// are registered once and then updated through the pointer returned, which
+/// stays valid for the life of the registry, so that updating them costs no
+/// more than an addition. The registry is not thread-safe.
+class ARROW_EXPORT MetricsRegistry {
+ public:
+  /// Get a counter or gauge, registering it at zero if it is new.
+  int64_t* Value(const std::string& name);
+
+  /// Get a latency histogram, registering it if it is new.
+  LatencyHistogram* Latency(const std::string& name);
+
+  /// Copy the metrics, in the order they were registered.
+  void Snapshot(PlasmaStoreMetrics* metrics) const;
+
+ private:
+  std::deque<std::pair<std::string, int64_t>> values_;
+  std::deque<std::pair<std::string, LatencyHistogram>> latencies_;
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_METRICS_H
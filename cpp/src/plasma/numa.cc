@@ -0,0 +1,89 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/numa.h"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+namespace plasma {
+
+#ifdef __linux__
+
+namespace {
+
+/// The memory policy of mbind(2) that allocates pages only on the given
+/// nodes, from <numaif.h>, which we do not depend on.
+constexpr int kMpolBind = 2;
+
+}  // namespace
+
+int NumNumaNodes() {
+  int num_nodes = 0;
+  while (access(("/sys/devices/system/node/node" + std::to_string(num_nodes)).c_str(),
+                F_OK) == 0) {
+    ++num_nodes;
+  }
+  return num_nodes > 0 ? num_nodes : 1;
+}
+
+int CurrentNumaNode() {
+  unsigned int cpu;
+  unsigned int node;
+  if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+    return -1;
+  }
+  return static_cast<int>(node);
+}
+
+arrow::Status BindToNumaNode(void* address, size_t size, int numa_node) {
+  const uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  const uintptr_t start = reinterpret_cast<uintptr_t>(address);
+  const uintptr_t page_start = start / page_size * page_size;
+  const unsigned long kBitsPerWord = 8 * sizeof(unsigned long);  // NOLINT
+  std::vector<unsigned long> node_mask(numa_node / kBitsPerWord + 1, 0);  // NOLINT
+  node_mask[numa_node / kBitsPerWord] = 1UL << (numa_node % kBitsPerWord);
+  if (syscall(SYS_mbind, page_start, size + (start - page_start), kMpolBind,
+              node_mask.data(), node_mask.size() * kBitsPerWord + 1, 0) != 0) {
+    return arrow::Status::IOError("Failed to bind memory to NUMA node ", numa_node,
+                                  ": ", std::strerror(errno));
+  }
+  return arrow::Status::OK();
+}
+
+#else
+
+int NumNumaNodes() { return 1; }
+
+int CurrentNumaNode() { return -1; }
+
+arrow::Status BindToNumaNode(void* address, size_t size, int numa_node) {
+  return arrow::Status::NotImplemented("NUMA placement is only supported on Linux");
+}
+
+#endif
+
+}  // namespace plasma
@@ -0,0 +1,50 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_NUMA_H
+#define PLASMA_NUMA_H
+
+#include <cstddef>
+
+#include "arrow/status.h"
+
+namespace plasma {
+
+/// Get the number of NUMA nodes of the machine.
+///
+/// \return The number of nodes, 1 if the machine has no NUMA support.
+int NumNumaNodes();
+
+/// Get the NUMA node of the CPU the calling thread runs on. Threads may be
+/// moved between nodes, so this is a hint for placing memory.
+///
+/// \return The node, or -1 if it is unknown.
+int CurrentNumaNode();
+
+/// Make the pages of a region of memory be allocated on a NUMA node. This
+/// must be called before the pages are first touched.
+///
+/// \param address The start of the region, which is rounded down to a page.
+/// \param size The size of the region in bytes.
+/// \param numa_node The node.
+/// \return An error if the kernel refused, or on platforms without NUMA
+///         support.
+arrow::Status BindToNumaNode(void* address, size_t size, int numa_node);
+
+}  // namespace plasma
+
+#endif  // PLASMA_NUMA_H
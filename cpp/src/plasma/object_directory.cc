@@ -0,0 +1,173 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "plasma/object_directory.h"
+
+#include <cstring>
+
+#include "arrow/util/logging.h"
+
+namespace plasma {
+
+namespace {
+
+/// A slot that has never been used, which ends the probing for an object.
+constexpr uint64_t kSlotFree = 0;
+/// A slot whose fields are being written by the store.
+constexpr uint64_t kSlotWriting = 1;
+constexpr uint64_t kSlotSealed = 2;
+/// A slot whose object was removed, which the store may reuse.
+constexpr uint64_t kSlotRemoved = 3;
+
+constexpr int kStateShift = 62;
+constexpr int kGenerationShift = 32;
+constexpr uint64_t kGenerationMask = (1ULL << 30) - 1;
+
+/// The number of slots after the one an object hashes to that are probed for
+/// it. Objects that do not fit are not in the directory, and clients get
+/// them from the store.
+constexpr int64_t kMaxProbes = 64;
+
+uint64_t SlotState(uint64_t word) { return word >> kStateShift; }
+
+uint64_t SlotGeneration(uint64_t word) {
+  return (word >> kGenerationShift) & kGenerationMask;
+}
+
+uint64_t SlotPins(uint64_t word) { return word & 0xFFFFFFFFULL; }
+
+uint64_t SlotWord(uint64_t state, uint64_t generation, uint64_t pins) {
+  return (state << kStateShift) | (generation << kGenerationShift) | pins;
+}
+
+void ObjectIdWords(const ObjectID& object_id, uint64_t words[3]) {
+  words[0] = words[1] = words[2] = 0;
+  std::memcpy(words, object_id.data(), kUniqueIDSize);
+}
+
+}  // namespace
+
+int64_t ObjectDirectory::Size(int64_t capacity) {
+  return capacity * static_cast<int64_t>(sizeof(ObjectDirectorySlot));
+}
+
+ObjectDirectory::ObjectDirectory(uint8_t* slots, int64_t capacity)
+    : slots_(reinterpret_cast<ObjectDirectorySlot*>(slots)), capacity_(capacity) {
+  ARROW_CHECK(capacity_ > 0 && (capacity_ & (capacity_ - 1)) == 0)
+      << "The capacity of the object directory must be a power of two";
+}
+
+void ObjectDirectory::Insert(const ObjectID& object_id, const PlasmaObject& object) {
+  if (object.device_num != 0 || slot_indices_.count(object_id) > 0) {
+    return;
+  }
+  uint64_t id_words[3];
+  ObjectIdWords(object_id, id_words);
+  const uint64_t hash = object_id.hash();
+  for (int64_t probe = 0; probe < kMaxProbes && probe < capacity_; ++probe) {
+    const int64_t index = static_cast<int64_t>((hash + probe) & (capacity_ - 1));
+    ObjectDirectorySlot* slot = &slots_[index];
+    const uint64_t word = slot->word.load(std::memory_order_relaxed);
+    if (SlotState(word) != kSlotFree && SlotState(word) != kSlotRemoved) {
+      continue;
+    }
+    // Bumping the generation makes the clients that looked at the previous
+    // object of the slot fail to pin it.
+    const uint64_t generation = (SlotGeneration(word) + 1) & kGenerationMask;
+    slot->word.store(SlotWord(kSlotWriting, generation, 0), std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (int i = 0; i < 3; ++i) {
+      slot->object_id[i].store(id_words[i], std::memory_order_relaxed);
+    }
+    slot->store_fd.store(object.store_fd, std::memory_order_relaxed);
+    slot->numa_node.store(object.numa_node, std::memory_order_relaxed);
+    slot->data_offset.store(object.data_offset, std::memory_order_relaxed);
+    slot->data_size.store(object.data_size, std::memory_order_relaxed);
+    slot->metadata_size.store(object.metadata_size, std::memory_order_relaxed);
+    slot->word.store(SlotWord(kSlotSealed, generation, 0), std::memory_order_release);
+    slot_indices_[object_id] = index;
+    return;
+  }
+}
+
+bool ObjectDirectory::Remove(const ObjectID& object_id) {
+  auto it = slot_indices_.find(object_id);
+  if (it == slot_indices_.end()) {
+    return true;
+  }
+  ObjectDirectorySlot* slot = &slots_[it->second];
+  uint64_t word = slot->word.load(std::memory_order_acquire);
+  do {
+    if (SlotPins(word) != 0) {
+      return false;
+    }
+  } while (!slot->word.compare_exchange_weak(
+      word, SlotWord(kSlotRemoved, SlotGeneration(word), 0), std::memory_order_acq_rel,
+      std::memory_order_acquire));
+  slot_indices_.erase(it);
+  return true;
+}
+
+void ObjectDirectory::Unpin(const ObjectID& object_id) {
+  auto it = slot_indices_.find(object_id);
+  ARROW_CHECK(it != slot_indices_.end()) << "To unpin an object it must be pinned";
+  const uint64_t word = slots_[it->second].word.fetch_sub(1, std::memory_order_release);
+  ARROW_CHECK(SlotPins(word) > 0) << "To unpin an object it must be pinned";
+}
+
+bool ObjectDirectory::Pin(const ObjectID& object_id, PlasmaObject* object) {
+  uint64_t id_words[3];
+  ObjectIdWords(object_id, id_words);
+  const uint64_t hash = object_id.hash();
+  for (int64_t probe = 0; probe < kMaxProbes && probe < capacity_; ++probe) {
+    ObjectDirectorySlot* slot = &slots_[(hash + probe) & (capacity_ - 1)];
+    uint64_t word = slot->word.load(std::memory_order_acquire);
+    if (SlotState(word) == kSlotFree) {
+      return false;
+    }
+    if (SlotState(word) != kSlotSealed ||
+        slot->object_id[0].load(std::memory_order_relaxed) != id_words[0] ||
+        slot->object_id[1].load(std::memory_order_relaxed) != id_words[1] ||
+        slot->object_id[2].load(std::memory_order_relaxed) != id_words[2]) {
+      continue;
+    }
+    PlasmaObject found = {};
+    found.store_fd = slot->store_fd.load(std::memory_order_relaxed);
+    found.data_offset = slot->data_offset.load(std::memory_order_relaxed);
+    found.data_size = slot->data_size.load(std::memory_order_relaxed);
+    found.metadata_offset = found.data_offset + found.data_size;
+    found.metadata_size = slot->metadata_size.load(std::memory_order_relaxed);
+    found.device_num = 0;
+    found.numa_node = slot->numa_node.load(std::memory_order_relaxed);
+    // The fields read above are only those of object_id if the slot still has
+    // the generation it had before, which the compare-and-swap checks.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t generation = SlotGeneration(word);
+    while (SlotState(word) == kSlotSealed && SlotGeneration(word) == generation) {
+      if (slot->word.compare_exchange_weak(word, word + 1, std::memory_order_acq_rel,
+                                           std::memory_order_acquire)) {
+        *object = found;
+        return true;
+      }
+    }
+    // The object was removed while it was looked up.
+    return false;
+  }
+  return false;
+}
+
+}  // namespace plasma
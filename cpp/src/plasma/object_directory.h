@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef PLASMA_OBJECT_DIRECTORY_H
+#define PLASMA_OBJECT_DIRECTORY_H
+
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+
+#include "plasma/common.h"
+#include "plasma/plasma.h"
+
+namespace plasma {
+
+/// A slot of the object directory. Its fields are only written by the store
+/// while the slot is not sealed, and read by clients between loading and
+/// compare-and-swapping the state word.
+struct ObjectDirectorySlot {
+  /// The state of the slot in the top 2 bits, a generation bumped every time
+  /// the slot is reused in the next 30 bits and the pin count in the low 32.
+  std::atomic<uint64_t> word;
+  std::atomic<uint64_t> object_id[3];
+  std::atomic<int32_t> store_fd;
+  std::atomic<int32_t> numa_node;
+  std::atomic<int64_t> data_offset;
+  std::atomic<int64_t> data_size;
+  std::atomic<int64_t> metadata_size;
+};
+
+static_assert(sizeof(ObjectDirectorySlot) == kBlockSize,
+              "ObjectDirectorySlot must fill a cache line");
+
+/// A lock-free hash table of the sealed objects of the store, which the store
+/// keeps in its shared memory. Clients pin an object found in it with a
+/// compare-and-swap instead of a round trip to the store. The store then
+/// turns the pin into a reference of the client when it receives the
+/// client's PinRequest, so that it is released when the client disconnects.
+/// Pinned objects can be neither evicted nor deleted. Only the store writes
+/// objects to the directory.
+class ObjectDirectory {
+ public:
+  /// The number of bytes of shared memory that a directory of capacity slots
+  /// takes.
+  static int64_t Size(int64_t capacity);
+
+  /// \param slots The slots of the directory in shared memory, zeroed by the
+  ///        store before the directory is used.
+  /// \param capacity The number of slots, a power of two.
+  ObjectDirectory(uint8_t* slots, int64_t capacity);
+
+  /// Make a sealed object in host memory visible to clients. This is a no-op
+  /// if the object would not fit within the maximum probe count.
+  void Insert(const ObjectID& object_id, const PlasmaObject& object);
+
+  /// Remove an object, unless clients have pinned it.
+  ///
+  /// \return false if the object is pinned and was not removed.
+  bool Remove(const ObjectID& object_id);
+
+  /// Drop one pin of an object, once the store holds a reference for it.
+  void Unpin(const ObjectID& object_id);
+
+  /// Pin a sealed object and describe where it is. Called by clients.
+  ///
+  /// \return false if the object is not in the directory.
+  bool Pin(const ObjectID& object_id, PlasmaObject* object);
+
+ private:
+  ObjectDirectorySlot* slots_;
+  int64_t capacity_;
+  /// The slot of each object in the directory. Only maintained in the store.
+  std::unordered_map<ObjectID, int64_t> slot_indices_;
+};
+
+}  // namespace plasma
+
+#endif  // PLASMA_OBJECT_DIRECTORY_H
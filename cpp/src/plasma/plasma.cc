@@ -26,15 +26,29 @@
 #include "plasma/plasma_allocator.h"
 #include "plasma/protocol.h"
 
+#ifdef PLASMA_CUDA
+#include "plasma/cuda_memory_pool.h"
+#endif
+
 namespace fb = plasma::flatbuf;
 
 namespace plasma {
 
-ObjectTableEntry::ObjectTableEntry() : pointer(nullptr), ref_count(0) {}
+ObjectTableEntry::ObjectTableEntry()
+    : device_num(0), pointer(nullptr), numa_node(-1), ref_count(0), priority(0) {}
 
 ObjectTableEntry::~ObjectTableEntry() {
-  PlasmaAllocator::Free(pointer, data_size + metadata_size);
+  if (device_num != 0) {
+#ifdef PLASMA_CUDA
+    CudaMemoryPool::Free(pointer, data_size + metadata_size);
+#endif
+  } else {
+    PlasmaAllocator::Free(pointer, data_size + metadata_size);
+  }
   pointer = nullptr;
+  for (const auto& replica : replicas) {
+    PlasmaAllocator::Free(replica.pointer, data_size + metadata_size);
+  }
 }
 
 int WarnIfSigpipe(int status, int client_sock) {
@@ -62,10 +76,8 @@ int WarnIfSigpipe(int status, int client_sock) {
  * @return The object info buffer. It is the caller's responsibility to free
  *         this buffer with "delete" after it has been used.
  */
-std::unique_ptr<uint8_t[]> CreateObjectInfoBuffer(fb::ObjectInfoT* object_info) {
-  flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreateObjectInfo(fbb, object_info);
-  fbb.Finish(message);
+static std::unique_ptr<uint8_t[]> CopyNotification(
+    const flatbuffers::FlatBufferBuilder& fbb) {
   auto notification =
       std::unique_ptr<uint8_t[]>(new uint8_t[sizeof(int64_t) + fbb.GetSize()]);
   *(reinterpret_cast<int64_t*>(notification.get())) = fbb.GetSize();
@@ -73,6 +85,26 @@ std::unique_ptr<uint8_t[]> CreateObjectInfoBuffer(fb::ObjectInfoT* object_info)
   return notification;
 }
 
+std::unique_ptr<uint8_t[]> CreateObjectInfoBuffer(fb::ObjectInfoT* object_info) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreateObjectInfo(fbb, object_info);
+  fbb.Finish(message);
+  return CopyNotification(fbb);
+}
+
+std::unique_ptr<uint8_t[]> CreateObjectInfoBatchBuffer(
+    const std::vector<std::shared_ptr<fb::ObjectInfoT>>& object_infos) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<fb::ObjectInfo>> objects;
+  objects.reserve(object_infos.size());
+  for (const auto& object_info : object_infos) {
+    objects.push_back(fb::CreateObjectInfo(fbb, object_info.get()));
+  }
+  auto message = fb::CreateObjectInfoBatch(fbb, fbb.CreateVector(objects));
+  fbb.Finish(message);
+  return CopyNotification(fbb);
+}
+
 ObjectTableEntry* GetObjectTableEntry(PlasmaStoreInfo* store_info,
                                       const ObjectID& object_id) {
   auto it = store_info->objects.find(object_id);
@@ -31,6 +31,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "plasma/compat.h"
 
@@ -91,6 +92,8 @@ struct PlasmaObject {
   int64_t metadata_size;
   /// Device number object is on.
   int device_num;
+  /// The NUMA node of the memory of the object, or -1 if it is unknown.
+  int numa_node;
 };
 
 enum class ObjectStatus : int {
@@ -141,6 +144,14 @@ int WarnIfSigpipe(int status, int client_sock);
 
 std::unique_ptr<uint8_t[]> CreateObjectInfoBuffer(flatbuf::ObjectInfoT* object_info);
 
+/// Create a notification about several objects in the same format as
+/// CreateObjectInfoBuffer, whose message is an ObjectInfoBatch.
+///
+/// @param object_infos The object infos to be serialized, in order.
+/// @return The notification buffer.
+std::unique_ptr<uint8_t[]> CreateObjectInfoBatchBuffer(
+    const std::vector<std::shared_ptr<flatbuf::ObjectInfoT>>& object_infos);
+
 }  // namespace plasma
 
 #endif  // PLASMA_PLASMA_H
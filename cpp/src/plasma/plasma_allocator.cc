@@ -15,33 +15,90 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <sys/mman.h>
+
+#include <algorithm>
+
+#include <arrow/status.h>
 #include <arrow/util/logging.h>
 
+#include "plasma/arena_allocator.h"
 #include "plasma/malloc.h"
+#include "plasma/numa.h"
 #include "plasma/plasma_allocator.h"
 
 namespace plasma {
 
+using arrow::Status;
+
 extern "C" {
 void* dlmemalign(size_t alignment, size_t bytes);
 void dlfree(void* mem);
+void* fake_mmap(size_t);
 }
 
 int64_t PlasmaAllocator::footprint_limit_ = 0;
 int64_t PlasmaAllocator::allocated_ = 0;
+AllocatorBackend PlasmaAllocator::backend_ = AllocatorBackend::DLMALLOC;
+int PlasmaAllocator::num_numa_nodes_ = 1;
+std::vector<std::unique_ptr<ArenaAllocator>> PlasmaAllocator::arenas_;
+std::vector<std::pair<uint8_t*, int64_t>> PlasmaAllocator::arena_regions_;
 
-void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes) {
+void* PlasmaAllocator::Memalign(size_t alignment, size_t bytes, int numa_node) {
   if (allocated_ + static_cast<int64_t>(bytes) > footprint_limit_) {
     return nullptr;
   }
-  void* mem = dlmemalign(alignment, bytes);
-  ARROW_CHECK(mem);
+  void* mem = nullptr;
+  if (backend_ == AllocatorBackend::ARENA) {
+    if (arenas_.empty()) {
+      // Map all of the memory at once, so that clients map a single file per
+      // NUMA node.
+      const int64_t region_size = footprint_limit_ / num_numa_nodes_;
+      for (int node = 0; node < num_numa_nodes_; ++node) {
+        void* pointer = fake_mmap(static_cast<size_t>(region_size));
+        ARROW_CHECK(pointer != MAP_FAILED) << "Failed to map the memory of the arena";
+        if (num_numa_nodes_ > 1) {
+          // The pages are still allocated if they cannot be bound, just not
+          // necessarily on the node.
+          Status s = BindToNumaNode(pointer, static_cast<size_t>(region_size), node);
+          if (!s.ok()) {
+            ARROW_LOG(WARNING) << s.ToString();
+          }
+        }
+        arena_regions_.emplace_back(static_cast<uint8_t*>(pointer), region_size);
+        arenas_.emplace_back(
+            new ArenaAllocator(static_cast<uint8_t*>(pointer), region_size));
+      }
+    }
+    // Try the arena of the node first. The free memory may be too fragmented
+    // for the object in all of them.
+    const int num_arenas = static_cast<int>(arenas_.size());
+    const int first = numa_node >= 0 && numa_node < num_arenas ? numa_node : 0;
+    for (int i = 0; i < num_arenas && mem == nullptr; ++i) {
+      mem = arenas_[(first + i) % num_arenas]->Allocate(alignment, bytes);
+    }
+    if (mem == nullptr) {
+      return nullptr;
+    }
+  } else {
+    mem = dlmemalign(alignment, bytes);
+    ARROW_CHECK(mem);
+  }
   allocated_ += bytes;
   return mem;
 }
 
 void PlasmaAllocator::Free(void* mem, size_t bytes) {
-  dlfree(mem);
+  // Entries of objects that are evicted or failed to be created have no memory.
+  if (mem == nullptr) {
+    return;
+  }
+  if (backend_ == AllocatorBackend::ARENA) {
+    const int node = std::max(GetNumaNode(mem), 0);
+    arenas_[node]->Free(mem, bytes);
+  } else {
+    dlfree(mem);
+  }
   allocated_ -= bytes;
 }
 
@@ -53,4 +110,56 @@ int64_t PlasmaAllocator::GetFootprintLimit() { return footprint_limit_; }
 
 int64_t PlasmaAllocator::Allocated() { return allocated_; }
 
+void PlasmaAllocator::SetBackend(AllocatorBackend backend) {
+  ARROW_CHECK(allocated_ == 0) << "The allocator must be set before allocating memory";
+  backend_ = backend;
+}
+
+AllocatorBackend PlasmaAllocator::GetBackend() { return backend_; }
+
+void PlasmaAllocator::SetNumaNodes(int num_nodes) {
+  ARROW_CHECK(allocated_ == 0) << "The NUMA nodes must be set before allocating memory";
+  ARROW_CHECK(num_nodes == 1 || backend_ == AllocatorBackend::ARENA)
+      << "Placing memory on NUMA nodes requires the arena allocator";
+  ARROW_CHECK(num_nodes > 0);
+  num_numa_nodes_ = num_nodes;
+}
+
+int PlasmaAllocator::GetNumaNodes() { return num_numa_nodes_; }
+
+int PlasmaAllocator::GetNumaNode(const void* mem) {
+  if (num_numa_nodes_ == 1) {
+    return -1;
+  }
+  const uint8_t* pointer = static_cast<const uint8_t*>(mem);
+  for (size_t i = 0; i < arena_regions_.size(); ++i) {
+    if (pointer >= arena_regions_[i].first &&
+        pointer < arena_regions_[i].first + arena_regions_[i].second) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+void PlasmaAllocator::GetStats(PlasmaAllocatorStats* stats) {
+  *stats = PlasmaAllocatorStats();
+  stats->allocated = allocated_;
+  stats->footprint_limit = footprint_limit_;
+  if (arenas_.empty()) {
+    stats->free_bytes = footprint_limit_ - allocated_;
+    return;
+  }
+  stats->largest_free_block = 0;
+  stats->num_free_blocks = 0;
+  for (const auto& arena : arenas_) {
+    PlasmaAllocatorStats arena_stats;
+    arena->GetStats(&arena_stats);
+    stats->free_bytes += arena_stats.free_bytes;
+    stats->largest_free_block =
+        std::max(stats->largest_free_block, arena_stats.largest_free_block);
+    stats->num_free_blocks += arena_stats.num_free_blocks;
+    stats->slab_bytes += arena_stats.slab_bytes;
+  }
+}
+
 }  // namespace plasma
@@ -20,9 +20,40 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace plasma {
 
+class ArenaAllocator;
+
+/// The allocators the Plasma store can get the memory of objects from.
+enum class AllocatorBackend : int {
+  /// dlmalloc, in memory-mapped files that are added as needed.
+  DLMALLOC = 0,
+  /// ArenaAllocator, in one memory-mapped file of the footprint limit. It
+  /// fragments less after many objects of mixed sizes.
+  ARENA = 1,
+};
+
+/// Statistics about the memory of the Plasma store. The ratio of
+/// largest_free_block to free_bytes tells how fragmented the free memory is.
+struct PlasmaAllocatorStats {
+  /// The number of bytes allocated to objects.
+  int64_t allocated = 0;
+  /// The memory footprint limit in bytes.
+  int64_t footprint_limit = 0;
+  /// The number of bytes that are free, not counting free slots of slabs.
+  int64_t free_bytes = 0;
+  /// The size of the largest free block in bytes, or -1 if it is unknown.
+  int64_t largest_free_block = -1;
+  /// The number of free blocks, or -1 if it is unknown.
+  int64_t num_free_blocks = -1;
+  /// The number of bytes of the slabs for small objects.
+  int64_t slab_bytes = 0;
+};
+
 class PlasmaAllocator {
  public:
   /// Allocates size bytes and returns a pointer to the allocated memory. The
@@ -30,8 +61,10 @@ class PlasmaAllocator {
   ///
   /// \param alignment Memory alignment.
   /// \param bytes Number of bytes.
+  /// \param numa_node The NUMA node to prefer, or -1 for any. If the region of
+  ///        that node is full, the memory comes from another one.
   /// \return Pointer to allocated memory.
-  static void* Memalign(size_t alignment, size_t bytes);
+  static void* Memalign(size_t alignment, size_t bytes, int numa_node = -1);
 
   /// Frees the memory space pointed to by mem, which must have been returned by
   /// a previous call to Memalign()
@@ -54,9 +87,47 @@ class PlasmaAllocator {
   /// \return Number of bytes allocated by Plasma so far.
   static int64_t Allocated();
 
+  /// Sets the allocator to get memory from. This must be called before any
+  /// memory is allocated.
+  ///
+  /// \param backend The allocator, dlmalloc by default.
+  static void SetBackend(AllocatorBackend backend);
+
+  /// Get the allocator memory is allocated from.
+  static AllocatorBackend GetBackend();
+
+  /// Splits the memory into one region per NUMA node, whose pages are
+  /// allocated on that node. This requires the arena backend and must be
+  /// called before any memory is allocated.
+  ///
+  /// \param num_nodes The number of nodes, each of which gets an equal share
+  ///        of the footprint limit.
+  static void SetNumaNodes(int num_nodes);
+
+  /// Get the number of regions the memory is split into.
+  static int GetNumaNodes();
+
+  /// Get the NUMA node of memory returned by Memalign().
+  ///
+  /// \param mem Pointer to the memory.
+  /// \return The node, or -1 if the memory is not split up by node.
+  static int GetNumaNode(const void* mem);
+
+  /// Get statistics about the memory of Plasma.
+  ///
+  /// \param[out] stats The statistics.
+  static void GetStats(PlasmaAllocatorStats* stats);
+
  private:
   static int64_t allocated_;
   static int64_t footprint_limit_;
+  static AllocatorBackend backend_;
+  static int num_numa_nodes_;
+  /// The arenas, one per NUMA node, created at the first allocation if they
+  /// are the backend.
+  static std::vector<std::unique_ptr<ArenaAllocator>> arenas_;
+  /// The start and size of the region of each arena.
+  static std::vector<std::pair<uint8_t*, int64_t>> arena_regions_;
 };
 
 }  // namespace plasma
@@ -99,15 +99,18 @@ Status PlasmaErrorStatus(fb::PlasmaError plasma_error) {
 // Create messages.
 
 Status SendCreateRequest(int sock, ObjectID object_id, int64_t data_size,
-                         int64_t metadata_size, int device_num) {
+                         int64_t metadata_size, int device_num, int64_t priority,
+                         int numa_node) {
   flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreatePlasmaCreateRequest(fbb, fbb.CreateString(object_id.binary()),
-                                               data_size, metadata_size, device_num);
+  auto message =
+      fb::CreatePlasmaCreateRequest(fbb, fbb.CreateString(object_id.binary()), data_size,
+                                    metadata_size, device_num, priority, numa_node);
   return PlasmaSend(sock, MessageType::PlasmaCreateRequest, &fbb, message);
 }
 
 Status ReadCreateRequest(uint8_t* data, size_t size, ObjectID* object_id,
-                         int64_t* data_size, int64_t* metadata_size, int* device_num) {
+                         int64_t* data_size, int64_t* metadata_size, int* device_num,
+                         int64_t* priority, int* numa_node) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaCreateRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
@@ -115,6 +118,8 @@ Status ReadCreateRequest(uint8_t* data, size_t size, ObjectID* object_id,
   *metadata_size = message->metadata_size();
   *object_id = ObjectID::from_binary(message->object_id()->str());
   *device_num = message->device_num();
+  *priority = message->priority();
+  *numa_node = message->numa_node();
   return Status::OK();
 }
 
@@ -123,7 +128,7 @@ Status SendCreateReply(int sock, ObjectID object_id, PlasmaObject* object,
   flatbuffers::FlatBufferBuilder fbb;
   PlasmaObjectSpec plasma_object(object->store_fd, object->data_offset, object->data_size,
                                  object->metadata_offset, object->metadata_size,
-                                 object->device_num);
+                                 object->device_num, object->numa_node);
   auto object_string = fbb.CreateString(object_id.binary());
 #ifdef PLASMA_CUDA
   flatbuffers::Offset<fb::CudaHandle> ipc_handle;
@@ -167,6 +172,7 @@ Status ReadCreateReply(uint8_t* data, size_t size, ObjectID* object_id,
   *mmap_size = message->mmap_size();
 
   object->device_num = message->plasma_object()->device_num();
+  object->numa_node = message->plasma_object()->numa_node();
 #ifdef PLASMA_CUDA
   if (object->device_num != 0) {
     RETURN_NOT_OK(CudaIpcMemHandle::FromBuffer(message->ipc_handle()->handle()->data(),
@@ -176,6 +182,97 @@ Status ReadCreateReply(uint8_t* data, size_t size, ObjectID* object_id,
   return PlasmaErrorStatus(message->error());
 }
 
+Status SendCreateManyRequest(int sock, const std::vector<ObjectID>& object_ids,
+                             const std::vector<int64_t>& data_sizes,
+                             const std::vector<int64_t>& metadata_sizes, int numa_node) {
+  DCHECK(object_ids.size() == data_sizes.size());
+  DCHECK(object_ids.size() == metadata_sizes.size());
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<uint64_t> unsigned_data_sizes(data_sizes.begin(), data_sizes.end());
+  std::vector<uint64_t> unsigned_metadata_sizes(metadata_sizes.begin(),
+                                                metadata_sizes.end());
+  auto message = fb::CreatePlasmaCreateManyRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVector(unsigned_data_sizes), fbb.CreateVector(unsigned_metadata_sizes),
+      numa_node);
+  return PlasmaSend(sock, MessageType::PlasmaCreateManyRequest, &fbb, message);
+}
+
+Status ReadCreateManyRequest(uint8_t* data, size_t size,
+                             std::vector<ObjectID>* object_ids,
+                             std::vector<int64_t>* data_sizes,
+                             std::vector<int64_t>* metadata_sizes, int* numa_node) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateManyRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  uoffset_t num_objects = message->object_ids()->size();
+  ARROW_CHECK(message->data_sizes()->size() == num_objects);
+  ARROW_CHECK(message->metadata_sizes()->size() == num_objects);
+  object_ids->clear();
+  data_sizes->clear();
+  metadata_sizes->clear();
+  for (uoffset_t i = 0; i < num_objects; ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+    data_sizes->push_back(static_cast<int64_t>(message->data_sizes()->Get(i)));
+    metadata_sizes->push_back(static_cast<int64_t>(message->metadata_sizes()->Get(i)));
+  }
+  *numa_node = message->numa_node();
+  return Status::OK();
+}
+
+Status SendCreateManyReply(int sock, const std::vector<ObjectID>& object_ids,
+                           const std::vector<PlasmaObject>& objects, PlasmaError error,
+                           const std::vector<int>& store_fds,
+                           const std::vector<int64_t>& mmap_sizes) {
+  DCHECK(object_ids.size() == objects.size());
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<PlasmaObjectSpec> object_specs;
+  for (const PlasmaObject& object : objects) {
+    object_specs.push_back(PlasmaObjectSpec(
+        object.store_fd, object.data_offset, object.data_size, object.metadata_offset,
+        object.metadata_size, object.device_num, object.numa_node));
+  }
+  auto message = fb::CreatePlasmaCreateManyReply(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVectorOfStructs(object_specs.data(), object_specs.size()), error,
+      fbb.CreateVector(store_fds), fbb.CreateVector(mmap_sizes));
+  return PlasmaSend(sock, MessageType::PlasmaCreateManyReply, &fbb, message);
+}
+
+Status ReadCreateManyReply(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                           std::vector<PlasmaObject>* objects,
+                           std::vector<int>* store_fds,
+                           std::vector<int64_t>* mmap_sizes) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaCreateManyReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  uoffset_t num_objects = message->object_ids()->size();
+  ARROW_CHECK(message->plasma_objects()->size() == num_objects);
+  object_ids->clear();
+  objects->clear();
+  for (uoffset_t i = 0; i < num_objects; ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+    const PlasmaObjectSpec* spec = message->plasma_objects()->Get(i);
+    PlasmaObject object = {};
+    object.store_fd = spec->segment_index();
+    object.data_offset = spec->data_offset();
+    object.data_size = spec->data_size();
+    object.metadata_offset = spec->metadata_offset();
+    object.metadata_size = spec->metadata_size();
+    object.device_num = spec->device_num();
+    object.numa_node = spec->numa_node();
+    objects->push_back(object);
+  }
+  ARROW_CHECK(message->store_fds()->size() == message->mmap_sizes()->size());
+  store_fds->clear();
+  mmap_sizes->clear();
+  for (uoffset_t i = 0; i < message->store_fds()->size(); ++i) {
+    store_fds->push_back(message->store_fds()->Get(i));
+    mmap_sizes->push_back(message->mmap_sizes()->Get(i));
+  }
+  return PlasmaErrorStatus(message->error());
+}
+
 Status SendCreateAndSealRequest(int sock, const ObjectID& object_id,
                                 const std::string& data, const std::string& metadata,
                                 unsigned char* digest) {
@@ -264,6 +361,33 @@ Status ReadSealRequest(uint8_t* data, size_t size, ObjectID* object_id,
   return Status::OK();
 }
 
+Status SendSealManyRequest(int sock, const std::vector<ObjectID>& object_ids,
+                           const std::vector<std::string>& digests) {
+  DCHECK(object_ids.size() == digests.size());
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaSealManyRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()),
+      fbb.CreateVectorOfStrings(digests));
+  return PlasmaSend(sock, MessageType::PlasmaSealManyRequest, &fbb, message);
+}
+
+Status ReadSealManyRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                           std::vector<std::string>* digests) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaSealManyRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  uoffset_t num_objects = message->object_ids()->size();
+  ARROW_CHECK(message->digests()->size() == num_objects);
+  object_ids->clear();
+  digests->clear();
+  for (uoffset_t i = 0; i < num_objects; ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+    digests->push_back(message->digests()->Get(i)->str());
+    ARROW_CHECK(digests->back().size() == kDigestSize);
+  }
+  return Status::OK();
+}
+
 Status SendSealReply(int sock, ObjectID object_id, PlasmaError error) {
   flatbuffers::FlatBufferBuilder fbb;
   auto message =
@@ -296,6 +420,64 @@ Status ReadReleaseRequest(uint8_t* data, size_t size, ObjectID* object_id) {
   return Status::OK();
 }
 
+Status SendReleaseManyRequest(int sock, const std::vector<ObjectID>& object_ids) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaReleaseManyRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()));
+  return PlasmaSend(sock, MessageType::PlasmaReleaseManyRequest, &fbb, message);
+}
+
+Status ReadReleaseManyRequest(uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaReleaseManyRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  object_ids->clear();
+  for (uoffset_t i = 0; i < message->object_ids()->size(); ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+  }
+  return Status::OK();
+}
+
+// Pin messages.
+
+Status SendPinRequest(int sock, const std::vector<ObjectID>& object_ids) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaPinRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()));
+  return PlasmaSend(sock, MessageType::PlasmaPinRequest, &fbb, message);
+}
+
+Status ReadPinRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaPinRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  object_ids->clear();
+  for (uoffset_t i = 0; i < message->object_ids()->size(); ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+  }
+  return Status::OK();
+}
+
+Status SendPrefetchRequest(int sock, const std::vector<ObjectID>& object_ids) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaPrefetchRequest(
+      fbb, ToFlatbuffer(&fbb, object_ids.data(), object_ids.size()));
+  return PlasmaSend(sock, MessageType::PlasmaPrefetchRequest, &fbb, message);
+}
+
+Status ReadPrefetchRequest(uint8_t* data, size_t size,
+                           std::vector<ObjectID>* object_ids) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaPrefetchRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  object_ids->clear();
+  for (uoffset_t i = 0; i < message->object_ids()->size(); ++i) {
+    object_ids->push_back(ObjectID::from_binary(message->object_ids()->Get(i)->str()));
+  }
+  return Status::OK();
+}
+
 Status SendReleaseReply(int sock, ObjectID object_id, PlasmaError error) {
   flatbuffers::FlatBufferBuilder fbb;
   auto message =
@@ -444,6 +626,59 @@ Status ReadListReply(uint8_t* data, size_t size, ObjectTable* objects) {
   return Status::OK();
 }
 
+// Metrics messages.
+
+Status SendMetricsRequest(int sock) {
+  flatbuffers::FlatBufferBuilder fbb;
+  auto message = fb::CreatePlasmaMetricsRequest(fbb);
+  return PlasmaSend(sock, MessageType::PlasmaMetricsRequest, &fbb, message);
+}
+
+Status ReadMetricsRequest(uint8_t* data, size_t size) { return Status::OK(); }
+
+Status SendMetricsReply(int sock, const PlasmaStoreMetrics& metrics) {
+  flatbuffers::FlatBufferBuilder fbb;
+  std::vector<flatbuffers::Offset<fb::PlasmaMetric>> values;
+  for (const auto& value : metrics.values) {
+    values.push_back(
+        fb::CreatePlasmaMetric(fbb, fbb.CreateString(value.first), value.second));
+  }
+  std::vector<flatbuffers::Offset<fb::PlasmaLatencyHistogram>> latencies;
+  for (const auto& latency : metrics.latencies) {
+    const LatencyHistogram& histogram = latency.second;
+    latencies.push_back(fb::CreatePlasmaLatencyHistogram(
+        fbb, fbb.CreateString(latency.first),
+        fbb.CreateVector(histogram.buckets.data(), histogram.buckets.size()),
+        histogram.count, histogram.total_micros, histogram.max_micros));
+  }
+  auto message = fb::CreatePlasmaMetricsReply(fbb, fbb.CreateVector(values),
+                                               fbb.CreateVector(latencies));
+  return PlasmaSend(sock, MessageType::PlasmaMetricsReply, &fbb, message);
+}
+
+Status ReadMetricsReply(uint8_t* data, size_t size, PlasmaStoreMetrics* metrics) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaMetricsReply>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  metrics->values.clear();
+  for (auto const& value : *message->metrics()) {
+    metrics->values.emplace_back(value->name()->str(), value->value());
+  }
+  metrics->latencies.clear();
+  for (auto const& latency : *message->latencies()) {
+    LatencyHistogram histogram;
+    auto buckets = latency->buckets();
+    for (uoffset_t i = 0; i < buckets->size() && i < histogram.buckets.size(); ++i) {
+      histogram.buckets[i] = buckets->Get(i);
+    }
+    histogram.count = latency->count();
+    histogram.total_micros = latency->total_micros();
+    histogram.max_micros = latency->max_micros();
+    metrics->latencies.emplace_back(latency->name()->str(), histogram);
+  }
+  return Status::OK();
+}
+
 // Connect messages.
 
 Status SendConnectRequest(int sock) {
@@ -454,17 +689,30 @@ Status SendConnectRequest(int sock) {
 
 Status ReadConnectRequest(uint8_t* data) { return Status::OK(); }
 
-Status SendConnectReply(int sock, int64_t memory_capacity) {
+Status SendConnectReply(int sock, int64_t memory_capacity, int object_directory_store_fd,
+                        int64_t object_directory_mmap_size,
+                        int64_t object_directory_offset,
+                        int64_t object_directory_capacity) {
   flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreatePlasmaConnectReply(fbb, memory_capacity);
+  auto message = fb::CreatePlasmaConnectReply(
+      fbb, memory_capacity, object_directory_store_fd, object_directory_mmap_size,
+      object_directory_offset, object_directory_capacity);
   return PlasmaSend(sock, MessageType::PlasmaConnectReply, &fbb, message);
 }
 
-Status ReadConnectReply(uint8_t* data, size_t size, int64_t* memory_capacity) {
+Status ReadConnectReply(uint8_t* data, size_t size, int64_t* memory_capacity,
+                        int* object_directory_store_fd,
+                        int64_t* object_directory_mmap_size,
+                        int64_t* object_directory_offset,
+                        int64_t* object_directory_capacity) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaConnectReply>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
   *memory_capacity = message->memory_capacity();
+  *object_directory_store_fd = message->object_directory_store_fd();
+  *object_directory_mmap_size = message->object_directory_mmap_size();
+  *object_directory_offset = message->object_directory_offset();
+  *object_directory_capacity = message->object_directory_capacity();
   return Status::OK();
 }
 
@@ -501,15 +749,15 @@ Status ReadEvictReply(uint8_t* data, size_t size, int64_t& num_bytes) {
 // Get messages.
 
 Status SendGetRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
-                      int64_t timeout_ms) {
+                      int64_t timeout_ms, int numa_node) {
   flatbuffers::FlatBufferBuilder fbb;
   auto message = fb::CreatePlasmaGetRequest(
-      fbb, ToFlatbuffer(&fbb, object_ids, num_objects), timeout_ms);
+      fbb, ToFlatbuffer(&fbb, object_ids, num_objects), timeout_ms, numa_node);
   return PlasmaSend(sock, MessageType::PlasmaGetRequest, &fbb, message);
 }
 
 Status ReadGetRequest(uint8_t* data, size_t size, std::vector<ObjectID>& object_ids,
-                      int64_t* timeout_ms) {
+                      int64_t* timeout_ms, int* numa_node) {
   DCHECK(data);
   auto message = flatbuffers::GetRoot<fb::PlasmaGetRequest>(data);
   DCHECK(VerifyFlatbuffer(message, data, size));
@@ -518,6 +766,7 @@ Status ReadGetRequest(uint8_t* data, size_t size, std::vector<ObjectID>& object_
     object_ids.push_back(ObjectID::from_binary(object_id));
   }
   *timeout_ms = message->timeout_ms();
+  *numa_node = message->numa_node();
   return Status::OK();
 }
 
@@ -531,9 +780,9 @@ Status SendGetReply(int sock, ObjectID object_ids[],
   std::vector<flatbuffers::Offset<fb::CudaHandle>> handles;
   for (int64_t i = 0; i < num_objects; ++i) {
     const PlasmaObject& object = plasma_objects[object_ids[i]];
-    objects.push_back(PlasmaObjectSpec(object.store_fd, object.data_offset,
-                                       object.data_size, object.metadata_offset,
-                                       object.metadata_size, object.device_num));
+    objects.push_back(PlasmaObjectSpec(
+        object.store_fd, object.data_offset, object.data_size, object.metadata_offset,
+        object.metadata_size, object.device_num, object.numa_node));
 #ifdef PLASMA_CUDA
     if (object.device_num != 0) {
       std::shared_ptr<arrow::Buffer> handle;
@@ -570,6 +819,7 @@ Status ReadGetReply(uint8_t* data, size_t size, ObjectID object_ids[],
     plasma_objects[i].metadata_offset = object->metadata_offset();
     plasma_objects[i].metadata_size = object->metadata_size();
     plasma_objects[i].device_num = object->device_num();
+    plasma_objects[i].numa_node = object->numa_node();
 #ifdef PLASMA_CUDA
     if (object->device_num() != 0) {
       const void* ipc_handle = message->handles()->Get(handle_pos)->handle()->data();
@@ -589,12 +839,20 @@ Status ReadGetReply(uint8_t* data, size_t size, ObjectID object_ids[],
 
 // Subscribe messages.
 
-Status SendSubscribeRequest(int sock) {
+Status SendSubscribeRequest(int sock, bool batched) {
   flatbuffers::FlatBufferBuilder fbb;
-  auto message = fb::CreatePlasmaSubscribeRequest(fbb);
+  auto message = fb::CreatePlasmaSubscribeRequest(fbb, batched);
   return PlasmaSend(sock, MessageType::PlasmaSubscribeRequest, &fbb, message);
 }
 
+Status ReadSubscribeRequest(uint8_t* data, size_t size, bool* batched) {
+  DCHECK(data);
+  auto message = flatbuffers::GetRoot<fb::PlasmaSubscribeRequest>(data);
+  DCHECK(VerifyFlatbuffer(message, data, size));
+  *batched = message->batched();
+  return Status::OK();
+}
+
 // Data messages.
 
 Status SendDataRequest(int sock, ObjectID object_id, const char* address, int port) {
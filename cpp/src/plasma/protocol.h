@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "plasma/metrics.h"
 #include "plasma/plasma.h"
 #include "plasma/plasma_generated.h"
 
@@ -47,10 +48,12 @@ Status PlasmaReceive(int sock, MessageType message_type, std::vector<uint8_t>* b
 /* Plasma Create message functions. */
 
 Status SendCreateRequest(int sock, ObjectID object_id, int64_t data_size,
-                         int64_t metadata_size, int device_num);
+                         int64_t metadata_size, int device_num, int64_t priority,
+                         int numa_node);
 
 Status ReadCreateRequest(uint8_t* data, size_t size, ObjectID* object_id,
-                         int64_t* data_size, int64_t* metadata_size, int* device_num);
+                         int64_t* data_size, int64_t* metadata_size, int* device_num,
+                         int64_t* priority, int* numa_node);
 
 Status SendCreateReply(int sock, ObjectID object_id, PlasmaObject* object,
                        PlasmaError error, int64_t mmap_size);
@@ -58,6 +61,25 @@ Status SendCreateReply(int sock, ObjectID object_id, PlasmaObject* object,
 Status ReadCreateReply(uint8_t* data, size_t size, ObjectID* object_id,
                        PlasmaObject* object, int* store_fd, int64_t* mmap_size);
 
+Status SendCreateManyRequest(int sock, const std::vector<ObjectID>& object_ids,
+                             const std::vector<int64_t>& data_sizes,
+                             const std::vector<int64_t>& metadata_sizes, int numa_node);
+
+Status ReadCreateManyRequest(uint8_t* data, size_t size,
+                             std::vector<ObjectID>* object_ids,
+                             std::vector<int64_t>* data_sizes,
+                             std::vector<int64_t>* metadata_sizes, int* numa_node);
+
+Status SendCreateManyReply(int sock, const std::vector<ObjectID>& object_ids,
+                           const std::vector<PlasmaObject>& objects, PlasmaError error,
+                           const std::vector<int>& store_fds,
+                           const std::vector<int64_t>& mmap_sizes);
+
+Status ReadCreateManyReply(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                           std::vector<PlasmaObject>* objects,
+                           std::vector<int>* store_fds,
+                           std::vector<int64_t>* mmap_sizes);
+
 Status SendCreateAndSealRequest(int sock, const ObjectID& object_id,
                                 const std::string& data, const std::string& metadata,
                                 unsigned char* digest);
@@ -85,6 +107,12 @@ Status SendSealRequest(int sock, ObjectID object_id, unsigned char* digest);
 Status ReadSealRequest(uint8_t* data, size_t size, ObjectID* object_id,
                        unsigned char* digest);
 
+Status SendSealManyRequest(int sock, const std::vector<ObjectID>& object_ids,
+                           const std::vector<std::string>& digests);
+
+Status ReadSealManyRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids,
+                           std::vector<std::string>* digests);
+
 Status SendSealReply(int sock, ObjectID object_id, PlasmaError error);
 
 Status ReadSealReply(uint8_t* data, size_t size, ObjectID* object_id);
@@ -92,10 +120,10 @@ Status ReadSealReply(uint8_t* data, size_t size, ObjectID* object_id);
 /* Plasma Get message functions. */
 
 Status SendGetRequest(int sock, const ObjectID* object_ids, int64_t num_objects,
-                      int64_t timeout_ms);
+                      int64_t timeout_ms, int numa_node);
 
 Status ReadGetRequest(uint8_t* data, size_t size, std::vector<ObjectID>& object_ids,
-                      int64_t* timeout_ms);
+                      int64_t* timeout_ms, int* numa_node);
 
 Status SendGetReply(int sock, ObjectID object_ids[],
                     std::unordered_map<ObjectID, PlasmaObject>& plasma_objects,
@@ -112,8 +140,26 @@ Status SendReleaseRequest(int sock, ObjectID object_id);
 
 Status ReadReleaseRequest(uint8_t* data, size_t size, ObjectID* object_id);
 
+Status SendReleaseManyRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadReleaseManyRequest(uint8_t* data, size_t size,
+                              std::vector<ObjectID>* object_ids);
+
 Status SendReleaseReply(int sock, ObjectID object_id, PlasmaError error);
 
+/* Plasma Pin message functions (no reply). */
+
+Status SendPinRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadPinRequest(uint8_t* data, size_t size, std::vector<ObjectID>* object_ids);
+
+/* Plasma Prefetch message functions (no reply). */
+
+Status SendPrefetchRequest(int sock, const std::vector<ObjectID>& object_ids);
+
+Status ReadPrefetchRequest(uint8_t* data, size_t size,
+                           std::vector<ObjectID>* object_ids);
+
 Status ReadReleaseReply(uint8_t* data, size_t size, ObjectID* object_id);
 
 /* Plasma Delete objects message functions. */
@@ -149,15 +195,32 @@ Status SendListReply(int sock, const ObjectTable& objects);
 
 Status ReadListReply(uint8_t* data, size_t size, ObjectTable* objects);
 
+/* Plasma Metrics message functions. */
+
+Status SendMetricsRequest(int sock);
+
+Status ReadMetricsRequest(uint8_t* data, size_t size);
+
+Status SendMetricsReply(int sock, const PlasmaStoreMetrics& metrics);
+
+Status ReadMetricsReply(uint8_t* data, size_t size, PlasmaStoreMetrics* metrics);
+
 /* Plasma Connect message functions. */
 
 Status SendConnectRequest(int sock);
 
 Status ReadConnectRequest(uint8_t* data, size_t size);
 
-Status SendConnectReply(int sock, int64_t memory_capacity);
+Status SendConnectReply(int sock, int64_t memory_capacity, int object_directory_store_fd,
+                        int64_t object_directory_mmap_size,
+                        int64_t object_directory_offset,
+                        int64_t object_directory_capacity);
 
-Status ReadConnectReply(uint8_t* data, size_t size, int64_t* memory_capacity);
+Status ReadConnectReply(uint8_t* data, size_t size, int64_t* memory_capacity,
+                        int* object_directory_store_fd,
+                        int64_t* object_directory_mmap_size,
+                        int64_t* object_directory_offset,
+                        int64_t* object_directory_capacity);
 
 /* Plasma Evict message functions (no reply so far). */
 
@@ -171,7 +234,9 @@ Status ReadEvictReply(uint8_t* data, size_t size, int64_t& num_bytes);
 
 /* Plasma Subscribe message functions. */
 
-Status SendSubscribeRequest(int sock);
+Status SendSubscribeRequest(int sock, bool batched);
+
+Status ReadSubscribeRequest(uint8_t* data, size_t size, bool* batched);
 
 /* Data messages. */
 
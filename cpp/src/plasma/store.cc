@@ -18,10 +18,11 @@
 // PLASMA STORE: This is a simple object store server process
 //
 // It accepts incoming client connections on a unix domain socket
-// (name passed in via the -s option of the executable) and uses a
-// single thread to serve the clients. Each client establishes a
-// connection and can create objects, wait for objects and seal
-// objects through that connection.
+// (name passed in via the -s option of the executable) and serves the
+// clients from a single thread or, with the -t option, from several
+// threads that read requests concurrently and handle them one at a time.
+// Each client establishes a connection and can create objects, wait for
+// objects and seal objects through that connection.
 //
 // It keeps a hash table that maps object_ids (which are 20 byte long,
 // just enough to store and SHA1 hash) to memory mapped files.
@@ -43,10 +44,15 @@
 #include <sys/un.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <chrono>
 #include <ctime>
+#include <iostream>
 #include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -54,20 +60,18 @@
 
 #include "arrow/status.h"
 
+#include "plasma/client.h"
 #include "plasma/common.h"
 #include "plasma/common_generated.h"
 #include "plasma/fling.h"
 #include "plasma/io.h"
 #include "plasma/malloc.h"
+#include "plasma/numa.h"
 #include "plasma/plasma_allocator.h"
 #include "plasma/protocol.h"
 
 #ifdef PLASMA_CUDA
-#include "arrow/gpu/cuda_api.h"
-
-using arrow::cuda::CudaBuffer;
-using arrow::cuda::CudaContext;
-using arrow::cuda::CudaDeviceManager;
+#include "plasma/cuda_memory_pool.h"
 #endif
 
 using arrow::util::ArrowLog;
@@ -77,10 +81,23 @@ namespace fb = plasma::flatbuf;
 
 namespace plasma {
 
+/// The number of threads writing objects to the external store and reading
+/// them back.
+constexpr int kExternalStoreThreads = 4;
+
+/// The number of objects a batch of notifications is sent at, even if the
+/// batch interval did not pass yet.
+constexpr size_t kMaxNotificationBatchSize = 1 << 12;
+
 struct GetRequest {
-  GetRequest(Client* client, const std::vector<ObjectID>& object_ids);
+  GetRequest(int64_t id, Client* client, const std::vector<ObjectID>& object_ids,
+             int numa_node);
+  /// The ID of the request in PlasmaStore::get_requests_.
+  int64_t id;
   /// The client that called get.
   Client* client;
+  /// The NUMA node of the client, whose copies of the objects are returned.
+  int numa_node;
   /// The ID of the timer that will time out and cause this wait to return to
   ///  the client if it hasn't already returned.
   int64_t timer;
@@ -96,8 +113,11 @@ struct GetRequest {
   int64_t num_satisfied;
 };
 
-GetRequest::GetRequest(Client* client, const std::vector<ObjectID>& object_ids)
-    : client(client),
+GetRequest::GetRequest(int64_t id, Client* client,
+                       const std::vector<ObjectID>& object_ids, int numa_node)
+    : id(id),
+      client(client),
+      numa_node(numa_node),
       timer(-1),
       object_ids(object_ids.begin(), object_ids.end()),
       objects(object_ids.size()),
@@ -106,24 +126,104 @@ GetRequest::GetRequest(Client* client, const std::vector<ObjectID>& object_ids)
   num_objects_to_wait_for = unique_ids.size();
 }
 
-Client::Client(int fd) : fd(fd), notification_fd(-1) {}
+Client::Client(int fd, EventLoop* loop) : fd(fd), loop(loop), notification_fd(-1) {}
 
 PlasmaStore::PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
                          const std::string& socket_name,
-                         std::shared_ptr<ExternalStore> external_store)
-    : loop_(loop), eviction_policy_(&store_info_), external_store_(external_store) {
+                         std::shared_ptr<ExternalStore> external_store,
+                         const std::vector<EventLoop*>& client_loops,
+                         const std::string& eviction_policy)
+    : loop_(loop),
+      client_loops_(client_loops),
+      next_client_loop_(0),
+      eviction_policy_(EvictionPolicy::Make(eviction_policy, &store_info_)),
+      next_get_request_id_(0),
+      notification_batch_interval_ms_(0),
+      max_notification_backlog_bytes_(0),
+      notification_flush_scheduled_(false),
+      object_directory_fd_(-1),
+      object_directory_map_size_(0),
+      object_directory_offset_(0),
+      object_directory_capacity_(0),
+      external_store_(external_store),
+      num_pending_spills_(0),
+      num_spilling_bytes_(0),
+      numa_replication_threshold_(0) {
+  ARROW_CHECK(eviction_policy_ != nullptr)
+      << "No such eviction policy \"" << eviction_policy << "\"";
+  // Register the gauges first, so that they are listed before the counters.
+  for (const char* gauge :
+       {"objects", "clients", "waiting_get_requests", "parked_create_requests",
+        "pending_spills", "spilling_bytes", "subscribers", "notification_backlog",
+        "allocated_bytes", "footprint_limit", "free_bytes", "largest_free_block",
+        "free_blocks", "slab_bytes"}) {
+    metrics_.Value(gauge);
+  }
+  num_created_out_of_memory_ = metrics_.Value("creates_out_of_memory");
+  num_evicted_objects_ = metrics_.Value("evicted_objects");
+  num_evicted_bytes_ = metrics_.Value("evicted_bytes");
+  num_spilled_objects_ = metrics_.Value("spilled_objects");
+  num_spilled_bytes_ = metrics_.Value("spilled_bytes");
+  num_failed_spills_ = metrics_.Value("failed_spills");
+  num_restored_objects_ = metrics_.Value("restored_objects");
+  num_restored_bytes_ = metrics_.Value("restored_bytes");
+  num_failed_restores_ = metrics_.Value("failed_restores");
+  num_replicated_objects_ = metrics_.Value("numa_replicated_objects");
+  max_notification_backlog_ = metrics_.Value("max_notification_backlog");
+  num_coalesced_notifications_ = metrics_.Value("coalesced_notifications");
+  num_dropped_subscribers_ = metrics_.Value("dropped_subscribers");
+  if (external_store_) {
+    ARROW_CHECK_OK(arrow::internal::ThreadPool::Make(kExternalStoreThreads,
+                                                     &external_store_threads_));
+  }
+  if (client_loops_.empty()) {
+    client_loops_.push_back(loop_);
+  }
   store_info_.directory = directory;
   store_info_.hugepages_enabled = hugepages_enabled;
-#ifdef PLASMA_CUDA
-  DCHECK_OK(CudaDeviceManager::GetInstance(&manager_));
-#endif
 }
 
 // TODO(pcm): Get rid of this destructor by using RAII to clean up data.
-PlasmaStore::~PlasmaStore() {}
+PlasmaStore::~PlasmaStore() {
+  // Wait for the external store to be done with the memory of the objects.
+  if (external_store_threads_) {
+    ARROW_CHECK_OK(external_store_threads_->Shutdown());
+  }
+}
 
 const PlasmaStoreInfo* PlasmaStore::GetPlasmaStoreInfo() { return &store_info_; }
 
+void PlasmaStore::CreateObjectDirectory(int64_t capacity) {
+  int64_t size = ObjectDirectory::Size(capacity);
+  uint8_t* pointer =
+      reinterpret_cast<uint8_t*>(PlasmaAllocator::Memalign(kBlockSize, size));
+  ARROW_CHECK(pointer != nullptr) << "Not enough memory for the object directory";
+  std::memset(pointer, 0, size);
+  GetMallocMapinfo(pointer, &object_directory_fd_, &object_directory_map_size_,
+                   &object_directory_offset_);
+  ARROW_CHECK(object_directory_fd_ != -1);
+  object_directory_capacity_ = capacity;
+  object_directory_.reset(new ObjectDirectory(pointer, capacity));
+}
+
+void PlasmaStore::EnableNumaReplication(int64_t num_gets) {
+  numa_replication_threshold_ = num_gets;
+}
+
+void PlasmaStore::ConfigureNotifications(int64_t batch_interval_ms,
+                                         int64_t max_backlog_bytes) {
+  notification_batch_interval_ms_ = batch_interval_ms;
+  max_notification_backlog_bytes_ = max_backlog_bytes;
+}
+
+void PlasmaStore::RunInLoop(EventLoop* loop, const std::function<void()>& function) {
+  if (loop->IsLoopThread()) {
+    function();
+  } else {
+    loop->Post(function);
+  }
+}
+
 // If this client is not already using the object, add the client to the
 // object's list of clients, otherwise do nothing.
 void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
@@ -137,7 +237,7 @@ void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEnt
   if (entry->ref_count == 0) {
     // Tell the eviction policy that this object is being used.
     std::vector<ObjectID> objects_to_evict;
-    eviction_policy_.BeginObjectAccess(object_id, &objects_to_evict);
+    eviction_policy_->BeginObjectAccess(object_id, &objects_to_evict);
     EvictObjects(objects_to_evict);
   }
   // Increase reference count.
@@ -149,7 +249,7 @@ void PlasmaStore::AddToClientObjectIds(const ObjectID& object_id, ObjectTableEnt
 
 // Allocate memory
 uint8_t* PlasmaStore::AllocateMemory(size_t size, int* fd, int64_t* map_size,
-                                     ptrdiff_t* offset) {
+                                     ptrdiff_t* offset, int numa_node) {
   // Try to evict objects until there is enough space.
   uint8_t* pointer = nullptr;
   while (true) {
@@ -160,17 +260,25 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, int* fd, int64_t* map_size,
     // plasma_client.cc). Note that even though this pointer is 64-byte aligned,
     // it is not guaranteed that the corresponding pointer in the client will be
     // 64-byte aligned, but in practice it often will be.
-    pointer = reinterpret_cast<uint8_t*>(PlasmaAllocator::Memalign(kBlockSize, size));
+    pointer = reinterpret_cast<uint8_t*>(
+        PlasmaAllocator::Memalign(kBlockSize, size, numa_node));
     if (pointer) {
       break;
     }
+    // The memory of objects being spilled is only freed once the external
+    // store wrote them. Rather than evicting more objects, wait for it if it
+    // would be enough.
+    if (num_spilling_bytes_ >= static_cast<int64_t>(size)) {
+      return nullptr;
+    }
     // Tell the eviction policy how much space we need to create this object.
     std::vector<ObjectID> objects_to_evict;
-    bool success = eviction_policy_.RequireSpace(size, &objects_to_evict);
-    EvictObjects(objects_to_evict);
+    bool success = eviction_policy_->RequireSpace(size, &objects_to_evict);
+    size_t num_evicted = EvictObjects(objects_to_evict);
     // Return an error to the client if not enough space could be freed to
-    // create the object.
-    if (!success) {
+    // create the object, or if clients pinned all of the objects chosen, or
+    // if the objects are being spilled.
+    if (!success || num_evicted == 0 || num_spilling_bytes_ > 0) {
       return nullptr;
     }
   }
@@ -179,25 +287,11 @@ uint8_t* PlasmaStore::AllocateMemory(size_t size, int* fd, int64_t* map_size,
   return pointer;
 }
 
-#ifdef PLASMA_CUDA
-Status PlasmaStore::AllocateCudaMemory(
-    int device_num, int64_t size, uint8_t** out_pointer,
-    std::shared_ptr<CudaIpcMemHandle>* out_ipc_handle) {
-  std::shared_ptr<CudaBuffer> cuda_buffer;
-  std::shared_ptr<CudaContext> context_;
-  DCHECK_NE(device_num, 0);
-  RETURN_NOT_OK(manager_->GetContext(device_num - 1, &context_));
-  RETURN_NOT_OK(context_->Allocate(static_cast<int64_t>(size), &cuda_buffer));
-  *out_pointer = cuda_buffer->mutable_data();
-  // The IPC handle will keep the buffer memory alive
-  return cuda_buffer->ExportForIpc(out_ipc_handle);
-}
-#endif
-
 // Create a new object buffer in the hash table.
 PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, int64_t data_size,
                                       int64_t metadata_size, int device_num,
-                                      Client* client, PlasmaObject* result) {
+                                      int64_t priority, int numa_node, Client* client,
+                                      PlasmaObject* result) {
   ARROW_LOG(DEBUG) << "creating object " << object_id.hex();
 
   auto entry = GetObjectTableEntry(&store_info_, object_id);
@@ -210,6 +304,7 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, int64_t data_si
   entry = store_info_.objects.emplace(object_id, std::move(ptr)).first->second.get();
   entry->data_size = data_size;
   entry->metadata_size = metadata_size;
+  entry->priority = priority;
 
   int fd = -1;
   int64_t map_size = 0;
@@ -219,28 +314,40 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, int64_t data_si
 
   if (device_num != 0) {
 #ifdef PLASMA_CUDA
-    auto st = AllocateCudaMemory(device_num, total_size, &pointer, &entry->ipc_handle);
+    // Objects share the IPC handle of the region of device memory they are
+    // in, so that clients open it once rather than for every object.
+    CudaAllocation allocation;
+    auto st = CudaMemoryPool::Allocate(device_num, total_size, &allocation);
     if (!st.ok()) {
       ARROW_LOG(ERROR) << "Failed to allocate CUDA memory: " << st.ToString();
+      store_info_.objects.erase(object_id);
       return PlasmaError::OutOfMemory;
     }
+    pointer = allocation.pointer;
+    offset = allocation.offset;
+    entry->ipc_handle = allocation.ipc_handle;
     result->ipc_handle = entry->ipc_handle;
 #else
     ARROW_LOG(ERROR) << "device_num != 0 but CUDA not enabled";
+    store_info_.objects.erase(object_id);
     return PlasmaError::OutOfMemory;
 #endif
   } else {
-    pointer = AllocateMemory(total_size, &fd, &map_size, &offset);
+    pointer = AllocateMemory(total_size, &fd, &map_size, &offset, numa_node);
     if (!pointer) {
       ARROW_LOG(ERROR) << "Not enough memory to create the object " << object_id.hex()
                        << ", data_size=" << data_size
                        << ", metadata_size=" << metadata_size
                        << ", will send a reply of PlasmaError::OutOfMemory";
+      *num_created_out_of_memory_ += 1;
+      // Remove the entry so that the client can try again.
+      store_info_.objects.erase(object_id);
       return PlasmaError::OutOfMemory;
     }
   }
 
   entry->pointer = pointer;
+  entry->numa_node = PlasmaAllocator::GetNumaNode(pointer);
   // TODO(pcm): Set the other fields.
   entry->fd = fd;
   entry->map_size = map_size;
@@ -256,16 +363,19 @@ PlasmaError PlasmaStore::CreateObject(const ObjectID& object_id, int64_t data_si
   result->data_size = data_size;
   result->metadata_size = metadata_size;
   result->device_num = device_num;
+  result->numa_node = entry->numa_node;
   // Notify the eviction policy that this object was created. This must be done
   // immediately before the call to AddToClientObjectIds so that the
   // eviction policy does not have an opportunity to evict the object.
-  eviction_policy_.ObjectCreated(object_id);
+  eviction_policy_->ObjectCreated(object_id);
   // Record that this client is using this object.
   AddToClientObjectIds(object_id, store_info_.objects[object_id].get(), client);
   return PlasmaError::OK;
 }
 
-void PlasmaObject_init(PlasmaObject* object, ObjectTableEntry* entry) {
+/// Describe a sealed object, or its copy on numa_node if there is one.
+void PlasmaObject_init(PlasmaObject* object, ObjectTableEntry* entry,
+                       int numa_node = -1) {
   DCHECK(object != nullptr);
   DCHECK(entry != nullptr);
   DCHECK(entry->state == ObjectState::PLASMA_SEALED);
@@ -276,12 +386,80 @@ void PlasmaObject_init(PlasmaObject* object, ObjectTableEntry* entry) {
 #endif
   object->store_fd = entry->fd;
   object->data_offset = entry->offset;
-  object->metadata_offset = entry->offset + entry->data_size;
+  object->numa_node = entry->numa_node;
+  for (const auto& replica : entry->replicas) {
+    if (replica.numa_node == numa_node) {
+      object->store_fd = replica.fd;
+      object->data_offset = replica.offset;
+      object->numa_node = replica.numa_node;
+      break;
+    }
+  }
+  object->metadata_offset = object->data_offset + entry->data_size;
   object->data_size = entry->data_size;
   object->metadata_size = entry->metadata_size;
   object->device_num = entry->device_num;
 }
 
+void PlasmaStore::ReplicateIfHot(ObjectTableEntry* entry, int numa_node) {
+  if (numa_replication_threshold_ <= 0 || numa_node < 0 || entry->device_num != 0 ||
+      entry->numa_node < 0 || entry->numa_node == numa_node) {
+    return;
+  }
+  for (const auto& replica : entry->replicas) {
+    if (replica.numa_node == numa_node) {
+      return;
+    }
+  }
+  if (entry->remote_gets.size() <= static_cast<size_t>(numa_node)) {
+    entry->remote_gets.resize(numa_node + 1, 0);
+  }
+  if (++entry->remote_gets[numa_node] < numa_replication_threshold_) {
+    return;
+  }
+  entry->remote_gets[numa_node] = 0;
+  // Copies are only made in free memory of the node. Objects are not evicted
+  // for them.
+  int64_t size = entry->data_size + entry->metadata_size;
+  ObjectReplica replica;
+  replica.pointer = reinterpret_cast<uint8_t*>(
+      PlasmaAllocator::Memalign(kBlockSize, size, numa_node));
+  if (replica.pointer == nullptr) {
+    return;
+  }
+  if (PlasmaAllocator::GetNumaNode(replica.pointer) != numa_node) {
+    PlasmaAllocator::Free(replica.pointer, size);
+    return;
+  }
+  std::memcpy(replica.pointer, entry->pointer, size);
+  replica.numa_node = numa_node;
+  GetMallocMapinfo(replica.pointer, &replica.fd, &replica.map_size, &replica.offset);
+  ARROW_CHECK(replica.fd != -1);
+  entry->replicas.push_back(replica);
+  *num_replicated_objects_ += 1;
+}
+
+void PlasmaStore::FreeReplicas(ObjectTableEntry* entry) {
+  for (const auto& replica : entry->replicas) {
+    PlasmaAllocator::Free(replica.pointer, entry->data_size + entry->metadata_size);
+  }
+  entry->replicas.clear();
+  entry->remote_gets.clear();
+}
+
+void PlasmaStore::AddToObjectDirectory(const ObjectID& object_id,
+                                       ObjectTableEntry* entry) {
+  if (object_directory_ && entry->device_num == 0) {
+    PlasmaObject object = {};
+    PlasmaObject_init(&object, entry);
+    object_directory_->Insert(object_id, object);
+  }
+}
+
+bool PlasmaStore::RemoveFromObjectDirectory(const ObjectID& object_id) {
+  return !object_directory_ || object_directory_->Remove(object_id);
+}
+
 void PlasmaStore::RemoveGetRequest(GetRequest* get_request) {
   // Remove the get request from each of the relevant object_get_requests hash
   // tables if it is present there. It should only be present there if the get
@@ -303,8 +481,16 @@ void PlasmaStore::RemoveGetRequest(GetRequest* get_request) {
   }
   // Remove the get request.
   if (get_request->timer != -1) {
-    ARROW_CHECK(loop_->RemoveTimer(get_request->timer) == kEventLoopOk);
+    EventLoop* loop = get_request->client->loop;
+    if (loop->IsLoopThread()) {
+      ARROW_CHECK(loop->RemoveTimer(get_request->timer) == kEventLoopOk);
+    } else {
+      // The timer may fire before this runs, and then finds the request gone.
+      int64_t timer = get_request->timer;
+      loop->Post([loop, timer]() { loop->RemoveTimer(timer); });
+    }
   }
+  get_requests_.erase(get_request->id);
   delete get_request;
 }
 
@@ -383,7 +569,8 @@ void PlasmaStore::UpdateObjectGetRequests(const ObjectID& object_id) {
     auto entry = GetObjectTableEntry(&store_info_, object_id);
     ARROW_CHECK(entry != nullptr);
 
-    PlasmaObject_init(&get_req->objects[object_id], entry);
+    ReplicateIfHot(entry, get_req->numa_node);
+    PlasmaObject_init(&get_req->objects[object_id], entry, get_req->numa_node);
     get_req->num_satisfied += 1;
     // Record the fact that this client will be using this object and will
     // be responsible for releasing this object.
@@ -411,41 +598,23 @@ void PlasmaStore::UpdateObjectGetRequests(const ObjectID& object_id) {
 
 void PlasmaStore::ProcessGetRequest(Client* client,
                                     const std::vector<ObjectID>& object_ids,
-                                    int64_t timeout_ms) {
+                                    int64_t timeout_ms, int numa_node) {
   // Create a get request for this object.
-  auto get_req = new GetRequest(client, object_ids);
+  auto get_req = new GetRequest(next_get_request_id_++, client, object_ids, numa_node);
+  get_requests_[get_req->id] = get_req;
   std::vector<ObjectID> evicted_ids;
-  std::vector<ObjectTableEntry*> evicted_entries;
   for (auto object_id : object_ids) {
     // Check if this object is already present locally. If so, record that the
     // object is being used and mark it as accounted for.
     auto entry = GetObjectTableEntry(&store_info_, object_id);
     if (entry && entry->state == ObjectState::PLASMA_SEALED) {
       // Update the get request to take into account the present object.
-      PlasmaObject_init(&get_req->objects[object_id], entry);
+      ReplicateIfHot(entry, numa_node);
+      PlasmaObject_init(&get_req->objects[object_id], entry, numa_node);
       get_req->num_satisfied += 1;
       // If necessary, record that this client is using this object. In the case
       // where entry == NULL, this will be called from SealObject.
       AddToClientObjectIds(object_id, entry, client);
-    } else if (entry && entry->state == ObjectState::PLASMA_EVICTED) {
-      // Make sure the object pointer is not already allocated
-      ARROW_CHECK(!entry->pointer);
-
-      entry->pointer = AllocateMemory(entry->data_size + entry->metadata_size, &entry->fd,
-                                      &entry->map_size, &entry->offset);
-      if (entry->pointer) {
-        entry->state = ObjectState::PLASMA_CREATED;
-        entry->create_time = std::time(nullptr);
-        eviction_policy_.ObjectCreated(object_id);
-        AddToClientObjectIds(object_id, store_info_.objects[object_id].get(), client);
-        evicted_ids.push_back(object_id);
-        evicted_entries.push_back(entry);
-      } else {
-        // We are out of memory an cannot allocate memory for this object.
-        // Change the state of the object back to PLASMA_EVICTED so some
-        // other request can try again.
-        entry->state = ObjectState::PLASMA_EVICTED;
-      }
     } else {
       // Add a placeholder plasma object to the get request to indicate that the
       // object is not present. This will be parsed by the client. We set the
@@ -453,35 +622,14 @@ void PlasmaStore::ProcessGetRequest(Client* client,
       get_req->objects[object_id].data_size = -1;
       // Add the get request to the relevant data structures.
       object_get_requests_[object_id].push_back(get_req);
-    }
-  }
-
-  if (!evicted_ids.empty()) {
-    unsigned char digest[kDigestSize];
-    std::vector<std::shared_ptr<Buffer>> buffers;
-    for (size_t i = 0; i < evicted_ids.size(); ++i) {
-      ARROW_CHECK(evicted_entries[i]->pointer != nullptr);
-      buffers.emplace_back(new arrow::MutableBuffer(evicted_entries[i]->pointer,
-                                                    evicted_entries[i]->data_size));
-    }
-    if (external_store_->Get(evicted_ids, buffers).ok()) {
-      for (size_t i = 0; i < evicted_ids.size(); ++i) {
-        evicted_entries[i]->state = ObjectState::PLASMA_SEALED;
-        std::memcpy(&evicted_entries[i]->digest[0], &digest[0], kDigestSize);
-        evicted_entries[i]->construct_duration =
-            std::time(nullptr) - evicted_entries[i]->create_time;
-        PlasmaObject_init(&get_req->objects[evicted_ids[i]], evicted_entries[i]);
-        get_req->num_satisfied += 1;
-      }
-    } else {
-      // We tried to get the objects from the external store, but could not get them.
-      // Set the state of these objects back to PLASMA_EVICTED so some other request
-      // can try again.
-      for (size_t i = 0; i < evicted_ids.size(); ++i) {
-        evicted_entries[i]->state = ObjectState::PLASMA_EVICTED;
+      if (entry && entry->state == ObjectState::PLASMA_EVICTED) {
+        // The get request is updated once the object is restored, like for
+        // objects that are sealed.
+        evicted_ids.push_back(object_id);
       }
     }
   }
+  RestoreObjects(evicted_ids);
 
   // If all of the objects are present already or if the timeout is 0, return to
   // the client.
@@ -490,10 +638,81 @@ void PlasmaStore::ProcessGetRequest(Client* client,
   } else if (timeout_ms != -1) {
     // Set a timer that will cause the get request to return to the client. Note
     // that a timeout of -1 is used to indicate that no timer should be set.
-    get_req->timer = loop_->AddTimer(timeout_ms, [this, get_req](int64_t timer_id) {
-      ReturnFromGet(get_req);
-      return kEventLoopTimerDone;
+    int64_t get_req_id = get_req->id;
+    get_req->timer =
+        client->loop->AddTimer(timeout_ms, [this, get_req_id](int64_t timer_id) {
+          std::lock_guard<std::mutex> lock(mutex_);
+          auto it = get_requests_.find(get_req_id);
+          if (it != get_requests_.end()) {
+            ReturnFromGet(it->second);
+          }
+          return kEventLoopTimerDone;
+        });
+  }
+}
+
+void PlasmaStore::RestoreObjects(const std::vector<ObjectID>& object_ids) {
+  std::vector<ObjectID> restored_ids;
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  for (const auto& object_id : object_ids) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    if (entry == nullptr || entry->state != ObjectState::PLASMA_EVICTED) {
+      continue;
+    }
+    // Make sure the object pointer is not already allocated
+    ARROW_CHECK(!entry->pointer);
+    int64_t size = entry->data_size + entry->metadata_size;
+    // Put the object back on the NUMA node it was created on if possible.
+    entry->pointer = AllocateMemory(size, &entry->fd, &entry->map_size, &entry->offset,
+                                    entry->numa_node);
+    if (!entry->pointer) {
+      // We are out of memory and cannot allocate memory for this object. The
+      // get requests waiting for it try again once spilled objects are freed.
+      continue;
+    }
+    entry->numa_node = PlasmaAllocator::GetNumaNode(entry->pointer);
+    entry->state = ObjectState::PLASMA_RESTORING;
+    entry->create_time = std::time(nullptr);
+    restored_ids.push_back(object_id);
+    buffers.emplace_back(new arrow::MutableBuffer(entry->pointer, size));
+  }
+  if (restored_ids.empty()) {
+    return;
+  }
+  ARROW_CHECK_OK(external_store_threads_->Spawn([this, restored_ids, buffers]() {
+    Status status = external_store_->Get(restored_ids, buffers);
+    loop_->Post([this, restored_ids, status]() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      FinishRestore(restored_ids, status);
     });
+  }));
+}
+
+void PlasmaStore::FinishRestore(const std::vector<ObjectID>& object_ids,
+                                const Status& status) {
+  if (!status.ok()) {
+    ARROW_LOG(WARNING) << "Failed to restore objects from the external store: "
+                       << status.ToString();
+  }
+  for (const auto& object_id : object_ids) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    ARROW_CHECK(entry != nullptr && entry->state == ObjectState::PLASMA_RESTORING);
+    if (status.ok()) {
+      *num_restored_objects_ += 1;
+      *num_restored_bytes_ += entry->data_size + entry->metadata_size;
+      entry->state = ObjectState::PLASMA_SEALED;
+      entry->construct_duration = std::time(nullptr) - entry->create_time;
+      AddToObjectDirectory(object_id, entry);
+      eviction_policy_->ObjectCreated(object_id);
+      UpdateObjectGetRequests(object_id);
+    } else {
+      // Set the state of the object back to PLASMA_EVICTED so some other
+      // request can try again.
+      *num_failed_restores_ += 1;
+      PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
+      entry->pointer = nullptr;
+      entry->state = ObjectState::PLASMA_EVICTED;
+    }
   }
 }
 
@@ -511,13 +730,16 @@ int PlasmaStore::RemoveFromClientObjectIds(const ObjectID& object_id,
       if (deletion_cache_.count(object_id) == 0) {
         // Tell the eviction policy that this object is no longer being used.
         std::vector<ObjectID> objects_to_evict;
-        eviction_policy_.EndObjectAccess(object_id, &objects_to_evict);
+        eviction_policy_->EndObjectAccess(object_id, &objects_to_evict);
         EvictObjects(objects_to_evict);
       } else {
         // Above code does not really delete an object. Instead, it just put an
         // object to LRU cache which will be cleaned when the memory is not enough.
         deletion_cache_.erase(object_id);
-        EvictObjects({object_id});
+        if (EvictObjects({object_id}) == 0) {
+          // A client pinned the object, delete it once that client releases it.
+          deletion_cache_.emplace(object_id);
+        }
       }
     }
     // Return 1 to indicate that the client was removed.
@@ -539,7 +761,9 @@ void PlasmaStore::ReleaseObject(const ObjectID& object_id, Client* client) {
 ObjectStatus PlasmaStore::ContainsObject(const ObjectID& object_id) {
   auto entry = GetObjectTableEntry(&store_info_, object_id);
   return entry && (entry->state == ObjectState::PLASMA_SEALED ||
-                   entry->state == ObjectState::PLASMA_EVICTED)
+                   entry->state == ObjectState::PLASMA_EVICTED ||
+                   entry->state == ObjectState::PLASMA_SPILLING ||
+                   entry->state == ObjectState::PLASMA_RESTORING)
              ? ObjectStatus::OBJECT_FOUND
              : ObjectStatus::OBJECT_NOT_FOUND;
 }
@@ -556,6 +780,7 @@ void PlasmaStore::SealObject(const ObjectID& object_id, unsigned char digest[])
   std::memcpy(&entry->digest[0], &digest[0], kDigestSize);
   // Set object construction duration.
   entry->construct_duration = std::time(nullptr) - entry->create_time;
+  AddToObjectDirectory(object_id, entry);
 
   // Inform all subscribers that a new object has been sealed.
   ObjectInfoT info;
@@ -603,14 +828,15 @@ PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
     return PlasmaError::ObjectNotSealed;
   }
 
-  if (entry->ref_count != 0) {
-    // To delete an object, there must be no clients currently using it.
+  if (entry->ref_count != 0 || !RemoveFromObjectDirectory(object_id)) {
+    // To delete an object, there must be no clients currently using it,
+    // including clients that pinned it through the object directory.
     // Put it into deletion cache, it will be deleted later.
     deletion_cache_.emplace(object_id);
     return PlasmaError::ObjectInUse;
   }
 
-  eviction_policy_.RemoveObject(object_id);
+  eviction_policy_->RemoveObject(object_id);
 
   store_info_.objects.erase(object_id);
   // Inform all subscribers that the object has been deleted.
@@ -622,9 +848,10 @@ PlasmaError PlasmaStore::DeleteObject(ObjectID& object_id) {
   return PlasmaError::OK;
 }
 
-void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
+size_t PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
+  std::vector<ObjectID> evicted_ids;
   std::vector<std::shared_ptr<arrow::Buffer>> evicted_object_data;
-  std::vector<ObjectTableEntry*> evicted_entries;
+  int64_t num_evicted_bytes = 0;
   for (const auto& object_id : object_ids) {
     ARROW_LOG(DEBUG) << "evicting object " << object_id.hex();
     auto entry = GetObjectTableEntry(&store_info_, object_id);
@@ -636,14 +863,28 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
         << "To evict an object it must have been sealed.";
     ARROW_CHECK(entry->ref_count == 0)
         << "To evict an object, there must be no clients currently using it.";
+    if (!RemoveFromObjectDirectory(object_id)) {
+      // A client pinned the object and is about to use it. Give it back to the
+      // eviction policy, which stops considering it once the pin is turned
+      // into a reference.
+      eviction_policy_->ObjectCreated(object_id);
+      continue;
+    }
+    evicted_ids.push_back(object_id);
+    *num_evicted_objects_ += 1;
+    *num_evicted_bytes_ += entry->data_size + entry->metadata_size;
 
     // If there is a backing external store, then mark object for eviction to
-    // external store, free the object data pointer and keep a placeholder
-    // entry in ObjectTable
+    // external store and keep a placeholder entry in ObjectTable. The object
+    // data pointer is freed once the object is written.
     if (external_store_) {
+      // No client uses the copies of the object, which are made again if it
+      // is restored and gotten often.
+      FreeReplicas(entry);
+      entry->state = ObjectState::PLASMA_SPILLING;
       evicted_object_data.push_back(std::make_shared<arrow::Buffer>(
           entry->pointer, entry->data_size + entry->metadata_size));
-      evicted_entries.push_back(entry);
+      num_evicted_bytes += entry->data_size + entry->metadata_size;
     } else {
       // If there is no backing external store, just erase the object entry
       // and send a deletion notification.
@@ -656,12 +897,68 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
     }
   }
 
-  if (external_store_ && !object_ids.empty()) {
-    ARROW_CHECK_OK(external_store_->Put(object_ids, evicted_object_data));
-    for (auto entry : evicted_entries) {
+  if (external_store_ && !evicted_ids.empty()) {
+    num_pending_spills_ += 1;
+    num_spilling_bytes_ += num_evicted_bytes;
+    ARROW_CHECK_OK(external_store_threads_->Spawn(
+        [this, evicted_ids, evicted_object_data, num_evicted_bytes]() {
+          Status status = external_store_->Put(evicted_ids, evicted_object_data);
+          loop_->Post([this, evicted_ids, num_evicted_bytes, status]() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            FinishSpill(evicted_ids, num_evicted_bytes, status);
+          });
+        }));
+  }
+  return evicted_ids.size();
+}
+
+void PlasmaStore::FinishSpill(const std::vector<ObjectID>& object_ids, int64_t num_bytes,
+                              const Status& status) {
+  num_pending_spills_ -= 1;
+  num_spilling_bytes_ -= num_bytes;
+  if (!status.ok()) {
+    ARROW_LOG(WARNING) << "Failed to spill objects to the external store: "
+                       << status.ToString();
+  }
+  for (const auto& object_id : object_ids) {
+    auto entry = GetObjectTableEntry(&store_info_, object_id);
+    ARROW_CHECK(entry != nullptr && entry->state == ObjectState::PLASMA_SPILLING);
+    if (!status.ok()) {
+      *num_failed_spills_ += 1;
+    }
+    if (status.ok() && object_get_requests_.count(object_id) == 0) {
+      *num_spilled_objects_ += 1;
+      *num_spilled_bytes_ += entry->data_size + entry->metadata_size;
       PlasmaAllocator::Free(entry->pointer, entry->data_size + entry->metadata_size);
       entry->pointer = nullptr;
       entry->state = ObjectState::PLASMA_EVICTED;
+    } else {
+      // Keep the object in memory if it could not be spilled, or if clients
+      // tried to get it meanwhile.
+      entry->state = ObjectState::PLASMA_SEALED;
+      AddToObjectDirectory(object_id, entry);
+      eviction_policy_->ObjectCreated(object_id);
+      UpdateObjectGetRequests(object_id);
+    }
+  }
+
+  // Retry what failed for lack of the memory that was just freed: restores of
+  // objects that get requests wait for, and create requests.
+  std::vector<ObjectID> evicted_ids;
+  for (const auto& it : object_get_requests_) {
+    auto entry = GetObjectTableEntry(&store_info_, it.first);
+    if (entry != nullptr && entry->state == ObjectState::PLASMA_EVICTED) {
+      evicted_ids.push_back(it.first);
+    }
+  }
+  RestoreObjects(evicted_ids);
+  std::deque<ParkedRequest> parked_requests;
+  parked_requests.swap(parked_requests_);
+  for (auto& request : parked_requests) {
+    Status s = ProcessRequest(request.client, request.type, request.input.data(),
+                              request.input.size());
+    if (!s.ok()) {
+      ARROW_LOG(FATAL) << "Failed to process parked request: " << s;
     }
   }
 }
@@ -669,16 +966,23 @@ void PlasmaStore::EvictObjects(const std::vector<ObjectID>& object_ids) {
 void PlasmaStore::ConnectClient(int listener_sock) {
   int client_fd = AcceptClient(listener_sock);
 
-  Client* client = new Client(client_fd);
-  connected_clients_[client_fd] = std::unique_ptr<Client>(client);
+  EventLoop* loop = client_loops_[next_client_loop_];
+  next_client_loop_ = (next_client_loop_ + 1) % client_loops_.size();
+  Client* client = new Client(client_fd, loop);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    connected_clients_[client_fd] = std::unique_ptr<Client>(client);
+  }
 
   // Add a callback to handle events on this socket.
-  // TODO(pcm): Check return value.
-  loop_->AddFileEvent(client_fd, kEventLoopRead, [this, client](int events) {
-    Status s = ProcessMessage(client);
-    if (!s.ok()) {
-      ARROW_LOG(FATAL) << "Failed to process file event: " << s;
-    }
+  RunInLoop(loop, [this, loop, client, client_fd]() {
+    // TODO(pcm): Check return value.
+    loop->AddFileEvent(client_fd, kEventLoopRead, [this, client](int events) {
+      Status s = ProcessMessage(client);
+      if (!s.ok()) {
+        ARROW_LOG(FATAL) << "Failed to process file event: " << s;
+      }
+    });
   });
   ARROW_LOG(DEBUG) << "New connection with fd " << client_fd;
 }
@@ -687,7 +991,7 @@ void PlasmaStore::DisconnectClient(int client_fd) {
   ARROW_CHECK(client_fd > 0);
   auto it = connected_clients_.find(client_fd);
   ARROW_CHECK(it != connected_clients_.end());
-  loop_->RemoveFileEvent(client_fd);
+  it->second->loop->RemoveFileEvent(client_fd);
   // Close the socket.
   close(client_fd);
   ARROW_LOG(INFO) << "Disconnecting client on fd " << client_fd;
@@ -712,6 +1016,13 @@ void PlasmaStore::DisconnectClient(int client_fd) {
 
   /// Remove all of the client's GetRequests.
   RemoveGetRequestsForClient(client);
+  // Drop the client's requests that wait for memory.
+  parked_requests_.erase(
+      std::remove_if(parked_requests_.begin(), parked_requests_.end(),
+                     [client](const ParkedRequest& request) {
+                       return request.client == client;
+                     }),
+      parked_requests_.end());
 
   for (const auto& entry : sealed_objects) {
     RemoveFromClientObjectIds(entry.first, entry.second, client);
@@ -720,7 +1031,7 @@ void PlasmaStore::DisconnectClient(int client_fd) {
   if (client->notification_fd > 0) {
     // This client has subscribed for notifications.
     auto notify_fd = client->notification_fd;
-    loop_->RemoveFileEvent(notify_fd);
+    client->loop->RemoveFileEvent(notify_fd);
     // Close socket.
     close(notify_fd);
     // Remove notification queue for this fd from global map.
@@ -744,7 +1055,9 @@ void PlasmaStore::DisconnectClient(int client_fd) {
 PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
     PlasmaStore::NotificationMap::iterator it) {
   int client_fd = it->first;
-  auto& notifications = it->second.object_notifications;
+  NotificationQueue& queue = it->second;
+  EventLoop* loop = queue.loop;
+  auto& notifications = queue.object_notifications;
 
   int num_processed = 0;
   bool closed = false;
@@ -763,15 +1076,13 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
                (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) {
       ARROW_LOG(DEBUG) << "The socket's send buffer is full, so we are caching this "
                           "notification and will send it later.";
-      // Add a callback to the event loop to send queued notifications whenever
-      // there is room in the socket's send buffer. Callbacks can be added
-      // more than once here and will be overwritten. The callback is removed
-      // at the end of the method.
-      // TODO(pcm): Introduce status codes and check in case the file descriptor
-      // is added twice.
-      loop_->AddFileEvent(client_fd, kEventLoopWrite, [this, client_fd](int events) {
-        SendNotifications(pending_notifications_.find(client_fd));
-      });
+      // Add a callback to the event loop of the subscriber to send queued
+      // notifications whenever there is room in the socket's send buffer. The
+      // callback is removed once the queue is empty.
+      if (!queue.write_event) {
+        queue.write_event = true;
+        UpdateWriteEvent(loop, client_fd);
+      }
       break;
     } else {
       ARROW_LOG(WARNING) << "Failed to send notification to client on fd " << client_fd;
@@ -781,44 +1092,190 @@ PlasmaStore::NotificationMap::iterator PlasmaStore::SendNotifications(
       }
     }
     num_processed += 1;
+    queue.num_bytes -= sizeof(int64_t) + size;
   }
   // Remove the sent notifications from the array.
   notifications.erase(notifications.begin(), notifications.begin() + num_processed);
 
+  // Rather than queueing notifications without bound for a subscriber that
+  // does not keep up, make it subscribe again.
+  if (!closed && max_notification_backlog_bytes_ > 0 &&
+      queue.num_bytes > max_notification_backlog_bytes_) {
+    ARROW_LOG(WARNING) << "Disconnecting the subscriber on fd " << client_fd
+                       << ", which is " << queue.num_bytes
+                       << " bytes of notifications behind";
+    *num_dropped_subscribers_ += 1;
+    closed = true;
+  }
+
   // If we have sent all notifications, remove the fd from the event loop.
-  if (notifications.empty()) {
-    loop_->RemoveFileEvent(client_fd);
+  if (notifications.empty() && queue.write_event) {
+    queue.write_event = false;
+    UpdateWriteEvent(loop, client_fd);
   }
 
   // Stop sending notifications if the pipe was broken.
   if (closed) {
-    close(client_fd);
-    return pending_notifications_.erase(it);
+    return DropSubscriber(it);
   } else {
     return ++it;
   }
 }
 
+PlasmaStore::NotificationMap::iterator PlasmaStore::DropSubscriber(
+    PlasmaStore::NotificationMap::iterator it) {
+  int client_fd = it->first;
+  EventLoop* loop = it->second.loop;
+  if (it->second.write_event) {
+    RunInLoop(loop, [loop, client_fd]() { loop->RemoveFileEvent(client_fd); });
+  }
+  close(client_fd);
+  // Let the client subscribe again.
+  for (auto& client : connected_clients_) {
+    if (client.second->notification_fd == client_fd) {
+      client.second->notification_fd = -1;
+    }
+  }
+  return pending_notifications_.erase(it);
+}
+
+void PlasmaStore::UpdateWriteEvent(EventLoop* loop, int client_fd) {
+  auto update = [this, loop, client_fd](bool write_event) {
+    if (write_event) {
+      loop->AddFileEvent(client_fd, kEventLoopWrite, [this, client_fd](int events) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = pending_notifications_.find(client_fd);
+        if (it != pending_notifications_.end()) {
+          SendNotifications(it);
+        }
+      });
+    } else {
+      loop->RemoveFileEvent(client_fd);
+    }
+  };
+  if (loop->IsLoopThread()) {
+    update(pending_notifications_.at(client_fd).write_event);
+  } else {
+    // By the time the loop runs this, the queue may have changed again or
+    // been removed along with its subscriber.
+    loop->Post([this, client_fd, update]() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = pending_notifications_.find(client_fd);
+      if (it != pending_notifications_.end()) {
+        update(it->second.write_event);
+      }
+    });
+  }
+}
+
+void PlasmaStore::AppendNotification(NotificationQueue* queue,
+                                     std::unique_ptr<uint8_t[]> notification) {
+  queue->num_bytes += sizeof(int64_t) + *reinterpret_cast<int64_t*>(notification.get());
+  queue->object_notifications.emplace_back(std::move(notification));
+  *max_notification_backlog_ =
+      std::max(*max_notification_backlog_,
+               static_cast<int64_t>(queue->object_notifications.size()));
+}
+
 void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info) {
+  // The batched subscribers share one copy of the notification.
+  std::shared_ptr<fb::ObjectInfoT> shared_info;
   auto it = pending_notifications_.begin();
   while (it != pending_notifications_.end()) {
-    auto notification = CreateObjectInfoBuffer(object_info);
-    it->second.object_notifications.emplace_back(std::move(notification));
-    it = SendNotifications(it);
+    NotificationQueue& queue = it->second;
+    if (!queue.batched) {
+      AppendNotification(&queue, CreateObjectInfoBuffer(object_info));
+      it = SendNotifications(it);
+      continue;
+    }
+    if (object_info->is_deletion) {
+      // The subscriber need not hear about an object that was deleted before
+      // the batch it was sealed in was sent.
+      auto sealed = std::find_if(
+          queue.batch.begin(), queue.batch.end(),
+          [object_info](const std::shared_ptr<fb::ObjectInfoT>& info) {
+            return !info->is_deletion && info->object_id == object_info->object_id;
+          });
+      if (sealed != queue.batch.end()) {
+        queue.batch.erase(sealed);
+        *num_coalesced_notifications_ += 2;
+        ++it;
+        continue;
+      }
+    }
+    if (shared_info == nullptr) {
+      shared_info = std::make_shared<fb::ObjectInfoT>(*object_info);
+    }
+    queue.batch.push_back(shared_info);
+    if (queue.batch.size() >= kMaxNotificationBatchSize) {
+      it = FlushNotificationBatch(it);
+    } else {
+      ScheduleNotificationFlush();
+      ++it;
+    }
   }
 }
 
 void PlasmaStore::PushNotification(fb::ObjectInfoT* object_info, int client_fd) {
   auto it = pending_notifications_.find(client_fd);
-  if (it != pending_notifications_.end()) {
-    auto notification = CreateObjectInfoBuffer(object_info);
-    it->second.object_notifications.emplace_back(std::move(notification));
+  if (it == pending_notifications_.end()) {
+    return;
+  }
+  if (it->second.batched) {
+    it->second.batch.push_back(std::make_shared<fb::ObjectInfoT>(*object_info));
+    if (it->second.batch.size() >= kMaxNotificationBatchSize) {
+      FlushNotificationBatch(it);
+    }
+  } else {
+    AppendNotification(&it->second, CreateObjectInfoBuffer(object_info));
     SendNotifications(it);
   }
 }
 
+PlasmaStore::NotificationMap::iterator PlasmaStore::FlushNotificationBatch(
+    PlasmaStore::NotificationMap::iterator it) {
+  NotificationQueue& queue = it->second;
+  if (queue.batch.empty()) {
+    return ++it;
+  }
+  AppendNotification(&queue, CreateObjectInfoBatchBuffer(queue.batch));
+  queue.batch.clear();
+  return SendNotifications(it);
+}
+
+void PlasmaStore::FlushNotificationBatches() {
+  notification_flush_scheduled_ = false;
+  auto it = pending_notifications_.begin();
+  while (it != pending_notifications_.end()) {
+    it = FlushNotificationBatch(it);
+  }
+}
+
+void PlasmaStore::ScheduleNotificationFlush() {
+  if (notification_flush_scheduled_) {
+    return;
+  }
+  notification_flush_scheduled_ = true;
+  auto flush = [this]() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    FlushNotificationBatches();
+  };
+  if (notification_batch_interval_ms_ == 0) {
+    // The loop runs posted tasks after the request being handled.
+    loop_->Post(flush);
+  } else {
+    int64_t interval_ms = notification_batch_interval_ms_;
+    RunInLoop(loop_, [this, interval_ms, flush]() {
+      loop_->AddTimer(interval_ms, [flush](int64_t timer_id) {
+        flush();
+        return kEventLoopTimerDone;
+      });
+    });
+  }
+}
+
 // Subscribe to notifications about sealed objects.
-void PlasmaStore::SubscribeToUpdates(Client* client) {
+void PlasmaStore::SubscribeToUpdates(Client* client, bool batched) {
   ARROW_LOG(DEBUG) << "subscribing to updates on fd " << client->fd;
   if (client->notification_fd > 0) {
     // This client has already subscribed. Return.
@@ -836,7 +1293,9 @@ void PlasmaStore::SubscribeToUpdates(Client* client) {
   }
 
   // Add this fd to global map, which is needed for this client to receive notifications.
-  pending_notifications_[fd];
+  NotificationQueue& queue = pending_notifications_[fd];
+  queue.loop = client->loop;
+  queue.batched = batched;
   client->notification_fd = fd;
 
   // Push notifications to the new subscriber about existing sealed objects.
@@ -851,15 +1310,81 @@ void PlasmaStore::SubscribeToUpdates(Client* client) {
       PushNotification(&info, fd);
     }
   }
+  if (batched) {
+    auto it = pending_notifications_.find(fd);
+    if (it != pending_notifications_.end()) {
+      FlushNotificationBatch(it);
+    }
+  }
 }
 
 Status PlasmaStore::ProcessMessage(Client* client) {
   fb::MessageType type;
-  Status s = ReadMessage(client->fd, &type, &input_buffer_);
+  Status s = ReadMessage(client->fd, &type, &client->input_buffer);
   ARROW_CHECK(s.ok() || s.IsIOError());
 
-  uint8_t* input = input_buffer_.data();
-  size_t input_size = input_buffer_.size();
+  // The latency includes the wait for requests read by other threads.
+  auto start = std::chrono::steady_clock::now();
+  std::lock_guard<std::mutex> lock(mutex_);
+  s = ProcessRequest(client, type, client->input_buffer.data(),
+                     client->input_buffer.size());
+  RecordLatency(type, start);
+  return s;
+}
+
+void PlasmaStore::RecordLatency(fb::MessageType type,
+                                std::chrono::steady_clock::time_point start) {
+  LatencyHistogram*& histogram = request_latencies_[static_cast<int64_t>(type)];
+  if (histogram == nullptr) {
+    histogram = metrics_.Latency(fb::EnumNameMessageType(type));
+  }
+  histogram->Record(std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now() - start)
+                        .count());
+}
+
+void PlasmaStore::GetMetrics(PlasmaStoreMetrics* metrics) {
+  *metrics_.Value("objects") = static_cast<int64_t>(store_info_.objects.size());
+  *metrics_.Value("clients") = static_cast<int64_t>(connected_clients_.size());
+  *metrics_.Value("waiting_get_requests") = static_cast<int64_t>(get_requests_.size());
+  *metrics_.Value("parked_create_requests") =
+      static_cast<int64_t>(parked_requests_.size());
+  *metrics_.Value("pending_spills") = num_pending_spills_;
+  *metrics_.Value("spilling_bytes") = num_spilling_bytes_;
+  int64_t notification_backlog = 0;
+  for (const auto& queue : pending_notifications_) {
+    notification_backlog += static_cast<int64_t>(queue.second.object_notifications.size());
+  }
+  *metrics_.Value("subscribers") = static_cast<int64_t>(pending_notifications_.size());
+  *metrics_.Value("notification_backlog") = notification_backlog;
+  PlasmaAllocatorStats stats;
+  PlasmaAllocator::GetStats(&stats);
+  *metrics_.Value("allocated_bytes") = stats.allocated;
+  *metrics_.Value("footprint_limit") = stats.footprint_limit;
+  *metrics_.Value("free_bytes") = stats.free_bytes;
+  *metrics_.Value("largest_free_block") = stats.largest_free_block;
+  *metrics_.Value("free_blocks") = stats.num_free_blocks;
+  *metrics_.Value("slab_bytes") = stats.slab_bytes;
+#ifdef PLASMA_CUDA
+  *metrics_.Value("cuda_reserved_bytes") = CudaMemoryPool::GetReserved();
+  *metrics_.Value("cuda_allocated_bytes") = CudaMemoryPool::GetAllocated();
+#endif
+  metrics_.Snapshot(metrics);
+}
+
+bool PlasmaStore::ParkIfSpilling(PlasmaError error_code, Client* client,
+                                 fb::MessageType type, const uint8_t* input,
+                                 size_t input_size) {
+  if (error_code != PlasmaError::OutOfMemory || num_pending_spills_ == 0) {
+    return false;
+  }
+  parked_requests_.push_back(
+      {client, type, std::vector<uint8_t>(input, input + input_size)});
+  return true;
+}
+
+Status PlasmaStore::ProcessRequest(Client* client, fb::MessageType type,
+                                   uint8_t* input, size_t input_size) {
   ObjectID object_id;
   PlasmaObject object = {};
 
@@ -869,10 +1394,17 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       int64_t data_size;
       int64_t metadata_size;
       int device_num;
+      int64_t priority;
+      int numa_node;
       RETURN_NOT_OK(ReadCreateRequest(input, input_size, &object_id, &data_size,
-                                      &metadata_size, &device_num));
+                                      &metadata_size, &device_num, &priority,
+                                      &numa_node));
       PlasmaError error_code =
-          CreateObject(object_id, data_size, metadata_size, device_num, client, &object);
+          CreateObject(object_id, data_size, metadata_size, device_num, priority,
+                       numa_node, client, &object);
+      if (ParkIfSpilling(error_code, client, type, input, input_size)) {
+        break;
+      }
       int64_t mmap_size = 0;
       if (error_code == PlasmaError::OK && device_num == 0) {
         mmap_size = GetMmapSize(object.store_fd);
@@ -888,6 +1420,54 @@ Status PlasmaStore::ProcessMessage(Client* client) {
         client->used_fds.insert(object.store_fd);
       }
     } break;
+    case fb::MessageType::PlasmaCreateManyRequest: {
+      std::vector<ObjectID> object_ids;
+      std::vector<int64_t> data_sizes;
+      std::vector<int64_t> metadata_sizes;
+      int numa_node;
+      RETURN_NOT_OK(ReadCreateManyRequest(input, input_size, &object_ids, &data_sizes,
+                                          &metadata_sizes, &numa_node));
+      // Either all of the objects are created or none of them is.
+      std::vector<PlasmaObject> objects(object_ids.size());
+      PlasmaError error_code = PlasmaError::OK;
+      size_t num_created = 0;
+      for (; num_created < object_ids.size(); ++num_created) {
+        error_code = CreateObject(object_ids[num_created], data_sizes[num_created],
+                                  metadata_sizes[num_created], 0, 0, numa_node,
+                                  client, &objects[num_created]);
+        if (error_code != PlasmaError::OK) {
+          break;
+        }
+      }
+      if (error_code != PlasmaError::OK) {
+        for (size_t i = 0; i < num_created; ++i) {
+          AbortObject(object_ids[i], client);
+        }
+        if (ParkIfSpilling(error_code, client, type, input, input_size)) {
+          break;
+        }
+        object_ids.clear();
+        objects.clear();
+      }
+      std::unordered_set<int> fds_to_send;
+      std::vector<int> store_fds;
+      std::vector<int64_t> mmap_sizes;
+      for (const PlasmaObject& created : objects) {
+        if (fds_to_send.insert(created.store_fd).second) {
+          store_fds.push_back(created.store_fd);
+          mmap_sizes.push_back(GetMmapSize(created.store_fd));
+        }
+      }
+      HANDLE_SIGPIPE(SendCreateManyReply(client->fd, object_ids, objects, error_code,
+                                         store_fds, mmap_sizes),
+                     client->fd);
+      for (int store_fd : store_fds) {
+        if (client->used_fds.find(store_fd) == client->used_fds.end()) {
+          WarnIfSigpipe(send_fd(client->fd, store_fd), client->fd);
+          client->used_fds.insert(store_fd);
+        }
+      }
+    } break;
     case fb::MessageType::PlasmaCreateAndSealRequest: {
       std::string data;
       std::string metadata;
@@ -898,7 +1478,10 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       // to the host.
       int device_num = 0;
       PlasmaError error_code = CreateObject(object_id, data.size(), metadata.size(),
-                                            device_num, client, &object);
+                                            device_num, 0, -1, client, &object);
+      if (ParkIfSpilling(error_code, client, type, input, input_size)) {
+        break;
+      }
       // Reply to the client.
       HANDLE_SIGPIPE(SendCreateAndSealReply(client->fd, error_code), client->fd);
 
@@ -927,13 +1510,40 @@ Status PlasmaStore::ProcessMessage(Client* client) {
     case fb::MessageType::PlasmaGetRequest: {
       std::vector<ObjectID> object_ids_to_get;
       int64_t timeout_ms;
-      RETURN_NOT_OK(ReadGetRequest(input, input_size, object_ids_to_get, &timeout_ms));
-      ProcessGetRequest(client, object_ids_to_get, timeout_ms);
+      int numa_node;
+      RETURN_NOT_OK(ReadGetRequest(input, input_size, object_ids_to_get, &timeout_ms,
+                                   &numa_node));
+      ProcessGetRequest(client, object_ids_to_get, timeout_ms, numa_node);
+    } break;
+    case fb::MessageType::PlasmaPrefetchRequest: {
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadPrefetchRequest(input, input_size, &object_ids));
+      RestoreObjects(object_ids);
     } break;
     case fb::MessageType::PlasmaReleaseRequest: {
       RETURN_NOT_OK(ReadReleaseRequest(input, input_size, &object_id));
       ReleaseObject(object_id, client);
     } break;
+    case fb::MessageType::PlasmaPinRequest: {
+      // The client pinned these objects through the object directory. Record
+      // that it is using them, so that they are released if it disconnects.
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadPinRequest(input, input_size, &object_ids));
+      for (const auto& object_id : object_ids) {
+        auto entry = GetObjectTableEntry(&store_info_, object_id);
+        ARROW_CHECK(entry != nullptr && entry->state == ObjectState::PLASMA_SEALED)
+            << "To pin an object it must be sealed";
+        AddToClientObjectIds(object_id, entry, client);
+        object_directory_->Unpin(object_id);
+      }
+    } break;
+    case fb::MessageType::PlasmaReleaseManyRequest: {
+      std::vector<ObjectID> object_ids;
+      RETURN_NOT_OK(ReadReleaseManyRequest(input, input_size, &object_ids));
+      for (const auto& object_id : object_ids) {
+        ReleaseObject(object_id, client);
+      }
+    } break;
     case fb::MessageType::PlasmaDeleteRequest: {
       std::vector<ObjectID> object_ids;
       std::vector<PlasmaError> error_codes;
@@ -961,22 +1571,48 @@ Status PlasmaStore::ProcessMessage(Client* client) {
       RETURN_NOT_OK(ReadSealRequest(input, input_size, &object_id, &digest[0]));
       SealObject(object_id, &digest[0]);
     } break;
+    case fb::MessageType::PlasmaSealManyRequest: {
+      std::vector<ObjectID> object_ids;
+      std::vector<std::string> digests;
+      RETURN_NOT_OK(ReadSealManyRequest(input, input_size, &object_ids, &digests));
+      unsigned char digest[kDigestSize];
+      for (size_t i = 0; i < object_ids.size(); ++i) {
+        std::memcpy(&digest[0], digests[i].data(), kDigestSize);
+        SealObject(object_ids[i], &digest[0]);
+      }
+    } break;
     case fb::MessageType::PlasmaEvictRequest: {
       // This code path should only be used for testing.
       int64_t num_bytes;
       RETURN_NOT_OK(ReadEvictRequest(input, input_size, &num_bytes));
       std::vector<ObjectID> objects_to_evict;
       int64_t num_bytes_evicted =
-          eviction_policy_.ChooseObjectsToEvict(num_bytes, &objects_to_evict);
+          eviction_policy_->ChooseObjectsToEvict(num_bytes, &objects_to_evict);
       EvictObjects(objects_to_evict);
       HANDLE_SIGPIPE(SendEvictReply(client->fd, num_bytes_evicted), client->fd);
     } break;
-    case fb::MessageType::PlasmaSubscribeRequest:
-      SubscribeToUpdates(client);
-      break;
+    case fb::MessageType::PlasmaSubscribeRequest: {
+      bool batched;
+      RETURN_NOT_OK(ReadSubscribeRequest(input, input_size, &batched));
+      SubscribeToUpdates(client, batched);
+    } break;
+    case fb::MessageType::PlasmaMetricsRequest: {
+      RETURN_NOT_OK(ReadMetricsRequest(input, input_size));
+      PlasmaStoreMetrics metrics;
+      GetMetrics(&metrics);
+      HANDLE_SIGPIPE(SendMetricsReply(client->fd, metrics), client->fd);
+    } break;
     case fb::MessageType::PlasmaConnectRequest: {
-      HANDLE_SIGPIPE(SendConnectReply(client->fd, PlasmaAllocator::GetFootprintLimit()),
+      HANDLE_SIGPIPE(SendConnectReply(client->fd, PlasmaAllocator::GetFootprintLimit(),
+                                      object_directory_fd_, object_directory_map_size_,
+                                      object_directory_offset_,
+                                      object_directory_capacity_),
                      client->fd);
+      if (object_directory_fd_ != -1 &&
+          client->used_fds.find(object_directory_fd_) == client->used_fds.end()) {
+        WarnIfSigpipe(send_fd(client->fd, object_directory_fd_), client->fd);
+        client->used_fds.insert(object_directory_fd_);
+      }
     } break;
     case fb::MessageType::PlasmaDisconnectClient:
       ARROW_LOG(DEBUG) << "Disconnecting client on fd " << client->fd;
@@ -989,29 +1625,57 @@ Status PlasmaStore::ProcessMessage(Client* client) {
   return Status::OK();
 }
 
+/// Bounds of the number of objects the object directory can hold.
+constexpr int64_t kMinObjectDirectoryCapacity = 1 << 10;
+constexpr int64_t kMaxObjectDirectoryCapacity = 1 << 20;
+
 class PlasmaStoreRunner {
  public:
   PlasmaStoreRunner() {}
 
   void Start(char* socket_name, std::string directory, bool hugepages_enabled,
-             std::shared_ptr<ExternalStore> external_store) {
-    // Create the event loop.
+             std::shared_ptr<ExternalStore> external_store, int num_threads,
+             const std::string& eviction_policy, int64_t numa_replication_gets,
+             int64_t notification_batch_interval_ms,
+             int64_t max_notification_backlog_bytes) {
+    // Create the event loops. With a single thread, the loop accepting
+    // connections also serves the clients.
     loop_.reset(new EventLoop);
+    std::vector<EventLoop*> client_loops;
+    if (num_threads > 1) {
+      for (int i = 0; i < num_threads; ++i) {
+        client_loops_.emplace_back(new EventLoop);
+        client_loops.push_back(client_loops_.back().get());
+      }
+    }
     store_.reset(new PlasmaStore(loop_.get(), directory, hugepages_enabled, socket_name,
-                                 external_store));
+                                 external_store, client_loops, eviction_policy));
     plasma_config = store_->GetPlasmaStoreInfo();
-
-    // We are using a single memory-mapped file by mallocing and freeing a single
-    // large amount of space up front. According to the documentation,
-    // dlmalloc might need up to 128*sizeof(size_t) bytes for internal
-    // bookkeeping.
-    void* pointer = plasma::PlasmaAllocator::Memalign(
-        kBlockSize, PlasmaAllocator::GetFootprintLimit() - 256 * sizeof(size_t));
-    ARROW_CHECK(pointer != nullptr);
-    // This will unmap the file, but the next one created will be as large
-    // as this one (this is an implementation detail of dlmalloc).
-    plasma::PlasmaAllocator::Free(
-        pointer, PlasmaAllocator::GetFootprintLimit() - 256 * sizeof(size_t));
+    store_->EnableNumaReplication(numa_replication_gets);
+    store_->ConfigureNotifications(notification_batch_interval_ms,
+                                   max_notification_backlog_bytes);
+
+    if (PlasmaAllocator::GetBackend() == AllocatorBackend::DLMALLOC) {
+      // We are using a single memory-mapped file by mallocing and freeing a
+      // single large amount of space up front. According to the documentation,
+      // dlmalloc might need up to 128*sizeof(size_t) bytes for internal
+      // bookkeeping.
+      void* pointer = plasma::PlasmaAllocator::Memalign(
+          kBlockSize, PlasmaAllocator::GetFootprintLimit() - 256 * sizeof(size_t));
+      ARROW_CHECK(pointer != nullptr);
+      // This will unmap the file, but the next one created will be as large
+      // as this one (this is an implementation detail of dlmalloc).
+      plasma::PlasmaAllocator::Free(
+          pointer, PlasmaAllocator::GetFootprintLimit() - 256 * sizeof(size_t));
+    }
+    // Clients map the object directory along with the objects in that file.
+    // Allow for one object of every 64KB of memory, within bounds.
+    int64_t directory_capacity = kMinObjectDirectoryCapacity;
+    while (directory_capacity < kMaxObjectDirectoryCapacity &&
+           directory_capacity * (1 << 16) < PlasmaAllocator::GetFootprintLimit()) {
+      directory_capacity *= 2;
+    }
+    store_->CreateObjectDirectory(directory_capacity);
 
     int socket = BindIpcSock(socket_name, true);
     // TODO(pcm): Check return value.
@@ -1020,19 +1684,37 @@ class PlasmaStoreRunner {
     loop_->AddFileEvent(socket, kEventLoopRead, [this, socket](int events) {
       this->store_->ConnectClient(socket);
     });
+    for (EventLoop* client_loop : client_loops) {
+      client_threads_.emplace_back([client_loop]() { client_loop->Start(); });
+    }
     loop_->Start();
   }
 
   void Stop() { loop_->Stop(); }
 
   void Shutdown() {
+    for (auto& client_loop : client_loops_) {
+      EventLoop* loop = client_loop.get();
+      loop->Post([loop]() { loop->Stop(); });
+    }
+    for (auto& thread : client_threads_) {
+      thread.join();
+    }
+    client_threads_.clear();
+    // The threads of the store post to the loops until it is destroyed.
+    store_ = nullptr;
     loop_->Shutdown();
+    for (auto& client_loop : client_loops_) {
+      client_loop->Shutdown();
+    }
+    client_loops_.clear();
     loop_ = nullptr;
-    store_ = nullptr;
   }
 
  private:
   std::unique_ptr<EventLoop> loop_;
+  std::vector<std::unique_ptr<EventLoop>> client_loops_;
+  std::vector<std::thread> client_threads_;
   std::unique_ptr<PlasmaStore> store_;
 };
 
@@ -1048,14 +1730,19 @@ void HandleSignal(int signal) {
 }
 
 void StartServer(char* socket_name, std::string plasma_directory, bool hugepages_enabled,
-                 std::shared_ptr<ExternalStore> external_store) {
+                 std::shared_ptr<ExternalStore> external_store, int num_threads,
+                 const std::string& eviction_policy, int64_t numa_replication_gets,
+                 int64_t notification_batch_interval_ms,
+                 int64_t max_notification_backlog_bytes) {
   // Ignore SIGPIPE signals. If we don't do this, then when we attempt to write
   // to a client that has already died, the store could die.
   signal(SIGPIPE, SIG_IGN);
 
   g_runner.reset(new PlasmaStoreRunner());
   signal(SIGTERM, HandleSignal);
-  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store);
+  g_runner->Start(socket_name, plasma_directory, hugepages_enabled, external_store,
+                  num_threads, eviction_policy, numa_replication_gets,
+                  notification_batch_interval_ms, max_notification_backlog_bytes);
 }
 
 }  // namespace plasma
@@ -1069,21 +1756,91 @@ int main(int argc, char* argv[]) {
   std::string external_store_endpoint;
   bool hugepages_enabled = false;
   int64_t system_memory = -1;
+  int num_threads = 1;
+  std::string eviction_policy = "lru";
+  int num_numa_nodes = 1;
+  int64_t numa_replication_gets = 0;
+  bool print_metrics = false;
+  int64_t notification_batch_interval_ms = 0;
+  int64_t max_notification_backlog_bytes = 0;
   int c;
-  while ((c = getopt(argc, argv, "s:m:d:e:h")) != -1) {
+  while ((c = getopt(argc, argv, "a:b:s:m:d:e:g:hl:n:p:qr:t:")) != -1) {
     switch (c) {
+      case 'a':
+        if (std::string(optarg) == "arena") {
+          plasma::PlasmaAllocator::SetBackend(plasma::AllocatorBackend::ARENA);
+        } else if (std::string(optarg) != "dlmalloc") {
+          ARROW_LOG(FATAL) << "No such allocator \"" << optarg << "\"";
+        }
+        break;
+      case 'b': {
+        char extra;
+        int scanned =
+            sscanf(optarg, "%" SCNd64 "%c", &notification_batch_interval_ms, &extra);
+        ARROW_CHECK(scanned == 1 && notification_batch_interval_ms >= 0);
+        break;
+      }
       case 'd':
         plasma_directory = std::string(optarg);
         break;
       case 'e':
         external_store_endpoint = std::string(optarg);
         break;
+      case 'g': {
+        // The size of the regions of device memory GPU objects are allocated
+        // from.
+        int64_t region_size;
+        char extra;
+        int scanned = sscanf(optarg, "%" SCNd64 "%c", &region_size, &extra);
+        ARROW_CHECK(scanned == 1 && region_size > 0);
+#ifdef PLASMA_CUDA
+        plasma::CudaMemoryPool::SetRegionSize(region_size);
+#else
+        ARROW_LOG(WARNING) << "Ignoring -g since the store was built without CUDA";
+#endif
+        break;
+      }
       case 'h':
         hugepages_enabled = true;
         break;
+      case 'l': {
+        char extra;
+        int scanned =
+            sscanf(optarg, "%" SCNd64 "%c", &max_notification_backlog_bytes, &extra);
+        ARROW_CHECK(scanned == 1 && max_notification_backlog_bytes >= 0);
+        break;
+      }
+      case 'n': {
+        // With 0, place objects on all of the NUMA nodes of the machine.
+        char extra;
+        int scanned = sscanf(optarg, "%d%c", &num_numa_nodes, &extra);
+        ARROW_CHECK(scanned == 1 && num_numa_nodes >= 0);
+        if (num_numa_nodes == 0) {
+          num_numa_nodes = plasma::NumNumaNodes();
+        }
+        break;
+      }
+      case 'q':
+        print_metrics = true;
+        break;
+      case 'r': {
+        char extra;
+        int scanned = sscanf(optarg, "%" SCNd64 "%c", &numa_replication_gets, &extra);
+        ARROW_CHECK(scanned == 1 && numa_replication_gets >= 0);
+        break;
+      }
+      case 'p':
+        eviction_policy = std::string(optarg);
+        break;
       case 's':
         socket_name = optarg;
         break;
+      case 't': {
+        char extra;
+        int scanned = sscanf(optarg, "%d%c", &num_threads, &extra);
+        ARROW_CHECK(scanned == 1 && num_threads > 0);
+        break;
+      }
       case 'm': {
         char extra;
         int scanned = sscanf(optarg, "%" SCNd64 "%c", &system_memory, &extra);
@@ -1103,6 +1860,18 @@ int main(int argc, char* argv[]) {
   if (!socket_name) {
     ARROW_LOG(FATAL) << "please specify socket for incoming connections with -s switch";
   }
+  if (print_metrics) {
+    // Print the metrics of the store that listens on the socket rather than
+    // starting one.
+    plasma::PlasmaClient client;
+    ARROW_CHECK_OK(client.Connect(socket_name, "", 0, 1));
+    plasma::PlasmaStoreMetrics metrics;
+    ARROW_CHECK_OK(client.Metrics(&metrics));
+    std::cout << metrics.ToString();
+    ARROW_CHECK_OK(client.Disconnect());
+    ArrowLog::ShutDownArrowLog();
+    return 0;
+  }
   if (system_memory == -1) {
     ARROW_LOG(FATAL) << "please specify the amount of system memory with -m switch";
   }
@@ -1110,6 +1879,16 @@ int main(int argc, char* argv[]) {
     ARROW_LOG(FATAL) << "if you want to use hugepages, please specify path to huge pages "
                         "filesystem with -d";
   }
+  if (num_numa_nodes > 1 &&
+      plasma::PlasmaAllocator::GetBackend() != plasma::AllocatorBackend::ARENA) {
+    ARROW_LOG(FATAL) << "placing objects on NUMA nodes with -n requires the arena "
+                        "allocator, please specify -a arena";
+  }
+  plasma::PlasmaAllocator::SetNumaNodes(num_numa_nodes);
+  if (num_numa_nodes > 1) {
+    ARROW_LOG(INFO) << "Splitting the memory of the store over " << num_numa_nodes
+                    << " NUMA nodes";
+  }
   if (plasma_directory.empty()) {
 #ifdef __linux__
     plasma_directory = "/dev/shm";
@@ -1159,7 +1938,9 @@ int main(int argc, char* argv[]) {
     ARROW_CHECK_OK(external_store->Connect(external_store_endpoint));
   }
   ARROW_LOG(DEBUG) << "starting server listening on " << socket_name;
-  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store);
+  plasma::StartServer(socket_name, plasma_directory, hugepages_enabled, external_store,
+                      num_threads, eviction_policy, numa_replication_gets,
+                      notification_batch_interval_ms, max_notification_backlog_bytes);
   plasma::g_runner->Shutdown();
   plasma::g_runner = nullptr;
 
@@ -18,17 +18,24 @@
 #ifndef PLASMA_STORE_H
 #define PLASMA_STORE_H
 
+#include <chrono>
 #include <deque>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
+#include "arrow/util/thread-pool.h"
+
 #include "plasma/common.h"
 #include "plasma/events.h"
 #include "plasma/eviction_policy.h"
 #include "plasma/external_store.h"
+#include "plasma/metrics.h"
+#include "plasma/object_directory.h"
 #include "plasma/plasma.h"
 #include "plasma/protocol.h"
 
@@ -49,18 +56,36 @@ using flatbuf::PlasmaError;
 struct GetRequest;
 
 struct NotificationQueue {
+  /// The event loop of the subscribed client, which waits for room in the
+  /// socket's send buffer.
+  EventLoop* loop = nullptr;
+  /// Whether the loop is waiting for room in the socket's send buffer.
+  bool write_event = false;
   /// The object notifications for clients. We notify the client about the
   /// objects in the order that the objects were sealed or deleted.
   std::deque<std::unique_ptr<uint8_t[]>> object_notifications;
+  /// The total size of object_notifications in bytes.
+  int64_t num_bytes = 0;
+  /// Whether the client receives the notifications in batches.
+  bool batched = false;
+  /// The notifications of a batched client that are not in a batch yet.
+  std::vector<std::shared_ptr<ObjectInfoT>> batch;
 };
 
 /// Contains all information that is associated with a Plasma store client.
 struct Client {
-  explicit Client(int fd);
+  Client(int fd, EventLoop* loop);
 
   /// The file descriptor used to communicate with the client.
   int fd;
 
+  /// The event loop that reads the requests of the client.
+  EventLoop* loop;
+
+  /// Input buffer. This is allocated only once to avoid mallocs for every
+  /// call to ProcessMessage.
+  std::vector<uint8_t> input_buffer;
+
   /// Object ids that are used by this client.
   std::unordered_set<ObjectID> object_ids;
 
@@ -72,14 +97,34 @@ struct Client {
   int notification_fd;
 };
 
+/// A create request that failed for lack of memory while objects were being
+/// spilled to the external store. It is handled again once they are.
+struct ParkedRequest {
+  Client* client;
+  MessageType type;
+  /// A copy of the message, since the input buffer of the client is reused.
+  std::vector<uint8_t> input;
+};
+
 class PlasmaStore {
  public:
   using NotificationMap = std::unordered_map<int, NotificationQueue>;
 
   // TODO: PascalCase PlasmaStore methods.
+  /// \param loop The event loop accepting connections.
+  /// \param client_loops The event loops serving the connected clients, which
+  ///        are distributed over them round-robin. If empty, loop serves them.
+  ///        Requests are read concurrently but handled one at a time.
+  /// \param eviction_policy The name of the eviction policy, see
+  ///        EvictionPolicy::Make.
+  ///
+  /// Objects are written to and read from external_store on background
+  /// threads, so its methods may be called concurrently.
   PlasmaStore(EventLoop* loop, std::string directory, bool hugepages_enabled,
               const std::string& socket_name,
-              std::shared_ptr<ExternalStore> external_store);
+              std::shared_ptr<ExternalStore> external_store,
+              const std::vector<EventLoop*>& client_loops = {},
+              const std::string& eviction_policy = "lru");
 
   ~PlasmaStore();
 
@@ -97,6 +142,9 @@ class PlasmaStore {
   ///        device_num = 0 corresponds to the host,
   ///        device_num = 1 corresponds to GPU0,
   ///        device_num = 2 corresponds to GPU1, etc.
+  /// @param priority The priority hint of the object for the eviction policy.
+  /// @param numa_node The NUMA node to place the object on if there is room,
+  ///        or -1 for any.
   /// @param client The client that created the object.
   /// @param result The object that has been created.
   /// @return One of the following error codes:
@@ -108,8 +156,8 @@ class PlasmaStore {
   ///    cannot create the object. In this case, the client should not call
   ///    plasma_release.
   PlasmaError CreateObject(const ObjectID& object_id, int64_t data_size,
-                           int64_t metadata_size, int device_num, Client* client,
-                           PlasmaObject* result);
+                           int64_t metadata_size, int device_num, int64_t priority,
+                           int numa_node, Client* client, PlasmaObject* result);
 
   /// Abort a created but unsealed object. If the client is not the
   /// creator, then the abort will fail.
@@ -129,15 +177,20 @@ class PlasmaStore {
   ///  - PlasmaError::ObjectInUse, if the object is in use.
   PlasmaError DeleteObject(ObjectID& object_id);
 
-  /// Evict objects returned by the eviction policy.
+  /// Evict objects returned by the eviction policy. Objects that clients
+  /// have pinned through the object directory are returned to the eviction
+  /// policy instead. With an external store, the objects are spilled to it
+  /// in the background and their memory is freed once they are written.
   ///
   /// @param object_ids Object IDs of the objects to be evicted.
-  void EvictObjects(const std::vector<ObjectID>& object_ids);
+  /// @return The number of objects that were evicted.
+  size_t EvictObjects(const std::vector<ObjectID>& object_ids);
 
   /// Process a get request from a client. This method assumes that we will
   /// eventually have these objects sealed. If one of the objects has not yet
   /// been sealed, the client that requested the object will be notified when it
-  /// is sealed.
+  /// is sealed. Objects evicted to the external store are restored, and the
+  /// client is likewise notified when they are.
   ///
   /// For each object, the client must do a call to release_object to tell the
   /// store when it is done with the object.
@@ -145,8 +198,16 @@ class PlasmaStore {
   /// @param client The client making this request.
   /// @param object_ids Object IDs of the objects to be gotten.
   /// @param timeout_ms The timeout for the get request in milliseconds.
+  /// @param numa_node The NUMA node of the client, whose copies of the objects
+  ///        are returned if there are any, or -1 if it is unknown.
   void ProcessGetRequest(Client* client, const std::vector<ObjectID>& object_ids,
-                         int64_t timeout_ms);
+                         int64_t timeout_ms, int numa_node);
+
+  /// Start restoring objects that were evicted to the external store, if
+  /// there is memory for them. Other objects are ignored.
+  ///
+  /// @param object_ids Object IDs of the objects to be restored.
+  void RestoreObjects(const std::vector<ObjectID>& object_ids);
 
   /// Seal an object. The object is now immutable and can be accessed with get.
   ///
@@ -171,7 +232,35 @@ class PlasmaStore {
   /// Subscribe a file descriptor to updates about new sealed objects.
   ///
   /// @param client The client making this request.
-  void SubscribeToUpdates(Client* client);
+  /// @param batched Whether to send the notifications in batches, see
+  ///        ConfigureNotifications.
+  void SubscribeToUpdates(Client* client, bool batched);
+
+  /// Allocate the object directory, through which clients get sealed objects
+  /// without a round trip to the store. This must be called before clients
+  /// connect.
+  ///
+  /// @param capacity The number of objects the directory can hold, a power of
+  ///        two.
+  void CreateObjectDirectory(int64_t capacity);
+
+  /// Copy objects that clients on another NUMA node get often to that node,
+  /// if it has free memory. Clients on the node then get the copy.
+  ///
+  /// @param num_gets The number of gets from a node after which an object is
+  ///        copied to it, or 0 to never copy objects.
+  void EnableNumaReplication(int64_t num_gets);
+
+  /// Set how notifications are delivered to subscribers.
+  ///
+  /// @param batch_interval_ms How long the notifications of batched
+  ///        subscribers are collected before they are sent as one message, or
+  ///        0 to send them once the store handled the current request. A
+  ///        seal and a deletion of the same object in a batch cancel out.
+  /// @param max_backlog_bytes The size of the unsent notifications of a
+  ///        subscriber after which it is disconnected, or 0 for no limit. It
+  ///        may subscribe again to be told about the sealed objects.
+  void ConfigureNotifications(int64_t batch_interval_ms, int64_t max_backlog_bytes);
 
   /// Connect a new client to the PlasmaStore.
   ///
@@ -185,13 +274,66 @@ class PlasmaStore {
 
   NotificationMap::iterator SendNotifications(NotificationMap::iterator it);
 
+  /// Get the metrics of the store, with the gauges set to their current
+  /// values.
+  ///
+  /// @param metrics The metrics.
+  void GetMetrics(PlasmaStoreMetrics* metrics);
+
   arrow::Status ProcessMessage(Client* client);
 
  private:
+  /// Handle a message read from a client.
+  arrow::Status ProcessRequest(Client* client, MessageType type, uint8_t* input,
+                               size_t input_size);
+
+  /// Handle a create request again later if it ran out of memory while objects
+  /// are spilled, which may free enough of it.
+  ///
+  /// @return true if the request was parked, in which case it must not be
+  ///         replied to.
+  bool ParkIfSpilling(PlasmaError error_code, Client* client, MessageType type,
+                      const uint8_t* input, size_t input_size);
+
+  /// Called on the store's loop once the external store wrote spilled objects.
+  void FinishSpill(const std::vector<ObjectID>& object_ids, int64_t num_bytes,
+                   const Status& status);
+
+  /// Called on the store's loop once the external store read restored objects.
+  void FinishRestore(const std::vector<ObjectID>& object_ids, const Status& status);
+
   void PushNotification(ObjectInfoT* object_notification);
 
+  /// Count how long a request of a type took to handle since start.
+  void RecordLatency(MessageType type, std::chrono::steady_clock::time_point start);
+
+  /// Make the event loop of a subscriber wait for room in its socket's send
+  /// buffer, or stop it waiting, as its notification queue requires.
+  void UpdateWriteEvent(EventLoop* loop, int client_fd);
+
   void PushNotification(ObjectInfoT* object_notification, int client_fd);
 
+  /// Queue a notification for a subscriber, counting its size.
+  void AppendNotification(NotificationQueue* queue,
+                          std::unique_ptr<uint8_t[]> notification);
+
+  /// Queue the batch of a subscriber as one notification and send it.
+  ///
+  /// @return Iterator pointing to the next subscriber.
+  NotificationMap::iterator FlushNotificationBatch(NotificationMap::iterator it);
+
+  /// Send the batches of all subscribers.
+  void FlushNotificationBatches();
+
+  /// Make the store's loop flush the batches once the batch interval passed,
+  /// unless it is going to already.
+  void ScheduleNotificationFlush();
+
+  /// Close the notification socket of a subscriber and forget its queue.
+  ///
+  /// @return Iterator pointing to the next subscriber.
+  NotificationMap::iterator DropSubscriber(NotificationMap::iterator it);
+
   void AddToClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
                             Client* client);
 
@@ -212,42 +354,104 @@ class PlasmaStore {
   int RemoveFromClientObjectIds(const ObjectID& object_id, ObjectTableEntry* entry,
                                 Client* client);
 
-  uint8_t* AllocateMemory(size_t size, int* fd, int64_t* map_size, ptrdiff_t* offset);
-#ifdef PLASMA_CUDA
-  Status AllocateCudaMemory(int device_num, int64_t size, uint8_t** out_pointer,
-                            std::shared_ptr<CudaIpcMemHandle>* out_ipc_handle);
-#endif
+  /// Make a sealed object visible to clients in the object directory.
+  void AddToObjectDirectory(const ObjectID& object_id, ObjectTableEntry* entry);
+
+  /// Remove an object from the object directory.
+  ///
+  /// @return false if a client has pinned the object through the directory.
+  bool RemoveFromObjectDirectory(const ObjectID& object_id);
+
+  uint8_t* AllocateMemory(size_t size, int* fd, int64_t* map_size, ptrdiff_t* offset,
+                          int numa_node);
+
+  /// Count a get of a sealed object by a client on numa_node, and copy the
+  /// object to that node once it was gotten often enough there.
+  void ReplicateIfHot(ObjectTableEntry* entry, int numa_node);
+
+  /// Free the copies of an object on other NUMA nodes.
+  void FreeReplicas(ObjectTableEntry* entry);
+
+  /// Run a function on the thread of an event loop, right away if it is the
+  /// calling thread.
+  void RunInLoop(EventLoop* loop, const std::function<void()>& function);
 
   /// Event loop of the plasma store.
   EventLoop* loop_;
+  /// Event loops serving the clients.
+  std::vector<EventLoop*> client_loops_;
+  /// Index in client_loops_ of the loop serving the next client.
+  size_t next_client_loop_;
+  /// Guards all of the state below against the client loops.
+  std::mutex mutex_;
   /// The plasma store information, including the object tables, that is exposed
   /// to the eviction policy.
   PlasmaStoreInfo store_info_;
   /// The state that is managed by the eviction policy.
-  EvictionPolicy eviction_policy_;
-  /// Input buffer. This is allocated only once to avoid mallocs for every
-  /// call to process_message.
-  std::vector<uint8_t> input_buffer_;
+  std::unique_ptr<EvictionPolicy> eviction_policy_;
   /// A hash table mapping object IDs to a vector of the get requests that are
   /// waiting for the object to arrive.
   std::unordered_map<ObjectID, std::vector<GetRequest*>> object_get_requests_;
+  /// The get requests that have not returned yet by ID, which their timers
+  /// look up since they may fire after the request returned on another thread.
+  std::unordered_map<int64_t, GetRequest*> get_requests_;
+  int64_t next_get_request_id_;
   /// The pending notifications that have not been sent to subscribers because
   /// the socket send buffers were full. This is a hash table from client file
   /// descriptor to an array of object_ids to send to that client.
   /// TODO(pcm): Consider putting this into the Client data structure and
   /// reorganize the code slightly.
   NotificationMap pending_notifications_;
+  /// How long notifications are batched for and the backlog of a subscriber
+  /// it is disconnected at, see ConfigureNotifications.
+  int64_t notification_batch_interval_ms_;
+  int64_t max_notification_backlog_bytes_;
+  /// Whether the store's loop is going to flush the batches.
+  bool notification_flush_scheduled_;
 
   std::unordered_map<int, std::unique_ptr<Client>> connected_clients_;
 
   std::unordered_set<ObjectID> deletion_cache_;
 
+  /// The shared-memory directory of sealed objects, or null if there is none.
+  std::unique_ptr<ObjectDirectory> object_directory_;
+  /// Where the memory of the directory is mapped, to tell connecting clients.
+  int object_directory_fd_;
+  int64_t object_directory_map_size_;
+  ptrdiff_t object_directory_offset_;
+  int64_t object_directory_capacity_;
+
+  /// The store objects are evicted to, or null if they are deleted.
+  std::shared_ptr<ExternalStore> external_store_;
   /// Manages worker threads for handling asynchronous/multi-threaded requests
   /// for reading/writing data to/from external store.
-  std::shared_ptr<ExternalStore> external_store_;
-#ifdef PLASMA_CUDA
-  arrow::cuda::CudaDeviceManager* manager_;
-#endif
+  std::shared_ptr<arrow::internal::ThreadPool> external_store_threads_;
+  /// The number of batches of objects being spilled, and their total size.
+  int64_t num_pending_spills_;
+  int64_t num_spilling_bytes_;
+  /// Create requests waiting for spilled objects to free their memory.
+  std::deque<ParkedRequest> parked_requests_;
+  /// The number of gets from another NUMA node after which objects are copied
+  /// to it, or 0.
+  int64_t numa_replication_threshold_;
+  /// The metrics of the store, and the counters and histograms in it that are
+  /// updated as requests are handled.
+  MetricsRegistry metrics_;
+  int64_t* num_created_out_of_memory_;
+  int64_t* num_evicted_objects_;
+  int64_t* num_evicted_bytes_;
+  int64_t* num_spilled_objects_;
+  int64_t* num_spilled_bytes_;
+  int64_t* num_failed_spills_;
+  int64_t* num_restored_objects_;
+  int64_t* num_restored_bytes_;
+  int64_t* num_failed_restores_;
+  int64_t* num_replicated_objects_;
+  int64_t* max_notification_backlog_;
+  int64_t* num_coalesced_notifications_;
+  int64_t* num_dropped_subscribers_;
+  /// The latency histogram of each type of request.
+  std::unordered_map<int64_t, LatencyHistogram*> request_latencies_;
 };
 
 }  // namespace plasma
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "plasma/arena_allocator.h"
+
+namespace plasma {
+
+constexpr int64_t kArenaSize = 1 << 20;
+
+class TestArenaAllocator : public ::testing::Test {
+ protected:
+  TestArenaAllocator()
+      : memory_(kArenaSize + ArenaAllocator::kMinSlotSize),
+        arena_(memory_.data(), static_cast<int64_t>(memory_.size())) {}
+
+  PlasmaAllocatorStats Stats() {
+    PlasmaAllocatorStats stats;
+    arena_.GetStats(&stats);
+    return stats;
+  }
+
+  void AssertUnfragmented() {
+    PlasmaAllocatorStats stats = Stats();
+    ASSERT_EQ(stats.num_free_blocks, 1);
+    ASSERT_EQ(stats.largest_free_block, stats.free_bytes);
+    ASSERT_GE(stats.free_bytes, kArenaSize);
+    ASSERT_EQ(stats.slab_bytes, 0);
+  }
+
+  std::vector<uint8_t> memory_;
+  ArenaAllocator arena_;
+};
+
+TEST_F(TestArenaAllocator, SlabTest) {
+  std::vector<std::pair<uint8_t*, size_t>> slots;
+  std::set<uint8_t*> unique_slots;
+  for (size_t size = 1; size <= 4096; size += 17) {
+    auto slot = static_cast<uint8_t*>(arena_.Allocate(64, size));
+    ASSERT_NE(slot, nullptr);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(slot) % 64, 0);
+    ASSERT_TRUE(unique_slots.insert(slot).second);
+    slots.emplace_back(slot, size);
+  }
+  ASSERT_GT(Stats().slab_bytes, 0);
+  for (const auto& slot : slots) {
+    arena_.Free(slot.first, slot.second);
+  }
+  AssertUnfragmented();
+}
+
+TEST_F(TestArenaAllocator, BestFitTest) {
+  void* a = arena_.Allocate(64, 100 << 10);
+  void* b = arena_.Allocate(64, 50 << 10);
+  void* c = arena_.Allocate(64, 200 << 10);
+  void* d = arena_.Allocate(64, 50 << 10);
+  ASSERT_TRUE(a && b && c && d);
+  arena_.Free(a, 100 << 10);
+  arena_.Free(c, 200 << 10);
+  ASSERT_EQ(Stats().num_free_blocks, 3);
+
+  // The smallest free blocks that fit are used, rather than the free memory
+  // after all of the blocks.
+  ASSERT_EQ(arena_.Allocate(64, 150 << 10), c);
+  ASSERT_EQ(arena_.Allocate(64, 100 << 10), a);
+  arena_.Free(a, 100 << 10);
+  arena_.Free(b, 50 << 10);
+  arena_.Free(c, 150 << 10);
+  arena_.Free(d, 50 << 10);
+  AssertUnfragmented();
+}
+
+TEST_F(TestArenaAllocator, AlignmentTest) {
+  void* small = arena_.Allocate(64, 64);
+  auto aligned = static_cast<uint8_t*>(arena_.Allocate(4096, 10000));
+  ASSERT_NE(aligned, nullptr);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(aligned) % 4096, 0);
+  arena_.Free(aligned, 10000);
+  arena_.Free(small, 64);
+  AssertUnfragmented();
+}
+
+TEST_F(TestArenaAllocator, OutOfMemoryTest) {
+  ASSERT_EQ(arena_.Allocate(64, 2 * kArenaSize), nullptr);
+  void* all = arena_.Allocate(64, kArenaSize);
+  ASSERT_NE(all, nullptr);
+  ASSERT_EQ(arena_.Allocate(64, 1), nullptr);
+  arena_.Free(all, kArenaSize);
+  AssertUnfragmented();
+}
+
+}  // namespace plasma
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
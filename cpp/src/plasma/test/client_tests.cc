@@ -25,6 +25,7 @@
 #include <chrono>
 #include <random>
 #include <thread>
+#include <unordered_map>
 
 #include <gtest/gtest.h>
 
@@ -61,7 +62,8 @@ class TestPlasmaStore : public ::testing::Test {
         test_executable.substr(0, test_executable.find_last_of("/"));
     std::string plasma_command =
         plasma_directory + "/plasma_store_server -m 10000000 -s " + store_socket_name_ +
-        " 1> /dev/null 2> /dev/null & " + "echo $! > " + store_socket_name_ + ".pid";
+        StoreOptions() + " 1> /dev/null 2> /dev/null & " + "echo $! > " +
+        store_socket_name_ + ".pid";
     system(plasma_command.c_str());
     ARROW_CHECK_OK(client_.Connect(store_socket_name_, ""));
     ARROW_CHECK_OK(client2_.Connect(store_socket_name_, ""));
@@ -99,6 +101,8 @@ class TestPlasmaStore : public ::testing::Test {
   const std::string& GetStoreSocketName() const { return store_socket_name_; }
 
  protected:
+  virtual std::string StoreOptions() const { return ""; }
+
   PlasmaClient client_;
   PlasmaClient client2_;
   std::string store_socket_name_;
@@ -150,6 +154,51 @@ TEST_F(TestPlasmaStore, NewSubscriberTest) {
   ARROW_CHECK_OK(local_client.Disconnect());
 }
 
+TEST_F(TestPlasmaStore, BatchedSubscriberTest) {
+  std::vector<ObjectID> object_ids;
+  std::shared_ptr<Buffer> data;
+  for (int64_t i = 0; i < 3; ++i) {
+    object_ids.push_back(random_object_id());
+    ARROW_CHECK_OK(client_.Create(object_ids.back(), i + 1, nullptr, 0, &data));
+    ARROW_CHECK_OK(client_.Seal(object_ids.back()));
+  }
+
+  // The existing objects arrive in one batch, which is returned one object at
+  // a time.
+  int fd = -1;
+  ARROW_CHECK_OK(client2_.Subscribe(&fd, true));
+  ASSERT_GT(fd, 0);
+  std::unordered_map<ObjectID, int64_t> sealed;
+  for (int i = 0; i < 3; ++i) {
+    ObjectID object_id;
+    int64_t data_size = 0;
+    int64_t metadata_size = -1;
+    ARROW_CHECK_OK(client2_.GetNotification(fd, &object_id, &data_size, &metadata_size));
+    ASSERT_EQ(metadata_size, 0);
+    sealed[object_id] = data_size;
+  }
+  for (int64_t i = 0; i < 3; ++i) {
+    ASSERT_EQ(sealed[object_ids[i]], i + 1);
+  }
+
+  // Objects sealed and deleted later arrive in order.
+  ObjectID object_id = random_object_id();
+  ARROW_CHECK_OK(client_.Create(object_id, 10, nullptr, 0, &data));
+  ARROW_CHECK_OK(client_.Seal(object_id));
+  ARROW_CHECK_OK(client_.Release(object_ids[0]));
+  ARROW_CHECK_OK(client_.Delete(object_ids[0]));
+  ObjectID received_id;
+  int64_t data_size;
+  int64_t metadata_size;
+  ARROW_CHECK_OK(client2_.GetNotification(fd, &received_id, &data_size, &metadata_size));
+  ASSERT_EQ(received_id, object_id);
+  ASSERT_EQ(data_size, 10);
+  ARROW_CHECK_OK(client2_.GetNotification(fd, &received_id, &data_size, &metadata_size));
+  ASSERT_EQ(received_id, object_ids[0]);
+  ASSERT_EQ(data_size, -1);
+  ASSERT_EQ(metadata_size, -1);
+}
+
 TEST_F(TestPlasmaStore, SealErrorsTest) {
   ObjectID object_id = random_object_id();
 
@@ -474,6 +523,108 @@ TEST_F(TestPlasmaStore, ManyObjectTest) {
   }
 }
 
+TEST_F(TestPlasmaStore, BatchedCreateSealReleaseTest) {
+  std::vector<ObjectID> object_ids = {random_object_id(), random_object_id(),
+                                      random_object_id()};
+  std::vector<std::shared_ptr<Buffer>> data;
+  ARROW_CHECK_OK(client_.Create(object_ids, {1, 2, 3}, {"a", "", "c"}, &data));
+  ASSERT_EQ(data.size(), 3);
+  for (size_t i = 0; i < data.size(); ++i) {
+    ASSERT_EQ(data[i]->size(), static_cast<int64_t>(i + 1));
+    memset(data[i]->mutable_data(), static_cast<int>(i), data[i]->size());
+  }
+  ARROW_CHECK_OK(client_.Seal(object_ids));
+  ASSERT_TRUE(client_.Seal(object_ids).IsPlasmaObjectAlreadySealed());
+
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get(object_ids, -1, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), 3);
+  AssertObjectBufferEqual(object_buffers[0], {'a'}, {0});
+  AssertObjectBufferEqual(object_buffers[1], {}, {1, 1});
+  AssertObjectBufferEqual(object_buffers[2], {'c'}, {2, 2, 2});
+  object_buffers.clear();
+
+  // Creating an existing object creates none of the others.
+  ObjectID new_object_id = random_object_id();
+  Status s = client_.Create({new_object_id, object_ids[0]}, {1, 1}, {"", ""}, &data);
+  ASSERT_TRUE(s.IsPlasmaObjectExists());
+  ARROW_CHECK_OK(client_.Create({new_object_id}, {1}, {""}, &data));
+  ARROW_CHECK_OK(client_.Release(new_object_id));
+  ARROW_CHECK_OK(client_.Abort(new_object_id));
+  data.clear();
+
+  // Releases are held back until the batch is full or another request is sent.
+  ARROW_CHECK_OK(client_.SetReleaseBatchSize(10));
+  ARROW_CHECK_OK(client_.Release(object_ids));
+  ObjectTable objects;
+  ARROW_CHECK_OK(client2_.List(&objects));
+  ASSERT_EQ(objects[object_ids[0]]->ref_count, 1);
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(object_ids[0], &has_object));
+  ASSERT_TRUE(has_object);
+  objects.clear();
+  ARROW_CHECK_OK(client2_.List(&objects));
+  ASSERT_EQ(objects[object_ids[0]]->ref_count, 0);
+}
+
+TEST_F(TestPlasmaStore, GetThroughObjectDirectoryTest) {
+  ObjectID object_id = random_object_id();
+  std::vector<uint8_t> data = {1, 2, 3};
+  CreateObject(client_, object_id, {42}, data);
+  // Wait for the store to handle the seal and release.
+  bool has_object;
+  ARROW_CHECK_OK(client_.Contains(object_id, &has_object));
+  ASSERT_TRUE(has_object);
+
+  // The sealed object is pinned through the object directory, and the store
+  // turns the pin into a reference of client2_.
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get({object_id}, -1, &object_buffers));
+  AssertObjectBufferEqual(object_buffers[0], {42}, {1, 2, 3});
+  ObjectTable objects;
+  ARROW_CHECK_OK(client2_.List(&objects));
+  ASSERT_EQ(objects[object_id]->ref_count, 1);
+
+  // A pinned object is only deleted once it is released.
+  ARROW_CHECK_OK(client_.Delete(object_id));
+  ARROW_CHECK_OK(client2_.Contains(object_id, &has_object));
+  ASSERT_TRUE(has_object);
+  object_buffers.clear();
+  ARROW_CHECK_OK(client2_.Contains(object_id, &has_object));
+  ASSERT_FALSE(has_object);
+
+  // A deleted object is no longer found in the directory.
+  ARROW_CHECK_OK(client2_.Get({object_id}, 0, &object_buffers));
+  ASSERT_FALSE(object_buffers[0].data);
+}
+
+class TestPlasmaStoreThreads : public TestPlasmaStore {
+ protected:
+  std::string StoreOptions() const override { return " -t 4"; }
+};
+
+TEST_F(TestPlasmaStoreThreads, GetAcrossThreadsTest) {
+  std::vector<ObjectBuffer> object_buffers;
+
+  // The clients are served by different threads, so the get of the second
+  // client is satisfied by the seal of the first one on another thread.
+  ObjectID object_id = random_object_id();
+  std::thread creator([this, object_id]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    CreateObject(client_, object_id, {42}, {3, 5, 6, 7, 9});
+  });
+  ARROW_CHECK_OK(client2_.Get({object_id}, 5000, &object_buffers));
+  creator.join();
+  ASSERT_EQ(object_buffers.size(), 1);
+  AssertObjectBufferEqual(object_buffers[0], {42}, {3, 5, 6, 7, 9});
+
+  // The timer of a get still fires on the thread of its client.
+  object_buffers.clear();
+  ARROW_CHECK_OK(client2_.Get({random_object_id()}, 50, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), 1);
+  ASSERT_FALSE(object_buffers[0].data);
+}
+
 #ifdef PLASMA_CUDA
 using arrow::cuda::CudaBuffer;
 using arrow::cuda::CudaBufferReader;
@@ -577,6 +728,48 @@ TEST_F(TestPlasmaStore, MultipleClientGPUTest) {
   AssertCudaRead(object_buffers[0].metadata, {5});
 }
 
+TEST_F(TestPlasmaStore, PooledGPUTest) {
+  // The objects are allocated from the same region of device memory, so each
+  // must be read at its own offset in it.
+  std::vector<ObjectID> object_ids;
+  for (uint8_t i = 0; i < 3; ++i) {
+    object_ids.push_back(random_object_id());
+    uint8_t data[] = {i, 7, i};
+    uint8_t metadata[] = {static_cast<uint8_t>(10 + i)};
+    std::shared_ptr<Buffer> data_buffer;
+    std::shared_ptr<CudaBuffer> gpu_buffer;
+    ARROW_CHECK_OK(client_.Create(object_ids.back(), sizeof(data), metadata,
+                                  sizeof(metadata), &data_buffer, 1));
+    ARROW_CHECK_OK(CudaBuffer::FromBuffer(data_buffer, &gpu_buffer));
+    CudaBufferWriter writer(gpu_buffer);
+    ARROW_CHECK_OK(writer.Write(data, sizeof(data)));
+    ARROW_CHECK_OK(client_.Seal(object_ids.back()));
+  }
+  // Free the memory of the first object for the next one.
+  ARROW_CHECK_OK(client_.Release(object_ids[0]));
+  ARROW_CHECK_OK(client_.Delete(object_ids[0]));
+  object_ids[0] = random_object_id();
+  uint8_t data[] = {0, 7, 0};
+  uint8_t metadata[] = {10};
+  std::shared_ptr<Buffer> data_buffer;
+  std::shared_ptr<CudaBuffer> gpu_buffer;
+  ARROW_CHECK_OK(client_.Create(object_ids[0], sizeof(data), metadata, sizeof(metadata),
+                                &data_buffer, 1));
+  ARROW_CHECK_OK(CudaBuffer::FromBuffer(data_buffer, &gpu_buffer));
+  CudaBufferWriter writer(gpu_buffer);
+  ARROW_CHECK_OK(writer.Write(data, sizeof(data)));
+  ARROW_CHECK_OK(client_.Seal(object_ids[0]));
+
+  std::vector<ObjectBuffer> object_buffers;
+  ARROW_CHECK_OK(client2_.Get(object_ids, -1, &object_buffers));
+  ASSERT_EQ(object_buffers.size(), 3);
+  for (uint8_t i = 0; i < 3; ++i) {
+    ASSERT_EQ(object_buffers[i].device_num, 1);
+    AssertCudaRead(object_buffers[i].data, {i, 7, i});
+    AssertCudaRead(object_buffers[i].metadata, {static_cast<uint8_t>(10 + i)});
+  }
+}
+
 #endif  // PLASMA_CUDA
 
 }  // namespace plasma
@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "plasma/common.h"
+#include "plasma/eviction_policy.h"
+#include "plasma/plasma.h"
+#include "plasma/test-util.h"
+
+namespace plasma {
+
+class TestEvictionPolicy : public ::testing::Test {
+ protected:
+  std::unique_ptr<EvictionPolicy> MakePolicy(const std::string& name) {
+    return EvictionPolicy::Make(name, &store_info_);
+  }
+
+  // Create an object, which its creator then seals and releases.
+  ObjectID CreateObject(EvictionPolicy* policy, int64_t size, int64_t priority = 0) {
+    ObjectID object_id = random_object_id();
+    auto entry = std::unique_ptr<ObjectTableEntry>(new ObjectTableEntry());
+    entry->data_size = size;
+    entry->metadata_size = 0;
+    entry->priority = priority;
+    store_info_.objects.emplace(object_id, std::move(entry));
+    policy->ObjectCreated(object_id);
+    UseObject(policy, object_id);
+    return object_id;
+  }
+
+  // Get and release an object, as a client would.
+  void UseObject(EvictionPolicy* policy, const ObjectID& object_id) {
+    std::vector<ObjectID> objects_to_evict;
+    policy->BeginObjectAccess(object_id, &objects_to_evict);
+    policy->EndObjectAccess(object_id, &objects_to_evict);
+    ASSERT_TRUE(objects_to_evict.empty());
+  }
+
+  std::vector<ObjectID> Evict(EvictionPolicy* policy, int64_t num_bytes) {
+    std::vector<ObjectID> objects_to_evict;
+    policy->ChooseObjectsToEvict(num_bytes, &objects_to_evict);
+    return objects_to_evict;
+  }
+
+  PlasmaStoreInfo store_info_;
+};
+
+TEST_F(TestEvictionPolicy, MakeTest) {
+  ASSERT_NE(MakePolicy("lru"), nullptr);
+  ASSERT_NE(MakePolicy("lru2"), nullptr);
+  ASSERT_NE(MakePolicy("gds"), nullptr);
+  ASSERT_EQ(MakePolicy("random"), nullptr);
+}
+
+TEST_F(TestEvictionPolicy, LRUTest) {
+  auto policy = MakePolicy("lru");
+  ObjectID hot = CreateObject(policy.get(), 10);
+  UseObject(policy.get(), hot);
+  UseObject(policy.get(), hot);
+  ObjectID one_shot = CreateObject(policy.get(), 10);
+  UseObject(policy.get(), one_shot);
+
+  ASSERT_EQ(Evict(policy.get(), 10), std::vector<ObjectID>({hot}));
+  ASSERT_EQ(Evict(policy.get(), 10), std::vector<ObjectID>({one_shot}));
+  ASSERT_TRUE(Evict(policy.get(), 10).empty());
+}
+
+TEST_F(TestEvictionPolicy, LRUKTest) {
+  auto policy = MakePolicy("lru2");
+  ObjectID hot = CreateObject(policy.get(), 10);
+  UseObject(policy.get(), hot);
+  UseObject(policy.get(), hot);
+  ObjectID one_shot = CreateObject(policy.get(), 10);
+  UseObject(policy.get(), one_shot);
+  ObjectID unused = CreateObject(policy.get(), 10);
+
+  // Objects used fewer than twice go first, least recently used first.
+  ASSERT_EQ(Evict(policy.get(), 10), std::vector<ObjectID>({one_shot}));
+  ASSERT_EQ(Evict(policy.get(), 10), std::vector<ObjectID>({unused}));
+
+  // Objects in use are not evicted.
+  std::vector<ObjectID> objects_to_evict;
+  policy->BeginObjectAccess(hot, &objects_to_evict);
+  ASSERT_TRUE(Evict(policy.get(), 10).empty());
+  policy->EndObjectAccess(hot, &objects_to_evict);
+  policy->RemoveObject(hot);
+  ASSERT_TRUE(Evict(policy.get(), 10).empty());
+}
+
+TEST_F(TestEvictionPolicy, GreedyDualSizeTest) {
+  auto policy = MakePolicy("gds");
+  ObjectID small = CreateObject(policy.get(), 10);
+  ObjectID large = CreateObject(policy.get(), 1000);
+  ObjectID cheap = CreateObject(policy.get(), 100);
+  ObjectID costly = CreateObject(policy.get(), 100, 99);
+  ASSERT_EQ(Evict(policy.get(), 1), std::vector<ObjectID>({large}));
+
+  // Of objects of the same size and priority, those not used since the last
+  // eviction go first.
+  ObjectID recent = CreateObject(policy.get(), 100);
+  ASSERT_EQ(Evict(policy.get(), 1), std::vector<ObjectID>({cheap}));
+  ASSERT_EQ(Evict(policy.get(), 1), std::vector<ObjectID>({recent}));
+
+  // Objects of higher priority are kept longer.
+  ASSERT_EQ(Evict(policy.get(), 1), std::vector<ObjectID>({small}));
+  ASSERT_EQ(Evict(policy.get(), 1), std::vector<ObjectID>({costly}));
+}
+
+}  // namespace plasma
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
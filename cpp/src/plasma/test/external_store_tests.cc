@@ -130,6 +130,29 @@ TEST_F(TestPlasmaStoreWithExternal, EvictionTest) {
   ASSERT_EQ(object_buffers[0].metadata, nullptr);
 }
 
+TEST_F(TestPlasmaStoreWithExternal, PrefetchTest) {
+  std::vector<ObjectID> object_ids;
+  std::string data(100 * 1024, 'x');
+  std::string metadata(16, 'y');
+  for (int i = 0; i < 20; i++) {
+    ObjectID object_id = random_object_id();
+    object_ids.push_back(object_id);
+    ARROW_CHECK_OK(client_.CreateAndSeal(object_id, data, metadata));
+  }
+
+  // The first objects were evicted to make room for the last ones. Restoring
+  // them ahead of the Get() should not change what it returns.
+  std::vector<ObjectID> prefetched_ids(object_ids.begin(), object_ids.begin() + 5);
+  ARROW_CHECK_OK(client_.Prefetch(prefetched_ids));
+  for (const auto& object_id : prefetched_ids) {
+    std::vector<ObjectBuffer> object_buffers;
+    ARROW_CHECK_OK(client_.Get({object_id}, -1, &object_buffers));
+    ASSERT_EQ(object_buffers.size(), 1);
+    ASSERT_TRUE(object_buffers[0].data);
+    AssertObjectBufferEqual(object_buffers[0], metadata, data);
+  }
+}
+
 }  // namespace plasma
 
 int main(int argc, char** argv) {
@@ -0,0 +1,76 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "plasma/metrics.h"
+
+namespace plasma {
+
+TEST(LatencyHistogram, Buckets) {
+  LatencyHistogram histogram;
+  histogram.Record(0);
+  histogram.Record(1);
+  histogram.Record(3);
+  histogram.Record(4);
+  histogram.Record(int64_t(1) << 40);
+  ASSERT_EQ(histogram.buckets[0], 1);
+  ASSERT_EQ(histogram.buckets[1], 1);
+  ASSERT_EQ(histogram.buckets[2], 1);
+  ASSERT_EQ(histogram.buckets[3], 1);
+  ASSERT_EQ(histogram.buckets[LatencyHistogram::kNumBuckets - 1], 1);
+  ASSERT_EQ(histogram.count, 5);
+  ASSERT_EQ(histogram.max_micros, int64_t(1) << 40);
+}
+
+TEST(LatencyHistogram, Percentile) {
+  LatencyHistogram histogram;
+  ASSERT_EQ(histogram.Percentile(0.5), 0);
+  for (int i = 0; i < 99; ++i) {
+    histogram.Record(10);
+  }
+  histogram.Record(5000);
+  // 10us falls in the bucket of latencies under 16us.
+  ASSERT_EQ(histogram.Percentile(0.5), 16);
+  ASSERT_EQ(histogram.Percentile(0.99), 16);
+  ASSERT_EQ(histogram.Percentile(1.0), 5000);
+}
+
+TEST(MetricsRegistry, Snapshot) {
+  MetricsRegistry registry;
+  int64_t* objects = registry.Value("objects");
+  *registry.Value("evictions") += 2;
+  *objects = 7;
+  // Values are registered once.
+  ASSERT_EQ(registry.Value("objects"), objects);
+  registry.Latency("PlasmaSealRequest")->Record(3);
+  PlasmaStoreMetrics metrics;
+  registry.Snapshot(&metrics);
+  ASSERT_EQ(metrics.values.size(), 2);
+  ASSERT_EQ(metrics.values[0].first, "objects");
+  ASSERT_EQ(metrics.Value("objects"), 7);
+  ASSERT_EQ(metrics.Value("evictions"), 2);
+  ASSERT_EQ(metrics.Value("missing"), -1);
+  ASSERT_EQ(metrics.latencies.size(), 1);
+  ASSERT_EQ(metrics.latencies[0].second.count, 1);
+  ASSERT_NE(metrics.ToString().find("PlasmaSealRequest count=1"), std::string::npos);
+}
+
+}  // namespace plasma
@@ -71,6 +71,7 @@ PlasmaObject random_plasma_object(void) {
   object.data_size = random + 3;
   object.metadata_size = random + 4;
   object.device_num = 0;
+  object.numa_node = random % 4;
   return object;
 }
 
@@ -80,20 +81,27 @@ TEST(PlasmaSerialization, CreateRequest) {
   int64_t data_size1 = 42;
   int64_t metadata_size1 = 11;
   int device_num1 = 0;
-  ARROW_CHECK_OK(
-      SendCreateRequest(fd, object_id1, data_size1, metadata_size1, device_num1));
+  int64_t priority1 = 7;
+  int numa_node1 = 3;
+  ARROW_CHECK_OK(SendCreateRequest(fd, object_id1, data_size1, metadata_size1,
+                                   device_num1, priority1, numa_node1));
   std::vector<uint8_t> data =
       read_message_from_file(fd, MessageType::PlasmaCreateRequest);
   ObjectID object_id2;
   int64_t data_size2;
   int64_t metadata_size2;
   int device_num2;
+  int64_t priority2;
+  int numa_node2;
   ARROW_CHECK_OK(ReadCreateRequest(data.data(), data.size(), &object_id2, &data_size2,
-                                   &metadata_size2, &device_num2));
+                                   &metadata_size2, &device_num2, &priority2,
+                                   &numa_node2));
   ASSERT_EQ(data_size1, data_size2);
   ASSERT_EQ(metadata_size1, metadata_size2);
   ASSERT_EQ(object_id1, object_id2);
   ASSERT_EQ(device_num1, device_num2);
+  ASSERT_EQ(priority1, priority2);
+  ASSERT_EQ(numa_node1, numa_node2);
   close(fd);
 }
 
@@ -117,6 +125,65 @@ TEST(PlasmaSerialization, CreateReply) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, CreateManyRequest) {
+  int fd = create_temp_file();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id()};
+  std::vector<int64_t> data_sizes1 = {42, 0};
+  std::vector<int64_t> metadata_sizes1 = {11, 7};
+  ARROW_CHECK_OK(
+      SendCreateManyRequest(fd, object_ids1, data_sizes1, metadata_sizes1, -1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaCreateManyRequest);
+  std::vector<ObjectID> object_ids2;
+  std::vector<int64_t> data_sizes2;
+  std::vector<int64_t> metadata_sizes2;
+  int numa_node2;
+  ARROW_CHECK_OK(ReadCreateManyRequest(data.data(), data.size(), &object_ids2,
+                                       &data_sizes2, &metadata_sizes2, &numa_node2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  ASSERT_EQ(data_sizes1, data_sizes2);
+  ASSERT_EQ(metadata_sizes1, metadata_sizes2);
+  ASSERT_EQ(numa_node2, -1);
+  close(fd);
+}
+
+TEST(PlasmaSerialization, CreateManyReply) {
+  int fd = create_temp_file();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id()};
+  std::vector<PlasmaObject> objects1 = {random_plasma_object(), random_plasma_object()};
+  std::vector<int> store_fds1 = {1, 2};
+  std::vector<int64_t> mmap_sizes1 = {100, 200};
+  ARROW_CHECK_OK(SendCreateManyReply(fd, object_ids1, objects1, PlasmaError::OK,
+                                     store_fds1, mmap_sizes1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaCreateManyReply);
+  std::vector<ObjectID> object_ids2;
+  std::vector<PlasmaObject> objects2;
+  std::vector<int> store_fds2;
+  std::vector<int64_t> mmap_sizes2;
+  ARROW_CHECK_OK(ReadCreateManyReply(data.data(), data.size(), &object_ids2, &objects2,
+                                     &store_fds2, &mmap_sizes2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  ASSERT_EQ(objects2.size(), 2);
+  ASSERT_EQ(memcmp(&objects1[0], &objects2[0], sizeof(PlasmaObject)), 0);
+  ASSERT_EQ(memcmp(&objects1[1], &objects2[1], sizeof(PlasmaObject)), 0);
+  ASSERT_EQ(store_fds1, store_fds2);
+  ASSERT_EQ(mmap_sizes1, mmap_sizes2);
+  close(fd);
+
+  // An error is returned along with no objects.
+  fd = create_temp_file();
+  ARROW_CHECK_OK(SendCreateManyReply(fd, {}, {}, PlasmaError::OutOfMemory, {},
+                                     std::vector<int64_t>{}));
+  data = read_message_from_file(fd, MessageType::PlasmaCreateManyReply);
+  Status s = ReadCreateManyReply(data.data(), data.size(), &object_ids2, &objects2,
+                                 &store_fds2, &mmap_sizes2);
+  ASSERT_TRUE(s.IsPlasmaStoreFull());
+  ASSERT_TRUE(object_ids2.empty());
+  ASSERT_TRUE(store_fds2.empty());
+  close(fd);
+}
+
 TEST(PlasmaSerialization, SealRequest) {
   int fd = create_temp_file();
   ObjectID object_id1 = random_object_id();
@@ -132,6 +199,22 @@ TEST(PlasmaSerialization, SealRequest) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, SealManyRequest) {
+  int fd = create_temp_file();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id()};
+  std::vector<std::string> digests1 = {std::string(kDigestSize, 7),
+                                       std::string(kDigestSize, 9)};
+  ARROW_CHECK_OK(SendSealManyRequest(fd, object_ids1, digests1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaSealManyRequest);
+  std::vector<ObjectID> object_ids2;
+  std::vector<std::string> digests2;
+  ARROW_CHECK_OK(ReadSealManyRequest(data.data(), data.size(), &object_ids2, &digests2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  ASSERT_EQ(digests1, digests2);
+  close(fd);
+}
+
 TEST(PlasmaSerialization, SealReply) {
   int fd = create_temp_file();
   ObjectID object_id1 = random_object_id();
@@ -150,15 +233,18 @@ TEST(PlasmaSerialization, GetRequest) {
   object_ids[0] = random_object_id();
   object_ids[1] = random_object_id();
   int64_t timeout_ms = 1234;
-  ARROW_CHECK_OK(SendGetRequest(fd, object_ids, 2, timeout_ms));
+  int numa_node = 1;
+  ARROW_CHECK_OK(SendGetRequest(fd, object_ids, 2, timeout_ms, numa_node));
   std::vector<uint8_t> data = read_message_from_file(fd, MessageType::PlasmaGetRequest);
   std::vector<ObjectID> object_ids_return;
   int64_t timeout_ms_return;
-  ARROW_CHECK_OK(
-      ReadGetRequest(data.data(), data.size(), object_ids_return, &timeout_ms_return));
+  int numa_node_return;
+  ARROW_CHECK_OK(ReadGetRequest(data.data(), data.size(), object_ids_return,
+                                &timeout_ms_return, &numa_node_return));
   ASSERT_EQ(object_ids[0], object_ids_return[0]);
   ASSERT_EQ(object_ids[1], object_ids_return[1]);
   ASSERT_EQ(timeout_ms, timeout_ms_return);
+  ASSERT_EQ(numa_node, numa_node_return);
   close(fd);
 }
 
@@ -209,6 +295,42 @@ TEST(PlasmaSerialization, ReleaseRequest) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, ReleaseManyRequest) {
+  int fd = create_temp_file();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id(),
+                                       random_object_id()};
+  ARROW_CHECK_OK(SendReleaseManyRequest(fd, object_ids1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaReleaseManyRequest);
+  std::vector<ObjectID> object_ids2;
+  ARROW_CHECK_OK(ReadReleaseManyRequest(data.data(), data.size(), &object_ids2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  close(fd);
+}
+
+TEST(PlasmaSerialization, PinRequest) {
+  int fd = create_temp_file();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id()};
+  ARROW_CHECK_OK(SendPinRequest(fd, object_ids1));
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType::PlasmaPinRequest);
+  std::vector<ObjectID> object_ids2;
+  ARROW_CHECK_OK(ReadPinRequest(data.data(), data.size(), &object_ids2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  close(fd);
+}
+
+TEST(PlasmaSerialization, PrefetchRequest) {
+  int fd = create_temp_file();
+  std::vector<ObjectID> object_ids1 = {random_object_id(), random_object_id()};
+  ARROW_CHECK_OK(SendPrefetchRequest(fd, object_ids1));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaPrefetchRequest);
+  std::vector<ObjectID> object_ids2;
+  ARROW_CHECK_OK(ReadPrefetchRequest(data.data(), data.size(), &object_ids2));
+  ASSERT_EQ(object_ids1, object_ids2);
+  close(fd);
+}
+
 TEST(PlasmaSerialization, ReleaseReply) {
   int fd = create_temp_file();
   ObjectID object_id1 = random_object_id();
@@ -252,6 +374,26 @@ TEST(PlasmaSerialization, DeleteReply) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, ConnectReply) {
+  int fd = create_temp_file();
+  ARROW_CHECK_OK(SendConnectReply(fd, 1 << 30, 7, 1 << 20, 4096, 1024));
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType::PlasmaConnectReply);
+  int64_t memory_capacity;
+  int directory_store_fd;
+  int64_t directory_mmap_size;
+  int64_t directory_offset;
+  int64_t directory_capacity;
+  ARROW_CHECK_OK(ReadConnectReply(data.data(), data.size(), &memory_capacity,
+                                  &directory_store_fd, &directory_mmap_size,
+                                  &directory_offset, &directory_capacity));
+  ASSERT_EQ(memory_capacity, 1 << 30);
+  ASSERT_EQ(directory_store_fd, 7);
+  ASSERT_EQ(directory_mmap_size, 1 << 20);
+  ASSERT_EQ(directory_offset, 4096);
+  ASSERT_EQ(directory_capacity, 1024);
+  close(fd);
+}
+
 TEST(PlasmaSerialization, EvictRequest) {
   int fd = create_temp_file();
   int64_t num_bytes = 111;
@@ -274,6 +416,41 @@ TEST(PlasmaSerialization, EvictReply) {
   close(fd);
 }
 
+TEST(PlasmaSerialization, SubscribeRequest) {
+  int fd = create_temp_file();
+  ARROW_CHECK_OK(SendSubscribeRequest(fd, true));
+  std::vector<uint8_t> data =
+      read_message_from_file(fd, MessageType::PlasmaSubscribeRequest);
+  bool batched = false;
+  ARROW_CHECK_OK(ReadSubscribeRequest(data.data(), data.size(), &batched));
+  ASSERT_TRUE(batched);
+  close(fd);
+}
+
+TEST(PlasmaSerialization, MetricsReply) {
+  int fd = create_temp_file();
+  MetricsRegistry registry;
+  *registry.Value("evicted_objects") = 3;
+  *registry.Value("free_bytes") = 1 << 20;
+  registry.Latency("PlasmaGetRequest")->Record(5);
+  registry.Latency("PlasmaGetRequest")->Record(900);
+  PlasmaStoreMetrics metrics1;
+  registry.Snapshot(&metrics1);
+  ARROW_CHECK_OK(SendMetricsReply(fd, metrics1));
+  std::vector<uint8_t> data = read_message_from_file(fd, MessageType::PlasmaMetricsReply);
+  PlasmaStoreMetrics metrics2;
+  ARROW_CHECK_OK(ReadMetricsReply(data.data(), data.size(), &metrics2));
+  ASSERT_EQ(metrics1.values, metrics2.values);
+  ASSERT_EQ(metrics2.latencies.size(), 1);
+  ASSERT_EQ(metrics2.latencies[0].first, "PlasmaGetRequest");
+  const LatencyHistogram& histogram = metrics2.latencies[0].second;
+  ASSERT_EQ(histogram.buckets, metrics1.latencies[0].second.buckets);
+  ASSERT_EQ(histogram.count, 2);
+  ASSERT_EQ(histogram.total_micros, 905);
+  ASSERT_EQ(histogram.max_micros, 900);
+  close(fd);
+}
+
 TEST(PlasmaSerialization, DataRequest) {
   int fd = create_temp_file();
   ObjectID object_id1 = random_object_id();
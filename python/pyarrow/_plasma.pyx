@@ -124,6 +124,8 @@ cdef extern from "plasma/client.h" nogil:
 
         CStatus Subscribe(int* fd)
 
+        CStatus Subscribe(int* fd, c_bool batched)
+
         CStatus DecodeNotification(const uint8_t* buffer,
                                    CUniqueID* object_id, int64_t* data_size,
                                    int64_t* metadata_size)
@@ -617,10 +619,19 @@ cdef class PlasmaClient:
             check_status(self.client.get().Evict(num_bytes, num_bytes_evicted))
         return num_bytes_evicted
 
-    def subscribe(self):
-        """Subscribe to notifications about sealed objects."""
+    def subscribe(self, c_bool batched=False):
+        """
+        Subscribe to notifications about sealed objects.
+
+        Parameters
+        ----------
+        batched : bool
+            Whether the store sends the notifications of many objects in one
+            message. They can then only be read with get_next_notification.
+        """
         with nogil:
-            check_status(self.client.get().Subscribe(&self.notification_fd))
+            check_status(self.client.get().Subscribe(&self.notification_fd,
+                                                     batched))
 
     def get_notification_socket(self):
         """
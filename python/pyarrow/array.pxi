@@ -349,7 +349,8 @@ cdef class _PandasConvertible:
     def to_pandas(self, categories=None, bint strings_to_categorical=False,
                   bint zero_copy_only=False, bint integer_object_nulls=False,
                   bint date_as_object=True, bint use_threads=True,
-                  bint deduplicate_objects=True, bint ignore_metadata=False):
+                  bint deduplicate_objects=True, bint ignore_metadata=False,
+                  bint split_blocks=False):
         """
         Convert to a pandas-compatible NumPy array or DataFrame, as appropriate
 
@@ -375,6 +376,11 @@ cdef class _PandasConvertible:
         ignore_metadata : boolean, default False
             If True, do not use the 'pandas' metadata to reconstruct the
             DataFrame index, if present
+        split_blocks : boolean, default False
+            If True, generate one internal "block" for each column when
+            creating a pandas.DataFrame from a RecordBatch or Table. Numeric
+            columns in one chunk without nulls are then not copied, and are
+            read-only
 
         Returns
         -------
@@ -390,7 +396,8 @@ cdef class _PandasConvertible:
             integer_object_nulls=integer_object_nulls,
             date_as_object=date_as_object,
             use_threads=use_threads,
-            deduplicate_objects=deduplicate_objects)
+            deduplicate_objects=deduplicate_objects,
+            split_blocks=split_blocks)
 
         return self._to_pandas(options, categories=categories,
                                ignore_metadata=ignore_metadata)
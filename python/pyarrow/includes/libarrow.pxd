@@ -1130,6 +1130,7 @@ cdef extern from "arrow/python/api.h" namespace "arrow::py" nogil:
         c_bool date_as_object
         c_bool use_threads
         c_bool deduplicate_objects
+        c_bool split_blocks
 
 cdef extern from "arrow/python/api.h" namespace 'arrow::py' nogil:
 
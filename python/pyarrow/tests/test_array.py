@@ -1064,6 +1064,17 @@ def test_array_from_numpy_unicode():
     assert arrow_arr.equals(expected)
 
 
+def test_array_from_numpy_unicode_non_ascii():
+    # Characters encoded with 1 to 4 bytes in UTF8
+    values = [u'a\xe9', u'\u20ac', u'\U0001f600b', u'']
+
+    for dtype in ['<U3', '>U3']:
+        arr = np.array(values, dtype=dtype)
+        arrow_arr = pa.array(arr)
+        assert arrow_arr.equals(pa.array(values, type='utf8'))
+        assert arrow_arr.to_pylist() == values
+
+
 def test_buffers_primitive():
     a = pa.array([1, 2, None, 4], type=pa.int16())
     buffers = a.buffers()
@@ -270,6 +270,32 @@ def test_sequence_integer_inferred(seq):
     assert arr.to_pylist() == expected
 
 
+def test_sequence_integer_inferred_past_sample():
+    # The type of long sequences of ints is first inferred from a sample,
+    # values further on must be accounted for all the same
+    data = list(range(5000)) + [None, 1.5]
+    arr = pa.array(data)
+    assert arr.type == pa.float64()
+    assert arr.null_count == 1
+    assert arr.to_pylist() == data
+
+    for last in [2 ** 63, True, 'a']:
+        with pytest.raises((ValueError, TypeError, pa.ArrowException)):
+            pa.array(list(range(5000)) + [last])
+
+
+def test_sequence_integer_inferred_large():
+    data = list(range(-2500, 2500)) + [None, 2 ** 63 - 1, -2 ** 63]
+    arr = pa.array(data)
+    assert arr.type == pa.int64()
+    assert arr.null_count == 1
+    assert arr.to_pylist() == data
+
+    arr = pa.array(data + [np.nan], from_pandas=True)
+    assert arr.type == pa.int64()
+    assert arr.null_count == 2
+
+
 @parametrize_with_iterable_types
 @pytest.mark.parametrize("np_scalar_pa_type", int_type_pairs)
 def test_sequence_numpy_integer(seq, np_scalar_pa_type):
@@ -2435,6 +2435,38 @@ def test_to_pandas_deduplicate_date_time():
                         len(casted_arr))
 
 
+def test_to_pandas_deduplicate_strings_across_batches():
+    # Strings are created in batches; the cache outlives each batch
+    values = ['foo', None, u'h\xe9llo'] * 20000
+    arr = pa.array(values)
+
+    result = arr.to_pandas()
+    assert list(result) == values
+    _assert_nunique(result, 3)
+
+
+def test_to_pandas_split_blocks():
+    df = pd.DataFrame({
+        'int': np.arange(5, dtype='int64'),
+        'float': np.arange(5, dtype='float32'),
+        'ts': pd.date_range('2000-01-01', periods=5),
+        'str': list('abcde'),
+        'with_nulls': [1.0, None, 3.0, 4.0, 5.0],
+    }, columns=['int', 'float', 'ts', 'str', 'with_nulls'])
+    table = pa.Table.from_pandas(df, preserve_index=False)
+
+    for use_threads in [False, True]:
+        result = table.to_pandas(split_blocks=True, use_threads=use_threads)
+        assert len(result._data.blocks) == len(df.columns)
+
+        # Columns of one chunk without nulls are not copied
+        for name in ['int', 'float', 'ts']:
+            assert not result[name].values.flags.writeable
+        assert result['with_nulls'].values.flags.writeable
+
+        tm.assert_frame_equal(result, df)
+
+
 # ---------------------------------------------------------------------
 
 def test_table_from_pandas_keeps_column_order_of_dataframe():
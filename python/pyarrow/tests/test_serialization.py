@@ -659,6 +659,23 @@ def test_serialize_subclasses():
     assert deserialized.value == 3
 
 
+def test_serialize_to_components_zero_copy():
+    arr = np.arange(100000, dtype='int64')
+    buf = pa.py_buffer(b'x' * 1000)
+
+    components = pa.serialize([arr, buf]).to_components()
+    data = components['data']
+    assert len(data) == 4
+
+    # The ndarray body and the buffer reference the original memory
+    assert data[2].address == arr.ctypes.data
+    assert data[3].address == buf.address
+
+    recons = pa.deserialize_components(components)
+    np.testing.assert_array_equal(recons[0], arr)
+    assert recons[1].to_pybytes() == buf.to_pybytes()
+
+
 def test_serialize_to_components_invalid_cases():
     buf = pa.py_buffer(b'hello')
 